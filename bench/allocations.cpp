@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include "allocations.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace bench {
+
+namespace {
+
+std::atomic<std::size_t> count_(0);
+
+} // (anon)
+
+std::size_t
+allocation_count() noexcept
+{
+    return count_.load(
+        std::memory_order_relaxed);
+}
+
+std::size_t
+peak_rss() noexcept
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if(! GetProcessMemoryInfo(
+            GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return pmc.PeakWorkingSetSize;
+#elif defined(__unix__) || defined(__APPLE__)
+    rusage ru;
+    if(getrusage(RUSAGE_SELF, &ru) != 0)
+        return 0;
+#if defined(__APPLE__)
+    // bytes
+    return static_cast<std::size_t>(ru.ru_maxrss);
+#else
+    // kilobytes
+    return static_cast<std::size_t>(ru.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // bench
+
+// Every allocation of the program goes
+// through these replacements, including
+// the ones made by the libraries
+void*
+operator new(std::size_t n)
+{
+    bench::count_.fetch_add(
+        1, std::memory_order_relaxed);
+    if(void* p = std::malloc(n ? n : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_BENCH_ALLOCATIONS_HPP
+#define BOOST_URL_BENCH_ALLOCATIONS_HPP
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace bench {
+
+// The number of calls to the global
+// operator new since the program started
+std::size_t
+allocation_count() noexcept;
+
+// The largest resident set size of the
+// process so far in bytes, or zero where
+// it is not known
+std::size_t
+peak_rss() noexcept;
+
+// Reports the allocations made while
+// a benchmark runs as allocs/op, and
+// the peak resident set size. The peak
+// is that of the whole process, so run
+// one benchmark at a time with
+// --benchmark_filter to compare them.
+class allocation_counter
+{
+    benchmark::State& state_;
+    std::size_t start_;
+
+public:
+    explicit
+    allocation_counter(
+        benchmark::State& state) noexcept
+        : state_(state)
+        , start_(allocation_count())
+    {
+    }
+
+    ~allocation_counter()
+    {
+        state_.counters["allocs/op"] =
+            benchmark::Counter(
+                static_cast<double>(
+                    allocation_count() - start_),
+                benchmark::Counter::kAvgIterations);
+        state_.counters["peak_rss"] =
+            benchmark::Counter(
+                static_cast<double>(peak_rss()),
+                benchmark::Counter::kDefaults,
+                benchmark::Counter::kIs1024);
+    }
+};
+
+} // bench
+
+#endif
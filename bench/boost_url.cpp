@@ -0,0 +1,445 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/decode_view.hpp>
+#include <boost/url/format.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/parse_whatwg.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "allocations.hpp"
+#include "corpus.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+namespace {
+
+// Parse the valid urls of a corpus
+// once, to benchmark what follows
+std::vector<urls::url>
+parsed(bench::corpus const& c)
+{
+    std::vector<urls::url> v;
+    for(auto const& s : c.urls)
+    {
+        auto rv = urls::parse_uri_reference(s);
+        if(rv)
+            v.emplace_back(*rv);
+    }
+    return v;
+}
+
+void
+report(
+    benchmark::State& state,
+    std::size_t bytes)
+{
+    state.SetBytesProcessed(static_cast<
+        std::int64_t>(state.iterations() * bytes));
+}
+
+// Also reports the urls per second, for
+// the benchmarks which parse a corpus
+void
+report(
+    benchmark::State& state,
+    bench::corpus const& c)
+{
+    report(state, c.bytes);
+    state.SetItemsProcessed(static_cast<
+        std::int64_t>(state.iterations() * c.urls.size()));
+}
+
+//------------------------------------------------
+
+void
+parse_uri(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = urls::parse_uri(s);
+                benchmark::DoNotOptimize(rv);
+            }
+        }
+    }
+    report(state, c);
+}
+
+void
+parse_uri_reference(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = urls::parse_uri_reference(s);
+                benchmark::DoNotOptimize(rv);
+            }
+        }
+    }
+    report(state, c);
+}
+
+// Parse and read every decoded size,
+// which the parser counts while it
+// validates. Compare with parse_uri
+// for the cost of the sizes.
+void
+decoded_sizes(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = urls::parse_uri(s);
+                if(! rv)
+                    continue;
+                std::size_t n =
+                    rv->encoded_userinfo().decoded_size() +
+                    rv->encoded_host().decoded_size() +
+                    rv->encoded_path().decoded_size() +
+                    rv->encoded_query().decoded_size() +
+                    rv->encoded_fragment().decoded_size();
+                benchmark::DoNotOptimize(n);
+            }
+        }
+    }
+    report(state, c);
+}
+
+// The WHATWG parser, which accepts
+// the same inputs as skyr
+void
+parse_whatwg(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = urls::parse_whatwg(s);
+                benchmark::DoNotOptimize(rv);
+            }
+        }
+    }
+    report(state, c);
+}
+
+// Parse into an owning url
+void
+url_from_string(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = urls::parse_uri_reference(s);
+                if(! rv)
+                    continue;
+                urls::url u(*rv);
+                benchmark::DoNotOptimize(u);
+            }
+        }
+    }
+    report(state, c);
+}
+
+// Iterate the decoded characters of
+// the path and the query
+void
+decode_view_iterate(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.encoded_path().size() +
+            u.encoded_query().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                unsigned sum = 0;
+                for(char c : u.encoded_path().decode())
+                    sum += static_cast<unsigned char>(c);
+                for(char c : u.encoded_query().decode())
+                    sum += static_cast<unsigned char>(c);
+                benchmark::DoNotOptimize(sum);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+// Iterate the decoded params
+void
+params_iterate(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.encoded_query().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                std::size_t n = 0;
+                for(auto p : u.params())
+                    n += p.key.size() + p.value.size();
+                benchmark::DoNotOptimize(n);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+// Iterate the decoded segments
+void
+segments_iterate(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.encoded_path().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                std::size_t n = 0;
+                for(auto s : u.segments())
+                    n += s.size();
+                benchmark::DoNotOptimize(n);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+// The copy of each url is included
+// in the measurement
+void
+normalize(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.size();
+    std::vector<urls::url> w;
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            w = v;
+            for(auto& u : w)
+                u.normalize();
+            benchmark::DoNotOptimize(w.data());
+        }
+    }
+    report(state, bytes);
+}
+
+//------------------------------------------------
+
+// Replace every part of a url in turn
+void
+set_parts(benchmark::State& state)
+{
+    auto const& c = bench::web_urls();
+    auto const v = parsed(c);
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u0 : v)
+            {
+                urls::url u = u0;
+                u.set_scheme("https");
+                u.set_encoded_user("user");
+                u.set_encoded_password("pass");
+                u.set_encoded_host("www.example.org");
+                u.set_port_number(8443);
+                u.set_encoded_path("/a/b/c");
+                u.set_encoded_query("x=1&y=2");
+                u.set_encoded_fragment("frag");
+                benchmark::DoNotOptimize(u);
+            }
+        }
+    }
+    report(state, c.bytes);
+}
+
+// Grow a path and a query one
+// element at a time
+void
+push_back_elements(benchmark::State& state)
+{
+    auto const n = static_cast<
+        std::size_t>(state.range(0));
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            urls::url u("https://www.example.com");
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                u.segments().push_back("segment");
+                u.params().append({"key", "value"});
+            }
+            benchmark::DoNotOptimize(u);
+        }
+    }
+    state.SetItemsProcessed(static_cast<
+        std::int64_t>(state.iterations() * n));
+}
+
+// Erase the params of a long query
+// one at a time from the front. The
+// copy of each url is included in
+// the measurement
+void
+erase_params(benchmark::State& state)
+{
+    auto const v = parsed(bench::long_queries());
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u0 : v)
+            {
+                urls::url u = u0;
+                auto ps = u.params();
+                while(! ps.empty())
+                    ps.erase(ps.begin());
+                benchmark::DoNotOptimize(u);
+            }
+        }
+    }
+}
+
+//------------------------------------------------
+
+void
+format(benchmark::State& state)
+{
+    std::size_t bytes = 0;
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            urls::url u = urls::format(
+                "{}://{}:{}/{}/{}?{}={}#{}",
+                "https", "www.example.com", 8080,
+                "path with spaces", "file.txt",
+                "key", "value&more", "frag ment");
+            bytes += u.size();
+            benchmark::DoNotOptimize(u);
+        }
+    }
+    state.SetBytesProcessed(static_cast<
+        std::int64_t>(bytes));
+}
+
+void
+format_to(benchmark::State& state)
+{
+    std::size_t bytes = 0;
+    urls::url u;
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            urls::format_to(u,
+                "{}://{}:{}/{}/{}?{}={}#{}",
+                "https", "www.example.com", 8080,
+                "path with spaces", "file.txt",
+                "key", "value&more", "frag ment");
+            bytes += u.size();
+            benchmark::DoNotOptimize(u);
+        }
+    }
+    state.SetBytesProcessed(static_cast<
+        std::int64_t>(bytes));
+}
+
+} // (anon)
+
+BENCHMARK_CAPTURE(parse_uri, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(parse_uri, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(parse_uri, idn_hosts, bench::idn_hosts_encoded);
+BENCHMARK_CAPTURE(parse_uri, deep_paths, bench::deep_paths);
+BENCHMARK_CAPTURE(parse_uri, access_logs, bench::access_logs);
+BENCHMARK_CAPTURE(decoded_sizes, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(decoded_sizes, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(parse_uri_reference, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(parse_uri_reference, fuzz_seeds, bench::fuzz_seeds);
+BENCHMARK_CAPTURE(parse_uri_reference, wpt_inputs, bench::wpt_inputs);
+BENCHMARK_CAPTURE(parse_uri_reference, access_logs, bench::access_logs);
+BENCHMARK_CAPTURE(parse_whatwg, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(parse_whatwg, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(parse_whatwg, deep_paths, bench::deep_paths);
+BENCHMARK_CAPTURE(parse_whatwg, fuzz_seeds, bench::fuzz_seeds);
+BENCHMARK_CAPTURE(parse_whatwg, wpt_inputs, bench::wpt_inputs);
+BENCHMARK_CAPTURE(parse_whatwg, access_logs, bench::access_logs);
+BENCHMARK_CAPTURE(url_from_string, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(url_from_string, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(decode_view_iterate, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(decode_view_iterate, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(params_iterate, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(segments_iterate, deep_paths, bench::deep_paths);
+BENCHMARK_CAPTURE(normalize, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(normalize, deep_paths, bench::deep_paths);
+BENCHMARK_CAPTURE(normalize, idn_hosts, bench::idn_hosts_encoded);
+BENCHMARK(set_parts);
+BENCHMARK(push_back_elements)->Range(8, 1024);
+BENCHMARK(erase_params);
+BENCHMARK(format);
+BENCHMARK(format_to);
@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include "corpus.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+namespace bench {
+
+namespace {
+
+// Host names with their punycode and
+// pct-encoded forms
+struct idn
+{
+    char const* utf8;
+    char const* punycode;
+};
+
+constexpr idn idns[] = {
+    { "\xe4\xbe\x8b\xe5\xad\x90.\xe6\xb5\x8b\xe8\xaf\x95",
+      "xn--fsqu00a.xn--0zwm56d" },
+    { "m\xc3\xbcnchen.de",
+      "xn--mnchen-3ya.de" },
+    { "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80.\xd1\x80\xd1\x84",
+      "xn--e1afmkfd.xn--p1ai" },
+    { "\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88.jp",
+      "xn--zckzah.jp" },
+    { "b\xc3\xbc\x63her.example",
+      "xn--bcher-kva.example" },
+};
+
+std::string
+pct_encode_all(std::string const& s)
+{
+    static constexpr char hex[] = "0123456789ABCDEF";
+    std::string r;
+    for(char c : s)
+    {
+        auto const u = static_cast<unsigned char>(c);
+        if(u < 0x80)
+        {
+            r.push_back(c);
+            continue;
+        }
+        r.push_back('%');
+        r.push_back(hex[u >> 4]);
+        r.push_back(hex[u & 0xf]);
+    }
+    return r;
+}
+
+// Reads the regular files of a ustar
+// archive, returns false on error
+bool
+read_tar(
+    std::string const& data,
+    corpus& c)
+{
+    std::size_t pos = 0;
+    while(pos + 512 <= data.size())
+    {
+        char const* h = data.data() + pos;
+        if(h[0] == '\0')
+            return true;
+        // size is octal, in 12 bytes at 124
+        std::size_t size = 0;
+        for(std::size_t i = 124; i < 136; ++i)
+        {
+            if(h[i] < '0' || h[i] > '7')
+                break;
+            size = size * 8 + static_cast<
+                std::size_t>(h[i] - '0');
+        }
+        char const type = h[156];
+        pos += 512;
+        if(pos + size > data.size())
+            return false;
+        if(type == '0' || type == '\0')
+            c.push_back(data.substr(pos, size));
+        pos += (size + 511) / 512 * 512;
+    }
+    return true;
+}
+
+} // (anon)
+
+corpus const&
+web_urls()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        char const* hosts[] = {
+            "www.example.com",
+            "api.example.org:8443",
+            "user:pass@cdn.example.net",
+            "192.168.0.1",
+            "[2001:db8::7]:8080",
+        };
+        char const* paths[] = {
+            "/",
+            "/index.html",
+            "/search",
+            "/static/js/app.min.js",
+            "/api/v1/users/12345/orders",
+            "/wiki/Uniform_Resource_Identifier",
+            "/a%20b/c%2Fd",
+        };
+        char const* queries[] = {
+            "",
+            "?q=boost+url",
+            "?id=42&sort=desc&page=3",
+            "?utm_source=news&utm_medium=email&utm_campaign=spring",
+        };
+        char const* frags[] = { "", "#top", "#section-3.1" };
+        std::size_t i = 0;
+        for(auto h : hosts)
+        for(auto p : paths)
+        for(auto q : queries)
+        {
+            c.push_back(
+                std::string(i % 2 ? "https://" : "http://") +
+                h + p + q + frags[i % 3]);
+            ++i;
+        }
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+long_queries()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        for(std::size_t n = 100; n <= 400; n += 100)
+        {
+            std::string s =
+                "https://www.example.com/search?";
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                if(i > 0)
+                    s += '&';
+                s += "key" + std::to_string(i) + "=";
+                s += i % 3 ? "value" : "va%20lue+%26";
+                s += std::to_string(i);
+            }
+            c.push_back(std::move(s));
+        }
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+idn_hosts()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        for(auto const& h : idns)
+        {
+            c.push_back(std::string("https://") +
+                h.utf8 + "/path?q=1");
+            c.push_back(std::string("http://www.") +
+                h.utf8 + ":8080/");
+        }
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+idn_hosts_encoded()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        for(auto const& h : idns)
+        {
+            c.push_back(std::string("https://") +
+                h.punycode + "/path?q=1");
+            c.push_back("http://www." +
+                pct_encode_all(h.utf8) + ":8080/");
+        }
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+deep_paths()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        for(std::size_t n = 250; n <= 1000; n += 250)
+        {
+            std::string s = "http://www.example.com";
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                if(i % 7 == 6)
+                    s += "/..";
+                else if(i % 5 == 4)
+                    s += "/.";
+                else
+                    s += "/seg" + std::to_string(i);
+            }
+            c.push_back(std::move(s));
+        }
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+fuzz_seeds()
+{
+    static corpus const c = []
+    {
+        corpus c;
+#ifdef BOOST_URL_BENCH_SEEDS
+        char const* path = std::getenv(
+            "BOOST_URL_BENCH_SEEDS");
+        if(! path)
+            path = BOOST_URL_BENCH_SEEDS;
+        std::ifstream f(path, std::ios::binary);
+        std::string const data(
+            (std::istreambuf_iterator<char>(f)),
+            std::istreambuf_iterator<char>());
+        if(! read_tar(data, c))
+            c = corpus();
+#endif
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+wpt_inputs()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        char const* inputs[] = {
+            "  http://example.com/  ",
+            "http://exa\tmple.com/pa\nth",
+            "HTTP://EXAMPLE.COM/A/B",
+            "http:\\\\example.com\\a\\b",
+            "https:example.com/path",
+            "http://example.com:80/",
+            "https://example.com:/",
+            "http://user:pa:ss@example.com/",
+            "http://@example.com/",
+            "http://0x7f.1/",
+            "http://2130706433/",
+            "http://127.0.0.0x1/",
+            "http://[0:0:0:0:0:0:13.1.68.3]/",
+            "http://[::ffff:192.168.0.1]:8080/",
+            "http://example.com/foo/%2e%2E/bar",
+            "http://example.com/foo/./bar/../baz",
+            "http://example.com/a b/c\"d<e>",
+            "http://example.com/?q='a b'&r=<>",
+            "http://example.com/#frag ment`",
+            "http://ex%41mple.com/",
+            "http://www.google.com/foo?bar=baz# \xc2\xbb",
+            "file:///C:/Windows/system32",
+            "file://localhost/etc/hosts",
+            "file:c:\\foo\\bar.html",
+            "file:/..//example",
+            "mailto:user@example.com?subject=hi",
+            "data:text/plain;base64,SGVsbG8=",
+            "javascript:alert(1)",
+            "sc://\xc3\xb1/x",
+            "non-spec:/.//p",
+            "urn:isbn:0451450523",
+            "blob:https://example.com/uuid",
+            "http://[::1",
+            "https://exa mple.com/",
+            "http://example.com:65536/",
+            "http://a:b@/www.example.com",
+            "http://%zz%66%a.com/",
+            "http:",
+            "\x01http://example.com/\x1f",
+            "http://example.com/\xe2\x9c\x93?\xe2\x9c\x93#\xe2\x9c\x93",
+        };
+        for(auto s : inputs)
+            c.push_back(s);
+        return c;
+    }();
+    return c;
+}
+
+corpus const&
+access_logs()
+{
+    static corpus const c = []
+    {
+        corpus c;
+        char const* hosts[] = {
+            "www.example.com",
+            "Api.Example.com",
+            "static.example-cdn.net:8443",
+        };
+        char const* targets[] = {
+            "/",
+            "/favicon.ico",
+            "/robots.txt",
+            "/products/12345?ref=home&utm_source=google&utm_medium=cpc&utm_campaign=summer_sale&gclid=EAIaIQobChMI",
+            "/search?q=red+shoes&size=42&color=red%2Cblue&sort=price_asc&page=2",
+            "/api/v2/events?session=3f2a9c1e-7b4d-4e8a-9f1c-2d3e4f5a6b7c&ts=1696412345123&ua=Mozilla%2F5.0%20(X11%3B%20Linux)",
+            "/track?e=%7B%22type%22%3A%22click%22%2C%22id%22%3A42%7D&v=1",
+            "/images/%E4%BE%8B%E5%AD%90/photo%201.jpg",
+            "/a/b/../c/./d.html?x=%41%42%43",
+            "/login?redirect=https%3A%2F%2Fwww.example.com%2Faccount%3Ftab%3Dorders",
+            "/static/js/vendor.8f3a1c.chunk.js",
+            "/wp-admin/../../etc/passwd",
+        };
+        for(auto h : hosts)
+        for(auto t : targets)
+            c.push_back(
+                std::string("https://") + h + t);
+        return c;
+    }();
+    return c;
+}
+
+} // bench
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_BENCH_CORPUS_HPP
+#define BOOST_URL_BENCH_CORPUS_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// A set of inputs for a benchmark
+struct corpus
+{
+    std::vector<std::string> urls;
+
+    // total size of the urls, used
+    // to report bytes per second
+    std::size_t bytes = 0;
+
+    void
+    push_back(std::string s)
+    {
+        bytes += s.size();
+        urls.push_back(std::move(s));
+    }
+};
+
+// Typical absolute URLs from web logs
+corpus const& web_urls();
+
+// URLs with hundreds of query params
+corpus const& long_queries();
+
+// URLs with internationalized hosts,
+// as UTF-8 for the WHATWG parsers
+corpus const& idn_hosts();
+
+// The same hosts in the form accepted
+// by rfc3986: punycode or pct-encoded
+corpus const& idn_hosts_encoded();
+
+// URLs with hundreds of path segments,
+// including dot segments
+corpus const& deep_paths();
+
+// The fuzz seeds in test/fuzz/seeds.tar,
+// including the invalid ones
+corpus const& fuzz_seeds();
+
+// Inputs in the style of the WHATWG URL
+// tests: spaces, tabs, backslashes, odd
+// IPv4 forms, file and opaque URLs, and
+// some which no parser accepts
+corpus const& wpt_inputs();
+
+// The request targets of an access log
+// with their hosts: tracking params,
+// session ids and encoded values
+corpus const& access_logs();
+
+} // bench
+
+#endif
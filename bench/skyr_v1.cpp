@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// The same cases as boost_url.cpp, for
+// the WHATWG parser of skyr v1 (C++17)
+
+#include <skyr/v1/url.hpp>
+#include <skyr/v1/percent_encoding/percent_decode.hpp>
+#include "allocations.hpp"
+#include "corpus.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace skyr_v1 = skyr::v1;
+
+namespace {
+
+std::vector<skyr_v1::url>
+parsed(bench::corpus const& c)
+{
+    std::vector<skyr_v1::url> v;
+    for(auto const& s : c.urls)
+    {
+        auto rv = skyr_v1::make_url(s);
+        if(rv)
+            v.push_back(std::move(*rv));
+    }
+    return v;
+}
+
+void
+report(
+    benchmark::State& state,
+    std::size_t bytes)
+{
+    state.SetBytesProcessed(static_cast<
+        std::int64_t>(state.iterations() * bytes));
+}
+
+// Also reports the urls per second, for
+// the benchmarks which parse a corpus
+void
+report(
+    benchmark::State& state,
+    bench::corpus const& c)
+{
+    report(state, c.bytes);
+    state.SetItemsProcessed(static_cast<
+        std::int64_t>(state.iterations() * c.urls.size()));
+}
+
+//------------------------------------------------
+
+void
+skyr_v1_make_url(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const& c = get();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& s : c.urls)
+            {
+                auto rv = skyr_v1::make_url(s);
+                benchmark::DoNotOptimize(rv);
+            }
+        }
+    }
+    report(state, c);
+}
+
+// Decode the path and the query
+void
+skyr_v1_percent_decode(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.pathname().size() +
+            u.search().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                auto p = skyr_v1::percent_decode(u.pathname());
+                auto q = skyr_v1::percent_decode(u.search());
+                benchmark::DoNotOptimize(p);
+                benchmark::DoNotOptimize(q);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+// Iterate the decoded params
+void
+skyr_v1_params_iterate(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.search().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                std::size_t n = 0;
+                for(auto const& p : u.search_parameters())
+                    n += p.first.size() + p.second.size();
+                benchmark::DoNotOptimize(n);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+// Replace every part of a url in turn
+void
+skyr_v1_set_parts(benchmark::State& state)
+{
+    auto const& c = bench::web_urls();
+    auto const v = parsed(c);
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u0 : v)
+            {
+                skyr_v1::url u = u0;
+                (void)u.set_protocol("https");
+                (void)u.set_username("user");
+                (void)u.set_password("pass");
+                (void)u.set_hostname("www.example.org");
+                (void)u.set_port(8443);
+                (void)u.set_pathname("/a/b/c");
+                (void)u.set_search("x=1&y=2");
+                (void)u.set_hash("frag");
+                benchmark::DoNotOptimize(u);
+            }
+        }
+    }
+    report(state, c.bytes);
+}
+
+// Serialize parsed urls
+void
+skyr_v1_href(
+    benchmark::State& state,
+    bench::corpus const& (*get)())
+{
+    auto const v = parsed(get());
+    std::size_t bytes = 0;
+    for(auto const& u : v)
+        bytes += u.href().size();
+    {
+        bench::allocation_counter ac(state);
+        for(auto _ : state)
+        {
+            for(auto const& u : v)
+            {
+                auto s = u.href();
+                benchmark::DoNotOptimize(s);
+            }
+        }
+    }
+    report(state, bytes);
+}
+
+} // (anon)
+
+BENCHMARK_CAPTURE(skyr_v1_make_url, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(skyr_v1_make_url, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(skyr_v1_make_url, idn_hosts, bench::idn_hosts);
+BENCHMARK_CAPTURE(skyr_v1_make_url, deep_paths, bench::deep_paths);
+BENCHMARK_CAPTURE(skyr_v1_make_url, fuzz_seeds, bench::fuzz_seeds);
+BENCHMARK_CAPTURE(skyr_v1_make_url, wpt_inputs, bench::wpt_inputs);
+BENCHMARK_CAPTURE(skyr_v1_make_url, access_logs, bench::access_logs);
+BENCHMARK_CAPTURE(skyr_v1_percent_decode, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(skyr_v1_percent_decode, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(skyr_v1_params_iterate, long_queries, bench::long_queries);
+BENCHMARK_CAPTURE(skyr_v1_href, web_urls, bench::web_urls);
+BENCHMARK_CAPTURE(skyr_v1_href, deep_paths, bench::deep_paths);
+BENCHMARK(skyr_v1_set_parts);
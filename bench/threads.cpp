@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Thread scaling of the allocating paths:
+// the recycle bins, url construction and
+// destruction, and persist. Each benchmark
+// runs at 1 to 128 threads, and reports the
+// throughput of all the threads together and
+// the median and tail latencies of an
+// operation, so contention on the lock of a
+// recycle bin or in the allocator shows up
+// as latency which grows with the threads.
+
+#include <boost/url/grammar/recycled.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "corpus.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+namespace {
+
+// Times one operation in every `stride`,
+// so the clock does not dominate short
+// operations, and reports percentiles of
+// the samples when it is destroyed.
+class latency_recorder
+{
+    static constexpr std::size_t stride = 16;
+
+    benchmark::State& state_;
+    std::vector<double> samples_;
+    std::size_t n_ = 0;
+
+public:
+    explicit
+    latency_recorder(
+        benchmark::State& state)
+        : state_(state)
+    {
+        samples_.reserve(1 << 16);
+    }
+
+    ~latency_recorder()
+    {
+        if(samples_.empty())
+            return;
+        std::sort(samples_.begin(), samples_.end());
+        auto const at = [this](double q)
+        {
+            auto i = static_cast<std::size_t>(
+                q * static_cast<double>(
+                    samples_.size() - 1));
+            return samples_[i];
+        };
+        // averaged over the threads
+        state_.counters["p50_ns"] = benchmark::Counter(
+            at(0.5), benchmark::Counter::kAvgThreads);
+        state_.counters["p99_ns"] = benchmark::Counter(
+            at(0.99), benchmark::Counter::kAvgThreads);
+        state_.counters["p999_ns"] = benchmark::Counter(
+            at(0.999), benchmark::Counter::kAvgThreads);
+        state_.counters["max_ns"] = benchmark::Counter(
+            samples_.back(), benchmark::Counter::kAvgThreads);
+    }
+
+    template<class F>
+    void
+    operator()(F&& f)
+    {
+        if(n_++ % stride != 0)
+        {
+            f();
+            return;
+        }
+        auto const t0 =
+            std::chrono::steady_clock::now();
+        f();
+        auto const t1 =
+            std::chrono::steady_clock::now();
+        samples_.push_back(static_cast<double>(
+            std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                    t1 - t0).count()));
+    }
+};
+
+void
+report(
+    benchmark::State& state,
+    std::size_t items)
+{
+    state.SetItemsProcessed(static_cast<
+        std::int64_t>(items));
+}
+
+//------------------------------------------------
+
+// The global bin, shared by every thread
+void
+recycled_global(benchmark::State& state)
+{
+    std::size_t items = 0;
+    {
+        latency_recorder rec(state);
+        for(auto _ : state)
+        {
+            rec([]
+            {
+                urls::grammar::recycled_ptr<
+                    std::string> p;
+                p->assign(64, 'x');
+                benchmark::DoNotOptimize(p->data());
+            });
+            ++items;
+        }
+    }
+    report(state, items);
+}
+
+// One bin shared by every thread
+void
+recycled_shared(benchmark::State& state)
+{
+    static urls::grammar::recycled<
+        std::string> bin;
+    std::size_t items = 0;
+    {
+        latency_recorder rec(state);
+        for(auto _ : state)
+        {
+            rec([]
+            {
+                urls::grammar::recycled_ptr<
+                    std::string> p(bin);
+                p->assign(64, 'x');
+                benchmark::DoNotOptimize(p->data());
+            });
+            ++items;
+        }
+    }
+    report(state, items);
+}
+
+// Construct and destroy a url from
+// each string of the corpus
+void
+url_lifetime(benchmark::State& state)
+{
+    auto const& c = bench::web_urls();
+    std::size_t items = 0;
+    std::size_t i =
+        static_cast<std::size_t>(
+            state.thread_index());
+    {
+        latency_recorder rec(state);
+        for(auto _ : state)
+        {
+            auto const& s =
+                c.urls[i++ % c.urls.size()];
+            rec([&s]
+            {
+                auto rv = urls::parse_uri(s);
+                if(rv)
+                {
+                    urls::url u(*rv);
+                    benchmark::DoNotOptimize(u.data());
+                }
+            });
+            ++items;
+        }
+    }
+    report(state, items);
+}
+
+// Make shared copies of views, and release
+// them, as a cache of urls would
+void
+persist(benchmark::State& state)
+{
+    auto const& c = bench::web_urls();
+    std::vector<urls::url_view> views;
+    for(auto const& s : c.urls)
+    {
+        auto rv = urls::parse_uri(s);
+        if(rv)
+            views.push_back(*rv);
+    }
+    std::size_t items = 0;
+    std::size_t i =
+        static_cast<std::size_t>(
+            state.thread_index());
+    {
+        latency_recorder rec(state);
+        for(auto _ : state)
+        {
+            auto const& v =
+                views[i++ % views.size()];
+            rec([&v]
+            {
+                auto sp = v.persist();
+                benchmark::DoNotOptimize(sp.get());
+            });
+            ++items;
+        }
+    }
+    report(state, items);
+}
+
+} // (anon)
+
+BENCHMARK(recycled_global)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(recycled_shared)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(url_lifetime)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(persist)->ThreadRange(1, 128)->UseRealTime();
@@ -0,0 +1,308 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+//[example_dedupe
+
+/*
+    This example removes the duplicates from
+    a file with one URL per line, such as a
+    crawl dataset, using every core. Two URLs
+    are duplicates when they are equal after
+    normalization, so the output is the same
+    as normalizing every URL and keeping the
+    first line with each normalized form.
+
+    Nothing is normalized into a new string.
+    In the first pass, worker threads parse
+    the lines of each chunk and compute the
+    fingerprint of each normalized URL. The
+    fingerprint selects one of many shards,
+    and each chunk records the lines which
+    belong to each shard.
+
+    In the second pass, every shard is owned
+    by one thread at a time, so no locks are
+    needed. The shard visits the lines which
+    belong to it in file order and inserts
+    them into a url_set, which compares the
+    URLs only when their fingerprints match.
+    The first line with each normalized form
+    is kept, and the result does not depend
+    on the number of threads.
+
+    The unique lines are written to standard
+    output in file order, and the statistics
+    to standard error. Lines which are not
+    valid URI references are dropped.
+*/
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url_set.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+// A line of the file
+struct line
+{
+    core::string_view s;
+    std::uint32_t shard = 0;
+    bool valid = false;
+    bool keep = false;
+};
+
+// The lines of a chunk
+struct chunk
+{
+    char const* first;
+    char const* last;
+    std::vector<line> lines;
+
+    // the valid lines, ordered by shard,
+    // and where each shard starts
+    std::vector<std::uint32_t> order;
+    std::vector<std::uint32_t> offsets;
+};
+
+// Split [first, last) into chunks of about
+// `size` characters which end after a newline
+std::vector<chunk>
+split(
+    char const* first,
+    char const* last,
+    std::size_t size)
+{
+    std::vector<chunk> v;
+    while (first != last)
+    {
+        char const* it = last;
+        if (static_cast<std::size_t>(last - first) > size)
+        {
+            auto const nl = static_cast<char const*>(
+                std::memchr(
+                    first + size, '\n',
+                    last - first - size));
+            if (nl)
+                it = nl + 1;
+        }
+        chunk c;
+        c.first = first;
+        c.last = it;
+        v.push_back(std::move(c));
+        first = it;
+    }
+    return v;
+}
+
+// Parse every line of a chunk and
+// assign the valid ones to shards
+void
+fingerprint(
+    chunk& c,
+    std::size_t shards)
+{
+    char const* it = c.first;
+    while (it != c.last)
+    {
+        auto nl = static_cast<char const*>(
+            std::memchr(it, '\n', c.last - it));
+        char const* const end = nl ? nl : c.last;
+        line ln;
+        ln.s = core::string_view(it, end - it);
+        if (!ln.s.empty() && ln.s.back() == '\r')
+            ln.s.remove_suffix(1);
+        auto rv = urls::parse_uri_reference(ln.s);
+        if (rv)
+        {
+            ln.valid = true;
+            // the high bits, as url_set
+            // uses the low bits
+            std::uint64_t const fp = rv->fingerprint();
+            ln.shard = static_cast<std::uint32_t>(
+                (fp >> 32) % shards);
+        }
+        c.lines.push_back(ln);
+        it = nl ? nl + 1 : c.last;
+    }
+
+    // counting sort, which keeps
+    // the lines in file order
+    c.offsets.assign(shards + 1, 0);
+    for (auto const& l : c.lines)
+        if (l.valid)
+            ++c.offsets[l.shard + 1];
+    std::partial_sum(
+        c.offsets.begin(), c.offsets.end(),
+        c.offsets.begin());
+    c.order.resize(c.offsets.back());
+    std::vector<std::uint32_t> pos(
+        c.offsets.begin(), c.offsets.end() - 1);
+    for (std::size_t i = 0; i < c.lines.size(); ++i)
+        if (c.lines[i].valid)
+            c.order[pos[c.lines[i].shard]++] =
+                static_cast<std::uint32_t>(i);
+}
+
+// Keep the first line with each
+// normalized form in a shard
+std::size_t
+dedupe(
+    std::vector<chunk>& chunks,
+    std::size_t shard)
+{
+    urls::url_set seen;
+    for (auto& c : chunks)
+    {
+        for (auto j = c.offsets[shard];
+            j != c.offsets[shard + 1]; ++j)
+        {
+            auto& ln = c.lines[c.order[j]];
+            urls::url_view u =
+                urls::parse_uri_reference(ln.s).value();
+            ln.keep = seen.insert(u).second;
+        }
+    }
+    return seen.size();
+}
+
+// Call f(i) for every i in [0, n), from
+// up to `threads` threads which take the
+// next index from a shared counter
+template<class F>
+void
+parallel(
+    std::size_t threads,
+    std::size_t n,
+    F const& f)
+{
+    std::atomic<std::size_t> next(0);
+    auto work = [&]
+    {
+        for (;;)
+        {
+            std::size_t const i = next++;
+            if (i >= n)
+                return;
+            f(i);
+        }
+    };
+    std::vector<std::thread> pool;
+    std::size_t const m = (std::min)(threads, n);
+    for (std::size_t i = 1; i < m; ++i)
+        pool.emplace_back(work);
+    work();
+    for (auto& t : pool)
+        t.join();
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << argv[0] << "\n";
+        std::cerr << "Usage: dedupe <file> <threads> <shards> <chunk_size>\n"
+                     "options:\n"
+                     "    <file>:             File with one URL per line (required)\n"
+                     "    <threads>:          Number of worker threads (default: hardware concurrency)\n"
+                     "    <shards>:           Number of shards (default: 16 times the threads)\n"
+                     "    <chunk_size>:       Approximate chunk size in bytes (default: 262144)\n"
+                     "examples:\n"
+                     "dedupe urls.txt > unique.txt\n"
+                     "dedupe urls.txt 64 4096 1048576 > unique.txt\n";
+        return EXIT_FAILURE;
+    }
+
+    std::size_t threads = std::thread::hardware_concurrency();
+    if (argc > 2)
+        threads = std::strtoul(argv[2], nullptr, 10);
+    if (threads == 0)
+        threads = 1;
+    std::size_t shards = 16 * threads;
+    if (argc > 3)
+        shards = std::strtoul(argv[3], nullptr, 10);
+    if (shards == 0)
+        shards = 1;
+    std::size_t chunk_size = 256 * 1024;
+    if (argc > 4)
+        chunk_size = std::strtoul(argv[4], nullptr, 10);
+    if (chunk_size == 0)
+        chunk_size = 1;
+
+    std::ifstream fin(argv[1], std::ios::binary);
+    if (!fin)
+    {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+    std::string const data(
+        (std::istreambuf_iterator<char>(fin)),
+        std::istreambuf_iterator<char>());
+
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<chunk> chunks = split(
+        data.data(), data.data() + data.size(), chunk_size);
+
+    parallel(threads, chunks.size(), [&](std::size_t i)
+    {
+        fingerprint(chunks[i], shards);
+    });
+    std::atomic<std::size_t> unique(0);
+    parallel(threads, shards, [&](std::size_t i)
+    {
+        unique += dedupe(chunks, i);
+    });
+    auto const elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // Write the unique lines in file order
+    std::size_t lines = 0;
+    std::size_t invalid = 0;
+    for (auto const& c : chunks)
+    {
+        for (auto const& ln : c.lines)
+        {
+            if (ln.keep)
+                std::cout.write(ln.s.data(), ln.s.size()) << "\n";
+            else if (!ln.valid)
+                ++invalid;
+        }
+        lines += c.lines.size();
+    }
+
+    std::cerr <<
+        "lines:      " << lines <<
+        "\nunique:     " << unique <<
+        "\nduplicates: " << lines - invalid - unique <<
+        "\ninvalid:    " << invalid <<
+        "\nshards:     " << shards <<
+        "\nthreads:    " << threads <<
+        "\ntime:       " << elapsed << " s";
+    if (elapsed > 0)
+        std::cerr <<
+            "\nrate:       " << static_cast<double>(data.size()) / elapsed / 1e6 << " MB/s";
+    std::cerr << "\n";
+    return EXIT_SUCCESS;
+}
+
+//]
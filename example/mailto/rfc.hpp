@@ -9,11 +9,11 @@
 #define BOOST_URL_EXAMPLE_MAILTO_MAILTO_GRAMMAR_HPP
 
 #include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/url/grammar/basic_range_rule.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
 #include <boost/url/grammar/digit_chars.hpp>
 #include <boost/url/grammar/optional_rule.hpp>
-#include <boost/url/grammar/range_rule.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
 #include <boost/url/grammar/variant_rule.hpp>
@@ -141,7 +141,7 @@ constexpr auto atext_token =
 
 /// Rule for dot-atom-text = 1*atext *("." 1*atext)
 constexpr auto dot_atom_text_rule =
-    grammar::range_rule(
+    grammar::basic_range_rule(
         atext_token,
         grammar::tuple_rule(
             grammar::squelch(
@@ -187,7 +187,7 @@ constexpr auto quoted_pair_rule =
 constexpr auto obs_fws_rule =
     grammar::tuple_rule(
         grammar::token_rule(wsp_chars),
-        grammar::range_rule(
+        grammar::basic_range_rule(
             grammar::delim_rule(crlf_chars),
             grammar::token_rule(wsp_chars)));
 
@@ -268,7 +268,7 @@ namespace detail
                 it, end,
                 grammar::tuple_rule(
                     grammar::delim_rule('('),
-                    grammar::range_rule(
+                    grammar::basic_range_rule(
                         grammar::tuple_rule(
                             grammar::optional_rule(fws_rule),
                             ccontent_rule_t{})),
@@ -290,7 +290,7 @@ constexpr auto comment_rule =
 constexpr auto cfws_rule =
     grammar::variant_rule(
         grammar::tuple_rule(
-            grammar::range_rule(
+            grammar::basic_range_rule(
                 grammar::tuple_rule(
                     grammar::optional_rule(fws_rule),
                     comment_rule), 1),
@@ -308,7 +308,7 @@ constexpr auto quoted_string_rule =
     grammar::tuple_rule(
         grammar::optional_rule(cfws_rule),
         grammar::delim_rule('"'),
-        grammar::range_rule(
+        grammar::basic_range_rule(
             grammar::tuple_rule(
                 grammar::optional_rule(fws_rule),
                 qcontent_rule)),
@@ -332,7 +332,7 @@ constexpr auto addr_spec_rule =
 
 /// Rule for to = addr-spec *("," addr-spec )
 constexpr auto to_rule =
-    grammar::range_rule(
+    grammar::basic_range_rule(
         addr_spec_rule,
         grammar::tuple_rule(
             grammar::squelch(
@@ -16,8 +16,13 @@
 
 #include <boost/url/url.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include <boost/system/system_error.hpp>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
 
 namespace urls = boost::urls;
 
@@ -25,12 +30,14 @@ int main(int argc, char** argv)
 {
     if (argc < 2) {
         std::cout << argv[0] << "\n";
-        std::cout << "Usage: suffix_list <url> <suffix_list>\n"
+        std::cout << "Usage: suffix_list <url> <suffix_list> <output>\n"
                      "options:\n"
                      "    <url>:              A valid url (required)\n"
-                     "    <suffix_list>:      File with the public suffix list (default: public_suffix_list.dat)\n"
+                     "    <suffix_list>:      File with the public suffix list, as text or compiled (default: public_suffix_list.dat)\n"
+                     "    <output>:           File to store the compiled list (optional)\n"
                      "examples:\n"
-                     "suffix_list \"www.example.com\" \"public_suffix_list.dat\"\n";
+                     "suffix_list \"https://www.example.com\" \"public_suffix_list.dat\" \"public_suffix_list.bin\"\n"
+                     "suffix_list \"https://www.example.com\" \"public_suffix_list.bin\"\n";
         return EXIT_FAILURE;
     }
 
@@ -40,42 +47,42 @@ int main(int argc, char** argv)
         argc < 3 ?
             "public_suffix_list.dat" :
             argv[2];
-    std::ifstream fin(filename);
-    if (fin.bad())
+    std::ifstream fin(filename, std::ios::binary);
+    if (!fin)
     {
         std::cerr << "Cannot open " << filename << "\n";
         return EXIT_FAILURE;
     }
 
-    std::string comment;
-    std::string suffix;
-    std::string line;
-    while (std::getline(fin, line))
+    // A compiled list is used in place. The
+    // text rules are only compiled when the
+    // file is not a compiled list already.
+    std::string contents(
+        (std::istreambuf_iterator<char>(fin)),
+        std::istreambuf_iterator<char>());
+    urls::public_suffix_list compiled;
+    urls::public_suffix_list_view psl;
+    try
     {
-        boost::core::string_view sv(line);
-        if (sv.starts_with("//") && suffix.empty())
-        {
-            comment.append(sv.substr(3));
-            comment.append("\n");
-        }
-        else if (line.empty())
-        {
-            if (suffix.empty())
-                comment.clear();
-            else
-                break;
-        }
-        else if (u.encoded_host().ends_with(line))
-        {
-            suffix = line;
-        }
+        psl = urls::public_suffix_list_view(contents);
+    }
+    catch (boost::system::system_error const&)
+    {
+        compiled = urls::public_suffix_list(contents);
+        psl = compiled;
+    }
+
+    if (argc > 3)
+    {
+        std::ofstream fout(argv[3], std::ios::binary);
+        fout.write(psl.data().data(), psl.data().size());
     }
 
     std::cout <<
         "url:    \n" << u                << "\n\n"
         "host:   \n" << u.encoded_host() << "\n\n"
-        "suffix: \n" << suffix           << "\n\n"
-        "detail: \n" << comment          << "\n\n";
+        "suffix: \n" << psl.public_suffix(u.encoded_host()) << "\n\n"
+        "domain: \n" << psl.registrable_domain(u.encoded_host()) << "\n\n";
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+//[example_validate
+
+/*
+    This example validates a file with one
+    URL per line, such as a crawl frontier
+    or a request log, using every core.
+
+    The file is mapped into memory and split
+    into chunks which end at line boundaries.
+    Worker threads take the next chunk from a
+    shared counter until none are left, so a
+    thread which finishes early keeps taking
+    work from the others, and parse every
+    line with parse_uri_reference. The views
+    reference the mapped file: no line is
+    copied.
+
+    Each chunk records the number of lines
+    and the offset and error of every invalid
+    line. When all chunks are done, the line
+    numbers are computed from the counts of
+    the previous chunks, and the statistics
+    are printed.
+*/
+
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace ipc = boost::interprocess;
+namespace core = boost::core;
+
+// An invalid line
+struct failure
+{
+    std::size_t offset;
+    boost::system::error_code ec;
+};
+
+// The results of a chunk
+struct chunk
+{
+    char const* first;
+    char const* last;
+    std::size_t lines = 0;
+    std::vector<failure> failures;
+};
+
+// Split [first, last) into chunks of about
+// `size` characters which end after a newline
+std::vector<chunk>
+split(
+    char const* first,
+    char const* last,
+    std::size_t size)
+{
+    std::vector<chunk> v;
+    while (first != last)
+    {
+        char const* it = last;
+        if (static_cast<std::size_t>(last - first) > size)
+        {
+            auto const nl = static_cast<char const*>(
+                std::memchr(
+                    first + size, '\n',
+                    last - first - size));
+            if (nl)
+                it = nl + 1;
+        }
+        chunk c;
+        c.first = first;
+        c.last = it;
+        v.push_back(std::move(c));
+        first = it;
+    }
+    return v;
+}
+
+// Parse every line of a chunk
+void
+validate(
+    chunk& c,
+    char const* base)
+{
+    char const* it = c.first;
+    while (it != c.last)
+    {
+        auto nl = static_cast<char const*>(
+            std::memchr(it, '\n', c.last - it));
+        char const* const end = nl ? nl : c.last;
+        core::string_view s(it, end - it);
+        if (!s.empty() && s.back() == '\r')
+            s.remove_suffix(1);
+        auto rv = urls::parse_uri_reference(s);
+        if (rv.has_error())
+            c.failures.push_back({
+                static_cast<std::size_t>(it - base),
+                rv.error() });
+        ++c.lines;
+        it = nl ? nl + 1 : c.last;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cout << argv[0] << "\n";
+        std::cout << "Usage: validate <file> <threads> <chunk_size> <max_errors>\n"
+                     "options:\n"
+                     "    <file>:             File with one URL per line (required)\n"
+                     "    <threads>:          Number of worker threads (default: hardware concurrency)\n"
+                     "    <chunk_size>:       Approximate chunk size in bytes (default: 262144)\n"
+                     "    <max_errors>:       Number of invalid lines to print (default: 20)\n"
+                     "examples:\n"
+                     "validate urls.txt\n"
+                     "validate urls.txt 8 1048576 100\n";
+        return EXIT_FAILURE;
+    }
+
+    std::size_t threads = std::thread::hardware_concurrency();
+    if (argc > 2)
+        threads = std::strtoul(argv[2], nullptr, 10);
+    if (threads == 0)
+        threads = 1;
+    std::size_t chunk_size = 256 * 1024;
+    if (argc > 3)
+        chunk_size = std::strtoul(argv[3], nullptr, 10);
+    if (chunk_size == 0)
+        chunk_size = 1;
+    std::size_t max_errors = 20;
+    if (argc > 4)
+        max_errors = std::strtoul(argv[4], nullptr, 10);
+
+    std::ifstream fin(argv[1], std::ios::binary | std::ios::ate);
+    if (!fin)
+    {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // An empty file cannot be mapped
+    ipc::mapped_region region;
+    char const* first = "";
+    std::size_t size = 0;
+    if (fin.tellg() > 0)
+    {
+        try
+        {
+            ipc::file_mapping file(argv[1], ipc::read_only);
+            ipc::mapped_region r(file, ipc::read_only);
+            region.swap(r);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "Cannot map " << argv[1] << ": " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+        region.advise(ipc::mapped_region::advice_sequential);
+        first = static_cast<char const*>(region.get_address());
+        size = region.get_size();
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<chunk> chunks = split(first, first + size, chunk_size);
+    std::atomic<std::size_t> next(0);
+    auto work = [&]
+    {
+        for (;;)
+        {
+            std::size_t const i = next++;
+            if (i >= chunks.size())
+                return;
+            validate(chunks[i], first);
+        }
+    };
+    std::vector<std::thread> pool;
+    threads = (std::max)(std::size_t(1),
+        (std::min)(threads, chunks.size()));
+    for (std::size_t i = 1; i < threads; ++i)
+        pool.emplace_back(work);
+    work();
+    for (auto& t : pool)
+        t.join();
+    auto const elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // Merge the results in file order
+    std::size_t lines = 0;
+    std::size_t invalid = 0;
+    std::size_t printed = 0;
+    std::map<std::string, std::size_t> stats;
+    for (auto const& c : chunks)
+    {
+        for (auto const& f : c.failures)
+        {
+            ++stats[f.ec.message()];
+            if (printed < max_errors)
+            {
+                // line number of the failure
+                std::size_t const n = lines + 1 +
+                    static_cast<std::size_t>(std::count(
+                        c.first, first + f.offset, '\n'));
+                std::cout <<
+                    "line " << n << " (offset " << f.offset << "): " <<
+                    f.ec.message() << "\n";
+                ++printed;
+            }
+        }
+        lines += c.lines;
+        invalid += c.failures.size();
+    }
+
+    std::cout <<
+        "\nlines:   " << lines <<
+        "\nvalid:   " << lines - invalid <<
+        "\ninvalid: " << invalid <<
+        "\nchunks:  " << chunks.size() <<
+        "\nthreads: " << threads <<
+        "\ntime:    " << elapsed << " s";
+    if (elapsed > 0)
+        std::cout <<
+            "\nrate:    " << static_cast<double>(size) / elapsed / 1e6 << " MB/s";
+    std::cout << "\n";
+    if (!stats.empty())
+    {
+        std::cout << "\nerrors:\n";
+        for (auto const& e : stats)
+            std::cout << "    " << e.second << "\t" << e.first << "\n";
+    }
+    return invalid == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//]
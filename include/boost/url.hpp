@@ -12,40 +12,105 @@
 
 #include <boost/url/grammar.hpp>
 
+#include <boost/url/authority.hpp>
 #include <boost/url/authority_view.hpp>
+#include <boost/url/basic_url.hpp>
+#include <boost/url/cache_key_builder.hpp>
+#include <boost/url/canonical_request.hpp>
+#include <boost/url/compact_url_view.hpp>
+#include <boost/url/compiled_format.hpp>
+#include <boost/url/cookie_match.hpp>
+#include <boost/url/data_url_view.hpp>
+#include <boost/url/decode_in_place.hpp>
+#include <boost/url/decode_validate_utf8.hpp>
 #include <boost/url/decode_view.hpp>
+#include <boost/url/edit_session.hpp>
 #include <boost/url/encode.hpp>
 #include <boost/url/encoding_opts.hpp>
+#include <boost/url/endpoint_key.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/error_types.hpp>
+#include <boost/url/file_router.hpp>
+#include <boost/url/form_encoder.hpp>
+#include <boost/url/form_parser.hpp>
 #include <boost/url/format.hpp>
+#include <boost/url/gather.hpp>
+#include <boost/url/host_interner.hpp>
+#include <boost/url/host_policy_table.hpp>
 #include <boost/url/host_type.hpp>
+#include <boost/url/hot_table.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
+#include <boost/url/magnet_link_view.hpp>
+#include <boost/url/mailto_view.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/url/normalize.hpp>
 #include <boost/url/optional.hpp>
+#include <boost/url/origin_view.hpp>
 #include <boost/url/param.hpp>
+#include <boost/url/param_key_set.hpp>
+#include <boost/url/param_values_view.hpp>
 #include <boost/url/params_base.hpp>
 #include <boost/url/params_encoded_base.hpp>
 #include <boost/url/params_encoded_ref.hpp>
 #include <boost/url/params_encoded_view.hpp>
+#include <boost/url/params_index.hpp>
 #include <boost/url/params_ref.hpp>
 #include <boost/url/params_view.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/parse_cache.hpp>
+#include <boost/url/parse_iri.hpp>
+#include <boost/url/parse_options.hpp>
 #include <boost/url/parse_path.hpp>
 #include <boost/url/parse_query.hpp>
+#include <boost/url/parse_whatwg.hpp>
+#include <boost/url/path_prefix_index.hpp>
 #include <boost/url/pct_string_view.hpp>
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include <boost/url/resolver.hpp>
+#include <boost/url/robots_matcher.hpp>
+#include <boost/url/route_literal.hpp>
+#include <boost/url/router.hpp>
 #include <boost/url/scheme.hpp>
+#include <boost/url/scheme_registry.hpp>
 #include <boost/url/segments_base.hpp>
 #include <boost/url/segments_encoded_base.hpp>
 #include <boost/url/segments_encoded_ref.hpp>
 #include <boost/url/segments_encoded_view.hpp>
 #include <boost/url/segments_ref.hpp>
 #include <boost/url/segments_view.hpp>
+#include <boost/url/shared_url.hpp>
+#include <boost/url/small_url.hpp>
+#include <boost/url/sort_urls.hpp>
 #include <boost/url/static_url.hpp>
+#include <boost/url/stats.hpp>
+#include <boost/url/stream_parser.hpp>
+#include <boost/url/uri_template.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/url_base.hpp>
+#include <boost/url/url_batch.hpp>
+#include <boost/url/url_builder.hpp>
+#include <boost/url/url_classifier.hpp>
+#include <boost/url/url_delta.hpp>
+#include <boost/url/url_dictionary.hpp>
+#include <boost/url/url_edit.hpp>
+#include <boost/url/url_features.hpp>
+#include <boost/url/url_fingerprint.hpp>
+#include <boost/url/url_image.hpp>
+#include <boost/url/url_index.hpp>
+#include <boost/url/url_interner.hpp>
+#include <boost/url/url_list.hpp>
+#include <boost/url/url_literal.hpp>
+#include <boost/url/url_map.hpp>
+#include <boost/url/url_record.hpp>
+#include <boost/url/url_rule_set.hpp>
+#include <boost/url/url_sanitizer.hpp>
+#include <boost/url/url_scanner.hpp>
+#include <boost/url/url_set.hpp>
+#include <boost/url/url_sharder.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/url_view_base.hpp>
 #include <boost/url/urls.hpp>
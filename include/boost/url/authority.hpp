@@ -0,0 +1,618 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_AUTHORITY_HPP
+#define BOOST_URL_AUTHORITY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** A modifiable container for an authority
+
+    This container owns the characters of a
+    valid authority, and keeps the offsets of
+    its parts as an @ref authority_view does.
+    Its userinfo, host, and port can be
+    replaced or removed in place: only the
+    characters after the part are moved, and
+    the offsets of the following parts are
+    adjusted.
+
+    Authorities of up to @ref inline_capacity
+    characters are stored in the object itself.
+    When an edit needs more characters, the
+    buffer is replaced by one of exactly the
+    new size, so that a rewritten authority
+    occupies no more memory than it needs.
+
+    @par Example
+    @code
+    authority a( request.header( "Host" ) );
+    a.set_host( "backend.internal" ).set_port_number( 8080 );
+    request.set_header( "Host", a.buffer() );
+    @endcode
+
+    @par BNF
+    @code
+    authority     = [ userinfo "@" ] host [ ":" port ]
+
+    userinfo      = user [ ":" [ password ] ]
+
+    host          = IP-literal / IPv4address / reg-name
+
+    port          = *DIGIT
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-3.2"
+        >3.2. Authority (rfc3986)</a>
+
+    @see
+        @ref authority_view,
+        @ref parse_authority.
+*/
+class BOOST_URL_DECL
+    authority
+    : private detail::parts_base
+{
+public:
+    /** The number of characters stored inline
+    */
+    static constexpr std::size_t
+        inline_capacity = 63;
+
+private:
+    detail::url_impl u_;
+    char* s_;
+    std::size_t cap_;
+    char buf_[inline_capacity + 1];
+
+    void copy(authority_view const& a);
+    char* resize(int first, int last, std::size_t n);
+    char* resize(int id, std::size_t n);
+    void set_host_ipvfuture(core::string_view s);
+
+public:
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Destructor
+
+        Any views which reference this
+        object are invalidated.
+    */
+    ~authority();
+
+    /** Constructor
+
+        Default constructed authorities
+        have an empty host, no userinfo,
+        and no port.
+
+        @par Postconditions
+        @code
+        this->empty() == true
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    authority() noexcept;
+
+    /** Constructor
+
+        This function constructs an authority
+        from the string `s`, which must be a
+        valid authority.
+
+        @par Example
+        @code
+        authority a( "user:pass@www.example.com:8080" );
+        @endcode
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input does not contain a valid authority.
+
+        @param s The string to parse.
+    */
+    explicit
+    authority(core::string_view s);
+
+    /** Constructor
+
+        The characters of `a` are copied.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param a The authority to copy.
+    */
+    authority(authority_view const& a);
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param other The authority to copy.
+    */
+    authority(authority const& other);
+
+    /** Constructor
+
+        Ownership of a heap buffer is
+        transferred, while inline characters
+        are copied. `other` becomes empty.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The authority to move.
+    */
+    authority(authority&& other) noexcept;
+
+    /** Assignment
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param other The authority to copy.
+    */
+    authority&
+    operator=(authority const& other);
+
+    /** Assignment
+
+        Ownership of a heap buffer is
+        transferred, while inline characters
+        are copied. `other` becomes empty.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The authority to move.
+    */
+    authority&
+    operator=(authority&& other) noexcept;
+
+    /** Assignment
+
+        The characters of `a` are copied.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param a The authority to copy.
+    */
+    authority&
+    operator=(authority_view const& a);
+
+    /** Return a view of the authority
+
+        The view references the characters
+        of this container, and is
+        invalidated by its modification.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    operator authority_view() const noexcept
+    {
+        return u_.construct_authority();
+    }
+
+    //--------------------------------------------
+    //
+    // Observers
+    //
+    //--------------------------------------------
+
+    /** Return the number of characters in the authority
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return u_.offset(id_end);
+    }
+
+    /** Return true if the authority is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return the number of characters which can be stored without reallocating
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return cap_;
+    }
+
+    /** Return true if the characters are stored inline
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    is_inline() const noexcept
+    {
+        return s_ == buf_;
+    }
+
+    /** Return the authority as a null-terminated string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    char const*
+    c_str() const noexcept
+    {
+        return s_;
+    }
+
+    /** Return the authority
+
+        @par Example
+        @code
+        assert( authority( "www.example.com:80" ).buffer() == "www.example.com:80" );
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return core::string_view(
+            s_, size());
+    }
+
+    /** Return true if a userinfo is present
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_userinfo() const noexcept
+    {
+        return u_.len(id_pass) != 0;
+    }
+
+    /** Return the userinfo
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    encoded_userinfo() const noexcept;
+
+    /** Return the host type
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    urls::host_type
+    host_type() const noexcept
+    {
+        return u_.host_type_;
+    }
+
+    /** Return the host
+
+        The host is returned as it appears
+        in the authority, with brackets
+        around IP-literals.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    encoded_host() const noexcept
+    {
+        return u_.pct_get(id_host);
+    }
+
+    /** Return true if a port is present
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_port() const noexcept
+    {
+        return u_.len(id_port) != 0;
+    }
+
+    /** Return the port
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    port() const noexcept;
+
+    /** Return the port number
+
+        This returns zero when there is no
+        port, or the port is too large.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint16_t
+    port_number() const noexcept
+    {
+        return u_.port_number_;
+    }
+
+    /** Return the host and port
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    encoded_host_and_port() const noexcept
+    {
+        return u_.get(id_host, id_end);
+    }
+
+    //--------------------------------------------
+    //
+    // Modifiers
+    //
+    //--------------------------------------------
+
+    /** Clear the contents
+
+        The capacity is preserved.
+
+        @par Postconditions
+        @code
+        this->empty() == true
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept;
+
+    /** Set the userinfo
+
+        The userinfo is set to the given
+        string, which may contain percent
+        escapes. Reserved characters are
+        percent-escaped as needed. The first
+        colon separates the user from the
+        password.
+
+        @par Example
+        @code
+        assert( authority( "example.com" ).set_encoded_userinfo( "user:p%40ss" ).buffer() == "user:p%40ss@example.com" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+    */
+    authority&
+    set_encoded_userinfo(
+        pct_string_view s);
+
+    /** Set the userinfo
+
+        Reserved characters in the string,
+        other than the first colon, are
+        percent-escaped.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+    */
+    authority&
+    set_userinfo(
+        core::string_view s);
+
+    /** Remove the userinfo
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    authority&
+    remove_userinfo() noexcept;
+
+    /** Set the host
+
+        Depending on the contents of the
+        string, the host is set to an IPv4
+        address, an IP-literal in brackets,
+        or a registered name in which
+        reserved characters are
+        percent-escaped.
+
+        @par Example
+        @code
+        assert( authority( "user@example.com:80" ).set_host( "[::1]" ).buffer() == "user@[::1]:80" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+    */
+    authority&
+    set_host(
+        core::string_view s);
+
+    /** Set the host
+
+        Depending on the contents of the
+        string, the host is set to an IPv4
+        address, an IP-literal in brackets,
+        or a registered name which may
+        contain percent escapes, and in
+        which reserved characters are
+        percent-escaped.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+    */
+    authority&
+    set_encoded_host(
+        pct_string_view s);
+
+    /** Set the host to an IPv4 address
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param addr The address to set.
+    */
+    authority&
+    set_host_ipv4(
+        ipv4_address const& addr);
+
+    /** Set the host to an IPv6 address
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param addr The address to set.
+    */
+    authority&
+    set_host_ipv6(
+        ipv6_address const& addr);
+
+    /** Set the port
+
+        @par Example
+        @code
+        assert( authority( "example.com" ).set_port( "8080" ).port_number() == 8080 );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` does not contain a valid port.
+
+        @param s The port string, which
+        contains only digits.
+    */
+    authority&
+    set_port(
+        core::string_view s);
+
+    /** Set the port
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The port number.
+    */
+    authority&
+    set_port_number(
+        std::uint16_t n);
+
+    /** Remove the port
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    authority&
+    remove_port() noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
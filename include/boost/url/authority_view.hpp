@@ -88,6 +88,7 @@ class BOOST_URL_DECL
 #ifndef BOOST_URL_DOCS
     // VFALCO docca emits this erroneously
     friend struct detail::url_impl;
+    friend class authority;
 #endif
 
     explicit
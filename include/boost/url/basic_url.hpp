@@ -0,0 +1,611 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_BASIC_URL_HPP
+#define BOOST_URL_BASIC_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_base.hpp>
+#include <memory>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+/** A modifiable container for a URL, using an allocator.
+
+    This container owns a url, represented
+    by a null-terminated character buffer
+    which is obtained from a copy of the
+    allocator passed upon construction.
+    The contents may be inspected and modified,
+    and the implementation maintains a useful
+    invariant: changes to the url always
+    leave it in a valid state.
+
+    This allows urls to be placed in memory
+    managed by the caller. For example, urls
+    used during a single request can be backed
+    by a monotonic arena which is released all
+    at once when the request completes.
+
+    @par Example
+    @code
+    std::pmr::monotonic_buffer_resource mr;
+    using pmr_url = basic_url< std::pmr::polymorphic_allocator< char > >;
+
+    pmr_url u( "https://www.example.com", &mr );
+    u.set_path( "/index.htm" );
+    @endcode
+
+    The allocator is not propagated by
+    assignment. When the allocators of the
+    two urls compare unequal, move assignment
+    copies the characters instead.
+
+    @tparam Allocator The allocator to use.
+    The value type must be `char`, and the
+    pointer type must be `char*`.
+
+    @see
+        @ref url,
+        @ref static_url,
+        @ref url_view.
+*/
+template<class Allocator>
+class basic_url
+    : public url_base
+{
+    using alloc_traits =
+        std::allocator_traits<Allocator>;
+
+    static_assert(
+        std::is_same<typename
+            alloc_traits::value_type, char>::value,
+        "Allocator::value_type must be char");
+
+    static_assert(
+        std::is_same<typename
+            alloc_traits::pointer, char*>::value,
+        "Allocator::pointer must be char*");
+
+    Allocator a_;
+
+    // capacity of the buffer released
+    // by the pending operation, if any
+    std::size_t old_cap_ = 0;
+
+    friend std::hash<basic_url>;
+    using url_view_base::digest;
+
+public:
+    /** The type of allocator used
+    */
+    using allocator_type = Allocator;
+
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Destructor
+
+        Any params, segments, iterators, or
+        views which reference this object are
+        invalidated. The underlying character
+        buffer is returned to the allocator,
+        invalidating all references to it.
+    */
+    ~basic_url();
+
+    /** Constructor
+
+        Default constructed urls contain
+        a zero-length string. This matches
+        the grammar for a relative-ref with
+        an empty path and no query or
+        fragment.
+        No memory is allocated.
+
+        @par Example
+        @code
+        basic_url< std::allocator< char > > u;
+        @endcode
+
+        @par Postconditions
+        @code
+        this->empty() == true
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param a The allocator to use.
+
+        @par BNF
+        @code
+        relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+        @endcode
+
+        @par Specification
+        <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-4.2"
+            >4.2. Relative Reference (rfc3986)</a>
+    */
+    explicit
+    basic_url(
+        Allocator const& a = Allocator()) noexcept;
+
+    /** Constructor
+
+        This function constructs a url from
+        the string `s`, which must contain a
+        valid <em>URI</em> or <em>relative-ref</em>
+        or else an exception is thrown.
+        The new url retains ownership by
+        making a copy of the passed string,
+        using memory obtained from `a`.
+
+        @par Example
+        @code
+        basic_url< std::allocator< char > > u( "https://www.example.com" );
+        @endcode
+
+        @par Effects
+        @code
+        return basic_url( parse_uri_reference( s ).value(), a );
+        @endcode
+
+        @par Postconditions
+        @code
+        this->buffer().data() != s.data()
+        @endcode
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input does not contain a valid url.
+
+        @param s The string to parse.
+
+        @param a The allocator to use.
+
+        @par BNF
+        @code
+        URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+
+        relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+        @endcode
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-4.1"
+            >4.1. URI Reference</a>
+    */
+    explicit
+    basic_url(
+        core::string_view s,
+        Allocator const& a = Allocator());
+
+    /** Constructor
+
+        The contents of `u` are transferred
+        to the newly constructed object,
+        which includes the underlying
+        character buffer and the allocator.
+        After construction, the moved-from
+        object is as if default constructed.
+
+        @par Postconditions
+        @code
+        u.empty() == true
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to move from.
+    */
+    basic_url(basic_url&& u) noexcept;
+
+    /** Constructor
+
+        The newly constructed object contains
+        a copy of `u`. The allocator is obtained
+        from `select_on_container_copy_construction`.
+
+        @par Postconditions
+        @code
+        this->buffer() == u.buffer() && this->buffer().data() != u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::length_error `u.size() > max_size()`.
+
+        @param u The url to copy.
+    */
+    basic_url(basic_url const& u);
+
+    /** Constructor
+
+        The newly constructed object contains
+        a copy of `u`.
+
+        @par Postconditions
+        @code
+        this->buffer() == u.buffer() && this->buffer().data() != u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::length_error `u.size() > max_size()`.
+
+        @param u The url to copy.
+
+        @param a The allocator to use.
+    */
+    basic_url(
+        url_view_base const& u,
+        Allocator const& a = Allocator());
+
+    /** Assignment
+
+        When the allocators compare equal,
+        the contents of `u` are transferred
+        to this, including the underlying
+        character buffer. Otherwise, the
+        characters are copied and the storage
+        of `u` is released. The allocator is
+        not propagated.
+        In both cases, after assignment, the
+        moved-from object is as if default
+        constructed.
+
+        @par Postconditions
+        @code
+        u.empty() == true
+        @endcode
+
+        @par Complexity
+        Constant when the allocators compare
+        equal, otherwise linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The url to assign from.
+    */
+    basic_url&
+    operator=(basic_url&& u);
+
+    /** Assignment
+
+        The contents of `u` are copied and
+        the previous contents of `this` are
+        destroyed. The allocator is not
+        propagated.
+        Capacity is preserved, or increases.
+
+        @par Postconditions
+        @code
+        this->buffer() == u.buffer() && this->buffer().data() != u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::length_error `u.size() > max_size()`.
+
+        @param u The url to copy.
+    */
+    basic_url&
+    operator=(
+        url_view_base const& u)
+    {
+        copy(u);
+        return *this;
+    }
+
+    /** Assignment
+
+        The contents of `u` are copied and
+        the previous contents of `this` are
+        destroyed. The allocator is not
+        propagated.
+        Capacity is preserved, or increases.
+
+        @par Postconditions
+        @code
+        this->buffer() == u.buffer() && this->buffer().data() != u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The url to copy.
+    */
+    basic_url&
+    operator=(basic_url const& u)
+    {
+        if (this != &u)
+            copy(u);
+        return *this;
+    }
+
+    /** Return the allocator used by the url
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    allocator_type
+    get_allocator() const noexcept
+    {
+        return a_;
+    }
+
+    //--------------------------------------------
+
+    /** Swap the contents.
+
+        Exchanges the contents of this url with another
+        url. All views, iterators and references remain valid.
+        The allocators are not exchanged, so they must
+        compare equal.
+
+        If `this == &other`, this function call has no effect.
+
+        @par Preconditions
+        @code
+        this->get_allocator() == other.get_allocator()
+        @endcode
+
+        @par Example
+        @code
+        basic_url< std::allocator< char > > u1( "https://www.example.com" );
+        basic_url< std::allocator< char > > u2( "https://www.boost.org" );
+        u1.swap(u2);
+        assert(u1 == "https://www.boost.org" );
+        assert(u2 == "https://www.example.com" );
+        @endcode
+
+        @par Complexity
+        Constant
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The object to swap with
+
+    */
+    void
+    swap(basic_url& other) noexcept;
+
+    /** Swap
+
+        Exchanges the contents of `v0` with another `v1`.
+        All views, iterators and references remain valid.
+
+        If `&v0 == &v1`, this function call has no effect.
+
+        @par Preconditions
+        @code
+        v0.get_allocator() == v1.get_allocator()
+        @endcode
+
+        @par Example
+        @code
+        basic_url< std::allocator< char > > u1( "https://www.example.com" );
+        basic_url< std::allocator< char > > u2( "https://www.boost.org" );
+        std::swap(u1, u2);
+        assert(u1 == "https://www.boost.org" );
+        assert(u2 == "https://www.example.com" );
+        @endcode
+
+        @par Effects
+        @code
+        v0.swap( v1 );
+        @endcode
+
+        @par Complexity
+        Constant
+
+        @par Exception Safety
+        Throws nothing
+
+        @param v0, v1 The objects to swap
+
+        @see
+            @ref basic_url::swap
+    */
+    friend
+    void
+    swap(basic_url& v0, basic_url& v1) noexcept
+    {
+        v0.swap(v1);
+    }
+
+    //--------------------------------------------
+    //
+    // fluent api
+    //
+
+    /// @copydoc url_base::set_scheme
+    basic_url& set_scheme(core::string_view s) { url_base::set_scheme(s); return *this; }
+    /// @copydoc url_base::set_scheme_id
+    basic_url& set_scheme_id(urls::scheme id) { url_base::set_scheme_id(id); return *this; }
+    /// @copydoc url_base::remove_scheme
+    basic_url& remove_scheme() { url_base::remove_scheme(); return *this; }
+
+    /// @copydoc url_base::set_encoded_authority
+    basic_url& set_encoded_authority(pct_string_view s) { url_base::set_encoded_authority(s); return *this; }
+    /// @copydoc url_base::remove_authority
+    basic_url& remove_authority() { url_base::remove_authority(); return *this; }
+
+    /// @copydoc url_base::set_userinfo
+    basic_url& set_userinfo(core::string_view s) { url_base::set_userinfo(s); return *this; }
+    /// @copydoc url_base::set_encoded_userinfo
+    basic_url& set_encoded_userinfo(pct_string_view s) { url_base::set_encoded_userinfo(s); return *this; }
+    /// @copydoc url_base::remove_userinfo
+    basic_url& remove_userinfo() noexcept { url_base::remove_userinfo(); return *this; }
+    /// @copydoc url_base::set_user
+    basic_url& set_user(core::string_view s) { url_base::set_user(s); return *this; }
+    /// @copydoc url_base::set_encoded_user
+    basic_url& set_encoded_user(pct_string_view s) { url_base::set_encoded_user(s); return *this; }
+    /// @copydoc url_base::set_password
+    basic_url& set_password(core::string_view s) { url_base::set_password(s); return *this; }
+    /// @copydoc url_base::set_encoded_password
+    basic_url& set_encoded_password(pct_string_view s) { url_base::set_encoded_password(s); return *this; }
+    /// @copydoc url_base::remove_password
+    basic_url& remove_password() noexcept { url_base::remove_password(); return *this; }
+
+    /// @copydoc url_base::set_host
+    basic_url& set_host(core::string_view s) { url_base::set_host(s); return *this; }
+    /// @copydoc url_base::set_encoded_host
+    basic_url& set_encoded_host(pct_string_view s) { url_base::set_encoded_host(s); return *this; }
+    /// @copydoc url_base::set_host_address
+    basic_url& set_host_address(core::string_view s) { url_base::set_host_address(s); return *this; }
+    /// @copydoc url_base::set_encoded_host_address
+    basic_url& set_encoded_host_address(pct_string_view s) { url_base::set_encoded_host_address(s); return *this; }
+    /// @copydoc url_base::set_host_ipv4
+    basic_url& set_host_ipv4(ipv4_address const& addr) { url_base::set_host_ipv4(addr); return *this; }
+    /// @copydoc url_base::set_host_ipv6
+    basic_url& set_host_ipv6(ipv6_address const& addr) { url_base::set_host_ipv6(addr); return *this; }
+    /// @copydoc url_base::set_host_ipvfuture
+    basic_url& set_host_ipvfuture(core::string_view s) { url_base::set_host_ipvfuture(s); return *this; }
+    /// @copydoc url_base::set_host_name
+    basic_url& set_host_name(core::string_view s) { url_base::set_host_name(s); return *this; }
+    /// @copydoc url_base::set_encoded_host_name
+    basic_url& set_encoded_host_name(pct_string_view s) { url_base::set_encoded_host_name(s); return *this; }
+    /// @copydoc url_base::set_port_number
+    basic_url& set_port_number(std::uint16_t n) { url_base::set_port_number(n); return *this; }
+    /// @copydoc url_base::set_port
+    basic_url& set_port(core::string_view s) { url_base::set_port(s); return *this; }
+    /// @copydoc url_base::remove_port
+    basic_url& remove_port() noexcept { url_base::remove_port(); return *this; }
+
+    /// @copydoc url_base::set_path_absolute
+    //bool set_path_absolute(bool absolute);
+    /// @copydoc url_base::set_path
+    basic_url& set_path(core::string_view s) { url_base::set_path(s); return *this; }
+    /// @copydoc url_base::set_encoded_path
+    basic_url& set_encoded_path(pct_string_view s) { url_base::set_encoded_path(s); return *this; }
+
+    /// @copydoc url_base::set_query
+    basic_url& set_query(core::string_view s) { url_base::set_query(s); return *this; }
+    /// @copydoc url_base::set_encoded_query
+    basic_url& set_encoded_query(pct_string_view s) { url_base::set_encoded_query(s); return *this; }
+    /// @copydoc url_base::remove_query
+    basic_url& remove_query() noexcept { url_base::remove_query(); return *this; }
+
+    /// @copydoc url_base::remove_fragment
+    basic_url& remove_fragment() noexcept { url_base::remove_fragment(); return *this; }
+    /// @copydoc url_base::set_fragment
+    basic_url& set_fragment(core::string_view s) { url_base::set_fragment(s); return *this; }
+    /// @copydoc url_base::set_encoded_fragment
+    basic_url& set_encoded_fragment(pct_string_view s) { url_base::set_encoded_fragment(s); return *this; }
+
+    /// @copydoc url_base::remove_origin
+    basic_url& remove_origin() { url_base::remove_origin(); return *this; }
+
+    /// @copydoc url_base::normalize
+    basic_url& normalize() { url_base::normalize(); return *this; }
+    /// @copydoc url_base::normalize(parse_options const&)
+    system::result<void> normalize(parse_options const& opt) { return url_base::normalize(opt); }
+    /// @copydoc url_base::normalize_scheme
+    basic_url& normalize_scheme() { url_base::normalize_scheme(); return *this; }
+    /// @copydoc url_base::normalize_authority
+    basic_url& normalize_authority() { url_base::normalize_authority(); return *this; }
+    /// @copydoc url_base::normalize_path
+    basic_url& normalize_path() { url_base::normalize_path(); return *this; }
+    /// @copydoc url_base::normalize_query
+    basic_url& normalize_query() { url_base::normalize_query(); return *this; }
+    /// @copydoc url_base::normalize_fragment
+    basic_url& normalize_fragment() { url_base::normalize_fragment(); return *this; }
+
+
+    //--------------------------------------------
+
+private:
+    char* allocate(std::size_t);
+    void deallocate(char* s, std::size_t cap) noexcept;
+
+    void clear_impl() noexcept override;
+    void reserve_impl(std::size_t, op_t&) override;
+    void cleanup(op_t&) override;
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<class Allocator>
+struct hash< ::boost::urls::basic_url<Allocator> >
+{
+    hash() = default;
+    hash(hash const&) = default;
+    hash& operator=(hash const&) = default;
+
+    explicit
+    hash(std::size_t salt) noexcept
+        : salt_(salt)
+    {
+    }
+
+    std::size_t
+    operator()(::boost::urls::basic_url<Allocator> const& u) const noexcept
+    {
+        return u.digest(salt_);
+    }
+
+private:
+    std::size_t salt_ = 0;
+};
+} // std
+#endif
+
+#include <boost/url/impl/basic_url.hpp>
+
+#endif
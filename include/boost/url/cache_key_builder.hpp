@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_CACHE_KEY_BUILDER_HPP
+#define BOOST_URL_CACHE_KEY_BUILDER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/param_key_set.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** A policy which computes cache keys of URLs
+
+    This object holds the rules used to turn
+    a URL into the key under which a cached
+    response is stored, so that equivalent
+    URLs share one entry:
+
+    @li The URL is normalized, as if by
+        @ref url_base::normalize.
+
+    @li A list of query parameter keys, and of
+        key prefixes such as "utm_", which are
+        removed from the query.
+
+    @li Whether the remaining parameters are
+        sorted by key.
+
+    @li Whether a port equal to the default
+        port of the scheme is removed.
+
+    @li Whether the fragment is kept.
+
+    The rules are prepared when they are added,
+    so the key is written from the characters
+    of the URL in one pass, without copying,
+    normalizing and editing a @ref url first.
+    When only the hash of the key is needed,
+    the key is never returned.
+
+    Keys are compared with the ignored keys
+    after decoding escapes, ignoring case.
+    Escapes of '&', '=' and '+' in the query
+    are kept, so that the parameters of the
+    key are the parameters of the URL.
+
+    @par Example
+    @code
+    cache_key_builder b;
+    b.ignore_param_prefix( "utm_" )
+     .ignore_param( "fbclid" );
+
+    url_view u( "HTTPS://Example.com/a/./%7Euser?z=1&utm_source=x&a=2#top" );
+    assert( b.key( u ) == "https://example.com/a/~user?a=2&z=1" );
+    assert( b.hash( u ) == b.hash( url_view( "https://example.com/a/~user?a=2&z=1" ) ) );
+    @endcode
+
+    @see
+        @ref param_key_set,
+        @ref url_sanitizer,
+        @ref url_base::normalize.
+*/
+class cache_key_builder
+    : private detail::parts_base
+{
+public:
+    /** Constructor
+
+        Default constructed builders keep
+        every parameter, sort the parameters,
+        keep the port and remove the fragment.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    cache_key_builder() noexcept = default;
+
+    /** Ignore a query parameter
+
+        Parameters whose decoded key is equal
+        to `key`, ignoring case, are removed
+        from the key.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param key The decoded key
+    */
+    BOOST_URL_DECL
+    cache_key_builder&
+    ignore_param(core::string_view key);
+
+    /** Ignore the query parameters with a key prefix
+
+        Parameters whose decoded key starts
+        with `prefix`, ignoring case, are
+        removed from the key.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param prefix The decoded prefix
+    */
+    BOOST_URL_DECL
+    cache_key_builder&
+    ignore_param_prefix(core::string_view prefix);
+
+    /** Set whether the parameters are sorted
+
+        When this is set, the parameters are
+        sorted by their decoded keys, as if
+        by @ref params_encoded_ref::sort.
+        Parameters with equal keys keep
+        their order.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param b `true` to sort the parameters
+    */
+    cache_key_builder&
+    sort_params(bool b = true) noexcept
+    {
+        sort_params_ = b;
+        return *this;
+    }
+
+    /** Set whether default ports are removed
+
+        When this is set, a port equal to the
+        default port of a known @ref scheme,
+        or an empty port, is removed.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param b `true` to remove default ports
+    */
+    cache_key_builder&
+    remove_default_port(bool b = true) noexcept
+    {
+        remove_default_port_ = b;
+        return *this;
+    }
+
+    /** Set whether the fragment is kept
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param b `true` to keep the fragment
+    */
+    cache_key_builder&
+    keep_fragment(bool b = true) noexcept
+    {
+        keep_fragment_ = b;
+        return *this;
+    }
+
+    /** Return the cache key of a URL
+
+        The key is the URL normalized, without
+        the parts removed by the policy. It is
+        never longer than the URL, and nothing
+        is parsed again.
+
+        @par Example
+        @code
+        cache_key_builder b;
+        assert( b.key( url_view( "http://H/%61/../b?y&x#f" ) ) == "http://h/b?x&y" );
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`, plus the sort
+        of the parameters.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        String tokens may throw exceptions.
+
+        @return The key.
+
+        @param u The URL
+
+        @param token A string token.
+
+        @see
+            @ref string_token.
+    */
+    template<BOOST_URL_STRTOK_TPARAM>
+    BOOST_URL_STRTOK_RETURN
+    key(
+        url_view_base const& u,
+        BOOST_URL_STRTOK_ARG(token)) const
+    {
+        key_impl(u, token);
+        return token.result();
+    }
+
+    /** Return the hash of the cache key of a URL
+
+        URLs with equal keys have equal
+        hashes. The key is not returned,
+        so nothing is allocated for most
+        URLs.
+
+        @par Complexity
+        Linear in `u.size()`, plus the sort
+        of the parameters.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The hash.
+
+        @param u The URL
+
+        @param seed A seed, to give different
+        hashes for the same key.
+    */
+    BOOST_URL_DECL
+    std::uint64_t
+    hash(
+        url_view_base const& u,
+        std::uint64_t seed = 0) const;
+
+private:
+    BOOST_URL_DECL
+    void
+    key_impl(
+        url_view_base const& u,
+        string_token::arg& t) const;
+
+    std::size_t
+    write_key(
+        url_view_base const& u,
+        char* dest) const;
+
+    param_key_set ignored_ =
+        param_key_set(ignore_case);
+    bool sort_params_ = true;
+    bool remove_default_port_ = false;
+    bool keep_fragment_ = false;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_CANONICAL_REQUEST_HPP
+#define BOOST_URL_CANONICAL_REQUEST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Write the canonical URI of a URL for request signing
+
+    The path of `u` is written to `sink` as
+    the canonical URI of a signed request,
+    as in AWS Signature Version 4: each
+    segment is decoded and encoded again,
+    so that only the unreserved characters
+    are not escaped and the escapes have
+    uppercase hexadecimal digits. The path
+    is not normalized, and an empty path
+    is written as "/".
+
+    The characters are written in blocks
+    as they are produced, so the string
+    is never built, and `sink` may be the
+    update function of a hash.
+
+    @par Example
+    @code
+    std::string s;
+    write_canonical_uri( url_view( "https://h/a%7eb/c%20d/%2f" ),
+        [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+    assert( s == "/a~b/c%20d/%2F" );
+    @endcode
+
+    @par Constraints
+    `sink( p, n )` is a valid expression,
+    where `p` is a `char const*` and `n`
+    is a `std::size_t`.
+
+    @par Complexity
+    Linear in `u.encoded_path().size()`.
+
+    @par Exception Safety
+    Throws nothing, unless `sink` throws.
+
+    @param u The URL
+
+    @param sink The function which is called
+    with each block of the canonical URI.
+
+    @par Specification
+    @li <a href="https://docs.aws.amazon.com/IAM/latest/UserGuide/create-signed-request.html"
+        >Create a signed AWS API request</a>
+
+    @see
+        @ref write_canonical_host,
+        @ref write_canonical_query.
+*/
+template<class Sink>
+void
+write_canonical_uri(
+    url_view_base const& u,
+    Sink&& sink);
+
+/** Write the canonical query string of a URL for request signing
+
+    The query parameters of `u` are written
+    to `sink` as the canonical query string of
+    a signed request, as in AWS Signature
+    Version 4: each key and value is decoded
+    and encoded again, so that only the
+    unreserved characters are not escaped,
+    every key is followed by '=', and the
+    parameters are sorted by their encoded
+    keys and then by their encoded values.
+    A '+' is a plus sign, and empty
+    parameters are skipped.
+
+    The parameters are sorted as views of
+    the URL, compared by producing their
+    encoded bytes, and the characters are
+    written in blocks as they are produced,
+    so the string is never built, and `sink`
+    may be the update function of a hash.
+
+    @par Example
+    @code
+    std::string s;
+    write_canonical_query( url_view( "https://h/?b=2&a&%61=1&c=x+y" ),
+        [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+    assert( s == "a=&a=1&b=2&c=x%2By" );
+    @endcode
+
+    @par Constraints
+    `sink( p, n )` is a valid expression,
+    where `p` is a `char const*` and `n`
+    is a `std::size_t`.
+
+    @par Complexity
+    Linear in `u.encoded_query().size()`,
+    plus the sort of the parameters.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+    Exceptions thrown by `sink` are
+    propagated.
+
+    @param u The URL
+
+    @param sink The function which is called
+    with each block of the canonical query.
+
+    @par Specification
+    @li <a href="https://docs.aws.amazon.com/IAM/latest/UserGuide/create-signed-request.html"
+        >Create a signed AWS API request</a>
+
+    @see
+        @ref write_canonical_host,
+        @ref write_canonical_uri.
+*/
+template<class Sink>
+void
+write_canonical_query(
+    url_view_base const& u,
+    Sink&& sink);
+
+/** Write the canonical host of a URL for request signing
+
+    The host of `u`, in lowercase, and its
+    port when there is one, are written to
+    `sink` as the value of the canonical
+    host header of a signed request.
+
+    @par Example
+    @code
+    std::string s;
+    write_canonical_host( url_view( "https://Bucket.S3.Amazonaws.com:8443/k" ),
+        [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+    assert( s == "bucket.s3.amazonaws.com:8443" );
+    @endcode
+
+    @par Constraints
+    `sink( p, n )` is a valid expression,
+    where `p` is a `char const*` and `n`
+    is a `std::size_t`.
+
+    @par Complexity
+    Linear in `u.encoded_host_and_port().size()`.
+
+    @par Exception Safety
+    Throws nothing, unless `sink` throws.
+
+    @param u The URL
+
+    @param sink The function which is called
+    with each block of the canonical host.
+
+    @see
+        @ref write_canonical_query,
+        @ref write_canonical_uri.
+*/
+template<class Sink>
+void
+write_canonical_host(
+    url_view_base const& u,
+    Sink&& sink);
+
+} // urls
+} // boost
+
+#include <boost/url/impl/canonical_request.hpp>
+
+#endif
@@ -0,0 +1,262 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_COMPACT_URL_VIEW_HPP
+#define BOOST_URL_COMPACT_URL_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/compact_url_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+/** A small non-owning reference to a parsed URL
+
+    A @ref url_view keeps the offset and
+    the decoded size of every component,
+    the number of segments and params, and
+    the address of an IP host, as values of
+    `std::size_t`. When many URLs are kept
+    in memory, these take more room than
+    the characters of the URLs.
+
+    This object keeps the offsets of the
+    components and the number of segments
+    and params as values of type `Offset`,
+    with the port number, the host type and
+    the scheme. The decoded sizes and the
+    address of an IP host are computed again
+    when a @ref url_view is obtained from
+    @ref view.
+
+    With `std::uint32_t`, the URL must have
+    fewer than 4 GB, and with `std::uint16_t`,
+    fewer than 64 KB, which keeps the object
+    within 32 bytes on 64-bit platforms.
+
+    Ownership is not transferred; the caller
+    is responsible for ensuring that the
+    lifetime of the character buffer extends
+    until it is no longer referenced.
+
+    @par Example
+    @code
+    std::vector< compact_url_view< std::uint16_t > > v;
+    for( core::string_view s : crawled )
+        v.emplace_back( url_view( s ) );
+
+    url_view u = v.front().view();
+    @endcode
+
+    @tparam Offset The type of the offsets,
+    `std::uint16_t` or `std::uint32_t`.
+
+    @see
+        @ref url_view.
+*/
+template<class Offset = std::uint32_t>
+class compact_url_view
+    : private detail::compact_url_base
+{
+    static_assert(
+        std::is_same<Offset, std::uint16_t>::value ||
+        std::is_same<Offset, std::uint32_t>::value,
+        "Offset must be std::uint16_t or std::uint32_t");
+
+    char const* cs_ = "";
+    Offset offset_[id_end + 1] = {};
+    Offset nseg_ = 0;
+    Offset nparam_ = 0;
+    std::uint16_t port_number_ = 0;
+    unsigned char host_type_ = 0;
+    unsigned char scheme_ = 0;
+
+public:
+    /** Constructor
+
+        Default constructed views
+        refer to an empty URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    compact_url_view() noexcept = default;
+
+    /** Constructor
+
+        The view refers to the same
+        characters as `u`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `u.size() > max_size()`
+
+        @param u The URL to reference.
+    */
+    explicit
+    compact_url_view(
+        url_view_base const& u)
+    {
+        parts p;
+        get(u, p);
+        if(p.offset[id_end] > max_size())
+            detail::throw_length_error();
+        cs_ = p.cs;
+        for(int i = 0; i <= id_end; ++i)
+            offset_[i] = static_cast<
+                Offset>(p.offset[i]);
+        nseg_ = static_cast<Offset>(p.nseg);
+        nparam_ = static_cast<Offset>(p.nparam);
+        port_number_ = p.port_number;
+        host_type_ = static_cast<
+            unsigned char>(p.host_type);
+        scheme_ = static_cast<
+            unsigned char>(p.scheme);
+    }
+
+    /** Return the maximum number of characters of a URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    static
+    constexpr
+    std::size_t
+    max_size() noexcept
+    {
+        return (std::numeric_limits<
+            Offset>::max)();
+    }
+
+    /** Return the number of characters of the URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return offset_[id_end];
+    }
+
+    /** Return true if the URL is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return the URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return core::string_view(
+            cs_, size());
+    }
+
+    /** Return the scheme of the URL
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_view_base::scheme_id.
+    */
+    urls::scheme
+    scheme_id() const noexcept
+    {
+        return static_cast<
+            urls::scheme>(scheme_);
+    }
+
+    /** Return the type of the host
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_view_base::host_type.
+    */
+    urls::host_type
+    host_type() const noexcept
+    {
+        return static_cast<
+            urls::host_type>(host_type_);
+    }
+
+    /** Return the port number
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_view_base::port_number.
+    */
+    std::uint16_t
+    port_number() const noexcept
+    {
+        return port_number_;
+    }
+
+    /** Return a view of the URL
+
+        The URL is not parsed again: the
+        decoded size of each component is
+        computed from its escapes, and an
+        IP host is read again.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view
+    view() const noexcept
+    {
+        parts p;
+        p.cs = cs_;
+        for(int i = 0; i <= id_end; ++i)
+            p.offset[i] = offset_[i];
+        p.nseg = nseg_;
+        p.nparam = nparam_;
+        p.port_number = port_number_;
+        p.host_type = host_type();
+        p.scheme = scheme_id();
+        return construct(p);
+    }
+};
+
+} // urls
+} // boost
+
+#endif
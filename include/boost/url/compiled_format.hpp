@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_COMPILED_FORMAT_HPP
+#define BOOST_URL_COMPILED_FORMAT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/format_args.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A format URL string parsed once for repeated use
+
+    The function @ref format parses its format
+    string on every call, to find the URL
+    component of each replacement field. This
+    object parses a format string once and
+    stores its literal pieces and replacement
+    fields, grouped by component. Formatting
+    arguments with it measures the result,
+    reserves the exact size in the destination,
+    and then writes each piece without parsing
+    the format string again.
+
+    The format string syntax and the results
+    are the same as with @ref format and
+    @ref format_to. The object holds a copy of
+    the format string.
+
+    @par Example
+    @code
+    compiled_format const f( "https://{}/users/{id}" );
+
+    url u = f.format( "example.com", arg( "id", 42 ) );
+    assert( u.buffer() == "https://example.com/users/42" );
+    @endcode
+
+    @par BNF
+    @code
+    replacement_field ::=  "{" [arg_id] [":" (format_spec | chrono_format_spec)] "}"
+    arg_id            ::=  integer | identifier
+    integer           ::=  digit+
+    digit             ::=  "0"..."9"
+    identifier        ::=  id_start id_continue*
+    id_start          ::=  "a"..."z" | "A"..."Z" | "_"
+    id_continue       ::=  id_start | digit
+    @endcode
+
+    @par Specification
+    @li <a href="https://fmt.dev/latest/syntax.html"
+        >Format String Syntax</a>
+
+    @see
+        @ref format,
+        @ref format_to.
+*/
+class compiled_format
+{
+public:
+    /** Constructor
+
+        This function parses the format
+        URL string `fmt`.
+
+        @par Complexity
+        Linear in `fmt.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `fmt` contains an invalid format string.
+
+        @param fmt The format URL string.
+    */
+    BOOST_URL_DECL
+    explicit
+    compiled_format(
+        core::string_view fmt);
+
+    /** Return the format string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return s_;
+    }
+
+    /** Format arguments into a URL
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return A URL holding the formatted result.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        The result contains an invalid URL
+        after replacements are applied.
+
+        @see
+            @ref format.
+    */
+    template <class... Args>
+    url
+    format(Args&&... args) const
+    {
+        url u;
+        vformat_to(u, detail::make_format_args(
+            std::forward<Args>(args)...));
+        return u;
+    }
+
+    /** Format arguments into a URL
+
+        This overload allows type-erased arguments
+        to be passed as an initializer_list, which
+        is mostly convenient for named parameters.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return A URL holding the formatted result.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        The result contains an invalid URL
+        after replacements are applied.
+
+        @see
+            @ref format.
+    */
+    url
+    format(
+#ifdef BOOST_URL_DOCS
+        std::initializer_list<__see_below__> args
+#else
+        std::initializer_list<detail::format_arg> args
+#endif
+        ) const
+    {
+        url u;
+        vformat_to(u, detail::format_args(
+            args.begin(), args.end()));
+        return u;
+    }
+
+    /** Format arguments into a URL
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param u An object that derives from @ref url_base.
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        `u` contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format_to.
+    */
+    template <class... Args>
+    void
+    format_to(
+        url_base& u,
+        Args&&... args) const
+    {
+        vformat_to(u, detail::make_format_args(
+            std::forward<Args>(args)...));
+    }
+
+    /** Format arguments into a URL
+
+        This overload allows type-erased arguments
+        to be passed as an initializer_list, which
+        is mostly convenient for named parameters.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param u An object that derives from @ref url_base.
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        `u` contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format_to.
+    */
+    void
+    format_to(
+        url_base& u,
+#ifdef BOOST_URL_DOCS
+        std::initializer_list<__see_below__> args
+#else
+        std::initializer_list<detail::format_arg> args
+#endif
+        ) const
+    {
+        vformat_to(u, detail::format_args(
+            args.begin(), args.end()));
+    }
+
+private:
+    class source;
+
+    // a literal or a replacement field
+    struct piece
+    {
+        enum kind_t : unsigned char
+        {
+            literal,
+            indexed,
+            named,
+            automatic
+        };
+
+        // literal chars, or the name
+        std::size_t pos = 0;
+        std::size_t size = 0;
+        // encoded size of a literal,
+        // or the index of an argument
+        std::size_t n = 0;
+        // start of the format spec
+        std::size_t spec = 0;
+        kind_t kind = literal;
+    };
+
+    // a component of the format string
+    struct part
+    {
+        std::size_t pos = 0;
+        std::size_t size = 0;
+        // range of pieces
+        std::size_t first = 0;
+        std::size_t last = 0;
+    };
+
+    BOOST_URL_DECL
+    void
+    vformat_to(
+        url_base& u,
+        detail::format_args args) const;
+
+    void
+    compile(
+        int id,
+        core::string_view s,
+        grammar::lut_chars const& cs);
+
+    std::string s_;
+    std::vector<piece> v_;
+    part parts_[
+        detail::parts_base::id_end + 1];
+    bool has_authority_ = false;
+    bool has_user_ = false;
+    bool has_pass_ = false;
+    bool has_port_ = false;
+    bool has_query_ = false;
+    bool has_frag_ = false;
+};
+
+} // urls
+} // boost
+
+#endif
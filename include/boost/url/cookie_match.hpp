@@ -0,0 +1,398 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_COOKIE_MATCH_HPP
+#define BOOST_URL_COOKIE_MATCH_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** Return true if the host of a URL domain-matches a cookie domain
+
+    The host domain-matches the domain
+    when they are equal ignoring ASCII case,
+    or when the host is a registered name
+    which ends with a dot followed by the
+    domain. A leading dot in the domain is
+    ignored, and an empty domain matches
+    nothing. Hosts are compared in their
+    encoded form, without brackets for IP
+    addresses, and nothing is allocated.
+
+    @par Example
+    @code
+    assert( domain_match( url_view( "https://www.Example.com/" ), "example.com" ) );
+    assert( ! domain_match( url_view( "https://badexample.com/" ), "example.com" ) );
+    assert( ! domain_match( url_view( "http://10.0.0.1/" ), "0.0.1" ) );
+    @endcode
+
+    @par Complexity
+    Linear in `domain.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL of the request.
+
+    @param domain The domain of the cookie.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6265#section-5.1.3"
+        >5.1.3. Domain Matching (rfc6265)</a>
+*/
+BOOST_URL_DECL
+bool
+domain_match(
+    url_view_base const& u,
+    core::string_view domain) noexcept;
+
+/** Return true if the host of a URL domain-matches a cookie domain
+
+    This function is the same as the
+    overload without a list, except that
+    a domain which is a public suffix, such
+    as `com` or `co.uk`, only matches a host
+    equal to it. A user agent applies this
+    check before storing a cookie, so that a
+    site can not set a cookie for every site
+    under the same suffix.
+
+    @par Example
+    @code
+    assert( ! domain_match( url_view( "https://www.example.co.uk/" ), "co.uk", psl ) );
+    assert( domain_match( url_view( "https://www.example.co.uk/" ), "example.co.uk", psl ) );
+    @endcode
+
+    @par Complexity
+    Linear in the size of the host.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL of the request.
+
+    @param domain The domain of the cookie.
+
+    @param psl The public suffix list.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6265#section-5.3"
+        >5.3. Storage Model (rfc6265)</a>
+*/
+BOOST_URL_DECL
+bool
+domain_match(
+    url_view_base const& u,
+    core::string_view domain,
+    public_suffix_list_view psl) noexcept;
+
+/** Return true if the path of a URL path-matches a cookie path
+
+    The path matches when it is equal to
+    the cookie path, or when it starts with
+    the cookie path and either the cookie
+    path ends with `/` or the next character
+    of the path is `/`. The comparison is
+    exact, on the encoded path. An empty
+    path, or one which does not start with
+    `/`, is compared as `/`.
+
+    @par Example
+    @code
+    assert( path_match( url_view( "https://example.com/docs/a" ), "/docs" ) );
+    assert( ! path_match( url_view( "https://example.com/docsets" ), "/docs" ) );
+    @endcode
+
+    @par Complexity
+    Linear in `path.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL of the request.
+
+    @param path The path of the cookie.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6265#section-5.1.4"
+        >5.1.4. Paths and Path-Match (rfc6265)</a>
+*/
+BOOST_URL_DECL
+bool
+path_match(
+    url_view_base const& u,
+    core::string_view path) noexcept;
+
+/** Return the default path of a cookie set by a URL
+
+    This is the path given to a cookie
+    whose `Path` attribute is missing or
+    does not start with `/`: the encoded
+    path of the URL up to, but not
+    including, its last `/`, or `"/"` if
+    that would be empty. The returned
+    string references the URL, or a
+    static string.
+
+    @par Example
+    @code
+    assert( default_cookie_path( url_view( "https://example.com/docs/a" ) ) == "/docs" );
+    assert( default_cookie_path( url_view( "https://example.com/a" ) ) == "/" );
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL of the response.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6265#section-5.1.4"
+        >5.1.4. Paths and Path-Match (rfc6265)</a>
+*/
+BOOST_URL_DECL
+core::string_view
+default_cookie_path(
+    url_view_base const& u) noexcept;
+
+//------------------------------------------------
+
+/** An index of the cookies of a cookie jar
+
+    This container maps the domain of each
+    stored cookie to its identifiers, so
+    that the cookies to send with a request
+    are found without scanning the whole jar.
+    A lookup hashes the host of the request
+    and each of its parent domains, one per
+    label, and only visits the cookies
+    stored under these domains, which it
+    then filters with the rules of
+    @ref domain_match and @ref path_match.
+
+    Domains are hashed and compared ignoring
+    ASCII case. The cookies of a domain are
+    kept in a list, and the domains in a
+    single hash table, so a lookup does not
+    allocate other than to append to the
+    caller's vector. The index only stores
+    identifiers, domains and paths: the
+    cookies themselves, their expiry and
+    their other attributes belong to the
+    caller.
+
+    @par Example
+    @code
+    cookie_index idx;
+    idx.insert( 1, "example.com", "/" );
+    idx.insert( 2, "www.example.com", "/docs", true );
+    idx.insert( 3, "other.com", "/" );
+
+    std::vector< std::size_t > ids;
+    idx.match( url_view( "https://www.example.com/docs/a" ), ids );
+    assert( ids.size() == 2 );     // 2 and 1
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6265#section-5.4"
+        >5.4. The Cookie Header (rfc6265)</a>
+
+    @see
+        @ref domain_match,
+        @ref path_match.
+*/
+class cookie_index
+{
+public:
+    /** Constructor
+
+        Default constructed indexes
+        have no cookies.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    cookie_index() noexcept = default;
+
+    /** Insert a cookie
+
+        A leading dot in `domain` is ignored,
+        and a cookie with an empty domain is
+        not inserted.
+        A host-only cookie, one set without a
+        `Domain` attribute, only matches hosts
+        equal to its domain, while other
+        cookies also match the subdomains of
+        their domain. The same identifier may
+        be inserted more than once.
+
+        @par Complexity
+        Linear in `domain.size() + path.size()`,
+        on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param id The identifier of the cookie.
+
+        @param domain The domain of the cookie.
+
+        @param path The path of the cookie.
+
+        @param host_only `true` if the cookie
+        only matches its own host.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        std::size_t id,
+        core::string_view domain,
+        core::string_view path,
+        bool host_only = false);
+
+    /** Remove a cookie
+
+        This function removes the entries
+        inserted with `id` under `domain`.
+
+        @par Complexity
+        Linear in `domain.size()` plus the
+        number of cookies of the domain,
+        on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of entries removed.
+
+        @param id The identifier of the cookie.
+
+        @param domain The domain it was
+        inserted with.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    erase(
+        std::size_t id,
+        core::string_view domain) noexcept;
+
+    /** Append the identifiers of the cookies matching a URL
+
+        The identifiers of the cookies whose
+        domain and path match the URL are
+        appended to `ids`. Cookies of the host
+        itself come first, followed by those of
+        each parent domain in turn. Cookies of
+        the same domain come in the order they
+        were inserted.
+
+        @par Complexity
+        Linear in the size of the host, plus
+        the size of the path times the number
+        of cookies stored under the host and
+        its parent domains.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw. The
+        identifiers appended before an
+        exception are kept.
+
+        @return The number of identifiers
+        appended.
+
+        @param u The URL of the request.
+
+        @param ids The vector to which the
+        identifiers are appended.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        url_view_base const& u,
+        std::vector<std::size_t>& ids) const;
+
+    /** Return the number of cookies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return true if there are no cookies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+private:
+    struct domain
+    {
+        std::size_t hash;
+        std::size_t key;
+        std::size_t size;
+
+        // one more than the first and
+        // last cookies, or zero
+        std::size_t first = 0;
+        std::size_t last = 0;
+    };
+
+    struct cookie
+    {
+        std::size_t id;
+        std::size_t path;
+        std::size_t path_size;
+        bool host_only;
+
+        // one more than the next cookie
+        // of the domain, or zero
+        std::size_t next = 0;
+    };
+
+    std::size_t
+    find(core::string_view d) const noexcept;
+
+    void rehash(std::size_t n);
+
+    std::vector<domain> domains_;
+    std::vector<cookie> cookies_;
+    // one more than a domain, or zero
+    std::vector<std::size_t> table_;
+    std::string keys_;
+    std::size_t size_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,310 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DATA_URL_VIEW_HPP
+#define BOOST_URL_DATA_URL_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A non-owning reference to a valid data URL
+
+    Data URLs hold a small file in the URL
+    itself, as in inline images of HTML and
+    CSS documents. The path of the URL, with
+    the scheme "data", has a media type, its
+    parameters, an optional ";base64" flag,
+    and the data after a comma:
+
+    @code
+    data:image/png;base64,iVBORw0KGgo...
+    @endcode
+
+    The header is split when the URL is
+    parsed, and the view records where each
+    part is. The parts reference the
+    characters of the URL, and nothing is
+    copied or allocated. The data is decoded
+    to a buffer of the caller in one pass,
+    with the base64 alphabet when the flag
+    is present, and otherwise as percent-
+    encoded characters.
+
+    Objects of this type are obtained from
+    @ref parse_data_url, and reference the
+    characters of the string which was parsed,
+    which must remain valid while the view is
+    used.
+
+    @par Example
+    @code
+    data_url_view d = parse_data_url(
+        "data:text/plain;charset=utf-8;base64,SGVsbG8=" ).value();
+
+    assert( d.media_type() == "text/plain" );
+    assert( d.parameters() == "charset=utf-8" );
+    assert( d.is_base64() );
+
+    std::string s( d.max_decoded_size(), '\0' );
+    s.resize( d.decode( &s[0], s.size() ).value() );
+    assert( s == "Hello" );
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc2397"
+        >RFC 2397: The "data" URL scheme</a>
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc4648#section-4"
+        >RFC 4648: Base 64 Encoding</a>
+
+    @see
+        @ref parse_data_url.
+*/
+class data_url_view
+{
+    // positions from the start
+    // of the buffer
+    url_view u_;
+    std::size_t type_end_ = 0;
+    std::size_t params_end_ = 0;
+    std::size_t data_ = 0;
+    std::size_t data_end_ = 0;
+    bool base64_ = false;
+
+    friend
+    BOOST_URL_DECL
+    system::result<data_url_view>
+    parse_data_url(
+        core::string_view s) noexcept;
+
+    BOOST_URL_DECL
+    pct_string_view
+    slice(
+        std::size_t first,
+        std::size_t last) const noexcept;
+
+public:
+    /** Constructor
+
+        Default constructed views reference
+        no URL, and all of their parts
+        are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    data_url_view() noexcept = default;
+
+    /** Return the URL as a URL view
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view const&
+    as_url_view() const noexcept
+    {
+        return u_;
+    }
+
+    /** Return the URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return u_.buffer();
+    }
+
+    /** Return the media type
+
+        This returns the media type as it
+        appears in the URL, such as
+        "image/png", or an empty string if
+        there is none, in which case the
+        type is "text/plain" with the
+        parameter "charset=US-ASCII".
+
+        @par Complexity
+        Linear in the size of the type.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    media_type() const noexcept
+    {
+        return slice(
+            u_.encoded_path().data() -
+                u_.buffer().data(),
+            type_end_);
+    }
+
+    /** Return the parameters of the media type
+
+        This returns the parameters after
+        the media type, without the first
+        ";" and without the base64 flag,
+        such as "charset=utf-8", or an empty
+        string if there are none.
+
+        @par Complexity
+        Linear in the size of the parameters.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    parameters() const noexcept
+    {
+        if(params_end_ == type_end_)
+            return {};
+        return slice(
+            type_end_ + 1, params_end_);
+    }
+
+    /** Return true if the data is encoded in base64
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    is_base64() const noexcept
+    {
+        return base64_;
+    }
+
+    /** Return the data
+
+        This returns the data after the
+        comma, up to the fragment of the
+        URL, as it appears in the URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    encoded_data() const noexcept
+    {
+        return u_.buffer().substr(
+            data_, data_end_ - data_);
+    }
+
+    /** Return an upper bound of the size of the decoded data
+
+        The bound is exact for base64 data
+        without escapes, padding or white
+        space, and for other data without
+        escapes.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    max_decoded_size() const noexcept
+    {
+        auto const n = data_end_ - data_;
+        if(! base64_)
+            return n;
+        return n / 4 * 3 + (n % 4) * 3 / 4;
+    }
+
+    /** Decode the data to a buffer
+
+        The data is decoded from base64 when
+        @ref is_base64 is true, and is
+        percent-decoded otherwise. A buffer
+        of @ref max_decoded_size bytes is
+        always large enough. Base64 data may
+        have percent-encoded characters, and
+        decoded white space is skipped, so the
+        data can be split in lines. Blocks of
+        base64 data are decoded with SIMD
+        instructions, when the CPU has them.
+
+        @par Complexity
+        Linear in the size of the data.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of bytes written,
+        or an error if the base64 data is
+        not valid, or if the buffer is too
+        small, in which case the contents
+        of the buffer are unspecified.
+
+        @param dest The buffer to write to.
+
+        @param size The size of the buffer.
+    */
+    BOOST_URL_DECL
+    system::result<std::size_t>
+    decode(
+        char* dest,
+        std::size_t size) const noexcept;
+};
+
+//------------------------------------------------
+
+/** Return a data URL parsed from a string
+
+    The string must be a URI with the scheme
+    "data", and its path must have a comma
+    after the media type and its parameters.
+    The base64 data is checked when it is
+    decoded.
+
+    @par Example
+    @code
+    system::result< data_url_view > rv = parse_data_url( "data:,Hello%2C%20World%21" );
+    @endcode
+
+    @par BNF
+    @code
+    dataurl    := "data:" [ mediatype ] [ ";base64" ] "," data
+    mediatype  := [ type "/" subtype ] *( ";" parameter )
+    data       := *urlchar
+    parameter  := attribute "=" value
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the URL, or an error
+    if the string is not a valid data URL
+
+    @param s The string to parse
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc2397#section-3"
+        >3. Syntax (rfc2397)</a>
+
+    @see
+        @ref data_url_view.
+*/
+BOOST_URL_DECL
+system::result<data_url_view>
+parse_data_url(
+    core::string_view s) noexcept;
+
+} // urls
+} // boost
+
+#endif
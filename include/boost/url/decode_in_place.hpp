@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DECODE_IN_PLACE_HPP
+#define BOOST_URL_DECODE_IN_PLACE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/param.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** Percent-decode a buffer in place
+
+    The percent-encoded string in the
+    buffer is replaced by its decoded
+    form, which is never longer. The
+    characters after the decoded string
+    are left unspecified. No separate
+    destination is needed.
+
+    The string is validated before it is
+    modified; when it contains an invalid
+    escape, the buffer is unchanged.
+
+    @par Example
+    @code
+    char buf[] = "Program%20Files";
+    auto rv = decode_in_place( buf, 15 );
+    assert( core::string_view( buf, *rv ) == "Program Files" );
+    @endcode
+
+    @par Complexity
+    Linear in `size`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The size of the decoded
+    string, or an error if the string
+    is not a valid percent-encoded string.
+
+    @param data A pointer to the string.
+
+    @param size The size of the string.
+
+    @param opt The options for decoding. If
+    `opt.space_as_plus` is `true`, plus signs
+    are decoded as spaces.
+
+    @see
+        @ref decode_params_in_place,
+        @ref make_pct_string_view.
+*/
+BOOST_URL_DECL
+system::result<std::size_t>
+decode_in_place(
+    char* data,
+    std::size_t size,
+    encoding_opts opt = {}) noexcept;
+
+/** Percent-decode a string in place
+
+    The percent-encoded string is replaced
+    by its decoded form. The string is
+    shrunk to the decoded size, which
+    does not reallocate.
+
+    The string is validated before it is
+    modified; when it contains an invalid
+    escape, the string is unchanged.
+
+    @par Example
+    @code
+    std::string s = "Program%20Files";
+    decode_in_place( s ).value();
+    assert( s == "Program Files" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return An error if the string is not
+    a valid percent-encoded string.
+
+    @param s The string to decode.
+
+    @param opt The options for decoding.
+
+    @see
+        @ref decode_params_in_place.
+*/
+BOOST_URL_DECL
+system::result<void>
+decode_in_place(
+    std::string& s,
+    encoding_opts opt = {}) noexcept;
+
+/** Percent-decode the params of a query in place
+
+    The string is parsed as a query, such
+    as the body of a form, and each key and
+    value is decoded in place. The decoded
+    keys and values are packed at the start
+    of the string without separators, and
+    the string is shrunk to their total
+    size. A @ref param_view referencing the
+    string is appended to `params` for each
+    param, in order.
+
+    This is useful when the encoded form is
+    not needed after the params are parsed,
+    as no second buffer is allocated for the
+    decoded strings.
+
+    The string is validated before it is
+    modified; when it contains an invalid
+    escape, the string is unchanged and no
+    params are appended.
+
+    @par Example
+    @code
+    std::string s = "name=John+Doe&msg=a%26b";
+    std::vector< param_view > v;
+    decode_params_in_place( s, v, encoding_opts( true ) ).value();
+    assert( v[0].key == "name" && v[0].value == "John Doe" );
+    assert( v[1].key == "msg" && v[1].value == "a&b" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @return An error if the string is not
+    a valid percent-encoded string.
+
+    @param s The query to decode. The views
+    appended to `params` are invalidated
+    when it is modified.
+
+    @param params The container to which
+    the params are appended.
+
+    @param opt The options for decoding. If
+    `opt.space_as_plus` is `true`, plus signs
+    are decoded as spaces, as in forms.
+
+    @see
+        @ref decode_in_place,
+        @ref parse_query.
+*/
+BOOST_URL_DECL
+system::result<void>
+decode_params_in_place(
+    std::string& s,
+    std::vector<param_view>& params,
+    encoding_opts opt = {});
+
+} // urls
+} // boost
+
+#endif
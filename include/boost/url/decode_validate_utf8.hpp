@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DECODE_VALIDATE_UTF8_HPP
+#define BOOST_URL_DECODE_VALIDATE_UTF8_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Percent-decode a string and validate it as UTF-8
+
+    The string is decoded to `dest`, and the
+    decoded characters are validated as UTF-8
+    in the same pass. Runs of characters which
+    are neither escapes nor above 0x7F are
+    copied in blocks.
+
+    The whole string is always decoded. When
+    the decoded characters are not valid
+    UTF-8, the returned value is the offset
+    in `dest` of the first invalid sequence:
+    the start of an overlong, surrogate, out
+    of range, or truncated sequence, or a
+    continuation byte without one.
+
+    Since a slash is not part of a multibyte
+    sequence, the decoded path of a
+    @ref segments_view, as given by
+    `buffer()`, is valid if and only if each
+    of its segments is valid.
+
+    @par Example
+    @code
+    url_view u( "/files/r%C3%A9sum%C3%A9.pdf" );
+    pct_string_view s = u.segments().buffer();
+    std::string buf( s.decoded_size(), '\0' );
+    assert( decode_validate_utf8( s, &buf[0] ) == buf.size() );
+    @endcode
+
+    @par Preconditions
+    `dest` points to at least `s.decoded_size()`
+    characters.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The offset in the decoded string
+    of the first invalid UTF-8 sequence, or
+    `s.decoded_size()` if there is none.
+
+    @param s The string to decode.
+
+    @param dest The destination buffer.
+
+    @param opt The options for decoding. If
+    `opt.space_as_plus` is `true`, plus signs
+    are decoded as spaces.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc3629#section-4"
+        >4. Syntax of UTF-8 Byte Sequences (rfc3629)</a>
+
+    @see
+        @ref decode_in_place,
+        @ref decode_view.
+*/
+BOOST_URL_DECL
+std::size_t
+decode_validate_utf8(
+    pct_string_view s,
+    char* dest,
+    encoding_opts opt = {}) noexcept;
+
+/** Percent-decode a view and validate it as UTF-8
+
+    @par Effects
+    @code
+    return decode_validate_utf8( s.encoded(), dest, s.options() );
+    @endcode
+
+    @par Preconditions
+    `dest` points to at least `s.size()`
+    characters.
+
+    @par Complexity
+    Linear in `s.encoded().size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The offset in the decoded string
+    of the first invalid UTF-8 sequence, or
+    `s.size()` if there is none.
+
+    @param s The view to decode.
+
+    @param dest The destination buffer.
+*/
+inline
+std::size_t
+decode_validate_utf8(
+    decode_view const& s,
+    char* dest) noexcept
+{
+    return decode_validate_utf8(
+        s.encoded(), dest, s.options());
+}
+
+} // urls
+} // boost
+
+#endif
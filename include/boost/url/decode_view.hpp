@@ -266,6 +266,35 @@ public:
         return dn_;
     }
 
+    /** Return the encoded characters
+
+        The returned string refers to the
+        contiguous characters which this
+        view decodes, so algorithms which
+        work on raw bytes can be used on
+        them without stepping through the
+        decoded characters one at a time.
+
+        @par Example
+        @code
+        decode_view v( "Program%20Files" );
+        assert( v.encoded() == "Program%20Files" );
+        assert( v.encoded().decoded_size() == v.size() );
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    encoded() const noexcept
+    {
+        return make_pct_string_view_unsafe(
+            p_, n_, dn_);
+    }
+
     /** Return an iterator to the beginning
 
         @par Example
@@ -573,6 +602,32 @@ private:
     {
         return -s1.compare(s0);
     }
+
+    static
+    std::size_t
+    decoded_size_of(decode_view s) noexcept
+    {
+        return s.size();
+    }
+
+    static
+    std::size_t
+    decoded_size_of(core::string_view s) noexcept
+    {
+        return s.size();
+    }
+
+    // the decoded sizes are known,
+    // so unequal sizes are not compared
+    template <class S0, class S1>
+    static
+    bool
+    decode_equal(S0 const& s0, S1 const& s1) noexcept
+    {
+        return
+            decoded_size_of(s0) == decoded_size_of(s1) &&
+            decode_compare(s0, s1) == 0;
+    }
 public:
 
     template<class S0, class S1>
@@ -581,7 +636,7 @@ public:
         typename std::enable_if<
             is_match<S0, S1>::value, bool>::type
     {
-        return decode_compare(s0, s1) == 0;
+        return decode_equal(s0, s1);
     }
 
     template<class S0, class S1>
@@ -590,7 +645,7 @@ public:
         typename std::enable_if<
             is_match<S0, S1>::value, bool>::type
     {
-        return decode_compare(s0, s1) != 0;
+        return ! decode_equal(s0, s1);
     }
 
     template<class S0, class S1>
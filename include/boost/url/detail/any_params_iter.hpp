@@ -80,6 +80,26 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept = 0;
+
+    // Measure and increment all the
+    // remaining elements.
+    // Returns the number of elements.
+    // n is increased by their encoded
+    // size, without separators.
+    // Can throw on bad percent-escape
+    BOOST_URL_DECL
+    virtual
+    std::size_t
+    measure_all(std::size_t& n);
+
+    // Copy all the remaining elements,
+    // with a '&' between each of them
+    BOOST_URL_DECL
+    virtual
+    void
+    copy_all(
+        char*& dest,
+        char const* end) noexcept;
 };
 
 //------------------------------------------------
@@ -219,6 +239,36 @@ private:
         copy_impl(dest, end,
             param_view(*it_++));
     }
+
+    // The loops over a whole range
+    // make one virtual call each
+
+    std::size_t
+    measure_all(
+        std::size_t& n) noexcept override
+    {
+        std::size_t nparam = 0;
+        for(; it_ != end_; ++it_, ++nparam)
+            measure_impl(n, param_view(*it_));
+        return nparam;
+    }
+
+    void
+    copy_all(
+        char*& dest,
+        char const* end) noexcept override
+    {
+        if(it_ == end_)
+            return;
+        copy_impl(dest, end,
+            param_view(*it_++));
+        for(; it_ != end_; ++it_)
+        {
+            *dest++ = '&';
+            copy_impl(dest, end,
+                param_view(*it_));
+        }
+    }
 };
 
 //------------------------------------------------
@@ -331,6 +381,38 @@ private:
         copy_impl(dest, end,
             param_view(*it_++));
     }
+
+    std::size_t
+    measure_all(
+        std::size_t& n) override
+    {
+        std::size_t nparam = 0;
+        for(; it_ != end_; ++it_, ++nparam)
+        {
+            // throw on invalid input
+            measure_impl(n,
+                param_pct_view(
+                    param_view(*it_)));
+        }
+        return nparam;
+    }
+
+    void
+    copy_all(
+        char*& dest,
+        char const* end) noexcept override
+    {
+        if(it_ == end_)
+            return;
+        copy_impl(dest, end,
+            param_view(*it_++));
+        for(; it_ != end_; ++it_)
+        {
+            *dest++ = '&';
+            copy_impl(dest, end,
+                param_view(*it_));
+        }
+    }
 };
 
 //------------------------------------------------
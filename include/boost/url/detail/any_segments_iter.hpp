@@ -12,6 +12,7 @@
 
 #include <boost/url/pct_string_view.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/core/ignore_unused.hpp>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -69,6 +70,23 @@ public:
     // element, encoding as needed.
     virtual void copy(char*& dest,
         char const* end) noexcept = 0;
+
+    // Measure and increment all the
+    // remaining elements. n is increased
+    // by their encoded size, without
+    // separators. Returns the number of
+    // elements. encode_colons only applies
+    // to the first one, and is cleared.
+    BOOST_URL_DECL virtual std::size_t
+        measure_all(std::size_t& n);
+
+    // Copy the nseg remaining elements,
+    // with a '/' between each of them.
+    // encode_colons only applies to the
+    // first one, and is cleared.
+    BOOST_URL_DECL virtual void copy_all(
+        char*& dest, char const* end,
+        std::size_t nseg) noexcept;
 };
 
 //------------------------------------------------
@@ -181,6 +199,51 @@ private:
             detail::to_sv(*it_++),
             encode_colons);
     }
+
+    // The loops over a whole range
+    // make one virtual call each
+
+    std::size_t
+    measure_all(
+        std::size_t& n) noexcept override
+    {
+        if(it_ == end_)
+            return 0;
+        measure_impl(n,
+            detail::to_sv(*it_),
+            encode_colons);
+        encode_colons = false;
+        std::size_t nseg = 1;
+        for(++it_; it_ != end_; ++it_, ++nseg)
+            measure_impl(n,
+                detail::to_sv(*it_),
+                false);
+        return nseg;
+    }
+
+    void
+    copy_all(
+        char*& dest,
+        char const* end,
+        std::size_t nseg) noexcept override
+    {
+        BOOST_ASSERT(static_cast<std::size_t>(
+            std::distance(it_, end_)) == nseg);
+        ignore_unused(nseg);
+        if(it_ == end_)
+            return;
+        copy_impl(dest, end,
+            detail::to_sv(*it_),
+            encode_colons);
+        encode_colons = false;
+        for(++it_; it_ != end_; ++it_)
+        {
+            *dest++ = '/';
+            copy_impl(dest, end,
+                detail::to_sv(*it_),
+                false);
+        }
+    }
 };
 
 //------------------------------------------------
@@ -298,6 +361,54 @@ private:
             detail::to_sv(*it_++),
             encode_colons);
     }
+
+    // The loops over a whole range
+    // make one virtual call each
+
+    std::size_t
+    measure_all(
+        std::size_t& n) override
+    {
+        if(it_ == end_)
+            return 0;
+        measure_impl(n,
+            // throw on invalid input
+            pct_string_view(
+                detail::to_sv(*it_)),
+            encode_colons);
+        encode_colons = false;
+        std::size_t nseg = 1;
+        for(++it_; it_ != end_; ++it_, ++nseg)
+            measure_impl(n,
+                pct_string_view(
+                    detail::to_sv(*it_)),
+                false);
+        return nseg;
+    }
+
+    void
+    copy_all(
+        char*& dest,
+        char const* end,
+        std::size_t nseg) noexcept override
+    {
+        BOOST_ASSERT(static_cast<std::size_t>(
+            std::distance(it_, end_)) == nseg);
+        ignore_unused(nseg);
+        if(it_ == end_)
+            return;
+        copy_impl(dest, end,
+            detail::to_sv(*it_),
+            encode_colons);
+        encode_colons = false;
+        for(++it_; it_ != end_; ++it_)
+        {
+            *dest++ = '/';
+            copy_impl(dest, end,
+                detail::to_sv(*it_),
+                false);
+        }
+    }
 };
 
 //------------------------------------------------
@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_COMPACT_URL_VIEW_HPP
+#define BOOST_URL_DETAIL_COMPACT_URL_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+class compact_url_base
+    : protected parts_base
+{
+protected:
+    // the parts of a url which are
+    // kept by a compact_url_view
+    struct parts
+    {
+        char const* cs = nullptr;
+        // offset of id_user ... id_end
+        std::size_t offset[id_end + 1] = {};
+        std::size_t nseg = 0;
+        std::size_t nparam = 0;
+        std::uint16_t port_number = 0;
+        urls::host_type host_type =
+            urls::host_type::none;
+        urls::scheme scheme =
+            urls::scheme::none;
+    };
+
+    BOOST_URL_DECL
+    static
+    void
+    get(
+        url_view_base const& u,
+        parts& p) noexcept;
+
+    // the decoded sizes and the
+    // ip address are computed again
+    BOOST_URL_DECL
+    static
+    url_view
+    construct(parts const& p) noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
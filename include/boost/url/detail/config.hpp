@@ -52,6 +52,44 @@
 # endif
 #endif
 
+// Set up AVX2, selected at runtime
+#if ! defined(BOOST_URL_NO_AVX2) && \
+    ! defined(BOOST_URL_USE_AVX2)
+# if defined(BOOST_URL_USE_SSE2) && \
+    (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(_MSC_VER))
+#  define BOOST_URL_USE_AVX2
+# endif
+#endif
+
+// Set up SSSE3, selected at runtime
+#if ! defined(BOOST_URL_NO_SSSE3) && \
+    ! defined(BOOST_URL_USE_SSSE3)
+# if defined(BOOST_URL_USE_SSE2) && \
+    (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(_MSC_VER))
+#  define BOOST_URL_USE_SSSE3
+# endif
+#endif
+
+// Set up SSE4.2, selected at runtime
+#if ! defined(BOOST_URL_NO_SSE42) && \
+    ! defined(BOOST_URL_USE_SSE42)
+# if defined(BOOST_URL_USE_SSE2) && \
+    (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(_MSC_VER))
+#  define BOOST_URL_USE_SSE42
+# endif
+#endif
+
+// Set up NEON
+#if ! defined(BOOST_URL_NO_NEON) && \
+    ! defined(BOOST_URL_USE_NEON)
+# if defined(__aarch64__) || defined(_M_ARM64)
+#  define BOOST_URL_USE_NEON
+# endif
+#endif
+
 // constexpr
 #if BOOST_WORKAROUND( BOOST_GCC_VERSION, <= 72000 ) || \
     BOOST_WORKAROUND( BOOST_CLANG_VERSION, <= 35000 )
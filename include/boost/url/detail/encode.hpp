@@ -13,9 +13,11 @@
 
 #include <boost/url/encoding_opts.hpp>
 #include <boost/url/pct_string_view.hpp>
+#include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <cstdlib>
+#include <cstring>
 
 namespace boost {
 namespace urls {
@@ -41,60 +43,49 @@ re_encoded_size_unsafe(
     CharSet const& unreserved,
     encoding_opts opt) noexcept
 {
+    // '%' must be reserved
+    BOOST_ASSERT(! unreserved('%'));
+    // space is only encoded as a plus
+    // when it is not unreserved.
+    bool const plus =
+        opt.space_as_plus &&
+        ! unreserved(' ');
+
     std::size_t n = 0;
     auto const end = s.end();
     auto it = s.begin();
-    if(opt.space_as_plus)
+    while(it != end)
     {
-        while(it != end)
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, end, unreserved);
+        n += p - it;
+        it = p;
+        if(it == end)
+            break;
+        if(*it == '%')
         {
-            if(*it != '%')
-            {
-                if( unreserved(*it)
-                    || *it == ' ')
-                    n += 1; 
-                else
-                    n += 3;
-                ++it;
-            }
-            else
-            {
-                BOOST_ASSERT(end - it >= 3);
-                BOOST_ASSERT(
-                    grammar::hexdig_value(
-                        it[1]) >= 0);
-                BOOST_ASSERT(
-                    grammar::hexdig_value(
-                        it[2]) >= 0);
-                n += 3;
-                it += 3;
-            }
+            BOOST_ASSERT(end - it >= 3);
+            BOOST_ASSERT(
+                grammar::hexdig_value(
+                    it[1]) >= 0);
+            BOOST_ASSERT(
+                grammar::hexdig_value(
+                    it[2]) >= 0);
+            n += 3;
+            it += 3;
         }
-    }
-    else
-    {
-        while(it != end)
+        else if(
+            plus &&
+            *it == ' ')
         {
-            if(*it != '%')
-            {
-                if(unreserved(*it))
-                    n += 1; 
-                else
-                    n += 3;
-                ++it;
-            }
-            else
-            {
-                BOOST_ASSERT(end - it >= 3);
-                BOOST_ASSERT(
-                    grammar::hexdig_value(
-                        it[1]) >= 0);
-                BOOST_ASSERT(
-                    grammar::hexdig_value(
-                        it[2]) >= 0);
-                n += 3;
-                it += 3;
-            }
+            n += 1;
+            ++it;
+        }
+        else
+        {
+            n += 3;
+            ++it;
         }
     }
     return n;
@@ -127,72 +118,56 @@ re_encode_unsafe(
     };
     ignore_unused(end);
 
+    // '%' must be reserved
+    BOOST_ASSERT(! unreserved('%'));
+    // space is only encoded as a plus
+    // when it is not unreserved.
+    bool const plus =
+        opt.space_as_plus &&
+        ! unreserved(' ');
+
     auto dest = dest_;
     auto const dest0 = dest;
     auto const last = s.end();
     std::size_t dn = 0;
     auto it = s.begin();
 
-    if(opt.space_as_plus)
+    while(it != last)
     {
-        while(it != last)
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, last, unreserved);
+        std::size_t const n = p - it;
+        BOOST_ASSERT(
+            n <= static_cast<std::size_t>(
+                end - dest));
+        if(n > 0)
+            std::memcpy(dest, it, n);
+        dest += n;
+        it = p;
+        if(it == last)
+            break;
+        BOOST_ASSERT(dest != end);
+        if(*it == '%')
         {
+            *dest++ = *it++;
             BOOST_ASSERT(dest != end);
-            if(*it != '%')
-            {
-                if(*it == ' ')
-                {
-                    *dest++ = '+';
-                }
-                else if(unreserved(*it))
-                {
-                    *dest++ = *it;
-                }
-                else
-                {
-                    encode(dest, *it);
-                    dn += 2;
-                }
-                ++it;
-            }
-            else
-            {
-                *dest++ = *it++;
-                BOOST_ASSERT(dest != end);
-                *dest++ = *it++;
-                BOOST_ASSERT(dest != end);
-                *dest++ = *it++;
-                dn += 2;
-            }
+            *dest++ = *it++;
+            BOOST_ASSERT(dest != end);
+            *dest++ = *it++;
+            dn += 2;
         }
-    }
-    else
-    {
-        while(it != last)
+        else if(
+            plus &&
+            *it == ' ')
         {
-            BOOST_ASSERT(dest != end);
-            if(*it != '%')
-            {
-                if(unreserved(*it))
-                {
-                    *dest++ = *it;
-                }
-                else
-                {
-                    encode(dest, *it);
-                    dn += 2;
-                }
-                ++it;
-            }
-            else
-            {
-                *dest++ = *it++;
-                BOOST_ASSERT(dest != end);
-                *dest++ = *it++;
-                BOOST_ASSERT(dest != end);
-                *dest++ = *it++;
-                dn += 2;
-            }
+            *dest++ = '+';
+            ++it;
+        }
+        else
+        {
+            encode(dest, *it++);
+            dn += 2;
         }
     }
     dest_ = dest;
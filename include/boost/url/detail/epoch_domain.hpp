@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_EPOCH_DOMAIN_HPP
+#define BOOST_URL_DETAIL_EPOCH_DOMAIN_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The readers of a hot_table, counted
+// per epoch so that a writer can wait
+// for the readers of an old table.
+//
+// The epoch has two values. A reader
+// adds one to the counter of the
+// current epoch before it loads the
+// table, and removes it when it is
+// done, so entering and leaving take
+// one atomic operation each and never
+// wait. The counters are spread over
+// slots chosen by thread, so readers
+// on different threads rarely share
+// a cache line.
+//
+// A writer which has replaced the
+// table flips the epoch and waits for
+// the counter of the previous epoch to
+// drop to zero, twice, so that every
+// reader which could have loaded the
+// old table has left.
+class BOOST_URL_DECL epoch_domain
+{
+    struct slot
+    {
+        std::atomic<std::size_t> n[2];
+        char pad[64 - 2 * sizeof(
+            std::atomic<std::size_t>)];
+    };
+
+    static constexpr std::size_t
+        slot_count = 16;
+
+    slot slots_[slot_count];
+    std::atomic<std::size_t> epoch_{0};
+
+public:
+    epoch_domain() noexcept;
+
+    epoch_domain(epoch_domain const&) = delete;
+    epoch_domain& operator=(epoch_domain const&) = delete;
+
+    // returns the token to leave with
+    std::size_t
+    enter() noexcept;
+
+    void
+    leave(std::size_t token) noexcept;
+
+    // waits until the readers which
+    // entered before the call have left
+    void
+    synchronize() noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_FILE_ROUTER_HPP
+#define BOOST_URL_DETAIL_FILE_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/url_fingerprint.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+class file_router_base
+{
+public:
+    static constexpr std::size_t npos = std::size_t(-1);
+
+protected:
+    // the routes are a trie of the
+    // decoded segments of the prefixes
+    struct node
+    {
+        std::size_t key = 0;
+        std::size_t size = 0;
+        // children, sorted by key
+        std::vector<std::size_t> children;
+        std::size_t route = npos;
+    };
+
+    struct root_dir
+    {
+        std::size_t pos;
+        std::size_t size;
+    };
+
+    // write the decoded path, with its dot
+    // segments removed, as "/seg/seg", or
+    // return false if a segment decodes to
+    // a separator or a null character
+    BOOST_URL_DECL
+    static
+    bool
+    normalize(
+        segments_encoded_view segs,
+        std::string& out);
+
+    BOOST_URL_DECL
+    static
+    url_fingerprint
+    digest(core::string_view s) noexcept;
+
+    BOOST_URL_DECL
+    std::size_t
+    insert_impl(
+        core::string_view prefix,
+        core::string_view root);
+
+    // return the route of the longest
+    // prefix of a normalized path, and
+    // where the rest of the path begins
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        core::string_view path,
+        std::size_t& rest) const noexcept;
+
+    // replace the prefix of a normalized
+    // path with the root of its route
+    BOOST_URL_DECL
+    void
+    join(
+        std::size_t route,
+        std::size_t rest,
+        std::string& path) const;
+
+    BOOST_URL_DECL
+    std::size_t
+    resolve_impl(
+        segments_encoded_view segs,
+        std::string& out) const;
+
+    core::string_view
+    root(std::size_t route) const noexcept
+    {
+        auto const& r = roots_[route];
+        return core::string_view(
+            keys_.data() + r.pos, r.size);
+    }
+
+    std::vector<node> nodes_;
+    std::vector<root_dir> roots_;
+    std::string keys_;
+
+private:
+    core::string_view
+    key(node const& n) const noexcept
+    {
+        return core::string_view(
+            keys_.data() + n.key, n.size);
+    }
+
+    std::size_t
+    child(
+        std::size_t parent,
+        core::string_view k) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -15,6 +15,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <array>
+#include <type_traits>
 
 // This file implements functions and classes to
 // type-erase format arguments.
@@ -98,8 +99,22 @@ struct named_arg
 };
 
 // A type erased format argument
+//
+// Strings and integers, which are most
+// arguments, are stored by value and
+// formatted with a switch on their kind.
+// Other types are formatted through
+// function pointers.
 class format_arg
 {
+    enum class kind : unsigned char
+    {
+        custom,
+        string,
+        signed_int,
+        unsigned_int
+    };
+
     void const* arg_;
     void (*measure_)(
         format_parse_context&,
@@ -113,8 +128,73 @@ class format_arg
         void const* );
     core::string_view name_;
     std::size_t value_ = 0;
+    core::string_view str_;
+    union
+    {
+        long long int s;
+        unsigned long long int u;
+    } int_{};
+    kind kind_ = kind::custom;
     bool ignore_ = false;
 
+    template <class T>
+    static
+    constexpr
+    kind
+    kind_of() noexcept;
+
+    template <class A>
+    void
+    set_value( A const& a );
+
+    template <class A>
+    void
+    set_value(
+        A const&,
+        std::integral_constant<
+            kind, kind::custom>) noexcept
+    {
+    }
+
+    template <class A>
+    void
+    set_value(
+        A const& a,
+        std::integral_constant<
+            kind, kind::string>) noexcept
+    {
+        str_ = a;
+    }
+
+    void
+    set_value(
+        char const& c,
+        std::integral_constant<
+            kind, kind::string>) noexcept
+    {
+        str_ = core::string_view(&c, 1);
+    }
+
+    template <class A>
+    void
+    set_value(
+        A const& a,
+        std::integral_constant<
+            kind, kind::signed_int>) noexcept
+    {
+        int_.s = a;
+    }
+
+    template <class A>
+    void
+    set_value(
+        A const& a,
+        std::integral_constant<
+            kind, kind::unsigned_int>) noexcept
+    {
+        int_.u = a;
+    }
+
     template <class A>
     static
     void
@@ -157,19 +237,13 @@ public:
     measure(
         format_parse_context& pctx,
         measure_context& mctx,
-        grammar::lut_chars const& cs)
-    {
-        measure_( pctx, mctx, cs, arg_ );
-    }
+        grammar::lut_chars const& cs);
 
     void
     format(
         format_parse_context& pctx,
         format_context& fctx,
-        grammar::lut_chars const& cs )
-    {
-        fmt_( pctx, fctx, cs, arg_ );
-    }
+        grammar::lut_chars const& cs );
 
     core::string_view
     name() const
@@ -10,6 +10,8 @@
 #ifndef BOOST_URL_DETAIL_IMPL_FORMAT_ARGS_HPP
 #define BOOST_URL_DETAIL_IMPL_FORMAT_ARGS_HPP
 
+#include <boost/mp11/algorithm.hpp>
+
 namespace boost {
 namespace urls {
 namespace detail {
@@ -64,6 +66,52 @@ BOOST_URL_DECL
 std::size_t
 get_uvalue( char a );
 
+// the integer types with a formatter
+using format_int_types = mp11::mp_list<
+    short int,
+    int,
+    long int,
+    long long int,
+    unsigned short int,
+    unsigned int,
+    unsigned long int,
+    unsigned long long int>;
+
+// Only the types whose formatter is provided
+// by the library take the builtin kinds, so
+// a formatter for any other type is used
+template <class T>
+constexpr
+auto
+format_arg::
+kind_of() noexcept ->
+    kind
+{
+    return
+        mp11::mp_contains<
+            format_int_types, T>::value ?
+            (std::is_unsigned<T>::value ?
+                kind::unsigned_int :
+                kind::signed_int) :
+        (std::is_same<T, core::string_view>::value ||
+        std::is_same<T, char const*>::value ||
+        std::is_same<T, char>::value) ?
+            kind::string :
+            kind::custom;
+}
+
+template <class A>
+void
+format_arg::
+set_value( A const& a )
+{
+    using ref_t = typename std::remove_cv<
+        typename std::remove_reference<A>::type>::type;
+    kind_ = kind_of<ref_t>();
+    set_value(a, std::integral_constant<
+        kind, kind_of<ref_t>()>{});
+}
+
 template<class A>
 format_arg::
 format_arg( A&& a )
@@ -72,7 +120,9 @@ format_arg( A&& a )
     , fmt_( &format_impl<A> )
     , value_( get_uvalue(std::forward<A>(a) ))
     , ignore_( std::is_same<A, ignore_format>::value )
-{}
+{
+    set_value(a);
+}
 
 template<class A>
 format_arg::
@@ -82,7 +132,9 @@ format_arg( named_arg<A>&& a )
     , fmt_( &format_impl<A> )
     , name_( a.name )
     , value_( get_uvalue(a.value))
-{}
+{
+    set_value(a.value);
+}
 
 template<class A>
 format_arg::
@@ -92,7 +144,9 @@ format_arg( core::string_view name, A&& a )
     , fmt_( &format_impl<A> )
     , name_( name )
     , value_( get_uvalue(a) )
-{}
+{
+    set_value(a);
+}
 
 // define the type-erased implementations that
 // depends on everything: the context types,
@@ -368,15 +422,8 @@ public:
 template <class T>
 struct formatter<
     T, typename std::enable_if<
-        mp11::mp_contains<mp11::mp_list<
-            short int,
-            int,
-            long int,
-            long long int,
-            unsigned short int,
-            unsigned int,
-            unsigned long int,
-            unsigned long long int>, T>::value>::type>
+        mp11::mp_contains<
+            format_int_types, T>::value>::type>
 {
 private:
     integer_formatter_impl impl_;
@@ -411,6 +458,80 @@ public:
     }
 };
 
+// the builtin kinds are formatted
+// without an indirect call
+inline
+void
+format_arg::
+measure(
+    format_parse_context& pctx,
+    measure_context& mctx,
+    grammar::lut_chars const& cs)
+{
+    switch (kind_)
+    {
+    case kind::string:
+    {
+        formatter<core::string_view> f;
+        pctx.advance_to( f.parse(pctx) );
+        mctx.advance_to( f.measure( str_, mctx, cs ) );
+        return;
+    }
+    case kind::signed_int:
+    {
+        integer_formatter_impl f;
+        pctx.advance_to( f.parse(pctx) );
+        mctx.advance_to( f.measure( int_.s, mctx, cs ) );
+        return;
+    }
+    case kind::unsigned_int:
+    {
+        integer_formatter_impl f;
+        pctx.advance_to( f.parse(pctx) );
+        mctx.advance_to( f.measure( int_.u, mctx, cs ) );
+        return;
+    }
+    default:
+        measure_( pctx, mctx, cs, arg_ );
+    }
+}
+
+inline
+void
+format_arg::
+format(
+    format_parse_context& pctx,
+    format_context& fctx,
+    grammar::lut_chars const& cs)
+{
+    switch (kind_)
+    {
+    case kind::string:
+    {
+        formatter<core::string_view> f;
+        pctx.advance_to( f.parse(pctx) );
+        fctx.advance_to( f.format( str_, fctx, cs ) );
+        return;
+    }
+    case kind::signed_int:
+    {
+        integer_formatter_impl f;
+        pctx.advance_to( f.parse(pctx) );
+        fctx.advance_to( f.format( int_.s, fctx, cs ) );
+        return;
+    }
+    case kind::unsigned_int:
+    {
+        integer_formatter_impl f;
+        pctx.advance_to( f.parse(pctx) );
+        fctx.advance_to( f.format( int_.u, fctx, cs ) );
+        return;
+    }
+    default:
+        fmt_( pctx, fctx, cs, arg_ );
+    }
+}
+
 } // detail
 } // url
 } // boost
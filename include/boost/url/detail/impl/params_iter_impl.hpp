@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_PARAMS_ITER_IMPL_HPP
+#define BOOST_URL_DETAIL_IMPL_PARAMS_ITER_IMPL_HPP
+
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// These run once per param while
+// iterating, so they are inline
+
+// set up state for key/value at pos
+inline
+void
+params_iter_impl::
+setup() noexcept
+{
+    dk = 1;
+    dv = 0;
+    auto const end = ref.end();
+    BOOST_ASSERT(pos != ref.size());
+    auto p0 = ref.begin() + pos;
+    auto p = p0;
+    // key
+    for(;;)
+    {
+        if( p == end ||
+            *p == '&')
+        {
+            // no value
+            nk = 1 + p - p0;
+            dk = nk - dk;
+            nv = 0;
+            return;
+        }
+        if(*p == '=')
+            break;
+        if(*p == '%')
+        {
+            BOOST_ASSERT(
+                end - p >= 3);
+            dk += 2;
+            p += 2;
+        }
+        ++p;
+    }
+    nk = 1 + p - p0;
+    dk = nk - dk;
+    p0 = p;
+
+    // value
+    for(;;)
+    {
+        ++p;
+        if( p == end ||
+            *p == '&')
+            break;
+        if(*p == '%')
+        {
+            BOOST_ASSERT(
+                end - p >= 3);
+            dv += 2;
+            p += 2;
+        }
+    }
+    nv = p - p0;
+    dv = nv - dv - 1;
+}
+
+inline
+void
+params_iter_impl::
+increment() noexcept
+{
+    BOOST_ASSERT(
+        index < ref.nparam());
+    pos += nk + nv;
+    ++index;
+    if(index < ref.nparam())
+        setup();
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
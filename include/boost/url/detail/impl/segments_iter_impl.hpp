@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_SEGMENTS_ITER_IMPL_HPP
+#define BOOST_URL_DETAIL_IMPL_SEGMENTS_ITER_IMPL_HPP
+
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// This runs once per segment while
+// iterating, so it is inline
+
+inline
+void
+segments_iter_impl::
+increment() noexcept
+{
+    BOOST_ASSERT(
+        index != ref.nseg());
+    ++index;
+    pos = next;
+    if(index == ref.nseg())
+        return;
+    // "/" segment
+    auto const end = ref.end();
+    auto p = ref.data() + pos;
+    BOOST_ASSERT(p != end);
+    BOOST_ASSERT(*p == '/');
+    dn = 0;
+    ++p; // skip '/'
+    auto const p0 = p;
+    while(p != end)
+    {
+        if(*p == '/')
+            break;
+        if(*p != '%')
+        {
+            ++p;
+            continue;
+        }
+        p += 3;
+        dn += 2;
+    }
+    next = p - ref.data();
+    dn = p - p0 - dn;
+    s_ = make_pct_string_view_unsafe(
+        p0, p - p0, dn);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_INTERN_TABLE_HPP
+#define BOOST_URL_DETAIL_INTERN_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The table shared by url_interner and
+// host_interner. Records are given dense
+// 32-bit ids, and are allocated in an
+// arena which never moves or frees them
+// until the table is destroyed, so they
+// must be trivially destructible.
+//
+// Lookups take no lock: the slots of an
+// open addressing table hold the high
+// half of a 64-bit hash next to the id,
+// and the callback comparing a record
+// with a key is only called when the
+// hashes are equal. Insertions are
+// serialized by a mutex.
+class BOOST_URL_DECL intern_table
+{
+    struct table;
+    struct chunk;
+
+    struct entry
+    {
+        std::uint64_t hash;
+        void const* rec;
+    };
+
+    // entry i of segment k is the
+    // id ((2^k - 1) * first_segment + i)
+    static constexpr std::size_t
+        first_segment = 256;
+    static constexpr int
+        max_segments = 25;
+
+    std::atomic<table*> table_{nullptr};
+    std::atomic<std::uint32_t> size_{0};
+    std::atomic<std::size_t> bytes_{0};
+    std::atomic<entry*> segs_[max_segments];
+
+    // writers only
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::mutex m_;
+#endif
+    chunk* chunks_ = nullptr;
+
+    entry const&
+    at(std::uint32_t id) const noexcept;
+
+    std::uint32_t
+    find(
+        table const*,
+        std::uint64_t,
+        bool(*)(void const*, void const*),
+        void const*) const noexcept;
+
+    void*
+    allocate(std::size_t);
+
+public:
+    static constexpr std::uint32_t npos =
+        std::uint32_t(-1);
+
+    explicit
+    intern_table(std::size_t n = 0);
+
+    ~intern_table();
+
+    intern_table(intern_table const&) = delete;
+    intern_table& operator=(intern_table const&) = delete;
+
+    std::size_t
+    size() const noexcept
+    {
+        return size_.load(
+            std::memory_order_acquire);
+    }
+
+    // the bytes of the records
+    std::size_t
+    arena_size() const noexcept
+    {
+        return bytes_.load(
+            std::memory_order_relaxed);
+    }
+
+    // the record of an id less than size()
+    void const*
+    get(std::uint32_t id) const noexcept
+    {
+        return at(id).rec;
+    }
+
+    // the id of the record for which
+    // eq(record, key) is true, or npos
+    std::uint32_t
+    find(
+        std::uint64_t hash,
+        bool (*eq)(void const*, void const*),
+        void const* key) const noexcept;
+
+    // the id of the record for which
+    // eq(record, key) is true, or else
+    // the id of a new record of n bytes
+    // constructed with init(record, key)
+    std::uint32_t
+    insert(
+        std::uint64_t hash,
+        bool (*eq)(void const*, void const*),
+        void const* key,
+        std::size_t n,
+        void (*init)(void*, void const*));
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
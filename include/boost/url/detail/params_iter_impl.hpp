@@ -81,4 +81,6 @@ struct BOOST_URL_DECL params_iter_impl
 } // urls
 } // boost
 
+#include <boost/url/detail/impl/params_iter_impl.hpp>
+
 #endif
@@ -0,0 +1,796 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PARSE_LITERAL_HPP
+#define BOOST_URL_DETAIL_PARSE_LITERAL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  These functions parse a URI-reference
+    in a constant expression.
+
+    The rules in the rfc directory return
+    system::result and build non-literal
+    types, so they cannot run at compile
+    time. The functions here accept exactly
+    the same strings and compute the same
+    offsets, decoded sizes, and counts that
+    uri_reference_rule stores in url_impl.
+    Any change to those rules must be
+    reflected here; the url_literal tests
+    compare both parsers.
+*/
+
+// The parts of a URL laid out as in url_impl
+struct literal_parts : parts_base
+{
+    std::size_t offset[id_end + 1] = {};
+    std::size_t decoded[id_end] = {};
+    std::size_t nseg = 0;
+    std::size_t nparam = 0;
+    unsigned char ip_addr[16] = {};
+    std::uint16_t port_number = 0;
+    urls::host_type host_type =
+        urls::host_type::none;
+
+    BOOST_CXX14_CONSTEXPR
+    std::size_t
+    len(int id) const noexcept
+    {
+        return offset[id + 1] - (
+            id == id_scheme ? 0 : offset[id]);
+    }
+
+    BOOST_CXX14_CONSTEXPR
+    void
+    set_size(
+        int id,
+        std::size_t n) noexcept
+    {
+        auto const d = n - len(id);
+        for(auto i = id + 1;
+            i <= id_end; ++i)
+            offset[i] += d;
+    }
+};
+
+namespace literal {
+
+constexpr auto user_chars =
+    unreserved_chars + sub_delim_chars;
+
+constexpr auto password_chars =
+    user_chars + ':';
+
+constexpr auto minor_chars =
+    user_chars + ':';
+
+constexpr auto nocolon_pchars =
+    pchars - ':';
+
+// without the '&' which separates params
+constexpr auto query_chars =
+    pchars + '/' + '?' + '[' + ']' - '&';
+
+constexpr auto fragment_chars =
+    pchars + '/' + '?' + '#';
+
+constexpr grammar::lut_chars scheme_chars(
+    "0123456789" "+-."
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+
+BOOST_CXX14_CONSTEXPR
+inline
+int
+hexdig_value(char c) noexcept
+{
+    if(c >= '0' && c <= '9')
+        return c - '0';
+    if(c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if(c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+// size of a valid pct-string once decoded
+BOOST_CXX14_CONSTEXPR
+inline
+std::size_t
+decoded_size(
+    char const* first,
+    char const* last) noexcept
+{
+    std::size_t n = 0;
+    while(first != last)
+    {
+        if(*first == '%')
+            first += 3;
+        else
+            ++first;
+        ++n;
+    }
+    return n;
+}
+
+// *( cs / pct-encoded ), false
+// on a malformed escape
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_encoded(
+    char const*& it,
+    char const* end,
+    grammar::lut_chars const& cs) noexcept
+{
+    while(it != end)
+    {
+        if(cs(*it))
+        {
+            ++it;
+            continue;
+        }
+        if(*it != '%')
+            break;
+        if( end - it < 3 ||
+            hexdig_value(it[1]) < 0 ||
+            hexdig_value(it[2]) < 0)
+            return false;
+        it += 3;
+    }
+    return true;
+}
+
+// dec-octet
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_dec_octet(
+    char const*& it,
+    char const* end,
+    unsigned char& v) noexcept
+{
+    if( it == end ||
+        ! grammar::digit_chars(*it))
+        return false;
+    unsigned n = *it - '0';
+    ++it;
+    if( it != end &&
+        grammar::digit_chars(*it))
+    {
+        if(n == 0)
+            return false;
+        n = 10 * n + (*it - '0');
+        ++it;
+        if( it != end &&
+            grammar::digit_chars(*it))
+        {
+            if(n > 25)
+                return false;
+            n = 10 * n + (*it - '0');
+            if(n > 255)
+                return false;
+            ++it;
+            if( it != end &&
+                grammar::digit_chars(*it))
+                return false;
+        }
+    }
+    v = static_cast<unsigned char>(n);
+    return true;
+}
+
+// IPv4address
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_ipv4(
+    char const*& it,
+    char const* end,
+    unsigned char* b) noexcept
+{
+    for(int i = 0; i < 4; ++i)
+    {
+        if(i > 0)
+        {
+            if( it == end ||
+                *it != '.')
+                return false;
+            ++it;
+        }
+        if(! parse_dec_octet(it, end, b[i]))
+            return false;
+    }
+    return true;
+}
+
+// h16
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_h16(
+    char const*& it,
+    char const* end,
+    unsigned char* b) noexcept
+{
+    if( it == end ||
+        hexdig_value(*it) < 0)
+        return false;
+    unsigned v = 0;
+    for(int i = 0; i < 4; ++i)
+    {
+        if(it == end)
+            break;
+        auto const d = hexdig_value(*it);
+        if(d < 0)
+            break;
+        v = 16 * v + d;
+        ++it;
+    }
+    b[0] = static_cast<unsigned char>(v / 256);
+    b[1] = static_cast<unsigned char>(v % 256);
+    return true;
+}
+
+// IPv6address, as in ipv6_address_rule
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_ipv6(
+    char const*& it,
+    char const* const end,
+    unsigned char* bytes) noexcept
+{
+    int n = 8;      // words needed
+    int b = -1;     // value of n
+                    // when '::' seen
+    bool c = false; // need colon
+    auto prev = it;
+    for(;;)
+    {
+        if(it == end)
+        {
+            if(b != -1)
+                break;
+            return false;
+        }
+        if(*it == ':')
+        {
+            ++it;
+            if(it == end)
+                return false;
+            if(*it == ':')
+            {
+                if(b != -1)
+                    return false;
+                ++it;
+                --n;
+                b = n;
+                if(n == 0)
+                    break;
+                c = false;
+                continue;
+            }
+            if(! c)
+                return false;
+            prev = it;
+            if(! parse_h16(
+                    it, end, &bytes[2*(8-n)]))
+                return false;
+            --n;
+            if(n == 0)
+                break;
+            continue;
+        }
+        if(*it == '.')
+        {
+            if(b == -1 && n > 1)
+                return false;
+            // the last h16 must read
+            // as a decimal octet
+            unsigned const word =
+                bytes[2*(7-n)] * 256u +
+                bytes[2*(7-n)+1];
+            if( word > 0x255 ||
+                ((word >> 4) & 0xf) > 9 ||
+                (word & 0xf) > 9)
+                return false;
+            it = prev;
+            if(! parse_ipv4(
+                    it, end, &bytes[2*(7-n)]))
+                return false;
+            --n;
+            break;
+        }
+        auto const d = hexdig_value(*it);
+        if(b != -1 && d < 0)
+            break;
+        if(c)
+            return false;
+        prev = it;
+        if(! parse_h16(
+                it, end, &bytes[2*(8-n)]))
+            return false;
+        --n;
+        if(n == 0)
+            break;
+        c = true;
+    }
+    if(b == -1)
+        return true;
+    // move the words after "::"
+    // to the end and zero fill
+    int const i0 = 2 * (7 - b);
+    int const i1 = 2 * (b - n);
+    for(int i = i1 - 1; i >= 0; --i)
+        bytes[16 - i1 + i] = bytes[i0 + 2 + i];
+    for(int i = i0; i < 16 - i1; ++i)
+        bytes[i] = 0;
+    return true;
+}
+
+// IP-literal, after the '['
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_ip_literal(
+    char const*& it,
+    char const* const end,
+    literal_parts& p) noexcept
+{
+    if(it == end)
+        return false;
+    if(*it != 'v')
+    {
+        auto const it0 = it;
+        if( parse_ipv6(it, end, p.ip_addr) &&
+            it != end && *it == ']')
+        {
+            ++it;
+            p.host_type = host_type::ipv6;
+            return true;
+        }
+        // IPv6addrz
+        it = it0;
+        for(auto& c : p.ip_addr)
+            c = 0;
+        if(! parse_ipv6(it, end, p.ip_addr))
+            return false;
+        if( end - it < 3 ||
+            it[0] != '%' ||
+            it[1] != '2' ||
+            it[2] != '5')
+            return false;
+        it += 3;
+        auto const z = it;
+        if( ! parse_encoded(
+                it, end, unreserved_chars) ||
+            it == z ||
+            it == end ||
+            *it != ']')
+            return false;
+        ++it;
+        p.host_type = host_type::ipv6;
+        return true;
+    }
+    // IPvFuture
+    ++it;
+    auto const major = it;
+    while( it != end &&
+        hexdig_value(*it) >= 0)
+        ++it;
+    if( it == major ||
+        it == end ||
+        *it != '.')
+        return false;
+    ++it;
+    auto const minor = it;
+    while( it != end &&
+        minor_chars(*it))
+        ++it;
+    if( it == minor ||
+        it == end ||
+        *it != ']')
+        return false;
+    ++it;
+    p.host_type = host_type::ipvfuture;
+    return true;
+}
+
+// authority, after the "//"
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_authority(
+    char const*& it,
+    char const* const end,
+    literal_parts& p) noexcept
+{
+    using id = parts_base;
+
+    // [ userinfo "@" ]
+    {
+        auto const it0 = it;
+        bool ok = parse_encoded(
+            it, end, user_chars);
+        auto const user_end = it;
+        auto pass = it;
+        bool has_pass = false;
+        if( ok &&
+            it != end &&
+            *it == ':')
+        {
+            ++it;
+            pass = it;
+            has_pass = true;
+            ok = parse_encoded(
+                it, end, password_chars);
+        }
+        if( ok &&
+            it != end &&
+            *it == '@')
+        {
+            p.set_size(id::id_user,
+                2 + (user_end - it0));
+            p.decoded[id::id_user] =
+                decoded_size(it0, user_end);
+            if(has_pass)
+            {
+                p.set_size(id::id_pass,
+                    2 + (it - pass));
+                p.decoded[id::id_pass] =
+                    decoded_size(pass, it);
+            }
+            else
+            {
+                p.set_size(id::id_pass, 1);
+            }
+            ++it;
+        }
+        else
+        {
+            it = it0;
+            p.set_size(id::id_user, 2);
+        }
+    }
+
+    // host
+    auto const host = it;
+    p.host_type = host_type::name;
+    if(it != end)
+    {
+        if(*it == '[')
+        {
+            ++it;
+            if(! parse_ip_literal(it, end, p))
+                return false;
+        }
+        else
+        {
+            if(parse_ipv4(it, end, p.ip_addr))
+            {
+                auto const it1 = it;
+                if( parse_encoded(
+                        it, end, user_chars) &&
+                    it != it1)
+                {
+                    for(auto& c : p.ip_addr)
+                        c = 0;
+                }
+                else
+                {
+                    it = it1;
+                    p.host_type = host_type::ipv4;
+                }
+            }
+            else
+            {
+                for(auto& c : p.ip_addr)
+                    c = 0;
+                it = host;
+                if(! parse_encoded(
+                        it, end, user_chars))
+                    return false;
+            }
+        }
+    }
+    p.set_size(id::id_host, it - host);
+    p.decoded[id::id_host] =
+        decoded_size(host, it);
+
+    // [ ":" port ]
+    if( it != end &&
+        *it == ':')
+    {
+        ++it;
+        auto const port = it;
+        std::uint32_t v = 0;
+        while( it != end &&
+            grammar::digit_chars(*it))
+        {
+            // numbers which do not
+            // fit are stored as zero
+            if(v <= 65535)
+                v = 10 * v + (*it - '0');
+            ++it;
+        }
+        if(v <= 65535)
+            p.port_number =
+                static_cast<std::uint16_t>(v);
+        p.set_size(id::id_port,
+            1 + (it - port));
+    }
+    return true;
+}
+
+// *( "/" / segment ) after the first segment
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_segments(
+    char const*& it,
+    char const* const end,
+    std::size_t& nseg) noexcept
+{
+    while(it != end)
+    {
+        if(*it == '/')
+        {
+            ++it;
+            ++nseg;
+            continue;
+        }
+        auto const it0 = it;
+        if(! parse_encoded(it, end, pchars))
+            return false;
+        if(it == it0)
+            break;
+    }
+    return true;
+}
+
+// as in path_segments
+BOOST_CXX14_CONSTEXPR
+inline
+std::size_t
+path_segments(
+    char const* s,
+    std::size_t n,
+    std::size_t nseg) noexcept
+{
+    if(n == 1)
+    {
+        if(s[0] == '/')
+            return 0;
+        return 1;
+    }
+    if(n == 2)
+    {
+        if( s[0] == '.' &&
+            s[1] == '/')
+            return nseg - 1;
+        return nseg;
+    }
+    if(n > 2)
+    {
+        if( s[0] == '/' &&
+            s[1] == '.' &&
+            s[2] == '/')
+            return nseg - 1;
+        if( s[0] == '.' &&
+            s[1] == '/')
+            return nseg - 1;
+    }
+    return nseg;
+}
+
+// [ "//" authority ] and the path,
+// as in hier_part_rule or, when
+// relative is true, relative_part_rule
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_hier_part(
+    char const*& it,
+    char const* const end,
+    literal_parts& p,
+    bool relative) noexcept
+{
+    using id = parts_base;
+    auto path = it;
+    std::size_t nseg = 0;
+    if(end - it == 1)
+    {
+        if(*it == '/')
+        {
+            // path-absolute
+            ++it;
+            nseg = 1;
+        }
+        else if(
+            ! relative ||
+            *it != ':')
+        {
+            // path-rootless or
+            // path-noscheme
+            if(! parse_encoded(it, end, pchars))
+                return false;
+            nseg = it != path;
+        }
+    }
+    else if(it != end)
+    {
+        bool has_authority = false;
+        if( it[0] == '/' &&
+            it[1] == '/')
+        {
+            it += 2;
+            if(! parse_authority(it, end, p))
+                return false;
+            has_authority = true;
+            path = it;
+        }
+        // the authority requires an absolute
+        // path or an empty path, except in
+        // a relative-ref
+        if( it != end && (
+            relative ||
+            ! has_authority ||
+            *it == '/' ||
+            *it == '?' ||
+            *it == '#'))
+        {
+            if(*it != '/')
+            {
+                if(! parse_encoded(it, end,
+                        relative
+                        ? nocolon_pchars
+                        : pchars))
+                    return false;
+                if( it != path &&
+                    relative &&
+                    it != end &&
+                    *it == ':')
+                    return false;
+                if(it != path)
+                {
+                    ++nseg;
+                    if(! parse_segments(
+                            it, end, nseg))
+                        return false;
+                }
+            }
+            else if(! parse_segments(
+                    it, end, nseg))
+            {
+                return false;
+            }
+        }
+    }
+    auto const n =
+        static_cast<std::size_t>(it - path);
+    p.set_size(id::id_path, n);
+    p.decoded[id::id_path] =
+        decoded_size(path, it);
+    p.nseg = path_segments(path, n, nseg);
+    return true;
+}
+
+// URI-reference, as in uri_reference_rule
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_uri_reference(
+    char const* s,
+    std::size_t size,
+    literal_parts& p) noexcept
+{
+    using id = parts_base;
+    auto it = s;
+    auto const end = s + size;
+
+    // scheme ":" hier-part / relative-part
+    bool relative = true;
+    if( it != end &&
+        grammar::alpha_chars(*it))
+    {
+        ++it;
+        while( it != end &&
+            scheme_chars(*it))
+            ++it;
+        if( it != end &&
+            *it == ':')
+        {
+            ++it;
+            p.set_size(id::id_scheme, it - s);
+            relative = false;
+        }
+        else
+        {
+            it = s;
+        }
+    }
+    if(! parse_hier_part(
+            it, end, p, relative))
+        return false;
+
+    // [ "?" query ]
+    if( it != end &&
+        *it == '?')
+    {
+        ++it;
+        auto const query = it;
+        // map "?" to { {} }
+        std::size_t n = 1;
+        while(it != end)
+        {
+            if(*it == '&')
+            {
+                ++n;
+                ++it;
+                continue;
+            }
+            auto const it1 = it;
+            if(! parse_encoded(
+                    it, end, query_chars))
+                return false;
+            if(it == it1)
+                break;
+        }
+        // as in query_rule, which counts
+        // one param unless the query
+        // ends the string
+        if( it == query &&
+            it != end)
+            ++n;
+        p.nparam = n;
+        p.set_size(id::id_query,
+            1 + (it - query));
+        p.decoded[id::id_query] =
+            decoded_size(query, it);
+    }
+
+    // [ "#" fragment ]
+    if( it != end &&
+        *it == '#')
+    {
+        ++it;
+        auto const frag = it;
+        if(! parse_encoded(
+                it, end, fragment_chars))
+            return false;
+        p.set_size(id::id_frag,
+            1 + (it - frag));
+        p.decoded[id::id_frag] =
+            decoded_size(frag, it);
+    }
+    return it == end;
+}
+
+} // literal
+} // detail
+} // urls
+} // boost
+
+#endif
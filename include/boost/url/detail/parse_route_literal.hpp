@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PARSE_ROUTE_LITERAL_HPP
+#define BOOST_URL_DETAIL_PARSE_ROUTE_LITERAL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parse_literal.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+namespace literal {
+
+/*  These functions check a router path
+    template in a constant expression.
+
+    They accept exactly the strings for
+    which router::insert does not throw:
+    the path_template_rule and the dot
+    segment rules in src/detail/router.cpp.
+    Any change to those rules must be
+    reflected here; the route_literal tests
+    compare both.
+*/
+
+// arg_id [ "?" / "*" / "+" ], the
+// contents of a replacement field
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_route_field(
+    char const* it,
+    char const* const end) noexcept
+{
+    if( it != end && (
+        grammar::alpha_chars(*it) ||
+        *it == '_'))
+    {
+        // identifier
+        ++it;
+        while( it != end && (
+            grammar::alnum_chars(*it) ||
+            *it == '_'))
+            ++it;
+    }
+    else if(
+        it != end &&
+        grammar::digit_chars(*it))
+    {
+        // integer, without leading
+        // zeros and within size_t
+        if( *it == '0' &&
+            end - it > 1 &&
+            grammar::digit_chars(it[1]))
+            return false;
+        std::size_t n = 0;
+        while( it != end &&
+            grammar::digit_chars(*it))
+        {
+            std::size_t const d = *it - '0';
+            if(n > (std::size_t(-1) - d) / 10)
+                return false;
+            n = 10 * n + d;
+            ++it;
+        }
+    }
+    if( it != end && (
+        *it == '?' ||
+        *it == '*' ||
+        *it == '+'))
+        ++it;
+    return it == end;
+}
+
+// 1 for ".", 2 for "..",
+// otherwise 0
+BOOST_CXX14_CONSTEXPR
+inline
+int
+route_dots(
+    char const* it,
+    char const* const end) noexcept
+{
+    int n = 0;
+    while(it != end)
+    {
+        if(*it == '.')
+            ++it;
+        else if(
+            end - it >= 3 &&
+            it[0] == '%' &&
+            it[1] == '2' && (
+                it[2] == 'E' ||
+                it[2] == 'e'))
+            it += 3;
+        else
+            return 0;
+        if(++n > 2)
+            return 0;
+    }
+    return n;
+}
+
+// path-template =
+//     [ "/" ] segment-template *( "/" segment-template )
+//
+// Sets the number of replacement
+// fields on success
+BOOST_CXX14_CONSTEXPR
+inline
+bool
+parse_route(
+    char const* it,
+    char const* const end,
+    std::size_t& fields) noexcept
+{
+    fields = 0;
+    if( it != end &&
+        *it == '/')
+        ++it;
+    // levels above the root, and
+    // segments below it
+    std::size_t above = 0;
+    std::size_t below = 0;
+    for(;;)
+    {
+        bool field = false;
+        if( it != end &&
+            *it == '{')
+        {
+            auto close = it + 1;
+            while( close != end &&
+                *close != '}')
+                ++close;
+            if( close != end &&
+                parse_route_field(
+                    it + 1, close))
+            {
+                it = close + 1;
+                field = true;
+                ++fields;
+            }
+        }
+        auto const seg = it;
+        if( ! field &&
+            ! parse_encoded(it, end, pchars))
+            return false;
+        int const dots = field ? 0 :
+            route_dots(seg, it);
+        if(dots == 2)
+        {
+            if(below == 0)
+                ++above;
+            else
+                --below;
+        }
+        else if(dots == 0)
+        {
+            if(above != 0)
+                --above;
+            else
+                ++below;
+        }
+        if(it == end)
+            break;
+        if(*it != '/')
+            return false;
+        ++it;
+    }
+    return above == 0;
+}
+
+} // literal
+} // detail
+} // urls
+} // boost
+
+#endif
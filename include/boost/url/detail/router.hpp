@@ -10,6 +10,7 @@
 #ifndef BOOST_URL_DETAIL_ROUTER_HPP
 #define BOOST_URL_DETAIL_ROUTER_HPP
 
+#include <boost/url/detail/config.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <boost/url/segments_encoded_view.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
@@ -34,21 +35,39 @@ public:
         virtual void const* get() const noexcept = 0;
     };
 
+    // the number of paths find_many_impl
+    // walks through the tree together
+    static constexpr std::size_t batch_size = 16;
+
 protected:
+    BOOST_URL_DECL
     router_base();
 
+    BOOST_URL_DECL
     virtual ~router_base();
 
+    BOOST_URL_DECL
     void
     insert_impl(
         core::string_view s,
         any_resource const* v);
 
+    BOOST_URL_DECL
     any_resource const*
     find_impl(
         segments_encoded_view path,
         core::string_view*& matches,
         core::string_view*& names) const noexcept;
+
+    // n is at most batch_size
+    BOOST_URL_DECL
+    void
+    find_many_impl(
+        segments_encoded_view const* paths,
+        std::size_t n,
+        any_resource const** rs,
+        core::string_view** matches,
+        core::string_view** names) const noexcept;
 };
 
 } // detail
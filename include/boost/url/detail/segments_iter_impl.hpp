@@ -55,7 +55,6 @@ public:
 
     void update() noexcept;
 
-    BOOST_URL_DECL
     void
     increment() noexcept;
 
@@ -82,4 +81,6 @@ public:
 } // urls
 } // boost
 
+#include <boost/url/detail/impl/segments_iter_impl.hpp>
+
 #endif
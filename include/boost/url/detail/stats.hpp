@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_STATS_HPP
+#define BOOST_URL_DETAIL_STATS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The counters behind url_stats. The
+// hooks are empty unless the library
+// and its users are compiled with
+// BOOST_URL_ENABLE_STATS.
+
+BOOST_URL_DECL
+void
+stats_allocate_impl(
+    std::size_t) noexcept;
+
+BOOST_URL_DECL
+void
+stats_deallocate_impl() noexcept;
+
+BOOST_URL_DECL
+void
+stats_reallocate_impl() noexcept;
+
+BOOST_URL_DECL
+void
+stats_recycled_impl(
+    bool hit) noexcept;
+
+BOOST_URL_DECL
+void
+stats_parse_impl(
+    bool ok) noexcept;
+
+#ifdef BOOST_URL_ENABLE_STATS
+
+inline
+void
+stats_allocate(
+    std::size_t n) noexcept
+{
+    stats_allocate_impl(n);
+}
+
+inline
+void
+stats_deallocate() noexcept
+{
+    stats_deallocate_impl();
+}
+
+inline
+void
+stats_reallocate() noexcept
+{
+    stats_reallocate_impl();
+}
+
+inline
+void
+stats_recycled(
+    bool hit) noexcept
+{
+    stats_recycled_impl(hit);
+}
+
+inline
+void
+stats_parse(
+    bool ok) noexcept
+{
+    stats_parse_impl(ok);
+}
+
+#else
+
+inline void stats_allocate(
+    std::size_t) noexcept
+{
+}
+inline void stats_deallocate() noexcept
+{
+}
+inline void stats_reallocate() noexcept
+{
+}
+inline void stats_recycled(
+    bool) noexcept
+{
+}
+inline void stats_parse(
+    bool) noexcept
+{
+}
+
+#endif
+
+} // detail
+} // urls
+} // boost
+
+#endif
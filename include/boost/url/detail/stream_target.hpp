@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_STREAM_TARGET_HPP
+#define BOOST_URL_DETAIL_STREAM_TARGET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Collects the characters of a URL
+// which arrives in several pieces
+class stream_target
+{
+    std::string buf_;
+    // the target, when it was found
+    // entirely in the last chunk
+    core::string_view s_;
+    system::error_code ec_;
+    std::size_t size_ = 0;
+    // hex digits still expected
+    unsigned char pct_ = 0;
+    bool done_ = false;
+    bool in_buf_ = false;
+
+public:
+    stream_target() = default;
+    stream_target(
+        stream_target const&) = delete;
+    stream_target& operator=(
+        stream_target const&) = delete;
+
+    bool
+    done() const noexcept
+    {
+        return done_;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    BOOST_URL_DECL
+    system::result<std::size_t>
+    write(core::string_view s);
+
+    BOOST_URL_DECL
+    system::result<core::string_view>
+    finish() noexcept;
+
+    BOOST_URL_DECL
+    void
+    reset() noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
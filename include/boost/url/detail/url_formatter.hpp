@@ -0,0 +1,301 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_FORMATTER_HPP
+#define BOOST_URL_DETAIL_URL_FORMATTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+enum class url_part : unsigned char
+{
+    all,
+    scheme,
+    authority,
+    userinfo,
+    user,
+    password,
+    host,
+    port,
+    path,
+    query,
+    fragment,
+    origin,
+    resource,
+    target
+};
+
+// The format spec of a URL,
+// "[part][:decoded]" or "decoded"
+struct url_spec
+{
+    url_part part = url_part::all;
+    bool decoded = false;
+};
+
+// Return true if [it, end) begins with
+// the word s, followed by ':' or '}'
+template<class It>
+BOOST_CXX14_CONSTEXPR
+bool
+spec_word(
+    It& it, It end,
+    char const* s) noexcept
+{
+    It p = it;
+    for(; *s; ++s, ++p)
+        if(p == end || *p != *s)
+            return false;
+    if( p != end &&
+        *p != ':' &&
+        *p != '}')
+        return false;
+    it = p;
+    return true;
+}
+
+// Parse a spec, which ends at '}'. Returns
+// false if the spec is invalid, or names
+// a part which T does not have.
+template<class It>
+BOOST_CXX14_CONSTEXPR
+bool
+parse_url_spec(
+    It& it, It end,
+    url_spec& spec,
+    bool is_url) noexcept
+{
+    struct name
+    {
+        char const* s;
+        url_part part;
+        bool authority;
+    };
+    constexpr name names[] = {
+        { "scheme", url_part::scheme, false },
+        { "authority", url_part::authority, true },
+        { "userinfo", url_part::userinfo, true },
+        { "user", url_part::user, true },
+        { "password", url_part::password, true },
+        { "host", url_part::host, true },
+        { "port", url_part::port, true },
+        { "path", url_part::path, false },
+        { "query", url_part::query, false },
+        { "fragment", url_part::fragment, false },
+        { "origin", url_part::origin, false },
+        { "resource", url_part::resource, false },
+        { "target", url_part::target, false },
+    };
+    if(spec_word(it, end, "decoded"))
+    {
+        spec.decoded = true;
+        return it == end || *it == '}';
+    }
+    for(auto const& n : names)
+    {
+        if(! spec_word(it, end, n.s))
+            continue;
+        if(! is_url && ! n.authority)
+            return false;
+        spec.part = n.part;
+        break;
+    }
+    if(it != end && *it == ':')
+    {
+        ++it;
+        if(! spec_word(it, end, "decoded"))
+            return false;
+        spec.decoded = true;
+    }
+    return it == end || *it == '}';
+}
+
+inline
+core::string_view
+get_url_part(
+    url_view_base const& u,
+    url_part part) noexcept
+{
+    switch(part)
+    {
+    default:
+    case url_part::all: return u.buffer();
+    case url_part::scheme: return u.scheme();
+    case url_part::authority: return u.encoded_authority();
+    case url_part::userinfo: return u.encoded_userinfo();
+    case url_part::user: return u.encoded_user();
+    case url_part::password: return u.encoded_password();
+    case url_part::host: return u.encoded_host();
+    case url_part::port: return u.port();
+    case url_part::path: return u.encoded_path();
+    case url_part::query: return u.encoded_query();
+    case url_part::fragment: return u.encoded_fragment();
+    case url_part::origin: return u.encoded_origin();
+    case url_part::resource: return u.encoded_resource();
+    case url_part::target: return u.encoded_target();
+    }
+}
+
+inline
+core::string_view
+get_url_part(
+    authority_view const& a,
+    url_part part) noexcept
+{
+    switch(part)
+    {
+    default:
+    case url_part::all:
+    case url_part::authority: return a.buffer();
+    case url_part::userinfo: return a.encoded_userinfo();
+    case url_part::user: return a.encoded_user();
+    case url_part::password: return a.encoded_password();
+    case url_part::host: return a.encoded_host();
+    case url_part::port: return a.port();
+    }
+}
+
+// Call write once for each run of the
+// decoded string, so that the runs
+// are copied as blocks
+BOOST_URL_DECL
+void
+write_decoded(
+    core::string_view s,
+    bool space_as_plus,
+    void (*write)(void*, char const*, std::size_t),
+    void* out);
+
+template<class OutputIt>
+OutputIt
+format_url_part(
+    core::string_view s,
+    bool decoded,
+    bool space_as_plus,
+    OutputIt out)
+{
+    if( ! decoded ||
+        s.find_first_of(
+            space_as_plus ? "%+" : "%") ==
+                core::string_view::npos)
+        return std::copy(
+            s.data(), s.data() + s.size(), out);
+    write_decoded(s, space_as_plus,
+        [](void* p, char const* d, std::size_t n)
+        {
+            auto& it = *static_cast<OutputIt*>(p);
+            it = std::copy(d, d + n, it);
+        }, &out);
+    return out;
+}
+
+// The formatter of url_view_base and
+// authority_view, for std::format and
+// fmt. Error is the exception thrown
+// by parse on invalid specs.
+template<class T, class Error>
+struct url_formatter
+{
+    url_spec spec;
+
+    template<class ParseContext>
+    BOOST_CXX14_CONSTEXPR
+    auto
+    parse(ParseContext& ctx) ->
+        decltype(ctx.begin())
+    {
+        auto it = ctx.begin();
+        if(! parse_url_spec(it, ctx.end(), spec,
+                std::is_base_of<url_view_base, T>::value))
+            throw Error("invalid URL format spec");
+        return it;
+    }
+
+    template<class FormatContext>
+    auto
+    format(
+        T const& u,
+        FormatContext& ctx) const ->
+            decltype(ctx.out())
+    {
+        return format_url_part(
+            get_url_part(u, spec.part),
+            spec.decoded, false, ctx.out());
+    }
+};
+
+// The formatter of pct_string_view, where
+// the only spec is "decoded", and of
+// decode_view, which has no spec
+template<class T, class Error>
+struct pct_formatter
+{
+    bool decoded =
+        std::is_same<T, decode_view>::value;
+
+    template<class ParseContext>
+    BOOST_CXX14_CONSTEXPR
+    auto
+    parse(ParseContext& ctx) ->
+        decltype(ctx.begin())
+    {
+        auto it = ctx.begin();
+        if( it == ctx.end() ||
+            *it == '}')
+            return it;
+        if( std::is_same<T, decode_view>::value ||
+            ! spec_word(it, ctx.end(), "decoded") ||
+            (it != ctx.end() && *it != '}'))
+            throw Error("invalid pct_string_view format spec");
+        decoded = true;
+        return it;
+    }
+
+    template<class FormatContext>
+    auto
+    format(
+        pct_string_view s,
+        FormatContext& ctx) const ->
+            decltype(ctx.out())
+    {
+        return format_url_part(
+            s, decoded, false, ctx.out());
+    }
+
+    template<class FormatContext>
+    auto
+    format(
+        decode_view const& s,
+        FormatContext& ctx) const ->
+            decltype(ctx.out())
+    {
+        return format_url_part(
+            core::string_view(
+                s.begin().base(),
+                s.end().base() - s.begin().base()),
+            true, s.options().space_as_plus,
+            ctx.out());
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -49,6 +49,10 @@ struct BOOST_URL_DECL url_impl : parts_base
     std::uint16_t port_number_ = 0;
     host_type host_type_ =
         urls::host_type::none;
+    // the host is known to have no escapes
+    // and no uppercase letters, so it is
+    // unchanged by normalization
+    bool host_norm_ = false;
     scheme scheme_ =
         urls::scheme::none;
 
@@ -67,9 +71,40 @@ struct BOOST_URL_DECL url_impl : parts_base
     authority_view
     construct_authority() const noexcept;
 
-    std::size_t len(int, int) const noexcept;
-    std::size_t len(int) const noexcept;
-    std::size_t offset(int) const noexcept;
+    // The accessors used by the iterators
+    // are defined here so they inline
+
+    // return offset of id
+    std::size_t
+    offset(int id) const noexcept
+    {
+        return
+            id == id_scheme
+            ? zero_
+            : offset_[id];
+    }
+
+    // return length of [first, last)
+    std::size_t
+    len(
+        int first,
+        int last) const noexcept
+    {
+        BOOST_ASSERT(first <= last);
+        BOOST_ASSERT(last <= id_end);
+        return offset(last) - offset(first);
+    }
+
+    // return length of part
+    std::size_t
+    len(int id) const noexcept
+    {
+        return id == id_end
+            ? zero_
+            : ( offset(id + 1) -
+                offset(id) );
+    }
+
     core::string_view get(int) const noexcept;
     core::string_view get(int, int) const noexcept;
     pct_string_view pct_get(int) const noexcept;
@@ -111,10 +146,40 @@ public:
     path_ref(core::string_view,
         std::size_t, std::size_t) noexcept;
     pct_string_view buffer() const noexcept;
-    std::size_t size() const noexcept;
-    char const* data() const noexcept;
-    char const* end() const noexcept;
-    std::size_t nseg() const noexcept;
+
+    std::size_t
+    size() const noexcept
+    {
+        if(impl_)
+            return impl_->len(id_path);
+        return size_;
+    }
+
+    char const*
+    data() const noexcept
+    {
+        if(impl_)
+            return impl_->cs_ +
+                impl_->offset(id_path);
+        return data_;
+    }
+
+    char const*
+    end() const noexcept
+    {
+        if(impl_)
+            return impl_->cs_ +
+                impl_->offset(id_query);
+        return data_ + size_;
+    }
+
+    std::size_t
+    nseg() const noexcept
+    {
+        if(impl_)
+            return impl_->nseg_;
+        return nseg_;
+    }
 
     bool
     alias_of(
@@ -160,10 +225,51 @@ public:
     query_ref() = default;
     query_ref(url_impl const& impl) noexcept;
     pct_string_view buffer() const noexcept;
-    std::size_t size() const noexcept; // with '?'
-    char const* begin() const noexcept; // no '?'
-    char const* end() const noexcept;
-    std::size_t nparam() const noexcept;
+
+    // with '?'
+    std::size_t
+    size() const noexcept
+    {
+        if(impl_)
+            return impl_->len(id_query);
+        if(size_ > 0)
+            return size_ + 1;
+        return question_mark_;
+    }
+
+    // no '?'
+    char const*
+    begin() const noexcept
+    {
+        if(impl_)
+        {
+            // using the offset array here
+            auto pos = impl_->offset_[id_query];
+            auto pos1 = impl_->offset_[id_frag];
+            if(pos < pos1)
+                return impl_->cs_ + pos + 1; // no '?'
+            // empty
+            return impl_->cs_ + pos;
+        }
+        return data_;
+    }
+
+    char const*
+    end() const noexcept
+    {
+        if(impl_)
+            return impl_->cs_ +
+                impl_->offset(id_frag);
+        return data_ + size_;
+    }
+
+    std::size_t
+    nparam() const noexcept
+    {
+        if(impl_)
+            return impl_->nparam_;
+        return nparam_;
+    }
 
     bool
     alias_of(
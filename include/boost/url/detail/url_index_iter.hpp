@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_INDEX_ITER_HPP
+#define BOOST_URL_DETAIL_URL_INDEX_ITER_HPP
+
+#include <boost/url/param.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The words of a url_index entry are the
+// offset, size and decoded size of a
+// segment, or of the key and the value
+// of a param followed by has_value.
+template<class T>
+struct url_index_entry;
+
+template<>
+struct url_index_entry<pct_string_view>
+{
+    static constexpr std::size_t words = 3;
+
+    static
+    pct_string_view
+    get(
+        char const* data,
+        std::size_t const* e) noexcept
+    {
+        return make_pct_string_view_unsafe(
+            data + e[0], e[1], e[2]);
+    }
+};
+
+template<>
+struct url_index_entry<param_pct_view>
+{
+    static constexpr std::size_t words = 7;
+
+    static
+    param_pct_view
+    get(
+        char const* data,
+        std::size_t const* e) noexcept
+    {
+        return {
+            make_pct_string_view_unsafe(
+                data + e[0], e[1], e[2]),
+            make_pct_string_view_unsafe(
+                data + e[3], e[4], e[5]),
+            e[6] != 0 };
+    }
+};
+
+// A random access iterator to
+// the entries of a url_index
+template<class T>
+class url_index_iter
+{
+    using entry = url_index_entry<T>;
+
+    char const* data_ = nullptr;
+    std::size_t const* e_ = nullptr;
+
+public:
+    using value_type = T;
+    using reference = T;
+    using pointer = reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    url_index_iter() = default;
+
+    url_index_iter(
+        char const* data,
+        std::size_t const* e) noexcept
+        : data_(data)
+        , e_(e)
+    {
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return entry::get(data_, e_);
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        return **this;
+    }
+
+    reference
+    operator[](
+        difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    url_index_iter&
+    operator++() noexcept
+    {
+        e_ += entry::words;
+        return *this;
+    }
+
+    url_index_iter
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    url_index_iter&
+    operator--() noexcept
+    {
+        e_ -= entry::words;
+        return *this;
+    }
+
+    url_index_iter
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    url_index_iter&
+    operator+=(
+        difference_type n) noexcept
+    {
+        e_ += n * static_cast<
+            difference_type>(entry::words);
+        return *this;
+    }
+
+    url_index_iter&
+    operator-=(
+        difference_type n) noexcept
+    {
+        e_ -= n * static_cast<
+            difference_type>(entry::words);
+        return *this;
+    }
+
+    friend
+    url_index_iter
+    operator+(
+        url_index_iter it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    url_index_iter
+    operator+(
+        difference_type n,
+        url_index_iter it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    url_index_iter
+    operator-(
+        url_index_iter it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return (it0.e_ - it1.e_) /
+            static_cast<difference_type>(
+                entry::words);
+    }
+
+    friend
+    bool
+    operator==(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ == it1.e_;
+    }
+
+    friend
+    bool
+    operator!=(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ != it1.e_;
+    }
+
+    friend
+    bool
+    operator<(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ < it1.e_;
+    }
+
+    friend
+    bool
+    operator>(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ > it1.e_;
+    }
+
+    friend
+    bool
+    operator<=(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ <= it1.e_;
+    }
+
+    friend
+    bool
+    operator>=(
+        url_index_iter const& it0,
+        url_index_iter const& it1) noexcept
+    {
+        return it0.e_ >= it1.e_;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_TABLE_HPP
+#define BOOST_URL_DETAIL_URL_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The open addressing table shared by
+// url_set and url_map. The strings of
+// the urls are appended to one arena,
+// and each slot keeps the fingerprint
+// of a url next to its index, so urls
+// are only parsed and compared when
+// their fingerprints are equal.
+//
+// Entries are kept in insertion order:
+// entry i is the substring of the arena
+// which ends at ends_[i].
+class BOOST_URL_DECL url_table
+{
+    struct slot
+    {
+        std::uint64_t fp;
+
+        // 0 if the slot is empty
+        std::size_t index;
+    };
+
+    std::vector<slot> slots_;
+    std::vector<std::size_t> ends_;
+    std::string arena_;
+
+    void rehash(std::size_t n);
+
+public:
+    static constexpr std::size_t npos =
+        std::size_t(-1);
+
+    url_table() noexcept = default;
+
+    std::size_t
+    size() const noexcept
+    {
+        return ends_.size();
+    }
+
+    std::size_t
+    arena_size() const noexcept
+    {
+        return arena_.size();
+    }
+
+    // the url of entry i
+    url_view
+    get(std::size_t i) const noexcept;
+
+    // the index of the entry equal to u,
+    // or npos if there is none
+    std::size_t
+    find(
+        url_view_base const& u,
+        std::uint64_t fp) const noexcept;
+
+    // make room for n entries with
+    // m characters in total
+    void
+    reserve(
+        std::size_t n,
+        std::size_t m);
+
+    // append an entry which is not in the
+    // table. Room for one more entry with
+    // u.size() characters must be reserved.
+    std::size_t
+    insert(
+        url_view_base const& u,
+        std::uint64_t fp) noexcept;
+
+    void
+    clear() noexcept;
+
+    void
+    swap(url_table& other) noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_EDIT_SESSION_HPP
+#define BOOST_URL_EDIT_SESSION_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/url_base.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A session of repeated edits to the path or the query of a URL
+
+    Each change to the path of a URL moves
+    its query and fragment, and each change
+    to the query moves the fragment. A loop
+    which appends many segments or params
+    to a URL with a long query or fragment
+    moves these characters once per
+    iteration.
+
+    While a session is open, the components
+    which follow the edited one are held
+    aside, so the edited component is at
+    the end of the URL and changes to it
+    move nothing after it. When the session
+    is closed, these components are put
+    back at the end of the URL at once.
+
+    While the session is open, the URL
+    does not contain the components held
+    aside, and only the edited component
+    may be modified.
+
+    @par Example
+    @code
+    url u( "https://www.example.com/api?key=0123456789abcdef#section" );
+    {
+        edit_session s( u, edit_session::path );
+        for( auto const& seg : { "v2", "items", "42" } )
+            u.segments().push_back( seg );
+    }
+    assert( u.buffer() == "https://www.example.com/api/v2/items/42?key=0123456789abcdef#section" );
+    @endcode
+
+    @see
+        @ref segments_ref,
+        @ref params_ref,
+        @ref url_base.
+*/
+class BOOST_URL_DECL edit_session
+    : private detail::parts_base
+{
+    url_base* u_ = nullptr;
+    int first_ = id_end;
+    std::string tail_;
+    std::size_t len_[id_end] = {};
+    std::size_t decoded_[id_end] = {};
+    std::size_t nparam_ = 0;
+
+public:
+    /** The component edited by a session
+    */
+    enum part
+    {
+        /// The path, the query and fragment are held aside
+        path,
+
+        /// The query, the fragment is held aside
+        query
+    };
+
+    /** Constructor
+
+        The components of `u` which follow
+        `p` are held aside until the
+        session is closed.
+
+        @par Complexity
+        Linear in the size of the components
+        which follow `p`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The URL to edit. Ownership
+        is not transferred; the caller is
+        responsible for ensuring that the
+        lifetime of the URL extends until
+        the session is closed.
+
+        @param p The component to edit.
+    */
+    edit_session(
+        url_base& u,
+        part p);
+
+    edit_session(
+        edit_session const&) = delete;
+
+    edit_session&
+    operator=(
+        edit_session const&) = delete;
+
+    /** Destructor
+
+        The session is closed if it
+        is still open.
+
+        @par Exception Safety
+        Calls to allocate may throw, in which
+        case `std::terminate` is called. Call
+        @ref close to handle the error.
+    */
+    ~edit_session();
+
+    /** Return true if the session is open
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    is_open() const noexcept
+    {
+        return u_ != nullptr;
+    }
+
+    /** Close the session
+
+        The components held aside are put
+        back at the end of the URL. If the
+        session is not open, this function
+        has no effect.
+
+        @par Complexity
+        Linear in the size of the components
+        held aside.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw length_error
+        The result does not fit in the
+        capacity of a @ref static_url.
+    */
+    void
+    close();
+};
+
+} // urls
+} // boost
+
+#endif
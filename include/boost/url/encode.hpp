@@ -65,6 +65,47 @@ encoded_size(
     CharSet const& unreserved,
     encoding_opts opt = {}) noexcept;
 
+/** Return the buffer size needed for percent-encoding
+
+    This overload takes the options as a
+    @ref static_encoding_opts, so that the
+    tests of the options are resolved at
+    compile time. The result is the same
+    as with the equivalent @ref encoding_opts.
+
+    @par Example
+    @code
+    assert( encoded_size( "My Stuff", pchars, static_encoding_opts< true >{} ) == 8 );
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of bytes needed,
+    excluding any null terminator.
+
+    @param s The string to measure.
+
+    @param unreserved The set of characters
+    that is not percent-encoded.
+
+    @param opt The options for encoding.
+
+    @see
+        @ref encode,
+        @ref static_encoding_opts.
+*/
+template<
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+std::size_t
+encoded_size(
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt) noexcept;
+
 //------------------------------------------------
 
 /** Apply percent-encoding to a string
@@ -123,6 +164,60 @@ encode(
     CharSet const& unreserved,
     encoding_opts opt = {});
 
+/** Apply percent-encoding to a string
+
+    This overload takes the options as a
+    @ref static_encoding_opts, so that the
+    tests of the options in the inner loop
+    are resolved at compile time. The result
+    is the same as with the equivalent
+    @ref encoding_opts.
+
+    @par Example
+    @code
+    char buf[100];
+    assert( encode( buf, sizeof(buf), "Program Files", pchars,
+        static_encoding_opts< false, true >{} ) == 15 );
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of characters written
+    to the destination buffer.
+
+    @param dest The destination buffer
+    to write to.
+
+    @param size The number of writable
+    characters pointed to by `dest`.
+    If this is less than `encoded_size(s)`,
+    the result is truncated.
+
+    @param s The string to encode.
+
+    @param unreserved The set of characters
+    that is not percent-encoded.
+
+    @param opt The options for encoding.
+
+    @see
+        @ref encoded_size,
+        @ref static_encoding_opts.
+*/
+template<
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+std::size_t
+encode(
+    char* dest,
+    std::size_t size,
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt);
+
 #ifndef BOOST_URL_DOCS
 // VFALCO semi-private for now
 template<class CharSet>
@@ -188,6 +283,54 @@ encode(
     encoding_opts opt = {},
     BOOST_URL_STRTOK_ARG(token)) noexcept;
 
+/** Return a percent-encoded string
+
+    This overload takes the options as a
+    @ref static_encoding_opts, so that the
+    tests of the options in the inner loop
+    are resolved at compile time. The result
+    is the same as with the equivalent
+    @ref encoding_opts.
+
+    @par Example
+    @code
+    std::string s = encode( "My Stuff", pchars,
+        static_encoding_opts< true >{} );
+
+    assert( s == "My+Stuff" );
+    @endcode
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @return The string
+
+    @param s The string to encode.
+
+    @param unreserved The set of characters
+    that is not percent-encoded.
+
+    @param opt The options for encoding.
+
+    @param token A string token.
+
+    @see
+        @ref encoded_size,
+        @ref static_encoding_opts.
+*/
+template<
+    BOOST_URL_STRTOK_TPARAM,
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+BOOST_URL_STRTOK_RETURN
+encode(
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt,
+    BOOST_URL_STRTOK_ARG(token)) noexcept;
+
 } // urls
 } // boost
 
@@ -75,6 +75,75 @@ struct BOOST_URL_DECL encoding_opts
 #endif
 };
 
+//------------------------------------------------
+
+/** Percent-encoding options known at compile time
+
+    This type holds the same options as
+    @ref encoding_opts, as template arguments
+    instead of data members. When it is passed
+    to @ref encode or @ref encoded_size, a copy
+    of the algorithm is instantiated for these
+    options, and the tests of the options in
+    the inner loop are resolved by the
+    compiler. The results are the same as
+    with the corresponding @ref encoding_opts.
+
+    Objects of this type convert to
+    @ref encoding_opts, so they can be passed
+    to every other function taking options.
+
+    @par Example
+    @code
+    std::string s = encode( "a b", unreserved_chars,
+        static_encoding_opts< true >{} );
+    assert( s == "a+b" );
+    @endcode
+
+    @tparam SpaceAsPlus The value of
+    @ref encoding_opts::space_as_plus.
+
+    @tparam LowerCase The value of
+    @ref encoding_opts::lower_case.
+
+    @see
+        @ref encode,
+        @ref encoded_size,
+        @ref encoding_opts.
+*/
+template<
+    bool SpaceAsPlus = false,
+    bool LowerCase = false>
+struct static_encoding_opts
+{
+    /** True if spaces encode to plus signs
+    */
+    static constexpr bool space_as_plus = SpaceAsPlus;
+
+    /** True if hexadecimal digits are emitted as lower case
+    */
+    static constexpr bool lower_case = LowerCase;
+
+    /** Return the options as @ref encoding_opts
+    */
+    operator
+    encoding_opts() const noexcept
+    {
+        return encoding_opts(
+            SpaceAsPlus, LowerCase);
+    }
+};
+
+#ifndef BOOST_URL_DOCS
+template<bool SpaceAsPlus, bool LowerCase>
+constexpr bool static_encoding_opts<
+    SpaceAsPlus, LowerCase>::space_as_plus;
+
+template<bool SpaceAsPlus, bool LowerCase>
+constexpr bool static_encoding_opts<
+    SpaceAsPlus, LowerCase>::lower_case;
+#endif
+
 } // urls
 } // boost
 
@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ENDPOINT_KEY_HPP
+#define BOOST_URL_ENDPOINT_KEY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+/** The scheme, host and port a URL connects to
+
+    Objects of this type are made from a URL
+    with @ref make_endpoint_key. The host
+    references the character buffer of the
+    URL, and its case-insensitive hash is
+    computed once, so keys are hashed in
+    constant time, and compared in constant
+    time unless their hashes are equal.
+    The port is the effective port of the
+    URL.
+
+    Keys can also be interned in an
+    @ref endpoint_table, which gives every
+    distinct host an integer, so that
+    interned keys are compared as integers
+    and do not reference the URL.
+
+    @par Example
+    @code
+    endpoint_key k0 = make_endpoint_key( url_view( "https://API.example.com/v1/a" ) );
+    endpoint_key k1 = make_endpoint_key( url_view( "https://api.example.com:443/v2/b" ) );
+    assert( k0 == k1 );
+    @endcode
+
+    @see
+        @ref endpoint_table,
+        @ref make_endpoint_key,
+        @ref url_view_base::effective_port.
+*/
+struct endpoint_key
+{
+    /** The host, as written in the URL
+    */
+    core::string_view host;
+
+    /** A case-insensitive hash of the host
+    */
+    std::size_t host_hash;
+
+    /** The effective port
+    */
+    std::uint16_t port;
+
+    /** The scheme
+    */
+    urls::scheme scheme;
+
+    /** Return a hash of the key
+    */
+    std::size_t
+    digest() const noexcept
+    {
+        std::size_t const k =
+            (static_cast<std::size_t>(
+                scheme) << 16) | port;
+        return host_hash ^ (k * 0x9e3779b9u);
+    }
+
+    /** Return true if two keys are equal
+    */
+    friend
+    bool
+    operator==(
+        endpoint_key const& a,
+        endpoint_key const& b) noexcept
+    {
+        return
+            a.host_hash == b.host_hash &&
+            a.port == b.port &&
+            a.scheme == b.scheme &&
+            grammar::ci_is_equal(a.host, b.host);
+    }
+
+    /** Return true if two keys are not equal
+    */
+    friend
+    bool
+    operator!=(
+        endpoint_key const& a,
+        endpoint_key const& b) noexcept
+    {
+        return !(a == b);
+    }
+};
+
+/** Return the endpoint key of a URL
+
+    @par Complexity
+    Linear in `u.encoded_host().size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL
+*/
+BOOST_URL_DECL
+endpoint_key
+make_endpoint_key(
+    url_view_base const& u) noexcept;
+
+/** A table of interned endpoint hosts
+
+    Each distinct host, compared without
+    regard to case, is given a nonzero
+    integer the first time it is interned,
+    and the table keeps a lowercase copy of
+    it. An interned key packs this integer,
+    the scheme and the port into one 64-bit
+    integer, so that keys of the same
+    endpoint are equal integers.
+
+    @par Example
+    @code
+    endpoint_table table;
+    std::uint64_t id = table.intern( make_endpoint_key( u ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+
+    @see
+        @ref endpoint_key.
+*/
+class endpoint_table
+{
+    struct impl;
+
+    impl* impl_;
+
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    endpoint_table();
+
+    /** Destructor
+    */
+    BOOST_URL_DECL
+    ~endpoint_table();
+
+    endpoint_table(endpoint_table const&) = delete;
+    endpoint_table& operator=(endpoint_table const&) = delete;
+
+    /** Return the integer of a host, interning it if needed
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param host The host
+        @param host_hash The case-insensitive
+        hash of the host, as computed by
+        `grammar::ci_digest`.
+    */
+    BOOST_URL_DECL
+    std::uint32_t
+    host_id(
+        core::string_view host,
+        std::size_t host_hash);
+
+    /** Return the interned key of an endpoint
+
+        The result is `(id << 32) | (scheme << 16) | port`,
+        where `id` is the integer of the host.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param k The key to intern
+    */
+    std::uint64_t
+    intern(endpoint_key const& k)
+    {
+        return
+            (static_cast<std::uint64_t>(
+                host_id(k.host, k.host_hash)) << 32) |
+            (static_cast<std::uint64_t>(
+                k.scheme) << 16) |
+            k.port;
+    }
+
+    /** Return the lowercase host of an interned integer
+
+        The string remains valid until the
+        table is destroyed.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id An integer returned by
+        @ref host_id. Zero and integers not
+        returned by the table yield an empty
+        string.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    host(std::uint32_t id) const noexcept;
+
+    /** Return the number of interned hosts
+    */
+    BOOST_URL_DECL
+    std::size_t
+    size() const noexcept;
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<>
+struct hash< ::boost::urls::endpoint_key >
+{
+    std::size_t
+    operator()(
+        ::boost::urls::endpoint_key const& k) const noexcept
+    {
+        return k.digest();
+    }
+};
+} // std
+#endif
+
+#endif
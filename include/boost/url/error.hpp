@@ -79,7 +79,37 @@ enum class error
     /**
      * The URL is not a base URL
     */
-    not_a_base
+    not_a_base,
+
+    /**
+     * The scheme is not allowed by a policy
+    */
+    scheme_not_allowed,
+
+    /**
+     * The URL is larger than a limit
+    */
+    too_long,
+
+    /**
+     * The path has more segments than a limit
+    */
+    too_many_segments,
+
+    /**
+     * The query has more params than a limit
+    */
+    too_many_params,
+
+    /**
+     * The host is larger than a limit
+    */
+    host_too_long,
+
+    /**
+     * The string has bytes which are not valid UTF-8
+    */
+    bad_utf8
 };
 
 } // urls
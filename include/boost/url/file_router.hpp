@@ -0,0 +1,307 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_FILE_ROUTER_HPP
+#define BOOST_URL_FILE_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/file_router.hpp>
+#include <boost/url/url_fingerprint.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A router mapping URL prefixes to directories
+
+    This container maps path prefixes, such as
+    `/static`, to root directories, and resolves
+    the path of a URL to a file in the root of
+    its longest matching prefix. The prefixes are
+    stored in a trie of segments, so the cost of
+    a lookup does not depend on the number of
+    routes.
+
+    The path of the URL is decoded and its dot
+    segments are removed before it is matched,
+    so a request can never name a file outside
+    the root of its route. Paths with segments
+    which decode to a slash, a backslash, or
+    to a null character are rejected.
+
+    The resolved file names are written to
+    strings owned by the caller or by the
+    router, which keep their capacity from one
+    request to the next, so the allocations
+    stop once the buffers have grown.
+
+    The router can also cache the resolved
+    names, with a value of type `Info` which
+    the caller fills, such as the size and the
+    modification time of the file. The cache
+    has a fixed number of entries, and is
+    keyed by a 128-bit digest of the decoded
+    and normalized path.
+
+    @par Example
+    @code
+    struct file_info
+    {
+        std::uint64_t size = 0;
+        bool exists = false;
+    };
+
+    file_router< file_info > r( 4096 );
+    r.insert( "/static", "/var/www/static" );
+    r.insert( "/", "/var/www/html" );
+
+    auto* e = r.lookup( url_view( "/static/css/../app.js?v=2" ) );
+    assert( e->path == "/var/www/static/app.js" );
+    if( ! e->has_info )
+    {
+        e->info = stat_file( e->path );
+        e->has_info = true;
+    }
+    @endcode
+
+    @tparam Info The type of the values
+    stored with the cached names. It must
+    be default constructible and copy
+    assignable.
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref router.
+*/
+template<class Info>
+class file_router
+    : private detail::file_router_base
+{
+public:
+    /// The value returned when no route matches
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    /** A resolved file name
+    */
+    struct entry
+    {
+        /// The route of the name
+        std::size_t route = npos;
+
+        /// The file name
+        std::string path;
+
+        /// The value stored by the caller
+        Info info;
+
+        /// True if the caller stored a value
+        bool has_info = false;
+    };
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param cache_size The number of names
+        to cache, or zero to cache none.
+    */
+    explicit
+    file_router(
+        std::size_t cache_size = 0)
+        : cache_(cache_size)
+        , slots_(cache_size == 0
+            ? 1 : cache_size)
+    {
+    }
+
+    /** Map a prefix to a directory
+
+        The prefix is a path whose segments
+        must match the first segments of the
+        requests, after they are decoded and
+        normalized. A trailing slash in the
+        prefix is ignored, and the prefix `/`
+        matches all requests. If the prefix is
+        already mapped, its directory is
+        replaced. The cache is cleared.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return The route of the prefix.
+
+        @throw system_error
+        `prefix` is not a valid path,
+        `root` is empty, or a segment of
+        `prefix` decodes to a separator.
+
+        @param prefix The path prefix.
+
+        @param root The directory.
+    */
+    std::size_t
+    insert(
+        core::string_view prefix,
+        core::string_view root)
+    {
+        auto const r =
+            insert_impl(prefix, root);
+        clear_cache();
+        return r;
+    }
+
+    /** Return the number of routes
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return roots_.size();
+    }
+
+    /** Resolve the path of a URL to a file name
+
+        The file name is written to `path`,
+        which keeps its capacity. The cache is
+        not used.
+
+        @par Complexity
+        Linear in the size of the path.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return The route of the path, or
+        @ref npos if no route matches or
+        the path is rejected, in which case
+        `path` is empty.
+
+        @param u The URL.
+
+        @param path The string to write
+        the file name to.
+    */
+    std::size_t
+    resolve(
+        url_view_base const& u,
+        std::string& path) const
+    {
+        return resolve_impl(
+            u.encoded_segments(), path);
+    }
+
+    /** Resolve the path of a URL, using the cache
+
+        When the decoded and normalized path
+        is in the cache, its entry is returned
+        as it was left by the caller. Otherwise
+        the name is resolved and replaces the
+        entry in its slot, with `has_info` set
+        to false. The returned entry is valid
+        until the next call to a function
+        which is not `const`.
+
+        @par Complexity
+        Linear in the size of the path.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return A pointer to the entry, or
+        `nullptr` if no route matches or the
+        path is rejected.
+
+        @param u The URL.
+    */
+    entry*
+    lookup(url_view_base const& u)
+    {
+        if(! normalize(
+                u.encoded_segments(), buf_))
+            return nullptr;
+        auto const key = digest(buf_);
+        slot& s = slots_[cache_ == 0
+            ? 0 : key.low % cache_];
+        if( s.used &&
+            s.key == key)
+        {
+            if(s.e.route == npos)
+                return nullptr;
+            return &s.e;
+        }
+        s.used = false;
+        std::size_t rest = 0;
+        auto const r = match(buf_, rest);
+        if(r != npos)
+        {
+            s.e.path.assign(buf_);
+            join(r, rest, s.e.path);
+            s.e.info = Info();
+        }
+        s.e.route = r;
+        s.e.has_info = false;
+        s.key = key;
+        s.used = cache_ != 0;
+        if(r == npos)
+            return nullptr;
+        return &s.e;
+    }
+
+    /** Remove all cached names
+
+        The capacity of the
+        entries is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear_cache() noexcept
+    {
+        for(auto& s : slots_)
+            s.used = false;
+    }
+
+private:
+    struct slot
+    {
+        url_fingerprint key;
+        bool used = false;
+        entry e;
+    };
+
+    std::size_t cache_;
+    std::vector<slot> slots_;
+    std::string buf_;
+};
+
+template<class Info>
+constexpr std::size_t file_router<Info>::npos;
+
+} // urls
+} // boost
+
+#endif
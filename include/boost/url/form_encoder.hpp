@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_FORM_ENCODER_HPP
+#define BOOST_URL_FORM_ENCODER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/param.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** An incremental encoder for form bodies
+
+    This encoder writes params as a body of
+    type `application/x-www-form-urlencoded`
+    into output buffers provided by the
+    caller, such as the buffer of a socket,
+    a piece at a time. Each call to
+    @ref write fills as much of the buffer
+    as it can and returns, so the caller
+    controls when more output is produced,
+    and the body is never assembled in an
+    intermediate buffer.
+
+    Characters other than the unreserved
+    characters are percent-encoded, as by
+    @ref encode with @ref unreserved_chars,
+    and the params are separated with
+    `"&"`. An escape which does not fit in
+    a buffer is continued in the next one.
+
+    @par Example
+    @code
+    std::vector< param_view > v = { { "name", "John Doe" }, { "msg", "a&b" } };
+    form_encoder e;
+    char buf[16];
+    for( auto const& qp : v )
+    {
+        e.put( qp );
+        while( ! e.done() )
+            std::cout.write( buf, e.write( buf, sizeof(buf) ) );
+    }
+    // name=John+Doe&msg=a%26b
+    @endcode
+
+    @see
+        @ref encode,
+        @ref form_parser.
+*/
+class form_encoder
+{
+    core::string_view key_;
+    core::string_view value_;
+    encoding_opts opt_;
+    // separators, or an escape which
+    // did not fit in the last buffer
+    char pend_[3] = {};
+    unsigned char pn_ = 0;
+    unsigned char pi_ = 0;
+    // 0 idle, 1 key, 2 value
+    unsigned char part_ = 0;
+    bool has_value_ = false;
+    bool first_ = true;
+
+    bool
+    flush(
+        char*& dest,
+        char const* end) noexcept;
+
+    bool
+    encode_some(
+        char*& dest,
+        char const* end,
+        core::string_view& s) noexcept;
+
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param opt The options for encoding.
+        By default, spaces are encoded as
+        plus signs, as in forms.
+    */
+    explicit
+    form_encoder(
+        encoding_opts opt =
+            encoding_opts(true)) noexcept
+        : opt_(opt)
+    {
+    }
+
+    /** Return true if the last param was written
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    done() const noexcept
+    {
+        return part_ == 0 && pi_ == pn_;
+    }
+
+    /** Start writing a param
+
+        The key and value are referenced, not
+        copied, and must remain valid until
+        @ref done returns `true`.
+
+        @par Preconditions
+        @code
+        this->done()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param qp The param to write
+    */
+    BOOST_URL_DECL
+    void
+    put(param_view const& qp) noexcept;
+
+    /** Write the encoded param to a buffer
+
+        This function writes as many
+        characters of the current param as
+        fit in the buffer.
+
+        @par Complexity
+        Linear in the return value.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of characters
+        written, which is `size` unless
+        @ref done returns `true`.
+
+        @param dest The buffer to write to
+
+        @param size The size of the buffer
+    */
+    BOOST_URL_DECL
+    std::size_t
+    write(
+        char* dest,
+        std::size_t size) noexcept;
+
+    /** Prepare the encoder for a new body
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    reset() noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
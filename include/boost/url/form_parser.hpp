@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_FORM_PARSER_HPP
+#define BOOST_URL_FORM_PARSER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/param.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** An incremental parser for form bodies
+
+    This parser decodes a body of type
+    `application/x-www-form-urlencoded`,
+    such as the body of an HTTP POST
+    request, which arrives in consecutive
+    chunks. Each param is passed to a
+    handler as soon as it is complete,
+    with its key and value decoded.
+    Escapes and plus signs are decoded
+    even when they straddle chunks.
+
+    The params are split as by
+    @ref parse_query: a body of `"a&b="`
+    has a param `"a"` without a value
+    and a param `"b"` with an empty value,
+    and an empty body has no params.
+
+    @par Storage
+    Only the param being decoded is kept,
+    in storage the parser owns, which is
+    reused for the next param and after
+    @ref reset. A param larger than the
+    limit given upon construction is an
+    error, so the memory used is bounded
+    whatever the size of the body.
+
+    @par Example
+    @code
+    form_parser p;
+    std::vector< param > v;
+    auto h = [&v]( param_view const& qp ) { v.emplace_back( qp ); };
+    p.write( "name=John+D", h );
+    p.write( "oe&msg=a%2", h );
+    p.write( "6b", h );
+    p.finish( h );
+    assert( v[0].key == "name" && v[0].value == "John Doe" );
+    assert( v[1].key == "msg" && v[1].value == "a&b" );
+    @endcode
+
+    @see
+        @ref decode_params_in_place,
+        @ref parse_query.
+*/
+class form_parser
+{
+    std::string buf_;
+    system::error_code ec_;
+    std::size_t max_size_;
+    std::size_t key_size_ = 0;
+    encoding_opts opt_;
+    // hex digits still expected
+    unsigned char pct_ = 0;
+    unsigned char hex_ = 0;
+    bool has_value_ = false;
+    bool ready_ = false;
+    bool any_ = false;
+    bool clear_ = false;
+
+    BOOST_URL_DECL
+    system::result<std::size_t>
+    feed(
+        char const* first,
+        char const* last);
+
+    BOOST_URL_DECL
+    param_view
+    take() noexcept;
+
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param opt The options for decoding.
+        By default, plus signs are decoded
+        as spaces, as in forms.
+
+        @param max_size The largest decoded
+        size of a key and value, together.
+    */
+    explicit
+    form_parser(
+        encoding_opts opt = encoding_opts(true),
+        std::size_t max_size = 65536) noexcept
+        : max_size_(max_size)
+        , opt_(opt)
+    {
+    }
+
+    /** Constructor (deleted)
+    */
+    form_parser(
+        form_parser const&) = delete;
+
+    /** Assignment (deleted)
+    */
+    form_parser& operator=(
+        form_parser const&) = delete;
+
+    /** Parse the next chunk of the body
+
+        The handler is called with a
+        @ref param_view for each param
+        completed by this chunk. The
+        param refers to storage owned
+        by the parser, which is only
+        valid during the call.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown by the handler
+        are propagated.
+
+        @return The number of characters
+        consumed, which is `s.size()`, or an
+        error if an invalid percent-escape
+        was found or a param is too large.
+        Once an error occurs, the same
+        error is returned until @ref reset
+        is called.
+
+        @param s The next characters
+
+        @param h The handler, invocable as
+        `h( param_view const& )`
+    */
+    template<class Handler>
+    system::result<std::size_t>
+    write(
+        core::string_view s,
+        Handler&& h)
+    {
+        auto it = s.data();
+        auto const end = it + s.size();
+        while(it != end)
+        {
+            auto rv = feed(it, end);
+            if(! rv)
+                return rv.error();
+            it += *rv;
+            if(ready_)
+                h(take());
+        }
+        return s.size();
+    }
+
+    /** Finish parsing the body
+
+        The handler is called with the
+        last param, if the body is not
+        empty. The parser must then be
+        reset before another body is
+        parsed.
+
+        @par Exception Safety
+        Exceptions thrown by the handler
+        are propagated.
+
+        @return An error if the body ends
+        inside a percent-escape, or if an
+        error occurred earlier.
+
+        @param h The handler, invocable as
+        `h( param_view const& )`
+    */
+    template<class Handler>
+    system::result<void>
+    finish(Handler&& h)
+    {
+        if(ec_.failed())
+            return ec_;
+        if(pct_ != 0)
+        {
+            // expected HEXDIG
+            ec_ = BOOST_URL_ERR(
+                error::incomplete_encoding);
+            return ec_;
+        }
+        if(any_)
+        {
+            // the body ends with '&'
+            if(clear_)
+            {
+                buf_.clear();
+                clear_ = false;
+            }
+            any_ = false;
+            h(take());
+        }
+        return {};
+    }
+
+    /** Prepare the parser for a new body
+
+        The storage used for params is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    reset() noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
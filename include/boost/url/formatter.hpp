@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_FORMATTER_HPP
+#define BOOST_URL_FORMATTER_HPP
+
+/*
+    Formatters of URLs for `std::format` and `fmt`
+
+    This header specializes `std::formatter`,
+    when the standard library has `<format>`,
+    and `fmt::formatter`, when `<fmt/format.h>`
+    is included before this header, for
+    url_view, url, static_url,
+    authority_view, decode_view
+    and pct_string_view.
+
+    The characters are written directly to
+    the output of the formatter, in runs,
+    without building a temporary string.
+
+    URLs accept a format spec which selects
+    the part which is written, and whether
+    it is percent-decoded:
+
+    - `{}` writes the encoded URL
+    - `{:decoded}` writes the decoded URL
+    - `{:host}`, `{:path}`, ... write the
+    encoded part: one of `scheme`, `authority`,
+    `userinfo`, `user`, `password`, `host`,
+    `port`, `path`, `query`, `fragment`,
+    `origin`, `resource` and `target`
+    - `{:host:decoded}`, ... write the
+    decoded part
+
+    Authorities accept the specs of the
+    parts of an authority. Percent-encoded
+    strings accept `{}` and `{:decoded}`.
+
+    Example:
+
+    url_view u( "https://www.example.com/a%20b?q=1" );
+    assert( std::format( "{}", u ) == "https://www.example.com/a%20b?q=1" );
+    assert( std::format( "{:host}", u ) == "www.example.com" );
+    assert( std::format( "{:path:decoded}", u ) == "/a b" );
+*/
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/url_formatter.hpp>
+
+#if defined(__has_include)
+# if __has_include(<version>)
+#  include <version>
+# endif
+#endif
+
+#if defined(__cpp_lib_format)
+# include <format>
+#endif
+
+#ifndef BOOST_URL_DOCS
+
+#define BOOST_URL_FORMATTERS(ns, error)                 \
+namespace ns {                                          \
+template<>                                              \
+struct formatter<boost::urls::url_view_base>            \
+    : boost::urls::detail::url_formatter<               \
+        boost::urls::url_view_base, error> {};          \
+template<>                                              \
+struct formatter<boost::urls::url_view>                 \
+    : boost::urls::detail::url_formatter<               \
+        boost::urls::url_view, error> {};               \
+template<>                                              \
+struct formatter<boost::urls::url>                      \
+    : boost::urls::detail::url_formatter<               \
+        boost::urls::url, error> {};                    \
+template<std::size_t Capacity>                          \
+struct formatter<boost::urls::static_url<Capacity>>     \
+    : boost::urls::detail::url_formatter<               \
+        boost::urls::static_url<Capacity>, error> {};   \
+template<>                                              \
+struct formatter<boost::urls::authority_view>           \
+    : boost::urls::detail::url_formatter<               \
+        boost::urls::authority_view, error> {};         \
+template<>                                              \
+struct formatter<boost::urls::decode_view>              \
+    : boost::urls::detail::pct_formatter<               \
+        boost::urls::decode_view, error> {};            \
+template<>                                              \
+struct formatter<boost::urls::pct_string_view>          \
+    : boost::urls::detail::pct_formatter<               \
+        boost::urls::pct_string_view, error> {};        \
+}
+
+#if defined(__cpp_lib_format)
+BOOST_URL_FORMATTERS(std, std::format_error)
+#endif
+
+#if defined(FMT_VERSION)
+BOOST_URL_FORMATTERS(fmt, fmt::format_error)
+#endif
+
+#undef BOOST_URL_FORMATTERS
+
+#endif
+
+#endif
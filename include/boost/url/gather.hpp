@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GATHER_HPP
+#define BOOST_URL_GATHER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_batch.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Return a component of each URL in an array
+
+    Each element `out[i]` is set to the
+    component `p` of `urls[i]`, without its
+    delimiters and still percent-encoded,
+    as returned by @ref url_batch::get. A
+    component which is not present is empty.
+
+    The URL objects hold the positions of
+    their components, so the views are
+    formed without reading the characters
+    of the URLs, which are usually in other
+    blocks of memory. As the views are
+    formed, the characters of the elements
+    a few positions ahead are requested,
+    so that when `out` is read soon after,
+    as when the URLs are processed in
+    blocks of a few hundred elements, the
+    cache misses are already under way or
+    resolved instead of being waited for
+    one at a time.
+
+    @par Example
+    @code
+    std::vector< url > v = ...;
+    std::unordered_map< core::string_view, std::size_t > count;
+    core::string_view hosts[ 256 ];
+    for( std::size_t i = 0; i < v.size(); i += 256 )
+    {
+        std::size_t n = (std::min)( v.size() - i, std::size_t( 256 ) );
+        gather( url_batch::host, v.data() + i, n, hosts );
+        for( std::size_t j = 0; j < n; ++j )
+            ++count[ hosts[ j ] ];
+    }
+    @endcode
+
+    @par Preconditions
+    @code
+    p != url_batch::end
+    @endcode
+
+    @par Complexity
+    Linear in `n`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param p The component.
+
+    @param urls A pointer to the first URL.
+
+    @param n The number of URLs.
+
+    @param out A pointer to the first of
+    `n` elements to assign.
+
+    @see
+        @ref url_batch.
+*/
+BOOST_URL_DECL
+void
+gather(
+    url_batch::part p,
+    url_view const* urls,
+    std::size_t n,
+    core::string_view* out) noexcept;
+
+/** @copydoc gather(url_batch::part,url_view const*,std::size_t,core::string_view*)
+*/
+BOOST_URL_DECL
+void
+gather(
+    url_batch::part p,
+    url const* urls,
+    std::size_t n,
+    core::string_view* out) noexcept;
+
+} // urls
+} // boost
+
+#endif
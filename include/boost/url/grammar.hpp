@@ -14,18 +14,21 @@
 
 #include <boost/url/grammar/alnum_chars.hpp>
 #include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/basic_range_rule.hpp>
 #include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/grammar/dec_octet_rule.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
 #include <boost/url/grammar/digit_chars.hpp>
 #include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/find_delim_rule.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/literal_rule.hpp>
 #include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/not_empty_rule.hpp>
 #include <boost/url/grammar/optional_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/profile.hpp>
 #include <boost/url/grammar/range_rule.hpp>
 #include <boost/url/grammar/recycled.hpp>
 #include <boost/url/grammar/string_token.hpp>
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_ALNUM_CHARS_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/detail/charset.hpp>
 
 namespace boost {
@@ -50,6 +51,14 @@ namespace grammar {
 #ifdef BOOST_URL_DOCS
 constexpr __implementation_defined__ alnum_chars;
 #else
+namespace detail {
+// the same set, for the SIMD kernels
+constexpr lut_chars alnum_lut(
+    "0123456789"
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+} // detail
+
 struct alnum_chars_t
 {
     constexpr
@@ -62,14 +71,15 @@ struct alnum_chars_t
             (c >= 'a' && c <= 'z');
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
     char const*
     find_if(
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_pred(
-            *this, first, last);
+        return detail::alnum_lut.find_if(
+            first, last);
     }
 
     char const*
@@ -77,8 +87,8 @@ struct alnum_chars_t
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_not_pred(
-            *this, first, last);
+        return detail::alnum_lut.find_if_not(
+            first, last);
     }
 #endif
 };
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_ALPHA_CHARS_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/detail/charset.hpp>
 
 namespace boost {
@@ -45,6 +46,13 @@ namespace grammar {
 #ifdef BOOST_URL_DOCS
 constexpr __implementation_defined__ alpha_chars;
 #else
+namespace detail {
+// the same set, for the SIMD kernels
+constexpr lut_chars alpha_lut(
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+} // detail
+
 struct alpha_chars_t
 {
     constexpr
@@ -59,14 +67,15 @@ struct alpha_chars_t
             (c >= 'a' && c <= 'z');
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
     char const*
     find_if(
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_pred(
-            *this, first, last);
+        return detail::alpha_lut.find_if(
+            first, last);
     }
 
     char const*
@@ -74,8 +83,8 @@ struct alpha_chars_t
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_not_pred(
-            *this, first, last);
+        return detail::alpha_lut.find_if_not(
+            first, last);
     }
 #endif
 };
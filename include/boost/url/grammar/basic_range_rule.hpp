@@ -0,0 +1,481 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_BASIC_RANGE_RULE_HPP
+#define BOOST_URL_GRAMMAR_BASIC_RANGE_RULE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/type_traits.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/empty_value.hpp>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+#ifndef BOOST_URL_DOCS
+template<class R0, class R1>
+struct basic_range_rule_t;
+#endif
+
+/** A forward range of parsed elements
+
+    Objects of this type are forward ranges
+    returned when parsing using the
+    @ref basic_range_rule.
+
+    Iteration is performed by re-parsing the
+    underlying character buffer. Ownership
+    of the buffer is not transferred; the
+    caller is responsible for ensuring that
+    the lifetime of the buffer extends until
+    it is no longer referenced by the range.
+
+    Unlike @ref range, the rules are part of
+    the type and are stored by value, so no
+    storage is allocated and the elements are
+    parsed without virtual calls. Use this
+    type when the range is iterated in the
+    same scope where it is parsed, and
+    @ref range when a single type is needed
+    for ranges parsed with different rules.
+
+    @tparam T The value type of the range
+
+    @tparam First The rule used to parse
+    the first element
+
+    @tparam Next The rule used to parse
+    each subsequent element
+
+    @see
+        @ref basic_range_rule,
+        @ref parse,
+        @ref range.
+*/
+template<
+    class T,
+    class First,
+    class Next = First>
+class basic_range
+#ifndef BOOST_URL_DOCS
+    : private empty_value<First, 0>
+    , private empty_value<Next, 1>
+#endif
+{
+    core::string_view s_;
+    std::size_t n_ = 0;
+
+    template<class R0, class R1>
+    friend struct basic_range_rule_t;
+
+    First const&
+    first() const noexcept
+    {
+        return empty_value<First, 0>::get();
+    }
+
+    Next const&
+    next() const noexcept
+    {
+        return empty_value<Next, 1>::get();
+    }
+
+    basic_range(
+        core::string_view s,
+        std::size_t n,
+        First const& first,
+        Next const& next) noexcept
+        : empty_value<First, 0>(
+            empty_init, first)
+        , empty_value<Next, 1>(
+            empty_init, next)
+        , s_(s)
+        , n_(n)
+    {
+    }
+
+public:
+    /** The type of each element of the range
+    */
+    using value_type = T;
+
+    /** The type of each element of the range
+    */
+    using reference = T const&;
+
+    /** The type of each element of the range
+    */
+    using const_reference = T const&;
+
+    /** Provided for compatibility, unused
+    */
+    using pointer = void const*;
+
+    /** The type used to represent unsigned integers
+    */
+    using size_type = std::size_t;
+
+    /** The type used to represent signed integers
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** A constant, forward iterator to elements of the range
+    */
+    class iterator;
+
+    /** A constant, forward iterator to elements of the range
+    */
+    using const_iterator = iterator;
+
+    /** Constructor
+
+        Default-constructed ranges have
+        zero elements. This constructor
+        is only available when the rules
+        are default constructible.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    basic_range() = default;
+
+    /** Constructor
+
+        The copy references the same
+        underlying character buffer.
+        Ownership is not transferred; the
+        caller is responsible for ensuring
+        that the lifetime of the buffer
+        extends until it is no longer
+        referenced.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    basic_range(
+        basic_range const&) = default;
+
+    /** Assignment
+
+        The copy references the same
+        underlying character buffer.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    basic_range&
+    operator=(
+        basic_range const& other) noexcept
+    {
+        // Many rules, such as token_rule,
+        // hold const members and can not
+        // be assigned, but the rules are
+        // nothrow copy constructible.
+        if(this != &other)
+        {
+            this->~basic_range();
+            ::new(this) basic_range(other);
+        }
+        return *this;
+    }
+
+    /** Return an iterator to the beginning
+    */
+    iterator begin() const noexcept;
+
+    /** Return an iterator to the end
+    */
+    iterator end() const noexcept;
+
+    /** Return true if the range is empty
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return the number of elements in the range
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return the matching part of the string
+    */
+    core::string_view
+    string() const noexcept
+    {
+        return s_;
+    }
+};
+
+//------------------------------------------------
+
+/** Match a repeating number of elements
+
+    This rule matches the same elements as
+    @ref range_rule, using the same rules and
+    limits. The value is a @ref basic_range
+    which keeps the type of the rule, so
+    iterating it parses each element with
+    a direct call which can be inlined.
+
+    @par Value Type
+    @code
+    using value_type = basic_range< typename Rule::value_type, Rule >;
+    @endcode
+
+    @par Example
+    Rules are used with the function @ref parse.
+    @code
+    // range    = 1*( ";" token )
+    auto rv = parse( ";alpha;xray;charlie",
+        basic_range_rule(
+            tuple_rule(
+                squelch( delim_rule( ';' ) ),
+                token_rule( alpha_chars ) ),
+            1 ) );
+    assert( rv->size() == 3 );
+    assert( *rv->begin() == "alpha" );
+    @endcode
+
+    @par BNF
+    @code
+    range        = <N>*<M>next
+    @endcode
+
+    @param next The rule to use for matching
+    each element. The range extends until this
+    rule returns an error.
+
+    @param N The minimum number of elements for
+    the range to be valid. If omitted, this
+    defaults to zero.
+
+    @param M The maximum number of elements for
+    the range to be valid. If omitted, this
+    defaults to unlimited.
+
+    @see
+        @ref basic_range,
+        @ref parse,
+        @ref range_rule.
+*/
+#ifdef BOOST_URL_DOCS
+template<class Rule>
+constexpr
+__implementation_defined__
+basic_range_rule(
+    Rule next,
+    std::size_t N = 0,
+    std::size_t M =
+        std::size_t(-1)) noexcept;
+#else
+template<class R0, class R1>
+struct basic_range_rule_t
+{
+    using value_type = basic_range<
+        typename R0::value_type, R0, R1>;
+
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const;
+
+private:
+    constexpr
+    basic_range_rule_t(
+        R0 const& first,
+        R1 const& next,
+        std::size_t N,
+        std::size_t M) noexcept
+        : first_(first)
+        , next_(next)
+        , N_(N)
+        , M_(M)
+    {
+    }
+
+    template<class R_>
+    friend
+    constexpr
+    basic_range_rule_t<R_, R_>
+    basic_range_rule(
+        R_ const& next,
+        std::size_t N,
+        std::size_t M) noexcept;
+
+    template<
+        class R0_, class R1_>
+    friend
+    constexpr
+    auto
+    basic_range_rule(
+        R0_ const& first,
+        R1_ const& next,
+        std::size_t N,
+        std::size_t M) noexcept ->
+            typename std::enable_if<
+                ! std::is_integral<R1_>::value,
+                basic_range_rule_t<R0_, R1_>>::type;
+
+    R0 const first_;
+    R1 const next_;
+    std::size_t N_;
+    std::size_t M_;
+};
+
+template<class Rule>
+constexpr
+basic_range_rule_t<Rule, Rule>
+basic_range_rule(
+    Rule const& next,
+    std::size_t N = 0,
+    std::size_t M =
+        std::size_t(-1)) noexcept
+{
+    // If you get a compile error here it
+    // means that your rule does not meet
+    // the type requirements. Please check
+    // the documentation.
+    static_assert(
+        is_rule<Rule>::value,
+        "Rule requirements not met");
+
+    return basic_range_rule_t<Rule, Rule>{
+        next, next, N, M};
+}
+#endif
+
+//------------------------------------------------
+
+/** Match a repeating number of elements
+
+    This rule matches the same elements as
+    the two-rule form of @ref range_rule.
+    The rule `first` is used for matching the
+    first element, while the `next` rule is
+    used to match every subsequent element.
+    The value is a @ref basic_range which
+    keeps the types of both rules.
+
+    @par Value Type
+    @code
+    using value_type = basic_range< typename Rule1::value_type, Rule1, Rule2 >;
+    @endcode
+
+    @par Example
+    Rules are used with the function @ref parse.
+    @code
+    // range    = [ token ] *( "," token )
+    auto rv = parse( "whiskey,tango,foxtrot",
+        basic_range_rule(
+            token_rule( alpha_chars ),          // first
+            tuple_rule(                      // next
+                squelch( delim_rule(',') ),
+                token_rule( alpha_chars ) ) ) );
+    assert( rv->size() == 3 );
+    @endcode
+
+    @par BNF
+    @code
+    range       = <1>*<1>first
+                / first <N-1>*<M-1>next
+    @endcode
+
+    @param first The rule to use for matching
+    the first element. If this rule returns
+    an error, the range is empty.
+
+    @param next The rule to use for matching
+    each subsequent element. The range extends
+    until this rule returns an error.
+
+    @param N The minimum number of elements for
+    the range to be valid. If omitted, this
+    defaults to zero.
+
+    @param M The maximum number of elements for
+    the range to be valid. If omitted, this
+    defaults to unlimited.
+
+    @see
+        @ref basic_range,
+        @ref parse,
+        @ref range_rule.
+*/
+#ifdef BOOST_URL_DOCS
+template<
+    class Rule1, class Rule2>
+constexpr
+__implementation_defined__
+basic_range_rule(
+    Rule1 first,
+    Rule2 next,
+    std::size_t N = 0,
+    std::size_t M =
+        std::size_t(-1)) noexcept;
+#else
+template<
+    class Rule1, class Rule2>
+constexpr
+auto
+basic_range_rule(
+    Rule1 const& first,
+    Rule2 const& next,
+    std::size_t N = 0,
+    std::size_t M =
+        std::size_t(-1)) noexcept ->
+    typename std::enable_if<
+        ! std::is_integral<Rule2>::value,
+        basic_range_rule_t<Rule1, Rule2>>::type
+{
+    // If you get a compile error here it
+    // means that your rule does not meet
+    // the type requirements. Please check
+    // the documentation.
+    static_assert(
+        is_rule<Rule1>::value,
+        "Rule requirements not met");
+    static_assert(
+        is_rule<Rule2>::value,
+        "Rule requirements not met");
+
+    // If you get a compile error here it
+    // means that your rules do not have
+    // the exact same value_type. Please
+    // check the documentation.
+    static_assert(
+        std::is_same<
+            typename Rule1::value_type,
+            typename Rule2::value_type>::value,
+        "Rule requirements not met");
+
+    return basic_range_rule_t<Rule1, Rule2>{
+        first, next, N, M};
+}
+#endif
+
+} // grammar
+} // urls
+} // boost
+
+#include <boost/url/grammar/impl/basic_range_rule.hpp>
+
+#endif
@@ -74,6 +74,13 @@ struct ch_delim_rule
         char const*& it,
         char const* end) const noexcept;
 
+    constexpr
+    detail::ch_chars
+    first_chars() const noexcept
+    {
+        return { ch_ };
+    }
+
 private:
     char ch_;
 };
@@ -156,6 +163,13 @@ struct cs_delim_rule
             it++, 1 };
     }
 
+    constexpr
+    CharSet const&
+    first_chars() const noexcept
+    {
+        return cs_;
+    }
+
 private:
     CharSet cs_;
 };
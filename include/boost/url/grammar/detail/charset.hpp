@@ -10,7 +10,9 @@
 #ifndef BOOST_URL_GRAMMAR_DETAIL_CHARSET_HPP
 #define BOOST_URL_GRAMMAR_DETAIL_CHARSET_HPP
 
+#include <boost/url/detail/config.hpp>
 #include <boost/core/bit.hpp>
+#include <cstdint>
 #include <type_traits>
 
 #ifdef BOOST_URL_USE_SSE2
@@ -59,6 +61,19 @@ struct has_find_if_not<T, void_t<
 {
 };
 
+// The set holding one character
+struct ch_chars
+{
+    char ch;
+
+    constexpr
+    bool
+    operator()(char c) const noexcept
+    {
+        return c == ch;
+    }
+};
+
 template<class Pred>
 char const*
 find_if(
@@ -177,6 +192,56 @@ find_if_not_pred(
 
 #endif
 
+#if defined(BOOST_URL_USE_AVX2) || \
+    defined(BOOST_URL_USE_NEON)
+
+// Inputs shorter than one block
+// of the kernel use the byte loop.
+#ifdef BOOST_URL_USE_AVX2
+constexpr std::size_t find_lut_wide_min = 32;
+#else
+constexpr std::size_t find_lut_wide_min = 16;
+#endif
+
+// Return the first character in [first, last)
+// whose membership in the set described by
+// the lut_chars masks and nibble tables is
+// equal to `match`. Uses AVX2 when the CPU
+// supports it, or NEON.
+BOOST_URL_DECL
+char const*
+find_lut_wide(
+    std::uint64_t const* mask,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    bool match) noexcept;
+
+#endif
+
+#ifdef BOOST_URL_USE_AVX2
+
+// Scan the characters of a pct-encoded
+// string whose unreserved characters are
+// in the set described by the lut_chars
+// masks and nibble tables, which must not
+// contain '%', 32 characters at a time.
+// Returns the end of the match, or where
+// fewer than 32 characters remain, and
+// adds the decoded size to n. Returns
+// null when an escape is invalid. Returns
+// first when the CPU lacks AVX2.
+BOOST_URL_DECL
+char const*
+scan_pct_wide(
+    std::uint64_t const* mask,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    std::size_t& n) noexcept;
+
+#endif
+
 } // detail
 } // grammar
 } // urls
@@ -104,6 +104,29 @@ to_upper(char c) noexcept
 
 //------------------------------------------------
 
+// set bit 5 of the bytes in 'A'...'Z',
+// eight at a time
+inline
+std::uint64_t
+fold8(std::uint64_t v) noexcept
+{
+    std::uint64_t const hi =
+        0x8080808080808080ULL;
+    std::uint64_t const low =
+        v & ~hi;
+    // the high bit of each byte is set
+    // if it is above 'Z', or at least 'A'
+    std::uint64_t const gt_z =
+        low + 0x2525252525252525ULL;
+    std::uint64_t const ge_a =
+        low + 0x3f3f3f3f3f3f3f3fULL;
+    std::uint64_t const upper =
+        (gt_z ^ ge_a) & ~v & hi;
+    return v | (upper >> 2);
+}
+
+//------------------------------------------------
+
 template<class S0, class S1>
 auto
 ci_is_equal(
@@ -171,6 +194,26 @@ ci_is_less(
     core::string_view s0,
     core::string_view s1) noexcept;
 
+// Return the first uppercase
+// letter in [it, last), or last
+BOOST_URL_DECL
+char const*
+find_upper(
+    char const* it,
+    char const* last) noexcept;
+
+// Lowercase the letters in [it, last),
+// and skip the two characters after
+// each '%' when escapes is true. Only
+// the characters which change are
+// written.
+BOOST_URL_DECL
+void
+to_lower_in_place(
+    char* it,
+    char* last,
+    bool escapes) noexcept;
+
 } // detail
 } // grammar
 } // urls
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_DETAIL_DIGITS_HPP
+#define BOOST_URL_GRAMMAR_DETAIL_DIGITS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+// These functions work on up to eight
+// characters held in a 64-bit word, the
+// first character in the low byte. The
+// word is assembled byte by byte, so the
+// result does not depend on the byte
+// order of the platform, and compilers
+// turn the full load into one instruction.
+
+// Load the characters in [it, end),
+// eight at most. The missing bytes
+// are zero, which is not a digit.
+inline
+std::uint64_t
+load_digits8(
+    char const* it,
+    char const* end) noexcept
+{
+    std::uint64_t w = 0;
+    if(end - it >= 8)
+    {
+        for(unsigned i = 0; i < 8; ++i)
+            w |= std::uint64_t(
+                static_cast<unsigned char>(
+                    it[i])) << (8 * i);
+        return w;
+    }
+    for(unsigned i = 0; it != end; ++i, ++it)
+        w |= std::uint64_t(
+            static_cast<unsigned char>(
+                *it)) << (8 * i);
+    return w;
+}
+
+// Return the number of leading bytes
+// of w which are decimal digits
+inline
+std::size_t
+count_digits8(std::uint64_t w) noexcept
+{
+    // A digit is 0x30 to 0x39. The high
+    // nibble must be 3, and adding 6 must
+    // not carry out of the low nibble. A
+    // carry out of a byte only reaches
+    // the bytes after a non-digit.
+    std::uint64_t const t =
+        (w & 0xF0F0F0F0F0F0F0F0ULL) |
+        (((w + 0x0606060606060606ULL) &
+            0xF0F0F0F0F0F0F0F0ULL) >> 4);
+    std::uint64_t const y =
+        t ^ 0x3333333333333333ULL;
+    // set the high bit of each nonzero
+    // byte, without carries between bytes
+    std::uint64_t const nz = (
+        ((y & 0x7F7F7F7F7F7F7F7FULL) +
+            0x7F7F7F7F7F7F7F7FULL) | y) &
+        0x8080808080808080ULL;
+    if(nz == 0)
+        return 8;
+    return static_cast<std::size_t>(
+        core::countr_zero(nz)) / 8;
+}
+
+// Return the value of the first n
+// characters of w, which are digits.
+// 0 < n <= 8
+inline
+std::uint64_t
+parse_digits8(
+    std::uint64_t w,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n > 0 && n <= 8);
+    // the digits become the high bytes,
+    // after n - 8 leading zero digits
+    w -= 0x3030303030303030ULL;
+    w <<= 8 * (8 - n);
+    // pairs, then quads, then the eight
+    w = (w * 10) + (w >> 8);
+    w = (((w & 0x000000FF000000FFULL) *
+            (100 + (1000000ULL << 32))) +
+        (((w >> 16) & 0x000000FF000000FFULL) *
+            (1 + (10000ULL << 32)))) >> 32;
+    return w;
+}
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,348 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_DETAIL_FUSED_RULE_HPP
+#define BOOST_URL_GRAMMAR_DETAIL_FUSED_RULE_HPP
+
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/find_delim_rule.hpp>
+#include <boost/url/grammar/literal_rule.hpp>
+#include <boost/url/grammar/token_rule.hpp>
+#include <boost/url/grammar/detail/tuple.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/integral.hpp>
+#include <boost/mp11/utility.hpp>
+#include <cstring>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+template<class Rule>
+struct squelch_rule_t;
+
+// Rules which tuple_rule matches inline.
+// The value of a fused rule is the string
+// it matched, or void, so that a sequence
+// can match a run of them with one scanner
+// and form their values from the positions
+// where each one ended. scan matches the
+// rule as parse would, and on failure sets
+// ev and leaves it unchanged.
+template<class Rule>
+struct fused_rule
+    : std::false_type
+{
+};
+
+template<class CharSet>
+struct fused_rule<token_rule_t<CharSet>>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        token_rule_t<CharSet> const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        if(it == end)
+        {
+            ev = error::need_more;
+            return false;
+        }
+        // vectorized for lut_chars
+        char const* it1 =
+            grammar::find_if_not(
+                it, end, r.cs_);
+        if(it1 == it)
+        {
+            ev = error::mismatch;
+            return false;
+        }
+        it = it1;
+        return true;
+    }
+};
+
+template<>
+struct fused_rule<ch_delim_rule>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        ch_delim_rule const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        if(it == end)
+        {
+            ev = error::need_more;
+            return false;
+        }
+        if(*it != r.first_chars().ch)
+        {
+            ev = error::mismatch;
+            return false;
+        }
+        ++it;
+        return true;
+    }
+};
+
+template<class CharSet>
+struct fused_rule<cs_delim_rule<CharSet>>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        cs_delim_rule<CharSet> const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        if(it == end)
+        {
+            ev = error::need_more;
+            return false;
+        }
+        if(! r.first_chars()(*it))
+        {
+            ev = error::mismatch;
+            return false;
+        }
+        ++it;
+        return true;
+    }
+};
+
+template<>
+struct fused_rule<literal_rule>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        literal_rule const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        std::size_t const n = end - it;
+        if(n >= r.n_)
+        {
+            if(std::memcmp(
+                it, r.s_, r.n_) != 0)
+            {
+                ev = error::mismatch;
+                return false;
+            }
+            it += r.n_;
+            return true;
+        }
+        // a prefix of the
+        // literal needs more
+        if( n > 0 &&
+            std::memcmp(
+                it, r.s_, n) != 0)
+            ev = error::mismatch;
+        else
+            ev = error::need_more;
+        return false;
+    }
+};
+
+template<>
+struct fused_rule<ci_literal_rule>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        ci_literal_rule const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        std::size_t const n = end - it;
+        if(n >= r.n_)
+        {
+            if(! ci_is_equal(
+                core::string_view(it, r.n_),
+                core::string_view(r.s_, r.n_)))
+            {
+                ev = error::mismatch;
+                return false;
+            }
+            it += r.n_;
+            return true;
+        }
+        if( n > 0 &&
+            ! ci_is_equal(
+                core::string_view(it, n),
+                core::string_view(r.s_, n)))
+            ev = error::mismatch;
+        else
+            ev = error::need_more;
+        return false;
+    }
+};
+
+template<>
+struct fused_rule<ch_find_delim_rule>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        ch_find_delim_rule const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        void const* p = it == end ? nullptr :
+            std::memchr(it, r.ch_, end - it);
+        if(! p)
+        {
+            ev = error::need_more;
+            return false;
+        }
+        it = static_cast<char const*>(p);
+        return true;
+    }
+};
+
+template<class CharSet>
+struct fused_rule<cs_find_delim_rule<CharSet>>
+    : std::true_type
+{
+    static
+    bool
+    scan(
+        cs_find_delim_rule<CharSet> const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        char const* const it1 =
+            grammar::find_if(it, end, r.cs_);
+        if(it1 == end)
+        {
+            ev = error::need_more;
+            return false;
+        }
+        it = it1;
+        return true;
+    }
+};
+
+template<class Rule>
+struct fused_rule<squelch_rule_t<Rule>>
+    : fused_rule<Rule>
+{
+    static
+    bool
+    scan(
+        squelch_rule_t<Rule> const& r,
+        char const*& it,
+        char const* end,
+        error& ev) noexcept
+    {
+        return fused_rule<Rule>::scan(
+            r.get(), it, end, ev);
+    }
+};
+
+//------------------------------------------------
+
+template<class L, class I>
+using is_fused_impl = mp11::mp_bool<
+    fused_rule<mp11::mp_at<L, I>>::value>;
+
+// true if the I-th rule of L is fused
+template<class L, std::size_t I>
+using is_fused = mp11::mp_eval_if_c<
+    (I >= mp11::mp_size<L>::value),
+    mp11::mp_false,
+    is_fused_impl, L, mp11::mp_size_t<I>>;
+
+// the end of the run of fused
+// rules of L starting at I
+template<
+    class L,
+    std::size_t I,
+    bool = is_fused<L, I>::value>
+struct fused_end
+    : mp11::mp_size_t<I>
+{
+};
+
+template<class L, std::size_t I>
+struct fused_end<L, I, true>
+    : fused_end<L, I + 1>
+{
+};
+
+// match the rules [I, Ie) of rn,
+// storing where each one ends
+template<
+    std::size_t I,
+    std::size_t Ie,
+    class T>
+typename std::enable_if<
+    I == Ie, bool>::type
+scan_fused(
+    T const&,
+    char const*&,
+    char const*,
+    char const**,
+    error&) noexcept
+{
+    return true;
+}
+
+template<
+    std::size_t I,
+    std::size_t Ie,
+    class T>
+typename std::enable_if<
+    I != Ie, bool>::type
+scan_fused(
+    T const& rn,
+    char const*& it,
+    char const* end,
+    char const** pos,
+    error& ev) noexcept
+{
+    auto const& r = get<I>(rn);
+    using R = typename std::decay<
+        decltype(r)>::type;
+    if(! fused_rule<R>::scan(
+            r, it, end, ev))
+        return false;
+    *pos = it;
+    return scan_fused<I + 1, Ie>(
+        rn, it, end, pos + 1, ev);
+}
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
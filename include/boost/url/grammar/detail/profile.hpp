@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_DETAIL_PROFILE_HPP
+#define BOOST_URL_GRAMMAR_DETAIL_PROFILE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef BOOST_URL_ENABLE_GRAMMAR_PROFILE
+# define BOOST_URL_GRAMMAR_PROFILE
+# if defined(BOOST_URL_USE_SSE2)
+#  ifdef _MSC_VER
+#   include <intrin.h>
+#  else
+#   include <x86intrin.h>
+#  endif
+# else
+#  include <chrono>
+# endif
+#endif
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+// The counters of one rule type. Every
+// type is registered on first use and
+// never destroyed.
+struct rule_type
+{
+    core::typeinfo const* type;
+    std::atomic<std::size_t> calls;
+    std::atomic<std::size_t> failures;
+    std::atomic<std::size_t> bytes;
+    std::atomic<std::size_t> backtracks;
+    std::atomic<std::uint64_t> cycles;
+    rule_type* next;
+
+    explicit
+    rule_type(
+        core::typeinfo const& ti) noexcept;
+};
+
+BOOST_URL_DECL
+void
+rule_register_impl(
+    rule_type&) noexcept;
+
+inline
+rule_type::
+rule_type(
+    core::typeinfo const& ti) noexcept
+    : type(&ti)
+    , calls(0)
+    , failures(0)
+    , bytes(0)
+    , backtracks(0)
+    , cycles(0)
+    , next(nullptr)
+{
+    rule_register_impl(*this);
+}
+
+template<class R>
+rule_type&
+rule_type_of() noexcept
+{
+    static rule_type t(
+        BOOST_CORE_TYPEID(R));
+    return t;
+}
+
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+
+// The time stamp counter where there is
+// one, which costs a few cycles to read,
+// and the steady clock elsewhere
+inline
+std::uint64_t
+rule_clock() noexcept
+{
+#if defined(BOOST_URL_USE_SSE2)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now(
+            ).time_since_epoch().count());
+#endif
+}
+
+template<class R>
+void
+rule_leave(
+    std::uint64_t t0,
+    std::size_t n,
+    bool ok) noexcept
+{
+    auto const t1 = rule_clock();
+    auto& t = rule_type_of<R>();
+    t.calls.fetch_add(1,
+        std::memory_order_relaxed);
+    if(ok)
+        t.bytes.fetch_add(n,
+            std::memory_order_relaxed);
+    else
+        t.failures.fetch_add(1,
+            std::memory_order_relaxed);
+    t.cycles.fetch_add(t1 - t0,
+        std::memory_order_relaxed);
+}
+
+template<class R>
+void
+rule_backtrack() noexcept
+{
+    rule_type_of<R>().backtracks.fetch_add(
+        1, std::memory_order_relaxed);
+}
+
+#else
+
+template<class R>
+void rule_backtrack() noexcept
+{
+}
+
+#endif
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
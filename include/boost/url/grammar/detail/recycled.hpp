@@ -10,6 +10,10 @@
 #ifndef BOOST_URL_GRAMMAR_DETAIL_RECYCLED_HPP
 #define BOOST_URL_GRAMMAR_DETAIL_RECYCLED_HPP
 
+#include <boost/url/detail/config.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <atomic>
+#include <cstddef>
 #include <utility>
 
 namespace boost {
@@ -53,6 +57,54 @@ nearest_pow2(
 
 //------------------------------------------------
 
+// The counters of the instances of one
+// type held by recycle bins. Every type
+// is registered on first use and never
+// destroyed.
+struct recycled_type
+{
+    core::typeinfo const* type;
+    std::atomic<std::size_t> count;
+    std::atomic<std::size_t> bytes;
+    std::atomic<std::size_t> count_max;
+    std::atomic<std::size_t> bytes_max;
+    std::atomic<std::size_t> alloc_max;
+    recycled_type* next;
+
+    explicit
+    recycled_type(
+        core::typeinfo const& ti) noexcept;
+};
+
+BOOST_URL_DECL
+void
+recycled_register_impl(
+    recycled_type&) noexcept;
+
+inline
+recycled_type::
+recycled_type(
+    core::typeinfo const& ti) noexcept
+    : type(&ti)
+    , count(0)
+    , bytes(0)
+    , count_max(0)
+    , bytes_max(0)
+    , alloc_max(0)
+    , next(nullptr)
+{
+    recycled_register_impl(*this);
+}
+
+template<class T>
+recycled_type&
+recycled_type_of() noexcept
+{
+    static recycled_type t(
+        BOOST_CORE_TYPEID(T));
+    return t;
+}
+
 BOOST_URL_DECL
 void
 recycled_add_impl(
@@ -63,31 +115,50 @@ void
 recycled_remove_impl(
     std::size_t) noexcept;
 
-#ifdef BOOST_URL_REPORT
+BOOST_URL_DECL
+void
+recycled_add_impl(
+    recycled_type&,
+    std::size_t) noexcept;
 
-inline
+BOOST_URL_DECL
+void
+recycled_remove_impl(
+    recycled_type&,
+    std::size_t) noexcept;
+
+#if defined(BOOST_URL_REPORT) || \
+    defined(BOOST_URL_ENABLE_STATS)
+
+#define BOOST_URL_RECYCLED_STATS
+
+template<class T>
 void
 recycled_add(
     std::size_t n) noexcept
 {
-    recycled_add_impl(n);
+    recycled_add_impl(
+        recycled_type_of<T>(), n);
 }
 
-inline
+template<class T>
 void
 recycled_remove(
     std::size_t n) noexcept
 {
-    recycled_remove_impl(n);
+    recycled_remove_impl(
+        recycled_type_of<T>(), n);
 }
 
 #else
 
-inline void recycled_add(
+template<class T>
+void recycled_add(
     std::size_t) noexcept
 {
 }
-inline void recycled_remove(
+template<class T>
+void recycled_remove(
     std::size_t) noexcept
 {
 }
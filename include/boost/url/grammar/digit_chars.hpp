@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_DIGIT_CHARS_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/detail/charset.hpp>
 
 namespace boost {
@@ -45,6 +46,12 @@ namespace grammar {
 #ifdef BOOST_URL_DOCS
 constexpr __implementation_defined__ digit_chars;
 #else
+namespace detail {
+// the same set, for the SIMD kernels
+constexpr lut_chars digit_lut(
+    "0123456789");
+} // detail
+
 struct digit_chars_t
 {
     constexpr
@@ -54,14 +61,15 @@ struct digit_chars_t
         return c >= '0' && c <= '9';
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
     char const*
     find_if(
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_pred(
-            *this, first, last);
+        return detail::digit_lut.find_if(
+            first, last);
     }
 
     char const*
@@ -69,8 +77,8 @@ struct digit_chars_t
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_not_pred(
-            *this, first, last);
+        return detail::digit_lut.find_if_not(
+            first, last);
     }
 #endif
 };
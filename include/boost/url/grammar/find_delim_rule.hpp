@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_FIND_DELIM_RULE_HPP
+#define BOOST_URL_GRAMMAR_FIND_DELIM_RULE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/type_traits.hpp>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+/** Match the characters before a delimiter
+
+    This matches the characters up to, but
+    not including, the first occurrence of
+    the specified character, which is left
+    in the input. There may be no characters
+    before it. The delimiter is found with
+    a vectorized search, so this is faster
+    than a @ref token_rule matching every
+    other character. If the delimiter is not
+    in the input, the error code
+    @ref error::need_more is returned.
+
+    @par Value Type
+    @code
+    using value_type = core::string_view;
+    @endcode
+
+    @par Example
+    Rules are used with the function @ref parse.
+    @code
+    system::result< std::tuple< core::string_view, core::string_view > > rv = parse( "key=value;",
+        tuple_rule(
+            find_delim_rule( '=' ),
+            squelch( delim_rule( '=' ) ),
+            find_delim_rule( ';' ),
+            squelch( delim_rule( ';' ) ) ) );
+    @endcode
+
+    @param ch The delimiter to find.
+
+    @see
+        @ref delim_rule,
+        @ref parse,
+        @ref token_rule.
+*/
+#ifdef BOOST_URL_DOCS
+constexpr
+__implementation_defined__
+find_delim_rule( char ch ) noexcept;
+#else
+namespace detail {
+template<class Rule>
+struct fused_rule;
+} // detail
+
+struct ch_find_delim_rule
+{
+    using value_type = core::string_view;
+
+    constexpr
+    ch_find_delim_rule(char ch) noexcept
+        : ch_(ch)
+    {
+    }
+
+    BOOST_URL_DECL
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept;
+
+private:
+    template<class>
+    friend struct detail::fused_rule;
+
+    char ch_;
+};
+
+constexpr
+ch_find_delim_rule
+find_delim_rule( char ch ) noexcept
+{
+    return ch_find_delim_rule(ch);
+}
+#endif
+
+//------------------------------------------------
+
+/** Match the characters before a delimiter from a character set
+
+    This matches the characters up to, but
+    not including, the first character which
+    belongs to the specified character set.
+    The search is vectorized when the set
+    is a @ref lut_chars. If no character of
+    the set is in the input, the error code
+    @ref error::need_more is returned.
+
+    @par Value Type
+    @code
+    using value_type = core::string_view;
+    @endcode
+
+    @par Example
+    Rules are used with the function @ref parse.
+    @code
+    system::result< core::string_view > rv = parse( "abc;",
+        tuple_rule(
+            find_delim_rule( lut_chars( ",;" ) ),
+            squelch( delim_rule( lut_chars( ",;" ) ) ) ) );
+    @endcode
+
+    @param cs The character set to use.
+
+    @see
+        @ref delim_rule,
+        @ref find_if,
+        @ref parse.
+*/
+#ifdef BOOST_URL_DOCS
+template<class CharSet>
+constexpr
+__implementation_defined__
+find_delim_rule( CharSet const& cs ) noexcept;
+#else
+template<class CharSet>
+struct cs_find_delim_rule
+{
+    using value_type = core::string_view;
+
+    constexpr
+    cs_find_delim_rule(
+        CharSet const& cs) noexcept
+        : cs_(cs)
+    {
+    }
+
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept
+    {
+        char const* const it1 =
+            grammar::find_if(it, end, cs_);
+        if(it1 == end)
+        {
+            // no delimiter
+            BOOST_URL_RETURN_EC(
+                error::need_more);
+        }
+        char const* const it0 = it;
+        it = it1;
+        return core::string_view(
+            it0, it1 - it0);
+    }
+
+private:
+    template<class>
+    friend struct detail::fused_rule;
+
+    CharSet cs_;
+};
+
+template<class CharSet>
+constexpr
+typename std::enable_if<
+    ! std::is_convertible<
+        CharSet, char>::value,
+    cs_find_delim_rule<CharSet>>::type
+find_delim_rule(
+    CharSet const& cs) noexcept
+{
+    // If you get a compile error here it
+    // means that your type does not meet
+    // the requirements for a CharSet.
+    // Please consult the documentation.
+    static_assert(
+        is_charset<CharSet>::value,
+        "CharSet requirements not met");
+
+    return cs_find_delim_rule<CharSet>(cs);
+}
+#endif
+
+} // grammar
+} // urls
+} // boost
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_HEXDIG_CHARS_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/detail/charset.hpp>
 
 namespace boost {
@@ -58,6 +59,14 @@ namespace grammar {
 #ifdef BOOST_URL_DOCS
 constexpr __implementation_defined__ hexdig_chars;
 #else
+namespace detail {
+// the same set, for the SIMD kernels
+constexpr lut_chars hexdig_lut(
+    "0123456789"
+    "ABCDEF"
+    "abcdef");
+} // detail
+
 struct hexdig_chars_t
 {
     /** Return true if c is in the character set.
@@ -72,14 +81,15 @@ struct hexdig_chars_t
             (c >= 'a' && c <= 'f');
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
     char const*
     find_if(
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_pred(
-            *this, first, last);
+        return detail::hexdig_lut.find_if(
+            first, last);
     }
 
     char const*
@@ -87,8 +97,8 @@ struct hexdig_chars_t
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_not_pred(
-            *this, first, last);
+        return detail::hexdig_lut.find_if_not(
+            first, last);
     }
 #endif
 };
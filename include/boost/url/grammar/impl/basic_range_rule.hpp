@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_IMPL_BASIC_RANGE_RULE_HPP
+#define BOOST_URL_GRAMMAR_IMPL_BASIC_RANGE_RULE_HPP
+
+#include <boost/url/grammar/error.hpp>
+#include <boost/assert.hpp>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+//------------------------------------------------
+//
+// iterator
+//
+//------------------------------------------------
+
+template<
+    class T, class First, class Next>
+class basic_range<T, First, Next>::
+    iterator
+{
+public:
+    using value_type = T;
+    using reference = T const&;
+    using pointer = void const*;
+    using difference_type =
+        std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    iterator() = default;
+    iterator(
+        iterator const&) = default;
+    iterator& operator=(
+        iterator const&) = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return *rv_;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        // can't compare iterators
+        // from different containers!
+        BOOST_ASSERT(r_ == other.r_);
+
+        return p_ == other.p_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(
+            p_ != nullptr);
+        auto const end =
+            r_->s_.data() +
+            r_->s_.size();
+        rv_ = (grammar::parse)(
+            p_, end, r_->next());
+        if( !rv_ )
+            p_ = nullptr;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+private:
+    friend class basic_range;
+
+    basic_range const* r_ = nullptr;
+    char const* p_ = nullptr;
+    system::result<T> rv_;
+
+    iterator(
+        basic_range const& r) noexcept
+        : r_(&r)
+        , p_(r.s_.data())
+    {
+        if(r_->n_ == 0)
+        {
+            // a default-constructed
+            // range has no buffer
+            p_ = nullptr;
+            return;
+        }
+        auto const end =
+            r_->s_.data() +
+            r_->s_.size();
+        rv_ = (grammar::parse)(
+            p_, end, r_->first());
+        if( !rv_ )
+            p_ = nullptr;
+    }
+
+    constexpr
+    iterator(
+        basic_range const& r,
+        int) noexcept
+        : r_(&r)
+        , p_(nullptr)
+    {
+    }
+};
+
+//------------------------------------------------
+
+template<
+    class T, class First, class Next>
+auto
+basic_range<T, First, Next>::
+begin() const noexcept ->
+    iterator
+{
+    return { *this };
+}
+
+template<
+    class T, class First, class Next>
+auto
+basic_range<T, First, Next>::
+end() const noexcept ->
+    iterator
+{
+    return { *this, 0 };
+}
+
+//------------------------------------------------
+
+template<class R0, class R1>
+auto
+basic_range_rule_t<R0, R1>::
+parse(
+    char const*& it,
+    char const* end) const ->
+        system::result<value_type>
+{
+    std::size_t n = 0;
+    auto const it0 = it;
+    auto it1 = it;
+    auto rv = (grammar::parse)(
+        it, end, first_);
+    if( !rv )
+    {
+        if(rv.error() != error::end_of_range)
+        {
+            // rewind unless error::end_of_range
+            it = it1;
+        }
+        if(n < N_)
+        {
+            // too few
+            BOOST_URL_RETURN_EC(
+                error::mismatch);
+        }
+        // good
+        return value_type(
+            core::string_view(it0, it - it0),
+                n, first_, next_);
+    }
+    for(;;)
+    {
+        ++n;
+        it1 = it;
+        rv = (grammar::parse)(
+            it, end, next_);
+        if( !rv )
+        {
+            if(rv.error() != error::end_of_range)
+            {
+                // rewind unless error::end_of_range
+                it = it1;
+            }
+            break;
+        }
+        if(n >= M_)
+        {
+            // too many
+            BOOST_URL_RETURN_EC(
+                error::mismatch);
+        }
+    }
+    if(n < N_)
+    {
+        // too few
+        BOOST_URL_RETURN_EC(
+            error::mismatch);
+    }
+    // good
+    return value_type(
+        core::string_view(it0, it - it0),
+            n, first_, next_);
+}
+
+} // grammar
+} // urls
+} // boost
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_IMPL_OPTIONAL_RULE_HPP
 
 #include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
 
 namespace boost {
 namespace urls {
@@ -32,6 +33,8 @@ parse(
     if(rv)
         return value_type(*rv);
     it = it0;
+    detail::rule_backtrack<
+        optional_rule_t<R>>();
     return boost::none;
 }
 
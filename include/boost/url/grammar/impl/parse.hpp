@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/type_traits.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
 
 namespace boost {
 namespace urls {
@@ -33,7 +34,16 @@ parse(
         is_rule<R>::value,
         "Rule requirements not met");
 
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    auto const t0 = detail::rule_clock();
+    auto const it0 = it;
+    auto rv = r.parse(it, end);
+    detail::rule_leave<R>(t0,
+        it - it0, rv.has_value());
+    return rv;
+#else
     return r.parse(it, end);
+#endif
 }
 
 template<class R>
@@ -53,7 +63,11 @@ parse(
 
     auto it = s.data();
     auto const end = it + s.size();
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    auto rv = grammar::parse(it, end, r);
+#else
     auto rv = r.parse(it, end);
+#endif
     if( rv &&
         it != end)
         return error::leftover;
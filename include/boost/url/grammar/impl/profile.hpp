@@ -0,0 +1,33 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_IMPL_PROFILE_HPP
+#define BOOST_URL_GRAMMAR_IMPL_PROFILE_HPP
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+template<class R>
+rule_profile
+get_rule_profile() noexcept
+{
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    return detail::rule_read(
+        detail::rule_type_of<R>());
+#else
+    return {};
+#endif
+}
+
+} // grammar
+} // urls
+} // boost
+
+#endif
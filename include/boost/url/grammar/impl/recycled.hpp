@@ -10,7 +10,9 @@
 #ifndef BOOST_URL_GRAMMAR_IMPL_RECYCLED_PTR_HPP
 #define BOOST_URL_GRAMMAR_IMPL_RECYCLED_PTR_HPP
 
+#include <boost/url/detail/stats.hpp>
 #include <boost/assert.hpp>
+#include <new>
 
 namespace boost {
 namespace urls {
@@ -18,26 +20,243 @@ namespace grammar {
 
 //------------------------------------------------
 
+#if !defined(BOOST_URL_DISABLE_THREADS)
+
+// The per-thread caches of every
+// recycled<T> used by a thread
+template<class T>
+struct recycled<T>::cache
+{
+    // bins with a cache on one thread
+    static constexpr std::size_t max_bins = 4;
+
+    // instances kept before spilling
+    static constexpr std::size_t max_size = 16;
+
+    struct slot
+    {
+        recycled* bin;
+        U* head;
+        std::size_t size;
+    };
+
+    slot v[max_bins] = {};
+
+    // This stays valid after the cache is
+    // destroyed, which can happen before
+    // a static bin is destroyed.
+    struct state
+    {
+        cache* p;
+        bool done;
+    };
+
+    static
+    state&
+    local_state() noexcept
+    {
+        static thread_local state st = {};
+        return st;
+    }
+
+    // Returns nullptr once the
+    // thread is exiting.
+    static
+    cache*
+    get() noexcept
+    {
+        auto& st = local_state();
+        if(st.p || st.done)
+            return st.p;
+        static thread_local cache c;
+        return st.p;
+    }
+
+    slot*
+    find(recycled* bin) noexcept
+    {
+        slot* empty = nullptr;
+        for(auto& e : v)
+        {
+            if(e.bin == bin)
+                return &e;
+            if( ! e.bin &&
+                ! empty)
+                empty = &e;
+        }
+        if(empty)
+            *empty = { bin, nullptr, 0 };
+        return empty;
+    }
+
+    void
+    flush(slot& e) noexcept
+    {
+        if(! e.head)
+            return;
+        U* last = e.head;
+        while(last->next)
+            last = last->next;
+        e.bin->push_shared(e.head, last);
+        e.head = nullptr;
+        e.size = 0;
+    }
+
+    cache() noexcept
+    {
+        local_state().p = this;
+    }
+
+    ~cache()
+    {
+        auto& st = local_state();
+        st.p = nullptr;
+        st.done = true;
+        for(auto& e : v)
+            if(e.bin)
+                flush(e);
+    }
+};
+
+template<class T>
+void
+recycled<T>::
+push_shared(
+    U* first,
+    U* last) noexcept
+{
+    // Only whole lists are ever popped from
+    // the shared stack, so this is free of
+    // the ABA problem.
+    U* head = shared_.load(
+        std::memory_order_relaxed);
+    do
+    {
+        last->next = head;
+    }
+    while(! shared_.compare_exchange_weak(
+        head, first,
+        std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+template<class T>
+auto
+recycled<T>::
+acquire_local() ->
+    U*
+{
+    cache* c = cache::get();
+    auto e = c ? c->find(this) : nullptr;
+    U* p;
+    if(e && e->head)
+    {
+        // reuse
+        p = e->head;
+        e->head = p->next;
+        --e->size;
+    }
+    else
+    {
+        // take everything from the shared
+        // stack, keep the rest in the cache
+        p = shared_.exchange(nullptr,
+            std::memory_order_acquire);
+        if(! p)
+        {
+            urls::detail::stats_recycled(false);
+            return new U;
+        }
+        U* rest = p->next;
+        if(rest)
+        {
+            if(e)
+            {
+                std::size_t n = 0;
+                for(U* it = rest; it; it = it->next)
+                    ++n;
+                e->head = rest;
+                e->size = n;
+            }
+            else
+            {
+                U* last = rest;
+                while(last->next)
+                    last = last->next;
+                push_shared(rest, last);
+            }
+        }
+    }
+    detail::recycled_remove<T>(
+        sizeof(U));
+    urls::detail::stats_recycled(true);
+    ++p->refs;
+    return p;
+}
+
+template<class T>
+void
+recycled<T>::
+release_local(U* u) noexcept
+{
+    cache* c = cache::get();
+    auto e = c ? c->find(this) : nullptr;
+    detail::recycled_add<T>(
+        sizeof(U));
+    if(! e)
+    {
+        u->next = nullptr;
+        push_shared(u, u);
+        return;
+    }
+    if(e->size >= cache::max_size)
+        c->flush(*e);
+    u->next = e->head;
+    e->head = u;
+    ++e->size;
+}
+
+#endif
+
+//------------------------------------------------
+
 template<class T>
 recycled<T>::
 ~recycled()
 {
-    std::size_t n = 0;
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if(mode_ == recycle_mode::per_thread)
+    {
+        // Caches of other threads cannot
+        // be reached, see recycle_mode.
+        if(auto c = cache::get())
+        {
+            for(auto& e : c->v)
+            {
+                if(e.bin != this)
+                    continue;
+                c->flush(e);
+                e.bin = nullptr;
+            }
+        }
+        head_ = shared_.exchange(nullptr,
+            std::memory_order_acquire);
+    }
+#endif
     // VFALCO we should probably deallocate
     // in reverse order of allocation but
     // that requires a doubly-linked list.
     auto it = head_;
     while(it)
     {
-        ++n;
         auto next = it->next;
         BOOST_ASSERT(
             it->refs == 0);
         delete it;
+        detail::recycled_remove<T>(
+            sizeof(U));
         it = next;
     }
-    detail::recycled_remove(
-        sizeof(U) * n);
 }
 
 template<class T>
@@ -46,6 +265,14 @@ recycled<T>::
 acquire() ->
     U*
 {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if(mode_ == recycle_mode::per_thread)
+    {
+        U* p = acquire_local();
+        BOOST_ASSERT(p->refs == 1);
+        return p;
+    }
+#endif
     U* p;
     {
 #if !defined(BOOST_URL_DISABLE_THREADS)
@@ -57,13 +284,15 @@ acquire() ->
         {
             // reuse
             head_ = head_->next;
-            detail::recycled_remove(
+            detail::recycled_remove<T>(
                 sizeof(U));
             ++p->refs;
+            urls::detail::stats_recycled(true);
         }
         else
         {
             p = new U;
+            urls::detail::stats_recycled(false);
         }
     }
     BOOST_ASSERT(p->refs == 1);
@@ -77,6 +306,13 @@ release(U* u) noexcept
 {
     if(--u->refs != 0)
         return;
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if(mode_ == recycle_mode::per_thread)
+    {
+        release_local(u);
+        return;
+    }
+#endif
     {
 #if !defined(BOOST_URL_DISABLE_THREADS)
         std::lock_guard<
@@ -85,7 +321,7 @@ release(U* u) noexcept
         u->next = head_;
         head_ = u;
     }
-    detail::recycled_add(
+    detail::recycled_add<T>(
         sizeof(U));
 }
 
@@ -131,9 +367,22 @@ recycled_ptr(
     std::nullptr_t) noexcept
     : recycled_ptr([]() -> B&
         {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+            // The global bin is never destroyed,
+            // so threads exiting after static
+            // destruction can still return the
+            // instances in their caches.
+            alignas(B) static unsigned char
+                buf[sizeof(B)];
+            static B* r = ::new(
+                static_cast<void*>(buf)) B(
+                    recycle_mode::per_thread);
+            return *r;
+#else
             // VFALCO need guaranteed constexpr-init
             static B r;
             return r;
+#endif
         }(), nullptr)
 {
 }
@@ -214,6 +463,20 @@ release() noexcept
     }
 }
 
+//------------------------------------------------
+
+template<class T>
+recycled_stats
+get_recycled_stats() noexcept
+{
+#ifdef BOOST_URL_RECYCLED_STATS
+    return detail::recycled_read(
+        detail::recycled_type_of<T>());
+#else
+    return {};
+#endif
+}
+
 } // grammar
 } // urls
 } // boost
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_IMPL_TUPLE_RULE_HPP
 
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/detail/fused_rule.hpp>
 #include <boost/mp11/integral.hpp>
 #include <boost/mp11/list.hpp>
 #include <boost/mp11/tuple.hpp>
@@ -30,6 +31,8 @@ struct parse_sequence
 {
     using R = detail::tuple<R0, Rn...>;
 
+    using Rs = mp11::mp_list<R0, Rn...>;
+
     using L = mp11::mp_list<
         typename R0::value_type,
         typename Rn::value_type...>;
@@ -114,6 +117,121 @@ struct parse_sequence
             mp11::mp_size_t<Iv+1>{});
     }
 
+    // a run of fused rules, matched
+    // by one scanner
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    dispatch(
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_true const&)
+    {
+        constexpr std::size_t Ie =
+            fused_end<Rs, Ir>::value;
+        char const* pos[1 + Ie - Ir];
+        pos[0] = it;
+        error e{};
+        if(! scan_fused<Ir, Ie>(
+                rn, it, end, pos + 1, e))
+        {
+            ec = BOOST_URL_ERR(e);
+            return;
+        }
+        store(pos, it, end, ir, iv,
+            mp11::mp_false{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    dispatch(
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_false const&)
+    {
+        apply(it, end, ir, iv, is_void<Ir>{});
+    }
+
+    // form the values of a run
+    // from the end of each rule
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store(
+        char const* const*,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_true const&)
+    {
+        apply(it, end, ir, iv);
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_false const&)
+    {
+        store_value(pos, it, end,
+            ir, iv, is_void<Ir>{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store_value(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const&,
+        mp11::mp_size_t<Iv> const&,
+        mp11::mp_true const&)
+    {
+        store(pos + 1, it, end,
+            mp11::mp_size_t<Ir+1>{},
+            mp11::mp_size_t<Iv>{},
+            mp11::mp_bool<
+                ! is_fused<Rs, Ir+1>::value>{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store_value(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const&,
+        mp11::mp_size_t<Iv> const&,
+        mp11::mp_false const&)
+    {
+        get<Iv>(vn) = core::string_view(
+            pos[0], pos[1] - pos[0]);
+        store(pos + 1, it, end,
+            mp11::mp_size_t<Ir+1>{},
+            mp11::mp_size_t<Iv+1>{},
+            mp11::mp_bool<
+                ! is_fused<Rs, Ir+1>::value>{});
+    }
+
     template<
         std::size_t Ir = 0,
         std::size_t Iv = 0>
@@ -126,7 +244,8 @@ struct parse_sequence
         mp11::mp_size_t<Iv> const& iv = {}
             ) noexcept
     {
-        apply(it, end, ir, iv, is_void<Ir>{});
+        dispatch(it, end, ir, iv,
+            is_fused<Rs, Ir>{});
     }
 
     struct deref
@@ -158,6 +277,8 @@ struct parse_sequence<false, R0, Rn...>
 {
     using R = detail::tuple<R0, Rn...>;
 
+    using Rs = mp11::mp_list<R0, Rn...>;
+
     using L = mp11::mp_list<
         typename R0::value_type,
         typename Rn::value_type...>;
@@ -238,6 +359,121 @@ struct parse_sequence<false, R0, Rn...>
             mp11::mp_size_t<Iv+1>{});
     }
 
+    // a run of fused rules, matched
+    // by one scanner
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    dispatch(
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_true const&)
+    {
+        constexpr std::size_t Ie =
+            fused_end<Rs, Ir>::value;
+        char const* pos[1 + Ie - Ir];
+        pos[0] = it;
+        error e{};
+        if(! scan_fused<Ir, Ie>(
+                rn, it, end, pos + 1, e))
+        {
+            v = BOOST_URL_ERR(e);
+            return;
+        }
+        store(pos, it, end, ir, iv,
+            mp11::mp_false{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    dispatch(
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_false const&)
+    {
+        apply(it, end, ir, iv, is_void<Ir>{});
+    }
+
+    // form the values of a run
+    // from the end of each rule
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store(
+        char const* const*,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_true const&)
+    {
+        apply(it, end, ir, iv);
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const& ir,
+        mp11::mp_size_t<Iv> const& iv,
+        mp11::mp_false const&)
+    {
+        store_value(pos, it, end,
+            ir, iv, is_void<Ir>{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store_value(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const&,
+        mp11::mp_size_t<Iv> const&,
+        mp11::mp_true const&)
+    {
+        store(pos + 1, it, end,
+            mp11::mp_size_t<Ir+1>{},
+            mp11::mp_size_t<Iv>{},
+            mp11::mp_bool<
+                ! is_fused<Rs, Ir+1>::value>{});
+    }
+
+    template<
+        std::size_t Ir,
+        std::size_t Iv>
+    void
+    store_value(
+        char const* const* pos,
+        char const*& it,
+        char const* end,
+        mp11::mp_size_t<Ir> const&,
+        mp11::mp_size_t<Iv> const&,
+        mp11::mp_false const&)
+    {
+        v = core::string_view(
+            pos[0], pos[1] - pos[0]);
+        store(pos + 1, it, end,
+            mp11::mp_size_t<Ir+1>{},
+            mp11::mp_size_t<Iv+1>{},
+            mp11::mp_bool<
+                ! is_fused<Rs, Ir+1>::value>{});
+    }
+
     template<
         std::size_t Ir = 0,
         std::size_t Iv = 0>
@@ -250,7 +486,8 @@ struct parse_sequence<false, R0, Rn...>
         mp11::mp_size_t<Iv> const& iv = {}
             ) noexcept
     {
-        apply(it, end, ir, iv, is_void<Ir>{});
+        dispatch(it, end, ir, iv,
+            is_fused<Rs, Ir>{});
     }
 
     V
@@ -12,7 +12,9 @@
 
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/detail/digits.hpp>
 #include <algorithm> // VFALCO grr..
+#include <cstdint>
 
 namespace boost {
 namespace urls {
@@ -55,14 +57,50 @@ parse(
         std::numeric_limits<
             U>::digits10;
     static constexpr U ten = 10;
+    static constexpr U Max = (
+        std::numeric_limits<
+            U>::max)();
+
+    // the first eight digits at most
+    // are validated and converted at once
+    std::uint64_t const w =
+        detail::load_digits8(it, end);
+    std::size_t const n =
+        detail::count_digits8(w);
+    std::uint64_t const v =
+        detail::parse_digits8(w, n);
+    if(n < 8)
+    {
+        if( n > std::size_t(Digits10) && (
+            n > std::size_t(Digits10) + 1 ||
+            v > std::uint64_t(Max)))
+        {
+            // integer overflow
+            BOOST_URL_RETURN_EC(
+                error::invalid);
+        }
+        it += n;
+        return static_cast<U>(v);
+    }
+    if(n > std::size_t(Digits10))
+    {
+        // integer overflow
+        BOOST_URL_RETURN_EC(
+            error::invalid);
+    }
+    U u = static_cast<U>(v);
+    it += 8;
+
+    // the digits after the first eight
+    // which cannot overflow
+    std::size_t const safe =
+        std::size_t(Digits10) - 8;
     char const* safe_end;
     if(static_cast<std::size_t>(
-            end - it) >= Digits10)
-        safe_end = it + Digits10;
+            end - it) >= safe)
+        safe_end = it + safe;
     else
         safe_end = end;
-    U u = *it - '0';
-    ++it;
     while(it != safe_end &&
         digit_chars(*it))
     {
@@ -73,9 +111,6 @@ parse(
     if( it != end &&
         digit_chars(*it))
     {
-        static constexpr U Max = (
-            std::numeric_limits<
-                U>::max)();
         static constexpr
             auto div = (Max / ten);
         static constexpr
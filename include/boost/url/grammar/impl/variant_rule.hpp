@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
 #include <cstdint>
 #include <type_traits>
 
@@ -21,6 +22,48 @@ namespace grammar {
 
 namespace detail {
 
+// A rule which publishes the characters
+// which can start a match has a member
+// function first_chars() returning a
+// CharSet. Such a rule never matches
+// the empty string.
+template<class R, class = void>
+struct has_first_chars : std::false_type {};
+
+template<class R>
+struct has_first_chars<R, void_t<decltype(
+    std::declval<bool&>() =
+        std::declval<R const&>().first_chars()(
+            std::declval<char>())
+    )>> : std::true_type
+{
+};
+
+template<class R>
+constexpr
+bool
+may_start(
+    R const&,
+    char const*,
+    char const*,
+    std::false_type const&) noexcept
+{
+    return true;
+}
+
+template<class R>
+bool
+may_start(
+    R const& r,
+    char const* it,
+    char const* end,
+    std::true_type const&) noexcept
+{
+    return
+        it != end &&
+        r.first_chars()(*it);
+}
+
 // must come first
 template<
     class R0,
@@ -61,15 +104,25 @@ parse_variant(
             typename R0::value_type,
             typename Rn::value_type...>>
 {
-    auto const it0 = it;
-    auto rv = parse(
-        it, end, get<I>(rn));
-    if( rv )
-        return variant<
-            typename R0::value_type,
-            typename Rn::value_type...>{
-                variant2::in_place_index_t<I>{}, *rv};
-    it = it0;
+    using R = typename std::decay<
+        decltype(get<I>(rn))>::type;
+    // skip the alternatives which
+    // cannot start with *it
+    if(may_start(get<I>(rn), it, end,
+        has_first_chars<R>{}))
+    {
+        auto const it0 = it;
+        auto rv = parse(
+            it, end, get<I>(rn));
+        if( rv )
+            return variant<
+                typename R0::value_type,
+                typename Rn::value_type...>{
+                    variant2::in_place_index_t<I>{}, *rv};
+        it = it0;
+        rule_backtrack<
+            variant_rule_t<R0, Rn...>>();
+    }
     return parse_variant(
         it, end, rn,
         std::integral_constant<
@@ -46,8 +46,16 @@ constexpr
 __implementation_defined__
 literal_rule( char const* s );
 #else
+namespace detail {
+template<class Rule>
+struct fused_rule;
+} // detail
+
 class literal_rule
 {
+    template<class>
+    friend struct detail::fused_rule;
+
     char const* s_ = nullptr;
     std::size_t n_ = 0;
 
@@ -81,6 +89,77 @@ public:
 };
 #endif
 
+//------------------------------------------------
+
+/** Match a string literal ignoring case
+
+    This matches the literal as @ref literal_rule
+    does, except that ASCII letters compare
+    equal to the same letter in the other case.
+    Long literals are compared sixteen or eight
+    characters at a time. The value is the
+    matched characters of the input, in their
+    original case.
+
+    @par Value Type
+    @code
+    using value_type = core::string_view;
+    @endcode
+
+    @par Example
+    Rules are used with the function @ref parse.
+    @code
+    system::result< core::string_view > rv = parse( "HTTP://", ci_literal_rule( "http://" ) );
+    @endcode
+
+    @see
+        @ref ci_is_equal,
+        @ref literal_rule,
+        @ref parse.
+*/
+#ifdef BOOST_URL_DOCS
+constexpr
+__implementation_defined__
+ci_literal_rule( char const* s );
+#else
+class ci_literal_rule
+{
+    template<class>
+    friend struct detail::fused_rule;
+
+    char const* s_ = nullptr;
+    std::size_t n_ = 0;
+
+    constexpr
+    static
+    std::size_t
+    len(char const* s) noexcept
+    {
+        return *s
+            ? 1 + len(s + 1)
+            : 0;
+    }
+
+public:
+    using value_type = core::string_view;
+
+    constexpr
+    explicit
+    ci_literal_rule(
+        char const* s) noexcept
+        : s_(s)
+        , n_(len(s))
+    {
+    }
+
+    BOOST_URL_DECL
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept;
+};
+#endif
+
 } // grammar
 } // urls
 } // boost
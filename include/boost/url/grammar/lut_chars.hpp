@@ -65,6 +65,12 @@ class lut_chars
 {
     std::uint64_t mask_[4] = {};
 
+    // The nibble tables used by the SIMD
+    // kernels. A character c = 16 * h + l
+    // is a member when bit (h & 7) of
+    // nib_[l + 16 * (h >> 3)] is set.
+    alignas(16) unsigned char nib_[32] = {};
+
     constexpr
     static
     std::uint64_t
@@ -83,6 +89,46 @@ class lut_chars
             unsigned char>(c) >> 2);
     }
 
+    // Return the bits of the characters
+    // 16 * h + l, for the n high nibbles
+    // starting at h, from the mask which
+    // holds low nibble l at shift s
+    constexpr
+    static
+    unsigned
+    gather(
+        std::uint64_t m,
+        unsigned s,
+        unsigned h,
+        unsigned n) noexcept
+    {
+        return n == 0 ? 0 :
+            static_cast<unsigned>(
+                (m >> (4 * h + s)) & 1) |
+            (gather(m, s, h + 1, n - 1) << 1);
+    }
+
+    // Return nib_[i] for the masks
+    constexpr
+    static
+    unsigned char
+    nibble(
+        std::uint64_t m0,
+        std::uint64_t m1,
+        std::uint64_t m2,
+        std::uint64_t m3,
+        unsigned i) noexcept
+    {
+        return static_cast<unsigned char>(
+            gather(
+                (i & 3) == 0 ? m0 :
+                (i & 3) == 1 ? m1 :
+                (i & 3) == 2 ? m2 : m3,
+                (i & 15) >> 2,
+                8 * (i >> 4),
+                8));
+    }
+
     constexpr
     static
     lut_chars
@@ -131,6 +177,23 @@ class lut_chars
         std::uint64_t m2,
         std::uint64_t m3) noexcept
         : mask_{ m0, m1, m2, m3 }
+        , nib_{
+            nibble(m0, m1, m2, m3, 0), nibble(m0, m1, m2, m3, 1),
+            nibble(m0, m1, m2, m3, 2), nibble(m0, m1, m2, m3, 3),
+            nibble(m0, m1, m2, m3, 4), nibble(m0, m1, m2, m3, 5),
+            nibble(m0, m1, m2, m3, 6), nibble(m0, m1, m2, m3, 7),
+            nibble(m0, m1, m2, m3, 8), nibble(m0, m1, m2, m3, 9),
+            nibble(m0, m1, m2, m3, 10), nibble(m0, m1, m2, m3, 11),
+            nibble(m0, m1, m2, m3, 12), nibble(m0, m1, m2, m3, 13),
+            nibble(m0, m1, m2, m3, 14), nibble(m0, m1, m2, m3, 15),
+            nibble(m0, m1, m2, m3, 16), nibble(m0, m1, m2, m3, 17),
+            nibble(m0, m1, m2, m3, 18), nibble(m0, m1, m2, m3, 19),
+            nibble(m0, m1, m2, m3, 20), nibble(m0, m1, m2, m3, 21),
+            nibble(m0, m1, m2, m3, 22), nibble(m0, m1, m2, m3, 23),
+            nibble(m0, m1, m2, m3, 24), nibble(m0, m1, m2, m3, 25),
+            nibble(m0, m1, m2, m3, 26), nibble(m0, m1, m2, m3, 27),
+            nibble(m0, m1, m2, m3, 28), nibble(m0, m1, m2, m3, 29),
+            nibble(m0, m1, m2, m3, 30), nibble(m0, m1, m2, m3, 31) }
     {
     }
 
@@ -156,11 +219,11 @@ public:
     */
     constexpr
     lut_chars(char ch) noexcept
-        : mask_ {
+        : lut_chars(
             lo(ch) == 0 ? hi(ch) : 0,
             lo(ch) == 1 ? hi(ch) : 0,
             lo(ch) == 2 ? hi(ch) : 0,
-            lo(ch) == 3 ? hi(ch) : 0 }
+            lo(ch) == 3 ? hi(ch) : 0)
     {
     }
 
@@ -381,7 +444,48 @@ public:
     }
 
 #ifndef BOOST_URL_DOCS
+#if defined(BOOST_URL_USE_AVX2) || \
+    defined(BOOST_URL_USE_NEON)
+    char const*
+    find_if(
+        char const* first,
+        char const* last) const noexcept
+    {
+        if(static_cast<std::size_t>(
+            last - first) >=
+                detail::find_lut_wide_min)
+            return detail::find_lut_wide(
+                mask_, nib_, first, last, true);
 #ifdef BOOST_URL_USE_SSE2
+        return detail::find_if_pred(
+            *this, first, last);
+#else
+        return detail::find_if(
+            first, last, *this,
+            std::false_type{});
+#endif
+    }
+
+    char const*
+    find_if_not(
+        char const* first,
+        char const* last) const noexcept
+    {
+        if(static_cast<std::size_t>(
+            last - first) >=
+                detail::find_lut_wide_min)
+            return detail::find_lut_wide(
+                mask_, nib_, first, last, false);
+#ifdef BOOST_URL_USE_SSE2
+        return detail::find_if_not_pred(
+            *this, first, last);
+#else
+        return detail::find_if_not(
+            first, last, *this,
+            std::false_type{});
+#endif
+    }
+#elif defined(BOOST_URL_USE_SSE2)
     char const*
     find_if(
         char const* first,
@@ -400,6 +504,27 @@ public:
             *this, first, last);
     }
 #endif
+#ifdef BOOST_URL_USE_AVX2
+    // Skip the characters of a pct-encoded
+    // string with this set as unreserved
+    // characters, adding the decoded size
+    // to n. Returns null on an invalid
+    // escape. See detail::scan_pct_wide.
+    char const*
+    scan_pct(
+        char const* first,
+        char const* last,
+        std::size_t& n) const noexcept
+    {
+        if( static_cast<std::size_t>(
+                last - first) <
+                    detail::find_lut_wide_min ||
+            (*this)('%'))
+            return first;
+        return detail::scan_pct_wide(
+            mask_, nib_, first, last, n);
+    }
+#endif
 #endif
 };
 
@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_PROFILE_HPP
+#define BOOST_URL_GRAMMAR_PROFILE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+/** The work done by the rules of one type
+
+    Each call to @ref parse with a rule
+    updates the counters of the type of the
+    rule. The compound rules such as
+    @ref tuple_rule, @ref variant_rule and
+    @ref range_rule parse their elements
+    with @ref parse, so the counters show
+    how the time of a grammar is divided
+    among the rules it is built from.
+
+    The counters are only updated when the
+    library and the code which uses it are
+    compiled with the macro
+    `BOOST_URL_ENABLE_GRAMMAR_PROFILE`
+    defined. Otherwise the hooks compile to
+    nothing and every value is zero.
+
+    @see
+        @ref get_rule_profile,
+        @ref get_rule_type_profiles,
+        @ref reset_rule_profiles,
+        @ref rule_profile_enabled.
+*/
+struct rule_profile
+{
+    /** The number of calls to parse
+    */
+    std::size_t calls = 0;
+
+    /** The number of calls which failed
+    */
+    std::size_t failures = 0;
+
+    /** The number of characters consumed by successful calls
+    */
+    std::size_t bytes = 0;
+
+    /** The number of times the input was rewound
+
+        This counts the alternatives of a
+        @ref variant_rule which failed, and
+        the elements of an @ref optional_rule
+        which were absent, for the type of the
+        variant or optional rule.
+    */
+    std::size_t backtracks = 0;
+
+    /** The time spent in the calls
+
+        This is measured with the time stamp
+        counter of the processor where there
+        is one, and in ticks of
+        `std::chrono::steady_clock` elsewhere.
+        It includes the time of the rules
+        which were called by this rule.
+    */
+    std::uint64_t cycles = 0;
+};
+
+/** The work done by the rules of one type
+
+    @see
+        @ref get_rule_type_profiles.
+*/
+struct rule_type_profile
+{
+    /** The name of the type of the rule
+    */
+    std::string type;
+
+    /** The counters of the type
+    */
+    rule_profile profile;
+};
+
+/** Return true if the counters are updated
+
+    This is true when the calling code was
+    compiled with `BOOST_URL_ENABLE_GRAMMAR_PROFILE`
+    defined.
+*/
+constexpr
+bool
+rule_profile_enabled() noexcept
+{
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Return the counters of one rule type
+
+    @par Example
+    @code
+    rule_profile p = get_rule_profile< decltype( ipv4_address_rule ) >();
+    @endcode
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @tparam R The type of the rule.
+
+    @see
+        @ref rule_profile.
+*/
+template<class R>
+rule_profile
+get_rule_profile() noexcept;
+
+/** Return the counters of every rule type
+
+    This returns one element for each type
+    of rule which was parsed since the
+    program started, sorted by decreasing
+    @ref rule_profile::cycles, so the rules
+    which cost the most come first.
+
+    @par Example
+    @code
+    for( auto const& e : get_rule_type_profiles() )
+        std::cout <<
+            e.profile.calls << " " <<
+            e.profile.cycles << " " <<
+            e.type << "\n";
+    @endcode
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @see
+        @ref rule_type_profile.
+*/
+BOOST_URL_DECL
+std::vector<rule_type_profile>
+get_rule_type_profiles();
+
+/** Set every counter of every rule type to zero
+
+    @par Thread Safety
+    May be called concurrently; updates
+    which happen at the same time may be
+    lost.
+
+    @par Exception Safety
+    Throws nothing.
+*/
+BOOST_URL_DECL
+void
+reset_rule_profiles() noexcept;
+
+namespace detail {
+
+BOOST_URL_DECL
+rule_profile
+rule_read(
+    rule_type const&) noexcept;
+
+} // detail
+
+} // grammar
+} // urls
+} // boost
+
+#include <boost/url/grammar/impl/profile.hpp>
+
+#endif
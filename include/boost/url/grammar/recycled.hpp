@@ -14,7 +14,9 @@
 #include <boost/url/grammar/detail/recycled.hpp>
 #include <atomic>
 #include <cstddef>
+#include <string>
 #include <type_traits>
+#include <vector>
 #include <stddef.h> // ::max_align_t
 
 #if !defined(BOOST_URL_DISABLE_THREADS)
@@ -50,6 +52,44 @@ using aligned_storage =
 
 //------------------------------------------------
 
+/** The strategy used by a recycle bin
+
+    This determines how a @ref recycled
+    bin shares its instances between
+    threads.
+
+    @see
+        @ref recycled.
+*/
+enum class recycle_mode
+{
+    /** All threads share one list
+
+        Every acquisition and release takes
+        a lock on a mutex owned by the bin.
+    */
+    locked,
+
+    /** Each thread keeps its own cache
+
+        Instances released by a thread are
+        kept in a small cache local to that
+        thread, and reused by the same thread
+        without synchronization. The caches
+        are backed by a lock-free list shared
+        by all threads, which receives
+        instances when a cache grows too
+        large or when a thread exits.
+
+        A bin using this mode must outlive
+        every thread which acquires or
+        releases instances from it.
+    */
+    per_thread
+};
+
+//------------------------------------------------
+
 /** A thread-safe collection of instances of T
 
     Instances of this type may be used to control
@@ -83,9 +123,40 @@ public:
     ~recycled();
 
     /** Constructor
+
+        The bin uses @ref recycle_mode::locked.
     */
     constexpr recycled() = default;
 
+    /** Constructor
+
+        @par Example
+        @code
+        static recycled< std::string > bin( recycle_mode::per_thread );
+        @endcode
+
+        @param mode The strategy used to share
+        instances between threads.
+    */
+    constexpr
+    explicit
+    recycled(
+        recycle_mode mode) noexcept
+        : mode_(mode)
+    {
+    }
+
+    /** Return the strategy used by the bin
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    recycle_mode
+    mode() const noexcept
+    {
+        return mode_;
+    }
+
 private:
     template<class>
     friend class recycled_ptr;
@@ -117,8 +188,19 @@ private:
     U* head_ = nullptr;
 
 #if !defined(BOOST_URL_DISABLE_THREADS)
+    struct cache;
+
+    U* acquire_local();
+    void release_local(U* u) noexcept;
+    void push_shared(U* first, U* last) noexcept;
+
     std::mutex m_;
+
+    // shared by all threads, per_thread mode
+    std::atomic<U*> shared_{nullptr};
 #endif
+
+    recycle_mode mode_ = recycle_mode::locked;
 };
 
 //------------------------------------------------
@@ -501,6 +583,166 @@ public:
     void release() noexcept;
 };
 
+//------------------------------------------------
+
+/** Statistics of the instances held by recycle bins
+
+    An instance is held by a bin from the time
+    it is released by its last @ref recycled_ptr
+    until it is acquired again or the bin is
+    destroyed. A count which keeps growing in a
+    long-running program indicates that instances
+    are released faster than they are reused.
+
+    The statistics are only updated when the
+    library and the code which uses it are
+    compiled with `BOOST_URL_ENABLE_STATS` or
+    `BOOST_URL_REPORT` defined. Otherwise the
+    hooks are empty and every value is zero.
+
+    @see
+        @ref get_recycled_stats,
+        @ref get_recycled_type_stats,
+        @ref recycled_stats_enabled.
+*/
+struct recycled_stats
+{
+    /** The number of instances held
+    */
+    std::size_t count = 0;
+
+    /** The number of bytes held
+    */
+    std::size_t bytes = 0;
+
+    /** The highest number of instances held
+    */
+    std::size_t count_max = 0;
+
+    /** The highest number of bytes held
+    */
+    std::size_t bytes_max = 0;
+
+    /** The size of the largest instance
+    */
+    std::size_t alloc_max = 0;
+};
+
+/** The statistics of the bins of one type
+
+    @see
+        @ref get_recycled_type_stats.
+*/
+struct recycled_type_stats
+{
+    /** The name of the type of the instances
+    */
+    std::string type;
+
+    /** The statistics of the type
+    */
+    recycled_stats stats;
+};
+
+/** Return true if the statistics are updated
+
+    This is true when the calling code was
+    compiled with `BOOST_URL_ENABLE_STATS`
+    or `BOOST_URL_REPORT` defined.
+*/
+constexpr
+bool
+recycled_stats_enabled() noexcept
+{
+#ifdef BOOST_URL_RECYCLED_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Return the statistics of every recycle bin
+
+    The counts and bytes are exact. To avoid
+    contention, each thread keeps its own
+    counters, so the maximums are the highest
+    values reached by a single thread.
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref recycled_stats.
+*/
+BOOST_URL_DECL
+recycled_stats
+get_recycled_stats() noexcept;
+
+/** Return the statistics of the bins of one type
+
+    This returns the statistics of all the
+    instances of @ref recycled with the
+    parameter `T`. The maximums are the
+    highest values reached by the type, over
+    all threads.
+
+    @par Example
+    @code
+    recycled_stats st = get_recycled_stats< std::string >();
+    @endcode
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @tparam T The type of the instances.
+
+    @see
+        @ref recycled_stats.
+*/
+template<class T>
+recycled_stats
+get_recycled_stats() noexcept;
+
+/** Return the statistics of every type
+
+    This returns one element for each type
+    of instance which was held by a bin
+    since the program started.
+
+    @par Example
+    @code
+    for( auto const& e : get_recycled_type_stats() )
+        metrics.gauge( "recycled.bytes", e.stats.bytes, { "type", e.type } );
+    @endcode
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @see
+        @ref recycled_type_stats.
+*/
+BOOST_URL_DECL
+std::vector<recycled_type_stats>
+get_recycled_type_stats();
+
+namespace detail {
+
+BOOST_URL_DECL
+recycled_stats
+recycled_read(
+    recycled_type const&) noexcept;
+
+} // detail
+
 } // grammar
 } // urls
 } // boost
@@ -335,6 +335,258 @@ preserve_size(
 }
 #endif
 
+//------------------------------------------------
+
+/** A token for writing into a caller-provided buffer
+
+    The characters are written to the beginning
+    of the buffer, and the result is a
+    `core::string_view` referencing them. No
+    memory is allocated. If the buffer is too
+    small, an exception is thrown before
+    anything is written, leaving the buffer
+    unchanged.
+
+    @par Example
+    @code
+    char buf[64];
+    core::string_view s = pct_string_view( "Program%20Files" ).decode(
+        {}, string_token::span_token( buf ) );
+    assert( s == "Program Files" );
+    assert( s.data() == buf );
+    @endcode
+
+    @throw system_error The buffer
+    is too small for the result.
+
+    @param dest A pointer to the buffer.
+
+    @param size The size of the buffer.
+*/
+#ifdef BOOST_URL_DOCS
+__implementation_defined__
+span_token(
+    char* dest,
+    std::size_t size) noexcept;
+#else
+struct span_token_t
+    : arg
+{
+    using result_type = core::string_view;
+
+    span_token_t(
+        char* dest,
+        std::size_t size) noexcept
+        : p_(dest)
+        , cap_(size)
+    {
+    }
+
+    char*
+    prepare(std::size_t n) override
+    {
+        if(n > cap_)
+            urls::detail::throw_length_error();
+        n_ = n;
+        return p_;
+    }
+
+    result_type
+    result() noexcept
+    {
+        return core::string_view(p_, n_);
+    }
+
+private:
+    char* p_;
+    std::size_t cap_;
+    std::size_t n_ = 0;
+};
+
+inline
+span_token_t
+span_token(
+    char* dest,
+    std::size_t size) noexcept
+{
+    return span_token_t(dest, size);
+}
+
+template<std::size_t N>
+span_token_t
+span_token(char (&dest)[N]) noexcept
+{
+    return span_token_t(dest, N);
+}
+#endif
+
+//------------------------------------------------
+
+/** A token for allocating the result from an arena
+
+    The storage for the characters is obtained
+    from the allocator `a`, and the result is a
+    `core::string_view` referencing them. The
+    storage is never deallocated by the token
+    or the algorithm: this is intended for
+    allocators which release their memory all
+    at once, such as a bump or monotonic arena,
+    so results from many calls can be kept
+    until the arena is released.
+
+    @par Example
+    With a standard monotonic buffer resource:
+    @code
+    char buf[1024];
+    std::pmr::monotonic_buffer_resource mr( buf, sizeof( buf ) );
+    std::pmr::polymorphic_allocator< char > a( &mr );
+
+    core::string_view s = pct_string_view( "Program%20Files" ).decode(
+        {}, string_token::arena_token( a ) );
+    assert( s == "Program Files" );
+    @endcode
+
+    @note
+    To write to a `std::pmr::string`, use
+    @ref string_token::append_to or
+    @ref string_token::assign_to, which
+    accept strings with any allocator.
+
+    @param a The allocator to use. It is
+    rebound to `char` as needed.
+*/
+#ifdef BOOST_URL_DOCS
+template<class Allocator>
+__implementation_defined__
+arena_token(
+    Allocator const& a);
+#else
+template<class Alloc>
+struct arena_token_t
+    : arg
+{
+    using result_type = core::string_view;
+
+    using allocator_type = typename
+        std::allocator_traits<Alloc>::template
+            rebind_alloc<char>;
+
+    explicit
+    arena_token_t(
+        Alloc const& a) noexcept
+        : a_(a)
+    {
+    }
+
+    char*
+    prepare(std::size_t n) override
+    {
+        using traits = std::allocator_traits<
+            allocator_type>;
+        p_ = traits::allocate(a_, n);
+        n_ = n;
+        return p_;
+    }
+
+    result_type
+    result() noexcept
+    {
+        return core::string_view(p_, n_);
+    }
+
+private:
+    allocator_type a_;
+    char* p_ = nullptr;
+    std::size_t n_ = 0;
+};
+
+template<class Alloc>
+arena_token_t<Alloc>
+arena_token(Alloc const& a)
+{
+    return arena_token_t<Alloc>(a);
+}
+#endif
+
+//------------------------------------------------
+
+#ifndef BOOST_URL_DOCS
+namespace detail {
+
+BOOST_URL_DECL
+char*
+prepare_scratch(std::size_t n);
+
+} // detail
+#endif
+
+/** A token for writing into a per-thread scratch buffer
+
+    The characters are written to a buffer
+    owned by the calling thread, and the
+    result is a `core::string_view`
+    referencing them. The buffer grows as
+    needed and is reused by every call on
+    the same thread, so once it is large
+    enough no memory is allocated. This is
+    intended for values which are only
+    needed briefly, such as for logging or
+    a comparison.
+
+    The result remains valid until the next
+    use of a scratch token on the same
+    thread, or until the thread exits. For
+    this reason, the input of an algorithm
+    which writes to a scratch token must not
+    be the result of another one.
+
+    @par Example
+    @code
+    url_view u( "https://www.example.com/path%20to/file" );
+    if( u.path( string_token::scratch_token() ) == "/path to/file" )
+        log( u.host( string_token::scratch_token() ) );
+    @endcode
+
+    @throw std::bad_alloc The buffer
+    could not be grown.
+*/
+#ifdef BOOST_URL_DOCS
+__implementation_defined__
+scratch_token() noexcept;
+#else
+struct scratch_token_t
+    : arg
+{
+    using result_type = core::string_view;
+
+    char*
+    prepare(std::size_t n) override
+    {
+        p_ = urls::string_token::
+            detail::prepare_scratch(n);
+        n_ = n;
+        return p_;
+    }
+
+    result_type
+    result() noexcept
+    {
+        return core::string_view(p_, n_);
+    }
+
+private:
+    char* p_ = nullptr;
+    std::size_t n_ = 0;
+};
+
+inline
+scratch_token_t
+scratch_token() noexcept
+{
+    return {};
+}
+#endif
+
 } // string_token
 
 namespace grammar {
@@ -53,6 +53,11 @@ __implementation_defined__
 token_rule(
     CharSet cs) noexcept;
 #else
+namespace detail {
+template<class Rule>
+struct fused_rule;
+} // detail
+
 template<class CharSet>
 struct token_rule_t
 {
@@ -70,6 +75,9 @@ struct token_rule_t
         system::result<value_type>;
 
 private:
+    template<class>
+    friend struct detail::fused_rule;
+
     template<class CharSet_>
     friend
     constexpr
@@ -31,6 +31,14 @@ namespace grammar {
     implicit specification of linear white
     space between each rule.
 
+    Consecutive rules returned by
+    @ref token_rule, @ref delim_rule,
+    @ref find_delim_rule, @ref literal_rule
+    and @ref ci_literal_rule, or by
+    @ref squelch applied to them, are
+    matched together by one inline scanner
+    instead of one call to @ref parse each.
+
     @par Value Type
     @code
     using value_type = __see_below__;
@@ -26,6 +26,14 @@ namespace grammar {
     is stored and returned in the variant. If
     no match occurs, an error is returned.
 
+    An alternative whose rule has a member
+    function `first_chars()`, returning a
+    <em>CharSet</em> which contains every
+    character that can start a match, is
+    only tried when the next character of
+    the input is in that set. Such a rule
+    must not match the empty string.
+
     @par Value Type
     @code
     using value_type = variant< typename Rules::value_type... >;
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_VCHARS_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/detail/charset.hpp>
 
 namespace boost {
@@ -45,6 +46,14 @@ namespace grammar {
 #ifdef BOOST_URL_DOCS
 constexpr __implementation_defined__ vchars;
 #else
+namespace detail {
+// the same set, for the SIMD kernels
+constexpr lut_chars vchars_lut(
+    "!\"#$%&'()*+,-./0123456789:;<=>?@"
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
+    "abcdefghijklmnopqrstuvwxyz{|}~");
+} // detail
+
 struct vchars_t
 {
     constexpr
@@ -54,14 +63,15 @@ struct vchars_t
         return c >= 0x21 && c <= 0x7e;
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
     char const*
     find_if(
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_pred(
-            *this, first, last);
+        return detail::vchars_lut.find_if(
+            first, last);
     }
 
     char const*
@@ -69,8 +79,8 @@ struct vchars_t
         char const* first,
         char const* last) const noexcept
     {
-        return detail::find_if_not_pred(
-            *this, first, last);
+        return detail::vchars_lut.find_if_not(
+            first, last);
     }
 #endif
 };
@@ -0,0 +1,323 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_HOST_INTERNER_HPP
+#define BOOST_URL_HOST_INTERNER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/intern_table.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** A concurrent table of unique hosts
+
+    Each host interned in the table is given
+    a dense 32-bit identifier, the same for
+    every host which has the same characters
+    regardless of case. The table keeps one
+    lowercase copy of each host. Hosts are
+    compared as they are written, so
+    `"%41"` and `"a"` are different hosts.
+
+    Finding a host, and interning a host
+    which is already in the table, hash the
+    host once, ignoring case, and take no
+    lock. Adding a host takes a lock, which
+    serializes the writers.
+
+    Programs which keep state per host, such
+    as rate limiters, connection pools and
+    politeness queues, can use the
+    identifiers as keys, so that they hash
+    and compare integers instead of strings.
+
+    @par Example
+    @code
+    host_interner t;
+    std::uint32_t id = t.intern( url_view( "https://WWW.Example.com/a" ) );
+    assert( t.intern( url_view( "http://www.example.com:8080/b" ) ) == id );
+    assert( t.host( id ) == "www.example.com" );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+
+    @see
+        @ref endpoint_table,
+        @ref host_id_view,
+        @ref url_interner.
+*/
+class host_interner
+{
+    detail::intern_table t_;
+
+public:
+    /** The type of an identifier
+    */
+    using id_type = std::uint32_t;
+
+    /** The value which identifies no host
+    */
+    static constexpr id_type npos =
+        id_type(-1);
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param n The number of hosts which
+        can be interned before the table of
+        slots is enlarged.
+    */
+    explicit
+    host_interner(std::size_t n = 0)
+        : t_(n)
+    {
+    }
+
+    host_interner(host_interner const&) = delete;
+    host_interner& operator=(host_interner const&) = delete;
+
+    /** Return the number of interned hosts
+
+        The identifiers of the hosts are
+        the values less than this number.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return t_.size();
+    }
+
+    /** Return true if no host is interned
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return the number of bytes used by the copies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    arena_size() const noexcept
+    {
+        return t_.arena_size();
+    }
+
+    /** Intern a host
+
+        If a host equal to `host`, ignoring
+        case, is in the table, its identifier
+        is returned, without taking a lock.
+        Otherwise, a lowercase copy of `host`
+        is added to the table and given the
+        next identifier.
+
+        @par Complexity
+        Linear in `host.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on too many hosts.
+
+        @throw system_error
+        The table has `npos` hosts.
+
+        @return The identifier of the host.
+
+        @param host The encoded host.
+    */
+    BOOST_URL_DECL
+    id_type
+    intern(core::string_view host);
+
+    /** Intern the host of a URL
+
+        @par Effects
+        @code
+        return this->intern( u.encoded_host() );
+        @endcode
+
+        @param u The URL whose host is interned.
+    */
+    id_type
+    intern(url_view_base const& u)
+    {
+        return intern(u.encoded_host());
+    }
+
+    /** Return the identifier of a host
+
+        This function takes no lock.
+
+        @par Complexity
+        Linear in `host.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The identifier of the host
+        equal to `host`, ignoring case, or
+        @ref npos if there is none.
+
+        @param host The encoded host.
+    */
+    BOOST_URL_DECL
+    id_type
+    find(core::string_view host) const noexcept;
+
+    /** Return the identifier of the host of a URL
+
+        @par Effects
+        @code
+        return this->find( u.encoded_host() );
+        @endcode
+
+        @param u The URL whose host is found.
+    */
+    id_type
+    find(url_view_base const& u) const noexcept
+    {
+        return find(u.encoded_host());
+    }
+
+    /** Return the host with an identifier
+
+        The string is the lowercase copy
+        held by the table, and remains valid
+        until the table is destroyed. This
+        function takes no lock.
+
+        @par Preconditions
+        @code
+        id < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The identifier returned
+        by @ref intern or @ref find.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    host(id_type id) const noexcept;
+
+    /// @copydoc host
+    core::string_view
+    operator[](id_type id) const noexcept
+    {
+        return host(id);
+    }
+};
+
+//------------------------------------------------
+
+/** A URL view with the identifier of its host
+
+    This view is constructed with a
+    @ref host_interner, which gives it the
+    identifier of its host with a single
+    hash and probe of the table. URLs with
+    the same host, ignoring case, have the
+    same identifier, so their hosts are
+    compared as integers.
+
+    Like any @ref url_view, the caller is
+    responsible for ensuring that the
+    character buffer outlives the view.
+
+    @par Example
+    @code
+    host_interner hosts;
+    host_id_view u0( url_view( "https://WWW.Example.com/a" ), hosts );
+    host_id_view u1( url_view( "http://www.example.com/b" ), hosts );
+    assert( u0.host_id() == u1.host_id() );
+    @endcode
+
+    @see
+        @ref host_interner.
+*/
+class host_id_view
+    : public url_view
+{
+    host_interner::id_type id_ =
+        host_interner::npos;
+
+public:
+    /** Constructor
+
+        Default constructed views refer to
+        an empty URL, and their identifier
+        is @ref host_interner::npos.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    host_id_view() noexcept = default;
+
+    /** Constructor
+
+        The host of `u` is interned in `t`.
+
+        @par Complexity
+        Linear in `u.encoded_host().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The URL to reference.
+        @param t The table of hosts.
+    */
+    host_id_view(
+        url_view_base const& u,
+        host_interner& t)
+        : url_view(u)
+        , id_(t.intern(u.encoded_host()))
+    {
+    }
+
+    /** Return the identifier of the host
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    host_interner::id_type
+    host_id() const noexcept
+    {
+        return id_;
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,488 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_HOST_POLICY_TABLE_HPP
+#define BOOST_URL_HOST_POLICY_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+class host_policy_table;
+#endif
+
+/** A policy of a host in a @ref host_policy_table
+
+    @see
+        @ref host_policy_table.
+*/
+struct host_policy
+{
+    /** The host
+
+        When inserted in a table, this is the
+        registered name the policy applies to,
+        such as `example.com`, which is
+        compared ignoring ASCII case and
+        percent-encoding. When returned by a
+        lookup, this is the part of the host
+        of the request which matched it.
+    */
+    core::string_view host;
+
+    /** The identifier of the policy
+    */
+    std::uint32_t id = 0;
+
+    /** True if the policy also applies to the subdomains of the host
+    */
+    bool include_subdomains = false;
+};
+
+//------------------------------------------------
+
+/** A non-owning reference to a compiled host policy table
+
+    Objects of this type refer to the binary
+    image of a compiled table, as returned by
+    @ref host_policy_table::data. Like the
+    image of a @ref public_suffix_list_view,
+    it is used in place, so it can be stored
+    in a file and mapped read-only into every
+    worker process.
+
+    @par Binary Format
+    The image has the layout of a compiled
+    public suffix list, with a different
+    signature, and 8 bytes per trie node
+    holding the flags and the identifier of
+    the policy ending there.
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref host_policy_table,
+        @ref public_suffix_list_view.
+*/
+class host_policy_table_view
+{
+public:
+    /** Constructor
+
+        Default constructed views have
+        no policies.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    host_policy_table_view() noexcept = default;
+
+    /** Constructor
+
+        This function references a compiled
+        table. Only the header of the image is
+        inspected; lookups check every index
+        they read against the sizes it gives,
+        so a damaged image can produce wrong
+        results but never reads outside of
+        `data`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `data` is not a compiled table of a
+        supported version.
+
+        @param data The binary image
+    */
+    BOOST_URL_DECL
+    explicit
+    host_policy_table_view(
+        core::string_view data);
+
+    /** Return the binary image
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    data() const noexcept;
+
+    /** Return the number of policies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return rules_;
+    }
+
+    /** Return true if there are no policies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return rules_ == 0;
+    }
+
+    /** Return the policy applying to a host
+
+        A policy applies to the host it was
+        inserted with and, if it includes
+        subdomains, to every host ending with
+        a dot followed by it. When several
+        policies apply, the one with the most
+        labels is returned. A trailing dot in
+        the host is ignored for matching and
+        kept in the result.
+
+        @par Example
+        @code
+        assert( t.find( "www.example.com" )->host == "example.com" );
+        @endcode
+
+        @par Complexity
+        Linear in `host.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The policy, whose host views
+        the end of `host`, or an empty optional.
+
+        @param host The percent-encoded
+        registered name.
+    */
+    BOOST_URL_DECL
+    boost::optional<host_policy>
+    find(
+        pct_string_view host) const noexcept;
+
+    /** Return the policy applying to the host of a URL
+
+        Only registered names have policies,
+        so an empty optional is returned for
+        URLs whose host is an IP address.
+
+        @par Complexity
+        Linear in the size of the host.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL.
+    */
+    BOOST_URL_DECL
+    boost::optional<host_policy>
+    find(
+        url_view_base const& u) const noexcept;
+
+    /** Return true if a URL must be fetched with https
+
+        @par Example
+        @code
+        assert( t.force_https( url_view( "http://www.example.com/" ) ) );
+        @endcode
+
+        @par Complexity
+        Linear in the size of the host.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL.
+    */
+    bool
+    force_https(
+        url_view_base const& u) const noexcept
+    {
+        return find(u).has_value();
+    }
+
+    /** Change the scheme of a URL to https if a policy applies
+
+        If the scheme of `u` is `http` and a
+        policy applies to its host, the scheme
+        is changed to `https`, and an explicit
+        port 80 is changed to 443.
+
+        @par Example
+        @code
+        url u( "http://www.example.com:80/a" );
+        assert( t.upgrade( u ) );
+        assert( u.buffer() == "https://www.example.com:443/a" );
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return true if `u` was changed.
+
+        @param u The URL to change.
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc6797#section-8.3"
+            >8.3. URI Loading and Port Mapping (rfc6797)</a>
+    */
+    BOOST_URL_DECL
+    bool
+    upgrade(url_base& u) const;
+
+private:
+    friend class host_policy_table;
+
+    struct no_check {};
+
+    BOOST_URL_DECL
+    host_policy_table_view(
+        core::string_view data,
+        no_check) noexcept;
+
+    char const* table_ = nullptr;
+    unsigned char const* nodes_ = nullptr;
+    char const* labels_ = nullptr;
+    std::uint32_t rules_ = 0;
+    std::uint32_t node_count_ = 0;
+    std::uint32_t table_size_ = 0;
+    std::uint32_t labels_size_ = 0;
+};
+
+//------------------------------------------------
+
+/** A compiled table of host policies
+
+    This container holds policies for hosts,
+    each applying to one registered name and
+    optionally to its subdomains, such as
+    the HTTP Strict Transport Security
+    entries of a client. It answers whether
+    a request must be upgraded to https,
+    and which policy applies to its host,
+    with one lookup per label of the host.
+
+    The hosts are stored as a trie of labels
+    read from the rightmost label, in the
+    same compiled format as the
+    @ref public_suffix_list. The compiled
+    table is kept in a single buffer, which
+    is returned by @ref data and can be
+    referenced later by a
+    @ref host_policy_table_view.
+
+    @par Example
+    @code
+    host_policy_table t{
+        { "example.com", 1, true },
+        { "login.example.org", 2 } };
+
+    url u( "http://www.example.com/" );
+    t.upgrade( u );
+    assert( u.scheme_id() == scheme::https );
+    assert( ! t.force_https( url_view( "http://www.example.org/" ) ) );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6797#section-8.2"
+        >8.2. Known HSTS Host Domain Name Matching (rfc6797)</a>
+
+    @see
+        @ref host_policy_table_view,
+        @ref public_suffix_list.
+*/
+class host_policy_table
+{
+public:
+    /** Constructor
+
+        Default constructed tables have
+        no policies.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    host_policy_table() noexcept = default;
+
+    /** Constructor
+
+        This function compiles a list of
+        policies. A trailing dot in a host is
+        ignored, and policies with an empty
+        host are skipped. When several
+        policies have the same host, the last
+        one is used.
+
+        @par Complexity
+        Linear in the total size of the hosts.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @throw system_error
+        The compiled table would exceed the
+        limits of the binary format.
+
+        @param policies The policies.
+
+        @param n The number of policies.
+    */
+    BOOST_URL_DECL
+    host_policy_table(
+        host_policy const* policies,
+        std::size_t n);
+
+    /** Constructor
+
+        @copydetails host_policy_table(host_policy const*, std::size_t)
+    */
+    host_policy_table(
+        std::initializer_list<
+            host_policy> policies)
+        : host_policy_table(
+            policies.begin(),
+            policies.size())
+    {
+    }
+
+    /** Return the binary image of the table
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return view().data();
+    }
+
+    /** Return a view of the table
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    operator
+    host_policy_table_view() const noexcept
+    {
+        return view();
+    }
+
+    /** Return the number of policies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return view().size();
+    }
+
+    /** Return true if there are no policies
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return view().empty();
+    }
+
+    /** Return the policy applying to a host
+
+        @copydetails host_policy_table_view::find(pct_string_view) const
+    */
+    boost::optional<host_policy>
+    find(
+        pct_string_view host) const noexcept
+    {
+        return view().find(host);
+    }
+
+    /** Return the policy applying to the host of a URL
+
+        @copydetails host_policy_table_view::find(url_view_base const&) const
+    */
+    boost::optional<host_policy>
+    find(
+        url_view_base const& u) const noexcept
+    {
+        return view().find(u);
+    }
+
+    /** Return true if a URL must be fetched with https
+
+        @copydetails host_policy_table_view::force_https
+    */
+    bool
+    force_https(
+        url_view_base const& u) const noexcept
+    {
+        return view().force_https(u);
+    }
+
+    /** Change the scheme of a URL to https if a policy applies
+
+        @copydetails host_policy_table_view::upgrade
+    */
+    bool
+    upgrade(url_base& u) const
+    {
+        return view().upgrade(u);
+    }
+
+private:
+    host_policy_table_view
+    view() const noexcept
+    {
+        return host_policy_table_view(
+            data_, host_policy_table_view::no_check{});
+    }
+
+    std::string data_;
+};
+
+} // urls
+} // boost
+
+#endif
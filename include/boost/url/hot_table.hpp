@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_HOT_TABLE_HPP
+#define BOOST_URL_HOT_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/epoch_domain.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+
+/** An immutable table which can be replaced while it is read
+
+    Tables such as a @ref router, a
+    @ref url_classifier, a @ref url_rule_set
+    or a @ref public_suffix_list are built
+    once from a configuration, and are then
+    only read. When the configuration
+    changes, a new table is built aside, and
+    this object publishes it by swapping a
+    pointer. Threads which read the table
+    never take a lock and never wait, even
+    while a new table is published.
+
+    A reader obtains a @ref snapshot, which
+    refers to the table current at the time
+    and keeps it alive until the snapshot is
+    destroyed. Obtaining a snapshot and
+    releasing it each take one atomic
+    operation on a counter shared with few
+    other threads, in addition to the load
+    of the pointer.
+
+    The old table is destroyed by the
+    writer once every snapshot of it was
+    released. The readers are counted by
+    epoch: @ref publish replaces the table,
+    then waits for the readers which entered
+    before the replacement, so it may block,
+    and is meant to be called from a thread
+    which builds the tables in the
+    background. Writers are serialized.
+
+    @par Example
+    @code
+    // load_routes returns a std::unique_ptr< router< int > >
+    hot_table< router< int > > routes;
+    routes.publish( load_routes( config ) );
+
+    // request threads
+    hot_table< router< int > >::snapshot s = routes.read();
+    matches m;
+    int const* v = s->find( u.encoded_segments(), m );
+
+    // the reload thread
+    routes.publish( load_routes( new_config ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+    A thread which holds a snapshot must not
+    call @ref publish on the same object.
+
+    @tparam T The type of the table, which
+    is only accessed through `T const&`
+    once published.
+*/
+template<class T>
+class hot_table
+{
+    mutable detail::epoch_domain d_;
+    std::atomic<T const*> p_;
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::mutex m_;
+#endif
+
+public:
+    class snapshot;
+
+    /** Constructor
+
+        The object holds no table.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    hot_table() noexcept
+        : p_(nullptr)
+    {
+    }
+
+    /** Constructor
+
+        The object holds the table `t`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown by the move
+        constructor of `T` propagate.
+
+        @param t The table.
+    */
+    explicit
+    hot_table(T t)
+        : p_(new T(std::move(t)))
+    {
+    }
+
+    /** Destructor
+
+        No snapshot of this object may
+        still exist.
+    */
+    ~hot_table()
+    {
+        delete p_.load(
+            std::memory_order_relaxed);
+    }
+
+    hot_table(hot_table const&) = delete;
+    hot_table& operator=(hot_table const&) = delete;
+
+    /** Return a snapshot of the current table
+
+        The snapshot refers to the table
+        which is current when this function
+        is called, or to no table if none was
+        published.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    snapshot
+    read() const noexcept;
+
+    /** Replace the table
+
+        The table `t` becomes the current
+        table. Then this function waits until
+        every snapshot of the previous table
+        is released, and destroys it.
+
+        @par Preconditions
+        The calling thread holds no snapshot
+        of this object.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by the move
+        constructor of `T` propagate.
+
+        @param t The new table.
+    */
+    void
+    publish(T t);
+
+    /** Replace the table
+
+        @par Preconditions
+        The calling thread holds no snapshot
+        of this object.
+
+        @par Exception Safety
+        Throws nothing, unless the
+        destructor of `T` throws.
+
+        @param p The new table, or null to
+        remove the table.
+    */
+    void
+    publish(std::unique_ptr<T const> p);
+};
+
+//------------------------------------------------
+
+/** A reference to a published table
+
+    The table is kept alive until the
+    snapshot is destroyed, even when a new
+    table is published meanwhile.
+
+    @see
+        @ref hot_table::read.
+*/
+template<class T>
+class hot_table<T>::snapshot
+{
+    hot_table const* t_ = nullptr;
+    T const* p_ = nullptr;
+    std::size_t token_ = 0;
+
+    friend class hot_table;
+
+    snapshot(
+        hot_table const& t) noexcept;
+
+public:
+    /** Constructor
+
+        The snapshot refers to no table.
+    */
+    snapshot() = default;
+
+    /** Constructor
+
+        The table of `other` is transferred
+        to the new snapshot, and `other`
+        refers to no table.
+    */
+    snapshot(snapshot&& other) noexcept;
+
+    /** Assignment
+
+        The table of `other` is transferred
+        to this snapshot, and `other`
+        refers to no table.
+    */
+    snapshot&
+    operator=(snapshot&& other) noexcept;
+
+    /** Destructor
+
+        The table is released.
+    */
+    ~snapshot();
+
+    /** Return the table, or null if there is none
+    */
+    T const*
+    get() const noexcept
+    {
+        return p_;
+    }
+
+    /** Return the table
+
+        @par Preconditions
+        `this->get() != nullptr`
+    */
+    T const&
+    operator*() const noexcept
+    {
+        return *p_;
+    }
+
+    /** Return the table
+
+        @par Preconditions
+        `this->get() != nullptr`
+    */
+    T const*
+    operator->() const noexcept
+    {
+        return p_;
+    }
+
+    /** Return true if the snapshot refers to a table
+    */
+    explicit
+    operator bool() const noexcept
+    {
+        return p_ != nullptr;
+    }
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/hot_table.hpp>
+
+#endif
@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_BASIC_URL_HPP
+#define BOOST_URL_IMPL_BASIC_URL_HPP
+
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+template<class Allocator>
+basic_url<Allocator>::
+~basic_url()
+{
+    if(s_)
+    {
+        BOOST_ASSERT(
+            cap_ != 0);
+        deallocate(s_, cap_);
+    }
+}
+
+template<class Allocator>
+basic_url<Allocator>::
+basic_url(
+    Allocator const& a) noexcept
+    : a_(a)
+{
+}
+
+template<class Allocator>
+basic_url<Allocator>::
+basic_url(
+    core::string_view s,
+    Allocator const& a)
+    : basic_url(parse_uri_reference(s
+        ).value(BOOST_URL_POS), a)
+{
+}
+
+template<class Allocator>
+basic_url<Allocator>::
+basic_url(basic_url&& u) noexcept
+    : url_base(u.impl_)
+    , a_(std::move(u.a_))
+{
+    s_ = u.s_;
+    cap_ = u.cap_;
+    u.s_ = nullptr;
+    u.cap_ = 0;
+    u.impl_ = {from::url};
+}
+
+template<class Allocator>
+basic_url<Allocator>::
+basic_url(basic_url const& u)
+    : basic_url(alloc_traits::
+        select_on_container_copy_construction(
+            u.a_))
+{
+    copy(u);
+}
+
+template<class Allocator>
+basic_url<Allocator>::
+basic_url(
+    url_view_base const& u,
+    Allocator const& a)
+    : basic_url(a)
+{
+    copy(u);
+}
+
+template<class Allocator>
+auto
+basic_url<Allocator>::
+operator=(basic_url&& u) ->
+    basic_url&
+{
+    if(this == &u)
+        return *this;
+    if(!(a_ == u.a_))
+    {
+        copy(u);
+        if(u.s_)
+            u.deallocate(u.s_, u.cap_);
+        u.s_ = nullptr;
+        u.cap_ = 0;
+        u.impl_ = {from::url};
+        return *this;
+    }
+    if(s_)
+        deallocate(s_, cap_);
+    impl_ = u.impl_;
+    s_ = u.s_;
+    cap_ = u.cap_;
+    u.s_ = nullptr;
+    u.cap_ = 0;
+    u.impl_ = {from::url};
+    return *this;
+}
+
+template<class Allocator>
+void
+basic_url<Allocator>::
+swap(basic_url& other) noexcept
+{
+    if (this == &other)
+        return;
+    BOOST_ASSERT(a_ == other.a_);
+    std::swap(s_, other.s_);
+    std::swap(cap_, other.cap_);
+    std::swap(impl_, other.impl_);
+    std::swap(pi_, other.pi_);
+    if (pi_ == &other.impl_)
+        pi_ = &impl_;
+    if (other.pi_ == &impl_)
+        other.pi_ = &other.impl_;
+}
+
+//------------------------------------------------
+
+template<class Allocator>
+char*
+basic_url<Allocator>::
+allocate(std::size_t n)
+{
+    auto s = alloc_traits::allocate(
+        a_, n + 1);
+    cap_ = n;
+    detail::stats_allocate(n + 1);
+    return s;
+}
+
+template<class Allocator>
+void
+basic_url<Allocator>::
+deallocate(
+    char* s,
+    std::size_t cap) noexcept
+{
+    detail::stats_deallocate();
+    alloc_traits::deallocate(
+        a_, s, cap + 1);
+}
+
+template<class Allocator>
+void
+basic_url<Allocator>::
+clear_impl() noexcept
+{
+    if(s_)
+    {
+        // preserve capacity
+        impl_ = {from::url};
+        s_[0] = '\0';
+        impl_.cs_ = s_;
+    }
+    else
+    {
+        BOOST_ASSERT(impl_.cs_[0] == 0);
+    }
+}
+
+template<class Allocator>
+void
+basic_url<Allocator>::
+reserve_impl(
+    std::size_t n,
+    op_t& op)
+{
+    if(n > max_size())
+        detail::throw_length_error();
+    if(n <= cap_)
+        return;
+    if(s_ != nullptr)
+    {
+        // 50% growth policy
+        auto const h = cap_ / 2;
+        std::size_t new_cap;
+        if(cap_ <= max_size() - h)
+            new_cap = cap_ + h;
+        else
+            new_cap = max_size();
+        if( new_cap < n)
+            new_cap = n;
+        auto const old_cap = cap_;
+        char* s = allocate(new_cap);
+        detail::stats_reallocate();
+        std::memcpy(s, s_, size() + 1);
+        BOOST_ASSERT(! op.old);
+        op.old = s_;
+        old_cap_ = old_cap;
+        s_ = s;
+    }
+    else
+    {
+        s_ = allocate(n);
+        s_[0] = '\0';
+    }
+    impl_.cs_ = s_;
+}
+
+template<class Allocator>
+void
+basic_url<Allocator>::
+cleanup(
+    op_t& op)
+{
+    if(op.old)
+        deallocate(op.old, old_cap_);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_CANONICAL_REQUEST_HPP
+#define BOOST_URL_IMPL_CANONICAL_REQUEST_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+using canonical_write_fn = void(*)(
+    void*, char const*, std::size_t);
+
+BOOST_URL_DECL
+void
+write_canonical_uri(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink);
+
+BOOST_URL_DECL
+void
+write_canonical_query(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink);
+
+BOOST_URL_DECL
+void
+write_canonical_host(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink);
+
+template<class Sink>
+void
+call_canonical_sink(
+    void* sink,
+    char const* p,
+    std::size_t n)
+{
+    (*static_cast<Sink*>(sink))(p, n);
+}
+
+} // detail
+
+template<class Sink>
+void
+write_canonical_uri(
+    url_view_base const& u,
+    Sink&& sink)
+{
+    using S = typename
+        std::remove_reference<Sink>::type;
+    detail::write_canonical_uri(u,
+        &detail::call_canonical_sink<S>,
+        const_cast<void*>(static_cast<
+            void const*>(&sink)));
+}
+
+template<class Sink>
+void
+write_canonical_query(
+    url_view_base const& u,
+    Sink&& sink)
+{
+    using S = typename
+        std::remove_reference<Sink>::type;
+    detail::write_canonical_query(u,
+        &detail::call_canonical_sink<S>,
+        const_cast<void*>(static_cast<
+            void const*>(&sink)));
+}
+
+template<class Sink>
+void
+write_canonical_host(
+    url_view_base const& u,
+    Sink&& sink)
+{
+    using S = typename
+        std::remove_reference<Sink>::type;
+    detail::write_canonical_host(u,
+        &detail::call_canonical_sink<S>,
+        const_cast<void*>(static_cast<
+            void const*>(&sink)));
+}
+
+} // urls
+} // boost
+
+#endif
@@ -10,6 +10,7 @@
 #ifndef BOOST_URL_IMPL_PCT_ENCODED_VIEW_HPP
 #define BOOST_URL_IMPL_PCT_ENCODED_VIEW_HPP
 
+#include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/type_traits.hpp>
 #include <boost/static_assert.hpp>
 
@@ -62,9 +63,22 @@ public:
     iterator&
     operator=(iterator const&) = default;
 
-    BOOST_URL_DECL
     reference
-    operator*() const noexcept;
+    operator*() const noexcept
+    {
+        if (space_as_plus_ &&
+            *pos_ == '+')
+            return ' ';
+        if (*pos_ != '%')
+            return *pos_;
+        auto d0 = grammar::hexdig_value(pos_[1]);
+        auto d1 = grammar::hexdig_value(pos_[2]);
+        return static_cast<char>(
+            ((static_cast<
+                  unsigned char>(d0) << 4) +
+             (static_cast<
+                 unsigned char>(d1))));
+    }
 
     iterator&
     operator++() noexcept
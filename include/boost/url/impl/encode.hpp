@@ -18,81 +18,67 @@
 #include <boost/url/grammar/type_traits.hpp>
 #include <boost/assert.hpp>
 #include <boost/static_assert.hpp>
+#include <cstring>
 
 namespace boost {
 namespace urls {
 
-//------------------------------------------------
+namespace detail {
 
-template<class CharSet>
+// The algorithms take the options as a
+// template parameter, which is either
+// encoding_opts or static_encoding_opts.
+// With the latter, the options are
+// constants and their branches vanish.
+
+template<
+    class CharSet,
+    class Opts>
 std::size_t
-encoded_size(
+encoded_size_impl(
     core::string_view s,
     CharSet const& unreserved,
-    encoding_opts opt) noexcept
+    Opts const& opt) noexcept
 {
-/*  If you get a compile error here, it
-    means that the value you passed does
-    not meet the requirements stated in
-    the documentation.
-*/
-    static_assert(
-        grammar::is_charset<CharSet>::value,
-        "Type requirements not met");
+    // space is only encoded as a plus
+    // when it is not unreserved.
+    bool const plus =
+        opt.space_as_plus &&
+        ! unreserved(' ');
 
     std::size_t n = 0;
     auto it = s.data();
     auto const last = it + s.size();
-
-    if(! opt.space_as_plus ||
-        unreserved(' '))
-    {
-        while(it != last)
-        {
-            if(unreserved(*it))
-                n += 1;
-            else
-                n += 3;
-            ++it;
-        }
-    }
-    else
+    while(it != last)
     {
-        while(it != last)
-        {
-            auto c = *it;
-            if(unreserved(c))
-                ++n;
-            else if(c == ' ')
-                ++n;
-            else
-                n += 3;
-            ++it;
-        }
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, last, unreserved);
+        n += p - it;
+        it = p;
+        if(it == last)
+            break;
+        if( plus &&
+            *it == ' ')
+            n += 1;
+        else
+            n += 3;
+        ++it;
     }
     return n;
 }
 
-//------------------------------------------------
-
-template<class CharSet>
+template<
+    class CharSet,
+    class Opts>
 std::size_t
-encode(
+encode_impl(
     char* dest,
     std::size_t size,
     core::string_view s,
     CharSet const& unreserved,
-    encoding_opts opt)
+    Opts const& opt)
 {
-/*  If you get a compile error here, it
-    means that the value you passed does
-    not meet the requirements stated in
-    the documentation.
-*/
-    static_assert(
-        grammar::is_charset<CharSet>::value,
-        "Type requirements not met");
-
     // '%' must be reserved
     BOOST_ASSERT(! unreserved('%'));
 
@@ -113,70 +99,62 @@ encode(
     auto const dest0 = dest;
     auto const end3 = end - 3;
 
-    if(! opt.space_as_plus)
+    // space is only encoded as a plus
+    // when it is not unreserved.
+    bool const plus =
+        opt.space_as_plus &&
+        ! unreserved(' ');
+
+    while(it != last)
     {
-        while(it != last)
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, last, unreserved);
+        std::size_t n = p - it;
+        if(n > static_cast<std::size_t>(
+            end - dest))
         {
-            if(unreserved(*it))
-            {
-                if(dest == end)
-                    return dest - dest0;
-                *dest++ = *it++;
-                continue;
-            }
-            if(dest > end3)
-                return dest - dest0;
-            encode(dest, *it++);
+            // dest too small
+            n = end - dest;
+            if(n > 0)
+                std::memcpy(dest, it, n);
+            return (dest + n) - dest0;
         }
-        return dest - dest0;
-    }
-    else if(! unreserved(' '))
-    {
-        // VFALCO space is usually reserved,
-        // and we depend on this for an
-        // optimization. if this assert
-        // goes off we can split the loop
-        // below into two versions.
-        BOOST_ASSERT(! unreserved(' '));
-
-        while(it != last)
+        if(n > 0)
+            std::memcpy(dest, it, n);
+        dest += n;
+        it = p;
+        if(it == last)
+            break;
+        if( plus &&
+            *it == ' ')
         {
-            if(unreserved(*it))
-            {
-                if(dest == end)
-                    return dest - dest0;
-                *dest++ = *it++;
-                continue;
-            }
-            if(*it == ' ')
-            {
-                if(dest == end)
-                    return dest - dest0;
-                *dest++ = '+';
-                ++it;
-                continue;
-            }
-            if(dest > end3)
+            if(dest == end)
                 return dest - dest0;
-            encode(dest, *it++);
+            *dest++ = '+';
+            ++it;
+            continue;
         }
+        if(dest > end3)
+            return dest - dest0;
+        encode(dest, *it++);
     }
     return dest - dest0;
 }
 
-//------------------------------------------------
-
 // unsafe encode just
 // asserts on the output buffer
 //
-template<class CharSet>
+template<
+    class CharSet,
+    class Opts>
 std::size_t
-encode_unsafe(
+encode_unsafe_impl(
     char* dest,
     std::size_t size,
     core::string_view s,
     CharSet const& unreserved,
-    encoding_opts opt)
+    Opts const& opt)
 {
     // '%' must be reserved
     BOOST_ASSERT(! unreserved('%'));
@@ -200,48 +178,146 @@ encode_unsafe(
         *dest++ = hex[c&0xf];
     };
 
+    // space is only encoded as a plus
+    // when it is not unreserved.
+    bool const plus =
+        opt.space_as_plus &&
+        ! unreserved(' ');
+
     auto const dest0 = dest;
-    if(! opt.space_as_plus)
+    while(it != last)
     {
-        while(it != last)
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, last, unreserved);
+        std::size_t const n = p - it;
+        BOOST_ASSERT(
+            n <= static_cast<std::size_t>(
+                end - dest));
+        if(n > 0)
+            std::memcpy(dest, it, n);
+        dest += n;
+        it = p;
+        if(it == last)
+            break;
+        BOOST_ASSERT(dest != end);
+        if( plus &&
+            *it == ' ')
         {
-            BOOST_ASSERT(dest != end);
-            if(unreserved(*it))
-                *dest++ = *it++;
-            else
-                encode(dest, *it++);
+            *dest++ = '+';
+            ++it;
         }
-    }
-    else
-    {
-        // VFALCO space is usually reserved,
-        // and we depend on this for an
-        // optimization. if this assert
-        // goes off we can split the loop
-        // below into two versions.
-        BOOST_ASSERT(! unreserved(' '));
-
-        while(it != last)
+        else
         {
-            BOOST_ASSERT(dest != end);
-            if(unreserved(*it))
-            {
-                *dest++ = *it++;
-            }
-            else if(*it == ' ')
-            {
-                *dest++ = '+';
-                ++it;
-            }
-            else
-            {
-                encode(dest, *it++);
-            }
+            encode(dest, *it++);
         }
     }
     return dest - dest0;
 }
 
+} // detail
+
+//------------------------------------------------
+
+template<class CharSet>
+std::size_t
+encoded_size(
+    core::string_view s,
+    CharSet const& unreserved,
+    encoding_opts opt) noexcept
+{
+/*  If you get a compile error here, it
+    means that the value you passed does
+    not meet the requirements stated in
+    the documentation.
+*/
+    static_assert(
+        grammar::is_charset<CharSet>::value,
+        "Type requirements not met");
+
+    return detail::encoded_size_impl(
+        s, unreserved, opt);
+}
+
+template<
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+std::size_t
+encoded_size(
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt) noexcept
+{
+    static_assert(
+        grammar::is_charset<CharSet>::value,
+        "Type requirements not met");
+
+    return detail::encoded_size_impl(
+        s, unreserved, opt);
+}
+
+//------------------------------------------------
+
+template<class CharSet>
+std::size_t
+encode(
+    char* dest,
+    std::size_t size,
+    core::string_view s,
+    CharSet const& unreserved,
+    encoding_opts opt)
+{
+/*  If you get a compile error here, it
+    means that the value you passed does
+    not meet the requirements stated in
+    the documentation.
+*/
+    static_assert(
+        grammar::is_charset<CharSet>::value,
+        "Type requirements not met");
+
+    return detail::encode_impl(
+        dest, size, s, unreserved, opt);
+}
+
+template<
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+std::size_t
+encode(
+    char* dest,
+    std::size_t size,
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt)
+{
+    static_assert(
+        grammar::is_charset<CharSet>::value,
+        "Type requirements not met");
+
+    return detail::encode_impl(
+        dest, size, s, unreserved, opt);
+}
+
+//------------------------------------------------
+
+template<class CharSet>
+std::size_t
+encode_unsafe(
+    char* dest,
+    std::size_t size,
+    core::string_view s,
+    CharSet const& unreserved,
+    encoding_opts opt)
+{
+    return detail::encode_unsafe_impl(
+        dest, size, s, unreserved, opt);
+}
+
 //------------------------------------------------
 
 template<
@@ -263,11 +339,37 @@ encode(
         grammar::is_charset<CharSet>::value,
         "Type requirements not met");
 
-    auto const n = encoded_size(
+    auto const n = detail::encoded_size_impl(
+        s, unreserved, opt);
+    auto p = token.prepare(n);
+    if(n > 0)
+        detail::encode_unsafe_impl(
+            p, n, s, unreserved, opt);
+    return token.result();
+}
+
+template<
+    class StringToken,
+    class CharSet,
+    bool SpaceAsPlus,
+    bool LowerCase>
+BOOST_URL_STRTOK_RETURN
+encode(
+    core::string_view s,
+    CharSet const& unreserved,
+    static_encoding_opts<
+        SpaceAsPlus, LowerCase> opt,
+    StringToken&& token) noexcept
+{
+    static_assert(
+        grammar::is_charset<CharSet>::value,
+        "Type requirements not met");
+
+    auto const n = detail::encoded_size_impl(
         s, unreserved, opt);
     auto p = token.prepare(n);
     if(n > 0)
-        encode_unsafe(
+        detail::encode_unsafe_impl(
             p, n, s, unreserved, opt);
     return token.result();
 }
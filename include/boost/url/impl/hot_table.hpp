@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_HOT_TABLE_HPP
+#define BOOST_URL_IMPL_HOT_TABLE_HPP
+
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+template<class T>
+hot_table<T>::
+snapshot::
+snapshot(
+    hot_table const& t) noexcept
+    : t_(&t)
+    , token_(t.d_.enter())
+{
+    // entering is ordered before this
+    // load, see detail::epoch_domain
+    p_ = t.p_.load();
+}
+
+template<class T>
+hot_table<T>::
+snapshot::
+snapshot(snapshot&& other) noexcept
+    : t_(other.t_)
+    , p_(other.p_)
+    , token_(other.token_)
+{
+    other.t_ = nullptr;
+    other.p_ = nullptr;
+}
+
+template<class T>
+auto
+hot_table<T>::
+snapshot::
+operator=(snapshot&& other) noexcept ->
+    snapshot&
+{
+    if(this != &other)
+    {
+        if(t_)
+            t_->d_.leave(token_);
+        t_ = other.t_;
+        p_ = other.p_;
+        token_ = other.token_;
+        other.t_ = nullptr;
+        other.p_ = nullptr;
+    }
+    return *this;
+}
+
+template<class T>
+hot_table<T>::
+snapshot::
+~snapshot()
+{
+    if(t_)
+        t_->d_.leave(token_);
+}
+
+//------------------------------------------------
+
+template<class T>
+auto
+hot_table<T>::
+read() const noexcept ->
+    snapshot
+{
+    return snapshot(*this);
+}
+
+template<class T>
+void
+hot_table<T>::
+publish(T t)
+{
+    publish(std::unique_ptr<T const>(
+        new T(std::move(t))));
+}
+
+template<class T>
+void
+hot_table<T>::
+publish(std::unique_ptr<T const> p)
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::lock_guard<std::mutex> lock(m_);
+#endif
+    std::unique_ptr<T const> old(
+        p_.exchange(p.release()));
+    d_.synchronize();
+}
+
+} // urls
+} // boost
+
+#endif
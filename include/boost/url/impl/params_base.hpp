@@ -25,6 +25,7 @@ class BOOST_URL_DECL params_base::iterator
     bool space_as_plus_ = true;
 
     friend class params_base;
+    friend class params_index;
     friend class params_ref;
 
     iterator(
@@ -180,6 +180,19 @@ find_last(
         it.it_, key, ic);
 }
 
+inline
+param_values_view
+params_encoded_base::
+values(
+    pct_string_view key,
+    ignore_case_param ic) const noexcept
+{
+    return { find_impl(
+        begin().it_, key, ic),
+        key, {}, false,
+        static_cast<bool>(ic), nullptr };
+}
+
 } // urls
 } // boost
 
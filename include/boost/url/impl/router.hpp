@@ -7,6 +7,9 @@
 // Official repository: https://github.com/boostorg/url
 //
 
+#ifndef BOOST_URL_IMPL_ROUTER_HPP
+#define BOOST_URL_IMPL_ROUTER_HPP
+
 #include <boost/url/detail/except.hpp>
 #include <boost/url/decode_view.hpp>
 #include <boost/url/grammar/unsigned_rule.hpp>
@@ -71,5 +74,62 @@ find(segments_encoded_view path, matches_base& m) const noexcept
     return nullptr;
 }
 
+template <class T>
+template <std::size_t N>
+std::size_t
+router<T>::
+find_many(
+    segments_encoded_view const* paths,
+    std::size_t n,
+    T const** results,
+    matches_storage<N>* m) const noexcept
+{
+    std::size_t found = 0;
+    while (n != 0)
+    {
+        std::size_t k = n;
+        if (k > batch_size)
+            k = batch_size;
+        core::string_view* matches_its[batch_size];
+        core::string_view* ids_its[batch_size];
+        any_resource const* ps[batch_size];
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            // the mutable storage is only
+            // reachable through the base
+            matches_base& mb = m[i];
+            matches_its[i] = mb.matches();
+            ids_its[i] = mb.ids();
+        }
+        find_many_impl(
+            paths, k, ps, matches_its, ids_its);
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            matches_base& mb = m[i];
+            if (ps[i])
+            {
+                BOOST_ASSERT(matches_its[i] >= mb.matches());
+                mb.resize(static_cast<std::size_t>(
+                    matches_its[i] - mb.matches()));
+                results[i] = reinterpret_cast<
+                    T const*>(ps[i]->get());
+                ++found;
+            }
+            else
+            {
+                mb.resize(0);
+                results[i] = nullptr;
+            }
+        }
+        paths += k;
+        results += k;
+        m += k;
+        n -= k;
+    }
+    return found;
+}
+
 } // urls
 } // boost
+
+#endif
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_SORT_URLS_HPP
+#define BOOST_URL_IMPL_SORT_URLS_HPP
+
+#include <boost/url/grammar/string_token.hpp>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+template<class RandomIt>
+void
+sort_urls(
+    RandomIt first,
+    RandomIt last,
+    std::size_t threads)
+{
+    using value_type = typename
+        std::iterator_traits<RandomIt>::value_type;
+    std::size_t const n = static_cast<
+        std::size_t>(last - first);
+    if(n < 2)
+        return;
+
+    // Each key is followed by the position
+    // of its URL, big endian, so that equal
+    // URLs keep their order and the sorted
+    // keys give the permutation
+    std::string buf;
+    std::vector<std::size_t> ends;
+    ends.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        url_view_base const& u = first[i];
+        u.sort_key(string_token::append_to(buf));
+        for(std::size_t k = sizeof(i); k-- > 0;)
+            buf.push_back(static_cast<char>(
+                (i >> (8 * k)) & 0xff));
+        ends.push_back(buf.size());
+    }
+    std::vector<core::string_view> keys;
+    keys.reserve(n);
+    std::size_t pos = 0;
+    for(auto const end : ends)
+    {
+        keys.emplace_back(
+            buf.data() + pos, end - pos);
+        pos = end;
+    }
+    radix_sort_keys(
+        keys.data(), keys.data() + n, threads);
+
+    std::vector<value_type> v;
+    v.reserve(n);
+    for(auto const& key : keys)
+    {
+        std::size_t i = 0;
+        char const* p = key.data() +
+            key.size() - sizeof(i);
+        for(std::size_t k = 0; k < sizeof(i); ++k)
+            i = (i << 8) | static_cast<
+                unsigned char>(p[k]);
+        v.push_back(std::move(first[i]));
+    }
+    std::move(v.begin(), v.end(), first);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_MAP_HPP
+#define BOOST_URL_IMPL_URL_MAP_HPP
+
+#include <iterator>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+template<class T>
+template<class V>
+class url_map<T>::basic_iterator
+{
+    using map_type = typename std::conditional<
+        std::is_const<V>::value,
+        url_map const, url_map>::type;
+
+    map_type* m_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class url_map;
+
+    template<class>
+    friend class basic_iterator;
+
+    basic_iterator(
+        map_type& m,
+        std::size_t i) noexcept
+        : m_(&m)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = std::pair<url_view, T>;
+    using reference = std::pair<url_view, V&>;
+    using pointer = reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    basic_iterator() = default;
+    basic_iterator(basic_iterator const&) = default;
+    basic_iterator& operator=(
+        basic_iterator const&) noexcept = default;
+
+    template<
+        class V_ = V,
+        class = typename std::enable_if<
+            std::is_const<V_>::value>::type>
+    basic_iterator(
+        basic_iterator<T> const& other) noexcept
+        : m_(other.m_)
+        , i_(other.i_)
+    {
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return { m_->t_.get(i_), m_->v_[i_] };
+    }
+
+    // the return value is too expensive
+    pointer operator->() const = delete;
+
+    basic_iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    basic_iterator&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    basic_iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    basic_iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        basic_iterator const& other) const noexcept
+    {
+        return i_ == other.i_;
+    }
+
+    bool
+    operator!=(
+        basic_iterator const& other) const noexcept
+    {
+        return i_ != other.i_;
+    }
+};
+
+//------------------------------------------------
+
+template<class T>
+auto
+url_map<T>::
+begin() noexcept ->
+    iterator
+{
+    return { *this, 0 };
+}
+
+template<class T>
+auto
+url_map<T>::
+begin() const noexcept ->
+    const_iterator
+{
+    return { *this, 0 };
+}
+
+template<class T>
+auto
+url_map<T>::
+end() noexcept ->
+    iterator
+{
+    return { *this, v_.size() };
+}
+
+template<class T>
+auto
+url_map<T>::
+end() const noexcept ->
+    const_iterator
+{
+    return { *this, v_.size() };
+}
+
+template<class T>
+void
+url_map<T>::
+reserve(
+    std::size_t n,
+    std::size_t chars)
+{
+    t_.reserve(n, chars);
+    v_.reserve(n);
+}
+
+template<class T>
+template<class... Args>
+auto
+url_map<T>::
+emplace(
+    url_view_base const& u,
+    Args&&... args) ->
+        std::pair<iterator, bool>
+{
+    auto const fp = u.fingerprint();
+    auto i = t_.find(u, fp);
+    if(i != detail::url_table::npos)
+        return { { *this, i }, false };
+    // after this, inserting
+    // the key cannot throw
+    t_.reserve(
+        t_.size() + 1,
+        t_.arena_size() + u.size());
+    v_.emplace_back(
+        std::forward<Args>(args)...);
+    i = t_.insert(u, fp);
+    return { { *this, i }, true };
+}
+
+template<class T>
+T&
+url_map<T>::
+operator[](url_view_base const& u)
+{
+    return v_[emplace(u).first.i_];
+}
+
+template<class T>
+auto
+url_map<T>::
+find(url_view_base const& u) noexcept ->
+    iterator
+{
+    auto const i = t_.find(u, u.fingerprint());
+    if(i == detail::url_table::npos)
+        return end();
+    return { *this, i };
+}
+
+template<class T>
+auto
+url_map<T>::
+find(url_view_base const& u) const noexcept ->
+    const_iterator
+{
+    auto const i = t_.find(u, u.fingerprint());
+    if(i == detail::url_table::npos)
+        return end();
+    return { *this, i };
+}
+
+} // urls
+} // boost
+
+#endif
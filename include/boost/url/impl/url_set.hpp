@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_SET_HPP
+#define BOOST_URL_IMPL_URL_SET_HPP
+
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+class url_set::iterator
+{
+    detail::url_table const* t_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class url_set;
+
+    iterator(
+        detail::url_table const& t,
+        std::size_t i) noexcept
+        : t_(&t)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = url_set::value_type;
+    using reference = url_set::reference;
+    using pointer = reference;
+    using difference_type =
+        url_set::difference_type;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    iterator() = default;
+    iterator(iterator const&) = default;
+    iterator& operator=(
+        iterator const&) noexcept = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return t_->get(i_);
+    }
+
+    // the return value is too expensive
+    pointer operator->() const = delete;
+
+    iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return i_ == other.i_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return i_ != other.i_;
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+url_set::
+begin() const noexcept ->
+    iterator
+{
+    return { t_, 0 };
+}
+
+inline
+auto
+url_set::
+end() const noexcept ->
+    iterator
+{
+    return { t_, t_.size() };
+}
+
+inline
+auto
+url_set::
+insert(url_view_base const& u) ->
+    std::pair<iterator, bool>
+{
+    auto const fp = u.fingerprint();
+    auto i = t_.find(u, fp);
+    if(i != detail::url_table::npos)
+        return { { t_, i }, false };
+    t_.reserve(
+        t_.size() + 1,
+        t_.arena_size() + u.size());
+    i = t_.insert(u, fp);
+    return { { t_, i }, true };
+}
+
+inline
+auto
+url_set::
+find(url_view_base const& u) const noexcept ->
+    iterator
+{
+    auto const i = t_.find(u, u.fingerprint());
+    if(i == detail::url_table::npos)
+        return end();
+    return { t_, i };
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_VIEW_HPP
+#define BOOST_URL_IMPL_URL_VIEW_HPP
+
+#include <boost/url/detail/over_allocator.hpp>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+struct url_view_base::shared_impl
+    : url_view
+{
+    virtual
+    ~shared_impl()
+    {
+    }
+
+    // copy the impl of u, referencing the
+    // characters stored after this object
+    explicit
+    shared_impl(
+        url_view_base const& u) noexcept
+    {
+        impl_ = *u.pi_;
+        impl_.cs_ = reinterpret_cast<
+            char const*>(this + 1);
+        impl_.from_ =
+            detail::url_impl::from::string;
+        pi_ = &impl_;
+    }
+};
+
+template<class Allocator>
+std::shared_ptr<url_view const>
+url_view_base::
+persist(Allocator const& a) const
+{
+    using T = shared_impl;
+    auto p = std::allocate_shared<T>(
+        detail::over_allocator<T, Allocator>(
+            size(), a), *this);
+    std::memcpy(
+        reinterpret_cast<char*>(
+            p.get() + 1), data(), size());
+    return p;
+}
+
+//------------------------------------------------
+
+namespace detail {
+
+// The views are placed after the
+// arena, followed by the characters
+struct alignas(url_view) persist_arena
+{
+    std::size_t n = 0;
+
+    ~persist_arena()
+    {
+        auto v = views();
+        while(n > 0)
+            v[--n].~url_view();
+    }
+
+    url_view*
+    views() noexcept
+    {
+        return reinterpret_cast<
+            url_view*>(this + 1);
+    }
+
+    // construct the next view as a
+    // copy of u, stored at dest
+    void
+    push(
+        url_view_base const& u,
+        char* dest) noexcept
+    {
+        std::memcpy(dest,
+            u.data(), u.size());
+        url_view* v = ::new(
+            &views()[n]) url_view;
+        url_view_base& vb = *v;
+        vb.impl_ = *u.pi_;
+        vb.impl_.cs_ = dest;
+        vb.impl_.from_ =
+            url_impl::from::string;
+        ++n;
+    }
+};
+
+} // detail
+
+template<
+    class FwdIt,
+    class OutputIt,
+    class Allocator>
+OutputIt
+persist_all(
+    FwdIt first,
+    FwdIt last,
+    OutputIt out,
+    Allocator const& a)
+{
+    using T = detail::persist_arena;
+    std::size_t n = 0;
+    std::size_t size = 0;
+    for(auto it = first; it != last; ++it)
+    {
+        url_view_base const& u = *it;
+        ++n;
+        size += u.size();
+    }
+    if(n == 0)
+        return out;
+    auto p = std::allocate_shared<T>(
+        detail::over_allocator<T, Allocator>(
+            n * sizeof(url_view) + size, a));
+    char* dest = reinterpret_cast<char*>(
+        p->views() + n);
+    for(auto it = first; it != last; ++it)
+    {
+        url_view_base const& u = *it;
+        p->push(u, dest);
+        dest += u.size();
+    }
+    url_view* v = p->views();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        *out = std::shared_ptr<
+            url_view const>(p, &v[i]);
+        ++out;
+    }
+    return out;
+}
+
+} // urls
+} // boost
+
+#endif
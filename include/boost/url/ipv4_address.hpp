@@ -302,6 +302,15 @@ public:
 private:
     friend class ipv6_address;
 
+    friend
+    core::string_view
+    write_ipv4_addresses(
+        ipv4_address const*,
+        std::size_t,
+        char*,
+        std::size_t,
+        char);
+
     BOOST_URL_DECL
     std::size_t
     print_impl(
@@ -338,6 +347,50 @@ system::result<ipv4_address>
 parse_ipv4_address(
     core::string_view s) noexcept;
 
+/** Write the dotted decimal strings of addresses to a buffer
+
+    Each address is followed by `delim`. The
+    resulting buffer is not null-terminated.
+
+    @par Example
+    @code
+    std::vector< ipv4_address > v = ...;
+    std::string s( v.size() * ( ipv4_address::max_str_len + 1 ), '\0' );
+    s.resize( write_ipv4_addresses( v.data(), v.size(), &s[0], s.size() ).size() );
+    @endcode
+
+    @par Complexity
+    Linear in `n`.
+
+    @par Exception Safety
+    Exceptions thrown on invalid input.
+
+    @throw system_error
+    `dest_size < n * (ipv4_address::max_str_len + 1)`
+
+    @return The formatted strings.
+
+    @param addrs A pointer to the first address.
+
+    @param n The number of addresses.
+
+    @param dest The buffer in which to write,
+    which must have at least `dest_size` space.
+
+    @param dest_size The size of the output buffer.
+
+    @param delim The character written after
+    each address.
+*/
+BOOST_URL_DECL
+core::string_view
+write_ipv4_addresses(
+    ipv4_address const* addrs,
+    std::size_t n,
+    char* dest,
+    std::size_t dest_size,
+    char delim = '\n');
+
 } // urls
 } // boost
 
@@ -182,6 +182,11 @@ public:
 
         The returned string does not
         contain surrounding square brackets.
+        It is in the canonical form of rfc5952:
+        hex digits are lowercase, leading zeros
+        are omitted, and "::" replaces the
+        first longest run of two or more zero
+        groups.
 
         When called with no arguments, the
         return type is `std::string`.
@@ -218,6 +223,8 @@ public:
         @par Specification
         @li <a href="https://datatracker.ietf.org/doc/html/rfc4291#section-2.2">
             2.2. Text Representation of Addresses (rfc4291)</a>
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc5952#section-4">
+            4. A Recommendation for IPv6 Text Representation (rfc5952)</a>
     */
     template<BOOST_URL_STRTOK_TPARAM>
     BOOST_URL_STRTOK_RETURN
@@ -231,6 +238,8 @@ public:
     /** Write a dotted decimal string representing the address to a buffer
 
         The resulting buffer is not null-terminated.
+        The address is written in the same form
+        as @ref to_string, without allocating.
 
         @throw std::length_error `dest_size < ipv6_address::max_str_len`
 
@@ -0,0 +1,530 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_MAGNET_LINK_VIEW_HPP
+#define BOOST_URL_MAGNET_LINK_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+/** A non-owning reference to a valid magnet link
+
+    Magnet links identify the content of a
+    file by its hash, in the query of a URI
+    with the scheme "magnet". This view
+    references the fields of the link which
+    are relevant to the scheme:
+
+    @li The exact topics, with the keys "xt"
+        or "xt.1", "xt.2", and so on, which
+        are URNs with the hash of the content,
+
+    @li The display name, with the key "dn",
+
+    @li The address trackers, with the key "tr",
+
+    @li The web seeds, with the key "ws".
+
+    The query is scanned once, when the link
+    is parsed, and the view records where the
+    first param of each field is and how many
+    params the field has. The fields are
+    ranges which start at their first param,
+    without rescanning the params before it.
+    Keys are compared after decoding escapes,
+    and values are returned percent-encoded.
+    Nothing is allocated.
+
+    Objects of this type are obtained from
+    @ref parse_magnet_link, and reference the
+    characters of the string which was parsed,
+    which must remain valid while the view is
+    used.
+
+    @par Example
+    @code
+    magnet_link_view m = parse_magnet_link(
+        "magnet:?xt=urn:btih:d2474e86c95b19b8bcfdb92bc12c9d44667cfa36"
+        "&dn=Leaves+of+Grass"
+        "&tr=udp%3A%2F%2Ftracker.example.com%3A80" ).value();
+
+    assert( m.exact_topics().size() == 1 );
+    assert( m.display_name() == "Leaves+of+Grass" );
+    for( auto p : m.address_trackers() )
+        assert( p.value.decode() == "udp://tracker.example.com:80" );
+    @endcode
+
+    @par Specification
+    @li <a href="https://www.bittorrent.org/beps/bep_0009.html"
+        >Extension for Peers to Send Metadata Files</a>
+    @li <a href="https://www.bittorrent.org/beps/bep_0053.html"
+        >Magnet URI extension</a>
+
+    @see
+        @ref parse_magnet_link.
+*/
+class magnet_link_view
+{
+    enum class field
+    {
+        xt,
+        dn,
+        tr,
+        ws
+    };
+
+    // where the params of a field start,
+    // from the start of the query
+    struct field_pos
+    {
+        std::size_t pos = 0;
+        std::size_t n = 0;
+    };
+
+    url_view u_;
+    field_pos xt_;
+    field_pos dn_;
+    field_pos tr_;
+    field_pos ws_;
+
+    friend
+    BOOST_URL_DECL
+    system::result<magnet_link_view>
+    parse_magnet_link(
+        core::string_view s) noexcept;
+
+public:
+    class params_type;
+
+    /** Constructor
+
+        Default constructed views reference
+        no link, and all of their fields
+        are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    magnet_link_view() noexcept = default;
+
+    /** Return the link as a URL view
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view const&
+    as_url_view() const noexcept
+    {
+        return u_;
+    }
+
+    /** Return the link
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return u_.buffer();
+    }
+
+    /** Return the exact topics
+
+        A valid link has at least one exact
+        topic. Each one is a URN with the
+        protocol and the hash of the content.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_type
+    exact_topics() const noexcept;
+
+    /** Return true if the link has a display name
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_display_name() const noexcept
+    {
+        return dn_.n != 0;
+    }
+
+    /** Return the display name
+
+        This returns the value of the first
+        param with the key "dn", or an empty
+        string if there is none. The name is
+        only shown to users.
+
+        @par Complexity
+        Linear in the size of the name.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    pct_string_view
+    display_name() const noexcept;
+
+    /** Return the address trackers
+
+        Trackers are percent-encoded URLs used
+        to find peers for the content.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_type
+    address_trackers() const noexcept;
+
+    /** Return the web seeds
+
+        Web seeds are percent-encoded URLs
+        which serve the content over HTTP.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_type
+    web_seeds() const noexcept;
+
+private:
+    params_type
+    params(
+        field f,
+        field_pos const& fp) const noexcept;
+};
+
+//------------------------------------------------
+
+/** A forward range of the params of a magnet link field
+
+    The elements reference the characters
+    of the link.
+*/
+class magnet_link_view::params_type
+{
+    friend class magnet_link_view;
+
+    char const* first_ = nullptr;
+    char const* end_ = nullptr;
+    std::size_t n_ = 0;
+    field f_ = field::xt;
+
+    params_type(
+        char const* first,
+        char const* end,
+        std::size_t n,
+        field f) noexcept
+        : first_(first)
+        , end_(end)
+        , n_(n)
+        , f_(f)
+    {
+    }
+
+public:
+    class iterator;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /// The value type
+    using value_type = param_pct_view;
+
+    /// The reference type
+    using reference = param_pct_view;
+
+    /// @copydoc reference
+    using const_reference = param_pct_view;
+
+    /// An unsigned integer type
+    using size_type = std::size_t;
+
+    /** Constructor
+
+        Default constructed ranges are empty.
+    */
+    params_type() noexcept = default;
+
+    /** Return the number of params
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return true if there are no params
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return an iterator to the first param
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+};
+
+//------------------------------------------------
+
+/** A forward iterator to the params of a magnet link field
+*/
+class magnet_link_view::params_type::iterator
+{
+    friend class params_type;
+
+    // the param at p_ ends at next_
+    char const* p_ = nullptr;
+    char const* next_ = nullptr;
+    char const* end_ = nullptr;
+    field f_ = field::xt;
+
+    iterator(
+        char const* p,
+        char const* end,
+        field f) noexcept
+        : p_(p)
+        , next_(p)
+        , end_(end)
+        , f_(f)
+    {
+        if(p_)
+            next_ = find_next();
+    }
+
+    // Return the end of the param at p_
+    BOOST_URL_DECL
+    char const*
+    find_next() const noexcept;
+
+    // Move to the next param of the
+    // field, or set p_ to null
+    BOOST_URL_DECL
+    void
+    increment() noexcept;
+
+public:
+    using value_type = param_pct_view;
+    using reference = param_pct_view;
+    using pointer = param_pct_view;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    /** Constructor
+
+        Default constructed iterators
+        are equal to the end iterator
+        of any range.
+    */
+    iterator() noexcept = default;
+
+    BOOST_URL_DECL
+    reference
+    operator*() const noexcept;
+
+    pointer
+    operator->() const noexcept
+    {
+        return **this;
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(p_);
+        increment();
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return p_ == other.p_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return p_ != other.p_;
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+magnet_link_view::
+params_type::
+begin() const noexcept ->
+    iterator
+{
+    if(n_ == 0)
+        return iterator();
+    return iterator(first_, end_, f_);
+}
+
+inline
+auto
+magnet_link_view::
+params_type::
+end() const noexcept ->
+    iterator
+{
+    return iterator();
+}
+
+inline
+auto
+magnet_link_view::
+params(
+    field f,
+    field_pos const& fp) const noexcept ->
+        params_type
+{
+    if(fp.n == 0)
+        return {};
+    core::string_view q =
+        u_.encoded_query();
+    return params_type(
+        q.data() + fp.pos,
+        q.data() + q.size(),
+        fp.n,
+        f);
+}
+
+inline
+auto
+magnet_link_view::
+exact_topics() const noexcept ->
+    params_type
+{
+    return params(field::xt, xt_);
+}
+
+inline
+auto
+magnet_link_view::
+address_trackers() const noexcept ->
+    params_type
+{
+    return params(field::tr, tr_);
+}
+
+inline
+auto
+magnet_link_view::
+web_seeds() const noexcept ->
+    params_type
+{
+    return params(field::ws, ws_);
+}
+
+//------------------------------------------------
+
+/** Return a magnet link parsed from a string
+
+    The string must be an absolute URI with
+    the scheme "magnet" and at least one
+    exact topic, and every exact topic must
+    be a valid URI. The query is scanned
+    once to find the fields of the link.
+
+    @par Example
+    @code
+    system::result< magnet_link_view > rv = parse_magnet_link(
+        "magnet:?xt=urn:btih:d2474e86c95b19b8bcfdb92bc12c9d44667cfa36" );
+    @endcode
+
+    @par BNF
+    @code
+    absolute-URI  = scheme ":" hier-part [ "?" query ]
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the link, or an error
+    if the string is not a valid magnet link
+
+    @param s The string to parse
+
+    @see
+        @ref magnet_link_view.
+*/
+BOOST_URL_DECL
+system::result<magnet_link_view>
+parse_magnet_link(
+    core::string_view s) noexcept;
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,592 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_MAILTO_VIEW_HPP
+#define BOOST_URL_MAILTO_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+/** A non-owning reference to a valid mailto URL
+
+    A mailto URL holds the addresses of the
+    recipients of a message in its path,
+    separated by commas, and header fields
+    of the message in its query. This view
+    references the fields of the URL which
+    are relevant to the scheme:
+
+    @li The recipients, which are the
+        addresses in the path followed by the
+        addresses in the header fields "to",
+
+    @li The addresses in the header
+        fields "cc" and "bcc",
+
+    @li The header fields "subject"
+        and "body".
+
+    The path and the query are scanned once,
+    when the URL is parsed, and the view
+    records how many addresses each field
+    has and where its first header field is.
+    The addresses are ranges which start at
+    their first header field, without
+    rescanning the params before it. Header
+    names are compared ignoring case after
+    decoding escapes, and addresses and
+    values are returned percent-encoded.
+    Nothing is allocated.
+
+    Addresses are separated by literal
+    commas; an escaped comma is part of an
+    address. Empty addresses are skipped, and
+    addresses are not checked against the
+    syntax of an email address.
+
+    Objects of this type are obtained from
+    @ref parse_mailto, and reference the
+    characters of the string which was parsed,
+    which must remain valid while the view is
+    used.
+
+    @par Example
+    @code
+    mailto_view m = parse_mailto(
+        "mailto:alice@example.com,bob@example.com"
+        "?cc=carol@example.com&subject=Our%20meeting" ).value();
+
+    assert( m.to().size() == 2 );
+    assert( *m.cc().begin() == "carol@example.com" );
+    assert( m.subject().decode() == "Our meeting" );
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6068"
+        >The 'mailto' URI Scheme (rfc6068)</a>
+
+    @see
+        @ref parse_mailto.
+*/
+class mailto_view
+{
+    enum class field
+    {
+        to,
+        cc,
+        bcc
+    };
+
+    // where the first header field is, from
+    // the start of the query, and the number
+    // of addresses or of header fields
+    struct field_pos
+    {
+        std::size_t pos = 0;
+        std::size_t n = 0;
+    };
+
+    url_view u_;
+    std::size_t path_n_ = 0;
+    field_pos to_;
+    field_pos cc_;
+    field_pos bcc_;
+    field_pos subject_;
+    field_pos body_;
+
+    friend
+    BOOST_URL_DECL
+    system::result<mailto_view>
+    parse_mailto(
+        core::string_view s) noexcept;
+
+public:
+    class addresses_type;
+
+    /** Constructor
+
+        Default constructed views reference
+        no URL, and all of their fields
+        are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    mailto_view() noexcept = default;
+
+    /** Return the URL as a URL view
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view const&
+    as_url_view() const noexcept
+    {
+        return u_;
+    }
+
+    /** Return the URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return u_.buffer();
+    }
+
+    /** Return the recipients
+
+        These are the addresses in the path,
+        followed by the addresses in every
+        header field "to", in order.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    addresses_type
+    to() const noexcept;
+
+    /** Return the carbon copy recipients
+
+        These are the addresses in every
+        header field "cc", in order.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    addresses_type
+    cc() const noexcept;
+
+    /** Return the blind carbon copy recipients
+
+        These are the addresses in every
+        header field "bcc", in order.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    addresses_type
+    bcc() const noexcept;
+
+    /** Return true if the URL has a subject
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_subject() const noexcept
+    {
+        return subject_.n != 0;
+    }
+
+    /** Return the subject
+
+        This returns the value of the first
+        header field "subject", or an empty
+        string if there is none.
+
+        @par Complexity
+        Linear in the size of the subject.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    subject() const noexcept
+    {
+        return value(subject_);
+    }
+
+    /** Return true if the URL has a body
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    has_body() const noexcept
+    {
+        return body_.n != 0;
+    }
+
+    /** Return the body
+
+        This returns the value of the first
+        header field "body", or an empty
+        string if there is none.
+
+        @par Complexity
+        Linear in the size of the body.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_string_view
+    body() const noexcept
+    {
+        return value(body_);
+    }
+
+private:
+    addresses_type
+    addresses(
+        field f,
+        field_pos const& fp,
+        core::string_view path) const noexcept;
+
+    BOOST_URL_DECL
+    pct_string_view
+    value(field_pos const& fp) const noexcept;
+};
+
+//------------------------------------------------
+
+/** A forward range of the addresses of a mailto URL field
+
+    The elements reference the characters
+    of the URL.
+*/
+class mailto_view::addresses_type
+{
+    friend class mailto_view;
+
+    char const* path_ = nullptr;
+    char const* path_end_ = nullptr;
+    char const* first_ = nullptr;
+    char const* end_ = nullptr;
+    std::size_t n_ = 0;
+    field f_ = field::to;
+
+    addresses_type(
+        char const* path,
+        char const* path_end,
+        char const* first,
+        char const* end,
+        std::size_t n,
+        field f) noexcept
+        : path_(path)
+        , path_end_(path_end)
+        , first_(first)
+        , end_(end)
+        , n_(n)
+        , f_(f)
+    {
+    }
+
+public:
+    class iterator;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /// The value type
+    using value_type = pct_string_view;
+
+    /// The reference type
+    using reference = pct_string_view;
+
+    /// @copydoc reference
+    using const_reference = pct_string_view;
+
+    /// An unsigned integer type
+    using size_type = std::size_t;
+
+    /** Constructor
+
+        Default constructed ranges are empty.
+    */
+    addresses_type() noexcept = default;
+
+    /** Return the number of addresses
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return true if there are no addresses
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return an iterator to the first address
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+};
+
+//------------------------------------------------
+
+/** A forward iterator to the addresses of a mailto URL field
+*/
+class mailto_view::addresses_type::iterator
+{
+    friend class addresses_type;
+
+    // the address at p_ ends at next_,
+    // in a list of addresses which ends
+    // at list_end_, which is the end of
+    // the path or of a header field
+    char const* p_ = nullptr;
+    char const* next_ = nullptr;
+    char const* list_end_ = nullptr;
+    // the first header field of the
+    // field, and the end of the query
+    char const* first_ = nullptr;
+    char const* end_ = nullptr;
+    field f_ = field::to;
+    bool path_ = false;
+
+    BOOST_URL_DECL
+    iterator(
+        addresses_type const& r) noexcept;
+
+    // Set p_ and next_ to the first
+    // address in [it, list_end_)
+    BOOST_URL_DECL
+    bool
+    find_address(
+        char const* it) noexcept;
+
+    // Move to the next address of the
+    // field, or set p_ to null
+    BOOST_URL_DECL
+    void
+    increment() noexcept;
+
+public:
+    using value_type = pct_string_view;
+    using reference = pct_string_view;
+    using pointer = pct_string_view;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    /** Constructor
+
+        Default constructed iterators
+        are equal to the end iterator
+        of any range.
+    */
+    iterator() noexcept = default;
+
+    BOOST_URL_DECL
+    reference
+    operator*() const noexcept;
+
+    pointer
+    operator->() const noexcept
+    {
+        return **this;
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(p_);
+        increment();
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return p_ == other.p_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return p_ != other.p_;
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+mailto_view::
+addresses_type::
+begin() const noexcept ->
+    iterator
+{
+    if(n_ == 0)
+        return iterator();
+    return iterator(*this);
+}
+
+inline
+auto
+mailto_view::
+addresses_type::
+end() const noexcept ->
+    iterator
+{
+    return iterator();
+}
+
+inline
+auto
+mailto_view::
+addresses(
+    field f,
+    field_pos const& fp,
+    core::string_view path) const noexcept ->
+        addresses_type
+{
+    std::size_t const n =
+        fp.n + (f == field::to ? path_n_ : 0);
+    if(n == 0)
+        return {};
+    core::string_view q =
+        u_.encoded_query();
+    return addresses_type(
+        path.data(),
+        path.data() + path.size(),
+        fp.n != 0 ? q.data() + fp.pos : nullptr,
+        q.data() + q.size(),
+        n,
+        f);
+}
+
+inline
+auto
+mailto_view::
+to() const noexcept ->
+    addresses_type
+{
+    return addresses(
+        field::to, to_, u_.encoded_path());
+}
+
+inline
+auto
+mailto_view::
+cc() const noexcept ->
+    addresses_type
+{
+    return addresses(
+        field::cc, cc_, {});
+}
+
+inline
+auto
+mailto_view::
+bcc() const noexcept ->
+    addresses_type
+{
+    return addresses(
+        field::bcc, bcc_, {});
+}
+
+//------------------------------------------------
+
+/** Return a mailto URL parsed from a string
+
+    The string must be an absolute URI with
+    the scheme "mailto". The path and the
+    query are scanned once to find the
+    fields of the URL.
+
+    @par Example
+    @code
+    system::result< mailto_view > rv = parse_mailto(
+        "mailto:alice@example.com?subject=Hello" );
+    @endcode
+
+    @par BNF
+    @code
+    mailtoURI    = "mailto:" [ to ] [ hfields ]
+    to           = addr-spec *("," addr-spec )
+    hfields      = "?" hfield *( "&" hfield )
+    hfield       = hfname "=" hfvalue
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the URL, or an error
+    if the string is not a valid mailto URL
+
+    @param s The string to parse
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6068#section-2"
+        >2. Syntax of a 'mailto' URI (rfc6068)</a>
+
+    @see
+        @ref mailto_view.
+*/
+BOOST_URL_DECL
+system::result<mailto_view>
+parse_mailto(
+    core::string_view s) noexcept;
+
+} // urls
+} // boost
+
+#endif
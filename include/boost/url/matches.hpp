@@ -16,7 +16,21 @@
 namespace boost {
 namespace urls {
 
-// Base route match results
+/** Base class for route match results
+
+    This type-erased interface holds the
+    segments matched by the replacement
+    fields of a path template, and the ids
+    of those fields, as filled in by
+    @ref router::find or
+    @ref uri_template::match.
+
+    @see
+        @ref matches,
+        @ref matches_storage,
+        @ref router,
+        @ref uri_template.
+*/
 class matches_base
 {
 public:
@@ -53,31 +67,44 @@ public:
     std::size_t
     size() const = 0;
 
+    /// Return the number of results which fit in the storage
+    virtual
+    std::size_t
+    capacity() const = 0;
+
     virtual
     void
     resize(std::size_t) = 0;
 
+    BOOST_URL_DECL
     const_reference
     at( size_type pos ) const;
 
+    BOOST_URL_DECL
     const_reference
     at( core::string_view id ) const;
 
+    BOOST_URL_DECL
     const_reference
     operator[]( size_type pos ) const;
 
+    BOOST_URL_DECL
     const_reference
     operator[]( core::string_view id ) const;
 
+    BOOST_URL_DECL
     const_iterator
     find( core::string_view id ) const;
 
+    BOOST_URL_DECL
     const_iterator
     begin() const;
 
+    BOOST_URL_DECL
     const_iterator
     end() const;
 
+    BOOST_URL_DECL
     bool
     empty() const noexcept;
 };
@@ -141,6 +168,13 @@ public:
         return size_;
     }
 
+    virtual
+    std::size_t
+    capacity() const override
+    {
+        return N;
+    }
+
     virtual
     void
     resize(std::size_t n) override
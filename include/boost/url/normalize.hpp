@@ -0,0 +1,310 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_NORMALIZE_HPP
+#define BOOST_URL_NORMALIZE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Normalization options
+
+    These options select the steps applied
+    by @ref normalize_to.
+
+    @see
+        @ref normalize_to,
+        @ref url_base::normalize.
+*/
+struct BOOST_URL_DECL normalize_opts
+{
+    /** True if the scheme and host are converted to lower case
+
+        Characters in percent-encoding triplets
+        of the host are not affected.
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2.1">
+            6.2.2.1. Case Normalization (rfc3986)</a>
+    */
+    bool lower_case = true;
+
+    /** True if percent-encoding is normalized
+
+        Escapes of characters which are allowed
+        unencoded in their component are decoded,
+        and the hexadecimal digits of the other
+        escapes are converted to upper case.
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2.2">
+            6.2.2.2. Percent-Encoding Normalization (rfc3986)</a>
+    */
+    bool percent_encoding = true;
+
+    /** True if dot segments are removed from the path
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2.3">
+            6.2.2.3. Path Segment Normalization (rfc3986)</a>
+    */
+    bool remove_dot_segments = true;
+
+    /** True if a default or empty port is removed
+
+        The port and its colon are removed
+        when the port is empty, or when it is
+        the default port of a known scheme.
+
+        @par Specification
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.3">
+            6.2.3. Scheme-Based Normalization (rfc3986)</a>
+
+        @see
+            @ref default_port.
+    */
+    bool remove_default_port = false;
+
+#ifndef BOOST_URL_DOCS
+    normalize_opts(
+        bool lower_case_ = true,
+        bool percent_encoding_ = true,
+        bool remove_dot_segments_ = true,
+        bool remove_default_port_ = false) noexcept;
+#endif
+};
+
+/** Write the normalized form of a URL to a buffer
+
+    The normalized form of `u` is written to
+    the buffer in a single pass, without
+    allocating memory, and a view of the
+    result is returned.
+    The buffer is also the scratch space of
+    the algorithm, so it may need to be larger
+    than the result. The size of `u`, plus two
+    characters for each colon in the path when
+    `u` has neither a scheme nor an authority,
+    is always enough.
+    With the default options, the result is
+    the same as calling @ref url_base::normalize
+    on a copy of `u`.
+
+    @par Example
+    @code
+    char buf[64];
+    url_view u = normalize_to(
+        url_view( "HTTP://Example.com:80/a/./b/../%7Ec" ),
+        buf, sizeof(buf), { true, true, true, true } ).value();
+    assert( u.buffer() == "http://example.com/a/~c" );
+    @endcode
+
+    @par Preconditions
+    The buffer does not overlap the
+    buffer of `u`.
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the normalized URL,
+    which references the buffer, or an
+    error if the buffer is too small.
+
+    @param u The URL to normalize.
+
+    @param dest A pointer to the buffer.
+
+    @param size The size of the buffer.
+
+    @param opt The normalization steps to apply.
+
+    @see
+        @ref normalize_opts,
+        @ref url_base::normalize.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+normalize_to(
+    url_view_base const& u,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt = {}) noexcept;
+
+/** Assign the normalized form of a URL to another
+
+    The normalized form of `u` is written
+    directly in the buffer of `dest`, which
+    reserves capacity at most once. This lets
+    a @ref static_url hold the result without
+    allocating memory.
+    With the default options, the result is
+    the same as calling @ref url_base::normalize
+    on a copy of `u`.
+
+    @par Example
+    @code
+    static_url< 64 > dest;
+    normalize_to( url_view( "HTTP://Example.com/a/./b" ), dest );
+    assert( dest.buffer() == "http://example.com/a/b" );
+    @endcode
+
+    @par Preconditions
+    The buffer of `dest` does not overlap
+    the buffer of `u`.
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @throw length_error
+    The capacity needed exceeds the capacity
+    of a @ref static_url. The capacity needed
+    is the size of `u`, plus two characters for
+    each colon in the path when `u` has neither
+    a scheme nor an authority.
+
+    @param u The URL to normalize.
+
+    @param dest The URL to assign.
+
+    @param opt The normalization steps to apply.
+
+    @see
+        @ref normalize_opts,
+        @ref url_base::normalize.
+*/
+BOOST_URL_DECL
+void
+normalize_to(
+    url_view_base const& u,
+    url_base& dest,
+    normalize_opts const& opt = {});
+
+/** Parse a URI and write its normalized form to a buffer
+
+    This function parses `s` with the grammar
+    of @ref parse_uri and writes its normalized
+    form to the buffer, as @ref normalize_to
+    does. When `s` is already in normal form,
+    which is checked with one scan of the
+    parsed components, the characters are
+    copied and the offsets computed by the
+    parse are reused, so the string is
+    neither rewritten nor parsed again.
+
+    @par Example
+    @code
+    char buf[64];
+    url_view u = parse_uri_normalized(
+        "HTTP://Example.com/a/./b/../%7Ec", buf, sizeof(buf) ).value();
+    assert( u.buffer() == "http://example.com/a/~c" );
+    @endcode
+
+    @par Preconditions
+    The buffer does not overlap `s`.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the normalized URL,
+    which references the buffer, or an
+    error if `s` is not a valid URI or
+    the buffer is too small.
+
+    @param s The string to parse.
+
+    @param dest A pointer to the buffer.
+
+    @param size The size of the buffer.
+
+    @param opt The normalization steps to apply.
+
+    @see
+        @ref normalize_opts,
+        @ref normalize_to,
+        @ref parse_uri.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+parse_uri_normalized(
+    core::string_view s,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt = {}) noexcept;
+
+/** Parse a URI and assign its normalized form to a URL
+
+    This function parses `s` with the grammar
+    of @ref parse_uri and writes its normalized
+    form directly in the buffer of `dest`,
+    without the intermediate @ref url of
+    `url( parse_uri( s ).value() ).normalize()`.
+    When `s` is already in normal form, the
+    characters are copied and the offsets
+    computed by the parse are reused.
+
+    @par Example
+    @code
+    url u;
+    parse_uri_normalized( "HTTP://Example.com/a/./b", u ).value();
+    assert( u.buffer() == "http://example.com/a/b" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @throw length_error
+    The capacity needed exceeds the capacity
+    of a @ref static_url.
+
+    @return An error if `s` is not a valid
+    URI, in which case `dest` is unchanged.
+
+    @param s The string to parse.
+
+    @param dest The URL to assign.
+
+    @param opt The normalization steps to apply.
+
+    @see
+        @ref normalize_opts,
+        @ref normalize_to,
+        @ref parse_uri.
+*/
+BOOST_URL_DECL
+system::result<void>
+parse_uri_normalized(
+    core::string_view s,
+    url_base& dest,
+    normalize_opts const& opt = {});
+
+} // urls
+} // boost
+
+#endif
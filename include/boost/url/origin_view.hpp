@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ORIGIN_VIEW_HPP
+#define BOOST_URL_ORIGIN_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+/** A non-owning origin of a URL
+
+    An origin is either a tuple of a scheme,
+    a host and a port, or opaque. URLs whose
+    scheme is `ftp`, `http`, `https`, `ws`
+    or `wss` and which have a host have a
+    tuple origin; the port is the port of the
+    URL, or the default port of its scheme
+    when the URL has none. Other URLs have an
+    opaque origin.
+
+    The host references the character buffer
+    of the URL, and is compared and hashed
+    without regard to case. Percent escapes
+    in the host are compared as written.
+
+    Following the WHATWG specification, an
+    opaque origin is not equal to any origin,
+    including itself.
+
+    @par Example
+    @code
+    url_view u0( "https://www.example.com/index.htm" );
+    url_view u1( "HTTPS://WWW.EXAMPLE.COM:443/path?q" );
+    assert( u0.origin() == u1.origin() );
+    @endcode
+
+    @see
+        @ref url_view_base::origin.
+*/
+class origin_view
+{
+    core::string_view host_;
+    urls::scheme scheme_ = urls::scheme::none;
+    std::uint16_t port_ = 0;
+
+public:
+    /** Constructor
+
+        Default constructed origins are opaque.
+    */
+    origin_view() noexcept = default;
+
+    /** Constructor
+
+        @param s The scheme
+        @param host The host
+        @param port The port
+    */
+    origin_view(
+        urls::scheme s,
+        core::string_view host,
+        std::uint16_t port) noexcept
+        : host_(host)
+        , scheme_(s)
+        , port_(port)
+    {
+    }
+
+    /** Return true if the origin is opaque
+    */
+    bool
+    is_opaque() const noexcept
+    {
+        return scheme_ == urls::scheme::none;
+    }
+
+    /** Return the scheme of a tuple origin
+
+        Opaque origins return @ref scheme::none.
+    */
+    urls::scheme
+    scheme_id() const noexcept
+    {
+        return scheme_;
+    }
+
+    /** Return the host of a tuple origin
+    */
+    core::string_view
+    host() const noexcept
+    {
+        return host_;
+    }
+
+    /** Return the port of a tuple origin
+    */
+    std::uint16_t
+    port() const noexcept
+    {
+        return port_;
+    }
+
+    /** Return a hash of the origin
+
+        Origins which are equal have equal
+        digests.
+
+        @param salt A value which changes
+        the digests of all origins.
+    */
+    std::size_t
+    digest(std::size_t salt = 0) const noexcept
+    {
+        std::size_t const k =
+            (static_cast<std::size_t>(
+                scheme_) << 16) | port_;
+        return grammar::ci_digest(host_) ^
+            ((k + salt) * 0x9e3779b9u);
+    }
+
+    /** Return true if two origins are the same origin
+    */
+    friend
+    bool
+    operator==(
+        origin_view const& a,
+        origin_view const& b) noexcept
+    {
+        return
+            ! a.is_opaque() &&
+            a.scheme_ == b.scheme_ &&
+            a.port_ == b.port_ &&
+            grammar::ci_is_equal(a.host_, b.host_);
+    }
+
+    /** Return true if two origins are not the same origin
+    */
+    friend
+    bool
+    operator!=(
+        origin_view const& a,
+        origin_view const& b) noexcept
+    {
+        return !(a == b);
+    }
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<>
+struct hash< ::boost::urls::origin_view >
+{
+    std::size_t
+    operator()(
+        ::boost::urls::origin_view const& o) const noexcept
+    {
+        return o.digest();
+    }
+};
+} // std
+#endif
+
+#endif
@@ -15,6 +15,7 @@
 #include <boost/url/detail/optional_string.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <cstddef>
+#include <iterator>
 #include <string>
 
 namespace boost {
@@ -931,4 +932,37 @@ operator=(
 } // urls
 } // boost
 
+#if defined(__cpp_lib_ranges) && ! defined(BOOST_URL_DOCS)
+// The iterators of params_encoded_view
+// have param as their value type and
+// param_pct_view as their reference,
+// which both convert to param_view.
+// This makes them std::bidirectional_iterator.
+namespace std {
+
+template<
+    template<class> class TQual,
+    template<class> class UQual>
+struct basic_common_reference<
+    boost::urls::param_pct_view,
+    boost::urls::param,
+    TQual, UQual>
+{
+    using type = boost::urls::param_view;
+};
+
+template<
+    template<class> class TQual,
+    template<class> class UQual>
+struct basic_common_reference<
+    boost::urls::param,
+    boost::urls::param_pct_view,
+    TQual, UQual>
+{
+    using type = boost::urls::param_view;
+};
+
+} // std
+#endif
+
 #endif
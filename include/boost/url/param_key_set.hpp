@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAM_KEY_SET_HPP
+#define BOOST_URL_PARAM_KEY_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A set of query parameter keys and key prefixes
+
+    This container holds the keys of the
+    parameters which should be found or
+    removed from many queries, such as
+    tracking parameters. Keys are matched
+    exactly, or by one of the prefixes
+    in the set.
+
+    The exact keys are stored in a hash
+    table and the prefixes in a trie, so
+    a key is matched with a single pass
+    over its characters, however many
+    keys and prefixes the set contains.
+    Encoded keys are decoded as they are
+    matched, without allocating.
+
+    @par Example
+    @code
+    param_key_set ks( ignore_case );
+    ks.insert( "fbclid" );
+    ks.insert( "gclid" );
+    ks.insert_prefix( "utm_" );
+
+    url u( "https://www.example.com/?utm_source=a&id=42&FBCLID=x" );
+    assert( u.params().erase( ks ) == 2 );
+    assert( u.buffer() == "https://www.example.com/?id=42" );
+    @endcode
+
+    @see
+        @ref params_ref::erase.
+*/
+class param_key_set
+{
+public:
+    /** Constructor
+
+        Default constructed sets contain no
+        keys and compare keys with case.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_key_set() noexcept = default;
+
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param ic If the value @ref ignore_case
+        is passed here, keys are compared
+        case-insensitively.
+    */
+    explicit
+    param_key_set(
+        ignore_case_param ic) noexcept
+        : ic_(static_cast<bool>(ic))
+    {
+    }
+
+    /** Insert a key
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param key The decoded key
+    */
+    BOOST_URL_DECL
+    void
+    insert(core::string_view key);
+
+    /** Insert a key prefix
+
+        Every key which starts with
+        `prefix` is matched.
+
+        @par Complexity
+        Linear in `prefix.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param prefix The decoded prefix
+    */
+    BOOST_URL_DECL
+    void
+    insert_prefix(core::string_view prefix);
+
+    /** Return true if a key is matched
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key
+    */
+    BOOST_URL_DECL
+    bool
+    match(core::string_view key) const noexcept;
+
+    /** Return true if an encoded key is matched
+
+        The key is compared after
+        decoding its escapes.
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key
+    */
+    BOOST_URL_DECL
+    bool
+    match_encoded(pct_string_view key) const noexcept;
+
+    /** Return true if the set is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return keys_.empty() && trie_.empty();
+    }
+
+private:
+    // left-child, right-sibling trie
+    struct node
+    {
+        char c = 0;
+        bool end = false;
+        std::uint32_t child = 0;
+        std::uint32_t sibling = 0;
+    };
+
+    struct slot
+    {
+        std::size_t hash = 0;
+        // one more than the index
+        // of the key, zero if empty
+        std::size_t key = 0;
+    };
+
+    template<class Iter>
+    bool
+    match_impl(Iter first, Iter last) const noexcept;
+
+    std::uint32_t
+    child(
+        std::uint32_t n,
+        char c) const noexcept;
+
+    void rehash(std::size_t nkey);
+
+    std::vector<std::string> keys_;
+    std::vector<slot> table_;
+    std::vector<node> trie_;
+    bool ic_ = false;
+};
+
+} // urls
+} // boost
+
+#endif
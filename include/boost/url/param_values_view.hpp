@@ -0,0 +1,301 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAM_VALUES_VIEW_HPP
+#define BOOST_URL_PARAM_VALUES_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/detail/params_iter_impl.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+class params_base;
+class params_encoded_base;
+class params_index;
+
+namespace detail {
+
+// The position of a param, and the
+// index of the next param with the
+// same key, or the number of params
+struct param_link
+{
+    std::size_t pos;
+    std::size_t next;
+};
+
+} // detail
+#endif
+
+/** A view of the values of the params with a key
+
+    The range yields the value of each param
+    whose key matches, in the order of the
+    query, without copying or decoding it.
+    The returned strings may contain percent
+    escapes; dereferencing them, as in `*v`,
+    gives a @ref decode_view of the decoded
+    characters. A param without a value, as
+    in `"?a&b"`, yields an empty string.
+
+    Ranges returned by @ref params_base::values
+    and @ref params_encoded_base::values find
+    each match by comparing the keys which
+    follow the previous one. Ranges returned
+    by @ref params_index::values go from one
+    match to the next directly.
+
+    The strings produced when iterators
+    are dereferenced refer to the underlying
+    character buffer.
+    Ownership is not transferred; the caller
+    is responsible for ensuring that the
+    lifetime of the buffer extends until
+    it is no longer referenced by any
+    container or iterator.
+
+    @par Example
+    @code
+    url_view u( "?filter=red&size=42&filter=blue" );
+    for( pct_string_view v : u.encoded_params().values( "filter" ) )
+        facets.push_back( *v );
+    @endcode
+
+    @see
+        @ref params_base::values,
+        @ref params_encoded_base::values,
+        @ref params_index::values.
+*/
+class param_values_view
+{
+    friend class params_base;
+    friend class params_encoded_base;
+    friend class params_index;
+
+    detail::params_iter_impl first_;
+    // the key, which is dkey_ when
+    // decoded_key_ is true
+    pct_string_view key_;
+    core::string_view dkey_;
+    detail::param_link const* links_ = nullptr;
+    bool decoded_key_ = false;
+    bool ic_ = false;
+
+    param_values_view(
+        detail::params_iter_impl const& first,
+        pct_string_view key,
+        core::string_view dkey,
+        bool decoded_key,
+        bool ic,
+        detail::param_link const* links) noexcept
+        : first_(first)
+        , key_(key)
+        , dkey_(dkey)
+        , links_(links)
+        , decoded_key_(decoded_key)
+        , ic_(ic)
+    {
+    }
+
+public:
+    /** A forward iterator to a value
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+    */
+    using value_type = pct_string_view;
+
+    /// @copydoc value_type
+    using reference = pct_string_view;
+
+    /// @copydoc value_type
+    using const_reference = pct_string_view;
+
+    /** An unsigned integer type to represent sizes.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        After construction both views reference
+        the same character buffer.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_values_view(
+        param_values_view const&) = default;
+
+    /** Assignment
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_values_view& operator=(
+        param_values_view const&) = default;
+
+    /** Return an iterator to the first value
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return true if no param has the key
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return first_.index ==
+            first_.ref.nparam();
+    }
+};
+
+//------------------------------------------------
+
+class param_values_view::iterator
+{
+    friend class param_values_view;
+
+    detail::params_iter_impl it_;
+    pct_string_view key_;
+    core::string_view dkey_;
+    detail::param_link const* links_ = nullptr;
+    bool decoded_key_ = false;
+    bool ic_ = false;
+
+    iterator(
+        detail::params_iter_impl const& it,
+        param_values_view const& v) noexcept
+        : it_(it)
+        , key_(v.key_)
+        , dkey_(v.dkey_)
+        , links_(v.links_)
+        , decoded_key_(v.decoded_key_)
+        , ic_(v.ic_)
+    {
+    }
+
+public:
+    using value_type = pct_string_view;
+    using reference = pct_string_view;
+    using pointer = reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    iterator() = default;
+    iterator(iterator const&) = default;
+    iterator& operator=(
+        iterator const&) = default;
+
+    BOOST_URL_DECL
+    iterator&
+    operator++() noexcept;
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return it_.dereference().value;
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        return it_.dereference().value;
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.it_.equal(it1.it_);
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return ! it0.it_.equal(it1.it_);
+    }
+};
+
+inline
+auto
+param_values_view::
+begin() const noexcept ->
+    iterator
+{
+    return { first_, *this };
+}
+
+inline
+auto
+param_values_view::
+end() const noexcept ->
+    iterator
+{
+    return { detail::params_iter_impl(
+        first_.ref, 0), *this };
+}
+
+} // urls
+} // boost
+
+#endif
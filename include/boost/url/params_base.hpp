@@ -15,6 +15,7 @@
 #include <boost/url/encoding_opts.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/param.hpp>
+#include <boost/url/param_values_view.hpp>
 #include <boost/url/detail/params_iter_impl.hpp>
 #include <boost/url/detail/url_impl.hpp>
 #include <iosfwd>
@@ -39,6 +40,7 @@ namespace urls {
 class BOOST_URL_DECL params_base
 {
     friend class url_view_base;
+    friend class params_index;
     friend class params_ref;
     friend class params_view;
 
@@ -476,6 +478,45 @@ public:
         core::string_view key,
         ignore_case_param ic = {}) const noexcept;
 
+    /** Return the values of the params with a key
+
+        This function returns a range of the
+        values of every param whose key
+        matches, in order. The values are
+        found as the range is iterated, and
+        are neither copied nor decoded.
+        The comparison is performed as if all
+        escaped characters were decoded first.
+
+        @par Example
+        @code
+        url_view u( "?filter=red&size=42&Filter=blue" );
+
+        assert( std::distance( u.params().values( "filter", ignore_case ).begin(), u.params().values( "filter", ignore_case ).end() ) == 2 );
+        @endcode
+
+        @par Complexity
+        Linear in the characters before the
+        first match. Iterating the range is
+        linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    param_values_view
+    values(
+        core::string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
 private:
     detail::params_iter_impl
     find_impl(
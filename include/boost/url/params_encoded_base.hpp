@@ -14,6 +14,7 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/param.hpp>
+#include <boost/url/param_values_view.hpp>
 #include <boost/url/detail/params_iter_impl.hpp>
 #include <boost/url/detail/url_impl.hpp>
 #include <iosfwd>
@@ -506,6 +507,49 @@ public:
         pct_string_view key,
         ignore_case_param ic = {}) const noexcept;
 
+    /** Return the values of the params with a key
+
+        This function returns a range of the
+        values of every param whose key
+        matches, in order. The values are
+        found as the range is iterated, and
+        are neither copied nor decoded.
+        The comparison is performed as if all
+        escaped characters were decoded first.
+
+        @par Example
+        @code
+        url_view u( "?filter=red&size=42&filter=blue" );
+
+        for( pct_string_view v : u.encoded_params().values( "filter" ) )
+            assert( v == "red" || v == "blue" );
+        @endcode
+
+        @par Complexity
+        Linear in the characters before the
+        first match. Iterating the range is
+        linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `key` contains an invalid percent-encoding.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    param_values_view
+    values(
+        pct_string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
 private:
     detail::params_iter_impl
     find_impl(
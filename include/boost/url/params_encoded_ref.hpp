@@ -69,6 +69,7 @@ class params_encoded_view;
     @li @ref replace, @ref set : Modified
         params and all params
         after (including `end()`).
+    @li @ref sort : All params.
 */
 class BOOST_URL_DECL params_encoded_ref
     : public params_encoded_base
@@ -659,6 +660,40 @@ public:
         pct_string_view key,
         ignore_case_param ic = {}) noexcept;
 
+    /** Sort params by key
+
+        The params are sorted by their
+        decoded keys, compared as unsigned
+        bytes, and params with equal keys
+        keep their relative order. The keys
+        are compared where they are in the
+        query, which is then written once
+        in the new order.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?b=2&%61=1&b=1&A=0" );
+
+        u.encoded_params().sort();
+
+        assert( u.encoded_query() == "A=0&%61=1&b=2&b=1" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().encoded_query().size()`
+        plus `this->size()` times the logarithm
+        of `this->size()` key comparisons.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    void
+    sort();
+
     //--------------------------------------------
 
     /** Replace params
@@ -0,0 +1,594 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAMS_INDEX_HPP
+#define BOOST_URL_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/param_values_view.hpp>
+#include <boost/url/params_view.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A hash index of the keys of a query
+
+    The functions @ref params_base::find,
+    @ref params_base::contains, and
+    @ref params_base::count compare the
+    decoded key of every parameter with the
+    key being searched for. This object
+    decodes and hashes every key of a
+    query once, so that many lookups on the
+    same query each take constant time on
+    average and do not allocate.
+
+    The index also links each param to the
+    next param with the same key, and is a
+    range of the groups of params with the
+    same key, in the order in which their
+    keys first appear. The values of a group
+    are visited without comparing keys.
+
+    Keys are compared after percent-decoding,
+    as with @ref params_base::find. When the
+    index is built with @ref ignore_case,
+    keys are compared case-insensitively.
+
+    The index references the characters of
+    the query. Modifying or destroying the
+    URL invalidates the index, which must
+    then be assigned again.
+
+    @par Example
+    @code
+    url_view u( "?user=john&Lang=en&tag=a&tag=b" );
+    params_index idx( u.params(), ignore_case );
+
+    assert( idx.contains( "lang" ) );
+    assert( idx.count( "tag" ) == 2 );
+    assert( (*idx.find( "user" )).value == "john" );
+
+    for( auto const& g : idx )
+        std::cout << g.key << ": " << g.count << " values\n";
+    @endcode
+
+    @see
+        @ref params_view.
+*/
+class params_index
+{
+public:
+    /** The params with the same key
+    */
+    struct group
+    {
+        /** The key of the first param
+        */
+        pct_string_view key;
+
+        /** The number of params
+        */
+        std::size_t count;
+
+        /** The values of the params
+        */
+        param_values_view values;
+    };
+
+    /** A random access iterator to a group
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+    */
+    using value_type = group;
+
+    /// @copydoc value_type
+    using reference = group;
+
+    /// @copydoc value_type
+    using const_reference = group;
+
+    /** An unsigned integer type to represent sizes.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default constructed indexes refer
+        to an empty query.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_index() noexcept = default;
+
+    /** Constructor
+
+        This function indexes the keys
+        of the params in `ps`.
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The params to index
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, keys are compared
+        case-insensitively.
+    */
+    BOOST_URL_DECL
+    explicit
+    params_index(
+        params_view const& ps,
+        ignore_case_param ic = {});
+
+    /** Index other params
+
+        This function replaces the contents
+        of the index with the keys of the
+        params in `ps`.
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The params to index
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, keys are compared
+        case-insensitively.
+    */
+    BOOST_URL_DECL
+    void
+    assign(
+        params_view const& ps,
+        ignore_case_param ic = {});
+
+    /** Return the indexed params
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_view const&
+    params() const noexcept
+    {
+        return ps_;
+    }
+
+    /** Return true if a matching key exists
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The unencoded key
+    */
+    bool
+    contains(
+        core::string_view key) const noexcept
+    {
+        return find_slot(key) != nullptr;
+    }
+
+    /** Return the number of matching keys
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The unencoded key
+    */
+    BOOST_URL_DECL
+    std::size_t
+    count(
+        core::string_view key) const noexcept;
+
+    /** Find the first matching key
+
+        This function returns an iterator to
+        the first param whose key matches, or
+        `this->params().end()` if there is no
+        match.
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The unencoded key
+    */
+    BOOST_URL_DECL
+    params_view::iterator
+    find(
+        core::string_view key) const noexcept;
+
+    /** Return the values of the params with a key
+
+        The range starts at the first param
+        whose key matches, and goes from each
+        match to the next without comparing
+        the keys in between.
+
+        @par Example
+        @code
+        params_index idx( url_view( "?filter=red&size=42&filter=blue" ).params() );
+
+        for( pct_string_view v : idx.values( "filter" ) )
+            assert( v == "red" || v == "blue" );
+        @endcode
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The unencoded key
+    */
+    BOOST_URL_DECL
+    param_values_view
+    values(
+        core::string_view key) const noexcept;
+
+    /** Return the number of distinct keys
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return order_.size();
+    }
+
+    /** Return true if there are no params
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return order_.empty();
+    }
+
+    /** Return the group of a key
+
+        Groups are numbered in the order
+        in which their keys first appear.
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The number of the group.
+    */
+    BOOST_URL_DECL
+    group
+    operator[](std::size_t i) const noexcept;
+
+    /** Return an iterator to the first group
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+private:
+    struct slot
+    {
+        // zero when the slot is empty
+        std::size_t n = 0;
+        std::size_t hash = 0;
+        pct_string_view key;
+        // first and last match
+        std::size_t pos = 0;
+        std::size_t index = 0;
+        std::size_t last = 0;
+    };
+
+    BOOST_URL_DECL
+    slot const*
+    find_slot(
+        core::string_view key) const noexcept;
+
+    param_values_view
+    make_values(slot const& s) const noexcept;
+
+    params_view ps_;
+    std::vector<slot> table_;
+    // the slots in order of first match
+    std::vector<std::size_t> order_;
+    std::vector<detail::param_link> links_;
+    bool ic_ = false;
+};
+
+//------------------------------------------------
+
+class params_index::iterator
+{
+    friend class params_index;
+
+    params_index const* idx_ = nullptr;
+    std::size_t i_ = 0;
+
+    iterator(
+        params_index const* idx,
+        std::size_t i) noexcept
+        : idx_(idx)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = group;
+    using reference = group;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    iterator() = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return (*idx_)[i_];
+    }
+
+    reference
+    operator[](difference_type n) const noexcept
+    {
+        return (*idx_)[i_ + n];
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++i_;
+        return tmp;
+    }
+
+    iterator&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --i_;
+        return tmp;
+    }
+
+    iterator&
+    operator+=(difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    iterator&
+    operator-=(difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    iterator
+    operator+(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator+(
+        difference_type n,
+        iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator-(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return static_cast<difference_type>(
+            it0.i_ - it1.i_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ == it1.i_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ != it1.i_;
+    }
+
+    friend
+    bool
+    operator<(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ < it1.i_;
+    }
+
+    friend
+    bool
+    operator>(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ > it1.i_;
+    }
+
+    friend
+    bool
+    operator<=(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ <= it1.i_;
+    }
+
+    friend
+    bool
+    operator>=(
+        iterator const& it0,
+        iterator const& it1) noexcept
+    {
+        return it0.i_ >= it1.i_;
+    }
+};
+
+inline
+auto
+params_index::
+begin() const noexcept ->
+    iterator
+{
+    return { this, 0 };
+}
+
+inline
+auto
+params_index::
+end() const noexcept ->
+    iterator
+{
+    return { this, order_.size() };
+}
+
+//------------------------------------------------
+
+/** Group the params of a query by key
+
+    @par Effects
+    @code
+    return params_index( ps, ic );
+    @endcode
+
+    @par Example
+    @code
+    url_view u( "?filter=red&size=42&filter=blue" );
+
+    for( auto const& g : group_by_key( u.params() ) )
+        for( pct_string_view v : g.values )
+            facets[ g.key ].push_back( *v );
+    @endcode
+
+    @par Complexity
+    Linear in `ps.buffer().size()`.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @param ps The params to group
+
+    @param ic An optional parameter. If
+    the value @ref ignore_case is passed
+    here, keys are compared
+    case-insensitively.
+*/
+inline
+params_index
+group_by_key(
+    params_view const& ps,
+    ignore_case_param ic = {})
+{
+    return params_index(ps, ic);
+}
+
+} // urls
+} // boost
+
+#endif
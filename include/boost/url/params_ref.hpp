@@ -13,6 +13,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/ignore_case.hpp>
+#include <boost/url/param_key_set.hpp>
 #include <boost/url/params_base.hpp>
 #include <initializer_list>
 #include <iterator>
@@ -70,6 +71,8 @@ class params_view;
     @li @ref erase : Erased elements and all
         elements after (including `end()`).
 
+    @li @ref sort : All elements.
+
     @li @ref insert : All elements at or after
         the insertion point (including `end()`).
 
@@ -654,6 +657,80 @@ public:
         core::string_view key,
         ignore_case_param ic = {}) noexcept;
 
+    /** Erase elements
+
+        This function removes every element
+        whose key is matched by `keys`. The
+        params are visited once, and the
+        characters of the ones which are kept
+        are moved at most once.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        param_key_set ks;
+        ks.insert( "fbclid" );
+        ks.insert_prefix( "utm_" );
+
+        url u( "?utm_source=a&id=42&fbclid=x&utm_medium=b" );
+
+        assert( u.params().erase( ks ) == 3 );
+        assert( u.encoded_query() == "id=42" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().encoded_query().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of elements removed
+        from the container.
+
+        @param keys The keys to match.
+    */
+    std::size_t
+    erase(
+        param_key_set const& keys) noexcept;
+
+    /** Sort the elements by key
+
+        The elements are sorted by their
+        decoded keys, compared as unsigned
+        bytes, and elements with equal keys
+        keep their relative order. The keys
+        are compared where they are in the
+        query, which is then written once
+        in the new order. This puts queries
+        in a canonical order, as used for
+        cache keys and request signatures.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?b=2&a=1&b=1&A=0" );
+
+        u.params().sort();
+
+        assert( u.encoded_query() == "A=0&a=1&b=2&b=1" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().encoded_query().size()`
+        plus `this->size()` times the logarithm
+        of `this->size()` key comparisons.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    void
+    sort();
+
     //--------------------------------------------
 
     /** Replace elements
@@ -13,6 +13,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error_types.hpp>
+#include <boost/url/parse_options.hpp>
 #include <boost/url/url_view.hpp>
 
 namespace boost {
@@ -113,6 +114,40 @@ system::result<url_view>
 parse_origin_form(
     core::string_view s);
 
+/** Return a reference to a parsed URL string, within limits
+
+    This function parses a string as
+    @ref parse_origin_form does, and fails if the
+    string or the URL exceeds one of the
+    limits in `opt`. The size of the string
+    is checked before it is parsed. The
+    other limits are checked on the parsed
+    view, which costs no more than the
+    parse itself, since parsing is linear
+    and does not allocate.
+
+    @par Example
+    @code
+    parse_options opt;
+    opt.max_segments = 2;
+    assert( parse_origin_form( "/a/b/c", opt ).error() == error::too_many_segments );
+    @endcode
+
+    @return A @ref result containing a value or an error
+
+    @param s The string to parse
+
+    @param opt The limits on the URL
+
+    @see
+        @ref parse_options.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+parse_origin_form(
+    core::string_view s,
+    parse_options const& opt);
+
 //------------------------------------------------
 
 /** Return a reference to a parsed URL string
@@ -216,6 +251,40 @@ system::result<url_view>
 parse_uri(
     core::string_view s);
 
+/** Return a reference to a parsed URL string, within limits
+
+    This function parses a string as
+    @ref parse_uri does, and fails if the
+    string or the URL exceeds one of the
+    limits in `opt`. The size of the string
+    is checked before it is parsed. The
+    other limits are checked on the parsed
+    view, which costs no more than the
+    parse itself, since parsing is linear
+    and does not allocate.
+
+    @par Example
+    @code
+    parse_options opt;
+    opt.max_segments = 2;
+    assert( parse_uri( "http://example.com/a/b/c", opt ).error() == error::too_many_segments );
+    @endcode
+
+    @return A @ref result containing a value or an error
+
+    @param s The string to parse
+
+    @param opt The limits on the URL
+
+    @see
+        @ref parse_options.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+parse_uri(
+    core::string_view s,
+    parse_options const& opt);
+
 //------------------------------------------------
 
 /** Return a reference to a parsed URL string
@@ -278,6 +347,258 @@ system::result<url_view>
 parse_uri_reference(
     core::string_view s);
 
+//------------------------------------------------
+
+/** Parse a batch of URL strings
+
+    This function parses each string in the
+    range `[first, first + n)` as a
+    <em>URI-reference</em>, storing the outcome
+    for the i-th input in `out[i]`. Each element
+    of the output holds either a view referencing
+    the corresponding input string, or the error
+    which caused parsing to fail.
+    Ownership of the strings is not transferred;
+    the caller is responsible for ensuring that
+    the lifetime of every character buffer extends
+    until the views are no longer being accessed.
+
+    This is equivalent to calling
+    @ref parse_uri_reference on each input in
+    turn, but avoids the per-call overhead when
+    many strings are parsed at once.
+
+    @par Example
+    @code
+    core::string_view in[] = {
+        "https://www.example.com/index.htm",
+        "/path/to/file.txt?id=1",
+        "http://[::1" };
+    system::result< url_view > out[3];
+    std::size_t n = parse_uri_reference( in, 3, out );
+    assert( n == 2 );
+    assert( out[2].has_error() );
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the inputs.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of inputs which were
+    parsed successfully.
+
+    @param first A pointer to the first input.
+
+    @param n The number of inputs.
+
+    @param out A pointer to storage for at
+    least `n` results.
+
+    @see
+        @ref parse_uri_reference.
+*/
+BOOST_URL_DECL
+std::size_t
+parse_uri_reference(
+    core::string_view const* first,
+    std::size_t n,
+    system::result<url_view>* out) noexcept;
+
+//------------------------------------------------
+
+/** A limit on the work done by one call
+
+    A call to the resumable overload of
+    @ref parse_uri_reference stops before
+    the input which would make it parse
+    more than `urls` strings, or more than
+    `bytes` characters. At least one input
+    is parsed by each call, so that a batch
+    always makes progress.
+
+    @see
+        @ref parse_progress,
+        @ref parse_uri_reference.
+*/
+struct parse_budget
+{
+    /// The largest number of strings to parse
+    std::size_t urls = std::size_t(-1);
+
+    /// The largest number of characters to parse
+    std::size_t bytes = std::size_t(-1);
+};
+
+/** The position of a batch parse
+
+    This holds all the state of a batch
+    parsed by the resumable overload of
+    @ref parse_uri_reference, so that the
+    batch can be parsed in slices between
+    other work, such as the callbacks of an
+    event loop, without creating threads.
+    A default constructed object starts at
+    the first input.
+
+    @see
+        @ref parse_budget,
+        @ref parse_uri_reference.
+*/
+struct parse_progress
+{
+    /// The number of inputs parsed
+    std::size_t next = 0;
+
+    /// The number of inputs parsed successfully
+    std::size_t good = 0;
+};
+
+/** Parse a slice of a batch of URL strings
+
+    This function continues the parse of the
+    strings in the range `[first, first + n)`,
+    as by @ref parse_uri_reference, from the
+    input at `p.next`, and stops when all the
+    inputs are parsed or the budget is spent.
+    The outcome for the i-th input is stored
+    in `out[i]`, and `p` is updated so that
+    the next call with the same arguments
+    picks up where this one left off.
+
+    @par Example
+    @code
+    struct job
+    {
+        std::vector< core::string_view > in;
+        std::vector< system::result< url_view > > out;
+        parse_progress p;
+    };
+
+    void step( job& j )
+    {
+        parse_budget b;
+        b.bytes = 64 * 1024;
+        if( ! parse_uri_reference(
+                j.in.data(), j.in.size(), j.out.data(), j.p, b ) )
+            loop.post( [&j]{ step( j ); } );
+    }
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the
+    inputs parsed by this call.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return `true` if all the inputs are
+    parsed, in which case `p.good` is the
+    number of inputs parsed successfully.
+
+    @param first A pointer to the first input.
+
+    @param n The number of inputs.
+
+    @param out A pointer to storage for at
+    least `n` results.
+
+    @param p The position of the batch,
+    which is updated.
+
+    @param b The work allowed for this call.
+
+    @see
+        @ref parse_budget,
+        @ref parse_progress.
+*/
+BOOST_URL_DECL
+bool
+parse_uri_reference(
+    core::string_view const* first,
+    std::size_t n,
+    system::result<url_view>* out,
+    parse_progress& p,
+    parse_budget b = {}) noexcept;
+
+//------------------------------------------------
+
+/** Return false if a string can not be a URI
+
+    This function rejects most strings which
+    are not URIs, such as text or binary
+    data, in one scan of the string, so they
+    can be skipped without a call to
+    @ref parse_uri. It returns false if the
+    string contains a character which is not
+    allowed anywhere in a URI, such as a
+    control character, a space or a byte
+    which is not ASCII, if an escape is not
+    followed by two hexadecimal digits, if a
+    square bracket is outside of the
+    authority, or if the string does not
+    start with a scheme. Otherwise it
+    returns true, and the string may still
+    fail to parse.
+
+    @par Example
+    @code
+    for( core::string_view s : lines )
+        if( is_plausible_uri( s ) )
+            if( auto rv = parse_uri( s ) )
+                handle( *rv );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return `false` if `parse_uri( s )`
+    fails, `true` if it may succeed.
+
+    @param s The string to check.
+
+    @see
+        @ref is_plausible_uri_reference,
+        @ref parse_uri.
+*/
+BOOST_URL_DECL
+bool
+is_plausible_uri(
+    core::string_view s) noexcept;
+
+/** Return false if a string can not be a URI-reference
+
+    This function checks the same characters
+    as @ref is_plausible_uri, but the string
+    does not need a scheme. If it has none,
+    its first segment can not contain a
+    `':'`.
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return `false` if
+    `parse_uri_reference( s )` fails, `true`
+    if it may succeed.
+
+    @param s The string to check.
+
+    @see
+        @ref is_plausible_uri,
+        @ref parse_uri_reference.
+*/
+BOOST_URL_DECL
+bool
+is_plausible_uri_reference(
+    core::string_view s) noexcept;
+
 } // url
 } // boost
 
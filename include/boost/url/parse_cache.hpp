@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARSE_CACHE_HPP
+#define BOOST_URL_PARSE_CACHE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Counters of the work done by a parse cache
+
+    @see
+        @ref parse_cache::stats.
+*/
+struct parse_cache_stats
+{
+    /** The number of strings found in the cache
+
+        These strings were compared with the
+        stored copy, and the stored offsets
+        were used without parsing the string.
+    */
+    std::size_t hits = 0;
+
+    /** The number of strings which were parsed
+    */
+    std::size_t misses = 0;
+
+    /** The number of parsed URLs stored
+    */
+    std::size_t insertions = 0;
+
+    /** The number of stored URLs replaced by others
+    */
+    std::size_t evictions = 0;
+};
+
+/** A bounded cache of parsed URL strings
+
+    Programs such as load balancers, crawlers
+    and pollers parse the same strings again
+    and again. This cache maps a hash of the
+    characters of a string to a copy of the
+    string and the offsets and decoded sizes
+    which a successful parse computed for it.
+    When a string is found, its characters
+    are compared with the copy using
+    `std::memcmp`, and the view is built from
+    the stored offsets without validating the
+    string again.
+
+    The cache has a fixed number of slots,
+    divided into shards which each have their
+    own lock. A string can only be stored in
+    one slot, chosen by its hash, and replaces
+    the string which was stored there before.
+    Strings longer than a maximum size, and
+    strings which fail to parse, are never
+    stored. The memory used is therefore
+    bounded by the number of slots times the
+    maximum size.
+
+    The cache is opt-in: it is only used
+    through its own member functions, or by
+    @ref parse_uri and @ref parse_uri_reference
+    after it is installed with
+    @ref set_parse_cache.
+
+    @par Example
+    @code
+    parse_cache cache( 4096 );
+    for( core::string_view s : requests )
+    {
+        system::result< url_view > rv = cache.parse_uri( s );
+        // ...
+    }
+    parse_cache_stats st = cache.stats();
+    double hit_rate = double( st.hits ) / ( st.hits + st.misses );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+
+    @see
+        @ref parse_cache_stats,
+        @ref set_parse_cache.
+*/
+class parse_cache
+{
+    struct shard;
+
+    shard* shards_ = nullptr;
+    std::size_t nslot_ = 0;
+    std::size_t max_size_ = 0;
+
+public:
+    /** The number of shards
+    */
+    static constexpr std::size_t shard_count = 16;
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param slots The number of URLs the
+        cache can hold. This is rounded up to
+        a multiple of @ref shard_count.
+
+        @param max_size The size of the
+        largest string which is stored.
+    */
+    BOOST_URL_DECL
+    explicit
+    parse_cache(
+        std::size_t slots,
+        std::size_t max_size = 2048);
+
+    /** Destructor
+
+        The cache must not be installed
+        with @ref set_parse_cache.
+    */
+    BOOST_URL_DECL
+    ~parse_cache();
+
+    parse_cache(parse_cache const&) = delete;
+    parse_cache& operator=(parse_cache const&) = delete;
+
+    /** Return the number of slots
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return nslot_ * shard_count;
+    }
+
+    /** Return the size of the largest string which is stored
+    */
+    std::size_t
+    max_size() const noexcept
+    {
+        return max_size_;
+    }
+
+    /** Parse a URI, using the cache
+
+        The result is the same as the
+        result of @ref parse_uri. The view
+        references `s`, and not the copy
+        held by the cache.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The string to parse
+    */
+    BOOST_URL_DECL
+    system::result<url_view>
+    parse_uri(core::string_view s);
+
+    /** Parse a URI reference, using the cache
+
+        The result is the same as the
+        result of @ref parse_uri_reference.
+        The view references `s`, and not
+        the copy held by the cache.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param s The string to parse
+    */
+    BOOST_URL_DECL
+    system::result<url_view>
+    parse_uri_reference(core::string_view s);
+
+    /** Return the counters of the cache
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    parse_cache_stats
+    stats() const noexcept;
+
+    /** Remove every URL and reset the counters
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+private:
+    system::result<url_view>
+    parse(core::string_view, int);
+};
+
+/** Install a cache used by the parse functions
+
+    After this call, @ref parse_uri and
+    @ref parse_uri_reference look up their
+    input in `c`. A null pointer removes
+    the installed cache, so that the parse
+    functions do not use a cache.
+
+    The caller is responsible for keeping
+    the cache alive until it is removed,
+    and until the parse calls which may be
+    using it have returned.
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The cache installed before
+
+    @param c The cache to install, or null
+*/
+BOOST_URL_DECL
+parse_cache*
+set_parse_cache(parse_cache* c) noexcept;
+
+namespace detail {
+
+BOOST_URL_DECL
+parse_cache*
+get_parse_cache() noexcept;
+
+} // detail
+
+} // urls
+} // boost
+
+#endif
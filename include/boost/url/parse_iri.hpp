@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARSE_IRI_HPP
+#define BOOST_URL_PARSE_IRI_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost {
+namespace urls {
+
+/** Parse an IRI reference and map it to a URI reference
+
+    This function parses the string `s` as an
+    <em>IRI-reference</em> and stores the URI
+    reference it maps to in `dest`, replacing
+    its contents. Each byte of the UTF-8
+    characters in `s` is percent-encoded, with
+    uppercase hexadecimal digits, and the other
+    characters are kept as they are.
+
+    The characters which are not ASCII must
+    be valid UTF-8, and must be characters
+    which RFC 3987 allows: <em>ucschar</em>
+    anywhere an unreserved character is
+    allowed, and <em>iprivate</em> in the query
+    only. They are mapped as they are validated,
+    and a string which is all ASCII is parsed
+    as a URI reference with no extra work.
+
+    @par Example
+    @code
+    url u;
+    parse_iri_reference( "http://r\xc3\xa9sum\xc3\xa9.example/caf\xc3\xa9?q=\xe2\x82\xac", u ).value();
+    assert( u.buffer() == "http://r%C3%A9sum%C3%A9.example/caf%C3%A9?q=%E2%82%AC" );
+    assert( u.host() == "r\xc3\xa9sum\xc3\xa9.example" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @throw length_error
+    The result does not fit in the capacity
+    of a @ref static_url.
+
+    @return An error if `s` is not a valid
+    IRI reference, in which case `dest`
+    is unchanged.
+
+    @param s The string to parse.
+
+    @param dest The container where the
+    result is written.
+
+    @par BNF
+    @code
+    IRI-reference = IRI / irelative-ref
+
+    ucschar       = %xA0-D7FF / %xF900-FDCF / %xFDF0-FFEF
+                  / %x10000-1FFFD / %x20000-2FFFD / %x30000-3FFFD
+                  / %x40000-4FFFD / %x50000-5FFFD / %x60000-6FFFD
+                  / %x70000-7FFFD / %x80000-8FFFD / %x90000-9FFFD
+                  / %xA0000-AFFFD / %xB0000-BFFFD / %xC0000-CFFFD
+                  / %xD0000-DFFFD / %xE1000-EFFFD
+
+    iprivate      = %xE000-F8FF / %xF0000-FFFFD / %x100000-10FFFD
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc3987#section-2.2"
+        >2.2. ABNF for IRI References and IRIs (rfc3987)</a>
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc3987#section-3.1"
+        >3.1. Mapping of IRIs to URIs (rfc3987)</a>
+
+    @see
+        @ref parse_uri_reference.
+*/
+BOOST_URL_DECL
+system::result<void>
+parse_iri_reference(
+    core::string_view s,
+    url_base& dest);
+
+/** Parse an IRI reference and map it to a URI reference
+
+    This function parses the string `s` as an
+    <em>IRI-reference</em> and returns a new
+    @ref url holding the URI reference it
+    maps to.
+
+    @par Example
+    @code
+    url u = parse_iri_reference( "/\xe6\x97\xa5\xe6\x9c\xac" ).value();
+    assert( u.encoded_path() == "/%E6%97%A5%E6%9C%AC" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @return A @ref url with the result,
+    or an error if `s` is not a valid
+    IRI reference.
+
+    @param s The string to parse.
+
+    @see
+        @ref parse_uri_reference.
+*/
+BOOST_URL_DECL
+system::result<url>
+parse_iri_reference(
+    core::string_view s);
+
+} // urls
+} // boost
+
+#endif
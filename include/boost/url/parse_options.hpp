@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARSE_OPTIONS_HPP
+#define BOOST_URL_PARSE_OPTIONS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Limits on the URLs accepted by an algorithm
+
+    These options bound the work done on
+    untrusted input. Algorithms accepting
+    them fail with a specific error, such as
+    @ref error::too_long, as soon as a URL
+    exceeds one of the limits, before the
+    URL is modified or any work depending
+    on the number of its parts is done.
+    Default constructed options have no
+    limits.
+
+    @par Example
+    @code
+    parse_options opt;
+    opt.max_size = 2048;
+    opt.max_segments = 32;
+
+    system::result< url_view > rv = parse_uri( s, opt );
+    @endcode
+
+    @see
+        @ref parse_origin_form,
+        @ref parse_uri,
+        @ref url_base::normalize.
+*/
+struct parse_options
+{
+    /** The largest number of characters in a URL
+    */
+    std::size_t max_size = std::size_t(-1);
+
+    /** The largest number of segments in a path
+    */
+    std::size_t max_segments = std::size_t(-1);
+
+    /** The largest number of params in a query
+    */
+    std::size_t max_params = std::size_t(-1);
+
+    /** The largest number of characters in a host
+
+        The limit applies to the
+        encoded host.
+    */
+    std::size_t max_host_size = std::size_t(-1);
+};
+
+} // urls
+} // boost
+
+#endif
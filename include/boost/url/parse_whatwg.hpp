@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARSE_WHATWG_HPP
+#define BOOST_URL_PARSE_WHATWG_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** Options for parsing URLs as a web browser does
+
+    @see
+        @ref parse_whatwg.
+*/
+struct whatwg_opts
+{
+    /** The type of a domain to ASCII function
+
+        The function receives a percent-decoded
+        domain, which is UTF-8, and stores its
+        ASCII form in `result`. It returns
+        `false` if the domain is not valid.
+    */
+    using domain_to_ascii_fn = bool(*)(
+        core::string_view domain,
+        std::string& result);
+
+    /** The function used to convert domains to ASCII
+
+        This function implements the
+        <em>domain to ASCII</em> algorithm
+        of UTS #46. It is only called for the
+        hosts of special schemes which are not
+        all ASCII, or which have a label
+        starting with "xn--". Other domains are
+        converted to lower case.
+
+        When this is null, domains which are
+        not all ASCII are rejected, and labels
+        starting with "xn--" are not checked.
+
+        @par Example
+        The IDNA implementation of skyr can
+        be used here:
+        @code
+        whatwg_opts opt;
+        opt.domain_to_ascii = [](
+            core::string_view d, std::string& r )
+        {
+            auto rv = skyr::domain_to_ascii(
+                std::string_view( d.data(), d.size() ) );
+            if( ! rv )
+                return false;
+            r = std::move( *rv );
+            return true;
+        };
+        @endcode
+    */
+    domain_to_ascii_fn domain_to_ascii = nullptr;
+};
+
+/** Parse a URL as a web browser does
+
+    This function parses the string `s` as an
+    absolute URL with the basic URL parser of
+    the WHATWG URL Standard, and stores the
+    serialized result in `dest`, replacing its
+    contents. The rules for special schemes
+    are applied: leading and trailing spaces
+    and control characters are removed, as are
+    tabs and newlines; backslashes separate
+    path segments; hosts are converted to lower
+    case or to an IPv4 address, which may be
+    written in hexadecimal or octal; default
+    ports are removed; and dot segments are
+    removed from paths.
+
+    The result is always a valid
+    <em>absolute-URI</em>. Characters which the
+    WHATWG serialization leaves unescaped but
+    RFC 3986 does not allow, such as "|" or
+    "^", are percent-encoded, as are percent
+    signs which do not start a valid escape.
+
+    The result is written once into storage
+    reserved for it, so a destination which is
+    reused for many URLs stops allocating once
+    it is large enough.
+
+    @par Example
+    @code
+    url u;
+    parse_whatwg( " HTTP://EXAMPLE.com:80\\a\\.\\b\\..\\c?x#y ", u ).value();
+    assert( u.buffer() == "http://example.com/a/c?x#y" );
+
+    parse_whatwg( "http://0x7f.1/", u ).value();
+    assert( u.host_type() == host_type::ipv4 );
+    assert( u.buffer() == "http://127.0.0.1/" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`, plus the calls
+    to the domain to ASCII function.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @throw length_error
+    The result does not fit in the capacity
+    of a @ref static_url.
+
+    @return An error if `s` is not a valid
+    absolute URL, in which case `dest`
+    is unchanged.
+
+    @param s The string to parse.
+
+    @param dest The container where the
+    result is written.
+
+    @param opt The options to use.
+
+    @par Specification
+    @li <a href="https://url.spec.whatwg.org/#concept-basic-url-parser"
+        >4.4. URL parsing (WHATWG URL Standard)</a>
+
+    @see
+        @ref whatwg_opts.
+*/
+BOOST_URL_DECL
+system::result<void>
+parse_whatwg(
+    core::string_view s,
+    url_base& dest,
+    whatwg_opts const& opt = {});
+
+/** Parse a URL as a web browser does
+
+    This function parses the string `s` as
+    an absolute URL with the basic URL parser
+    of the WHATWG URL Standard, and returns a
+    new @ref url holding the result.
+
+    @par Example
+    @code
+    url u = parse_whatwg( "https://example.com:443" ).value();
+    assert( u.buffer() == "https://example.com/" );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @return A @ref url with the result,
+    or an error if `s` is not a valid
+    absolute URL.
+
+    @param s The string to parse.
+
+    @param opt The options to use.
+
+    @see
+        @ref whatwg_opts.
+*/
+BOOST_URL_DECL
+system::result<url>
+parse_whatwg(
+    core::string_view s,
+    whatwg_opts const& opt = {});
+
+} // urls
+} // boost
+
+#endif
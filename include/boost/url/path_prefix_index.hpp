@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PATH_PREFIX_INDEX_HPP
+#define BOOST_URL_PATH_PREFIX_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** Return true if a path starts with another as if both were decoded
+
+    The paths are compared as if their
+    escapes were decoded, except for escapes
+    of the slash, "%2F", which are compared
+    literally so that they never match a
+    segment separator. Runs of characters
+    without escapes are compared several
+    bytes at a time, and escapes are only
+    decoded where the paths differ.
+
+    @par Example
+    @code
+    assert( *path_starts_with( "/%61pi/v1/users", "/api/" ) == 7 );
+    assert( ! path_starts_with( "/api%2Fv1", "/api/" ) );
+    @endcode
+
+    @par Complexity
+    Linear in `prefix.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of characters of
+    `path` which match `prefix`, or an
+    empty optional if `path` does not
+    start with `prefix`.
+
+    @param path The percent-encoded path.
+
+    @param prefix The percent-encoded prefix.
+
+    @see
+        @ref path_ends_with,
+        @ref path_prefix_index.
+*/
+BOOST_URL_DECL
+boost::optional<std::size_t>
+path_starts_with(
+    pct_string_view path,
+    pct_string_view prefix) noexcept;
+
+/** Return true if a path ends with another as if both were decoded
+
+    The paths are compared as if their
+    escapes were decoded, except for escapes
+    of the slash, "%2F", which are compared
+    literally so that they never match a
+    segment separator. Runs of characters
+    without escapes are compared several
+    bytes at a time, and escapes are only
+    decoded where the paths differ.
+
+    @par Example
+    @code
+    assert( *path_ends_with( "/static/%69ndex.html", "index.html" ) == 12 );
+    @endcode
+
+    @par Complexity
+    Linear in `suffix.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of characters of
+    `path` which match `suffix`, or an
+    empty optional if `path` does not
+    end with `suffix`.
+
+    @param path The percent-encoded path.
+
+    @param suffix The percent-encoded suffix.
+
+    @see
+        @ref path_starts_with.
+*/
+BOOST_URL_DECL
+boost::optional<std::size_t>
+path_ends_with(
+    pct_string_view path,
+    pct_string_view suffix) noexcept;
+
+//------------------------------------------------
+
+/** An index of path prefixes
+
+    This container holds path prefixes, each
+    with an identifier, such as the rules of
+    an access control list, and returns the
+    prefixes matching a path with a single
+    pass over its segments.
+
+    A prefix matches a path when its segments
+    are the first segments of the path,
+    compared as if escapes were decoded, so
+    "/api" matches "/api" and "/api/users"
+    but not "/apis". A trailing slash in a
+    prefix is ignored, and the prefix "/"
+    matches every path. Whether a path is
+    absolute is not considered, and dot
+    segments are compared literally, so
+    paths should be normalized first.
+
+    The prefixes are stored in a trie of
+    segments, whose edges are kept in a hash
+    table, so the cost of a lookup does not
+    depend on the number of prefixes.
+
+    @par Example
+    @code
+    path_prefix_index acl;
+    acl.insert( 1, "/" );
+    acl.insert( 2, "/api" );
+    acl.insert( 3, "/api/admin/" );
+    acl.insert( 4, "/static" );
+
+    std::vector< std::size_t > ids;
+    acl.match( "/api/admin/users", ids );
+    assert( ids == std::vector< std::size_t >({ 1, 2, 3 }) );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref path_starts_with.
+*/
+class path_prefix_index
+{
+public:
+    /** Constructor
+
+        Default constructed indexes
+        have no prefixes.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    path_prefix_index() noexcept = default;
+
+    /** Insert a prefix
+
+        The same prefix, and the same
+        identifier, may be inserted more
+        than once.
+
+        @par Complexity
+        Linear in `prefix.size()`, on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param id The identifier of the prefix.
+
+        @param prefix The percent-encoded prefix.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        std::size_t id,
+        pct_string_view prefix);
+
+    /** Remove a prefix
+
+        This function removes the entries
+        inserted with `id` and `prefix`.
+
+        @par Complexity
+        Linear in `prefix.size()` plus the
+        number of entries of the prefix,
+        on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of entries removed.
+
+        @param id The identifier of the prefix.
+
+        @param prefix The prefix it was
+        inserted with.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    erase(
+        std::size_t id,
+        pct_string_view prefix) noexcept;
+
+    /** Append the identifiers of the prefixes matching a path
+
+        The identifiers of the prefixes which
+        match `path` are appended to `ids`,
+        from the shortest prefix to the
+        longest. Identifiers of the same prefix
+        come in the order they were inserted.
+
+        @par Complexity
+        Linear in `path.size()` plus the
+        number of identifiers appended, on
+        average.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw. The
+        identifiers appended before an
+        exception are kept.
+
+        @return The number of identifiers
+        appended.
+
+        @param path The percent-encoded path.
+
+        @param ids The vector to which the
+        identifiers are appended.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        pct_string_view path,
+        std::vector<std::size_t>& ids) const;
+
+    /** Append the identifiers of the prefixes matching the path of a URL
+
+        @copydetails match(pct_string_view, std::vector<std::size_t>&) const
+    */
+    std::size_t
+    match(
+        url_view_base const& u,
+        std::vector<std::size_t>& ids) const
+    {
+        return match(u.encoded_path(), ids);
+    }
+
+    /** Return the number of prefixes
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return true if there are no prefixes
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+private:
+    struct node
+    {
+        std::size_t parent;
+        std::size_t hash;
+        std::size_t key;
+        std::size_t size;
+
+        // one more than the first and
+        // last entries, or zero
+        std::size_t first = 0;
+        std::size_t last = 0;
+    };
+
+    struct entry
+    {
+        std::size_t id;
+
+        // one more than the next entry
+        // of the node, or zero
+        std::size_t next = 0;
+    };
+
+    std::size_t
+    find(
+        std::size_t parent,
+        core::string_view seg,
+        std::size_t hash) const noexcept;
+
+    std::size_t
+    find(core::string_view prefix) const noexcept;
+
+    void rehash(std::size_t n);
+
+    // the root is the first node
+    std::vector<node> nodes_;
+    std::vector<entry> entries_;
+    // a node other than the root, or zero
+    std::vector<std::size_t> table_;
+    std::string keys_;
+    std::size_t size_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PUBLIC_SUFFIX_LIST_HPP
+#define BOOST_URL_PUBLIC_SUFFIX_LIST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A compiled Public Suffix List
+
+    The Public Suffix List enumerates the
+    domain suffixes under which internet
+    users can register names, such as
+    `com`, `co.uk` or `github.io`. This
+    container compiles the rules of a list
+    once, and then answers which part of a
+    host is its public suffix, and which
+    part is its registrable domain.
+
+    The rules are stored as a trie of
+    labels, read from the rightmost label
+    of a host. The children of every node
+    are found through a single hash table,
+    so a lookup takes time proportional to
+    the number of labels in the host and
+    does not allocate. Wildcard rules such
+    as `*.ck` and exception rules such as
+    `!www.ck` are handled as described by
+    the list's formal algorithm.
+
+    The compiled list is kept in a single
+    buffer, which is returned by @ref data.
+    The buffer can be saved and referenced
+    later by a @ref public_suffix_list_view,
+    without compiling the rules again.
+
+    @par Example
+    @code
+    public_suffix_list psl( read_file( "public_suffix_list.dat" ) );
+
+    url_view u( "https://www.example.co.uk/" );
+
+    assert( psl.public_suffix( u.encoded_host() ) == "co.uk" );
+    assert( psl.registrable_domain( u.encoded_host() ) == "example.co.uk" );
+    @endcode
+
+    @par Hosts
+    Hosts are compared label by label after
+    percent-decoding and ASCII case folding.
+    The list stores internationalized rules
+    in Unicode, so a host only matches them
+    when its labels are UTF-8. Punycode
+    labels (`xn--`) only match rules which
+    are also written in punycode. A trailing
+    dot in a host is ignored for matching
+    and kept in the results. The host should
+    be a registered name; IP addresses are
+    not treated specially.
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref public_suffix_list_view,
+        <a href="https://publicsuffix.org/list/"
+            >The Public Suffix List</a>
+*/
+class public_suffix_list
+{
+public:
+    /** Constructor
+
+        Default constructed lists have no
+        rules. The public suffix of a host
+        is then its rightmost label, as given
+        by the implicit `*` rule.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    public_suffix_list() noexcept = default;
+
+    /** Constructor
+
+        This function compiles the rules in
+        the contents of a file in the format
+        of `public_suffix_list.dat`. Each
+        line contains at most one rule, which
+        ends at the first whitespace. Empty
+        lines and lines starting with `//` are
+        ignored.
+
+        @par Complexity
+        Linear in `rules.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @throw system_error
+        The compiled list would exceed the
+        limits of the binary format.
+
+        @param rules The contents of the list
+    */
+    BOOST_URL_DECL
+    explicit
+    public_suffix_list(
+        core::string_view rules);
+
+    /** Return the binary image of the list
+
+        The returned string can be stored and
+        used to construct a
+        @ref public_suffix_list_view.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref public_suffix_list_view.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return view().data();
+    }
+
+    /** Return a view of the list
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    operator
+    public_suffix_list_view() const noexcept
+    {
+        return view();
+    }
+
+    /** Return the number of rules in the list
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return view().size();
+    }
+
+    /** Return true if the list has no rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return view().empty();
+    }
+
+    /** Return the public suffix of a host
+
+        The returned string views the end of
+        `host`. If the host has no labels,
+        the returned string is empty.
+
+        @par Example
+        @code
+        assert( psl.public_suffix( "www.example.com" ) == "com" );
+        @endcode
+
+        @par Complexity
+        Linear in `host.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param host The percent-encoded host
+    */
+    core::string_view
+    public_suffix(
+        pct_string_view host) const noexcept
+    {
+        return view().public_suffix(host);
+    }
+
+    /** Return the registrable domain of a host
+
+        The registrable domain is the public
+        suffix with one more label. The
+        returned string views the end of
+        `host`. If the host is itself a
+        public suffix, there is no registrable
+        domain and the returned string is
+        empty.
+
+        @par Example
+        @code
+        assert( psl.registrable_domain( "www.example.com" ) == "example.com" );
+        assert( psl.registrable_domain( "com" ) == "" );
+        @endcode
+
+        @par Complexity
+        Linear in `host.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param host The percent-encoded host
+    */
+    core::string_view
+    registrable_domain(
+        pct_string_view host) const noexcept
+    {
+        return view().registrable_domain(host);
+    }
+
+private:
+    public_suffix_list_view
+    view() const noexcept
+    {
+        return public_suffix_list_view(
+            data_, public_suffix_list_view::no_check{});
+    }
+
+    std::string data_;
+};
+
+} // urls
+} // boost
+
+#endif
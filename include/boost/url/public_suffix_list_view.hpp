@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PUBLIC_SUFFIX_LIST_VIEW_HPP
+#define BOOST_URL_PUBLIC_SUFFIX_LIST_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+class public_suffix_list;
+#endif
+
+/** A non-owning reference to a compiled Public Suffix List
+
+    Objects of this type refer to the binary
+    image of a compiled list, as returned by
+    @ref public_suffix_list::data. The image
+    is used in place: it is never parsed,
+    copied, or modified. This makes it
+    possible to compile the list once, store
+    the image in a file, and map that file
+    read-only into every process which needs
+    the list, without reading the text rules
+    again.
+
+    Ownership is not transferred; the caller
+    is responsible for ensuring that the
+    lifetime of the image extends until it
+    is no longer referenced.
+
+    @par Example
+    @code
+    // once, at build time
+    public_suffix_list psl( read_file( "public_suffix_list.dat" ) );
+    write_file( "public_suffix_list.bin", psl.data() );
+
+    // in each process
+    core::string_view image = map_file( "public_suffix_list.bin" );
+    public_suffix_list_view v( image );
+
+    assert( v.registrable_domain( "www.example.co.uk" ) == "example.co.uk" );
+    @endcode
+
+    @par Binary Format
+    All integers are 32-bit, little-endian
+    and unaligned, so the image can be shared
+    between platforms. The image starts with
+    a 24 byte header holding a signature, the
+    format version, the number of rules, the
+    number of trie nodes, the number of hash
+    table slots, and the size of the label
+    pool. The header is followed by the hash
+    table, with 16 bytes per slot, one byte
+    of flags per node, and the label pool.
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref public_suffix_list.
+*/
+class public_suffix_list_view
+{
+public:
+    /** Constructor
+
+        Default constructed views have no
+        rules. The public suffix of a host
+        is then its rightmost label, as given
+        by the implicit `*` rule.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    public_suffix_list_view() noexcept = default;
+
+    /** Constructor
+
+        This function references a compiled
+        list. Only the header of the image is
+        inspected; lookups check every index
+        they read against the sizes it gives,
+        so a damaged image can produce wrong
+        results but never reads outside of
+        `data`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `data` is not a compiled list of a
+        supported version.
+
+        @param data The binary image
+    */
+    BOOST_URL_DECL
+    explicit
+    public_suffix_list_view(
+        core::string_view data);
+
+    /** Return the binary image
+
+        The returned string can be stored and
+        later used to construct a view of the
+        same list.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    data() const noexcept;
+
+    /** Return the number of rules in the list
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return rules_;
+    }
+
+    /** Return true if the list has no rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return rules_ == 0;
+    }
+
+    /** Return the public suffix of a host
+
+        @copydoc public_suffix_list::public_suffix
+    */
+    BOOST_URL_DECL
+    core::string_view
+    public_suffix(
+        pct_string_view host) const noexcept;
+
+    /** Return the registrable domain of a host
+
+        @copydoc public_suffix_list::registrable_domain
+    */
+    BOOST_URL_DECL
+    core::string_view
+    registrable_domain(
+        pct_string_view host) const noexcept;
+
+private:
+    friend class public_suffix_list;
+
+    struct no_check {};
+
+    BOOST_URL_DECL
+    public_suffix_list_view(
+        core::string_view data,
+        no_check) noexcept;
+
+    std::size_t
+    suffix_labels(
+        core::string_view host) const noexcept;
+
+    std::uint32_t
+    find(
+        std::uint32_t parent,
+        core::string_view label) const noexcept;
+
+    char const* table_ = nullptr;
+    unsigned char const* nodes_ = nullptr;
+    char const* labels_ = nullptr;
+    std::uint32_t rules_ = 0;
+    std::uint32_t node_count_ = 0;
+    std::uint32_t table_size_ = 0;
+    std::uint32_t labels_size_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
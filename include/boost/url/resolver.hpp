@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RESOLVER_HPP
+#define BOOST_URL_RESOLVER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Resolves many references against one base URL
+
+    The function @ref resolve copies the base
+    into the destination and then edits it
+    for each reference, which can take several
+    allocations and moves of the characters.
+    This object keeps a copy of the base, and
+    of the base with a normalized path, so
+    that resolving each reference copies the
+    parts of the result from the base and
+    from the reference directly into the
+    destination, after a single reservation.
+
+    The result is the same as the result of
+    @ref url_base::resolve. The common cases
+    of absolute URLs, network-path references
+    such as "//host/path", absolute paths,
+    and references with only a query or a
+    fragment are written without editing.
+    Relative paths, which require merging
+    the paths, are resolved with
+    @ref url_base::resolve after reserving
+    the space for the result.
+
+    @par Example
+    @code
+    resolver r( url_view( "http://www.example.com/docs/index.htm?lang=en" ) );
+    url dest;
+
+    r.resolve( url_view( "/images/logo.png" ), dest );
+    assert( dest.buffer() == "http://www.example.com/images/logo.png" );
+
+    r.resolve( url_view( "#top" ), dest );
+    assert( dest.buffer() == "http://www.example.com/docs/index.htm?lang=en#top" );
+
+    r.resolve( url_view( "guide.htm" ), dest );
+    assert( dest.buffer() == "http://www.example.com/docs/guide.htm" );
+    @endcode
+
+    @par Specification
+    <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5"
+        >5. Reference Resolution (rfc3986)</a>
+
+    @see
+        @ref resolve,
+        @ref url_base::resolve.
+*/
+class resolver
+    : private detail::parts_base
+{
+public:
+    /** Constructor
+
+        The base URL is copied, so the
+        resolver does not reference it.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `! base.has_scheme()`
+
+        @param base The base URL, which
+        must contain a scheme.
+    */
+    BOOST_URL_DECL
+    explicit
+    resolver(url_view_base const& base);
+
+    /** Return the base URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_view
+    base() const noexcept
+    {
+        return base_;
+    }
+
+    /** Resolve a reference against the base URL
+
+        The result of resolving `ref` against
+        the base URL is placed into `dest`,
+        replacing its contents.
+
+        @par Postconditions
+        The contents of `dest` are the same as
+        the contents of `u` after the call to
+        `u.resolve( ref )`, where `u` is a
+        copy of `this->base()`.
+
+        @par Complexity
+        Linear in `this->base().size() + ref.size()`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param ref The URL reference to resolve
+
+        @param dest The container where the
+        result is written
+    */
+    BOOST_URL_DECL
+    void
+    resolve(
+        url_view_base const& ref,
+        url_base& dest) const;
+
+    /** Resolve a reference against the base URL
+
+        @par Effects
+        @code
+        url u;
+        this->resolve( ref, u );
+        return u;
+        @endcode
+
+        @par Complexity
+        Linear in `this->base().size() + ref.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ref The URL reference to resolve
+    */
+    url
+    resolve(url_view_base const& ref) const
+    {
+        url u;
+        resolve(ref, u);
+        return u;
+    }
+
+private:
+    struct part;
+
+    static
+    void
+    assign(
+        url_base& dest,
+        part const* p,
+        std::size_t n);
+
+    url base_;
+    url norm_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -13,12 +13,56 @@
 #include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
+#include <type_traits>
 
 namespace boost {
 namespace urls {
 
 namespace detail {
 
+template<class CharSet, class = void>
+struct has_scan_pct : std::false_type
+{
+};
+
+template<class CharSet>
+struct has_scan_pct<CharSet, decltype(
+    std::declval<CharSet const&>().scan_pct(
+        std::declval<char const*>(),
+        std::declval<char const*>(),
+        std::declval<std::size_t&>()),
+    void())> : std::true_type
+{
+};
+
+// Skip whole blocks of valid characters
+// and escapes when the character set
+// has a vectorized scan. The scalar loop
+// resumes where the scan stops.
+template<class CharSet>
+char const*
+scan_pct(
+    char const* it,
+    char const* end,
+    CharSet const& cs,
+    std::size_t& n,
+    std::true_type) noexcept
+{
+    return cs.scan_pct(it, end, n);
+}
+
+template<class CharSet>
+char const*
+scan_pct(
+    char const* it,
+    char const*,
+    CharSet const&,
+    std::size_t&,
+    std::false_type) noexcept
+{
+    return it;
+}
+
 template<class CharSet>
 auto
 parse_encoded(
@@ -29,7 +73,16 @@ parse_encoded(
 {
     auto const start = it;
     std::size_t n = 0;
-    char const* it0;
+    char const* it0 = scan_pct(
+        it, end, cs, n,
+        has_scan_pct<CharSet>{});
+    if(! it0)
+    {
+        // expected HEXDIG
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    it = it0;
 skip:
     it0 = it;
     it = grammar::find_if_not(
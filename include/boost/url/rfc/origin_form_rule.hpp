@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/url_view.hpp>
+#include <boost/url/grammar/charset.hpp>
 
 namespace boost {
 namespace urls {
@@ -61,6 +62,14 @@ struct origin_form_rule_t
         char const*& it,
         char const* end
             ) const noexcept;
+
+    // an absolute-path starts with "/"
+    constexpr
+    grammar::detail::ch_chars
+    first_chars() const noexcept
+    {
+        return { '/' };
+    }
 };
 
 constexpr origin_form_rule_t origin_form_rule{};
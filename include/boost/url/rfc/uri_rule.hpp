@@ -13,6 +13,7 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error_types.hpp>
 #include <boost/url/url_view.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
 
 namespace boost {
 namespace urls {
@@ -58,6 +59,14 @@ struct uri_rule_t
         char const* const end
             ) const noexcept ->
         system::result<value_type>;
+
+    // a scheme starts with ALPHA
+    constexpr
+    grammar::alpha_chars_t
+    first_chars() const noexcept
+    {
+        return {};
+    }
 };
 
 constexpr uri_rule_t uri_rule{};
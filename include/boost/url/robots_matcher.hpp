@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ROBOTS_MATCHER_HPP
+#define BOOST_URL_ROBOTS_MATCHER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A compiled group of robots.txt rules
+
+    This container holds the `Allow` and
+    `Disallow` rules of one group of a
+    robots.txt file, and tells whether a URL
+    may be fetched. A rule is a path pattern
+    in which `*` matches any sequence of
+    characters and a final `$` matches the
+    end of the URL. A rule matches a URL
+    when it matches a prefix of its path,
+    followed by its query if there is one.
+    Of the rules which match, the one with
+    the most characters wins, and an `Allow`
+    rule wins over a `Disallow` rule of the
+    same size. A URL which no rule matches
+    is allowed.
+
+    Rules and URLs are compared under
+    percent-encoding equivalence: an escaped
+    unreserved character, as in `%7E`, is
+    the same as the character itself, the
+    case of the hexadecimal digits of other
+    escapes does not matter, and characters
+    of a rule which are not allowed in a URL,
+    such as a space or UTF-8, are the same
+    as their escapes.
+
+    The rules are compiled into a single
+    automaton: a trie of their characters in
+    which each `*` is a node which loops on
+    any character. A match reads the path
+    and query once, following every rule at
+    once, and does not allocate unless more
+    than 64 states of the automaton are live
+    at the same time.
+
+    @par Example
+    @code
+    robots_matcher m;
+    m.disallow( "/private" );
+    m.allow( "/private/press*.html$" );
+    m.disallow( "*?sessionid=" );
+
+    assert( ! m.allowed( url_view( "https://example.com/private/x" ) ) );
+    assert( m.allowed( url_view( "https://example.com/private/press-2023.html" ) ) );
+    assert( ! m.allowed( url_view( "https://example.com/a?sessionid=1" ) ) );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc9309#section-2.2.2"
+        >2.2.2. The "Allow" and "Disallow" Lines (rfc9309)</a>
+*/
+class robots_matcher
+{
+public:
+    /** Constructor
+
+        Default constructed matchers have
+        no rules, and allow every URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    robots_matcher() noexcept = default;
+
+    /** Add an `Allow` rule
+
+        An empty pattern is ignored.
+
+        @par Complexity
+        Linear in `pattern.size()`, on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param pattern The path pattern.
+    */
+    BOOST_URL_DECL
+    void
+    allow(core::string_view pattern);
+
+    /** Add a `Disallow` rule
+
+        An empty pattern is ignored, as it
+        disallows nothing.
+
+        @par Complexity
+        Linear in `pattern.size()`, on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param pattern The path pattern.
+    */
+    BOOST_URL_DECL
+    void
+    disallow(core::string_view pattern);
+
+    /** Return true if a URL may be fetched
+
+        The path of the URL, or `"/"` if it is
+        empty, followed by its query, is
+        matched against the rules.
+
+        @par Complexity
+        Linear in the size of the path and
+        query times the number of live states,
+        which is the number of rules matching
+        the characters read so far.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The URL to check.
+    */
+    BOOST_URL_DECL
+    bool
+    allowed(
+        url_view_base const& u) const;
+
+    /** Return true if a request target may be fetched
+
+        @par Example
+        @code
+        assert( m.allowed( "/index.html?page=2" ) );
+        @endcode
+
+        @par Complexity
+        The same as the overload which
+        takes a URL.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param target The path of the URL,
+        optionally followed by `"?"` and
+        its query.
+    */
+    BOOST_URL_DECL
+    bool
+    allowed(
+        pct_string_view target) const;
+
+    /** Return the number of rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return true if there are no rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+private:
+    struct node
+    {
+        // the node reached through
+        // a '*', zero if none
+        std::uint32_t star = 0;
+
+        // true if this node was
+        // reached through a '*'
+        bool loop = false;
+
+        // twice the size of the longest
+        // rule ending here, plus one if
+        // it allows, or zero. end is for
+        // rules ending with '$'
+        std::size_t score = 0;
+        std::size_t end = 0;
+    };
+
+    struct edge
+    {
+        // zero if empty
+        std::uint32_t child = 0;
+        std::uint32_t parent = 0;
+        unsigned char c = 0;
+    };
+
+    class state;
+
+    void insert(core::string_view, bool);
+    std::uint32_t child(
+        std::uint32_t parent,
+        unsigned char c) const noexcept;
+    std::uint32_t add(
+        std::uint32_t parent,
+        unsigned char c);
+    void rehash(std::size_t n);
+
+    std::vector<node> nodes_;
+    std::vector<edge> table_;
+    std::size_t edges_ = 0;
+    std::size_t size_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
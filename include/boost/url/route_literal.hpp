@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ROUTE_LITERAL_HPP
+#define BOOST_URL_ROUTE_LITERAL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/parse_route_literal.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A router path template checked in a constant expression
+
+    Objects of this type hold a path template
+    for a @ref router, such as
+    `/user/{id}/files/{path+}`, and the number
+    of its replacement fields. Declared
+    `constexpr`, the template is checked by
+    the compiler: a template which
+    @ref router::insert would reject is a
+    compile error, and the number of fields
+    can size a @ref matches_storage.
+
+    This requires a compiler with relaxed
+    `constexpr` support (C++14 or later).
+    Otherwise the template is checked at run
+    time when the object is constructed.
+
+    The object references the characters of
+    the string, which should be a string
+    literal or otherwise outlive it.
+
+    @par Example
+    @code
+    constexpr route_literal files( "/user/{id}/files/{path+}" );
+    static_assert( files.fields() == 2, "" );
+
+    router< int > r;
+    r.insert( files, 1 );
+
+    matches_storage< files.fields() > m;
+    r.find( parse_path( "/user/42/files/a/b" ).value(), m );
+    assert( m[1] == "a/b" );
+    @endcode
+
+    @see
+        @ref matches_storage,
+        @ref router.
+*/
+class route_literal
+{
+public:
+    /** Constructor
+
+        Default constructed literals
+        refer to an empty template.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    route_literal() noexcept = default;
+
+    /** Constructor
+
+        This function checks a string literal
+        as a path template. In a constant
+        expression, an invalid template fails
+        to compile.
+
+        @par Complexity
+        Linear in `N`.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid path template.
+
+        @param s The string literal to check.
+    */
+    template<std::size_t N>
+    BOOST_CXX14_CONSTEXPR
+    explicit
+    route_literal(
+        char const(&s)[N])
+        : route_literal(
+            core::string_view(s, N - 1))
+    {
+    }
+
+    /** Constructor
+
+        This function checks a string as a
+        path template. In a constant
+        expression, an invalid template fails
+        to compile.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid path template.
+
+        @param s The string to check.
+    */
+    BOOST_CXX14_CONSTEXPR
+    explicit
+    route_literal(
+        core::string_view s)
+        : s_(s.data())
+        , n_(s.size())
+    {
+        if(! detail::literal::parse_route(
+                s_, s_ + n_, fields_))
+            detail::throw_invalid_argument();
+    }
+
+    /** Return the string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    core::string_view
+    buffer() const noexcept
+    {
+        return core::string_view(s_, n_);
+    }
+
+    /** Return the number of replacement fields
+
+        This is the largest number of matches
+        which @ref router::find can return for
+        this template.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    std::size_t
+    fields() const noexcept
+    {
+        return fields_;
+    }
+
+private:
+    char const* s_ = "";
+    std::size_t n_ = 0;
+    std::size_t fields_ = 0;
+};
+
+} // urls
+} // boost
+
+#endif
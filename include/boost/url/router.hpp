@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ROUTER_HPP
+#define BOOST_URL_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse_path.hpp>
+#include <boost/url/detail/router.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/url/route_literal.hpp>
+
+namespace boost {
+namespace urls {
+
+/** A URL router.
+
+    This container matches static and dynamic
+    URL requests to an object which represents
+    how the it should be handled. These
+    values are usually callback functions.
+
+    The inserted path templates are stored
+    as a tree with one node per segment.
+    The literal children of a node are
+    kept sorted, so a request segment is
+    looked up with a binary search, and the
+    replacement fields are tried afterwards
+    in order of precedence: `{id}`, `{id?}`,
+    `{id*}` and `{id+}`. The cost of
+    @ref find depends on the length of the
+    request and the fields along the way,
+    not on the number of templates, and it
+    does not allocate.
+
+    @tparam T type of resource associated with
+    each path template
+
+    @tparam N maximum number of replacement fields
+    in a path template
+
+    @par Exception Safety
+
+    @li Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref parse_absolute_uri,
+        @ref parse_relative_ref,
+        @ref parse_uri,
+        @ref parse_uri_reference,
+        @ref resolve.
+*/
+template <class T>
+class router
+    : private detail::router_base
+{
+public:
+    /// Constructor
+    router() = default;
+
+    /** Route the specified URL path to a resource
+
+        @param path A url path with dynamic segments
+        @param resource A resource the path corresponds to
+
+        @see
+            https://fmt.dev/latest/syntax.html
+     */
+    template <class U>
+    void
+    insert(core::string_view pattern, U&& v);
+
+    /** Route a checked path template to a resource
+
+        The template was checked when the
+        @ref route_literal was constructed,
+        so this function only throws when
+        allocation fails.
+
+        @param pattern A path template
+        @param v A resource the path corresponds to
+
+        @see
+            @ref route_literal.
+     */
+    template <class U>
+    void
+    insert(route_literal const& pattern, U&& v)
+    {
+        insert(pattern.buffer(), std::forward<U>(v));
+    }
+
+    /** Match URL path to corresponding resource
+
+        @param request Request path
+        @return The match results
+     */
+    T const*
+    find(segments_encoded_view path, matches_base& m) const noexcept;
+
+#ifdef BOOST_URL_DOCS
+    /// @copydoc find
+    T const*
+    find(segments_encoded_view path, matches& m) const noexcept;
+#endif
+
+    /** Match many URL paths to their resources
+
+        This function has the same effect as
+        calling @ref find for each path, with
+        `results[i] = find( paths[i], m[i] )`.
+        The paths are walked through the tree
+        of templates together, a few at a
+        time, and the nodes each path visits
+        next are prefetched while the others
+        are matched. When the tree is larger
+        than the cache, this hides much of the
+        latency of following each path alone.
+
+        @par Example
+        @code
+        router< int > r;
+        r.insert( "user/{id}", 1 );
+        r.insert( "help", 2 );
+
+        segments_encoded_view paths[] = {
+            parse_path( "user/42" ).value(),
+            parse_path( "help" ).value(),
+            parse_path( "nope" ).value() };
+        int const* results[3];
+        matches m[3];
+        std::size_t n = r.find_many( paths, 3, results, m );
+        assert( n == 2 );
+        assert( *results[0] == 1 && m[0][0] == "42" );
+        assert( results[2] == nullptr );
+        @endcode
+
+        @par Complexity
+        Linear in the total size of the paths.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of paths which
+        matched a resource.
+
+        @param paths The request paths.
+
+        @param n The number of paths, and of
+        elements in `results` and `m`.
+
+        @param results The resource of each
+        path, or null if it has none.
+
+        @param m The match results of each path.
+     */
+    template <std::size_t N>
+    std::size_t
+    find_many(
+        segments_encoded_view const* paths,
+        std::size_t n,
+        T const** results,
+        matches_storage<N>* m) const noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/router.hpp>
+
+#endif
+
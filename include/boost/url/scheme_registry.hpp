@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SCHEME_REGISTRY_HPP
+#define BOOST_URL_SCHEME_REGISTRY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A set of schemes defined by the application
+
+    The enumeration @ref scheme only identifies
+    a few well-known schemes. This container
+    holds additional schemes, along with their
+    default ports, and finds them in strings
+    which are not normalized.
+
+    Schemes of up to eight characters are
+    packed into an integer when they are
+    inserted. A lookup packs the string being
+    searched for in the same way and compares
+    it with each scheme in a single
+    operation, ignoring case.
+
+    @par Example
+    @code
+    scheme_registry r;
+    r.insert( "s3" );
+    r.insert( "kafka", 9092 );
+    r.insert( "grpc", 443 );
+
+    url_view u( "KAFKA://broker/topic" );
+    assert( r.contains( u.scheme() ) );
+    assert( r.default_port( u.scheme() ) == 9092 );
+    @endcode
+
+    @see
+        @ref scheme,
+        @ref string_to_scheme.
+*/
+class scheme_registry
+{
+public:
+    /** The value returned when a scheme is not found
+    */
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    /** Constructor
+
+        Default constructed registries
+        contain no schemes.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    scheme_registry() noexcept = default;
+
+    /** Insert a scheme
+
+        The scheme is added to the registry, or
+        its default port is replaced if the
+        registry already contains it. The
+        comparison ignores case, and the
+        scheme is stored in lowercase.
+
+        @par Example
+        @code
+        scheme_registry r;
+        assert( r.insert( "hdfs", 8020 ) == 0 );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid scheme.
+
+        @return The index of the scheme
+
+        @param s The scheme
+
+        @param port The default port, or
+        zero if there is none.
+
+        @par BNF
+        @code
+        scheme      = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
+        @endcode
+    */
+    BOOST_URL_DECL
+    std::size_t
+    insert(
+        core::string_view s,
+        std::uint16_t port = 0);
+
+    /** Return the index of a scheme
+
+        This function returns the index of
+        the scheme which matches `s` ignoring
+        case, or @ref npos if there is none.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The scheme to find
+    */
+    BOOST_URL_DECL
+    std::size_t
+    find(core::string_view s) const noexcept;
+
+    /** Return true if the registry contains a scheme
+
+        @par Effects
+        @code
+        return this->find( s ) != npos;
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The scheme to find
+    */
+    bool
+    contains(core::string_view s) const noexcept
+    {
+        return find(s) != npos;
+    }
+
+    /** Return the default port of a scheme
+
+        This function returns the port which
+        was inserted with the scheme matching
+        `s`, or zero if there is no such scheme.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The scheme to find
+    */
+    BOOST_URL_DECL
+    std::uint16_t
+    default_port(core::string_view s) const noexcept;
+
+    /** Return the scheme at an index
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The index of the scheme
+    */
+    core::string_view
+    name(std::size_t i) const noexcept
+    {
+        return v_[i].name;
+    }
+
+    /** Return the number of schemes
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return true if there are no schemes
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+private:
+    struct entry
+    {
+        // zero when the name is
+        // too long to be packed
+        std::uint64_t key = 0;
+        std::uint64_t mask = 0;
+        std::string name;
+        std::uint16_t port = 0;
+    };
+
+    std::vector<entry> v_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -15,7 +15,9 @@
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <boost/url/detail/url_impl.hpp>
+#include <cstdint>
 #include <iosfwd>
+#include <vector>
 
 namespace boost {
 namespace urls {
@@ -305,10 +307,108 @@ public:
     BOOST_URL_DECL
     iterator
     end() const noexcept;
+
+    /** Compute the hash of each segment
+
+        This function writes the
+        @ref segment_hash of each decoded
+        segment to `dest`, in order, in one
+        pass over the path. Segments which
+        are equal once decoded have the
+        same hash, so `"%7E"` and `"~"` hash
+        the same. At most `n` hashes are
+        written.
+
+        @par Example
+        @code
+        std::uint32_t h[3];
+        url_view u( "/a/%7E/~" );
+        u.encoded_segments().hashes( h, 3 );
+        assert( h[1] == h[2] && h[1] == segment_hash( "~" ) );
+        @endcode
+
+        @par Complexity
+        Linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of segments,
+        which is the number of hashes
+        written when it is not above `n`.
+
+        @param dest The array to write to
+
+        @param n The size of the array
+
+        @see
+            @ref segment_hash.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    hashes(
+        std::uint32_t* dest,
+        std::size_t n) const noexcept;
+
+    /** Return the hash of each segment
+
+        @par Effects
+        @code
+        std::vector< std::uint32_t > v( this->size() );
+        this->hashes( v.data(), v.size() );
+        return v;
+        @endcode
+
+        @par Complexity
+        Linear in `this->buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @see
+            @ref segment_hash.
+    */
+    BOOST_URL_DECL
+    std::vector<std::uint32_t>
+    hashes() const;
 };
 
 //------------------------------------------------
 
+/** Return the hash of a decoded segment
+
+    This function returns the CRC32C of
+    the characters of the string, which
+    is the hash returned for a segment
+    with the same decoded value by
+    @ref segments_encoded_base::hashes.
+    Tables built from plain strings can
+    thus be looked up with the hashes of
+    the segments of a URL.
+
+    The CRC32 instructions of SSE4.2 or
+    ARMv8 are used when available.
+
+    @par Example
+    @code
+    assert( segment_hash( "~" ) == url_view( "/%7e" ).encoded_segments().hashes()[0] );
+    @endcode
+
+    @par Complexity
+    Linear in `s.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param s The decoded segment
+*/
+BOOST_URL_DECL
+std::uint32_t
+segment_hash(
+    core::string_view s) noexcept;
+
+//------------------------------------------------
+
 /** Format to an output stream
 
     Any percent-escapes are emitted as-is;
@@ -0,0 +1,392 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SHARED_URL_HPP
+#define BOOST_URL_SHARED_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** An immutable URL with a shared, reference counted buffer
+
+    Objects of this type own a copy of a
+    valid URL, like @ref url, but the
+    characters can not be modified and are
+    shared by all the copies of the object.
+    Copying only increments a reference
+    count, so a URL can be handed to many
+    consumers, such as a logger, a cache
+    and an upstream client, without copying
+    its characters each time.
+
+    The reference count is atomic. Copies
+    can be used and destroyed concurrently
+    from different threads, while the same
+    object must not be assigned concurrently
+    with other uses of it.
+
+    To modify the URL, construct a @ref url
+    from it, which copies the characters.
+
+    @par Example
+    @code
+    shared_url u( "https://www.example.com/index.htm?q=1" );
+    shared_url u2 = u;
+    assert( u2.buffer().data() == u.buffer().data() );
+
+    url u3 = u.to_url();
+    u3.set_query( "q=2" );
+    @endcode
+
+    @par BNF
+    @code
+    URI-reference = URI / relative-ref
+
+    URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+
+    relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @see
+        @ref url,
+        @ref url_view.
+*/
+class BOOST_URL_DECL shared_url
+    : public url_view_base
+{
+    struct rep;
+
+    rep* p_ = nullptr;
+
+    friend std::hash<shared_url>;
+    using url_view_base::digest;
+
+public:
+    //--------------------------------------------
+    //
+    // Special Members
+    //
+    //--------------------------------------------
+
+    /** Destructor
+
+        The reference count is decremented, and
+        the characters are released when this
+        was the last object referencing them.
+        Views which reference the characters
+        remain valid while other copies of
+        this object exist.
+    */
+    ~shared_url();
+
+    /** Constructor
+
+        Default constructed urls contain a
+        zero-length string. No memory is
+        allocated.
+
+        @par Postconditions
+        @code
+        this->empty() == true
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    shared_url() noexcept;
+
+    /** Constructor
+
+        This function constructs a url from
+        the string `s`, which must contain a
+        valid <em>URI</em> or <em>relative-ref</em>
+        or else an exception is thrown.
+        The new url retains ownership by
+        making a copy of the passed string.
+
+        @par Example
+        @code
+        shared_url u( "https://www.example.com" );
+        @endcode
+
+        @par Effects
+        @code
+        return shared_url( parse_uri_reference( s ).value() );
+        @endcode
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input does not contain a valid url.
+
+        @param s The string to parse.
+    */
+    explicit
+    shared_url(core::string_view s);
+
+    /** Constructor
+
+        The characters of `u` are copied
+        into a new shared buffer.
+
+        @par Postconditions
+        @code
+        this->buffer() == u.buffer() && this->buffer().data() != u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The url to copy.
+    */
+    shared_url(url_view_base const& u);
+
+    /** Constructor
+
+        The new object shares the
+        characters of `u`.
+
+        @par Postconditions
+        @code
+        this->buffer().data() == u.buffer().data()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to share.
+    */
+    shared_url(shared_url const& u) noexcept;
+
+    /** Constructor
+
+        The characters of `u` are transferred
+        to the new object, without changing
+        the reference count. After construction,
+        the moved-from object is as if default
+        constructed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to move from.
+    */
+    shared_url(shared_url&& u) noexcept;
+
+    /** Assignment
+
+        This object shares the characters of
+        `u`, and releases its previous ones.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to share.
+    */
+    shared_url&
+    operator=(shared_url const& u) noexcept;
+
+    /** Assignment
+
+        The characters of `u` are transferred
+        to this object, which releases its
+        previous ones. After assignment, the
+        moved-from object is as if default
+        constructed.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The url to move from.
+    */
+    shared_url&
+    operator=(shared_url&& u) noexcept;
+
+    /** Assignment
+
+        The characters of `u` are copied
+        into a new shared buffer, and the
+        previous ones are released.
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The url to copy.
+    */
+    shared_url&
+    operator=(url_view_base const& u);
+
+    //--------------------------------------------
+    //
+    // Observers
+    //
+    //--------------------------------------------
+
+    /** Return the number of objects sharing the characters
+
+        The value is zero for urls which
+        do not own a buffer, such as default
+        constructed ones. With concurrent
+        copies, the value is approximate.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    use_count() const noexcept;
+
+    /** Return a modifiable copy of the url
+
+        @par Effects
+        @code
+        return url( *this );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    url
+    to_url() const
+    {
+        return url(*this);
+    }
+
+    /** Return the maximum number of characters possible
+
+        This represents the largest number of
+        characters that are possible in a url,
+        not including any null terminator.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    static
+    constexpr
+    std::size_t
+    max_size() noexcept
+    {
+        return BOOST_URL_MAX_SIZE;
+    }
+
+    //--------------------------------------------
+
+    /** Swap the contents
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The object to swap with
+    */
+    void
+    swap(shared_url& other) noexcept;
+
+    /** Swap
+
+        @par Effects
+        @code
+        v0.swap( v1 );
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param v0, v1 The objects to swap
+    */
+    friend
+    void
+    swap(shared_url& v0, shared_url& v1) noexcept
+    {
+        v0.swap(v1);
+    }
+
+private:
+    void release() noexcept;
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<>
+struct hash< ::boost::urls::shared_url >
+{
+    hash() = default;
+    hash(hash const&) = default;
+    hash& operator=(hash const&) = default;
+
+    explicit
+    hash(std::size_t salt) noexcept
+        : salt_(salt)
+    {
+    }
+
+    std::size_t
+    operator()(::boost::urls::shared_url const& u) const noexcept
+    {
+        return u.digest(salt_);
+    }
+
+private:
+    std::size_t salt_ = 0;
+};
+} // std
+#endif
+
+#endif
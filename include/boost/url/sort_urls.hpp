@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SORT_URLS_HPP
+#define BOOST_URL_SORT_URLS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Sort strings in the order of their bytes
+
+    The strings are sorted with a most
+    significant digit radix sort, in the
+    order of `std::memcmp` on their bytes,
+    with a string sorting before the strings
+    it is a prefix of. This is the order of
+    the sort keys returned by
+    @ref url_view_base::sort_key.
+
+    When `threads` is not 1, the strings are
+    split into buckets on their leading bytes
+    until there are enough buckets to share,
+    and the buckets are then sorted by a pool
+    of threads. Only the views are moved;
+    the characters they reference are not
+    modified.
+
+    @par Example
+    @code
+    std::vector< core::string_view > v = { "b", "ab", "a" };
+    radix_sort_keys( v.data(), v.data() + v.size() );
+    assert( v[0] == "a" && v[1] == "ab" && v[2] == "b" );
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the
+    distinguishing prefixes of the strings.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+    If an exception is thrown, the range
+    is left in an unspecified order.
+
+    @param first The first string to sort.
+
+    @param last One past the last
+    string to sort.
+
+    @param threads The number of threads
+    to use. If this is zero, the number
+    returned by
+    `std::thread::hardware_concurrency`
+    is used. When the library is compiled
+    with `BOOST_URL_DISABLE_THREADS`, the
+    sort always runs on the calling thread.
+
+    @see
+        @ref sort_urls,
+        @ref url_view_base::sort_key.
+*/
+BOOST_URL_DECL
+void
+radix_sort_keys(
+    core::string_view* first,
+    core::string_view* last,
+    std::size_t threads = 0);
+
+/** Sort URLs in the order of compare
+
+    The URLs are sorted in the order of
+    @ref url_view_base::compare, as if each
+    were normalized. The sort key of each
+    URL is computed once, and the keys are
+    sorted with @ref radix_sort_keys, so the
+    components are not decoded again for
+    each comparison. The sort is stable.
+
+    @par Example
+    @code
+    std::vector< url_view > v = {
+        url_view( "http://www.b.com" ),
+        url_view( "HTTP://www.A.com/x/../y" ),
+        url_view( "http://www.a.com" ) };
+    sort_urls( v.begin(), v.end() );
+    assert( v[0] == url_view( "http://www.a.com" ) );
+    assert( v[1] == url_view( "http://www.a.com/y" ) );
+    @endcode
+
+    @par Constraints
+    The elements are convertible to
+    `url_view_base const&`, and are
+    move constructible and move assignable.
+
+    @par Complexity
+    Linear in the total size of the URLs.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+    If an exception is thrown, the range
+    is left in an unspecified order.
+
+    @param first An iterator to the
+    first URL to sort.
+
+    @param last An iterator to one
+    past the last URL to sort.
+
+    @param threads The number of threads
+    to use, as in @ref radix_sort_keys.
+
+    @see
+        @ref radix_sort_keys,
+        @ref url_view_base::compare,
+        @ref url_view_base::sort_key.
+*/
+template<class RandomIt>
+void
+sort_urls(
+    RandomIt first,
+    RandomIt last,
+    std::size_t threads = 0);
+
+} // urls
+} // boost
+
+#include <boost/url/impl/sort_urls.hpp>
+
+#endif
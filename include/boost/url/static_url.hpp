@@ -64,6 +64,7 @@ class BOOST_URL_DECL
     void clear_impl() noexcept override;
     void reserve_impl(std::size_t, op_t&) override;
     void cleanup(op_t&) override;
+    std::size_t max_capacity_impl() const noexcept override;
 
     void
     copy(url_view_base const& u)
@@ -164,7 +165,7 @@ public:
     */
     static_url() noexcept
         : static_url_base(
-            buf_, sizeof(buf_))
+            buf_, Capacity)
     {
     }
 
@@ -218,7 +219,7 @@ public:
     static_url(
         core::string_view s)
         : static_url_base(
-            buf_, sizeof(buf_), s)
+            buf_, Capacity, s)
     {
     }
 
@@ -421,6 +422,8 @@ public:
 
     /// @copydoc url_base::normalize
     static_url& normalize() { url_base::normalize(); return *this; }
+    /// @copydoc url_base::normalize(parse_options const&)
+    system::result<void> normalize(parse_options const& opt) { return url_base::normalize(opt); }
     /// @copydoc url_base::normalize_scheme
     static_url& normalize_scheme() { url_base::normalize_scheme(); return *this; }
     /// @copydoc url_base::normalize_authority
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_STATS_HPP
+#define BOOST_URL_STATS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Counters of the work done by the library
+
+    These counters describe the memory
+    allocated by containers such as @ref url,
+    the reuse of the recycled instances used
+    by temporary storage, and the number of
+    URLs parsed. They are meant to be read
+    periodically from a running program and
+    forwarded to a metrics system.
+
+    The counters are only updated when the
+    library and the code which uses it are
+    compiled with the macro
+    `BOOST_URL_ENABLE_STATS` defined.
+    Otherwise the hooks are empty functions,
+    which cost nothing, and every counter
+    stays zero.
+
+    @par Example
+    @code
+    url_stats prev = get_url_stats();
+    for(;;)
+    {
+        std::this_thread::sleep_for( std::chrono::seconds(10) );
+        url_stats cur = get_url_stats();
+        metrics.gauge( "url.allocations", cur.allocations - prev.allocations );
+        metrics.gauge( "url.parse_calls", cur.parse_calls - prev.parse_calls );
+        prev = cur;
+    }
+    @endcode
+
+    @see
+        @ref get_url_stats,
+        @ref reset_url_stats,
+        @ref url_stats_enabled.
+*/
+struct url_stats
+{
+    /** The number of buffers allocated by urls
+
+        This counts the buffers of @ref url
+        and @ref basic_url. A @ref static_url
+        never allocates.
+    */
+    std::size_t allocations = 0;
+
+    /** The number of buffers deallocated by urls
+    */
+    std::size_t deallocations = 0;
+
+    /** The total number of bytes allocated by urls
+    */
+    std::size_t bytes_allocated = 0;
+
+    /** The number of times a url grew its buffer
+
+        This counts the calls to `reserve_impl`
+        which replaced an existing buffer with
+        a larger one, and copied the contents.
+    */
+    std::size_t reallocations = 0;
+
+    /** The number of recycled instances reused
+    */
+    std::size_t recycled_hits = 0;
+
+    /** The number of recycled instances allocated
+    */
+    std::size_t recycled_misses = 0;
+
+    /** The number of calls to the parse functions
+
+        This counts the calls to
+        @ref parse_absolute_uri,
+        @ref parse_origin_form,
+        @ref parse_relative_ref,
+        @ref parse_uri, and
+        @ref parse_uri_reference, and each
+        string of a batch parse.
+    */
+    std::size_t parse_calls = 0;
+
+    /** The number of parse calls which failed
+    */
+    std::size_t parse_errors = 0;
+};
+
+/** Return the current values of the counters
+
+    The counters are updated with relaxed
+    atomic operations: each one is exact,
+    but the values of different counters
+    may be read at slightly different times.
+
+    @par Thread Safety
+    May be called concurrently.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref reset_url_stats,
+        @ref url_stats.
+*/
+BOOST_URL_DECL
+url_stats
+get_url_stats() noexcept;
+
+/** Set every counter to zero
+
+    @par Thread Safety
+    May be called concurrently; updates
+    which happen at the same time may be
+    lost.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @see
+        @ref get_url_stats,
+        @ref url_stats.
+*/
+BOOST_URL_DECL
+void
+reset_url_stats() noexcept;
+
+/** Return true if the counters are updated
+
+    This is true when the calling code was
+    compiled with `BOOST_URL_ENABLE_STATS`
+    defined.
+*/
+constexpr
+bool
+url_stats_enabled() noexcept
+{
+#ifdef BOOST_URL_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // urls
+} // boost
+
+#endif
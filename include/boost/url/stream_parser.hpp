@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_STREAM_PARSER_HPP
+#define BOOST_URL_STREAM_PARSER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/stream_target.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/type_traits.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+/** An incremental parser for URLs which arrive in pieces
+
+    This parser accepts the characters of a
+    URL in consecutive chunks, such as the
+    payloads of the TCP segments carrying an
+    HTTP request line. It keeps its state
+    between calls to @ref write, and rejects
+    invalid percent-escapes as soon as they
+    are seen. The URL ends at the first
+    character which can not appear in any
+    URL, such as the space after an HTTP
+    request-target, or at the call to
+    @ref finish.
+
+    Once the URL is complete, @ref finish
+    applies `Rule` to it and returns the same
+    @ref url_view that @ref grammar::parse
+    returns for the same characters.
+
+    @par Storage
+    A @ref url_view refers to contiguous
+    characters. When the URL is complete
+    within a single chunk, the view returned
+    by @ref finish refers to that chunk and
+    nothing is copied. Otherwise, the parser
+    collects the characters in storage it
+    owns, which is reused after @ref reset.
+    A chunk is never referenced after the
+    call to @ref write which received it
+    unless it completed the URL, so the caller
+    may reuse the memory of earlier chunks.
+
+    @par Example
+    @code
+    stream_parser< origin_form_rule_t > p;
+
+    p.write( "/path/to/fi" );
+    p.write( "le.txt?id=42 HTTP/1.1\r\n" );
+    assert( p.done() );
+
+    system::result< url_view > rv = p.finish();
+    assert( rv->encoded_path() == "/path/to/file.txt" );
+    @endcode
+
+    @tparam Rule The rule used to parse the
+    URL, such as @ref origin_form_rule or
+    @ref uri_reference_rule. The value type
+    of the rule must be @ref url_view.
+
+    @see
+        @ref grammar::parse,
+        @ref origin_form_rule,
+        @ref uri_reference_rule.
+*/
+template<class Rule>
+class stream_parser
+{
+    static_assert(
+        grammar::is_rule<Rule>::value,
+        "Rule requirements not met");
+
+    static_assert(
+        std::is_same<
+            typename Rule::value_type,
+            url_view>::value,
+        "Rule must produce a url_view");
+
+    detail::stream_target t_;
+    Rule r_;
+
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param r The rule used to parse
+        the URL
+    */
+    explicit
+    stream_parser(
+        Rule const& r = {}) noexcept
+        : r_(r)
+    {
+    }
+
+    /** Constructor (deleted)
+    */
+    stream_parser(
+        stream_parser const&) = delete;
+
+    /** Assignment (deleted)
+    */
+    stream_parser& operator=(
+        stream_parser const&) = delete;
+
+    /** Return true if the end of the URL was found
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    done() const noexcept
+    {
+        return t_.done();
+    }
+
+    /** Return the number of characters of the URL received
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return t_.size();
+    }
+
+    /** Parse the next chunk of the URL
+
+        This function consumes characters
+        from `s` up to the end of the URL.
+        When the URL ended in a previous
+        chunk, nothing is consumed.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The number of characters
+        consumed, or an error if an invalid
+        percent-escape was found. Once an
+        error occurs, the same error is
+        returned until @ref reset is called.
+
+        @param s The next characters
+    */
+    system::result<std::size_t>
+    write(core::string_view s)
+    {
+        return t_.write(s);
+    }
+
+    /** Parse the complete URL
+
+        This function marks the end of the
+        URL, if it was not found yet, and
+        applies the rule to it. The returned
+        view remains valid until the parser
+        is reset or destroyed, and, when the
+        URL arrived in a single chunk, while
+        that chunk is valid.
+
+        @par Complexity
+        Linear in @ref size.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The parsed URL, or an error
+        if the rule does not match the URL.
+    */
+    system::result<url_view>
+    finish() noexcept
+    {
+        auto rv = t_.finish();
+        if(! rv)
+            return rv.error();
+        return grammar::parse(*rv, r_);
+    }
+
+    /** Prepare the parser for a new URL
+
+        The storage used for URLs which
+        arrived in several chunks is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    reset() noexcept
+    {
+        t_.reset();
+    }
+};
+
+} // urls
+} // boost
+
+#endif
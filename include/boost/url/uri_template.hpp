@@ -0,0 +1,646 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URI_TEMPLATE_HPP
+#define BOOST_URL_URI_TEMPLATE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** The value of a variable of a URI template
+
+    A value is undefined, a string, a list
+    of strings, or a list of key and value
+    pairs. Lists and pairs reference the
+    container they are made from, which
+    must remain valid while the value is
+    used.
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6570#section-2.3"
+        >2.3. Variables (rfc6570)</a>
+
+    @see
+        @ref uri_template.
+*/
+class template_value
+{
+public:
+    /** The kind of a value
+    */
+    enum kind_t : unsigned char
+    {
+        /// The variable is not defined
+        undefined,
+
+        /// A string
+        string,
+
+        /// A list of strings
+        list,
+
+        /// A list of key and value pairs
+        map
+    };
+
+    /** Constructor
+
+        Default constructed values
+        are undefined.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    template_value() noexcept = default;
+
+    /** Constructor
+
+        The value is the string `s`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The string.
+    */
+    template_value(
+        core::string_view s) noexcept
+        : s_(s)
+        , kind_(string)
+    {
+    }
+
+    /** Constructor
+
+        The value is the string `s`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The null-terminated string.
+    */
+    template_value(
+        char const* s) noexcept
+        : template_value(
+            core::string_view(s))
+    {
+    }
+
+    /** Constructor
+
+        The value is the string `s`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The string.
+    */
+    template_value(
+        std::string const& s) noexcept
+        : template_value(
+            core::string_view(s))
+    {
+    }
+
+    /** Return a list value
+
+        The elements of `c` are the strings
+        of the list. `c` must have `size()`
+        and `operator[]`, and its elements
+        must be convertible to
+        `core::string_view`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param c The container of strings.
+    */
+    template<class Container>
+    static
+    template_value
+    make_list(Container const& c) noexcept
+    {
+        template_value v;
+        v.p_ = &c;
+        v.n_ = c.size();
+        v.get_ = &get_list<Container>;
+        v.kind_ = list;
+        return v;
+    }
+
+    /** Return a map value
+
+        The elements of `c` are the pairs of
+        the list. `c` must have `size()` and
+        `operator[]`, and the members `first`
+        and `second` of its elements must be
+        convertible to `core::string_view`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param c The container of pairs.
+    */
+    template<class Container>
+    static
+    template_value
+    make_map(Container const& c) noexcept
+    {
+        template_value v;
+        v.p_ = &c;
+        v.n_ = c.size();
+        v.get_ = &get_map<Container>;
+        v.kind_ = map;
+        return v;
+    }
+
+    /** Return the kind of the value
+
+        Empty lists and maps are undefined.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    kind_t
+    kind() const noexcept
+    {
+        if( kind_ > string &&
+            n_ == 0)
+            return undefined;
+        return kind_;
+    }
+
+    /** Return the string
+
+        @par Preconditions
+        @code
+        this->kind() == string
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    str() const noexcept
+    {
+        return s_;
+    }
+
+    /** Return the number of elements of a list or map
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return an element of a list, or a key of a map
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The index of the element.
+    */
+    core::string_view
+    at(std::size_t i) const noexcept
+    {
+        return get_(p_, i, false);
+    }
+
+    /** Return a value of a map
+
+        @par Preconditions
+        @code
+        this->kind() == map && i < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The index of the pair.
+    */
+    core::string_view
+    value_at(std::size_t i) const noexcept
+    {
+        return get_(p_, i, true);
+    }
+
+private:
+    template<class Container>
+    static
+    core::string_view
+    get_list(
+        void const* p,
+        std::size_t i,
+        bool) noexcept
+    {
+        return core::string_view(
+            (*static_cast<
+                Container const*>(p))[i]);
+    }
+
+    template<class Container>
+    static
+    core::string_view
+    get_map(
+        void const* p,
+        std::size_t i,
+        bool second) noexcept
+    {
+        auto const& e = (*static_cast<
+            Container const*>(p))[i];
+        if(second)
+            return core::string_view(e.second);
+        return core::string_view(e.first);
+    }
+
+    core::string_view s_;
+    void const* p_ = nullptr;
+    std::size_t n_ = 0;
+    core::string_view (*get_)(
+        void const*, std::size_t, bool) = nullptr;
+    kind_t kind_ = undefined;
+};
+
+//------------------------------------------------
+
+/** A URI template parsed once for repeated expansion
+
+    This object parses a URI template once and
+    stores its literals and expressions, with
+    the character set used to encode the
+    values of each expression. Expanding the
+    template measures the result, reserves
+    the exact size in the destination, and
+    then writes the expansion, which is
+    parsed as a URI reference.
+
+    Templates of level 4 are supported: the
+    operators "+", "#", ".", "/", ";", "?"
+    and "&", the prefix modifier ":n" and
+    the explode modifier "*".
+
+    The variables are provided by a function
+    object, which is called with the name of
+    each variable of an expression and returns
+    its @ref template_value. It is called once
+    when the result is measured, and once when
+    it is written, and must return the same
+    value both times.
+
+    @par Example
+    @code
+    uri_template const t( "https://api.example.com/orders{/id}{?fields*}" );
+
+    std::vector< std::string > fields = { "total", "items" };
+    url u = t.expand( [&]( core::string_view name ) -> template_value
+    {
+        if( name == "id" )
+            return "42";
+        if( name == "fields" )
+            return template_value::make_list( fields );
+        return {};
+    } );
+    assert( u.buffer() == "https://api.example.com/orders/42?fields=total&fields=items" );
+    @endcode
+
+    A template can also be matched against
+    a URL, to extract the values of its
+    variables:
+
+    @code
+    matches m;
+    if( t.match( u, m ) )
+    {
+        assert( m["id"] == "42" );
+        assert( m[1] == "total" && m[2] == "items" );
+    }
+    @endcode
+
+    @par BNF
+    @code
+    URI-Template  = *( literals / expression )
+    expression    =  "{" [ operator ] variable-list "}"
+    operator      =  "+" / "#" / "." / "/" / ";" / "?" / "&"
+    variable-list =  varspec *( "," varspec )
+    varspec       =  varname [ modifier-level4 ]
+    varname       =  varchar *( ["."] varchar )
+    varchar       =  ALPHA / DIGIT / "_" / pct-encoded
+    modifier-level4 = prefix / explode
+    prefix        =  ":" max-length
+    max-length    =  %x31-39 0*3DIGIT
+    explode       =  "*"
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6570"
+        >URI Template (rfc6570)</a>
+
+    @see
+        @ref compiled_format,
+        @ref template_value.
+*/
+class uri_template
+{
+public:
+    /** Constructor
+
+        This function parses the URI
+        template `s`.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid URI template.
+
+        @param s The URI template.
+    */
+    BOOST_URL_DECL
+    explicit
+    uri_template(
+        core::string_view s);
+
+    /** Return the template string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return s_;
+    }
+
+    /** Expand the template into a URL
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return A URL holding the expansion.
+
+        @param vars A function object returning
+        the value of a variable from its name.
+
+        @throw system_error
+        The expansion is not a valid
+        URI reference.
+    */
+    template<class Vars>
+    url
+    expand(Vars const& vars) const
+    {
+        url u;
+        expand_to(u, vars);
+        return u;
+    }
+
+    /** Expand the template into a URL
+
+        The contents of `u` are replaced
+        by the expansion.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+        If the expansion is not a valid
+        URI reference, `u` is cleared.
+
+        @param u An object that derives from @ref url_base.
+
+        @param vars A function object returning
+        the value of a variable from its name.
+
+        @throw system_error
+        The expansion is not a valid
+        URI reference, or does not fit
+        in the capacity of a @ref static_url.
+    */
+    template<class Vars>
+    void
+    expand_to(
+        url_base& u,
+        Vars const& vars) const
+    {
+        vexpand_to(u, vars_ref{
+            &vars, &get_var<Vars>});
+    }
+
+    /** Expand the template into a string
+
+        The expansion is not required to be
+        a valid URI reference.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return A string holding the expansion.
+
+        @param vars A function object returning
+        the value of a variable from its name.
+    */
+    template<class Vars>
+    std::string
+    expand_string(Vars const& vars) const
+    {
+        return vexpand_string(vars_ref{
+            &vars, &get_var<Vars>});
+    }
+
+    /** Match a URL against the template
+
+        This function matches the encoded
+        string `s` against the template in
+        one pass, and stores the values of
+        the variables in `m`, in the order
+        they appear in `s`, with the
+        variable names as ids. The values are
+        slices of `s` which are still percent
+        encoded; nothing is copied.
+
+        Since the expansion of a template
+        is not always reversible, matching
+        follows these rules:
+
+        @li Literals must appear verbatim,
+        after encoding.
+
+        @li The characters of an expression
+        end at the first character which its
+        operator cannot produce, or at the
+        first occurrence of the literal which
+        follows the expression.
+
+        @li Without the operators ";", "?"
+        and "&", the values are assigned to
+        the variables in order, and the last
+        variable takes the rest of the
+        expression, such as the elements of
+        a list. A variable with the explode
+        modifier takes each of the remaining
+        elements, as separate results.
+
+        @li With the operators ";", "?"
+        and "&", the values are assigned by
+        name, in any order. A pair whose
+        name is not a variable of the
+        expression is taken whole by its
+        first exploded variable, or else
+        ends the expression.
+
+        Undefined variables have no results.
+
+        @par Example
+        @code
+        uri_template const t( "/users/{id}/posts{?page,limit}" );
+        matches m;
+        assert( t.match( "/users/42/posts?limit=10", m ) );
+        assert( m["id"] == "42" && m["limit"] == "10" );
+        @endcode
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `true` if `s` matches the
+        template and the results fit in `m`.
+        Otherwise `m` is empty.
+
+        @param s The encoded string to match.
+
+        @param m The match results. The ids
+        reference the template, and the values
+        reference `s`.
+    */
+    BOOST_URL_DECL
+    bool
+    match(
+        core::string_view s,
+        matches_base& m) const noexcept;
+
+    /** Match a URL against the template
+
+        This function matches the string
+        of `u` against the template.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `true` if `u` matches the
+        template and the results fit in `m`.
+
+        @param u The URL to match.
+
+        @param m The match results.
+
+        @see
+            @ref match.
+    */
+    bool
+    match(
+        url_view_base const& u,
+        matches_base& m) const noexcept
+    {
+        return match(u.buffer(), m);
+    }
+
+private:
+    struct vars_ref
+    {
+        void const* p;
+        template_value (*get)(
+            void const*, core::string_view);
+    };
+
+    template<class Vars>
+    static
+    template_value
+    get_var(
+        void const* p,
+        core::string_view name)
+    {
+        return (*static_cast<
+            Vars const*>(p))(name);
+    }
+
+    // a literal or an expression
+    struct piece
+    {
+        // literal chars
+        std::size_t pos = 0;
+        std::size_t size = 0;
+        // the encoded literal in lit_
+        std::size_t epos = 0;
+        std::size_t n = 0;
+        // range of varspecs
+        std::size_t first = 0;
+        std::size_t last = 0;
+        // 0 for a literal, or the index
+        // of the operator in the table
+        unsigned char op = 0;
+    };
+
+    struct varspec
+    {
+        std::size_t pos = 0;
+        std::size_t size = 0;
+        // 0 when there is no prefix
+        std::size_t prefix = 0;
+        bool explode = false;
+    };
+
+    class expander;
+
+    BOOST_URL_DECL
+    void
+    vexpand_to(
+        url_base& u,
+        vars_ref vars) const;
+
+    BOOST_URL_DECL
+    std::string
+    vexpand_string(
+        vars_ref vars) const;
+
+    std::string s_;
+    // the encoded literals
+    std::string lit_;
+    std::vector<piece> v_;
+    std::vector<varspec> vars_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -489,6 +489,8 @@ public:
 
     /// @copydoc url_base::normalize
     url& normalize() { url_base::normalize(); return *this; }
+    /// @copydoc url_base::normalize(parse_options const&)
+    system::result<void> normalize(parse_options const& opt) { return url_base::normalize(opt); }
     /// @copydoc url_base::normalize_scheme
     url& normalize_scheme() { url_base::normalize_scheme(); return *this; }
     /// @copydoc url_base::normalize_authority
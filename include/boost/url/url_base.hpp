@@ -16,6 +16,7 @@
 #include <boost/url/ipv6_address.hpp>
 #include <boost/url/params_encoded_ref.hpp>
 #include <boost/url/params_ref.hpp>
+#include <boost/url/parse_options.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/segments_encoded_ref.hpp>
@@ -37,6 +38,9 @@ struct any_segments_iter;
 struct params_iter_impl;
 struct segments_iter_impl;
 struct pattern;
+struct normalizer;
+struct whatwg_parser;
+struct iri_parser;
 }
 #endif
 
@@ -69,11 +73,22 @@ class BOOST_URL_DECL
 
     friend class url;
     friend class static_url_base;
+    friend class small_url_base;
+    template<class> friend class basic_url;
     friend class params_ref;
     friend class segments_ref;
     friend class segments_encoded_ref;
     friend class params_encoded_ref;
     friend struct detail::pattern;
+    friend struct detail::normalizer;
+    friend class url_builder;
+    friend class uri_template;
+    friend class edit_session;
+    friend class url_edit;
+    friend class resolver;
+    friend class url_sanitizer;
+    friend struct detail::whatwg_parser;
+    friend struct detail::iri_parser;
 
     struct op_t
     {
@@ -101,6 +116,10 @@ class BOOST_URL_DECL
         std::size_t, op_t&) = 0;
     virtual void cleanup(op_t&) = 0;
 
+    // the largest capacity which
+    // reserve_impl can provide
+    virtual std::size_t max_capacity_impl() const noexcept;
+
 public:
     //--------------------------------------------
     //
@@ -2516,6 +2535,308 @@ public:
     url_base&
     remove_origin();
 
+    //--------------------------------------------
+    //
+    // Capacity-checked setters
+    //
+    //--------------------------------------------
+
+    /** Set the scheme, or return an error
+
+        This function measures the exact size
+        of the result before changing the url.
+        If the scheme is invalid, or if the
+        result does not fit in the largest
+        capacity the url can have, an error is
+        returned and the url is unchanged.
+        Otherwise the effect is the same as
+        @ref set_scheme.
+
+        The largest capacity of a @ref static_url
+        is its fixed capacity, so these functions
+        never throw for it and can be used where
+        exceptions are disabled.
+
+        @par Example
+        @code
+        static_url< 16 > u( "http://a.com" );
+        assert( u.try_set_scheme( "https" ).has_value() );
+        assert( u.try_set_scheme( "a-very-long-scheme" ).error() == error::no_space );
+        assert( u.buffer() == "https://a.com" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @return An error if `s` is not a valid
+        scheme, or @ref error::no_space if the
+        result does not fit.
+
+        @param s The scheme to set.
+
+        @see
+            @ref set_scheme.
+    */
+    system::result<void>
+    try_set_scheme(
+        core::string_view s);
+
+    /** Set the host, or return an error
+
+        The same as @ref set_encoded_host, but
+        the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The host to set.
+
+        @see
+            @ref set_encoded_host,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_encoded_host(
+        pct_string_view s);
+
+    /** Set the port, or return an error
+
+        The same as @ref set_port_number, but
+        the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param n The port number to set.
+
+        @see
+            @ref set_port_number,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_port_number(
+        std::uint16_t n);
+
+    /** Set the path, or return an error
+
+        The same as @ref set_encoded_path, but
+        the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The path to set.
+
+        @see
+            @ref set_encoded_path,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_encoded_path(
+        pct_string_view s);
+
+    /** Set the query, or return an error
+
+        The same as @ref set_query, but the
+        size of the result is checked first.
+        If it does not fit in the largest
+        capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The query to set.
+
+        @see
+            @ref set_query,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_query(
+        core::string_view s);
+
+    /** Set the query, or return an error
+
+        The same as @ref set_encoded_query, but
+        the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The query to set.
+
+        @see
+            @ref set_encoded_query,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_encoded_query(
+        pct_string_view s);
+
+    /** Set the fragment, or return an error
+
+        The same as @ref set_fragment, but the
+        size of the result is checked first.
+        If it does not fit in the largest
+        capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The fragment to set.
+
+        @see
+            @ref set_fragment,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_fragment(
+        core::string_view s);
+
+    /** Set the fragment, or return an error
+
+        The same as @ref set_encoded_fragment,
+        but the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param s The fragment to set.
+
+        @see
+            @ref set_encoded_fragment,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_set_encoded_fragment(
+        pct_string_view s);
+
+    /** Append a query parameter, or return an error
+
+        The same as calling `params().append( p )`,
+        but the size of the result is checked
+        first. If it does not fit in the
+        largest capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Example
+        @code
+        static_url< 32 > u( "/path" );
+        assert( u.try_append_param( { "first", "John Doe" } ).has_value() );
+        assert( u.buffer() == "/path?first=John%20Doe" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size() + p.key.size() + p.value.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param p The param to append.
+
+        @see
+            @ref params_ref::append,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_append_param(
+        param_view const& p);
+
+    /** Append a query parameter, or return an error
+
+        The same as calling
+        `encoded_params().append( p )`, but the
+        size of the result is checked first.
+        If it does not fit in the largest
+        capacity the url can have,
+        @ref error::no_space is returned and
+        the url is unchanged.
+
+        @par Complexity
+        Linear in `this->size() + p.key.size() + p.value.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw, which
+        only a url which can grow does.
+
+        @param p The param to append.
+
+        @see
+            @ref params_encoded_ref::append,
+            @ref try_set_scheme.
+    */
+    system::result<void>
+    try_append_encoded_param(
+        param_pct_view const& p);
+
     //--------------------------------------------
     //
     // Normalization
@@ -2539,6 +2860,38 @@ public:
     url_base&
     normalize();
 
+    /** Normalize the URL components, within limits
+
+        Applies Syntax-based normalization to
+        all components of the URL, as
+        @ref normalize does, if the URL does
+        not exceed any of the limits in `opt`.
+        Otherwise, the URL is not modified
+        and an error is returned.
+
+        @par Example
+        @code
+        parse_options opt;
+        opt.max_segments = 2;
+        url u( "http://example.com/a/b/c/../d" );
+        assert( u.normalize( opt ).error() == error::too_many_segments );
+        @endcode
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return An empty @ref result upon
+        success, otherwise an error code.
+
+        @param opt The limits on the URL.
+
+        @see
+            @ref parse_options.
+    */
+    system::result<void>
+    normalize(parse_options const& opt);
+
     /** Normalize the URL scheme
 
         Applies Syntax-based normalization to the
@@ -2780,6 +3133,11 @@ private:
     core::string_view
     first_segment() const noexcept;
 
+    bool fits(std::size_t n) const noexcept;
+    bool has_dot_prefix() const noexcept;
+    std::size_t host_size(std::size_t n) const noexcept;
+    std::size_t port_size(std::size_t n) const noexcept;
+
     detail::segments_iter_impl
     edit_segments(
         detail::segments_iter_impl const&,
@@ -2794,6 +3152,13 @@ private:
         detail::any_params_iter&&) ->
             detail::params_iter_impl;
 
+    std::size_t
+    erase_params(
+        param_key_set const& keys) noexcept;
+
+    void
+    sort_params(encoding_opts opt);
+
     system::result<void>
     resolve_impl(
         url_view_base const& base,
@@ -0,0 +1,404 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_BATCH_HPP
+#define BOOST_URL_URL_BATCH_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/compact_url_view.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A columnar container of parsed URLs
+
+    The characters of the URLs are stored one
+    after the other in a single buffer, and the
+    positions of the components are stored in
+    one array per component, as in the offsets
+    of a @ref url_view. The scheme, the host
+    type, and the port number of the URLs are
+    also stored in arrays. A scan of one
+    component, such as the hosts of all URLs,
+    only reads the arrays and characters of
+    that component.
+
+    The arrays follow the layout of the buffers
+    of a string column in Apache Arrow: the
+    characters of URL `i` are
+    `[offsets()[i], offsets()[i + 1])` in
+    @ref data. Each component `p` of URL `i`
+    begins at `positions(p)[i]` and ends where
+    the next component begins. The host and
+    the path have no delimiters, so these
+    ranges can be used directly. The other
+    components include their delimiters, as
+    in the URL: the ":" after the scheme, the
+    "//" before the user, the ":" and "@"
+    around the password, the ":" before the
+    port, the "?" before the query and the "#"
+    before the fragment.
+
+    The size of the buffer is limited to
+    4 GB, so positions take 32 bits.
+
+    @par Example
+    @code
+    url_batch b;
+    for( core::string_view s : lines )
+        b.append( s );
+
+    // count the URLs of each host
+    std::unordered_map< core::string_view, std::size_t > hosts;
+    for( std::size_t i = 0; i < b.size(); ++i )
+        ++hosts[ b.get( url_batch::host, i ) ];
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref compact_url_view,
+        @ref url_view.
+*/
+class url_batch
+    : private detail::compact_url_base
+{
+public:
+    /** A component of the URLs
+    */
+    enum part : unsigned char
+    {
+        /// The scheme, followed by ":"
+        scheme,
+
+        /// The user, preceded by "//"
+        user,
+
+        /// The password, with ":" and "@"
+        password,
+
+        /// The host
+        host,
+
+        /// The port, preceded by ":"
+        port,
+
+        /// The path
+        path,
+
+        /// The query, preceded by "?"
+        query,
+
+        /// The fragment, preceded by "#"
+        fragment,
+
+        /// The end of the URL
+        end
+    };
+
+    /** Constructor
+
+        Default constructed batches
+        have no URLs.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_batch() noexcept = default;
+
+    /** Return the number of URLs
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return scheme_.size();
+    }
+
+    /** Return true if there are no URLs
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Reserve space
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The number of URLs.
+
+        @param chars The number of characters
+        of all URLs.
+    */
+    BOOST_URL_DECL
+    void
+    reserve(
+        std::size_t n,
+        std::size_t chars);
+
+    /** Remove all URLs
+
+        The capacity is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Append a URL
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The characters do not fit in 4 GB.
+
+        @param u The URL to append.
+    */
+    BOOST_URL_DECL
+    void
+    push_back(
+        url_view_base const& u);
+
+    /** Parse and append a URL
+
+        The string is parsed as a
+        URI reference.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return An error if `s` is not a
+        valid URI reference, in which case
+        nothing is appended.
+
+        @throw system_error
+        The characters do not fit in 4 GB.
+
+        @param s The string to parse.
+    */
+    BOOST_URL_DECL
+    system::result<void>
+    append(
+        core::string_view s);
+
+    /** Return the characters of all URLs
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return chars_;
+    }
+
+    /** Return where each URL begins
+
+        The array has `this->size() + 1`
+        elements, and the last one is
+        the size of @ref data.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint32_t const*
+    offsets() const noexcept
+    {
+        if(pos_[scheme].empty())
+            return &zero_;
+        return pos_[scheme].data();
+    }
+
+    /** Return where a component of each URL begins
+
+        The array has `this->size()`
+        elements. With @ref end, the
+        array has the positions where
+        each URL ends.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param p The component.
+    */
+    std::uint32_t const*
+    positions(part p) const noexcept
+    {
+        if(p == end)
+            return offsets() + 1;
+        return pos_[p].data();
+    }
+
+    /** Return the scheme of each URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    urls::scheme const*
+    scheme_ids() const noexcept
+    {
+        return scheme_.data();
+    }
+
+    /** Return the host type of each URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    urls::host_type const*
+    host_types() const noexcept
+    {
+        return host_type_.data();
+    }
+
+    /** Return the port number of each URL
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint16_t const*
+    port_numbers() const noexcept
+    {
+        return port_number_.data();
+    }
+
+    /** Return a URL
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The position of the URL.
+    */
+    core::string_view
+    buffer(std::size_t i) const noexcept
+    {
+        return slice(
+            offsets()[i],
+            offsets()[i + 1]);
+    }
+
+    /** Return a component of a URL
+
+        The component is returned without its
+        delimiters, and is still percent-encoded.
+        A component which is not present is
+        empty.
+
+        @par Preconditions
+        @code
+        i < this->size() && p != end
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param p The component.
+
+        @param i The position of the URL.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    get(
+        part p,
+        std::size_t i) const noexcept;
+
+    /** Return a view of a URL
+
+        The URL is not parsed again. The view
+        references the characters of the
+        batch, which are invalidated by the
+        functions which append URLs.
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the URL.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The position of the URL.
+    */
+    BOOST_URL_DECL
+    url_view
+    view(std::size_t i) const noexcept;
+
+private:
+    core::string_view
+    slice(
+        std::uint32_t first,
+        std::uint32_t last) const noexcept
+    {
+        return core::string_view(
+            chars_.data() + first,
+            last - first);
+    }
+
+    static constexpr std::uint32_t zero_ = 0;
+
+    std::string chars_;
+    // one array per part, pos_[scheme]
+    // has one more element, or none
+    std::vector<std::uint32_t> pos_[end];
+    std::vector<urls::scheme> scheme_;
+    std::vector<urls::host_type> host_type_;
+    std::vector<std::uint16_t> port_number_;
+    std::vector<std::uint32_t> nseg_;
+    std::vector<std::uint32_t> nparam_;
+};
+
+} // urls
+} // boost
+
+#endif
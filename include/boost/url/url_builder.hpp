@@ -0,0 +1,495 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_BUILDER_HPP
+#define BOOST_URL_URL_BUILDER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** A builder which writes a URL once, from left to right
+
+    Setting a component of a @ref url moves
+    the components which follow it, and the
+    URL is kept valid after every change.
+    When a URL is made from its parts, the
+    components are usually known in order,
+    and nothing follows the component being
+    set.
+
+    This object only accepts the components
+    in the order they appear in a URL: the
+    scheme, the userinfo, the host and the
+    port, the path segments, the query
+    parameters, and the fragment. Each one
+    is encoded at the end of the buffer and
+    recorded as it is written, so no
+    character is moved and the result is
+    never parsed again. When the capacity
+    given at construction is enough, the
+    URL is built with a single allocation.
+
+    Components may be skipped, but once a
+    component is set, the ones before it
+    can no longer be set.
+
+    @par Example
+    @code
+    url_builder b( 64 );
+    b.set_scheme( "https" )
+     .set_host( "www.example.com" )
+     .set_port_number( 8443 )
+     .append_segment( "path" )
+     .append_segment( "to file.txt" )
+     .append_param( { "id", "42" } )
+     .set_fragment( "top" );
+
+    url u = b.release();
+    assert( u.buffer() == "https://www.example.com:8443/path/to%20file.txt?id=42#top" );
+    @endcode
+
+    @see
+        @ref url,
+        @ref url_edit.
+*/
+class url_builder
+    : private detail::parts_base
+{
+    url u_;
+    int id_ = id_scheme;
+
+    BOOST_URL_DECL
+    char*
+    append(int id, std::size_t n);
+
+    BOOST_URL_DECL
+    void
+    start(int id);
+
+    BOOST_URL_DECL
+    void
+    open_authority();
+
+public:
+    /** Constructor
+
+        Default constructed builders
+        are empty and do not allocate.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_builder() noexcept = default;
+
+    /** Constructor
+
+        Storage for at least `capacity`
+        characters is allocated.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param capacity The expected size
+        of the resulting URL.
+    */
+    BOOST_URL_DECL
+    explicit
+    url_builder(std::size_t capacity);
+
+    /** Return the URL built so far
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return u_.buffer();
+    }
+
+    /** Clear the builder
+
+        The characters written so far are
+        removed, and every component may
+        be set again. The capacity is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Return the URL and clear the builder
+
+        The storage of the builder is moved
+        into the returned URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    url
+    release() noexcept;
+
+    //--------------------------------------------
+    //
+    // Scheme
+    //
+    //--------------------------------------------
+
+    /** Set the scheme
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid scheme.
+
+        @throw system_error
+        A component was already set.
+
+        @param s The scheme to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_scheme(core::string_view s);
+
+    /** Set the scheme
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `id == scheme::unknown`, or a
+        component was already set.
+
+        @param id The scheme to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_scheme_id(urls::scheme id);
+
+    //--------------------------------------------
+    //
+    // Authority
+    //
+    //--------------------------------------------
+
+    /** Set the user
+
+        Reserved characters in the string are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the scheme
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_user(core::string_view s);
+
+    /** Set the user
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the scheme
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_encoded_user(pct_string_view s);
+
+    /** Set the password
+
+        Reserved characters in the string are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the user
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_password(core::string_view s);
+
+    /** Set the password
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the user
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_encoded_password(pct_string_view s);
+
+    /** Set the host
+
+        Depending on the contents of the
+        string, the host is set to an IP
+        address or to a reg-name, as in
+        @ref url_base::set_host.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the userinfo
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_host(core::string_view s);
+
+    /** Set the host
+
+        Depending on the contents of the
+        string, the host is set to an IP
+        address or to a reg-name, as in
+        @ref url_base::set_encoded_host.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the userinfo
+        was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_encoded_host(pct_string_view s);
+
+    /** Set the port
+
+        An empty host is written first
+        if no host was set.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the host
+        was already set.
+
+        @param n The port number to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_port_number(std::uint16_t n);
+
+    //--------------------------------------------
+    //
+    // Path
+    //
+    //--------------------------------------------
+
+    /** Append a segment to the path
+
+        The path is absolute. When the first
+        segment is empty or ".", the path
+        starts with "/." so that the
+        segments are kept as they are.
+        Reserved characters in the string are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the path
+        was already set.
+
+        @param s The segment to append.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    append_segment(core::string_view s);
+
+    /** Append a segment to the path
+
+        The path is absolute. When the first
+        segment is empty or ".", the path
+        starts with "/." so that the
+        segments are kept as they are.
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A component after the path
+        was already set.
+
+        @param s The segment to append.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    append_encoded_segment(pct_string_view s);
+
+    //--------------------------------------------
+    //
+    // Query
+    //
+    //--------------------------------------------
+
+    /** Append a parameter to the query
+
+        Reserved characters in the key and
+        value are percent-escaped in the
+        result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The fragment was already set.
+
+        @param p The parameter to append.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    append_param(param_view const& p);
+
+    /** Append a parameter to the query
+
+        Escapes in the key and value are
+        preserved, and reserved characters
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The fragment was already set.
+
+        @param p The parameter to append.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    append_encoded_param(param_pct_view const& p);
+
+    //--------------------------------------------
+    //
+    // Fragment
+    //
+    //--------------------------------------------
+
+    /** Set the fragment
+
+        Reserved characters in the string are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The fragment was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_fragment(core::string_view s);
+
+    /** Set the fragment
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The fragment was already set.
+
+        @param s The string to set.
+    */
+    BOOST_URL_DECL
+    url_builder&
+    set_encoded_fragment(pct_string_view s);
+};
+
+} // urls
+} // boost
+
+#endif
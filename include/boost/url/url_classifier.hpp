@@ -0,0 +1,268 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_CLASSIFIER_HPP
+#define BOOST_URL_URL_CLASSIFIER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A pattern matched by a @ref url_classifier
+
+    Each member is a condition on one part
+    of a URL. An empty member matches every
+    URL. The host and the path are compared
+    with the encoded host and segments of
+    the URL.
+
+    @see
+        @ref url_classifier.
+*/
+struct url_glob
+{
+    /** The scheme to match
+
+        Schemes are compared
+        case-insensitively.
+    */
+    core::string_view scheme;
+
+    /** The host pattern to match
+
+        The pattern is a list of labels
+        separated by dots, compared with the
+        labels of the host. A label `*`
+        matches any one label, and a label
+        `**` matches any number of labels,
+        including none. Otherwise, a `*`
+        in a label matches any characters
+        in the label. Hosts are compared
+        case-insensitively, and a trailing
+        dot is ignored. For example,
+        `**.example.com` matches
+        `example.com` and `www.example.com`,
+        and `*apple.com` matches
+        `pineapple.com` but not
+        `www.apple.com`.
+    */
+    core::string_view host;
+
+    /** The path pattern to match
+
+        The pattern is a list of segments,
+        compared with the segments of the
+        path, in the same way as the labels
+        of the host, but exactly. For example,
+        the segments `docs` and `**` match
+        `/docs` and `/docs/a/b`, and the
+        segments `img` and `*.png` match
+        `/img/logo.png`.
+    */
+    core::string_view path;
+};
+
+//------------------------------------------------
+
+/** A compiled set of patterns classifying URLs
+
+    This container holds an ordered list of
+    patterns, each associated with a handler,
+    and returns the handler of the first
+    pattern matching a URL, as used to route
+    links to the applications which open them.
+
+    The host patterns are stored in a trie of
+    labels, read from the rightmost label of a
+    host. Every node of this trie owns a second
+    trie holding the path patterns of its
+    rules, one segment per edge. The literal
+    children of a node are kept sorted, and
+    the children with wildcards are tried
+    after them. Every node knows the first
+    pattern below it, so a match skips the
+    branches which cannot improve on the
+    pattern already found. A match walks the
+    labels of the host and the segments of the
+    path once for each wildcard which can
+    take them, so its cost depends on the
+    size of the URL and the wildcards of the
+    patterns which match it, and not on the
+    number of patterns. Matching does
+    not allocate.
+
+    @par Example
+    @code
+    url_classifier c;
+    c.insert( 1, { "", "**.apple.com" } );
+    c.insert( 2, { "", "*.internal", "/status" } );
+    c.insert( 3, { "https", "**.google.com" } );
+
+    assert( c.find( url_view( "https://maps.google.com/x" ) ) == 3 );
+    assert( c.find( url_view( "http://wiki.internal/status" ) ) == 2 );
+    assert( c.find( url_view( "http://example.com" ) ) == url_classifier::npos );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref url_glob,
+        @ref url_rule_set.
+*/
+class url_classifier
+{
+public:
+    /// The value returned when no pattern matches
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    /** Constructor
+
+        Default constructed classifiers
+        have no patterns.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_classifier() noexcept = default;
+
+    /** Append a pattern
+
+        The pattern is added after the
+        patterns already in the container,
+        with the handler `h`, which is
+        returned when it is the first
+        pattern matching a URL.
+
+        @par Complexity
+        Linear in the size of the strings
+        of `g`, and in the number of
+        children of the nodes along it.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param h The handler of the pattern.
+
+        @param g The pattern.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        std::size_t h,
+        url_glob const& g);
+
+    /** Return the handler of the first pattern matching a URL
+
+        @par Complexity
+        Linear in the number of labels of the
+        host and segments of the path, for
+        every wildcard which can take them.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The handler, or @ref npos
+        if no pattern matches.
+
+        @param u The URL to classify.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    find(
+        url_view_base const& u) const noexcept;
+
+    /** Return the number of patterns
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return rules_.size();
+    }
+
+    /** Return true if there are no patterns
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return rules_.empty();
+    }
+
+private:
+    struct node
+    {
+        // the label or segment of
+        // the edge from the parent
+        std::size_t key = 0;
+        std::size_t size = 0;
+        bool glob = false;
+        // the key is "**"
+        bool any = false;
+        // children without and with
+        // wildcards, the first sorted
+        std::vector<std::size_t> lits;
+        std::vector<std::size_t> globs;
+        // host nodes: the root of the
+        // path trie, zero if none
+        std::size_t paths = 0;
+        // path nodes: the rules ending
+        // here, in ascending order
+        std::vector<std::size_t> rules;
+        // the first rule below this node
+        std::size_t first = npos;
+    };
+
+    struct rule
+    {
+        std::size_t handler;
+        std::size_t scheme;
+        std::size_t scheme_size;
+    };
+
+    struct matcher;
+
+    core::string_view
+    key(node const& n) const noexcept
+    {
+        return core::string_view(
+            keys_.data() + n.key, n.size);
+    }
+
+    std::size_t
+    child(
+        std::size_t parent,
+        core::string_view k,
+        bool host) const noexcept;
+
+    std::vector<node> nodes_;
+    std::vector<rule> rules_;
+    std::string keys_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,328 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_DELTA_HPP
+#define BOOST_URL_URL_DELTA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** Describes a URL as edits of another URL
+
+    A delta holds the components of a URL
+    which differ from those of a previous
+    URL. Consecutive URLs of a log often
+    differ in a single segment or param
+    value, and the delta of such a URL is a
+    few characters long.
+
+    The components are the scheme, user,
+    password, host, port, path, query, and
+    fragment, found with the offsets which
+    were computed when the URLs were parsed.
+    A component which changed is stored as
+    the number of characters it shares at
+    the start and at the end with the same
+    component of the previous URL, followed
+    by the characters in between.
+
+    @par Example
+    @code
+    url_view a( "https://www.example.com/docs/page/1?lang=en" );
+    url_view b( "https://www.example.com/docs/page/2?lang=en" );
+
+    std::string d;
+    url_delta::encode( a, b, d );
+
+    url u;
+    url_delta::apply( a, d, u ).value();
+    assert( u == b );
+    @endcode
+
+    @par Binary Format
+    A delta starts with a byte holding one
+    bit per component, from the scheme in
+    the least significant bit to the
+    fragment. Each component whose bit is
+    set follows, in order, as three variable
+    length integers, holding the number of
+    characters kept at its start, the number
+    kept at its end, and the number of new
+    characters, followed by the new
+    characters. Variable length integers
+    store 7 bits per byte, least significant
+    first. A delta needs no other framing,
+    so deltas can be concatenated.
+
+    @see
+        @ref url_delta_decoder,
+        @ref url_delta_encoder.
+*/
+class url_delta
+{
+public:
+    /** Append the delta between two URLs
+
+        @par Complexity
+        Linear in `prev.size() + next.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param prev The previous URL.
+
+        @param next The URL to describe.
+
+        @param dest The string to append to.
+    */
+    BOOST_URL_DECL
+    static
+    void
+    encode(
+        url_view_base const& prev,
+        url_view_base const& next,
+        std::string& dest);
+
+    /** Apply a delta to a URL
+
+        The URL described by the delta at the
+        start of `delta`, against `prev`, is
+        assigned to `dest`. The two URLs may
+        be the same object.
+
+        @par Complexity
+        Linear in the size of the result.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return The number of characters of
+        the delta, or an error if the delta
+        is truncated, does not apply to
+        `prev`, or does not describe a valid
+        URL.
+
+        @param prev The previous URL.
+
+        @param delta The characters starting
+        with the delta.
+
+        @param dest The URL to assign.
+    */
+    BOOST_URL_DECL
+    static
+    system::result<std::size_t>
+    apply(
+        url_view_base const& prev,
+        core::string_view delta,
+        url& dest);
+};
+
+//------------------------------------------------
+
+/** An encoder for sequences of URL deltas
+
+    Each URL appended is stored as its
+    @ref url_delta against the previous one,
+    and the first against an empty URL.
+
+    @par Example
+    @code
+    url_delta_encoder e;
+    for( url_view u : batch )
+        e.push_back( u );
+    ship( e.release() );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref url_delta,
+        @ref url_delta_decoder.
+*/
+class url_delta_encoder
+{
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_delta_encoder() noexcept = default;
+
+    /** Return the number of URLs encoded
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return the encoded characters
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return s_;
+    }
+
+    /** Append a URL
+
+        @par Complexity
+        Linear in `u.size()` plus the size
+        of the previous URL.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The URL to append.
+    */
+    BOOST_URL_DECL
+    void
+    push_back(url_view_base const& u);
+
+    /** Return the encoded characters
+
+        Afterwards, the encoder is empty, and
+        the next URL appended is encoded
+        against an empty URL.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    std::string
+    release();
+
+private:
+    std::string s_;
+    url prev_;
+    std::size_t size_ = 0;
+};
+
+//------------------------------------------------
+
+/** A decoder for sequences of URL deltas
+
+    The decoder reads the characters written
+    by a @ref url_delta_encoder, one URL at
+    a time.
+
+    Ownership is not transferred; the caller
+    is responsible for ensuring that the
+    lifetime of the characters extends until
+    they are no longer referenced.
+
+    @par Example
+    @code
+    url_delta_decoder d( payload );
+    while( ! d.done() )
+        process( d.next().value() );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the basic
+    exception safety guarantee.
+
+    @see
+        @ref url_delta,
+        @ref url_delta_encoder.
+*/
+class url_delta_decoder
+{
+public:
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param data The encoded characters.
+    */
+    explicit
+    url_delta_decoder(
+        core::string_view data) noexcept
+        : data_(data)
+    {
+    }
+
+    /** Return true if every URL was decoded
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    done() const noexcept
+    {
+        return pos_ == data_.size();
+    }
+
+    /** Decode the next URL
+
+        The returned view references the
+        decoder, and remains valid until
+        the next call.
+        After an error, the decoder does
+        not move, and the calls which follow
+        return the same error.
+
+        @par Preconditions
+        @code
+        ! this->done()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the URL.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return The URL, or an error if the
+        characters are damaged.
+    */
+    BOOST_URL_DECL
+    system::result<url_view>
+    next();
+
+private:
+    core::string_view data_;
+    std::size_t pos_ = 0;
+    url cur_;
+    std::string buf_;
+};
+
+} // urls
+} // boost
+
+#endif
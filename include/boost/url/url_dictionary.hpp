@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_DICTIONARY_HPP
+#define BOOST_URL_URL_DICTIONARY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/intern_table.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** Dictionaries of hosts, segments, and keys
+
+    A dictionary gives dense 32-bit
+    identifiers to the encoded hosts, path
+    segments, and query param keys which
+    are frequent in a set of URLs, so that
+    a @ref url_record_writer can store the
+    identifier of a string in place of its
+    characters. Each kind of string has its
+    own identifiers, given in the order the
+    strings are inserted, and strings are
+    compared as they are written, with case.
+
+    A writer and the readers of its records
+    must use equal dictionaries. Inserting
+    the same strings in the same order
+    gives the same identifiers, so the
+    strings of each kind, in the order of
+    their identifiers, can be shipped
+    alongside the records.
+
+    Finding a string, and inserting a
+    string which is already in the
+    dictionary, take no lock. Inserting a
+    new string takes a lock, which
+    serializes the writers.
+
+    @par Example
+    @code
+    url_dictionary d;
+    for( url_view u : sample )
+        d.insert( u );
+    assert( d.find( url_dictionary::kind::host, "www.example.com" ) == 0 );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+
+    @see
+        @ref url_record_reader,
+        @ref url_record_writer.
+*/
+class url_dictionary
+{
+    detail::intern_table t_[3];
+
+public:
+    /** The kinds of strings
+    */
+    enum class kind
+    {
+        /// Encoded hosts
+        host,
+
+        /// Encoded path segments
+        segment,
+
+        /// Encoded query param keys
+        key
+    };
+
+    /** The type of an identifier
+    */
+    using id_type = std::uint32_t;
+
+    /** The value which identifies no string
+    */
+    static constexpr id_type npos =
+        id_type(-1);
+
+    /** Constructor
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_dictionary() = default;
+
+    url_dictionary(url_dictionary const&) = delete;
+    url_dictionary& operator=(url_dictionary const&) = delete;
+
+    /** Return the number of strings of a kind
+
+        The identifiers of the strings are
+        the values less than this number.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param k The kind of strings.
+    */
+    std::size_t
+    size(kind k) const noexcept
+    {
+        return t_[static_cast<int>(k)].size();
+    }
+
+    /** Insert a string
+
+        If the string is in the dictionary,
+        its identifier is returned, without
+        taking a lock. Otherwise, a copy of
+        the string is given the next
+        identifier of its kind.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on too many strings.
+
+        @throw system_error
+        The dictionary has `npos` strings
+        of kind `k`.
+
+        @return The identifier of the string.
+
+        @param k The kind of string.
+
+        @param s The encoded string.
+    */
+    BOOST_URL_DECL
+    id_type
+    insert(
+        kind k,
+        core::string_view s);
+
+    /** Insert the strings of a URL
+
+        The host of the URL, if it has an
+        authority, its segments, and its
+        param keys are inserted.
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on too many strings.
+
+        @throw system_error
+        A dictionary has `npos` strings.
+
+        @param u The URL.
+    */
+    BOOST_URL_DECL
+    void
+    insert(url_view_base const& u);
+
+    /** Return the identifier of a string
+
+        This function takes no lock.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The identifier of the string,
+        or @ref npos if there is none.
+
+        @param k The kind of string.
+
+        @param s The encoded string.
+    */
+    BOOST_URL_DECL
+    id_type
+    find(
+        kind k,
+        core::string_view s) const noexcept;
+
+    /** Return the string of an identifier
+
+        The returned string remains valid
+        until the dictionary is destroyed.
+
+        @par Preconditions
+        @code
+        id < this->size( k )
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param k The kind of string.
+
+        @param id The identifier.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    get(
+        kind k,
+        id_type id) const noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,578 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_EDIT_HPP
+#define BOOST_URL_URL_EDIT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A set of component replacements applied to a URL at once
+
+    Each setter of @ref url_base resizes its
+    component in place and moves the rest of
+    the string, so rewriting several components
+    of a URL moves its characters, and possibly
+    reallocates, once per component.
+
+    This object collects the replacements
+    instead. The new components are validated
+    and encoded when they are set, and stored
+    in the object. When the edit is applied,
+    the final layout of the URL is computed,
+    capacity is reserved once, the components
+    which are kept are moved at most once, and
+    the new components are copied in place.
+
+    The result is the same as calling the
+    corresponding setters of @ref url_base on
+    the URL, in the order the components appear
+    in the URL. An edit can be applied to any
+    number of URLs.
+
+    @par Example
+    @code
+    url_edit e;
+    e.set_scheme( "https" )
+     .set_encoded_host( "backend.internal" )
+     .set_port_number( 8443 )
+     .set_encoded_path( "/v2/items" );
+
+    url u( "http://example.com/items?id=42" );
+    e.apply( u );
+    assert( u.buffer() == "https://backend.internal:8443/v2/items?id=42" );
+    @endcode
+
+    @see
+        @ref url_base.
+*/
+class url_edit
+    : private detail::parts_base
+{
+public:
+    /** Constructor
+
+        Default constructed edits keep
+        every component of a URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_edit() noexcept = default;
+
+    /** Clear the edit
+
+        All the replacements are removed.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Apply the edit to a URL
+
+        The components of `u` are replaced
+        by the ones set in this object.
+
+        @par Complexity
+        Linear in the size of the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw length_error
+        The result does not fit in the
+        capacity of a @ref static_url.
+
+        @param u The URL to modify.
+    */
+    BOOST_URL_DECL
+    void
+    apply(url_base& u) const;
+
+    //--------------------------------------------
+    //
+    // Scheme
+    //
+    //--------------------------------------------
+
+    /** Set the scheme
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid scheme.
+
+        @param s The scheme to set.
+
+        @see
+            @ref url_base::set_scheme.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_scheme(core::string_view s);
+
+    /** Set the scheme
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `id == scheme::unknown`
+
+        @param id The scheme to set.
+
+        @see
+            @ref url_base::set_scheme_id.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_scheme_id(urls::scheme id);
+
+    /** Remove the scheme
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_scheme.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_scheme() noexcept;
+
+    //--------------------------------------------
+    //
+    // Authority
+    //
+    //--------------------------------------------
+
+    /** Remove the authority
+
+        The user, password, host, and port
+        are removed. Setting any of them
+        afterwards adds an authority again.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_authority.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_authority() noexcept;
+
+    /** Set the user
+
+        Reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_user.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_user(core::string_view s);
+
+    /** Set the user
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_user.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_user(pct_string_view s);
+
+    /** Set the password
+
+        Reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_password.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_password(core::string_view s);
+
+    /** Set the password
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_password.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_password(pct_string_view s);
+
+    /** Remove the userinfo
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_userinfo.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_userinfo() noexcept;
+
+    /** Set the host
+
+        Depending on the contents of the passed
+        string, the host is an IP-literal, an
+        IPv4 address, or a reg-name, in which
+        case reserved characters are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_host.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_host(core::string_view s);
+
+    /** Set the host
+
+        Depending on the contents of the passed
+        string, the host is an IP-literal, an
+        IPv4 address, or a reg-name, in which
+        case escapes in the string are preserved
+        and reserved characters are
+        percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_host.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_host(pct_string_view s);
+
+    /** Set the port
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The port number to set.
+
+        @see
+            @ref url_base::set_port_number.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_port_number(std::uint16_t n);
+
+    /** Set the port
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` does not contain a valid port.
+
+        @param s The port string to set.
+
+        @see
+            @ref url_base::set_port.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_port(core::string_view s);
+
+    /** Remove the port
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_port.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_port() noexcept;
+
+    //--------------------------------------------
+    //
+    // Path
+    //
+    //--------------------------------------------
+
+    /** Set the path
+
+        Reserved characters in the string
+        are percent-escaped in the result.
+        The path is adjusted as needed to
+        keep the result valid.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_path.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_path(core::string_view s);
+
+    /** Set the path
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+        The path is adjusted as needed to
+        keep the result valid.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_path.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_path(pct_string_view s);
+
+    //--------------------------------------------
+    //
+    // Query
+    //
+    //--------------------------------------------
+
+    /** Set the query
+
+        Reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_query.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_query(core::string_view s);
+
+    /** Set the query
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_query.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_query(pct_string_view s);
+
+    /** Remove the query
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_query.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_query() noexcept;
+
+    //--------------------------------------------
+    //
+    // Fragment
+    //
+    //--------------------------------------------
+
+    /** Set the fragment
+
+        Reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_fragment.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_fragment(core::string_view s);
+
+    /** Set the fragment
+
+        Escapes in the string are preserved,
+        and reserved characters in the string
+        are percent-escaped in the result.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` contains an invalid percent-encoding.
+
+        @param s The string to set.
+
+        @see
+            @ref url_base::set_encoded_fragment.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    set_encoded_fragment(pct_string_view s);
+
+    /** Remove the fragment
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref url_base::remove_fragment.
+    */
+    BOOST_URL_DECL
+    url_edit&
+    remove_fragment() noexcept;
+
+private:
+    enum class op : unsigned char
+    {
+        keep,
+        set,
+        remove
+    };
+
+    // a replacement, stored in s_
+    struct field
+    {
+        op what = op::keep;
+        std::size_t pos = 0;
+        std::size_t n = 0;
+    };
+
+    char* stage(int id, std::size_t n);
+    void stage(int id, core::string_view s);
+    core::string_view get(int id) const noexcept;
+
+    // indexed by part id + 1. The user,
+    // password, port, query, and fragment
+    // are stored without delimiters.
+    field f_[id_end + 1];
+    bool remove_authority_ = false;
+    bool set_authority_ = false;
+    std::string s_;
+};
+
+} // urls
+} // boost
+
+#endif
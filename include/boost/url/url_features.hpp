@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_FEATURES_HPP
+#define BOOST_URL_URL_FEATURES_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_batch.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** The lexical features of a URL
+
+    This is a fixed vector of numbers describing
+    the characters of a URL and of its host, path
+    and query, as used by the models which
+    classify URLs as phishing or spam. It is
+    filled by @ref extract_features.
+
+    The same statistics are computed for the
+    whole URL and for each component, on the
+    encoded characters, without delimiters:
+    the number of characters, of digits, of
+    letters, of dots, of hyphens and of
+    percent signs, and the Shannon entropy of
+    the bytes, in bits per byte.
+
+    The tokens of the host, the path and the
+    query are the runs of letters and digits.
+    Each token is hashed, ignoring case, and
+    the counts of the tokens falling into each
+    of @ref token_buckets buckets are the last
+    features of the vector.
+
+    @par Example
+    @code
+    url_features f;
+    extract_features( url_view( "http://login.example.com.evil.io/a/b?x=1" ), f );
+    assert( f[ url_features::host_labels ] == 5 );
+    assert( f[ url_features::path_segments ] == 2 );
+    assert( f[ url_features::query_digits ] == 1 );
+    @endcode
+
+    @see
+        @ref extract_features.
+*/
+class url_features
+{
+public:
+    /// The number of buckets of token hashes
+    static constexpr std::size_t token_buckets = 16;
+
+    /** A feature of the vector
+    */
+    enum feature : unsigned char
+    {
+        /// The size of the URL
+        url_length,
+        /// The digits of the URL
+        url_digits,
+        /// The letters of the URL
+        url_letters,
+        /// The dots of the URL
+        url_dots,
+        /// The hyphens of the URL
+        url_hyphens,
+        /// The percent signs of the URL
+        url_escapes,
+        /// The entropy of the URL
+        url_entropy,
+
+        /// The size of the host
+        host_length,
+        /// The digits of the host
+        host_digits,
+        /// The letters of the host
+        host_letters,
+        /// The dots of the host
+        host_dots,
+        /// The hyphens of the host
+        host_hyphens,
+        /// The percent signs of the host
+        host_escapes,
+        /// The entropy of the host
+        host_entropy,
+
+        /// The size of the path
+        path_length,
+        /// The digits of the path
+        path_digits,
+        /// The letters of the path
+        path_letters,
+        /// The dots of the path
+        path_dots,
+        /// The hyphens of the path
+        path_hyphens,
+        /// The percent signs of the path
+        path_escapes,
+        /// The entropy of the path
+        path_entropy,
+
+        /// The size of the query
+        query_length,
+        /// The digits of the query
+        query_digits,
+        /// The letters of the query
+        query_letters,
+        /// The dots of the query
+        query_dots,
+        /// The hyphens of the query
+        query_hyphens,
+        /// The percent signs of the query
+        query_escapes,
+        /// The entropy of the query
+        query_entropy,
+
+        /// The labels of a host which is a name
+        host_labels,
+        /// 1 if the host is an IP address
+        host_is_ip,
+        /// The segments of the path
+        path_segments,
+        /// The params of the query
+        query_params,
+        /// 1 if there is a userinfo
+        has_userinfo,
+        /// 1 if there is a port
+        has_port,
+        /// 1 if the scheme is "https"
+        is_https,
+
+        /// The first bucket of token hashes
+        token_hash,
+
+        /// The number of features
+        count = token_hash + token_buckets
+    };
+
+    /** Constructor
+
+        All features are zero.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_features() noexcept = default;
+
+    /** Return a feature
+
+        @par Preconditions
+        @code
+        i < count
+        @endcode
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The feature, or
+        `token_hash + j` for bucket `j`.
+    */
+    float
+    operator[](std::size_t i) const noexcept
+    {
+        return v_[i];
+    }
+
+    /** Return the features
+
+        The array has @ref count elements,
+        in the order of @ref feature.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    float const*
+    data() const noexcept
+    {
+        return v_;
+    }
+
+private:
+    friend
+    BOOST_URL_DECL
+    void
+    extract_features(
+        url_view_base const&,
+        url_features&) noexcept;
+
+    float v_[count] = {};
+};
+
+/** Compute the lexical features of a URL
+
+    The features of `u` are stored in `f`,
+    replacing its contents. The counts of
+    each component are computed 16 characters
+    at a time where SSE2 or NEON is available,
+    and the components are found from the
+    offsets of `u`, so nothing is parsed.
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL
+
+    @param f The features
+
+    @see
+        @ref url_features.
+*/
+BOOST_URL_DECL
+void
+extract_features(
+    url_view_base const& u,
+    url_features& f) noexcept;
+
+/** Compute the lexical features of the URLs of a batch
+
+    The features of every URL of `b` are
+    stored in the matrix `columns`, one column
+    per feature: feature `j` of URL `i` is
+    `columns[ j * b.size() + i ]`. This is the
+    layout of the float columns of a table of
+    Apache Arrow or of a Fortran matrix.
+
+    @par Example
+    @code
+    std::vector< float > m( b.size() * url_features::count );
+    extract_features( b, m.data() );
+
+    // the sizes of the hosts
+    float const* hosts = m.data() + url_features::host_length * b.size();
+    @endcode
+
+    @par Preconditions
+    `columns` has room for
+    `b.size() * url_features::count`
+    elements.
+
+    @par Complexity
+    Linear in `b.data().size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param b The URLs
+
+    @param columns The matrix of features
+*/
+BOOST_URL_DECL
+void
+extract_features(
+    url_batch const& b,
+    float* columns) noexcept;
+
+} // urls
+} // boost
+
+#endif
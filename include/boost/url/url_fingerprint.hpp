@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_FINGERPRINT_HPP
+#define BOOST_URL_URL_FINGERPRINT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+/** A 128-bit fingerprint of a URL
+
+    Objects of this type are returned by
+    @ref url_view_base::fingerprint128.
+    URLs which compare equal have equal
+    fingerprints, and the probability that
+    URLs which are not equal have equal
+    fingerprints is negligible, even in
+    sets with billions of URLs.
+
+    @par Example
+    @code
+    url_view u0( "HTTP://www.A.com/a/./b" );
+    url_view u1( "http://www.a.com/a/%62" );
+    assert( u0.fingerprint128() == u1.fingerprint128() );
+    @endcode
+
+    @see
+        @ref url_view_base::fingerprint,
+        @ref url_view_base::fingerprint128.
+*/
+struct url_fingerprint
+{
+    /** The low 64 bits of the fingerprint
+    */
+    std::uint64_t low = 0;
+
+    /** The high 64 bits of the fingerprint
+    */
+    std::uint64_t high = 0;
+
+    /** Return true if two fingerprints are equal
+    */
+    friend
+    bool
+    operator==(
+        url_fingerprint const& a,
+        url_fingerprint const& b) noexcept
+    {
+        return
+            a.low == b.low &&
+            a.high == b.high;
+    }
+
+    /** Return true if two fingerprints are not equal
+    */
+    friend
+    bool
+    operator!=(
+        url_fingerprint const& a,
+        url_fingerprint const& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /** Return true if a fingerprint is less than another
+
+        The order is arbitrary, and is
+        only useful to sort fingerprints.
+    */
+    friend
+    bool
+    operator<(
+        url_fingerprint const& a,
+        url_fingerprint const& b) noexcept
+    {
+        if(a.high != b.high)
+            return a.high < b.high;
+        return a.low < b.low;
+    }
+};
+
+} // urls
+} // boost
+
+//------------------------------------------------
+
+// std::hash specialization
+#ifndef BOOST_URL_DOCS
+namespace std {
+template<>
+struct hash< ::boost::urls::url_fingerprint >
+{
+    std::size_t
+    operator()(
+        ::boost::urls::url_fingerprint const& f) const noexcept
+    {
+        // the bits are already mixed
+        return static_cast<std::size_t>(f.low);
+    }
+};
+} // std
+#endif
+
+#endif
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_IMAGE_HPP
+#define BOOST_URL_URL_IMAGE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** Return the size of the image of a URL
+
+    The image of a URL holds its characters
+    together with the offsets and decoded
+    sizes of its components, which are
+    computed when the URL is parsed. A view
+    of the URL can be obtained from the image
+    without parsing it again, in another
+    process or on another platform.
+
+    @par Binary Format
+    The image starts with a header holding a
+    signature, the format version, the offset
+    of every component, the decoded size of
+    every component, the number of segments
+    and params, the port number, the host
+    type, the scheme, and the address of an
+    IP host. The characters of the URL follow
+    the header. Integers are little-endian and
+    unaligned.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param u The URL
+
+    @see
+        @ref read_url_image,
+        @ref write_url_image.
+*/
+BOOST_URL_DECL
+std::size_t
+url_image_size(
+    url_view_base const& u) noexcept;
+
+/** Write the image of a URL to a buffer
+
+    @par Example
+    @code
+    url_view u( "https://www.example.com/path?q=1" );
+    char buf[512];
+    std::size_t n = write_url_image( u, buf, sizeof(buf) ).value();
+    queue.push( buf, n );
+    @endcode
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of characters
+    written, or an error if the buffer
+    is smaller than @ref url_image_size.
+
+    @param u The URL
+
+    @param dest A pointer to the buffer.
+
+    @param size The size of the buffer.
+
+    @see
+        @ref read_url_image,
+        @ref url_image_size.
+*/
+BOOST_URL_DECL
+system::result<std::size_t>
+write_url_image(
+    url_view_base const& u,
+    char* dest,
+    std::size_t size) noexcept;
+
+/** Return the image of a URL
+
+    @par Complexity
+    Linear in `u.size()`.
+
+    @par Exception Safety
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param u The URL
+
+    @see
+        @ref read_url_image,
+        @ref write_url_image.
+*/
+BOOST_URL_DECL
+std::string
+make_url_image(
+    url_view_base const& u);
+
+/** Return a view of the URL in an image
+
+    The header of the image is checked: the
+    signature and version must match, and the
+    offsets, decoded sizes, and enumerations
+    must be consistent with each other and
+    with the size of the image. The characters
+    of the URL are not inspected, so this does
+    not detect an image whose characters were
+    modified after it was written.
+
+    The returned view references the
+    characters in the image.
+
+    @par Example
+    @code
+    url_view u = read_url_image( queue.front() ).value();
+    @endcode
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view of the URL, or an
+    error if the header is damaged.
+
+    @param image The image of the URL
+
+    @see
+        @ref read_url_image_unchecked,
+        @ref write_url_image.
+*/
+BOOST_URL_DECL
+system::result<url_view>
+read_url_image(
+    core::string_view image) noexcept;
+
+/** Return a view of the URL in a trusted image
+
+    This function reconstructs the view
+    without checking the image. It is
+    intended for images written by
+    @ref write_url_image and passed
+    through a trusted channel, such as a
+    shared memory queue between stages of
+    the same service.
+
+    The returned view references the
+    characters in the image.
+
+    @par Preconditions
+    `image` was returned by @ref make_url_image
+    or written by @ref write_url_image, and
+    was not modified since.
+
+    @par Complexity
+    Constant.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param image The image of the URL
+
+    @see
+        @ref read_url_image,
+        @ref write_url_image.
+*/
+BOOST_URL_DECL
+url_view
+read_url_image_unchecked(
+    core::string_view image) noexcept;
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,313 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_INDEX_HPP
+#define BOOST_URL_URL_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/url_index_iter.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** An index of the segments and params of a URL
+
+    The segment and param containers of a
+    URL only know how many elements they
+    have, so reaching the element at a given
+    position scans the path or the query
+    from the beginning. This object walks the
+    path and the query of a URL once and
+    records where each segment, key and value
+    starts, so any of them can then be
+    obtained in constant time.
+
+    The offsets are stored in a small buffer
+    inside the object. A URL with more
+    segments and params than fit in it
+    causes a single allocation, whose
+    storage is reused by @ref assign.
+
+    The index references the characters of
+    the URL. Modifying or destroying the URL
+    invalidates the index, which must then be
+    assigned again.
+
+    The segments and params can also be
+    traversed with random access iterators,
+    so that algorithms such as
+    `std::lower_bound` or `std::next` take
+    constant time per step.
+
+    @par Example
+    @code
+    url_view u( "/api/v1/users/42?fields=name&sort=asc" );
+    url_index idx( u );
+
+    assert( idx.segments_size() == 4 );
+    assert( idx.segment( 3 ) == "42" );
+    assert( idx.param( 1 ).key == "sort" );
+    assert( *std::next( idx.segments_begin(), 2 ) == "users" );
+    @endcode
+
+    @see
+        @ref url_view_base::encoded_segments,
+        @ref url_view_base::encoded_params.
+*/
+class url_index
+{
+public:
+    /** A random access iterator to the segments
+
+        The iterator references the index,
+        which must outlive it. Dereferencing
+        it returns a @ref pct_string_view.
+    */
+#ifdef BOOST_URL_DOCS
+    using segments_iterator = __see_below__;
+#else
+    using segments_iterator =
+        detail::url_index_iter<pct_string_view>;
+#endif
+
+    /** A random access iterator to the params
+
+        The iterator references the index,
+        which must outlive it. Dereferencing
+        it returns a @ref param_pct_view.
+    */
+#ifdef BOOST_URL_DOCS
+    using params_iterator = __see_below__;
+#else
+    using params_iterator =
+        detail::url_index_iter<param_pct_view>;
+#endif
+
+    /** Constructor
+
+        Default constructed indexes
+        have no segments or params.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_index() noexcept = default;
+
+    /** Constructor
+
+        This function indexes the segments
+        and params of `u`.
+
+        @par Complexity
+        Linear in `u.encoded_path().size() + u.encoded_query().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The URL to index
+    */
+    BOOST_URL_DECL
+    explicit
+    url_index(
+        url_view_base const& u);
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    url_index(
+        url_index const& other);
+
+    /** Assignment
+
+        @par Exception Safety
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    url_index&
+    operator=(
+        url_index const& other);
+
+    /** Destructor
+    */
+    BOOST_URL_DECL
+    ~url_index();
+
+    /** Index another URL
+
+        This function replaces the contents
+        of the index with the segments and
+        params of `u`. Allocated storage is
+        reused when it is large enough.
+
+        @par Complexity
+        Linear in `u.encoded_path().size() + u.encoded_query().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The URL to index
+    */
+    BOOST_URL_DECL
+    void
+    assign(
+        url_view_base const& u);
+
+    /** Return the number of segments
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    segments_size() const noexcept
+    {
+        return nseg_;
+    }
+
+    /** Return the number of params
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    params_size() const noexcept
+    {
+        return nparam_;
+    }
+
+    /** Return a segment
+
+        @par Preconditions
+        @code
+        i < this->segments_size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index
+        of the segment
+    */
+    pct_string_view
+    segment(
+        std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < nseg_);
+        return segments_begin()[
+            static_cast<std::ptrdiff_t>(i)];
+    }
+
+    /** Return a param
+
+        @par Preconditions
+        @code
+        i < this->params_size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param i The zero-based index
+        of the param
+    */
+    param_pct_view
+    param(
+        std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < nparam_);
+        return params_begin()[
+            static_cast<std::ptrdiff_t>(i)];
+    }
+
+    /** Return an iterator to the first segment
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    segments_iterator
+    segments_begin() const noexcept
+    {
+        return { data_, p_ };
+    }
+
+    /** Return an iterator past the last segment
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    segments_iterator
+    segments_end() const noexcept
+    {
+        return { data_, p_ + nseg_ * seg_words };
+    }
+
+    /** Return an iterator to the first param
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_iterator
+    params_begin() const noexcept
+    {
+        return { data_, p_ + nseg_ * seg_words };
+    }
+
+    /** Return an iterator past the last param
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_iterator
+    params_end() const noexcept
+    {
+        return { data_, p_ +
+            nseg_ * seg_words +
+            nparam_ * param_words };
+    }
+
+private:
+    // offset, size, decoded size
+    static constexpr std::size_t seg_words =
+        detail::url_index_entry<
+            pct_string_view>::words;
+    // the same for the key and the
+    // value, then has_value
+    static constexpr std::size_t param_words =
+        detail::url_index_entry<
+            param_pct_view>::words;
+    static constexpr std::size_t inline_words = 30;
+
+    void
+    reserve(std::size_t n);
+
+    char const* data_ = nullptr;
+    std::size_t nseg_ = 0;
+    std::size_t nparam_ = 0;
+    std::size_t* p_ = inline_;
+    std::size_t cap_ = inline_words;
+    std::size_t inline_[inline_words];
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,246 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_INTERNER_HPP
+#define BOOST_URL_URL_INTERNER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/intern_table.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** A concurrent table of unique normalized URLs
+
+    Each URL interned in the table is given a
+    32-bit identifier, the same for every URL
+    which compares equal to it with
+    @ref url_view_base::compare. The table
+    keeps one normalized copy of each URL,
+    which is obtained from its identifier in
+    constant time.
+
+    The copies are appended to an arena
+    which never moves or frees them, along
+    with the offsets of their components, so
+    the views returned by @ref view are
+    built without parsing, and remain valid
+    until the table is destroyed.
+
+    Finding a URL, and interning a URL which
+    is already in the table, take no lock:
+    the table of slots holds the
+    @ref url_view_base::fingerprint of each
+    URL next to its identifier, and the
+    stored URL is only compared when the
+    fingerprints match. Adding a URL takes
+    a lock, which serializes the writers.
+
+    @par Example
+    @code
+    url_interner t;
+    std::uint32_t id = t.intern( url_view( "HTTP://www.Example.com/a/./b" ) );
+    assert( t.intern( url_view( "http://www.example.com/a/b" ) ) == id );
+    assert( t.view( id ).buffer() == "http://www.example.com/a/b" );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe, unless the library
+    is compiled with `BOOST_URL_DISABLE_THREADS`.
+
+    @see
+        @ref url_set,
+        @ref url_view_base::compare,
+        @ref url_view_base::fingerprint.
+*/
+class url_interner
+{
+    detail::intern_table t_;
+
+public:
+    /** The type of an identifier
+    */
+    using id_type = std::uint32_t;
+
+    /** The value which identifies no URL
+    */
+    static constexpr id_type npos =
+        id_type(-1);
+
+    /** Constructor
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param n The number of URLs which
+        can be interned before the table of
+        slots is enlarged.
+    */
+    explicit
+    url_interner(std::size_t n = 0)
+        : t_(n)
+    {
+    }
+
+    /** Destructor
+
+        All the views returned by
+        @ref view are invalidated.
+    */
+    ~url_interner() = default;
+
+    url_interner(url_interner const&) = delete;
+    url_interner& operator=(url_interner const&) = delete;
+
+    /** Return the number of interned URLs
+
+        The identifiers of the URLs are
+        the values less than this number.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return t_.size();
+    }
+
+    /** Return true if no URL is interned
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return the number of bytes used by the copies
+
+        This includes the characters and the
+        offsets of the interned URLs, but not
+        the table of slots.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    arena_size() const noexcept
+    {
+        return t_.arena_size();
+    }
+
+    /** Intern a URL
+
+        If a URL equal to `u` is in the
+        table, its identifier is returned,
+        without taking a lock. Otherwise, a
+        normalized copy of `u` is added to
+        the table and given the next
+        identifier.
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on too many URLs.
+
+        @throw system_error
+        The table has `npos` URLs.
+
+        @return The identifier of the URL.
+
+        @param u The URL to intern.
+    */
+    BOOST_URL_DECL
+    id_type
+    intern(url_view_base const& u);
+
+    /** Return the identifier of a URL
+
+        This function takes no lock.
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The identifier of the URL
+        equal to `u`, or @ref npos if there
+        is none.
+
+        @param u The URL to find.
+    */
+    BOOST_URL_DECL
+    id_type
+    find(url_view_base const& u) const noexcept;
+
+    /** Return true if a URL is interned
+
+        This function takes no lock.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL to find.
+    */
+    bool
+    contains(url_view_base const& u) const noexcept
+    {
+        return find(u) != npos;
+    }
+
+    /** Return the URL with an identifier
+
+        The view references the normalized
+        copy held by the table, and is built
+        from its stored offsets without
+        parsing. It remains valid until the
+        table is destroyed. This function
+        takes no lock.
+
+        @par Preconditions
+        @code
+        id < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param id The identifier returned
+        by @ref intern or @ref find.
+    */
+    BOOST_URL_DECL
+    url_view
+    view(id_type id) const noexcept;
+
+    /// @copydoc view
+    url_view
+    operator[](id_type id) const noexcept
+    {
+        return view(id);
+    }
+};
+
+} // urls
+} // boost
+
+#endif
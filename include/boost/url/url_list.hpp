@@ -0,0 +1,373 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_LIST_HPP
+#define BOOST_URL_URL_LIST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A non-owning reference to a sorted, front-coded list of URLs
+
+    Objects of this type refer to the binary
+    image of a list, as returned by
+    @ref url_list_builder::release. The image
+    is used in place: it is never parsed,
+    copied, or modified, so it can be stored
+    in a file and mapped read-only into the
+    processes which need the list.
+
+    Sorted URLs often share long prefixes,
+    such as their scheme, host, and the first
+    segments of their path. Each URL in the
+    image is stored as the number of characters
+    it shares with the previous URL, followed
+    by the rest of its characters. Every few
+    URLs, at the restart points, a URL is
+    stored in full, and the image keeps the
+    position of each of them. Accessing a URL
+    only reads the entries between it and the
+    previous restart point, and copies each of
+    its characters once.
+
+    The image holds the characters of the URLs
+    alone. When a URL is accessed, its
+    characters are written to a buffer given
+    by the caller and parsed again, which
+    rebuilds the offsets of its components.
+
+    Ownership is not transferred; the caller
+    is responsible for ensuring that the
+    lifetime of the image extends until it
+    is no longer referenced.
+
+    @par Example
+    @code
+    url_list_builder b;
+    b.push_back( url_view( "https://www.example.com/docs/a" ) );
+    b.push_back( url_view( "https://www.example.com/docs/b" ) );
+    std::string image = b.release();
+
+    url_list_view v( image );
+    std::string buf;
+    assert( v.get( 1, buf ).path() == "/docs/b" );
+    @endcode
+
+    @par Binary Format
+    The image starts with the entries. Each
+    entry has two variable length integers,
+    holding the number of shared characters
+    and the number of new characters, followed
+    by the new characters. The entries are
+    followed by the 64-bit offset of every
+    restart point, and by a 28 byte footer
+    holding the number of URLs, the size of
+    the entries, the restart interval, the
+    format version, and a signature. Fixed
+    size integers are little-endian and
+    unaligned, so the image can be shared
+    between platforms.
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref url_list_builder.
+*/
+class url_list_view
+{
+public:
+    /** Constructor
+
+        Default constructed views have
+        no URLs.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_list_view() noexcept = default;
+
+    /** Constructor
+
+        This function references the image of
+        a list. Only the footer of the image is
+        inspected; accessors check every offset
+        they read against the size of the image,
+        so a damaged image can produce errors or
+        wrong results but never reads outside of
+        `data`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `data` is not the image of a list of
+        a supported version.
+
+        @param data The binary image
+    */
+    BOOST_URL_DECL
+    explicit
+    url_list_view(
+        core::string_view data);
+
+    /** Return the binary image
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return data_;
+    }
+
+    /** Return the number of URLs in the list
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Return true if the list has no URLs
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /** Return a URL in the list
+
+        The characters of the URL at position
+        `i` are written to the buffer, and a
+        view of them is returned.
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the URL and the
+        restart interval.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return A view of the URL, which
+        references the buffer, or an error if
+        the buffer is too small or the image
+        is damaged.
+
+        @param i The position of the URL.
+
+        @param dest A pointer to the buffer.
+
+        @param size The size of the buffer.
+    */
+    BOOST_URL_DECL
+    system::result<url_view>
+    get(
+        std::size_t i,
+        char* dest,
+        std::size_t size) const noexcept;
+
+    /** Return a URL in the list
+
+        The characters of the URL at position
+        `i` are assigned to `dest`, and a view
+        of them is returned.
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Linear in the size of the URL and the
+        restart interval.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @return A view of the URL, which
+        references `dest`.
+
+        @throw system_error
+        The image is damaged.
+
+        @param i The position of the URL.
+
+        @param dest The string to assign.
+    */
+    BOOST_URL_DECL
+    url_view
+    get(
+        std::size_t i,
+        std::string& dest) const;
+
+    /** Return the position of the first URL not less than a string
+
+        URLs are ordered by the characters of
+        their buffers, as in the list. When
+        every URL in the list is less than `s`,
+        the size of the list is returned.
+
+        @par Complexity
+        Logarithmic in the size of the list,
+        and linear in the restart interval.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The string to find.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    lower_bound(
+        core::string_view s) const noexcept;
+
+private:
+    core::string_view data_;
+    std::size_t size_ = 0;
+    std::size_t entries_size_ = 0;
+    std::size_t interval_ = 1;
+};
+
+//------------------------------------------------
+
+/** A builder for sorted, front-coded lists of URLs
+
+    URLs are appended in ascending order of
+    the characters of their buffers, and the
+    binary image of the list is returned by
+    @ref release.
+
+    @par Example
+    @code
+    url_list_builder b;
+    for( url_view u : sorted_urls )
+        b.push_back( u );
+    write_file( "frontier.bin", b.release() );
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref url_list_view.
+*/
+class url_list_builder
+{
+public:
+    /** Constructor
+
+        A URL is stored in full every
+        `restart_interval` URLs. Longer
+        intervals make the image smaller
+        and accesses slower.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `restart_interval == 0 || restart_interval > 64`
+
+        @param restart_interval The number
+        of URLs between restart points.
+    */
+    BOOST_URL_DECL
+    explicit
+    url_list_builder(
+        std::size_t restart_interval = 16);
+
+    /** Return the number of URLs in the list
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Append a URL
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `u.buffer()` is less than the
+        buffer of the last URL appended.
+
+        @param u The URL to append.
+    */
+    BOOST_URL_DECL
+    void
+    push_back(url_view_base const& u);
+
+    /** Return the image of the list
+
+        The returned string can be used to
+        construct a @ref url_list_view.
+        Afterwards, the builder is empty.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    std::string
+    release();
+
+private:
+    std::string entries_;
+    std::string restarts_;
+    std::string last_;
+    std::size_t size_ = 0;
+    std::size_t interval_;
+};
+
+} // urls
+} // boost
+
+#endif
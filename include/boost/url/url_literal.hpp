@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_LITERAL_HPP
+#define BOOST_URL_URL_LITERAL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/parse_literal.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A URL parsed in a constant expression
+
+    Objects of this type hold a URI-reference
+    and the offsets of its parts, computed by
+    the constructor. Declared `constexpr`, the
+    string is parsed by the compiler: an
+    invalid literal is a compile error, and
+    the conversion to @ref url_view at run
+    time only copies the precomputed offsets.
+
+    The grammar is the same as the one used by
+    @ref parse_uri_reference, and the resulting
+    views are identical.
+
+    This requires a compiler with relaxed
+    `constexpr` support (C++14 or later).
+    Otherwise the string is parsed at run
+    time when the object is constructed.
+
+    The object references the characters of
+    the string, which should be a string
+    literal or otherwise outlive it.
+
+    @par Example
+    @code
+    constexpr url_literal api( "https://api.example.com/v1/users?active" );
+
+    url_view u = api;
+    assert( u.host() == "api.example.com" );
+    @endcode
+
+    @par BNF
+    @code
+    URI-reference = URI / relative-ref
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-4.1"
+        >4.1. URI Reference (rfc3986)</a>
+
+    @see
+        @ref parse_uri_reference,
+        @ref url_view.
+*/
+class url_literal
+{
+public:
+    /** Constructor
+
+        Default constructed literals
+        refer to an empty string.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    url_literal() noexcept = default;
+
+    /** Constructor
+
+        This function parses a string literal
+        as a <em>URI-reference</em>. In a
+        constant expression, an invalid string
+        fails to compile.
+
+        @par Complexity
+        Linear in `N`.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid URI-reference.
+
+        @param s The string literal to parse.
+    */
+    template<std::size_t N>
+    BOOST_CXX14_CONSTEXPR
+    url_literal(
+        char const(&s)[N])
+        : url_literal(
+            core::string_view(s, N - 1))
+    {
+    }
+
+    /** Constructor
+
+        This function parses a string
+        as a <em>URI-reference</em>. In a
+        constant expression, an invalid string
+        fails to compile.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid URI-reference.
+
+        @param s The string to parse.
+    */
+    BOOST_CXX14_CONSTEXPR
+    explicit
+    url_literal(
+        core::string_view s)
+        : s_(s.data())
+        , n_(s.size())
+    {
+        if(! detail::literal::parse_uri_reference(
+                s_, n_, p_))
+            detail::throw_invalid_argument();
+    }
+
+    /** Return the string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    core::string_view
+    buffer() const noexcept
+    {
+        return core::string_view(s_, n_);
+    }
+
+    /** Return a pointer to the string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    char const*
+    data() const noexcept
+    {
+        return s_;
+    }
+
+    /** Return the number of characters in the string
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    constexpr
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return a view of the URL
+
+        The returned view references the
+        characters of the string. No parsing
+        takes place.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    BOOST_URL_DECL
+    operator url_view() const noexcept;
+
+private:
+    char const* s_ = "";
+    std::size_t n_ = 0;
+    detail::literal_parts p_;
+};
+
+} // urls
+} // boost
+
+#endif
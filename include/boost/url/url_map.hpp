@@ -0,0 +1,388 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_MAP_HPP
+#define BOOST_URL_URL_MAP_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A map from URLs which are unique up to normalization
+
+    Keys are equal when they compare equal
+    with @ref url_view_base::compare, so a
+    different spelling of a key finds the
+    same element.
+
+    The keys are stored as in @ref url_set:
+    their characters are kept in one arena,
+    and the slots of the table hold the
+    fingerprint of each key next to its
+    position in the arena. The mapped values
+    are stored contiguously, in insertion
+    order.
+
+    @par Example
+    @code
+    url_map< int > m;
+    m[ url_view( "http://www.example.com/a/./b" ) ] = 1;
+    m[ url_view( "HTTP://www.EXAMPLE.com/a/%62" ) ] += 1;
+    assert( m.size() == 1 );
+    assert( (*m.find( url_view( "http://www.example.com/a/b" ) )).second == 2 );
+    @endcode
+
+    @par Iterator Invalidation
+    Inserting elements does not invalidate
+    iterators. The views and references
+    returned when they are dereferenced are
+    invalidated by inserting elements.
+
+    @tparam T The type of the mapped values.
+
+    @see
+        @ref url_set,
+        @ref url_view_base::compare,
+        @ref url_view_base::fingerprint.
+*/
+template<class T>
+class url_map
+{
+    detail::url_table t_;
+    std::vector<T> v_;
+
+#ifndef BOOST_URL_DOCS
+    template<class V>
+    class basic_iterator;
+#endif
+
+public:
+    /** A Bidirectional iterator to an element
+
+        Objects of this type allow iteration
+        through the elements of the map.
+        Dereferencing yields a pair with a
+        view of the key and a reference to
+        the mapped value.
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    using iterator = basic_iterator<T>;
+#endif
+
+    /** A Bidirectional iterator to a constant element
+    */
+#ifdef BOOST_URL_DOCS
+    using const_iterator = __see_below__;
+#else
+    using const_iterator = basic_iterator<T const>;
+#endif
+
+    /** The key type
+    */
+    using key_type = url_view;
+
+    /** The mapped type
+    */
+    using mapped_type = T;
+
+    /** The reference type
+
+        This is the type of value returned when
+        iterators of the map are dereferenced.
+    */
+    using reference = std::pair<url_view, T&>;
+
+    /// @copydoc reference
+    using const_reference = std::pair<url_view, T const&>;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default constructed maps are empty
+        and do not allocate memory.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_map() noexcept = default;
+
+    /** Return true if the map is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return the number of elements
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return an iterator to the first element
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() noexcept;
+
+    /// @copydoc begin
+    const_iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() noexcept;
+
+    /// @copydoc end
+    const_iterator
+    end() const noexcept;
+
+    /** Reserve room for elements
+
+        Memory is allocated so that `n`
+        elements whose keys have `chars`
+        characters in total can be inserted
+        without further allocations.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param n The number of elements.
+
+        @param chars The number of characters
+        in all the keys.
+    */
+    void
+    reserve(
+        std::size_t n,
+        std::size_t chars = 0);
+
+    /** Remove all elements
+
+        The capacity is not released.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept
+    {
+        t_.clear();
+        v_.clear();
+    }
+
+    /** Swap the contents
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The map to swap with.
+    */
+    void
+    swap(url_map& other) noexcept
+    {
+        t_.swap(other.t_);
+        v_.swap(other.v_);
+    }
+
+    /** Swap the contents
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    friend
+    void
+    swap(
+        url_map& a,
+        url_map& b) noexcept
+    {
+        a.swap(b);
+    }
+
+    /** Insert an element constructed in place
+
+        When the map does not contain a key
+        which compares equal to `u`, a copy
+        of the characters of `u` is inserted
+        with a value constructed from `args`.
+        Otherwise, nothing is constructed.
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by the constructor
+        of `T` are propagated.
+
+        @return An iterator to the element
+        whose key is equal to `u`, and true
+        if it was inserted.
+
+        @param u The key.
+
+        @param args The arguments to construct
+        the mapped value with.
+    */
+    template<class... Args>
+    std::pair<iterator, bool>
+    emplace(
+        url_view_base const& u,
+        Args&&... args);
+
+    /** Insert an element
+
+        When the map does not contain a key
+        which compares equal to `u`, a copy
+        of the characters of `u` is inserted
+        with `value`.
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return An iterator to the element
+        whose key is equal to `u`, and true
+        if it was inserted.
+
+        @param u The key.
+
+        @param value The mapped value.
+    */
+    std::pair<iterator, bool>
+    insert(
+        url_view_base const& u,
+        T const& value)
+    {
+        return emplace(u, value);
+    }
+
+    /// @copydoc insert
+    std::pair<iterator, bool>
+    insert(
+        url_view_base const& u,
+        T&& value)
+    {
+        return emplace(u, std::move(value));
+    }
+
+    /** Return the value mapped to a key
+
+        When the map does not contain a key
+        which compares equal to `u`, an element
+        with a value initialized mapped value
+        is inserted.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The key.
+    */
+    T&
+    operator[](url_view_base const& u);
+
+    /** Return an iterator to the element with a key
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the element, or
+        `end()` if there is none.
+
+        @param u The key to find.
+    */
+    iterator
+    find(url_view_base const& u) noexcept;
+
+    /// @copydoc find
+    const_iterator
+    find(url_view_base const& u) const noexcept;
+
+    /** Return true if the map contains a key
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The key to find.
+    */
+    bool
+    contains(url_view_base const& u) const noexcept
+    {
+        return t_.find(u, u.fingerprint()) !=
+            detail::url_table::npos;
+    }
+
+    /** Return the number of elements with a key
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return 1 if the map contains `u`,
+        and 0 otherwise.
+
+        @param u The key to find.
+    */
+    std::size_t
+    count(url_view_base const& u) const noexcept
+    {
+        return contains(u) ? 1 : 0;
+    }
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/url_map.hpp>
+
+#endif
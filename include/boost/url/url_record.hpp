@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_RECORD_HPP
+#define BOOST_URL_URL_RECORD_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url_dictionary.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A writer of compact binary URL records
+
+    A record stores a URL in a few bytes by
+    replacing its well-known scheme with its
+    @ref scheme value, and its host, path
+    segments, and param keys with their
+    identifiers in a @ref url_dictionary,
+    when the dictionary has them. Other
+    strings are stored as they are written,
+    so any URL can be stored, and is read
+    back with the same characters.
+
+    Records need no other framing, so they
+    can be concatenated.
+
+    @par Example
+    @code
+    url_record_writer w( dict );
+    std::string batch;
+    for( url_view u : urls )
+        w.write( u, batch );
+    producer.send( batch );
+    @endcode
+
+    @par Binary Format
+    A record starts with a byte of flags
+    telling whether the URL has a scheme,
+    an authority, a userinfo, a port, a
+    query, and a fragment, and whether its
+    path is absolute, from the least
+    significant bit. The parts which are
+    present follow in order. The scheme is
+    a variable length integer holding its
+    @ref scheme value, or zero followed by
+    a string. The userinfo and the port are
+    strings. The host is a variable length
+    integer holding its identifier plus
+    one, or zero followed by a string. The
+    path is the number of segments plus
+    one, followed by each segment stored
+    as the host is, or zero followed by the
+    path as a string. The query is the
+    number of params plus one, followed by
+    each param, or zero followed by the
+    query as a string. A param is a
+    variable length integer holding twice
+    the identifier of its key plus one, or
+    zero, plus one if it has a value, then
+    the key as a string when it has no
+    identifier, then the value as a string
+    if there is one. The fragment is a
+    string. Strings are their size as a
+    variable length integer, followed by
+    their characters. Variable length
+    integers store 7 bits per byte, least
+    significant first.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe.
+
+    @see
+        @ref url_dictionary,
+        @ref url_record_reader.
+*/
+class url_record_writer
+{
+    url_dictionary const* d_;
+
+public:
+    /** Constructor
+
+        The dictionary is referenced, and
+        must remain valid while the writer
+        is used.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param d The dictionary.
+    */
+    explicit
+    url_record_writer(
+        url_dictionary const& d) noexcept
+        : d_(&d)
+    {
+    }
+
+    /** Append the record of a URL
+
+        @par Complexity
+        Linear in `u.size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The URL.
+
+        @param dest The string to append to.
+    */
+    BOOST_URL_DECL
+    void
+    write(
+        url_view_base const& u,
+        std::string& dest) const;
+};
+
+//------------------------------------------------
+
+/** A reader of compact binary URL records
+
+    The reader rebuilds the characters of
+    the URL of a record, written by a
+    @ref url_record_writer, in an arena it
+    owns, and parses them.
+
+    @par Example
+    @code
+    url_record_reader r( dict );
+    core::string_view batch = consumer.poll();
+    while( ! batch.empty() )
+        process( r.read( batch ).value() );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe.
+
+    @see
+        @ref url_dictionary,
+        @ref url_record_writer.
+*/
+class url_record_reader
+{
+    url_dictionary const* d_;
+    std::string arena_;
+
+public:
+    /** Constructor
+
+        The dictionary is referenced, and
+        must remain valid while the reader
+        is used.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param d The dictionary.
+    */
+    explicit
+    url_record_reader(
+        url_dictionary const& d) noexcept
+        : d_(&d)
+    {
+    }
+
+    /** Read the record at the start of a string
+
+        On success, `data` is moved past the
+        record. The returned view references
+        the arena of the reader, and remains
+        valid until the next call.
+
+        @par Complexity
+        Linear in the size of the URL.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return The URL, or an error if the
+        record is truncated, refers to
+        strings which are not in the
+        dictionary, or does not describe a
+        valid URL.
+
+        @param data The characters starting
+        with the record.
+    */
+    BOOST_URL_DECL
+    system::result<url_view>
+    read(core::string_view& data);
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,292 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_RULE_SET_HPP
+#define BOOST_URL_URL_RULE_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A rule matched by a @ref url_rule_set
+
+    Each member is a condition on one part
+    of a URL. An empty member matches every
+    URL. All of the strings are decoded.
+
+    @see
+        @ref url_rule_set.
+*/
+struct url_rule
+{
+    /** The host suffix to match
+
+        The host of the URL must be equal
+        to this string, or end with a dot
+        followed by it. Hosts are compared
+        case-insensitively, label by label,
+        and a trailing dot is ignored. For
+        example, `example.com` matches
+        `example.com` and `ads.example.com`,
+        but not `badexample.com`.
+    */
+    core::string_view host;
+
+    /** The path prefix to match
+
+        The segments of the path of the URL
+        must start with the segments of this
+        string, which are compared exactly.
+        For example, `/ads` matches `/ads`
+        and `/ads/banner.png`, but not
+        `/adsense`, and `/ads/` matches
+        `/ads/banner.png` but not `/ads`.
+    */
+    core::string_view path;
+
+    /** The key of a query parameter which must be present
+
+        Keys are compared exactly.
+    */
+    core::string_view param;
+};
+
+//------------------------------------------------
+
+/** A compiled set of rules matched against URLs
+
+    This container holds many rules, each
+    made of a host suffix, a path prefix,
+    and a query parameter key, as used by
+    access control lists and content
+    blockers. It returns the identifiers of
+    every rule matching a URL in one pass.
+
+    The host suffixes are stored in a trie
+    of labels, read from the rightmost label
+    of a host. Every node of this trie owns
+    a second trie holding the path prefixes
+    of its rules, one segment per edge. The
+    children of all nodes are found through
+    a single hash table. A match walks the
+    labels of the host once and, for each
+    host suffix found, the segments of the
+    path once, so its cost depends on the
+    size of the URL and the number of rules
+    which match it, and not on the number of
+    rules in the set. Matching does not
+    allocate, other than to append to the
+    caller's vector.
+
+    @par Example
+    @code
+    url_rule_set rs;
+    rs.insert( 1, { "ads.example.com", {}, {} } );
+    rs.insert( 2, { "example.com", "/track", {} } );
+    rs.insert( 3, { "", "/", "utm_source" } );
+
+    std::vector< std::size_t > ids;
+    rs.match( url_view( "https://www.example.com/track/x?utm_source=a" ), ids );
+    assert( ids.size() == 2 );     // 3 and 2
+    @endcode
+
+    @par Exception Safety
+    Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref url_rule.
+*/
+class url_rule_set
+{
+public:
+    /** Constructor
+
+        Default constructed sets have no rules.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_rule_set() noexcept = default;
+
+    /** Insert a rule
+
+        The rule is added to the set with the
+        identifier `id`, which is returned when
+        the rule matches. The same identifier
+        may be used for several rules.
+
+        @par Complexity
+        Linear in the size of the strings
+        of `r`, on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param id The identifier of the rule.
+
+        @param r The rule.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        std::size_t id,
+        url_rule const& r);
+
+    /** Append the identifiers of the rules matching a URL
+
+        The identifiers are appended to `ids`.
+        Rules with shorter host suffixes come
+        first and, for the same host suffix,
+        rules with shorter path prefixes come
+        first. Otherwise, rules come in the
+        order they were inserted. An
+        identifier appears once for
+        every matching rule which uses it.
+
+        @par Complexity
+        Linear in the number of labels in the
+        host times the number of segments in
+        the path, plus the number of rules
+        which match the host and path.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw. The
+        identifiers appended before an
+        exception are kept.
+
+        @return The number of identifiers
+        appended.
+
+        @param u The URL to match.
+
+        @param ids The vector to which the
+        identifiers are appended.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        url_view_base const& u,
+        std::vector<std::size_t>& ids) const;
+
+    /** Return true if any rule matches a URL
+
+        @par Complexity
+        The same as @ref match.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL to match.
+    */
+    BOOST_URL_DECL
+    bool
+    match_any(
+        url_view_base const& u) const noexcept;
+
+    /** Return the number of rules in the set
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return rules_.size();
+    }
+
+    /** Return true if the set has no rules
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return rules_.empty();
+    }
+
+private:
+    struct node
+    {
+        // the edge from the parent
+        std::size_t parent = 0;
+        std::size_t key = 0;
+        std::size_t size = 0;
+
+        // host nodes: the root of the
+        // path trie, zero if none. The
+        // root has no key, and is not
+        // in the table
+        std::size_t paths = 0;
+
+        // path nodes: one more than the
+        // first and last rules ending here
+        std::size_t rules = 0;
+        std::size_t last = 0;
+    };
+
+    struct rule
+    {
+        std::size_t id;
+        std::size_t param;
+        std::size_t param_size;
+
+        // the path must have more
+        // segments than the prefix
+        bool deeper;
+
+        // one more than the next rule
+        // ending at the same node
+        std::size_t next;
+    };
+
+    struct slot
+    {
+        std::size_t hash = 0;
+        // zero if empty
+        std::size_t node = 0;
+    };
+
+    struct cursor;
+
+    std::size_t
+    child(
+        std::size_t parent,
+        cursor c) const noexcept;
+
+    template<class F>
+    bool
+    visit(
+        url_view_base const& u,
+        F const& f) const;
+
+    void rehash(std::size_t n);
+    void link(std::size_t i) noexcept;
+
+    std::vector<node> nodes_;
+    std::vector<rule> rules_;
+    std::vector<slot> table_;
+    std::string keys_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,279 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SCANNER_HPP
+#define BOOST_URL_URL_SCANNER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+/** A forward range of the URLs found in a text
+
+    This range finds the absolute URLs with
+    an authority, such as those in the links
+    of an HTML document or in plain text,
+    without copying the text. The elements
+    are views which reference the characters
+    of the text, which must remain valid
+    while they are used.
+
+    Candidates are found by searching for
+    "://" several bytes at a time. The
+    scheme is the longest run of scheme
+    characters before it which starts with
+    a letter. The candidate extends over the
+    characters that may appear in a URL,
+    which are @ref pchars, @ref gen_delim_chars,
+    and '%', and it ends before any fragment.
+    Trailing punctuation which usually
+    belongs to the surrounding text, such as
+    a final period or an unmatched closing
+    parenthesis, is removed. Each candidate
+    is then parsed with @ref absolute_uri_rule,
+    and candidates which are not valid are
+    skipped.
+
+    The text is scanned lazily, as the
+    iterators are incremented.
+
+    @par Example
+    @code
+    core::string_view s =
+        "<a href=\"https://www.example.com/a?x=1\">home</a> "
+        "(see http://example.org/docs.)";
+
+    url_scanner sc( s );
+    auto it = sc.begin();
+    assert( it->buffer() == "https://www.example.com/a?x=1" );
+    ++it;
+    assert( it->buffer() == "http://example.org/docs" );
+    ++it;
+    assert( it == sc.end() );
+    @endcode
+
+    @par BNF
+    @code
+    absolute-URI  = scheme ":" hier-part [ "?" query ]
+    @endcode
+
+    @see
+        @ref absolute_uri_rule,
+        @ref url_view.
+*/
+class url_scanner
+{
+    core::string_view s_;
+
+public:
+    class iterator;
+
+    /** The value type
+    */
+    using value_type = url_view;
+
+    /** The reference type
+
+        This is the type of value returned
+        when iterators of the range are
+        dereferenced.
+    */
+    using reference = url_view;
+
+    /// @copydoc reference
+    using const_reference = url_view;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** Constructor
+
+        Default constructed ranges
+        are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_scanner() noexcept = default;
+
+    /** Constructor
+
+        The range references the text,
+        which is not scanned until the
+        range is iterated.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param s The text to scan
+    */
+    explicit
+    url_scanner(
+        core::string_view s) noexcept
+        : s_(s)
+    {
+    }
+
+    /** Return the text being scanned
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    core::string_view
+    buffer() const noexcept
+    {
+        return s_;
+    }
+
+    /** Return an iterator to the first URL
+
+        The text is scanned up to the
+        end of the first URL.
+
+        @par Complexity
+        Linear in the number of characters
+        up to the end of the first URL.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+};
+
+//------------------------------------------------
+
+/** A forward iterator to the URLs found in a text
+*/
+class url_scanner::iterator
+{
+    friend class url_scanner;
+
+    char const* it_ = nullptr;
+    char const* end_ = nullptr;
+    url_view u_;
+
+    iterator(
+        char const* it,
+        char const* end) noexcept
+        : it_(it)
+        , end_(end)
+    {
+        if(it_)
+            next();
+    }
+
+    // Find the next valid URL at or
+    // after it_, or set it_ to null
+    BOOST_URL_DECL
+    void
+    next() noexcept;
+
+public:
+    using value_type = url_view;
+    using reference = url_view;
+    using pointer = url_view const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    /** Constructor
+
+        Default constructed iterators
+        are equal to the end iterator
+        of any range.
+    */
+    iterator() noexcept = default;
+
+    reference
+    operator*() const noexcept
+    {
+        BOOST_ASSERT(it_);
+        return u_;
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        BOOST_ASSERT(it_);
+        return &u_;
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(it_);
+        next();
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return it_ == other.it_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return it_ != other.it_;
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+url_scanner::
+begin() const noexcept ->
+    iterator
+{
+    return iterator(
+        s_.data(), s_.data() + s_.size());
+}
+
+inline
+auto
+url_scanner::
+end() const noexcept ->
+    iterator
+{
+    return iterator();
+}
+
+} // urls
+} // boost
+
+#endif
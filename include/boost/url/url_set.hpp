@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SET_HPP
+#define BOOST_URL_URL_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+/** A set of URLs which are unique up to normalization
+
+    URLs are equal when they compare equal
+    with @ref url_view_base::compare, so a
+    URL is not inserted when the set already
+    contains a different spelling of it.
+
+    The characters of all the URLs are stored
+    in one contiguous arena, and the table uses
+    open addressing. Each slot holds the
+    @ref url_view_base::fingerprint of a URL
+    next to its position in the arena, so the
+    stored URLs are only parsed and compared
+    when the fingerprints match. Apart from the
+    characters, each URL costs between 30 and
+    50 bytes.
+
+    Elements are visited in insertion
+    order, as the spelling with which
+    they were first inserted.
+
+    @par Example
+    @code
+    url_set s;
+    s.insert( url_view( "http://www.example.com/a/./b" ) );
+    assert( ! s.insert( url_view( "HTTP://www.EXAMPLE.com/a/%62" ) ).second );
+    assert( s.contains( url_view( "http://www.example.com/a/b" ) ) );
+    assert( s.size() == 1 );
+    @endcode
+
+    @par Iterator Invalidation
+    Inserting elements does not invalidate
+    iterators. The views returned when they
+    are dereferenced are invalidated by
+    inserting elements.
+
+    @see
+        @ref url_map,
+        @ref url_view_base::compare,
+        @ref url_view_base::fingerprint.
+*/
+class url_set
+{
+    detail::url_table t_;
+
+public:
+    /** A Bidirectional iterator to an element
+
+        Objects of this type allow iteration
+        through the URLs in the set.
+        The values returned are read-only;
+        elements cannot be modified.
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+
+        This is the type of value returned when
+        iterators of the set are dereferenced.
+    */
+    using value_type = url_view;
+
+    /// @copydoc value_type
+    using reference = url_view;
+
+    /// @copydoc value_type
+    using const_reference = url_view;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default constructed sets are empty
+        and do not allocate memory.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_set() noexcept = default;
+
+    /** Return true if the set is empty
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    bool
+    empty() const noexcept
+    {
+        return t_.size() == 0;
+    }
+
+    /** Return the number of elements
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return t_.size();
+    }
+
+    /** Return an iterator to the first element
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    iterator
+    end() const noexcept;
+
+    /** Reserve room for elements
+
+        Memory is allocated so that `n`
+        elements with `chars` characters in
+        total can be inserted without further
+        allocations.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param n The number of elements.
+
+        @param chars The number of characters
+        in all the elements.
+    */
+    void
+    reserve(
+        std::size_t n,
+        std::size_t chars = 0)
+    {
+        t_.reserve(n, chars);
+    }
+
+    /** Remove all elements
+
+        The capacity is not released.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept
+    {
+        t_.clear();
+    }
+
+    /** Swap the contents
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param other The set to swap with.
+    */
+    void
+    swap(url_set& other) noexcept
+    {
+        t_.swap(other.t_);
+    }
+
+    /** Swap the contents
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    friend
+    void
+    swap(
+        url_set& a,
+        url_set& b) noexcept
+    {
+        a.swap(b);
+    }
+
+    /** Insert a URL
+
+        A copy of the characters of `u` is
+        inserted, unless the set contains a
+        URL which compares equal to `u`.
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return An iterator to the element
+        equal to `u`, and true if it was
+        inserted.
+
+        @param u The URL to insert.
+    */
+    std::pair<iterator, bool>
+    insert(url_view_base const& u);
+
+    /** Return an iterator to the element equal to a URL
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the element, or
+        `end()` if there is none.
+
+        @param u The URL to find.
+    */
+    iterator
+    find(url_view_base const& u) const noexcept;
+
+    /** Return true if the set contains a URL
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL to find.
+    */
+    bool
+    contains(url_view_base const& u) const noexcept
+    {
+        return t_.find(u, u.fingerprint()) !=
+            detail::url_table::npos;
+    }
+
+    /** Return the number of elements equal to a URL
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return 1 if the set contains `u`,
+        and 0 otherwise.
+
+        @param u The URL to find.
+    */
+    std::size_t
+    count(url_view_base const& u) const noexcept
+    {
+        return contains(u) ? 1 : 0;
+    }
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/url_set.hpp>
+
+#endif
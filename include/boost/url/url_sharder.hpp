@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SHARDER_HPP
+#define BOOST_URL_URL_SHARDER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** Assigns URLs to shards by registrable domain
+
+    The shard of a URL depends only on the
+    registrable domain of its host, as given
+    by a public suffix list, so that all the
+    URLs of a site go to the same shard.
+    Hosts which have no registrable domain,
+    such as IP addresses or public suffixes,
+    are used whole. The domain is hashed
+    after decoding escapes and ignoring
+    case, with a hash which is the same on
+    every platform and in every run for a
+    given seed.
+
+    The hash is mapped to a shard with a
+    jump consistent hash. When the number of
+    shards grows from `n` to `n + 1`, only
+    about `1 / (n + 1)` of the domains move,
+    all of them to the new shard.
+
+    @par Example
+    @code
+    url_sharder s( psl, 512 );
+
+    std::vector< std::vector< std::size_t > > shards;
+    s.assign( urls.data(), urls.size(), shards );
+
+    // shards[ i ] lists the indexes of the urls of shard i
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe.
+
+    @see
+        @ref public_suffix_list,
+        @ref public_suffix_list_view.
+*/
+class url_sharder
+{
+    public_suffix_list_view psl_;
+    std::uint64_t seed_;
+    std::uint32_t n_;
+
+public:
+    /** Constructor
+
+        The list is referenced, and
+        must remain valid while the
+        sharder is used.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `shards == 0`.
+
+        @param psl The public suffix list.
+
+        @param shards The number of shards.
+
+        @param seed The seed of the hash.
+    */
+    BOOST_URL_DECL
+    url_sharder(
+        public_suffix_list_view psl,
+        std::uint32_t shards,
+        std::uint64_t seed = 0);
+
+    /** Return the number of shards
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    std::uint32_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return the part of a URL which is hashed
+
+        This is the registrable domain of
+        the host, or the host when it has
+        no registrable domain. The returned
+        string views the end of the host.
+
+        @par Example
+        @code
+        assert( s.key( url_view( "https://www.example.co.uk/" ) ) == "example.co.uk" );
+        @endcode
+
+        @par Complexity
+        Linear in `u.encoded_host().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    key(url_view_base const& u) const noexcept;
+
+    /** Return the hash of the key of a URL
+
+        @par Complexity
+        Linear in `u.encoded_host().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL.
+
+        @see
+            @ref key.
+    */
+    BOOST_URL_DECL
+    std::uint64_t
+    digest(url_view_base const& u) const noexcept;
+
+    /** Return the shard of a URL
+
+        @par Complexity
+        Linear in `u.encoded_host().size()`,
+        plus logarithmic in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return A shard less than `this->size()`.
+
+        @param u The URL.
+    */
+    BOOST_URL_DECL
+    std::uint32_t
+    shard(url_view_base const& u) const noexcept;
+
+    /** Assign a range of URLs to shards
+
+        On return, `shards` holds one list
+        per shard, with the indexes of its
+        URLs in increasing order. The
+        capacity of the lists is reused.
+
+        @par Complexity
+        Linear in the size of the hosts.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param urls A pointer to the first URL.
+
+        @param n The number of URLs.
+
+        @param shards The lists of indexes.
+    */
+    BOOST_URL_DECL
+    void
+    assign(
+        url_view const* urls,
+        std::size_t n,
+        std::vector<std::vector<
+            std::size_t>>& shards) const;
+};
+
+} // urls
+} // boost
+
+#endif
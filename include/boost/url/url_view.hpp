@@ -337,6 +337,76 @@ public:
     }
 };
 
+//------------------------------------------------
+
+/** Return shared, persistent copies of a range of urls
+
+    This function copies every url in the range
+    `[first, last)` into one contiguous arena
+    obtained from a single allocation, and
+    writes a shared, read-only @ref url_view for
+    each of them to `out`, in order. The arena
+    holds the shared control block, the views,
+    and the characters of all the urls. Each
+    pointer written shares ownership of the
+    arena, which is freed when the last of
+    them is released.
+
+    This is more efficient than calling
+    @ref url_view_base::persist for each url
+    when many urls with the same lifetime are
+    kept, such as all of the urls found while
+    parsing a document.
+
+    @par Example
+    @code
+    std::vector< url_view > v;
+    v.push_back( url_view( "http://a.example.com/" ) );
+    v.push_back( url_view( "http://b.example.com/" ) );
+
+    std::vector< std::shared_ptr< url_view const > > sp;
+    persist_all( v.begin(), v.end(), std::back_inserter( sp ) );
+    assert( sp.size() == 2 );
+    assert( sp[1]->buffer() == "http://b.example.com/" );
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the urls.
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @return The output iterator, after
+    the last element written.
+
+    @param first The beginning of the range.
+    Dereferencing an iterator must yield an
+    object convertible to
+    `url_view_base const&`.
+
+    @param last The end of the range.
+
+    @param out The output iterator to which a
+    `std::shared_ptr<url_view const>` is
+    written for each url.
+
+    @param a The allocator to use. If omitted,
+    `std::allocator<char>` is used.
+
+    @see
+        @ref url_view_base::persist.
+*/
+template<
+    class FwdIt,
+    class OutputIt,
+    class Allocator = std::allocator<char>>
+OutputIt
+persist_all(
+    FwdIt first,
+    FwdIt last,
+    OutputIt out,
+    Allocator const& a = Allocator());
+
 } // urls
 } // boost
 
@@ -370,4 +440,6 @@ private:
 } // std
 #endif
 
+#include <boost/url/impl/url_view.hpp>
+
 #endif
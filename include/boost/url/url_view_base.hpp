@@ -16,12 +16,14 @@
 #include <boost/url/host_type.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
+#include <boost/url/origin_view.hpp>
 #include <boost/url/params_view.hpp>
 #include <boost/url/params_encoded_view.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/segments_encoded_view.hpp>
 #include <boost/url/segments_view.hpp>
+#include <boost/url/url_fingerprint.hpp>
 #include <boost/url/detail/url_impl.hpp>
 #include <boost/url/grammar/string_token.hpp>
 #include <boost/assert.hpp>
@@ -38,7 +40,14 @@ namespace urls {
 #ifndef BOOST_URL_DOCS
 namespace detail {
 struct pattern;
+struct normalizer;
+struct url_image;
+struct whatwg_parser;
+struct iri_parser;
+struct persist_arena;
 }
+template<class Allocator>
+class basic_url;
 #endif
 
 
@@ -71,8 +80,11 @@ class BOOST_URL_DECL
 
     friend class url;
     friend class url_base;
+    template<class> friend class basic_url;
     friend class url_view;
     friend class static_url_base;
+    friend class small_url_base;
+    friend class shared_url;
     friend class params_base;
     friend class params_encoded_base;
     friend class params_encoded_ref;
@@ -86,6 +98,18 @@ class BOOST_URL_DECL
     friend class segments_ref;
     friend class segments_view;
     friend struct detail::pattern;
+    friend struct detail::normalizer;
+    friend struct detail::url_image;
+    friend class url_edit;
+    friend class uri_template;
+    friend class edit_session;
+    friend class url_builder;
+    friend class resolver;
+    friend class url_sanitizer;
+    friend class cache_key_builder;
+    friend struct detail::whatwg_parser;
+    friend struct detail::iri_parser;
+    friend struct detail::persist_arena;
 
     struct shared_impl;
 
@@ -297,6 +321,43 @@ public:
     std::shared_ptr<
         url_view const> persist() const;
 
+    /** Return a shared, persistent copy of the url
+
+        This function returns a read-only copy of
+        the url, with shared lifetime, using the
+        specified allocator. The object, the
+        shared control block, and a copy of the
+        underlying string are placed in a single
+        allocation obtained from `a`, which is
+        also used to free it when the last
+        reference is released.
+
+        @par Example
+        @code
+        url_view u( "http://example.com/path" );
+        std::shared_ptr< url_view const > sp = u.persist( std::allocator< char >() );
+        assert( sp->buffer() == u.buffer() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @tparam Allocator An <em>Allocator</em>
+        type. It is rebound as needed.
+
+        @param a The allocator to use.
+
+        @see
+            @ref persist_all.
+    */
+    template<class Allocator>
+    std::shared_ptr<
+        url_view const> persist(
+            Allocator const& a) const;
+
     //--------------------------------------------
     //
     // Scheme
@@ -1561,6 +1622,62 @@ public:
     std::uint16_t
     port_number() const noexcept;
 
+    /** Return the port, or the default port of the scheme
+
+        If a port is present and not empty, this
+        function returns @ref port_number.
+        Otherwise it returns the default port of
+        the scheme, which is zero for schemes
+        without one.
+
+        @par Example
+        @code
+        assert( url_view( "https://www.example.com/" ).effective_port() == 443 );
+        assert( url_view( "https://www.example.com:8443/" ).effective_port() == 8443 );
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref default_port,
+            @ref port_number.
+    */
+    std::uint16_t
+    effective_port() const noexcept;
+
+    /** Return a key identifying the host and port
+
+        The key packs a case-insensitive hash
+        of the encoded host into the high bits
+        and the @ref effective_port into the
+        low 16 bits, so URLs which connect to
+        the same host and port have equal keys.
+        It is meant for lookups in tables such
+        as connection pools, which must still
+        compare the hosts of equal keys.
+
+        @par Example
+        @code
+        assert( url_view( "http://WWW.example.com/a" ).authority_key() ==
+                url_view( "http://www.example.com:80/b" ).authority_key() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->encoded_host().size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref effective_port.
+    */
+    std::uint64_t
+    authority_key() const noexcept;
+
     //--------------------------------------------
     //
     // Path
@@ -2267,6 +2384,39 @@ public:
     pct_string_view
     encoded_origin() const noexcept;
 
+    /** Return the origin as a scheme, host and port
+
+        URLs whose scheme is `ftp`, `http`,
+        `https`, `ws` or `wss` and which have a
+        host have a tuple origin, made of the
+        scheme, the host, and the port or the
+        default port of the scheme. Other URLs
+        have an opaque origin. The returned
+        origin references the character buffer
+        of the URL, and is compared and hashed
+        without building a string.
+
+        @par Example
+        @code
+        url_view u0( "https://www.example.com/index.htm" );
+        url_view u1( "https://www.example.com:443/path?q" );
+        assert( u0.origin() == u1.origin() );
+        assert( u0.origin().port() == 443 );
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @see
+            @ref encoded_origin,
+            @ref origin_view.
+    */
+    origin_view
+    origin() const noexcept;
+
     /** Return the resource
 
         This function returns the resource, which
@@ -2359,6 +2509,148 @@ public:
     int
     compare(url_view_base const& other) const noexcept;
 
+    /** Return a 64-bit fingerprint of the normalized URL
+
+        The fingerprint is computed in one pass
+        over the components, as if the URL were
+        first normalized, without modifying or
+        copying it. URLs which compare equal have
+        equal fingerprints, which makes the value
+        suitable as a key to deduplicate URLs.
+
+        @par Example
+        @code
+        url_view u0( "HTTP://www.A.com/a/./b" );
+        url_view u1( "http://www.a.com/a/%62" );
+        assert( u0.compare( u1 ) == 0 );
+        assert( u0.fingerprint() == u1.fingerprint() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The fingerprint.
+
+        @param seed A value which changes
+        the fingerprints of all URLs.
+
+        @see
+            @ref compare,
+            @ref fingerprint128.
+    */
+    std::uint64_t
+    fingerprint(std::uint64_t seed = 0) const noexcept;
+
+    /** Return a 128-bit fingerprint of the normalized URL
+
+        The fingerprint is computed in one pass
+        over the components, as if the URL were
+        first normalized, without modifying or
+        copying it. URLs which compare equal have
+        equal fingerprints, and collisions between
+        URLs which are not equal are negligible
+        even in sets with billions of URLs.
+
+        @par Example
+        @code
+        url_view u0( "HTTP://www.A.com/a/./b" );
+        url_view u1( "http://www.a.com/a/%62" );
+        assert( u0.fingerprint128() == u1.fingerprint128() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The fingerprint.
+
+        @param seed A value which changes
+        the fingerprints of all URLs.
+
+        @see
+            @ref compare,
+            @ref fingerprint,
+            @ref url_fingerprint.
+    */
+    url_fingerprint
+    fingerprint128(std::uint64_t seed = 0) const noexcept;
+
+    /** Return a sort key of the normalized URL
+
+        The sort key is a string of bytes whose
+        order, compared as unsigned bytes with
+        `std::memcmp` or as a `std::string`, is
+        the order of @ref compare: for any two
+        URLs `u0` and `u1`, the sign of
+        `u0.compare( u1 )` is the sign of the
+        comparison of their sort keys. Keys are
+        computed once per URL, so that sorting
+        and merging compare bytes instead of
+        decoding and normalizing the components
+        in every comparison, and they can be
+        sorted with a radix sort.
+
+        The sort key is not a URL, and its
+        format may change between versions
+        of the library.
+
+        <br>
+
+        This function accepts an optional
+        <em>StringToken</em> parameter which
+        controls the return type and behavior
+        of the function:
+
+        @li When called with no arguments,
+        the return type of the function is
+        `std::string`. Otherwise
+
+        @li When called with a string token,
+        the behavior and return type of the
+        function depends on the type of string
+        token being passed.
+
+        @par Example
+        @code
+        url_view u0( "HTTP://www.A.com/a/./b" );
+        url_view u1( "http://www.a.com/c" );
+        assert( u0.compare( u1 ) < 0 );
+        assert( u0.sort_key() < u1.sort_key() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        String tokens may throw exceptions.
+
+        @param token An optional string token to
+        use. If this parameter is omitted, the
+        function returns a new `std::string`.
+
+        @see
+            @ref compare,
+            @ref radix_sort_keys,
+            @ref sort_urls.
+    */
+    template<BOOST_URL_STRTOK_TPARAM>
+    BOOST_URL_STRTOK_RETURN
+    sort_key(
+        BOOST_URL_STRTOK_ARG(token)) const
+    {
+        std::size_t const n =
+            sort_key_size();
+        char* dest = token.prepare(n);
+        write_sort_key(dest, n);
+        return token.result();
+    }
+
     /** Return the result of comparing two URLs
 
         The URLs are compared component by
@@ -2734,6 +3026,14 @@ private:
     // implementation
     //
     //--------------------------------------------
+    std::size_t
+    sort_key_size() const noexcept;
+
+    void
+    write_sort_key(
+        char* dest,
+        std::size_t n) const noexcept;
+
     static
     int
     segments_compare(
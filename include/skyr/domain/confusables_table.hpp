@@ -0,0 +1,4467 @@
+// Auto-generated by tools/make_confusables_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
+#define SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// The table of the prototypes of confusable code points of UTS #39
+///
+/// The mapping of a code point which has a canonical decomposition is its
+/// decomposition, and that of any other code point is the NFD of its
+/// prototype. The skeleton of a string is found by decomposing it, then
+/// mapping the decomposed code points, with the combining marks put in
+/// canonical order after each step. Hangul syllables are not in the table,
+/// and are decomposed by the algorithm.
+namespace skyr::confusables_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = 7;
+
+/// The index of the values of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = std::array<std::uint8_t, 8704>{
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 80, 81, 82, 83, 84, 80, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+  94, 95, 96, 97, 98, 99, 100, 101, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 102, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 103, 104, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 105, 80, 80, 80,
+  106, 80, 80, 80, 80, 80, 80, 80, 80, 80, 107, 80, 80, 108, 80, 80,
+  109, 110, 80, 80, 80, 80, 111, 80, 80, 80, 80, 80, 112, 80, 80, 80,
+  80, 80, 80, 80, 113, 80, 80, 80, 114, 80, 80, 80, 115, 116, 117, 118,
+  80, 80, 80, 119, 120, 80, 80, 80, 80, 80, 80, 80, 80, 80, 121, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  122, 80, 80, 80, 80, 80, 80, 80, 80, 80, 123, 80, 80, 80, 80, 80,
+  80, 124, 125, 126, 80, 80, 80, 80, 80, 80, 127, 80, 128, 80, 80, 80,
+  80, 80, 80, 80, 129, 80, 80, 130, 131, 80, 80, 132, 80, 133, 134, 80,
+  80, 135, 80, 80, 80, 80, 80, 136, 80, 80, 80, 80, 80, 137, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 138, 139, 80, 140,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 141, 80, 80, 142, 143, 144, 145,
+  146, 147, 148, 149, 150, 151, 152, 153, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 154,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+  80, 80, 169, 170, 80, 171, 172, 173, 174, 175, 176, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 177, 178, 80, 80, 80, 179, 180, 80, 80, 181, 182, 183,
+  184, 185, 186, 187, 188, 189, 190, 80, 191, 192, 80, 193, 194, 195, 196, 80,
+  197, 198, 199, 200, 201, 202, 80, 80, 203, 204, 205, 206, 80, 80, 80, 80,
+  207, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 208, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 209, 210, 80, 80, 80, 80, 80, 80, 80, 211, 212,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 213, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 214, 215, 216, 80, 80, 80, 217, 218, 219, 220, 221, 222, 223, 224,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  225, 80, 226, 80, 80, 227, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 228, 229, 80, 80, 80, 80, 80, 80, 80, 80, 80, 230, 231, 80, 80,
+  80, 80, 232, 80, 233, 80, 234, 80, 80, 80, 80, 80, 80, 80, 235, 80,
+  80, 80, 80, 80, 80, 80, 80, 236, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 237,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  238, 239, 240, 241, 242, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+};
+
+/// The index of the mapping of each code point of each block, or 0 when the
+/// code point is its own prototype and a starter
+inline constexpr auto block_values = std::array<std::uint16_t, 31104>{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 0, 8, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+  0, 0, 0, 0, 5, 11, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0,
+  13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+  29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 0, 0,
+  43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+  59, 60, 61, 62, 63, 64, 65, 0, 66, 67, 68, 69, 70, 71, 0, 72,
+  73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+  29, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 127, 0, 128, 129, 130, 131, 132, 133, 134,
+  134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 0, 0, 144, 145, 146, 147,
+  148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+  164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+  180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+  196, 197, 198, 198, 199, 0, 0, 200, 0, 29, 201, 0, 202, 203, 0, 0,
+  0, 204, 205, 206, 0, 0, 4, 207, 208, 209, 207, 0, 0, 210, 211, 212,
+  213, 214, 0, 0, 215, 216, 217, 218, 0, 0, 0, 0, 219, 220, 221, 222,
+  223, 0, 0, 224, 225, 226, 227, 228, 0, 0, 0, 229, 230, 231, 0, 232,
+  4, 233, 0, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246,
+  247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 260, 261,
+  262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+  278, 279, 280, 281, 282, 283, 0, 0, 284, 285, 286, 287, 288, 289, 290, 291,
+  292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+  308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 228, 0, 320, 321,
+  0, 0, 322, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+  335, 336, 337, 338, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 339, 0,
+  0, 340, 0, 0, 341, 0, 342, 343, 344, 345, 0, 0, 0, 346, 9, 347,
+  0, 348, 0, 349, 0, 0, 350, 351, 0, 352, 353, 354, 0, 0, 0, 0,
+  355, 203, 0, 356, 0, 0, 357, 0, 358, 121, 121, 359, 0, 360, 361, 362,
+  0, 363, 0, 364, 0, 365, 366, 0, 0, 0, 0, 0, 367, 368, 0, 0,
+  0, 0, 369, 0, 0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 0, 356,
+  371, 0, 372, 0, 340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  373, 0, 0, 281, 374, 375, 376, 377, 378, 379, 380, 381, 0, 0, 0, 0,
+  0, 0, 0, 382, 0, 0, 0, 0, 0, 5, 1, 5, 5, 5, 5, 383,
+  0, 0, 384, 385, 386, 0, 386, 0, 5, 0, 5, 5, 0, 0, 0, 0,
+  387, 0, 0, 383, 0, 0, 0, 388, 389, 390, 391, 121, 392, 1, 0, 0,
+  0, 393, 394, 0, 395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+  0, 0, 0, 0, 5, 0, 1, 0, 387, 0, 0, 396, 0, 0, 0, 0,
+  397, 398, 399, 400, 401, 401, 402, 403, 404, 405, 406, 407, 402, 408, 409, 410,
+  411, 399, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+  426, 427, 428, 429, 430, 431, 432, 427, 428, 433, 434, 435, 436, 437, 438, 439,
+  440, 426, 441, 442, 443, 444, 444, 445, 445, 432, 446, 447, 448, 449, 450, 451,
+  452, 453, 400, 454, 455, 456, 457, 442, 458, 459, 460, 461, 462, 463, 464, 0,
+  465, 466, 467, 468, 469, 470, 471, 465, 472, 473, 474, 475, 476, 477, 478, 479,
+  480, 481, 482, 483, 484, 485, 406, 486, 487, 488, 489, 490, 491, 492, 402, 493,
+  494, 0, 0, 0, 495, 496, 497, 498, 0, 0, 121, 499, 0, 500, 501, 502,
+  0, 0, 0, 0, 5, 503, 504, 505, 506, 507, 508, 0, 509, 0, 510, 511,
+  512, 513, 514, 0, 0, 515, 516, 517, 212, 4, 518, 519, 520, 521, 0, 3,
+  0, 522, 0, 523, 524, 525, 0, 526, 0, 0, 527, 528, 529, 530, 531, 532,
+  533, 348, 534, 356, 535, 354, 0, 211, 212, 121, 536, 0, 0, 537, 0, 538,
+  0, 539, 0, 538, 540, 370, 541, 0, 0, 0, 542, 543, 544, 545, 546, 0,
+  534, 212, 525, 547, 548, 541, 549, 0, 0, 0, 0, 550, 551, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 218, 552, 0, 0, 0, 0, 0, 0,
+  536, 539, 553, 554, 212, 354, 0, 555, 232, 556, 520, 0, 0, 557, 0, 558,
+  559, 560, 0, 561, 562, 563, 4, 564, 502, 0, 0, 0, 565, 566, 567, 0,
+  513, 198, 514, 568, 0, 515, 0, 228, 0, 569, 518, 519, 520, 517, 3, 570,
+  522, 556, 524, 525, 571, 526, 0, 0, 0, 0, 0, 572, 199, 0, 573, 0,
+  348, 574, 575, 576, 0, 577, 0, 578, 498, 579, 536, 0, 580, 581, 538, 549,
+  539, 553, 540, 356, 541, 36, 0, 0, 0, 0, 582, 583, 584, 0, 0, 585,
+  586, 587, 0, 588, 354, 231, 121, 589, 554, 0, 0, 111, 590, 591, 592, 0,
+  0, 362, 196, 196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  593, 594, 212, 365, 595, 537, 596, 597, 0, 0, 0, 0, 598, 599, 0, 0,
+  0, 0, 0, 600, 601, 602, 603, 604, 0, 0, 605, 606, 196, 196, 0, 0,
+  607, 608, 609, 346, 0, 0, 610, 611, 612, 613, 614, 615, 0, 0, 616, 617,
+  0, 0, 618, 619, 0, 0, 0, 0, 0, 0, 620, 621, 622, 623, 525, 356,
+  9, 347, 624, 0, 0, 0, 0, 0, 0, 0, 0, 625, 0, 577, 626, 627,
+  4, 628, 629, 0, 0, 630, 631, 632, 633, 632, 633, 634, 635, 636, 637, 121,
+  638, 639, 640, 641, 19, 49, 642, 643, 644, 352, 645, 646, 647, 648, 649, 650,
+  228, 372, 651, 652, 653, 654, 655, 656, 212, 365, 657, 658, 659, 660, 661, 662,
+  663, 664, 665, 666, 667, 668, 0, 0, 669, 670, 0, 0, 0, 0, 0, 0,
+  0, 671, 0, 0, 0, 0, 0, 0, 0, 0, 672, 0, 673, 674, 0, 0,
+  675, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 676, 677, 362, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 678, 0, 0, 0, 0,
+  0, 0, 0, 0, 679, 0, 0, 0, 0, 0, 680, 0, 681, 682, 0, 563,
+  0, 0, 0, 571, 0, 3, 0, 0, 0, 0, 5, 0, 0, 5, 0, 0,
+  0, 362, 0, 676, 0, 0, 676, 0, 0, 0, 0, 0, 0, 0, 535, 0,
+  625, 0, 0, 0, 0, 683, 0, 0, 684, 0, 685, 0, 684, 370, 0, 0,
+  0, 203, 0, 0, 195, 538, 0, 686, 0, 387, 0, 0, 0, 0, 0, 0,
+  0, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 398, 398, 698, 699,
+  700, 701, 702, 703, 704, 705, 706, 707, 695, 708, 709, 710, 711, 712, 713, 406,
+  714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 723, 724, 725, 726, 0, 727,
+  4, 728, 729, 387, 403, 429, 0, 730, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 4, 0, 0, 537, 5, 0, 0, 0, 0, 0, 4,
+  0, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  233, 731, 1, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 732, 733, 0, 0, 12, 0, 734,
+  735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 0, 0, 0, 0, 0,
+  0, 0, 746, 747, 748, 749, 750, 4, 0, 0, 0, 751, 0, 0, 0, 0,
+  0, 0, 0, 0, 752, 0, 0, 0, 0, 0, 0, 0, 0, 753, 0, 751,
+  0, 0, 0, 0, 0, 0, 0, 538, 0, 0, 754, 755, 756, 757, 743, 744,
+  745, 758, 759, 400, 760, 761, 433, 412, 402, 401, 402, 399, 429, 414, 762, 761,
+  763, 4, 0, 0, 0, 538, 0, 595, 519, 0, 2, 12, 764, 765, 754, 766,
+  767, 0, 768, 769, 0, 768, 770, 771, 772, 773, 0, 0, 0, 0, 751, 0,
+  0, 774, 0, 0, 0, 775, 0, 0, 776, 0, 0, 777, 0, 0, 778, 0,
+  0, 779, 780, 0, 0, 0, 0, 0, 781, 0, 0, 0, 0, 0, 782, 783,
+  0, 0, 0, 0, 784, 0, 0, 785, 784, 786, 786, 0, 0, 787, 0, 0,
+  0, 0, 0, 0, 788, 789, 0, 790, 0, 0, 754, 773, 0, 751, 538, 0,
+  791, 538, 792, 793, 0, 0, 794, 795, 796, 797, 0, 798, 754, 0, 799, 0,
+  800, 751, 754, 801, 388, 538, 802, 803, 804, 805, 806, 807, 808, 0, 0, 406,
+  809, 810, 811, 812, 813, 0, 0, 814, 411, 0, 815, 816, 403, 817, 818, 819,
+  763, 4, 820, 821, 822, 538, 823, 595, 519, 824, 0, 0, 0, 825, 826, 827,
+  0, 763, 763, 387, 387, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844,
+  403, 403, 841, 845, 846, 847, 848, 398, 849, 850, 851, 0, 0, 0, 0, 0,
+  0, 852, 0, 0, 0, 0, 799, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 853, 787, 0, 0, 0, 854, 855, 856, 0, 0, 857, 0, 0, 0,
+  0, 858, 774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 859, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 401, 860, 403, 399, 861,
+  862, 863, 864, 404, 5, 5, 0, 0, 0, 0, 865, 0, 0, 866, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 867, 868, 869, 870, 0, 871, 872, 873, 874, 875,
+  876, 877, 878, 879, 0, 880, 881, 882, 0, 883, 884, 885, 886, 887, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 888, 889, 890, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 891, 892, 893, 894, 895, 896, 897, 898,
+  0, 899, 0, 0, 900, 0, 0, 901, 902, 854, 0, 0, 0, 0, 903, 904,
+  905, 906, 907, 0, 0, 0, 908, 909, 0, 910, 911, 766, 766, 754, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 912, 913, 914, 915, 916, 917,
+  918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933,
+  934, 935, 0, 936, 937, 938, 939, 940, 938, 941, 403, 404, 942, 429, 430, 943,
+  755, 756, 757, 413, 944, 945, 946, 947, 465, 469, 470, 948, 949, 950, 951, 465,
+  952, 953, 954, 387, 955, 0, 956, 0, 957, 0, 0, 0, 0, 958, 959, 0,
+  960, 961, 962, 963, 964, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 965, 0, 0, 0, 0, 0, 0,
+  0, 966, 0, 0, 967, 0, 0, 0, 0, 0, 0, 0, 968, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 969, 0, 0,
+  0, 970, 426, 397, 398, 0, 0, 0, 971, 972, 973, 974, 975, 976, 977, 978,
+  0, 0, 0, 0, 0, 979, 538, 824, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 340, 0, 0,
+  0, 953, 0, 0, 0, 0, 980, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 968, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 981, 982, 983, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 984, 985, 0, 986,
+  987, 987, 0, 0, 0, 0, 3, 0, 0, 0, 322, 0, 0, 988, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 989, 0,
+  0, 0, 954, 990, 0, 0, 991, 992, 993, 994, 995, 0, 0, 0, 0, 996,
+  997, 0, 0, 0, 998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 999, 0, 0, 1000, 0, 0, 0, 0, 0, 968, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1001, 0, 969, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1002, 1003, 1004, 0, 0, 1005, 0,
+  0, 0, 0, 0, 0, 0, 538, 988, 0, 0, 322, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 953, 954, 387, 0, 0, 1006, 0, 0, 0, 0, 0, 0, 1007, 0, 1008,
+  1009, 1010, 0, 1011, 1012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 968, 1013, 0, 0,
+  0, 1014, 1015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 969, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 538, 0, 1016, 1017, 1018, 0, 0, 0, 1019, 0,
+  1020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 953, 0, 322, 0, 0, 1021, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 968, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1022, 0, 0, 1023, 1024, 1025, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 1027, 0, 0,
+  0, 0, 0, 0, 0, 0, 3, 0, 988, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1028, 0, 0, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1030, 0, 0, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1032, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1032, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1033, 0, 1034, 1035, 1036, 1037, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 538, 1039, 1040, 0, 1041, 1042, 1043, 1044, 1045, 0,
+  1046, 0, 1047, 0, 1048, 1049, 0, 1050, 1051, 0, 1052, 0, 0, 0, 0, 0,
+  953, 0, 538, 990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1053, 1054, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1055, 0, 1056, 0, 0, 1057, 0, 0, 0, 0, 0, 0, 0, 1058, 1059, 0,
+  0, 0, 0, 0, 0, 0, 0, 1060, 0, 1061, 0, 0, 1062, 0, 0, 0,
+  0, 0, 1063, 0, 1064, 0, 0, 0, 1065, 0, 0, 0, 0, 1066, 0, 0,
+  0, 0, 0, 0, 0, 1067, 1068, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1069, 1070, 0, 0, 0, 0, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 953, 538, 990, 0, 1071, 1072, 1073, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1074, 1053, 1054, 0, 0, 0, 0, 0, 0, 0, 1075, 0, 1076, 0,
+  0, 0, 0, 1077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078,
+  0, 1079, 1080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1081, 0, 0, 0,
+  1082, 0, 0, 0, 0, 0, 0, 1083, 1084, 0, 1085, 1086, 0, 1087, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1088, 0, 0, 0, 0, 538, 1089, 1090, 0, 0, 0, 0, 0, 0, 1091,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 953, 538, 990, 0, 0, 0, 0, 1092, 1040, 1093, 0, 1094, 0, 0, 0,
+  1095, 0, 0, 1096, 1097, 0, 0, 0, 0, 1094, 0, 0, 1031, 0, 0, 0,
+  538, 0, 0, 1098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1099, 0, 0, 1100, 0, 1101, 0, 0, 0, 1102, 1103, 1104, 0, 0, 1105,
+  1105, 0, 1106, 1106, 0, 0, 0, 0, 1107, 0, 1108, 1109, 1110, 1111, 390, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1112, 0, 0, 0, 0, 1113,
+  0, 1114, 0, 0, 0, 0, 538, 0, 0, 0, 1115, 1116, 1117, 988, 1118, 1119,
+  0, 0, 0, 0, 0, 0, 1120, 0, 0, 1094, 0, 1119, 1115, 0, 0, 0,
+  0, 0, 538, 990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1121, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1122, 0, 1123, 1124, 1125, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1126, 1127, 1128, 0, 0, 0, 1129,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1130, 0, 0, 0, 0, 0, 0, 0, 1131, 0, 0, 0, 1132,
+  0, 0, 0, 0, 1133, 1133, 0, 1134, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1135, 0, 0, 0, 0, 1136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1137, 0, 0, 0, 0, 1138, 1139, 1140, 0, 0, 0, 0, 0,
+  0, 1141, 0, 0, 0, 1142, 0, 0, 1143, 1144, 1145, 1146, 0, 1028, 0, 0,
+  538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1147, 0, 0, 0, 0, 1148, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1149, 1150, 0, 1151, 1152, 1153,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1154, 0, 0, 0, 0, 1155, 1156, 1157, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1158, 1159, 1160, 1161, 0, 1028, 0, 0,
+  538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1162, 1163, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1164, 0, 1165, 1166, 0, 0, 0, 0, 0, 0, 0, 0, 1167, 0, 1168, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1169, 1170, 0, 1171, 0, 0, 1172, 1173,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1174, 0, 431, 0, 1175, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1177, 0, 0,
+  0, 0, 1178, 0, 0, 0, 0, 1179, 0, 0, 0, 0, 1180, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1181, 1182, 0, 0, 0, 0, 0,
+  0, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 0, 0,
+  1196, 1197, 1198, 1199, 1200, 0, 1201, 1202, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 0, 0,
+  0, 0, 1205, 0, 0, 0, 0, 1206, 0, 0, 0, 0, 1207, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1208, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1209, 0, 0, 0, 0, 0, 0, 0, 1210, 0,
+  0, 0, 0, 0, 0, 1211, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 538, 0, 1215,
+  0, 0, 0, 0, 0, 0, 1216, 0, 0, 1217, 1218, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1028, 1219, 990, 1220, 1221, 0, 0, 0, 0, 0,
+  538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1222, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1223, 1224, 0, 0, 0, 0, 0, 0, 0, 0, 1225,
+  1226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0,
+  0, 1228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1229, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1230, 0,
+  1231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 538,
+  0, 1232, 0, 0, 1233, 0, 0, 0, 1234, 0, 1235, 0, 0, 1236, 0, 0,
+  0, 0, 0, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249,
+  1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265,
+  1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1244, 0, 1277, 0, 1278,
+  0, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 0, 1290, 0, 1291,
+  0, 1292, 1293, 1294, 0, 0, 1295, 1296, 1297, 0, 1298, 1299, 1300, 1301, 1302, 0,
+  0, 0, 1303, 0, 1304, 0, 1305, 0, 1306, 0, 1307, 1308, 1309, 0, 0, 1310,
+  1311, 1312, 0, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+  1326, 1327, 1328, 1329, 1330, 1331, 1330, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+  1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 0, 1355,
+  1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1232, 1365, 1366, 1300, 1301, 1367, 1368,
+  1369, 1370, 1371, 1372, 1373, 1374, 1244, 1375, 1376, 1251, 1377, 1235, 1378, 1379, 1380, 1381,
+  1382, 1383, 1384, 1385, 1386, 1237, 1239, 1299, 1387, 1388, 1241, 1302, 1389, 1242, 1390, 1391,
+  1243, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1246, 1403, 1404, 1405,
+  1406, 1407, 1247, 1408, 1260, 1409, 1261, 1263, 1265, 1266, 1268, 1410, 1279, 1411, 1285, 1412,
+  1413, 1283, 1284, 1295, 1296, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1238,
+  682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 1427, 1428,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1429, 217, 524, 0, 1430, 121, 0, 0, 494, 525, 513, 502, 515, 0, 340, 0,
+  494, 568, 0, 677, 0, 0, 0, 520, 0, 0, 0, 517, 0, 525, 212, 1431,
+  673, 0, 625, 516, 0, 0, 0, 1432, 0, 0, 0, 675, 341, 0, 1433, 199,
+  0, 0, 217, 0, 677, 563, 0, 0, 0, 595, 563, 0, 0, 0, 1434, 556,
+  0, 0, 522, 0, 0, 0, 518, 671, 0, 0, 0, 212, 0, 0, 574, 0,
+  534, 0, 357, 673, 514, 0, 0, 0, 0, 0, 0, 674, 575, 0, 0, 0,
+  1435, 0, 0, 1436, 0, 0, 0, 0, 0, 0, 0, 0, 1437, 1438, 1439, 1440,
+  1441, 1442, 1443, 1444, 1445, 1446, 0, 1447, 1448, 1449, 1450, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1451, 0, 0, 0, 1452, 1453, 1454, 1455, 595,
+  0, 519, 0, 385, 0, 0, 0, 1456, 384, 0, 1457, 1458, 1459, 1460, 1461, 1462,
+  1456, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 0, 0, 5, 0, 682, 0, 1424, 0,
+  0, 0, 0, 0, 1470, 0, 0, 1471, 1472, 1473, 1474, 1475, 1476, 1470, 1477, 1478,
+  1479, 1480, 1481, 1482, 1483, 0, 0, 1484, 1485, 1486, 1487, 0, 0, 522, 0, 671,
+  0, 0, 199, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
+  1501, 1502, 0, 0, 0, 1503, 1504, 1505, 1506, 0, 0, 0, 0, 502, 0, 0,
+  0, 0, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+  0, 0, 0, 0, 0, 568, 0, 0, 0, 0, 1434, 0, 1521, 1522, 1523, 1524,
+  1525, 1526, 1527, 1528, 1529, 1530, 1531, 134, 1532, 1533, 0, 0, 0, 0, 0, 218,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1534, 1535, 1536, 1537, 1538, 1539, 0,
+  0, 1540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1541, 1542, 1543, 1544,
+  1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
+  1565, 1566, 1567, 1568, 0, 0, 0, 0, 0, 0, 0, 0, 1569, 1570, 1571, 1572,
+  0, 0, 0, 0, 0, 0, 0, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
+  1582, 1583, 1584, 1585, 1586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1587,
+  1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 0, 0, 0,
+  1601, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 1603,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1604, 1605, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1606, 1607, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 535, 0, 0, 0, 0, 517, 36, 1608, 1609,
+  1610, 1611, 1612, 1613, 1614, 1615, 0, 217, 0, 0, 0, 0, 0, 0, 1616, 1617,
+  1618, 1619, 1620, 1621, 1622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199,
+  0, 0, 0, 0, 551, 1623, 0, 1624, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1625, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1429, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1429, 0, 0, 0, 0, 1432,
+  520, 0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1626, 1627, 1628, 0, 0, 1629, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1630, 1631, 1632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1633, 1634,
+  0, 0, 0, 0, 1633, 1634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 526, 36, 1635,
+  1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 0, 0,
+  7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 384, 0, 0, 0, 0, 526, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 4, 1650, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 518, 520, 0, 593, 0, 0, 0, 0, 0, 0, 0,
+  0, 1651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1451, 387, 1652, 0, 0,
+  571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1653, 1654, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1655, 1656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1658, 1659, 1660, 1661, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1028, 0, 0, 0, 0, 1662, 0, 0, 0, 0,
+  0, 0, 1663, 1028, 1664, 1665, 0, 0, 0, 1666, 1667, 0, 0, 1668, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 387, 0, 0, 0, 0, 0, 387, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1669, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1670, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1671, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1672, 0, 0, 1673, 0, 0, 1674, 0, 0, 0, 0, 0, 0,
+  0, 0, 1675, 0, 0, 0, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+  1686, 1687, 1688, 1689, 0, 0, 0, 0, 0, 0, 0, 394, 1690, 1691, 0, 0,
+  1692, 0, 0, 1693, 1694, 1695, 0, 0, 1696, 0, 1697, 0, 0, 1698, 0, 0,
+  1699, 0, 1700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1701, 1702, 1703, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1704, 1705, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1706, 1707, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 0, 0, 1717,
+  1718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1719, 0, 1720, 0, 0, 0, 0,
+  1721, 1722, 1723, 1724, 807, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 0, 1734,
+  1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1750, 0, 1751, 0, 1752, 0, 1753, 0, 1754, 0,
+  0, 0, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1756, 0, 0, 0, 0, 0, 0, 1757, 0, 1758, 0, 0,
+  1759, 1760, 0, 1761, 1762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1763, 1764, 0, 0, 0, 0, 1765, 0, 0, 0, 1766, 0, 0, 1767,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1768, 1769, 1770, 1771, 1772,
+  1773, 1774, 1775, 1776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1777, 1778, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1779, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1780, 1781, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1782, 0, 0, 0, 0, 1783, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1784,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  399, 1785, 401, 1, 1786, 435, 1787, 1788, 438, 437, 409, 1789, 433, 429, 430, 1790,
+  1791, 0, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 0, 0, 0, 0, 416, 0, 0,
+  0, 0, 0, 0, 1799, 0, 0, 0, 1800, 1801, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 553, 0, 0, 0, 578, 0, 0, 536, 0, 580, 0, 538,
+  499, 538, 0, 0, 1802, 0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 0,
+  537, 362, 1803, 0, 552, 0, 576, 1804, 549, 1805, 0, 1806, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1807, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1809, 0, 0, 1810, 1811,
+  1812, 0, 1813, 1814, 1815, 1816, 1817, 0, 1818, 0, 0, 358, 358, 1819, 1820, 1821,
+  0, 0, 0, 203, 0, 0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0,
+  1822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1823,
+  0, 0, 1824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1825, 1826, 0, 0, 0, 0,
+  1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842,
+  1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858,
+  1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+  1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890,
+  1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906,
+  1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922,
+  1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938,
+  1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
+  1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970,
+  1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986,
+  1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+  2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+  2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+  2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 0, 195, 0, 0,
+  2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062,
+  2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078,
+  2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+  2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110,
+  2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126,
+  2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 0, 0, 0, 0, 0, 356,
+  2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152,
+  2153, 2154, 2155, 2156, 2157, 2158, 0, 0, 2159, 2160, 2161, 2162, 2163, 2164, 0, 0,
+  2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180,
+  2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196,
+  2197, 2198, 2199, 2200, 2201, 2202, 0, 0, 2203, 2204, 2205, 2206, 2207, 2208, 0, 0,
+  2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 0, 2217, 0, 2218, 0, 2219, 0, 2220,
+  2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236,
+  2237, 529, 2238, 530, 2239, 531, 2240, 532, 2241, 544, 2242, 545, 2243, 546, 0, 0,
+  2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259,
+  2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275,
+  2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291,
+  2292, 2293, 2294, 2295, 2296, 0, 2297, 2298, 2299, 2300, 2301, 504, 2302, 5, 2303, 5,
+  392, 2304, 2305, 2306, 2307, 0, 2308, 2309, 2310, 506, 2311, 507, 2312, 2313, 2314, 2315,
+  2316, 2317, 2318, 512, 0, 0, 2319, 2320, 2321, 2322, 2323, 508, 0, 2324, 2325, 2326,
+  2327, 2328, 2329, 533, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 510, 2337, 2338, 503, 2339,
+  0, 0, 2340, 2341, 2342, 0, 2343, 2344, 2345, 509, 2346, 511, 2347, 2348, 5, 0,
+  2349, 2350, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+  388, 388, 388, 388, 1313, 1313, 233, 0, 5, 5, 12, 5, 1, 1, 0, 1,
+  0, 0, 1451, 0, 763, 2351, 2352, 1451, 7, 7, 0, 0, 0, 0, 0, 7,
+  732, 733, 5, 1, 2353, 5, 1, 2353, 0, 384, 385, 0, 2354, 0, 10, 0,
+  0, 1656, 0, 388, 1656, 0, 0, 2355, 2356, 2357, 0, 0, 0, 0, 765, 0,
+  0, 0, 2, 392, 0, 0, 0, 2358, 0, 0, 387, 0, 0, 2359, 2360, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1808, 0, 0, 0, 0, 0, 0, 0, 0, 2361, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2362, 0, 0, 2363, 2364, 0, 0, 2365, 2366, 0, 2367, 562, 616, 2368, 0,
+  0, 0, 0, 0, 0, 0, 2369, 0, 0, 0, 0, 0, 0, 2370, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 807, 2382, 0, 0, 0,
+  0, 2383, 0, 0, 0, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394,
+  2395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2396, 2397, 556, 2398, 0, 2399, 2400, 675, 2401, 2402, 203, 517, 517, 517, 625, 111,
+  4, 4, 1434, 4, 0, 521, 2403, 0, 0, 522, 2404, 217, 217, 217, 0, 0,
+  0, 2405, 0, 0, 516, 0, 2406, 1633, 516, 2407, 2408, 18, 514, 556, 577, 577,
+  515, 551, 0, 520, 538, 2409, 2410, 2411, 2412, 121, 0, 2413, 549, 356, 568, 570,
+  523, 2414, 2415, 2416, 0, 1429, 671, 577, 121, 554, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 233, 2417, 2418, 595, 2419, 2420, 2421, 2422, 526, 2423, 2424, 1434, 556, 1429, 520,
+  121, 2425, 2426, 2427, 537, 2428, 2429, 2430, 2431, 36, 2432, 2433, 4, 553, 671, 6,
+  0, 0, 0, 557, 499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2434, 0, 0, 0, 2435, 0, 0, 0, 0, 2436, 2437, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2438, 0,
+  0, 0, 0, 0, 0, 2439, 0, 0, 0, 0, 2440, 0, 0, 0, 2441, 2442,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2443, 2444, 2445,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1625, 0, 0, 2446, 2447, 0, 1436, 0, 0, 2448, 0, 0, 2449, 0, 0, 570,
+  0, 523, 388, 0, 2450, 1656, 2451, 765, 391, 1451, 0, 0, 0, 0, 2452, 0,
+  0, 0, 0, 4, 2453, 233, 2454, 0, 537, 1424, 682, 2455, 2456, 2457, 0, 2458,
+  2459, 0, 0, 0, 0, 0, 387, 0, 2460, 0, 0, 0, 392, 0, 0, 0,
+  0, 2461, 0, 0, 2462, 0, 0, 2463, 0, 2464, 0, 0, 0, 0, 0, 0,
+  2465, 2466, 0, 0, 0, 0, 0, 2467, 0, 2468, 2469, 0, 0, 0, 2470, 0,
+  2471, 0, 2472, 2473, 0, 0, 0, 0, 0, 0, 2474, 2475, 0, 2476, 2477, 2478,
+  2479, 2480, 0, 0, 2481, 2482, 0, 0, 2483, 2484, 0, 0, 0, 0, 0, 0,
+  2485, 2486, 2487, 2488, 2489, 2490, 0, 0, 2491, 2492, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2493, 212, 0, 0, 2494, 0, 0, 0, 212, 0, 0,
+  0, 0, 0, 0, 524, 2495, 0, 0, 0, 0, 0, 0, 2496, 2497, 2498, 2499,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2500, 537, 1424, 682, 2501, 1451, 0, 0, 2502, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1467, 1456, 2503, 2504, 0, 0, 0, 0, 0, 0,
+  2505, 2506, 2507, 2508, 0, 0, 0, 0, 0, 0, 2509, 2510, 2511, 2512, 2359, 2513,
+  0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 515,
+  2514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2515, 0, 0, 0, 2516, 2517, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2519, 2520, 0, 2521, 0, 0, 2522,
+  0, 2523, 2524, 2525, 2526, 793, 0, 0, 2527, 2528, 0, 2529, 212, 0, 0, 0,
+  0, 0, 0, 121, 539, 2530, 2531, 2532, 2533, 2534, 348, 0, 0, 0, 0, 1650,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1315, 0, 0, 1315,
+  0, 0, 1315, 0, 0, 1315, 0, 0, 0, 0, 1315, 0, 0, 0, 1315, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2535, 2536, 2537, 0, 0, 2538, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2539, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2540, 4, 2541, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2542, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564,
+  2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580,
+  2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596,
+  2597, 2598, 2599, 2600, 2601, 2602, 2603, 2553, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611,
+  2612, 2613, 2614, 2615, 2616, 2617, 0, 0, 2618, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2619, 0, 2620, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2621, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2622, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1313, 1313, 0, 2623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2624,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1656, 0, 526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2626, 0, 0, 0, 0, 0, 0, 0,
+  2627, 0, 0, 0, 10, 0, 0, 2628, 0, 0, 0, 0, 0, 2629, 0, 0,
+  2626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2630, 0, 1436, 0, 0, 0, 2631, 2632, 0, 2632, 0, 0, 2633, 0, 0,
+  0, 2634, 0, 0, 0, 0, 0, 2501, 0, 0, 2501, 391, 0, 0, 2635, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2636, 0, 0, 0, 0, 0, 391, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2494, 0, 0, 0, 0, 0, 0,
+  2637, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2639, 0, 0, 0, 0, 0, 0, 0, 2640, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2641, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2501, 0, 0, 0, 0, 0, 0, 2642, 2643, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1020, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2644, 2645, 0, 0, 0, 0, 384, 385,
+  0, 0, 2644, 2645, 2646, 2647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1652, 388, 2648, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2495, 0, 0, 0, 0, 0, 2649, 2650, 0, 1656, 0, 2451, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2651, 2652, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2653, 0, 2654, 0, 0, 0, 0, 0, 0, 0, 0, 2655, 2656,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2360, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2635, 0,
+  0, 0, 0, 0, 2518, 2658, 0, 2659, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2660, 0, 0, 2661, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2662, 2451, 2663, 0, 1656, 2451, 0, 0, 0, 0, 0, 0,
+  2494, 2493, 2664, 2665, 2666, 2667, 2668, 0, 0, 0, 0, 0, 2669, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2502, 0, 0,
+  2475, 2441, 2670, 2671, 2672, 2673, 2674, 2675, 0, 2676, 2677, 0, 0, 0, 0, 36,
+  2678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2679, 2680, 2681,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2682, 0, 0, 0, 2683, 0,
+  0, 0, 0, 0, 2684, 2685, 2686, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2687, 0, 0, 0, 0, 2688, 2689, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2690, 0, 0, 0, 0, 2691, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2692, 0, 2693, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2694, 2695, 2696, 2697,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 618, 0, 614, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 568, 576, 1436, 0, 562, 354, 0, 0, 0, 0, 517, 0,
+  0, 0, 4, 0, 518, 536, 2698, 0, 520, 0, 521, 0, 0, 0, 3, 538,
+  570, 0, 522, 539, 556, 553, 524, 0, 525, 0, 571, 541, 526, 2699, 593, 0,
+  0, 2530, 0, 0, 1467, 0, 0, 0, 0, 0, 388, 0, 2700, 2701, 0, 0,
+  0, 0, 0, 0, 0, 0, 1656, 0, 0, 0, 988, 0, 228, 372, 0, 0,
+  1434, 2702, 574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2703, 0, 0, 0,
+  0, 0, 0, 0, 2704, 0, 0, 0, 0, 2705, 0, 0, 0, 0, 0, 2706,
+  2707, 2708, 0, 0, 0, 0, 0, 0, 0, 2542, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 212, 0, 0, 0, 0, 0, 519, 595, 515, 2446, 0, 0, 0, 0, 0,
+  0, 37, 0, 0, 0, 0, 0, 0, 2513, 523, 0, 0, 0, 0, 0, 4,
+  0, 234, 0, 0, 3, 2404, 0, 0, 0, 2494, 0, 0, 0, 526, 0, 0,
+  1436, 0, 0, 2709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2710,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 1858, 2719, 406, 2720, 1873, 487, 2721, 493,
+  2722, 2723, 2724, 2725, 2726, 2727, 483, 484, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2736, 0, 0, 0, 2682, 2737,
+  0, 0, 0, 0, 0, 0, 2487, 2488, 2738, 2739, 2740, 2741, 2742, 0, 2743, 0,
+  391, 1451, 764, 0, 0, 2744, 0, 0, 0, 535, 0, 0, 0, 2360, 0, 2745,
+  1435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2746, 2747, 0, 2748, 0, 0, 0, 2749, 0, 2750, 0, 0, 2751, 2752,
+  2753, 0, 2754, 2755, 2756, 0, 2757, 2758, 2759, 2760, 0, 2761, 0, 0, 2762, 2763,
+  2764, 2765, 2766, 2767, 2768, 0, 2769, 0, 2770, 0, 0, 2771, 0, 2772, 0, 2773,
+  0, 2774, 2771, 0, 0, 0, 0, 0, 0, 2775, 2776, 0, 0, 0, 2777, 2777,
+  2777, 2778, 2779, 2780, 2781, 2782, 0, 0, 2783, 2784, 0, 2785, 2786, 2786, 0, 2787,
+  2788, 2789, 2790, 2791, 2792, 0, 2787, 0, 2793, 2794, 2795, 2796, 2797, 2798, 0, 2799,
+  2800, 0, 2801, 0, 2802, 2803, 0, 0, 2804, 2805, 0, 2806, 2807, 2808, 2809, 2810,
+  2811, 0, 2812, 2813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1313, 1315, 2451, 1656, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825,
+  2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2839, 2840,
+  2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2753, 2850, 2851, 2852, 2853, 2854,
+  2855, 2856, 2857, 2755, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869,
+  2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885,
+  2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901,
+  2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+  2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+  2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949,
+  2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965,
+  2966, 2967, 2968, 2969, 2970, 2971, 2972, 2789, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980,
+  2981, 2982, 2983, 2984, 2985, 2986, 2987, 2798, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995,
+  2996, 2802, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010,
+  3011, 3012, 3013, 3014, 3015, 3016, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3017, 1, 0, 0, 0, 3, 2651, 2652, 0, 0, 0, 0, 0, 0,
+  0, 0, 3018, 0, 2644, 2645, 0, 0, 0, 0, 3019, 3020, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3021, 3022, 3023, 3024, 3025, 3026,
+  0, 0, 0, 1656, 0, 0, 3018, 0, 2833, 3027, 3028, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3029, 0, 3030, 2651,
+  3031, 0, 3032, 0, 3033, 0, 3034, 0, 3035, 0, 3036, 0, 3037, 0, 3038, 0,
+  3039, 0, 3040, 0, 0, 3041, 0, 3042, 0, 3043, 0, 0, 0, 0, 0, 0,
+  3044, 3045, 0, 3046, 3047, 0, 3048, 3049, 0, 3050, 3051, 0, 3052, 3053, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3054, 0, 0, 0, 0, 3055, 3056, 3057, 3058, 0, 3059, 0,
+  1435, 0, 0, 0, 2748, 0, 0, 0, 2854, 0, 0, 2828, 3060, 0, 3061, 0,
+  3062, 0, 3063, 0, 3064, 0, 3065, 0, 3066, 0, 3067, 0, 3068, 0, 3069, 2843,
+  3070, 0, 3071, 0, 0, 3072, 0, 3073, 2834, 3074, 0, 2816, 0, 0, 1656, 2821,
+  3075, 3076, 0, 3077, 3078, 0, 3079, 3080, 3081, 3082, 3083, 0, 3084, 3085, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2839, 0, 0,
+  0, 0, 0, 0, 3086, 0, 0, 3087, 3088, 3089, 3090, 1451, 0, 0, 3091, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1364, 1232, 1365, 1366, 1300, 1301, 1367, 1233, 1368, 1369, 1370, 1371, 1372, 1373, 1374,
+  1244, 1375, 1376, 1234, 1251, 1377, 1235, 1378, 1379, 1236, 1380, 1381, 1382, 1383, 1384, 3092,
+  1303, 3093, 1304, 3094, 1305, 3095, 1306, 3096, 1307, 1308, 1309, 3097, 3098, 1310, 1311, 1312,
+  3099, 1313, 1314, 1315, 3100, 1238, 1239, 1299, 1387, 1389, 1390, 1394, 1398, 1400, 1246, 1403,
+  1405, 1247, 1248, 1250, 1252, 1253, 1257, 1259, 1261, 1262, 1263, 1264, 1265, 1268, 1272, 1410,
+  1285, 1413, 1283, 1284, 1296, 1297, 1418, 1330, 1331, 1333, 1342, 1343, 1345, 3101, 1357, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1313, 1315, 0, 1656, 2451, 0, 2746, 0, 0, 0, 2815, 2651, 0, 0, 0, 2747,
+  2814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117,
+  3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 0,
+  3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148,
+  3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164,
+  3165, 3166, 3167, 3168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188,
+  3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+  3205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221,
+  3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3238, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1313, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2451, 0, 0, 0, 0, 0, 0, 0, 0, 1656,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3241, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3242,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2839, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3243, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2840, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3244,
+  3245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2868, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3248, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3249, 0, 0, 0, 0, 0, 3250, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3251, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3252, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3253,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3254, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3255, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3256, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3257,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3258, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3259, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3260, 0, 0, 0, 0, 0,
+  3261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3262, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3264, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3266, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3267,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3269, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3270, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3271,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3273, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3274, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3275, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3277, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3278, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 3279, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3281, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3282, 0, 0, 0, 0, 0, 0, 0, 3283, 0, 3284, 0,
+  0, 0, 0, 0, 0, 0, 0, 3285, 3286, 0, 0, 0, 3287, 0, 0, 0,
+  3288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3289, 0, 0, 0, 3290, 3291,
+  3292, 0, 3293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  514, 522, 671, 1429, 524, 0, 673, 518, 0, 502, 556, 557, 516, 551, 1623, 520,
+  521, 1434, 563, 217, 0, 519, 595, 517, 0, 0, 677, 526, 525, 3294, 513, 1625,
+  515, 2446, 4, 3, 682, 1424, 0, 3295, 763, 12, 2351, 3296, 0, 387, 3297, 1435,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 763, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 218, 552, 0, 121, 0, 0, 0, 0, 0, 2530, 0, 0,
+  3298, 3299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2494, 0, 0, 0, 0, 0, 0, 2388,
+  0, 0, 0, 0, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 402, 3308, 389, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 357, 0, 0, 3309, 2452, 2493, 0, 0, 0, 3310, 3311,
+  0, 497, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3312, 494, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3313, 519, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 570, 0, 0, 0, 595,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 340, 0, 0, 0, 218,
+  399, 401, 0, 0, 3314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3315, 0, 396, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 3316, 3317, 0, 0, 0, 0, 0, 0,
+  0, 231, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3324, 3325, 3326, 3327, 0, 0,
+  616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 365, 0, 0, 3309, 2452,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0, 0, 0,
+  0, 3328, 0, 0, 0, 0, 0, 0, 0, 0, 228, 372, 0, 0, 988, 0,
+  0, 0, 0, 0, 0, 0, 0, 3329, 3330, 0, 3331, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0, 5, 0, 0, 1451,
+  0, 0, 0, 0, 0, 3332, 0, 0, 551, 195, 3333, 3334, 0, 3335, 3336, 370,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0,
+  0, 2495, 502, 526, 514, 534, 3337, 2530, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1313, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3338, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3339, 0, 0, 0,
+  3340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357,
+  3358, 3359, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3360, 3361, 3362, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3364, 3365, 3366, 3367, 1369, 3368, 1390, 3369, 1370, 1371, 3370, 1396, 1372, 3371, 1399, 1401,
+  3372, 1403, 3373, 3374, 1409, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3386, 0, 0, 0, 0, 0, 3387, 0, 0, 0, 0, 0, 0, 0, 0, 820,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3388, 0, 0, 3389, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3390, 0, 3391, 3392, 3393, 0, 0, 3394, 3395, 0, 0, 0, 0, 0, 3396, 3397,
+  0, 3398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3399, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 577, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 538, 66, 3400,
+  0, 3401, 3402, 0, 0, 0, 0, 576, 576, 0, 0, 0, 0, 2455, 370, 0,
+  0, 0, 370, 2699, 0, 2699, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0,
+  3403, 0, 3404, 3405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3406, 3407, 540, 0, 3408, 121, 0, 0, 0, 0, 3409, 3410, 3411, 0, 3412, 0,
+  3413, 576, 0, 362, 0, 0, 0, 580, 0, 0, 0, 581, 0, 0, 365, 0,
+  674, 0, 0, 1803, 0, 0, 0, 0, 0, 0, 0, 354, 1820, 0, 0, 584,
+  0, 0, 3407, 0, 0, 0, 0, 0, 0, 537, 231, 0, 0, 0, 2702, 553,
+  0, 0, 1805, 0, 0, 0, 536, 0, 0, 0, 0, 365, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3414, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430,
+  3431, 3432, 3433, 3434, 3435, 3436, 3437, 0, 0, 0, 0, 3438, 3439, 1233, 3440, 3365,
+  3366, 3441, 3367, 3442, 3443, 3368, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 1245, 3451, 3452,
+  3453, 3454, 3455, 1250, 3456, 3457, 1234, 1253, 1257, 1258, 1267, 3458, 3459, 3460, 3461, 1272,
+  1273, 1275, 1244, 3462, 3463, 3464, 3465, 3466, 3467, 1236, 3468, 3469, 0, 0, 0, 0,
+  3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484,
+  3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500,
+  3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516,
+  3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532,
+  3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548,
+  3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3489, 3561, 3562, 3563,
+  3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579,
+  3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595,
+  3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611,
+  3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627,
+  3628, 3579, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3563, 3637, 3638, 3639, 3640, 3641,
+  3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3489,
+  3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672,
+  3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3565, 3684, 3685, 3686, 3687,
+  3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703,
+  3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719,
+  3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 0, 0,
+  3734, 0, 3735, 0, 0, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 0,
+  3746, 0, 3747, 0, 0, 3748, 3749, 0, 0, 0, 3750, 3751, 3752, 3753, 3754, 3755,
+  3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771,
+  3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787,
+  3788, 3789, 3790, 3791, 3792, 3793, 3794, 3618, 3795, 3796, 3797, 3798, 3799, 3800, 3800, 3801,
+  3802, 3803, 3804, 3805, 3806, 3807, 3808, 3748, 3809, 3810, 3811, 3812, 3813, 3814, 0, 0,
+  3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3762, 3823, 3824, 3825, 3734, 3826, 3827, 3828,
+  3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3771, 3838, 3772, 3839, 3840, 3841, 3842,
+  3843, 3735, 3510, 3844, 3845, 3846, 3580, 3667, 3847, 3848, 3779, 3849, 3780, 3850, 3851, 3852,
+  3737, 3853, 3854, 3855, 3856, 3857, 3738, 3858, 3859, 3860, 3861, 3862, 3863, 3794, 3864, 3865,
+  3618, 3866, 3798, 3867, 3868, 3869, 3870, 3871, 3803, 3872, 3747, 3873, 3804, 3561, 3874, 3805,
+  3875, 3807, 3876, 3877, 3878, 3879, 3880, 3809, 3743, 3881, 3810, 3882, 3811, 3883, 3477, 3884,
+  3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3895, 3896, 3897, 3898, 3899, 0, 3900, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3901, 3902, 3903, 3904, 3905, 0, 0, 0, 0, 0, 3906, 3907, 3908,
+  3909, 2409, 2412, 3910, 3911, 3912, 3913, 3914, 3915, 2460, 3916, 3917, 3918, 3919, 3920, 3921,
+  3922, 3923, 3924, 3925, 3926, 3927, 3928, 0, 3929, 3930, 3931, 3932, 3933, 0, 3934, 0,
+  3935, 3936, 0, 3937, 3938, 0, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948,
+  3949, 3949, 800, 800, 800, 800, 751, 751, 751, 751, 3950, 3950, 3950, 3950, 3951, 3951,
+  3951, 3951, 3952, 3952, 3952, 3952, 773, 773, 773, 773, 784, 784, 784, 784, 3953, 3953,
+  3953, 3953, 3954, 3954, 3954, 3954, 3955, 3955, 3955, 3955, 3956, 3956, 3956, 3956, 3957, 3957,
+  3957, 3957, 3958, 3958, 3959, 3959, 778, 778, 776, 776, 781, 781, 779, 779, 786, 786,
+  786, 786, 905, 905, 905, 905, 3960, 3960, 3960, 3960, 3961, 3961, 3961, 3961, 754, 754,
+  773, 773, 773, 773, 3962, 3962, 538, 538, 538, 538, 538, 538, 538, 538, 754, 754,
+  3963, 3963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 787, 787, 787, 787, 795, 795, 794, 794, 796, 796, 771, 798, 798,
+  3964, 3964, 797, 797, 800, 800, 800, 800, 754, 754, 3965, 3965, 3966, 3966, 3967, 3967,
+  3968, 3968, 3969, 3969, 3970, 3970, 3971, 3971, 3971, 3972, 3972, 3972, 754, 754, 754, 754,
+  3973, 3974, 3975, 3972, 3972, 3976, 3977, 3978, 3979, 3980, 3980, 3981, 3982, 3983, 3984, 3985,
+  3985, 3986, 3987, 3988, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999,
+  4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015,
+  4016, 4017, 4017, 4018, 4019, 4020, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4027, 4028,
+  4029, 4030, 4031, 4032, 4032, 4033, 4034, 4035, 4036, 4037, 4037, 3978, 4038, 4039, 4040, 4041,
+  4041, 4042, 4043, 4044, 4044, 4045, 4046, 4047, 4048, 4049, 4049, 4050, 4051, 4052, 4053, 4054,
+  4055, 4056, 4057, 4058, 4059, 4060, 3975, 4061, 3972, 3972, 4062, 4063, 3979, 4064, 3980, 3980,
+  4065, 4066, 3984, 4067, 3985, 3985, 4068, 4069, 3987, 4070, 3988, 3988, 4017, 4017, 4020, 4020,
+  4021, 4025, 4026, 4027, 4027, 4031, 4032, 4032, 4071, 4036, 4072, 4073, 4040, 4074, 4041, 4041,
+  4052, 4075, 4076, 4048, 4077, 4049, 4049, 3973, 3974, 4078, 3975, 3966, 3976, 3977, 3978, 3979,
+  4079, 3981, 3982, 3983, 3984, 4080, 3987, 3989, 3990, 3991, 3992, 3993, 3995, 3996, 3997, 3998,
+  3999, 4000, 4081, 4001, 4002, 4003, 4004, 4005, 4006, 4008, 4009, 4010, 4011, 4012, 4013, 4014,
+  4015, 4016, 4018, 4019, 4022, 4023, 4024, 4025, 4026, 4028, 4029, 4030, 4031, 4082, 4033, 4034,
+  4035, 4036, 3978, 4038, 4039, 4040, 4083, 4042, 4043, 4084, 4045, 4046, 4047, 4048, 4085, 3975,
+  3966, 3979, 4079, 3984, 4080, 3987, 4086, 3999, 4087, 4088, 4089, 4025, 4026, 4031, 4040, 4083,
+  4048, 4085, 4090, 4091, 4092, 4093, 4093, 4094, 4094, 4095, 4095, 4096, 4096, 4097, 4097, 4098,
+  4098, 4099, 4099, 4100, 4100, 4101, 4101, 4102, 4102, 4103, 4104, 4105, 4088, 4106, 4107, 4108,
+  4109, 4093, 4093, 4094, 4094, 4095, 4095, 4096, 4096, 4097, 4097, 4098, 4098, 4099, 4099, 4100,
+  4100, 4101, 4101, 4102, 4102, 4103, 4104, 4105, 4088, 4106, 4107, 4108, 4109, 4103, 4104, 4105,
+  4088, 4087, 4089, 4007, 3996, 3997, 3998, 4103, 4104, 4105, 4007, 4008, 4110, 4110, 2644, 2645,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4111, 4112, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4118, 4119, 4119, 4120, 4121, 4122, 4123,
+  4123, 4124, 4125, 4125, 4126, 4126, 4127, 4128, 4128, 4129, 4130, 4130, 4131, 4131, 4132, 4133,
+  4133, 4134, 4134, 4135, 4136, 4137, 4138, 4138, 4139, 4140, 4141, 4141, 4142, 4142, 4143, 4144,
+  4145, 4146, 4146, 4147, 4147, 4148, 4148, 4149, 4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156,
+  0, 0, 4157, 4158, 4159, 4160, 4161, 4162, 4162, 4163, 4164, 4164, 4165, 4165, 4166, 4167,
+  4167, 4168, 4168, 4169, 4169, 4170, 4171, 4170, 4172, 4173, 4174, 4132, 4175, 4176, 4177, 4178,
+  4179, 4180, 4181, 4161, 4143, 4145, 4139, 4182, 4183, 4184, 4185, 4186, 4185, 4183, 4171, 4187,
+  4188, 4189, 4190, 4186, 4137, 4127, 4172, 4163, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4191, 4200, 4201, 4202, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2359, 0, 0, 0, 0, 0, 0,
+  4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218,
+  387, 2623, 0, 0, 4219, 4220, 4221, 4222, 4223, 4224, 4225, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 865, 865, 865,
+  0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2451, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4226, 4227, 4227, 768, 768, 770, 770, 769, 769, 772, 772, 772, 772, 4, 4, 4228,
+  4228, 4228, 4228, 793, 793, 4229, 4229, 4229, 4229, 751, 751, 751, 751, 4230, 4230, 4230,
+  4230, 4231, 4231, 4231, 4231, 4232, 4232, 4232, 4232, 4233, 4233, 4234, 4234, 4235, 4235, 4236,
+  4236, 4237, 4237, 4237, 4237, 752, 752, 752, 752, 4238, 4238, 4238, 4238, 4239, 4239, 4239,
+  4239, 4240, 4240, 4240, 4240, 4241, 4241, 4241, 4241, 734, 734, 734, 734, 4242, 4242, 4242,
+  4242, 785, 785, 785, 785, 4243, 4243, 4243, 4243, 786, 786, 786, 786, 4244, 4244, 4244,
+  4244, 4245, 4245, 4245, 4245, 4246, 4246, 4246, 4246, 538, 538, 538, 538, 906, 906, 754,
+  754, 754, 754, 754, 754, 4247, 4247, 4248, 4248, 4249, 4249, 4250, 4250, 0, 0, 0,
+  0, 234, 1, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 1313, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0, 0, 0, 0,
+  0, 513, 514, 556, 0, 515, 0, 0, 517, 4, 502, 518, 0, 520, 521, 3,
+  522, 0, 0, 563, 524, 0, 0, 0, 526, 525, 516, 2644, 2451, 2645, 4251, 0,
+  5, 348, 0, 553, 0, 577, 0, 203, 625, 121, 554, 0, 4, 0, 0, 538,
+  539, 0, 0, 231, 0, 0, 537, 0, 36, 356, 0, 0, 2623, 0, 4252, 0,
+  0, 0, 0, 0, 0, 1451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 10, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4253, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4254, 0,
+  0, 0, 0, 0, 0, 0, 4255, 4256, 4257, 4258, 0, 0, 0, 0, 0, 0,
+  4259, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4260, 0, 0,
+  0, 0, 514, 0, 0, 1436, 515, 551, 0, 0, 4, 0, 0, 519, 0, 0,
+  526, 0, 3, 0, 2501, 522, 563, 524, 0, 0, 0, 1652, 0, 0, 0, 0,
+  513, 514, 556, 1436, 0, 551, 0, 0, 0, 0, 0, 3, 0, 4261, 0, 0,
+  520, 524, 525, 571, 526, 593, 1634, 0, 4262, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 517,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4263, 4233, 0, 0, 906, 0, 0, 0, 4240, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4238, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 514, 556, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+  0, 520, 4261, 0, 0, 524, 0, 526, 0, 0, 322, 0, 0, 0, 0, 765,
+  4, 0, 526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4264, 4265, 4266, 4267, 4268, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 4269, 0, 4270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 675, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2415, 0, 0, 0, 556, 0, 0, 0, 0, 0, 1434, 0, 0, 0, 4271,
+  563, 0, 0, 557, 0, 497, 0, 0, 0, 354, 3335, 0, 538, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 553, 0, 4272,
+  0, 0, 4273, 2702, 0, 0, 0, 0, 231, 0, 0, 499, 0, 498, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4274, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  519, 0, 0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 4275, 0, 0, 0,
+  0, 0, 3, 2494, 555, 0, 0, 0, 0, 0, 0, 0, 0, 4276, 682, 0,
+  4277, 593, 4278, 0, 0, 0, 0, 0, 1804, 0, 0, 2698, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 538, 4279, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 370, 0, 0, 594, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 521, 0, 0, 3, 0, 518, 0, 0, 0, 556, 595, 0, 0,
+  0, 0, 0, 0, 0, 551, 1434, 526, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4280, 0, 4281,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 4282, 4283, 429, 0, 0, 0, 0, 4284,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  763, 0, 0, 0, 0, 0, 0, 4285, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 4286, 4287, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4288, 0, 4289, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4290, 4291, 4292, 4293, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4294, 4295, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4305,
+  4306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4307, 4308, 4309, 4310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4311, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4313,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4314, 0, 4315, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4316, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4317, 4318, 1020, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4319, 4320, 4321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4322, 4323,
+  0, 0, 0, 4324, 4325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 4326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4327, 0, 0, 0, 0, 0, 0, 1020, 0, 0, 968, 4328, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4329, 4330, 0, 4331, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 4332, 4333, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4334, 4335, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4336, 4337, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4338, 4339, 4340, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 0, 0, 0,
+  4348, 4349, 4350, 4351, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 4353, 0, 0, 0, 0, 0, 4354, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4355, 0, 0, 0, 0, 0, 4356, 0, 0, 4357, 0, 4358,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4359, 0, 0, 0, 4360, 0, 0, 0, 0, 0, 4361, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4362, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4363, 0, 4364, 0, 4365, 0, 4366, 4367, 0, 4368, 0, 4369, 4370, 4371,
+  4372, 4373, 4374, 4375, 0, 0, 0, 4376, 4377, 4378, 4379, 4380, 0, 4381, 4382, 0,
+  4383, 4384, 0, 0, 0, 0, 0, 0, 0, 4385, 0, 4386, 4387, 4388, 4389, 953,
+  0, 990, 983, 968, 4390, 4391, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 4392, 4393, 0, 0, 0, 4394, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4395, 4396, 0, 0, 0, 4397,
+  4398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 4399, 4399, 4400, 4401, 4402, 4403, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4404,
+  0, 0, 4405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4406, 4407, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 0, 0, 0, 0, 0, 537, 0, 0, 0, 362, 0, 0, 0, 362, 362,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4408, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4409, 4410, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  595, 0, 551, 1434, 525, 0, 515, 0, 4411, 516, 0, 0, 988, 0, 515, 1433,
+  0, 0, 1434, 0, 0, 3, 0, 2501, 682, 0, 0, 230, 524, 0, 0, 0,
+  537, 231, 551, 121, 1803, 0, 4278, 0, 538, 0, 228, 0, 988, 0, 354, 0,
+  0, 0, 0, 0, 0, 574, 988, 538, 370, 0, 0, 0, 356, 0, 0, 0,
+  3, 0, 0, 6, 824, 516, 677, 0, 0, 556, 0, 0, 526, 0, 0, 677,
+  0, 0, 556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 4412, 0, 0, 0, 0, 4413, 4414, 0,
+  0, 0, 0, 4415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 4418, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4419, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4420, 4421, 4422, 4423, 4424, 0, 4425, 4426, 4427, 0,
+  0, 0, 0, 0, 4428, 4429, 4430, 4431, 4432, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4433,
+  0, 0, 4434, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4436, 0, 4437, 4438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 4439, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 4440, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2638, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4441, 4442, 4443, 4444, 4445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4446, 4447, 4448, 4449, 4450, 4451, 4452, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 568, 595, 0, 524, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1434, 0, 0, 0, 1436, 0, 4453, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2415, 0, 4, 0, 0, 0, 0, 675, 0, 0,
+  0, 0, 0, 0, 0, 217, 0, 0, 0, 0, 563, 228, 0, 519, 0, 385,
+  513, 0, 682, 525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4454, 4455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4457, 4458,
+  4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 0, 0, 0, 4469, 4470, 4471,
+  4472, 4473, 4474, 0, 0, 0, 0, 0, 0, 0, 0, 4475, 4476, 4477, 4478, 4479,
+  4480, 4481, 4482, 0, 0, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4490, 4491, 4492, 4493, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4494, 4495, 4496, 4497, 4498,
+  4499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4500, 0, 0, 0, 228, 0, 0, 0, 0, 497, 0, 595, 0, 2451,
+  0, 0, 4278, 551, 2633, 2415, 217, 1625, 0, 0, 212, 4501, 2495, 0, 0, 0,
+  0, 675, 1432, 0, 0, 0, 0, 0, 0, 0, 1434, 2415, 0, 0, 0, 0,
+  1624, 0, 0, 0, 0, 0, 384, 385, 4502, 4503, 1656, 2451, 0, 0, 0, 4504,
+  0, 0, 4505, 4506, 4507, 1424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522,
+  2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195,
+  203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537,
+  362, 36, 356, 1803, 513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434,
+  520, 521, 3, 522, 2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199,
+  553, 671, 577, 195, 203, 0, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576,
+  231, 4509, 370, 537, 362, 36, 356, 1803, 513, 514, 556, 1429, 515, 551, 673, 517,
+  4, 502, 518, 1434, 520, 521, 3, 522, 2404, 217, 563, 524, 682, 595, 677, 526,
+  525, 516, 348, 199, 553, 671, 577, 195, 203, 625, 121, 554, 4508, 4, 6, 684,
+  538, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803, 513, 0, 556, 1429,
+  0, 0, 673, 0, 0, 502, 518, 0, 0, 521, 3, 522, 2404, 0, 563, 524,
+  682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 0, 195, 0, 625, 121, 554,
+  4508, 4, 6, 684, 0, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803,
+  513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522,
+  2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195,
+  203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537,
+  362, 36, 356, 1803, 513, 514, 0, 1429, 515, 551, 673, 0, 0, 502, 518, 1434,
+  520, 521, 3, 522, 2404, 0, 563, 524, 682, 595, 677, 526, 525, 0, 348, 199,
+  553, 671, 577, 195, 203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576,
+  231, 4509, 370, 537, 362, 36, 356, 1803, 513, 514, 0, 1429, 515, 551, 673, 0,
+  4, 502, 518, 1434, 520, 0, 3, 0, 0, 0, 563, 524, 682, 595, 677, 526,
+  525, 0, 348, 199, 553, 671, 577, 195, 203, 625, 121, 554, 4508, 4, 6, 684,
+  538, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803, 513, 514, 556, 1429,
+  515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522, 2404, 217, 563, 524,
+  682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195, 203, 625, 121, 554,
+  4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803,
+  513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522,
+  2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195,
+  203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537,
+  362, 36, 356, 1803, 513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434,
+  520, 521, 3, 522, 2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199,
+  553, 671, 577, 195, 203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576,
+  231, 4509, 370, 537, 362, 36, 356, 1803, 513, 514, 556, 1429, 515, 551, 673, 517,
+  4, 502, 518, 1434, 520, 521, 3, 522, 2404, 217, 563, 524, 682, 595, 677, 526,
+  525, 516, 348, 199, 553, 671, 577, 195, 203, 625, 121, 554, 4508, 4, 6, 684,
+  538, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803, 513, 514, 556, 1429,
+  515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522, 2404, 217, 563, 524,
+  682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195, 203, 625, 121, 554,
+  4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537, 362, 36, 356, 1803,
+  513, 514, 556, 1429, 515, 551, 673, 517, 4, 502, 518, 1434, 520, 521, 3, 522,
+  2404, 217, 563, 524, 682, 595, 677, 526, 525, 516, 348, 199, 553, 671, 577, 195,
+  203, 625, 121, 554, 4508, 4, 6, 684, 538, 539, 676, 576, 231, 4509, 370, 537,
+  362, 36, 356, 1803, 121, 683, 0, 0, 513, 514, 568, 1436, 515, 516, 517, 212,
+  4, 518, 519, 520, 521, 4510, 3, 570, 522, 212, 523, 524, 525, 571, 526, 593,
+  1634, 4411, 348, 534, 356, 535, 354, 4511, 211, 212, 121, 536, 2698, 11, 537, 4512,
+  538, 549, 539, 550, 538, 540, 370, 541, 2699, 594, 2530, 4513, 354, 212, 536, 541,
+  539, 549, 513, 514, 568, 1436, 515, 516, 517, 212, 4, 518, 519, 520, 521, 4510,
+  3, 570, 522, 212, 523, 524, 525, 571, 526, 593, 1634, 4411, 348, 534, 356, 535,
+  354, 4511, 211, 212, 121, 536, 2698, 11, 537, 4512, 538, 549, 539, 550, 538, 540,
+  370, 541, 2699, 594, 2530, 4513, 354, 212, 536, 541, 539, 549, 513, 514, 568, 1436,
+  515, 516, 517, 212, 4, 518, 519, 520, 521, 4510, 3, 570, 522, 212, 523, 524,
+  525, 571, 526, 593, 1634, 4411, 348, 534, 356, 535, 354, 4511, 211, 212, 121, 536,
+  2698, 11, 537, 4512, 538, 549, 539, 550, 538, 540, 370, 541, 2699, 594, 2530, 4513,
+  354, 212, 536, 541, 539, 549, 513, 514, 568, 1436, 515, 516, 517, 212, 4, 518,
+  519, 520, 521, 4510, 3, 570, 522, 212, 523, 524, 525, 571, 526, 593, 1634, 4411,
+  348, 534, 356, 535, 354, 4511, 211, 212, 121, 536, 2698, 11, 537, 4512, 538, 549,
+  539, 550, 538, 540, 370, 541, 2699, 594, 2530, 4513, 354, 212, 536, 541, 539, 549,
+  513, 514, 568, 1436, 515, 516, 517, 212, 4, 518, 519, 520, 521, 4510, 3, 570,
+  522, 212, 523, 524, 525, 571, 526, 593, 1634, 4411, 348, 534, 356, 535, 354, 4511,
+  211, 212, 121, 536, 2698, 11, 537, 4512, 538, 549, 539, 550, 538, 540, 370, 541,
+  2699, 594, 2530, 4513, 354, 212, 536, 541, 539, 549, 551, 4514, 0, 0, 3, 4,
+  218, 228, 1433, 230, 574, 4278, 322, 988, 3, 4, 218, 228, 1433, 230, 574, 4278,
+  322, 988, 3, 4, 218, 228, 1433, 230, 574, 4278, 322, 988, 3, 4, 218, 228,
+  1433, 230, 574, 4278, 322, 988, 3, 4, 218, 228, 1433, 230, 574, 4278, 322, 988,
+  4515, 4516, 4517, 4518, 4519, 4520, 4521, 0, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529,
+  4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538, 0, 0, 4539, 4540, 4541, 4542, 4543,
+  4544, 4545, 0, 4546, 4547, 0, 4548, 4549, 4550, 4551, 4552, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4553, 4554, 4555, 4556, 4557, 4558, 4559, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4560, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4561, 4562, 4563, 4564,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 4, 4565, 821, 0, 322, 4513, 59, 0, 0,
+  4566, 4567, 4568, 4569, 4570, 4571, 4572, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 4228, 4230, 4233, 0, 906, 4236, 4231, 4240, 754, 786, 4244, 4245, 4246, 4237, 734,
+  785, 4238, 4243, 4235, 752, 4229, 751, 4232, 4234, 4239, 4241, 4242, 754, 754, 766, 766,
+  0, 4228, 4230, 0, 538, 0, 0, 4231, 0, 754, 786, 4244, 4245, 4246, 4237, 734,
+  785, 4238, 4243, 0, 752, 4229, 751, 4232, 0, 4239, 0, 4242, 0, 0, 0, 0,
+  0, 0, 4230, 0, 0, 0, 0, 4231, 0, 754, 0, 4244, 0, 4246, 4237, 734,
+  0, 4238, 4243, 0, 752, 0, 0, 4232, 0, 4239, 0, 4242, 0, 754, 0, 766,
+  0, 4228, 4230, 0, 538, 0, 0, 4231, 4240, 754, 786, 0, 4245, 4246, 4237, 734,
+  785, 4238, 4243, 0, 752, 4229, 751, 4232, 0, 4239, 4241, 4242, 754, 0, 766, 0,
+  4, 4228, 4230, 4233, 538, 906, 4236, 4231, 4240, 754, 0, 4244, 4245, 4246, 4237, 734,
+  785, 4238, 4243, 4235, 752, 4229, 751, 4232, 4234, 4239, 4241, 4242, 0, 0, 0, 0,
+  0, 4228, 4230, 4233, 0, 906, 4236, 4231, 4240, 754, 0, 4244, 4245, 4246, 4237, 734,
+  785, 4238, 4243, 4235, 752, 4229, 751, 4232, 4234, 4239, 4241, 4242, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4580, 4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 0, 0, 0, 0, 4591,
+  4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 2553, 4600, 4601, 4602, 4603, 4604, 4605, 4606,
+  4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4609, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4617, 4618, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4619, 3135, 3134, 4620, 4621, 4622, 4623, 4624, 4625, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4626, 0, 0, 0, 0, 0, 2541, 4626, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4627, 4453, 1436, 0, 2633, 0, 0, 4628, 4629, 0, 4630, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2493, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4631, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 556, 0, 0, 0,
+  0, 0, 0, 0, 2501, 4632, 0, 0, 0, 0, 0, 0, 4633, 0, 2641, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 524, 0, 0, 4634, 4635, 0, 0, 0,
+  0, 4636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 4, 218, 228, 1433, 230, 574, 4278, 322, 988, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2651, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4637, 4638, 4639, 4640, 4641, 3756, 4642, 4643, 4644, 4645, 3757, 4646, 4647, 4648, 3758, 4649,
+  4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 3816, 4661, 4662, 4663, 4664,
+  4665, 4666, 4667, 4668, 4669, 3821, 3759, 3760, 3822, 4670, 4671, 3567, 4672, 3761, 4673, 4674,
+  4675, 4676, 4676, 4676, 4677, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688,
+  4689, 4690, 4691, 4692, 4693, 4694, 4694, 3824, 4695, 4696, 4697, 4698, 3763, 4699, 4700, 4701,
+  3720, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716,
+  4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4727, 4728, 4729, 4730, 3563,
+  4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 3768, 4739, 4740, 4741, 4742, 4743, 4744, 4745,
+  4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 3509, 4760,
+  4761, 4762, 4762, 4763, 4764, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774,
+  4775, 4776, 4777, 3769, 4778, 4779, 4780, 4781, 3836, 4781, 4782, 3771, 4783, 4784, 4785, 4786,
+  3772, 3482, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800,
+  4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808, 3773, 4809, 4810, 4811, 4812, 4813, 4814, 3775,
+  4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 3510, 3844, 4823, 4824, 4825, 4826, 4827, 4828,
+  4829, 4830, 3776, 4831, 4832, 4833, 4834, 3887, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842,
+  4843, 4844, 4845, 4846, 4847, 3580, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857,
+  4858, 3777, 3667, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 3848, 4867, 4868, 4869, 4870,
+  4871, 4872, 4873, 4874, 3849, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885,
+  4886, 3851, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4897, 4898, 4899,
+  3853, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 3566, 4907, 4908, 4909, 4910, 4911, 4912, 4913,
+  3859, 4914, 4915, 4916, 4917, 4918, 4919, 4919, 3860, 3889, 4920, 4921, 4922, 4923, 4924, 3528,
+  3862, 4925, 4926, 3788, 4927, 4928, 3742, 4929, 4930, 3792, 4931, 4932, 4933, 4934, 4934, 4935,
+  4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+  4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961, 3798, 4962, 4963, 4964, 4965, 4966,
+  4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975, 4976, 4977, 4763, 4978, 4979, 4980, 4981,
+  4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989, 3584, 4990, 4991, 4992, 4993, 4994, 4995, 3801,
+  4996, 4997, 4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011,
+  5012, 5013, 5014, 5015, 3523, 5016, 5017, 5018, 5019, 5020, 5021, 3869, 5022, 5023, 5024, 5025,
+  5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041,
+  3874, 3875, 5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 3876,
+  5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070,
+  5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084, 3882, 3882,
+  5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094, 3883, 5095, 5096, 5097, 5098, 5099,
+  5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109, 5110, 5111, 5112, 5113, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// The first octet of each mapping, then the number of octets
+inline constexpr auto mapping_offsets = std::array<std::uint16_t, 5115>{
+  0, 0, 2, 8, 9, 10, 11, 13, 14, 17, 20, 22, 24, 25, 28, 31,
+  34, 37, 40, 43, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 75, 78,
+  81, 84, 87, 90, 93, 94, 97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+  127, 130, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 164, 167, 170, 173,
+  176, 179, 182, 185, 188, 191, 194, 197, 200, 203, 206, 209, 212, 215, 218, 221,
+  224, 227, 230, 233, 236, 239, 242, 245, 248, 251, 254, 257, 260, 263, 266, 269,
+  272, 275, 278, 281, 284, 287, 290, 293, 296, 299, 302, 305, 308, 311, 314, 317,
+  320, 323, 326, 329, 332, 335, 338, 341, 344, 347, 348, 350, 352, 355, 358, 361,
+  364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394, 397, 400, 403, 406, 409,
+  411, 414, 417, 420, 423, 426, 429, 431, 433, 436, 439, 442, 445, 448, 451, 454,
+  457, 460, 463, 466, 469, 472, 475, 478, 481, 484, 487, 490, 493, 496, 499, 502,
+  505, 508, 511, 514, 517, 520, 523, 526, 529, 532, 535, 538, 541, 544, 547, 550,
+  553, 556, 559, 562, 563, 566, 568, 571, 572, 574, 576, 579, 580, 583, 586, 588,
+  591, 593, 596, 599, 602, 605, 608, 611, 613, 616, 617, 618, 620, 623, 626, 629,
+  632, 634, 637, 640, 643, 644, 647, 648, 649, 651, 653, 654, 658, 662, 666, 668,
+  670, 672, 674, 676, 678, 681, 684, 687, 690, 693, 696, 699, 702, 707, 712, 717,
+  722, 727, 732, 737, 742, 747, 752, 757, 762, 766, 770, 773, 776, 779, 782, 785,
+  788, 791, 794, 799, 804, 808, 812, 815, 817, 819, 821, 824, 827, 830, 833, 838,
+  843, 847, 851, 855, 859, 862, 865, 868, 871, 874, 877, 880, 883, 886, 889, 892,
+  895, 898, 901, 904, 907, 910, 913, 916, 919, 922, 925, 928, 931, 934, 937, 940,
+  943, 946, 949, 950, 953, 956, 959, 962, 965, 968, 973, 978, 983, 988, 991, 994,
+  999, 1004, 1007, 1010, 1013, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1036, 1039, 1042,
+  1045, 1047, 1051, 1054, 1057, 1058, 1061, 1064, 1067, 1070, 1073, 1074, 1078, 1081, 1084, 1088,
+  1091, 1094, 1097, 1098, 1101, 1103, 1106, 1109, 1112, 1114, 1117, 1120, 1123, 1125, 1127, 1130,
+  1132, 1133, 1134, 1135, 1136, 1137, 1139, 1142, 1144, 1145, 1148, 1151, 1153, 1155, 1157, 1159,
+  1161, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183, 1187, 1189, 1191, 1193,
+  1195, 1197, 1199, 1201, 1203, 1205, 1207, 1209, 1211, 1213, 1215, 1217, 1219, 1221, 1223, 1225,
+  1227, 1229, 1231, 1233, 1235, 1237, 1239, 1241, 1243, 1245, 1247, 1249, 1251, 1253, 1255, 1257,
+  1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273, 1277, 1279, 1281, 1283, 1285, 1287, 1289, 1291,
+  1293, 1295, 1297, 1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319, 1321, 1323,
+  1325, 1327, 1329, 1331, 1333, 1335, 1337, 1339, 1341, 1343, 1345, 1347, 1349, 1351, 1353, 1356,
+  1358, 1360, 1362, 1365, 1367, 1370, 1371, 1372, 1376, 1380, 1382, 1386, 1390, 1394, 1398, 1402,
+  1406, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1420, 1421, 1422, 1423, 1425, 1426, 1427, 1428,
+  1432, 1436, 1440, 1444, 1448, 1452, 1458, 1460, 1463, 1465, 1466, 1467, 1468, 1471, 1473, 1477,
+  1481, 1485, 1489, 1493, 1497, 1501, 1503, 1505, 1506, 1508, 1509, 1510, 1512, 1513, 1515, 1518,
+  1522, 1526, 1530, 1533, 1534, 1538, 1542, 1546, 1550, 1552, 1556, 1558, 1560, 1562, 1564, 1565,
+  1567, 1568, 1569, 1571, 1575, 1577, 1579, 1582, 1585, 1587, 1590, 1594, 1598, 1602, 1606, 1610,
+  1614, 1618, 1620, 1622, 1623, 1627, 1631, 1637, 1642, 1644, 1646, 1648, 1650, 1652, 1658, 1664,
+  1667, 1669, 1673, 1677, 1681, 1684, 1688, 1691, 1695, 1698, 1702, 1705, 1709, 1712, 1715, 1718,
+  1723, 1726, 1727, 1731, 1734, 1738, 1742, 1746, 1750, 1753, 1757, 1759, 1761, 1764, 1768, 1772,
+  1776, 1780, 1784, 1788, 1792, 1794, 1798, 1802, 1806, 1810, 1814, 1818, 1822, 1826, 1830, 1834,
+  1838, 1842, 1846, 1850, 1854, 1858, 1862, 1866, 1870, 1874, 1878, 1882, 1886, 1890, 1894, 1898,
+  1899, 1901, 1902, 1904, 1906, 1907, 1908, 1911, 1914, 1917, 1920, 1921, 1923, 1924, 1926, 1930,
+  1932, 1934, 1936, 1938, 1940, 1942, 1944, 1946, 1948, 1950, 1952, 1954, 1956, 1958, 1960, 1962,
+  1964, 1966, 1968, 1970, 1972, 1974, 1976, 1978, 1980, 1982, 1984, 1986, 1988, 1990, 1992, 1994,
+  1996, 1998, 2000, 2002, 2004, 2006, 2008, 2010, 2012, 2014, 2016, 2018, 2020, 2029, 2041, 2043,
+  2045, 2047, 2049, 2051, 2053, 2055, 2057, 2059, 2061, 2063, 2065, 2069, 2073, 2077, 2081, 2085,
+  2089, 2093, 2097, 2099, 2101, 2103, 2105, 2107, 2109, 2111, 2113, 2115, 2116, 2118, 2119, 2121,
+  2123, 2126, 2129, 2133, 2139, 2143, 2147, 2151, 2155, 2159, 2163, 2167, 2171, 2175, 2179, 2183,
+  2187, 2191, 2193, 2195, 2199, 2203, 2207, 2211, 2215, 2219, 2221, 2225, 2229, 2233, 2237, 2241,
+  2245, 2247, 2251, 2253, 2255, 2257, 2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273, 2275, 2277,
+  2279, 2281, 2283, 2287, 2291, 2293, 2295, 2297, 2299, 2301, 2305, 2309, 2312, 2314, 2316, 2318,
+  2320, 2322, 2324, 2326, 2328, 2330, 2332, 2334, 2336, 2338, 2340, 2342, 2344, 2346, 2348, 2350,
+  2352, 2354, 2356, 2358, 2360, 2364, 2366, 2368, 2372, 2376, 2380, 2384, 2388, 2390, 2392, 2394,
+  2396, 2398, 2399, 2401, 2404, 2407, 2410, 2413, 2416, 2419, 2422, 2425, 2428, 2431, 2434, 2437,
+  2440, 2443, 2446, 2449, 2452, 2455, 2458, 2461, 2464, 2467, 2470, 2473, 2476, 2479, 2482, 2485,
+  2488, 2491, 2494, 2497, 2501, 2505, 2509, 2513, 2519, 2525, 2527, 2529, 2533, 2537, 2543, 2549,
+  2555, 2558, 2561, 2564, 2567, 2570, 2573, 2576, 2579, 2582, 2585, 2588, 2591, 2594, 2597, 2600,
+  2603, 2606, 2609, 2612, 2615, 2618, 2621, 2624, 2627, 2630, 2633, 2635, 2638, 2641, 2644, 2647,
+  2650, 2653, 2656, 2659, 2662, 2665, 2668, 2671, 2674, 2676, 2680, 2682, 2688, 2694, 2703, 2709,
+  2715, 2721, 2727, 2736, 2745, 2754, 2760, 2766, 2772, 2774, 2777, 2780, 2786, 2792, 2798, 2804,
+  2810, 2816, 2822, 2828, 2834, 2840, 2846, 2852, 2855, 2861, 2867, 2873, 2879, 2880, 2883, 2886,
+  2892, 2898, 2904, 2910, 2916, 2922, 2928, 2934, 2940, 2946, 2949, 2955, 2961, 2967, 2973, 2979,
+  2985, 2991, 2997, 3006, 3015, 3024, 3027, 3030, 3033, 3036, 3039, 3042, 3045, 3048, 3054, 3060,
+  3066, 3072, 3075, 3081, 3087, 3089, 3095, 3101, 3104, 3107, 3110, 3116, 3122, 3128, 3130, 3133,
+  3136, 3139, 3142, 3148, 3154, 3157, 3160, 3163, 3169, 3175, 3178, 3184, 3187, 3193, 3199, 3205,
+  3210, 3215, 3220, 3225, 3231, 3236, 3242, 3245, 3251, 3257, 3263, 3266, 3269, 3272, 3278, 3284,
+  3287, 3290, 3293, 3296, 3299, 3302, 3305, 3308, 3311, 3314, 3317, 3323, 3329, 3335, 3341, 3350,
+  3353, 3359, 3362, 3365, 3368, 3374, 3380, 3386, 3392, 3398, 3404, 3407, 3410, 3413, 3416, 3422,
+  3425, 3428, 3431, 3434, 3440, 3446, 3452, 3458, 3461, 3470, 3475, 3478, 3484, 3493, 3502, 3511,
+  3517, 3526, 3529, 3535, 3541, 3550, 3556, 3562, 3565, 3568, 3574, 3577, 3580, 3583, 3586, 3589,
+  3592, 3595, 3600, 3603, 3606, 3609, 3615, 3618, 3621, 3624, 3627, 3630, 3633, 3636, 3639, 3642,
+  3645, 3648, 3651, 3656, 3659, 3662, 3665, 3668, 3671, 3674, 3677, 3683, 3689, 3698, 3710, 3722,
+  3725, 3731, 3734, 3737, 3743, 3749, 3755, 3758, 3761, 3767, 3773, 3779, 3785, 3791, 3797, 3800,
+  3803, 3806, 3812, 3815, 3821, 3827, 3836, 3842, 3851, 3854, 3857, 3860, 3863, 3866, 3872, 3875,
+  3878, 3881, 3884, 3887, 3893, 3899, 3905, 3911, 3917, 3923, 3926, 3932, 3935, 3938, 3944, 3948,
+  3954, 3960, 3966, 3981, 3984, 3987, 3990, 3996, 3999, 4005, 4014, 4020, 4026, 4032, 4035, 4040,
+  4043, 4049, 4055, 4061, 4067, 4073, 4079, 4085, 4091, 4097, 4103, 4109, 4115, 4121, 4127, 4133,
+  4139, 4145, 4151, 4157, 4163, 4172, 4181, 4190, 4199, 4208, 4214, 4220, 4226, 4232, 4238, 4247,
+  4253, 4259, 4265, 4271, 4277, 4283, 4292, 4301, 4307, 4313, 4319, 4325, 4331, 4337, 4343, 4349,
+  4355, 4361, 4367, 4373, 4379, 4385, 4391, 4397, 4403, 4409, 4415, 4421, 4427, 4433, 4439, 4445,
+  4451, 4457, 4463, 4469, 4475, 4481, 4487, 4493, 4499, 4505, 4511, 4517, 4523, 4532, 4538, 4544,
+  4553, 4559, 4562, 4568, 4571, 4577, 4583, 4589, 4595, 4601, 4607, 4613, 4619, 4625, 4631, 4640,
+  4649, 4655, 4661, 4667, 4676, 4682, 4688, 4694, 4703, 4712, 4721, 4727, 4733, 4739, 4748, 4754,
+  4763, 4769, 4775, 4781, 4787, 4796, 4802, 4808, 4814, 4820, 4826, 4832, 4838, 4844, 4850, 4856,
+  4862, 4868, 4874, 4880, 4889, 4892, 4898, 4901, 4904, 4907, 4913, 4919, 4925, 4931, 4937, 4943,
+  4946, 4949, 4952, 4955, 4958, 4961, 4964, 4967, 4970, 4973, 4979, 4988, 4994, 5000, 5009, 5015,
+  5024, 5033, 5042, 5051, 5060, 5069, 5078, 5084, 5090, 5096, 5102, 5108, 5114, 5123, 5129, 5135,
+  5141, 5147, 5153, 5156, 5165, 5171, 5174, 5180, 5186, 5192, 5198, 5201, 5207, 5213, 5219, 5225,
+  5231, 5233, 5235, 5238, 5241, 5244, 5245, 5247, 5249, 5251, 5252, 5253, 5254, 5256, 5261, 5266,
+  5270, 5274, 5279, 5284, 5289, 5294, 5299, 5304, 5309, 5314, 5319, 5324, 5326, 5332, 5337, 5343,
+  5349, 5352, 5355, 5358, 5362, 5366, 5371, 5376, 5379, 5384, 5389, 5392, 5395, 5400, 5405, 5410,
+  5413, 5416, 5420, 5424, 5429, 5434, 5439, 5444, 5449, 5454, 5459, 5464, 5469, 5471, 5474, 5478,
+  5482, 5485, 5490, 5495, 5498, 5501, 5506, 5511, 5514, 5517, 5522, 5527, 5530, 5533, 5538, 5543,
+  5547, 5549, 5551, 5553, 5558, 5563, 5568, 5573, 5578, 5583, 5586, 5589, 5594, 5599, 5604, 5609,
+  5614, 5619, 5624, 5629, 5633, 5637, 5642, 5647, 5652, 5657, 5662, 5667, 5670, 5675, 5680, 5685,
+  5690, 5695, 5700, 5705, 5710, 5713, 5718, 5723, 5728, 5733, 5738, 5743, 5748, 5753, 5758, 5763,
+  5768, 5773, 5778, 5783, 5788, 5793, 5798, 5803, 5808, 5813, 5818, 5823, 5828, 5833, 5838, 5843,
+  5848, 5853, 5857, 5863, 5867, 5873, 5878, 5883, 5888, 5893, 5898, 5903, 5908, 5913, 5918, 5923,
+  5928, 5933, 5938, 5943, 5946, 5949, 5954, 5959, 5964, 5969, 5974, 5979, 5984, 5989, 5994, 5999,
+  6004, 6009, 6012, 6017, 6022, 6027, 6032, 6037, 6042, 6048, 6052, 6058, 6062, 6068, 6072, 6078,
+  6084, 6090, 6096, 6102, 6106, 6112, 6118, 6124, 6127, 6130, 6133, 6136, 6139, 6142, 6145, 6148,
+  6151, 6154, 6156, 6158, 6164, 6170, 6176, 6182, 6186, 6192, 6198, 6204, 6209, 6214, 6219, 6224,
+  6229, 6234, 6239, 6242, 6245, 6246, 6249, 6252, 6255, 6256, 6259, 6262, 6265, 6268, 6271, 6274,
+  6277, 6280, 6283, 6286, 6289, 6292, 6295, 6298, 6301, 6306, 6311, 6316, 6321, 6326, 6331, 6336,
+  6341, 6346, 6351, 6356, 6361, 6366, 6371, 6376, 6381, 6386, 6391, 6397, 6403, 6408, 6413, 6418,
+  6423, 6428, 6433, 6437, 6442, 6447, 6450, 6453, 6456, 6459, 6462, 6465, 6468, 6471, 6474, 6477,
+  6480, 6483, 6486, 6489, 6492, 6495, 6498, 6501, 6507, 6513, 6516, 6519, 6522, 6525, 6528, 6531,
+  6533, 6536, 6539, 6542, 6545, 6548, 6551, 6554, 6557, 6560, 6563, 6566, 6569, 6572, 6575, 6578,
+  6581, 6584, 6587, 6590, 6593, 6596, 6599, 6605, 6611, 6617, 6623, 6629, 6635, 6638, 6644, 6650,
+  6656, 6662, 6668, 6671, 6674, 6677, 6680, 6683, 6689, 6692, 6695, 6698, 6701, 6704, 6707, 6710,
+  6713, 6716, 6719, 6722, 6725, 6728, 6731, 6734, 6740, 6746, 6749, 6752, 6755, 6758, 6761, 6764,
+  6767, 6770, 6773, 6776, 6779, 6782, 6785, 6788, 6791, 6794, 6797, 6800, 6801, 6803, 6806, 6808,
+  6811, 6813, 6815, 6818, 6822, 6825, 6828, 6832, 6835, 6838, 6841, 6844, 6847, 6850, 6854, 6856,
+  6859, 6862, 6865, 6868, 6871, 6874, 6877, 6880, 6883, 6886, 6889, 6892, 6895, 6898, 6901, 6904,
+  6907, 6910, 6913, 6916, 6919, 6922, 6925, 6928, 6931, 6934, 6937, 6940, 6943, 6946, 6949, 6952,
+  6955, 6958, 6961, 6964, 6967, 6970, 6973, 6976, 6979, 6982, 6985, 6988, 6991, 6994, 6997, 7000,
+  7003, 7006, 7009, 7012, 7015, 7018, 7021, 7024, 7027, 7030, 7033, 7036, 7039, 7042, 7045, 7048,
+  7051, 7054, 7057, 7060, 7063, 7066, 7069, 7072, 7075, 7078, 7081, 7084, 7089, 7094, 7097, 7100,
+  7103, 7106, 7109, 7112, 7115, 7118, 7121, 7124, 7129, 7134, 7139, 7144, 7147, 7150, 7153, 7156,
+  7161, 7166, 7169, 7172, 7175, 7178, 7181, 7184, 7187, 7190, 7193, 7196, 7199, 7202, 7205, 7208,
+  7211, 7214, 7219, 7224, 7227, 7230, 7233, 7236, 7239, 7242, 7245, 7248, 7253, 7258, 7261, 7264,
+  7267, 7270, 7273, 7276, 7279, 7282, 7285, 7288, 7291, 7294, 7297, 7300, 7303, 7306, 7309, 7312,
+  7317, 7322, 7327, 7332, 7337, 7342, 7347, 7352, 7355, 7358, 7361, 7364, 7367, 7370, 7373, 7376,
+  7381, 7386, 7389, 7392, 7395, 7398, 7401, 7404, 7409, 7414, 7419, 7424, 7429, 7434, 7437, 7440,
+  7443, 7446, 7449, 7452, 7455, 7458, 7461, 7464, 7467, 7470, 7473, 7476, 7481, 7486, 7491, 7496,
+  7499, 7502, 7505, 7508, 7511, 7514, 7517, 7520, 7523, 7526, 7529, 7532, 7535, 7538, 7541, 7544,
+  7547, 7550, 7553, 7556, 7559, 7562, 7565, 7568, 7571, 7574, 7577, 7580, 7583, 7586, 7589, 7593,
+  7596, 7599, 7602, 7605, 7610, 7615, 7620, 7625, 7630, 7635, 7640, 7645, 7650, 7655, 7660, 7665,
+  7670, 7675, 7680, 7685, 7690, 7695, 7700, 7705, 7708, 7711, 7714, 7717, 7720, 7723, 7728, 7733,
+  7738, 7743, 7748, 7753, 7758, 7763, 7768, 7773, 7776, 7779, 7782, 7785, 7788, 7791, 7794, 7797,
+  7802, 7807, 7812, 7817, 7822, 7827, 7832, 7837, 7842, 7847, 7852, 7857, 7862, 7867, 7872, 7877,
+  7882, 7887, 7892, 7897, 7900, 7903, 7906, 7909, 7914, 7919, 7924, 7929, 7934, 7939, 7944, 7949,
+  7954, 7959, 7962, 7965, 7968, 7971, 7974, 7977, 7980, 7983, 7987, 7991, 7997, 8003, 8009, 8015,
+  8021, 8027, 8031, 8035, 8041, 8047, 8053, 8059, 8065, 8071, 8075, 8079, 8085, 8091, 8097, 8103,
+  8107, 8111, 8117, 8123, 8129, 8135, 8139, 8143, 8149, 8155, 8161, 8167, 8173, 8179, 8183, 8187,
+  8193, 8199, 8205, 8211, 8217, 8223, 8227, 8231, 8237, 8243, 8249, 8255, 8261, 8267, 8271, 8275,
+  8281, 8287, 8293, 8299, 8305, 8311, 8315, 8319, 8325, 8331, 8337, 8343, 8347, 8351, 8357, 8363,
+  8369, 8375, 8379, 8383, 8389, 8395, 8401, 8407, 8413, 8419, 8423, 8429, 8435, 8441, 8445, 8449,
+  8455, 8461, 8467, 8473, 8479, 8485, 8489, 8493, 8499, 8505, 8511, 8517, 8523, 8529, 8533, 8537,
+  8541, 8545, 8549, 8553, 8557, 8563, 8569, 8577, 8585, 8593, 8601, 8609, 8617, 8623, 8629, 8637,
+  8645, 8653, 8661, 8669, 8677, 8683, 8689, 8697, 8705, 8713, 8721, 8729, 8737, 8743, 8749, 8757,
+  8765, 8773, 8781, 8789, 8797, 8803, 8809, 8817, 8825, 8833, 8841, 8849, 8857, 8863, 8869, 8877,
+  8885, 8893, 8901, 8909, 8917, 8921, 8925, 8931, 8935, 8941, 8945, 8951, 8955, 8959, 8963, 8967,
+  8969, 8973, 8979, 8983, 8989, 8993, 8999, 9003, 9007, 9011, 9016, 9021, 9026, 9030, 9034, 9040,
+  9044, 9050, 9054, 9058, 9062, 9067, 9072, 9077, 9081, 9085, 9091, 9095, 9099, 9103, 9109, 9113,
+  9117, 9121, 9125, 9129, 9130, 9136, 9140, 9146, 9150, 9156, 9160, 9164, 9168, 9170, 9173, 9176,
+  9178, 9181, 9184, 9186, 9188, 9190, 9192, 9196, 9199, 9202, 9205, 9209, 9211, 9215, 9217, 9220,
+  9225, 9229, 9231, 9233, 9236, 9239, 9242, 9245, 9248, 9251, 9254, 9257, 9260, 9263, 9266, 9269,
+  9272, 9275, 9278, 9281, 9284, 9287, 9290, 9293, 9296, 9299, 9302, 9305, 9308, 9311, 9314, 9317,
+  9320, 9323, 9325, 9328, 9330, 9331, 9334, 9336, 9338, 9339, 9341, 9343, 9345, 9347, 9350, 9353,
+  9356, 9360, 9363, 9365, 9367, 9370, 9374, 9376, 9378, 9381, 9383, 9386, 9388, 9390, 9393, 9397,
+  9399, 9401, 9404, 9407, 9410, 9415, 9420, 9425, 9428, 9432, 9435, 9438, 9443, 9448, 9453, 9455,
+  9460, 9465, 9470, 9473, 9474, 9476, 9481, 9486, 9488, 9492, 9498, 9504, 9513, 9516, 9521, 9526,
+  9531, 9536, 9539, 9544, 9547, 9550, 9553, 9556, 9559, 9564, 9567, 9569, 9571, 9576, 9579, 9582,
+  9587, 9592, 9597, 9602, 9607, 9612, 9617, 9622, 9625, 9628, 9633, 9638, 9643, 9648, 9652, 9654,
+  9657, 9662, 9667, 9672, 9677, 9680, 9683, 9686, 9689, 9692, 9697, 9702, 9707, 9712, 9717, 9722,
+  9727, 9732, 9738, 9741, 9744, 9747, 9750, 9753, 9757, 9762, 9766, 9769, 9772, 9777, 9782, 9786,
+  9789, 9792, 9797, 9799, 9802, 9807, 9810, 9814, 9817, 9820, 9823, 9826, 9832, 9835, 9838, 9840,
+  9843, 9846, 9849, 9852, 9855, 9858, 9861, 9864, 9867, 9870, 9873, 9876, 9879, 9882, 9885, 9888,
+  9891, 9894, 9897, 9901, 9905, 9909, 9913, 9917, 9921, 9925, 9929, 9933, 9937, 9941, 9943, 9945,
+  9947, 9949, 9951, 9953, 9955, 9957, 9959, 9962, 9965, 9968, 9971, 9974, 9977, 9980, 9983, 9986,
+  9989, 9992, 9995, 9998, 10001, 10004, 10007, 10010, 10013, 10016, 10019, 10022, 10025, 10029, 10032, 10035,
+  10038, 10041, 10044, 10047, 10050, 10053, 10056, 10059, 10062, 10065, 10068, 10070, 10073, 10075, 10078, 10082,
+  10085, 10088, 10091, 10094, 10097, 10100, 10103, 10106, 10109, 10112, 10116, 10119, 10122, 10125, 10128, 10132,
+  10135, 10138, 10141, 10149, 10161, 10162, 10163, 10164, 10165, 10167, 10171, 10175, 10178, 10181, 10187, 10193,
+  10199, 10205, 10208, 10211, 10214, 10218, 10221, 10225, 10228, 10231, 10234, 10237, 10240, 10243, 10251, 10254,
+  10257, 10260, 10263, 10266, 10270, 10273, 10276, 10279, 10282, 10285, 10288, 10291, 10295, 10298, 10300, 10303,
+  10305, 10308, 10311, 10317, 10322, 10325, 10327, 10330, 10333, 10336, 10339, 10341, 10343, 10345, 10347, 10349,
+  10351, 10353, 10356, 10359, 10362, 10365, 10368, 10371, 10374, 10377, 10380, 10383, 10386, 10389, 10392, 10395,
+  10398, 10401, 10404, 10407, 10410, 10413, 10416, 10419, 10422, 10425, 10428, 10431, 10434, 10437, 10440, 10443,
+  10446, 10449, 10452, 10454, 10456, 10459, 10462, 10465, 10467, 10469, 10471, 10474, 10477, 10480, 10483, 10486,
+  10489, 10492, 10495, 10498, 10501, 10504, 10507, 10510, 10513, 10516, 10519, 10522, 10525, 10528, 10531, 10534,
+  10537, 10540, 10543, 10546, 10549, 10552, 10555, 10558, 10561, 10564, 10567, 10570, 10573, 10576, 10579, 10582,
+  10585, 10588, 10591, 10594, 10597, 10600, 10603, 10606, 10609, 10612, 10615, 10618, 10621, 10624, 10627, 10630,
+  10633, 10636, 10639, 10642, 10645, 10648, 10651, 10654, 10657, 10660, 10663, 10666, 10669, 10672, 10675, 10678,
+  10681, 10684, 10687, 10690, 10693, 10696, 10699, 10702, 10705, 10708, 10711, 10714, 10717, 10720, 10723, 10726,
+  10729, 10732, 10735, 10738, 10741, 10744, 10747, 10750, 10753, 10756, 10759, 10762, 10765, 10768, 10771, 10774,
+  10777, 10780, 10783, 10786, 10789, 10792, 10795, 10798, 10801, 10804, 10807, 10810, 10813, 10816, 10819, 10822,
+  10825, 10828, 10831, 10834, 10837, 10840, 10843, 10846, 10849, 10852, 10855, 10858, 10861, 10864, 10867, 10870,
+  10873, 10876, 10879, 10882, 10885, 10888, 10891, 10894, 10897, 10900, 10903, 10906, 10909, 10912, 10915, 10918,
+  10921, 10924, 10927, 10930, 10933, 10936, 10939, 10942, 10945, 10948, 10951, 10954, 10957, 10960, 10963, 10966,
+  10969, 10972, 10975, 10978, 10981, 10984, 10987, 10990, 10993, 10996, 10999, 11002, 11005, 11008, 11011, 11014,
+  11017, 11020, 11023, 11026, 11029, 11032, 11035, 11038, 11041, 11044, 11047, 11050, 11053, 11056, 11059, 11062,
+  11065, 11068, 11071, 11074, 11077, 11080, 11083, 11086, 11089, 11092, 11095, 11098, 11101, 11104, 11107, 11110,
+  11113, 11116, 11119, 11122, 11125, 11128, 11131, 11134, 11137, 11140, 11143, 11146, 11149, 11152, 11155, 11158,
+  11161, 11164, 11167, 11170, 11173, 11176, 11179, 11182, 11185, 11188, 11191, 11194, 11197, 11200, 11203, 11206,
+  11209, 11212, 11215, 11218, 11221, 11224, 11227, 11230, 11233, 11236, 11239, 11242, 11245, 11248, 11251, 11254,
+  11257, 11260, 11263, 11266, 11269, 11272, 11275, 11278, 11281, 11284, 11286, 11289, 11292, 11295, 11298, 11301,
+  11303, 11305, 11308, 11311, 11314, 11317, 11323, 11329, 11335, 11341, 11347, 11353, 11359, 11365, 11371, 11377,
+  11383, 11389, 11395, 11401, 11407, 11413, 11419, 11425, 11431, 11437, 11443, 11449, 11455, 11461, 11467, 11473,
+  11476, 11478, 11481, 11484, 11490, 11496, 11502, 11508, 11514, 11520, 11526, 11532, 11538, 11544, 11550, 11556,
+  11562, 11568, 11574, 11580, 11586, 11592, 11598, 11604, 11610, 11616, 11619, 11625, 11631, 11637, 11643, 11649,
+  11655, 11661, 11667, 11673, 11679, 11682, 11685, 11688, 11691, 11694, 11697, 11700, 11703, 11706, 11709, 11714,
+  11719, 11724, 11729, 11734, 11739, 11744, 11749, 11754, 11759, 11764, 11769, 11774, 11779, 11787, 11795, 11803,
+  11811, 11819, 11827, 11835, 11843, 11851, 11859, 11867, 11875, 11883, 11891, 11899, 11916, 11930, 11935, 11940,
+  11945, 11950, 11955, 11960, 11965, 11970, 11975, 11980, 11985, 11990, 11995, 12000, 12005, 12010, 12015, 12020,
+  12025, 12030, 12035, 12040, 12045, 12050, 12055, 12060, 12065, 12070, 12075, 12080, 12085, 12090, 12095, 12100,
+  12105, 12110, 12114, 12118, 12122, 12126, 12130, 12134, 12138, 12142, 12146, 12151, 12156, 12161, 12165, 12169,
+  12173, 12177, 12181, 12185, 12189, 12193, 12197, 12201, 12206, 12211, 12216, 12221, 12226, 12231, 12236, 12241,
+  12246, 12251, 12256, 12261, 12266, 12271, 12276, 12280, 12284, 12288, 12292, 12296, 12300, 12304, 12308, 12312,
+  12317, 12322, 12327, 12332, 12337, 12342, 12347, 12352, 12357, 12362, 12367, 12372, 12377, 12382, 12387, 12392,
+  12397, 12402, 12407, 12412, 12417, 12422, 12425, 12428, 12431, 12434, 12437, 12440, 12443, 12446, 12449, 12452,
+  12455, 12458, 12461, 12464, 12467, 12470, 12473, 12476, 12479, 12482, 12485, 12488, 12491, 12494, 12497, 12500,
+  12503, 12506, 12509, 12512, 12515, 12518, 12521, 12524, 12527, 12530, 12533, 12536, 12539, 12542, 12545, 12548,
+  12551, 12554, 12557, 12560, 12563, 12566, 12569, 12572, 12575, 12578, 12581, 12584, 12587, 12590, 12593, 12596,
+  12599, 12601, 12603, 12606, 12610, 12613, 12616, 12619, 12622, 12625, 12628, 12631, 12634, 12637, 12639, 12642,
+  12645, 12648, 12650, 12656, 12658, 12660, 12663, 12665, 12667, 12669, 12671, 12673, 12675, 12677, 12679, 12681,
+  12683, 12686, 12688, 12689, 12692, 12695, 12699, 12703, 12705, 12708, 12711, 12714, 12717, 12720, 12723, 12726,
+  12729, 12732, 12735, 12738, 12741, 12744, 12747, 12750, 12753, 12756, 12759, 12762, 12765, 12768, 12771, 12774,
+  12777, 12780, 12783, 12786, 12789, 12795, 12801, 12807, 12813, 12822, 12831, 12840, 12846, 12852, 12861, 12867,
+  12876, 12882, 12888, 12897, 12903, 12909, 12915, 12921, 12924, 12927, 12930, 12933, 12936, 12939, 12942, 12945,
+  12948, 12951, 12954, 12957, 12960, 12963, 12966, 12969, 12972, 12976, 12981, 12986, 12988, 12991, 12993, 12996,
+  12998, 13001, 13004, 13007, 13010, 13012, 13015, 13018, 13024, 13033, 13039, 13048, 13054, 13060, 13069, 13078,
+  13084, 13090, 13096, 13105, 13111, 13120, 13129, 13135, 13144, 13153, 13159, 13165, 13171, 13177, 13186, 13192,
+  13198, 13207, 13216, 13222, 13228, 13237, 13246, 13255, 13264, 13273, 13279, 13288, 13294, 13303, 13309, 13318,
+  13324, 13333, 13339, 13348, 13357, 13366, 13372, 13378, 13387, 13393, 13399, 13405, 13414, 13420, 13426, 13429,
+  13432, 13435, 13438, 13441, 13444, 13447, 13450, 13453, 13456, 13459, 13462, 13465, 13468, 13471, 13474, 13477,
+  13480, 13483, 13486, 13489, 13492, 13495, 13498, 13501, 13504, 13507, 13510, 13513, 13516, 13519, 13522, 13525,
+  13528, 13531, 13534, 13537, 13540, 13543, 13546, 13549, 13552, 13555, 13558, 13561, 13564, 13567, 13570, 13573,
+  13576, 13579, 13582, 13585, 13588, 13591, 13594, 13597, 13600, 13603, 13606, 13609, 13612, 13615, 13618, 13621,
+  13624, 13627, 13630, 13633, 13636, 13639, 13642, 13645, 13648, 13651, 13654, 13657, 13660, 13663, 13666, 13669,
+  13672, 13675, 13678, 13681, 13684, 13687, 13690, 13693, 13696, 13699, 13702, 13705, 13708, 13711, 13714, 13717,
+  13720, 13723, 13726, 13729, 13732, 13735, 13738, 13741, 13744, 13747, 13750, 13753, 13756, 13759, 13762, 13765,
+  13768, 13771, 13774, 13777, 13780, 13783, 13786, 13789, 13792, 13795, 13798, 13801, 13804, 13807, 13810, 13813,
+  13816, 13819, 13822, 13825, 13828, 13831, 13834, 13837, 13840, 13843, 13846, 13849, 13852, 13855, 13858, 13861,
+  13864, 13867, 13870, 13873, 13876, 13879, 13882, 13885, 13888, 13891, 13894, 13897, 13900, 13903, 13906, 13909,
+  13912, 13915, 13918, 13921, 13924, 13927, 13930, 13933, 13936, 13939, 13942, 13945, 13948, 13951, 13954, 13957,
+  13960, 13963, 13966, 13969, 13972, 13975, 13978, 13981, 13984, 13987, 13990, 13993, 13996, 13999, 14002, 14005,
+  14008, 14011, 14014, 14017, 14020, 14023, 14026, 14029, 14032, 14035, 14038, 14041, 14044, 14047, 14050, 14053,
+  14056, 14059, 14062, 14065, 14068, 14071, 14074, 14077, 14080, 14083, 14086, 14089, 14092, 14095, 14098, 14101,
+  14104, 14107, 14110, 14113, 14116, 14119, 14122, 14125, 14128, 14131, 14134, 14137, 14140, 14143, 14146, 14149,
+  14152, 14155, 14158, 14161, 14164, 14167, 14170, 14173, 14176, 14179, 14182, 14185, 14188, 14191, 14194, 14197,
+  14200, 14203, 14206, 14209, 14212, 14215, 14218, 14221, 14224, 14227, 14230, 14233, 14236, 14239, 14242, 14245,
+  14248, 14251, 14254, 14257, 14260, 14263, 14266, 14269, 14272, 14275, 14278, 14281, 14284, 14287, 14290, 14293,
+  14296, 14299, 14302, 14305, 14308, 14311, 14314, 14317, 14320, 14323, 14326, 14329, 14332, 14335, 14338, 14341,
+  14344, 14347, 14350, 14353, 14356, 14359, 14362, 14365, 14368, 14371, 14374, 14377, 14380, 14383, 14386, 14389,
+  14392, 14395, 14398, 14401, 14404, 14407, 14410, 14413, 14416, 14419, 14422, 14425, 14428, 14431, 14434, 14437,
+  14440, 14443, 14446, 14449, 14452, 14455, 14459, 14462, 14465, 14468, 14471, 14474, 14477, 14480, 14483, 14486,
+  14489, 14492, 14495, 14498, 14501, 14504, 14507, 14510, 14513, 14516, 14519, 14522, 14525, 14528, 14531, 14534,
+  14537, 14540, 14543, 14546, 14549, 14552, 14555, 14558, 14561, 14564, 14567, 14570, 14573, 14576, 14579, 14582,
+  14585, 14588, 14591, 14594, 14597, 14600, 14603, 14606, 14609, 14612, 14615, 14618, 14621, 14624, 14627, 14630,
+  14633, 14636, 14639, 14642, 14645, 14648, 14651, 14654, 14657, 14660, 14663, 14666, 14669, 14673, 14677, 14681,
+  14684, 14687, 14690, 14694, 14698, 14702, 14705, 14708, 14710, 14712, 14714, 14717, 14720, 14722, 14726, 14730,
+  14734, 14738, 14742, 14746, 14749, 14753, 14755, 14757, 14759, 14761, 14763, 14765, 14767, 14771, 14775, 14781,
+  14787, 14791, 14795, 14799, 14803, 14807, 14811, 14815, 14819, 14823, 14827, 14831, 14835, 14839, 14843, 14847,
+  14851, 14855, 14859, 14863, 14867, 14871, 14875, 14879, 14883, 14887, 14891, 14895, 14899, 14903, 14905, 14907,
+  14909, 14911, 14913, 14915, 14917, 14919, 14921, 14923, 14925, 14927, 14929, 14933, 14937, 14939, 14944, 14949,
+  14955, 14963, 14971, 14979, 14985, 14991, 14997, 15003, 15009, 15013, 15017, 15021, 15025, 15029, 15033, 15037,
+  15041, 15045, 15049, 15055, 15061, 15067, 15071, 15075, 15079, 15083, 15087, 15091, 15095, 15099, 15103, 15107,
+  15111, 15115, 15119, 15123, 15127, 15131, 15135, 15139, 15143, 15147, 15151, 15155, 15159, 15163, 15167, 15171,
+  15175, 15179, 15183, 15187, 15191, 15195, 15198, 15202, 15206, 15210, 15214, 15218, 15222, 15226, 15230, 15234,
+  15238, 15242, 15246, 15250, 15254, 15258, 15262, 15266, 15270, 15274, 15278, 15281, 15284, 15287, 15291, 15295,
+  15299, 15303, 15307, 15311, 15315, 15319, 15324, 15329, 15334, 15339, 15344, 15349, 15355, 15361, 15367, 15371,
+  15375, 15379, 15383, 15387, 15391, 15397, 15403, 15409, 15412, 15416, 15420, 15424, 15428, 15432, 15436, 15442,
+  15445, 15448, 15452, 15455, 15458, 15461, 15464, 15469, 15472, 15478, 15483, 15488, 15493, 15498, 15502, 15506,
+  15510, 15514, 15520, 15524, 15528, 15532, 15536, 15540, 15546, 15552, 15558, 15564, 15568, 15572, 15576, 15579,
+  15585, 15591, 15597, 15603, 15609, 15615, 15621, 15627, 15633, 15639, 15645, 15651, 15657, 15663, 15669, 15675,
+  15681, 15689, 15697, 15705, 15713, 15719, 15725, 15731, 15737, 15743, 15749, 15755, 15761, 15767, 15773, 15779,
+  15785, 15791, 15797, 15803, 15809, 15815, 15821, 15827, 15833, 15839, 15845, 15851, 15857, 15863, 15869, 15874,
+  15879, 15885, 15891, 15897, 15903, 15909, 15915, 15921, 15927, 15933, 15939, 15945, 15951, 15957, 15963, 15971,
+  15977, 15983, 15989, 15995, 16001, 16007, 16013, 16019, 16025, 16031, 16037, 16043, 16049, 16055, 16061, 16067,
+  16073, 16079, 16089, 16096, 16104, 16112, 16120, 16127, 16135, 16165, 16178, 16185, 16188, 16191, 16194, 16197,
+  16200, 16203, 16206, 16209, 16212, 16215, 16218, 16221, 16224, 16227, 16230, 16233, 16236, 16239, 16242, 16245,
+  16248, 16251, 16254, 16256, 16260, 16262, 16264, 16266, 16268, 16270, 16272, 16274, 16276, 16278, 16280, 16282,
+  16284, 16286, 16288, 16290, 16292, 16294, 16296, 16298, 16304, 16309, 16314, 16317, 16320, 16323, 16326, 16329,
+  16332, 16335, 16344, 16350, 16353, 16357, 16359, 16362, 16366, 16370, 16374, 16378, 16382, 16386, 16390, 16394,
+  16397, 16399, 16401, 16405, 16407, 16409, 16412, 16413, 16416, 16420, 16424, 16428, 16432, 16436, 16444, 16448,
+  16452, 16456, 16460, 16464, 16468, 16472, 16476, 16480, 16484, 16488, 16492, 16496, 16500, 16504, 16508, 16512,
+  16516, 16520, 16524, 16528, 16532, 16536, 16540, 16544, 16548, 16552, 16556, 16564, 16572, 16580, 16584, 16588,
+  16592, 16596, 16600, 16608, 16616, 16620, 16624, 16628, 16632, 16635, 16638, 16641, 16644, 16648, 16652, 16656,
+  16660, 16664, 16668, 16676, 16684, 16688, 16692, 16696, 16700, 16704, 16708, 16712, 16716, 16720, 16724, 16728,
+  16732, 16736, 16748, 16760, 16772, 16784, 16796, 16808, 16812, 16816, 16824, 16828, 16831, 16834, 16837, 16840,
+  16843, 16846, 16849, 16852, 16855, 16858, 16861, 16864, 16867, 16870, 16873, 16876, 16879, 16882, 16885, 16888,
+  16891, 16894, 16897, 16905, 16913, 16916, 16924, 16927, 16930, 16933, 16936, 16939, 16947, 16955, 16959, 16963,
+  16967, 16971, 16975, 16979, 16983, 16987, 16995, 16999, 17003, 17007, 17011, 17015, 17018, 17026, 17030, 17034,
+  17038, 17042, 17046, 17050, 17054, 17062, 17070, 17078, 17090, 17102, 17110, 17118, 17130, 17138, 17146, 17154,
+  17166, 17178, 17182, 17190, 17194, 17198, 17202, 17206, 17210, 17214, 17218, 17222, 17226, 17230, 17234, 17238,
+  17242, 17246, 17250, 17254, 17258, 17262, 17265, 17269, 17273, 17277, 17285, 17293, 17305, 17317, 17329, 17341,
+  17353, 17357, 17361, 17365, 17369, 17373, 17374, 17378, 17382, 17386, 17390, 17394, 17398, 17402, 17406, 17410,
+  17414, 17418, 17422, 17426, 17430, 17434, 17438, 17442, 17446, 17450, 17454, 17458, 17462, 17466, 17470, 17478,
+  17486, 17498, 17510, 17522, 17534, 17536, 17539, 17542, 17545, 17548, 17552, 17556, 17560, 17561, 17562, 17564,
+  17566, 17568, 17571, 17573, 17577, 17581, 17585, 17589, 17593, 17597, 17601, 17605, 17609, 17613, 17617, 17621,
+  17625, 17629, 17633, 17637, 17641, 17645, 17649, 17653, 17657, 17661, 17665, 17669, 17673, 17677, 17681, 17685,
+  17689, 17693, 17697, 17701, 17705, 17709, 17713, 17717, 17721, 17725, 17729, 17733, 17737, 17741, 17745, 17749,
+  17753, 17757, 17761, 17765, 17769, 17773, 17776, 17780, 17784, 17788, 17792, 17796, 17800, 17804, 17808, 17812,
+  17816, 17820, 17824, 17828, 17832, 17834, 17836, 17838, 17840, 17842, 17844, 17846, 17848, 17850, 17852, 17854,
+  17858, 17861, 17864, 17867, 17870, 17873, 17876, 17879, 17882, 17885, 17888, 17891, 17894, 17897, 17900, 17903,
+  17906, 17909, 17912, 17915, 17918, 17921, 17924, 17927, 17930, 17933, 17940, 17944, 17949, 17954, 17959, 17964,
+  17969, 17974, 17979, 17982, 17984, 17986, 17990, 17993, 17996, 17999, 18002, 18004, 18006, 18009, 18012, 18015,
+  18018, 18022, 18025, 18028, 18031, 18034, 18037, 18040, 18043, 18047, 18050, 18053, 18056, 18060, 18063, 18066,
+  18069, 18073, 18076, 18079, 18082, 18085, 18089, 18092, 18095, 18098, 18101, 18104, 18107, 18110, 18113, 18116,
+  18119, 18122, 18125, 18128, 18131, 18134, 18138, 18141, 18144, 18147, 18151, 18154, 18157, 18160, 18163, 18166,
+  18169, 18172, 18175, 18178, 18181, 18184, 18187, 18190, 18193, 18196, 18199, 18202, 18205, 18208, 18211, 18214,
+  18217, 18220, 18223, 18226, 18229, 18232, 18235, 18239, 18242, 18245, 18248, 18251, 18254, 18257, 18261, 18265,
+  18268, 18271, 18274, 18277, 18280, 18283, 18286, 18289, 18292, 18296, 18299, 18302, 18305, 18309, 18312, 18315,
+  18318, 18321, 18324, 18327, 18330, 18333, 18337, 18340, 18344, 18347, 18350, 18353, 18356, 18359, 18362, 18365,
+  18368, 18371, 18374, 18377, 18381, 18384, 18387, 18390, 18393, 18397, 18400, 18404, 18407, 18410, 18413, 18417,
+  18421, 18424, 18427, 18430, 18433, 18436, 18439, 18442, 18445, 18448, 18451, 18455, 18458, 18461, 18464, 18467,
+  18470, 18473, 18476, 18479, 18482, 18485, 18488, 18491, 18494, 18497, 18501, 18504, 18507, 18510, 18513, 18516,
+  18520, 18523, 18526, 18529, 18532, 18535, 18538, 18541, 18544, 18547, 18550, 18554, 18557, 18560, 18563, 18566,
+  18569, 18572, 18575, 18578, 18581, 18584, 18587, 18590, 18593, 18596, 18599, 18603, 18606, 18609, 18612, 18615,
+  18619, 18622, 18625, 18628, 18631, 18634, 18637, 18640, 18644, 18647, 18650, 18653, 18657, 18660, 18663, 18666,
+  18669, 18672, 18676, 18680, 18684, 18687, 18691, 18694, 18697, 18700, 18703, 18706, 18709, 18712, 18715, 18719,
+  18722, 18725, 18728, 18731, 18734, 18738, 18741, 18744, 18748, 18752, 18755, 18758, 18761, 18764, 18767, 18770,
+  18773, 18776, 18780, 18783, 18787, 18790, 18794, 18797, 18800, 18804, 18807, 18810, 18814, 18818, 18821, 18824,
+  18827, 18830, 18833, 18836, 18839, 18842, 18845, 18848, 18851, 18855, 18858, 18862, 18866, 18869, 18873, 18877,
+  18881, 18884, 18887, 18891, 18895, 18899, 18903, 18906, 18909, 18912, 18915, 18918, 18922, 18925, 18928, 18932,
+  18936, 18940, 18943, 18946, 18949, 18952, 18956, 18960, 18963, 18966, 18970, 18973, 18976, 18979, 18983, 18986,
+  18989, 18992, 18995, 18998, 19002, 19005, 19008, 19011, 19014, 19017, 19020, 19024, 19028, 19031, 19035, 19038,
+  19042, 19045, 19048, 19052, 19056, 19059, 19063, 19066, 19070, 19073, 19076, 19079, 19082, 19085, 19088, 19092,
+  19096, 19100, 19104, 19107, 19110, 19113, 19116, 19119, 19122, 19125, 19128, 19131, 19134, 19137, 19141, 19144,
+  19147, 19150, 19153, 19156, 19159, 19162, 19165, 19168, 19171, 19175, 19179, 19183, 19186, 19189, 19192, 19195,
+  19199, 19202, 19206, 19209, 19212, 19216, 19220, 19223, 19226, 19229, 19232, 19235, 19238, 19241, 19244, 19247,
+  19250, 19253, 19256, 19259, 19262, 19265, 19268, 19271, 19275, 19278, 19281, 19284, 19287, 19290, 19294, 19298,
+  19301, 19304, 19307, 19310, 19314, 19317, 19320, 19323, 19326, 19330, 19334, 19337, 19340, 19343, 19347, 19350,
+  19354, 19358, 19361, 19364, 19367, 19371, 19374, 19377, 19380, 19383, 19386, 19389, 19392, 19396, 19399, 19402,
+  19405, 19409, 19412, 19415, 19418, 19421, 19425, 19429, 19432, 19435, 19438, 19442, 19445, 19449, 19452, 19456,
+  19459, 19462, 19465, 19468, 19471, 19474, 19477, 19481, 19484, 19487, 19490, 19493, 19496, 19500, 19503, 19507,
+  19511, 19515, 19518, 19521, 19524, 19527, 19530, 19533, 19536, 19539, 19543,
+};
+
+/// The combining classes of the first and the last code point of each
+/// mapping and of the mapped code point, and whether the mapping is a
+/// decomposition, packed as `first | (last << 8) | (source << 16) | (is_decomposition << 24)`
+inline constexpr auto mapping_classes = std::array<std::uint32_t, 5114>{
+  0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 0, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 256, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 0, 256, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 0, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 256, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 256, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16828928, 16828928, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 256, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16828928, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 256, 256,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16828928, 16828928, 16836096, 0, 0, 0, 16836096, 16836096, 16828928, 16828928,
+  16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 0, 256, 256, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 0,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 0, 0, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 256, 256, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 0, 256, 0, 58880, 0, 0, 0, 58880, 0, 56320, 56320, 0, 256,
+  0, 58880, 56320, 56320, 256, 16832512, 16832512, 0, 58880, 0, 0, 0, 58880, 51712, 16832512, 16832512,
+  0, 58880, 256, 256, 0, 256, 0, 0, 0, 0, 0, 58880, 58880, 58880, 0, 0,
+  0, 0, 0, 0, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 256, 256, 16836096, 16836096, 16836096, 16836096,
+  16828928, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 0, 0, 0, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536,
+  16836096, 16836096, 0, 56320, 56320, 16836096, 16836096, 16828928, 16828928, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 256, 0, 256, 256, 256, 256, 256, 256, 256, 0, 58880, 51712, 58880,
+  0, 0, 0, 58880, 0, 58880, 256, 256, 51712, 0, 0, 56320, 51712, 256, 0, 56320,
+  51712, 51712, 0, 51712, 0, 58880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15082275, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15263462,
+  14474460, 14426144, 14474460, 14474460, 15263976, 14211288, 14474460, 14474460, 14474460, 14474460, 14474460, 13294812, 13290186, 14474460, 14474460, 14474460,
+  14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 65793, 65793, 65793, 14474460, 14474460,
+  14474460, 15132390, 15132390, 15132390, 31909606, 31909606, 31909606, 31909606, 15780554, 15132390, 14474460, 14474460, 15132390, 15132390, 15132390, 14474460,
+  14474460, 15132390, 15132390, 15132390, 14474460, 14474460, 14474460, 14474460, 15263462, 14474460, 14474460, 15132390, 15329769, 15395562, 15395562, 15329769,
+  15395562, 15395562, 15329769, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 0, 16777216,
+  0, 0, 0, 0, 0, 16777216, 0, 16836096, 16836096, 16777216, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 0, 0, 0, 0, 0, 0, 0, 0, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16836096,
+  16836096, 16836096, 0, 0, 16836096, 16836096, 16836096, 16836096, 0, 16836096, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 16836096, 0, 0, 0, 0, 0, 0, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 0, 0, 0, 16836096, 16836096, 58880, 58880, 15132390, 15132390, 15132390, 15132390, 15132390, 58880, 58880, 0,
+  0, 256, 56320, 56320, 56320, 56320, 56320, 56320, 256, 256, 56320, 56320, 56320, 56320, 56320, 56320,
+  56320, 0, 51712, 51712, 16836096, 16836096, 56320, 56320, 56320, 56320, 0, 0, 56320, 56320, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 0, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14474460,
+  15132390, 15132390, 15132390, 15132390, 14474460, 15132390, 15132390, 15132390, 14606046, 14474460, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460,
+  14474974, 14474460, 14474460, 14474460, 15132390, 14474460, 15132390, 15132390, 14605532, 15001318, 657930, 723723, 789516, 855309, 974044, 986895,
+  1052688, 1118481, 1184274, 1304294, 1315860, 1381653, 1447446, 1513239, 1631974, 1697510, 1184274, 0, 0, 0, 0, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 2025190, 2090726, 2105376, 16836096, 16836096, 16836096, 16833536, 16836096, 58880,
+  58880, 58880, 0, 1828582, 1842204, 1907997, 2171169, 2287334, 15132390, 14474460, 15132390, 0, 0, 0, 0, 2302755,
+  0, 56320, 0, 0, 0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880,
+  58880, 0, 0, 58880, 58880, 58880, 58880, 16836096, 16836096, 0, 58880, 58880, 8960, 58880, 58880, 58880,
+  0, 16836096, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 15132390, 15132390, 14474460,
+  15132390, 14474460, 58880, 58880, 0, 0, 0, 0, 0, 56320, 56320, 58880, 2368548, 15132390, 14474460, 15132390,
+  15132390, 14474460, 15132390, 15132390, 14474460, 14474460, 14474460, 15132390, 14474460, 14474460, 15132390, 14474460, 15132390, 15132390, 14474460, 15132390,
+  14474460, 14474460, 15132390, 15132390, 58880, 0, 0, 58880, 58880, 58880, 58880, 58880, 15132390, 15132390, 15132390, 15132390,
+  14474460, 0, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460, 14474460, 15132390, 14474460, 14474460, 14474460, 15132390,
+  15132390, 15132390, 15132390, 58880, 58880, 58880, 58880, 56320, 56320, 0, 0, 58880, 58880, 58880, 58880, 58880,
+  15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460, 14474460, 14474460, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 15132390, 15080476, 14474460, 15132390, 14474460, 15132390, 14474460,
+  15132390, 15132390, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 59110, 59110, 59110, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 16779008, 16779008, 16779008, 515292, 592137, 15132390, 16779008, 16779008, 16779008, 16779008, 16779008,
+  16779008, 16779008, 16779008, 0, 0, 16777216, 16777216, 592137, 16779008, 16779008, 16779008, 0, 0, 15132390, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 16779008, 16779008, 0, 16779008, 16779008, 16779008, 16779008, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16777216, 16777216,
+  16777216, 592137, 16779008, 16779008, 59110, 0, 16777216, 0, 0, 0, 16777216, 16777216, 16777216, 648934, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21504, 0, 5376,
+  56320, 5376, 56320, 0, 56320, 0, 460551, 0, 0, 16800512, 592137, 5526612, 5987163, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 460551, 16777216, 16777216, 16777216, 16777216, 16777216, 592137,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 592137,
+  592137, 0, 0, 0, 16777216, 16777216, 16777216, 592137, 0, 0, 0, 2304, 0, 0, 0, 2304,
+  0, 592137, 16779520, 16777216, 16779520, 16777216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 230, 6776679, 6776679, 592137, 0, 0, 7039851, 7039851, 7039851, 7039851, 0, 0, 0, 0, 0,
+  0, 0, 230, 7759719, 7759719, 592137, 8022891, 8022891, 8022891, 8022891, 0, 0, 0, 0, 0, 0,
+  0, 14474460, 14474460, 0, 0, 0, 14474460, 14211288, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 0, 8487297,
+  8553090, 16810625, 8684676, 16811137, 16810496, 33280, 16810496, 33280, 8553090, 8553090, 8553090, 8553090, 8553090, 16810625, 15132390, 15132390,
+  592137, 15132390, 15132390, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 14474460, 0, 0, 0, 0, 0, 0,
+  16777216, 0, 2304, 460551, 592137, 592137, 0, 0, 0, 0, 0, 0, 0, 14474460, 58880, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15132390, 15132390, 15132390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  58880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58880, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58880, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 592137, 592137, 592137, 0, 0, 0, 0, 0, 0, 27499, 592137,
+  0, 0, 0, 0, 15132390, 0, 0, 15000804, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14606046, 15132390, 14474460, 0, 0, 15132390, 14474460, 592137, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 0, 0, 0, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460, 14469834,
+  14474460, 14474460, 14474460, 15132390, 15132390, 14474460, 14474460, 14474460, 15132390, 15132390, 14474460, 14474460, 15132390, 15132390, 15132390, 15132390,
+  15132390, 14474460, 15132390, 15132390, 15132390, 15132390, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 460551, 16777216, 16777216, 16777216,
+  16777216, 16777216, 592137, 0, 0, 0, 0, 0, 15132390, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 592137, 592137, 460551, 592137, 592137, 460551, 0, 0, 15132390, 65793, 14474460, 14474460, 15132390, 14474460, 15132390,
+  65793, 65793, 65793, 65793, 65793, 65793, 65793, 15132390, 15132390, 15132390, 0, 0, 0, 0, 0, 0,
+  0, 0, 256, 256, 256, 256, 256, 256, 256, 256, 0, 256, 256, 256, 0, 0,
+  0, 0, 0, 15132390, 15132390, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 15132390, 15132390,
+  15395562, 14079702, 14474460, 13290186, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15263976, 15000804, 15000804, 14474460, 14342874, 15132390, 15329769,
+  14474460, 15132390, 14474460, 16833536, 16833536, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16833536,
+  16833536, 16833536, 16833536, 16828928, 16828928, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16828928, 16828928, 16833536, 16833536, 16833536,
+  16833536, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16833536, 16833536, 16833536,
+  16833536, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16836096,
+  16836096, 16833536, 16833536, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536,
+  16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16836096, 58880, 16836096, 16833536,
+  16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16833536, 16833536, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16833536,
+  16833536, 16836096, 16836096, 16833536, 16833536, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656,
+  16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656,
+  16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656, 16838656,
+  16838656, 16838656, 16838656, 16838656, 16836096, 16836096, 16838656, 16838656, 16838656, 16836096, 16838656, 16836096, 16836096, 16836096, 16838656, 16777216,
+  16836096, 16838656, 16838656, 16838656, 16836096, 16838656, 16836096, 16836096, 16838656, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096, 16836096,
+  16836096, 16836096, 16836096, 16777216, 16838656, 16838656, 16838656, 16836096, 16838656, 16836096, 16836096, 16838656, 16777216, 16777216, 16777216, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 0, 256, 56320,
+  256, 0, 0, 15132390, 15132390, 65793, 65793, 15132390, 15132390, 15132390, 15132390, 65793, 65793, 65793, 15132390, 15132390,
+  65793, 65793, 15132390, 14474460, 15132390, 65793, 65793, 14474460, 14474460, 14474460, 14474460, 15132390, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 16777216, 0, 16777216, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 16777472, 16777472, 16777472, 0, 0, 0, 0, 16777472, 16777472, 16777472, 0, 16777472,
+  16777472, 16777472, 58880, 0, 0, 16777472, 16777472, 0, 0, 0, 0, 0, 58880, 16777472, 16777472, 16777472,
+  16777472, 58880, 58880, 58880, 58880, 58880, 58880, 16777472, 16777472, 0, 0, 0, 16777472, 16777472, 16777472, 16777472,
+  16777472, 16777472, 16777472, 16777472, 16777472, 16777472, 16777472, 0, 0, 16777472, 16777472, 16777472, 16777472, 0, 0, 0,
+  16777472, 16777472, 16777472, 16777472, 0, 0, 0, 0, 0, 16777472, 16777472, 16777472, 16777472, 16777472, 16777472, 16777472,
+  16777472, 0, 0, 0, 16777216, 16777216, 0, 56320, 56320, 56320, 0, 58880, 58880, 58880, 58880, 58880,
+  0, 256, 0, 56320, 56320, 56320, 56320, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 55296, 55296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 58880, 0, 0, 0, 0, 0, 0, 58880, 58880,
+  58880, 56320, 56320, 0, 58880, 56320, 58880, 0, 0, 0, 58880, 58880, 0, 0, 0, 0,
+  0, 0, 0, 16777472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15132390, 15132390, 15132390, 0, 592137, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  58880, 56320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14342874, 15000804, 15263462,
+  14605532, 14737632, 14737632, 0, 0, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264,
+  16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 526344,
+  583398, 0, 0, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264,
+  16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264, 0, 16779264, 16779264, 16779264, 16779264, 16779264, 16779264,
+  16779264, 16779264, 16779264, 16779264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 0, 15132390, 15132390,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  56320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 592137, 592137, 0, 592137, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  14474460, 14474460, 14474460, 592137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 460551, 592137, 0, 0, 0, 15132390, 15132390,
+  15132390, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 592137, 256, 256, 256, 0, 0, 0, 0, 0,
+  55296, 0, 0, 0, 0, 0, 592137, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 16780800, 1710618, 16781568, 0, 0, 0, 0, 0, 0, 0, 16783360, 16783616, 16783360, 16783616,
+  16781568, 16781824, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592,
+  16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782592, 16782080, 16783104, 16783104, 16783104, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58880, 58880, 0, 0, 0, 0,
+  58880, 58880, 8960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 8960, 8960, 8960, 8448, 8448, 8448, 8448, 8448, 8960, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 8960, 0, 0, 0, 0, 0, 8448, 8448, 8448, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58880, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 15132390, 15132390, 0, 0, 0, 0, 0,
+  0, 0, 0, 58880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 58880, 0, 56320, 0, 0, 0, 0, 58880, 256,
+  256, 256, 256, 0, 14474460, 0, 0, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14474460, 15132390, 15132390, 65793, 592137, 0, 15132390, 14474460,
+  0, 0, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460, 15132390, 15132390, 15132390, 14474460, 15132390, 14474460,
+  14474460, 14474460, 14474460, 15132390, 14474460, 15132390, 14474460, 592137, 592137, 592137, 16779008, 16779008, 16779008, 592137, 460551, 15132390,
+  15132390, 15132390, 16777216, 16777216, 592137, 592137, 460551, 592137, 0, 0, 0, 0, 592137, 460551, 460551, 592137,
+  460551, 460551, 16777216, 16777216, 592137, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 0, 0, 0, 0, 0, 0, 592137, 460551, 0, 15132390, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 16777216, 16777216, 0, 16777216, 0, 58880, 0, 0, 0, 16777216, 16777216, 592137, 460551, 0,
+  0, 0, 0, 0, 592137, 0, 592137, 460551, 592137, 592137, 460551, 0, 16777216, 592137, 592137, 460551,
+  592137, 592137, 592137, 592137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 592137, 0, 0, 460551, 592137, 592137, 592137, 0, 65793, 65793, 65793, 65793, 65793, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 0, 394758, 394758, 65793, 16832512, 16832512, 16832512, 16832512, 16832512, 16832512, 16832512,
+  14211288, 14211288, 65793, 65793, 65793, 14811136, 14211288, 14211288, 14211288, 14211288, 14211288, 14474460, 14474460, 14474460, 14474460, 14474460,
+  14474460, 14474460, 14474460, 15132390, 15132390, 15132390, 15132390, 15132390, 14474460, 14474460, 15132390, 15132390, 15132390, 15132390, 16832512, 16832512,
+  16832512, 16832512, 16832512, 16832512, 0, 0, 0, 0, 0, 15132390, 15132390, 15132390, 0, 0, 0, 0,
+  0, 0, 0, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 15132390, 15132390, 0, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 14474460, 15132390, 15132390, 15132390,
+  15132390, 15132390, 15132390, 460551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 58880, 0, 0, 0, 0, 0, 0, 0, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+  16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216, 16777216,
+};
+
+/// The UTF-8 encoded mappings
+inline constexpr auto mappings = std::array<std::uint8_t, 19543>{
+  39, 39, 194, 186, 47, 226, 130, 128, 79, 108, 39, 114, 110, 32, 99, 204,
+  184, 89, 204, 181, 203, 137, 206, 188, 44, 65, 204, 128, 65, 204, 129, 65,
+  204, 130, 65, 204, 131, 65, 204, 136, 65, 204, 138, 65, 69, 67, 204, 167,
+  69, 204, 128, 69, 204, 129, 69, 204, 130, 69, 204, 136, 73, 204, 128, 73,
+  204, 129, 73, 204, 130, 73, 204, 136, 68, 204, 181, 78, 204, 131, 79, 204,
+  128, 79, 204, 129, 79, 204, 130, 79, 204, 131, 79, 204, 136, 120, 79, 204,
+  184, 85, 204, 128, 85, 204, 129, 85, 204, 130, 85, 204, 136, 89, 204, 129,
+  97, 204, 128, 97, 204, 129, 97, 204, 130, 97, 204, 131, 97, 204, 136, 97,
+  204, 138, 97, 101, 99, 204, 167, 101, 204, 128, 101, 204, 129, 101, 204, 130,
+  101, 204, 136, 105, 204, 128, 105, 204, 129, 105, 204, 130, 105, 204, 136, 226,
+  136, 130, 204, 181, 110, 204, 131, 111, 204, 128, 111, 204, 129, 111, 204, 130,
+  111, 204, 131, 111, 204, 136, 111, 204, 184, 117, 204, 128, 117, 204, 129, 117,
+  204, 130, 117, 204, 136, 121, 204, 129, 121, 204, 136, 65, 204, 132, 97, 204,
+  132, 65, 204, 134, 97, 204, 134, 65, 204, 168, 97, 204, 168, 67, 204, 129,
+  99, 204, 129, 67, 204, 130, 99, 204, 130, 67, 204, 135, 99, 204, 135, 67,
+  204, 140, 99, 204, 140, 68, 204, 140, 100, 204, 140, 100, 204, 181, 69, 204,
+  132, 101, 204, 132, 69, 204, 134, 101, 204, 134, 69, 204, 135, 101, 204, 135,
+  69, 204, 168, 101, 204, 168, 69, 204, 140, 101, 204, 140, 71, 204, 130, 103,
+  204, 130, 71, 204, 134, 103, 204, 134, 71, 204, 135, 103, 204, 135, 71, 204,
+  167, 103, 204, 167, 72, 204, 130, 104, 204, 130, 72, 204, 181, 104, 204, 181,
+  73, 204, 131, 105, 204, 131, 73, 204, 132, 105, 204, 132, 73, 204, 134, 105,
+  204, 134, 73, 204, 168, 105, 204, 168, 73, 204, 135, 105, 108, 74, 105, 106,
+  74, 204, 130, 106, 204, 130, 75, 204, 167, 107, 204, 167, 76, 204, 129, 108,
+  204, 129, 76, 204, 167, 108, 204, 167, 76, 204, 140, 108, 204, 140, 108, 194,
+  183, 76, 204, 184, 108, 204, 184, 78, 204, 129, 110, 204, 129, 78, 204, 167,
+  110, 204, 167, 78, 204, 140, 110, 204, 140, 39, 110, 79, 204, 132, 111, 204,
+  132, 79, 204, 134, 111, 204, 134, 79, 204, 139, 111, 204, 139, 79, 69, 111,
+  101, 82, 204, 129, 114, 204, 129, 82, 204, 167, 114, 204, 167, 82, 204, 140,
+  114, 204, 140, 83, 204, 129, 115, 204, 129, 83, 204, 130, 115, 204, 130, 83,
+  204, 167, 115, 204, 167, 83, 204, 140, 115, 204, 140, 84, 204, 167, 116, 204,
+  167, 84, 204, 140, 116, 204, 140, 84, 204, 181, 116, 204, 181, 85, 204, 131,
+  117, 204, 131, 85, 204, 132, 117, 204, 132, 85, 204, 134, 117, 204, 134, 85,
+  204, 138, 117, 204, 138, 85, 204, 139, 117, 204, 139, 85, 204, 168, 117, 204,
+  168, 87, 204, 130, 119, 204, 130, 89, 204, 130, 121, 204, 130, 89, 204, 136,
+  90, 204, 129, 122, 204, 129, 90, 204, 135, 122, 204, 135, 90, 204, 140, 122,
+  204, 140, 102, 98, 204, 181, 39, 66, 98, 204, 132, 98, 67, 39, 39, 68,
+  100, 204, 132, 103, 70, 204, 166, 102, 204, 166, 71, 39, 108, 204, 181, 75,
+  39, 107, 204, 148, 78, 204, 166, 110, 204, 169, 79, 204, 181, 79, 204, 155,
+  111, 204, 155, 39, 80, 112, 204, 148, 82, 50, 39, 84, 116, 204, 148, 84,
+  204, 168, 85, 204, 155, 117, 204, 155, 39, 89, 121, 204, 148, 90, 204, 181,
+  122, 204, 181, 51, 50, 204, 181, 53, 115, 195, 190, 108, 108, 33, 68, 90,
+  204, 140, 68, 122, 204, 140, 100, 122, 204, 140, 76, 74, 76, 106, 108, 106,
+  78, 74, 78, 106, 110, 106, 65, 204, 140, 97, 204, 140, 73, 204, 140, 105,
+  204, 140, 79, 204, 140, 111, 204, 140, 85, 204, 140, 117, 204, 140, 85, 204,
+  136, 204, 132, 117, 204, 136, 204, 132, 85, 204, 136, 204, 129, 117, 204, 136,
+  204, 129, 85, 204, 136, 204, 140, 117, 204, 136, 204, 140, 85, 204, 136, 204,
+  128, 117, 204, 136, 204, 128, 65, 204, 136, 204, 132, 97, 204, 136, 204, 132,
+  65, 204, 135, 204, 132, 97, 204, 135, 204, 132, 195, 134, 204, 132, 195, 166,
+  204, 132, 71, 204, 181, 103, 204, 181, 71, 204, 140, 103, 204, 140, 75, 204,
+  140, 107, 204, 140, 79, 204, 168, 111, 204, 168, 79, 204, 168, 204, 132, 111,
+  204, 168, 204, 132, 198, 183, 204, 140, 202, 146, 204, 140, 106, 204, 140, 68,
+  90, 68, 122, 100, 122, 71, 204, 129, 103, 204, 129, 78, 204, 128, 110, 204,
+  128, 65, 204, 138, 204, 129, 97, 204, 138, 204, 129, 195, 134, 204, 129, 195,
+  166, 204, 129, 195, 152, 204, 129, 195, 184, 204, 129, 65, 204, 143, 97, 204,
+  143, 65, 204, 145, 97, 204, 145, 69, 204, 143, 101, 204, 143, 69, 204, 145,
+  101, 204, 145, 73, 204, 143, 105, 204, 143, 73, 204, 145, 105, 204, 145, 79,
+  204, 143, 111, 204, 143, 79, 204, 145, 111, 204, 145, 82, 204, 143, 114, 204,
+  143, 82, 204, 145, 114, 204, 145, 85, 204, 143, 117, 204, 143, 85, 204, 145,
+  117, 204, 145, 83, 204, 166, 115, 204, 166, 84, 204, 166, 116, 204, 166, 72,
+  204, 140, 104, 204, 140, 56, 90, 204, 166, 122, 204, 166, 65, 204, 135, 97,
+  204, 135, 69, 204, 167, 101, 204, 167, 79, 204, 136, 204, 132, 111, 204, 136,
+  204, 132, 79, 204, 131, 204, 132, 111, 204, 131, 204, 132, 79, 204, 135, 111,
+  204, 135, 79, 204, 135, 204, 132, 111, 204, 135, 204, 132, 89, 204, 132, 121,
+  204, 132, 84, 204, 184, 63, 85, 204, 181, 69, 204, 184, 101, 204, 184, 74,
+  204, 181, 106, 204, 181, 114, 204, 181, 121, 204, 181, 97, 98, 204, 148, 100,
+  204, 168, 100, 204, 148, 199, 157, 199, 157, 203, 158, 234, 158, 147, 103, 204,
+  148, 121, 104, 204, 148, 105, 204, 181, 108, 204, 180, 108, 204, 168, 108, 200,
+  157, 119, 114, 110, 204, 166, 110, 204, 168, 111, 204, 181, 111, 225, 180, 135,
+  114, 204, 169, 114, 204, 168, 115, 204, 168, 117, 122, 204, 168, 200, 157, 113,
+  204, 148, 100, 200, 157, 100, 202, 145, 116, 115, 116, 202, 131, 116, 201, 149,
+  102, 197, 139, 108, 115, 108, 122, 225, 163, 180, 213, 153, 60, 62, 94, 58,
+  45, 203, 135, 224, 165, 177, 194, 176, 126, 225, 163, 179, 225, 163, 181, 203,
+  129, 203, 170, 204, 128, 204, 129, 204, 130, 204, 131, 204, 132, 204, 134, 204,
+  135, 204, 136, 204, 137, 204, 138, 204, 139, 217, 176, 204, 142, 204, 143, 204,
+  134, 204, 135, 204, 146, 204, 147, 204, 148, 204, 147, 204, 150, 217, 144, 204,
+  152, 204, 153, 204, 154, 204, 155, 204, 156, 204, 157, 204, 158, 204, 159, 204,
+  177, 204, 166, 204, 168, 204, 163, 204, 164, 204, 165, 204, 166, 204, 169, 204,
+  170, 204, 171, 204, 172, 204, 173, 204, 174, 204, 175, 204, 176, 204, 178, 204,
+  179, 204, 180, 204, 181, 204, 184, 204, 186, 204, 187, 204, 188, 204, 189, 204,
+  190, 204, 191, 204, 128, 204, 129, 204, 147, 204, 136, 204, 129, 204, 168, 205,
+  134, 205, 136, 205, 137, 205, 138, 205, 139, 205, 140, 205, 141, 205, 142, 205,
+  144, 205, 145, 205, 146, 205, 147, 205, 148, 205, 149, 205, 150, 204, 135, 205,
+  153, 205, 154, 205, 155, 205, 156, 205, 157, 205, 158, 205, 159, 205, 160, 205,
+  161, 205, 162, 205, 163, 205, 164, 205, 165, 205, 167, 205, 168, 205, 169, 205,
+  170, 205, 171, 205, 172, 205, 173, 205, 175, 226, 177, 181, 202, 185, 203, 143,
+  208, 152, 225, 180, 142, 201, 148, 234, 156, 191, 59, 74, 194, 168, 204, 129,
+  206, 145, 204, 129, 194, 183, 206, 149, 204, 129, 206, 151, 204, 129, 206, 153,
+  204, 129, 206, 159, 204, 129, 206, 165, 204, 129, 206, 169, 204, 129, 206, 185,
+  204, 136, 204, 129, 65, 66, 69, 90, 72, 75, 201, 133, 77, 78, 80, 198,
+  169, 84, 89, 88, 206, 153, 204, 136, 206, 165, 204, 136, 206, 177, 204, 129,
+  206, 181, 204, 129, 206, 183, 204, 129, 206, 185, 204, 129, 207, 133, 204, 136,
+  204, 129, 195, 159, 225, 186, 159, 196, 184, 118, 111, 112, 225, 180, 155, 201,
+  184, 206, 185, 204, 136, 207, 133, 204, 136, 206, 191, 204, 129, 207, 133, 204,
+  129, 207, 137, 204, 129, 207, 146, 204, 129, 207, 146, 204, 136, 207, 128, 207,
+  130, 70, 198, 168, 99, 106, 195, 158, 67, 198, 134, 234, 156, 190, 208, 149,
+  204, 128, 208, 149, 204, 136, 208, 147, 204, 129, 234, 158, 146, 83, 208, 134,
+  204, 136, 208, 154, 204, 129, 208, 152, 204, 128, 208, 163, 204, 134, 206, 147,
+  208, 152, 204, 134, 206, 160, 206, 166, 98, 108, 108, 79, 54, 202, 153, 114,
+  101, 201, 156, 208, 184, 204, 134, 202, 141, 202, 156, 203, 137, 98, 198, 133,
+  105, 198, 133, 225, 180, 153, 208, 181, 204, 128, 208, 181, 204, 136, 208, 179,
+  204, 129, 209, 150, 204, 136, 208, 186, 204, 129, 208, 184, 204, 128, 209, 131,
+  204, 134, 206, 168, 207, 136, 86, 209, 180, 204, 143, 209, 181, 204, 143, 209,
+  160, 210, 134, 210, 135, 119, 210, 134, 210, 135, 210, 131, 210, 132, 210, 133,
+  210, 134, 210, 135, 208, 152, 204, 166, 204, 128, 208, 184, 204, 166, 204, 134,
+  206, 147, 39, 114, 39, 206, 147, 204, 181, 208, 150, 204, 169, 208, 182, 204,
+  169, 51, 204, 166, 201, 156, 204, 166, 75, 204, 169, 196, 184, 204, 169, 75,
+  204, 181, 196, 184, 204, 181, 72, 204, 169, 202, 156, 204, 169, 67, 204, 166,
+  99, 204, 166, 84, 204, 169, 225, 180, 155, 204, 169, 88, 204, 169, 104, 210,
+  188, 204, 168, 101, 204, 168, 208, 150, 204, 134, 208, 182, 204, 134, 201, 133,
+  204, 166, 208, 187, 204, 166, 72, 204, 166, 202, 156, 204, 166, 210, 182, 210,
+  183, 77, 204, 166, 202, 141, 204, 166, 208, 144, 204, 134, 208, 176, 204, 134,
+  208, 144, 204, 136, 208, 176, 204, 136, 208, 149, 204, 134, 208, 181, 204, 134,
+  198, 143, 211, 152, 204, 136, 211, 153, 204, 136, 208, 150, 204, 136, 208, 182,
+  204, 136, 208, 151, 204, 136, 208, 183, 204, 136, 208, 152, 204, 132, 208, 184,
+  204, 132, 208, 152, 204, 136, 208, 184, 204, 136, 208, 158, 204, 136, 208, 190,
+  204, 136, 211, 168, 204, 136, 211, 169, 204, 136, 208, 173, 204, 136, 209, 141,
+  204, 136, 208, 163, 204, 132, 209, 131, 204, 132, 208, 163, 204, 136, 209, 131,
+  204, 136, 208, 163, 204, 139, 209, 131, 204, 139, 208, 167, 204, 136, 209, 135,
+  204, 136, 208, 171, 204, 136, 209, 139, 204, 136, 100, 199, 182, 71, 201, 162,
+  198, 144, 113, 87, 225, 138, 174, 225, 136, 134, 225, 140, 163, 225, 137, 161,
+  85, 200, 183, 110, 201, 176, 213, 165, 214, 130, 214, 145, 214, 146, 214, 147,
+  214, 148, 214, 149, 214, 150, 214, 151, 214, 152, 214, 153, 214, 154, 214, 155,
+  214, 158, 214, 159, 214, 160, 214, 161, 214, 162, 214, 163, 214, 154, 214, 165,
+  214, 166, 214, 167, 214, 169, 214, 170, 214, 171, 214, 172, 214, 150, 214, 152,
+  214, 176, 214, 177, 214, 178, 214, 179, 204, 163, 214, 181, 214, 182, 214, 183,
+  214, 184, 204, 135, 214, 187, 214, 188, 214, 189, 214, 191, 204, 135, 204, 135,
+  215, 135, 108, 39, 194, 186, 47, 226, 130, 128, 226, 130, 128, 194, 186, 47,
+  226, 130, 128, 226, 130, 128, 226, 130, 128, 216, 185, 216, 144, 216, 145, 216,
+  146, 216, 147, 216, 148, 216, 149, 216, 150, 216, 151, 204, 129, 204, 147, 217,
+  144, 216, 167, 217, 147, 216, 167, 217, 148, 217, 136, 217, 148, 216, 167, 217,
+  149, 217, 138, 217, 148, 217, 137, 219, 155, 216, 179, 219, 155, 217, 137, 204,
+  130, 217, 137, 204, 139, 217, 140, 217, 141, 217, 145, 204, 138, 217, 148, 217,
+  149, 217, 158, 46, 216, 140, 42, 218, 161, 217, 176, 108, 217, 180, 108, 217,
+  149, 217, 136, 217, 180, 217, 136, 204, 147, 217, 180, 217, 137, 217, 180, 217,
+  137, 216, 149, 216, 173, 217, 148, 216, 173, 219, 155, 216, 175, 216, 149, 218,
+  138, 216, 149, 216, 175, 219, 155, 216, 177, 216, 149, 216, 177, 204, 134, 216,
+  177, 219, 155, 216, 181, 219, 155, 216, 183, 219, 155, 218, 161, 219, 155, 217,
+  129, 217, 131, 217, 131, 219, 155, 218, 175, 219, 155, 217, 132, 204, 134, 217,
+  132, 219, 155, 219, 149, 217, 148, 219, 129, 217, 148, 216, 169, 217, 136, 204,
+  134, 217, 136, 204, 147, 217, 136, 217, 176, 217, 136, 204, 130, 217, 136, 219,
+  155, 217, 137, 204, 134, 217, 187, 219, 146, 217, 148, 219, 150, 219, 151, 219,
+  152, 219, 153, 219, 154, 219, 155, 219, 156, 219, 160, 219, 161, 219, 162, 219,
+  163, 219, 164, 219, 167, 219, 170, 219, 171, 219, 173, 216, 175, 204, 130, 216,
+  177, 204, 130, 217, 162, 217, 163, 217, 164, 217, 166, 217, 169, 216, 161, 205,
+  136, 217, 133, 205, 136, 111, 204, 130, 220, 145, 220, 176, 220, 177, 220, 178,
+  220, 179, 220, 180, 220, 181, 220, 182, 220, 183, 220, 184, 220, 185, 220, 186,
+  220, 187, 220, 188, 220, 189, 220, 190, 220, 191, 221, 131, 221, 132, 221, 133,
+  221, 134, 221, 136, 221, 137, 221, 138, 216, 168, 219, 155, 218, 172, 221, 148,
+  217, 134, 216, 149, 217, 134, 204, 134, 216, 177, 217, 148, 218, 151, 216, 149,
+  216, 179, 204, 130, 223, 172, 223, 175, 223, 176, 223, 177, 223, 178, 95, 223,
+  189, 224, 160, 150, 224, 160, 151, 224, 160, 152, 224, 160, 153, 224, 160, 155,
+  224, 160, 156, 224, 160, 157, 224, 160, 158, 224, 160, 159, 224, 160, 160, 224,
+  160, 161, 224, 160, 162, 224, 160, 163, 224, 160, 165, 224, 160, 166, 224, 160,
+  167, 224, 160, 169, 224, 160, 170, 224, 160, 171, 224, 160, 172, 224, 160, 173,
+  224, 161, 153, 224, 161, 154, 224, 161, 155, 224, 162, 152, 224, 162, 153, 224,
+  162, 154, 224, 162, 155, 224, 162, 156, 224, 162, 157, 224, 162, 158, 224, 162,
+  159, 216, 168, 217, 148, 218, 162, 219, 155, 217, 133, 219, 155, 217, 137, 217,
+  148, 216, 175, 204, 164, 204, 163, 216, 181, 204, 164, 204, 163, 218, 175, 217,
+  136, 216, 178, 204, 130, 216, 168, 219, 162, 217, 137, 219, 155, 219, 162, 216,
+  177, 204, 134, 204, 135, 217, 137, 204, 134, 204, 135, 224, 163, 138, 224, 163,
+  139, 224, 163, 140, 224, 163, 141, 224, 163, 142, 224, 163, 143, 224, 163, 144,
+  224, 163, 145, 224, 163, 146, 224, 163, 147, 224, 163, 148, 224, 163, 149, 224,
+  163, 150, 224, 163, 151, 224, 163, 152, 224, 163, 153, 224, 163, 154, 224, 163,
+  155, 224, 163, 156, 224, 163, 157, 224, 163, 158, 224, 163, 159, 224, 163, 160,
+  224, 163, 161, 224, 163, 163, 224, 163, 164, 217, 140, 224, 163, 166, 224, 163,
+  167, 224, 163, 169, 224, 163, 172, 224, 163, 175, 224, 163, 180, 224, 163, 181,
+  224, 163, 182, 224, 163, 183, 224, 163, 187, 224, 163, 188, 224, 163, 189, 224,
+  163, 190, 205, 146, 204, 134, 204, 135, 204, 135, 224, 164, 133, 224, 165, 134,
+  224, 164, 133, 224, 164, 190, 224, 164, 176, 224, 165, 141, 224, 164, 135, 224,
+  164, 143, 224, 165, 133, 224, 164, 143, 224, 165, 134, 224, 164, 143, 224, 165,
+  135, 224, 164, 133, 224, 165, 137, 224, 164, 133, 224, 164, 190, 224, 165, 134,
+  224, 164, 133, 224, 164, 190, 224, 165, 135, 224, 164, 133, 224, 164, 190, 224,
+  165, 136, 224, 164, 168, 224, 164, 188, 224, 164, 176, 224, 164, 188, 224, 164,
+  179, 224, 164, 188, 204, 163, 224, 165, 141, 224, 165, 145, 224, 164, 149, 224,
+  164, 188, 224, 164, 150, 224, 164, 188, 224, 164, 151, 224, 164, 188, 224, 164,
+  156, 224, 164, 188, 224, 164, 161, 224, 164, 188, 224, 164, 162, 224, 164, 188,
+  224, 164, 171, 224, 164, 188, 224, 164, 175, 224, 164, 188, 224, 165, 164, 224,
+  165, 164, 224, 166, 133, 224, 166, 190, 224, 167, 135, 224, 166, 190, 224, 167,
+  135, 224, 167, 151, 224, 167, 141, 224, 166, 161, 224, 166, 188, 224, 166, 162,
+  224, 166, 188, 224, 166, 175, 224, 166, 188, 224, 166, 139, 224, 167, 131, 57,
+  224, 167, 190, 224, 166, 131, 224, 168, 133, 224, 168, 190, 224, 169, 178, 224,
+  168, 191, 224, 169, 178, 224, 169, 128, 224, 169, 179, 224, 169, 129, 224, 169,
+  179, 224, 169, 130, 224, 169, 178, 224, 169, 135, 224, 168, 133, 224, 169, 136,
+  224, 168, 133, 224, 169, 140, 224, 168, 178, 224, 168, 188, 224, 168, 184, 224,
+  168, 188, 224, 165, 134, 224, 168, 150, 224, 168, 188, 224, 168, 151, 224, 168,
+  188, 224, 168, 156, 224, 168, 188, 224, 168, 171, 224, 168, 188, 224, 170, 133,
+  224, 170, 190, 224, 170, 133, 224, 171, 133, 224, 170, 133, 224, 171, 135, 224,
+  170, 133, 224, 171, 136, 224, 170, 133, 224, 170, 190, 224, 171, 133, 224, 170,
+  133, 224, 170, 190, 224, 171, 135, 224, 170, 133, 224, 170, 190, 224, 171, 136,
+  224, 164, 189, 224, 165, 129, 224, 165, 130, 224, 165, 168, 224, 165, 169, 224,
+  165, 170, 224, 165, 174, 224, 165, 176, 224, 172, 133, 224, 172, 190, 224, 173,
+  135, 224, 173, 150, 224, 173, 135, 224, 172, 190, 224, 173, 135, 224, 173, 151,
+  224, 173, 141, 224, 172, 161, 224, 172, 188, 224, 172, 162, 224, 172, 188, 204,
+  138, 224, 174, 137, 224, 174, 179, 224, 174, 146, 224, 175, 151, 224, 174, 144,
+  224, 174, 136, 224, 174, 169, 224, 175, 134, 224, 174, 190, 224, 175, 135, 224,
+  174, 190, 224, 175, 134, 224, 175, 151, 204, 135, 224, 174, 179, 224, 174, 149,
+  224, 174, 137, 224, 174, 154, 224, 174, 136, 224, 175, 129, 224, 174, 154, 224,
+  175, 129, 224, 174, 142, 224, 174, 133, 224, 174, 175, 224, 174, 154, 224, 175,
+  130, 224, 174, 174, 224, 175, 128, 224, 175, 179, 224, 174, 142, 224, 174, 181,
+  224, 174, 183, 224, 174, 168, 224, 175, 128, 224, 176, 146, 224, 177, 149, 224,
+  176, 146, 224, 177, 140, 224, 176, 176, 214, 188, 224, 176, 161, 204, 163, 224,
+  176, 167, 214, 188, 224, 176, 172, 204, 163, 224, 176, 181, 224, 177, 129, 224,
+  176, 181, 204, 163, 224, 176, 181, 224, 176, 190, 224, 176, 188, 224, 177, 129,
+  224, 176, 190, 224, 177, 131, 224, 176, 190, 224, 177, 134, 224, 177, 150, 224,
+  177, 141, 224, 177, 149, 224, 177, 150, 224, 176, 139, 224, 176, 190, 224, 176,
+  140, 224, 176, 190, 224, 176, 133, 224, 176, 134, 224, 176, 135, 224, 176, 146,
+  224, 176, 156, 224, 176, 158, 224, 176, 163, 224, 176, 175, 224, 176, 177, 224,
+  176, 178, 224, 178, 188, 224, 178, 191, 224, 179, 149, 224, 179, 134, 224, 179,
+  149, 224, 179, 134, 224, 179, 150, 224, 179, 134, 224, 179, 130, 224, 179, 134,
+  224, 179, 130, 224, 179, 149, 224, 179, 141, 224, 178, 140, 224, 178, 190, 224,
+  177, 167, 224, 177, 168, 224, 177, 175, 224, 180, 135, 224, 181, 151, 224, 174,
+  137, 224, 181, 151, 224, 180, 168, 224, 181, 129, 224, 180, 142, 224, 181, 134,
+  224, 180, 146, 224, 180, 190, 224, 180, 146, 224, 181, 151, 224, 174, 163, 224,
+  180, 176, 224, 174, 180, 224, 174, 182, 224, 174, 159, 224, 174, 191, 224, 180,
+  187, 224, 180, 188, 224, 174, 191, 224, 181, 129, 224, 181, 134, 224, 181, 134,
+  224, 181, 134, 224, 180, 190, 224, 181, 135, 224, 180, 190, 224, 181, 134, 224,
+  181, 151, 224, 181, 141, 224, 180, 168, 224, 181, 141, 224, 180, 174, 111, 224,
+  180, 176, 111, 224, 180, 158, 224, 180, 176, 224, 181, 141, 224, 180, 166, 224,
+  181, 141, 224, 180, 176, 224, 180, 168, 224, 181, 141, 224, 180, 168, 224, 180,
+  181, 224, 181, 141, 224, 180, 176, 224, 180, 168, 224, 181, 141, 224, 180, 185,
+  224, 181, 141, 224, 180, 174, 224, 183, 138, 224, 183, 153, 224, 183, 138, 224,
+  183, 153, 224, 183, 143, 224, 183, 153, 224, 183, 143, 224, 183, 138, 224, 183,
+  153, 224, 183, 159, 224, 183, 168, 224, 183, 143, 224, 182, 162, 224, 182, 175,
+  224, 183, 168, 224, 183, 147, 224, 184, 130, 224, 184, 138, 224, 184, 142, 224,
+  184, 132, 224, 184, 145, 224, 184, 134, 224, 184, 160, 204, 138, 224, 184, 178,
+  224, 184, 184, 224, 184, 185, 224, 184, 186, 224, 185, 128, 224, 185, 128, 224,
+  184, 178, 224, 185, 136, 224, 185, 137, 224, 185, 138, 224, 185, 139, 224, 184,
+  136, 224, 184, 162, 224, 184, 154, 224, 184, 155, 224, 184, 157, 224, 184, 158,
+  224, 184, 159, 204, 138, 224, 186, 178, 224, 184, 184, 224, 184, 185, 224, 186,
+  186, 224, 185, 136, 224, 185, 137, 224, 185, 138, 224, 185, 139, 224, 186, 171,
+  224, 186, 153, 224, 186, 171, 224, 186, 161, 224, 189, 168, 224, 189, 188, 224,
+  189, 190, 224, 189, 160, 224, 189, 180, 224, 190, 130, 224, 189, 191, 224, 189,
+  160, 224, 189, 180, 224, 190, 130, 224, 188, 148, 224, 188, 139, 224, 188, 141,
+  224, 188, 141, 224, 188, 152, 224, 188, 153, 224, 188, 154, 224, 188, 154, 224,
+  188, 157, 224, 188, 157, 224, 188, 154, 224, 188, 157, 224, 188, 181, 224, 188,
+  185, 224, 189, 130, 224, 190, 183, 224, 189, 140, 224, 190, 183, 224, 189, 145,
+  224, 190, 183, 224, 189, 150, 224, 190, 183, 224, 189, 155, 224, 190, 183, 224,
+  189, 128, 224, 190, 181, 224, 189, 162, 224, 189, 177, 224, 189, 178, 224, 189,
+  177, 224, 189, 178, 224, 189, 180, 224, 189, 177, 224, 189, 180, 224, 190, 178,
+  224, 190, 128, 224, 190, 178, 224, 189, 177, 224, 190, 128, 224, 190, 179, 224,
+  190, 128, 224, 190, 179, 224, 189, 177, 224, 190, 128, 224, 189, 186, 224, 189,
+  187, 224, 189, 188, 224, 189, 189, 224, 190, 128, 224, 189, 177, 224, 190, 128,
+  224, 190, 130, 224, 190, 131, 224, 190, 132, 224, 190, 134, 224, 190, 135, 224,
+  190, 146, 224, 190, 183, 224, 190, 156, 224, 190, 183, 224, 190, 161, 224, 190,
+  183, 224, 190, 166, 224, 190, 183, 224, 190, 171, 224, 190, 183, 224, 190, 144,
+  224, 190, 181, 224, 191, 134, 224, 188, 157, 224, 188, 154, 229, 141, 144, 229,
+  141, 141, 225, 128, 130, 225, 128, 172, 111, 225, 128, 172, 225, 128, 149, 225,
+  128, 172, 225, 128, 165, 225, 128, 174, 225, 128, 158, 225, 128, 188, 225, 128,
+  158, 225, 128, 188, 225, 128, 177, 225, 128, 172, 225, 128, 186, 225, 128, 183,
+  225, 128, 185, 225, 128, 186, 225, 129, 138, 225, 129, 138, 225, 129, 129, 225,
+  128, 149, 225, 128, 190, 225, 128, 149, 225, 128, 172, 225, 128, 190, 225, 128,
+  131, 225, 128, 190, 225, 129, 189, 225, 128, 190, 225, 128, 130, 225, 128, 190,
+  225, 130, 141, 225, 130, 131, 204, 138, 234, 158, 134, 225, 132, 128, 225, 132,
+  128, 225, 132, 131, 225, 132, 131, 225, 132, 135, 225, 132, 135, 225, 132, 137,
+  225, 132, 137, 225, 132, 140, 225, 132, 140, 225, 132, 130, 225, 132, 128, 225,
+  132, 130, 225, 132, 130, 225, 132, 130, 225, 132, 131, 225, 132, 130, 225, 132,
+  135, 225, 132, 131, 225, 132, 128, 225, 132, 133, 225, 132, 130, 225, 132, 133,
+  225, 132, 133, 225, 132, 133, 225, 132, 146, 225, 132, 133, 225, 132, 139, 225,
+  132, 134, 225, 132, 135, 225, 132, 134, 225, 132, 139, 225, 132, 135, 225, 132,
+  128, 225, 132, 135, 225, 132, 130, 225, 132, 135, 225, 132, 131, 225, 132, 135,
+  225, 132, 137, 225, 132, 135, 225, 132, 137, 225, 132, 128, 225, 132, 135, 225,
+  132, 137, 225, 132, 131, 225, 132, 135, 225, 132, 137, 225, 132, 135, 225, 132,
+  135, 225, 132, 137, 225, 132, 137, 225, 132, 135, 225, 132, 137, 225, 132, 140,
+  225, 132, 135, 225, 132, 140, 225, 132, 135, 225, 132, 142, 225, 132, 135, 225,
+  132, 144, 225, 132, 135, 225, 132, 145, 225, 132, 135, 225, 132, 139, 225, 132,
+  135, 225, 132, 135, 225, 132, 139, 225, 132, 137, 225, 132, 128, 225, 132, 137,
+  225, 132, 130, 225, 132, 137, 225, 132, 131, 225, 132, 137, 225, 132, 133, 225,
+  132, 137, 225, 132, 134, 225, 132, 137, 225, 132, 135, 225, 132, 137, 225, 132,
+  135, 225, 132, 128, 225, 132, 137, 225, 132, 137, 225, 132, 137, 225, 132, 137,
+  225, 132, 139, 225, 132, 137, 225, 132, 140, 225, 132, 137, 225, 132, 142, 225,
+  132, 137, 225, 132, 143, 225, 132, 137, 225, 132, 144, 225, 132, 137, 225, 132,
+  145, 225, 132, 188, 225, 132, 188, 225, 132, 190, 225, 132, 190, 225, 132, 139,
+  225, 132, 128, 225, 132, 139, 225, 132, 131, 225, 132, 139, 225, 132, 134, 225,
+  132, 139, 225, 132, 135, 225, 132, 139, 225, 132, 137, 225, 132, 139, 225, 133,
+  128, 225, 132, 139, 225, 132, 139, 225, 132, 139, 225, 132, 140, 225, 132, 139,
+  225, 132, 142, 225, 132, 139, 225, 132, 144, 225, 132, 139, 225, 132, 145, 225,
+  132, 140, 225, 132, 139, 225, 133, 142, 225, 133, 142, 225, 133, 144, 225, 133,
+  144, 225, 132, 142, 225, 132, 143, 225, 132, 142, 225, 132, 146, 225, 132, 145,
+  225, 132, 135, 225, 132, 145, 225, 132, 139, 225, 132, 146, 225, 132, 146, 225,
+  132, 128, 225, 132, 131, 225, 132, 130, 225, 132, 137, 225, 132, 130, 225, 132,
+  140, 225, 132, 130, 225, 132, 146, 225, 132, 131, 225, 132, 133, 225, 133, 161,
+  228, 184, 168, 225, 133, 163, 228, 184, 168, 225, 133, 165, 228, 184, 168, 225,
+  133, 167, 228, 184, 168, 225, 133, 169, 225, 133, 161, 225, 133, 169, 225, 133,
+  161, 228, 184, 168, 225, 133, 169, 228, 184, 168, 225, 133, 174, 225, 133, 165,
+  225, 133, 174, 225, 133, 165, 228, 184, 168, 225, 133, 174, 228, 184, 168, 227,
+  131, 188, 227, 131, 188, 228, 184, 168, 228, 184, 168, 225, 133, 161, 225, 133,
+  169, 225, 133, 161, 225, 133, 174, 225, 133, 163, 225, 133, 169, 225, 133, 163,
+  225, 133, 173, 225, 133, 165, 225, 133, 169, 225, 133, 165, 225, 133, 174, 225,
+  133, 165, 227, 131, 188, 225, 133, 167, 225, 133, 169, 225, 133, 167, 225, 133,
+  174, 225, 133, 169, 225, 133, 165, 225, 133, 169, 225, 133, 165, 228, 184, 168,
+  225, 133, 169, 225, 133, 167, 228, 184, 168, 225, 133, 169, 225, 133, 169, 225,
+  133, 169, 225, 133, 174, 225, 133, 173, 225, 133, 163, 225, 133, 173, 225, 133,
+  163, 228, 184, 168, 225, 133, 173, 225, 133, 169, 225, 133, 173, 228, 184, 168,
+  225, 133, 174, 225, 133, 161, 225, 133, 174, 225, 133, 161, 228, 184, 168, 225,
+  133, 174, 225, 133, 165, 227, 131, 188, 225, 133, 174, 225, 133, 167, 228, 184,
+  168, 225, 133, 174, 225, 133, 174, 225, 133, 178, 225, 133, 161, 225, 133, 178,
+  225, 133, 165, 225, 133, 178, 225, 133, 165, 228, 184, 168, 225, 133, 178, 225,
+  133, 167, 225, 133, 178, 225, 133, 167, 228, 184, 168, 225, 133, 178, 225, 133,
+  174, 225, 133, 178, 228, 184, 168, 227, 131, 188, 225, 133, 174, 227, 131, 188,
+  227, 131, 188, 227, 131, 188, 228, 184, 168, 225, 133, 174, 228, 184, 168, 225,
+  133, 161, 228, 184, 168, 225, 133, 163, 228, 184, 168, 225, 133, 169, 228, 184,
+  168, 225, 133, 174, 228, 184, 168, 227, 131, 188, 228, 184, 168, 225, 134, 158,
+  225, 134, 158, 225, 133, 165, 225, 134, 158, 225, 133, 174, 225, 134, 158, 228,
+  184, 168, 225, 134, 158, 225, 134, 158, 225, 133, 161, 227, 131, 188, 225, 133,
+  163, 225, 133, 174, 225, 133, 167, 225, 133, 163, 225, 133, 169, 225, 133, 163,
+  225, 133, 169, 225, 133, 163, 228, 184, 168, 225, 132, 128, 225, 132, 128, 225,
+  132, 137, 225, 132, 130, 225, 132, 131, 225, 132, 133, 225, 132, 133, 225, 132,
+  128, 225, 132, 133, 225, 132, 134, 225, 132, 133, 225, 132, 135, 225, 132, 133,
+  225, 132, 137, 225, 132, 133, 225, 132, 144, 225, 132, 133, 225, 132, 145, 225,
+  132, 134, 225, 132, 135, 225, 132, 137, 225, 132, 139, 225, 132, 140, 225, 132,
+  142, 225, 132, 143, 225, 132, 144, 225, 132, 145, 225, 132, 146, 225, 132, 128,
+  225, 132, 133, 225, 132, 128, 225, 132, 137, 225, 132, 128, 225, 132, 130, 225,
+  133, 128, 225, 132, 130, 225, 132, 144, 225, 132, 133, 225, 132, 128, 225, 132,
+  137, 225, 132, 133, 225, 132, 131, 225, 132, 133, 225, 132, 131, 225, 132, 146,
+  225, 132, 133, 225, 132, 134, 225, 132, 128, 225, 132, 133, 225, 132, 134, 225,
+  132, 137, 225, 132, 133, 225, 132, 135, 225, 132, 137, 225, 132, 133, 225, 132,
+  135, 225, 132, 146, 225, 132, 133, 225, 132, 135, 225, 132, 139, 225, 132, 133,
+  225, 132, 137, 225, 132, 137, 225, 132, 133, 225, 133, 128, 225, 132, 133, 225,
+  132, 143, 225, 132, 133, 225, 133, 153, 225, 132, 134, 225, 132, 128, 225, 132,
+  134, 225, 132, 133, 225, 132, 134, 225, 132, 137, 225, 132, 134, 225, 132, 137,
+  225, 132, 137, 225, 132, 134, 225, 133, 128, 225, 132, 134, 225, 132, 142, 225,
+  132, 134, 225, 132, 146, 225, 132, 135, 225, 132, 133, 225, 132, 135, 225, 132,
+  146, 225, 133, 128, 225, 132, 139, 225, 132, 128, 225, 132, 128, 225, 132, 139,
+  225, 132, 143, 225, 133, 140, 225, 132, 146, 225, 132, 130, 225, 132, 146, 225,
+  132, 133, 225, 132, 146, 225, 132, 134, 225, 132, 146, 225, 132, 135, 225, 133,
+  153, 225, 132, 128, 225, 132, 130, 225, 132, 128, 225, 132, 135, 225, 132, 128,
+  225, 132, 142, 225, 132, 128, 225, 132, 143, 225, 132, 128, 225, 132, 146, 213,
+  136, 213, 177, 225, 141, 157, 225, 141, 158, 225, 141, 159, 68, 79, 39, 198,
+  171, 209, 160, 52, 76, 61, 206, 148, 194, 183, 225, 144, 129, 225, 144, 129,
+  194, 183, 194, 183, 206, 148, 206, 148, 194, 183, 194, 183, 225, 144, 132, 225,
+  144, 132, 194, 183, 194, 183, 225, 144, 133, 225, 144, 133, 194, 183, 194, 183,
+  225, 144, 134, 225, 144, 134, 194, 183, 194, 183, 225, 144, 138, 225, 144, 138,
+  194, 183, 194, 183, 225, 144, 139, 225, 144, 139, 194, 183, 194, 183, 225, 144,
+  129, 225, 144, 160, 206, 148, 225, 144, 160, 225, 144, 133, 225, 144, 160, 225,
+  144, 138, 225, 144, 160, 194, 183, 62, 194, 183, 86, 86, 194, 183, 194, 183,
+  201, 133, 201, 133, 194, 183, 194, 183, 225, 144, 178, 225, 144, 178, 194, 183,
+  62, 194, 183, 194, 183, 225, 144, 180, 225, 144, 180, 194, 183, 194, 183, 60,
+  60, 194, 183, 194, 183, 225, 144, 185, 225, 144, 185, 194, 183, 194, 183, 225,
+  145, 144, 194, 183, 85, 85, 194, 183, 194, 183, 213, 136, 213, 136, 194, 183,
+  194, 183, 225, 145, 143, 225, 145, 143, 194, 183, 225, 145, 144, 194, 183, 194,
+  183, 225, 145, 145, 225, 145, 145, 194, 183, 194, 183, 225, 145, 149, 225, 145,
+  149, 194, 183, 194, 183, 225, 145, 150, 225, 145, 150, 194, 183, 85, 39, 213,
+  136, 39, 225, 145, 144, 39, 225, 145, 149, 39, 98, 204, 135, 194, 183, 225,
+  145, 171, 225, 145, 171, 194, 183, 194, 183, 80, 112, 194, 183, 194, 183, 225,
+  145, 174, 225, 145, 174, 194, 183, 194, 183, 100, 100, 194, 183, 194, 183, 225,
+  145, 176, 225, 145, 176, 194, 183, 194, 183, 98, 98, 194, 183, 194, 183, 98,
+  204, 135, 98, 204, 135, 194, 183, 225, 145, 171, 39, 80, 39, 100, 39, 98,
+  39, 194, 183, 225, 146, 137, 225, 146, 137, 194, 183, 194, 183, 225, 146, 139,
+  225, 146, 139, 194, 183, 194, 183, 225, 146, 140, 225, 146, 140, 194, 183, 194,
+  183, 74, 74, 194, 183, 194, 183, 225, 146, 142, 225, 146, 142, 194, 183, 194,
+  183, 225, 146, 144, 225, 146, 144, 194, 183, 194, 183, 225, 146, 145, 225, 146,
+  145, 194, 183, 194, 183, 225, 146, 163, 225, 146, 163, 194, 183, 194, 183, 206,
+  147, 206, 147, 194, 183, 194, 183, 225, 146, 166, 225, 146, 166, 194, 183, 194,
+  183, 225, 146, 167, 225, 146, 167, 194, 183, 194, 183, 225, 146, 168, 225, 146,
+  168, 194, 183, 194, 183, 76, 194, 183, 225, 146, 171, 225, 146, 171, 194, 183,
+  194, 183, 225, 147, 128, 225, 147, 128, 194, 183, 194, 183, 225, 147, 135, 225,
+  147, 135, 194, 183, 194, 183, 225, 147, 136, 225, 147, 136, 194, 183, 225, 144,
+  161, 194, 183, 225, 147, 147, 225, 147, 147, 194, 183, 194, 183, 225, 147, 149,
+  225, 147, 149, 194, 183, 194, 183, 225, 147, 150, 225, 147, 150, 194, 183, 194,
+  183, 225, 147, 151, 225, 147, 151, 194, 183, 194, 183, 225, 147, 152, 225, 147,
+  152, 194, 183, 194, 183, 225, 147, 154, 225, 147, 154, 194, 183, 194, 183, 225,
+  147, 155, 225, 147, 155, 194, 183, 194, 183, 225, 147, 173, 225, 147, 173, 194,
+  183, 194, 183, 225, 147, 175, 225, 147, 175, 194, 183, 194, 183, 225, 147, 176,
+  225, 147, 176, 194, 183, 194, 183, 225, 147, 177, 225, 147, 177, 194, 183, 194,
+  183, 225, 147, 178, 225, 147, 178, 194, 183, 194, 183, 225, 147, 180, 225, 147,
+  180, 194, 183, 194, 183, 225, 147, 181, 225, 147, 181, 194, 183, 225, 148, 139,
+  60, 225, 148, 139, 225, 145, 149, 225, 148, 139, 98, 225, 148, 139, 225, 146,
+  144, 194, 183, 225, 148, 144, 225, 148, 144, 194, 183, 194, 183, 225, 148, 145,
+  225, 148, 145, 194, 183, 194, 183, 225, 148, 146, 225, 148, 146, 194, 183, 194,
+  183, 225, 148, 147, 225, 148, 147, 194, 183, 194, 183, 225, 148, 148, 225, 148,
+  148, 194, 183, 194, 183, 225, 148, 149, 225, 148, 149, 194, 183, 194, 183, 225,
+  148, 150, 225, 148, 150, 194, 183, 194, 183, 52, 52, 194, 183, 194, 183, 225,
+  148, 168, 225, 148, 168, 194, 183, 194, 183, 225, 148, 169, 225, 148, 169, 194,
+  183, 194, 183, 225, 148, 170, 225, 148, 170, 194, 183, 194, 183, 225, 148, 171,
+  225, 148, 171, 194, 183, 194, 183, 225, 148, 173, 225, 148, 173, 194, 183, 194,
+  183, 225, 148, 174, 225, 148, 174, 194, 183, 225, 144, 169, 194, 183, 225, 149,
+  140, 225, 149, 140, 194, 183, 194, 183, 225, 149, 154, 225, 149, 154, 194, 183,
+  194, 183, 225, 149, 167, 225, 149, 167, 194, 183, 225, 149, 144, 225, 145, 172,
+  225, 149, 144, 80, 225, 149, 144, 225, 145, 174, 225, 149, 144, 100, 225, 149,
+  144, 225, 145, 176, 225, 149, 144, 98, 225, 149, 144, 98, 204, 135, 225, 149,
+  144, 225, 146, 131, 225, 150, 149, 225, 146, 138, 225, 150, 149, 225, 146, 139,
+  225, 150, 149, 225, 146, 140, 225, 150, 149, 74, 225, 150, 149, 225, 146, 142,
+  225, 150, 149, 225, 146, 144, 225, 150, 149, 225, 146, 145, 226, 132, 178, 234,
+  159, 187, 226, 177, 175, 225, 146, 144, 225, 146, 137, 225, 147, 147, 225, 147,
+  154, 225, 149, 131, 225, 149, 134, 225, 149, 138, 198, 177, 206, 169, 225, 149,
+  144, 225, 145, 171, 225, 150, 149, 225, 146, 137, 225, 150, 150, 225, 146, 139,
+  225, 150, 150, 225, 146, 140, 225, 150, 150, 74, 225, 150, 150, 225, 146, 142,
+  225, 150, 150, 225, 146, 144, 225, 150, 150, 225, 146, 145, 225, 150, 167, 194,
+  183, 225, 150, 168, 194, 183, 225, 150, 169, 194, 183, 225, 150, 170, 194, 183,
+  225, 150, 171, 194, 183, 225, 150, 172, 194, 183, 225, 150, 173, 194, 183, 225,
+  154, 189, 225, 154, 188, 43, 225, 156, 148, 225, 156, 149, 225, 156, 180, 47,
+  225, 158, 162, 224, 184, 180, 224, 184, 181, 224, 184, 182, 224, 184, 183, 224,
+  185, 136, 225, 159, 146, 224, 184, 175, 224, 185, 154, 224, 185, 143, 224, 185,
+  155, 225, 159, 157, 225, 160, 181, 225, 161, 156, 225, 162, 169, 194, 183, 225,
+  162, 177, 194, 183, 225, 162, 180, 194, 183, 225, 162, 184, 194, 183, 225, 163,
+  128, 194, 183, 225, 147, 130, 225, 147, 130, 194, 183, 194, 183, 225, 147, 131,
+  225, 147, 131, 194, 183, 194, 183, 225, 147, 132, 225, 147, 132, 194, 183, 194,
+  183, 225, 147, 133, 225, 147, 133, 194, 183, 194, 183, 225, 149, 131, 194, 183,
+  225, 149, 134, 194, 183, 225, 149, 135, 194, 183, 225, 149, 136, 194, 183, 225,
+  149, 137, 194, 183, 225, 149, 139, 225, 163, 159, 225, 144, 158, 225, 144, 158,
+  225, 163, 159, 225, 149, 131, 194, 183, 225, 149, 158, 194, 183, 225, 149, 166,
+  194, 183, 225, 149, 171, 194, 183, 225, 150, 134, 194, 183, 225, 150, 151, 194,
+  183, 209, 160, 194, 183, 225, 151, 180, 194, 183, 225, 152, 155, 194, 183, 225,
+  164, 185, 225, 164, 186, 225, 164, 187, 225, 166, 158, 225, 166, 177, 225, 168,
+  151, 225, 168, 152, 225, 169, 160, 225, 169, 181, 225, 169, 182, 225, 169, 183,
+  225, 169, 184, 225, 169, 185, 225, 169, 186, 225, 169, 187, 225, 169, 188, 225,
+  169, 191, 225, 169, 133, 225, 170, 168, 225, 170, 168, 225, 170, 170, 225, 170,
+  168, 225, 170, 176, 225, 170, 177, 225, 170, 178, 225, 170, 179, 225, 170, 181,
+  225, 170, 182, 204, 168, 225, 170, 184, 225, 170, 185, 225, 170, 186, 225, 170,
+  187, 225, 170, 188, 225, 170, 189, 225, 170, 191, 225, 171, 128, 225, 171, 129,
+  225, 171, 130, 225, 171, 131, 225, 171, 132, 225, 171, 133, 225, 171, 134, 225,
+  171, 135, 225, 171, 136, 225, 171, 137, 225, 171, 138, 225, 171, 139, 225, 171,
+  140, 225, 171, 141, 225, 171, 142, 225, 172, 133, 225, 172, 181, 225, 172, 135,
+  225, 172, 181, 225, 172, 137, 225, 172, 181, 225, 172, 139, 225, 172, 181, 225,
+  172, 141, 225, 172, 181, 225, 172, 145, 225, 172, 181, 225, 172, 180, 225, 172,
+  186, 225, 172, 181, 225, 172, 188, 225, 172, 181, 225, 172, 190, 225, 172, 181,
+  225, 172, 191, 225, 172, 181, 225, 173, 130, 225, 172, 181, 225, 173, 132, 225,
+  172, 141, 225, 172, 145, 225, 172, 168, 225, 173, 144, 225, 173, 158, 225, 173,
+  158, 225, 173, 171, 225, 173, 172, 225, 173, 173, 225, 173, 174, 225, 173, 175,
+  225, 173, 176, 225, 173, 177, 225, 173, 178, 225, 173, 179, 225, 174, 170, 225,
+  174, 171, 225, 175, 166, 225, 175, 178, 225, 175, 179, 225, 176, 183, 225, 176,
+  187, 225, 176, 187, 225, 177, 190, 225, 177, 190, 225, 179, 145, 225, 179, 148,
+  225, 179, 150, 225, 179, 151, 225, 179, 155, 225, 179, 159, 225, 179, 160, 225,
+  179, 162, 225, 179, 163, 225, 179, 164, 225, 179, 165, 225, 179, 166, 225, 179,
+  167, 225, 179, 168, 225, 179, 180, 225, 179, 184, 225, 179, 185, 199, 157, 111,
+  122, 202, 140, 225, 180, 152, 208, 187, 225, 163, 150, 194, 186, 117, 101, 102,
+  204, 180, 114, 110, 204, 180, 110, 204, 180, 114, 204, 180, 201, 190, 204, 180,
+  115, 204, 180, 116, 204, 180, 122, 204, 180, 225, 180, 180, 112, 204, 181, 117,
+  204, 181, 202, 138, 204, 181, 201, 139, 225, 181, 139, 225, 181, 141, 225, 163,
+  148, 225, 153, 134, 225, 183, 128, 225, 183, 129, 225, 183, 130, 225, 183, 131,
+  225, 183, 132, 225, 183, 133, 225, 183, 134, 225, 183, 135, 225, 183, 136, 225,
+  183, 137, 225, 183, 138, 225, 183, 139, 225, 183, 140, 225, 183, 141, 225, 183,
+  142, 225, 183, 143, 225, 183, 144, 225, 183, 145, 225, 183, 146, 225, 183, 147,
+  225, 183, 148, 225, 183, 149, 225, 183, 150, 225, 183, 151, 225, 183, 152, 225,
+  183, 153, 225, 183, 154, 225, 183, 155, 225, 183, 156, 225, 183, 157, 225, 183,
+  158, 225, 183, 159, 225, 183, 160, 225, 183, 161, 225, 183, 162, 225, 183, 163,
+  225, 183, 164, 225, 183, 165, 225, 183, 166, 225, 183, 167, 225, 183, 168, 225,
+  183, 169, 225, 183, 170, 225, 183, 171, 225, 183, 172, 225, 183, 173, 226, 183,
+  172, 225, 183, 175, 225, 183, 176, 225, 183, 177, 225, 183, 178, 225, 183, 179,
+  225, 183, 180, 225, 183, 181, 225, 183, 182, 225, 183, 183, 225, 183, 184, 225,
+  183, 185, 225, 183, 186, 225, 183, 187, 225, 183, 188, 225, 183, 189, 225, 183,
+  190, 225, 183, 191, 65, 204, 165, 97, 204, 165, 66, 204, 135, 98, 204, 135,
+  66, 204, 163, 98, 204, 163, 66, 204, 177, 98, 204, 177, 67, 204, 167, 204,
+  129, 99, 204, 167, 204, 129, 68, 204, 135, 100, 204, 135, 68, 204, 163, 100,
+  204, 163, 68, 204, 177, 100, 204, 177, 68, 204, 167, 100, 204, 167, 68, 204,
+  173, 100, 204, 173, 69, 204, 132, 204, 128, 101, 204, 132, 204, 128, 69, 204,
+  132, 204, 129, 101, 204, 132, 204, 129, 69, 204, 173, 101, 204, 173, 69, 204,
+  176, 101, 204, 176, 69, 204, 167, 204, 134, 101, 204, 167, 204, 134, 70, 204,
+  135, 102, 204, 135, 71, 204, 132, 103, 204, 132, 72, 204, 135, 104, 204, 135,
+  72, 204, 163, 104, 204, 163, 72, 204, 136, 104, 204, 136, 72, 204, 167, 104,
+  204, 167, 72, 204, 174, 104, 204, 174, 73, 204, 176, 105, 204, 176, 73, 204,
+  136, 204, 129, 105, 204, 136, 204, 129, 75, 204, 129, 107, 204, 129, 75, 204,
+  163, 107, 204, 163, 75, 204, 177, 107, 204, 177, 76, 204, 163, 108, 204, 163,
+  76, 204, 163, 204, 132, 108, 204, 163, 204, 132, 76, 204, 177, 108, 204, 177,
+  76, 204, 173, 108, 204, 173, 77, 204, 129, 109, 204, 129, 77, 204, 135, 109,
+  204, 135, 77, 204, 163, 109, 204, 163, 78, 204, 135, 110, 204, 135, 78, 204,
+  163, 110, 204, 163, 78, 204, 177, 110, 204, 177, 78, 204, 173, 110, 204, 173,
+  79, 204, 131, 204, 129, 111, 204, 131, 204, 129, 79, 204, 131, 204, 136, 111,
+  204, 131, 204, 136, 79, 204, 132, 204, 128, 111, 204, 132, 204, 128, 79, 204,
+  132, 204, 129, 111, 204, 132, 204, 129, 80, 204, 129, 112, 204, 129, 80, 204,
+  135, 112, 204, 135, 82, 204, 135, 114, 204, 135, 82, 204, 163, 114, 204, 163,
+  82, 204, 163, 204, 132, 114, 204, 163, 204, 132, 82, 204, 177, 114, 204, 177,
+  83, 204, 135, 115, 204, 135, 83, 204, 163, 115, 204, 163, 83, 204, 129, 204,
+  135, 115, 204, 129, 204, 135, 83, 204, 140, 204, 135, 115, 204, 140, 204, 135,
+  83, 204, 163, 204, 135, 115, 204, 163, 204, 135, 84, 204, 135, 116, 204, 135,
+  84, 204, 163, 116, 204, 163, 84, 204, 177, 116, 204, 177, 84, 204, 173, 116,
+  204, 173, 85, 204, 164, 117, 204, 164, 85, 204, 176, 117, 204, 176, 85, 204,
+  173, 117, 204, 173, 85, 204, 131, 204, 129, 117, 204, 131, 204, 129, 85, 204,
+  132, 204, 136, 117, 204, 132, 204, 136, 86, 204, 131, 118, 204, 131, 86, 204,
+  163, 118, 204, 163, 87, 204, 128, 119, 204, 128, 87, 204, 129, 119, 204, 129,
+  87, 204, 136, 119, 204, 136, 87, 204, 135, 119, 204, 135, 87, 204, 163, 119,
+  204, 163, 88, 204, 135, 120, 204, 135, 88, 204, 136, 120, 204, 136, 89, 204,
+  135, 121, 204, 135, 90, 204, 130, 122, 204, 130, 90, 204, 163, 122, 204, 163,
+  90, 204, 177, 122, 204, 177, 104, 204, 177, 116, 204, 136, 119, 204, 138, 121,
+  204, 138, 97, 204, 137, 197, 191, 204, 135, 65, 204, 163, 97, 204, 163, 65,
+  204, 137, 97, 204, 137, 65, 204, 130, 204, 129, 97, 204, 130, 204, 129, 65,
+  204, 130, 204, 128, 97, 204, 130, 204, 128, 65, 204, 130, 204, 137, 97, 204,
+  130, 204, 137, 65, 204, 130, 204, 131, 97, 204, 130, 204, 131, 65, 204, 163,
+  204, 130, 97, 204, 163, 204, 130, 65, 204, 134, 204, 129, 97, 204, 134, 204,
+  129, 65, 204, 134, 204, 128, 97, 204, 134, 204, 128, 65, 204, 134, 204, 137,
+  97, 204, 134, 204, 137, 65, 204, 134, 204, 131, 97, 204, 134, 204, 131, 65,
+  204, 163, 204, 134, 97, 204, 163, 204, 134, 69, 204, 163, 101, 204, 163, 69,
+  204, 137, 101, 204, 137, 69, 204, 131, 101, 204, 131, 69, 204, 130, 204, 129,
+  101, 204, 130, 204, 129, 69, 204, 130, 204, 128, 101, 204, 130, 204, 128, 69,
+  204, 130, 204, 137, 101, 204, 130, 204, 137, 69, 204, 130, 204, 131, 101, 204,
+  130, 204, 131, 69, 204, 163, 204, 130, 101, 204, 163, 204, 130, 73, 204, 137,
+  105, 204, 137, 73, 204, 163, 105, 204, 163, 79, 204, 163, 111, 204, 163, 79,
+  204, 137, 111, 204, 137, 79, 204, 130, 204, 129, 111, 204, 130, 204, 129, 79,
+  204, 130, 204, 128, 111, 204, 130, 204, 128, 79, 204, 130, 204, 137, 111, 204,
+  130, 204, 137, 79, 204, 130, 204, 131, 111, 204, 130, 204, 131, 79, 204, 163,
+  204, 130, 111, 204, 163, 204, 130, 79, 204, 155, 204, 129, 111, 204, 155, 204,
+  129, 79, 204, 155, 204, 128, 111, 204, 155, 204, 128, 79, 204, 155, 204, 137,
+  111, 204, 155, 204, 137, 79, 204, 155, 204, 131, 111, 204, 155, 204, 131, 79,
+  204, 155, 204, 163, 111, 204, 155, 204, 163, 85, 204, 163, 117, 204, 163, 85,
+  204, 137, 117, 204, 137, 85, 204, 155, 204, 129, 117, 204, 155, 204, 129, 85,
+  204, 155, 204, 128, 117, 204, 155, 204, 128, 85, 204, 155, 204, 137, 117, 204,
+  155, 204, 137, 85, 204, 155, 204, 131, 117, 204, 155, 204, 131, 85, 204, 155,
+  204, 163, 117, 204, 155, 204, 163, 89, 204, 128, 121, 204, 128, 89, 204, 163,
+  121, 204, 163, 89, 204, 137, 121, 204, 137, 89, 204, 131, 121, 204, 131, 206,
+  177, 204, 147, 206, 177, 204, 148, 206, 177, 204, 147, 204, 128, 206, 177, 204,
+  148, 204, 128, 206, 177, 204, 147, 204, 129, 206, 177, 204, 148, 204, 129, 206,
+  177, 204, 147, 205, 130, 206, 177, 204, 148, 205, 130, 206, 145, 204, 147, 206,
+  145, 204, 148, 206, 145, 204, 147, 204, 128, 206, 145, 204, 148, 204, 128, 206,
+  145, 204, 147, 204, 129, 206, 145, 204, 148, 204, 129, 206, 145, 204, 147, 205,
+  130, 206, 145, 204, 148, 205, 130, 206, 181, 204, 147, 206, 181, 204, 148, 206,
+  181, 204, 147, 204, 128, 206, 181, 204, 148, 204, 128, 206, 181, 204, 147, 204,
+  129, 206, 181, 204, 148, 204, 129, 206, 149, 204, 147, 206, 149, 204, 148, 206,
+  149, 204, 147, 204, 128, 206, 149, 204, 148, 204, 128, 206, 149, 204, 147, 204,
+  129, 206, 149, 204, 148, 204, 129, 206, 183, 204, 147, 206, 183, 204, 148, 206,
+  183, 204, 147, 204, 128, 206, 183, 204, 148, 204, 128, 206, 183, 204, 147, 204,
+  129, 206, 183, 204, 148, 204, 129, 206, 183, 204, 147, 205, 130, 206, 183, 204,
+  148, 205, 130, 206, 151, 204, 147, 206, 151, 204, 148, 206, 151, 204, 147, 204,
+  128, 206, 151, 204, 148, 204, 128, 206, 151, 204, 147, 204, 129, 206, 151, 204,
+  148, 204, 129, 206, 151, 204, 147, 205, 130, 206, 151, 204, 148, 205, 130, 206,
+  185, 204, 147, 206, 185, 204, 148, 206, 185, 204, 147, 204, 128, 206, 185, 204,
+  148, 204, 128, 206, 185, 204, 147, 204, 129, 206, 185, 204, 148, 204, 129, 206,
+  185, 204, 147, 205, 130, 206, 185, 204, 148, 205, 130, 206, 153, 204, 147, 206,
+  153, 204, 148, 206, 153, 204, 147, 204, 128, 206, 153, 204, 148, 204, 128, 206,
+  153, 204, 147, 204, 129, 206, 153, 204, 148, 204, 129, 206, 153, 204, 147, 205,
+  130, 206, 153, 204, 148, 205, 130, 206, 191, 204, 147, 206, 191, 204, 148, 206,
+  191, 204, 147, 204, 128, 206, 191, 204, 148, 204, 128, 206, 191, 204, 147, 204,
+  129, 206, 191, 204, 148, 204, 129, 206, 159, 204, 147, 206, 159, 204, 148, 206,
+  159, 204, 147, 204, 128, 206, 159, 204, 148, 204, 128, 206, 159, 204, 147, 204,
+  129, 206, 159, 204, 148, 204, 129, 207, 133, 204, 147, 207, 133, 204, 148, 207,
+  133, 204, 147, 204, 128, 207, 133, 204, 148, 204, 128, 207, 133, 204, 147, 204,
+  129, 207, 133, 204, 148, 204, 129, 207, 133, 204, 147, 205, 130, 207, 133, 204,
+  148, 205, 130, 206, 165, 204, 148, 206, 165, 204, 148, 204, 128, 206, 165, 204,
+  148, 204, 129, 206, 165, 204, 148, 205, 130, 207, 137, 204, 147, 207, 137, 204,
+  148, 207, 137, 204, 147, 204, 128, 207, 137, 204, 148, 204, 128, 207, 137, 204,
+  147, 204, 129, 207, 137, 204, 148, 204, 129, 207, 137, 204, 147, 205, 130, 207,
+  137, 204, 148, 205, 130, 206, 169, 204, 147, 206, 169, 204, 148, 206, 169, 204,
+  147, 204, 128, 206, 169, 204, 148, 204, 128, 206, 169, 204, 147, 204, 129, 206,
+  169, 204, 148, 204, 129, 206, 169, 204, 147, 205, 130, 206, 169, 204, 148, 205,
+  130, 206, 177, 204, 128, 206, 181, 204, 128, 206, 183, 204, 128, 206, 185, 204,
+  128, 206, 191, 204, 128, 207, 133, 204, 128, 207, 137, 204, 128, 206, 177, 204,
+  147, 205, 133, 206, 177, 204, 148, 205, 133, 206, 177, 204, 147, 204, 128, 205,
+  133, 206, 177, 204, 148, 204, 128, 205, 133, 206, 177, 204, 147, 204, 129, 205,
+  133, 206, 177, 204, 148, 204, 129, 205, 133, 206, 177, 204, 147, 205, 130, 205,
+  133, 206, 177, 204, 148, 205, 130, 205, 133, 206, 145, 204, 147, 205, 133, 206,
+  145, 204, 148, 205, 133, 206, 145, 204, 147, 204, 128, 205, 133, 206, 145, 204,
+  148, 204, 128, 205, 133, 206, 145, 204, 147, 204, 129, 205, 133, 206, 145, 204,
+  148, 204, 129, 205, 133, 206, 145, 204, 147, 205, 130, 205, 133, 206, 145, 204,
+  148, 205, 130, 205, 133, 206, 183, 204, 147, 205, 133, 206, 183, 204, 148, 205,
+  133, 206, 183, 204, 147, 204, 128, 205, 133, 206, 183, 204, 148, 204, 128, 205,
+  133, 206, 183, 204, 147, 204, 129, 205, 133, 206, 183, 204, 148, 204, 129, 205,
+  133, 206, 183, 204, 147, 205, 130, 205, 133, 206, 183, 204, 148, 205, 130, 205,
+  133, 206, 151, 204, 147, 205, 133, 206, 151, 204, 148, 205, 133, 206, 151, 204,
+  147, 204, 128, 205, 133, 206, 151, 204, 148, 204, 128, 205, 133, 206, 151, 204,
+  147, 204, 129, 205, 133, 206, 151, 204, 148, 204, 129, 205, 133, 206, 151, 204,
+  147, 205, 130, 205, 133, 206, 151, 204, 148, 205, 130, 205, 133, 207, 137, 204,
+  147, 205, 133, 207, 137, 204, 148, 205, 133, 207, 137, 204, 147, 204, 128, 205,
+  133, 207, 137, 204, 148, 204, 128, 205, 133, 207, 137, 204, 147, 204, 129, 205,
+  133, 207, 137, 204, 148, 204, 129, 205, 133, 207, 137, 204, 147, 205, 130, 205,
+  133, 207, 137, 204, 148, 205, 130, 205, 133, 206, 169, 204, 147, 205, 133, 206,
+  169, 204, 148, 205, 133, 206, 169, 204, 147, 204, 128, 205, 133, 206, 169, 204,
+  148, 204, 128, 205, 133, 206, 169, 204, 147, 204, 129, 205, 133, 206, 169, 204,
+  148, 204, 129, 205, 133, 206, 169, 204, 147, 205, 130, 205, 133, 206, 169, 204,
+  148, 205, 130, 205, 133, 206, 177, 204, 134, 206, 177, 204, 132, 206, 177, 204,
+  128, 205, 133, 206, 177, 205, 133, 206, 177, 204, 129, 205, 133, 206, 177, 205,
+  130, 206, 177, 205, 130, 205, 133, 206, 145, 204, 134, 206, 145, 204, 132, 206,
+  145, 204, 128, 206, 145, 205, 133, 206, 185, 194, 168, 205, 130, 206, 183, 204,
+  128, 205, 133, 206, 183, 205, 133, 206, 183, 204, 129, 205, 133, 206, 183, 205,
+  130, 206, 183, 205, 130, 205, 133, 206, 149, 204, 128, 206, 151, 204, 128, 206,
+  151, 205, 133, 225, 190, 191, 204, 128, 225, 190, 191, 204, 129, 225, 190, 191,
+  205, 130, 206, 185, 204, 134, 206, 185, 204, 132, 206, 185, 204, 136, 204, 128,
+  206, 185, 205, 130, 206, 185, 204, 136, 205, 130, 206, 153, 204, 134, 206, 153,
+  204, 132, 206, 153, 204, 128, 225, 191, 190, 204, 128, 225, 191, 190, 204, 129,
+  225, 191, 190, 205, 130, 207, 133, 204, 134, 207, 133, 204, 132, 207, 133, 204,
+  136, 204, 128, 207, 129, 204, 147, 207, 129, 204, 148, 207, 133, 205, 130, 207,
+  133, 204, 136, 205, 130, 206, 165, 204, 134, 206, 165, 204, 132, 206, 165, 204,
+  128, 206, 161, 204, 148, 194, 168, 204, 128, 96, 207, 137, 204, 128, 205, 133,
+  207, 137, 205, 133, 207, 137, 204, 129, 205, 133, 207, 137, 205, 130, 207, 137,
+  205, 130, 205, 133, 206, 159, 204, 128, 206, 169, 204, 128, 206, 169, 205, 133,
+  194, 180, 226, 128, 130, 226, 128, 131, 46, 46, 46, 46, 46, 39, 39, 39,
+  33, 33, 63, 63, 63, 33, 33, 63, 39, 39, 39, 39, 226, 181, 151, 226,
+  181, 130, 234, 157, 176, 67, 226, 131, 171, 194, 163, 114, 110, 204, 184, 82,
+  115, 87, 204, 181, 100, 204, 181, 204, 177, 84, 226, 131, 171, 108, 116, 213,
+  148, 226, 131, 144, 226, 131, 145, 226, 131, 146, 226, 131, 147, 226, 131, 148,
+  226, 131, 149, 226, 131, 150, 226, 131, 151, 226, 131, 152, 226, 131, 153, 226,
+  131, 154, 226, 131, 156, 226, 131, 161, 226, 131, 165, 226, 131, 166, 226, 131,
+  167, 226, 131, 168, 226, 131, 169, 226, 131, 170, 226, 131, 171, 226, 131, 172,
+  226, 131, 173, 226, 131, 174, 226, 131, 175, 226, 131, 176, 97, 47, 99, 97,
+  47, 115, 194, 176, 67, 99, 47, 111, 99, 47, 117, 208, 173, 194, 176, 70,
+  78, 111, 81, 84, 69, 76, 206, 169, 201, 191, 75, 215, 144, 215, 145, 215,
+  146, 215, 147, 70, 65, 88, 234, 147, 168, 234, 147, 182, 240, 150, 188, 128,
+  108, 108, 108, 108, 86, 86, 108, 86, 108, 108, 86, 108, 108, 108, 108, 88,
+  88, 108, 88, 108, 108, 105, 105, 105, 105, 105, 105, 118, 118, 105, 118, 105,
+  105, 118, 105, 105, 105, 105, 120, 120, 105, 120, 105, 105, 225, 155, 143, 225,
+  155, 168, 226, 134, 144, 204, 184, 226, 134, 146, 204, 184, 226, 134, 148, 204,
+  184, 226, 134, 178, 240, 159, 132, 142, 225, 155, 154, 225, 155, 144, 226, 135,
+  144, 204, 184, 226, 135, 148, 204, 184, 226, 135, 146, 204, 184, 198, 142, 226,
+  136, 131, 204, 184, 226, 136, 136, 204, 184, 226, 136, 139, 204, 184, 43, 204,
+  135, 92, 111, 111, 226, 136, 163, 204, 184, 226, 136, 165, 204, 184, 202, 131,
+  202, 131, 202, 131, 202, 131, 202, 131, 202, 131, 226, 136, 174, 226, 136, 174,
+  226, 136, 174, 226, 136, 174, 226, 136, 174, 45, 204, 135, 226, 136, 188, 204,
+  184, 226, 137, 131, 204, 184, 226, 137, 133, 204, 184, 226, 137, 136, 204, 184,
+  61, 204, 135, 61, 204, 163, 204, 135, 61, 204, 138, 61, 204, 130, 61, 204,
+  134, 61, 205, 171, 61, 204, 184, 226, 137, 161, 204, 184, 226, 137, 161, 60,
+  60, 62, 62, 226, 137, 141, 204, 184, 60, 204, 184, 62, 204, 184, 226, 137,
+  164, 204, 184, 226, 137, 165, 204, 184, 226, 137, 178, 204, 184, 226, 137, 179,
+  204, 184, 226, 137, 182, 204, 184, 226, 137, 183, 204, 184, 226, 137, 186, 204,
+  184, 226, 137, 187, 204, 184, 225, 145, 149, 225, 145, 144, 226, 138, 130, 204,
+  184, 226, 138, 131, 204, 184, 226, 138, 134, 204, 184, 226, 138, 135, 204, 184,
+  240, 144, 138, 168, 202, 152, 234, 147, 149, 226, 138, 162, 204, 184, 226, 138,
+  168, 204, 184, 226, 138, 169, 204, 184, 226, 138, 171, 204, 184, 226, 136, 167,
+  225, 155, 156, 225, 155, 158, 60, 60, 60, 62, 62, 62, 226, 137, 188, 204,
+  184, 226, 137, 189, 204, 184, 226, 138, 145, 204, 184, 226, 138, 146, 204, 184,
+  226, 138, 178, 204, 184, 226, 138, 179, 204, 184, 226, 138, 180, 204, 184, 226,
+  138, 181, 204, 184, 194, 183, 194, 183, 194, 183, 226, 136, 133, 226, 140, 164,
+  227, 128, 136, 227, 128, 137, 227, 128, 188, 206, 148, 204, 178, 225, 155, 156,
+  204, 178, 194, 176, 204, 178, 226, 138, 155, 84, 204, 136, 226, 136, 135, 204,
+  136, 226, 139, 134, 204, 136, 194, 176, 204, 136, 126, 204, 136, 225, 144, 181,
+  226, 136, 135, 204, 180, 207, 137, 97, 204, 178, 234, 158, 147, 204, 178, 105,
+  204, 178, 207, 137, 204, 178, 226, 141, 149, 226, 141, 142, 226, 141, 139, 226,
+  141, 173, 226, 130, 129, 226, 130, 128, 226, 143, 187, 226, 152, 190, 92, 92,
+  226, 158, 128, 226, 158, 129, 226, 158, 130, 226, 158, 131, 226, 158, 132, 226,
+  158, 133, 226, 158, 134, 226, 158, 135, 226, 158, 136, 226, 158, 137, 40, 108,
+  41, 40, 50, 41, 40, 51, 41, 40, 52, 41, 40, 53, 41, 40, 54, 41,
+  40, 55, 41, 40, 56, 41, 40, 57, 41, 40, 108, 79, 41, 40, 108, 108,
+  41, 40, 108, 50, 41, 40, 108, 51, 41, 40, 108, 52, 41, 40, 108, 53,
+  41, 40, 108, 54, 41, 40, 108, 55, 41, 40, 108, 56, 41, 40, 108, 57,
+  41, 40, 50, 79, 41, 108, 46, 50, 46, 51, 46, 52, 46, 53, 46, 54,
+  46, 55, 46, 56, 46, 57, 46, 108, 79, 46, 108, 108, 46, 108, 50, 46,
+  108, 51, 46, 108, 52, 46, 108, 53, 46, 108, 54, 46, 108, 55, 46, 108,
+  56, 46, 108, 57, 46, 50, 79, 46, 40, 97, 41, 40, 98, 41, 40, 99,
+  41, 40, 100, 41, 40, 101, 41, 40, 102, 41, 40, 103, 41, 40, 104, 41,
+  40, 105, 41, 40, 106, 41, 40, 107, 41, 40, 114, 110, 41, 40, 110, 41,
+  40, 111, 41, 40, 112, 41, 40, 113, 41, 40, 114, 41, 40, 115, 41, 40,
+  116, 41, 40, 117, 41, 40, 118, 41, 40, 119, 41, 40, 120, 41, 40, 121,
+  41, 40, 122, 41, 194, 169, 226, 132, 151, 194, 174, 226, 146, 190, 240, 159,
+  132, 141, 226, 148, 130, 226, 148, 140, 226, 148, 156, 226, 136, 142, 226, 150,
+  140, 226, 150, 150, 226, 150, 152, 226, 143, 165, 226, 138, 179, 226, 150, 182,
+  240, 144, 138, 188, 226, 138, 178, 226, 140, 190, 226, 140, 146, 226, 150, 161,
+  240, 144, 166, 158, 226, 178, 182, 226, 142, 136, 226, 137, 143, 240, 157, 133,
+  152, 240, 157, 133, 165, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133,
+  174, 40, 41, 123, 125, 195, 183, 92, 225, 145, 149, 225, 145, 144, 47, 226,
+  157, 172, 226, 157, 173, 225, 155, 144, 225, 155, 154, 226, 135, 131, 226, 135,
+  130, 225, 155, 144, 226, 135, 130, 226, 135, 131, 225, 155, 154, 226, 141, 137,
+  226, 141, 130, 226, 140, 187, 240, 144, 139, 128, 226, 166, 154, 58, 226, 134,
+  146, 47, 204, 132, 226, 138, 151, 226, 138, 141, 226, 138, 142, 226, 138, 147,
+  226, 138, 148, 202, 131, 202, 131, 202, 131, 202, 131, 43, 204, 138, 43, 204,
+  130, 43, 204, 131, 43, 204, 163, 43, 204, 176, 43, 226, 130, 130, 45, 204,
+  147, 45, 204, 163, 120, 204, 135, 226, 140, 153, 226, 168, 159, 226, 136, 144,
+  126, 204, 135, 61, 226, 131, 176, 58, 58, 61, 61, 61, 61, 61, 61, 62,
+  60, 225, 151, 149, 225, 151, 146, 225, 145, 144, 225, 145, 149, 226, 171, 157,
+  204, 184, 47, 47, 47, 47, 47, 226, 134, 158, 226, 134, 159, 226, 134, 160,
+  226, 134, 161, 206, 187, 207, 135, 208, 168, 209, 136, 202, 159, 207, 172, 207,
+  151, 226, 152, 167, 226, 179, 175, 226, 179, 176, 226, 179, 177, 225, 155, 175,
+  226, 181, 191, 226, 183, 160, 226, 183, 161, 226, 183, 162, 226, 183, 163, 226,
+  183, 164, 226, 183, 165, 226, 183, 166, 226, 183, 167, 226, 183, 169, 226, 183,
+  171, 226, 183, 174, 226, 183, 176, 226, 183, 177, 226, 183, 178, 226, 183, 179,
+  226, 183, 180, 226, 183, 181, 226, 183, 184, 226, 183, 185, 226, 183, 186, 226,
+  183, 187, 226, 183, 188, 226, 183, 189, 226, 183, 190, 226, 183, 191, 45, 204,
+  136, 126, 204, 163, 40, 40, 41, 41, 226, 136, 181, 226, 136, 180, 226, 136,
+  183, 216, 159, 216, 155, 194, 182, 228, 185, 155, 228, 185, 154, 228, 186, 187,
+  229, 136, 130, 227, 148, 190, 229, 133, 128, 229, 176, 163, 229, 176, 162, 229,
+  183, 179, 229, 185, 186, 229, 189, 145, 229, 191, 132, 227, 163, 186, 230, 137,
+  140, 230, 148, 181, 230, 151, 161, 230, 173, 186, 230, 175, 141, 230, 176, 145,
+  230, 176, 181, 230, 176, 186, 231, 129, 172, 231, 136, 171, 228, 184, 172, 231,
+  138, 173, 231, 189, 146, 231, 164, 187, 231, 179, 185, 231, 189, 147, 232, 128,
+  130, 232, 130, 128, 232, 137, 185, 232, 153, 142, 232, 161, 164, 232, 166, 128,
+  232, 165, 191, 232, 167, 129, 232, 174, 160, 232, 180, 157, 232, 189, 166, 232,
+  190, 182, 233, 152, 157, 233, 146, 133, 233, 149, 183, 233, 149, 184, 233, 149,
+  191, 233, 151, 168, 233, 157, 146, 233, 159, 166, 233, 161, 181, 233, 163, 142,
+  233, 163, 158, 233, 163, 159, 233, 163, 160, 233, 165, 163, 233, 169, 172, 233,
+  172, 188, 233, 177, 188, 233, 186, 166, 233, 187, 132, 230, 150, 137, 233, 189,
+  144, 230, 173, 175, 233, 189, 191, 231, 171, 156, 233, 190, 153, 228, 186, 128,
+  233, 190, 159, 228, 185, 153, 228, 186, 133, 228, 186, 140, 228, 186, 160, 228,
+  186, 186, 229, 132, 191, 229, 133, 165, 229, 133, 171, 229, 134, 130, 229, 134,
+  150, 229, 134, 171, 229, 135, 160, 229, 135, 181, 229, 136, 128, 229, 138, 155,
+  229, 139, 185, 229, 140, 149, 229, 140, 154, 229, 140, 184, 229, 141, 129, 229,
+  141, 156, 229, 141, 169, 229, 142, 130, 229, 142, 182, 229, 143, 136, 229, 143,
+  163, 229, 156, 159, 229, 164, 130, 229, 164, 138, 229, 164, 149, 229, 164, 167,
+  229, 165, 179, 229, 173, 144, 229, 174, 128, 229, 175, 184, 229, 176, 143, 229,
+  176, 184, 229, 177, 174, 229, 177, 177, 229, 183, 155, 229, 183, 165, 229, 183,
+  177, 229, 183, 190, 229, 185, 178, 229, 185, 191, 229, 187, 180, 229, 187, 190,
+  229, 188, 139, 229, 188, 147, 229, 189, 144, 229, 189, 161, 229, 189, 179, 229,
+  191, 131, 230, 136, 136, 230, 136, 182, 230, 137, 139, 230, 148, 175, 230, 148,
+  180, 230, 150, 135, 230, 150, 151, 230, 150, 164, 230, 150, 185, 230, 151, 160,
+  230, 151, 165, 230, 155, 176, 230, 156, 136, 230, 156, 168, 230, 172, 160, 230,
+  173, 162, 230, 173, 185, 230, 174, 179, 230, 175, 139, 230, 175, 148, 230, 175,
+  155, 230, 176, 143, 230, 176, 148, 230, 176, 180, 231, 129, 171, 231, 136, 170,
+  231, 136, 182, 231, 136, 187, 231, 136, 191, 231, 137, 135, 231, 137, 153, 231,
+  137, 155, 231, 138, 172, 231, 142, 132, 231, 142, 137, 231, 147, 156, 231, 147,
+  166, 231, 148, 152, 231, 148, 159, 231, 148, 168, 231, 148, 176, 231, 150, 139,
+  231, 150, 146, 231, 153, 182, 231, 153, 189, 231, 154, 174, 231, 154, 191, 231,
+  155, 174, 231, 159, 155, 231, 159, 162, 231, 159, 179, 231, 164, 186, 231, 166,
+  184, 231, 166, 190, 231, 169, 180, 231, 171, 139, 231, 171, 185, 231, 177, 179,
+  231, 179, 184, 231, 188, 182, 231, 189, 145, 231, 190, 138, 231, 190, 189, 232,
+  128, 129, 232, 128, 140, 232, 128, 146, 232, 128, 179, 232, 129, 191, 232, 130,
+  137, 232, 135, 163, 232, 135, 170, 232, 135, 179, 232, 135, 188, 232, 136, 140,
+  232, 136, 155, 232, 136, 159, 232, 137, 174, 232, 137, 178, 232, 137, 184, 232,
+  153, 141, 232, 153, 171, 232, 161, 128, 232, 161, 140, 232, 161, 163, 232, 165,
+  190, 232, 166, 139, 232, 167, 146, 232, 168, 128, 232, 176, 183, 232, 177, 134,
+  232, 177, 149, 232, 177, 184, 232, 178, 157, 232, 181, 164, 232, 181, 176, 232,
+  182, 179, 232, 186, 171, 232, 187, 138, 232, 190, 155, 232, 190, 176, 232, 190,
+  181, 233, 130, 145, 233, 133, 137, 233, 135, 134, 233, 135, 140, 233, 135, 145,
+  233, 150, 128, 233, 152, 156, 233, 154, 182, 233, 154, 185, 233, 155, 168, 233,
+  157, 145, 233, 157, 158, 233, 157, 162, 233, 157, 169, 233, 159, 139, 233, 159,
+  173, 233, 159, 179, 233, 160, 129, 233, 162, 168, 233, 163, 155, 233, 166, 150,
+  233, 166, 153, 233, 166, 172, 233, 170, 168, 233, 171, 152, 233, 171, 159, 233,
+  172, 165, 233, 172, 175, 233, 172, 178, 233, 173, 154, 233, 179, 165, 233, 185,
+  181, 233, 185, 191, 233, 186, 165, 233, 186, 187, 233, 187, 131, 233, 187, 141,
+  233, 187, 145, 233, 187, 185, 233, 187, 189, 233, 188, 142, 233, 188, 147, 233,
+  188, 160, 233, 188, 187, 233, 189, 138, 233, 189, 146, 233, 190, 141, 233, 190,
+  156, 233, 190, 160, 203, 179, 226, 130, 184, 226, 159, 166, 226, 159, 167, 227,
+  128, 170, 227, 128, 171, 204, 137, 204, 165, 227, 128, 174, 227, 128, 175, 229,
+  141, 132, 229, 141, 133, 227, 129, 139, 227, 130, 153, 227, 129, 141, 227, 130,
+  153, 227, 129, 143, 227, 130, 153, 227, 129, 145, 227, 130, 153, 227, 129, 147,
+  227, 130, 153, 227, 129, 149, 227, 130, 153, 227, 129, 151, 227, 130, 153, 227,
+  129, 153, 227, 130, 153, 227, 129, 155, 227, 130, 153, 227, 129, 157, 227, 130,
+  153, 227, 129, 159, 227, 130, 153, 227, 129, 161, 227, 130, 153, 227, 129, 164,
+  227, 130, 153, 227, 129, 166, 227, 130, 153, 227, 129, 168, 227, 130, 153, 227,
+  129, 175, 227, 130, 153, 227, 129, 175, 227, 130, 154, 227, 129, 178, 227, 130,
+  153, 227, 129, 178, 227, 130, 154, 227, 129, 181, 227, 130, 153, 227, 129, 181,
+  227, 130, 154, 227, 129, 184, 227, 130, 153, 227, 129, 184, 227, 130, 154, 227,
+  129, 187, 227, 130, 153, 227, 129, 187, 227, 130, 154, 227, 129, 134, 227, 130,
+  153, 227, 130, 153, 204, 138, 239, 190, 158, 239, 190, 159, 227, 130, 157, 227,
+  130, 153, 227, 130, 171, 227, 130, 153, 227, 130, 173, 227, 130, 153, 227, 130,
+  175, 227, 130, 153, 227, 130, 177, 227, 130, 153, 227, 130, 179, 227, 130, 153,
+  227, 130, 181, 227, 130, 153, 227, 130, 183, 227, 130, 153, 227, 130, 185, 227,
+  130, 153, 227, 130, 187, 227, 130, 153, 227, 130, 189, 227, 130, 153, 227, 130,
+  191, 227, 130, 153, 227, 131, 129, 227, 130, 153, 227, 131, 132, 227, 130, 153,
+  227, 131, 134, 227, 130, 153, 227, 131, 136, 227, 130, 153, 227, 131, 143, 227,
+  130, 153, 227, 131, 143, 227, 130, 154, 227, 131, 146, 227, 130, 153, 227, 131,
+  146, 227, 130, 154, 227, 131, 149, 227, 130, 153, 227, 131, 149, 227, 130, 154,
+  227, 129, 184, 227, 131, 152, 227, 130, 153, 227, 131, 152, 227, 130, 154, 227,
+  131, 155, 227, 130, 153, 227, 131, 155, 227, 130, 154, 227, 130, 166, 227, 130,
+  153, 227, 131, 175, 227, 130, 153, 227, 131, 176, 227, 130, 153, 227, 131, 177,
+  227, 130, 153, 227, 131, 178, 227, 130, 153, 227, 131, 189, 227, 130, 153, 225,
+  133, 161, 225, 133, 163, 225, 133, 165, 225, 133, 167, 225, 133, 169, 225, 133,
+  173, 225, 133, 174, 225, 133, 178, 225, 133, 160, 225, 134, 158, 40, 225, 132,
+  128, 41, 40, 225, 132, 130, 41, 40, 225, 132, 131, 41, 40, 225, 132, 133,
+  41, 40, 225, 132, 134, 41, 40, 225, 132, 135, 41, 40, 225, 132, 137, 41,
+  40, 225, 132, 139, 41, 40, 225, 132, 140, 41, 40, 225, 132, 142, 41, 40,
+  225, 132, 143, 41, 40, 225, 132, 144, 41, 40, 225, 132, 145, 41, 40, 225,
+  132, 146, 41, 40, 225, 132, 128, 225, 133, 161, 41, 40, 225, 132, 130, 225,
+  133, 161, 41, 40, 225, 132, 131, 225, 133, 161, 41, 40, 225, 132, 133, 225,
+  133, 161, 41, 40, 225, 132, 134, 225, 133, 161, 41, 40, 225, 132, 135, 225,
+  133, 161, 41, 40, 225, 132, 137, 225, 133, 161, 41, 40, 225, 132, 139, 225,
+  133, 161, 41, 40, 225, 132, 140, 225, 133, 161, 41, 40, 225, 132, 142, 225,
+  133, 161, 41, 40, 225, 132, 143, 225, 133, 161, 41, 40, 225, 132, 144, 225,
+  133, 161, 41, 40, 225, 132, 145, 225, 133, 161, 41, 40, 225, 132, 146, 225,
+  133, 161, 41, 40, 225, 132, 140, 225, 133, 174, 41, 40, 225, 132, 139, 225,
+  133, 169, 225, 132, 140, 225, 133, 165, 225, 134, 171, 41, 40, 225, 132, 139,
+  225, 133, 169, 225, 132, 146, 225, 133, 174, 41, 40, 227, 131, 188, 41, 40,
+  228, 186, 140, 41, 40, 228, 184, 137, 41, 40, 229, 155, 155, 41, 40, 228,
+  186, 148, 41, 40, 229, 133, 173, 41, 40, 228, 184, 131, 41, 40, 229, 133,
+  171, 41, 40, 228, 185, 157, 41, 40, 229, 141, 129, 41, 40, 230, 156, 136,
+  41, 40, 231, 129, 171, 41, 40, 230, 176, 180, 41, 40, 230, 156, 168, 41,
+  40, 233, 135, 145, 41, 40, 229, 156, 159, 41, 40, 230, 151, 165, 41, 40,
+  230, 160, 170, 41, 40, 230, 156, 137, 41, 40, 231, 164, 190, 41, 40, 229,
+  144, 141, 41, 40, 231, 137, 185, 41, 40, 232, 178, 161, 41, 40, 231, 165,
+  157, 41, 40, 229, 138, 180, 41, 40, 228, 187, 163, 41, 40, 229, 145, 188,
+  41, 40, 229, 173, 166, 41, 40, 231, 155, 163, 41, 40, 228, 188, 129, 41,
+  40, 232, 179, 135, 41, 40, 229, 141, 148, 41, 40, 231, 165, 173, 41, 40,
+  228, 188, 145, 41, 40, 232, 135, 170, 41, 40, 232, 135, 179, 41, 108, 230,
+  156, 136, 50, 230, 156, 136, 51, 230, 156, 136, 52, 230, 156, 136, 53, 230,
+  156, 136, 54, 230, 156, 136, 55, 230, 156, 136, 56, 230, 156, 136, 57, 230,
+  156, 136, 108, 79, 230, 156, 136, 108, 108, 230, 156, 136, 108, 50, 230, 156,
+  136, 79, 231, 130, 185, 108, 231, 130, 185, 50, 231, 130, 185, 51, 231, 130,
+  185, 52, 231, 130, 185, 53, 231, 130, 185, 54, 231, 130, 185, 55, 231, 130,
+  185, 56, 231, 130, 185, 57, 231, 130, 185, 108, 79, 231, 130, 185, 108, 108,
+  231, 130, 185, 108, 50, 231, 130, 185, 108, 51, 231, 130, 185, 108, 52, 231,
+  130, 185, 108, 53, 231, 130, 185, 108, 54, 231, 130, 185, 108, 55, 231, 130,
+  185, 108, 56, 231, 130, 185, 108, 57, 231, 130, 185, 50, 79, 231, 130, 185,
+  50, 108, 231, 130, 185, 50, 50, 231, 130, 185, 50, 51, 231, 130, 185, 50,
+  52, 231, 130, 185, 108, 230, 151, 165, 50, 230, 151, 165, 51, 230, 151, 165,
+  52, 230, 151, 165, 53, 230, 151, 165, 54, 230, 151, 165, 55, 230, 151, 165,
+  56, 230, 151, 165, 57, 230, 151, 165, 108, 79, 230, 151, 165, 108, 108, 230,
+  151, 165, 108, 50, 230, 151, 165, 108, 51, 230, 151, 165, 108, 52, 230, 151,
+  165, 108, 53, 230, 151, 165, 108, 54, 230, 151, 165, 108, 55, 230, 151, 165,
+  108, 56, 230, 151, 165, 108, 57, 230, 151, 165, 50, 79, 230, 151, 165, 50,
+  108, 230, 151, 165, 50, 50, 230, 151, 165, 50, 51, 230, 151, 165, 50, 52,
+  230, 151, 165, 50, 53, 230, 151, 165, 50, 54, 230, 151, 165, 50, 55, 230,
+  151, 165, 50, 56, 230, 151, 165, 50, 57, 230, 151, 165, 51, 79, 230, 151,
+  165, 51, 108, 230, 151, 165, 227, 152, 189, 227, 150, 136, 227, 172, 187, 228,
+  189, 181, 229, 128, 164, 229, 149, 147, 229, 161, 161, 229, 162, 171, 229, 170,
+  175, 229, 184, 161, 227, 172, 186, 227, 169, 129, 228, 128, 191, 230, 153, 154,
+  227, 171, 154, 228, 145, 131, 230, 157, 174, 227, 174, 163, 230, 166, 157, 230,
+  186, 136, 231, 160, 148, 231, 181, 149, 230, 156, 140, 230, 156, 144, 230, 156,
+  143, 227, 172, 181, 230, 156, 147, 230, 156, 152, 232, 131, 188, 230, 156, 163,
+  232, 146, 141, 232, 152, 183, 228, 154, 182, 232, 168, 174, 232, 174, 134, 232,
+  177, 156, 232, 181, 191, 232, 183, 165, 232, 186, 151, 232, 187, 191, 233, 131,
+  142, 233, 142, 173, 233, 154, 183, 233, 185, 130, 228, 128, 185, 234, 139, 141,
+  234, 131, 128, 234, 129, 138, 234, 145, 152, 234, 132, 178, 234, 129, 144, 234,
+  143, 130, 234, 142, 191, 234, 138, 177, 234, 137, 153, 234, 142, 171, 234, 142,
+  181, 225, 153, 160, 225, 151, 161, 46, 44, 45, 46, 208, 170, 108, 203, 137,
+  98, 105, 234, 153, 180, 234, 153, 181, 234, 153, 182, 234, 153, 183, 234, 153,
+  184, 234, 153, 185, 234, 153, 186, 234, 153, 187, 234, 153, 189, 79, 79, 234,
+  154, 158, 234, 154, 159, 225, 154, 185, 202, 161, 234, 155, 179, 234, 155, 179,
+  203, 171, 84, 51, 116, 200, 157, 65, 65, 97, 97, 65, 79, 97, 111, 65,
+  85, 97, 117, 65, 86, 97, 118, 65, 89, 97, 121, 119, 204, 166, 116, 102,
+  38, 234, 157, 185, 234, 156, 167, 240, 144, 144, 146, 240, 144, 144, 186, 202,
+  154, 234, 147, 164, 234, 153, 140, 234, 160, 134, 234, 160, 172, 224, 165, 164,
+  234, 163, 132, 234, 163, 160, 234, 163, 161, 234, 163, 162, 234, 163, 163, 234,
+  163, 164, 234, 163, 165, 234, 163, 166, 234, 163, 167, 234, 163, 168, 234, 163,
+  169, 234, 163, 170, 234, 163, 171, 234, 163, 172, 234, 163, 173, 234, 163, 174,
+  234, 163, 175, 234, 163, 176, 234, 163, 177, 234, 164, 171, 234, 164, 172, 234,
+  164, 173, 234, 165, 147, 225, 132, 131, 225, 132, 134, 225, 132, 131, 225, 132,
+  135, 225, 132, 131, 225, 132, 137, 225, 132, 131, 225, 132, 140, 225, 132, 133,
+  225, 132, 128, 225, 132, 128, 225, 132, 133, 225, 132, 131, 225, 132, 131, 225,
+  132, 133, 225, 132, 135, 225, 132, 135, 225, 132, 133, 225, 132, 140, 225, 132,
+  134, 225, 132, 131, 225, 132, 135, 225, 132, 137, 225, 132, 144, 225, 132, 135,
+  225, 132, 143, 225, 132, 137, 225, 132, 137, 225, 132, 135, 225, 132, 139, 225,
+  132, 133, 225, 132, 139, 225, 132, 146, 225, 132, 140, 225, 132, 140, 225, 132,
+  146, 225, 132, 144, 225, 132, 144, 225, 132, 145, 225, 132, 146, 225, 132, 146,
+  225, 132, 137, 225, 133, 153, 225, 133, 153, 226, 176, 191, 234, 166, 157, 234,
+  166, 179, 234, 167, 128, 234, 167, 144, 234, 168, 129, 234, 168, 163, 234, 170,
+  176, 234, 170, 178, 234, 170, 179, 234, 170, 180, 234, 170, 183, 234, 170, 184,
+  234, 170, 190, 234, 170, 191, 234, 171, 129, 234, 171, 182, 201, 148, 204, 184,
+  199, 157, 111, 204, 184, 199, 157, 111, 204, 181, 209, 153, 201, 148, 101, 117,
+  111, 225, 180, 133, 202, 128, 111, 204, 155, 225, 180, 128, 225, 180, 138, 225,
+  180, 135, 201, 130, 226, 177, 182, 234, 175, 173, 225, 133, 169, 225, 133, 167,
+  225, 133, 169, 225, 133, 169, 228, 184, 168, 225, 133, 173, 225, 133, 161, 225,
+  133, 173, 225, 133, 161, 228, 184, 168, 225, 133, 173, 225, 133, 165, 225, 133,
+  174, 225, 133, 167, 225, 133, 174, 228, 184, 168, 228, 184, 168, 225, 133, 178,
+  225, 133, 161, 228, 184, 168, 225, 133, 178, 225, 133, 169, 227, 131, 188, 225,
+  133, 161, 227, 131, 188, 225, 133, 165, 227, 131, 188, 225, 133, 165, 228, 184,
+  168, 227, 131, 188, 225, 133, 169, 228, 184, 168, 225, 133, 163, 225, 133, 169,
+  228, 184, 168, 225, 133, 163, 228, 184, 168, 228, 184, 168, 225, 133, 167, 228,
+  184, 168, 225, 133, 167, 228, 184, 168, 228, 184, 168, 225, 133, 169, 228, 184,
+  168, 228, 184, 168, 225, 133, 173, 228, 184, 168, 225, 133, 178, 228, 184, 168,
+  228, 184, 168, 225, 134, 158, 225, 133, 161, 225, 134, 158, 225, 133, 165, 228,
+  184, 168, 225, 132, 130, 225, 132, 133, 225, 132, 130, 225, 132, 142, 225, 132,
+  131, 225, 132, 131, 225, 132, 135, 225, 132, 131, 225, 132, 137, 225, 132, 128,
+  225, 132, 131, 225, 132, 142, 225, 132, 131, 225, 132, 144, 225, 132, 133, 225,
+  132, 128, 225, 132, 146, 225, 132, 133, 225, 132, 133, 225, 132, 143, 225, 132,
+  133, 225, 132, 134, 225, 132, 146, 225, 132, 133, 225, 132, 135, 225, 132, 131,
+  225, 132, 133, 225, 132, 135, 225, 132, 145, 225, 132, 133, 225, 133, 140, 225,
+  132, 133, 225, 133, 153, 225, 132, 146, 225, 132, 134, 225, 132, 130, 225, 132,
+  134, 225, 132, 130, 225, 132, 130, 225, 132, 134, 225, 132, 134, 225, 132, 134,
+  225, 132, 135, 225, 132, 137, 225, 132, 134, 225, 132, 140, 225, 132, 135, 225,
+  132, 133, 225, 132, 145, 225, 132, 135, 225, 132, 134, 225, 132, 137, 225, 132,
+  135, 225, 132, 139, 225, 132, 137, 225, 132, 137, 225, 132, 128, 225, 132, 137,
+  225, 132, 137, 225, 132, 131, 225, 132, 137, 225, 133, 128, 225, 133, 128, 225,
+  132, 135, 225, 133, 128, 225, 132, 135, 225, 132, 139, 225, 133, 140, 225, 132,
+  134, 225, 133, 140, 225, 132, 146, 225, 132, 140, 225, 132, 135, 225, 132, 140,
+  225, 132, 135, 225, 132, 135, 225, 132, 145, 225, 132, 137, 225, 132, 145, 225,
+  132, 144, 232, 177, 136, 230, 155, 180, 232, 187, 138, 232, 179, 136, 230, 187,
+  145, 228, 184, 178, 229, 143, 165, 233, 190, 156, 229, 165, 145, 233, 135, 145,
+  229, 150, 135, 229, 165, 136, 230, 135, 182, 231, 153, 169, 231, 190, 133, 232,
+  152, 191, 232, 158, 186, 232, 163, 184, 233, 130, 143, 230, 168, 130, 230, 180,
+  155, 231, 131, 153, 231, 143, 158, 232, 144, 189, 233, 133, 170, 233, 167, 177,
+  228, 186, 130, 229, 141, 181, 230, 172, 132, 231, 136, 155, 232, 152, 173, 233,
+  184, 158, 229, 181, 144, 230, 191, 171, 232, 151, 141, 232, 165, 164, 230, 139,
+  137, 232, 135, 152, 232, 160, 159, 229, 187, 138, 230, 156, 151, 230, 181, 170,
+  231, 139, 188, 233, 131, 142, 228, 190, 134, 229, 134, 183, 229, 139, 158, 230,
+  147, 132, 230, 171, 147, 231, 136, 144, 231, 155, 167, 232, 128, 129, 232, 152,
+  134, 232, 153, 156, 232, 183, 175, 233, 156, 178, 233, 173, 175, 233, 183, 186,
+  231, 162, 140, 231, 165, 191, 231, 182, 160, 232, 143, 137, 233, 140, 132, 233,
+  185, 191, 232, 171, 150, 229, 163, 159, 229, 188, 132, 231, 177, 160, 232, 129,
+  190, 231, 137, 162, 231, 163, 138, 232, 179, 130, 233, 155, 183, 229, 163, 152,
+  229, 177, 162, 230, 168, 147, 230, 183, 154, 230, 188, 143, 231, 180, 175, 231,
+  184, 183, 233, 153, 139, 229, 139, 146, 232, 130, 139, 229, 135, 156, 229, 135,
+  140, 231, 168, 156, 231, 182, 190, 232, 143, 177, 233, 153, 181, 232, 174, 128,
+  230, 139, 143, 232, 171, 190, 228, 184, 185, 229, 175, 167, 230, 128, 146, 231,
+  142, 135, 231, 149, 176, 229, 140, 151, 231, 163, 187, 228, 190, 191, 229, 190,
+  169, 228, 184, 141, 230, 179, 140, 230, 149, 184, 231, 180, 162, 229, 143, 131,
+  229, 161, 158, 231, 156, 129, 232, 145, 137, 232, 170, 170, 230, 174, 186, 232,
+  190, 176, 230, 178, 136, 230, 139, 190, 232, 139, 165, 230, 142, 160, 231, 149,
+  165, 228, 186, 174, 229, 133, 169, 229, 135, 137, 230, 162, 129, 231, 179, 167,
+  232, 137, 175, 232, 171, 146, 233, 135, 143, 229, 139, 181, 229, 145, 130, 229,
+  165, 179, 229, 187, 172, 230, 151, 133, 230, 191, 190, 231, 164, 170, 233, 150,
+  173, 233, 169, 170, 233, 186, 151, 233, 187, 142, 229, 138, 155, 230, 155, 134,
+  230, 173, 183, 232, 189, 162, 229, 185, 180, 230, 134, 144, 230, 136, 128, 230,
+  146, 154, 230, 188, 163, 231, 133, 137, 231, 146, 137, 231, 167, 138, 231, 183,
+  180, 232, 129, 175, 232, 188, 166, 232, 147, 174, 233, 128, 163, 233, 141, 138,
+  229, 136, 151, 229, 138, 163, 229, 146, 189, 231, 131, 136, 232, 163, 130, 229,
+  187, 137, 229, 191, 181, 230, 141, 187, 230, 174, 174, 231, 176, 190, 231, 141,
+  181, 228, 187, 164, 229, 155, 185, 229, 182, 186, 230, 128, 156, 231, 142, 178,
+  231, 145, 169, 231, 190, 154, 232, 129, 134, 233, 136, 180, 233, 155, 182, 233,
+  157, 136, 233, 160, 152, 228, 190, 139, 231, 166, 174, 233, 134, 180, 233, 154,
+  184, 230, 131, 161, 228, 186, 134, 229, 131, 154, 229, 175, 174, 229, 176, 191,
+  230, 150, 153, 231, 135, 142, 231, 153, 130, 232, 147, 188, 233, 129, 188, 233,
+  190, 141, 230, 154, 136, 233, 152, 174, 229, 138, 137, 230, 157, 187, 230, 159,
+  179, 230, 181, 129, 230, 186, 156, 231, 144, 137, 231, 149, 153, 231, 161, 171,
+  231, 180, 144, 233, 161, 158, 229, 133, 173, 230, 136, 174, 233, 153, 184, 229,
+  128, 171, 229, 180, 153, 230, 183, 170, 232, 188, 170, 229, 190, 139, 230, 133,
+  132, 230, 160, 151, 233, 154, 134, 229, 136, 169, 229, 144, 143, 229, 177, 165,
+  230, 152, 147, 230, 157, 142, 230, 162, 168, 230, 179, 165, 231, 144, 134, 231,
+  151, 162, 231, 189, 185, 232, 163, 143, 232, 163, 161, 233, 135, 140, 233, 155,
+  162, 229, 140, 191, 230, 186, 186, 229, 144, 157, 231, 135, 144, 231, 146, 152,
+  232, 151, 186, 233, 154, 163, 233, 177, 151, 233, 186, 159, 230, 158, 151, 230,
+  183, 139, 232, 135, 168, 231, 171, 139, 231, 172, 160, 231, 178, 146, 231, 139,
+  128, 231, 130, 153, 232, 173, 152, 228, 187, 128, 232, 140, 182, 229, 136, 186,
+  229, 136, 135, 229, 186, 166, 230, 139, 147, 231, 179, 150, 229, 174, 133, 230,
+  180, 158, 230, 154, 180, 232, 188, 187, 232, 161, 140, 233, 153, 141, 232, 166,
+  139, 229, 187, 147, 229, 133, 128, 229, 151, 128, 229, 161, 154, 230, 153, 180,
+  229, 135, 158, 231, 140, 170, 231, 155, 138, 231, 164, 188, 231, 165, 158, 231,
+  165, 165, 231, 166, 143, 233, 157, 150, 231, 178, 190, 231, 190, 189, 232, 152,
+  146, 232, 171, 184, 233, 128, 184, 233, 131, 189, 233, 163, 175, 233, 163, 188,
+  233, 164, 168, 233, 182, 180, 233, 131, 158, 233, 154, 183, 228, 190, 174, 229,
+  131, 167, 229, 133, 141, 229, 139, 137, 229, 139, 164, 229, 141, 145, 229, 150,
+  157, 229, 152, 134, 229, 153, 168, 229, 161, 128, 229, 162, 168, 229, 177, 164,
+  229, 177, 174, 230, 130, 148, 230, 133, 168, 230, 134, 142, 230, 135, 178, 230,
+  149, 143, 230, 151, 162, 230, 154, 145, 230, 162, 133, 230, 181, 183, 230, 184,
+  154, 230, 188, 162, 231, 133, 174, 231, 136, 171, 231, 144, 162, 231, 162, 145,
+  231, 164, 190, 231, 165, 137, 231, 165, 136, 231, 165, 144, 231, 165, 150, 231,
+  165, 157, 231, 166, 141, 231, 166, 142, 231, 169, 128, 231, 170, 129, 231, 175,
+  128, 231, 184, 137, 231, 185, 129, 231, 189, 178, 232, 128, 133, 232, 135, 173,
+  232, 137, 185, 232, 145, 151, 232, 164, 144, 232, 166, 150, 232, 172, 129, 232,
+  172, 185, 232, 179, 147, 232, 180, 136, 232, 190, 182, 233, 155, 163, 233, 159,
+  191, 233, 160, 187, 230, 129, 181, 240, 164, 139, 174, 232, 136, 152, 228, 184,
+  166, 229, 134, 181, 229, 133, 168, 228, 190, 128, 229, 133, 133, 229, 134, 128,
+  229, 139, 135, 229, 139, 186, 229, 149, 149, 229, 150, 153, 229, 151, 162, 229,
+  162, 179, 229, 165, 132, 229, 165, 148, 229, 169, 162, 229, 172, 168, 229, 187,
+  146, 229, 187, 153, 229, 189, 169, 229, 190, 173, 230, 131, 152, 230, 133, 142,
+  230, 132, 136, 230, 133, 160, 230, 136, 180, 230, 143, 132, 230, 144, 156, 230,
+  145, 146, 230, 149, 150, 230, 156, 155, 230, 157, 150, 230, 173, 185, 230, 187,
+  155, 230, 187, 139, 231, 128, 158, 231, 158, 167, 231, 136, 181, 231, 138, 175,
+  231, 145, 177, 231, 148, 134, 231, 148, 187, 231, 152, 157, 231, 152, 159, 231,
+  155, 155, 231, 155, 180, 231, 157, 138, 231, 157, 128, 231, 163, 140, 231, 170,
+  177, 231, 177, 187, 231, 181, 155, 231, 188, 190, 232, 141, 146, 232, 143, 175,
+  232, 157, 185, 232, 165, 129, 232, 166, 134, 232, 170, 191, 232, 171, 139, 232,
+  171, 173, 232, 174, 138, 232, 188, 184, 233, 129, 178, 233, 134, 153, 233, 137,
+  182, 233, 153, 188, 233, 159, 155, 233, 160, 139, 233, 172, 146, 240, 162, 161,
+  138, 240, 162, 161, 132, 240, 163, 143, 149, 227, 174, 157, 228, 128, 152, 228,
+  128, 185, 240, 165, 137, 137, 240, 165, 179, 144, 240, 167, 187, 147, 233, 189,
+  131, 233, 190, 142, 102, 102, 102, 105, 102, 108, 102, 102, 105, 102, 102, 108,
+  115, 116, 213, 180, 213, 182, 213, 180, 213, 165, 213, 180, 213, 171, 213, 190,
+  213, 182, 213, 180, 213, 173, 215, 153, 214, 180, 239, 172, 158, 215, 178, 214,
+  183, 215, 162, 215, 148, 215, 155, 215, 156, 215, 157, 215, 168, 215, 170, 215,
+  169, 215, 129, 215, 169, 215, 130, 215, 169, 214, 188, 215, 129, 215, 169, 214,
+  188, 215, 130, 215, 144, 214, 183, 215, 144, 214, 184, 215, 144, 214, 188, 215,
+  145, 214, 188, 215, 146, 214, 188, 215, 147, 214, 188, 215, 148, 214, 188, 215,
+  149, 214, 188, 215, 150, 214, 188, 215, 152, 214, 188, 215, 153, 214, 188, 215,
+  154, 214, 188, 215, 155, 214, 188, 215, 156, 214, 188, 215, 158, 214, 188, 215,
+  160, 214, 188, 215, 161, 214, 188, 215, 163, 214, 188, 215, 164, 214, 188, 215,
+  166, 214, 188, 215, 167, 214, 188, 215, 168, 214, 188, 215, 169, 214, 188, 215,
+  170, 214, 188, 215, 149, 214, 185, 215, 145, 214, 191, 215, 155, 214, 191, 215,
+  164, 214, 191, 215, 144, 215, 156, 217, 177, 218, 128, 217, 186, 217, 191, 218,
+  166, 218, 132, 218, 131, 218, 134, 218, 135, 218, 141, 218, 140, 218, 179, 218,
+  177, 219, 149, 217, 148, 219, 146, 217, 148, 219, 133, 217, 137, 217, 180, 108,
+  217, 137, 217, 180, 111, 217, 137, 217, 180, 217, 136, 217, 137, 217, 180, 217,
+  136, 204, 147, 217, 137, 217, 180, 217, 136, 204, 134, 217, 137, 217, 180, 217,
+  136, 217, 176, 217, 137, 217, 180, 217, 187, 217, 137, 217, 180, 217, 137, 217,
+  137, 217, 180, 216, 172, 217, 137, 217, 180, 216, 173, 217, 137, 217, 180, 217,
+  133, 216, 168, 216, 172, 216, 168, 216, 173, 216, 168, 216, 174, 216, 168, 217,
+  133, 216, 168, 217, 137, 216, 170, 216, 172, 216, 170, 216, 173, 216, 170, 216,
+  174, 216, 170, 217, 133, 216, 170, 217, 137, 217, 137, 219, 155, 216, 172, 217,
+  137, 219, 155, 217, 133, 217, 137, 219, 155, 217, 137, 216, 172, 216, 173, 216,
+  172, 217, 133, 216, 173, 216, 172, 216, 173, 217, 133, 216, 174, 216, 172, 216,
+  174, 216, 173, 216, 174, 217, 133, 216, 179, 216, 172, 216, 179, 216, 173, 216,
+  179, 216, 174, 216, 179, 217, 133, 216, 181, 216, 173, 216, 181, 217, 133, 216,
+  182, 216, 172, 216, 182, 216, 173, 216, 182, 216, 174, 216, 182, 217, 133, 216,
+  183, 216, 173, 216, 183, 217, 133, 216, 184, 217, 133, 216, 185, 216, 172, 216,
+  185, 217, 133, 216, 186, 216, 172, 216, 186, 217, 133, 217, 129, 216, 172, 217,
+  129, 216, 173, 217, 129, 216, 174, 217, 129, 217, 133, 217, 129, 217, 137, 217,
+  130, 216, 173, 217, 130, 217, 133, 217, 130, 217, 137, 217, 131, 108, 217, 131,
+  216, 172, 217, 131, 216, 173, 217, 131, 216, 174, 217, 131, 217, 132, 217, 131,
+  217, 133, 217, 131, 217, 137, 217, 132, 216, 172, 217, 132, 216, 173, 217, 132,
+  216, 174, 217, 132, 217, 133, 217, 132, 217, 137, 217, 133, 216, 172, 217, 133,
+  216, 173, 217, 133, 216, 174, 217, 133, 217, 133, 217, 133, 217, 137, 217, 134,
+  216, 173, 217, 134, 216, 174, 217, 134, 217, 133, 217, 134, 217, 137, 111, 216,
+  172, 111, 217, 133, 111, 217, 137, 217, 137, 216, 172, 217, 137, 216, 173, 217,
+  137, 216, 174, 217, 137, 217, 133, 217, 137, 217, 137, 216, 176, 217, 176, 216,
+  177, 217, 176, 217, 137, 217, 176, 239, 185, 178, 217, 145, 239, 185, 180, 217,
+  145, 239, 185, 182, 217, 145, 239, 185, 184, 217, 145, 239, 185, 186, 217, 145,
+  239, 185, 188, 217, 176, 217, 137, 217, 180, 216, 177, 217, 137, 217, 180, 216,
+  178, 217, 137, 217, 180, 217, 134, 216, 168, 216, 177, 216, 168, 216, 178, 216,
+  168, 217, 134, 216, 170, 216, 177, 216, 170, 216, 178, 216, 170, 217, 134, 217,
+  137, 219, 155, 216, 177, 217, 137, 219, 155, 216, 178, 217, 137, 219, 155, 217,
+  134, 217, 133, 108, 217, 134, 216, 177, 217, 134, 216, 178, 217, 134, 217, 134,
+  217, 137, 216, 177, 217, 137, 216, 178, 217, 137, 217, 134, 217, 137, 217, 180,
+  216, 174, 216, 168, 111, 216, 170, 111, 216, 181, 216, 174, 217, 132, 111, 217,
+  134, 111, 111, 217, 176, 217, 137, 111, 217, 137, 219, 155, 111, 216, 179, 111,
+  216, 179, 219, 155, 217, 133, 216, 179, 219, 155, 111, 239, 185, 183, 217, 145,
+  239, 185, 185, 217, 145, 239, 185, 187, 217, 145, 216, 183, 217, 137, 216, 185,
+  217, 137, 216, 186, 217, 137, 216, 179, 217, 137, 216, 179, 219, 155, 217, 137,
+  216, 173, 217, 137, 216, 172, 217, 137, 216, 174, 217, 137, 216, 181, 217, 137,
+  216, 182, 217, 137, 216, 179, 219, 155, 216, 172, 216, 179, 219, 155, 216, 173,
+  216, 179, 219, 155, 216, 174, 216, 179, 219, 155, 216, 177, 216, 179, 216, 177,
+  216, 181, 216, 177, 216, 182, 216, 177, 108, 204, 139, 216, 170, 216, 172, 217,
+  133, 216, 170, 216, 173, 216, 172, 216, 170, 216, 173, 217, 133, 216, 170, 216,
+  174, 217, 133, 216, 170, 217, 133, 216, 172, 216, 170, 217, 133, 216, 173, 216,
+  170, 217, 133, 216, 174, 216, 172, 217, 133, 216, 173, 216, 173, 217, 133, 217,
+  137, 216, 179, 216, 173, 216, 172, 216, 179, 216, 172, 216, 173, 216, 179, 216,
+  172, 217, 137, 216, 179, 217, 133, 216, 173, 216, 179, 217, 133, 216, 172, 216,
+  179, 217, 133, 217, 133, 216, 181, 216, 173, 216, 173, 216, 181, 217, 133, 217,
+  133, 216, 179, 219, 155, 216, 173, 217, 133, 216, 179, 219, 155, 216, 172, 217,
+  137, 216, 179, 219, 155, 217, 133, 216, 174, 216, 179, 219, 155, 217, 133, 217,
+  133, 216, 182, 216, 173, 217, 137, 216, 182, 216, 174, 217, 133, 216, 183, 217,
+  133, 216, 173, 216, 183, 217, 133, 217, 133, 216, 183, 217, 133, 217, 137, 216,
+  185, 216, 172, 217, 133, 216, 185, 217, 133, 217, 133, 216, 185, 217, 133, 217,
+  137, 216, 186, 217, 133, 217, 133, 216, 186, 217, 133, 217, 137, 217, 129, 216,
+  174, 217, 133, 217, 130, 217, 133, 216, 173, 217, 130, 217, 133, 217, 133, 217,
+  132, 216, 173, 217, 133, 217, 132, 216, 173, 217, 137, 217, 132, 216, 172, 216,
+  172, 217, 132, 216, 174, 217, 133, 217, 132, 217, 133, 216, 173, 217, 133, 216,
+  173, 216, 172, 217, 133, 216, 173, 217, 133, 217, 133, 216, 173, 217, 137, 217,
+  133, 216, 172, 216, 173, 217, 133, 216, 172, 217, 133, 217, 133, 216, 174, 216,
+  172, 217, 133, 216, 174, 217, 133, 217, 133, 216, 172, 216, 174, 111, 217, 133,
+  216, 172, 111, 217, 133, 217, 133, 217, 134, 216, 173, 217, 133, 217, 134, 216,
+  173, 217, 137, 217, 134, 216, 172, 217, 133, 217, 134, 216, 172, 217, 137, 217,
+  134, 217, 133, 217, 137, 217, 137, 217, 133, 217, 133, 216, 168, 216, 174, 217,
+  137, 216, 170, 216, 172, 217, 137, 216, 170, 216, 174, 217, 137, 216, 170, 217,
+  133, 217, 137, 216, 172, 217, 133, 217, 137, 216, 172, 216, 173, 217, 137, 216,
+  179, 216, 174, 217, 137, 216, 181, 216, 173, 217, 137, 216, 179, 219, 155, 216,
+  173, 217, 137, 217, 132, 216, 172, 217, 137, 217, 132, 217, 133, 217, 137, 217,
+  137, 216, 173, 217, 137, 217, 137, 216, 172, 217, 137, 217, 137, 217, 133, 217,
+  137, 217, 133, 217, 133, 217, 137, 217, 130, 217, 133, 217, 137, 217, 131, 217,
+  133, 217, 137, 217, 134, 216, 172, 216, 173, 217, 133, 216, 174, 217, 137, 217,
+  132, 216, 172, 217, 133, 217, 131, 217, 133, 217, 133, 216, 173, 216, 172, 217,
+  137, 217, 133, 216, 172, 217, 137, 217, 129, 217, 133, 217, 137, 216, 168, 216,
+  173, 217, 137, 216, 181, 217, 132, 217, 137, 217, 130, 217, 132, 217, 137, 108,
+  217, 132, 217, 132, 217, 145, 217, 176, 111, 108, 217, 131, 216, 168, 216, 177,
+  217, 133, 216, 173, 217, 133, 216, 175, 216, 181, 217, 132, 216, 185, 217, 133,
+  216, 177, 216, 179, 217, 136, 217, 132, 216, 185, 217, 132, 217, 137, 111, 217,
+  136, 216, 179, 217, 132, 217, 133, 216, 181, 217, 132, 217, 137, 32, 108, 217,
+  132, 217, 132, 111, 32, 216, 185, 217, 132, 217, 137, 111, 32, 217, 136, 216,
+  179, 217, 132, 217, 133, 216, 172, 217, 132, 32, 216, 172, 217, 132, 108, 217,
+  132, 111, 216, 177, 217, 137, 108, 217, 132, 239, 184, 160, 239, 184, 161, 239,
+  184, 162, 239, 184, 163, 239, 184, 164, 239, 184, 165, 239, 184, 166, 239, 184,
+  167, 239, 184, 168, 239, 184, 169, 239, 184, 170, 239, 184, 171, 239, 184, 172,
+  239, 184, 173, 239, 184, 174, 239, 184, 175, 226, 140, 135, 226, 143, 156, 226,
+  143, 157, 226, 143, 158, 226, 143, 159, 226, 143, 160, 226, 143, 161, 216, 161,
+  216, 167, 217, 147, 216, 168, 216, 170, 216, 172, 216, 173, 216, 174, 216, 175,
+  216, 176, 216, 177, 216, 178, 216, 179, 216, 181, 216, 182, 216, 183, 216, 184,
+  216, 186, 217, 130, 217, 132, 217, 133, 217, 134, 217, 132, 216, 167, 217, 147,
+  217, 132, 108, 217, 180, 217, 132, 108, 217, 149, 217, 132, 108, 239, 184, 191,
+  227, 128, 156, 226, 150, 170, 78, 204, 138, 88, 204, 181, 86, 204, 181, 108,
+  204, 181, 108, 204, 181, 83, 204, 181, 108, 204, 181, 108, 204, 181, 226, 179,
+  168, 240, 144, 135, 189, 207, 152, 226, 181, 128, 240, 144, 139, 160, 240, 144,
+  141, 182, 240, 144, 141, 183, 240, 144, 141, 184, 240, 144, 141, 185, 240, 144,
+  141, 186, 240, 144, 142, 130, 240, 144, 142, 147, 226, 177, 176, 201, 183, 201,
+  158, 240, 144, 146, 134, 211, 131, 208, 139, 225, 155, 166, 55, 234, 153, 169,
+  240, 144, 168, 141, 240, 144, 168, 143, 240, 144, 168, 184, 240, 144, 168, 185,
+  240, 144, 168, 191, 240, 144, 169, 150, 240, 144, 169, 150, 240, 144, 171, 165,
+  240, 144, 171, 166, 240, 144, 178, 165, 240, 144, 178, 130, 240, 144, 180, 164,
+  240, 144, 180, 165, 240, 144, 180, 166, 240, 144, 180, 167, 240, 144, 186, 171,
+  240, 144, 186, 172, 240, 144, 189, 134, 240, 144, 189, 135, 240, 144, 189, 136,
+  240, 144, 189, 137, 240, 144, 189, 138, 240, 144, 189, 139, 240, 144, 189, 140,
+  240, 144, 189, 141, 240, 144, 189, 142, 240, 144, 189, 143, 240, 144, 189, 144,
+  240, 144, 190, 130, 240, 144, 190, 131, 240, 144, 190, 132, 240, 144, 190, 133,
+  240, 145, 129, 134, 240, 145, 129, 176, 240, 145, 129, 191, 240, 145, 130, 153,
+  240, 145, 130, 186, 240, 145, 130, 155, 240, 145, 130, 186, 240, 145, 130, 165,
+  240, 145, 130, 186, 240, 145, 130, 185, 240, 145, 130, 186, 240, 145, 132, 128,
+  240, 145, 132, 129, 240, 145, 132, 130, 240, 145, 132, 177, 240, 145, 132, 167,
+  240, 145, 132, 178, 240, 145, 132, 167, 240, 145, 132, 179, 240, 145, 132, 180,
+  240, 145, 133, 179, 240, 145, 135, 128, 224, 164, 186, 234, 163, 188, 234, 163,
+  187, 226, 137, 136, 240, 145, 136, 181, 240, 145, 136, 182, 240, 145, 139, 169,
+  240, 145, 139, 170, 240, 145, 140, 187, 240, 145, 140, 188, 240, 145, 141, 135,
+  240, 145, 140, 190, 240, 145, 141, 135, 240, 145, 141, 151, 240, 145, 141, 141,
+  240, 145, 141, 166, 240, 145, 141, 167, 240, 145, 141, 168, 240, 145, 141, 169,
+  240, 145, 141, 170, 240, 145, 141, 171, 240, 145, 141, 172, 240, 145, 141, 176,
+  240, 145, 141, 177, 240, 145, 141, 178, 240, 145, 141, 179, 240, 145, 141, 180,
+  240, 145, 144, 180, 240, 145, 145, 130, 240, 145, 144, 146, 240, 145, 144, 180,
+  240, 145, 145, 130, 240, 145, 144, 152, 240, 145, 144, 180, 240, 145, 145, 130,
+  240, 145, 144, 163, 240, 145, 144, 180, 240, 145, 145, 130, 240, 145, 144, 169,
+  240, 145, 144, 180, 240, 145, 145, 130, 240, 145, 144, 172, 240, 145, 144, 180,
+  240, 145, 145, 130, 240, 145, 144, 174, 240, 145, 145, 130, 240, 145, 145, 134,
+  240, 145, 145, 139, 240, 145, 145, 139, 240, 145, 145, 158, 224, 166, 152, 224,
+  166, 154, 224, 166, 156, 224, 166, 158, 224, 166, 159, 224, 166, 161, 224, 166,
+  178, 224, 166, 164, 224, 166, 165, 224, 166, 166, 224, 166, 167, 224, 166, 168,
+  224, 166, 170, 224, 166, 174, 224, 166, 175, 224, 166, 172, 224, 166, 163, 224,
+  166, 176, 224, 166, 183, 224, 166, 184, 224, 166, 190, 224, 166, 191, 224, 167,
+  135, 240, 145, 146, 185, 240, 145, 146, 186, 240, 145, 146, 185, 240, 145, 146,
+  176, 224, 167, 151, 240, 145, 146, 185, 240, 145, 146, 189, 224, 166, 189, 119,
+  204, 135, 224, 167, 167, 224, 167, 168, 224, 167, 172, 240, 145, 150, 184, 240,
+  145, 150, 175, 240, 145, 150, 185, 240, 145, 150, 175, 240, 145, 150, 191, 240,
+  145, 151, 128, 240, 145, 150, 130, 240, 145, 150, 131, 240, 145, 150, 132, 240,
+  145, 150, 178, 240, 145, 150, 179, 240, 145, 152, 191, 240, 145, 153, 129, 240,
+  145, 153, 129, 240, 145, 154, 182, 240, 145, 154, 183, 240, 145, 156, 171, 240,
+  145, 160, 185, 240, 145, 160, 186, 226, 136, 135, 240, 145, 164, 181, 240, 145,
+  164, 176, 240, 145, 164, 189, 240, 145, 164, 190, 240, 145, 165, 131, 240, 145,
+  167, 160, 240, 145, 168, 180, 240, 145, 169, 135, 240, 145, 170, 153, 240, 145,
+  171, 165, 240, 145, 171, 175, 240, 145, 171, 165, 240, 145, 171, 176, 240, 145,
+  171, 165, 240, 145, 171, 165, 240, 145, 171, 165, 240, 145, 171, 165, 240, 145,
+  171, 175, 240, 145, 171, 165, 240, 145, 171, 165, 240, 145, 171, 176, 240, 145,
+  171, 171, 240, 145, 171, 175, 240, 145, 171, 171, 240, 145, 171, 171, 240, 145,
+  171, 171, 240, 145, 171, 171, 240, 145, 171, 175, 240, 145, 171, 179, 240, 145,
+  171, 175, 240, 145, 171, 179, 240, 145, 171, 176, 240, 145, 171, 179, 240, 145,
+  171, 179, 240, 145, 171, 179, 240, 145, 171, 179, 240, 145, 171, 175, 240, 145,
+  171, 179, 240, 145, 171, 179, 240, 145, 171, 176, 240, 145, 176, 191, 240, 145,
+  177, 129, 240, 145, 177, 129, 240, 145, 178, 170, 240, 145, 181, 130, 240, 145,
+  181, 132, 240, 145, 181, 133, 240, 145, 182, 151, 240, 144, 142, 154, 240, 150,
+  171, 176, 240, 150, 171, 177, 240, 150, 171, 178, 240, 150, 171, 179, 240, 150,
+  171, 180, 240, 150, 172, 176, 240, 150, 172, 177, 240, 150, 172, 178, 240, 150,
+  172, 179, 240, 150, 172, 180, 240, 150, 172, 181, 240, 150, 172, 182, 234, 153,
+  152, 240, 150, 191, 176, 240, 150, 191, 177, 240, 155, 178, 158, 240, 157, 133,
+  151, 240, 157, 133, 165, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133,
+  152, 240, 157, 133, 165, 240, 157, 133, 174, 240, 157, 133, 152, 240, 157, 133,
+  165, 240, 157, 133, 175, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133,
+  176, 240, 157, 133, 152, 240, 157, 133, 165, 240, 157, 133, 177, 240, 157, 133,
+  152, 240, 157, 133, 165, 240, 157, 133, 178, 240, 157, 133, 165, 240, 157, 133,
+  166, 240, 157, 133, 167, 240, 157, 133, 168, 240, 157, 133, 169, 46, 240, 157,
+  133, 174, 240, 157, 133, 175, 240, 157, 133, 176, 240, 157, 133, 177, 240, 157,
+  133, 178, 240, 157, 133, 187, 240, 157, 133, 188, 240, 157, 133, 189, 240, 157,
+  133, 190, 240, 157, 133, 191, 240, 157, 134, 128, 240, 157, 134, 129, 240, 157,
+  134, 130, 240, 157, 134, 133, 240, 157, 134, 134, 240, 157, 134, 135, 240, 157,
+  134, 136, 240, 157, 134, 137, 240, 157, 134, 138, 240, 157, 134, 139, 240, 157,
+  134, 170, 240, 157, 134, 171, 240, 157, 134, 172, 240, 157, 134, 173, 240, 157,
+  134, 185, 240, 157, 133, 165, 240, 157, 134, 186, 240, 157, 133, 165, 240, 157,
+  134, 185, 240, 157, 133, 165, 240, 157, 133, 174, 240, 157, 134, 186, 240, 157,
+  133, 165, 240, 157, 133, 174, 240, 157, 134, 185, 240, 157, 133, 165, 240, 157,
+  133, 175, 240, 157, 134, 186, 240, 157, 133, 165, 240, 157, 133, 175, 211, 190,
+  226, 133, 132, 226, 138, 143, 226, 138, 144, 225, 155, 139, 240, 157, 137, 130,
+  240, 157, 137, 131, 240, 157, 137, 132, 107, 116, 206, 158, 206, 182, 206, 190,
+  226, 136, 130, 207, 157, 240, 158, 128, 128, 240, 158, 128, 129, 240, 158, 128,
+  130, 240, 158, 128, 131, 240, 158, 128, 132, 240, 158, 128, 133, 240, 158, 128,
+  134, 240, 158, 128, 136, 240, 158, 128, 137, 240, 158, 128, 138, 240, 158, 128,
+  139, 240, 158, 128, 140, 240, 158, 128, 141, 240, 158, 128, 142, 240, 158, 128,
+  143, 240, 158, 128, 144, 240, 158, 128, 145, 240, 158, 128, 146, 240, 158, 128,
+  147, 240, 158, 128, 148, 240, 158, 128, 149, 240, 158, 128, 150, 240, 158, 128,
+  151, 240, 158, 128, 152, 240, 158, 128, 155, 240, 158, 128, 156, 240, 158, 128,
+  157, 240, 158, 128, 158, 240, 158, 128, 159, 240, 158, 128, 160, 240, 158, 128,
+  161, 240, 158, 128, 163, 240, 158, 128, 164, 240, 158, 128, 166, 240, 158, 128,
+  167, 240, 158, 128, 168, 240, 158, 128, 169, 240, 158, 128, 170, 240, 158, 132,
+  176, 240, 158, 132, 177, 240, 158, 132, 178, 240, 158, 132, 179, 240, 158, 132,
+  180, 240, 158, 132, 181, 240, 158, 132, 182, 240, 158, 138, 174, 240, 158, 139,
+  172, 240, 158, 139, 173, 240, 158, 139, 174, 240, 158, 139, 175, 226, 136, 160,
+  240, 158, 163, 144, 240, 158, 163, 145, 240, 158, 163, 146, 240, 158, 163, 147,
+  240, 158, 163, 148, 240, 158, 163, 149, 240, 158, 163, 150, 240, 158, 165, 132,
+  240, 158, 165, 133, 240, 158, 165, 134, 240, 158, 165, 135, 240, 158, 165, 136,
+  240, 158, 165, 137, 240, 158, 165, 138, 79, 46, 79, 44, 108, 44, 50, 44,
+  51, 44, 52, 44, 53, 44, 54, 44, 55, 44, 56, 44, 57, 44, 36, 226,
+  131, 160, 40, 65, 41, 40, 66, 41, 40, 67, 41, 40, 68, 41, 40, 69,
+  41, 40, 70, 41, 40, 71, 41, 40, 72, 41, 40, 74, 41, 40, 75, 41,
+  40, 76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41, 40, 80, 41, 40,
+  81, 41, 40, 82, 41, 40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86,
+  41, 40, 87, 41, 40, 88, 41, 40, 89, 41, 40, 90, 41, 227, 143, 132,
+  9, 226, 131, 157, 67, 226, 131, 160, 40, 230, 156, 172, 41, 40, 229, 174,
+  137, 41, 40, 231, 130, 185, 41, 40, 230, 137, 147, 41, 40, 231, 155, 151,
+  41, 40, 229, 139, 157, 41, 40, 230, 149, 151, 41, 226, 152, 189, 81, 69,
+  65, 82, 86, 225, 183, 164, 226, 152, 169, 226, 167, 159, 226, 138, 161, 115,
+  115, 115, 77, 66, 86, 66, 226, 138, 160, 228, 184, 189, 228, 184, 184, 228,
+  185, 129, 240, 160, 132, 162, 228, 189, 160, 228, 190, 187, 229, 128, 130, 229,
+  129, 186, 229, 130, 153, 229, 131, 143, 227, 146, 158, 240, 160, 152, 186, 229,
+  133, 148, 229, 133, 164, 229, 133, 183, 240, 160, 148, 156, 227, 146, 185, 229,
+  133, 167, 229, 134, 141, 240, 160, 149, 139, 229, 134, 151, 229, 134, 164, 228,
+  187, 140, 229, 134, 172, 240, 169, 135, 159, 229, 135, 181, 229, 136, 131, 227,
+  147, 159, 229, 136, 187, 229, 137, 134, 229, 137, 178, 229, 137, 183, 227, 148,
+  149, 229, 140, 133, 229, 140, 134, 229, 141, 137, 229, 141, 154, 229, 141, 179,
+  229, 141, 189, 229, 141, 191, 240, 160, 168, 172, 231, 129, 176, 229, 143, 138,
+  229, 143, 159, 240, 160, 173, 163, 229, 143, 171, 229, 143, 177, 229, 144, 134,
+  229, 146, 158, 229, 144, 184, 229, 145, 136, 229, 145, 168, 229, 146, 162, 229,
+  147, 182, 229, 148, 144, 229, 149, 147, 229, 149, 163, 229, 150, 132, 229, 150,
+  171, 229, 150, 179, 229, 151, 130, 229, 156, 150, 229, 156, 151, 229, 153, 145,
+  229, 153, 180, 229, 163, 174, 229, 159, 142, 229, 159, 180, 229, 160, 141, 229,
+  158, 139, 229, 160, 178, 229, 160, 177, 229, 162, 172, 240, 161, 147, 164, 229,
+  163, 178, 229, 163, 183, 229, 164, 134, 229, 164, 154, 229, 164, 162, 229, 165,
+  162, 240, 161, 154, 168, 240, 161, 155, 170, 229, 167, 172, 229, 168, 155, 229,
+  168, 167, 229, 167, 152, 229, 169, 166, 227, 155, 174, 227, 155, 188, 229, 172,
+  136, 229, 172, 190, 240, 161, 167, 136, 229, 175, 131, 229, 175, 152, 229, 175,
+  179, 240, 161, 172, 152, 229, 175, 191, 229, 176, 134, 229, 189, 147, 229, 176,
+  162, 227, 158, 129, 229, 177, 160, 229, 179, 128, 229, 178, 141, 240, 161, 183,
+  164, 229, 181, 131, 240, 161, 183, 166, 229, 181, 174, 229, 181, 171, 229, 181,
+  188, 229, 183, 161, 229, 183, 162, 227, 160, 175, 229, 183, 189, 229, 184, 168,
+  229, 184, 189, 229, 185, 169, 227, 161, 162, 240, 162, 134, 131, 227, 161, 188,
+  229, 186, 176, 229, 186, 179, 229, 186, 182, 240, 170, 142, 146, 229, 187, 190,
+  240, 162, 140, 177, 232, 136, 129, 229, 188, 162, 227, 163, 135, 240, 163, 138,
+  184, 240, 166, 135, 154, 229, 189, 162, 229, 189, 171, 227, 163, 163, 229, 190,
+  154, 229, 191, 141, 229, 191, 151, 229, 191, 185, 230, 130, 129, 227, 164, 186,
+  227, 164, 156, 240, 162, 155, 148, 230, 131, 135, 230, 133, 136, 230, 133, 140,
+  230, 133, 186, 230, 134, 178, 230, 134, 164, 230, 134, 175, 230, 135, 158, 230,
+  136, 144, 230, 136, 155, 230, 137, 157, 230, 138, 177, 230, 139, 148, 230, 141,
+  144, 240, 162, 172, 140, 230, 140, 189, 230, 139, 188, 230, 141, 168, 230, 142,
+  131, 230, 143, 164, 240, 162, 175, 177, 230, 144, 162, 230, 143, 133, 230, 142,
+  169, 227, 168, 174, 230, 145, 169, 230, 145, 190, 230, 146, 157, 230, 145, 183,
+  227, 169, 172, 230, 149, 172, 240, 163, 128, 138, 230, 151, 163, 230, 155, 184,
+  230, 153, 137, 227, 172, 153, 227, 172, 136, 227, 171, 164, 229, 134, 146, 229,
+  134, 149, 230, 156, 128, 230, 154, 156, 232, 130, 173, 228, 143, 153, 230, 156,
+  161, 230, 157, 158, 230, 157, 147, 240, 163, 143, 131, 227, 173, 137, 230, 159,
+  186, 230, 158, 133, 230, 161, 146, 240, 163, 145, 173, 230, 162, 142, 230, 160,
+  159, 230, 164, 148, 230, 165, 130, 230, 166, 163, 230, 167, 170, 230, 170, 168,
+  240, 163, 154, 163, 230, 171, 155, 227, 176, 152, 230, 172, 161, 240, 163, 162,
+  167, 230, 173, 148, 227, 177, 142, 230, 173, 178, 230, 174, 159, 230, 174, 187,
+  240, 163, 170, 141, 240, 161, 180, 139, 240, 163, 171, 186, 230, 177, 142, 240,
+  163, 178, 188, 230, 178, 191, 230, 179, 141, 230, 177, 167, 230, 180, 150, 230,
+  180, 190, 230, 181, 169, 230, 181, 184, 230, 182, 133, 240, 163, 180, 158, 230,
+  180, 180, 230, 184, 175, 230, 185, 174, 227, 180, 179, 230, 187, 135, 240, 163,
+  187, 145, 230, 183, 185, 230, 189, 174, 240, 163, 189, 158, 240, 163, 190, 142,
+  230, 191, 134, 231, 128, 185, 231, 128, 155, 227, 182, 150, 231, 129, 138, 231,
+  129, 189, 231, 129, 183, 231, 130, 173, 240, 160, 148, 165, 231, 133, 133, 240,
+  164, 137, 163, 231, 134, 156, 240, 164, 142, 171, 231, 136, 168, 231, 137, 144,
+  240, 164, 152, 136, 231, 138, 128, 231, 138, 149, 240, 164, 156, 181, 240, 164,
+  160, 148, 231, 141, 186, 231, 142, 139, 227, 186, 172, 231, 142, 165, 227, 186,
+  184, 231, 145, 135, 231, 145, 156, 231, 146, 133, 231, 147, 138, 227, 188, 155,
+  231, 148, 164, 240, 164, 176, 182, 231, 148, 190, 240, 164, 178, 146, 240, 162,
+  134, 159, 231, 152, 144, 240, 164, 190, 161, 240, 164, 190, 184, 240, 165, 129,
+  132, 227, 191, 188, 228, 128, 136, 240, 165, 131, 179, 240, 165, 131, 178, 240,
+  165, 132, 153, 240, 165, 132, 179, 231, 156, 158, 231, 156, 159, 231, 158, 139,
+  228, 129, 134, 228, 130, 150, 240, 165, 144, 157, 231, 161, 142, 228, 131, 163,
+  240, 165, 152, 166, 240, 165, 154, 154, 240, 165, 155, 133, 231, 167, 171, 228,
+  132, 175, 231, 169, 138, 231, 169, 143, 240, 165, 165, 188, 240, 165, 170, 167,
+  231, 171, 174, 228, 136, 130, 240, 165, 174, 171, 231, 175, 134, 231, 175, 137,
+  228, 136, 167, 240, 165, 178, 128, 231, 179, 146, 228, 138, 160, 231, 179, 168,
+  231, 179, 163, 231, 180, 128, 240, 165, 190, 134, 231, 181, 163, 228, 140, 129,
+  231, 183, 135, 231, 184, 130, 231, 185, 133, 228, 140, 180, 240, 166, 136, 168,
+  240, 166, 137, 135, 228, 141, 153, 240, 166, 139, 153, 231, 189, 186, 240, 166,
+  140, 190, 231, 190, 149, 231, 191, 186, 240, 166, 147, 154, 240, 166, 148, 163,
+  232, 129, 160, 240, 166, 150, 168, 232, 129, 176, 240, 163, 141, 159, 228, 143,
+  149, 232, 130, 178, 232, 132, 131, 228, 144, 139, 232, 132, 190, 229, 170, 181,
+  240, 166, 158, 167, 240, 166, 158, 181, 240, 163, 142, 147, 240, 163, 142, 156,
+  232, 136, 132, 232, 190, 158, 228, 145, 171, 232, 138, 145, 232, 138, 139, 232,
+  138, 157, 229, 138, 179, 232, 138, 177, 232, 138, 179, 232, 138, 189, 232, 139,
+  166, 240, 166, 172, 188, 232, 140, 157, 232, 141, 163, 232, 142, 173, 232, 140,
+  163, 232, 142, 189, 232, 143, 167, 232, 141, 147, 232, 143, 138, 232, 143, 140,
+  232, 143, 156, 240, 166, 176, 182, 240, 166, 181, 171, 240, 166, 179, 149, 228,
+  148, 171, 232, 147, 177, 232, 147, 179, 232, 148, 150, 240, 167, 143, 138, 232,
+  149, 164, 240, 166, 188, 172, 228, 149, 157, 228, 149, 161, 240, 166, 190, 177,
+  240, 167, 131, 146, 228, 149, 171, 232, 153, 144, 232, 153, 167, 232, 153, 169,
+  232, 154, 169, 232, 154, 136, 232, 156, 142, 232, 155, 162, 232, 156, 168, 232,
+  157, 171, 232, 158, 134, 228, 151, 151, 232, 159, 161, 232, 160, 129, 228, 151,
+  185, 232, 161, 160, 232, 161, 163, 240, 167, 153, 167, 232, 163, 151, 232, 163,
+  158, 228, 152, 181, 232, 163, 186, 227, 146, 187, 240, 167, 162, 174, 240, 167,
+  165, 166, 228, 154, 190, 228, 155, 135, 232, 170, 160, 232, 177, 149, 240, 167,
+  178, 168, 232, 178, 171, 232, 179, 129, 232, 180, 155, 232, 181, 183, 240, 167,
+  188, 175, 240, 160, 160, 132, 232, 183, 139, 232, 182, 188, 232, 183, 176, 240,
+  160, 163, 158, 232, 187, 148, 240, 168, 151, 146, 240, 168, 151, 173, 233, 130,
+  148, 233, 131, 177, 233, 132, 145, 240, 168, 156, 174, 233, 132, 155, 233, 136,
+  184, 233, 139, 151, 233, 139, 152, 233, 137, 188, 233, 143, 185, 233, 144, 149,
+  240, 168, 175, 186, 233, 150, 139, 228, 166, 149, 233, 150, 183, 240, 168, 181,
+  183, 228, 167, 166, 233, 155, 131, 229, 182, 178, 233, 156, 163, 240, 169, 133,
+  133, 240, 169, 136, 154, 228, 169, 174, 228, 169, 182, 233, 159, 160, 240, 169,
+  144, 138, 228, 170, 178, 240, 169, 146, 150, 233, 160, 169, 240, 169, 150, 182,
+  233, 163, 162, 228, 172, 179, 233, 164, 169, 233, 166, 167, 233, 167, 130, 233,
+  167, 190, 228, 175, 142, 240, 169, 172, 176, 233, 177, 128, 233, 179, 189, 228,
+  179, 142, 228, 179, 173, 233, 181, 167, 240, 170, 131, 142, 228, 179, 184, 240,
+  170, 132, 133, 240, 170, 136, 142, 240, 170, 138, 145, 233, 186, 187, 228, 181,
+  150, 233, 187, 185, 233, 187, 190, 233, 188, 133, 233, 188, 143, 233, 188, 150,
+  233, 188, 187, 240, 170, 152, 128,
+};
+
+/// The runs of code points with the same canonical combining class, each
+/// packed as `(first << 8) | combining_class`
+inline constexpr auto combining_classes = std::array<std::uint32_t, 571>{
+  0, 196838, 202216, 202460, 203496, 203736, 203996, 205258, 205788, 206794, 207324, 209921, 211420, 212454, 214512, 214758,
+  215004, 215782, 216540, 216832, 217318, 218076, 219110, 219368, 219612, 220134, 220393, 220650, 221161, 221418, 221929, 222182,
+  225280, 295910, 296960, 365020, 365286, 366300, 366566, 367326, 367580, 367846, 369372, 370918, 371420, 371686, 372190, 372452,
+  372710, 372746, 373003, 373260, 373517, 373774, 374031, 374288, 374545, 374802, 375059, 375572, 375829, 376086, 376320, 376599,
+  376832, 377112, 377369, 377600, 378086, 378332, 378368, 378642, 378880, 397542, 399390, 399647, 399904, 400128, 412443, 412700,
+  412957, 413214, 413471, 413728, 413985, 414242, 414694, 415196, 415718, 416988, 417254, 417756, 417792, 421923, 422144, 448230,
+  449792, 450534, 451548, 451814, 451840, 452582, 452864, 453340, 453606, 454108, 454144, 463140, 463360, 471270, 471516, 471782,
+  472284, 472550, 473052, 473830, 474076, 474598, 474844, 475110, 475868, 476134, 476380, 476646, 476892, 477158, 477404, 477670,
+  477952, 519142, 520924, 521190, 521216, 523740, 523776, 530150, 530944, 531430, 533504, 533990, 534528, 535014, 536064, 547292,
+  547840, 563430, 563676, 564454, 565248, 576230, 577500, 578790, 582144, 582620, 582886, 583388, 583654, 584156, 584422, 585180,
+  585755, 586012, 586269, 586726, 587484, 587750, 588252, 588774, 589824, 605191, 605440, 609545, 609792, 610790, 611036, 611302,
+  611584, 637959, 638208, 642313, 642560, 655078, 655104, 670727, 670976, 675081, 675328, 703495, 703744, 707849, 708096, 736263,
+  736512, 740617, 740864, 773385, 773632, 801799, 802048, 806153, 806400, 808276, 808539, 808704, 834567, 834816, 838921, 839168,
+  867081, 867584, 871689, 871936, 903689, 903936, 931943, 932361, 932608, 936043, 936960, 964726, 965129, 965376, 968826, 969728,
+  989404, 989696, 996828, 996864, 997340, 997376, 997848, 997888, 1012097, 1012354, 1012480, 1012868, 1012992, 1014402, 1015296, 1015938,
+  1016064, 1016550, 1016841, 1017088, 1017574, 1017856, 1033948, 1033984, 1062663, 1062912, 1063177, 1063680, 1084892, 1084928, 1269222, 1269760,
+  1512457, 1512960, 1520649, 1520896, 1561097, 1561344, 1564134, 1564160, 1616356, 1616384, 1653214, 1653478, 1653724, 1653760, 1710054, 1710300,
+  1710336, 1728521, 1728768, 1734118, 1735936, 1736668, 1736704, 1749222, 1750492, 1752038, 1752540, 1752576, 1753052, 1753574, 1754076, 1754598,
+  1755868, 1756134, 1756928, 1782791, 1783040, 1786889, 1787136, 1797094, 1797340, 1797606, 1799168, 1813001, 1813504, 1828359, 1828608, 1831433,
+  1831936, 1849095, 1849344, 1888486, 1889024, 1889281, 1889756, 1891046, 1891548, 1892582, 1892608, 1892865, 1894656, 1895900, 1895936, 1897702,
+  1897728, 1898726, 1899008, 1949926, 1950428, 1950694, 1952476, 1952742, 1953258, 1953494, 1953756, 1953994, 1954278, 1963752, 1964004, 1964508,
+  1964762, 1965030, 1965289, 1965532, 1965798, 1966044, 1966080, 2150630, 2150913, 2151654, 2152449, 2153446, 2153728, 2154982, 2155008, 2155777,
+  2156518, 2156764, 2157030, 2157057, 2157788, 2158822, 2158848, 2944998, 2945536, 2981641, 2981888, 3006694, 3014656, 3156698, 3156964, 3157224,
+  3157470, 3157728, 3158016, 3184904, 3185408, 10907622, 10907648, 10908902, 10911232, 10919654, 10919936, 10940646, 10940928, 11011593, 11011840, 11021321,
+  11021568, 11060233, 11060480, 11067622, 11072000, 11086812, 11087360, 11096841, 11097088, 11121415, 11121664, 11124745, 11124992, 11186406, 11186432, 11186918,
+  11187420, 11187456, 11188198, 11188480, 11189990, 11190272, 11190758, 11190784, 11204105, 11204352, 11267337, 11267584, 16457242, 16457472, 16654566, 16656348,
+  16658150, 16658432, 16907740, 16907776, 16965852, 16965888, 17004262, 17005312, 17436124, 17436160, 17436646, 17436672, 17447142, 17447169, 17447644, 17447680,
+  17448713, 17448960, 17491430, 17491676, 17491712, 17638630, 17639424, 17738726, 17739008, 17778396, 17778918, 17779676, 17779942, 17780188, 17780992, 17793766,
+  17794012, 17794278, 17794524, 17794560, 17843721, 17843968, 17854473, 17854720, 17858313, 17858560, 17873161, 17873415, 17873664, 17891558, 17892096, 17904393,
+  17904896, 17920775, 17921024, 17940489, 17940736, 17943047, 17943296, 17970441, 17970695, 17970944, 18016519, 18016777, 18017024, 18037511, 18038016, 18042121,
+  18042368, 18048742, 18050304, 18051302, 18052352, 18104841, 18105088, 18105863, 18106112, 18112230, 18112256, 18137609, 18137863, 18138112, 18202377, 18202631,
+  18202880, 18235145, 18235392, 18265609, 18265863, 18266112, 18295561, 18295808, 18364681, 18364935, 18365184, 18431241, 18431744, 18432775, 18433024, 18472969,
+  18473216, 18494473, 18494720, 18499337, 18499584, 18520329, 18520576, 18628361, 18628608, 18694663, 18694912, 18695177, 18695680, 18716425, 18716672, 23785473,
+  23786752, 23802086, 23803648, 24113158, 24113664, 29138433, 29138688, 30500312, 30500609, 30501376, 30502370, 30502616, 30503680, 30505948, 30507776, 30508518,
+  30509788, 30510080, 30517990, 30518784, 30556902, 30557440, 31457510, 31459072, 31459558, 31463680, 31464422, 31465984, 31466470, 31466752, 31467238, 31468288,
+  31535334, 31536896, 31633126, 31633152, 31648998, 31649792, 32035036, 32036608, 32064742, 32066055, 32066304,
+};
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The index of the mapping of the code point
+constexpr auto mapping_of(char32_t code_point) noexcept -> std::size_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = std::size_t(blocks[code_point >> block_shift]);
+  return block_values[(block << block_shift) | (static_cast<std::uint32_t>(code_point) & block_mask)];
+}
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The canonical combining class of the code point
+constexpr auto combining_class_of(char32_t code_point) noexcept -> int {
+  auto key = static_cast<std::uint32_t>(code_point) << 8;
+  auto first = std::size_t(0), last = combining_classes.size();
+
+  // the first run starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((combining_classes[middle] & ~std::uint32_t(0xff)) <= key) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return static_cast<int>(combining_classes[first] & 0xff);
+}
+}  // namespace skyr::confusables_data
+
+#endif  // SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
@@ -0,0 +1,1027 @@
+// Auto-generated by tools/make_idna_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_IDNA_TABLE_HPP
+#define SKYR_DOMAIN_IDNA_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// The IDNA mapping table shared by skyr v1 and v2
+///
+/// The variables are `inline`, so a program which uses both
+/// versions of the library holds one copy of the table.
+namespace skyr::idna_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = 7;
+
+/// The number of bits of the status of a run
+inline constexpr auto status_bits = 3;
+
+/// The bias added to the offset of a run
+inline constexpr auto offset_bias = std::int32_t(2097152);
+
+/// The index of the runs of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = std::array<std::uint8_t, 8704>{
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 32, 35, 36, 37, 38, 32, 32, 32, 32, 32, 39, 40, 41,
+  42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 32, 63, 32, 64, 65, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 87,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 88, 32, 32, 89, 90, 91, 92,
+  93, 94, 95, 96, 97, 98, 99, 100, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 101,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+  117, 118, 119, 120, 102, 121, 122, 123, 124, 125, 126, 102, 32, 32, 127, 102,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 102, 139, 102, 140, 141,
+  142, 143, 144, 145, 146, 147, 148, 102, 149, 150, 102, 151, 152, 153, 154, 102,
+  155, 156, 102, 157, 158, 159, 102, 102, 160, 161, 162, 163, 102, 164, 102, 165,
+  32, 32, 32, 32, 32, 32, 32, 166, 167, 32, 168, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 32, 32, 32, 32, 32, 32, 32, 169, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 32, 32, 32, 32, 170, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 32, 32, 32, 171, 172, 173, 174, 102, 102, 102, 102, 175, 176, 177, 178,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 179,
+  32, 32, 32, 32, 32, 180, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 32, 181, 32, 32, 182, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 183, 184, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 185, 186, 187, 188, 189, 190, 102, 191, 192, 193, 194, 195, 196, 197, 198,
+  32, 32, 32, 32, 32, 199, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  200, 102, 201, 102, 102, 202, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 203, 204, 102, 102, 102, 102, 102, 205, 206, 207, 102, 208, 209, 102, 102,
+  210, 211, 212, 213, 214, 102, 32, 32, 32, 32, 32, 32, 32, 215, 216, 217,
+  218, 219, 220, 221, 222, 223, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 224, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 225, 32,
+  226, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 227, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 228, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  229, 230, 231, 232, 233, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 234, 235, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+};
+
+/// The first run of the runs of each block index, then the number of runs
+inline constexpr auto block_runs = std::array<std::uint16_t, 237>{
+  0, 9, 37, 164, 276, 349, 373, 395, 458, 493, 612, 664, 676, 685, 688, 693,
+  698, 708, 716, 723, 752, 789, 817, 846, 879, 902, 928, 943, 968, 975, 1002, 1028,
+  1050, 1051, 1060, 1063, 1074, 1091, 1099, 1105, 1110, 1124, 1132, 1141, 1145, 1157, 1164, 1171,
+  1179, 1183, 1186, 1191, 1207, 1254, 1285, 1413, 1536, 1576, 1648, 1702, 1724, 1825, 1832, 1843,
+  1846, 1873, 1912, 1919, 1922, 1925, 1928, 1956, 2064, 2076, 2095, 2097, 2104, 2232, 2319, 2330,
+  2339, 2373, 2404, 2516, 2616, 2724, 2837, 2840, 2842, 2847, 2895, 2927, 3013, 3082, 3088, 3093,
+  3097, 3103, 3110, 3114, 3133, 3138, 3144, 3145, 3273, 3401, 3522, 3613, 3706, 3800, 3910, 4014,
+  4112, 4196, 4269, 4362, 4402, 4451, 4463, 4465, 4470, 4478, 4484, 4490, 4496, 4498, 4506, 4512,
+  4518, 4531, 4540, 4546, 4551, 4568, 4574, 4581, 4587, 4589, 4594, 4598, 4601, 4605, 4608, 4613,
+  4621, 4627, 4633, 4637, 4651, 4681, 4687, 4691, 4695, 4701, 4705, 4711, 4713, 4718, 4725, 4728,
+  4732, 4741, 4747, 4766, 4774, 4777, 4781, 4783, 4787, 4789, 4791, 4793, 4801, 4806, 4815, 4817,
+  4820, 4822, 4825, 4831, 4833, 4835, 4842, 4844, 4848, 4855, 4857, 4869, 4875, 4877, 4880, 4884,
+  4891, 4913, 4935, 4941, 4947, 4971, 5000, 5032, 5038, 5048, 5056, 5060, 5064, 5071, 5073, 5075,
+  5078, 5184, 5235, 5238, 5248, 5297, 5302, 5366, 5372, 5374, 5378, 5385, 5389, 5396, 5403, 5411,
+  5415, 5417, 5420, 5423, 5426, 5428, 5555, 5681, 5808, 5935, 5966, 5967, 5969,
+};
+
+/// The runs of code points with the same properties, each packed as
+/// `first | (status << block_shift) | ((offset + offset_bias) << (block_shift + status_bits))`
+inline constexpr auto runs = std::array<std::uint32_t, 5969>{
+  2147483904, 2147484589, 2147483951, 2147484592, 2147483962, 2147517121, 2147483995, 2147484641, 2147484027, 2147483776, 2147352992, 2147484577, 2147344808, 2147484585, 2147409578, 2147484587,
+  2147484205, 2147484590, 2147337647, 2147484592, 2147353266, 2147332532, 2148277941, 2147484598, 2147328440, 2147345081, 2147407546, 2147484603, 2147342012, 2147340989, 2147342014, 2147484607,
+  2147517120, 2147484631, 2147517144, 2147484511, 2147484640, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322,
+  2147484555, 2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338,
+  2147484571, 2147485340, 2147484573, 2147485342, 2147484575, 2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354,
+  2147484587, 2147485356, 2147484589, 2147485358, 2147484591, 2147280560, 2147484593, 2147278514, 2147277491, 2147485364, 2147484597, 2147485366, 2147484599, 2147485369, 2147484602, 2147485371,
+  2147484604, 2147485373, 2147484606, 2147268287, 2147267264, 2147485377, 2147484610, 2147485379, 2147484612, 2147485381, 2147484614, 2147485383, 2147484616, 2147864265, 2147485386, 2147484619,
+  2147485388, 2147484621, 2147485390, 2147484623, 2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635,
+  2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651,
+  2147485420, 2147484653, 2147485422, 2147484655, 2147485424, 2147484657, 2147485426, 2147484659, 2147485428, 2147484661, 2147485430, 2147484663, 2147360504, 2147485433, 2147484666, 2147485435,
+  2147484668, 2147485437, 2147484670, 2147209983, 2147484544, 2147699329, 2147485314, 2147484547, 2147485316, 2147484549, 2147695238, 2147485319, 2147484552, 2147694217, 2147485323, 2147484556,
+  2147565198, 2147691151, 2147692176, 2147485329, 2147484562, 2147694227, 2147696276, 2147484565, 2147700374, 2147698327, 2147485336, 2147484569, 2147700380, 2147702429, 2147484574, 2147703455,
+  2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147707558, 2147485351, 2147484584, 2147707561, 2147484586, 2147485356, 2147484589, 2147707566, 2147485359, 2147484592,
+  2147706545, 2147485363, 2147484596, 2147485365, 2147484598, 2147708599, 2147485368, 2147484601, 2147485372, 2147484605, 2147123908, 2147122885, 2147121862, 2147129031, 2147128008, 2147126985,
+  2147128010, 2147126987, 2147125964, 2147485389, 2147484622, 2147485391, 2147484624, 2147485393, 2147484626, 2147485395, 2147484628, 2147485397, 2147484630, 2147485399, 2147484632, 2147485401,
+  2147484634, 2147485403, 2147484636, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418,
+  2147484651, 2147485420, 2147484653, 2147485422, 2147484655, 2147077873, 2147076850, 2147075827, 2147485428, 2147484661, 2147385078, 2147427063, 2147485432, 2147484665, 2147485434, 2147484667,
+  2147485436, 2147484669, 2147485438, 2147484671, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322, 2147484555,
+  2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338, 2147484571,
+  2147485340, 2147484573, 2147485342, 2147484575, 2147351200, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354, 2147484587,
+  2147485356, 2147484589, 2147485358, 2147484591, 2147485360, 2147484593, 2147485362, 2147484595, 2158538426, 2147485371, 2147484604, 2147317437, 2158535358, 2147484607, 2147485377, 2147484610,
+  2147284675, 2147555012, 2147557061, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386, 2147484619, 2147485388, 2147484621, 2147485390, 2147484623, 2147484544, 2146886320, 2147407537,
+  2146886322, 2146893491, 2147423924, 2147424949, 2147430070, 2146894519, 2146895544, 2147484601, 2146771416, 2146770393, 2146769370, 2146768347, 2146767324, 2146766301, 2147484638, 2147356384,
+  2146840289, 2146846434, 2146850531, 2147403492, 2147484645, 2147484544, 2147418816, 2147484610, 2147435203, 2147422916, 2147603141, 2147484614, 2147484239, 2147484624, 2147485424, 2147484657,
+  2147485426, 2147484659, 2147292916, 2147484661, 2147485430, 2147484663, 2147483896, 2146605562, 2147484667, 2146629118, 2147603199, 2147483776, 2146595204, 2146594181, 2147523206, 2146747015,
+  2147522184, 2147483787, 2147549836, 2147483789, 2147548814, 2147484560, 2147517073, 2147483810, 2147517091, 2147484588, 2147484482, 2147484611, 2147492559, 2147453648, 2147458769, 2147471058,
+  2147478227, 2147475156, 2147469013, 2147461846, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635, 2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410,
+  2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651, 2147485420, 2147484653, 2147485422, 2147484655, 2147429104, 2147435249, 2147436274,
+  2147484659, 2147422964, 2147418869, 2147484662, 2147485431, 2147484664, 2147429113, 2147485434, 2147484667, 2147351293, 2147566208, 2147517072, 2147484592, 2147485408, 2147484641, 2147485410,
+  2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651, 2147485420, 2147484653, 2147485422, 2147484655, 2147485424, 2147484657, 2147485426,
+  2147484659, 2147485428, 2147484661, 2147485430, 2147484663, 2147485432, 2147484665, 2147485434, 2147484667, 2147485436, 2147484669, 2147485438, 2147484671, 2147485312, 2147484545, 2147485322,
+  2147484555, 2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338,
+  2147484571, 2147485340, 2147484573, 2147485342, 2147484575, 2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354,
+  2147484587, 2147485356, 2147484589, 2147485358, 2147484591, 2147485360, 2147484593, 2147485362, 2147484595, 2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370,
+  2147484603, 2147485372, 2147484605, 2147485374, 2147484607, 2147483840, 2147485377, 2147484610, 2147485379, 2147484612, 2147485381, 2147484614, 2147485383, 2147484616, 2147485385, 2147484618,
+  2147485387, 2147484620, 2147485389, 2147484622, 2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635,
+  2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651,
+  2147485420, 2147484653, 2147485422, 2147484655, 2147485424, 2147484657, 2147485426, 2147484659, 2147485428, 2147484661, 2147485430, 2147484663, 2147485432, 2147484665, 2147485434, 2147484667,
+  2147485436, 2147484669, 2147485438, 2147484671, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322, 2147484555,
+  2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338, 2147484571,
+  2147485340, 2147484573, 2147485342, 2147484575, 2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354, 2147484587,
+  2147485356, 2147484589, 2147485358, 2147484591, 2147483824, 2147533489, 2147483863, 2147484633, 2147484544, 2147449479, 2147484552, 2147483787, 2147484557, 2147483792, 2147484561, 2147483848,
+  2147484624, 2147483883, 2147484655, 2147483893, 2147483776, 2147484550, 2147483804, 2147484574, 2147404533, 2147437302, 2147566327, 2147437304, 2147484665, 2147484544, 2147483869, 2147484638,
+  2147484544, 2147483790, 2147484560, 2147483851, 2147484621, 2147484544, 2147483826, 2147484608, 2147483899, 2147484669, 2147484544, 2147483822, 2147484592, 2147483839, 2147484608, 2147483868,
+  2147484638, 2147483871, 2147484640, 2147483883, 2147483776, 2147484576, 2147483829, 2147484598, 2147483838, 2147484627, 2147483874, 2147484643, 2147484544, 2147415768, 2147419867, 2147423964,
+  2147432158, 2147435231, 2147484640, 2147484544, 2147483780, 2147484549, 2147483789, 2147484559, 2147483793, 2147484563, 2147483817, 2147484586, 2147483825, 2147484594, 2147483827, 2147484598,
+  2147483834, 2147484604, 2147483845, 2147484615, 2147483849, 2147484619, 2147483855, 2147484631, 2147483864, 2147423964, 2147483870, 2147435231, 2147484640, 2147483876, 2147484646, 2147483903,
+  2147483776, 2147484545, 2147483780, 2147484549, 2147483787, 2147484559, 2147483793, 2147484563, 2147483817, 2147484586, 2147483825, 2147484594, 2147483315, 2147483828, 2147484597, 2147486390,
+  2147483831, 2147484600, 2147483834, 2147484604, 2147483837, 2147484606, 2147483843, 2147484615, 2147483849, 2147484619, 2147483854, 2147484625, 2147483858, 2147415769, 2147419867, 2147484636,
+  2147483869, 2147432158, 2147483871, 2147484646, 2147483895, 2147483776, 2147484545, 2147483780, 2147484549, 2147483790, 2147484559, 2147483794, 2147484563, 2147483817, 2147484586, 2147483825,
+  2147484594, 2147483828, 2147484597, 2147483834, 2147484604, 2147483846, 2147484615, 2147483850, 2147484619, 2147483854, 2147484624, 2147483857, 2147484640, 2147483876, 2147484646, 2147483890,
+  2147484665, 2147483776, 2147484545, 2147483780, 2147484549, 2147483789, 2147484559, 2147483793, 2147484563, 2147483817, 2147484586, 2147483825, 2147484594, 2147483828, 2147484597, 2147483834,
+  2147484604, 2147483845, 2147484615, 2147483849, 2147484619, 2147483854, 2147484630, 2147483864, 2147423964, 2147483870, 2147484639, 2147483876, 2147484646, 2147483896, 2147483776, 2147484546,
+  2147483780, 2147484549, 2147483787, 2147484558, 2147483793, 2147484562, 2147483798, 2147484569, 2147483803, 2147484572, 2147483805, 2147484574, 2147483808, 2147484579, 2147483813, 2147484584,
+  2147483819, 2147484590, 2147483834, 2147484606, 2147483843, 2147484614, 2147483849, 2147484618, 2147483854, 2147484624, 2147483857, 2147484631, 2147483864, 2147484646, 2147483899, 2147484544,
+  2147483789, 2147484558, 2147483793, 2147484562, 2147483817, 2147484586, 2147483834, 2147484605, 2147483845, 2147484614, 2147483849, 2147484618, 2147483854, 2147484629, 2147483863, 2147484632,
+  2147483867, 2147484640, 2147483876, 2147484646, 2147483888, 2147484663, 2147484544, 2147483789, 2147484558, 2147483793, 2147484562, 2147483817, 2147484586, 2147483828, 2147484597, 2147483834,
+  2147484604, 2147483845, 2147484614, 2147483849, 2147484618, 2147483854, 2147484629, 2147483863, 2147484638, 2147483871, 2147484640, 2147483876, 2147484646, 2147483888, 2147484657, 2147483891,
+  2147484544, 2147483780, 2147484549, 2147483789, 2147484558, 2147483793, 2147484562, 2147483845, 2147484614, 2147483849, 2147484618, 2147483856, 2147484628, 2147483876, 2147484646, 2147483776,
+  2147484546, 2147483780, 2147484549, 2147483799, 2147484570, 2147483826, 2147484595, 2147483836, 2147484605, 2147483838, 2147484608, 2147483847, 2147484618, 2147483851, 2147484623, 2147483861,
+  2147484630, 2147483863, 2147484632, 2147483872, 2147484646, 2147483888, 2147484658, 2147483893, 2147483776, 2147484545, 2147510963, 2147484596, 2147483835, 2147484607, 2147483868, 2147483776,
+  2147484545, 2147483779, 2147484548, 2147483781, 2147484550, 2147483787, 2147484556, 2147483812, 2147484581, 2147483814, 2147484583, 2147510963, 2147484596, 2147483838, 2147484608, 2147483845,
+  2147484614, 2147483847, 2147484616, 2147483854, 2147484624, 2147483866, 2147434204, 2147433181, 2147484638, 2147483872, 2147484544, 2147483276, 2147484557, 2147483331, 2147484612, 2147483848,
+  2147484617, 2147483341, 2147484622, 2147483346, 2147484627, 2147483351, 2147484632, 2147483356, 2147484637, 2147442409, 2147484650, 2147483885, 2147484657, 2147482355, 2147484660, 2147480309,
+  2147545846, 2147544823, 2147543801, 2147484666, 2147484544, 2147467905, 2147484546, 2147483283, 2147484564, 2147483800, 2147484569, 2147483293, 2147484574, 2147483298, 2147484579, 2147483303,
+  2147484584, 2147483308, 2147484589, 2147442361, 2147484602, 2147483837, 2147484606, 2147483853, 2147484622, 2147483867, 2147484544, 2147484544, 2147483808, 2154922695, 2147483848, 2154922701,
+  2147483854, 2147484624, 2147451644, 2147484669, 2147484544, 2147483871, 2147484641, 2147484544, 2147483849, 2147484618, 2147483854, 2147484624, 2147483863, 2147484632, 2147483865, 2147484634,
+  2147483870, 2147484640, 2147484544, 2147483785, 2147484554, 2147483790, 2147484560, 2147483825, 2147484594, 2147483830, 2147484600, 2147483839, 2147484608, 2147483841, 2147484610, 2147483846,
+  2147484616, 2147483863, 2147484632, 2147484544, 2147483793, 2147484562, 2147483798, 2147484568, 2147483867, 2147484637, 2147483901, 2147484544, 2147483802, 2147484576, 2147483894, 2147476216,
+  2147483902, 2147483776, 2147484545, 2147483805, 2147484576, 2147483897, 2147484544, 2147483789, 2147484558, 2147483797, 2147484576, 2147483831, 2147484608, 2147483860, 2147484640, 2147483885,
+  2147484654, 2147483889, 2147484658, 2147483892, 2147484544, 2147483828, 2147484598, 2147483870, 2147484640, 2147483882, 2147484656, 2147483898, 2147484544, 2147483782, 2147484551, 2147484171,
+  2147483790, 2147484560, 2147483802, 2147484576, 2147483897, 2147484544, 2147483819, 2147484592, 2147483894, 2147484544, 2147483807, 2147484576, 2147483820, 2147484592, 2147483836, 2147484608,
+  2147483841, 2147484612, 2147483886, 2147484656, 2147483893, 2147484544, 2147483820, 2147484592, 2147483850, 2147484624, 2147483867, 2147484638, 2147484544, 2147483804, 2147484574, 2147483871,
+  2147484640, 2147483901, 2147484671, 2147484544, 2147483786, 2147484560, 2147483802, 2147484576, 2147483822, 2147484592, 2147483839, 2147484544, 2147483852, 2147484624, 2147483901, 2147484544,
+  2147483892, 2147484668, 2147484544, 2147483832, 2147484603, 2147483850, 2147484621, 2141112960, 2141113985, 2141123202, 2141125251, 2141124229, 2141131398, 2141155975, 2183597704, 2147483785,
+  2144404112, 2147483835, 2144404157, 2147484608, 2147483848, 2147484624, 2147483899, 2147484544, 2139936428, 2140071597, 2139935406, 2147484591, 2139935408, 2140319410, 2139935411, 2147484603,
+  2139934396, 2140379837, 2139933374, 2139934399, 2139935424, 2139936450, 2139912899, 2140418756, 2147414726, 2139909831, 2139910856, 2140421834, 2140422859, 2139908813, 2147484622, 2139910863,
+  2139911888, 2140138193, 2139911890, 2140407507, 2147420884, 2139908822, 2139911895, 2147422937, 2140427994, 2139909851, 2147428060, 2140755677, 2140773088, 2139889378, 2139897571, 2139899620,
+  2140746470, 2140759784, 2140763881, 2147484651, 2140870392, 2147484665, 2147484544, 2140331675, 2139823772, 2140332701, 2139966110, 2140337823, 2139822752, 2140338849, 2140339874, 2140342947,
+  2140344996, 2147439271, 2140395176, 2140345001, 2147446442, 2140394155, 2140346028, 2140343981, 2140345006, 2140347058, 2140356275, 2140134069, 2140360374, 2147324600, 2140359353, 2139815611,
+  2140361404, 2140661439, 2147484608, 2147483898, 2147484667, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322,
+  2147484555, 2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338,
+  2147484571, 2147485340, 2147484573, 2147485342, 2147484575, 2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354,
+  2147484587, 2147485356, 2147484589, 2147485358, 2147484591, 2147485360, 2147484593, 2147485362, 2147484595, 2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370,
+  2147484603, 2147485372, 2147484605, 2147485374, 2147484607, 2147485376, 2147484609, 2147485378, 2147484611, 2147485380, 2147484613, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386,
+  2147484619, 2147485388, 2147484621, 2147485390, 2147484623, 2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402,
+  2147484635, 2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418,
+  2147484651, 2147485420, 2147484653, 2147485422, 2147484655, 2147485424, 2147484657, 2147485426, 2147484659, 2147485428, 2147484661, 2147485430, 2147484663, 2147485432, 2147484665, 2147485434,
+  2147484667, 2147485436, 2147484669, 2147485438, 2147484671, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322,
+  2147484555, 2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2139561626, 2147424923, 2147484572, 2139575966, 2147484575,
+  2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354, 2147484587, 2147485356, 2147484589, 2147485358, 2147484591,
+  2147485360, 2147484593, 2147485362, 2147484595, 2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370, 2147484603, 2147485372, 2147484605, 2147485374, 2147484607,
+  2147485376, 2147484609, 2147485378, 2147484611, 2147485380, 2147484613, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386, 2147484619, 2147485388, 2147484621, 2147485390, 2147484623,
+  2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635, 2147485404, 2147484637, 2147485406, 2147484639,
+  2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651, 2147485420, 2147484653, 2147485422, 2147484655,
+  2147485424, 2147484657, 2147485426, 2147484659, 2147485428, 2147484661, 2147485430, 2147484663, 2147485432, 2147484665, 2147485434, 2147484667, 2147485436, 2147484669, 2147485438, 2147484671,
+  2147484544, 2147476104, 2147484560, 2147483798, 2147476120, 2147483806, 2147484576, 2147476136, 2147484592, 2147476152, 2147484608, 2147483846, 2147476168, 2147483854, 2147484624, 2147483864,
+  2147476185, 2147483866, 2147476187, 2147483868, 2147476189, 2147483870, 2147476191, 2147484640, 2147476200, 2147484656, 2140204785, 2147484658, 2140203763, 2147484660, 2140202741, 2147484662,
+  2140201719, 2147484664, 2140229369, 2147484666, 2140228347, 2147484668, 2140227325, 2147483902, 2147353216, 2147345032, 2147369616, 2147361432, 2147418784, 2147410600, 2147484592, 2147416754,
+  2140142259, 2140136116, 2147483829, 2147484598, 2147483319, 2147476152, 2147408570, 2140128955, 2140133052, 2139196861, 2140139198, 2139194815, 2139193792, 2139192769, 2147404482, 2140132035,
+  2140121796, 2147483845, 2147484614, 2147483335, 2147396296, 2140115657, 2147396298, 2140114635, 2140122828, 2139180493, 2139179470, 2139178447, 2147484624, 2140075731, 2147483860, 2147484630,
+  2147476184, 2147381978, 2140099291, 2147483868, 2139164125, 2139163102, 2139162079, 2147484640, 2140092131, 2147484644, 2147476200, 2147369706, 2140113643, 2147477228, 2139147757, 2139146734,
+  2139211247, 2147483888, 2147363570, 2140101363, 2140105460, 2147483893, 2147484662, 2147483383, 2147353336, 2140098297, 2147355386, 2140098299, 2140092156, 2139131389, 2139130366, 2147483903,
+  2139128192, 2139127169, 2139126146, 2139125123, 2139124100, 2139123077, 2139122054, 2139121031, 2139120008, 2139118985, 2139117962, 2147484171, 2147484428, 2147483790, 2147484560, 2147483281,
+  2147484562, 2139104663, 2147484568, 2147483812, 2147484583, 2147483816, 2139080111, 2147484592, 2147483315, 2147482292, 2147484597, 2147483318, 2147482295, 2147484600, 2139067836, 2147484605,
+  2139064766, 2147484607, 2139087303, 2139086280, 2139054537, 2147484618, 2147446487, 2147484632, 2139031007, 2147484256, 2147483873, 2147484260, 2147483877, 2139030256, 2139087601, 2147483890,
+  2139030260, 2139014650, 2147901179, 2139031036, 2139008509, 2139078399, 2139013760, 2138998154, 2147884683, 2139014540, 2138992013, 2147483791, 2139047568, 2139050641, 2139059858, 2139068051,
+  2139559572, 2139049621, 2139051670, 2139052698, 2139054747, 2147483805, 2147484576, 2139040424, 2147484585, 2147483840, 2147484624, 2147483889, 2138932608, 2138931585, 2138932866, 2139010691,
+  2147484548, 2138929541, 2138928518, 2139443847, 2147484552, 2139004553, 2138928778, 2138927756, 2138926733, 2138925710, 2139120271, 2138924688, 2138923665, 2138925714, 2138924691, 2147484564,
+  2138924693, 2138923670, 2147484567, 2138922649, 2138921628, 2138920605, 2147484574, 2138918560, 2138917538, 2147484579, 2138921636, 2147484581, 2139786918, 2147484583, 2138917544, 2147484585,
+  2138900138, 2139024043, 2138888876, 2147484590, 2138888879, 2138887856, 2147483826, 2138892979, 2138894004, 2140303029, 2138882745, 2147484602, 2138877627, 2139755196, 2139740861, 2139739838,
+  2139752127, 2147698368, 2147484609, 2138865349, 2138864326, 2138867400, 2147484618, 2138801872, 2138800849, 2138799826, 2138798803, 2138796757, 2138792665, 2138795738, 2138790619, 2138791644,
+  2138792669, 2138793694, 2138786527, 2138842848, 2138841825, 2138840802, 2138839779, 2138852068, 2138851045, 2138850022, 2138848999, 2138834664, 2138849001, 2138847978, 2138846955, 2138833644,
+  2138823405, 2138831599, 2138826480, 2138825457, 2138824434, 2138823411, 2138835700, 2138834677, 2138833654, 2138832631, 2138818296, 2138832633, 2138831610, 2138830587, 2138817276, 2138807037,
+  2138815231, 2147484544, 2147483779, 2147484548, 2138742409, 2147484554, 2147483788, 2147484560, 2147484544, 2147483308, 2147482285, 2147484590, 2147483311, 2147482288, 2147484593, 2147484000,
+  2147484641, 2147484014, 2147484656, 2147484544, 2150858409, 2147484587, 2147484544, 2147483815, 2147484608, 2147483851, 2137999072, 2137989865, 2137988842, 2137987819, 2137986796, 2137985773,
+  2137984750, 2137983727, 2137982704, 2137981681, 2137980658, 2137969140, 2137968117, 2137967094, 2137966071, 2137965048, 2137964025, 2137963002, 2137961979, 2137960956, 2137959933, 2137958910,
+  2137957887, 2137956736, 2137955713, 2137954690, 2137953667, 2137952644, 2137951621, 2137950598, 2137949575, 2147483784, 2137928092, 2137927069, 2137926046, 2137925023, 2137924000, 2137922977,
+  2137921954, 2137920931, 2137919908, 2137918885, 2137917862, 2137916839, 2137915816, 2137914793, 2137913770, 2137912747, 2137911724, 2137910701, 2137909678, 2137908655, 2137907632, 2137906609,
+  2137905586, 2137904563, 2137903540, 2137902517, 2137960118, 2137933520, 2137856746, 2147484651, 2147484544, 2145418892, 2147484557, 2136414708, 2136416757, 2136415734, 2147484663, 2147484544,
+  2147485404, 2147484637, 2147484544, 2147483892, 2147484662, 2147484544, 2147483798, 2147484568, 2147533440, 2147483823, 2147484592, 2147483871, 2147485408, 2147484641, 2136483554, 2143578851,
+  2136499940, 2147484645, 2147485415, 2147484648, 2147485417, 2147484650, 2147485419, 2147484652, 2136445677, 2136477422, 2136442607, 2136443632, 2147484657, 2147485426, 2147484659, 2147485429,
+  2147484662, 2135931644, 2135942909, 2136409854, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322, 2147484555,
+  2147485324, 2147484557, 2147485326, 2147484559, 2147485328, 2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338, 2147484571,
+  2147485340, 2147484573, 2147485342, 2147484575, 2147485344, 2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354, 2147484587,
+  2147485356, 2147484589, 2147485358, 2147484591, 2147485360, 2147484593, 2147485362, 2147484595, 2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370, 2147484603,
+  2147485372, 2147484605, 2147485374, 2147484607, 2147485376, 2147484609, 2147485378, 2147484611, 2147485380, 2147484613, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386, 2147484619,
+  2147485388, 2147484621, 2147485390, 2147484623, 2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635,
+  2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485419, 2147484652, 2147485421, 2147484654, 2147485426, 2147484659, 2147483892, 2147484665,
+  2147484544, 2147483814, 2147484583, 2147483816, 2147484589, 2147483822, 2147484592, 2147483880, 2147470063, 2147484656, 2147483889, 2147484671, 2147484544, 2147483799, 2147484576, 2147483815,
+  2147484584, 2147483823, 2147484592, 2147483831, 2147484600, 2147483839, 2147484608, 2147483847, 2147484616, 2147483855, 2147484624, 2147483863, 2147484632, 2147483871, 2147484640, 2147484544,
+  2147483856, 2147484544, 2147483802, 2147484571, 2163522207, 2147484576, 2177020659, 2147483892, 2155610752, 2155650689, 2155664002, 2155672195, 2155697796, 2155741829, 2155747974, 2155767431,
+  2155793032, 2156452489, 2156490378, 2156495499, 2156518028, 2156537485, 2156557966, 2156611215, 2156631696, 2156641937, 2156799634, 2156894867, 2156922516, 2156926613, 2156956310, 2156964503,
+  2156991128, 2157003417, 2157027994, 2157080219, 2157097628, 2157124253, 2157897374, 2157970079, 2158440096, 2158462625, 2158469794, 2158480035, 2158497444, 2158574245, 2159061670, 2159109799,
+  2159231656, 2159254185, 2159272618, 2159294123, 2159348396, 2159350445, 2159720110, 2159729327, 2159740592, 2159752881, 2159870642, 2159877811, 2159881908, 2160000693, 2160009910, 2160022199,
+  2160029368, 2160090809, 2160107194, 2160124603, 2160205500, 2160799421, 2160845502, 2160865983, 2161622720, 2161626817, 2161710786, 2161726147, 2161738436, 2161758917, 2161797830, 2161801927,
+  2162074312, 2162097865, 2162129610, 2163168971, 2163235532, 2163258061, 2163316430, 2163339983, 2163348176, 2163354321, 2163406546, 2163410643, 2163442388, 2164546261, 2165002966, 2165014231,
+  2165018328, 2165021401, 2165028570, 2165045979, 2165047004, 2165128925, 2165349086, 2165353183, 2165699296, 2165708513, 2165758690, 2165764835, 2165773028, 2165780197, 2165872358, 2165878503,
+  2166110952, 2166117097, 2166166250, 2166182635, 2166229740, 2166471405, 2166477550, 2166493935, 2166827760, 2166955761, 2166960882, 2167146227, 2167234292, 2167280373, 2167666422, 2167801591,
+  2168388344, 2168414969, 2168472314, 2168523515, 2168592124, 2168602365, 2168607486, 2168640255, 2168716928, 2168726145, 2169079426, 2169085571, 2169093764, 2169101957, 2169117318, 2169131655,
+  2169134728, 2169214601, 2169217674, 2169222795, 2170226316, 2170256013, 2170735246, 2170746511, 2170769040, 2171057809, 2171070098, 2171141779, 2171187860, 2171767445, 2171781782, 2171796119,
+  2171830936, 2171867801, 2172070554, 2172081819, 2172149404, 2172402333, 2172433054, 2172646047, 2172666528, 2172670625, 2172894882, 2173082275, 2173209252, 2173214373, 2173218470, 2174173863,
+  2174182056, 2174340777, 2174497450, 2174499499, 2174546604, 2174653101, 2174665390, 2174668463, 2174674608, 2174773937, 2174807730, 2174812851, 2174826164, 2174996149, 2175047350, 2175050423,
+  2175236792, 2175238841, 2175257274, 2175514299, 2175562428, 2175568573, 2175639230, 2175648447, 2175650496, 2175659713, 2175689410, 2176092867, 2176501444, 2176510661, 2176548550, 2176570055,
+  2176577224, 2176586441, 2176589514, 2176629451, 2176632524, 2176648909, 2176653006, 2176665295, 2176691920, 2176706257, 2176713426, 2176772819, 2176787156, 2176790229, 2147483862, 2134933888,
+  2147484545, 2134946434, 2147484547, 2147447478, 2147484599, 2156668600, 2156670649, 2147484603, 2147483840, 2147484609, 2147484544, 2147483799, 2147484569, 2134775195, 2134774172, 2147484573,
+  2147460767, 2147484576, 2147406591, 2147483776, 2147484549, 2147483824, 2139045553, 2139217587, 2139044532, 2139217589, 2139042487, 2139216570, 2139056832, 2139035329, 2139059908, 2139034309,
+  2139114191, 2147483876, 2139012837, 2139194087, 2139197161, 2139198186, 2139202283, 2139205356, 2139206381, 2139011822, 2139208431, 2139209456, 2139009777, 2139010803, 2139011828, 2139014902,
+  2139015927, 2139016952, 2139019005, 2139022078, 2139031295, 2139037312, 2139041409, 2139209346, 2139049604, 2139092615, 2139094665, 2139102858, 2139103884, 2139113101, 2139115150, 2147483791,
+  2147484560, 2154936978, 2155079315, 2154944148, 2157255317, 2154943126, 2154977943, 2154942104, 2165204633, 2155019930, 2154953371, 2154927772, 2157851293, 2157333150, 2155114143, 2147484576,
+  2147483835, 2147484608, 2147483876, 2147484656, 2134417792, 2134416769, 2134415746, 2134414723, 2134413700, 2134412677, 2134411654, 2134410631, 2134409608, 2134408585, 2134407562, 2134406539,
+  2134405516, 2134404493, 2134403470, 2134402447, 2134401424, 2134400401, 2134399378, 2134398355, 2134397332, 2134396309, 2134395286, 2134394263, 2134393240, 2134392217, 2134391194, 2134390171,
+  2134389148, 2134388125, 2134387102, 2147483807, 2134385056, 2134384033, 2134383010, 2134381987, 2134380964, 2134379941, 2134378918, 2134377895, 2134376872, 2134375849, 2134374826, 2134373803,
+  2134372780, 2134371757, 2134370734, 2134369711, 2134368688, 2134367665, 2134366642, 2134365619, 2134364596, 2134363573, 2134362550, 2134361527, 2134360504, 2134359481, 2134358458, 2134357435,
+  2134356412, 2134355389, 2134354366, 2134353343, 2134352320, 2134351297, 2134350274, 2134349251, 2156670660, 2159075013, 2160920262, 2166694599, 2147484616, 2134409936, 2134345425, 2134344402,
+  2134343379, 2134342356, 2134341333, 2134340310, 2134339287, 2134338264, 2134337241, 2134336219, 2134335196, 2134334173, 2134333150, 2134332127, 2138735328, 2138736353, 2138737379, 2138738406,
+  2138739431, 2138740457, 2179353326, 2180556527, 2181157616, 2182360817, 2182961906, 2183562995, 2184766196, 2185969397, 2186570486, 2187773687, 2188374776, 2188975865, 2189576954, 2190178043,
+  2187784956, 2186936061, 2186332926, 2147484671, 2154693248, 2154835585, 2154700418, 2157011587, 2154840708, 2155586181, 2154690182, 2155582087, 2154780296, 2156061321, 2161244810, 2163704459,
+  2162598540, 2161274509, 2172456590, 2157068943, 2160940688, 2161534609, 2161237650, 2166009491, 2156258964, 2164232853, 2171088534, 2166037143, 2155901592, 2166161049, 2164946586, 2157666971,
+  2172073628, 2155493021, 2156087966, 2162763423, 2174064288, 2154939041, 2155601570, 2162360995, 2154666660, 2154701477, 2154665638, 2158821031, 2156211880, 2156022441, 2158212778, 2158161579,
+  2165366444, 2154910381, 2171102894, 2156041903, 2157556400, 2134248113, 2134247090, 2134246067, 2134245044, 2134244022, 2134242999, 2134241976, 2134240953, 2134239930, 2134238907, 2134237884,
+  2134236861, 2134235838, 2134230720, 2134221513, 2134220490, 2134219467, 2134274764, 2134270669, 2134269646, 2134275791, 2146912976, 2146914001, 2146915026, 2146916051, 2146917076, 2146918102,
+  2146919127, 2146920152, 2146921177, 2146922202, 2146923227, 2146924252, 2146925277, 2146926302, 2146927327, 2146928352, 2146930401, 2146931426, 2146932451, 2146933476, 2146935530, 2146937579,
+  2146939628, 2146941677, 2146943726, 2146944755, 2146945780, 2146946805, 2146947835, 2154796799, 2146863744, 2146862721, 2146861698, 2146860675, 2146861700, 2146860677, 2146861702, 2146862727,
+  2146861704, 2146862729, 2146861706, 2146860684, 2146859661, 2146858639, 2146859664, 2146858641, 2146856594, 2146854548, 2146853525, 2146852502, 2146851479, 2146853528, 2146852505, 2146850458,
+  2146849435, 2146850460, 2146851485, 2146850462, 2146851487, 2146850464, 2146851489, 2146854562, 2146853539, 2146857636, 2146863781, 2146864806, 2146862759, 2146863784, 2146866857, 2146867883,
+  2146866860, 2146864813, 2146867886, 2146866863, 2146865840, 2146863793, 2146864818, 2146863795, 2146861749, 2146863798, 2146864823, 2146863800, 2146860729, 2146861754, 2146860731, 2146858684,
+  2146861757, 2146859710, 2146857663, 2146858688, 2146855617, 2146854594, 2146856643, 2146855620, 2146854597, 2146853574, 2146852551, 2146851529, 2146850506, 2146851531, 2146850508, 2146849485,
+  2146851534, 2146850511, 2146851536, 2146854609, 2146853586, 2146852564, 2146851542, 2146853591, 2134074072, 2134064866, 2134063843, 2134062820, 2134061797, 2134060774, 2134059751, 2134058728,
+  2134057705, 2134056682, 2134055659, 2134054637, 2134053614, 2134052591, 2134051568, 2134105841, 2134100722, 2134096627, 2134108917, 2134095607, 2134094584, 2134093561, 2134097658, 2158748411,
+  2160772860, 2157357821, 2160739070, 2161291007, 2134098560, 2134095489, 2134960770, 2134092419, 2134089348, 2134088325, 2134089350, 2134082183, 2134077064, 2134084233, 2134088330, 2134085259,
+  2134950540, 2134949517, 2134081166, 2134078095, 2134074000, 2134076049, 2134077074, 2134069907, 2134082196, 2134941333, 2134072982, 2134062743, 2134068888, 2134062745, 2134069914, 2134935195,
+  2134066844, 2134055581, 2134062750, 2134063775, 2134052512, 2134061729, 2134058658, 2134059683, 2134048420, 2134057637, 2134054566, 2134055591, 2134054568, 2134056617, 2134050474, 2134051499,
+  2134044332, 2134054573, 2134053550, 2134052527, 2134049456, 2134046385, 2134911666, 2134043315, 2134045364, 2134042293, 2134907574, 2134039223, 2134036152, 2134037177, 2134039226, 2134036155,
+  2134901436, 2134033085, 2134030014, 2134031039, 2134027968, 2134028993, 2147483842, 2134015683, 2134014661, 2134013638, 2147483847, 2134012616, 2134014665, 2134013643, 2134014669, 2134013646,
+  2134012623, 2134011601, 2134010578, 2134009555, 2134008533, 2134007510, 2134009559, 2147483864, 2134007513, 2134006490, 2134008539, 2134007516, 2134010589, 2134008542, 2133986015, 2133935840,
+  2133926633, 2133925610, 2133924587, 2133923564, 2133922541, 2133921518, 2133920495, 2133919472, 2133918449, 2133917426, 2133916404, 2133915381, 2133914358, 2133913335, 2133912312, 2133911289,
+  2133910266, 2133909243, 2133908220, 2133907198, 2133959423, 2147484544, 2147483830, 2147484608, 2147484544, 2147483888, 2147484544, 2147483789, 2147484560, 2147483847, 2147484624, 2147484544,
+  2147483820, 2147485376, 2147484609, 2147485378, 2147484611, 2147485380, 2147484613, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386, 2147484619, 2147485388, 2147484621, 2147485390,
+  2147484623, 2147485392, 2147484625, 2147485394, 2147484627, 2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635, 2147485404, 2147484637, 2147485406,
+  2147484639, 2147485408, 2147484641, 2147485410, 2147484643, 2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651, 2147485420, 2147484653, 2147485312,
+  2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485320, 2147484553, 2147485322, 2147484555, 2147485324, 2147484557, 2147485326, 2147484559, 2147485328,
+  2147484561, 2147485330, 2147484563, 2147485332, 2147484565, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338, 2147484571, 2104933020, 2104934045, 2147484574, 2147483896, 2147484544,
+  2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2147485354, 2147484587, 2147485356, 2147484589, 2147485358, 2147484591, 2147485362, 2147484595,
+  2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370, 2147484603, 2147485372, 2147484605, 2147485374, 2147484607, 2147485376, 2147484609, 2147485378, 2147484611,
+  2147485380, 2147484613, 2147485382, 2147484615, 2147485384, 2147484617, 2147485386, 2147484619, 2147485388, 2147484621, 2147485390, 2147484623, 2147485392, 2147484625, 2147485394, 2147484627,
+  2147485396, 2147484629, 2147485398, 2147484631, 2147485400, 2147484633, 2147485402, 2147484635, 2147485404, 2147484637, 2147485406, 2147484639, 2147485408, 2147484641, 2147485410, 2147484643,
+  2147485412, 2147484645, 2147485414, 2147484647, 2147485416, 2147484649, 2147485418, 2147484651, 2147485420, 2147484653, 2147485422, 2147484655, 2147483376, 2147484657, 2147485433, 2147484666,
+  2147485435, 2147484668, 2111304445, 2147485438, 2147484671, 2147485312, 2147484545, 2147485314, 2147484547, 2147485316, 2147484549, 2147485318, 2147484551, 2147485323, 2147484556, 2104189581,
+  2147484558, 2147485328, 2147484561, 2147485330, 2147484563, 2147485334, 2147484567, 2147485336, 2147484569, 2147485338, 2147484571, 2147485340, 2147484573, 2147485342, 2147484575, 2147485344,
+  2147484577, 2147485346, 2147484579, 2147485348, 2147484581, 2147485350, 2147484583, 2147485352, 2147484585, 2104160938, 2104149675, 2104153772, 2104164013, 2104160942, 2147484591, 2104212144,
+  2104187569, 2104209074, 2148434611, 2147485364, 2147484597, 2147485366, 2147484599, 2147485368, 2147484601, 2147485370, 2147484603, 2147485372, 2147484605, 2147485374, 2147484607, 2147483840,
+  2147485378, 2147484611, 2147435204, 2104161989, 2111251142, 2147483847, 2147484663, 2103754488, 2103798521, 2147484666, 2147484544, 2147483820, 2147484592, 2147483834, 2147484608, 2147483896,
+  2147484544, 2147483846, 2147484622, 2147483866, 2147484640, 2147484544, 2147483860, 2147484639, 2147483901, 2147484544, 2147483854, 2147484623, 2147483866, 2147484638, 2147483903, 2147484544,
+  2147483831, 2147484608, 2147483854, 2147484624, 2147483866, 2147484636, 2147484544, 2147483843, 2147484635, 2147483895, 2147483776, 2147484545, 2147483783, 2147484553, 2147483791, 2147484561,
+  2147483799, 2147484576, 2147483815, 2147484584, 2147483823, 2147484592, 2146381532, 2147445469, 2103195358, 2147471071, 2147484640, 2147483880, 2107687664, 2107687552, 2147484608, 2147483886,
+  2147484656, 2147483898, 2147484544, 2147483812, 2147484592, 2147483847, 2147484619, 2147483900, 2147483776, 2118984320, 2109197953, 2119639682, 2119112323, 2111256196, 2102703749, 2104196742,
+  2124043911, 2124042888, 2105614985, 2120425098, 2104619659, 2105602700, 2107877005, 2113236622, 2115623567, 2117385872, 2117772945, 2118097554, 2120086163, 2109979284, 2110790293, 2111770262,
+  2112560791, 2116851352, 2120304281, 2122538650, 2102763163, 2104059548, 2110234269, 2112091806, 2117352095, 2123627168, 2106637985, 2111514274, 2117249699, 2118189732, 2108068517, 2116209318,
+  2117853863, 2107017896, 2109192873, 2110849706, 2112308907, 2120125100, 2103010989, 2103584430, 2103885487, 2108576432, 2110163633, 2112060082, 2113327795, 2115712692, 2117289653, 2117376694,
+  2119361207, 2121788088, 2122898105, 2123563706, 2113750715, 2113998524, 2115079869, 2116693694, 2120685247, 2123693760, 2118538945, 2105439938, 2107049667, 2114745028, 2115823301, 2112123590,
+  2113801927, 2119035592, 2121710281, 2105424586, 2106351307, 2109939404, 2110928589, 2111243982, 2114945743, 2115215056, 2121525969, 2103837394, 2115822291, 2103583444, 2103566037, 2114132694,
+  2115083991, 2116708056, 2121560793, 2118687450, 2108019419, 2109905628, 2118551261, 2102619870, 2106204895, 2107296480, 2112396001, 2112895714, 2103890659, 2113822436, 2103012069, 2107182822,
+  2102565607, 2110624488, 2108702441, 2114904810, 2104058603, 2105264876, 2113295085, 2116775662, 2118446831, 2110335728, 2119761649, 2110544626, 2108042995, 2116404980, 2108206837, 2112863990,
+  2102714103, 2103428856, 2103526137, 2109480698, 2114827003, 2116275964, 2118473469, 2120304382, 2103827199, 2104167040, 2105526913, 2106960514, 2108754563, 2111433348, 2113836677, 2121309830,
+  2122550919, 2123644552, 2123699849, 2103723658, 2109009547, 2110238348, 2119653005, 2106825358, 2107639439, 2107753104, 2108434065, 2111194770, 2111756947, 2112607892, 2113984149, 2115074710,
+  2115723927, 2119580312, 2116900505, 2119837338, 2120662683, 2103570076, 2103712413, 2104262302, 2111612575, 2117896864, 2118395553, 2106891938, 2107198115, 2108120740, 2110269093, 2114609830,
+  2112305831, 2102719144, 2104836777, 2106128042, 2106605227, 2107228844, 2112362157, 2112548526, 2115481263, 2115656368, 2120355505, 2121601714, 2121684659, 2121896628, 2102876853, 2113921718,
+  2120218295, 2121532088, 2107417273, 2102604474, 2103213755, 2106116796, 2106198717, 2108649150, 2109804223, 2111847104, 2113013441, 2116872898, 2119886531, 2123835076, 2108886725, 2121376454,
+  2103642823, 2109132488, 2109254345, 2110643914, 2110998219, 2112419532, 2112762573, 2113566414, 2114782927, 2121939664, 2103341777, 2107732690, 2121438931, 2103008980, 2106397397, 2110804694,
+  2119519959, 2107035352, 2107485913, 2109273818, 2112271067, 2121444060, 2103522013, 2104018654, 2106202847, 2108739296, 2109060833, 2109414114, 2110524131, 2112391908, 2112878309, 2115391206,
+  2117837543, 2117854952, 2120191721, 2121523946, 2103792363, 2110995180, 2104017645, 2111802094, 2112530159, 2117085936, 2121452273, 2122946290, 2123543283, 2109116148, 2110741237, 2116012790,
+  2114147063, 2114233080, 2114610937, 2112035578, 2111470331, 2118480636, 2102595325, 2116346622, 2103504639, 2103451264, 2106758785, 2107852418, 2114670211, 2105935492, 2110547589, 2108865158,
+  2119488135, 2117669512, 2121339529, 2117994122, 2106794635, 2103235212, 2104413837, 2147484558, 2105092752, 2147484561, 2108787346, 2147484563, 2103387797, 2112115350, 2113064599, 2113704600,
+  2113738393, 2113744538, 2113786523, 2121591452, 2114619037, 2115403422, 2147484575, 2117061280, 2147484577, 2118343330, 2147484579, 2119716517, 2119917222, 2147484583, 2121995946, 2122008235,
+  2122052268, 2123243181, 2119877294, 2121409199, 2102786736, 2103106225, 2103209650, 2103597747, 2103624372, 2103734965, 2104336054, 2104442551, 2104541880, 2105024185, 2105129658, 2106107579,
+  2106116796, 2107203261, 2107419326, 2107457215, 2107558592, 2108439233, 2108588738, 2108766915, 2109277892, 2110573253, 2110739142, 2111008455, 2111609544, 2111802057, 2112316106, 2113477323,
+  2113653452, 2113663693, 2113661646, 2113668815, 2113673936, 2113680081, 2113728210, 2113909460, 2113974997, 2114300630, 2114877143, 2114897624, 2114953945, 2115265242, 2115414747, 2115913436,
+  2116055773, 2116054750, 2116543199, 2117780192, 2117916385, 2118287074, 2118343395, 2118762212, 2118815461, 2119516902, 2119648999, 2121395944, 2121685737, 2121746154, 2107124459, 2233600748,
+  2115940077, 2147483886, 2102319856, 2103251697, 2103171826, 2102671091, 2103133940, 2103193333, 2103527158, 2103578359, 2104268536, 2104193785, 2104262394, 2104336123, 2104982268, 2105072381,
+  2105219838, 2105235199, 2105510528, 2105712257, 2106671746, 2106677891, 2106824324, 2106892933, 2107198086, 2107317895, 2107245192, 2107381385, 2107333258, 2107481739, 2107548300, 2107956877,
+  2108045966, 2108100239, 2108365456, 2108657297, 2108823186, 2108826259, 2108885652, 2109969045, 2110034582, 2110433943, 2110852760, 2110835353, 2110923418, 2111180443, 2111523484, 2113153693,
+  2111725214, 2111849119, 2111974048, 2112307873, 2112459426, 2112512675, 2112743076, 2112744101, 2112918182, 2112934567, 2112959144, 2113046185, 2113034922, 2113439403, 2113935020, 2114211501,
+  2114401966, 2114630319, 2114785968, 2115122865, 2115325618, 2116189875, 2116349620, 2117276341, 2117742262, 2117811895, 2117827256, 2118130361, 2118187706, 2118140603, 2118194876, 2118190781,
+  2118172350, 2118249151, 2118331072, 2118721217, 2119293634, 2119614147, 2119915204, 2120140485, 2121194182, 2121298631, 2121415368, 2121550537, 2121586378, 2121597643, 2121645772, 2122389197,
+  2123578062, 2226515663, 2226508496, 2229539537, 2097360594, 2098534099, 2098566868, 2237518549, 2240277206, 2249192151, 2123476696, 2123552473, 2147483866, 2081790592, 2081789569, 2081788546,
+  2081787523, 2081786500, 2081798789, 2081797766, 2147483783, 2083096211, 2083095188, 2083094165, 2083103382, 2083092119, 2147483800, 2083189405, 2147484574, 2083212959, 2083195552, 2083176097,
+  2083178146, 2083184292, 2083194535, 2083195560, 2081687977, 2083192490, 2083191467, 2083190444, 2083189421, 2083162798, 2083161775, 2083160752, 2147483831, 2083160760, 2147483837, 2083160766,
+  2147483839, 2083160768, 2147483842, 2083160771, 2147483845, 2083160774, 2083138251, 2083133132, 2083142349, 2083150542, 2083129039, 2083292880, 2083291857, 2083301074, 2083300051, 2083299028,
+  2083298005, 2083300054, 2083299031, 2083298008, 2083296985, 2083298010, 2083296987, 2083295964, 2083294941, 2083287774, 2083286751, 2083285728, 2083284705, 2083288802, 2083287779, 2083286756,
+  2083285733, 2083278566, 2083277543, 2083276520, 2083275497, 2083318506, 2083317483, 2083316460, 2083315437, 2083316462, 2083315439, 2083314416, 2083313393, 2083277554, 2083276531, 2083275508,
+  2083274485, 2083272438, 2083271415, 2083270392, 2083269369, 2083271418, 2083270395, 2083269372, 2083268349, 2083267327, 2083266176, 2083265153, 2083270274, 2083269251, 2083267204, 2083266181,
+  2083267206, 2083266183, 2083259016, 2083257993, 2083273354, 2083272331, 2083264140, 2083263117, 2083286670, 2083285647, 2083284624, 2083283601, 2083288722, 2083287699, 2083286676, 2083285653,
+  2083288726, 2083287703, 2083286680, 2083285657, 2083282586, 2083281563, 2083280540, 2083279517, 2083287710, 2083286687, 2083285665, 2083284642, 2083283619, 2083287716, 2083286693, 2083285671,
+  2083284648, 2083283625, 2083279530, 2083278507, 2083277484, 2083276461, 2083295918, 2083294895, 2083293873, 2147484594, 2147483842, 2083220179, 2083219156, 2083218133, 2083217110, 2083242711,
+  2083241688, 2083239641, 2083238618, 2083239643, 2083238620, 2083236573, 2083239646, 2083238623, 2083231456, 2083230433, 2083233506, 2083232483, 2083238628, 2083237605, 2083236582, 2083235559,
+  2083096296, 2083095273, 2083058410, 2083057387, 2083056364, 2083055341, 2083054318, 2083053295, 2083052272, 2083051249, 2083050226, 2083049203, 2083048180, 2083047157, 2083046134, 2083045111,
+  2083044088, 2083043065, 2083042042, 2083041019, 2083209980, 2083208957, 2083207934, 2083206911, 2083035776, 2083034753, 2083033730, 2083032707, 2083031684, 2083032709, 2083031686, 2083030663,
+  2083029640, 2083028617, 2083027594, 2083028619, 2083027596, 2083026573, 2083025550, 2083024527, 2083023504, 2083022482, 2083021459, 2083020436, 2083019414, 2083018392, 2083017370, 2083016347,
+  2083020444, 2083019421, 2083018398, 2083017375, 2083018400, 2083017377, 2083016355, 2083015332, 2083014309, 2083013287, 2083012266, 2083011244, 2083017389, 2083016366, 2083015343, 2083014320,
+  2083013297, 2083012274, 2083011252, 2083010229, 2083009206, 2083008184, 2083007161, 2083006138, 2083005115, 2083004092, 2083003069, 2083002046, 2083001024, 2083000001, 2082998978, 2082997955,
+  2082996932, 2082995910, 2082994887, 2082993864, 2082992841, 2082991818, 2082990796, 2082989773, 2082988750, 2082987727, 2082986704, 2082985682, 2082984659, 2082983636, 2082985685, 2082984662,
+  2082983639, 2082982616, 2082981593, 2082980570, 2082952923, 2082976477, 2081360350, 2081359327, 2081358304, 2081357281, 2081356258, 2081355235, 2082933476, 2082932453, 2082931430, 2082930407,
+  2082929384, 2082928361, 2082929386, 2082928363, 2082927340, 2082926317, 2082925294, 2082924271, 2082925296, 2082924273, 2082923250, 2082922227, 2082921204, 2082920181, 2082919159, 2082918136,
+  2082917113, 2082916090, 2082915067, 2082936572, 2082935549, 2082934527, 2082934400, 2082933377, 2082932354, 2082931331, 2082930308, 2082929286, 2082928263, 2082927241, 2082926219, 2082925196,
+  2082924173, 2082923150, 2082922127, 2082924176, 2082923154, 2082922131, 2082921108, 2082920085, 2082919062, 2082881175, 2082880152, 2082879129, 2082878106, 2082877083, 2082878108, 2082877085,
+  2082876062, 2082875039, 2082874016, 2082875041, 2082874018, 2082872995, 2082871972, 2082870949, 2082869928, 2082868906, 2082867884, 2082871981, 2082870958, 2082869935, 2082868912, 2082869937,
+  2082868914, 2082867891, 2082866869, 2082865846, 2082864823, 2082863803, 2082862781, 2082868926, 2082867903, 2082866880, 2082865857, 2082864835, 2082863813, 2082862790, 2082861767, 2082860744,
+  2082859722, 2082858699, 2082857676, 2082856653, 2082855631, 2082854608, 2082853585, 2082852563, 2082851540, 2082850517, 2082849494, 2082848472, 2082847449, 2082849498, 2082848475, 2082847452,
+  2082846429, 2082845406, 2082807519, 2082806496, 2082807521, 2082806498, 2082807523, 2082806500, 2082805478, 2082812647, 2082811624, 2082810602, 2082824939, 2082823916, 2082824942, 2082823919,
+  2082826992, 2082825969, 2082814706, 2082813683, 2082812660, 2082802421, 2082801398, 2082802423, 2082801400, 2082800378, 2082792187, 2082791164, 2082790142, 2082781951, 2082780800, 2082778753,
+  2082777730, 2082778755, 2082777732, 2082783877, 2082782854, 2082781832, 2082778761, 2082777738, 2082776715, 2082775692, 2082774669, 2082772622, 2082773647, 2082772626, 2082773651, 2082772628,
+  2082771606, 2082763415, 2082762392, 2082761370, 2082753179, 2082752156, 2082750109, 2082749086, 2082750111, 2082749088, 2082755233, 2082754210, 2082753188, 2082750117, 2082749094, 2082748071,
+  2082747048, 2082746025, 2082743978, 2082745003, 2082741933, 2082740910, 2082739887, 2082738864, 2082736817, 2082738867, 2082733748, 2082732725, 2082731702, 2082730680, 2082729657, 2082731706,
+  2082713276, 2082712253, 2147484606, 2147483840, 2082695888, 2082694865, 2082693842, 2082692819, 2082691796, 2082690773, 2082689750, 2082688727, 2082689752, 2082688729, 2082687707, 2082692828,
+  2082691805, 2082690782, 2082689759, 2082688736, 2082687713, 2082686690, 2082685667, 2082686692, 2082685669, 2082684646, 2082682599, 2082681576, 2082680553, 2082679530, 2082678507, 2082677484,
+  2082676461, 2082677486, 2082676463, 2082675440, 2082674418, 2082673395, 2082672372, 2082673397, 2082672374, 2082671351, 2082670328, 2082669306, 2082668283, 2082674428, 2082673405, 2082672383,
+  2082673280, 2082672257, 2082671234, 2082670211, 2082669188, 2082668165, 2082667142, 2082666119, 2082665096, 2082664074, 2082663051, 2082662028, 2082661005, 2082659982, 2082658959, 2147483792,
+  2082655890, 2082656915, 2082655892, 2082653845, 2082652822, 2082651799, 2082650776, 2082649753, 2082648730, 2082647707, 2082650780, 2082649757, 2082613918, 2082614943, 2082613920, 2082612897,
+  2082611874, 2082610851, 2082609828, 2082610853, 2082609830, 2082608807, 2082614952, 2082615977, 2082613930, 2082614955, 2082628268, 2082627245, 2082632366, 2082631343, 2082630320, 2082624177,
+  2082620082, 2082623155, 2082618036, 2082619061, 2082606774, 2082615991, 2082618040, 2082615993, 2082613946, 2082611899, 2082612925, 2082585278, 2082608832, 2082603713, 2082577090, 2082603715,
+  2082592452, 2082587333, 2082584262, 2082602695, 2147483848, 2082543344, 2082555633, 2082526962, 2082525939, 2082555636, 2082538229, 2082533110, 2082540279, 2082554616, 2082534137, 2082532858,
+  2082522619, 2082526972, 2147484669, 2147483902, 2147484160, 2080928144, 2093466257, 2147483794, 2080939411, 2080911765, 2080941462, 2093481623, 2147483801, 2147484576, 2147483824, 2089258673,
+  2089256626, 2080944563, 2080943540, 2080886197, 2080969143, 2080970168, 2093444793, 2093438651, 2093430461, 2093426367, 2093428417, 2147484613, 2080920007, 2080921032, 2080857545, 2080856522,
+  2080855499, 2080854476, 2080917965, 2080916942, 2080915919, 2080862672, 2093400785, 2147483858, 2080873940, 2080871893, 2080875990, 2080844247, 2089218776, 2080849369, 2080932315, 2080933340,
+  2093407965, 2080838111, 2080840160, 2080843233, 2080844515, 2080858596, 2080859621, 2080857574, 2147483879, 2080887272, 2080828905, 2080855531, 2147483884, 2080817648, 2082422513, 2080815602,
+  2147484659, 2080813556, 2147483893, 2080811510, 2082416375, 2080809464, 2082414329, 2080807418, 2082412283, 2080805372, 2082410237, 2080803326, 2082408191, 2082375296, 2082374274, 2082373252,
+  2082372230, 2082371208, 2082370186, 2082369163, 2082368140, 2082367118, 2082366096, 2082365073, 2082364050, 2082363028, 2082362006, 2082360983, 2082359960, 2082358938, 2082357915, 2082356892,
+  2082355870, 2082354847, 2082353824, 2082352802, 2082351779, 2082350756, 2082349734, 2082348711, 2082347688, 2082346666, 2082345644, 2082344622, 2082343600, 2082342578, 2082341555, 2082340532,
+  2082339510, 2082338487, 2082337464, 2082336442, 2082335419, 2082334396, 2082333374, 2082332351, 2082331328, 2082330306, 2082329283, 2082328260, 2082327238, 2082326215, 2082325192, 2082324170,
+  2082323147, 2082322124, 2082321102, 2082320079, 2082319056, 2082325201, 2082324178, 2082323155, 2082322132, 2082321110, 2082320087, 2082319064, 2082318042, 2082317019, 2082315996, 2082314974,
+  2082313951, 2082312928, 2082311906, 2082310883, 2082309860, 2082308838, 2082307815, 2082306792, 2082305770, 2082304747, 2082303724, 2082302702, 2082301680, 2082300658, 2082299635, 2082298612,
+  2082291445, 2082290422, 2082289399, 2082288376, 2082287353, 2082286330, 2082285307, 2082284284, 2147483901, 2147484287, 2147483776, 2080670081, 2080670349, 2080670095, 2080670352, 2080670106,
+  2080703137, 2080670139, 2080670401, 2080670171, 2091424479, 2080585441, 2093132514, 2093119204, 2093374181, 2093363942, 2093279975, 2093281000, 2093282025, 2093283050, 2093284075, 2093342444,
+  2093343469, 2093344494, 2093306607, 2093363952, 2093270769, 2093271794, 2093272819, 2093273844, 2093274869, 2093275895, 2093276920, 2093277945, 2093278970, 2093279995, 2093281020, 2093282045,
+  2093283070, 2093284095, 2093284992, 2093286017, 2093288066, 2093289091, 2093290116, 2093291141, 2093293195, 2093295244, 2093297293, 2093299342, 2093301391, 2093302420, 2093303445, 2093304470,
+  2093305500, 2093308573, 2093215390, 2147483808, 2084929185, 2085101219, 2084928164, 2085101221, 2084926119, 2085100202, 2084940464, 2084918961, 2084943540, 2084917941, 2147483839, 2084994754,
+  2147483848, 2084992714, 2147483856, 2084990674, 2147483864, 2084988634, 2147483869, 2080574176, 2080582370, 2080437731, 2080574180, 2080572133, 2088963814, 2147483879, 2090101480, 2089197289,
+  2090258157, 2090301166, 2147483887, 2147484544, 2147483788, 2147484557, 2147483815, 2147484584, 2147483835, 2147484604, 2147483838, 2147484607, 2147483854, 2147484624, 2147483870, 2147484544,
+  2147483899, 2147484544, 2147483779, 2147484551, 2147483828, 2147484599, 2147484544, 2147483791, 2147484560, 2147483804, 2147484576, 2147483809, 2147484624, 2147483902, 2147484544, 2147483805,
+  2147484576, 2147483857, 2147484640, 2147483900, 2147484544, 2147483812, 2147484589, 2147483851, 2147484624, 2147483899, 2147484544, 2147483806, 2147484575, 2147483844, 2147484616, 2147483862,
+  2147525248, 2147484584, 2147484544, 2147483806, 2147484576, 2147483818, 2147525296, 2147483860, 2147484632, 2147483900, 2147484544, 2147483816, 2147484592, 2147483876, 2147484655, 2147483888,
+  2147484544, 2147483831, 2147484608, 2147483862, 2147484640, 2147483880, 2147484544, 2147483782, 2147484552, 2147483785, 2147484554, 2147483830, 2147484599, 2147483833, 2147484604, 2147483837,
+  2147484607, 2147483862, 2147484631, 2147484544, 2147483807, 2147484583, 2147483824, 2147484640, 2147483891, 2147484660, 2147483894, 2147484667, 2147484544, 2147483804, 2147484575, 2147483834,
+  2147484607, 2147483840, 2147484544, 2147483832, 2147484604, 2147483856, 2147484626, 2147484544, 2147483780, 2147484549, 2147483783, 2147484556, 2147483796, 2147484565, 2147483800, 2147484569,
+  2147483830, 2147484600, 2147483835, 2147484607, 2147483849, 2147484624, 2147483865, 2147484640, 2147484544, 2147483808, 2147484608, 2147483879, 2147484651, 2147483895, 2147484544, 2147483830,
+  2147484601, 2147483862, 2147484632, 2147483891, 2147484664, 2147484544, 2147483794, 2147484569, 2147483805, 2147484585, 2147483824, 2147484544, 2147483849, 2147549824, 2147483827, 2147484608,
+  2147483891, 2147484666, 2147484544, 2147483816, 2147484592, 2147483834, 2147483776, 2147484640, 2147483903, 2147484544, 2147483816, 2147484592, 2147483866, 2147483776, 2147484640, 2147483895,
+  2147484544, 2147483854, 2147484626, 2147483888, 2147484671, 2147484544, 2147483837, 2147484606, 2147483842, 2147484624, 2147483881, 2147484656, 2147483898, 2147484544, 2147483829, 2147484598,
+  2147483847, 2147484624, 2147483895, 2147484544, 2147483854, 2147484624, 2147483872, 2147484641, 2147483893, 2147484544, 2147483794, 2147484563, 2147483839, 2147484544, 2147483783, 2147484552,
+  2147483785, 2147484554, 2147483790, 2147484559, 2147483806, 2147484575, 2147483818, 2147484592, 2147483883, 2147484656, 2147483898, 2147484544, 2147483780, 2147484549, 2147483789, 2147484559,
+  2147483793, 2147484563, 2147483817, 2147484586, 2147483825, 2147484594, 2147483828, 2147484597, 2147483834, 2147484603, 2147483845, 2147484615, 2147483849, 2147484619, 2147483854, 2147484624,
+  2147483857, 2147484631, 2147483864, 2147484637, 2147483876, 2147484646, 2147483885, 2147484656, 2147483893, 2147484544, 2147483866, 2147484635, 2147483868, 2147484637, 2147483872, 2147484544,
+  2147483848, 2147484624, 2147483866, 2147484544, 2147483830, 2147484600, 2147483870, 2147484544, 2147483845, 2147484624, 2147483866, 2147484640, 2147483885, 2147484544, 2147483833, 2147484608,
+  2147483850, 2147484544, 2147483803, 2147484573, 2147483820, 2147484592, 2147483840, 2147484544, 2147483836, 2147483776, 2147517088, 2147484608, 2147483891, 2147484671, 2147483776, 2147484576,
+  2147483816, 2147484586, 2147483864, 2147484634, 2147483877, 2147484544, 2147483848, 2147484624, 2147484544, 2147483811, 2147484608, 2147483897, 2147484544, 2147483785, 2147484554, 2147483831,
+  2147484600, 2147483846, 2147484624, 2147483885, 2147484656, 2147484544, 2147483792, 2147484562, 2147483816, 2147484585, 2147483831, 2147484544, 2147483783, 2147484552, 2147483786, 2147484555,
+  2147483831, 2147484602, 2147483835, 2147484604, 2147483838, 2147484607, 2147483848, 2147484624, 2147483866, 2147484640, 2147483878, 2147484647, 2147483881, 2147484650, 2147484544, 2147483791,
+  2147484560, 2147483794, 2147484563, 2147483801, 2147484576, 2147483818, 2147483776, 2147484640, 2147483897, 2147483776, 2147484608, 2147483890, 2147484671, 2147484544, 2147483802, 2147484544,
+  2147483887, 2147484656, 2147483893, 2147484544, 2147483844, 2147484544, 2147483823, 2147484544, 2147483847, 2147484544, 2147483833, 2147484608, 2147483871, 2147484640, 2147483882, 2147484654,
+  2147483888, 2147483776, 2147484624, 2147483886, 2147484656, 2147483894, 2147484544, 2147483846, 2147484624, 2147483866, 2147484635, 2147483874, 2147484643, 2147483896, 2147484669, 2147484544,
+  2147483792, 2147483776, 2147517120, 2147484640, 2147484544, 2147483803, 2147484544, 2147483851, 2147484623, 2147484544, 2147483784, 2147484559, 2147483808, 2147484640, 2147483876, 2147484544,
+  2147483896, 2147484544, 2147483891, 2147484544, 2147483807, 2147484624, 2147483859, 2147484644, 2147483880, 2147484656, 2147484544, 2147483900, 2147484544, 2147483883, 2147484656, 2147483901,
+  2147484544, 2147483785, 2147484560, 2147483802, 2147484572, 2147484192, 2147483812, 2147484544, 2147483894, 2147484544, 2147483815, 2147484585, 2147477214, 2147476192, 2147475169, 2147474146,
+  2147473123, 2147472100, 2147484645, 2147483891, 2147484667, 2147484544, 2147482299, 2147480253, 2147478207, 2147484609, 2147483881, 2147484544, 2147483846, 2147483776, 2147484640, 2147483892,
+  2147484544, 2147483863, 2147484640, 2147483897, 2024900224, 2024873626, 2024847028, 2024820430, 2147483861, 2024820438, 2024793832, 2024793728, 2024767106, 2024740508, 2147483805, 2024740510,
+  2147483808, 2024740514, 2147483811, 2024740517, 2147483815, 2024740521, 2147483821, 2024740526, 2024713910, 2147483834, 2024713915, 2147483836, 2024713917, 2147483844, 2024713925, 2024687312,
+  2024660714, 2024660608, 2024633988, 2147483782, 2024633991, 2147483787, 2024633997, 2147483797, 2024634006, 2147483805, 2024607390, 2024580792, 2147483834, 2024580795, 2147483839, 2024580800,
+  2147483845, 2024580806, 2147483847, 2024580810, 2147483857, 2024554194, 2024527596, 2024527488, 2024500870, 2024474272, 2024447674, 2024421076, 2024394478, 2024394368, 2024367752, 2024341154,
+  2024314556, 2024287958, 2024261360, 2024261248, 2024234634, 2024421028, 2024688293, 2147483814, 2025072296, 2025062073, 2025072314, 2032999105, 2025045698, 2025046739, 2025045716, 2032967387,
+  2025023196, 2025025245, 2025026270, 2025037535, 2025031392, 2025029345, 2025012962, 2025002739, 2025012980, 2032939771, 2024986364, 2024986240, 2024987277, 2024986254, 2032907925, 2024963734,
+  2024965783, 2024966808, 2024978073, 2024971930, 2024969883, 2024953500, 2024943277, 2024953518, 2032880309, 2024926902, 2024927943, 2024926920, 2032848591, 2024904400, 2024906449, 2024907474,
+  2024918739, 2024912596, 2024910549, 2024894166, 2024883943, 2024894184, 2032820975, 2024867568, 2024867456, 2024868481, 2024867458, 2032789129, 2024844938, 2024846987, 2024848012, 2024859277,
+  2024853134, 2024851087, 2024834704, 2024824481, 2024834722, 2032761513, 2024808106, 2024809147, 2024808124, 2032729795, 2024785604, 2024787653, 2024788678, 2024799943, 2024793800, 2024791753,
+  2024820426, 2024819403, 2147483852, 2023852750, 2023842520, 2023832290, 2023822060, 2023811830, 2147484544, 2147483788, 2147484571, 2147483808, 2147484577, 2147483824, 2147484544, 2147483783,
+  2147484552, 2147483801, 2147484571, 2147483810, 2147484579, 2147483813, 2147484582, 2147483819, 2147484544, 2147483821, 2147484592, 2147483838, 2147484608, 2147483850, 2147484622, 2147483856,
+  2147483776, 2147484608, 2147483898, 2147484671, 2147484544, 2147483845, 2147484615, 2147483863, 2147519104, 2147484578, 2147483852, 2147484624, 2147483866, 2147484638, 2147483872, 2147483776,
+  2147484657, 2147484544, 2147483829, 2147483776, 2147484545, 2147483838, 2019597952, 2019601026, 2019603075, 2147483780, 2019626629, 2019603078, 2019596935, 2019606152, 2019624585, 2019616394,
+  2019595918, 2019601039, 2019608208, 2019594897, 2019607186, 2019588755, 2019590804, 2019579541, 2019581591, 2019582616, 2019587737, 2019588762, 2019589787, 2019642012, 2019718813, 2019692190,
+  2019639967, 2147483808, 2019565217, 2019568290, 2147483811, 2019593892, 2147483813, 2019564199, 2147483816, 2019591849, 2019583658, 2019563182, 2019568303, 2019575472, 2019562161, 2019574450,
+  2147483827, 2019558068, 2019546805, 2019548855, 2147483832, 2019555001, 2147483834, 2019557051, 2147483836, 2019535554, 2147483843, 2019531463, 2147483848, 2019559113, 2147483850, 2019550923,
+  2147483852, 2019550925, 2019530446, 2019535567, 2147483856, 2019529425, 2019541714, 2147483859, 2019525332, 2147483861, 2019516119, 2147483864, 2019522265, 2147483866, 2019524315, 2147483868,
+  2019653341, 2147483870, 2019574495, 2147483872, 2019499745, 2019502818, 2147483875, 2019528420, 2147483877, 2019498727, 2019507944, 2019526377, 2019518186, 2147483883, 2019518188, 2019497710,
+  2019502831, 2019510000, 2019496689, 2019508978, 2147483891, 2019492596, 2019481333, 2019483383, 2147483896, 2019489529, 2019490554, 2019491579, 2019543804, 2147483901, 2019593982, 2147483903,
+  2019466880, 2019469954, 2019472003, 2019495556, 2019472006, 2019465863, 2019475080, 2019493513, 2147483786, 2019485323, 2019464846, 2019469967, 2019477136, 2019463825, 2019476114, 2019457683,
+  2019459732, 2019448469, 2019450519, 2019451544, 2019456665, 2019457690, 2019458715, 2147483804, 2019434145, 2019437218, 2019439267, 2147483812, 2019462821, 2019439270, 2019433127, 2019442344,
+  2019460777, 2147483818, 2019452587, 2019432110, 2019437231, 2019444400, 2019431089, 2019443378, 2019424947, 2019426996, 2019415733, 2019417783, 2019418808, 2019423929, 2019424954, 2019425979,
+  2147483836, 2147484656, 2147483890, 2147484544, 2147483820, 2147484592, 2147484544, 2147483796, 2147484576, 2147483823, 2147484593, 2147483840, 2147484609, 2147483856, 2147484625, 2147483894,
+  2147483776, 2017246593, 2147484555, 2147483789, 2017223056, 2017222033, 2017221010, 2017219987, 2017218964, 2017217941, 2017216918, 2017215895, 2017214872, 2017213849, 2017212826, 2017211803,
+  2017210780, 2017209757, 2017208734, 2017207711, 2017206688, 2017205665, 2017204642, 2017203619, 2017202596, 2017201573, 2017200550, 2017199527, 2017198504, 2017197481, 2029759146, 2017256107,
+  2017270444, 2017254061, 2017273518, 2147484591, 2017248944, 2017229514, 2017233611, 2017238732, 2017237709, 2017233614, 2017239759, 2147484624, 2017201898, 2017200875, 2017199852, 2147483885,
+  2147484656, 2147484544, 2017153680, 2147484561, 2147483821, 2147484646, 2029645440, 2029701761, 2029702786, 2147483779, 2042687120, 2040863377, 2038885010, 2029703827, 2037506708, 2040272533,
+  2053060246, 2040285847, 2037527192, 2043682457, 2046566042, 2043542171, 2038482588, 2041953949, 2038283934, 2043561631, 2038429344, 2049738401, 2047604386, 2053773987, 2040214180, 2038977189,
+  2046016166, 2042739367, 2042934952, 2037341865, 2037350058, 2054717099, 2041506476, 2037383853, 2038896302, 2042847919, 2053964464, 2042661553, 2048736946, 2048990899, 2038911668, 2045849269,
+  2043891382, 2043889335, 2047602360, 2038490809, 2039345850, 2054965947, 2147483836, 2029474496, 2029473473, 2029472450, 2029471427, 2029470404, 2029469381, 2029468358, 2029467335, 2029466312,
+  2147483849, 2041913040, 2038856401, 2147483858, 2147484640, 2147483878, 2147484544, 2147483862, 2147484640, 2147483885, 2147484656, 2147483899, 2147484544, 2147483892, 2147484544, 2147483865,
+  2147484640, 2147483884, 2147484544, 2147483788, 2147484560, 2147483848, 2147484624, 2147483866, 2147484640, 2147484544, 2147483784, 2147484560, 2147483822, 2147484544, 2147483788, 2147484557,
+  2147483890, 2147484659, 2147483895, 2147484666, 2147484544, 2147483811, 2147484581, 2147483819, 2147484590, 2147483851, 2147484621, 2147484544, 2147483860, 2147484640, 2147483886, 2147484656,
+  2147483892, 2147484664, 2147483899, 2147484544, 2147483779, 2147484560, 2147483798, 2147484544, 2147483863, 2147484544, 2147483829, 2147484608, 2147484544, 2147483806, 2147484576, 2147484544,
+  2147483810, 2147484592, 2147484544, 2147483873, 1968764544, 1968758401, 1968766594, 2082766467, 1969058436, 1969137285, 1969149574, 1969221255, 1969343112, 1969373833, 1969452682, 1969427083,
+  1962035852, 2084091533, 1969553038, 1969559183, 1969574544, 1969592977, 2083793554, 1962056339, 1969573524, 1969611413, 2083837590, 1969619607, 1969631896, 1968885401, 1969638042, 1969646235,
+  2120683164, 1969709725, 1969723038, 1962082975, 1969778336, 1969788577, 1969832610, 1969836707, 1962133156, 1969916581, 1969917606, 1969944231, 1969965736, 1969975977, 1969992363, 1970042540,
+  1970049709, 1970057902, 1970082479, 1970091696, 1970092721, 1970091698, 1970090675, 2085085876, 1977675445, 1970164406, 1970184887, 2085400248, 1970195129, 1970200250, 1970220731, 1970375356,
+  1970269885, 1970285246, 1970316991, 1970375360, 1970460353, 1970485954, 1970553539, 1970568900, 1970601669, 1970600646, 1970621127, 1970638536, 1970645705, 1970660042, 1971007179, 1970727628,
+  1971006157, 1970802382, 1970837199, 1969675984, 1971484369, 1971188434, 1971226323, 1971250900, 1971116757, 1971286742, 1971284695, 1971409624, 2087857881, 1971479258, 1971483355, 1971497692,
+  1971517149, 1971524318, 1971588831, 2088313568, 2088380129, 1971727074, 1971774179, 1971785444, 1971703525, 1971847910, 1962548967, 2147483880, 1972010729, 1972065002, 1972063979, 2089120492,
+  1972198125, 1972218606, 1972232943, 1972244208, 2089459441, 1972254450, 1972260595, 2147483892, 1972287221, 1962684150, 1972348663, 1972361976, 1972444921, 1972391674, 2090182395, 1972575996,
+  2090182397, 1972617982, 1972613887, 1972630144, 1972732545, 1962848899, 1972758148, 1972801157, 1972821638, 1972865671, 1962896008, 2091117193, 1962920586, 1972934283, 1972936332, 1972938381,
+  1972957838, 2125205135, 1973009040, 2091549329, 2091548306, 1982184083, 1973041812, 1973040789, 1962985110, 2095613591, 2107968152, 1973102233, 1973110426, 1963008667, 1973156508, 1973207709,
+  1973216926, 1973250719, 1973388960, 1963091617, 1963059874, 1973405347, 2092483236, 1973455525, 1973586598, 1973589671, 1973590696, 1973587625, 1973633706, 1973653163, 1973689004, 1973673645,
+  1973683886, 1973730991, 1973750448, 1973753521, 1973779122, 1973789363, 1973855924, 1973940917, 1973975734, 1974101687, 2093568696, 1974080185, 1974012602, 1974122171, 1974148796, 1974247101,
+  2093797054, 1974308543, 1974212288, 1974182593, 1963307714, 1974377155, 1974397636, 1974428357, 1974388422, 1963366087, 1974607560, 1974636233, 2094858954, 1974756043, 1975038668, 1974858445,
+  1963536078, 1974930127, 1963516624, 1963478737, 1969423058, 1969425107, 1975038676, 1974935253, 1981767382, 1965820631, 1975058136, 1975061209, 1975066330, 1975127771, 1975115484, 2095815389,
+  1963568862, 1975283423, 1975162592, 1975371489, 1975422690, 2095983331, 1975429860, 1975315173, 1975565030, 1963645671, 1975610088, 1975708393, 1975780074, 1975973611, 2096553708, 1976023789,
+  1963764462, 1976093423, 2097078000, 1976143601, 1963815666, 1976172275, 1976217332, 1976243957, 2097568503, 2089832184, 2097678073, 1976390394, 2098136827, 1976504060, 1976517373, 1976411902,
+  1976590079, 1976629888, 1976687233, 1976630914, 1976670851, 1976685188, 1976697477, 2098225798, 1976612487, 1976868488, 1976931977, 1964025482, 1977025163, 1977020044, 2098664077, 1976807054,
+  1977187983, 2098805392, 2098853521, 1977275026, 1977391763, 1977363092, 1977358997, 1964114582, 1977405079, 1977456280, 1977449113, 1977503386, 2083531419, 1977656988, 2099583645, 1977744030,
+  2147483807, 1977885344, 1977897633, 1977924258, 2100532899, 1977971364, 1977991845, 2100838054, 2101065383, 1978223272, 1978239657, 1964378794, 1978264235, 1964389036, 1964388013, 1978427054,
+  1978447535, 1978468016, 1978487473, 1978557106, 1964483251, 1978647220, 2102134453, 1978671798, 2102226615, 1978720952, 2090965689, 1978882746, 2103024315, 2103046844, 2103189181, 1964702398,
+  1964713663, 1979110080, 2103364289, 2103362242, 2103401155, 2103426756, 1979147973, 1979146951, 1979189960, 1964753609, 1979254474, 1964764875, 1964845772, 2104181453, 1979450062, 1979512527,
+  1979577040, 1964919505, 2104709842, 1979715283, 2104826580, 2104869589, 1979770582, 1979863767, 1964990168, 1979948761, 1979957978, 1979962075, 2105574108, 2105879261, 2105878238, 2147483871,
+  1965198048, 2106141409, 1980338914, 1980340963, 1965231844, 2106355429, 1980609254, 1965352679, 1980629736, 1980623593, 1980652266, 2107141867, 1980751596, 1965445869, 1980851950, 1980911343,
+  1980978928, 1965494001, 2107824882, 2107855603, 1965528820, 2108003061, 1981289206, 2108104439, 1981314808, 1981417209, 1981427450, 2108522235, 2108595964, 1981517565, 2108730110, 1981531903,
+  2095545984, 1965642369, 1981596290, 1981678211, 1965694596, 1981736581, 1971633798, 2109244039, 2109257352, 2095590025, 2095598218, 1981930123, 1981932172, 1985496717, 1965782670, 1982073487,
+  1982066320, 1982083729, 1969522322, 1982102163, 1982103188, 1982112405, 1982153366, 2110166679, 1982150296, 1982206617, 1982277274, 1982352027, 1982209692, 1982366365, 1982408350, 1982522015,
+  1982254752, 1982375585, 1982376610, 1982391971, 2110409380, 2110724773, 2110570150, 1965953703, 1982670504, 1982671529, 1982706346, 2112388779, 1982784172, 2111176365, 1965997742, 1966000815,
+  2111309488, 2111604401, 1966007986, 1983018675, 1983029940, 1983040181, 1983041206, 1983105719, 1983070904, 1983207097, 1983161018, 1983314619, 1983230652, 1983298237, 1983324862, 2147483839,
+  1983416000, 1983447745, 1966137026, 1983542979, 1983545028, 2113047237, 1983661766, 1983667911, 1966192328, 1983694537, 1961608906, 2113638091, 2113825484, 1966327501, 1966335694, 1984120527,
+  1984198352, 1984358097, 1984564946, 2114672339, 1984650964, 1984672469, 1984763606, 1984856791, 2115329752, 2084089561, 1984939738, 1984923355, 1984975580, 2084308701, 1985207006, 1985308383,
+  2117061344, 2117087969, 1985661666, 1985755875, 1985787620, 2117412581, 1985795814, 1986086631, 1986248424, 1986153194, 1986542315, 1986569964, 2118661869, 1986950894, 1967037167, 1986993904,
+  2119047921, 1967117042, 1987265267, 1972304628, 1987361525, 2120040182, 2120257271, 1967250168, 1967257337, 1987549946, 2120761083, 1967315708, 2120902397, 1987589886, 1987588863, 1987618432,
+  2121193089, 1987805826, 1967440515, 1987876484, 1988004485, 1988031110, 1988091527, 1967594120, 2122620553, 1988371082, 1988679307, 1988871820, 1967851149, 1967881870, 1988977295, 2124085904,
+  1967890065, 2124140178, 2124410515, 2124543636, 1989319317, 1967981206, 1989380759, 1989384856, 1989391001, 1989400218, 1989406363, 1989443228, 2125434525, 2147483806, 2147484160, 2147484160,
+  2147483888,
+};
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The packed run of the code point
+constexpr auto find_run(char32_t code_point) noexcept -> std::uint32_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = blocks[code_point >> block_shift];
+  auto first = std::size_t(block_runs[block]), last = std::size_t(block_runs[block + 1]);
+  auto low = static_cast<std::uint32_t>(code_point) & block_mask;
+
+  // the first run of a block starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((runs[middle] & block_mask) <= low) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return runs[first];
+}
+
+/// The code points below `direct_size` are looked up with one load
+inline constexpr auto direct_size = std::size_t(0x800);
+
+constexpr auto make_direct_runs() noexcept {
+  auto table = std::array<std::uint32_t, direct_size>{};
+  for (auto i = std::size_t(0); i < direct_size; ++i) {
+    table[i] = find_run(static_cast<char32_t>(i));
+  }
+  return table;
+}
+
+/// The packed run of each code point below `direct_size`
+inline constexpr auto direct_runs = make_direct_runs();
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The packed run of the code point
+constexpr auto run_of(char32_t code_point) noexcept -> std::uint32_t {
+  return (code_point < direct_size) ? direct_runs[code_point] : find_run(code_point);
+}
+
+/// \param run A packed run
+/// \return The value of `idna_status` of the run
+constexpr auto status_of(std::uint32_t run) noexcept -> int {
+  return static_cast<int>((run >> block_shift) & ((std::uint32_t(1) << status_bits) - 1));
+}
+
+/// \param run A packed run
+/// \return The difference between the mapped value and the code point
+constexpr auto offset_of(std::uint32_t run) noexcept -> std::int32_t {
+  return static_cast<std::int32_t>(run >> (block_shift + status_bits)) - offset_bias;
+}
+}  // namespace skyr::idna_data
+
+#endif  // SKYR_DOMAIN_IDNA_TABLE_HPP
@@ -0,0 +1,1924 @@
+// Auto-generated by tools/make_nfc_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_NFC_TABLE_HPP
+#define SKYR_DOMAIN_NFC_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/// The normalization table of the NFC step of IDNA processing
+///
+/// The variables are `inline`, as those of the IDNA mapping table.
+namespace skyr::nfc_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = 7;
+
+/// The number of bits of the combining class index of a value
+inline constexpr auto class_bits = 6;
+
+/// Every code point below this one has a canonical combining class of 0
+/// and an NFC_Quick_Check value of Yes
+inline constexpr auto first_value = U'\x300';
+
+/// The canonical combining classes, indexed by the values of the table
+inline constexpr auto combining_classes = std::array<std::uint8_t, 56>{
+  0, 1, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+  20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+  36, 84, 91, 103, 107, 118, 122, 129, 130, 132, 202, 214, 216, 218, 220, 222,
+  224, 226, 228, 230, 232, 233, 234, 240,
+};
+
+/// The index of the runs of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = std::array<std::uint8_t, 8704>{
+  0, 0, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8,
+  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 30, 31,
+  0, 32, 33, 0, 34, 35, 36, 37, 38, 39, 0, 40, 0, 0, 41, 42,
+  43, 44, 45, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 47, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0,
+  51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 54, 0, 0,
+  55, 56, 57, 58, 0, 59, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 61, 61, 62, 63, 64, 0, 0, 0, 0, 0, 65, 0, 0, 0,
+  0, 0, 0, 66, 0, 67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 69, 70, 0, 0, 0, 0, 71, 0, 0, 72, 73, 74,
+  75, 76, 77, 78, 79, 80, 81, 0, 82, 83, 0, 84, 85, 86, 87, 0,
+  88, 0, 89, 90, 91, 92, 0, 0, 85, 0, 93, 94, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 95, 96, 0, 0, 0, 0, 0, 0, 0, 0, 97,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 99, 100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  102, 0, 96, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 104, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  61, 61, 61, 61, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// The first run of the runs of each block index, then the number of runs
+inline constexpr auto block_runs = std::array<std::uint16_t, 108>{
+  0, 1, 53, 56, 59, 98, 122, 135, 158, 165, 176, 200, 211, 226, 239, 244,
+  255, 262, 270, 279, 288, 295, 301, 307, 338, 359, 366, 369, 372, 375, 378, 383,
+  388, 391, 396, 405, 418, 428, 435, 438, 455, 475, 490, 515, 517, 534, 539, 542,
+  545, 548, 550, 552, 559, 562, 567, 572, 577, 582, 587, 592, 606, 609, 610, 627,
+  629, 646, 651, 654, 657, 660, 671, 675, 678, 681, 688, 694, 700, 704, 712, 717,
+  721, 725, 738, 745, 755, 761, 764, 768, 771, 775, 782, 785, 790, 793, 798, 801,
+  804, 807, 810, 813, 822, 831, 834, 844, 849, 852, 856, 858,
+};
+
+/// The runs of code points with the same properties, each packed as
+/// `first | ((class_index | (quick_check << class_bits)) << block_shift)`
+inline constexpr auto runs = std::array<std::uint16_t, 858>{
+  0, 22912, 6533, 22918, 6541, 22927, 6544, 22929, 6546, 22931, 6677, 5910, 6682, 22043, 5916, 5409,
+  22307, 21799, 5929, 22317, 5935, 22320, 5938, 180, 16568, 5945, 6589, 14784, 22978, 14787, 23493, 6598,
+  5959, 6602, 5965, 79, 6608, 5971, 6615, 6744, 5977, 6619, 6876, 7005, 6879, 7008, 6882, 6627,
+  112, 8308, 117, 8318, 127, 0, 8199, 8, 0, 6531, 8, 0, 5905, 6546, 5910, 6551,
+  6042, 5915, 6556, 5922, 6568, 5930, 6571, 6061, 6446, 6575, 816, 945, 1074, 1203, 1332, 1461,
+  1590, 1719, 1848, 1977, 2107, 2236, 2365, 62, 2495, 64, 2625, 2754, 67, 6596, 5957, 70,
+  1863, 72, 0, 6544, 3352, 3481, 3610, 27, 3019, 3148, 3277, 3406, 3535, 3664, 3793, 3922,
+  22995, 22357, 5974, 6615, 5980, 6621, 5983, 96, 4080, 113, 0, 6614, 93, 6623, 5987, 6628,
+  101, 6631, 105, 5994, 6635, 5997, 110, 0, 4113, 18, 6576, 5937, 6578, 5940, 6581, 5943,
+  6586, 5947, 6589, 5950, 6591, 5954, 6595, 5956, 6597, 5958, 6599, 5960, 6601, 75, 0, 6635,
+  6002, 6643, 116, 6013, 126, 0, 6550, 26, 6555, 36, 6565, 40, 6569, 46, 5977, 92,
+  0, 6552, 5913, 6556, 32, 6602, 5967, 6612, 98, 5987, 6628, 5990, 6631, 5993, 6634, 5997,
+  3056, 3185, 3314, 6643, 6006, 6647, 6009, 6651, 0, 16828, 61, 717, 78, 6609, 5970, 6611,
+  85, 8280, 96, 0, 444, 61, 16446, 63, 717, 78, 16471, 88, 8284, 94, 8287, 96,
+  6654, 127, 0, 8243, 52, 8246, 55, 444, 61, 717, 78, 8281, 92, 8286, 95, 0,
+  444, 61, 717, 78, 0, 444, 61, 16446, 63, 717, 78, 16470, 88, 8284, 94, 0,
+  16446, 63, 717, 78, 16471, 88, 0, 444, 61, 717, 78, 4309, 20822, 87, 0, 444,
+  61, 16450, 67, 717, 78, 16469, 87, 0, 699, 61, 16446, 63, 717, 78, 16471, 88,
+  0, 17098, 75, 16463, 80, 16479, 96, 0, 4536, 698, 59, 4680, 76, 0, 4792, 698,
+  59, 4936, 76, 0, 5912, 26, 5941, 54, 5943, 56, 5689, 58, 8259, 68, 8269, 78,
+  8274, 83, 8279, 88, 8284, 93, 8297, 106, 5105, 5234, 8307, 5364, 8309, 119, 8312, 121,
+  5242, 126, 5120, 8193, 6530, 644, 5, 6534, 8, 8211, 20, 8221, 30, 8226, 35, 8231,
+  40, 8236, 45, 8249, 58, 5958, 71, 0, 16430, 47, 439, 56, 697, 59, 0, 5901,
+  14, 0, 16481, 118, 0, 16424, 67, 0, 6621, 96, 0, 660, 22, 692, 53, 0,
+  722, 83, 6621, 94, 0, 6441, 42, 0, 6073, 6586, 5947, 60, 0, 6551, 5912, 25,
+  736, 97, 6645, 125, 6015, 0, 6576, 5941, 6587, 5949, 62, 5951, 6593, 5955, 6597, 5962,
+  6603, 79, 0, 436, 16437, 54, 708, 69, 6635, 5996, 6637, 116, 0, 682, 44, 486,
+  103, 754, 116, 0, 439, 56, 0, 6608, 83, 212, 5973, 6618, 5980, 6624, 97, 226,
+  105, 5997, 110, 6644, 117, 6648, 122, 0, 6592, 5954, 6595, 5962, 6603, 6989, 5582, 5967,
+  5456, 6609, 6774, 6519, 6009, 5882, 6651, 6908, 6013, 6654, 6015, 0, 8305, 114, 8307, 116,
+  8309, 118, 8311, 120, 8313, 122, 8315, 124, 8317, 126, 0, 8251, 60, 8254, 63, 8265,
+  74, 8267, 76, 8275, 84, 8283, 92, 8291, 100, 8299, 108, 8302, 112, 8313, 122, 8315,
+  124, 8317, 126, 8192, 2, 0, 6608, 210, 6612, 216, 6619, 93, 6625, 98, 229, 6631,
+  5992, 6633, 234, 5996, 6640, 113, 0, 8230, 39, 8234, 44, 0, 8233, 43, 0, 8284,
+  93, 0, 6639, 114, 0, 767, 0, 6624, 0, 5802, 6443, 6700, 6061, 6190, 48, 0,
+  16921, 27, 0, 6639, 112, 6644, 126, 0, 6558, 32, 6640, 114, 0, 646, 7, 684,
+  45, 0, 708, 69, 6624, 114, 0, 5931, 46, 723, 84, 0, 435, 52, 704, 65,
+  0, 6576, 49, 6578, 5940, 53, 6583, 57, 6590, 64, 6593, 66, 758, 119, 0, 749,
+  110, 8192, 8192, 14, 8208, 17, 8210, 19, 8213, 31, 8224, 33, 8226, 35, 8229, 39,
+  8234, 110, 8304, 8192, 90, 0, 8221, 2846, 8223, 32, 8234, 55, 8248, 61, 8254, 63,
+  8256, 66, 8259, 69, 8262, 79, 0, 6560, 5927, 6574, 48, 0, 6013, 126, 0, 5984,
+  97, 0, 6646, 123, 0, 5901, 14, 6543, 16, 6584, 185, 5946, 59, 703, 64, 0,
+  6629, 5990, 103, 0, 6564, 40, 0, 6571, 45, 0, 5958, 6600, 5963, 6604, 5965, 81,
+  0, 6530, 5891, 6532, 5893, 6, 0, 710, 71, 752, 113, 767, 0, 697, 16826, 59,
+  6528, 3, 16423, 40, 691, 53, 499, 116, 0, 704, 65, 458, 75, 0, 693, 438,
+  55, 0, 489, 746, 107, 0, 443, 61, 16446, 63, 717, 78, 16471, 88, 6630, 109,
+  6640, 117, 0, 706, 67, 454, 71, 6622, 95, 0, 16432, 49, 16442, 59, 16445, 62,
+  706, 451, 68, 0, 16431, 48, 703, 448, 65, 0, 703, 64, 0, 694, 439, 56,
+  0, 683, 44, 0, 697, 442, 59, 0, 16432, 49, 701, 63, 451, 68, 0, 736,
+  97, 0, 692, 53, 711, 72, 0, 665, 26, 0, 450, 67, 708, 70, 0, 663,
+  24, 0, 240, 117, 0, 6576, 55, 0, 368, 114, 0, 158, 31, 0, 8286, 5733,
+  231, 106, 6381, 5742, 115, 6011, 5888, 3, 6533, 5898, 12, 6570, 46, 8251, 65, 0,
+  6594, 69, 6528, 7, 6536, 25, 6555, 34, 6563, 37, 6566, 43, 0, 6574, 47, 6636,
+  112, 0, 5968, 87, 0, 6596, 458, 75, 8192, 30,
+};
+
+/// The code points with a canonical decomposition, other than the Hangul
+/// syllables, in order
+inline constexpr auto decomposed = std::array<char32_t, 2061>{
+  U'\xc0', U'\xc1', U'\xc2', U'\xc3', U'\xc4', U'\xc5', U'\xc7', U'\xc8',
+  U'\xc9', U'\xca', U'\xcb', U'\xcc', U'\xcd', U'\xce', U'\xcf', U'\xd1',
+  U'\xd2', U'\xd3', U'\xd4', U'\xd5', U'\xd6', U'\xd9', U'\xda', U'\xdb',
+  U'\xdc', U'\xdd', U'\xe0', U'\xe1', U'\xe2', U'\xe3', U'\xe4', U'\xe5',
+  U'\xe7', U'\xe8', U'\xe9', U'\xea', U'\xeb', U'\xec', U'\xed', U'\xee',
+  U'\xef', U'\xf1', U'\xf2', U'\xf3', U'\xf4', U'\xf5', U'\xf6', U'\xf9',
+  U'\xfa', U'\xfb', U'\xfc', U'\xfd', U'\xff', U'\x100', U'\x101', U'\x102',
+  U'\x103', U'\x104', U'\x105', U'\x106', U'\x107', U'\x108', U'\x109', U'\x10a',
+  U'\x10b', U'\x10c', U'\x10d', U'\x10e', U'\x10f', U'\x112', U'\x113', U'\x114',
+  U'\x115', U'\x116', U'\x117', U'\x118', U'\x119', U'\x11a', U'\x11b', U'\x11c',
+  U'\x11d', U'\x11e', U'\x11f', U'\x120', U'\x121', U'\x122', U'\x123', U'\x124',
+  U'\x125', U'\x128', U'\x129', U'\x12a', U'\x12b', U'\x12c', U'\x12d', U'\x12e',
+  U'\x12f', U'\x130', U'\x134', U'\x135', U'\x136', U'\x137', U'\x139', U'\x13a',
+  U'\x13b', U'\x13c', U'\x13d', U'\x13e', U'\x143', U'\x144', U'\x145', U'\x146',
+  U'\x147', U'\x148', U'\x14c', U'\x14d', U'\x14e', U'\x14f', U'\x150', U'\x151',
+  U'\x154', U'\x155', U'\x156', U'\x157', U'\x158', U'\x159', U'\x15a', U'\x15b',
+  U'\x15c', U'\x15d', U'\x15e', U'\x15f', U'\x160', U'\x161', U'\x162', U'\x163',
+  U'\x164', U'\x165', U'\x168', U'\x169', U'\x16a', U'\x16b', U'\x16c', U'\x16d',
+  U'\x16e', U'\x16f', U'\x170', U'\x171', U'\x172', U'\x173', U'\x174', U'\x175',
+  U'\x176', U'\x177', U'\x178', U'\x179', U'\x17a', U'\x17b', U'\x17c', U'\x17d',
+  U'\x17e', U'\x1a0', U'\x1a1', U'\x1af', U'\x1b0', U'\x1cd', U'\x1ce', U'\x1cf',
+  U'\x1d0', U'\x1d1', U'\x1d2', U'\x1d3', U'\x1d4', U'\x1d5', U'\x1d6', U'\x1d7',
+  U'\x1d8', U'\x1d9', U'\x1da', U'\x1db', U'\x1dc', U'\x1de', U'\x1df', U'\x1e0',
+  U'\x1e1', U'\x1e2', U'\x1e3', U'\x1e6', U'\x1e7', U'\x1e8', U'\x1e9', U'\x1ea',
+  U'\x1eb', U'\x1ec', U'\x1ed', U'\x1ee', U'\x1ef', U'\x1f0', U'\x1f4', U'\x1f5',
+  U'\x1f8', U'\x1f9', U'\x1fa', U'\x1fb', U'\x1fc', U'\x1fd', U'\x1fe', U'\x1ff',
+  U'\x200', U'\x201', U'\x202', U'\x203', U'\x204', U'\x205', U'\x206', U'\x207',
+  U'\x208', U'\x209', U'\x20a', U'\x20b', U'\x20c', U'\x20d', U'\x20e', U'\x20f',
+  U'\x210', U'\x211', U'\x212', U'\x213', U'\x214', U'\x215', U'\x216', U'\x217',
+  U'\x218', U'\x219', U'\x21a', U'\x21b', U'\x21e', U'\x21f', U'\x226', U'\x227',
+  U'\x228', U'\x229', U'\x22a', U'\x22b', U'\x22c', U'\x22d', U'\x22e', U'\x22f',
+  U'\x230', U'\x231', U'\x232', U'\x233', U'\x340', U'\x341', U'\x343', U'\x344',
+  U'\x374', U'\x37e', U'\x385', U'\x386', U'\x387', U'\x388', U'\x389', U'\x38a',
+  U'\x38c', U'\x38e', U'\x38f', U'\x390', U'\x3aa', U'\x3ab', U'\x3ac', U'\x3ad',
+  U'\x3ae', U'\x3af', U'\x3b0', U'\x3ca', U'\x3cb', U'\x3cc', U'\x3cd', U'\x3ce',
+  U'\x3d3', U'\x3d4', U'\x400', U'\x401', U'\x403', U'\x407', U'\x40c', U'\x40d',
+  U'\x40e', U'\x419', U'\x439', U'\x450', U'\x451', U'\x453', U'\x457', U'\x45c',
+  U'\x45d', U'\x45e', U'\x476', U'\x477', U'\x4c1', U'\x4c2', U'\x4d0', U'\x4d1',
+  U'\x4d2', U'\x4d3', U'\x4d6', U'\x4d7', U'\x4da', U'\x4db', U'\x4dc', U'\x4dd',
+  U'\x4de', U'\x4df', U'\x4e2', U'\x4e3', U'\x4e4', U'\x4e5', U'\x4e6', U'\x4e7',
+  U'\x4ea', U'\x4eb', U'\x4ec', U'\x4ed', U'\x4ee', U'\x4ef', U'\x4f0', U'\x4f1',
+  U'\x4f2', U'\x4f3', U'\x4f4', U'\x4f5', U'\x4f8', U'\x4f9', U'\x622', U'\x623',
+  U'\x624', U'\x625', U'\x626', U'\x6c0', U'\x6c2', U'\x6d3', U'\x929', U'\x931',
+  U'\x934', U'\x958', U'\x959', U'\x95a', U'\x95b', U'\x95c', U'\x95d', U'\x95e',
+  U'\x95f', U'\x9cb', U'\x9cc', U'\x9dc', U'\x9dd', U'\x9df', U'\xa33', U'\xa36',
+  U'\xa59', U'\xa5a', U'\xa5b', U'\xa5e', U'\xb48', U'\xb4b', U'\xb4c', U'\xb5c',
+  U'\xb5d', U'\xb94', U'\xbca', U'\xbcb', U'\xbcc', U'\xc48', U'\xcc0', U'\xcc7',
+  U'\xcc8', U'\xcca', U'\xccb', U'\xd4a', U'\xd4b', U'\xd4c', U'\xdda', U'\xddc',
+  U'\xddd', U'\xdde', U'\xf43', U'\xf4d', U'\xf52', U'\xf57', U'\xf5c', U'\xf69',
+  U'\xf73', U'\xf75', U'\xf76', U'\xf78', U'\xf81', U'\xf93', U'\xf9d', U'\xfa2',
+  U'\xfa7', U'\xfac', U'\xfb9', U'\x1026', U'\x1b06', U'\x1b08', U'\x1b0a', U'\x1b0c',
+  U'\x1b0e', U'\x1b12', U'\x1b3b', U'\x1b3d', U'\x1b40', U'\x1b41', U'\x1b43', U'\x1e00',
+  U'\x1e01', U'\x1e02', U'\x1e03', U'\x1e04', U'\x1e05', U'\x1e06', U'\x1e07', U'\x1e08',
+  U'\x1e09', U'\x1e0a', U'\x1e0b', U'\x1e0c', U'\x1e0d', U'\x1e0e', U'\x1e0f', U'\x1e10',
+  U'\x1e11', U'\x1e12', U'\x1e13', U'\x1e14', U'\x1e15', U'\x1e16', U'\x1e17', U'\x1e18',
+  U'\x1e19', U'\x1e1a', U'\x1e1b', U'\x1e1c', U'\x1e1d', U'\x1e1e', U'\x1e1f', U'\x1e20',
+  U'\x1e21', U'\x1e22', U'\x1e23', U'\x1e24', U'\x1e25', U'\x1e26', U'\x1e27', U'\x1e28',
+  U'\x1e29', U'\x1e2a', U'\x1e2b', U'\x1e2c', U'\x1e2d', U'\x1e2e', U'\x1e2f', U'\x1e30',
+  U'\x1e31', U'\x1e32', U'\x1e33', U'\x1e34', U'\x1e35', U'\x1e36', U'\x1e37', U'\x1e38',
+  U'\x1e39', U'\x1e3a', U'\x1e3b', U'\x1e3c', U'\x1e3d', U'\x1e3e', U'\x1e3f', U'\x1e40',
+  U'\x1e41', U'\x1e42', U'\x1e43', U'\x1e44', U'\x1e45', U'\x1e46', U'\x1e47', U'\x1e48',
+  U'\x1e49', U'\x1e4a', U'\x1e4b', U'\x1e4c', U'\x1e4d', U'\x1e4e', U'\x1e4f', U'\x1e50',
+  U'\x1e51', U'\x1e52', U'\x1e53', U'\x1e54', U'\x1e55', U'\x1e56', U'\x1e57', U'\x1e58',
+  U'\x1e59', U'\x1e5a', U'\x1e5b', U'\x1e5c', U'\x1e5d', U'\x1e5e', U'\x1e5f', U'\x1e60',
+  U'\x1e61', U'\x1e62', U'\x1e63', U'\x1e64', U'\x1e65', U'\x1e66', U'\x1e67', U'\x1e68',
+  U'\x1e69', U'\x1e6a', U'\x1e6b', U'\x1e6c', U'\x1e6d', U'\x1e6e', U'\x1e6f', U'\x1e70',
+  U'\x1e71', U'\x1e72', U'\x1e73', U'\x1e74', U'\x1e75', U'\x1e76', U'\x1e77', U'\x1e78',
+  U'\x1e79', U'\x1e7a', U'\x1e7b', U'\x1e7c', U'\x1e7d', U'\x1e7e', U'\x1e7f', U'\x1e80',
+  U'\x1e81', U'\x1e82', U'\x1e83', U'\x1e84', U'\x1e85', U'\x1e86', U'\x1e87', U'\x1e88',
+  U'\x1e89', U'\x1e8a', U'\x1e8b', U'\x1e8c', U'\x1e8d', U'\x1e8e', U'\x1e8f', U'\x1e90',
+  U'\x1e91', U'\x1e92', U'\x1e93', U'\x1e94', U'\x1e95', U'\x1e96', U'\x1e97', U'\x1e98',
+  U'\x1e99', U'\x1e9b', U'\x1ea0', U'\x1ea1', U'\x1ea2', U'\x1ea3', U'\x1ea4', U'\x1ea5',
+  U'\x1ea6', U'\x1ea7', U'\x1ea8', U'\x1ea9', U'\x1eaa', U'\x1eab', U'\x1eac', U'\x1ead',
+  U'\x1eae', U'\x1eaf', U'\x1eb0', U'\x1eb1', U'\x1eb2', U'\x1eb3', U'\x1eb4', U'\x1eb5',
+  U'\x1eb6', U'\x1eb7', U'\x1eb8', U'\x1eb9', U'\x1eba', U'\x1ebb', U'\x1ebc', U'\x1ebd',
+  U'\x1ebe', U'\x1ebf', U'\x1ec0', U'\x1ec1', U'\x1ec2', U'\x1ec3', U'\x1ec4', U'\x1ec5',
+  U'\x1ec6', U'\x1ec7', U'\x1ec8', U'\x1ec9', U'\x1eca', U'\x1ecb', U'\x1ecc', U'\x1ecd',
+  U'\x1ece', U'\x1ecf', U'\x1ed0', U'\x1ed1', U'\x1ed2', U'\x1ed3', U'\x1ed4', U'\x1ed5',
+  U'\x1ed6', U'\x1ed7', U'\x1ed8', U'\x1ed9', U'\x1eda', U'\x1edb', U'\x1edc', U'\x1edd',
+  U'\x1ede', U'\x1edf', U'\x1ee0', U'\x1ee1', U'\x1ee2', U'\x1ee3', U'\x1ee4', U'\x1ee5',
+  U'\x1ee6', U'\x1ee7', U'\x1ee8', U'\x1ee9', U'\x1eea', U'\x1eeb', U'\x1eec', U'\x1eed',
+  U'\x1eee', U'\x1eef', U'\x1ef0', U'\x1ef1', U'\x1ef2', U'\x1ef3', U'\x1ef4', U'\x1ef5',
+  U'\x1ef6', U'\x1ef7', U'\x1ef8', U'\x1ef9', U'\x1f00', U'\x1f01', U'\x1f02', U'\x1f03',
+  U'\x1f04', U'\x1f05', U'\x1f06', U'\x1f07', U'\x1f08', U'\x1f09', U'\x1f0a', U'\x1f0b',
+  U'\x1f0c', U'\x1f0d', U'\x1f0e', U'\x1f0f', U'\x1f10', U'\x1f11', U'\x1f12', U'\x1f13',
+  U'\x1f14', U'\x1f15', U'\x1f18', U'\x1f19', U'\x1f1a', U'\x1f1b', U'\x1f1c', U'\x1f1d',
+  U'\x1f20', U'\x1f21', U'\x1f22', U'\x1f23', U'\x1f24', U'\x1f25', U'\x1f26', U'\x1f27',
+  U'\x1f28', U'\x1f29', U'\x1f2a', U'\x1f2b', U'\x1f2c', U'\x1f2d', U'\x1f2e', U'\x1f2f',
+  U'\x1f30', U'\x1f31', U'\x1f32', U'\x1f33', U'\x1f34', U'\x1f35', U'\x1f36', U'\x1f37',
+  U'\x1f38', U'\x1f39', U'\x1f3a', U'\x1f3b', U'\x1f3c', U'\x1f3d', U'\x1f3e', U'\x1f3f',
+  U'\x1f40', U'\x1f41', U'\x1f42', U'\x1f43', U'\x1f44', U'\x1f45', U'\x1f48', U'\x1f49',
+  U'\x1f4a', U'\x1f4b', U'\x1f4c', U'\x1f4d', U'\x1f50', U'\x1f51', U'\x1f52', U'\x1f53',
+  U'\x1f54', U'\x1f55', U'\x1f56', U'\x1f57', U'\x1f59', U'\x1f5b', U'\x1f5d', U'\x1f5f',
+  U'\x1f60', U'\x1f61', U'\x1f62', U'\x1f63', U'\x1f64', U'\x1f65', U'\x1f66', U'\x1f67',
+  U'\x1f68', U'\x1f69', U'\x1f6a', U'\x1f6b', U'\x1f6c', U'\x1f6d', U'\x1f6e', U'\x1f6f',
+  U'\x1f70', U'\x1f71', U'\x1f72', U'\x1f73', U'\x1f74', U'\x1f75', U'\x1f76', U'\x1f77',
+  U'\x1f78', U'\x1f79', U'\x1f7a', U'\x1f7b', U'\x1f7c', U'\x1f7d', U'\x1f80', U'\x1f81',
+  U'\x1f82', U'\x1f83', U'\x1f84', U'\x1f85', U'\x1f86', U'\x1f87', U'\x1f88', U'\x1f89',
+  U'\x1f8a', U'\x1f8b', U'\x1f8c', U'\x1f8d', U'\x1f8e', U'\x1f8f', U'\x1f90', U'\x1f91',
+  U'\x1f92', U'\x1f93', U'\x1f94', U'\x1f95', U'\x1f96', U'\x1f97', U'\x1f98', U'\x1f99',
+  U'\x1f9a', U'\x1f9b', U'\x1f9c', U'\x1f9d', U'\x1f9e', U'\x1f9f', U'\x1fa0', U'\x1fa1',
+  U'\x1fa2', U'\x1fa3', U'\x1fa4', U'\x1fa5', U'\x1fa6', U'\x1fa7', U'\x1fa8', U'\x1fa9',
+  U'\x1faa', U'\x1fab', U'\x1fac', U'\x1fad', U'\x1fae', U'\x1faf', U'\x1fb0', U'\x1fb1',
+  U'\x1fb2', U'\x1fb3', U'\x1fb4', U'\x1fb6', U'\x1fb7', U'\x1fb8', U'\x1fb9', U'\x1fba',
+  U'\x1fbb', U'\x1fbc', U'\x1fbe', U'\x1fc1', U'\x1fc2', U'\x1fc3', U'\x1fc4', U'\x1fc6',
+  U'\x1fc7', U'\x1fc8', U'\x1fc9', U'\x1fca', U'\x1fcb', U'\x1fcc', U'\x1fcd', U'\x1fce',
+  U'\x1fcf', U'\x1fd0', U'\x1fd1', U'\x1fd2', U'\x1fd3', U'\x1fd6', U'\x1fd7', U'\x1fd8',
+  U'\x1fd9', U'\x1fda', U'\x1fdb', U'\x1fdd', U'\x1fde', U'\x1fdf', U'\x1fe0', U'\x1fe1',
+  U'\x1fe2', U'\x1fe3', U'\x1fe4', U'\x1fe5', U'\x1fe6', U'\x1fe7', U'\x1fe8', U'\x1fe9',
+  U'\x1fea', U'\x1feb', U'\x1fec', U'\x1fed', U'\x1fee', U'\x1fef', U'\x1ff2', U'\x1ff3',
+  U'\x1ff4', U'\x1ff6', U'\x1ff7', U'\x1ff8', U'\x1ff9', U'\x1ffa', U'\x1ffb', U'\x1ffc',
+  U'\x1ffd', U'\x2000', U'\x2001', U'\x2126', U'\x212a', U'\x212b', U'\x219a', U'\x219b',
+  U'\x21ae', U'\x21cd', U'\x21ce', U'\x21cf', U'\x2204', U'\x2209', U'\x220c', U'\x2224',
+  U'\x2226', U'\x2241', U'\x2244', U'\x2247', U'\x2249', U'\x2260', U'\x2262', U'\x226d',
+  U'\x226e', U'\x226f', U'\x2270', U'\x2271', U'\x2274', U'\x2275', U'\x2278', U'\x2279',
+  U'\x2280', U'\x2281', U'\x2284', U'\x2285', U'\x2288', U'\x2289', U'\x22ac', U'\x22ad',
+  U'\x22ae', U'\x22af', U'\x22e0', U'\x22e1', U'\x22e2', U'\x22e3', U'\x22ea', U'\x22eb',
+  U'\x22ec', U'\x22ed', U'\x2329', U'\x232a', U'\x2adc', U'\x304c', U'\x304e', U'\x3050',
+  U'\x3052', U'\x3054', U'\x3056', U'\x3058', U'\x305a', U'\x305c', U'\x305e', U'\x3060',
+  U'\x3062', U'\x3065', U'\x3067', U'\x3069', U'\x3070', U'\x3071', U'\x3073', U'\x3074',
+  U'\x3076', U'\x3077', U'\x3079', U'\x307a', U'\x307c', U'\x307d', U'\x3094', U'\x309e',
+  U'\x30ac', U'\x30ae', U'\x30b0', U'\x30b2', U'\x30b4', U'\x30b6', U'\x30b8', U'\x30ba',
+  U'\x30bc', U'\x30be', U'\x30c0', U'\x30c2', U'\x30c5', U'\x30c7', U'\x30c9', U'\x30d0',
+  U'\x30d1', U'\x30d3', U'\x30d4', U'\x30d6', U'\x30d7', U'\x30d9', U'\x30da', U'\x30dc',
+  U'\x30dd', U'\x30f4', U'\x30f7', U'\x30f8', U'\x30f9', U'\x30fa', U'\x30fe', U'\xf900',
+  U'\xf901', U'\xf902', U'\xf903', U'\xf904', U'\xf905', U'\xf906', U'\xf907', U'\xf908',
+  U'\xf909', U'\xf90a', U'\xf90b', U'\xf90c', U'\xf90d', U'\xf90e', U'\xf90f', U'\xf910',
+  U'\xf911', U'\xf912', U'\xf913', U'\xf914', U'\xf915', U'\xf916', U'\xf917', U'\xf918',
+  U'\xf919', U'\xf91a', U'\xf91b', U'\xf91c', U'\xf91d', U'\xf91e', U'\xf91f', U'\xf920',
+  U'\xf921', U'\xf922', U'\xf923', U'\xf924', U'\xf925', U'\xf926', U'\xf927', U'\xf928',
+  U'\xf929', U'\xf92a', U'\xf92b', U'\xf92c', U'\xf92d', U'\xf92e', U'\xf92f', U'\xf930',
+  U'\xf931', U'\xf932', U'\xf933', U'\xf934', U'\xf935', U'\xf936', U'\xf937', U'\xf938',
+  U'\xf939', U'\xf93a', U'\xf93b', U'\xf93c', U'\xf93d', U'\xf93e', U'\xf93f', U'\xf940',
+  U'\xf941', U'\xf942', U'\xf943', U'\xf944', U'\xf945', U'\xf946', U'\xf947', U'\xf948',
+  U'\xf949', U'\xf94a', U'\xf94b', U'\xf94c', U'\xf94d', U'\xf94e', U'\xf94f', U'\xf950',
+  U'\xf951', U'\xf952', U'\xf953', U'\xf954', U'\xf955', U'\xf956', U'\xf957', U'\xf958',
+  U'\xf959', U'\xf95a', U'\xf95b', U'\xf95c', U'\xf95d', U'\xf95e', U'\xf95f', U'\xf960',
+  U'\xf961', U'\xf962', U'\xf963', U'\xf964', U'\xf965', U'\xf966', U'\xf967', U'\xf968',
+  U'\xf969', U'\xf96a', U'\xf96b', U'\xf96c', U'\xf96d', U'\xf96e', U'\xf96f', U'\xf970',
+  U'\xf971', U'\xf972', U'\xf973', U'\xf974', U'\xf975', U'\xf976', U'\xf977', U'\xf978',
+  U'\xf979', U'\xf97a', U'\xf97b', U'\xf97c', U'\xf97d', U'\xf97e', U'\xf97f', U'\xf980',
+  U'\xf981', U'\xf982', U'\xf983', U'\xf984', U'\xf985', U'\xf986', U'\xf987', U'\xf988',
+  U'\xf989', U'\xf98a', U'\xf98b', U'\xf98c', U'\xf98d', U'\xf98e', U'\xf98f', U'\xf990',
+  U'\xf991', U'\xf992', U'\xf993', U'\xf994', U'\xf995', U'\xf996', U'\xf997', U'\xf998',
+  U'\xf999', U'\xf99a', U'\xf99b', U'\xf99c', U'\xf99d', U'\xf99e', U'\xf99f', U'\xf9a0',
+  U'\xf9a1', U'\xf9a2', U'\xf9a3', U'\xf9a4', U'\xf9a5', U'\xf9a6', U'\xf9a7', U'\xf9a8',
+  U'\xf9a9', U'\xf9aa', U'\xf9ab', U'\xf9ac', U'\xf9ad', U'\xf9ae', U'\xf9af', U'\xf9b0',
+  U'\xf9b1', U'\xf9b2', U'\xf9b3', U'\xf9b4', U'\xf9b5', U'\xf9b6', U'\xf9b7', U'\xf9b8',
+  U'\xf9b9', U'\xf9ba', U'\xf9bb', U'\xf9bc', U'\xf9bd', U'\xf9be', U'\xf9bf', U'\xf9c0',
+  U'\xf9c1', U'\xf9c2', U'\xf9c3', U'\xf9c4', U'\xf9c5', U'\xf9c6', U'\xf9c7', U'\xf9c8',
+  U'\xf9c9', U'\xf9ca', U'\xf9cb', U'\xf9cc', U'\xf9cd', U'\xf9ce', U'\xf9cf', U'\xf9d0',
+  U'\xf9d1', U'\xf9d2', U'\xf9d3', U'\xf9d4', U'\xf9d5', U'\xf9d6', U'\xf9d7', U'\xf9d8',
+  U'\xf9d9', U'\xf9da', U'\xf9db', U'\xf9dc', U'\xf9dd', U'\xf9de', U'\xf9df', U'\xf9e0',
+  U'\xf9e1', U'\xf9e2', U'\xf9e3', U'\xf9e4', U'\xf9e5', U'\xf9e6', U'\xf9e7', U'\xf9e8',
+  U'\xf9e9', U'\xf9ea', U'\xf9eb', U'\xf9ec', U'\xf9ed', U'\xf9ee', U'\xf9ef', U'\xf9f0',
+  U'\xf9f1', U'\xf9f2', U'\xf9f3', U'\xf9f4', U'\xf9f5', U'\xf9f6', U'\xf9f7', U'\xf9f8',
+  U'\xf9f9', U'\xf9fa', U'\xf9fb', U'\xf9fc', U'\xf9fd', U'\xf9fe', U'\xf9ff', U'\xfa00',
+  U'\xfa01', U'\xfa02', U'\xfa03', U'\xfa04', U'\xfa05', U'\xfa06', U'\xfa07', U'\xfa08',
+  U'\xfa09', U'\xfa0a', U'\xfa0b', U'\xfa0c', U'\xfa0d', U'\xfa10', U'\xfa12', U'\xfa15',
+  U'\xfa16', U'\xfa17', U'\xfa18', U'\xfa19', U'\xfa1a', U'\xfa1b', U'\xfa1c', U'\xfa1d',
+  U'\xfa1e', U'\xfa20', U'\xfa22', U'\xfa25', U'\xfa26', U'\xfa2a', U'\xfa2b', U'\xfa2c',
+  U'\xfa2d', U'\xfa2e', U'\xfa2f', U'\xfa30', U'\xfa31', U'\xfa32', U'\xfa33', U'\xfa34',
+  U'\xfa35', U'\xfa36', U'\xfa37', U'\xfa38', U'\xfa39', U'\xfa3a', U'\xfa3b', U'\xfa3c',
+  U'\xfa3d', U'\xfa3e', U'\xfa3f', U'\xfa40', U'\xfa41', U'\xfa42', U'\xfa43', U'\xfa44',
+  U'\xfa45', U'\xfa46', U'\xfa47', U'\xfa48', U'\xfa49', U'\xfa4a', U'\xfa4b', U'\xfa4c',
+  U'\xfa4d', U'\xfa4e', U'\xfa4f', U'\xfa50', U'\xfa51', U'\xfa52', U'\xfa53', U'\xfa54',
+  U'\xfa55', U'\xfa56', U'\xfa57', U'\xfa58', U'\xfa59', U'\xfa5a', U'\xfa5b', U'\xfa5c',
+  U'\xfa5d', U'\xfa5e', U'\xfa5f', U'\xfa60', U'\xfa61', U'\xfa62', U'\xfa63', U'\xfa64',
+  U'\xfa65', U'\xfa66', U'\xfa67', U'\xfa68', U'\xfa69', U'\xfa6a', U'\xfa6b', U'\xfa6c',
+  U'\xfa6d', U'\xfa70', U'\xfa71', U'\xfa72', U'\xfa73', U'\xfa74', U'\xfa75', U'\xfa76',
+  U'\xfa77', U'\xfa78', U'\xfa79', U'\xfa7a', U'\xfa7b', U'\xfa7c', U'\xfa7d', U'\xfa7e',
+  U'\xfa7f', U'\xfa80', U'\xfa81', U'\xfa82', U'\xfa83', U'\xfa84', U'\xfa85', U'\xfa86',
+  U'\xfa87', U'\xfa88', U'\xfa89', U'\xfa8a', U'\xfa8b', U'\xfa8c', U'\xfa8d', U'\xfa8e',
+  U'\xfa8f', U'\xfa90', U'\xfa91', U'\xfa92', U'\xfa93', U'\xfa94', U'\xfa95', U'\xfa96',
+  U'\xfa97', U'\xfa98', U'\xfa99', U'\xfa9a', U'\xfa9b', U'\xfa9c', U'\xfa9d', U'\xfa9e',
+  U'\xfa9f', U'\xfaa0', U'\xfaa1', U'\xfaa2', U'\xfaa3', U'\xfaa4', U'\xfaa5', U'\xfaa6',
+  U'\xfaa7', U'\xfaa8', U'\xfaa9', U'\xfaaa', U'\xfaab', U'\xfaac', U'\xfaad', U'\xfaae',
+  U'\xfaaf', U'\xfab0', U'\xfab1', U'\xfab2', U'\xfab3', U'\xfab4', U'\xfab5', U'\xfab6',
+  U'\xfab7', U'\xfab8', U'\xfab9', U'\xfaba', U'\xfabb', U'\xfabc', U'\xfabd', U'\xfabe',
+  U'\xfabf', U'\xfac0', U'\xfac1', U'\xfac2', U'\xfac3', U'\xfac4', U'\xfac5', U'\xfac6',
+  U'\xfac7', U'\xfac8', U'\xfac9', U'\xfaca', U'\xfacb', U'\xfacc', U'\xfacd', U'\xface',
+  U'\xfacf', U'\xfad0', U'\xfad1', U'\xfad2', U'\xfad3', U'\xfad4', U'\xfad5', U'\xfad6',
+  U'\xfad7', U'\xfad8', U'\xfad9', U'\xfb1d', U'\xfb1f', U'\xfb2a', U'\xfb2b', U'\xfb2c',
+  U'\xfb2d', U'\xfb2e', U'\xfb2f', U'\xfb30', U'\xfb31', U'\xfb32', U'\xfb33', U'\xfb34',
+  U'\xfb35', U'\xfb36', U'\xfb38', U'\xfb39', U'\xfb3a', U'\xfb3b', U'\xfb3c', U'\xfb3e',
+  U'\xfb40', U'\xfb41', U'\xfb43', U'\xfb44', U'\xfb46', U'\xfb47', U'\xfb48', U'\xfb49',
+  U'\xfb4a', U'\xfb4b', U'\xfb4c', U'\xfb4d', U'\xfb4e', U'\x1109a', U'\x1109c', U'\x110ab',
+  U'\x1112e', U'\x1112f', U'\x1134b', U'\x1134c', U'\x114bb', U'\x114bc', U'\x114be', U'\x115ba',
+  U'\x115bb', U'\x11938', U'\x1d15e', U'\x1d15f', U'\x1d160', U'\x1d161', U'\x1d162', U'\x1d163',
+  U'\x1d164', U'\x1d1bb', U'\x1d1bc', U'\x1d1bd', U'\x1d1be', U'\x1d1bf', U'\x1d1c0', U'\x2f800',
+  U'\x2f801', U'\x2f802', U'\x2f803', U'\x2f804', U'\x2f805', U'\x2f806', U'\x2f807', U'\x2f808',
+  U'\x2f809', U'\x2f80a', U'\x2f80b', U'\x2f80c', U'\x2f80d', U'\x2f80e', U'\x2f80f', U'\x2f810',
+  U'\x2f811', U'\x2f812', U'\x2f813', U'\x2f814', U'\x2f815', U'\x2f816', U'\x2f817', U'\x2f818',
+  U'\x2f819', U'\x2f81a', U'\x2f81b', U'\x2f81c', U'\x2f81d', U'\x2f81e', U'\x2f81f', U'\x2f820',
+  U'\x2f821', U'\x2f822', U'\x2f823', U'\x2f824', U'\x2f825', U'\x2f826', U'\x2f827', U'\x2f828',
+  U'\x2f829', U'\x2f82a', U'\x2f82b', U'\x2f82c', U'\x2f82d', U'\x2f82e', U'\x2f82f', U'\x2f830',
+  U'\x2f831', U'\x2f832', U'\x2f833', U'\x2f834', U'\x2f835', U'\x2f836', U'\x2f837', U'\x2f838',
+  U'\x2f839', U'\x2f83a', U'\x2f83b', U'\x2f83c', U'\x2f83d', U'\x2f83e', U'\x2f83f', U'\x2f840',
+  U'\x2f841', U'\x2f842', U'\x2f843', U'\x2f844', U'\x2f845', U'\x2f846', U'\x2f847', U'\x2f848',
+  U'\x2f849', U'\x2f84a', U'\x2f84b', U'\x2f84c', U'\x2f84d', U'\x2f84e', U'\x2f84f', U'\x2f850',
+  U'\x2f851', U'\x2f852', U'\x2f853', U'\x2f854', U'\x2f855', U'\x2f856', U'\x2f857', U'\x2f858',
+  U'\x2f859', U'\x2f85a', U'\x2f85b', U'\x2f85c', U'\x2f85d', U'\x2f85e', U'\x2f85f', U'\x2f860',
+  U'\x2f861', U'\x2f862', U'\x2f863', U'\x2f864', U'\x2f865', U'\x2f866', U'\x2f867', U'\x2f868',
+  U'\x2f869', U'\x2f86a', U'\x2f86b', U'\x2f86c', U'\x2f86d', U'\x2f86e', U'\x2f86f', U'\x2f870',
+  U'\x2f871', U'\x2f872', U'\x2f873', U'\x2f874', U'\x2f875', U'\x2f876', U'\x2f877', U'\x2f878',
+  U'\x2f879', U'\x2f87a', U'\x2f87b', U'\x2f87c', U'\x2f87d', U'\x2f87e', U'\x2f87f', U'\x2f880',
+  U'\x2f881', U'\x2f882', U'\x2f883', U'\x2f884', U'\x2f885', U'\x2f886', U'\x2f887', U'\x2f888',
+  U'\x2f889', U'\x2f88a', U'\x2f88b', U'\x2f88c', U'\x2f88d', U'\x2f88e', U'\x2f88f', U'\x2f890',
+  U'\x2f891', U'\x2f892', U'\x2f893', U'\x2f894', U'\x2f895', U'\x2f896', U'\x2f897', U'\x2f898',
+  U'\x2f899', U'\x2f89a', U'\x2f89b', U'\x2f89c', U'\x2f89d', U'\x2f89e', U'\x2f89f', U'\x2f8a0',
+  U'\x2f8a1', U'\x2f8a2', U'\x2f8a3', U'\x2f8a4', U'\x2f8a5', U'\x2f8a6', U'\x2f8a7', U'\x2f8a8',
+  U'\x2f8a9', U'\x2f8aa', U'\x2f8ab', U'\x2f8ac', U'\x2f8ad', U'\x2f8ae', U'\x2f8af', U'\x2f8b0',
+  U'\x2f8b1', U'\x2f8b2', U'\x2f8b3', U'\x2f8b4', U'\x2f8b5', U'\x2f8b6', U'\x2f8b7', U'\x2f8b8',
+  U'\x2f8b9', U'\x2f8ba', U'\x2f8bb', U'\x2f8bc', U'\x2f8bd', U'\x2f8be', U'\x2f8bf', U'\x2f8c0',
+  U'\x2f8c1', U'\x2f8c2', U'\x2f8c3', U'\x2f8c4', U'\x2f8c5', U'\x2f8c6', U'\x2f8c7', U'\x2f8c8',
+  U'\x2f8c9', U'\x2f8ca', U'\x2f8cb', U'\x2f8cc', U'\x2f8cd', U'\x2f8ce', U'\x2f8cf', U'\x2f8d0',
+  U'\x2f8d1', U'\x2f8d2', U'\x2f8d3', U'\x2f8d4', U'\x2f8d5', U'\x2f8d6', U'\x2f8d7', U'\x2f8d8',
+  U'\x2f8d9', U'\x2f8da', U'\x2f8db', U'\x2f8dc', U'\x2f8dd', U'\x2f8de', U'\x2f8df', U'\x2f8e0',
+  U'\x2f8e1', U'\x2f8e2', U'\x2f8e3', U'\x2f8e4', U'\x2f8e5', U'\x2f8e6', U'\x2f8e7', U'\x2f8e8',
+  U'\x2f8e9', U'\x2f8ea', U'\x2f8eb', U'\x2f8ec', U'\x2f8ed', U'\x2f8ee', U'\x2f8ef', U'\x2f8f0',
+  U'\x2f8f1', U'\x2f8f2', U'\x2f8f3', U'\x2f8f4', U'\x2f8f5', U'\x2f8f6', U'\x2f8f7', U'\x2f8f8',
+  U'\x2f8f9', U'\x2f8fa', U'\x2f8fb', U'\x2f8fc', U'\x2f8fd', U'\x2f8fe', U'\x2f8ff', U'\x2f900',
+  U'\x2f901', U'\x2f902', U'\x2f903', U'\x2f904', U'\x2f905', U'\x2f906', U'\x2f907', U'\x2f908',
+  U'\x2f909', U'\x2f90a', U'\x2f90b', U'\x2f90c', U'\x2f90d', U'\x2f90e', U'\x2f90f', U'\x2f910',
+  U'\x2f911', U'\x2f912', U'\x2f913', U'\x2f914', U'\x2f915', U'\x2f916', U'\x2f917', U'\x2f918',
+  U'\x2f919', U'\x2f91a', U'\x2f91b', U'\x2f91c', U'\x2f91d', U'\x2f91e', U'\x2f91f', U'\x2f920',
+  U'\x2f921', U'\x2f922', U'\x2f923', U'\x2f924', U'\x2f925', U'\x2f926', U'\x2f927', U'\x2f928',
+  U'\x2f929', U'\x2f92a', U'\x2f92b', U'\x2f92c', U'\x2f92d', U'\x2f92e', U'\x2f92f', U'\x2f930',
+  U'\x2f931', U'\x2f932', U'\x2f933', U'\x2f934', U'\x2f935', U'\x2f936', U'\x2f937', U'\x2f938',
+  U'\x2f939', U'\x2f93a', U'\x2f93b', U'\x2f93c', U'\x2f93d', U'\x2f93e', U'\x2f93f', U'\x2f940',
+  U'\x2f941', U'\x2f942', U'\x2f943', U'\x2f944', U'\x2f945', U'\x2f946', U'\x2f947', U'\x2f948',
+  U'\x2f949', U'\x2f94a', U'\x2f94b', U'\x2f94c', U'\x2f94d', U'\x2f94e', U'\x2f94f', U'\x2f950',
+  U'\x2f951', U'\x2f952', U'\x2f953', U'\x2f954', U'\x2f955', U'\x2f956', U'\x2f957', U'\x2f958',
+  U'\x2f959', U'\x2f95a', U'\x2f95b', U'\x2f95c', U'\x2f95d', U'\x2f95e', U'\x2f95f', U'\x2f960',
+  U'\x2f961', U'\x2f962', U'\x2f963', U'\x2f964', U'\x2f965', U'\x2f966', U'\x2f967', U'\x2f968',
+  U'\x2f969', U'\x2f96a', U'\x2f96b', U'\x2f96c', U'\x2f96d', U'\x2f96e', U'\x2f96f', U'\x2f970',
+  U'\x2f971', U'\x2f972', U'\x2f973', U'\x2f974', U'\x2f975', U'\x2f976', U'\x2f977', U'\x2f978',
+  U'\x2f979', U'\x2f97a', U'\x2f97b', U'\x2f97c', U'\x2f97d', U'\x2f97e', U'\x2f97f', U'\x2f980',
+  U'\x2f981', U'\x2f982', U'\x2f983', U'\x2f984', U'\x2f985', U'\x2f986', U'\x2f987', U'\x2f988',
+  U'\x2f989', U'\x2f98a', U'\x2f98b', U'\x2f98c', U'\x2f98d', U'\x2f98e', U'\x2f98f', U'\x2f990',
+  U'\x2f991', U'\x2f992', U'\x2f993', U'\x2f994', U'\x2f995', U'\x2f996', U'\x2f997', U'\x2f998',
+  U'\x2f999', U'\x2f99a', U'\x2f99b', U'\x2f99c', U'\x2f99d', U'\x2f99e', U'\x2f99f', U'\x2f9a0',
+  U'\x2f9a1', U'\x2f9a2', U'\x2f9a3', U'\x2f9a4', U'\x2f9a5', U'\x2f9a6', U'\x2f9a7', U'\x2f9a8',
+  U'\x2f9a9', U'\x2f9aa', U'\x2f9ab', U'\x2f9ac', U'\x2f9ad', U'\x2f9ae', U'\x2f9af', U'\x2f9b0',
+  U'\x2f9b1', U'\x2f9b2', U'\x2f9b3', U'\x2f9b4', U'\x2f9b5', U'\x2f9b6', U'\x2f9b7', U'\x2f9b8',
+  U'\x2f9b9', U'\x2f9ba', U'\x2f9bb', U'\x2f9bc', U'\x2f9bd', U'\x2f9be', U'\x2f9bf', U'\x2f9c0',
+  U'\x2f9c1', U'\x2f9c2', U'\x2f9c3', U'\x2f9c4', U'\x2f9c5', U'\x2f9c6', U'\x2f9c7', U'\x2f9c8',
+  U'\x2f9c9', U'\x2f9ca', U'\x2f9cb', U'\x2f9cc', U'\x2f9cd', U'\x2f9ce', U'\x2f9cf', U'\x2f9d0',
+  U'\x2f9d1', U'\x2f9d2', U'\x2f9d3', U'\x2f9d4', U'\x2f9d5', U'\x2f9d6', U'\x2f9d7', U'\x2f9d8',
+  U'\x2f9d9', U'\x2f9da', U'\x2f9db', U'\x2f9dc', U'\x2f9dd', U'\x2f9de', U'\x2f9df', U'\x2f9e0',
+  U'\x2f9e1', U'\x2f9e2', U'\x2f9e3', U'\x2f9e4', U'\x2f9e5', U'\x2f9e6', U'\x2f9e7', U'\x2f9e8',
+  U'\x2f9e9', U'\x2f9ea', U'\x2f9eb', U'\x2f9ec', U'\x2f9ed', U'\x2f9ee', U'\x2f9ef', U'\x2f9f0',
+  U'\x2f9f1', U'\x2f9f2', U'\x2f9f3', U'\x2f9f4', U'\x2f9f5', U'\x2f9f6', U'\x2f9f7', U'\x2f9f8',
+  U'\x2f9f9', U'\x2f9fa', U'\x2f9fb', U'\x2f9fc', U'\x2f9fd', U'\x2f9fe', U'\x2f9ff', U'\x2fa00',
+  U'\x2fa01', U'\x2fa02', U'\x2fa03', U'\x2fa04', U'\x2fa05', U'\x2fa06', U'\x2fa07', U'\x2fa08',
+  U'\x2fa09', U'\x2fa0a', U'\x2fa0b', U'\x2fa0c', U'\x2fa0d', U'\x2fa0e', U'\x2fa0f', U'\x2fa10',
+  U'\x2fa11', U'\x2fa12', U'\x2fa13', U'\x2fa14', U'\x2fa15', U'\x2fa16', U'\x2fa17', U'\x2fa18',
+  U'\x2fa19', U'\x2fa1a', U'\x2fa1b', U'\x2fa1c', U'\x2fa1d',
+};
+
+/// The first code point of the full decomposition of each code point of
+/// `decomposed`, then the size of `decomposition_data`
+inline constexpr auto decomposition_offsets = std::array<std::uint16_t, 2062>{
+  0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+  32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+  64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+  96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+  128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+  160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+  192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+  224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+  256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276, 278, 280, 282, 284, 286,
+  288, 290, 292, 294, 296, 298, 300, 302, 304, 306, 308, 310, 312, 314, 316, 318,
+  320, 322, 324, 326, 328, 330, 332, 334, 336, 338, 340, 342, 344, 346, 349, 352,
+  355, 358, 361, 364, 367, 370, 373, 376, 379, 382, 384, 386, 388, 390, 392, 394,
+  396, 398, 401, 404, 406, 408, 410, 412, 414, 416, 418, 421, 424, 426, 428, 430,
+  432, 434, 436, 438, 440, 442, 444, 446, 448, 450, 452, 454, 456, 458, 460, 462,
+  464, 466, 468, 470, 472, 474, 476, 478, 480, 482, 484, 486, 488, 490, 492, 494,
+  496, 498, 500, 503, 506, 509, 512, 514, 516, 519, 522, 524, 526, 527, 528, 529,
+  531, 532, 533, 535, 537, 538, 540, 542, 544, 546, 548, 550, 553, 555, 557, 559,
+  561, 563, 565, 568, 570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 590, 592,
+  594, 596, 598, 600, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624,
+  626, 628, 630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652, 654, 656,
+  658, 660, 662, 664, 666, 668, 670, 672, 674, 676, 678, 680, 682, 684, 686, 688,
+  690, 692, 694, 696, 698, 700, 702, 704, 706, 708, 710, 712, 714, 716, 718, 720,
+  722, 724, 726, 728, 730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752,
+  754, 756, 758, 760, 762, 764, 766, 768, 770, 772, 774, 777, 779, 781, 783, 785,
+  787, 790, 792, 794, 796, 798, 800, 802, 804, 806, 808, 810, 812, 814, 816, 818,
+  820, 822, 824, 826, 828, 830, 832, 834, 836, 838, 840, 842, 844, 846, 848, 850,
+  852, 854, 856, 858, 860, 862, 864, 866, 869, 872, 874, 876, 878, 880, 882, 884,
+  886, 888, 890, 892, 895, 898, 901, 904, 906, 908, 910, 912, 915, 918, 920, 922,
+  924, 926, 928, 930, 932, 934, 936, 938, 940, 942, 944, 946, 948, 950, 953, 956,
+  958, 960, 962, 964, 966, 968, 970, 972, 975, 978, 980, 982, 984, 986, 988, 990,
+  992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010, 1012, 1014, 1017, 1020, 1023, 1026,
+  1029, 1032, 1035, 1038, 1040, 1042, 1044, 1046, 1048, 1050, 1052, 1054, 1057, 1060, 1062, 1064,
+  1066, 1068, 1070, 1072, 1075, 1078, 1081, 1084, 1087, 1090, 1092, 1094, 1096, 1098, 1100, 1102,
+  1104, 1106, 1108, 1110, 1112, 1114, 1116, 1118, 1121, 1124, 1127, 1130, 1132, 1134, 1136, 1138,
+  1140, 1142, 1144, 1146, 1148, 1150, 1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166, 1168, 1170,
+  1172, 1174, 1176, 1178, 1180, 1182, 1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200, 1203,
+  1206, 1209, 1212, 1215, 1218, 1221, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1251,
+  1254, 1257, 1260, 1262, 1264, 1266, 1268, 1270, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+  1296, 1299, 1302, 1304, 1306, 1308, 1310, 1312, 1314, 1316, 1318, 1321, 1324, 1327, 1330, 1333,
+  1336, 1339, 1342, 1345, 1348, 1351, 1354, 1357, 1360, 1363, 1366, 1369, 1372, 1375, 1378, 1380,
+  1382, 1384, 1386, 1389, 1392, 1395, 1398, 1401, 1404, 1407, 1410, 1413, 1416, 1418, 1420, 1422,
+  1424, 1426, 1428, 1430, 1432, 1434, 1436, 1439, 1442, 1445, 1448, 1451, 1454, 1456, 1458, 1461,
+  1464, 1467, 1470, 1473, 1476, 1478, 1480, 1483, 1486, 1489, 1492, 1494, 1496, 1499, 1502, 1505,
+  1508, 1510, 1512, 1515, 1518, 1521, 1524, 1527, 1530, 1532, 1534, 1537, 1540, 1543, 1546, 1549,
+  1552, 1554, 1556, 1559, 1562, 1565, 1568, 1571, 1574, 1576, 1578, 1581, 1584, 1587, 1590, 1593,
+  1596, 1598, 1600, 1603, 1606, 1609, 1612, 1614, 1616, 1619, 1622, 1625, 1628, 1630, 1632, 1635,
+  1638, 1641, 1644, 1647, 1650, 1652, 1655, 1658, 1661, 1663, 1665, 1668, 1671, 1674, 1677, 1680,
+  1683, 1685, 1687, 1690, 1693, 1696, 1699, 1702, 1705, 1707, 1709, 1711, 1713, 1715, 1717, 1719,
+  1721, 1723, 1725, 1727, 1729, 1731, 1733, 1736, 1739, 1743, 1747, 1751, 1755, 1759, 1763, 1766,
+  1769, 1773, 1777, 1781, 1785, 1789, 1793, 1796, 1799, 1803, 1807, 1811, 1815, 1819, 1823, 1826,
+  1829, 1833, 1837, 1841, 1845, 1849, 1853, 1856, 1859, 1863, 1867, 1871, 1875, 1879, 1883, 1886,
+  1889, 1893, 1897, 1901, 1905, 1909, 1913, 1915, 1917, 1920, 1922, 1925, 1927, 1930, 1932, 1934,
+  1936, 1938, 1940, 1941, 1943, 1946, 1948, 1951, 1953, 1956, 1958, 1960, 1962, 1964, 1966, 1968,
+  1970, 1972, 1974, 1976, 1979, 1982, 1984, 1987, 1989, 1991, 1993, 1995, 1997, 1999, 2001, 2003,
+  2005, 2008, 2011, 2013, 2015, 2017, 2020, 2022, 2024, 2026, 2028, 2030, 2032, 2034, 2035, 2038,
+  2040, 2043, 2045, 2048, 2050, 2052, 2054, 2056, 2058, 2059, 2060, 2061, 2062, 2063, 2065, 2067,
+  2069, 2071, 2073, 2075, 2077, 2079, 2081, 2083, 2085, 2087, 2089, 2091, 2093, 2095, 2097, 2099,
+  2101, 2103, 2105, 2107, 2109, 2111, 2113, 2115, 2117, 2119, 2121, 2123, 2125, 2127, 2129, 2131,
+  2133, 2135, 2137, 2139, 2141, 2143, 2145, 2147, 2149, 2151, 2153, 2154, 2155, 2157, 2159, 2161,
+  2163, 2165, 2167, 2169, 2171, 2173, 2175, 2177, 2179, 2181, 2183, 2185, 2187, 2189, 2191, 2193,
+  2195, 2197, 2199, 2201, 2203, 2205, 2207, 2209, 2211, 2213, 2215, 2217, 2219, 2221, 2223, 2225,
+  2227, 2229, 2231, 2233, 2235, 2237, 2239, 2241, 2243, 2245, 2247, 2249, 2251, 2253, 2255, 2257,
+  2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
+  2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297,
+  2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+  2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329,
+  2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+  2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361,
+  2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+  2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393,
+  2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409,
+  2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425,
+  2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441,
+  2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+  2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+  2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489,
+  2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505,
+  2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521,
+  2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537,
+  2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+  2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569,
+  2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585,
+  2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601,
+  2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617,
+  2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+  2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649,
+  2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665,
+  2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681,
+  2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697,
+  2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+  2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729,
+  2730, 2731, 2732, 2733, 2735, 2737, 2739, 2741, 2744, 2747, 2749, 2751, 2753, 2755, 2757, 2759,
+  2761, 2763, 2765, 2767, 2769, 2771, 2773, 2775, 2777, 2779, 2781, 2783, 2785, 2787, 2789, 2791,
+  2793, 2795, 2797, 2799, 2801, 2803, 2805, 2807, 2809, 2811, 2813, 2815, 2817, 2819, 2821, 2823,
+  2825, 2827, 2829, 2831, 2833, 2836, 2839, 2842, 2845, 2848, 2850, 2852, 2855, 2858, 2861, 2864,
+  2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880,
+  2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896,
+  2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912,
+  2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928,
+  2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944,
+  2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960,
+  2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976,
+  2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992,
+  2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008,
+  3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024,
+  3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040,
+  3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056,
+  3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072,
+  3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088,
+  3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104,
+  3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120,
+  3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136,
+  3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152,
+  3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
+  3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184,
+  3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+  3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216,
+  3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232,
+  3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248,
+  3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+  3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280,
+  3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
+  3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312,
+  3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328,
+  3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344,
+  3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360,
+  3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376,
+  3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392,
+  3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406,
+};
+
+/// The full canonical decompositions
+inline constexpr auto decomposition_data = std::array<char32_t, 3406>{
+  U'\x41', U'\x300', U'\x41', U'\x301', U'\x41', U'\x302', U'\x41', U'\x303',
+  U'\x41', U'\x308', U'\x41', U'\x30a', U'\x43', U'\x327', U'\x45', U'\x300',
+  U'\x45', U'\x301', U'\x45', U'\x302', U'\x45', U'\x308', U'\x49', U'\x300',
+  U'\x49', U'\x301', U'\x49', U'\x302', U'\x49', U'\x308', U'\x4e', U'\x303',
+  U'\x4f', U'\x300', U'\x4f', U'\x301', U'\x4f', U'\x302', U'\x4f', U'\x303',
+  U'\x4f', U'\x308', U'\x55', U'\x300', U'\x55', U'\x301', U'\x55', U'\x302',
+  U'\x55', U'\x308', U'\x59', U'\x301', U'\x61', U'\x300', U'\x61', U'\x301',
+  U'\x61', U'\x302', U'\x61', U'\x303', U'\x61', U'\x308', U'\x61', U'\x30a',
+  U'\x63', U'\x327', U'\x65', U'\x300', U'\x65', U'\x301', U'\x65', U'\x302',
+  U'\x65', U'\x308', U'\x69', U'\x300', U'\x69', U'\x301', U'\x69', U'\x302',
+  U'\x69', U'\x308', U'\x6e', U'\x303', U'\x6f', U'\x300', U'\x6f', U'\x301',
+  U'\x6f', U'\x302', U'\x6f', U'\x303', U'\x6f', U'\x308', U'\x75', U'\x300',
+  U'\x75', U'\x301', U'\x75', U'\x302', U'\x75', U'\x308', U'\x79', U'\x301',
+  U'\x79', U'\x308', U'\x41', U'\x304', U'\x61', U'\x304', U'\x41', U'\x306',
+  U'\x61', U'\x306', U'\x41', U'\x328', U'\x61', U'\x328', U'\x43', U'\x301',
+  U'\x63', U'\x301', U'\x43', U'\x302', U'\x63', U'\x302', U'\x43', U'\x307',
+  U'\x63', U'\x307', U'\x43', U'\x30c', U'\x63', U'\x30c', U'\x44', U'\x30c',
+  U'\x64', U'\x30c', U'\x45', U'\x304', U'\x65', U'\x304', U'\x45', U'\x306',
+  U'\x65', U'\x306', U'\x45', U'\x307', U'\x65', U'\x307', U'\x45', U'\x328',
+  U'\x65', U'\x328', U'\x45', U'\x30c', U'\x65', U'\x30c', U'\x47', U'\x302',
+  U'\x67', U'\x302', U'\x47', U'\x306', U'\x67', U'\x306', U'\x47', U'\x307',
+  U'\x67', U'\x307', U'\x47', U'\x327', U'\x67', U'\x327', U'\x48', U'\x302',
+  U'\x68', U'\x302', U'\x49', U'\x303', U'\x69', U'\x303', U'\x49', U'\x304',
+  U'\x69', U'\x304', U'\x49', U'\x306', U'\x69', U'\x306', U'\x49', U'\x328',
+  U'\x69', U'\x328', U'\x49', U'\x307', U'\x4a', U'\x302', U'\x6a', U'\x302',
+  U'\x4b', U'\x327', U'\x6b', U'\x327', U'\x4c', U'\x301', U'\x6c', U'\x301',
+  U'\x4c', U'\x327', U'\x6c', U'\x327', U'\x4c', U'\x30c', U'\x6c', U'\x30c',
+  U'\x4e', U'\x301', U'\x6e', U'\x301', U'\x4e', U'\x327', U'\x6e', U'\x327',
+  U'\x4e', U'\x30c', U'\x6e', U'\x30c', U'\x4f', U'\x304', U'\x6f', U'\x304',
+  U'\x4f', U'\x306', U'\x6f', U'\x306', U'\x4f', U'\x30b', U'\x6f', U'\x30b',
+  U'\x52', U'\x301', U'\x72', U'\x301', U'\x52', U'\x327', U'\x72', U'\x327',
+  U'\x52', U'\x30c', U'\x72', U'\x30c', U'\x53', U'\x301', U'\x73', U'\x301',
+  U'\x53', U'\x302', U'\x73', U'\x302', U'\x53', U'\x327', U'\x73', U'\x327',
+  U'\x53', U'\x30c', U'\x73', U'\x30c', U'\x54', U'\x327', U'\x74', U'\x327',
+  U'\x54', U'\x30c', U'\x74', U'\x30c', U'\x55', U'\x303', U'\x75', U'\x303',
+  U'\x55', U'\x304', U'\x75', U'\x304', U'\x55', U'\x306', U'\x75', U'\x306',
+  U'\x55', U'\x30a', U'\x75', U'\x30a', U'\x55', U'\x30b', U'\x75', U'\x30b',
+  U'\x55', U'\x328', U'\x75', U'\x328', U'\x57', U'\x302', U'\x77', U'\x302',
+  U'\x59', U'\x302', U'\x79', U'\x302', U'\x59', U'\x308', U'\x5a', U'\x301',
+  U'\x7a', U'\x301', U'\x5a', U'\x307', U'\x7a', U'\x307', U'\x5a', U'\x30c',
+  U'\x7a', U'\x30c', U'\x4f', U'\x31b', U'\x6f', U'\x31b', U'\x55', U'\x31b',
+  U'\x75', U'\x31b', U'\x41', U'\x30c', U'\x61', U'\x30c', U'\x49', U'\x30c',
+  U'\x69', U'\x30c', U'\x4f', U'\x30c', U'\x6f', U'\x30c', U'\x55', U'\x30c',
+  U'\x75', U'\x30c', U'\x55', U'\x308', U'\x304', U'\x75', U'\x308', U'\x304',
+  U'\x55', U'\x308', U'\x301', U'\x75', U'\x308', U'\x301', U'\x55', U'\x308',
+  U'\x30c', U'\x75', U'\x308', U'\x30c', U'\x55', U'\x308', U'\x300', U'\x75',
+  U'\x308', U'\x300', U'\x41', U'\x308', U'\x304', U'\x61', U'\x308', U'\x304',
+  U'\x41', U'\x307', U'\x304', U'\x61', U'\x307', U'\x304', U'\xc6', U'\x304',
+  U'\xe6', U'\x304', U'\x47', U'\x30c', U'\x67', U'\x30c', U'\x4b', U'\x30c',
+  U'\x6b', U'\x30c', U'\x4f', U'\x328', U'\x6f', U'\x328', U'\x4f', U'\x328',
+  U'\x304', U'\x6f', U'\x328', U'\x304', U'\x1b7', U'\x30c', U'\x292', U'\x30c',
+  U'\x6a', U'\x30c', U'\x47', U'\x301', U'\x67', U'\x301', U'\x4e', U'\x300',
+  U'\x6e', U'\x300', U'\x41', U'\x30a', U'\x301', U'\x61', U'\x30a', U'\x301',
+  U'\xc6', U'\x301', U'\xe6', U'\x301', U'\xd8', U'\x301', U'\xf8', U'\x301',
+  U'\x41', U'\x30f', U'\x61', U'\x30f', U'\x41', U'\x311', U'\x61', U'\x311',
+  U'\x45', U'\x30f', U'\x65', U'\x30f', U'\x45', U'\x311', U'\x65', U'\x311',
+  U'\x49', U'\x30f', U'\x69', U'\x30f', U'\x49', U'\x311', U'\x69', U'\x311',
+  U'\x4f', U'\x30f', U'\x6f', U'\x30f', U'\x4f', U'\x311', U'\x6f', U'\x311',
+  U'\x52', U'\x30f', U'\x72', U'\x30f', U'\x52', U'\x311', U'\x72', U'\x311',
+  U'\x55', U'\x30f', U'\x75', U'\x30f', U'\x55', U'\x311', U'\x75', U'\x311',
+  U'\x53', U'\x326', U'\x73', U'\x326', U'\x54', U'\x326', U'\x74', U'\x326',
+  U'\x48', U'\x30c', U'\x68', U'\x30c', U'\x41', U'\x307', U'\x61', U'\x307',
+  U'\x45', U'\x327', U'\x65', U'\x327', U'\x4f', U'\x308', U'\x304', U'\x6f',
+  U'\x308', U'\x304', U'\x4f', U'\x303', U'\x304', U'\x6f', U'\x303', U'\x304',
+  U'\x4f', U'\x307', U'\x6f', U'\x307', U'\x4f', U'\x307', U'\x304', U'\x6f',
+  U'\x307', U'\x304', U'\x59', U'\x304', U'\x79', U'\x304', U'\x300', U'\x301',
+  U'\x313', U'\x308', U'\x301', U'\x2b9', U'\x3b', U'\xa8', U'\x301', U'\x391',
+  U'\x301', U'\xb7', U'\x395', U'\x301', U'\x397', U'\x301', U'\x399', U'\x301',
+  U'\x39f', U'\x301', U'\x3a5', U'\x301', U'\x3a9', U'\x301', U'\x3b9', U'\x308',
+  U'\x301', U'\x399', U'\x308', U'\x3a5', U'\x308', U'\x3b1', U'\x301', U'\x3b5',
+  U'\x301', U'\x3b7', U'\x301', U'\x3b9', U'\x301', U'\x3c5', U'\x308', U'\x301',
+  U'\x3b9', U'\x308', U'\x3c5', U'\x308', U'\x3bf', U'\x301', U'\x3c5', U'\x301',
+  U'\x3c9', U'\x301', U'\x3d2', U'\x301', U'\x3d2', U'\x308', U'\x415', U'\x300',
+  U'\x415', U'\x308', U'\x413', U'\x301', U'\x406', U'\x308', U'\x41a', U'\x301',
+  U'\x418', U'\x300', U'\x423', U'\x306', U'\x418', U'\x306', U'\x438', U'\x306',
+  U'\x435', U'\x300', U'\x435', U'\x308', U'\x433', U'\x301', U'\x456', U'\x308',
+  U'\x43a', U'\x301', U'\x438', U'\x300', U'\x443', U'\x306', U'\x474', U'\x30f',
+  U'\x475', U'\x30f', U'\x416', U'\x306', U'\x436', U'\x306', U'\x410', U'\x306',
+  U'\x430', U'\x306', U'\x410', U'\x308', U'\x430', U'\x308', U'\x415', U'\x306',
+  U'\x435', U'\x306', U'\x4d8', U'\x308', U'\x4d9', U'\x308', U'\x416', U'\x308',
+  U'\x436', U'\x308', U'\x417', U'\x308', U'\x437', U'\x308', U'\x418', U'\x304',
+  U'\x438', U'\x304', U'\x418', U'\x308', U'\x438', U'\x308', U'\x41e', U'\x308',
+  U'\x43e', U'\x308', U'\x4e8', U'\x308', U'\x4e9', U'\x308', U'\x42d', U'\x308',
+  U'\x44d', U'\x308', U'\x423', U'\x304', U'\x443', U'\x304', U'\x423', U'\x308',
+  U'\x443', U'\x308', U'\x423', U'\x30b', U'\x443', U'\x30b', U'\x427', U'\x308',
+  U'\x447', U'\x308', U'\x42b', U'\x308', U'\x44b', U'\x308', U'\x627', U'\x653',
+  U'\x627', U'\x654', U'\x648', U'\x654', U'\x627', U'\x655', U'\x64a', U'\x654',
+  U'\x6d5', U'\x654', U'\x6c1', U'\x654', U'\x6d2', U'\x654', U'\x928', U'\x93c',
+  U'\x930', U'\x93c', U'\x933', U'\x93c', U'\x915', U'\x93c', U'\x916', U'\x93c',
+  U'\x917', U'\x93c', U'\x91c', U'\x93c', U'\x921', U'\x93c', U'\x922', U'\x93c',
+  U'\x92b', U'\x93c', U'\x92f', U'\x93c', U'\x9c7', U'\x9be', U'\x9c7', U'\x9d7',
+  U'\x9a1', U'\x9bc', U'\x9a2', U'\x9bc', U'\x9af', U'\x9bc', U'\xa32', U'\xa3c',
+  U'\xa38', U'\xa3c', U'\xa16', U'\xa3c', U'\xa17', U'\xa3c', U'\xa1c', U'\xa3c',
+  U'\xa2b', U'\xa3c', U'\xb47', U'\xb56', U'\xb47', U'\xb3e', U'\xb47', U'\xb57',
+  U'\xb21', U'\xb3c', U'\xb22', U'\xb3c', U'\xb92', U'\xbd7', U'\xbc6', U'\xbbe',
+  U'\xbc7', U'\xbbe', U'\xbc6', U'\xbd7', U'\xc46', U'\xc56', U'\xcbf', U'\xcd5',
+  U'\xcc6', U'\xcd5', U'\xcc6', U'\xcd6', U'\xcc6', U'\xcc2', U'\xcc6', U'\xcc2',
+  U'\xcd5', U'\xd46', U'\xd3e', U'\xd47', U'\xd3e', U'\xd46', U'\xd57', U'\xdd9',
+  U'\xdca', U'\xdd9', U'\xdcf', U'\xdd9', U'\xdcf', U'\xdca', U'\xdd9', U'\xddf',
+  U'\xf42', U'\xfb7', U'\xf4c', U'\xfb7', U'\xf51', U'\xfb7', U'\xf56', U'\xfb7',
+  U'\xf5b', U'\xfb7', U'\xf40', U'\xfb5', U'\xf71', U'\xf72', U'\xf71', U'\xf74',
+  U'\xfb2', U'\xf80', U'\xfb3', U'\xf80', U'\xf71', U'\xf80', U'\xf92', U'\xfb7',
+  U'\xf9c', U'\xfb7', U'\xfa1', U'\xfb7', U'\xfa6', U'\xfb7', U'\xfab', U'\xfb7',
+  U'\xf90', U'\xfb5', U'\x1025', U'\x102e', U'\x1b05', U'\x1b35', U'\x1b07', U'\x1b35',
+  U'\x1b09', U'\x1b35', U'\x1b0b', U'\x1b35', U'\x1b0d', U'\x1b35', U'\x1b11', U'\x1b35',
+  U'\x1b3a', U'\x1b35', U'\x1b3c', U'\x1b35', U'\x1b3e', U'\x1b35', U'\x1b3f', U'\x1b35',
+  U'\x1b42', U'\x1b35', U'\x41', U'\x325', U'\x61', U'\x325', U'\x42', U'\x307',
+  U'\x62', U'\x307', U'\x42', U'\x323', U'\x62', U'\x323', U'\x42', U'\x331',
+  U'\x62', U'\x331', U'\x43', U'\x327', U'\x301', U'\x63', U'\x327', U'\x301',
+  U'\x44', U'\x307', U'\x64', U'\x307', U'\x44', U'\x323', U'\x64', U'\x323',
+  U'\x44', U'\x331', U'\x64', U'\x331', U'\x44', U'\x327', U'\x64', U'\x327',
+  U'\x44', U'\x32d', U'\x64', U'\x32d', U'\x45', U'\x304', U'\x300', U'\x65',
+  U'\x304', U'\x300', U'\x45', U'\x304', U'\x301', U'\x65', U'\x304', U'\x301',
+  U'\x45', U'\x32d', U'\x65', U'\x32d', U'\x45', U'\x330', U'\x65', U'\x330',
+  U'\x45', U'\x327', U'\x306', U'\x65', U'\x327', U'\x306', U'\x46', U'\x307',
+  U'\x66', U'\x307', U'\x47', U'\x304', U'\x67', U'\x304', U'\x48', U'\x307',
+  U'\x68', U'\x307', U'\x48', U'\x323', U'\x68', U'\x323', U'\x48', U'\x308',
+  U'\x68', U'\x308', U'\x48', U'\x327', U'\x68', U'\x327', U'\x48', U'\x32e',
+  U'\x68', U'\x32e', U'\x49', U'\x330', U'\x69', U'\x330', U'\x49', U'\x308',
+  U'\x301', U'\x69', U'\x308', U'\x301', U'\x4b', U'\x301', U'\x6b', U'\x301',
+  U'\x4b', U'\x323', U'\x6b', U'\x323', U'\x4b', U'\x331', U'\x6b', U'\x331',
+  U'\x4c', U'\x323', U'\x6c', U'\x323', U'\x4c', U'\x323', U'\x304', U'\x6c',
+  U'\x323', U'\x304', U'\x4c', U'\x331', U'\x6c', U'\x331', U'\x4c', U'\x32d',
+  U'\x6c', U'\x32d', U'\x4d', U'\x301', U'\x6d', U'\x301', U'\x4d', U'\x307',
+  U'\x6d', U'\x307', U'\x4d', U'\x323', U'\x6d', U'\x323', U'\x4e', U'\x307',
+  U'\x6e', U'\x307', U'\x4e', U'\x323', U'\x6e', U'\x323', U'\x4e', U'\x331',
+  U'\x6e', U'\x331', U'\x4e', U'\x32d', U'\x6e', U'\x32d', U'\x4f', U'\x303',
+  U'\x301', U'\x6f', U'\x303', U'\x301', U'\x4f', U'\x303', U'\x308', U'\x6f',
+  U'\x303', U'\x308', U'\x4f', U'\x304', U'\x300', U'\x6f', U'\x304', U'\x300',
+  U'\x4f', U'\x304', U'\x301', U'\x6f', U'\x304', U'\x301', U'\x50', U'\x301',
+  U'\x70', U'\x301', U'\x50', U'\x307', U'\x70', U'\x307', U'\x52', U'\x307',
+  U'\x72', U'\x307', U'\x52', U'\x323', U'\x72', U'\x323', U'\x52', U'\x323',
+  U'\x304', U'\x72', U'\x323', U'\x304', U'\x52', U'\x331', U'\x72', U'\x331',
+  U'\x53', U'\x307', U'\x73', U'\x307', U'\x53', U'\x323', U'\x73', U'\x323',
+  U'\x53', U'\x301', U'\x307', U'\x73', U'\x301', U'\x307', U'\x53', U'\x30c',
+  U'\x307', U'\x73', U'\x30c', U'\x307', U'\x53', U'\x323', U'\x307', U'\x73',
+  U'\x323', U'\x307', U'\x54', U'\x307', U'\x74', U'\x307', U'\x54', U'\x323',
+  U'\x74', U'\x323', U'\x54', U'\x331', U'\x74', U'\x331', U'\x54', U'\x32d',
+  U'\x74', U'\x32d', U'\x55', U'\x324', U'\x75', U'\x324', U'\x55', U'\x330',
+  U'\x75', U'\x330', U'\x55', U'\x32d', U'\x75', U'\x32d', U'\x55', U'\x303',
+  U'\x301', U'\x75', U'\x303', U'\x301', U'\x55', U'\x304', U'\x308', U'\x75',
+  U'\x304', U'\x308', U'\x56', U'\x303', U'\x76', U'\x303', U'\x56', U'\x323',
+  U'\x76', U'\x323', U'\x57', U'\x300', U'\x77', U'\x300', U'\x57', U'\x301',
+  U'\x77', U'\x301', U'\x57', U'\x308', U'\x77', U'\x308', U'\x57', U'\x307',
+  U'\x77', U'\x307', U'\x57', U'\x323', U'\x77', U'\x323', U'\x58', U'\x307',
+  U'\x78', U'\x307', U'\x58', U'\x308', U'\x78', U'\x308', U'\x59', U'\x307',
+  U'\x79', U'\x307', U'\x5a', U'\x302', U'\x7a', U'\x302', U'\x5a', U'\x323',
+  U'\x7a', U'\x323', U'\x5a', U'\x331', U'\x7a', U'\x331', U'\x68', U'\x331',
+  U'\x74', U'\x308', U'\x77', U'\x30a', U'\x79', U'\x30a', U'\x17f', U'\x307',
+  U'\x41', U'\x323', U'\x61', U'\x323', U'\x41', U'\x309', U'\x61', U'\x309',
+  U'\x41', U'\x302', U'\x301', U'\x61', U'\x302', U'\x301', U'\x41', U'\x302',
+  U'\x300', U'\x61', U'\x302', U'\x300', U'\x41', U'\x302', U'\x309', U'\x61',
+  U'\x302', U'\x309', U'\x41', U'\x302', U'\x303', U'\x61', U'\x302', U'\x303',
+  U'\x41', U'\x323', U'\x302', U'\x61', U'\x323', U'\x302', U'\x41', U'\x306',
+  U'\x301', U'\x61', U'\x306', U'\x301', U'\x41', U'\x306', U'\x300', U'\x61',
+  U'\x306', U'\x300', U'\x41', U'\x306', U'\x309', U'\x61', U'\x306', U'\x309',
+  U'\x41', U'\x306', U'\x303', U'\x61', U'\x306', U'\x303', U'\x41', U'\x323',
+  U'\x306', U'\x61', U'\x323', U'\x306', U'\x45', U'\x323', U'\x65', U'\x323',
+  U'\x45', U'\x309', U'\x65', U'\x309', U'\x45', U'\x303', U'\x65', U'\x303',
+  U'\x45', U'\x302', U'\x301', U'\x65', U'\x302', U'\x301', U'\x45', U'\x302',
+  U'\x300', U'\x65', U'\x302', U'\x300', U'\x45', U'\x302', U'\x309', U'\x65',
+  U'\x302', U'\x309', U'\x45', U'\x302', U'\x303', U'\x65', U'\x302', U'\x303',
+  U'\x45', U'\x323', U'\x302', U'\x65', U'\x323', U'\x302', U'\x49', U'\x309',
+  U'\x69', U'\x309', U'\x49', U'\x323', U'\x69', U'\x323', U'\x4f', U'\x323',
+  U'\x6f', U'\x323', U'\x4f', U'\x309', U'\x6f', U'\x309', U'\x4f', U'\x302',
+  U'\x301', U'\x6f', U'\x302', U'\x301', U'\x4f', U'\x302', U'\x300', U'\x6f',
+  U'\x302', U'\x300', U'\x4f', U'\x302', U'\x309', U'\x6f', U'\x302', U'\x309',
+  U'\x4f', U'\x302', U'\x303', U'\x6f', U'\x302', U'\x303', U'\x4f', U'\x323',
+  U'\x302', U'\x6f', U'\x323', U'\x302', U'\x4f', U'\x31b', U'\x301', U'\x6f',
+  U'\x31b', U'\x301', U'\x4f', U'\x31b', U'\x300', U'\x6f', U'\x31b', U'\x300',
+  U'\x4f', U'\x31b', U'\x309', U'\x6f', U'\x31b', U'\x309', U'\x4f', U'\x31b',
+  U'\x303', U'\x6f', U'\x31b', U'\x303', U'\x4f', U'\x31b', U'\x323', U'\x6f',
+  U'\x31b', U'\x323', U'\x55', U'\x323', U'\x75', U'\x323', U'\x55', U'\x309',
+  U'\x75', U'\x309', U'\x55', U'\x31b', U'\x301', U'\x75', U'\x31b', U'\x301',
+  U'\x55', U'\x31b', U'\x300', U'\x75', U'\x31b', U'\x300', U'\x55', U'\x31b',
+  U'\x309', U'\x75', U'\x31b', U'\x309', U'\x55', U'\x31b', U'\x303', U'\x75',
+  U'\x31b', U'\x303', U'\x55', U'\x31b', U'\x323', U'\x75', U'\x31b', U'\x323',
+  U'\x59', U'\x300', U'\x79', U'\x300', U'\x59', U'\x323', U'\x79', U'\x323',
+  U'\x59', U'\x309', U'\x79', U'\x309', U'\x59', U'\x303', U'\x79', U'\x303',
+  U'\x3b1', U'\x313', U'\x3b1', U'\x314', U'\x3b1', U'\x313', U'\x300', U'\x3b1',
+  U'\x314', U'\x300', U'\x3b1', U'\x313', U'\x301', U'\x3b1', U'\x314', U'\x301',
+  U'\x3b1', U'\x313', U'\x342', U'\x3b1', U'\x314', U'\x342', U'\x391', U'\x313',
+  U'\x391', U'\x314', U'\x391', U'\x313', U'\x300', U'\x391', U'\x314', U'\x300',
+  U'\x391', U'\x313', U'\x301', U'\x391', U'\x314', U'\x301', U'\x391', U'\x313',
+  U'\x342', U'\x391', U'\x314', U'\x342', U'\x3b5', U'\x313', U'\x3b5', U'\x314',
+  U'\x3b5', U'\x313', U'\x300', U'\x3b5', U'\x314', U'\x300', U'\x3b5', U'\x313',
+  U'\x301', U'\x3b5', U'\x314', U'\x301', U'\x395', U'\x313', U'\x395', U'\x314',
+  U'\x395', U'\x313', U'\x300', U'\x395', U'\x314', U'\x300', U'\x395', U'\x313',
+  U'\x301', U'\x395', U'\x314', U'\x301', U'\x3b7', U'\x313', U'\x3b7', U'\x314',
+  U'\x3b7', U'\x313', U'\x300', U'\x3b7', U'\x314', U'\x300', U'\x3b7', U'\x313',
+  U'\x301', U'\x3b7', U'\x314', U'\x301', U'\x3b7', U'\x313', U'\x342', U'\x3b7',
+  U'\x314', U'\x342', U'\x397', U'\x313', U'\x397', U'\x314', U'\x397', U'\x313',
+  U'\x300', U'\x397', U'\x314', U'\x300', U'\x397', U'\x313', U'\x301', U'\x397',
+  U'\x314', U'\x301', U'\x397', U'\x313', U'\x342', U'\x397', U'\x314', U'\x342',
+  U'\x3b9', U'\x313', U'\x3b9', U'\x314', U'\x3b9', U'\x313', U'\x300', U'\x3b9',
+  U'\x314', U'\x300', U'\x3b9', U'\x313', U'\x301', U'\x3b9', U'\x314', U'\x301',
+  U'\x3b9', U'\x313', U'\x342', U'\x3b9', U'\x314', U'\x342', U'\x399', U'\x313',
+  U'\x399', U'\x314', U'\x399', U'\x313', U'\x300', U'\x399', U'\x314', U'\x300',
+  U'\x399', U'\x313', U'\x301', U'\x399', U'\x314', U'\x301', U'\x399', U'\x313',
+  U'\x342', U'\x399', U'\x314', U'\x342', U'\x3bf', U'\x313', U'\x3bf', U'\x314',
+  U'\x3bf', U'\x313', U'\x300', U'\x3bf', U'\x314', U'\x300', U'\x3bf', U'\x313',
+  U'\x301', U'\x3bf', U'\x314', U'\x301', U'\x39f', U'\x313', U'\x39f', U'\x314',
+  U'\x39f', U'\x313', U'\x300', U'\x39f', U'\x314', U'\x300', U'\x39f', U'\x313',
+  U'\x301', U'\x39f', U'\x314', U'\x301', U'\x3c5', U'\x313', U'\x3c5', U'\x314',
+  U'\x3c5', U'\x313', U'\x300', U'\x3c5', U'\x314', U'\x300', U'\x3c5', U'\x313',
+  U'\x301', U'\x3c5', U'\x314', U'\x301', U'\x3c5', U'\x313', U'\x342', U'\x3c5',
+  U'\x314', U'\x342', U'\x3a5', U'\x314', U'\x3a5', U'\x314', U'\x300', U'\x3a5',
+  U'\x314', U'\x301', U'\x3a5', U'\x314', U'\x342', U'\x3c9', U'\x313', U'\x3c9',
+  U'\x314', U'\x3c9', U'\x313', U'\x300', U'\x3c9', U'\x314', U'\x300', U'\x3c9',
+  U'\x313', U'\x301', U'\x3c9', U'\x314', U'\x301', U'\x3c9', U'\x313', U'\x342',
+  U'\x3c9', U'\x314', U'\x342', U'\x3a9', U'\x313', U'\x3a9', U'\x314', U'\x3a9',
+  U'\x313', U'\x300', U'\x3a9', U'\x314', U'\x300', U'\x3a9', U'\x313', U'\x301',
+  U'\x3a9', U'\x314', U'\x301', U'\x3a9', U'\x313', U'\x342', U'\x3a9', U'\x314',
+  U'\x342', U'\x3b1', U'\x300', U'\x3b1', U'\x301', U'\x3b5', U'\x300', U'\x3b5',
+  U'\x301', U'\x3b7', U'\x300', U'\x3b7', U'\x301', U'\x3b9', U'\x300', U'\x3b9',
+  U'\x301', U'\x3bf', U'\x300', U'\x3bf', U'\x301', U'\x3c5', U'\x300', U'\x3c5',
+  U'\x301', U'\x3c9', U'\x300', U'\x3c9', U'\x301', U'\x3b1', U'\x313', U'\x345',
+  U'\x3b1', U'\x314', U'\x345', U'\x3b1', U'\x313', U'\x300', U'\x345', U'\x3b1',
+  U'\x314', U'\x300', U'\x345', U'\x3b1', U'\x313', U'\x301', U'\x345', U'\x3b1',
+  U'\x314', U'\x301', U'\x345', U'\x3b1', U'\x313', U'\x342', U'\x345', U'\x3b1',
+  U'\x314', U'\x342', U'\x345', U'\x391', U'\x313', U'\x345', U'\x391', U'\x314',
+  U'\x345', U'\x391', U'\x313', U'\x300', U'\x345', U'\x391', U'\x314', U'\x300',
+  U'\x345', U'\x391', U'\x313', U'\x301', U'\x345', U'\x391', U'\x314', U'\x301',
+  U'\x345', U'\x391', U'\x313', U'\x342', U'\x345', U'\x391', U'\x314', U'\x342',
+  U'\x345', U'\x3b7', U'\x313', U'\x345', U'\x3b7', U'\x314', U'\x345', U'\x3b7',
+  U'\x313', U'\x300', U'\x345', U'\x3b7', U'\x314', U'\x300', U'\x345', U'\x3b7',
+  U'\x313', U'\x301', U'\x345', U'\x3b7', U'\x314', U'\x301', U'\x345', U'\x3b7',
+  U'\x313', U'\x342', U'\x345', U'\x3b7', U'\x314', U'\x342', U'\x345', U'\x397',
+  U'\x313', U'\x345', U'\x397', U'\x314', U'\x345', U'\x397', U'\x313', U'\x300',
+  U'\x345', U'\x397', U'\x314', U'\x300', U'\x345', U'\x397', U'\x313', U'\x301',
+  U'\x345', U'\x397', U'\x314', U'\x301', U'\x345', U'\x397', U'\x313', U'\x342',
+  U'\x345', U'\x397', U'\x314', U'\x342', U'\x345', U'\x3c9', U'\x313', U'\x345',
+  U'\x3c9', U'\x314', U'\x345', U'\x3c9', U'\x313', U'\x300', U'\x345', U'\x3c9',
+  U'\x314', U'\x300', U'\x345', U'\x3c9', U'\x313', U'\x301', U'\x345', U'\x3c9',
+  U'\x314', U'\x301', U'\x345', U'\x3c9', U'\x313', U'\x342', U'\x345', U'\x3c9',
+  U'\x314', U'\x342', U'\x345', U'\x3a9', U'\x313', U'\x345', U'\x3a9', U'\x314',
+  U'\x345', U'\x3a9', U'\x313', U'\x300', U'\x345', U'\x3a9', U'\x314', U'\x300',
+  U'\x345', U'\x3a9', U'\x313', U'\x301', U'\x345', U'\x3a9', U'\x314', U'\x301',
+  U'\x345', U'\x3a9', U'\x313', U'\x342', U'\x345', U'\x3a9', U'\x314', U'\x342',
+  U'\x345', U'\x3b1', U'\x306', U'\x3b1', U'\x304', U'\x3b1', U'\x300', U'\x345',
+  U'\x3b1', U'\x345', U'\x3b1', U'\x301', U'\x345', U'\x3b1', U'\x342', U'\x3b1',
+  U'\x342', U'\x345', U'\x391', U'\x306', U'\x391', U'\x304', U'\x391', U'\x300',
+  U'\x391', U'\x301', U'\x391', U'\x345', U'\x3b9', U'\xa8', U'\x342', U'\x3b7',
+  U'\x300', U'\x345', U'\x3b7', U'\x345', U'\x3b7', U'\x301', U'\x345', U'\x3b7',
+  U'\x342', U'\x3b7', U'\x342', U'\x345', U'\x395', U'\x300', U'\x395', U'\x301',
+  U'\x397', U'\x300', U'\x397', U'\x301', U'\x397', U'\x345', U'\x1fbf', U'\x300',
+  U'\x1fbf', U'\x301', U'\x1fbf', U'\x342', U'\x3b9', U'\x306', U'\x3b9', U'\x304',
+  U'\x3b9', U'\x308', U'\x300', U'\x3b9', U'\x308', U'\x301', U'\x3b9', U'\x342',
+  U'\x3b9', U'\x308', U'\x342', U'\x399', U'\x306', U'\x399', U'\x304', U'\x399',
+  U'\x300', U'\x399', U'\x301', U'\x1ffe', U'\x300', U'\x1ffe', U'\x301', U'\x1ffe',
+  U'\x342', U'\x3c5', U'\x306', U'\x3c5', U'\x304', U'\x3c5', U'\x308', U'\x300',
+  U'\x3c5', U'\x308', U'\x301', U'\x3c1', U'\x313', U'\x3c1', U'\x314', U'\x3c5',
+  U'\x342', U'\x3c5', U'\x308', U'\x342', U'\x3a5', U'\x306', U'\x3a5', U'\x304',
+  U'\x3a5', U'\x300', U'\x3a5', U'\x301', U'\x3a1', U'\x314', U'\xa8', U'\x300',
+  U'\xa8', U'\x301', U'\x60', U'\x3c9', U'\x300', U'\x345', U'\x3c9', U'\x345',
+  U'\x3c9', U'\x301', U'\x345', U'\x3c9', U'\x342', U'\x3c9', U'\x342', U'\x345',
+  U'\x39f', U'\x300', U'\x39f', U'\x301', U'\x3a9', U'\x300', U'\x3a9', U'\x301',
+  U'\x3a9', U'\x345', U'\xb4', U'\x2002', U'\x2003', U'\x3a9', U'\x4b', U'\x41',
+  U'\x30a', U'\x2190', U'\x338', U'\x2192', U'\x338', U'\x2194', U'\x338', U'\x21d0',
+  U'\x338', U'\x21d4', U'\x338', U'\x21d2', U'\x338', U'\x2203', U'\x338', U'\x2208',
+  U'\x338', U'\x220b', U'\x338', U'\x2223', U'\x338', U'\x2225', U'\x338', U'\x223c',
+  U'\x338', U'\x2243', U'\x338', U'\x2245', U'\x338', U'\x2248', U'\x338', U'\x3d',
+  U'\x338', U'\x2261', U'\x338', U'\x224d', U'\x338', U'\x3c', U'\x338', U'\x3e',
+  U'\x338', U'\x2264', U'\x338', U'\x2265', U'\x338', U'\x2272', U'\x338', U'\x2273',
+  U'\x338', U'\x2276', U'\x338', U'\x2277', U'\x338', U'\x227a', U'\x338', U'\x227b',
+  U'\x338', U'\x2282', U'\x338', U'\x2283', U'\x338', U'\x2286', U'\x338', U'\x2287',
+  U'\x338', U'\x22a2', U'\x338', U'\x22a8', U'\x338', U'\x22a9', U'\x338', U'\x22ab',
+  U'\x338', U'\x227c', U'\x338', U'\x227d', U'\x338', U'\x2291', U'\x338', U'\x2292',
+  U'\x338', U'\x22b2', U'\x338', U'\x22b3', U'\x338', U'\x22b4', U'\x338', U'\x22b5',
+  U'\x338', U'\x3008', U'\x3009', U'\x2add', U'\x338', U'\x304b', U'\x3099', U'\x304d',
+  U'\x3099', U'\x304f', U'\x3099', U'\x3051', U'\x3099', U'\x3053', U'\x3099', U'\x3055',
+  U'\x3099', U'\x3057', U'\x3099', U'\x3059', U'\x3099', U'\x305b', U'\x3099', U'\x305d',
+  U'\x3099', U'\x305f', U'\x3099', U'\x3061', U'\x3099', U'\x3064', U'\x3099', U'\x3066',
+  U'\x3099', U'\x3068', U'\x3099', U'\x306f', U'\x3099', U'\x306f', U'\x309a', U'\x3072',
+  U'\x3099', U'\x3072', U'\x309a', U'\x3075', U'\x3099', U'\x3075', U'\x309a', U'\x3078',
+  U'\x3099', U'\x3078', U'\x309a', U'\x307b', U'\x3099', U'\x307b', U'\x309a', U'\x3046',
+  U'\x3099', U'\x309d', U'\x3099', U'\x30ab', U'\x3099', U'\x30ad', U'\x3099', U'\x30af',
+  U'\x3099', U'\x30b1', U'\x3099', U'\x30b3', U'\x3099', U'\x30b5', U'\x3099', U'\x30b7',
+  U'\x3099', U'\x30b9', U'\x3099', U'\x30bb', U'\x3099', U'\x30bd', U'\x3099', U'\x30bf',
+  U'\x3099', U'\x30c1', U'\x3099', U'\x30c4', U'\x3099', U'\x30c6', U'\x3099', U'\x30c8',
+  U'\x3099', U'\x30cf', U'\x3099', U'\x30cf', U'\x309a', U'\x30d2', U'\x3099', U'\x30d2',
+  U'\x309a', U'\x30d5', U'\x3099', U'\x30d5', U'\x309a', U'\x30d8', U'\x3099', U'\x30d8',
+  U'\x309a', U'\x30db', U'\x3099', U'\x30db', U'\x309a', U'\x30a6', U'\x3099', U'\x30ef',
+  U'\x3099', U'\x30f0', U'\x3099', U'\x30f1', U'\x3099', U'\x30f2', U'\x3099', U'\x30fd',
+  U'\x3099', U'\x8c48', U'\x66f4', U'\x8eca', U'\x8cc8', U'\x6ed1', U'\x4e32', U'\x53e5',
+  U'\x9f9c', U'\x9f9c', U'\x5951', U'\x91d1', U'\x5587', U'\x5948', U'\x61f6', U'\x7669',
+  U'\x7f85', U'\x863f', U'\x87ba', U'\x88f8', U'\x908f', U'\x6a02', U'\x6d1b', U'\x70d9',
+  U'\x73de', U'\x843d', U'\x916a', U'\x99f1', U'\x4e82', U'\x5375', U'\x6b04', U'\x721b',
+  U'\x862d', U'\x9e1e', U'\x5d50', U'\x6feb', U'\x85cd', U'\x8964', U'\x62c9', U'\x81d8',
+  U'\x881f', U'\x5eca', U'\x6717', U'\x6d6a', U'\x72fc', U'\x90ce', U'\x4f86', U'\x51b7',
+  U'\x52de', U'\x64c4', U'\x6ad3', U'\x7210', U'\x76e7', U'\x8001', U'\x8606', U'\x865c',
+  U'\x8def', U'\x9732', U'\x9b6f', U'\x9dfa', U'\x788c', U'\x797f', U'\x7da0', U'\x83c9',
+  U'\x9304', U'\x9e7f', U'\x8ad6', U'\x58df', U'\x5f04', U'\x7c60', U'\x807e', U'\x7262',
+  U'\x78ca', U'\x8cc2', U'\x96f7', U'\x58d8', U'\x5c62', U'\x6a13', U'\x6dda', U'\x6f0f',
+  U'\x7d2f', U'\x7e37', U'\x964b', U'\x52d2', U'\x808b', U'\x51dc', U'\x51cc', U'\x7a1c',
+  U'\x7dbe', U'\x83f1', U'\x9675', U'\x8b80', U'\x62cf', U'\x6a02', U'\x8afe', U'\x4e39',
+  U'\x5be7', U'\x6012', U'\x7387', U'\x7570', U'\x5317', U'\x78fb', U'\x4fbf', U'\x5fa9',
+  U'\x4e0d', U'\x6ccc', U'\x6578', U'\x7d22', U'\x53c3', U'\x585e', U'\x7701', U'\x8449',
+  U'\x8aaa', U'\x6bba', U'\x8fb0', U'\x6c88', U'\x62fe', U'\x82e5', U'\x63a0', U'\x7565',
+  U'\x4eae', U'\x5169', U'\x51c9', U'\x6881', U'\x7ce7', U'\x826f', U'\x8ad2', U'\x91cf',
+  U'\x52f5', U'\x5442', U'\x5973', U'\x5eec', U'\x65c5', U'\x6ffe', U'\x792a', U'\x95ad',
+  U'\x9a6a', U'\x9e97', U'\x9ece', U'\x529b', U'\x66c6', U'\x6b77', U'\x8f62', U'\x5e74',
+  U'\x6190', U'\x6200', U'\x649a', U'\x6f23', U'\x7149', U'\x7489', U'\x79ca', U'\x7df4',
+  U'\x806f', U'\x8f26', U'\x84ee', U'\x9023', U'\x934a', U'\x5217', U'\x52a3', U'\x54bd',
+  U'\x70c8', U'\x88c2', U'\x8aaa', U'\x5ec9', U'\x5ff5', U'\x637b', U'\x6bae', U'\x7c3e',
+  U'\x7375', U'\x4ee4', U'\x56f9', U'\x5be7', U'\x5dba', U'\x601c', U'\x73b2', U'\x7469',
+  U'\x7f9a', U'\x8046', U'\x9234', U'\x96f6', U'\x9748', U'\x9818', U'\x4f8b', U'\x79ae',
+  U'\x91b4', U'\x96b8', U'\x60e1', U'\x4e86', U'\x50da', U'\x5bee', U'\x5c3f', U'\x6599',
+  U'\x6a02', U'\x71ce', U'\x7642', U'\x84fc', U'\x907c', U'\x9f8d', U'\x6688', U'\x962e',
+  U'\x5289', U'\x677b', U'\x67f3', U'\x6d41', U'\x6e9c', U'\x7409', U'\x7559', U'\x786b',
+  U'\x7d10', U'\x985e', U'\x516d', U'\x622e', U'\x9678', U'\x502b', U'\x5d19', U'\x6dea',
+  U'\x8f2a', U'\x5f8b', U'\x6144', U'\x6817', U'\x7387', U'\x9686', U'\x5229', U'\x540f',
+  U'\x5c65', U'\x6613', U'\x674e', U'\x68a8', U'\x6ce5', U'\x7406', U'\x75e2', U'\x7f79',
+  U'\x88cf', U'\x88e1', U'\x91cc', U'\x96e2', U'\x533f', U'\x6eba', U'\x541d', U'\x71d0',
+  U'\x7498', U'\x85fa', U'\x96a3', U'\x9c57', U'\x9e9f', U'\x6797', U'\x6dcb', U'\x81e8',
+  U'\x7acb', U'\x7b20', U'\x7c92', U'\x72c0', U'\x7099', U'\x8b58', U'\x4ec0', U'\x8336',
+  U'\x523a', U'\x5207', U'\x5ea6', U'\x62d3', U'\x7cd6', U'\x5b85', U'\x6d1e', U'\x66b4',
+  U'\x8f3b', U'\x884c', U'\x964d', U'\x898b', U'\x5ed3', U'\x5140', U'\x55c0', U'\x585a',
+  U'\x6674', U'\x51de', U'\x732a', U'\x76ca', U'\x793c', U'\x795e', U'\x7965', U'\x798f',
+  U'\x9756', U'\x7cbe', U'\x7fbd', U'\x8612', U'\x8af8', U'\x9038', U'\x90fd', U'\x98ef',
+  U'\x98fc', U'\x9928', U'\x9db4', U'\x90de', U'\x96b7', U'\x4fae', U'\x50e7', U'\x514d',
+  U'\x52c9', U'\x52e4', U'\x5351', U'\x559d', U'\x5606', U'\x5668', U'\x5840', U'\x58a8',
+  U'\x5c64', U'\x5c6e', U'\x6094', U'\x6168', U'\x618e', U'\x61f2', U'\x654f', U'\x65e2',
+  U'\x6691', U'\x6885', U'\x6d77', U'\x6e1a', U'\x6f22', U'\x716e', U'\x722b', U'\x7422',
+  U'\x7891', U'\x793e', U'\x7949', U'\x7948', U'\x7950', U'\x7956', U'\x795d', U'\x798d',
+  U'\x798e', U'\x7a40', U'\x7a81', U'\x7bc0', U'\x7df4', U'\x7e09', U'\x7e41', U'\x7f72',
+  U'\x8005', U'\x81ed', U'\x8279', U'\x8279', U'\x8457', U'\x8910', U'\x8996', U'\x8b01',
+  U'\x8b39', U'\x8cd3', U'\x8d08', U'\x8fb6', U'\x9038', U'\x96e3', U'\x97ff', U'\x983b',
+  U'\x6075', U'\x242ee', U'\x8218', U'\x4e26', U'\x51b5', U'\x5168', U'\x4f80', U'\x5145',
+  U'\x5180', U'\x52c7', U'\x52fa', U'\x559d', U'\x5555', U'\x5599', U'\x55e2', U'\x585a',
+  U'\x58b3', U'\x5944', U'\x5954', U'\x5a62', U'\x5b28', U'\x5ed2', U'\x5ed9', U'\x5f69',
+  U'\x5fad', U'\x60d8', U'\x614e', U'\x6108', U'\x618e', U'\x6160', U'\x61f2', U'\x6234',
+  U'\x63c4', U'\x641c', U'\x6452', U'\x6556', U'\x6674', U'\x6717', U'\x671b', U'\x6756',
+  U'\x6b79', U'\x6bba', U'\x6d41', U'\x6edb', U'\x6ecb', U'\x6f22', U'\x701e', U'\x716e',
+  U'\x77a7', U'\x7235', U'\x72af', U'\x732a', U'\x7471', U'\x7506', U'\x753b', U'\x761d',
+  U'\x761f', U'\x76ca', U'\x76db', U'\x76f4', U'\x774a', U'\x7740', U'\x78cc', U'\x7ab1',
+  U'\x7bc0', U'\x7c7b', U'\x7d5b', U'\x7df4', U'\x7f3e', U'\x8005', U'\x8352', U'\x83ef',
+  U'\x8779', U'\x8941', U'\x8986', U'\x8996', U'\x8abf', U'\x8af8', U'\x8acb', U'\x8b01',
+  U'\x8afe', U'\x8aed', U'\x8b39', U'\x8b8a', U'\x8d08', U'\x8f38', U'\x9072', U'\x9199',
+  U'\x9276', U'\x967c', U'\x96e3', U'\x9756', U'\x97db', U'\x97ff', U'\x980b', U'\x983b',
+  U'\x9b12', U'\x9f9c', U'\x2284a', U'\x22844', U'\x233d5', U'\x3b9d', U'\x4018', U'\x4039',
+  U'\x25249', U'\x25cd0', U'\x27ed3', U'\x9f43', U'\x9f8e', U'\x5d9', U'\x5b4', U'\x5f2',
+  U'\x5b7', U'\x5e9', U'\x5c1', U'\x5e9', U'\x5c2', U'\x5e9', U'\x5bc', U'\x5c1',
+  U'\x5e9', U'\x5bc', U'\x5c2', U'\x5d0', U'\x5b7', U'\x5d0', U'\x5b8', U'\x5d0',
+  U'\x5bc', U'\x5d1', U'\x5bc', U'\x5d2', U'\x5bc', U'\x5d3', U'\x5bc', U'\x5d4',
+  U'\x5bc', U'\x5d5', U'\x5bc', U'\x5d6', U'\x5bc', U'\x5d8', U'\x5bc', U'\x5d9',
+  U'\x5bc', U'\x5da', U'\x5bc', U'\x5db', U'\x5bc', U'\x5dc', U'\x5bc', U'\x5de',
+  U'\x5bc', U'\x5e0', U'\x5bc', U'\x5e1', U'\x5bc', U'\x5e3', U'\x5bc', U'\x5e4',
+  U'\x5bc', U'\x5e6', U'\x5bc', U'\x5e7', U'\x5bc', U'\x5e8', U'\x5bc', U'\x5e9',
+  U'\x5bc', U'\x5ea', U'\x5bc', U'\x5d5', U'\x5b9', U'\x5d1', U'\x5bf', U'\x5db',
+  U'\x5bf', U'\x5e4', U'\x5bf', U'\x11099', U'\x110ba', U'\x1109b', U'\x110ba', U'\x110a5',
+  U'\x110ba', U'\x11131', U'\x11127', U'\x11132', U'\x11127', U'\x11347', U'\x1133e', U'\x11347',
+  U'\x11357', U'\x114b9', U'\x114ba', U'\x114b9', U'\x114b0', U'\x114b9', U'\x114bd', U'\x115b8',
+  U'\x115af', U'\x115b9', U'\x115af', U'\x11935', U'\x11930', U'\x1d157', U'\x1d165', U'\x1d158',
+  U'\x1d165', U'\x1d158', U'\x1d165', U'\x1d16e', U'\x1d158', U'\x1d165', U'\x1d16f', U'\x1d158',
+  U'\x1d165', U'\x1d170', U'\x1d158', U'\x1d165', U'\x1d171', U'\x1d158', U'\x1d165', U'\x1d172',
+  U'\x1d1b9', U'\x1d165', U'\x1d1ba', U'\x1d165', U'\x1d1b9', U'\x1d165', U'\x1d16e', U'\x1d1ba',
+  U'\x1d165', U'\x1d16e', U'\x1d1b9', U'\x1d165', U'\x1d16f', U'\x1d1ba', U'\x1d165', U'\x1d16f',
+  U'\x4e3d', U'\x4e38', U'\x4e41', U'\x20122', U'\x4f60', U'\x4fae', U'\x4fbb', U'\x5002',
+  U'\x507a', U'\x5099', U'\x50e7', U'\x50cf', U'\x349e', U'\x2063a', U'\x514d', U'\x5154',
+  U'\x5164', U'\x5177', U'\x2051c', U'\x34b9', U'\x5167', U'\x518d', U'\x2054b', U'\x5197',
+  U'\x51a4', U'\x4ecc', U'\x51ac', U'\x51b5', U'\x291df', U'\x51f5', U'\x5203', U'\x34df',
+  U'\x523b', U'\x5246', U'\x5272', U'\x5277', U'\x3515', U'\x52c7', U'\x52c9', U'\x52e4',
+  U'\x52fa', U'\x5305', U'\x5306', U'\x5317', U'\x5349', U'\x5351', U'\x535a', U'\x5373',
+  U'\x537d', U'\x537f', U'\x537f', U'\x537f', U'\x20a2c', U'\x7070', U'\x53ca', U'\x53df',
+  U'\x20b63', U'\x53eb', U'\x53f1', U'\x5406', U'\x549e', U'\x5438', U'\x5448', U'\x5468',
+  U'\x54a2', U'\x54f6', U'\x5510', U'\x5553', U'\x5563', U'\x5584', U'\x5584', U'\x5599',
+  U'\x55ab', U'\x55b3', U'\x55c2', U'\x5716', U'\x5606', U'\x5717', U'\x5651', U'\x5674',
+  U'\x5207', U'\x58ee', U'\x57ce', U'\x57f4', U'\x580d', U'\x578b', U'\x5832', U'\x5831',
+  U'\x58ac', U'\x214e4', U'\x58f2', U'\x58f7', U'\x5906', U'\x591a', U'\x5922', U'\x5962',
+  U'\x216a8', U'\x216ea', U'\x59ec', U'\x5a1b', U'\x5a27', U'\x59d8', U'\x5a66', U'\x36ee',
+  U'\x36fc', U'\x5b08', U'\x5b3e', U'\x5b3e', U'\x219c8', U'\x5bc3', U'\x5bd8', U'\x5be7',
+  U'\x5bf3', U'\x21b18', U'\x5bff', U'\x5c06', U'\x5f53', U'\x5c22', U'\x3781', U'\x5c60',
+  U'\x5c6e', U'\x5cc0', U'\x5c8d', U'\x21de4', U'\x5d43', U'\x21de6', U'\x5d6e', U'\x5d6b',
+  U'\x5d7c', U'\x5de1', U'\x5de2', U'\x382f', U'\x5dfd', U'\x5e28', U'\x5e3d', U'\x5e69',
+  U'\x3862', U'\x22183', U'\x387c', U'\x5eb0', U'\x5eb3', U'\x5eb6', U'\x5eca', U'\x2a392',
+  U'\x5efe', U'\x22331', U'\x22331', U'\x8201', U'\x5f22', U'\x5f22', U'\x38c7', U'\x232b8',
+  U'\x261da', U'\x5f62', U'\x5f6b', U'\x38e3', U'\x5f9a', U'\x5fcd', U'\x5fd7', U'\x5ff9',
+  U'\x6081', U'\x393a', U'\x391c', U'\x6094', U'\x226d4', U'\x60c7', U'\x6148', U'\x614c',
+  U'\x614e', U'\x614c', U'\x617a', U'\x618e', U'\x61b2', U'\x61a4', U'\x61af', U'\x61de',
+  U'\x61f2', U'\x61f6', U'\x6210', U'\x621b', U'\x625d', U'\x62b1', U'\x62d4', U'\x6350',
+  U'\x22b0c', U'\x633d', U'\x62fc', U'\x6368', U'\x6383', U'\x63e4', U'\x22bf1', U'\x6422',
+  U'\x63c5', U'\x63a9', U'\x3a2e', U'\x6469', U'\x647e', U'\x649d', U'\x6477', U'\x3a6c',
+  U'\x654f', U'\x656c', U'\x2300a', U'\x65e3', U'\x66f8', U'\x6649', U'\x3b19', U'\x6691',
+  U'\x3b08', U'\x3ae4', U'\x5192', U'\x5195', U'\x6700', U'\x669c', U'\x80ad', U'\x43d9',
+  U'\x6717', U'\x671b', U'\x6721', U'\x675e', U'\x6753', U'\x233c3', U'\x3b49', U'\x67fa',
+  U'\x6785', U'\x6852', U'\x6885', U'\x2346d', U'\x688e', U'\x681f', U'\x6914', U'\x3b9d',
+  U'\x6942', U'\x69a3', U'\x69ea', U'\x6aa8', U'\x236a3', U'\x6adb', U'\x3c18', U'\x6b21',
+  U'\x238a7', U'\x6b54', U'\x3c4e', U'\x6b72', U'\x6b9f', U'\x6bba', U'\x6bbb', U'\x23a8d',
+  U'\x21d0b', U'\x23afa', U'\x6c4e', U'\x23cbc', U'\x6cbf', U'\x6ccd', U'\x6c67', U'\x6d16',
+  U'\x6d3e', U'\x6d77', U'\x6d41', U'\x6d69', U'\x6d78', U'\x6d85', U'\x23d1e', U'\x6d34',
+  U'\x6e2f', U'\x6e6e', U'\x3d33', U'\x6ecb', U'\x6ec7', U'\x23ed1', U'\x6df9', U'\x6f6e',
+  U'\x23f5e', U'\x23f8e', U'\x6fc6', U'\x7039', U'\x701e', U'\x701b', U'\x3d96', U'\x704a',
+  U'\x707d', U'\x7077', U'\x70ad', U'\x20525', U'\x7145', U'\x24263', U'\x719c', U'\x243ab',
+  U'\x7228', U'\x7235', U'\x7250', U'\x24608', U'\x7280', U'\x7295', U'\x24735', U'\x24814',
+  U'\x737a', U'\x738b', U'\x3eac', U'\x73a5', U'\x3eb8', U'\x3eb8', U'\x7447', U'\x745c',
+  U'\x7471', U'\x7485', U'\x74ca', U'\x3f1b', U'\x7524', U'\x24c36', U'\x753e', U'\x24c92',
+  U'\x7570', U'\x2219f', U'\x7610', U'\x24fa1', U'\x24fb8', U'\x25044', U'\x3ffc', U'\x4008',
+  U'\x76f4', U'\x250f3', U'\x250f2', U'\x25119', U'\x25133', U'\x771e', U'\x771f', U'\x771f',
+  U'\x774a', U'\x4039', U'\x778b', U'\x4046', U'\x4096', U'\x2541d', U'\x784e', U'\x788c',
+  U'\x78cc', U'\x40e3', U'\x25626', U'\x7956', U'\x2569a', U'\x256c5', U'\x798f', U'\x79eb',
+  U'\x412f', U'\x7a40', U'\x7a4a', U'\x7a4f', U'\x2597c', U'\x25aa7', U'\x25aa7', U'\x7aee',
+  U'\x4202', U'\x25bab', U'\x7bc6', U'\x7bc9', U'\x4227', U'\x25c80', U'\x7cd2', U'\x42a0',
+  U'\x7ce8', U'\x7ce3', U'\x7d00', U'\x25f86', U'\x7d63', U'\x4301', U'\x7dc7', U'\x7e02',
+  U'\x7e45', U'\x4334', U'\x26228', U'\x26247', U'\x4359', U'\x262d9', U'\x7f7a', U'\x2633e',
+  U'\x7f95', U'\x7ffa', U'\x8005', U'\x264da', U'\x26523', U'\x8060', U'\x265a8', U'\x8070',
+  U'\x2335f', U'\x43d5', U'\x80b2', U'\x8103', U'\x440b', U'\x813e', U'\x5ab5', U'\x267a7',
+  U'\x267b5', U'\x23393', U'\x2339c', U'\x8201', U'\x8204', U'\x8f9e', U'\x446b', U'\x8291',
+  U'\x828b', U'\x829d', U'\x52b3', U'\x82b1', U'\x82b3', U'\x82bd', U'\x82e6', U'\x26b3c',
+  U'\x82e5', U'\x831d', U'\x8363', U'\x83ad', U'\x8323', U'\x83bd', U'\x83e7', U'\x8457',
+  U'\x8353', U'\x83ca', U'\x83cc', U'\x83dc', U'\x26c36', U'\x26d6b', U'\x26cd5', U'\x452b',
+  U'\x84f1', U'\x84f3', U'\x8516', U'\x273ca', U'\x8564', U'\x26f2c', U'\x455d', U'\x4561',
+  U'\x26fb1', U'\x270d2', U'\x456b', U'\x8650', U'\x865c', U'\x8667', U'\x8669', U'\x86a9',
+  U'\x8688', U'\x870e', U'\x86e2', U'\x8779', U'\x8728', U'\x876b', U'\x8786', U'\x45d7',
+  U'\x87e1', U'\x8801', U'\x45f9', U'\x8860', U'\x8863', U'\x27667', U'\x88d7', U'\x88de',
+  U'\x4635', U'\x88fa', U'\x34bb', U'\x278ae', U'\x27966', U'\x46be', U'\x46c7', U'\x8aa0',
+  U'\x8aed', U'\x8b8a', U'\x8c55', U'\x27ca8', U'\x8cab', U'\x8cc1', U'\x8d1b', U'\x8d77',
+  U'\x27f2f', U'\x20804', U'\x8dcb', U'\x8dbc', U'\x8df0', U'\x208de', U'\x8ed4', U'\x8f38',
+  U'\x285d2', U'\x285ed', U'\x9094', U'\x90f1', U'\x9111', U'\x2872e', U'\x911b', U'\x9238',
+  U'\x92d7', U'\x92d8', U'\x927c', U'\x93f9', U'\x9415', U'\x28bfa', U'\x958b', U'\x4995',
+  U'\x95b7', U'\x28d77', U'\x49e6', U'\x96c3', U'\x5db2', U'\x9723', U'\x29145', U'\x2921a',
+  U'\x4a6e', U'\x4a76', U'\x97e0', U'\x2940a', U'\x4ab2', U'\x29496', U'\x980b', U'\x980b',
+  U'\x9829', U'\x295b6', U'\x98e2', U'\x4b33', U'\x9929', U'\x99a7', U'\x99c2', U'\x99fe',
+  U'\x4bce', U'\x29b30', U'\x9b12', U'\x9c40', U'\x9cfd', U'\x4cce', U'\x4ced', U'\x9d67',
+  U'\x2a0ce', U'\x4cf8', U'\x2a105', U'\x2a20e', U'\x2a291', U'\x9ebb', U'\x4d56', U'\x9ef9',
+  U'\x9efe', U'\x9f05', U'\x9f0f', U'\x9f16', U'\x9f3b', U'\x2a600',
+};
+
+/// The pairs which compose to a primary composite, other than the Hangul
+/// syllables, each packed as `(first << 21) | second`, in order
+inline constexpr auto composition_keys = std::array<std::uint64_t, 941>{
+  0x7800338, 0x7a00338, 0x7c00338, 0x8200300,
+  0x8200301, 0x8200302, 0x8200303, 0x8200304,
+  0x8200306, 0x8200307, 0x8200308, 0x8200309,
+  0x820030a, 0x820030c, 0x820030f, 0x8200311,
+  0x8200323, 0x8200325, 0x8200328, 0x8400307,
+  0x8400323, 0x8400331, 0x8600301, 0x8600302,
+  0x8600307, 0x860030c, 0x8600327, 0x8800307,
+  0x880030c, 0x8800323, 0x8800327, 0x880032d,
+  0x8800331, 0x8a00300, 0x8a00301, 0x8a00302,
+  0x8a00303, 0x8a00304, 0x8a00306, 0x8a00307,
+  0x8a00308, 0x8a00309, 0x8a0030c, 0x8a0030f,
+  0x8a00311, 0x8a00323, 0x8a00327, 0x8a00328,
+  0x8a0032d, 0x8a00330, 0x8c00307, 0x8e00301,
+  0x8e00302, 0x8e00304, 0x8e00306, 0x8e00307,
+  0x8e0030c, 0x8e00327, 0x9000302, 0x9000307,
+  0x9000308, 0x900030c, 0x9000323, 0x9000327,
+  0x900032e, 0x9200300, 0x9200301, 0x9200302,
+  0x9200303, 0x9200304, 0x9200306, 0x9200307,
+  0x9200308, 0x9200309, 0x920030c, 0x920030f,
+  0x9200311, 0x9200323, 0x9200328, 0x9200330,
+  0x9400302, 0x9600301, 0x960030c, 0x9600323,
+  0x9600327, 0x9600331, 0x9800301, 0x980030c,
+  0x9800323, 0x9800327, 0x980032d, 0x9800331,
+  0x9a00301, 0x9a00307, 0x9a00323, 0x9c00300,
+  0x9c00301, 0x9c00303, 0x9c00307, 0x9c0030c,
+  0x9c00323, 0x9c00327, 0x9c0032d, 0x9c00331,
+  0x9e00300, 0x9e00301, 0x9e00302, 0x9e00303,
+  0x9e00304, 0x9e00306, 0x9e00307, 0x9e00308,
+  0x9e00309, 0x9e0030b, 0x9e0030c, 0x9e0030f,
+  0x9e00311, 0x9e0031b, 0x9e00323, 0x9e00328,
+  0xa000301, 0xa000307, 0xa400301, 0xa400307,
+  0xa40030c, 0xa40030f, 0xa400311, 0xa400323,
+  0xa400327, 0xa400331, 0xa600301, 0xa600302,
+  0xa600307, 0xa60030c, 0xa600323, 0xa600326,
+  0xa600327, 0xa800307, 0xa80030c, 0xa800323,
+  0xa800326, 0xa800327, 0xa80032d, 0xa800331,
+  0xaa00300, 0xaa00301, 0xaa00302, 0xaa00303,
+  0xaa00304, 0xaa00306, 0xaa00308, 0xaa00309,
+  0xaa0030a, 0xaa0030b, 0xaa0030c, 0xaa0030f,
+  0xaa00311, 0xaa0031b, 0xaa00323, 0xaa00324,
+  0xaa00328, 0xaa0032d, 0xaa00330, 0xac00303,
+  0xac00323, 0xae00300, 0xae00301, 0xae00302,
+  0xae00307, 0xae00308, 0xae00323, 0xb000307,
+  0xb000308, 0xb200300, 0xb200301, 0xb200302,
+  0xb200303, 0xb200304, 0xb200307, 0xb200308,
+  0xb200309, 0xb200323, 0xb400301, 0xb400302,
+  0xb400307, 0xb40030c, 0xb400323, 0xb400331,
+  0xc200300, 0xc200301, 0xc200302, 0xc200303,
+  0xc200304, 0xc200306, 0xc200307, 0xc200308,
+  0xc200309, 0xc20030a, 0xc20030c, 0xc20030f,
+  0xc200311, 0xc200323, 0xc200325, 0xc200328,
+  0xc400307, 0xc400323, 0xc400331, 0xc600301,
+  0xc600302, 0xc600307, 0xc60030c, 0xc600327,
+  0xc800307, 0xc80030c, 0xc800323, 0xc800327,
+  0xc80032d, 0xc800331, 0xca00300, 0xca00301,
+  0xca00302, 0xca00303, 0xca00304, 0xca00306,
+  0xca00307, 0xca00308, 0xca00309, 0xca0030c,
+  0xca0030f, 0xca00311, 0xca00323, 0xca00327,
+  0xca00328, 0xca0032d, 0xca00330, 0xcc00307,
+  0xce00301, 0xce00302, 0xce00304, 0xce00306,
+  0xce00307, 0xce0030c, 0xce00327, 0xd000302,
+  0xd000307, 0xd000308, 0xd00030c, 0xd000323,
+  0xd000327, 0xd00032e, 0xd000331, 0xd200300,
+  0xd200301, 0xd200302, 0xd200303, 0xd200304,
+  0xd200306, 0xd200308, 0xd200309, 0xd20030c,
+  0xd20030f, 0xd200311, 0xd200323, 0xd200328,
+  0xd200330, 0xd400302, 0xd40030c, 0xd600301,
+  0xd60030c, 0xd600323, 0xd600327, 0xd600331,
+  0xd800301, 0xd80030c, 0xd800323, 0xd800327,
+  0xd80032d, 0xd800331, 0xda00301, 0xda00307,
+  0xda00323, 0xdc00300, 0xdc00301, 0xdc00303,
+  0xdc00307, 0xdc0030c, 0xdc00323, 0xdc00327,
+  0xdc0032d, 0xdc00331, 0xde00300, 0xde00301,
+  0xde00302, 0xde00303, 0xde00304, 0xde00306,
+  0xde00307, 0xde00308, 0xde00309, 0xde0030b,
+  0xde0030c, 0xde0030f, 0xde00311, 0xde0031b,
+  0xde00323, 0xde00328, 0xe000301, 0xe000307,
+  0xe400301, 0xe400307, 0xe40030c, 0xe40030f,
+  0xe400311, 0xe400323, 0xe400327, 0xe400331,
+  0xe600301, 0xe600302, 0xe600307, 0xe60030c,
+  0xe600323, 0xe600326, 0xe600327, 0xe800307,
+  0xe800308, 0xe80030c, 0xe800323, 0xe800326,
+  0xe800327, 0xe80032d, 0xe800331, 0xea00300,
+  0xea00301, 0xea00302, 0xea00303, 0xea00304,
+  0xea00306, 0xea00308, 0xea00309, 0xea0030a,
+  0xea0030b, 0xea0030c, 0xea0030f, 0xea00311,
+  0xea0031b, 0xea00323, 0xea00324, 0xea00328,
+  0xea0032d, 0xea00330, 0xec00303, 0xec00323,
+  0xee00300, 0xee00301, 0xee00302, 0xee00307,
+  0xee00308, 0xee0030a, 0xee00323, 0xf000307,
+  0xf000308, 0xf200300, 0xf200301, 0xf200302,
+  0xf200303, 0xf200304, 0xf200307, 0xf200308,
+  0xf200309, 0xf20030a, 0xf200323, 0xf400301,
+  0xf400302, 0xf400307, 0xf40030c, 0xf400323,
+  0xf400331, 0x15000300, 0x15000301, 0x15000342,
+  0x18400300, 0x18400301, 0x18400303, 0x18400309,
+  0x18800304, 0x18a00301, 0x18c00301, 0x18c00304,
+  0x18e00301, 0x19400300, 0x19400301, 0x19400303,
+  0x19400309, 0x19e00301, 0x1a800300, 0x1a800301,
+  0x1a800303, 0x1a800309, 0x1aa00301, 0x1aa00304,
+  0x1aa00308, 0x1ac00304, 0x1b000301, 0x1b800300,
+  0x1b800301, 0x1b800304, 0x1b80030c, 0x1c400300,
+  0x1c400301, 0x1c400303, 0x1c400309, 0x1c800304,
+  0x1ca00301, 0x1cc00301, 0x1cc00304, 0x1ce00301,
+  0x1d400300, 0x1d400301, 0x1d400303, 0x1d400309,
+  0x1de00301, 0x1e800300, 0x1e800301, 0x1e800303,
+  0x1e800309, 0x1ea00301, 0x1ea00304, 0x1ea00308,
+  0x1ec00304, 0x1f000301, 0x1f800300, 0x1f800301,
+  0x1f800304, 0x1f80030c, 0x20400300, 0x20400301,
+  0x20400303, 0x20400309, 0x20600300, 0x20600301,
+  0x20600303, 0x20600309, 0x22400300, 0x22400301,
+  0x22600300, 0x22600301, 0x29800300, 0x29800301,
+  0x29a00300, 0x29a00301, 0x2b400307, 0x2b600307,
+  0x2c000307, 0x2c200307, 0x2d000301, 0x2d200301,
+  0x2d400308, 0x2d600308, 0x2fe00307, 0x34000300,
+  0x34000301, 0x34000303, 0x34000309, 0x34000323,
+  0x34200300, 0x34200301, 0x34200303, 0x34200309,
+  0x34200323, 0x35e00300, 0x35e00301, 0x35e00303,
+  0x35e00309, 0x35e00323, 0x36000300, 0x36000301,
+  0x36000303, 0x36000309, 0x36000323, 0x36e0030c,
+  0x3d400304, 0x3d600304, 0x44c00304, 0x44e00304,
+  0x45000306, 0x45200306, 0x45c00304, 0x45e00304,
+  0x5240030c, 0x72200300, 0x72200301, 0x72200304,
+  0x72200306, 0x72200313, 0x72200314, 0x72200345,
+  0x72a00300, 0x72a00301, 0x72a00313, 0x72a00314,
+  0x72e00300, 0x72e00301, 0x72e00313, 0x72e00314,
+  0x72e00345, 0x73200300, 0x73200301, 0x73200304,
+  0x73200306, 0x73200308, 0x73200313, 0x73200314,
+  0x73e00300, 0x73e00301, 0x73e00313, 0x73e00314,
+  0x74200314, 0x74a00300, 0x74a00301, 0x74a00304,
+  0x74a00306, 0x74a00308, 0x74a00314, 0x75200300,
+  0x75200301, 0x75200313, 0x75200314, 0x75200345,
+  0x75800345, 0x75c00345, 0x76200300, 0x76200301,
+  0x76200304, 0x76200306, 0x76200313, 0x76200314,
+  0x76200342, 0x76200345, 0x76a00300, 0x76a00301,
+  0x76a00313, 0x76a00314, 0x76e00300, 0x76e00301,
+  0x76e00313, 0x76e00314, 0x76e00342, 0x76e00345,
+  0x77200300, 0x77200301, 0x77200304, 0x77200306,
+  0x77200308, 0x77200313, 0x77200314, 0x77200342,
+  0x77e00300, 0x77e00301, 0x77e00313, 0x77e00314,
+  0x78200313, 0x78200314, 0x78a00300, 0x78a00301,
+  0x78a00304, 0x78a00306, 0x78a00308, 0x78a00313,
+  0x78a00314, 0x78a00342, 0x79200300, 0x79200301,
+  0x79200313, 0x79200314, 0x79200342, 0x79200345,
+  0x79400300, 0x79400301, 0x79400342, 0x79600300,
+  0x79600301, 0x79600342, 0x79c00345, 0x7a400301,
+  0x7a400308, 0x80c00308, 0x82000306, 0x82000308,
+  0x82600301, 0x82a00300, 0x82a00306, 0x82a00308,
+  0x82c00306, 0x82c00308, 0x82e00308, 0x83000300,
+  0x83000304, 0x83000306, 0x83000308, 0x83400301,
+  0x83c00308, 0x84600304, 0x84600306, 0x84600308,
+  0x8460030b, 0x84e00308, 0x85600308, 0x85a00308,
+  0x86000306, 0x86000308, 0x86600301, 0x86a00300,
+  0x86a00306, 0x86a00308, 0x86c00306, 0x86c00308,
+  0x86e00308, 0x87000300, 0x87000304, 0x87000306,
+  0x87000308, 0x87400301, 0x87c00308, 0x88600304,
+  0x88600306, 0x88600308, 0x8860030b, 0x88e00308,
+  0x89600308, 0x89a00308, 0x8ac00308, 0x8e80030f,
+  0x8ea0030f, 0x9b000308, 0x9b200308, 0x9d000308,
+  0x9d200308, 0xc4e00653, 0xc4e00654, 0xc4e00655,
+  0xc9000654, 0xc9400654, 0xd8200654, 0xda400654,
+  0xdaa00654, 0x12500093c, 0x12600093c, 0x12660093c,
+  0x138e009be, 0x138e009d7, 0x168e00b3e, 0x168e00b56,
+  0x168e00b57, 0x172400bd7, 0x178c00bbe, 0x178c00bd7,
+  0x178e00bbe, 0x188c00c56, 0x197e00cd5, 0x198c00cc2,
+  0x198c00cd5, 0x198c00cd6, 0x199400cd5, 0x1a8c00d3e,
+  0x1a8c00d57, 0x1a8e00d3e, 0x1bb200dca, 0x1bb200dcf,
+  0x1bb200ddf, 0x1bb800dca, 0x204a0102e, 0x360a01b35,
+  0x360e01b35, 0x361201b35, 0x361601b35, 0x361a01b35,
+  0x362201b35, 0x367401b35, 0x367801b35, 0x367c01b35,
+  0x367e01b35, 0x368401b35, 0x3c6c00304, 0x3c6e00304,
+  0x3cb400304, 0x3cb600304, 0x3cc400307, 0x3cc600307,
+  0x3d4000302, 0x3d4000306, 0x3d4200302, 0x3d4200306,
+  0x3d7000302, 0x3d7200302, 0x3d9800302, 0x3d9a00302,
+  0x3e0000300, 0x3e0000301, 0x3e0000342, 0x3e0000345,
+  0x3e0200300, 0x3e0200301, 0x3e0200342, 0x3e0200345,
+  0x3e0400345, 0x3e0600345, 0x3e0800345, 0x3e0a00345,
+  0x3e0c00345, 0x3e0e00345, 0x3e1000300, 0x3e1000301,
+  0x3e1000342, 0x3e1000345, 0x3e1200300, 0x3e1200301,
+  0x3e1200342, 0x3e1200345, 0x3e1400345, 0x3e1600345,
+  0x3e1800345, 0x3e1a00345, 0x3e1c00345, 0x3e1e00345,
+  0x3e2000300, 0x3e2000301, 0x3e2200300, 0x3e2200301,
+  0x3e3000300, 0x3e3000301, 0x3e3200300, 0x3e3200301,
+  0x3e4000300, 0x3e4000301, 0x3e4000342, 0x3e4000345,
+  0x3e4200300, 0x3e4200301, 0x3e4200342, 0x3e4200345,
+  0x3e4400345, 0x3e4600345, 0x3e4800345, 0x3e4a00345,
+  0x3e4c00345, 0x3e4e00345, 0x3e5000300, 0x3e5000301,
+  0x3e5000342, 0x3e5000345, 0x3e5200300, 0x3e5200301,
+  0x3e5200342, 0x3e5200345, 0x3e5400345, 0x3e5600345,
+  0x3e5800345, 0x3e5a00345, 0x3e5c00345, 0x3e5e00345,
+  0x3e6000300, 0x3e6000301, 0x3e6000342, 0x3e6200300,
+  0x3e6200301, 0x3e6200342, 0x3e7000300, 0x3e7000301,
+  0x3e7000342, 0x3e7200300, 0x3e7200301, 0x3e7200342,
+  0x3e8000300, 0x3e8000301, 0x3e8200300, 0x3e8200301,
+  0x3e9000300, 0x3e9000301, 0x3e9200300, 0x3e9200301,
+  0x3ea000300, 0x3ea000301, 0x3ea000342, 0x3ea200300,
+  0x3ea200301, 0x3ea200342, 0x3eb200300, 0x3eb200301,
+  0x3eb200342, 0x3ec000300, 0x3ec000301, 0x3ec000342,
+  0x3ec000345, 0x3ec200300, 0x3ec200301, 0x3ec200342,
+  0x3ec200345, 0x3ec400345, 0x3ec600345, 0x3ec800345,
+  0x3eca00345, 0x3ecc00345, 0x3ece00345, 0x3ed000300,
+  0x3ed000301, 0x3ed000342, 0x3ed000345, 0x3ed200300,
+  0x3ed200301, 0x3ed200342, 0x3ed200345, 0x3ed400345,
+  0x3ed600345, 0x3ed800345, 0x3eda00345, 0x3edc00345,
+  0x3ede00345, 0x3ee000345, 0x3ee800345, 0x3ef800345,
+  0x3f6c00345, 0x3f7e00300, 0x3f7e00301, 0x3f7e00342,
+  0x3f8c00345, 0x3fec00345, 0x3ffc00300, 0x3ffc00301,
+  0x3ffc00342, 0x432000338, 0x432400338, 0x432800338,
+  0x43a000338, 0x43a400338, 0x43a800338, 0x440600338,
+  0x441000338, 0x441600338, 0x444600338, 0x444a00338,
+  0x447800338, 0x448600338, 0x448a00338, 0x449000338,
+  0x449a00338, 0x44c200338, 0x44c800338, 0x44ca00338,
+  0x44e400338, 0x44e600338, 0x44ec00338, 0x44ee00338,
+  0x44f400338, 0x44f600338, 0x44f800338, 0x44fa00338,
+  0x450400338, 0x450600338, 0x450c00338, 0x450e00338,
+  0x452200338, 0x452400338, 0x454400338, 0x455000338,
+  0x455200338, 0x455600338, 0x456400338, 0x456600338,
+  0x456800338, 0x456a00338, 0x608c03099, 0x609603099,
+  0x609a03099, 0x609e03099, 0x60a203099, 0x60a603099,
+  0x60aa03099, 0x60ae03099, 0x60b203099, 0x60b603099,
+  0x60ba03099, 0x60be03099, 0x60c203099, 0x60c803099,
+  0x60cc03099, 0x60d003099, 0x60de03099, 0x60de0309a,
+  0x60e403099, 0x60e40309a, 0x60ea03099, 0x60ea0309a,
+  0x60f003099, 0x60f00309a, 0x60f603099, 0x60f60309a,
+  0x613a03099, 0x614c03099, 0x615603099, 0x615a03099,
+  0x615e03099, 0x616203099, 0x616603099, 0x616a03099,
+  0x616e03099, 0x617203099, 0x617603099, 0x617a03099,
+  0x617e03099, 0x618203099, 0x618803099, 0x618c03099,
+  0x619003099, 0x619e03099, 0x619e0309a, 0x61a403099,
+  0x61a40309a, 0x61aa03099, 0x61aa0309a, 0x61b003099,
+  0x61b00309a, 0x61b603099, 0x61b60309a, 0x61de03099,
+  0x61e003099, 0x61e203099, 0x61e403099, 0x61fa03099,
+  0x22132110ba, 0x22136110ba, 0x2214a110ba, 0x2226211127,
+  0x2226411127, 0x2268e1133e, 0x2268e11357, 0x22972114b0,
+  0x22972114ba, 0x22972114bd, 0x22b70115af, 0x22b72115af,
+  0x2326a11930,
+};
+
+/// The primary composite of each pair of `composition_keys`
+inline constexpr auto composites = std::array<char32_t, 941>{
+  U'\x226e', U'\x2260', U'\x226f', U'\xc0', U'\xc1', U'\xc2', U'\xc3', U'\x100',
+  U'\x102', U'\x226', U'\xc4', U'\x1ea2', U'\xc5', U'\x1cd', U'\x200', U'\x202',
+  U'\x1ea0', U'\x1e00', U'\x104', U'\x1e02', U'\x1e04', U'\x1e06', U'\x106', U'\x108',
+  U'\x10a', U'\x10c', U'\xc7', U'\x1e0a', U'\x10e', U'\x1e0c', U'\x1e10', U'\x1e12',
+  U'\x1e0e', U'\xc8', U'\xc9', U'\xca', U'\x1ebc', U'\x112', U'\x114', U'\x116',
+  U'\xcb', U'\x1eba', U'\x11a', U'\x204', U'\x206', U'\x1eb8', U'\x228', U'\x118',
+  U'\x1e18', U'\x1e1a', U'\x1e1e', U'\x1f4', U'\x11c', U'\x1e20', U'\x11e', U'\x120',
+  U'\x1e6', U'\x122', U'\x124', U'\x1e22', U'\x1e26', U'\x21e', U'\x1e24', U'\x1e28',
+  U'\x1e2a', U'\xcc', U'\xcd', U'\xce', U'\x128', U'\x12a', U'\x12c', U'\x130',
+  U'\xcf', U'\x1ec8', U'\x1cf', U'\x208', U'\x20a', U'\x1eca', U'\x12e', U'\x1e2c',
+  U'\x134', U'\x1e30', U'\x1e8', U'\x1e32', U'\x136', U'\x1e34', U'\x139', U'\x13d',
+  U'\x1e36', U'\x13b', U'\x1e3c', U'\x1e3a', U'\x1e3e', U'\x1e40', U'\x1e42', U'\x1f8',
+  U'\x143', U'\xd1', U'\x1e44', U'\x147', U'\x1e46', U'\x145', U'\x1e4a', U'\x1e48',
+  U'\xd2', U'\xd3', U'\xd4', U'\xd5', U'\x14c', U'\x14e', U'\x22e', U'\xd6',
+  U'\x1ece', U'\x150', U'\x1d1', U'\x20c', U'\x20e', U'\x1a0', U'\x1ecc', U'\x1ea',
+  U'\x1e54', U'\x1e56', U'\x154', U'\x1e58', U'\x158', U'\x210', U'\x212', U'\x1e5a',
+  U'\x156', U'\x1e5e', U'\x15a', U'\x15c', U'\x1e60', U'\x160', U'\x1e62', U'\x218',
+  U'\x15e', U'\x1e6a', U'\x164', U'\x1e6c', U'\x21a', U'\x162', U'\x1e70', U'\x1e6e',
+  U'\xd9', U'\xda', U'\xdb', U'\x168', U'\x16a', U'\x16c', U'\xdc', U'\x1ee6',
+  U'\x16e', U'\x170', U'\x1d3', U'\x214', U'\x216', U'\x1af', U'\x1ee4', U'\x1e72',
+  U'\x172', U'\x1e76', U'\x1e74', U'\x1e7c', U'\x1e7e', U'\x1e80', U'\x1e82', U'\x174',
+  U'\x1e86', U'\x1e84', U'\x1e88', U'\x1e8a', U'\x1e8c', U'\x1ef2', U'\xdd', U'\x176',
+  U'\x1ef8', U'\x232', U'\x1e8e', U'\x178', U'\x1ef6', U'\x1ef4', U'\x179', U'\x1e90',
+  U'\x17b', U'\x17d', U'\x1e92', U'\x1e94', U'\xe0', U'\xe1', U'\xe2', U'\xe3',
+  U'\x101', U'\x103', U'\x227', U'\xe4', U'\x1ea3', U'\xe5', U'\x1ce', U'\x201',
+  U'\x203', U'\x1ea1', U'\x1e01', U'\x105', U'\x1e03', U'\x1e05', U'\x1e07', U'\x107',
+  U'\x109', U'\x10b', U'\x10d', U'\xe7', U'\x1e0b', U'\x10f', U'\x1e0d', U'\x1e11',
+  U'\x1e13', U'\x1e0f', U'\xe8', U'\xe9', U'\xea', U'\x1ebd', U'\x113', U'\x115',
+  U'\x117', U'\xeb', U'\x1ebb', U'\x11b', U'\x205', U'\x207', U'\x1eb9', U'\x229',
+  U'\x119', U'\x1e19', U'\x1e1b', U'\x1e1f', U'\x1f5', U'\x11d', U'\x1e21', U'\x11f',
+  U'\x121', U'\x1e7', U'\x123', U'\x125', U'\x1e23', U'\x1e27', U'\x21f', U'\x1e25',
+  U'\x1e29', U'\x1e2b', U'\x1e96', U'\xec', U'\xed', U'\xee', U'\x129', U'\x12b',
+  U'\x12d', U'\xef', U'\x1ec9', U'\x1d0', U'\x209', U'\x20b', U'\x1ecb', U'\x12f',
+  U'\x1e2d', U'\x135', U'\x1f0', U'\x1e31', U'\x1e9', U'\x1e33', U'\x137', U'\x1e35',
+  U'\x13a', U'\x13e', U'\x1e37', U'\x13c', U'\x1e3d', U'\x1e3b', U'\x1e3f', U'\x1e41',
+  U'\x1e43', U'\x1f9', U'\x144', U'\xf1', U'\x1e45', U'\x148', U'\x1e47', U'\x146',
+  U'\x1e4b', U'\x1e49', U'\xf2', U'\xf3', U'\xf4', U'\xf5', U'\x14d', U'\x14f',
+  U'\x22f', U'\xf6', U'\x1ecf', U'\x151', U'\x1d2', U'\x20d', U'\x20f', U'\x1a1',
+  U'\x1ecd', U'\x1eb', U'\x1e55', U'\x1e57', U'\x155', U'\x1e59', U'\x159', U'\x211',
+  U'\x213', U'\x1e5b', U'\x157', U'\x1e5f', U'\x15b', U'\x15d', U'\x1e61', U'\x161',
+  U'\x1e63', U'\x219', U'\x15f', U'\x1e6b', U'\x1e97', U'\x165', U'\x1e6d', U'\x21b',
+  U'\x163', U'\x1e71', U'\x1e6f', U'\xf9', U'\xfa', U'\xfb', U'\x169', U'\x16b',
+  U'\x16d', U'\xfc', U'\x1ee7', U'\x16f', U'\x171', U'\x1d4', U'\x215', U'\x217',
+  U'\x1b0', U'\x1ee5', U'\x1e73', U'\x173', U'\x1e77', U'\x1e75', U'\x1e7d', U'\x1e7f',
+  U'\x1e81', U'\x1e83', U'\x175', U'\x1e87', U'\x1e85', U'\x1e98', U'\x1e89', U'\x1e8b',
+  U'\x1e8d', U'\x1ef3', U'\xfd', U'\x177', U'\x1ef9', U'\x233', U'\x1e8f', U'\xff',
+  U'\x1ef7', U'\x1e99', U'\x1ef5', U'\x17a', U'\x1e91', U'\x17c', U'\x17e', U'\x1e93',
+  U'\x1e95', U'\x1fed', U'\x385', U'\x1fc1', U'\x1ea6', U'\x1ea4', U'\x1eaa', U'\x1ea8',
+  U'\x1de', U'\x1fa', U'\x1fc', U'\x1e2', U'\x1e08', U'\x1ec0', U'\x1ebe', U'\x1ec4',
+  U'\x1ec2', U'\x1e2e', U'\x1ed2', U'\x1ed0', U'\x1ed6', U'\x1ed4', U'\x1e4c', U'\x22c',
+  U'\x1e4e', U'\x22a', U'\x1fe', U'\x1db', U'\x1d7', U'\x1d5', U'\x1d9', U'\x1ea7',
+  U'\x1ea5', U'\x1eab', U'\x1ea9', U'\x1df', U'\x1fb', U'\x1fd', U'\x1e3', U'\x1e09',
+  U'\x1ec1', U'\x1ebf', U'\x1ec5', U'\x1ec3', U'\x1e2f', U'\x1ed3', U'\x1ed1', U'\x1ed7',
+  U'\x1ed5', U'\x1e4d', U'\x22d', U'\x1e4f', U'\x22b', U'\x1ff', U'\x1dc', U'\x1d8',
+  U'\x1d6', U'\x1da', U'\x1eb0', U'\x1eae', U'\x1eb4', U'\x1eb2', U'\x1eb1', U'\x1eaf',
+  U'\x1eb5', U'\x1eb3', U'\x1e14', U'\x1e16', U'\x1e15', U'\x1e17', U'\x1e50', U'\x1e52',
+  U'\x1e51', U'\x1e53', U'\x1e64', U'\x1e65', U'\x1e66', U'\x1e67', U'\x1e78', U'\x1e79',
+  U'\x1e7a', U'\x1e7b', U'\x1e9b', U'\x1edc', U'\x1eda', U'\x1ee0', U'\x1ede', U'\x1ee2',
+  U'\x1edd', U'\x1edb', U'\x1ee1', U'\x1edf', U'\x1ee3', U'\x1eea', U'\x1ee8', U'\x1eee',
+  U'\x1eec', U'\x1ef0', U'\x1eeb', U'\x1ee9', U'\x1eef', U'\x1eed', U'\x1ef1', U'\x1ee',
+  U'\x1ec', U'\x1ed', U'\x1e0', U'\x1e1', U'\x1e1c', U'\x1e1d', U'\x230', U'\x231',
+  U'\x1ef', U'\x1fba', U'\x386', U'\x1fb9', U'\x1fb8', U'\x1f08', U'\x1f09', U'\x1fbc',
+  U'\x1fc8', U'\x388', U'\x1f18', U'\x1f19', U'\x1fca', U'\x389', U'\x1f28', U'\x1f29',
+  U'\x1fcc', U'\x1fda', U'\x38a', U'\x1fd9', U'\x1fd8', U'\x3aa', U'\x1f38', U'\x1f39',
+  U'\x1ff8', U'\x38c', U'\x1f48', U'\x1f49', U'\x1fec', U'\x1fea', U'\x38e', U'\x1fe9',
+  U'\x1fe8', U'\x3ab', U'\x1f59', U'\x1ffa', U'\x38f', U'\x1f68', U'\x1f69', U'\x1ffc',
+  U'\x1fb4', U'\x1fc4', U'\x1f70', U'\x3ac', U'\x1fb1', U'\x1fb0', U'\x1f00', U'\x1f01',
+  U'\x1fb6', U'\x1fb3', U'\x1f72', U'\x3ad', U'\x1f10', U'\x1f11', U'\x1f74', U'\x3ae',
+  U'\x1f20', U'\x1f21', U'\x1fc6', U'\x1fc3', U'\x1f76', U'\x3af', U'\x1fd1', U'\x1fd0',
+  U'\x3ca', U'\x1f30', U'\x1f31', U'\x1fd6', U'\x1f78', U'\x3cc', U'\x1f40', U'\x1f41',
+  U'\x1fe4', U'\x1fe5', U'\x1f7a', U'\x3cd', U'\x1fe1', U'\x1fe0', U'\x3cb', U'\x1f50',
+  U'\x1f51', U'\x1fe6', U'\x1f7c', U'\x3ce', U'\x1f60', U'\x1f61', U'\x1ff6', U'\x1ff3',
+  U'\x1fd2', U'\x390', U'\x1fd7', U'\x1fe2', U'\x3b0', U'\x1fe7', U'\x1ff4', U'\x3d3',
+  U'\x3d4', U'\x407', U'\x4d0', U'\x4d2', U'\x403', U'\x400', U'\x4d6', U'\x401',
+  U'\x4c1', U'\x4dc', U'\x4de', U'\x40d', U'\x4e2', U'\x419', U'\x4e4', U'\x40c',
+  U'\x4e6', U'\x4ee', U'\x40e', U'\x4f0', U'\x4f2', U'\x4f4', U'\x4f8', U'\x4ec',
+  U'\x4d1', U'\x4d3', U'\x453', U'\x450', U'\x4d7', U'\x451', U'\x4c2', U'\x4dd',
+  U'\x4df', U'\x45d', U'\x4e3', U'\x439', U'\x4e5', U'\x45c', U'\x4e7', U'\x4ef',
+  U'\x45e', U'\x4f1', U'\x4f3', U'\x4f5', U'\x4f9', U'\x4ed', U'\x457', U'\x476',
+  U'\x477', U'\x4da', U'\x4db', U'\x4ea', U'\x4eb', U'\x622', U'\x623', U'\x625',
+  U'\x624', U'\x626', U'\x6c2', U'\x6d3', U'\x6c0', U'\x929', U'\x931', U'\x934',
+  U'\x9cb', U'\x9cc', U'\xb4b', U'\xb48', U'\xb4c', U'\xb94', U'\xbca', U'\xbcc',
+  U'\xbcb', U'\xc48', U'\xcc0', U'\xcca', U'\xcc7', U'\xcc8', U'\xccb', U'\xd4a',
+  U'\xd4c', U'\xd4b', U'\xdda', U'\xddc', U'\xdde', U'\xddd', U'\x1026', U'\x1b06',
+  U'\x1b08', U'\x1b0a', U'\x1b0c', U'\x1b0e', U'\x1b12', U'\x1b3b', U'\x1b3d', U'\x1b40',
+  U'\x1b41', U'\x1b43', U'\x1e38', U'\x1e39', U'\x1e5c', U'\x1e5d', U'\x1e68', U'\x1e69',
+  U'\x1eac', U'\x1eb6', U'\x1ead', U'\x1eb7', U'\x1ec6', U'\x1ec7', U'\x1ed8', U'\x1ed9',
+  U'\x1f02', U'\x1f04', U'\x1f06', U'\x1f80', U'\x1f03', U'\x1f05', U'\x1f07', U'\x1f81',
+  U'\x1f82', U'\x1f83', U'\x1f84', U'\x1f85', U'\x1f86', U'\x1f87', U'\x1f0a', U'\x1f0c',
+  U'\x1f0e', U'\x1f88', U'\x1f0b', U'\x1f0d', U'\x1f0f', U'\x1f89', U'\x1f8a', U'\x1f8b',
+  U'\x1f8c', U'\x1f8d', U'\x1f8e', U'\x1f8f', U'\x1f12', U'\x1f14', U'\x1f13', U'\x1f15',
+  U'\x1f1a', U'\x1f1c', U'\x1f1b', U'\x1f1d', U'\x1f22', U'\x1f24', U'\x1f26', U'\x1f90',
+  U'\x1f23', U'\x1f25', U'\x1f27', U'\x1f91', U'\x1f92', U'\x1f93', U'\x1f94', U'\x1f95',
+  U'\x1f96', U'\x1f97', U'\x1f2a', U'\x1f2c', U'\x1f2e', U'\x1f98', U'\x1f2b', U'\x1f2d',
+  U'\x1f2f', U'\x1f99', U'\x1f9a', U'\x1f9b', U'\x1f9c', U'\x1f9d', U'\x1f9e', U'\x1f9f',
+  U'\x1f32', U'\x1f34', U'\x1f36', U'\x1f33', U'\x1f35', U'\x1f37', U'\x1f3a', U'\x1f3c',
+  U'\x1f3e', U'\x1f3b', U'\x1f3d', U'\x1f3f', U'\x1f42', U'\x1f44', U'\x1f43', U'\x1f45',
+  U'\x1f4a', U'\x1f4c', U'\x1f4b', U'\x1f4d', U'\x1f52', U'\x1f54', U'\x1f56', U'\x1f53',
+  U'\x1f55', U'\x1f57', U'\x1f5b', U'\x1f5d', U'\x1f5f', U'\x1f62', U'\x1f64', U'\x1f66',
+  U'\x1fa0', U'\x1f63', U'\x1f65', U'\x1f67', U'\x1fa1', U'\x1fa2', U'\x1fa3', U'\x1fa4',
+  U'\x1fa5', U'\x1fa6', U'\x1fa7', U'\x1f6a', U'\x1f6c', U'\x1f6e', U'\x1fa8', U'\x1f6b',
+  U'\x1f6d', U'\x1f6f', U'\x1fa9', U'\x1faa', U'\x1fab', U'\x1fac', U'\x1fad', U'\x1fae',
+  U'\x1faf', U'\x1fb2', U'\x1fc2', U'\x1ff2', U'\x1fb7', U'\x1fcd', U'\x1fce', U'\x1fcf',
+  U'\x1fc7', U'\x1ff7', U'\x1fdd', U'\x1fde', U'\x1fdf', U'\x219a', U'\x219b', U'\x21ae',
+  U'\x21cd', U'\x21cf', U'\x21ce', U'\x2204', U'\x2209', U'\x220c', U'\x2224', U'\x2226',
+  U'\x2241', U'\x2244', U'\x2247', U'\x2249', U'\x226d', U'\x2262', U'\x2270', U'\x2271',
+  U'\x2274', U'\x2275', U'\x2278', U'\x2279', U'\x2280', U'\x2281', U'\x22e0', U'\x22e1',
+  U'\x2284', U'\x2285', U'\x2288', U'\x2289', U'\x22e2', U'\x22e3', U'\x22ac', U'\x22ad',
+  U'\x22ae', U'\x22af', U'\x22ea', U'\x22eb', U'\x22ec', U'\x22ed', U'\x3094', U'\x304c',
+  U'\x304e', U'\x3050', U'\x3052', U'\x3054', U'\x3056', U'\x3058', U'\x305a', U'\x305c',
+  U'\x305e', U'\x3060', U'\x3062', U'\x3065', U'\x3067', U'\x3069', U'\x3070', U'\x3071',
+  U'\x3073', U'\x3074', U'\x3076', U'\x3077', U'\x3079', U'\x307a', U'\x307c', U'\x307d',
+  U'\x309e', U'\x30f4', U'\x30ac', U'\x30ae', U'\x30b0', U'\x30b2', U'\x30b4', U'\x30b6',
+  U'\x30b8', U'\x30ba', U'\x30bc', U'\x30be', U'\x30c0', U'\x30c2', U'\x30c5', U'\x30c7',
+  U'\x30c9', U'\x30d0', U'\x30d1', U'\x30d3', U'\x30d4', U'\x30d6', U'\x30d7', U'\x30d9',
+  U'\x30da', U'\x30dc', U'\x30dd', U'\x30f7', U'\x30f8', U'\x30f9', U'\x30fa', U'\x30fe',
+  U'\x1109a', U'\x1109c', U'\x110ab', U'\x1112e', U'\x1112f', U'\x1134b', U'\x1134c', U'\x114bc',
+  U'\x114bb', U'\x114be', U'\x115ba', U'\x115bb', U'\x11938',
+};
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The properties of the code point
+constexpr auto find_value(char32_t code_point) noexcept -> std::uint8_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = blocks[code_point >> block_shift];
+  auto first = std::size_t(block_runs[block]), last = std::size_t(block_runs[block + 1]);
+  auto low = static_cast<std::uint32_t>(code_point) & block_mask;
+
+  // the first run of a block starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((runs[middle] & block_mask) <= low) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return static_cast<std::uint8_t>(runs[first] >> block_shift);
+}
+
+/// The code points below `direct_size` are looked up with one load
+inline constexpr auto direct_size = std::size_t(0x800);
+
+constexpr auto make_direct_values() noexcept {
+  auto table = std::array<std::uint8_t, direct_size>{};
+  for (auto i = std::size_t(0); i < direct_size; ++i) {
+    table[i] = find_value(static_cast<char32_t>(i));
+  }
+  return table;
+}
+
+/// The properties of each code point below `direct_size`
+inline constexpr auto direct_values = make_direct_values();
+
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \return The properties of the code point
+constexpr auto value_of(char32_t code_point) noexcept -> std::uint8_t {
+  return (code_point < direct_size) ? direct_values[code_point] : find_value(code_point);
+}
+
+/// \param value The properties of a code point
+/// \return The canonical combining class of the code point
+constexpr auto combining_class_of(std::uint8_t value) noexcept -> std::uint8_t {
+  return combining_classes[value & ((1u << class_bits) - 1)];
+}
+
+/// \param value The properties of a code point
+/// \return The value of `nfc_quick_check` of the code point
+constexpr auto quick_check_of(std::uint8_t value) noexcept -> int {
+  return static_cast<int>(value >> class_bits);
+}
+
+/// \param code_point A code point value
+/// \return The full canonical decomposition of the code point, as a pair
+///         of offsets in `decomposition_data`, which are equal if the code
+///         point has none
+constexpr auto decomposition_of(char32_t code_point) noexcept -> std::pair<std::size_t, std::size_t> {
+  auto it = std::lower_bound(decomposed.begin(), decomposed.end(), code_point);
+  if ((it == decomposed.end()) || (*it != code_point)) {
+    return {0, 0};
+  }
+  auto index = static_cast<std::size_t>(it - decomposed.begin());
+  return {decomposition_offsets[index], decomposition_offsets[index + 1]};
+}
+
+/// \param first A code point value
+/// \param second A code point value
+/// \return The primary composite of the pair, or 0 if there is none
+constexpr auto composite_of(char32_t first, char32_t second) noexcept -> char32_t {
+  auto key = (std::uint64_t(first) << 21) | std::uint64_t(second);
+  auto it = std::lower_bound(composition_keys.begin(), composition_keys.end(), key);
+  if ((it == composition_keys.end()) || (*it != key)) {
+    return 0;
+  }
+  return composites[static_cast<std::size_t>(it - composition_keys.begin())];
+}
+}  // namespace skyr::nfc_data
+
+#endif  // SKYR_DOMAIN_NFC_TABLE_HPP
@@ -0,0 +1,295 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_BOOST_URL_BOOST_URL_HPP
+#define SKYR_V2_BOOST_URL_BOOST_URL_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <skyr/v2/core/host.hpp>
+#include <skyr/v2/core/url_record.hpp>
+#include <skyr/v2/url.hpp>
+
+namespace skyr::inline v2 {
+namespace boost_url {
+namespace details {
+/// The characters of a user, which RFC 3986 allows without escapes
+inline constexpr auto user_chars = boost::urls::unreserved_chars + boost::urls::sub_delim_chars;
+
+/// The characters of a password
+inline constexpr auto password_chars = user_chars + ':';
+
+/// The characters of a registered name
+inline constexpr auto host_chars = user_chars;
+
+/// The characters of a path
+inline constexpr auto path_chars = boost::urls::pchars + '/';
+
+/// The characters of a query or a fragment
+inline constexpr auto query_chars = path_chars + '?';
+
+/// Appends a component of a URL record
+///
+/// The characters which the WHATWG serialization leaves unescaped
+/// but RFC 3986 does not allow, such as "|" or "^", are
+/// percent-encoded, as are percent signs which do not start an
+/// escape, so that the result is a valid component.
+///
+/// \param component The component
+/// \param allowed The characters allowed in the component
+/// \param output The string which is appended to
+/// \returns The size of the decoded component
+inline auto append_component(std::string_view component, const boost::urls::grammar::lut_chars &allowed,
+                             std::string *output) -> std::size_t {
+  constexpr auto hex = std::string_view("0123456789ABCDEF");
+  constexpr auto is_hex = boost::urls::grammar::hexdig_chars;
+
+  auto decoded_size = component.size();
+  for (auto i = 0UL; i < component.size(); ++i) {
+    auto byte = component[i];
+    if ((byte == '%') && ((component.size() - i) > 2) && is_hex(component[i + 1]) && is_hex(component[i + 2])) {
+      output->append(component.substr(i, 3));
+      decoded_size -= 2;
+      i += 2;
+    } else if ((byte != '%') && allowed(byte)) {
+      output->push_back(byte);
+    } else {
+      auto value = static_cast<unsigned char>(byte);
+      output->push_back('%');
+      output->push_back(hex[value >> 4u]);
+      output->push_back(hex[value & 0x0fu]);
+    }
+  }
+  return decoded_size;
+}
+}  // namespace details
+
+/// Converts a URL record to a Boost.URL `url`
+///
+/// The URL is serialized as `serialize` does, and the offsets, the
+/// decoded sizes, the number of segments and of parameters and the
+/// host address are recorded as each component is written, so the
+/// result is never parsed again. Characters which RFC 3986 does not
+/// allow in a component are percent-encoded. A path which starts
+/// with an empty segment in a URL without a host is prefixed with
+/// "/.", as Boost.URL does.
+///
+/// \param record A URL record
+/// \returns A `boost::urls::url` with the same components
+inline auto to_boost_url(const url_record &record) -> boost::urls::url {
+  using boost::urls::detail::url_impl;
+  using namespace std::string_view_literals;
+
+  auto buffer = std::string{};
+  buffer.reserve(record.scheme.size() + record.username.size() + record.password.size() +
+                 record.path.chars().size() + (record.query ? record.query.value().size() : 0) +
+                 (record.fragment ? record.fragment.value().size() : 0) + 64);
+
+  auto impl = url_impl(url_impl::from::string);
+  auto mark = [&impl, &buffer](int id) { impl.offset_[id] = buffer.size(); };
+
+  // the scheme always starts at zero
+  impl.scheme_ = boost::urls::string_to_scheme(record.scheme);
+  buffer.append(record.scheme);
+  buffer.push_back(':');
+
+  mark(url_impl::id_user);
+  if (record.host || (record.scheme == "file")) {
+    buffer.append("//"sv);
+    if (record.includes_credentials()) {
+      impl.decoded_[url_impl::id_user] = details::append_component(record.username, details::user_chars, &buffer);
+      mark(url_impl::id_pass);
+      if (!record.password.empty()) {
+        buffer.push_back(':');
+        impl.decoded_[url_impl::id_pass] =
+            details::append_component(record.password, details::password_chars, &buffer);
+      }
+      buffer.push_back('@');
+    } else {
+      mark(url_impl::id_pass);
+    }
+
+    mark(url_impl::id_host);
+    impl.host_type_ = boost::urls::host_type::name;
+    impl.host_norm_ = true;
+    if (record.host) {
+      const auto &host = record.host.value();
+      char address[skyr::host::max_serialized_address_size];
+      auto name = host.serialize_to(address);
+      if (host.is_ipv4_address() || host.is_ipv6_address()) {
+        auto copy_bytes = [&impl](const auto &bytes) {
+          std::copy(std::cbegin(bytes), std::cend(bytes), impl.ip_addr_);
+        };
+        if (host.is_ipv4_address()) {
+          copy_bytes(host.to_ipv4_address().value().to_bytes());
+          impl.host_type_ = boost::urls::host_type::ipv4;
+        } else {
+          copy_bytes(host.to_ipv6_address().value().to_bytes());
+          impl.host_type_ = boost::urls::host_type::ipv6;
+        }
+        impl.decoded_[url_impl::id_host] = name.size();
+        buffer.append(name);
+      } else {
+        auto first = buffer.size();
+        impl.decoded_[url_impl::id_host] = details::append_component(name, details::host_chars, &buffer);
+        impl.host_norm_ = (impl.decoded_[url_impl::id_host] == (buffer.size() - first)) &&
+                          std::none_of(std::cbegin(buffer) + first, std::cend(buffer),
+                                       [](auto byte) { return (byte >= 'A') && (byte <= 'Z'); });
+      }
+    }
+
+    mark(url_impl::id_port);
+    if (record.port) {
+      char port[5];
+      auto last = std::to_chars(port, port + sizeof(port), record.port.value()).ptr;
+      impl.port_number_ = record.port.value();
+      buffer.push_back(':');
+      buffer.append(port, last);
+    }
+  } else {
+    mark(url_impl::id_pass);
+    mark(url_impl::id_host);
+    mark(url_impl::id_port);
+  }
+
+  mark(url_impl::id_path);
+  auto first = buffer.size();
+  if (record.cannot_be_a_base_url) {
+    impl.decoded_[url_impl::id_path] =
+        details::append_component(record.path.front(), details::path_chars, &buffer);
+    impl.nseg_ = (buffer.size() == first)
+                     ? 0
+                     : (1 + static_cast<std::size_t>(std::count(std::cbegin(buffer) + first, std::cend(buffer), '/')));
+  } else if (record.path.empty() || (record.path.chars() == "/"sv)) {
+    impl.decoded_[url_impl::id_path] = 1;
+    buffer.push_back('/');
+  } else {
+    auto prefix = !record.host && (record.scheme != "file") && record.path.front().empty();
+    if (prefix) {
+      buffer.append("/."sv);
+    }
+    impl.decoded_[url_impl::id_path] =
+        details::append_component(record.path.chars(), details::path_chars, &buffer) + (prefix ? 2 : 0);
+    impl.nseg_ = record.path.size();
+  }
+
+  mark(url_impl::id_query);
+  if (record.query) {
+    buffer.push_back('?');
+    auto first_param = buffer.size();
+    impl.decoded_[url_impl::id_query] =
+        details::append_component(record.query.value(), details::query_chars, &buffer);
+    impl.nparam_ = 1 + static_cast<std::size_t>(std::count(std::cbegin(buffer) + first_param, std::cend(buffer), '&'));
+  }
+
+  mark(url_impl::id_frag);
+  if (record.fragment) {
+    buffer.push_back('#');
+    impl.decoded_[url_impl::id_frag] =
+        details::append_component(record.fragment.value(), details::query_chars, &buffer);
+  }
+
+  mark(url_impl::id_end);
+  impl.cs_ = buffer.data();
+  return boost::urls::url(impl.construct());
+}
+
+/// Converts a URL to a Boost.URL `url`
+///
+/// \param input A URL
+/// \returns A `boost::urls::url` with the same components
+inline auto to_boost_url(const url &input) -> boost::urls::url {
+  return to_boost_url(input.record());
+}
+
+/// Converts a Boost.URL URL to a URL record
+///
+/// The components are copied as they are, without being checked or
+/// normalized, so the URL is expected to be one which the WHATWG
+/// parser leaves unchanged, such as one returned by `to_boost_url`.
+/// A URL without an authority and whose path is not absolute has an
+/// opaque path.
+///
+/// \param input A Boost.URL URL
+/// \returns A URL record with the same components
+inline auto to_url_record(const boost::urls::url_view_base &input) -> url_record {
+  auto to_string = [](auto component) { return std::string(component.data(), component.size()); };
+
+  auto record = url_record{};
+  record.scheme = to_string(input.scheme());
+
+  if (input.has_authority()) {
+    record.username = to_string(input.encoded_user());
+    record.password = to_string(input.encoded_password());
+
+    switch (input.host_type()) {
+      case boost::urls::host_type::ipv4:
+        record.host = skyr::host{skyr::ipv4_address(input.host_ipv4_address().to_uint())};
+        break;
+      case boost::urls::host_type::ipv6: {
+        auto bytes = input.host_ipv6_address().to_bytes();
+        auto pieces = std::array<unsigned short, 8>{};
+        for (auto i = 0UL; i < pieces.size(); ++i) {
+          pieces[i] = static_cast<unsigned short>((bytes[i * 2] << 8u) | bytes[(i * 2) + 1]);
+        }
+        record.host = skyr::host{skyr::ipv6_address(pieces)};
+        break;
+      }
+      default:
+        if (input.encoded_host().empty()) {
+          record.host = skyr::host{empty_host{}};
+        } else if (record.is_special()) {
+          record.host = skyr::host{domain_name{to_string(input.encoded_host())}};
+        } else {
+          record.host = skyr::host{opaque_host{to_string(input.encoded_host())}};
+        }
+        break;
+    }
+
+    if (input.has_port() && !input.port().empty()) {
+      record.port = input.port_number();
+    }
+  }
+
+  if (!input.has_authority() && !input.is_path_absolute()) {
+    record.cannot_be_a_base_url = true;
+    record.path.push_back(to_string(input.encoded_path()));
+  } else if (input.encoded_path() == "/") {
+    record.path.push_back(std::string_view());
+  } else {
+    auto segments = input.encoded_segments();
+    record.path.reserve(segments.size(), input.encoded_path().size());
+    for (auto segment : segments) {
+      record.path.push_back(std::string_view(segment.data(), segment.size()));
+    }
+  }
+
+  if (input.has_query()) {
+    record.query = to_string(input.encoded_query());
+  }
+  if (input.has_fragment()) {
+    record.fragment = to_string(input.encoded_fragment());
+  }
+  return record;
+}
+}  // namespace boost_url
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_BOOST_URL_BOOST_URL_HPP
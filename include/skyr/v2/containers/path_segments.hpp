@@ -0,0 +1,279 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CONTAINERS_PATH_SEGMENTS_HPP
+#define SKYR_V2_CONTAINERS_PATH_SEGMENTS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace skyr::inline v2 {
+/// A list of path segments stored in one string
+///
+/// Each segment is stored after a `/`, so the characters are the
+/// serialized path, and the end of each segment is kept in a vector
+/// of offsets. Pushing and popping segments and serializing the path
+/// are O(1) amortized, and do not allocate once the capacity is
+/// reached. Clearing the list keeps its capacity.
+///
+/// The segments are returned as `std::string_view`s, which are
+/// invalidated by any modification of the list.
+class path_segments {
+ public:
+  /// The segment type
+  using value_type = std::string_view;
+  /// An alias to `value_type`
+  using const_reference = value_type;
+  /// An alias to `value_type`
+  using reference = value_type;
+  /// \c std::size_t
+  using size_type = std::size_t;
+  /// \c std::ptrdiff_t
+  using difference_type = std::ptrdiff_t;
+
+  /// A random access iterator through the segments
+  class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    const_iterator() = default;
+
+    auto operator*() const noexcept -> reference {
+      return (*segments_)[index_];
+    }
+
+    auto operator[](difference_type n) const noexcept -> reference {
+      return (*segments_)[static_cast<size_type>(static_cast<difference_type>(index_) + n)];
+    }
+
+    auto operator++() noexcept -> const_iterator & {
+      ++index_;
+      return *this;
+    }
+
+    auto operator++(int) noexcept -> const_iterator {
+      auto it = *this;
+      ++index_;
+      return it;
+    }
+
+    auto operator--() noexcept -> const_iterator & {
+      --index_;
+      return *this;
+    }
+
+    auto operator--(int) noexcept -> const_iterator {
+      auto it = *this;
+      --index_;
+      return it;
+    }
+
+    auto operator+=(difference_type n) noexcept -> const_iterator & {
+      index_ = static_cast<size_type>(static_cast<difference_type>(index_) + n);
+      return *this;
+    }
+
+    auto operator-=(difference_type n) noexcept -> const_iterator & {
+      return *this += -n;
+    }
+
+    friend auto operator+(const_iterator it, difference_type n) noexcept -> const_iterator {
+      return it += n;
+    }
+
+    friend auto operator+(difference_type n, const_iterator it) noexcept -> const_iterator {
+      return it += n;
+    }
+
+    friend auto operator-(const_iterator it, difference_type n) noexcept -> const_iterator {
+      return it -= n;
+    }
+
+    friend auto operator-(const const_iterator &lhs, const const_iterator &rhs) noexcept -> difference_type {
+      return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    friend auto operator==(const const_iterator &lhs, const const_iterator &rhs) noexcept -> bool {
+      return lhs.index_ == rhs.index_;
+    }
+
+    friend auto operator<=>(const const_iterator &lhs, const const_iterator &rhs) noexcept {
+      return lhs.index_ <=> rhs.index_;
+    }
+
+   private:
+    friend class path_segments;
+
+    const_iterator(const path_segments *segments, size_type index) noexcept : segments_(segments), index_(index) {
+    }
+
+    const path_segments *segments_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  /// An alias to `const_iterator`
+  using iterator = const_iterator;
+
+  /// Constructs an empty list
+  path_segments() = default;
+
+  /// Constructs a list from segments
+  /// \param segments The segments
+  path_segments(std::initializer_list<std::string_view> segments) {
+    for (auto segment : segments) {
+      push_back(segment);
+    }
+  }
+
+  /// \returns `true` if there are no segments
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return ends_.empty();
+  }
+
+  /// \returns The number of segments
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return ends_.size();
+  }
+
+  /// \param index The index of a segment
+  /// \returns The segment
+  [[nodiscard]] auto operator[](size_type index) const noexcept -> std::string_view {
+    assert(index < size());
+    auto first = (index == 0) ? 0 : ends_[index - 1];
+    return std::string_view(chars_).substr(first + 1, ends_[index] - first - 1);
+  }
+
+  /// \returns The first segment
+  [[nodiscard]] auto front() const noexcept -> std::string_view {
+    return (*this)[0];
+  }
+
+  /// \returns The last segment
+  [[nodiscard]] auto back() const noexcept -> std::string_view {
+    return (*this)[size() - 1];
+  }
+
+  /// \returns An iterator to the first segment
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return const_iterator(this, 0);
+  }
+
+  /// \returns An iterator past the last segment
+  [[nodiscard]] auto cend() const noexcept -> const_iterator {
+    return const_iterator(this, size());
+  }
+
+  /// \returns An iterator to the first segment
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return cbegin();
+  }
+
+  /// \returns An iterator past the last segment
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return cend();
+  }
+
+  /// Returns the segments, each preceded by a `/`
+  ///
+  /// This is the serialized path, except that an empty list
+  /// returns an empty string.
+  ///
+  /// \returns The characters of the list
+  [[nodiscard]] auto chars() const noexcept -> std::string_view {
+    return chars_;
+  }
+
+  /// Reserves space for segments
+  /// \param segments The number of segments
+  /// \param chars The total size of the segments
+  void reserve(size_type segments, size_type chars) {
+    ends_.reserve(segments);
+    chars_.reserve(segments + chars);
+  }
+
+  /// Removes every segment, keeping the capacity
+  void clear() noexcept {
+    chars_.clear();
+    ends_.clear();
+  }
+
+  /// Appends a segment
+  /// \param segment The segment
+  void push_back(std::string_view segment) {
+    chars_ += '/';
+    chars_ += segment;
+    ends_.push_back(chars_.size());
+  }
+
+  /// Appends a segment
+  /// \param segment The segment
+  void emplace_back(std::string_view segment = {}) {
+    push_back(segment);
+  }
+
+  /// Appends characters to the last segment
+  /// \param s The characters to append
+  void append_to_back(std::string_view s) {
+    assert(!empty());
+    chars_ += s;
+    ends_.back() = chars_.size();
+  }
+
+  /// Removes the last segment
+  void pop_back() noexcept {
+    assert(!empty());
+    ends_.pop_back();
+    chars_.resize(empty() ? 0 : ends_.back());
+  }
+
+  /// Removes the first segment
+  ///
+  /// This moves the characters and offsets of the other segments.
+  void pop_front() noexcept {
+    assert(!empty());
+    auto n = ends_.front();
+    chars_.erase(0, n);
+    ends_.erase(ends_.begin());
+    for (auto &end : ends_) {
+      end -= n;
+    }
+  }
+
+  /// Swaps two lists
+  /// \param other Another list
+  void swap(path_segments &other) noexcept {
+    chars_.swap(other.chars_);
+    ends_.swap(other.ends_);
+  }
+
+  /// Compares two lists
+  friend auto operator==(const path_segments &lhs, const path_segments &rhs) noexcept -> bool {
+    return (lhs.chars_ == rhs.chars_) && (lhs.ends_ == rhs.ends_);
+  }
+
+ private:
+  std::string chars_;
+  std::vector<size_type> ends_;
+};
+
+/// Swaps two lists of path segments
+///
+/// \param lhs A list of path segments
+/// \param rhs A list of path segments
+inline void swap(path_segments &lhs, path_segments &rhs) noexcept {
+  lhs.swap(rhs);
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CONTAINERS_PATH_SEGMENTS_HPP
@@ -120,6 +120,20 @@ class static_vector {
     --size_;
   }
 
+  ///
+  /// \param count
+  /// \pre `count <= capacity()`
+  /// \post `size() == count`
+  constexpr void resize(size_type count) noexcept(std::is_trivially_move_assignable_v<T>) {
+    assert(count <= Capacity);
+    while (size_ > count) {
+      pop_back();
+    }
+    while (size_ < count) {
+      emplace_back();
+    }
+  }
+
   ///
   /// \return
   [[nodiscard]] constexpr auto data() noexcept -> pointer {
@@ -0,0 +1,135 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_BASE_CONTEXT_HPP
+#define SKYR_V2_CORE_BASE_CONTEXT_HPP
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <tl/expected.hpp>
+#include <skyr/v2/core/url_record.hpp>
+#include <skyr/v2/core/compact_url_record.hpp>
+#include <skyr/v2/core/errors.hpp>
+#include <skyr/v2/core/parse.hpp>
+
+namespace skyr::inline v2 {
+/// A base URL prepared for resolving many inputs against it
+///
+/// The parser copies the scheme, credentials, host, path and
+/// query of the base into the record it writes, depending on the
+/// form of the input. A `base_context` holds the base and what
+/// is computed from it once, and parses into records owned by
+/// the caller: a record reused for many parses keeps the
+/// capacity of its components, so the pieces inherited from the
+/// base are copied into existing storage instead of being
+/// allocated again for every input.
+///
+/// ```
+/// auto base = skyr::base_context(skyr::parse("https://example.org/docs/index.html").value());
+/// auto url = skyr::url_record{};
+/// for (auto href : hrefs) {
+///   if (base.parse(href, url)) {
+///     // ...
+///   }
+/// }
+/// ```
+///
+/// A `base_context` is not modified by parsing, so it can be
+/// shared between threads.
+class base_context {
+ public:
+  /// Constructor
+  /// \param base The base URL
+  explicit base_context(url_record base)
+      : base_(std::move(base)), reserve_size_(details::base_record_size(base_)) {
+  }
+
+  /// \returns The base URL
+  [[nodiscard]] auto record() const noexcept -> const url_record & {
+    return base_;
+  }
+
+  /// Parses a URL against the base
+  ///
+  /// \param input The input string
+  /// \returns A new record on success, an error on failure
+  [[nodiscard]] auto parse(std::string_view input) const -> tl::expected<url_record, url_parse_errc> {
+    bool validation_error = false;
+    return details::parse(input, &validation_error, &base_);
+  }
+
+  /// Parses a URL against the base into a record owned by the
+  /// caller
+  ///
+  /// \param input The input string
+  /// \param url The record to write to. It keeps the capacity of
+  ///            its components, and is cleared on failure
+  /// \returns An error on failure
+  auto parse(std::string_view input, url_record &url) const -> tl::expected<void, url_parse_errc> {
+    bool validation_error = false;
+    return parse(input, url, &validation_error);
+  }
+
+  /// Parses a URL against the base into a record owned by the
+  /// caller
+  ///
+  /// \param input The input string
+  /// \param url The record to write to. It keeps the capacity of
+  ///            its components, and is cleared on failure
+  /// \param validation_error Set to `true` if there was a
+  ///                         validation error
+  /// \returns An error on failure
+  auto parse(std::string_view input, url_record &url, bool *validation_error) const
+      -> tl::expected<void, url_parse_errc> {
+    input = remove_leading_c0_control_or_space(input, validation_error);
+    input = remove_trailing_c0_control_or_space(input, validation_error);
+    auto stripped = std::string{};
+    input = remove_tab_and_newline(input, stripped, validation_error);
+
+    url.clear();
+    auto context = url_parser_context(input, validation_error, &base_, details::url_record_builder(url), std::nullopt);
+    auto result = details::run_parser(context);
+    details::count_parse(result.has_value());
+    if (!result) {
+      url.clear();
+    }
+    return result;
+  }
+
+  /// Parses a URL against the base into a compact record owned by
+  /// the caller
+  ///
+  /// \param input The input string
+  /// \param url The record to write to. It is cleared on failure
+  /// \returns An error on failure
+  auto parse(std::string_view input, compact_url_record &url) const -> tl::expected<void, url_parse_errc> {
+    bool validation_error = false;
+    input = remove_leading_c0_control_or_space(input, &validation_error);
+    input = remove_trailing_c0_control_or_space(input, &validation_error);
+    auto stripped = std::string{};
+    input = remove_tab_and_newline(input, stripped, &validation_error);
+
+    // the size of the base is only computed once
+    url.clear();
+    url.reserve((3 * input.size()) + reserve_size_);
+
+    auto context = basic_url_parser_context<details::compact_url_record_builder>(
+        input, &validation_error, &base_, details::compact_url_record_builder(url), std::nullopt);
+    auto result = details::run_parser(context);
+    details::count_parse(result.has_value());
+    if (!result) {
+      url.clear();
+    }
+    return result;
+  }
+
+ private:
+  url_record base_;
+  std::size_t reserve_size_;
+};
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_BASE_CONTEXT_HPP
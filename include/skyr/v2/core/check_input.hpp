@@ -6,31 +6,177 @@
 #ifndef SKYR_V2_CORE_CHECK_INPUT_HPP
 #define SKYR_V2_CORE_CHECK_INPUT_HPP
 
-#include <locale>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace skyr::inline v2 {
+/// The bytes for which `std::iscntrl` or `std::isspace` is true in
+/// the classic locale: U+0000 to U+0020, and U+007F
 constexpr static auto is_c0_control_or_space = [](auto byte) {
-  return std::iscntrl(byte, std::locale::classic()) || std::isspace(byte, std::locale::classic());
+  auto value = static_cast<unsigned char>(byte);
+  return (value <= 0x20) || (value == 0x7f);
 };
 
+constexpr static auto is_tab_or_newline = [](auto byte) { return (byte == '\t') || (byte == '\r') || (byte == '\n'); };
+
+namespace details {
+#if defined(__SSE2__)
+/// A mask of the bytes of `bytes` which are C0 controls or spaces
+inline auto c0_control_or_space_mask(__m128i bytes) noexcept -> unsigned {
+  auto is_c0_or_space = _mm_cmpeq_epi8(_mm_min_epu8(bytes, _mm_set1_epi8(0x20)), bytes);
+  auto is_delete = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x7f));
+  return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(is_c0_or_space, is_delete)));
+}
+
+/// A vectorized search for the first tab or newline
+inline auto find_tab_or_newline_sse2(std::string_view input) noexcept -> std::size_t {
+  auto first = input.data();
+  auto size = input.size();
+  auto i = std::size_t(0);
+  for (; i + 16 <= size; i += 16) {
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+    auto matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')),
+                                             _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))),
+                                _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  for (; i < size; ++i) {
+    if (is_tab_or_newline(first[i])) {
+      return i;
+    }
+  }
+  return std::string_view::npos;
+}
+#endif  // defined(__SSE2__)
+
+/// Finds the first tab or newline in the input
+///
+/// \param input An input string
+/// \returns The position of the byte, or `std::string_view::npos`
+constexpr inline auto find_tab_or_newline(std::string_view input) noexcept -> std::size_t {
+#if defined(__SSE2__)
+  if (!std::is_constant_evaluated()) {
+    return find_tab_or_newline_sse2(input);
+  }
+#endif  // defined(__SSE2__)
+  auto it = std::find_if(std::cbegin(input), std::cend(input), is_tab_or_newline);
+  return (it == std::cend(input)) ? std::string_view::npos : static_cast<std::size_t>(it - std::cbegin(input));
+}
+
+/// The number of C0 controls or spaces at the start of the input
+constexpr inline auto count_leading_c0_control_or_space(std::string_view input) noexcept -> std::size_t {
+  // most inputs have none
+  if (input.empty() || !is_c0_control_or_space(input.front())) {
+    return 0;
+  }
+#if defined(__SSE2__)
+  if (!std::is_constant_evaluated()) {
+    auto i = std::size_t(0);
+    for (; i + 16 <= input.size(); i += 16) {
+      auto mask = c0_control_or_space_mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + i)));
+      if (mask != 0xffffU) {
+        return i + static_cast<std::size_t>(std::countr_one(mask));
+      }
+    }
+    for (; i < input.size(); ++i) {
+      if (!is_c0_control_or_space(input[i])) {
+        break;
+      }
+    }
+    return i;
+  }
+#endif  // defined(__SSE2__)
+  auto it = std::find_if_not(std::cbegin(input), std::cend(input), is_c0_control_or_space);
+  return static_cast<std::size_t>(it - std::cbegin(input));
+}
+
+/// The number of C0 controls or spaces at the end of the input
+constexpr inline auto count_trailing_c0_control_or_space(std::string_view input) noexcept -> std::size_t {
+  if (input.empty() || !is_c0_control_or_space(input.back())) {
+    return 0;
+  }
+#if defined(__SSE2__)
+  if (!std::is_constant_evaluated()) {
+    auto n = input.size();
+    for (; n >= 16; n -= 16) {
+      auto mask = c0_control_or_space_mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + n - 16)));
+      if (mask != 0xffffU) {
+        // the bits are in the order of the bytes, so the last
+        // bytes of the block are the highest bits
+        auto count = static_cast<std::size_t>(std::countl_one(static_cast<std::uint16_t>(mask)));
+        return input.size() - n + count;
+      }
+    }
+    for (; n > 0; --n) {
+      if (!is_c0_control_or_space(input[n - 1])) {
+        break;
+      }
+    }
+    return input.size() - n;
+  }
+#endif  // defined(__SSE2__)
+  auto it = std::find_if_not(std::crbegin(input), std::crend(input), is_c0_control_or_space);
+  return static_cast<std::size_t>(it - std::crbegin(input));
+}
+}  // namespace details
+
 constexpr inline auto remove_leading_c0_control_or_space(std::string_view input, bool *validation_error) {
-  auto first = std::cbegin(input), last = std::cend(input);
-  auto it = std::find_if_not(first, last, is_c0_control_or_space);
-  *validation_error |= (it != first);
-  input.remove_prefix(std::distance(first, it));
+  auto count = details::count_leading_c0_control_or_space(input);
+  *validation_error |= (count != 0);
+  input.remove_prefix(count);
   return input;
 }
 
 constexpr inline auto remove_trailing_c0_control_or_space(std::string_view input, bool *validation_error) {
-  auto first = std::crbegin(input), last = std::crend(input);
-  auto it = std::find_if_not(first, last, is_c0_control_or_space);
-  *validation_error |= (it != first);
-  input.remove_suffix(std::distance(first, it));
+  auto count = details::count_trailing_c0_control_or_space(input);
+  *validation_error |= (count != 0);
+  input.remove_suffix(count);
   return input;
 }
+
+/// Removes all tabs and newlines from the input
+///
+/// The parser never sees these bytes, so it does not need to skip
+/// them before each byte. Inputs without them, which are nearly
+/// all inputs, are only scanned; the others are copied without
+/// them to `buffer`, one run between two removed bytes at a time.
+///
+/// \param input An input string
+/// \param buffer The storage of the result, if bytes are removed
+/// \param validation_error Set to `true` if bytes are removed
+/// \returns The input without tabs or newlines, which refers to
+///          `input` or to `buffer`
+inline auto remove_tab_and_newline(std::string_view input, std::string &buffer, bool *validation_error)
+    -> std::string_view {
+  auto pos = details::find_tab_or_newline(input);
+  if (pos == std::string_view::npos) {
+    return input;
+  }
+
+  *validation_error |= true;
+  buffer.clear();
+  buffer.reserve(input.size() - 1);
+  while (pos != std::string_view::npos) {
+    buffer.append(input.data(), pos);
+    input.remove_prefix(pos + 1);
+    pos = details::find_tab_or_newline(input);
+  }
+  buffer.append(input);
+  return buffer;
+}
 }  // namespace skyr::inline v2
 
 #endif  // SKYR_V2_CORE_CHECK_INPUT_HPP
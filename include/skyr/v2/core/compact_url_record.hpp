@@ -0,0 +1,481 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_COMPACT_URL_RECORD_HPP
+#define SKYR_V2_CORE_COMPACT_URL_RECORD_HPP
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <optional>
+#include <skyr/v2/core/host.hpp>
+#include <skyr/v2/core/schemes.hpp>
+#include <skyr/v2/core/stats.hpp>
+#include <skyr/v2/core/url_record.hpp>
+
+namespace skyr::inline v2 {
+namespace details {
+class compact_url_record_builder;
+}  // namespace details
+
+/// Represents the parts of a URL identifier in one contiguous buffer
+///
+/// The components are stored one after the other in a single
+/// character buffer, in the order scheme, username, password,
+/// host, path, query and fragment, and are located using a table
+/// of offsets. The path is stored serialized, so each segment is
+/// preceded by a `'/'`, unless the URL cannot be a base URL.
+///
+/// Clearing the record keeps the buffer, so a record which is
+/// reused for many parses stops allocating once its capacity is
+/// large enough.
+class compact_url_record {
+ public:
+  /// string type
+  /// \sa url_record::string_type
+  using string_type = std::string;
+
+  /// The type of the host, if the URL has one
+  enum class host_kind : unsigned char {
+    none,
+    domain_name,
+    ipv4_address,
+    ipv6_address,
+    opaque_host,
+    empty,
+  };
+
+  /// Default constructor
+  compact_url_record() = default;
+
+  /// \returns An ASCII string that identifies the type of URL
+  [[nodiscard]] auto scheme() const noexcept -> std::string_view {
+    return part(scheme_id);
+  }
+
+  /// \returns An ASCII string identifying a username
+  [[nodiscard]] auto username() const noexcept -> std::string_view {
+    return part(username_id);
+  }
+
+  /// \returns An ASCII string identifying a password
+  [[nodiscard]] auto password() const noexcept -> std::string_view {
+    return part(password_id);
+  }
+
+  /// \returns The serialized host, if there is one
+  [[nodiscard]] auto host() const noexcept -> std::optional<std::string_view> {
+    return (host_kind_ != host_kind::none) ? std::make_optional(part(host_id)) : std::nullopt;
+  }
+
+  /// \returns The type of the host
+  [[nodiscard]] auto host_type() const noexcept -> host_kind {
+    return host_kind_;
+  }
+
+  /// \returns An optional network port
+  [[nodiscard]] auto port() const noexcept -> std::optional<std::uint16_t> {
+    return port_;
+  }
+
+  /// \returns The serialized path
+  [[nodiscard]] auto path() const noexcept -> std::string_view {
+    return part(path_id);
+  }
+
+  /// \returns The number of path segments
+  [[nodiscard]] auto path_size() const noexcept -> std::size_t {
+    return path_size_;
+  }
+
+  /// \returns An optional ASCII string
+  [[nodiscard]] auto query() const noexcept -> std::optional<std::string_view> {
+    return has_query_ ? std::make_optional(part(query_id)) : std::nullopt;
+  }
+
+  /// \returns An optional ASCII string
+  [[nodiscard]] auto fragment() const noexcept -> std::optional<std::string_view> {
+    return has_fragment_ ? std::make_optional(part(fragment_id)) : std::nullopt;
+  }
+
+  /// \returns `true` if this URL cannot be used as a base URL
+  [[nodiscard]] auto cannot_be_a_base_url() const noexcept -> bool {
+    return cannot_be_a_base_url_;
+  }
+
+  /// Tests if the URL is a special scheme
+  /// \returns `true` if the URL scheme is a special scheme, `false`
+  ///          otherwise
+  [[nodiscard]] auto is_special() const noexcept -> bool {
+    return skyr::is_special(scheme());
+  }
+
+  /// Tests if the URL includes credentials
+  /// \returns `true` if the URL username or password is not an
+  ///          empty string, `false` otherwise
+  [[nodiscard]] auto includes_credentials() const noexcept -> bool {
+    return !username().empty() || !password().empty();
+  }
+
+  /// Tests if the URL cannot have a username, password or port
+  /// \returns `true` if the URL cannot have a username, password
+  ///          or port
+  [[nodiscard]] auto cannot_have_a_username_password_or_port() const noexcept -> bool {
+    return (host_kind_ == host_kind::none) || (host_kind_ == host_kind::empty) || cannot_be_a_base_url_ ||
+           (scheme() == "file");
+  }
+
+  /// \returns The number of characters that can be held without
+  ///          reallocating
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t {
+    return buffer_.capacity();
+  }
+
+  /// Reserves space for at least `size` characters
+  /// \param size The number of characters
+  void reserve(std::size_t size) {
+    if (size > buffer_.capacity()) {
+      details::count_reserve(size);
+    }
+    buffer_.reserve(size);
+  }
+
+  /// Removes every component, keeping the capacity
+  void clear() noexcept {
+    buffer_.clear();
+    offsets_.fill(0);
+    path_size_ = 0;
+    port_ = std::nullopt;
+    host_kind_ = host_kind::none;
+    has_query_ = false;
+    has_fragment_ = false;
+    cannot_be_a_base_url_ = false;
+  }
+
+  /// Copies the components into a `url_record`
+  /// \returns A `url_record` with the same components
+  [[nodiscard]] auto to_url_record() const -> url_record {
+    auto record = url_record{};
+    record.scheme = scheme();
+    record.username = username();
+    record.password = password();
+    record.host = make_host();
+    record.port = port_;
+    auto path = part(path_id);
+    if (cannot_be_a_base_url_) {
+      record.path.emplace_back(path);
+    } else {
+      record.path.reserve(path_size_, path.size());
+      while (!path.empty()) {
+        auto last = path.find('/', 1);
+        record.path.emplace_back(path.substr(1, last - 1));
+        path.remove_prefix((last != std::string_view::npos) ? last : path.size());
+      }
+    }
+    if (has_query_) {
+      record.query = part(query_id);
+    }
+    if (has_fragment_) {
+      record.fragment = part(fragment_id);
+    }
+    record.cannot_be_a_base_url = cannot_be_a_base_url_;
+    return record;
+  }
+
+  /// Swaps two `compact_url_record` objects
+  /// \param other Another `compact_url_record` object
+  void swap(compact_url_record &other) noexcept {
+    using std::swap;
+    swap(buffer_, other.buffer_);
+    swap(scratch_, other.scratch_);
+    swap(offsets_, other.offsets_);
+    swap(path_size_, other.path_size_);
+    swap(port_, other.port_);
+    swap(host_kind_, other.host_kind_);
+    swap(has_query_, other.has_query_);
+    swap(has_fragment_, other.has_fragment_);
+    swap(cannot_be_a_base_url_, other.cannot_be_a_base_url_);
+  }
+
+ private:
+  friend class details::compact_url_record_builder;
+
+  enum component : unsigned char {
+    scheme_id = 0,
+    username_id,
+    password_id,
+    host_id,
+    path_id,
+    query_id,
+    fragment_id,
+    end_id,
+  };
+
+  [[nodiscard]] auto part(component id) const noexcept -> std::string_view {
+    return std::string_view(buffer_).substr(offsets_[id], offsets_[id + 1] - offsets_[id]);
+  }
+
+  // Replaces `count` characters at `pos` in the component
+  void splice(component id, std::size_t pos, std::size_t count, std::string_view s) {
+    buffer_.replace(offsets_[id] + pos, count, s);
+    auto delta = s.size() - count;
+    for (auto i = id + 1; i <= end_id; ++i) {
+      offsets_[i] += delta;
+    }
+  }
+
+  void assign(component id, std::string_view s) {
+    splice(id, 0, offsets_[id + 1] - offsets_[id], s);
+  }
+
+  void append(component id, std::string_view s) {
+    splice(id, offsets_[id + 1] - offsets_[id], 0, s);
+  }
+
+  [[nodiscard]] auto make_host() const -> std::optional<skyr::v2::host> {
+    auto name = part(host_id);
+    auto validation_error = false;
+    switch (host_kind_) {
+      case host_kind::domain_name:
+        return skyr::v2::host{skyr::v2::domain_name{std::string(name)}};
+      case host_kind::ipv4_address:
+        return skyr::v2::host{parse_ipv4_address(name, &validation_error).value()};
+      case host_kind::ipv6_address:
+        return skyr::v2::host{parse_ipv6_address(name.substr(1, name.size() - 2), &validation_error).value()};
+      case host_kind::opaque_host:
+        return skyr::v2::host{skyr::v2::opaque_host{std::string(name)}};
+      case host_kind::empty:
+        return skyr::v2::host{skyr::v2::empty_host{}};
+      case host_kind::none:
+        break;
+    }
+    return std::nullopt;
+  }
+
+  string_type buffer_;
+  // working storage for the parser
+  string_type scratch_;
+  std::array<std::size_t, end_id + 1> offsets_ = {};
+  std::size_t path_size_ = 0;
+  std::optional<std::uint16_t> port_;
+  host_kind host_kind_ = host_kind::none;
+  bool has_query_ = false;
+  bool has_fragment_ = false;
+  bool cannot_be_a_base_url_ = false;
+};
+
+/// Swaps two `compact_url_record` objects
+///
+/// Equivalent to `lhs.swap(rhs)`
+///
+/// \param lhs A `compact_url_record` object
+/// \param rhs A `compact_url_record` object
+inline void swap(compact_url_record &lhs, compact_url_record &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+namespace details {
+/// Writes the components produced by the URL parser into a
+/// `compact_url_record`
+class compact_url_record_builder {
+ public:
+  explicit compact_url_record_builder(compact_url_record &url) noexcept : url_(url) {
+  }
+
+  [[nodiscard]] auto scratch() noexcept -> std::string & {
+    return url_.scratch_;
+  }
+
+  [[nodiscard]] auto scheme() const noexcept -> std::string_view {
+    return url_.scheme();
+  }
+
+  void set_scheme(std::string_view scheme) {
+    url_.assign(compact_url_record::scheme_id, scheme);
+  }
+
+  [[nodiscard]] auto is_special() const noexcept -> bool {
+    return url_.is_special();
+  }
+
+  [[nodiscard]] auto includes_credentials() const noexcept -> bool {
+    return url_.includes_credentials();
+  }
+
+  void append_to_username(std::string_view s) {
+    url_.append(compact_url_record::username_id, s);
+  }
+
+  void append_to_password(std::string_view s) {
+    url_.append(compact_url_record::password_id, s);
+  }
+
+  [[nodiscard]] auto has_host() const noexcept -> bool {
+    return url_.host_kind_ != compact_url_record::host_kind::none;
+  }
+
+  [[nodiscard]] auto host_is_empty() const noexcept -> bool {
+    return url_.host_kind_ == compact_url_record::host_kind::empty;
+  }
+
+  [[nodiscard]] auto host_is_localhost() const noexcept -> bool {
+    return has_host() && (url_.part(compact_url_record::host_id) == "localhost");
+  }
+
+  void set_host(const skyr::v2::host &host) {
+    using kind = compact_url_record::host_kind;
+    if (host.is_domain_name()) {
+      url_.host_kind_ = kind::domain_name;
+    } else if (host.is_ipv4_address()) {
+      url_.host_kind_ = kind::ipv4_address;
+    } else if (host.is_ipv6_address()) {
+      url_.host_kind_ = kind::ipv6_address;
+    } else if (host.is_opaque_host()) {
+      url_.host_kind_ = kind::opaque_host;
+    } else {
+      url_.host_kind_ = kind::empty;
+    }
+    url_.assign(compact_url_record::host_id, host.serialize());
+  }
+
+  void set_host(const std::optional<skyr::v2::host> &host) {
+    if (host) {
+      set_host(host.value());
+    } else {
+      url_.host_kind_ = compact_url_record::host_kind::none;
+      url_.assign(compact_url_record::host_id, {});
+    }
+  }
+
+  void set_empty_host() {
+    url_.host_kind_ = compact_url_record::host_kind::empty;
+    url_.assign(compact_url_record::host_id, {});
+  }
+
+  [[nodiscard]] auto port() const noexcept -> std::optional<std::uint16_t> {
+    return url_.port_;
+  }
+
+  void set_port(std::optional<std::uint16_t> port) noexcept {
+    url_.port_ = port;
+  }
+
+  void set_authority_from(const url_record &base) {
+    url_.assign(compact_url_record::username_id, base.username);
+    url_.assign(compact_url_record::password_id, base.password);
+    set_host(base.host);
+    url_.port_ = base.port;
+  }
+
+  void set_cannot_be_a_base_url() noexcept {
+    url_.cannot_be_a_base_url_ = true;
+  }
+
+  [[nodiscard]] auto path_empty() const noexcept -> bool {
+    return url_.path_size_ == 0;
+  }
+
+  [[nodiscard]] auto path_size() const noexcept -> std::size_t {
+    return url_.path_size_;
+  }
+
+  [[nodiscard]] auto path_front() const noexcept -> std::string_view {
+    auto path = url_.part(compact_url_record::path_id);
+    if (url_.cannot_be_a_base_url_) {
+      return path;
+    }
+    return path.substr(1, path.find('/', 1) - 1);
+  }
+
+  void clear_path() {
+    url_.assign(compact_url_record::path_id, {});
+    url_.path_size_ = 0;
+  }
+
+  void push_back_path(std::string_view segment) {
+    if (!url_.cannot_be_a_base_url_) {
+      url_.append(compact_url_record::path_id, "/");
+    }
+    url_.append(compact_url_record::path_id, segment);
+    ++url_.path_size_;
+  }
+
+  void pop_back_path() {
+    auto path = url_.part(compact_url_record::path_id);
+    auto pos = url_.cannot_be_a_base_url_ ? 0 : path.rfind('/');
+    url_.splice(compact_url_record::path_id, pos, path.size() - pos, {});
+    --url_.path_size_;
+  }
+
+  void pop_front_path() {
+    auto path = url_.part(compact_url_record::path_id);
+    auto pos = url_.cannot_be_a_base_url_ ? path.size() : std::min(path.find('/', 1), path.size());
+    url_.splice(compact_url_record::path_id, 0, pos, {});
+    --url_.path_size_;
+  }
+
+  void append_to_path_front(std::string_view s) {
+    // only used when the URL cannot be a base URL, so the
+    // path has a single segment
+    url_.append(compact_url_record::path_id, s);
+  }
+
+  void set_path_from(const url_record &base) {
+    clear_path();
+    auto cannot_be_a_base_url = url_.cannot_be_a_base_url_;
+    url_.cannot_be_a_base_url_ = base.cannot_be_a_base_url;
+    for (const auto &segment : base.path) {
+      push_back_path(segment);
+    }
+    url_.cannot_be_a_base_url_ = cannot_be_a_base_url;
+  }
+
+  [[nodiscard]] auto has_query() const noexcept -> bool {
+    return url_.has_query_;
+  }
+
+  void clear_query() {
+    url_.has_query_ = false;
+    url_.assign(compact_url_record::query_id, {});
+  }
+
+  void set_empty_query() {
+    url_.has_query_ = true;
+    url_.assign(compact_url_record::query_id, {});
+  }
+
+  void set_query_from(const url_record &base) {
+    url_.has_query_ = base.query.has_value();
+    url_.assign(compact_url_record::query_id, base.query ? std::string_view(base.query.value()) : std::string_view());
+  }
+
+  void append_to_query(std::string_view s) {
+    url_.has_query_ = true;
+    url_.append(compact_url_record::query_id, s);
+  }
+
+  [[nodiscard]] auto has_fragment() const noexcept -> bool {
+    return url_.has_fragment_;
+  }
+
+  void set_empty_fragment() {
+    url_.has_fragment_ = true;
+    url_.assign(compact_url_record::fragment_id, {});
+  }
+
+  void append_to_fragment(std::string_view s) {
+    url_.has_fragment_ = true;
+    url_.append(compact_url_record::fragment_id, s);
+  }
+
+ private:
+  compact_url_record &url_;
+};
+}  // namespace details
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_COMPACT_URL_RECORD_HPP
@@ -38,6 +38,16 @@ enum class url_parse_errc {
   cannot_have_a_username_password_or_port,
   /// Invalid port value
   invalid_port,
+  /// The input is larger than a limit
+  too_long,
+  /// The path has more segments than a limit
+  too_many_segments,
+  /// The query has more name-value pairs than a limit
+  too_many_params,
+  /// The host is larger than a limit
+  host_too_long,
+  /// A label of the host is larger than a limit
+  label_too_long,
 };
 
 namespace details {
@@ -71,6 +81,16 @@ class url_parse_error_category : public std::error_category {
         return "Cannot have a username, password or port";
       case url_parse_errc::invalid_port:
         return "Invalid port";
+      case url_parse_errc::too_long:
+        return "Input too long";
+      case url_parse_errc::too_many_segments:
+        return "Too many path segments";
+      case url_parse_errc::too_many_params:
+        return "Too many query parameters";
+      case url_parse_errc::host_too_long:
+        return "Host too long";
+      case url_parse_errc::label_too_long:
+        return "Host label too long";
       default:
         return "(Unknown error)";
     }
@@ -8,17 +8,20 @@
 
 #include <variant>
 #include <string>
+#include <string_view>
 #include <cassert>
 #include <algorithm>
 #include <tl/expected.hpp>
 #include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/action/join.hpp>
 #include <skyr/v2/core/errors.hpp>
+#include <skyr/v2/core/parser_stats.hpp>
 #include <skyr/v2/network/ipv4_address.hpp>
 #include <skyr/v2/network/ipv6_address.hpp>
 #include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
 #include <skyr/v2/percent_encoding/percent_decode.hpp>
 #include <skyr/v2/domain/domain.hpp>
+#include <skyr/v2/domain/domain_cache.hpp>
 
 namespace skyr::inline v2 {
 /// Represents a domain name in a [URL host](https://url.spec.whatwg.org/#host-representation)
@@ -64,20 +67,38 @@ class host {
   constexpr explicit host(empty_host host) : host_(host) {
   }
 
+  /// The length of the longest serialized IP address, with the
+  /// brackets of an IPv6 address
+  static constexpr std::size_t max_serialized_address_size = ipv6_address::max_serialized_size + 2;
+
   ///
   /// \return The host as a string
   [[nodiscard]] auto serialize() const {
-    constexpr static auto serialize = [](auto &&host) -> std::string {
+    char buffer[max_serialized_address_size];
+    return std::string(serialize_to(buffer));
+  }
+
+  /// Serializes the host without allocating
+  ///
+  /// \param buffer A buffer of at least `max_serialized_address_size`
+  ///               characters, where an IP address is written
+  /// \returns The name of a domain or an opaque host, or the address
+  ///          written to `buffer`
+  [[nodiscard]] auto serialize_to(char *buffer) const noexcept -> std::string_view {
+    auto serialize = [buffer](auto &&host) -> std::string_view {
       using T = std::decay_t<decltype(host)>;
 
       if constexpr (std::is_same_v<T, skyr::v2::ipv4_address>) {
-        return host.serialize();
+        return std::string_view(buffer, host.serialize_to(buffer));
       } else if constexpr (std::is_same_v<T, skyr::v2::ipv6_address>) {
-        return fmt::format("[{}]", host.serialize());
+        buffer[0] = '[';
+        auto size = host.serialize_to(buffer + 1);
+        buffer[size + 1] = ']';
+        return std::string_view(buffer, size + 2);
       } else if constexpr (std::is_same_v<T, skyr::v2::domain_name> || std::is_same_v<T, skyr::v2::opaque_host>) {
         return host.name;
       } else {
-        return std::string();
+        return std::string_view();
       }
     };
 
@@ -213,7 +234,12 @@ inline auto parse_host(std::string_view input, bool is_not_special, bool *valida
   }
 
   auto ascii_domain = std::string{};
-  if (!domain_to_ascii(domain_name, &ascii_domain)) {
+  auto cache = get_domain_cache();
+  auto converted = [&] {
+    [[maybe_unused]] auto timer = details::parser_timer(&parser_stats::domain_to_ascii_calls, &parser_stats::domain_to_ascii_time);
+    return cache ? cache->domain_to_ascii(domain_name, &ascii_domain) : domain_to_ascii(domain_name, &ascii_domain);
+  }();
+  if (!converted) {
     return tl::make_unexpected(url_parse_errc::domain_error);
   }
 
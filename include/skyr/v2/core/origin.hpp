@@ -0,0 +1,120 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_ORIGIN_HPP
+#define SKYR_V2_CORE_ORIGIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <skyr/v2/core/schemes.hpp>
+
+namespace skyr::inline v2 {
+/// A non-owning [URL origin](https://url.spec.whatwg.org/#origin)
+///
+/// An origin is either a tuple of a scheme, a host and a port,
+/// or opaque. The port is the port of the URL, or the default
+/// port of the scheme if the URL has none. The scheme and host
+/// reference the URL they are taken from, and the scheme is
+/// compared as a packed integer, so origins are compared and
+/// hashed without building strings.
+///
+/// As in the specification, an opaque origin is not the same
+/// origin as any origin, including itself.
+///
+/// \sa url::origin_parts
+class url_origin {
+ public:
+  /// Constructs an opaque origin
+  constexpr url_origin() noexcept = default;
+
+  /// Constructs a tuple origin
+  /// \param scheme The scheme
+  /// \param host The serialized host
+  /// \param port The port
+  constexpr url_origin(std::string_view scheme, std::string_view host, std::uint16_t port) noexcept
+      : scheme_(scheme), host_(host), key_(details::scheme_key(scheme)), port_(port), opaque_(false) {
+  }
+
+  /// \returns `true` if the origin is opaque
+  [[nodiscard]] constexpr auto is_opaque() const noexcept -> bool {
+    return opaque_;
+  }
+
+  /// \returns The scheme of a tuple origin
+  [[nodiscard]] constexpr auto scheme() const noexcept -> std::string_view {
+    return scheme_;
+  }
+
+  /// \returns The serialized host of a tuple origin
+  [[nodiscard]] constexpr auto host() const noexcept -> std::string_view {
+    return host_;
+  }
+
+  /// \returns The port of a tuple origin
+  [[nodiscard]] constexpr auto port() const noexcept -> std::uint16_t {
+    return port_;
+  }
+
+  /// \returns A hash of the origin, which is the same for
+  ///          origins that are the same origin
+  [[nodiscard]] auto hash() const noexcept -> std::size_t {
+    auto key = static_cast<std::size_t>(key_ ^ (static_cast<std::uint64_t>(port_) << 40));
+    return std::hash<std::string_view>()(host_) ^ (key * 0x9e3779b9u);
+  }
+
+  /// Tests if two origins are the
+  /// [same origin](https://url.spec.whatwg.org/#same-origin)
+  friend constexpr auto operator==(const url_origin &lhs, const url_origin &rhs) noexcept -> bool {
+    return !lhs.opaque_ && !rhs.opaque_ && (lhs.key_ == rhs.key_) && (lhs.port_ == rhs.port_) &&
+           (lhs.host_ == rhs.host_);
+  }
+
+ private:
+  std::string_view scheme_;
+  std::string_view host_;
+  std::uint64_t key_ = 0;
+  std::uint16_t port_ = 0;
+  bool opaque_ = true;
+};
+
+namespace details {
+/// Reads a serialized tuple origin, `scheme://host[:port]`
+/// \param origin A serialized origin
+/// \returns The origin, which references `origin`
+constexpr inline auto parse_serialized_origin(std::string_view origin) noexcept -> url_origin {
+  auto scheme_end = origin.find("://");
+  if ((scheme_end == std::string_view::npos) || !default_port(origin.substr(0, scheme_end))) {
+    return {};
+  }
+  auto scheme = origin.substr(0, scheme_end);
+  auto host = origin.substr(scheme_end + 3);
+  auto port = default_port(scheme).value();
+
+  // an IPv6 address is in square brackets
+  auto port_start = host.find(':', host.starts_with('[') ? host.find(']') : 0);
+  if (port_start != std::string_view::npos) {
+    port = 0;
+    for (auto c : host.substr(port_start + 1)) {
+      port = static_cast<std::uint16_t>((port * 10) + (c - '0'));
+    }
+    host = host.substr(0, port_start);
+  }
+  return url_origin(scheme, host, port);
+}
+}  // namespace details
+}  // namespace skyr::inline v2
+
+namespace std {
+template <>
+struct hash<skyr::v2::url_origin> {
+  auto operator()(const skyr::v2::url_origin &origin) const noexcept -> std::size_t {
+    return origin.hash();
+  }
+};
+}  // namespace std
+
+#endif  // SKYR_V2_CORE_ORIGIN_HPP
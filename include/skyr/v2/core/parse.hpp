@@ -8,38 +8,35 @@
 
 #include <system_error>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <tl/expected.hpp>
 #include <skyr/v2/core/url_record.hpp>
+#include <skyr/v2/core/compact_url_record.hpp>
 #include <skyr/v2/core/errors.hpp>
 #include <skyr/v2/core/check_input.hpp>
+#include <skyr/v2/core/parse_options.hpp>
+#include <skyr/v2/core/stats.hpp>
 #include <skyr/v2/core/url_parser_context.hpp>
+#include <skyr/v2/platform/tracepoints.hpp>
 
 namespace skyr::inline v2 {
 namespace details {
-inline auto basic_parse(std::string_view input, bool *validation_error, const url_record *base, const url_record *url,
-                        std::optional<url_parse_state> state_override) -> tl::expected<url_record, url_parse_errc> {
-  constexpr auto is_tab_or_newline = [](auto byte) { return (byte == '\t') || (byte == '\r') || (byte == '\n'); };
-
-  if (url == nullptr) {
-    input = remove_leading_c0_control_or_space(input, validation_error);
-    input = remove_trailing_c0_control_or_space(input, validation_error);
-  }
-
-  auto context = url_parser_context(input, validation_error, base, url, state_override);
+template <class Builder>
+inline auto run_parser(basic_url_parser_context<Builder> &context) -> tl::expected<void, url_parse_errc> {
+  // the input has no tabs or newlines, see `remove_tab_and_newline`
   while (true) {
-    // remove tabs and new lines
-    while (!context.is_eof() && is_tab_or_newline(context.next_byte())) {
-      context.increment();
+    // copy runs of plain bytes without dispatching on each one
+    if (context.parse_run()) {
+      continue;
     }
 
-    auto action = context.parse_next();
-    if (!action) {
-      return tl::make_unexpected(action.error());
-    }
-
-    switch (action.value()) {
+    switch (context.parse_next()) {
       case url_parse_action::success:
-        return std::move(context).get_url();
+        return {};
+      case url_parse_action::failure:
+        return tl::make_unexpected(context.error());
       case url_parse_action::increment:
         break;
       case url_parse_action::continue_:
@@ -52,12 +49,124 @@ inline auto basic_parse(std::string_view input, bool *validation_error, const ur
     context.increment();
   }
 
-  return std::move(context).get_url();
+  return {};
 }
 
-inline auto parse(std::string_view input, bool *validation_error, const url_record *base)
+inline auto basic_parse(std::string_view input, bool *validation_error, const url_record *base, const url_record *url,
+                        std::optional<url_parse_state> state_override, const parse_options &options = {})
     -> tl::expected<url_record, url_parse_errc> {
-  auto url = basic_parse(input, validation_error, base, nullptr, std::nullopt);
+  SKYR_TRACE2(basic_parse_entry, input.data(), input.size());
+  if (input.size() > options.max_size) {
+    SKYR_TRACE1(basic_parse_return, false);
+    return tl::make_unexpected(url_parse_errc::too_long);
+  }
+
+  if (url == nullptr) {
+    input = remove_leading_c0_control_or_space(input, validation_error);
+    input = remove_trailing_c0_control_or_space(input, validation_error);
+  }
+  auto stripped = std::string{};
+  input = remove_tab_and_newline(input, stripped, validation_error);
+
+  auto new_url = url ? *url : url_record{};
+  auto context =
+      url_parser_context(input, validation_error, base, url_record_builder(new_url), state_override, options);
+  auto result = run_parser(context);
+  count_parse(result.has_value());
+  if (!result) {
+    SKYR_TRACE1(basic_parse_return, false);
+    return tl::make_unexpected(result.error());
+  }
+  if (new_url.query && (details::count_params(new_url.query.value()) > options.max_params)) {
+    SKYR_TRACE1(basic_parse_return, false);
+    return tl::make_unexpected(url_parse_errc::too_many_params);
+  }
+  SKYR_TRACE1(basic_parse_return, true);
+  return new_url;
+}
+
+/// Parses one component of a URL into an existing record
+///
+/// Only the components reached from `state_override` are
+/// written, and the others keep their storage, so an edit
+/// allocates only when a component outgrows its capacity.
+/// Errors are returned before the component is written, except
+/// for the `host` state, which writes the host before it fails
+/// on an invalid port.
+inline auto basic_parse(std::string_view input, bool *validation_error, url_record &url,
+                        url_parse_state state_override) -> tl::expected<void, url_parse_errc> {
+  SKYR_TRACE2(basic_parse_entry, input.data(), input.size());
+  auto stripped = std::string{};
+  input = remove_tab_and_newline(input, stripped, validation_error);
+  auto context = url_parser_context(input, validation_error, nullptr, url_record_builder(url), state_override);
+  auto result = run_parser(context);
+  count_parse(result.has_value());
+  SKYR_TRACE1(basic_parse_return, result.has_value());
+  return result;
+}
+
+/// Parses many inputs, reusing the scratch buffer of the parser
+template <class OutputIterator>
+inline auto parse_many(std::span<const std::string_view> inputs, const url_record *base, OutputIterator out)
+    -> OutputIterator {
+  auto scratch = std::string{};
+  auto stripped = std::string{};
+  for (auto input : inputs) {
+    bool validation_error = false;
+    input = remove_leading_c0_control_or_space(input, &validation_error);
+    input = remove_trailing_c0_control_or_space(input, &validation_error);
+    input = remove_tab_and_newline(input, stripped, &validation_error);
+
+    auto url = url_record{};
+    auto context =
+        url_parser_context(input, &validation_error, base, url_record_builder(url, scratch), std::nullopt);
+    auto result = run_parser(context);
+    count_parse(result.has_value());
+    if (result) {
+      *out = tl::expected<url_record, url_parse_errc>(std::move(url));
+    } else {
+      *out = tl::expected<url_record, url_parse_errc>(tl::unexpect, result.error());
+    }
+    ++out;
+  }
+  return out;
+}
+
+/// An upper bound on the size of the components copied from a base URL
+inline auto base_record_size(const url_record &base) noexcept -> std::size_t {
+  constexpr auto max_host_size = std::size_t(255);
+  auto size = base.scheme.size() + base.username.size() + base.password.size();
+  size += base.host ? max_host_size : 0;
+  size += base.path.chars().size();
+  size += base.query ? base.query.value().size() : 0;
+  return size;
+}
+
+inline auto basic_parse(std::string_view input, bool *validation_error, const url_record *base,
+                        compact_url_record &url) -> tl::expected<void, url_parse_errc> {
+  input = remove_leading_c0_control_or_space(input, validation_error);
+  input = remove_trailing_c0_control_or_space(input, validation_error);
+  auto stripped = std::string{};
+  input = remove_tab_and_newline(input, stripped, validation_error);
+
+  // percent encoding at most triples each byte, so the
+  // buffer does not need to grow while parsing
+  url.clear();
+  url.reserve((3 * input.size()) + (base ? base_record_size(*base) : 0));
+
+  auto context = basic_url_parser_context<compact_url_record_builder>(
+      input, validation_error, base, compact_url_record_builder(url), std::nullopt);
+  auto result = run_parser(context);
+  count_parse(result.has_value());
+  if (!result) {
+    url.clear();
+  }
+  return result;
+}
+
+inline auto parse(std::string_view input, bool *validation_error, const url_record *base,
+                  const parse_options &options = {}) -> tl::expected<url_record, url_parse_errc> {
+  auto url = basic_parse(input, validation_error, base, nullptr, std::nullopt, options);
 
   if (!url) {
     return url;
@@ -93,6 +202,103 @@ inline auto parse(std::string_view input, const url_record &base, bool *validati
     -> tl::expected<url_record, url_parse_errc> {
   return details::parse(input, validation_error, &base);
 }
+
+/// Parses a URL within limits
+///
+/// The parser fails with a specific error as soon as the input
+/// exceeds one of the limits, which bounds the work done on
+/// untrusted input.
+///
+/// ```
+/// auto options = skyr::parse_options{};
+/// options.max_size = 2048;
+/// options.max_label_size = 63;
+/// auto url = skyr::parse(input, options);
+/// ```
+///
+/// \param input The input string
+/// \param options The limits on the URL
+/// \returns A URL record on success and an error code on failure
+inline auto parse(std::string_view input, const parse_options &options) -> tl::expected<url_record, url_parse_errc> {
+  bool validation_error = false;
+  return details::parse(input, &validation_error, nullptr, options);
+}
+
+/// Parses a URL against a base URL within limits
+///
+/// \param input The input string
+/// \param base A base URL
+/// \param options The limits on the URL
+/// \returns A URL record on success and an error code on failure
+inline auto parse(std::string_view input, const url_record &base, const parse_options &options)
+    -> tl::expected<url_record, url_parse_errc> {
+  bool validation_error = false;
+  return details::parse(input, &validation_error, &base, options);
+}
+
+/// Parses many URLs
+///
+/// The inputs are parsed one after the other by the same parser,
+/// which keeps the capacity of its scratch buffer, so only the
+/// components of the records are allocated. Errors are written to
+/// the output instead of being thrown.
+///
+/// ```
+/// auto results = std::vector<tl::expected<skyr::url_record, skyr::url_parse_errc>>{};
+/// results.reserve(inputs.size());
+/// skyr::parse_many(inputs, std::back_inserter(results));
+/// ```
+///
+/// \tparam OutputIterator An output iterator of
+///         `tl::expected<url_record, url_parse_errc>`
+/// \param inputs The input strings
+/// \param out The first output
+/// \returns The output iterator past the last result
+template <class OutputIterator>
+inline auto parse_many(std::span<const std::string_view> inputs, OutputIterator out) -> OutputIterator {
+  return details::parse_many(inputs, nullptr, std::move(out));
+}
+
+/// Parses many URLs against a base URL
+///
+/// \tparam OutputIterator An output iterator of
+///         `tl::expected<url_record, url_parse_errc>`
+/// \param inputs The input strings
+/// \param base A base URL
+/// \param out The first output
+/// \returns The output iterator past the last result
+template <class OutputIterator>
+inline auto parse_many(std::span<const std::string_view> inputs, const url_record &base, OutputIterator out)
+    -> OutputIterator {
+  return details::parse_many(inputs, &base, std::move(out));
+}
+
+/// Parses a URL into a record owned by the caller
+///
+/// The components are written into the single buffer held by
+/// `url`. A record reused for many parses keeps its capacity, so
+/// once it is large enough parsing does not allocate, except
+/// where the host parser does.
+///
+/// \param input The input string
+/// \param url The record to write to. It is cleared on failure
+/// \returns An error on failure
+inline auto parse(std::string_view input, compact_url_record &url) -> tl::expected<void, url_parse_errc> {
+  bool validation_error = false;
+  return details::basic_parse(input, &validation_error, nullptr, url);
+}
+
+/// Parses a URL into a record owned by the caller
+///
+/// \param input The input string
+/// \param base A base URL
+/// \param url The record to write to. It is cleared on failure
+/// \returns An error on failure
+inline auto parse(std::string_view input, const url_record &base, compact_url_record &url)
+    -> tl::expected<void, url_parse_errc> {
+  bool validation_error = false;
+  return details::basic_parse(input, &validation_error, &base, url);
+}
 }  // namespace skyr::inline v2
 
 #endif  // SKYR_V2_CORE_PARSE_HPP
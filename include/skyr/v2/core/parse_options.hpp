@@ -0,0 +1,69 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_PARSE_OPTIONS_HPP
+#define SKYR_V2_CORE_PARSE_OPTIONS_HPP
+
+#include <cstddef>
+#include <limits>
+#include <string_view>
+
+namespace skyr::inline v2 {
+/// Limits on the URLs accepted by the parser
+///
+/// These bound the work done on untrusted input. The parser fails
+/// with a specific error as soon as a limit is exceeded, and the
+/// host limits are checked before the host is decoded and passed
+/// to the IDNA algorithm. Default constructed options have no
+/// limits.
+struct parse_options {
+  /// The largest number of bytes in the input
+  std::size_t max_size = std::numeric_limits<std::size_t>::max();
+  /// The largest number of path segments
+  std::size_t max_segments = std::numeric_limits<std::size_t>::max();
+  /// The largest number of name-value pairs in the query
+  std::size_t max_params = std::numeric_limits<std::size_t>::max();
+  /// The largest number of bytes in the host, before it is decoded
+  std::size_t max_host_size = std::numeric_limits<std::size_t>::max();
+  /// The largest number of bytes in a label of the host, before it
+  /// is decoded, which bounds the work of the Punycode encoder
+  std::size_t max_label_size = std::numeric_limits<std::size_t>::max();
+};
+
+namespace details {
+/// The size of the largest label of a host, the labels being
+/// separated by dots
+constexpr inline auto max_label_size(std::string_view host) noexcept -> std::size_t {
+  auto result = std::size_t(0);
+  while (true) {
+    auto dot = host.find('.');
+    auto size = (dot == std::string_view::npos) ? host.size() : dot;
+    result = (size > result) ? size : result;
+    if (dot == std::string_view::npos) {
+      return result;
+    }
+    host.remove_prefix(dot + 1);
+  }
+}
+
+/// The number of name-value pairs in a query
+constexpr inline auto count_params(std::string_view query) noexcept -> std::size_t {
+  auto result = std::size_t(0);
+  while (!query.empty()) {
+    auto amp = query.find('&');
+    if (amp != 0) {
+      ++result;
+    }
+    if (amp == std::string_view::npos) {
+      break;
+    }
+    query.remove_prefix(amp + 1);
+  }
+  return result;
+}
+}  // namespace details
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_PARSE_OPTIONS_HPP
@@ -0,0 +1,180 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_PARSER_STATS_HPP
+#define SKYR_V2_CORE_PARSER_STATS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <skyr/v2/core/url_parse_state.hpp>
+
+namespace skyr::inline v2 {
+/// The kinds of validation error found by the URL parser
+///
+/// The names follow the validation errors of the WHATWG URL
+/// specification. The errors found while parsing a host are
+/// counted together as `host_invalid`.
+enum class validation_error_kind {
+  /// A code point which is not a URL code point, or a '%'
+  /// which does not start a percent-encoded byte
+  invalid_url_unit,
+  /// A special scheme which is not followed by "//"
+  special_scheme_missing_following_solidus,
+  /// A relative URL without a base URL
+  missing_scheme_non_relative_url,
+  /// A '\' used as a '/' in a special URL
+  invalid_reverse_solidus,
+  /// A '@' in the authority
+  invalid_credentials,
+  /// An empty host in a URL which needs one
+  host_missing,
+  /// An error found while parsing the host
+  host_invalid,
+  /// A port which is not a number, or is out of range
+  port_invalid,
+  /// A Windows drive letter in a relative file URL
+  file_invalid_windows_drive_letter,
+  /// A Windows drive letter in the host of a file URL
+  file_invalid_windows_drive_letter_host,
+  /// A scheme which starts with a character other than a letter
+  invalid_scheme,
+  /// An empty segment removed from the start of a file path
+  file_empty_path_segment,
+};
+
+/// The number of values of `url_parse_state`
+inline constexpr auto url_parse_state_count = static_cast<std::size_t>(url_parse_state::fragment) + 1;
+
+/// The number of values of `validation_error_kind`
+inline constexpr auto validation_error_kind_count =
+    static_cast<std::size_t>(validation_error_kind::file_empty_path_segment) + 1;
+
+/// Counters of the work done by the states of the URL parser
+///
+/// The counters are only updated when the code is compiled with
+/// `SKYR_ENABLE_PARSER_STATS` defined, otherwise they stay zero
+/// and the hooks compile to nothing. They are kept per thread,
+/// so updating them needs no synchronization, and each thread
+/// reads its own counters. They are meant to explain the
+/// parses which take much longer than the others.
+struct parser_stats {
+  /// The number of visits to each state, indexed by
+  /// `url_parse_state`
+  ///
+  /// A state is visited once for each byte it handles one at a
+  /// time, and once at the end of the input.
+  std::array<std::size_t, url_parse_state_count> state_visits = {};
+  /// The number of bytes handled by each state, indexed by
+  /// `url_parse_state`, including the runs of bytes which are
+  /// copied without a visit
+  std::array<std::size_t, url_parse_state_count> state_bytes = {};
+  /// The number of validation errors of each kind, indexed by
+  /// `validation_error_kind`
+  std::array<std::size_t, validation_error_kind_count> validation_errors = {};
+  /// The number of hosts parsed
+  std::size_t host_parses = 0;
+  /// The time spent parsing hosts, including `domain_to_ascii`
+  std::chrono::nanoseconds host_time = {};
+  /// The number of calls to `domain_to_ascii`, including those
+  /// answered by a domain cache
+  std::size_t domain_to_ascii_calls = 0;
+  /// The time spent in `domain_to_ascii`
+  std::chrono::nanoseconds domain_to_ascii_time = {};
+
+  /// \returns The number of visits to `state`
+  [[nodiscard]] auto visits(url_parse_state state) const noexcept -> std::size_t {
+    return state_visits[static_cast<std::size_t>(state)];
+  }
+
+  /// \returns The number of bytes handled by `state`
+  [[nodiscard]] auto bytes(url_parse_state state) const noexcept -> std::size_t {
+    return state_bytes[static_cast<std::size_t>(state)];
+  }
+
+  /// \returns The number of validation errors of `kind`
+  [[nodiscard]] auto errors(validation_error_kind kind) const noexcept -> std::size_t {
+    return validation_errors[static_cast<std::size_t>(kind)];
+  }
+};
+
+namespace details {
+inline auto parser_stats_instance() noexcept -> parser_stats & {
+  thread_local auto stats = parser_stats{};
+  return stats;
+}
+
+inline void count_state([[maybe_unused]] url_parse_state state, [[maybe_unused]] std::size_t bytes) noexcept {
+#if defined(SKYR_ENABLE_PARSER_STATS)
+  auto &stats = parser_stats_instance();
+  ++stats.state_visits[static_cast<std::size_t>(state)];
+  stats.state_bytes[static_cast<std::size_t>(state)] += bytes;
+#endif
+}
+
+inline void count_state_run([[maybe_unused]] url_parse_state state, [[maybe_unused]] std::size_t bytes) noexcept {
+#if defined(SKYR_ENABLE_PARSER_STATS)
+  parser_stats_instance().state_bytes[static_cast<std::size_t>(state)] += bytes;
+#endif
+}
+
+inline void count_validation_error([[maybe_unused]] validation_error_kind kind) noexcept {
+#if defined(SKYR_ENABLE_PARSER_STATS)
+  ++parser_stats_instance().validation_errors[static_cast<std::size_t>(kind)];
+#endif
+}
+
+/// Adds the time between its construction and its destruction
+/// to a counter of `parser_stats`
+class parser_timer {
+ public:
+#if defined(SKYR_ENABLE_PARSER_STATS)
+  parser_timer(std::size_t parser_stats::*calls, std::chrono::nanoseconds parser_stats::*time) noexcept
+      : calls_(calls), time_(time), start_(std::chrono::steady_clock::now()) {
+  }
+
+  ~parser_timer() {
+    auto &stats = parser_stats_instance();
+    ++(stats.*calls_);
+    stats.*time_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+  }
+#else
+  parser_timer(std::size_t parser_stats::*, std::chrono::nanoseconds parser_stats::*) noexcept {
+  }
+#endif
+
+  parser_timer(const parser_timer &) = delete;
+  auto operator=(const parser_timer &) -> parser_timer & = delete;
+
+#if defined(SKYR_ENABLE_PARSER_STATS)
+ private:
+  std::size_t parser_stats::*calls_;
+  std::chrono::nanoseconds parser_stats::*time_;
+  std::chrono::steady_clock::time_point start_;
+#endif
+};
+}  // namespace details
+
+/// \returns `true` if the counters are updated
+constexpr auto parser_stats_enabled() noexcept -> bool {
+#if defined(SKYR_ENABLE_PARSER_STATS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// \returns A copy of the counters of the calling thread
+inline auto get_parser_stats() noexcept -> parser_stats {
+  return details::parser_stats_instance();
+}
+
+/// Sets every counter of the calling thread to zero
+inline void reset_parser_stats() noexcept {
+  details::parser_stats_instance() = parser_stats{};
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_PARSER_STATS_HPP
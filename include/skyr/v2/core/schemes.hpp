@@ -11,24 +11,66 @@
 #include <optional>
 
 namespace skyr::inline v2 {
+namespace details {
+/// Packs a scheme of up to seven characters, and its length,
+/// into an integer, so that it is compared in a single operation
+/// \param scheme
+/// \returns The packed scheme, or zero if it is too long
+constexpr inline auto scheme_key(std::string_view scheme) noexcept -> std::uint64_t {
+  if (scheme.size() > 7) {
+    return 0;
+  }
+  auto key = static_cast<std::uint64_t>(scheme.size()) << 56;
+  for (auto i = 0UL; i < scheme.size(); ++i) {
+    key |= static_cast<std::uint64_t>(static_cast<unsigned char>(scheme[i])) << (8 * i);
+  }
+  return key;
+}
+
+/// A special scheme and its default port
+struct special_scheme {
+  std::uint64_t key;
+  std::string_view name;
+  std::optional<std::uint16_t> port;
+};
+
+constexpr inline auto make_special_scheme(std::string_view name, std::optional<std::uint16_t> port) noexcept
+    -> special_scheme {
+  return {scheme_key(name), name, port};
+}
+
+/// The special schemes. Every function which maps a scheme to
+/// a property reads this table
+inline constexpr special_scheme special_schemes[] = {
+    make_special_scheme("ftp", 21),  make_special_scheme("file", std::nullopt),
+    make_special_scheme("http", 80), make_special_scheme("https", 443),
+    make_special_scheme("ws", 80),   make_special_scheme("wss", 443),
+};
+
+/// \param scheme
+/// \returns The entry of a special scheme, or `nullptr`
+constexpr inline auto find_special_scheme(std::string_view scheme) noexcept -> const special_scheme * {
+  auto key = scheme_key(scheme);
+  for (const auto &entry : special_schemes) {
+    if (entry.key == key) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+}  // namespace details
+
 /// \param scheme
 /// \returns
 constexpr inline auto is_special(std::string_view scheme) noexcept -> bool {
-  return (scheme == "file") || (scheme == "ftp") || (scheme == "http") || (scheme == "https") || (scheme == "ws") ||
-         (scheme == "wss");
+  return details::find_special_scheme(scheme) != nullptr;
 }
 
 /// \param scheme
 /// \returns
 constexpr inline auto default_port(std::string_view scheme) noexcept -> std::optional<std::uint16_t> {
-  if (scheme == "ftp") {
-    return 21;
-  } else if ((scheme == "http") || (scheme == "ws")) {
-    return 80;
-  } else if ((scheme == "https") || (scheme == "wss")) {
-    return 443;
-  }
-  return std::nullopt;
+  auto entry = details::find_special_scheme(scheme);
+  return entry ? entry->port : std::nullopt;
 }
 }  // namespace skyr::inline v2
 
@@ -6,50 +6,178 @@
 #ifndef SKYR_V2_CORE_SERIALIZE_HPP
 #define SKYR_V2_CORE_SERIALIZE_HPP
 
-#include <fmt/format.h>
-#include <range/v3/view/join.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
 #include <skyr/v2/core/url_record.hpp>
+#include <skyr/v2/core/compact_url_record.hpp>
 
 namespace skyr::inline v2 {
 namespace details {
-inline auto serialize_password(const url_record &url) -> std::string {
-  return !url.password.empty() ? fmt::format(":{}", url.password) : std::string{};
-}
+/// The pieces of a serialized URL record, in order
+///
+/// The pieces refer to the components of the record, or to
+/// buffers of this object for the IP addresses and the port, so
+/// the size of the serialization is known before it is written,
+/// without allocating.
+class serialized_url_pieces {
+ public:
+  serialized_url_pieces(const url_record &url, bool include_fragment) noexcept {
+    using namespace std::string_view_literals;
 
-inline auto serialize_credentials(const url_record &url) -> std::string {
-  return url.includes_credentials() ? fmt::format("{}{}@", url.username, serialize_password(url)) : std::string{};
-}
+    push_back(url.scheme);
+    push_back(":"sv);
+    if (url.host) {
+      push_back("//"sv);
+      if (url.includes_credentials()) {
+        push_back(url.username);
+        if (!url.password.empty()) {
+          push_back(":"sv);
+          push_back(url.password);
+        }
+        push_back("@"sv);
+      }
+      push_back(url.host.value().serialize_to(host_));
+      if (url.port) {
+        push_back(":"sv);
+        auto last = std::to_chars(std::begin(port_), std::end(port_), url.port.value()).ptr;
+        push_back(std::string_view(port_, static_cast<std::size_t>(last - port_)));
+      }
+    } else if (url.scheme == "file") {
+      push_back("//"sv);
+    }
 
-inline auto serialize_port(const url_record &url) -> std::string {
-  return url.port ? fmt::format(":{}", url.port.value()) : std::string{};
-}
+    if (url.cannot_be_a_base_url) {
+      push_back(url.path.front());
+    } else if (url.path.empty()) {
+      push_back("/"sv);
+    } else {
+      push_back(url.path.chars());
+    }
 
-inline auto serialize_file_scheme(const url_record &url) -> std::string {
-  return (!url.host && (url.scheme == "file")) ? "//" : "";
-}
+    if (url.query) {
+      push_back("?"sv);
+      push_back(url.query.value());
+    }
+    if (include_fragment && url.fragment) {
+      push_back("#"sv);
+      push_back(url.fragment.value());
+    }
+  }
+
+  serialized_url_pieces(const serialized_url_pieces &) = delete;
+  auto operator=(const serialized_url_pieces &) -> serialized_url_pieces & = delete;
+
+  /// \returns The size of the serialization
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return size_;
+  }
+
+  /// Writes the serialization to a buffer of at least `size()`
+  /// characters
+  void write_to(char *buffer) const noexcept {
+    for (auto i = 0U; i < count_; ++i) {
+      std::copy(std::cbegin(pieces_[i]), std::cend(pieces_[i]), buffer);  // NOLINT
+      buffer += pieces_[i].size();                                          // NOLINT
+    }
+  }
 
-inline auto serialize_authority(const url_record &url) -> std::string {
-  return url.host
-             ? fmt::format("//{}{}{}", serialize_credentials(url), url.host.value().serialize(), serialize_port(url))
-             : serialize_file_scheme(url);
+  /// Appends the serialization to `output`, which grows at most once
+  void append_to(std::string &output) const {
+    output.reserve(output.size() + size_);
+    for (auto i = 0U; i < count_; ++i) {
+      output += pieces_[i];  // NOLINT
+    }
+  }
+
+ private:
+  void push_back(std::string_view piece) noexcept {
+    pieces_[count_++] = piece;  // NOLINT
+    size_ += piece.size();
+  }
+
+  // scheme ":" "//" username ":" password "@" host ":" port path
+  // "?" query "#" fragment
+  std::array<std::string_view, 15> pieces_{};
+  std::size_t count_ = 0;
+  std::size_t size_ = 0;
+  char host_[host::max_serialized_address_size] = {};
+  char port_[5] = {};
+};
+
+inline void serialize_excluding_fragment(const url_record &url, std::string &output) {
+  serialized_url_pieces(url, false).append_to(output);
 }
 
-inline auto serialize_path(const std::vector<std::string> &path) -> std::string {
-  return fmt::format("/{}", path | ranges::views::join('/') | ranges::to<std::string>());
+inline void serialize_excluding_fragment(const compact_url_record &url, std::string &output) {
+  output += url.scheme();
+  output += ':';
+  if (url.host()) {
+    output += "//";
+    if (url.includes_credentials()) {
+      output += url.username();
+      if (!url.password().empty()) {
+        output += ':';
+        output += url.password();
+      }
+      output += '@';
+    }
+    output += url.host().value();
+    if (url.port()) {
+      char port[5];
+      auto last = std::to_chars(std::begin(port), std::end(port), url.port().value()).ptr;
+      output += ':';
+      output.append(port, last);
+    }
+  } else if (url.scheme() == "file") {
+    output += "//";
+  }
+  if (!url.cannot_be_a_base_url() && url.path().empty()) {
+    output += '/';
+  } else {
+    output += url.path();
+  }
+  if (url.query()) {
+    output += '?';
+    output += url.query().value();
+  }
 }
+}  // namespace details
 
-inline auto serialize_path(const url_record &url) -> std::string {
-  return url.cannot_be_a_base_url ? url.path.front() : serialize_path(url.path);
+/// The size of the serialization of a URL record
+///
+/// \param url A URL record
+/// \returns The exact size of `serialize(url)`
+inline auto serialized_size(const url_record &url) noexcept -> std::size_t {
+  return details::serialized_url_pieces(url, true).size();
 }
 
-inline auto serialize_query(const url_record &url) -> std::string {
-  return url.query ? fmt::format("?{}", url.query.value()) : std::string{};
+/// Serializes a URL record to a buffer
+///
+/// \param url A URL record
+/// \param buffer A buffer of at least `serialized_size(url)`
+///               characters
+/// \returns The number of characters written
+inline auto serialize_to(const url_record &url, char *buffer) noexcept -> std::size_t {
+  auto pieces = details::serialized_url_pieces(url, true);
+  pieces.write_to(buffer);
+  return pieces.size();
 }
 
-inline auto serialize_fragment(const url_record &url) -> std::string {
-  return url.fragment ? fmt::format("#{}", url.fragment.value()) : std::string{};
+/// Serializes a URL record at the end of a string
+///
+/// The size of the serialization is computed first, so `output`
+/// grows at most once, and not at all if it has the capacity.
+///
+/// \param url A URL record
+/// \param output The string to append to
+inline void serialize_to(const url_record &url, std::string &output) {
+  details::serialized_url_pieces(url, true).append_to(output);
 }
-}  // namespace details
 
 /// Serializes a URL record according to the
 /// [WhatWG specification](https://url.spec.whatwg.org/#url-serializing)
@@ -57,8 +185,9 @@ inline auto serialize_fragment(const url_record &url) -> std::string {
 /// \param url A URL record
 /// \returns A serialized URL string, excluding the fragment
 inline auto serialize_excluding_fragment(const url_record &url) -> url_record::string_type {
-  return fmt::format("{}:{}{}{}", url.scheme, details::serialize_authority(url), details::serialize_path(url),
-                     details::serialize_query(url));
+  auto output = url_record::string_type{};
+  details::serialize_excluding_fragment(url, output);
+  return output;
 }
 
 /// Serializes a URL record according to the
@@ -67,7 +196,35 @@ inline auto serialize_excluding_fragment(const url_record &url) -> url_record::s
 /// \param url A URL record
 /// \returns A serialized URL string
 inline auto serialize(const url_record &url) -> url_record::string_type {
-  return fmt::format("{}{}", serialize_excluding_fragment(url), details::serialize_fragment(url));
+  auto output = url_record::string_type{};
+  serialize_to(url, output);
+  return output;
+}
+
+/// Serializes a compact URL record according to the
+/// [WhatWG specification](https://url.spec.whatwg.org/#url-serializing)
+///
+/// \param url A compact URL record
+/// \returns A serialized URL string, excluding the fragment
+inline auto serialize_excluding_fragment(const compact_url_record &url) -> compact_url_record::string_type {
+  auto output = compact_url_record::string_type{};
+  details::serialize_excluding_fragment(url, output);
+  return output;
+}
+
+/// Serializes a compact URL record according to the
+/// [WhatWG specification](https://url.spec.whatwg.org/#url-serializing)
+///
+/// \param url A compact URL record
+/// \returns A serialized URL string
+inline auto serialize(const compact_url_record &url) -> compact_url_record::string_type {
+  auto output = compact_url_record::string_type{};
+  details::serialize_excluding_fragment(url, output);
+  if (url.fragment()) {
+    output += '#';
+    output += url.fragment().value();
+  }
+  return output;
 }
 }  // namespace skyr::inline v2
 
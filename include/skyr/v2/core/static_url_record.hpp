@@ -0,0 +1,889 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_STATIC_URL_RECORD_HPP
+#define SKYR_V2_CORE_STATIC_URL_RECORD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <version>
+#include <skyr/v2/core/compact_url_record.hpp>
+#include <skyr/v2/core/errors.hpp>
+#include <skyr/v2/core/host.hpp>
+#include <skyr/v2/core/schemes.hpp>
+#include <skyr/v2/core/url_parser_context.hpp>
+#include <skyr/v2/core/url_record.hpp>
+#include <skyr/v2/network/ipv4_address.hpp>
+#include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
+
+namespace skyr::inline v2 {
+namespace details {
+template <std::size_t Capacity>
+class static_url_record_builder;
+}  // namespace details
+
+/// Represents the parts of a URL identifier in a fixed size buffer
+///
+/// This has the layout of `compact_url_record`, with an array in
+/// place of the string, so that a URL can be parsed when the program
+/// is compiled, and stored as a constant. It is created by the
+/// `_static_url` literal.
+///
+/// \tparam Capacity The number of characters in the buffer
+template <std::size_t Capacity>
+class static_url_record {
+ public:
+  /// The type of the host, if the URL has one
+  using host_kind = compact_url_record::host_kind;
+
+  /// Default constructor
+  constexpr static_url_record() = default;
+
+  /// \returns An ASCII string that identifies the type of URL
+  [[nodiscard]] constexpr auto scheme() const noexcept -> std::string_view {
+    return part(scheme_id);
+  }
+
+  /// \returns An ASCII string identifying a username
+  [[nodiscard]] constexpr auto username() const noexcept -> std::string_view {
+    return part(username_id);
+  }
+
+  /// \returns An ASCII string identifying a password
+  [[nodiscard]] constexpr auto password() const noexcept -> std::string_view {
+    return part(password_id);
+  }
+
+  /// \returns The serialized host, if there is one
+  [[nodiscard]] constexpr auto host() const noexcept -> std::optional<std::string_view> {
+    return (host_kind_ != host_kind::none) ? std::make_optional(part(host_id)) : std::nullopt;
+  }
+
+  /// \returns The type of the host
+  [[nodiscard]] constexpr auto host_type() const noexcept -> host_kind {
+    return host_kind_;
+  }
+
+  /// \returns An optional network port
+  [[nodiscard]] constexpr auto port() const noexcept -> std::optional<std::uint16_t> {
+    return port_;
+  }
+
+  /// \returns The serialized path
+  [[nodiscard]] constexpr auto path() const noexcept -> std::string_view {
+    return part(path_id);
+  }
+
+  /// \returns The number of path segments
+  [[nodiscard]] constexpr auto path_size() const noexcept -> std::size_t {
+    return path_size_;
+  }
+
+  /// \returns An optional ASCII string
+  [[nodiscard]] constexpr auto query() const noexcept -> std::optional<std::string_view> {
+    return has_query_ ? std::make_optional(part(query_id)) : std::nullopt;
+  }
+
+  /// \returns An optional ASCII string
+  [[nodiscard]] constexpr auto fragment() const noexcept -> std::optional<std::string_view> {
+    return has_fragment_ ? std::make_optional(part(fragment_id)) : std::nullopt;
+  }
+
+  /// \returns `true` if this URL cannot be used as a base URL
+  [[nodiscard]] constexpr auto cannot_be_a_base_url() const noexcept -> bool {
+    return cannot_be_a_base_url_;
+  }
+
+  /// Tests if the URL is a special scheme
+  /// \returns `true` if the URL scheme is a special scheme, `false`
+  ///          otherwise
+  [[nodiscard]] constexpr auto is_special() const noexcept -> bool {
+    return skyr::is_special(scheme());
+  }
+
+  /// Tests if the URL includes credentials
+  /// \returns `true` if the URL username or password is not an
+  ///          empty string, `false` otherwise
+  [[nodiscard]] constexpr auto includes_credentials() const noexcept -> bool {
+    return !username().empty() || !password().empty();
+  }
+
+  /// \returns The number of characters of the components
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    return offsets_[end_id];
+  }
+
+  /// \returns The number of characters that can be held
+  [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t {
+    return Capacity;
+  }
+
+  /// Copies the components into a `url_record`
+  /// \returns A `url_record` with the same components
+  [[nodiscard]] auto to_url_record() const -> url_record {
+    auto record = url_record{};
+    record.scheme = scheme();
+    record.username = username();
+    record.password = password();
+    record.host = make_host();
+    record.port = port_;
+    auto path = part(path_id);
+    if (cannot_be_a_base_url_) {
+      record.path.emplace_back(path);
+    } else {
+      record.path.reserve(path_size_, path.size());
+      while (!path.empty()) {
+        auto last = path.find('/', 1);
+        record.path.emplace_back(path.substr(1, last - 1));
+        path.remove_prefix((last != std::string_view::npos) ? last : path.size());
+      }
+    }
+    if (has_query_) {
+      record.query = part(query_id);
+    }
+    if (has_fragment_) {
+      record.fragment = part(fragment_id);
+    }
+    record.cannot_be_a_base_url = cannot_be_a_base_url_;
+    return record;
+  }
+
+ private:
+  template <std::size_t>
+  friend class details::static_url_record_builder;
+
+  enum component : unsigned char {
+    scheme_id = 0,
+    username_id,
+    password_id,
+    host_id,
+    path_id,
+    query_id,
+    fragment_id,
+    end_id,
+  };
+
+  [[nodiscard]] constexpr auto part(component id) const noexcept -> std::string_view {
+    return std::string_view(buffer_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]);
+  }
+
+  // Replaces `count` characters at `pos` in the component
+  constexpr void splice(component id, std::size_t pos, std::size_t count, std::string_view s) {
+    auto first = std::begin(buffer_) + offsets_[id] + pos;
+    auto last = std::begin(buffer_) + offsets_[end_id];
+    if (s.size() > count) {
+      std::copy_backward(first + count, last, last + (s.size() - count));
+    } else {
+      std::copy(first + count, last, first + s.size());
+    }
+    std::copy(std::begin(s), std::end(s), first);
+    for (auto i = id + 1; i <= end_id; ++i) {
+      offsets_[i] = offsets_[i] + s.size() - count;
+    }
+  }
+
+  constexpr void append(component id, std::string_view s) {
+    splice(id, offsets_[id + 1] - offsets_[id], 0, s);
+  }
+
+  [[nodiscard]] auto make_host() const -> std::optional<skyr::v2::host> {
+    auto name = part(host_id);
+    auto validation_error = false;
+    switch (host_kind_) {
+      case host_kind::domain_name:
+        return skyr::v2::host{skyr::v2::domain_name{std::string(name)}};
+      case host_kind::ipv4_address:
+        return skyr::v2::host{parse_ipv4_address(name, &validation_error).value()};
+      case host_kind::ipv6_address:
+        return skyr::v2::host{parse_ipv6_address(name.substr(1, name.size() - 2), &validation_error).value()};
+      case host_kind::opaque_host:
+        return skyr::v2::host{skyr::v2::opaque_host{std::string(name)}};
+      case host_kind::empty:
+        return skyr::v2::host{skyr::v2::empty_host{}};
+      case host_kind::none:
+        break;
+    }
+    return std::nullopt;
+  }
+
+  std::array<char, Capacity> buffer_ = {};
+  std::array<std::size_t, end_id + 1> offsets_ = {};
+  std::size_t path_size_ = 0;
+  std::optional<std::uint16_t> port_;
+  host_kind host_kind_ = host_kind::none;
+  bool has_query_ = false;
+  bool has_fragment_ = false;
+  bool cannot_be_a_base_url_ = false;
+};
+
+namespace details {
+/// Writes the components of a URL into a `static_url_record`
+///
+/// The components are written in order, and the only one that is
+/// changed after it is written is the path, which is at the end of
+/// the buffer until the query or fragment is written.
+template <std::size_t Capacity>
+class static_url_record_builder {
+  using record = static_url_record<Capacity>;
+
+ public:
+  constexpr explicit static_url_record_builder(record &url) noexcept : url_(url) {
+  }
+
+  [[nodiscard]] constexpr auto scheme() const noexcept -> std::string_view {
+    return url_.scheme();
+  }
+
+  constexpr void append_to_scheme(char byte) {
+    url_.append(record::scheme_id, std::string_view(&byte, 1));
+  }
+
+  constexpr void append_to_username(std::string_view s) {
+    url_.append(record::username_id, s);
+  }
+
+  constexpr void append_to_password(std::string_view s) {
+    url_.append(record::password_id, s);
+  }
+
+  constexpr void append_to_host(std::string_view s) {
+    url_.append(record::host_id, s);
+  }
+
+  constexpr void set_host_kind(typename record::host_kind kind) noexcept {
+    url_.host_kind_ = kind;
+  }
+
+  constexpr void set_port(std::optional<std::uint16_t> port) noexcept {
+    url_.port_ = port;
+  }
+
+  constexpr void set_cannot_be_a_base_url() noexcept {
+    url_.cannot_be_a_base_url_ = true;
+  }
+
+  [[nodiscard]] constexpr auto path_size() const noexcept -> std::size_t {
+    return url_.path_size_;
+  }
+
+  [[nodiscard]] constexpr auto path_front() const noexcept -> std::string_view {
+    auto path = url_.part(record::path_id);
+    return path.substr(1, path.find('/', 1) - 1);
+  }
+
+  constexpr void push_back_path(std::string_view segment) {
+    if (!url_.cannot_be_a_base_url_) {
+      url_.append(record::path_id, "/");
+    }
+    url_.append(record::path_id, segment);
+    ++url_.path_size_;
+  }
+
+  constexpr void pop_back_path() {
+    auto path = url_.part(record::path_id);
+    auto pos = path.rfind('/');
+    url_.splice(record::path_id, pos, path.size() - pos, {});
+    --url_.path_size_;
+  }
+
+  constexpr void pop_front_path() {
+    auto path = url_.part(record::path_id);
+    auto pos = std::min(path.find('/', 1), path.size());
+    url_.splice(record::path_id, 0, pos, {});
+    --url_.path_size_;
+  }
+
+  constexpr void append_to_path_front(std::string_view s) {
+    url_.append(record::path_id, s);
+  }
+
+  constexpr void append_to_query(std::string_view s) {
+    url_.has_query_ = true;
+    url_.append(record::query_id, s);
+  }
+
+  constexpr void append_to_fragment(std::string_view s) {
+    url_.has_fragment_ = true;
+    url_.append(record::fragment_id, s);
+  }
+
+  /// Copies the components into a record of another capacity, of at
+  /// least the size of the components
+  template <std::size_t OtherCapacity>
+  [[nodiscard]] constexpr auto copy() const -> static_url_record<OtherCapacity> {
+    auto url = static_url_record<OtherCapacity>{};
+    std::copy_n(std::begin(url_.buffer_), url_.size(), std::begin(url.buffer_));
+    url.offsets_ = url_.offsets_;
+    url.path_size_ = url_.path_size_;
+    url.port_ = url_.port_;
+    url.host_kind_ = url_.host_kind_;
+    url.has_query_ = url_.has_query_;
+    url.has_fragment_ = url_.has_fragment_;
+    url.cannot_be_a_base_url_ = url_.cannot_be_a_base_url_;
+    return url;
+  }
+
+ private:
+  record &url_;
+};
+
+/// The result of parsing a URL literal
+enum class static_parse_status {
+  /// The URL was parsed
+  success,
+  /// The URL is not valid
+  failure,
+  /// The URL needs the run time parser
+  unsupported,
+};
+
+/// The record and status of a parsed URL literal
+template <std::size_t Capacity>
+struct static_parse_result {
+  static_url_record<Capacity> url;
+  static_parse_status status = static_parse_status::success;
+  std::optional<url_parse_errc> error;
+};
+
+/// \param size The number of characters of a URL string
+/// \returns A capacity that can hold the parsed URL
+constexpr inline auto static_parse_capacity(std::size_t size) noexcept -> std::size_t {
+  // each character is percent-encoded at most, and a special URL
+  // with no path is given the path "/"
+  return (3 * size) + 1;
+}
+
+/// Parses the URLs that can be parsed at compile time, according to
+/// the [WhatWG specification](https://url.spec.whatwg.org/#url-parsing)
+///
+/// The input is an absolute URL of ASCII characters. Each part that
+/// would need the run time parser makes the result `unsupported`:
+/// special hosts with characters other than letters, digits, hyphens
+/// and dots, which need IDNA processing, Punycode labels, IPv6
+/// addresses, IPv4 addresses that are not four decimal numbers,
+/// percent-encoded hosts, several `'@'` in the authority and Windows
+/// drive letters in file URLs.
+template <std::size_t Capacity>
+class static_url_parser {
+  using host_kind = compact_url_record::host_kind;
+
+ public:
+  constexpr explicit static_url_parser(std::string_view input) : input_(input), url_(result_.url) {
+  }
+
+  [[nodiscard]] constexpr auto parse() -> static_parse_result<Capacity> {
+    strip_input();
+    if (result_.status == static_parse_status::success) {
+      parse_url();
+    }
+    return result_;
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto is_alpha(char byte) noexcept {
+    return ((byte >= 'a') && (byte <= 'z')) || ((byte >= 'A') && (byte <= 'Z'));
+  }
+
+  [[nodiscard]] static constexpr auto is_digit(char byte) noexcept {
+    return (byte >= '0') && (byte <= '9');
+  }
+
+  [[nodiscard]] static constexpr auto is_hex_digit(char byte) noexcept {
+    return is_digit(byte) || (((byte | 0x20) >= 'a') && ((byte | 0x20) <= 'f'));
+  }
+
+  [[nodiscard]] static constexpr auto to_lower(char byte) noexcept {
+    return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte | 0x20) : byte;
+  }
+
+  constexpr void fail(url_parse_errc error) {
+    if (result_.status == static_parse_status::success) {
+      result_.status = static_parse_status::failure;
+      result_.error = error;
+    }
+  }
+
+  constexpr void unsupported() {
+    if (result_.status == static_parse_status::success) {
+      result_.status = static_parse_status::unsupported;
+    }
+  }
+
+  [[nodiscard]] constexpr auto ok() const noexcept {
+    return result_.status == static_parse_status::success;
+  }
+
+  // Removes the leading and trailing C0 control or space, and the
+  // tabs and newlines
+  constexpr void strip_input() {
+    while (!input_.empty() && (static_cast<unsigned char>(input_.front()) <= 0x20)) {
+      input_.remove_prefix(1);
+    }
+    while (!input_.empty() && (static_cast<unsigned char>(input_.back()) <= 0x20)) {
+      input_.remove_suffix(1);
+    }
+    if (static_parse_capacity(input_.size()) > Capacity) {
+      unsupported();
+      return;
+    }
+
+    auto size = std::size_t(0);
+    for (auto byte : input_) {
+      if (static_cast<unsigned char>(byte) >= 0x80) {
+        unsupported();
+        return;
+      }
+      if ((byte != '\t') && (byte != '\n') && (byte != '\r')) {
+        buffer_[size++] = byte;
+      }
+    }
+    input_ = std::string_view(buffer_.data(), size);
+  }
+
+  [[nodiscard]] constexpr auto is_special() const noexcept {
+    return skyr::is_special(url_.scheme());
+  }
+
+  [[nodiscard]] constexpr auto is_path_delimiter(char byte) const noexcept {
+    return (byte == '/') || (is_special() && (byte == '\\'));
+  }
+
+  // The first of the delimiters in the rest of the input
+  [[nodiscard]] constexpr auto find_delimiter(std::string_view delimiters) const noexcept {
+    return std::min(input_.find_first_of(delimiters), input_.size());
+  }
+
+  // The end of the authority, or of the host of a file URL
+  [[nodiscard]] constexpr auto find_end_of_host() const noexcept {
+    return find_delimiter(is_special() ? "/\\?#" : "/?#");
+  }
+
+  // The host is "localhost", which is the empty host in a file URL
+  [[nodiscard]] static constexpr auto is_localhost(std::string_view host) noexcept {
+    constexpr auto localhost = std::string_view("localhost");
+    return (host.size() == localhost.size()) &&
+           std::equal(std::begin(host), std::end(host), std::begin(localhost),
+                      [](auto lhs, auto rhs) { return to_lower(lhs) == rhs; });
+  }
+
+  constexpr void parse_url() {
+    if (input_.empty() || !is_alpha(input_.front())) {
+      fail(url_parse_errc::not_an_absolute_url_with_fragment);
+      return;
+    }
+
+    auto colon = input_.find(':');
+    constexpr auto is_scheme_byte = [](auto byte) {
+      return is_alpha(byte) || is_digit(byte) || (byte == '+') || (byte == '-') || (byte == '.');
+    };
+    if ((colon == std::string_view::npos) ||
+        !std::all_of(std::begin(input_), std::begin(input_) + colon, is_scheme_byte)) {
+      fail(url_parse_errc::not_an_absolute_url_with_fragment);
+      return;
+    }
+    for (auto byte : input_.substr(0, colon)) {
+      url_.append_to_scheme(to_lower(byte));
+    }
+    input_.remove_prefix(colon + 1);
+
+    if (url_.scheme() == "file") {
+      parse_file();
+    } else if (is_special()) {
+      while (!input_.empty() && is_path_delimiter(input_.front())) {
+        input_.remove_prefix(1);
+      }
+      parse_authority();
+      parse_path_start();
+    } else if (input_.substr(0, 2) == "//") {
+      input_.remove_prefix(2);
+      parse_authority();
+      parse_path_start();
+    } else if (!input_.empty() && (input_.front() == '/')) {
+      input_.remove_prefix(1);
+      parse_path();
+    } else {
+      parse_cannot_be_a_base_url_path();
+    }
+    parse_query();
+    parse_fragment();
+  }
+
+  constexpr void parse_authority() {
+    auto last = find_end_of_host();
+    auto authority = input_.substr(0, last);
+    input_.remove_prefix(last);
+
+    auto at = authority.find('@');
+    if (at != std::string_view::npos) {
+      if (authority.find('@', at + 1) != std::string_view::npos) {
+        unsupported();
+        return;
+      }
+      auto credentials = authority.substr(0, at);
+      authority.remove_prefix(at + 1);
+      if (authority.empty()) {
+        fail(url_parse_errc::empty_hostname);
+        return;
+      }
+
+      auto colon = credentials.find(':');
+      for (auto byte : credentials.substr(0, colon)) {
+        percent_encode(byte, percent_encoding::details::is_userinfo_byte,
+                       [this](auto s) { url_.append_to_username(s); });
+      }
+      if (colon != std::string_view::npos) {
+        for (auto byte : credentials.substr(colon + 1)) {
+          percent_encode(byte, percent_encoding::details::is_userinfo_byte,
+                         [this](auto s) { url_.append_to_password(s); });
+        }
+      }
+    }
+
+    auto colon = authority.find(':');
+    auto host = authority.substr(0, colon);
+    if ((colon != std::string_view::npos) && host.empty()) {
+      fail(url_parse_errc::empty_hostname);
+      return;
+    }
+
+    if (is_special()) {
+      if (host.empty()) {
+        fail(url_parse_errc::empty_hostname);
+        return;
+      }
+      parse_domain(host);
+    } else {
+      parse_opaque_host(host);
+    }
+
+    if (colon != std::string_view::npos) {
+      parse_port(authority.substr(colon + 1));
+    }
+  }
+
+  constexpr void parse_port(std::string_view port) {
+    if (port.empty()) {
+      return;
+    }
+
+    auto value = std::uint32_t(0);
+    for (auto byte : port) {
+      if (!is_digit(byte)) {
+        fail(url_parse_errc::invalid_port);
+        return;
+      }
+      value = std::min((value * 10) + static_cast<std::uint32_t>(byte - '0'), std::uint32_t(0x10000));
+    }
+    if (value > 0xffffu) {
+      fail(url_parse_errc::invalid_port);
+      return;
+    }
+
+    auto port_number = static_cast<std::uint16_t>(value);
+    url_.set_port((default_port(url_.scheme()) == port_number) ? std::nullopt : std::make_optional(port_number));
+  }
+
+  constexpr void parse_domain(std::string_view host) {
+    constexpr auto is_forbidden = [](auto byte) {
+      return (byte != '%') && details::is_forbidden_host_point(byte);
+    };
+    constexpr auto is_ldh = [](auto byte) {
+      return is_alpha(byte) || is_digit(byte) || (byte == '-') || (byte == '.');
+    };
+
+    if (host.front() == '[') {
+      unsupported();
+      return;
+    }
+    if (std::any_of(std::begin(host), std::end(host), is_forbidden)) {
+      fail(url_parse_errc::domain_error);
+      return;
+    }
+    if (!std::all_of(std::begin(host), std::end(host), is_ldh)) {
+      unsupported();
+      return;
+    }
+
+    // the labels are checked as in `details::ascii_domain_to_ascii`,
+    // and those which could be IPv4 numbers as in `parse_ipv4_address`
+    auto labels = host;
+    if ((labels.size() > 1) && (labels.back() == '.')) {
+      labels.remove_suffix(1);
+    }
+    auto is_number = true;
+    for (auto rest = labels; true;) {
+      auto dot = rest.find('.');
+      auto label = rest.substr(0, dot);
+      if ((label.size() >= 4) && (to_lower(label[0]) == 'x') && (to_lower(label[1]) == 'n') && (label[2] == '-') &&
+          (label[3] == '-')) {
+        unsupported();
+        return;
+      }
+      auto is_hex = (label.size() >= 2) && (label[0] == '0') && (to_lower(label[1]) == 'x');
+      auto digits = is_hex ? label.substr(2) : label;
+      is_number &=
+          !label.empty() && std::all_of(std::begin(digits), std::end(digits), is_hex ? is_hex_digit : is_digit);
+      if (dot == std::string_view::npos) {
+        break;
+      }
+      rest.remove_prefix(dot + 1);
+    }
+
+    if (!is_number) {
+      url_.set_host_kind(host_kind::domain_name);
+      for (auto byte : host) {
+        auto lower = to_lower(byte);
+        url_.append_to_host(std::string_view(&lower, 1));
+      }
+      return;
+    }
+
+    auto address = parse_ipv4_dotted_quad(labels);
+    if (!address) {
+      unsupported();
+      return;
+    }
+    url_.set_host_kind(host_kind::ipv4_address);
+    url_.append_to_host(labels);
+  }
+
+  constexpr void parse_opaque_host(std::string_view host) {
+    constexpr auto is_forbidden = [](auto byte) {
+      return (byte != '%') && details::is_forbidden_host_point(byte);
+    };
+
+    if (!host.empty() && (host.front() == '[')) {
+      unsupported();
+      return;
+    }
+    if (std::any_of(std::begin(host), std::end(host), is_forbidden)) {
+      fail(url_parse_errc::forbidden_host_point);
+      return;
+    }
+
+    url_.set_host_kind(host.empty() ? host_kind::empty : host_kind::opaque_host);
+    for (auto byte : host) {
+      percent_encode(byte, percent_encoding::details::is_c0_control_byte, [this](auto s) { url_.append_to_host(s); });
+    }
+  }
+
+  constexpr void parse_file() {
+    url_.set_host_kind(host_kind::empty);
+    if ((input_.size() >= 2) && is_path_delimiter(input_[0]) && is_path_delimiter(input_[1])) {
+      input_.remove_prefix(2);
+      auto last = find_end_of_host();
+      auto host = input_.substr(0, last);
+      input_.remove_prefix(last);
+      if (details::is_windows_drive_letter(host)) {
+        unsupported();
+        return;
+      }
+      if (!host.empty() && !is_localhost(host)) {
+        parse_domain(host);
+      }
+      parse_path_start();
+    } else {
+      if (!input_.empty() && is_path_delimiter(input_.front())) {
+        input_.remove_prefix(1);
+      }
+      parse_path();
+    }
+  }
+
+  constexpr void parse_path_start() {
+    if (!ok()) {
+      return;
+    }
+    if (is_special()) {
+      if (!input_.empty() && is_path_delimiter(input_.front())) {
+        input_.remove_prefix(1);
+      }
+      parse_path();
+    } else if (!input_.empty() && (input_.front() != '?') && (input_.front() != '#')) {
+      if (input_.front() == '/') {
+        input_.remove_prefix(1);
+      }
+      parse_path();
+    }
+  }
+
+  constexpr void parse_path() {
+    if (!ok()) {
+      return;
+    }
+
+    auto last = find_delimiter("?#");
+    auto path = input_.substr(0, last);
+    input_.remove_prefix(last);
+
+    auto segment = std::array<char, Capacity>{};
+    while (true) {
+      auto delimiter =
+          std::find_if(std::begin(path), std::end(path), [this](auto byte) { return is_path_delimiter(byte); });
+      auto size = std::size_t(0);
+      for (auto it = std::begin(path); it != delimiter; ++it) {
+        percent_encode(*it, percent_encoding::details::is_path_byte, [&segment, &size](auto s) {
+          std::copy(std::begin(s), std::end(s), std::begin(segment) + size);
+          size += s.size();
+        });
+      }
+      auto buffer = std::string_view(segment.data(), size);
+      auto is_last = (delimiter == std::end(path));
+
+      if (details::is_double_dot_path_segment(buffer)) {
+        if (url_.path_size() != 0) {
+          url_.pop_back_path();
+        }
+        if (is_last) {
+          url_.push_back_path({});
+        }
+      } else if (details::is_single_dot_path_segment(buffer)) {
+        if (is_last) {
+          url_.push_back_path({});
+        }
+      } else {
+        if ((url_.scheme() == "file") && (url_.path_size() == 0) && details::is_windows_drive_letter(buffer)) {
+          unsupported();
+          return;
+        }
+        url_.push_back_path(buffer);
+      }
+
+      if (is_last) {
+        break;
+      }
+      path.remove_prefix(static_cast<std::size_t>(delimiter - std::begin(path)) + 1);
+    }
+
+    if (url_.scheme() == "file") {
+      while ((url_.path_size() > 1) && url_.path_front().empty()) {
+        url_.pop_front_path();
+      }
+    }
+  }
+
+  constexpr void parse_cannot_be_a_base_url_path() {
+    url_.set_cannot_be_a_base_url();
+    url_.push_back_path({});
+    auto last = find_delimiter("?#");
+    for (auto byte : input_.substr(0, last)) {
+      percent_encode(byte, percent_encoding::details::is_c0_control_byte,
+                     [this](auto s) { url_.append_to_path_front(s); });
+    }
+    input_.remove_prefix(last);
+  }
+
+  constexpr void parse_query() {
+    if (!ok() || input_.empty() || (input_.front() != '?')) {
+      return;
+    }
+
+    auto last = input_.find('#');
+    auto query = input_.substr(1, (last != std::string_view::npos) ? (last - 1) : std::string_view::npos);
+    input_.remove_prefix(std::min(last, input_.size()));
+    url_.append_to_query({});
+    auto is_special_query = is_special();
+    for (auto byte : query) {
+      auto encode = (byte < '!') || (byte > '~') || (byte == '"') || (byte == '#') || (byte == '<') || (byte == '>') ||
+                    ((byte == '\'') && is_special_query);
+      percent_encode(byte, [encode](auto) { return encode; }, [this](auto s) { url_.append_to_query(s); });
+    }
+  }
+
+  constexpr void parse_fragment() {
+    if (!ok() || input_.empty()) {
+      return;
+    }
+
+    url_.append_to_fragment({});
+    for (auto byte : input_.substr(1)) {
+      percent_encode(byte, percent_encoding::details::is_fragment_byte,
+                     [this](auto s) { url_.append_to_fragment(s); });
+    }
+  }
+
+  template <class InSet, class Append>
+  static constexpr void percent_encode(char byte, InSet in_set, Append append) {
+    constexpr auto mask = std::byte(0x0f);
+
+    auto value = static_cast<std::byte>(byte);
+    if (in_set(value)) {
+      char encoded[] = {'%', percent_encoding::details::hex_to_alnum((value >> 4u) & mask),
+                        percent_encoding::details::hex_to_alnum(value & mask)};
+      append(std::string_view(encoded, 3));
+    } else {
+      append(std::string_view(&byte, 1));
+    }
+  }
+
+  std::string_view input_;
+  std::array<char, Capacity> buffer_ = {};
+  static_parse_result<Capacity> result_;
+  static_url_record_builder<Capacity> url_;
+};
+
+/// Parses a URL at compile time
+///
+/// \tparam Capacity The number of characters of the record. The URL
+///                  is unsupported if it is less than
+///                  `static_parse_capacity(input.size())`
+/// \param input An ASCII string
+/// \returns The record and the status of the parser
+template <std::size_t Capacity>
+constexpr auto parse_static_url(std::string_view input) -> static_parse_result<Capacity> {
+  return static_url_parser<Capacity>(input).parse();
+}
+
+/// A string literal, used as a template argument
+template <std::size_t N>
+struct url_literal {
+  consteval url_literal(const char (&str)[N]) {  // NOLINT
+    std::copy_n(str, N, value);
+  }
+
+  [[nodiscard]] constexpr auto view() const noexcept {
+    return std::string_view(value, N - 1);
+  }
+
+  char value[N] = {};
+};
+}  // namespace details
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+namespace literals {
+/// Literal operator for a URL string that is parsed when the program
+/// is compiled
+///
+/// An invalid URL does not compile. Neither does a URL that needs the
+/// run time parser, such as a URL with an internationalized domain
+/// name, for which the `_url` literal is used instead.
+///
+/// ```
+/// constexpr auto url = "https://example.com/path?query"_static_url;
+/// static_assert(url.host() == "example.com");
+/// ```
+///
+/// \tparam Literal The URL string
+/// \returns A `static_url_record` with the capacity of the parsed URL
+template <details::url_literal Literal>
+consteval auto operator"" _static_url() {
+  constexpr auto parsed =
+      details::parse_static_url<details::static_parse_capacity(Literal.view().size())>(Literal.view());
+  static_assert(parsed.status != details::static_parse_status::failure, "The URL literal is not a valid URL");
+  static_assert(parsed.status != details::static_parse_status::unsupported,
+                "The URL literal can only be parsed at run time, use the _url literal");
+
+  auto url = parsed.url;
+  return details::static_url_record_builder(url).template copy<parsed.url.size()>();
+}
+}  // namespace literals
+#endif  // defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_STATIC_URL_RECORD_HPP
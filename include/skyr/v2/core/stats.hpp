@@ -0,0 +1,99 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_CORE_STATS_HPP
+#define SKYR_V2_CORE_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace skyr::inline v2 {
+/// Counters of the work done by the URL parser
+///
+/// The counters are only updated when the code is compiled with
+/// `SKYR_ENABLE_STATS` defined, otherwise they stay zero and
+/// the hooks compile to nothing. They are meant to be read
+/// periodically and forwarded to a metrics system.
+///
+/// The strings of a `url_record` use the default allocator and
+/// are not counted; a `compact_url_record` reused for many
+/// parses only allocates when it grows, which is counted.
+struct parse_stats {
+  /// The number of runs of the parser, including those made
+  /// by the setters of `url`
+  std::size_t parse_calls = 0;
+  /// The number of runs of the parser which failed
+  std::size_t parse_errors = 0;
+  /// The number of times the buffer of a `compact_url_record`
+  /// was grown
+  std::size_t reserves = 0;
+  /// The total size requested by those reserves
+  std::size_t bytes_reserved = 0;
+};
+
+namespace details {
+struct parse_counters {
+  std::atomic<std::size_t> parse_calls = 0;
+  std::atomic<std::size_t> parse_errors = 0;
+  std::atomic<std::size_t> reserves = 0;
+  std::atomic<std::size_t> bytes_reserved = 0;
+};
+
+inline auto parse_counters_instance() noexcept -> parse_counters & {
+  static auto counters = parse_counters{};
+  return counters;
+}
+
+inline void count_parse([[maybe_unused]] bool ok) noexcept {
+#if defined(SKYR_ENABLE_STATS)
+  auto &counters = parse_counters_instance();
+  counters.parse_calls.fetch_add(1, std::memory_order_relaxed);
+  if (!ok) {
+    counters.parse_errors.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+}
+
+inline void count_reserve([[maybe_unused]] std::size_t size) noexcept {
+#if defined(SKYR_ENABLE_STATS)
+  auto &counters = parse_counters_instance();
+  counters.reserves.fetch_add(1, std::memory_order_relaxed);
+  counters.bytes_reserved.fetch_add(size, std::memory_order_relaxed);
+#endif
+}
+}  // namespace details
+
+/// \returns `true` if the counters are updated
+constexpr auto parse_stats_enabled() noexcept -> bool {
+#if defined(SKYR_ENABLE_STATS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// Reads the counters with relaxed atomic loads
+/// \returns The current values of the counters
+inline auto get_parse_stats() noexcept -> parse_stats {
+  auto &counters = details::parse_counters_instance();
+  auto stats = parse_stats{};
+  stats.parse_calls = counters.parse_calls.load(std::memory_order_relaxed);
+  stats.parse_errors = counters.parse_errors.load(std::memory_order_relaxed);
+  stats.reserves = counters.reserves.load(std::memory_order_relaxed);
+  stats.bytes_reserved = counters.bytes_reserved.load(std::memory_order_relaxed);
+  return stats;
+}
+
+/// Sets every counter to zero
+inline void reset_parse_stats() noexcept {
+  auto &counters = details::parse_counters_instance();
+  counters.parse_calls.store(0, std::memory_order_relaxed);
+  counters.parse_errors.store(0, std::memory_order_relaxed);
+  counters.reserves.store(0, std::memory_order_relaxed);
+  counters.bytes_reserved.store(0, std::memory_order_relaxed);
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_CORE_STATS_HPP
@@ -9,7 +9,6 @@
 #include <string>
 #include <optional>
 #include <tl/expected.hpp>
-#include <skyr/v2/core/url_record.hpp>
 
 namespace skyr::inline v2 {
 /// States of the URL parser
@@ -7,6 +7,9 @@
 #define SKYR_V2_CORE_URL_PARSER_CONTEXT_HPP
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <string_view>
 #include <optional>
 #include <iterator>
@@ -18,6 +21,8 @@
 #include <skyr/v2/core/schemes.hpp>
 #include <skyr/v2/core/host.hpp>
 #include <skyr/v2/core/errors.hpp>
+#include <skyr/v2/core/parse_options.hpp>
+#include <skyr/v2/core/parser_stats.hpp>
 #include <skyr/v2/core/url_record.hpp>
 #include <skyr/v2/core/url_parse_state.hpp>
 #include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
@@ -60,7 +65,10 @@ constexpr inline auto is_windows_drive_letter(std::string_view segment) noexcept
     return false;
   }
 
-  if (!std::isalpha(segment[0], std::locale::classic())) {
+  // an ASCII test, so that the function can be used in constant
+  // expressions
+  auto first = static_cast<char>(segment[0] | 0x20);
+  if ((first < 'a') || (first > 'z')) {
     return false;
   }
 
@@ -83,50 +91,400 @@ constexpr inline auto is_double_dot_path_segment(std::string_view segment) noexc
          (segment == "%2e%2E");
 }
 
-inline void shorten_path(std::string_view scheme, std::vector<std::string> &path) {
-  if (!path.empty() && !((scheme == "file"sv) && (path.size() == 1) && is_windows_drive_letter(path.front()))) {
-    path.pop_back();
+/// Classes of bytes that the parser states treat in the same way
+enum class byte_class : unsigned char {
+  alpha,
+  digit,
+  /// '+', '-' and '.', which can follow the first byte of a scheme
+  scheme_punctuation,
+  /// The other URL code points that aren't delimiters
+  sub_delim,
+  apostrophe,
+  percent_sign,
+  colon,
+  commercial_at,
+  solidus,
+  reverse_solidus,
+  question_mark,
+  number_sign,
+  left_square_bracket,
+  right_square_bracket,
+  grave_accent,
+  /// '"', '<' and '>'
+  quotation_mark_or_angle_bracket,
+  /// '^', '{', '|' and '}'
+  other_printable,
+  /// U+0000 to U+0020, and U+007F
+  c0_control_or_space,
+  non_ascii,
+};
+
+/// A set of byte classes, one bit per class
+using byte_class_set = std::uint32_t;
+
+constexpr inline auto byte_classes_of(std::initializer_list<byte_class> classes) noexcept -> byte_class_set {
+  auto set = byte_class_set(0);
+  for (auto c : classes) {
+    set |= byte_class_set(1) << static_cast<unsigned>(c);
   }
+  return set;
+}
+
+constexpr inline auto is_ascii_alphanumeric(char byte) noexcept {
+  return ((byte >= '0') && (byte <= '9')) || ((byte >= 'a') && (byte <= 'z')) || ((byte >= 'A') && (byte <= 'Z'));
 }
+
+constexpr inline auto make_byte_class_table() noexcept {
+  constexpr auto class_of = [](char byte) {
+    auto value = static_cast<unsigned char>(byte);
+    if (value >= 0x80) {
+      return byte_class::non_ascii;
+    } else if ((value <= 0x20) || (value == 0x7f)) {
+      return byte_class::c0_control_or_space;
+    } else if ((byte >= '0') && (byte <= '9')) {
+      return byte_class::digit;
+    } else if (is_ascii_alphanumeric(byte)) {
+      return byte_class::alpha;
+    } else if (contains("+-."sv, byte)) {
+      return byte_class::scheme_punctuation;
+    } else if (contains("!$&()*,;=_~"sv, byte)) {
+      return byte_class::sub_delim;
+    } else if (contains(R"("<>)"sv, byte)) {
+      return byte_class::quotation_mark_or_angle_bracket;
+    } else if (contains("^{|}"sv, byte)) {
+      return byte_class::other_printable;
+    }
+    switch (byte) {
+      case '\'':
+        return byte_class::apostrophe;
+      case '%':
+        return byte_class::percent_sign;
+      case ':':
+        return byte_class::colon;
+      case '@':
+        return byte_class::commercial_at;
+      case '/':
+        return byte_class::solidus;
+      case '\\':
+        return byte_class::reverse_solidus;
+      case '?':
+        return byte_class::question_mark;
+      case '#':
+        return byte_class::number_sign;
+      case '[':
+        return byte_class::left_square_bracket;
+      case ']':
+        return byte_class::right_square_bracket;
+      default:
+        return byte_class::grave_accent;
+    }
+  };
+
+  auto table = std::array<byte_class, 256>{};
+  for (auto i = 0u; i < table.size(); ++i) {
+    table[i] = class_of(static_cast<char>(i));
+  }
+  return table;
+}
+
+/// The class of each byte
+inline constexpr auto byte_class_table = make_byte_class_table();
+
+inline constexpr auto url_parse_state_count = static_cast<std::size_t>(url_parse_state::fragment) + 1;
+
+/// For each state, the classes of the bytes that the state copies
+/// unchanged to the buffer or to the record, without percent
+/// encoding, validation or a change of state; the first set is
+/// for non-special URLs and the second for special URLs
+///
+/// The states that parse hosts, or that add path segments, only
+/// see the bytes which end a run.
+constexpr inline auto make_run_table() noexcept {
+  using bc = byte_class;
+  constexpr auto any = (byte_class_set(1) << (static_cast<unsigned>(bc::non_ascii) + 1)) - 1;
+  constexpr auto reverse_solidus = byte_classes_of({bc::reverse_solidus});
+
+  constexpr auto scheme = byte_classes_of({bc::alpha, bc::digit, bc::scheme_punctuation});
+  constexpr auto authority =
+      any & ~byte_classes_of({bc::commercial_at, bc::solidus, bc::question_mark, bc::number_sign});
+  constexpr auto host = any & ~byte_classes_of({bc::colon, bc::solidus, bc::question_mark, bc::number_sign,
+                                                bc::left_square_bracket, bc::right_square_bracket});
+  constexpr auto port = byte_classes_of({bc::digit});
+  constexpr auto file_host =
+      any & ~byte_classes_of({bc::solidus, bc::reverse_solidus, bc::question_mark, bc::number_sign});
+  constexpr auto path = byte_classes_of({bc::alpha, bc::digit, bc::scheme_punctuation, bc::sub_delim, bc::apostrophe,
+                                         bc::percent_sign, bc::colon, bc::commercial_at});
+  constexpr auto query =
+      any & ~byte_classes_of({bc::c0_control_or_space, bc::non_ascii, bc::quotation_mark_or_angle_bracket,
+                              bc::number_sign});
+  constexpr auto fragment = byte_classes_of({bc::alpha, bc::digit, bc::scheme_punctuation, bc::sub_delim,
+                                             bc::apostrophe, bc::colon, bc::commercial_at, bc::solidus,
+                                             bc::question_mark});
+
+  auto table = std::array<std::array<byte_class_set, 2>, url_parse_state_count>{};
+  auto set = [&table](url_parse_state state, byte_class_set non_special, byte_class_set special) {
+    table[static_cast<std::size_t>(state)] = {non_special, special};
+  };
+  set(url_parse_state::scheme, scheme, scheme);
+  set(url_parse_state::authority, authority, authority & ~reverse_solidus);
+  set(url_parse_state::host, host, host & ~reverse_solidus);
+  set(url_parse_state::hostname, host, host & ~reverse_solidus);
+  set(url_parse_state::port, port, port);
+  set(url_parse_state::file_host, file_host, file_host);
+  set(url_parse_state::path, path, path);
+  set(url_parse_state::query, query, query & ~byte_classes_of({bc::apostrophe}));
+  set(url_parse_state::fragment, fragment, fragment);
+  return table;
+}
+
+inline constexpr auto run_table = make_run_table();
+
+/// \param first The start of the input
+/// \param last The end of the input
+/// \param classes The classes of the bytes that can be included in
+///                the run
+/// \returns The first byte not in `classes`
+constexpr inline auto find_end_of_run(std::string_view::const_iterator first, std::string_view::const_iterator last,
+                                      byte_class_set classes) noexcept {
+  while ((first != last) &&
+         ((classes >> static_cast<unsigned>(byte_class_table[static_cast<unsigned char>(*first)])) & 1u)) {
+    ++first;
+  }
+  return first;
+}
+
+template <class Builder>
+inline void shorten_path(Builder &url) {
+  if (!url.path_empty() &&
+      !((url.scheme() == "file"sv) && (url.path_size() == 1) && is_windows_drive_letter(url.path_front()))) {
+    url.pop_back_path();
+  }
+}
+
+/// Writes the components produced by the URL parser into a
+/// `url_record`
+///
+/// The record is updated in place, so the components which are
+/// not written keep their storage
+class url_record_builder {
+ public:
+  explicit url_record_builder(url_record &url) noexcept : url_(url) {
+  }
+
+  /// Uses a scratch string owned by the caller, which keeps its
+  /// capacity between parses
+  url_record_builder(url_record &url, std::string &scratch) noexcept : url_(url), external_scratch_(&scratch) {
+  }
+
+  [[nodiscard]] auto scratch() noexcept -> std::string & {
+    return external_scratch_ ? *external_scratch_ : scratch_;
+  }
+
+  [[nodiscard]] auto scheme() const noexcept -> std::string_view {
+    return url_.scheme;
+  }
+
+  void set_scheme(std::string_view scheme) {
+    url_.scheme = scheme;
+  }
+
+  [[nodiscard]] auto is_special() const noexcept -> bool {
+    return url_.is_special();
+  }
+
+  [[nodiscard]] auto includes_credentials() const noexcept -> bool {
+    return url_.includes_credentials();
+  }
+
+  void append_to_username(std::string_view s) {
+    url_.username += s;
+  }
+
+  void append_to_password(std::string_view s) {
+    url_.password += s;
+  }
+
+  [[nodiscard]] auto has_host() const noexcept -> bool {
+    return url_.host.has_value();
+  }
+
+  [[nodiscard]] auto host_is_empty() const noexcept -> bool {
+    return url_.host && url_.host.value().is_empty();
+  }
+
+  [[nodiscard]] auto host_is_localhost() const -> bool {
+    return url_.host && (url_.host.value().serialize() == "localhost");
+  }
+
+  void set_host(skyr::v2::host host) {
+    url_.host = std::move(host);
+  }
+
+  void set_host(const std::optional<skyr::v2::host> &host) {
+    url_.host = host;
+  }
+
+  void set_empty_host() {
+    url_.host = skyr::v2::host{skyr::v2::empty_host{}};
+  }
+
+  [[nodiscard]] auto port() const noexcept -> std::optional<std::uint16_t> {
+    return url_.port;
+  }
+
+  void set_port(std::optional<std::uint16_t> port) noexcept {
+    url_.port = port;
+  }
+
+  void set_authority_from(const url_record &base) {
+    url_.username = base.username;
+    url_.password = base.password;
+    url_.host = base.host;
+    url_.port = base.port;
+  }
+
+  void set_cannot_be_a_base_url() noexcept {
+    url_.cannot_be_a_base_url = true;
+  }
+
+  [[nodiscard]] auto path_empty() const noexcept -> bool {
+    return url_.path.empty();
+  }
+
+  [[nodiscard]] auto path_size() const noexcept -> std::size_t {
+    return url_.path.size();
+  }
+
+  [[nodiscard]] auto path_front() const noexcept -> std::string_view {
+    return url_.path.front();
+  }
+
+  void clear_path() {
+    url_.path.clear();
+  }
+
+  void push_back_path(std::string_view segment) {
+    url_.path.emplace_back(segment);
+  }
+
+  void pop_back_path() {
+    url_.path.pop_back();
+  }
+
+  void pop_front_path() {
+    url_.path.pop_front();
+  }
+
+  void append_to_path_front(std::string_view s) {
+    // a URL that cannot be a base has exactly one path segment
+    assert(url_.path.size() == 1);
+    url_.path.append_to_back(s);
+  }
+
+  void set_path_from(const url_record &base) {
+    url_.path = base.path;
+  }
+
+  [[nodiscard]] auto has_query() const noexcept -> bool {
+    return url_.query.has_value();
+  }
+
+  void clear_query() {
+    url_.query = std::nullopt;
+  }
+
+  void set_empty_query() {
+    if (url_.query) {
+      url_.query.value().clear();
+    } else {
+      url_.query.emplace();
+    }
+  }
+
+  void set_query_from(const url_record &base) {
+    url_.query = base.query;
+  }
+
+  void append_to_query(std::string_view s) {
+    if (!url_.query) {
+      set_empty_query();
+    }
+    url_.query.value() += s;
+  }
+
+  [[nodiscard]] auto has_fragment() const noexcept -> bool {
+    return url_.fragment.has_value();
+  }
+
+  void set_empty_fragment() {
+    if (url_.fragment) {
+      url_.fragment.value().clear();
+    } else {
+      url_.fragment.emplace();
+    }
+  }
+
+  void append_to_fragment(std::string_view s) {
+    if (!url_.fragment) {
+      set_empty_fragment();
+    }
+    url_.fragment.value() += s;
+  }
+
+ private:
+  url_record &url_;
+  std::string scratch_;
+  std::string *external_scratch_ = nullptr;
+};
 }  // namespace details
 
 enum class url_parse_action {
   success = 0,
   increment,
   continue_,
+  /// The parser stopped on an error, see
+  /// `basic_url_parser_context::error`
+  failure,
 };
 
-class url_parser_context {
+/// Runs the URL parser state machine
+///
+/// \tparam Builder Receives the URL components, either
+///         `details::url_record_builder` or
+///         `details::compact_url_record_builder`
+template <class Builder>
+class basic_url_parser_context {
  private:
-  url_record url;
+  Builder url;
   url_parse_state state;
   std::string_view input;
   std::string_view::const_iterator input_it;
   bool *validation_error;
   const url_record *base;
   std::optional<url_parse_state> state_override;
-  std::string buffer;
+  parse_options options;
+  std::string &buffer;
 
   bool at_flag;
   bool square_braces_flag;
+  url_parse_errc parse_error;
 
  public:
-  url_parser_context(std::string_view input, bool *validation_error, const url_record *base, const url_record *url,
-                     std::optional<url_parse_state> state_override)
-      : input(input),
+  basic_url_parser_context(std::string_view input, bool *validation_error, const url_record *base, Builder url,
+                           std::optional<url_parse_state> state_override, const parse_options &options = {})
+      : url(std::move(url)),
+        state(state_override ? state_override.value() : url_parse_state::scheme_start),
+        input(input),
         input_it(begin(input)),
         validation_error(validation_error),
         base(base),
-        url(url ? *url : url_record{}),
-        state(state_override ? state_override.value() : url_parse_state::scheme_start),
         state_override(state_override),
-        buffer(),
+        options(options),
+        buffer(this->url.scratch()),
         at_flag(false),
-        square_braces_flag(false) {
-  }
-
-  [[nodiscard]] auto get_url() && -> url_record && {
-    return std::move(url);
+        square_braces_flag(false),
+        parse_error() {
+    buffer.clear();
   }
 
   [[nodiscard]] auto is_eof() const noexcept {
@@ -142,8 +500,59 @@ class url_parser_context {
     ++input_it;
   }
 
-  auto parse_next() -> tl::expected<url_parse_action, url_parse_errc> {
+  /// Copies a run of bytes that need no percent encoding,
+  /// validation or state change, as found in `details::run_table`
+  ///
+  /// \returns `true` if any bytes were consumed
+  auto parse_run() -> bool {
+    auto classes = details::run_table[static_cast<std::size_t>(state)][url.is_special() ? 1 : 0];
+    if (classes == 0) {
+      return false;
+    }
+
+    // a file host is parsed by the file host state
+    if (((state == url_parse_state::host) || (state == url_parse_state::hostname)) && state_override &&
+        (url.scheme() == "file")) {
+      return false;
+    }
+
+    auto first = input_it;
+    auto last = details::find_end_of_run(first, std::end(input), classes);
+    if (first == last) {
+      return false;
+    }
+
+    auto run = input.substr(std::distance(std::begin(input), first), std::distance(first, last));
+    details::count_state_run(state, run.size());
+    switch (state) {
+      case url_parse_state::scheme:
+        for (auto byte : run) {
+          buffer.push_back(((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte - 'A' + 'a') : byte);
+        }
+        break;
+      case url_parse_state::query:
+        url.append_to_query(run);
+        break;
+      case url_parse_state::fragment:
+        url.append_to_fragment(run);
+        break;
+      default:
+        buffer += run;
+        break;
+    }
+    input_it = last;
+    return true;
+  }
+
+  /// \returns The error which made a state return
+  ///          `url_parse_action::failure`
+  [[nodiscard]] auto error() const noexcept -> url_parse_errc {
+    return parse_error;
+  }
+
+  auto parse_next() -> url_parse_action {
     auto byte = next_byte();
+    details::count_state(state, is_eof() ? 0 : 1);
     switch (state) {
       case url_parse_state::scheme_start:
         return parse_scheme_start(byte);
@@ -187,7 +596,7 @@ class url_parser_context {
       case url_parse_state::fragment:
         return parse_fragment(byte);
       default:
-        return tl::make_unexpected(url_parse_errc::cannot_override_scheme);
+        return fail(url_parse_errc::cannot_override_scheme);
     }
   }
 
@@ -197,6 +606,16 @@ class url_parser_context {
     --input_it;
   }
 
+  void report(validation_error_kind kind) noexcept {
+    *validation_error |= true;
+    details::count_validation_error(kind);
+  }
+
+  auto fail(url_parse_errc errc) noexcept -> url_parse_action {
+    parse_error = errc;
+    return url_parse_action::failure;
+  }
+
   void restart_from_beginning() noexcept {
     input_it = std::begin(input);
   }
@@ -213,7 +632,7 @@ class url_parser_context {
     return !still_to_process().empty() && still_to_process().substr(1).starts_with(chars);
   }
 
-  auto parse_scheme_start(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_scheme_start(char byte) -> url_parse_action {
     if (std::isalpha(byte, std::locale::classic())) {
       auto lower = std::tolower(byte, std::locale::classic());
       buffer.push_back(lower);
@@ -223,14 +642,14 @@ class url_parser_context {
       restart_from_beginning();
       return url_parse_action::continue_;
     } else {
-      *validation_error |= true;
-      return tl::make_unexpected(url_parse_errc::invalid_scheme_character);
+      report(validation_error_kind::invalid_scheme);
+      return fail(url_parse_errc::invalid_scheme_character);
     }
 
     return url_parse_action::increment;
   }
 
-  auto parse_scheme(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_scheme(char byte) -> url_parse_action {
     if (std::isalnum(byte, std::locale::classic()) || details::contains("+-."sv, byte)) {
       auto lower = std::tolower(byte, std::locale::classic());
       buffer.push_back(lower);
@@ -238,27 +657,27 @@ class url_parser_context {
       if (state_override) {
         if ((url.is_special() && !is_special(buffer)) ||
             (!url.is_special() && is_special(buffer)) ||
-            ((url.includes_credentials() || url.port) && (buffer == "file")) ||
-            ((url.scheme == "file") && (!url.host || url.host.value().is_empty()))) {
-          return tl::make_unexpected(url_parse_errc::cannot_override_scheme);
+            ((url.includes_credentials() || url.port()) && (buffer == "file")) ||
+            ((url.scheme() == "file") && (!url.has_host() || url.host_is_empty()))) {
+          return fail(url_parse_errc::cannot_override_scheme);
         }
       }
       set_scheme_from_buffer();
 
       if (state_override) {
-        if (url.port == default_port(url.scheme)) {
+        if (url.port() == default_port(url.scheme())) {
           clear_port();
         }
         return url_parse_action::success;
       }
       buffer.clear();
 
-      if (url.scheme == "file") {
+      if (url.scheme() == "file") {
         if (!remaining_starts_with("//"sv)) {
-          *validation_error |= true;
+          report(validation_error_kind::special_scheme_missing_following_solidus);
         }
         state = url_parse_state::file;
-      } else if (url.is_special() && base && (base->scheme == url.scheme)) {
+      } else if (url.is_special() && base && (base->scheme == url.scheme())) {
         state = url_parse_state::special_relative_or_authority;
       } else if (url.is_special()) {
         state = url_parse_state::special_authority_slashes;
@@ -276,16 +695,16 @@ class url_parser_context {
       restart_from_beginning();
       return url_parse_action::continue_;
     } else {
-      return tl::make_unexpected(url_parse_errc::invalid_scheme_character);
+      return fail(url_parse_errc::invalid_scheme_character);
     }
 
     return url_parse_action::increment;
   }
 
-  auto parse_no_scheme(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_no_scheme(char byte) -> url_parse_action {
     if (!base || (base->cannot_be_a_base_url && (byte != '#'))) {
-      *validation_error |= true;
-      return tl::make_unexpected(url_parse_errc::not_an_absolute_url_with_fragment);
+      report(validation_error_kind::missing_scheme_non_relative_url);
+      return fail(url_parse_errc::not_an_absolute_url_with_fragment);
     } else if (base->cannot_be_a_base_url && (byte == '#')) {
       set_scheme_from_base();
       set_path_from_base();
@@ -305,19 +724,19 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_special_relative_or_authority(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_special_relative_or_authority(char byte) -> url_parse_action {
     if ((byte == '/') && remaining_starts_with("/"sv)) {
       increment();
       state = url_parse_state::special_authority_ignore_slashes;
     } else {
-      *validation_error |= true;
+      report(validation_error_kind::special_scheme_missing_following_solidus);
       decrement();
       state = url_parse_state::relative;
     }
     return url_parse_action::increment;
   }
 
-  auto parse_path_or_authority(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_path_or_authority(char byte) -> url_parse_action {
     if (byte == '/') {
       state = url_parse_state::authority;
     } else {
@@ -327,7 +746,7 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_relative(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_relative(char byte) -> url_parse_action {
     set_scheme_from_base();
     if (is_eof()) {
       set_authority_from_base();
@@ -348,13 +767,13 @@ class url_parser_context {
       state = url_parse_state::fragment;
     } else {
       if (url.is_special() && (byte == '\\')) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
         state = url_parse_state::relative_slash;
       } else {
         set_authority_from_base();
         set_path_from_base();
-        if (!url.path.empty()) {
-          url.path.pop_back();
+        if (!url.path_empty()) {
+          url.pop_back_path();
         }
         state = url_parse_state::path;
 
@@ -369,10 +788,10 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_relative_slash(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_relative_slash(char byte) -> url_parse_action {
     if (url.is_special() && ((byte == '/') || (byte == '\\'))) {
       if (byte == '\\') {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
       }
       state = url_parse_state::special_authority_ignore_slashes;
     } else if (byte == '/') {
@@ -386,12 +805,12 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_special_authority_slashes(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_special_authority_slashes(char byte) -> url_parse_action {
     if ((byte == '/') && remaining_starts_with("/"sv)) {
       increment();
       state = url_parse_state::special_authority_ignore_slashes;
     } else {
-      *validation_error |= true;
+      report(validation_error_kind::special_scheme_missing_following_solidus);
       decrement();
       state = url_parse_state::special_authority_ignore_slashes;
     }
@@ -399,19 +818,19 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_special_authority_ignore_slashes(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_special_authority_ignore_slashes(char byte) -> url_parse_action {
     if ((byte != '/') && (byte != '\\')) {
       decrement();
       state = url_parse_state::authority;
     } else {
-      *validation_error |= true;
+      report(validation_error_kind::special_scheme_missing_following_solidus);
     }
     return url_parse_action::increment;
   }
 
-  auto parse_authority(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_authority(char byte) -> url_parse_action {
     if (byte == '@') {
-      *validation_error |= true;
+      report(validation_error_kind::invalid_credentials);
       if (at_flag) {
         buffer.insert(0, "%40");
       }
@@ -422,8 +841,8 @@ class url_parser_context {
     } else if (((is_eof()) || (byte == '/') || (byte == '?') || (byte == '#')) ||
                (url.is_special() && (byte == '\\'))) {
       if (at_flag && buffer.empty()) {
-        *validation_error |= true;
-        return tl::make_unexpected(url_parse_errc::empty_hostname);
+        report(validation_error_kind::host_missing);
+        return fail(url_parse_errc::empty_hostname);
       }
       restart_from_beginning_of_buffer();
       state = url_parse_state::host;
@@ -436,8 +855,8 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_hostname(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
-    if (state_override && (url.scheme == "file")) {
+  auto parse_hostname(char byte) -> url_parse_action {
+    if (state_override && (url.scheme() == "file")) {
       state = url_parse_state::file_host;
       if (input_it == begin(input)) {
         return url_parse_action::continue_;
@@ -445,13 +864,13 @@ class url_parser_context {
       decrement();
     } else if ((byte == ':') && !square_braces_flag) {
       if (buffer.empty()) {
-        *validation_error |= true;
-        return tl::make_unexpected(url_parse_errc::empty_hostname);
+        report(validation_error_kind::host_missing);
+        return fail(url_parse_errc::empty_hostname);
       }
 
       auto result = set_host_from_buffer();
       if (!result) {
-        return tl::make_unexpected(result.error());
+        return fail(result.error());
       }
       buffer.clear();
       state = url_parse_state::port;
@@ -465,16 +884,16 @@ class url_parser_context {
       }
 
       if (url.is_special() && buffer.empty()) {
-        *validation_error |= true;
-        return tl::make_unexpected(url_parse_errc::empty_hostname);
-      } else if (state_override && buffer.empty() && (url.includes_credentials() || url.port)) {
-        *validation_error |= true;
+        report(validation_error_kind::host_missing);
+        return fail(url_parse_errc::empty_hostname);
+      } else if (state_override && buffer.empty() && (url.includes_credentials() || url.port())) {
+        report(validation_error_kind::host_missing);
         return url_parse_action::success;
       }
 
       auto result = set_host_from_buffer();
       if (!result) {
-        return tl::make_unexpected(result.error());
+        return fail(result.error());
       }
       buffer.clear();
       state = url_parse_state::path_start;
@@ -493,14 +912,14 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_port(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_port(char byte) -> url_parse_action {
     if (std::isdigit(byte, std::locale::classic())) {
       buffer += byte;
     } else if (((is_eof()) || (byte == '/') || (byte == '?') || (byte == '#')) ||
                (url.is_special() && (byte == '\\')) || state_override) {
       auto result = set_port_from_buffer();
       if (!result) {
-        return tl::make_unexpected(result.error());
+        return fail(result.error());
       }
       buffer.clear();
 
@@ -511,20 +930,20 @@ class url_parser_context {
       decrement();
       state = url_parse_state::path_start;
     } else {
-      *validation_error |= true;
-      return tl::make_unexpected(url_parse_errc::invalid_port);
+      report(validation_error_kind::port_invalid);
+      return fail(url_parse_errc::invalid_port);
     }
 
     return url_parse_action::increment;
   }
 
-  auto parse_file(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_file(char byte) -> url_parse_action {
     set_file_scheme();
     set_empty_host();
 
     if ((byte == '/') || (byte == '\\')) {
       if (byte == '\\') {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
       }
       state = url_parse_state::file_slash;
     } else if (base && (base->scheme == "file")) {
@@ -540,9 +959,9 @@ class url_parser_context {
       } else {
         clear_query();
         if (!details::is_windows_drive_letter(still_to_process())) {
-          details::shorten_path(url.scheme, url.path);
+          details::shorten_path(url);
         } else {
-          *validation_error |= true;
+          report(validation_error_kind::file_invalid_windows_drive_letter);
           clear_path();
         }
         state = url_parse_state::path;
@@ -562,10 +981,10 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_file_slash(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_file_slash(char byte) -> url_parse_action {
     if ((byte == '/') || (byte == '\\')) {
       if (byte == '\\') {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
       }
       state = url_parse_state::file_host;
     } else {
@@ -584,7 +1003,7 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_file_host(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_file_host(char byte) -> url_parse_action {
     if ((is_eof()) || (byte == '/') || (byte == '\\') || (byte == '?') || (byte == '#')) {
       bool at_begin = (input_it == begin(input));
       if (!at_begin) {
@@ -592,7 +1011,7 @@ class url_parser_context {
       }
 
       if (!state_override && details::is_windows_drive_letter(buffer)) {
-        *validation_error |= true;
+        report(validation_error_kind::file_invalid_windows_drive_letter_host);
         state = url_parse_state::path;
       } else if (buffer.empty()) {
         set_empty_host();
@@ -605,10 +1024,10 @@ class url_parser_context {
       } else {
         auto result = set_host_from_buffer();
         if (!result) {
-          return tl::make_unexpected(result.error());
+          return fail(result.error());
         }
-        if (url.host.value().serialize() == "localhost") {
-          url.host.value() = skyr::v2::host{skyr::v2::empty_host{}};
+        if (url.host_is_localhost()) {
+          url.set_empty_host();
         }
 
         if (state_override) {
@@ -626,11 +1045,11 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_path_start(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_path_start(char byte) -> url_parse_action {
     bool at_begin = (input_it == begin(input));
     if (url.is_special()) {
       if (byte == '\\') {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
       }
       state = url_parse_state::path;
       if ((byte != '/') && (byte != '\\')) {
@@ -657,15 +1076,15 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_path(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_path(char byte) -> url_parse_action {
     if (((is_eof()) || (byte == '/')) || (url.is_special() && (byte == '\\')) ||
         (!state_override && ((byte == '?') || (byte == '#')))) {
       if (url.is_special() && (byte == '\\')) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_reverse_solidus);
       }
 
       if (details::is_double_dot_path_segment(buffer)) {
-        details::shorten_path(url.scheme, url.path);
+        details::shorten_path(url);
         if (!((byte == '/') || (url.is_special() && (byte == '\\')))) {
           add_empty_path_element();
         }
@@ -673,9 +1092,9 @@ class url_parser_context {
                  !((byte == '/') || (url.is_special() && (byte == '\\')))) {
         add_empty_path_element();
       } else if (!details::is_single_dot_path_segment(buffer)) {
-        if ((url.scheme == "file") && url.path.empty() && details::is_windows_drive_letter(buffer)) {
-          if (!url.host || !url.host.value().is_empty()) {
-            *validation_error |= true;
+        if ((url.scheme() == "file") && url.path_empty() && details::is_windows_drive_letter(buffer)) {
+          if (!url.has_host() || !url.host_is_empty()) {
+            report(validation_error_kind::file_invalid_windows_drive_letter_host);
             set_empty_host();
           }
           buffer[1] = ':';
@@ -686,9 +1105,13 @@ class url_parser_context {
 
       buffer.clear();
 
-      if ((url.scheme == "file") && (is_eof() || (byte == '?') || (byte == '#'))) {
-        while ((url.path.size() > 1) && url.path[0].empty()) {
-          *validation_error |= true;
+      if (url.path_size() > options.max_segments) {
+        return fail(url_parse_errc::too_many_segments);
+      }
+
+      if ((url.scheme() == "file") && (is_eof() || (byte == '?') || (byte == '#'))) {
+        while ((url.path_size() > 1) && url.path_front().empty()) {
+          report(validation_error_kind::file_empty_path_segment);
           remove_path_element();
         }
       }
@@ -704,7 +1127,7 @@ class url_parser_context {
       }
     } else {
       if (!details::is_url_code_point(byte) && (byte != '%')) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_url_unit);
       }
 
       auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::path);
@@ -714,7 +1137,7 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_cannot_be_a_base_url(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_cannot_be_a_base_url(char byte) -> url_parse_action {
     if (byte == '?') {
       set_empty_query();
       state = url_parse_state::query;
@@ -723,9 +1146,9 @@ class url_parser_context {
       state = url_parse_state::fragment;
     } else {
       if (!is_eof() && (!details::is_url_code_point(byte) && (byte != '%'))) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_url_unit);
       } else if ((byte == '%') && !percent_encoding::is_percent_encoded(still_to_process())) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_url_unit);
       }
       if (!is_eof()) {
         append_to_path0(byte);
@@ -734,7 +1157,7 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_query(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_query(char byte) -> url_parse_action {
     if (!state_override && (byte == '#')) {
       set_empty_fragment();
       state = url_parse_state::fragment;
@@ -749,14 +1172,14 @@ class url_parser_context {
     return url_parse_action::increment;
   }
 
-  auto parse_fragment(char byte) -> tl::expected<url_parse_action, url_parse_errc> {
+  auto parse_fragment(char byte) -> url_parse_action {
     if (!is_eof()) {
       if (!details::is_url_code_point(byte) && (byte != '%')) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_url_unit);
       }
 
       if ((byte == '%') && !percent_encoding::is_percent_encoded(still_to_process())) {
-        *validation_error |= true;
+        report(validation_error_kind::invalid_url_unit);
       }
 
       append_to_fragment(byte);
@@ -765,15 +1188,15 @@ class url_parser_context {
   }
 
   void set_scheme_from_buffer() {
-    url.scheme = buffer;
+    url.set_scheme(buffer);
   }
 
   void set_file_scheme() {
-    url.scheme = "file";
+    url.set_scheme("file"sv);
   }
 
   void set_scheme_from_base() {
-    url.scheme = base->scheme;
+    url.set_scheme(base->scheme);
   }
 
   void set_credentials_from_buffer() {
@@ -786,28 +1209,42 @@ class url_parser_context {
 
       auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
       if (password_token_seen_flag) {
-        url.password += pct_encoded.to_string();
+        url.append_to_password(pct_encoded.to_string());
       } else {
-        url.username += pct_encoded.to_string();
+        url.append_to_username(pct_encoded.to_string());
       }
     }
   }
 
   auto set_host_from_buffer() -> tl::expected<void, url_parse_errc> {
-    auto host = parse_host(buffer, !url.is_special(), validation_error);
+    // checked before the host is decoded, and before the IDNA
+    // algorithm, whose cost grows with the size of the labels
+    if (buffer.size() > options.max_host_size) {
+      return tl::make_unexpected(url_parse_errc::host_too_long);
+    }
+    if (details::max_label_size(buffer) > options.max_label_size) {
+      return tl::make_unexpected(url_parse_errc::label_too_long);
+    }
+
+    [[maybe_unused]] auto timer = details::parser_timer(&parser_stats::host_parses, &parser_stats::host_time);
+    auto host_validation_error = false;
+    auto host = parse_host(buffer, !url.is_special(), &host_validation_error);
+    if (host_validation_error) {
+      report(validation_error_kind::host_invalid);
+    }
     if (!host) {
       return tl::make_unexpected(host.error());
     }
-    url.host = host.value();
+    url.set_host(std::move(host).value());
     return {};
   }
 
   void set_empty_host() {
-    url.host = skyr::host{skyr::empty_host{}};
+    url.set_empty_host();
   }
 
   void set_host_from_base() {
-    url.host = base->host;
+    url.set_host(base->host);
   }
 
   auto set_port_from_buffer() -> tl::expected<void, url_parse_errc> {
@@ -815,106 +1252,94 @@ class url_parser_context {
       auto port = details::port_number(buffer);
 
       if (!port) {
-        *validation_error |= true;
+        report(validation_error_kind::port_invalid);
         return tl::make_unexpected(port.error());
       }
 
-      auto dport = default_port(url.scheme);
+      auto dport = default_port(url.scheme());
       if (dport && (dport.value() == port.value())) {
-        url.port = std::nullopt;
+        url.set_port(std::nullopt);
       } else {
-        url.port = port.value();
+        url.set_port(port.value());
       }
     }
     return {};
   }
 
   void clear_port() {
-    url.port = std::nullopt;
+    url.set_port(std::nullopt);
   }
 
   void set_authority_from_base() {
-    url.username = base->username;
-    url.password = base->password;
-    url.host = base->host;
-    url.port = base->port;
+    url.set_authority_from(*base);
   }
 
   void set_cannot_be_a_base_url_flag() {
-    url.cannot_be_a_base_url = true;
+    url.set_cannot_be_a_base_url();
   }
 
   void clear_path() {
-    url.path.clear();
+    url.clear_path();
   }
 
   void add_empty_path_element() {
-    url.path.emplace_back();
+    url.push_back_path({});
   }
 
   void add_path_element_from_buffer() {
-    url.path.emplace_back(buffer);
+    url.push_back_path(buffer);
   }
 
   void remove_path_element() {
-    auto next_it = std::begin(url.path);
-    ++next_it;
-    std::rotate(std::begin(url.path), next_it, std::end(url.path));
-    url.path.pop_back();
+    url.pop_front_path();
   }
 
   void set_path_from_base() {
-    url.path = base->path;
+    url.set_path_from(*base);
   }
 
   void set_path_from_base0() {
-    url.path.push_back(base->path[0]);
+    url.push_back_path(base->path[0]);
   }
 
   void append_to_path0(char byte) {
     auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::c0_control);
-    url.path[0] += pct_encoded.to_string();
+    url.append_to_path_front(pct_encoded.to_string());
   }
 
   void clear_query() {
-    url.query = std::nullopt;
+    url.clear_query();
   }
 
   void set_empty_query() {
-    url.query = std::string();
+    url.set_empty_query();
   }
 
   void set_query_from_base() {
-    url.query = base->query;
+    url.set_query_from(*base);
   }
 
   void pct_encode_and_append_to_query(char byte) {
-    if (!url.query) {
-      set_empty_query();
-    }
     auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::any);
-    url.query.value() += std::move(pct_encoded).to_string();
+    url.append_to_query(pct_encoded.to_string());
   }
 
   void append_to_query(char byte) {
-    if (!url.query) {
-      set_empty_query();
-    }
-    url.query.value().push_back(byte);
+    url.append_to_query(std::string_view(&byte, 1));
   }
 
   void set_empty_fragment() {
-    url.fragment = std::string();
+    url.set_empty_fragment();
   }
 
   void append_to_fragment(char byte) {
-    if (!url.fragment) {
-      set_empty_fragment();
-    }
     auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::fragment);
-    url.fragment.value() += pct_encoded.to_string();
+    url.append_to_fragment(pct_encoded.to_string());
   }
 };
+
+/// The URL parser, producing a `url_record`
+using url_parser_context = basic_url_parser_context<details::url_record_builder>;
 }  // namespace skyr::inline v2
 
 #endif  // SKYR_V2_CORE_URL_PARSER_CONTEXT_HPP
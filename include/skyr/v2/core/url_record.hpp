@@ -10,6 +10,7 @@
 #include <string>
 #include <cstdint>
 #include <optional>
+#include <skyr/v2/containers/path_segments.hpp>
 #include <skyr/v2/core/host.hpp>
 #include <skyr/v2/core/schemes.hpp>
 
@@ -34,7 +35,9 @@ class url_record {
   std::optional<std::uint16_t> port;
   /// A list of zero or more ASCII strings, used to identify a
   /// location in a hierarchical form
-  std::vector<string_type> path;
+  ///
+  /// The segments are stored contiguously, in one string
+  path_segments path;
   /// An optional ASCII string
   std::optional<string_type> query;
   /// An optional ASCII string
@@ -68,6 +71,22 @@ class url_record {
     return (!host || host.value().is_empty()) || cannot_be_a_base_url || (scheme == "file");
   }
 
+  /// Resets every component, keeping the capacity of the
+  /// strings and of the path
+  ///
+  /// \post The record is equal to a default constructed record
+  void clear() noexcept {
+    scheme.clear();
+    username.clear();
+    password.clear();
+    host.reset();
+    port.reset();
+    path.clear();
+    query.reset();
+    fragment.reset();
+    cannot_be_a_base_url = false;
+  }
+
   /// Swaps two `url_record` objects
   /// \param other Another `url_record` object
   void swap(url_record &other) noexcept {
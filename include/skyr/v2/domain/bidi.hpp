@@ -0,0 +1,162 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_DOMAIN_BIDI_HPP
+#define SKYR_V2_DOMAIN_BIDI_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <skyr/domain/bidi_table.hpp>
+
+namespace skyr::inline v2::idna {
+/// \enum bidi_class
+/// The values of the Bidi_Class property, in the order of the table
+enum class bidi_class {
+  l, r, al, en, es, et, an, cs, nsm, bn, b, s, ws, on, lre, lro, rle, rlo, pdf, lri, rli, fsi, pdi,
+};
+
+/// \enum joining_type
+/// The values of the Joining_Type property, in the order of the table
+enum class joining_type {
+  u, c, d, l, r, t,
+};
+
+/// \enum label_direction
+/// The direction of a label, as given by the Bidi Rule:
+///
+/// https://tools.ietf.org/html/rfc5893#section-2
+///
+enum class label_direction {
+  /// The label has no R, AL or AN code point and satisfies the rule
+  ltr,
+  /// The label has no R, AL or AN code point and does not satisfy the rule,
+  /// which is an error only in a Bidi domain name
+  invalid_ltr,
+  /// The label has an R, AL or AN code point and satisfies the rule
+  rtl,
+  /// The label has an R, AL or AN code point and does not satisfy the rule
+  invalid_rtl,
+};
+
+// the shared table holds the values of bidi_class and joining_type
+static_assert(static_cast<int>(bidi_class::pdi) == 22);
+static_assert(static_cast<int>(joining_type::t) == 5);
+
+///
+/// \param code_point A code point value
+/// \return The bidi class of the code point
+constexpr auto code_point_bidi_class(char32_t code_point) noexcept -> bidi_class {
+  return (code_point <= U'\x10ffff')
+             ? static_cast<bidi_class>(bidi_data::bidi_class_of(bidi_data::value_of(code_point)))
+             : bidi_class::l;
+}
+
+///
+/// \param code_point A code point value
+/// \return The joining type of the code point
+constexpr auto code_point_joining_type(char32_t code_point) noexcept -> joining_type {
+  return (code_point <= U'\x10ffff')
+             ? static_cast<joining_type>(bidi_data::joining_type_of(bidi_data::value_of(code_point)))
+             : joining_type::u;
+}
+
+///
+/// \param label A label, after mapping
+/// \return The direction of the label
+constexpr auto direction_of(std::u32string_view label) noexcept -> label_direction {
+  constexpr auto bit = [](bidi_class value) { return std::uint32_t(1) << static_cast<int>(value); };
+  constexpr auto rtl_classes = bit(bidi_class::r) | bit(bidi_class::al) | bit(bidi_class::an);
+  constexpr auto common_classes = bit(bidi_class::en) | bit(bidi_class::es) | bit(bidi_class::cs) |
+                                  bit(bidi_class::et) | bit(bidi_class::on) | bit(bidi_class::bn) |
+                                  bit(bidi_class::nsm);
+
+  if (label.empty()) {
+    return label_direction::ltr;
+  }
+
+  // the classes of the label are gathered in a bitmap, so
+  // that the rules are a few tests once the label is read
+  auto classes = std::uint32_t(0);
+  auto last = bidi_class::nsm;
+  for (auto code_point : label) {
+    auto value = code_point_bidi_class(code_point);
+    classes |= bit(value);
+    if (value != bidi_class::nsm) {
+      last = value;
+    }
+  }
+  auto first = bit(code_point_bidi_class(label.front()));
+
+  if ((classes & rtl_classes) == 0) {
+    /// Rules 1, 5 and 6
+    auto valid = (first == bit(bidi_class::l)) && ((classes & ~(bit(bidi_class::l) | common_classes)) == 0) &&
+                 ((last == bidi_class::l) || (last == bidi_class::en));
+    return valid ? label_direction::ltr : label_direction::invalid_ltr;
+  }
+
+  /// Rules 1 to 4
+  auto valid = ((first & (bit(bidi_class::r) | bit(bidi_class::al))) != 0) &&
+               ((classes & ~(rtl_classes | common_classes)) == 0) &&
+               ((last == bidi_class::r) || (last == bidi_class::al) || (last == bidi_class::en) ||
+                (last == bidi_class::an)) &&
+               ((classes & (bit(bidi_class::en) | bit(bidi_class::an))) !=
+                (bit(bidi_class::en) | bit(bidi_class::an)));
+  return valid ? label_direction::rtl : label_direction::invalid_rtl;
+}
+
+///
+/// \param label A label, after mapping
+/// \return `true` if each ZERO WIDTH JOINER and ZERO WIDTH NON-JOINER of the
+///         label is allowed by the CONTEXTJ rules
+///
+/// https://tools.ietf.org/html/rfc5892#appendix-A.1
+constexpr auto satisfies_contextj(std::u32string_view label) noexcept -> bool {
+  constexpr auto zwnj = U'\x200c';
+  constexpr auto zwj = U'\x200d';
+
+  for (auto i = std::size_t(0); i < label.size(); ++i) {
+    if ((label[i] != zwnj) && (label[i] != zwj)) {
+      continue;
+    }
+
+    if ((i != 0) && bidi_data::is_virama(label[i - 1])) {
+      continue;
+    }
+
+    if (label[i] == zwj) {
+      return false;
+    }
+
+    /// (Joining_Type:{L,D})(Joining_Type:T)*\u200C(Joining_Type:T)*(Joining_Type:{R,D})
+    auto before = i;
+    while ((before != 0) && (code_point_joining_type(label[before - 1]) == joining_type::t)) {
+      --before;
+    }
+    if (before == 0) {
+      return false;
+    }
+    auto joins_before = code_point_joining_type(label[before - 1]);
+    if ((joins_before != joining_type::l) && (joins_before != joining_type::d)) {
+      return false;
+    }
+
+    auto after = i + 1;
+    while ((after != label.size()) && (code_point_joining_type(label[after]) == joining_type::t)) {
+      ++after;
+    }
+    if (after == label.size()) {
+      return false;
+    }
+    auto joins_after = code_point_joining_type(label[after]);
+    if ((joins_after != joining_type::r) && (joins_after != joining_type::d)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace skyr::inline v2::idna
+
+#endif  // SKYR_V2_DOMAIN_BIDI_HPP
@@ -8,6 +8,7 @@
 
 #include <string>
 #include <string_view>
+#include <span>
 #include <algorithm>
 #include <iterator>
 #include <tl/expected.hpp>
@@ -22,23 +23,31 @@
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/transform.hpp>
-#include <skyr/v2/unicode/ranges/transforms/u32_transform.hpp>
 #include <skyr/v2/unicode/ranges/transforms/u8_transform.hpp>
-#include <skyr/v2/unicode/ranges/views/u8_view.hpp>
+#include <skyr/v2/unicode/transcode.hpp>
 #include <skyr/v2/domain/errors.hpp>
 #include <skyr/v2/domain/idna.hpp>
+#include <skyr/v2/domain/bidi.hpp>
+#include <skyr/v2/platform/tracepoints.hpp>
+#include <skyr/v2/domain/nfc.hpp>
 #include <skyr/v2/domain/punycode.hpp>
+#include <skyr/v2/containers/static_vector.hpp>
 
 namespace skyr::inline v2 {
 constexpr inline auto validate_label(std::u32string_view label, [[maybe_unused]] bool use_std3_ascii_rules,
-                                     bool check_hyphens, [[maybe_unused]] bool check_bidi,
-                                     [[maybe_unused]] bool check_joiners, bool transitional_processing)
-    -> tl::expected<void, domain_errc> {
+                                     bool check_hyphens, bool check_bidi, bool check_joiners,
+                                     bool transitional_processing) -> tl::expected<idna::label_direction, domain_errc> {
   /// https://www.unicode.org/reports/tr46/#Validity_Criteria;
 
+  /// Criterion 1; mapped labels are already normalized, so this is
+  /// a quick check unless the label came from Punycode
+  if (!idna::is_nfc(label)) {
+    return tl::make_unexpected(domain_errc::bad_input);
+  }
+
   if (check_hyphens) {
     /// Criterion 2
-    if ((label.size() >= 4) && (label.substr(2, 4) == U"--")) {
+    if ((label.size() >= 4) && (label.substr(2, 2) == U"--")) {
       return tl::make_unexpected(domain_errc::bad_input);
     }
 
@@ -69,7 +78,22 @@ constexpr inline auto validate_label(std::u32string_view label, [[maybe_unused]]
     }
   }
 
-  return {};
+  /// Criterion 7
+  if (check_joiners && !idna::satisfies_contextj(label)) {
+    return tl::make_unexpected(domain_errc::bad_input);
+  }
+
+  /// Criterion 8, for this label; an LTR label which does not satisfy the
+  /// rule is only an error in a Bidi domain name, which the caller knows
+  if (check_bidi) {
+    auto direction = idna::direction_of(label);
+    if (direction == idna::label_direction::invalid_rtl) {
+      return tl::make_unexpected(domain_errc::bad_input);
+    }
+    return direction;
+  }
+
+  return idna::label_direction::ltr;
 }
 
 ///
@@ -86,10 +110,21 @@ struct domain_to_ascii_context {
   bool transitional_processing;
   bool verify_dns_length;
 
-  // These are intermediate buffers
+  // This is an intermediate buffer, of which the first `label_count`
+  // labels are used, so that a context can be reused without
+  // releasing the memory of its labels
   std::vector<std::u32string> labels;
-  std::string punycode_encoded;
-  std::u32string punycode_decoded;
+  std::size_t label_count = 0;
+
+  /// \returns The next label, which is empty
+  auto next_label() -> std::u32string & {
+    if (label_count == labels.size()) {
+      labels.emplace_back();
+    }
+    auto &label = labels[label_count++];
+    label.clear();
+    return label;
+  }
 };
 
 ///
@@ -106,7 +141,7 @@ inline auto create_domain_to_ascii_context(std::string_view domain_name, std::st
                                            bool check_bidi, bool check_joiners, bool use_std3_ascii_rules,
                                            bool transitional_processing, bool verify_dns_length)
     -> tl::expected<domain_to_ascii_context, domain_errc> {
-  auto u32domain_name = unicode::as<std::u32string>(unicode::views::as_u8(domain_name) | unicode::transforms::to_u32);
+  auto u32domain_name = unicode::u8_to_u32(domain_name);
   if (u32domain_name) {
     return domain_to_ascii_context{u32domain_name.value(),
                                    ascii_domain,
@@ -117,31 +152,33 @@ inline auto create_domain_to_ascii_context(std::string_view domain_name, std::st
                                    transitional_processing,
                                    verify_dns_length,
                                    {},
-                                   {},
-                                   {}};
+                                   0};
   } else {
     return tl::make_unexpected(domain_errc::encoding_error);
   }
 }
 
+/// Converts the domain of a context, which keeps its buffers so
+/// that it can be reused
 ///
 /// \param context
 /// \return
-inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expected<void, domain_errc> {
+inline auto domain_to_ascii_impl(domain_to_ascii_context &context) -> tl::expected<void, domain_errc> {
   /// https://www.unicode.org/reports/tr46/#ToASCII
 
-  constexpr auto map_domain_name =
-      [](domain_to_ascii_context &&ctx) -> tl::expected<domain_to_ascii_context, domain_errc> {
+  constexpr auto map_domain_name = [](domain_to_ascii_context &ctx) -> tl::expected<void, domain_errc> {
     auto result = idna::map_code_points(ctx.domain_name, ctx.use_std3_ascii_rules, ctx.transitional_processing);
     if (result) {
       ctx.domain_name.erase(result.value(), std::cend(ctx.domain_name));
-      return std::move(ctx);
+      /// https://www.unicode.org/reports/tr46/#Processing, step 2
+      idna::normalize_nfc(&ctx.domain_name);
+      return {};
     } else {
       return tl::make_unexpected(result.error());
     }
   };
 
-  constexpr auto process_labels = [](auto &&ctx) -> tl::expected<std::decay_t<decltype(ctx)>, domain_errc> {
+  constexpr auto process_labels = [](domain_to_ascii_context &ctx) -> tl::expected<void, domain_errc> {
     using namespace std::string_view_literals;
 
     constexpr auto to_string_view = [](auto &&label) {
@@ -149,26 +186,42 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expec
       return std::u32string_view(std::addressof(*std::cbegin(label)), size);
     };
 
+    auto is_bidi_domain = false;
+    auto has_invalid_ltr_label = false;
     for (auto &&label : ctx.domain_name | ranges::views::split(U'.') | ranges::views::transform(to_string_view)) {
+      auto validated = tl::expected<idna::label_direction, domain_errc>{};
       if ((label.size() >= 4) && (label.substr(0, 4) == U"xn--")) {
-        ctx.punycode_decoded.clear();
-        auto decoded = punycode_decode(label.substr(4), &ctx.punycode_decoded);
-        if (!decoded) {
-          return tl::make_unexpected(decoded.error());
+        // labels that fit are decoded on the stack
+        auto decoded_buffer = static_vector<char32_t, punycode::label_capacity>{};
+        auto decoded_heap_buffer = std::u32string{};
+        auto decoded_label = std::u32string_view{};
+        if ((label.size() - 4) <= decoded_buffer.capacity()) {
+          decoded_buffer.resize(decoded_buffer.capacity());
+          auto decoded =
+              punycode_decode(label.substr(4), std::span<char32_t>(decoded_buffer.data(), decoded_buffer.size()));
+          if (!decoded) {
+            return tl::make_unexpected(decoded.error());
+          }
+          decoded_label = std::u32string_view(decoded_buffer.data(), decoded.value());
+        } else {
+          auto decoded = punycode_decode(label.substr(4), &decoded_heap_buffer);
+          if (!decoded) {
+            return tl::make_unexpected(decoded.error());
+          }
+          decoded_label = decoded_heap_buffer;
         }
 
-        auto validated = validate_label(ctx.punycode_decoded, ctx.use_std3_ascii_rules, ctx.check_hyphens,
-                                        ctx.check_bidi, ctx.check_joiners, false);
-        if (!validated) {
-          return tl::make_unexpected(validated.error());
-        }
+        validated = validate_label(decoded_label, ctx.use_std3_ascii_rules, ctx.check_hyphens, ctx.check_bidi,
+                                   ctx.check_joiners, false);
       } else {
-        auto validated = validate_label(label, ctx.use_std3_ascii_rules, ctx.check_hyphens, ctx.check_bidi,
-                                        ctx.check_joiners, ctx.transitional_processing);
-        if (!validated) {
-          return tl::make_unexpected(validated.error());
-        }
+        validated = validate_label(label, ctx.use_std3_ascii_rules, ctx.check_hyphens, ctx.check_bidi,
+                                   ctx.check_joiners, ctx.transitional_processing);
       }
+      if (!validated) {
+        return tl::make_unexpected(validated.error());
+      }
+      is_bidi_domain |= (validated.value() == idna::label_direction::rtl);
+      has_invalid_ltr_label |= (validated.value() == idna::label_direction::invalid_ltr);
 
       constexpr auto is_ascii = [](std::u32string_view input) noexcept {
         constexpr auto is_in_ascii_set = [](auto c) { return c <= U'\x7e'; };
@@ -176,29 +229,45 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expec
         return ranges::cend(input) == ranges::find_if_not(input, is_in_ascii_set);
       };
 
-      ctx.labels.emplace_back();
+      auto &output_label = ctx.next_label();
       if (!is_ascii(label)) {
-        ctx.punycode_encoded.clear();
-        auto result = punycode_encode(label, &ctx.punycode_encoded);
-        if (!result) {
+        // labels are encoded on the stack unless they are too long
+        auto encoded_buffer = static_vector<char, punycode::label_capacity>{};
+        encoded_buffer.resize(encoded_buffer.capacity());
+        auto encoded_heap_buffer = std::string{};
+        auto encoded_label = std::string_view{};
+        auto result = punycode_encode(label, std::span<char>(encoded_buffer.data(), encoded_buffer.size()));
+        if (result) {
+          encoded_label = std::string_view(encoded_buffer.data(), result.value());
+        } else if (result.error() == domain_errc::big_output) {
+          auto heap_result = punycode_encode(label, &encoded_heap_buffer);
+          if (!heap_result) {
+            return tl::make_unexpected(heap_result.error());
+          }
+          encoded_label = encoded_heap_buffer;
+        } else {
           return tl::make_unexpected(result.error());
         }
-        ranges::copy(U"xn--"sv, ranges::back_inserter(ctx.labels.back()));
-        ranges::copy(ctx.punycode_encoded, ranges::back_inserter(ctx.labels.back()));
+        ranges::copy(U"xn--"sv, ranges::back_inserter(output_label));
+        ranges::copy(encoded_label, ranges::back_inserter(output_label));
       } else {
-        ranges::copy(label, ranges::back_inserter(ctx.labels.back()));
+        ranges::copy(label, ranges::back_inserter(output_label));
       }
     }
 
+    /// Criterion 8, for the whole domain
+    if (is_bidi_domain && has_invalid_ltr_label) {
+      return tl::make_unexpected(domain_errc::bad_input);
+    }
+
     if (ctx.domain_name.back() == U'.') {
-      ctx.labels.emplace_back();
+      ctx.next_label();
     }
 
-    return std::move(ctx);
+    return {};
   };
 
-  constexpr auto check_length =
-      [](auto &&ctx) -> tl::expected<std::decay_t<decltype(ctx)>, domain_errc> {
+  constexpr auto check_length = [](domain_to_ascii_context &ctx) -> tl::expected<void, domain_errc> {
     constexpr auto max_domain_length = 253;
     constexpr auto max_label_length = 63;
 
@@ -208,24 +277,116 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expec
         return tl::make_unexpected(domain_errc::invalid_length);
       }
 
-      for (const auto &label : ctx.labels) {
-        auto label_length = label.size();
+      for (auto i = std::size_t(0); i < ctx.label_count; ++i) {
+        auto label_length = ctx.labels[i].size();
         if ((label_length < 1) || (label_length > max_label_length)) {
           return tl::make_unexpected(domain_errc::invalid_length);
         }
       }
     }
 
-    return std::move(ctx);
+    return {};
   };
 
-  constexpr auto copy_to_output = [](domain_to_ascii_context &&ctx) -> tl::expected<void, domain_errc> {
-    ranges::copy(ctx.labels | ranges::views::join('.'), ranges::back_inserter(*ctx.ascii_domain));
+  constexpr auto copy_to_output = [](domain_to_ascii_context &ctx) -> tl::expected<void, domain_errc> {
+    for (auto i = std::size_t(0); i < ctx.label_count; ++i) {
+      if (i != 0) {
+        ctx.ascii_domain->push_back('.');
+      }
+      ranges::copy(ctx.labels[i], ranges::back_inserter(*ctx.ascii_domain));
+    }
     return {};
   };
 
-  return map_domain_name(std::move(context)).and_then(process_labels).and_then(check_length).and_then(copy_to_output);
+  context.label_count = 0;
+  return map_domain_name(context)
+      .and_then([&]() { return process_labels(context); })
+      .and_then([&]() { return check_length(context); })
+      .and_then([&]() { return copy_to_output(context); });
+}
+
+///
+/// \param context
+/// \return
+inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expected<void, domain_errc> {
+  return domain_to_ascii_impl(context);
+}
+
+namespace details {
+/// Converts a domain made only of ASCII letters, digits, hyphens and
+/// dots, without transcoding, mapping or punycode
+///
+/// Letters are lowercased, which is the IDNA mapping for ASCII. Any
+/// domain that IDNA processing could change in other ways, or that
+/// fails validation, is rejected.
+///
+/// \param domain_name A domain
+/// \param ascii_domain The ASCII domain is appended here
+/// \param check_hyphens
+/// \param verify_dns_length
+/// \returns `true` if the ASCII domain was written, `false` if full
+///          processing is needed
+inline auto ascii_domain_to_ascii(std::string_view domain_name, std::string *ascii_domain, bool check_hyphens,
+                                  bool verify_dns_length) -> bool {
+  constexpr auto max_domain_length = 253;
+  constexpr auto max_label_length = 63;
+
+  if (domain_name.empty()) {
+    return false;
+  }
+
+  // a branch-free pass so that the check vectorizes
+  auto is_ldh = true;
+  for (auto c : domain_name) {
+    auto byte = static_cast<unsigned char>(c);
+    is_ldh &= (static_cast<unsigned char>((byte | 0x20u) - 'a') < 26u) |
+              (static_cast<unsigned char>(byte - '0') < 10u) | (byte == '-') | (byte == '.');
+  }
+  if (!is_ldh) {
+    return false;
+  }
+
+  if (verify_dns_length && (domain_name.size() > max_domain_length)) {
+    return false;
+  }
+
+  constexpr auto to_lower = [](char byte) {
+    return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte | 0x20) : byte;
+  };
+
+  auto labels = domain_name;
+  while (true) {
+    auto dot = labels.find('.');
+    auto label = labels.substr(0, dot);
+
+    // punycode labels are decoded and validated
+    if ((label.size() >= 4) && (to_lower(label[0]) == 'x') && (to_lower(label[1]) == 'n') && (label[2] == '-') &&
+        (label[3] == '-')) {
+      return false;
+    }
+
+    if (check_hyphens && !label.empty() &&
+        (((label.size() >= 4) && (label.substr(2, 2) == "--")) || (label.front() == '-') || (label.back() == '-'))) {
+      return false;
+    }
+
+    if (verify_dns_length && (label.empty() || (label.size() > max_label_length))) {
+      return false;
+    }
+
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    labels.remove_prefix(dot + 1);
+  }
+
+  auto offset = ascii_domain->size();
+  ascii_domain->append(domain_name);
+  std::transform(std::begin(*ascii_domain) + offset, std::end(*ascii_domain), std::begin(*ascii_domain) + offset,
+                 to_lower);
+  return true;
 }
+}  // namespace details
 
 ///
 /// \param domain_name
@@ -240,9 +401,17 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context &&context) -> tl::expec
 inline auto domain_to_ascii(std::string_view domain_name, std::string *ascii_domain, bool check_hyphens,
                             bool check_bidi, bool check_joiners, bool use_std3_ascii_rules,
                             bool transitional_processing, bool verify_dns_length) -> tl::expected<void, domain_errc> {
-  return create_domain_to_ascii_context(domain_name, ascii_domain, check_hyphens, check_bidi, check_joiners,
-                                        use_std3_ascii_rules, transitional_processing, verify_dns_length)
-      .and_then(domain_to_ascii_impl);
+  SKYR_TRACE2(domain_to_ascii_entry, domain_name.data(), domain_name.size());
+  if (details::ascii_domain_to_ascii(domain_name, ascii_domain, check_hyphens, verify_dns_length)) {
+    SKYR_TRACE1(domain_to_ascii_return, true);
+    return {};
+  }
+
+  auto result = create_domain_to_ascii_context(domain_name, ascii_domain, check_hyphens, check_bidi, check_joiners,
+                                               use_std3_ascii_rules, transitional_processing, verify_dns_length)
+                    .and_then([](domain_to_ascii_context &&context) { return domain_to_ascii_impl(context); });
+  SKYR_TRACE1(domain_to_ascii_return, result.has_value());
+  return result;
 }
 
 /// Converts a UTF-8 encoded domain to ASCII using
@@ -303,9 +472,6 @@ struct domain_to_u8_context {
   std::string *u8_domain;
 
   std::vector<std::string> labels;
-
-  /// This is used as an intermediate buffer
-  std::u32string punycode_decoded;
 };
 
 ///
@@ -320,12 +486,25 @@ inline auto domain_to_u8_impl(domain_to_u8_context &&context) -> tl::expected<vo
     context.labels.emplace_back();
     if (label.substr(0, 4) == "xn--") {
       label.remove_prefix(4);
-      context.punycode_decoded.clear();
-      auto result = punycode_decode(label, &context.punycode_decoded);
-      if (!result) {
-        return tl::make_unexpected(result.error());
+      // labels that fit are decoded on the stack
+      auto decoded_buffer = static_vector<char32_t, punycode::label_capacity>{};
+      auto decoded_heap_buffer = std::u32string{};
+      auto decoded_label = std::u32string_view{};
+      if (label.size() <= decoded_buffer.capacity()) {
+        decoded_buffer.resize(decoded_buffer.capacity());
+        auto result = punycode_decode(label, std::span<char32_t>(decoded_buffer.data(), decoded_buffer.size()));
+        if (!result) {
+          return tl::make_unexpected(result.error());
+        }
+        decoded_label = std::u32string_view(decoded_buffer.data(), result.value());
+      } else {
+        auto result = punycode_decode(label, &decoded_heap_buffer);
+        if (!result) {
+          return tl::make_unexpected(result.error());
+        }
+        decoded_label = decoded_heap_buffer;
       }
-      auto u8 = context.punycode_decoded | unicode::transforms::to_u8;
+      auto u8 = decoded_label | unicode::transforms::to_u8;
       auto first = std::cbegin(u8);
       auto last = std::cend(u8);
       for (auto it = first; it != last; ++it) {
@@ -345,13 +524,40 @@ inline auto domain_to_u8_impl(domain_to_u8_context &&context) -> tl::expected<vo
   return {};
 }
 
+namespace details {
+/// Tests whether any label of a domain starts with the Punycode
+/// prefix "xn--"
+///
+/// The prefix is searched with `std::string_view::find`, which
+/// scans for its first character with `memchr`.
+///
+/// \param domain_name A domain
+/// \returns `true` if a label is Punycode encoded
+constexpr inline auto has_punycode_label(std::string_view domain_name) noexcept {
+  auto pos = domain_name.find("xn--");
+  while (pos != std::string_view::npos) {
+    if ((pos == 0) || (domain_name[pos - 1] == '.')) {
+      return true;
+    }
+    pos = domain_name.find("xn--", pos + 1);
+  }
+  return false;
+}
+}  // namespace details
+
 /// Converts a Punycode encoded domain to UTF-8
 ///
 /// \param domain_name A Punycode encoded domain
 /// \returns A valid UTF-8 encoded domain, or an error
 inline auto domain_to_u8(std::string_view domain_name, std::string *u8_domain, [[maybe_unused]] bool *validation_error)
     -> tl::expected<void, domain_errc> {
-  auto context = domain_to_u8_context{domain_name, u8_domain, {}, {}};
+  // domains without Punycode labels are already UTF-8
+  if (!details::has_punycode_label(domain_name)) {
+    u8_domain->append(domain_name);
+    return {};
+  }
+
+  auto context = domain_to_u8_context{domain_name, u8_domain, {}};
   return domain_to_u8_impl(std::move(context));
 }
 
@@ -363,6 +569,25 @@ inline auto domain_to_u8(std::string_view domain_name, std::string *u8_domain) -
   [[maybe_unused]] bool validation_error = false;
   return domain_to_u8(domain_name, u8_domain, &validation_error);
 }
+
+/// Converts a Punycode encoded domain to UTF-8, without copying it
+/// when none of its labels is Punycode encoded
+///
+/// \param domain_name A Punycode encoded domain
+/// \param buffer A buffer for the decoded domain, which is only
+///               used when a label is Punycode encoded
+/// \returns A view of the UTF-8 encoded domain, which references
+///          either `domain_name` or `*buffer`, or an error
+inline auto domain_to_u8_view(std::string_view domain_name, std::string *buffer)
+    -> tl::expected<std::string_view, domain_errc> {
+  if (!details::has_punycode_label(domain_name)) {
+    return domain_name;
+  }
+
+  buffer->clear();
+  auto context = domain_to_u8_context{domain_name, buffer, {}};
+  return domain_to_u8_impl(std::move(context)).map([buffer]() { return std::string_view(*buffer); });
+}
 }  // namespace skyr::inline v2
 
 #endif  // SKYR_V2_DOMAIN_DOMAIN_HPP
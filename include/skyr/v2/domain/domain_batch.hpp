@@ -0,0 +1,124 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_DOMAIN_DOMAIN_BATCH_HPP
+#define SKYR_V2_DOMAIN_DOMAIN_BATCH_HPP
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <tl/expected.hpp>
+#include <skyr/v2/domain/domain.hpp>
+#include <skyr/v2/domain/domain_cache.hpp>
+#include <skyr/v2/domain/errors.hpp>
+#include <skyr/v2/unicode/transcode.hpp>
+
+namespace skyr::inline v2 {
+/// Converts many domains to ASCII, reusing its memory from one
+/// domain to the next
+///
+/// The results are written one after the other in a buffer owned
+/// by the batch, and are returned as views of it. The UTF-32
+/// buffer and the labels of the IDNA processing are kept between
+/// domains, and between calls, so that a batch which has seen a
+/// few domains converts the next ones without allocating.
+///
+/// Domains made only of ASCII letters, digits, hyphens and dots
+/// take the same fast path as `domain_to_ascii`. The others are
+/// looked up in a cache, if there is one, and processed otherwise.
+///
+/// A batch is not thread safe, but each thread may use its own
+/// batch with a shared cache.
+class domain_batch {
+ public:
+  /// The result of the conversion of one domain
+  using result_type = tl::expected<std::string_view, domain_errc>;
+
+  /// Constructor
+  /// \param be_strict Tells the processor to be strict, as the
+  ///        argument of `domain_to_ascii`
+  /// \param cache A cache of the results of the domains which are
+  ///        not ASCII, or `nullptr`; the cache holds results which
+  ///        are not strict, so it is only used when `be_strict` is
+  ///        `false`
+  explicit domain_batch(bool be_strict = false, domain_cache *cache = nullptr)
+      : be_strict_(be_strict), cache_(be_strict ? nullptr : cache) {
+  }
+
+  /// Converts domains to ASCII
+  ///
+  /// Each result is the same as that of
+  /// `domain_to_ascii(domain_name, &output, be_strict)`.
+  ///
+  /// \param domain_names The UTF-8 encoded domains
+  /// \returns The result of each domain, which views memory of the
+  ///          batch that is valid until the next call
+  auto domain_to_ascii(std::span<const std::string_view> domain_names) -> std::span<const result_type> {
+    arena_.clear();
+    ends_.clear();
+    results_.clear();
+
+    for (auto domain_name : domain_names) {
+      auto offset = arena_.size();
+      auto converted = convert(domain_name);
+      if (converted && (arena_.size() == offset)) {
+        converted = tl::make_unexpected(domain_errc::empty_string);
+      }
+      if (!converted) {
+        arena_.resize(offset);
+        results_.emplace_back(tl::make_unexpected(converted.error()));
+      } else {
+        results_.emplace_back();
+      }
+      ends_.push_back(arena_.size());
+    }
+
+    // the views are made once the arena has stopped growing
+    auto first = std::size_t(0);
+    for (auto i = std::size_t(0); i < results_.size(); ++i) {
+      if (results_[i]) {
+        results_[i] = std::string_view(arena_.data() + first, ends_[i] - first);
+      }
+      first = ends_[i];
+    }
+    return results_;
+  }
+
+ private:
+  auto convert(std::string_view domain_name) -> tl::expected<void, domain_errc> {
+    if (details::ascii_domain_to_ascii(domain_name, &arena_, false, be_strict_)) {
+      return {};
+    }
+
+    if (cache_ != nullptr) {
+      return cache_->domain_to_ascii(domain_name, &arena_);
+    }
+
+    if (!unicode::u8_to_u32(domain_name, &context_.domain_name)) {
+      return tl::make_unexpected(domain_errc::encoding_error);
+    }
+    context_.ascii_domain = &arena_;
+    context_.check_hyphens = false;
+    context_.check_bidi = true;
+    context_.check_joiners = true;
+    context_.use_std3_ascii_rules = be_strict_;
+    context_.transitional_processing = false;
+    context_.verify_dns_length = be_strict_;
+    return domain_to_ascii_impl(context_);
+  }
+
+  bool be_strict_;
+  domain_cache *cache_;
+  domain_to_ascii_context context_{};
+  std::string arena_;
+  std::vector<std::size_t> ends_;
+  std::vector<result_type> results_;
+};
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_DOMAIN_DOMAIN_BATCH_HPP
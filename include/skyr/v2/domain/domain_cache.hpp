@@ -0,0 +1,215 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_DOMAIN_DOMAIN_CACHE_HPP
+#define SKYR_V2_DOMAIN_DOMAIN_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <tl/expected.hpp>
+#include <skyr/v2/domain/domain.hpp>
+#include <skyr/v2/domain/errors.hpp>
+
+namespace skyr::inline v2 {
+/// A cache of the results of `domain_to_ascii`
+///
+/// The cache is split into shards, each with its own lock and
+/// least recently used list, so that threads converting different
+/// domains rarely wait for each other. The memory used by the
+/// domains and their results is bounded by a budget, which is
+/// divided between the shards.
+class domain_cache {
+ public:
+  /// The number of shards
+  static constexpr std::size_t shard_count = 16;
+
+  /// The memory budget of a default constructed cache, in bytes
+  static constexpr std::size_t default_budget = 4ul * 1024ul * 1024ul;
+
+  /// Constructor
+  /// \param budget The maximum number of bytes used by the entries
+  explicit domain_cache(std::size_t budget = default_budget) : shard_budget_(budget / shard_count) {
+  }
+
+  domain_cache(const domain_cache &) = delete;
+  domain_cache(domain_cache &&) = delete;
+  auto operator=(const domain_cache &) -> domain_cache & = delete;
+  auto operator=(domain_cache &&) -> domain_cache & = delete;
+
+  ~domain_cache() = default;
+
+  /// Converts a UTF-8 encoded domain to ASCII, using the cached result
+  /// if there is one
+  ///
+  /// The result is the same as `domain_to_ascii(domain_name, ascii_domain)`.
+  ///
+  /// \param domain_name A domain
+  /// \param ascii_domain The ASCII domain, which is appended to
+  /// \returns `void`, or an error
+  auto domain_to_ascii(std::string_view domain_name, std::string *ascii_domain) -> tl::expected<void, domain_errc> {
+    auto &shard = shards_[std::hash<std::string_view>{}(domain_name) % shard_count];
+
+    {
+      auto lock = std::lock_guard<std::mutex>(shard.mutex);
+      auto it = shard.index.find(domain_name);
+      if (it != shard.index.end()) {
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return copy_result(it->second->result, ascii_domain);
+      }
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+
+    // the conversion is done without holding the lock
+    auto result = tl::expected<std::string, domain_errc>{};
+    auto converted = skyr::v2::domain_to_ascii(domain_name, &result.value());
+    if (!converted) {
+      result = tl::make_unexpected(converted.error());
+    }
+
+    auto size = entry_size(domain_name, result);
+    if (size <= shard_budget_) {
+      auto lock = std::lock_guard<std::mutex>(shard.mutex);
+      if (shard.index.find(domain_name) == shard.index.end()) {
+        shard.entries.push_front(entry{std::string(domain_name), result});
+        shard.index.emplace(shard.entries.front().domain_name, shard.entries.begin());
+        shard.memory_usage += size;
+        evict(shard);
+      }
+    }
+
+    return copy_result(result, ascii_domain);
+  }
+
+  /// \returns The number of conversions that used a cached result
+  [[nodiscard]] auto hits() const noexcept -> std::uint64_t {
+    auto count = std::uint64_t{0};
+    for (const auto &shard : shards_) {
+      count += shard.hits.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  /// \returns The number of conversions that were not cached
+  [[nodiscard]] auto misses() const noexcept -> std::uint64_t {
+    auto count = std::uint64_t{0};
+    for (const auto &shard : shards_) {
+      count += shard.misses.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  /// \returns The number of cached domains
+  [[nodiscard]] auto size() const -> std::size_t {
+    auto count = std::size_t{0};
+    for (auto &shard : shards_) {
+      auto lock = std::lock_guard<std::mutex>(shard.mutex);
+      count += shard.index.size();
+    }
+    return count;
+  }
+
+  /// \returns The number of bytes used by the cached entries
+  [[nodiscard]] auto memory_usage() const -> std::size_t {
+    auto usage = std::size_t{0};
+    for (auto &shard : shards_) {
+      auto lock = std::lock_guard<std::mutex>(shard.mutex);
+      usage += shard.memory_usage;
+    }
+    return usage;
+  }
+
+  /// Removes every cached entry, keeping the counters
+  void clear() {
+    for (auto &shard : shards_) {
+      auto lock = std::lock_guard<std::mutex>(shard.mutex);
+      shard.index.clear();
+      shard.entries.clear();
+      shard.memory_usage = 0;
+    }
+  }
+
+ private:
+  struct entry {
+    std::string domain_name;
+    tl::expected<std::string, domain_errc> result;
+  };
+
+  using entry_list = std::list<entry>;
+
+  struct string_hash {
+    using is_transparent = void;
+
+    auto operator()(std::string_view value) const noexcept -> std::size_t {
+      return std::hash<std::string_view>{}(value);
+    }
+  };
+
+  struct shard {
+    mutable std::mutex mutex;
+    entry_list entries;
+    std::unordered_map<std::string_view, entry_list::iterator, string_hash, std::equal_to<>> index;
+    std::size_t memory_usage = 0;
+    std::atomic<std::uint64_t> hits = 0;
+    std::atomic<std::uint64_t> misses = 0;
+  };
+
+  static auto entry_size(std::string_view domain_name, const tl::expected<std::string, domain_errc> &result) noexcept
+      -> std::size_t {
+    // the list node and the index node are counted as overhead
+    constexpr auto overhead = sizeof(entry) + (4 * sizeof(void *));
+    return domain_name.size() + (result ? result.value().size() : 0) + overhead;
+  }
+
+  static auto copy_result(const tl::expected<std::string, domain_errc> &result, std::string *ascii_domain)
+      -> tl::expected<void, domain_errc> {
+    if (!result) {
+      return tl::make_unexpected(result.error());
+    }
+    ascii_domain->append(result.value());
+    return {};
+  }
+
+  void evict(shard &shard) {
+    while (shard.memory_usage > shard_budget_) {
+      const auto &last = shard.entries.back();
+      shard.memory_usage -= entry_size(last.domain_name, last.result);
+      shard.index.erase(last.domain_name);
+      shard.entries.pop_back();
+    }
+  }
+
+  std::size_t shard_budget_;
+  std::array<shard, shard_count> shards_;
+};
+
+namespace details {
+inline std::atomic<domain_cache *> installed_domain_cache = nullptr;
+}  // namespace details
+
+/// Installs a cache that is used when hosts are parsed
+///
+/// The cache must outlive every parse that may use it.
+///
+/// \param cache The cache, or `nullptr` to stop using a cache
+inline void set_domain_cache(domain_cache *cache) noexcept {
+  details::installed_domain_cache.store(cache, std::memory_order_release);
+}
+
+/// \returns The cache used when hosts are parsed, or `nullptr`
+inline auto get_domain_cache() noexcept -> domain_cache * {
+  return details::installed_domain_cache.load(std::memory_order_acquire);
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_DOMAIN_DOMAIN_CACHE_HPP
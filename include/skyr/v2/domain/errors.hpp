@@ -24,6 +24,8 @@ enum class domain_errc {
   empty_string,
   /// The number of labels in the domain is too large
   too_many_labels,
+  /// The output buffer is too small
+  big_output,
 };
 }  // namespace skyr::inline v2
 
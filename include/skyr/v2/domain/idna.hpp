@@ -6,47 +6,36 @@
 #ifndef SKYR_V2_DOMAIN_IDNA_HPP
 #define SKYR_V2_DOMAIN_IDNA_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <tl/expected.hpp>
 #include <skyr/v2/domain/errors.hpp>
 #include <skyr/v2/unicode/traits/range_iterator.hpp>
-#include <skyr/v2/domain/idna_tables.hpp>
+#include <skyr/v2/domain/idna_status.hpp>
+#include <skyr/domain/idna_table.hpp>
 
 namespace skyr::inline v2::idna {
+// the shared table holds the values of idna_status
+static_assert(static_cast<int>(idna_status::disallowed) == 1);
+static_assert(static_cast<int>(idna_status::valid) == 7);
+
 ///
 /// \param code_point A code point value
 /// \return The status of the code point
 constexpr auto code_point_status(char32_t code_point) -> idna_status {
-  constexpr auto less = [](const auto &range, auto code_point) { return range.last < code_point; };
-
-  auto first = std::cbegin(details::statuses), last = std::cend(details::statuses);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it == last) || !((code_point >= (*it).first) && (code_point <= (*it).last)) ? idna_status::valid : it->status;
-}
-
-namespace details {
-constexpr auto map_code_point_16(char16_t code_point) -> char16_t {
-  constexpr auto less = [](const auto &lhs, auto rhs) { return lhs.code_point < rhs; };
-
-  auto first = std::cbegin(mapped_16), last = std::cend(mapped_16);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it != last) ? it->mapped : code_point;
+  return (code_point <= U'\x10ffff') ? static_cast<idna_status>(idna_data::status_of(idna_data::run_of(code_point)))
+                                      : idna_status::valid;
 }
-}  // namespace details
 
 ///
 /// \param code_point A code point value
 /// \return The code point or mapped value, depending on the status of the code
 /// point
 constexpr auto map_code_point(char32_t code_point) -> char32_t {
-  constexpr auto less = [](const auto &lhs, auto rhs) { return lhs.code_point < rhs; };
-
-  if (code_point <= U'\xffff') {
-    return static_cast<char32_t>(details::map_code_point_16(static_cast<char16_t>(code_point)));
-  }
-
-  auto first = std::cbegin(details::mapped_32), last = std::cend(details::mapped_32);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it != last) ? it->mapped : code_point;
+  return (code_point <= U'\x10ffff')
+             ? static_cast<char32_t>(static_cast<std::int32_t>(code_point) +
+                                     idna_data::offset_of(idna_data::run_of(code_point)))
+             : code_point;
 }
 
 ///
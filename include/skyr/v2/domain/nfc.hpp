@@ -0,0 +1,205 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_DOMAIN_NFC_HPP
+#define SKYR_V2_DOMAIN_NFC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <skyr/domain/nfc_table.hpp>
+
+namespace skyr::inline v2::idna {
+/// \enum nfc_quick_check
+/// The values of the NFC_Quick_Check property, in the order of the table
+enum class nfc_quick_check {
+  yes, no, maybe,
+};
+
+namespace details {
+// https://www.unicode.org/versions/Unicode14.0.0/ch03.pdf#G24646
+inline constexpr auto hangul_s_base = char32_t(0xac00);
+inline constexpr auto hangul_l_base = char32_t(0x1100);
+inline constexpr auto hangul_v_base = char32_t(0x1161);
+inline constexpr auto hangul_t_base = char32_t(0x11a7);
+inline constexpr auto hangul_l_count = char32_t(19);
+inline constexpr auto hangul_v_count = char32_t(21);
+inline constexpr auto hangul_t_count = char32_t(28);
+inline constexpr auto hangul_n_count = hangul_v_count * hangul_t_count;
+inline constexpr auto hangul_s_count = hangul_l_count * hangul_n_count;
+
+/// Appends the full canonical decomposition of a code point
+constexpr auto decompose_code_point(char32_t code_point, std::u32string *output) {
+  if ((code_point >= hangul_s_base) && (code_point < (hangul_s_base + hangul_s_count))) {
+    auto index = code_point - hangul_s_base;
+    output->push_back(hangul_l_base + (index / hangul_n_count));
+    output->push_back(hangul_v_base + ((index % hangul_n_count) / hangul_t_count));
+    if ((index % hangul_t_count) != 0) {
+      output->push_back(hangul_t_base + (index % hangul_t_count));
+    }
+    return;
+  }
+
+  auto [first, last] = nfc_data::decomposition_of(code_point);
+  if (first == last) {
+    output->push_back(code_point);
+  } else {
+    output->append(nfc_data::decomposition_data.data() + first, last - first);
+  }
+}
+
+/// \return The primary composite of a pair of code points, or 0
+constexpr auto compose_pair(char32_t first, char32_t second) noexcept -> char32_t {
+  if ((first >= hangul_l_base) && (first < (hangul_l_base + hangul_l_count)) && (second >= hangul_v_base) &&
+      (second < (hangul_v_base + hangul_v_count))) {
+    return hangul_s_base + ((((first - hangul_l_base) * hangul_v_count) + (second - hangul_v_base)) * hangul_t_count);
+  }
+  if ((first >= hangul_s_base) && (first < (hangul_s_base + hangul_s_count)) &&
+      (((first - hangul_s_base) % hangul_t_count) == 0) && (second > hangul_t_base) &&
+      (second < (hangul_t_base + hangul_t_count))) {
+    return first + (second - hangul_t_base);
+  }
+  return nfc_data::composite_of(first, second);
+}
+}  // namespace details
+
+///
+/// \param code_point A code point value
+/// \return The canonical combining class of the code point
+constexpr auto canonical_combining_class(char32_t code_point) noexcept -> std::uint8_t {
+  return ((code_point >= nfc_data::first_value) && (code_point <= U'\x10ffff'))
+             ? nfc_data::combining_class_of(nfc_data::value_of(code_point))
+             : std::uint8_t(0);
+}
+
+/// Tells whether a string is in NFC without normalizing it
+///
+/// Code points below U+0300, such as those of ASCII labels, are
+/// skipped without a lookup.
+///
+/// https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+///
+/// \param input A string of code points
+/// \return `yes` or `no` when the answer is known, and `maybe` when the
+///         string must be normalized to be sure
+constexpr auto quick_check_nfc(std::u32string_view input) noexcept -> nfc_quick_check {
+  auto result = nfc_quick_check::yes;
+  auto last_class = std::uint8_t(0);
+  for (auto code_point : input) {
+    if (code_point < nfc_data::first_value) {
+      last_class = 0;
+      continue;
+    }
+    if (code_point > U'\x10ffff') {
+      return nfc_quick_check::no;
+    }
+    auto value = nfc_data::value_of(code_point);
+    auto combining_class = nfc_data::combining_class_of(value);
+    if ((combining_class != 0) && (last_class > combining_class)) {
+      return nfc_quick_check::no;
+    }
+    auto quick_check = static_cast<nfc_quick_check>(nfc_data::quick_check_of(value));
+    if (quick_check == nfc_quick_check::no) {
+      return nfc_quick_check::no;
+    }
+    if (quick_check == nfc_quick_check::maybe) {
+      result = nfc_quick_check::maybe;
+    }
+    last_class = combining_class;
+  }
+  return result;
+}
+
+/// Converts a string to NFC
+///
+/// \param input A string of code points
+/// \param output The string in NFC is appended here
+constexpr auto to_nfc(std::u32string_view input, std::u32string *output) {
+  /// https://www.unicode.org/reports/tr15/#Description_Norm
+  auto offset = output->size();
+  for (auto code_point : input) {
+    details::decompose_code_point(code_point, output);
+  }
+
+  /// Canonical ordering, by insertion since the runs of non-starters
+  /// are short
+  auto &buffer = *output;
+  for (auto i = offset + 1; i < buffer.size(); ++i) {
+    auto code_point = buffer[i];
+    auto combining_class = canonical_combining_class(code_point);
+    if (combining_class == 0) {
+      continue;
+    }
+    auto j = i;
+    while ((j > offset) && (canonical_combining_class(buffer[j - 1]) > combining_class)) {
+      buffer[j] = buffer[j - 1];
+      --j;
+    }
+    buffer[j] = code_point;
+  }
+
+  /// Canonical composition, in place
+  if (buffer.size() == offset) {
+    return;
+  }
+  auto starter = offset;
+  // a string which starts with a non-starter has nothing to compose with
+  auto last_class = int(canonical_combining_class(buffer[offset]));
+  if (last_class != 0) {
+    last_class = 256;
+  }
+  auto write = offset + 1;
+  for (auto read = offset + 1; read < buffer.size(); ++read) {
+    auto code_point = buffer[read];
+    auto combining_class = int(canonical_combining_class(code_point));
+    auto composite = (last_class < 256) ? details::compose_pair(buffer[starter], code_point) : char32_t(0);
+    if ((composite != 0) && ((last_class < combining_class) || (last_class == 0))) {
+      buffer[starter] = composite;
+      continue;
+    }
+    if (combining_class == 0) {
+      starter = write;
+    }
+    last_class = combining_class;
+    buffer[write++] = code_point;
+  }
+  buffer.resize(write);
+}
+
+/// Converts a string to NFC in place, unless the quick check shows that
+/// it already is
+///
+/// \param input A string of code points
+constexpr auto normalize_nfc(std::u32string *input) {
+  if (quick_check_nfc(*input) == nfc_quick_check::yes) {
+    return;
+  }
+  auto output = std::u32string{};
+  output.reserve(input->size() + (input->size() / 2));
+  to_nfc(*input, &output);
+  *input = std::move(output);
+}
+
+///
+/// \param input A string of code points
+/// \return `true` if the string is in NFC
+constexpr auto is_nfc(std::u32string_view input) -> bool {
+  switch (quick_check_nfc(input)) {
+    case nfc_quick_check::yes:
+      return true;
+    case nfc_quick_check::no:
+      return false;
+    case nfc_quick_check::maybe:
+      break;
+  }
+  auto output = std::u32string{};
+  to_nfc(input, &output);
+  return output == input;
+}
+}  // namespace skyr::inline v2::idna
+
+#endif  // SKYR_V2_DOMAIN_NFC_HPP
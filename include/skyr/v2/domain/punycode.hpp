@@ -9,10 +9,8 @@
 #include <string>
 #include <string_view>
 #include <limits>
-#include <range/v3/view/filter.hpp>
-#include <range/v3/view/transform.hpp>
-#include <range/v3/algorithm/copy.hpp>
-#include <range/v3/view/take.hpp>
+#include <span>
+#include <algorithm>
 #include <tl/expected.hpp>
 #include <skyr/v2/domain/errors.hpp>
 
@@ -29,6 +27,10 @@ constexpr auto initial_n = 0x80ul;
 constexpr auto delimiter = 0x2dul;
 }  // namespace constants
 
+/// The capacity of the stack buffers used for a single label,
+/// which is at most 63 octets in the DNS
+constexpr auto label_capacity = 63ul;
+
 constexpr inline auto adapt(uint32_t delta, uint32_t numpoints, bool firsttime) -> std::uint32_t {
   using namespace constants;
 
@@ -48,14 +50,13 @@ constexpr inline auto adapt(uint32_t delta, uint32_t numpoints, bool firsttime)
 /// defined in [RFC 3492](https://tools.ietf.org/html/rfc3492)
 ///
 /// \param input A UTF-32 encoded domain
-/// \param output An ascii string on output
-/// \returns `void` or an error
-inline auto punycode_encode(std::u32string_view input, std::string *output) -> tl::expected<void, domain_errc> {
+/// \param output A buffer for the ASCII output
+/// \returns The number of characters written, or an error, which is
+///          `domain_errc::big_output` if the buffer is too small
+inline auto punycode_encode(std::u32string_view input, std::span<char> output)
+    -> tl::expected<std::size_t, domain_errc> {
   using namespace punycode::constants;
 
-  constexpr auto is_ascii_value = [] (auto c) { return c < 0x80; };
-  constexpr auto to_char = [] (auto c) { return static_cast<char>(c); };
-
   // encode_digit(d,flag) returns the basic code point whose value
   // (when used for representing integers) is d, which needs to be in
   // the range 0 to base-1.  The lowercase form is used unless flag is
@@ -75,14 +76,24 @@ inline auto punycode_encode(std::u32string_view input, std::string *output) -> t
   auto delta = 0ul;
   auto bias = initial_bias;
 
-  auto ascii_values = input | ranges::views::filter(is_ascii_value) | ranges::views::transform(to_char);
-  std::copy(std::begin(ascii_values), std::end(ascii_values), std::back_inserter(*output));
+  auto out = std::size_t{0};
+  for (auto c : input) {
+    if (c < 0x80) {
+      if (out == output.size()) {
+        return tl::make_unexpected(domain_errc::big_output);
+      }
+      output[out++] = static_cast<char>(c);
+    }
+  }
 
-  auto h = static_cast<uint32_t>(output->size());
-  auto b = static_cast<uint32_t>(output->size());
+  auto h = static_cast<uint32_t>(out);
+  auto b = static_cast<uint32_t>(out);
 
   if (b != 0ul) {
-    *output += static_cast<char>(delimiter);
+    if (out == output.size()) {
+      return tl::make_unexpected(domain_errc::big_output);
+    }
+    output[out++] = static_cast<char>(delimiter);
   }
 
   while (h < input.size()) {
@@ -114,12 +125,18 @@ inline auto punycode_encode(std::u32string_view input, std::string *output) -> t
           if (q < t) {
             break;
           }
-          *output += encode_digit(t + (q - t) % (base - t), 0);
+          if (out == output.size()) {
+            return tl::make_unexpected(domain_errc::big_output);
+          }
+          output[out++] = encode_digit(t + (q - t) % (base - t), 0);
           q = (q - t) / (base - t);
           k += base;
         }
 
-        *output += encode_digit(q, 0);
+        if (out == output.size()) {
+          return tl::make_unexpected(domain_errc::big_output);
+        }
+        output[out++] = encode_digit(q, 0);
         bias = punycode::adapt(delta, (h + 1ul), (h == b));
         delta = 0ul;
         ++h;
@@ -129,16 +146,47 @@ inline auto punycode_encode(std::u32string_view input, std::string *output) -> t
     ++delta, ++n;
   }
 
-  return {};
+  return out;
+}
+
+/// Performs Punycode encoding based on a reference implementation
+/// defined in [RFC 3492](https://tools.ietf.org/html/rfc3492)
+///
+/// \param input A UTF-32 encoded domain
+/// \param output An ascii string on output
+/// \returns `void` or an error
+inline auto punycode_encode(std::u32string_view input, std::string *output) -> tl::expected<void, domain_errc> {
+  // the buffer grows until the output fits
+  auto first = output->size();
+  auto size = std::max(input.size() * 2, punycode::label_capacity);
+  while (true) {
+    output->resize(first + size);
+    auto result = punycode_encode(input, std::span<char>(output->data() + first, size));
+    if (result) {
+      output->resize(first + result.value());
+      return {};
+    }
+    if (result.error() != domain_errc::big_output) {
+      output->resize(first);
+      return tl::make_unexpected(result.error());
+    }
+    size *= 2;
+  }
 }
 
 /// Performs Punycode decoding based on a reference implementation
 /// defined in [RFC 3492](https://tools.ietf.org/html/rfc3492)
 ///
+/// The output never has more code points than the input has
+/// characters.
+///
 /// \param input An ASCII encoded domain to be decoded
-/// \returns The decoded UTF-8 domain, or an error
+/// \param output A buffer for the UTF-32 output
+/// \returns The number of code points written, or an error, which
+///          is `domain_errc::big_output` if the buffer is too small
 template <class StringView>
-constexpr inline auto punycode_decode(StringView input, std::u32string *output) -> tl::expected<void, domain_errc> {
+constexpr inline auto punycode_decode(StringView input, std::span<char32_t> output)
+    -> tl::expected<std::size_t, domain_errc> {
   using namespace punycode::constants;
 
   // decode_digit(cp) returns the numeric value of a basic code
@@ -168,8 +216,13 @@ constexpr inline auto punycode_decode(StringView input, std::u32string *output)
 
   auto delim_index = input.find_last_of(delimiter);
   delim_index = (delim_index == decltype(input)::npos) ? 0ul : delim_index;
-  auto ascii_values = input | ranges::views::take(delim_index);
-  std::copy(std::begin(ascii_values), std::end(ascii_values), std::back_inserter(*output));
+  if (delim_index > output.size()) {
+    return tl::make_unexpected(domain_errc::big_output);
+  }
+  auto size = std::size_t{0};
+  for (; size < delim_index; ++size) {
+    output[size] = static_cast<char32_t>(input[size]);
+  }
 
   auto input_index = (delim_index > 0ul) ? (delim_index + 1ul) : 0ul;
   auto i = 0ul;
@@ -201,7 +254,7 @@ constexpr inline auto punycode_decode(StringView input, std::u32string *output)
       k += base;
     }
 
-    auto out = output->size() + 1ul;
+    auto out = size + 1ul;
     bias = punycode::adapt((i - oldi), out, (oldi == 0ul));
 
     if ((i / out) > (std::numeric_limits<uint32_t>::max() - n)) {
@@ -210,9 +263,32 @@ constexpr inline auto punycode_decode(StringView input, std::u32string *output)
     n += i / out;
     i %= out;
 
-    output->insert(i++, 1, static_cast<char32_t>(n));
+    if (size == output.size()) {
+      return tl::make_unexpected(domain_errc::big_output);
+    }
+    std::copy_backward(output.data() + i, output.data() + size, output.data() + size + 1);
+    output[i++] = static_cast<char32_t>(n);
+    ++size;
   }
 
+  return size;
+}
+
+/// Performs Punycode decoding based on a reference implementation
+/// defined in [RFC 3492](https://tools.ietf.org/html/rfc3492)
+///
+/// \param input An ASCII encoded domain to be decoded
+/// \returns The decoded UTF-8 domain, or an error
+template <class StringView>
+constexpr inline auto punycode_decode(StringView input, std::u32string *output) -> tl::expected<void, domain_errc> {
+  auto first = output->size();
+  output->resize(first + input.size());
+  auto result = punycode_decode(input, std::span<char32_t>(output->data() + first, input.size()));
+  if (!result) {
+    output->resize(first);
+    return tl::make_unexpected(result.error());
+  }
+  output->resize(first + result.value());
   return {};
 }
 }  // namespace skyr::inline v2
@@ -0,0 +1,290 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_DOMAIN_SKELETON_HPP
+#define SKYR_V2_DOMAIN_SKELETON_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tl/expected.hpp>
+#include <skyr/v2/unicode/transcode.hpp>
+#include <skyr/v2/domain/domain.hpp>
+#include <skyr/v2/domain/errors.hpp>
+#include <skyr/domain/confusables_table.hpp>
+
+namespace skyr::inline v2 {
+namespace details {
+constexpr auto make_ascii_confusables() noexcept {
+  auto bits = std::array<std::uint64_t, 2>{};
+  for (auto code_point = 0u; code_point < 0x80u; ++code_point) {
+    if (confusables_data::mapping_of(static_cast<char32_t>(code_point)) != 0) {
+      bits[code_point >> 6u] |= std::uint64_t(1) << (code_point & 0x3fu);
+    }
+  }
+  return bits;
+}
+
+/// The ASCII code points which are not their own prototype, such as
+/// "0", "1" and "m"
+inline constexpr auto ascii_confusables = make_ascii_confusables();
+
+/// \param code_point An ASCII code point
+/// \return \c true if the code point is its own prototype
+constexpr inline auto is_ascii_prototype(char32_t code_point) noexcept {
+  return ((ascii_confusables[code_point >> 6u] >> (code_point & 0x3fu)) & 1u) == 0;
+}
+
+/// \param block A pointer to 8 ASCII octets
+/// \return \c true if each octet is its own prototype
+inline auto is_ascii_prototype_block(const char *block) noexcept {
+  auto confusables = std::uint64_t(0);
+  for (auto i = 0; i < 8; ++i) {
+    auto code_point = static_cast<std::uint8_t>(block[i]);
+    confusables |= ascii_confusables[code_point >> 6u] >> (code_point & 0x3fu);
+  }
+  return (confusables & 1u) == 0;
+}
+
+/// Appends a code point to a UTF-8 encoded string
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \param output The string
+inline void append_u8(char32_t code_point, std::string *output) {
+  auto value = static_cast<std::uint32_t>(code_point);
+  if (value < 0x80u) {
+    output->push_back(static_cast<char>(value));
+  } else if (value < 0x800u) {
+    output->push_back(static_cast<char>(0xc0u | (value >> 6u)));
+    output->push_back(static_cast<char>(0x80u | (value & 0x3fu)));
+  } else if (value < 0x10000u) {
+    output->push_back(static_cast<char>(0xe0u | (value >> 12u)));
+    output->push_back(static_cast<char>(0x80u | ((value >> 6u) & 0x3fu)));
+    output->push_back(static_cast<char>(0x80u | (value & 0x3fu)));
+  } else {
+    output->push_back(static_cast<char>(0xf0u | (value >> 18u)));
+    output->push_back(static_cast<char>(0x80u | ((value >> 12u) & 0x3fu)));
+    output->push_back(static_cast<char>(0x80u | ((value >> 6u) & 0x3fu)));
+    output->push_back(static_cast<char>(0x80u | (value & 0x3fu)));
+  }
+}
+
+/// Calls a function for each code point of a mapping
+/// \param index The index of a mapping
+/// \param fn A function taking a code point
+template <class Fn>
+inline void for_each_mapped(std::size_t index, Fn fn) {
+  auto first = std::cbegin(confusables_data::mappings) + confusables_data::mapping_offsets[index];
+  auto last = std::cbegin(confusables_data::mappings) + confusables_data::mapping_offsets[index + 1];
+  while (first != last) {
+    auto length = static_cast<std::size_t>(unicode::sequence_length(*first));
+    auto octets = std::array<char, 4>{};
+    std::copy(first, first + length, std::begin(octets));
+    fn((length == 1) ? static_cast<char32_t>(*first) : unicode::details::decode_valid_sequence(octets.data(), length));
+    first += length;
+  }
+}
+
+/// Calls a function for each code point of the canonical decomposition
+/// of a code point, with the index of its mapping
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \param fn A function taking a code point and the index of its mapping
+template <class Fn>
+inline void decompose(char32_t code_point, Fn fn) {
+  constexpr auto s_base = U'\xac00';
+  constexpr auto l_base = U'\x1100';
+  constexpr auto v_base = U'\x1161';
+  constexpr auto t_base = U'\x11a7';
+  constexpr auto t_count = 28u;
+  constexpr auto n_count = 588u;
+  constexpr auto s_count = 11172u;
+
+  constexpr auto is_decomposition = [](std::size_t index) {
+    return ((confusables_data::mapping_classes[index] >> 24u) & 1u) != 0;
+  };
+
+  // Hangul syllables are decomposed by the algorithm of the
+  // Unicode standard, rather than stored in the table
+  if ((code_point >= s_base) && ((code_point - s_base) < s_count)) {
+    auto index = static_cast<std::uint32_t>(code_point - s_base);
+    auto parts = std::array<char32_t, 3>{static_cast<char32_t>(l_base + (index / n_count)),
+                                         static_cast<char32_t>(v_base + ((index % n_count) / t_count)),
+                                         static_cast<char32_t>(t_base + (index % t_count))};
+    auto size = ((index % t_count) != 0) ? 3 : 2;
+    for (auto i = 0; i < size; ++i) {
+      fn(parts[i], confusables_data::mapping_of(parts[i]));
+    }
+    return;
+  }
+
+  auto index = confusables_data::mapping_of(code_point);
+  if ((index != 0) && is_decomposition(index)) {
+    for_each_mapped(index, [&fn](char32_t part) { fn(part, confusables_data::mapping_of(part)); });
+  } else {
+    fn(code_point, index);
+  }
+}
+
+/// Puts the combining marks of a string in canonical order
+/// \param code_points The string
+inline void order_marks(std::u32string *code_points) {
+  constexpr auto is_mark = [](char32_t code_point) { return confusables_data::combining_class_of(code_point) != 0; };
+  constexpr auto by_class = [](char32_t lhs, char32_t rhs) {
+    return confusables_data::combining_class_of(lhs) < confusables_data::combining_class_of(rhs);
+  };
+
+  for (auto it = std::begin(*code_points); it != std::end(*code_points);) {
+    auto marks = std::find_if(it, std::end(*code_points), is_mark);
+    it = std::find_if_not(marks, std::end(*code_points), is_mark);
+    std::stable_sort(marks, it, by_class);
+  }
+}
+
+/// The state of a skeleton while it is appended to
+struct skeleton_state {
+  /// The combining class of the last decomposed code point
+  int source_class = 0;
+  /// The combining class of the last code point of the skeleton
+  int last_class = 0;
+  /// \c false if two combining marks are not in canonical order,
+  /// either in the decomposition or in the skeleton
+  bool is_ordered = true;
+};
+
+/// Appends the prototype of a decomposed code point to a skeleton
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \param index The index of the mapping of the code point
+/// \param skeleton The skeleton
+/// \param state The state of the skeleton
+inline void append_prototype(char32_t code_point, std::size_t index, std::string *skeleton, skeleton_state *state) {
+  if (index == 0) {
+    append_u8(code_point, skeleton);
+    state->source_class = 0;
+    state->last_class = 0;
+    return;
+  }
+
+  auto classes = confusables_data::mapping_classes[index];
+  auto first_class = static_cast<int>(classes & 0xffu);
+  auto source_class = static_cast<int>((classes >> 16u) & 0xffu);
+  if (((source_class != 0) && (source_class < state->source_class)) ||
+      ((first_class != 0) && (first_class < state->last_class))) {
+    state->is_ordered = false;
+  }
+  auto offset = confusables_data::mapping_offsets[index];
+  skeleton->append(reinterpret_cast<const char *>(confusables_data::mappings.data() + offset),
+                   confusables_data::mapping_offsets[index + 1] - offset);
+  state->source_class = source_class;
+  state->last_class = static_cast<int>((classes >> 8u) & 0xffu);
+}
+
+/// Appends the skeleton of a code point to a skeleton
+/// \param code_point A code point value, no greater than U+10FFFF
+/// \param skeleton The skeleton
+/// \param state The state of the skeleton
+inline void append_skeleton(char32_t code_point, std::string *skeleton, skeleton_state *state) {
+  if ((code_point < U'\x80') && is_ascii_prototype(code_point)) {
+    skeleton->push_back(static_cast<char>(code_point));
+    state->source_class = 0;
+    state->last_class = 0;
+    return;
+  }
+
+  decompose(code_point, [skeleton, state](char32_t part, std::size_t index) {
+    append_prototype(part, index, skeleton, state);
+  });
+}
+
+/// Appends the skeleton of a string whose combining marks are not in
+/// canonical order, following each step of UTS #39
+/// \param input A valid UTF-8 encoded string
+/// \param skeleton The skeleton
+inline void append_ordered_skeleton(std::string_view input, std::string *skeleton) {
+  auto code_points = unicode::u8_to_u32(input).value();
+  auto decomposed = std::u32string{};
+  for (auto code_point : code_points) {
+    decompose(code_point, [&decomposed](char32_t part, std::size_t) { decomposed.push_back(part); });
+  }
+  order_marks(&decomposed);
+
+  auto mapped = std::u32string{};
+  for (auto code_point : decomposed) {
+    auto index = confusables_data::mapping_of(code_point);
+    if (index == 0) {
+      mapped.push_back(code_point);
+    } else {
+      for_each_mapped(index, [&mapped](char32_t part) { mapped.push_back(part); });
+    }
+  }
+  order_marks(&mapped);
+
+  for (auto code_point : mapped) {
+    append_u8(code_point, skeleton);
+  }
+}
+}  // namespace details
+
+/// Computes the skeleton of a domain, as defined by UTS #39
+///
+/// Two domains which have the same skeleton are confusable, so that
+/// the skeleton of a domain can be compared to those of a set of
+/// domains to protect. The skeleton is not a domain, and is only
+/// meant to be compared.
+///
+/// Punycode labels are decoded first. Each code point is replaced by
+/// its prototype, which is found with two loads from the table, and
+/// the ASCII text is copied 8 octets at a time when none of its code
+/// points is confusable. The domain is expected to have been
+/// processed by `domain_to_ascii` or the host parser, which has
+/// removed the ignored code points.
+///
+/// https://www.unicode.org/reports/tr39/#Confusable_Detection
+///
+/// \param domain_name A UTF-8 encoded domain
+/// \param skeleton The UTF-8 encoded skeleton, which is appended to
+/// \returns `void`, or an error
+inline auto domain_to_skeleton(std::string_view domain_name, std::string *skeleton)
+    -> tl::expected<void, domain_errc> {
+  auto buffer = std::string{};
+  auto u8_domain = domain_to_u8_view(domain_name, &buffer);
+  if (!u8_domain) {
+    return tl::make_unexpected(u8_domain.error());
+  }
+
+  if (!unicode::is_valid_u8(u8_domain.value())) {
+    return tl::make_unexpected(domain_errc::encoding_error);
+  }
+
+  auto first = skeleton->size();
+  skeleton->reserve(first + u8_domain.value().size());
+  auto state = details::skeleton_state{};
+  unicode::details::for_each_valid_u8(
+      u8_domain.value(),
+      [skeleton, &state](const char *block) {
+        if (details::is_ascii_prototype_block(block)) {
+          skeleton->append(block, 8);
+          state.source_class = 0;
+          state.last_class = 0;
+        } else {
+          for (auto i = 0; i < 8; ++i) {
+            details::append_skeleton(static_cast<char32_t>(block[i]), skeleton, &state);
+          }
+        }
+      },
+      [skeleton, &state](char32_t code_point) { details::append_skeleton(code_point, skeleton, &state); });
+
+  // the marks are rarely out of order, and the skeleton is then
+  // found again with each step of the algorithm
+  if (!state.is_ordered) {
+    skeleton->resize(first);
+    details::append_ordered_skeleton(u8_domain.value(), skeleton);
+  }
+  return {};
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_DOMAIN_SKELETON_HPP
@@ -6,10 +6,15 @@
 #ifndef SKYR_V2_FILESYSTEM_PATH_HPP
 #define SKYR_V2_FILESYSTEM_PATH_HPP
 
+#include <algorithm>
 #include <filesystem>
+#include <optional>
+#include <string_view>
 #include <tl/expected.hpp>
 #include <skyr/v2/url.hpp>
+#include <skyr/v2/core/url_record.hpp>
 #include <skyr/v2/percent_encoding/percent_decode.hpp>
+#include <skyr/v2/percent_encoding/percent_encode.hpp>
 
 namespace skyr::inline v2 {
 /// \namespace filesystem
@@ -24,32 +29,125 @@ enum class path_errc {
   percent_decoding_error,
 };
 
+namespace details {
+/// Tests if a path segment is "." or "..", in any of its percent
+/// encoded forms, which the URL parser would remove
+inline auto is_dot_segment(std::string_view segment) noexcept {
+  constexpr auto is_dot = [](std::string_view value) {
+    return (value == ".") || (value == "%2e") || (value == "%2E");
+  };
+
+  if (is_dot(segment)) {
+    return true;
+  }
+  for (auto i = 1ul; (i < segment.size()) && (i <= 3ul); ++i) {
+    if (is_dot(segment.substr(0, i)) && is_dot(segment.substr(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Builds the record of a file URL directly from an absolute path
+///
+/// \returns The record, or `std::nullopt` for paths that the URL
+///          parser would change other than by percent encoding them,
+///          such as relative paths, paths with dot segments or with
+///          characters that delimit a query or fragment
+inline auto make_file_url_record(std::string_view path) -> std::optional<url_record> {
+  constexpr auto is_parser_sensitive = [](char c) {
+    return (c == '\\') || (c == '?') || (c == '#') || (c == '\t') || (c == '\n') || (c == '\r');
+  };
+
+  if ((path.size() < 2) || (path.front() != '/') || (path[1] == '/') ||
+      (static_cast<unsigned char>(path.back()) <= 0x20u) ||
+      (std::find_if(std::cbegin(path), std::cend(path), is_parser_sensitive) != std::cend(path))) {
+    return std::nullopt;
+  }
+
+  auto record = url_record{};
+  record.scheme = "file";
+  record.host = host{empty_host{}};
+
+  path.remove_prefix(1);
+  auto encoded = std::string{};
+  while (true) {
+    auto separator = path.find('/');
+    auto segment = path.substr(0, separator);
+    if (is_dot_segment(segment)) {
+      return std::nullopt;
+    }
+    if (record.path.empty() && (segment.size() == 2) && (segment[1] == '|')) {
+      // the parser rewrites Windows drive letters
+      return std::nullopt;
+    }
+    encoded.clear();
+    percent_encode_bytes_to(segment, percent_encoding::encode_set::path, encoded);
+    record.path.push_back(encoded);
+    if (separator == std::string_view::npos) {
+      break;
+    }
+    path.remove_prefix(separator + 1);
+  }
+  return record;
+}
+}  // namespace details
+
 /// Converts a path object to a URL with a file protocol. Handles
 /// some processing, including percent encoding
+///
+/// Absolute paths are percent encoded a segment at a time straight
+/// into the URL, without parsing it.
+///
 /// \param path A filesystem path
 /// \returns a url object or an error on failure
 inline auto from_path(const std::filesystem::path &path) -> tl::expected<url, url_parse_errc> {
   /// This is weird because not every library implementation has transitioned
   /// from changing the return type of generic_u8string to a std::u8string between C++17 and C++20
   using namespace std::string_view_literals;
-  constexpr auto scheme = u8"file://"sv;
-  auto input = std::u8string(scheme);
   auto u8string = path.generic_u8string(); // Sometimes a std::string and
                                            // sometimes a std::u8string (correct, for C++20)
+  auto view = std::string_view(reinterpret_cast<const char *>(u8string.data()), u8string.size());
+  auto record = details::make_file_url_record(view);
+  if (record) {
+    return url(std::move(record.value()));
+  }
+
+  constexpr auto scheme = u8"file://"sv;
+  auto input = std::u8string(scheme);
   input.append(std::cbegin(u8string), std::cend(u8string));
   return make_url(input);
 }
 
 /// Converts a URL pathname to a filesystem path
+///
+/// The pathname is percent decoded in a single pass.
+///
 /// \param input A url object
 /// \returns a path object or an error on failure
 inline auto to_path(const url &input) -> tl::expected<std::filesystem::path, path_errc> {
-  auto pathname = input.pathname();
-  auto decoded = skyr::percent_decode(pathname);
-  if (!decoded) {
-    return tl::make_unexpected(path_errc::percent_decoding_error);
+  auto pathname = input.pathname_view();
+  auto decoded = std::string{};
+  decoded.reserve(pathname.size());
+  while (true) {
+    auto pos = pathname.find('%');
+    decoded.append(pathname.substr(0, pos));
+    if (pos == std::string_view::npos) {
+      break;
+    }
+    if ((pathname.size() - pos) < 3) {
+      return tl::make_unexpected(path_errc::percent_decoding_error);
+    }
+    auto v0 = percent_encoding::details::alnum_to_hex(pathname[pos + 1]);
+    auto v1 = percent_encoding::details::alnum_to_hex(pathname[pos + 2]);
+    if (!v0 || !v1) {
+      return tl::make_unexpected(path_errc::percent_decoding_error);
+    }
+    decoded.push_back(static_cast<char>((0x10u * std::to_integer<unsigned int>(v0.value())) +
+                                        std::to_integer<unsigned int>(v1.value())));
+    pathname.remove_prefix(pos + 3);
   }
-  return std::filesystem::path(decoded.value());
+  return std::filesystem::path(std::move(decoded));
 }
 }  // namespace filesystem
 }  // namespace skyr::v2
@@ -6,15 +6,17 @@
 #ifndef SKYR_V2_JSON_JSON_HPP
 #define SKYR_V2_JSON_JSON_HPP
 
+#include <algorithm>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <vector>
 #include <tl/expected.hpp>
 #include <nlohmann/json.hpp>
-#include <fmt/format.h>
-#include <skyr/v2/core/parse_query.hpp>
-#include <skyr/v2/percent_encoding/percent_encode.hpp>
-#include <skyr/v2/percent_encoding/percent_decode.hpp>
+#include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
+#include <skyr/v2/percent_encoding/percent_decode_range.hpp>
+#include <skyr/v2/url_search_parameters_view.hpp>
 
 namespace skyr::inline v2 {
 namespace json {
@@ -24,57 +26,138 @@ enum class json_errc {
   invalid_query = 1,
 };
 
-inline auto encode_query(const nlohmann::json &json, char separator='&', char equal='=')
-  -> tl::expected<std::string, json_errc> {
-  using namespace std::string_literals;
+namespace details {
+template <class OutputIterator>
+inline auto percent_encode_to(std::string_view input, OutputIterator out) -> OutputIterator {
+  for (auto byte : input) {
+    auto encoded = percent_encoding::percent_encode_byte(std::byte(byte), percent_encoding::encode_set::component);
+    out = std::copy(std::cbegin(encoded), std::cend(encoded), out);
+  }
+  return out;
+}
 
-  std::string result{};
+// Returns the input if it has no escape, and otherwise decodes
+// it into the buffer. An input with an invalid escape is
+// returned unchanged
+inline auto percent_decode_to(std::string_view input, std::string &buffer) -> std::string_view {
+  if (input.find('%') == std::string_view::npos) {
+    return input;
+  }
 
+  buffer.clear();
+  for (auto &&value : percent_encoding::percent_decode_range{input}) {
+    if (!value) {
+      return input;
+    }
+    buffer.push_back(value.value());
+  }
+  return buffer;
+}
+}  // namespace details
+
+/// Writes a JSON object as a query string
+///
+/// Each string member is written as a `name=value` pair, each
+/// element of an array member as a pair with the name of the
+/// array, and any other member as a name without a value. Names
+/// and values are percent encoded as they are written, without
+/// intermediate strings.
+///
+/// \param json A JSON object
+/// \param out The output iterator
+/// \param separator The separator between pairs
+/// \param equal The separator between a name and its value
+/// \returns The end of the output, or an error if `json` is not
+///          an object
+template <class OutputIterator>
+inline auto encode_query_to(const nlohmann::json &json, OutputIterator out, char separator = '&', char equal = '=')
+    -> tl::expected<OutputIterator, json_errc> {
   if (!json.is_object()) {
     return tl::make_unexpected(json_errc::invalid_query);
   }
 
-  for (auto &[key, value] : json.items()) {
+  auto first = true;
+  auto write = [&](std::string_view name, std::string_view value) {
+    if (!first) {
+      *out++ = separator;
+    }
+    first = false;
+    out = details::percent_encode_to(name, out);
+    *out++ = equal;
+    out = details::percent_encode_to(value, out);
+  };
+
+  for (const auto &[key, value] : json.items()) {
     if (value.is_string()) {
-      result += fmt::format(
-          "{}{}{}{}", percent_encode(key), equal, percent_encode(value.get<std::string>()), separator);
+      write(key, value.template get_ref<const std::string &>());
     } else if (value.is_array()) {
-      for (auto &element : value.items()) {
-        result += fmt::format(
-            "{}{}{}{}", percent_encode(key), equal, percent_encode(element.value().get<std::string>()), separator);
+      for (const auto &element : value) {
+        write(key, element.template get_ref<const std::string &>());
       }
     } else {
-      result += fmt::format("{}{}{}", percent_encode(key), equal, separator);
+      write(key, {});
     }
   }
+  return out;
+}
+
+/// Writes a JSON object as a query string
+///
+/// \param json A JSON object
+/// \param separator The separator between pairs
+/// \param equal The separator between a name and its value
+/// \returns The query string, or an error if `json` is not an
+///          object
+inline auto encode_query(const nlohmann::json &json, char separator='&', char equal='=')
+  -> tl::expected<std::string, json_errc> {
+  auto result = std::string{};
+  if (auto out = encode_query_to(json, std::back_inserter(result), separator, equal); !out) {
+    return tl::make_unexpected(out.error());
+  }
+  return result;
+}
 
-  return result.substr(0, result.size() - 1);
+/// Reads the parameters of a query string in order, without
+/// building a JSON object
+///
+/// `handler(name, value)` is called with the decoded name and
+/// value of each parameter. They are views which are valid only
+/// during the call, and which refer to the query when there is
+/// nothing to decode. Empty sequences, as in `a=1&&b=2`, are
+/// skipped, and a name or value with an invalid escape is passed
+/// unchanged.
+///
+/// \param query The query string, with or without the leading `?`
+/// \param handler The function called for each parameter
+template <class Handler>
+inline void decode_query_to(std::string_view query, Handler &&handler) {
+  auto name_buffer = std::string{};
+  auto value_buffer = std::string{};
+  for (const auto &[name, value] : url_search_parameters_view(query)) {
+    handler(details::percent_decode_to(name, name_buffer), details::percent_decode_to(value, value_buffer));
+  }
 }
 
+/// Reads a query string into a JSON object
+///
+/// Each name is a member of the object. A name which is repeated
+/// has an array of its values.
+///
+/// \param query The query string, with or without the leading `?`
+/// \returns A JSON object
 inline auto decode_query(std::string_view query) -> nlohmann::json {
   nlohmann::json object;
-
-  auto parameters = parse_query(query);
-  if (parameters) {
-    for (auto &&[name, value] : parameters.value()) {
-      const auto name_ = skyr::percent_decode(name).value();
-      const auto value_ = value ? skyr::percent_decode(value.value()).value() : std::string();
-
-      if (object.contains(name_)) {
-        auto current_value = object[name_];
-        if (current_value.is_string()) {
-          auto prev_value = current_value.get<std::string>();
-          object[name_] = std::vector<std::string>{prev_value, value_};
-        } else if (current_value.is_array()) {
-          auto values = current_value.get<std::vector<std::string>>();
-          values.emplace_back(value_);
-          object[name_] = values;
-        }
-      } else {
-        object[name_] = value_;
-      }
+  decode_query_to(query, [&object](std::string_view name, std::string_view value) {
+    auto &current = object[std::string(name)];
+    if (current.is_null()) {
+      current = value;
+    } else if (current.is_string()) {
+      auto previous = std::move(current);
+      current = nlohmann::json::array({std::move(previous), value});
+    } else {
+      current.push_back(value);
     }
-  }
+  });
   return object;
 }
 }  // namespace json
@@ -7,7 +7,11 @@
 #define SKYR_V2_NETWORK_IPV4_ADDRESS_HPP
 
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <type_traits>
 #include <string_view>
 #include <optional>
 #include <cmath>
@@ -19,7 +23,10 @@
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/drop_last.hpp>
-#include <fmt/format.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
 
 namespace skyr::inline v2 {
 /// Enumerates IPv4 address parsing errors
@@ -60,24 +67,168 @@ class ipv4_address {
              static_cast<unsigned char>(address_ >> 8u), static_cast<unsigned char>(address_)}};
   }
 
+  /// The length of the longest serialized address
+  static constexpr std::size_t max_serialized_size = 15;
+
+  /// Writes the serialized IPv4 address to a buffer
+  /// \param buffer A buffer of at least `max_serialized_size` characters
+  /// \returns The number of characters written
+  constexpr auto serialize_to(char *buffer) const noexcept -> std::size_t {
+    auto output = buffer;
+    for (auto i = 0U; i < 4U; ++i) {
+      if (i != 0U) {
+        *output++ = '.';
+      }
+      auto octet = (address_ >> (8U * (3U - i))) & 0xffU;
+      if (octet >= 100U) {
+        *output++ = static_cast<char>('0' + (octet / 100U));
+      }
+      if (octet >= 10U) {
+        *output++ = static_cast<char>('0' + ((octet / 10U) % 10U));
+      }
+      *output++ = static_cast<char>('0' + (octet % 10U));
+    }
+    return static_cast<std::size_t>(output - buffer);
+  }
+
   /// \returns The address as a string
   [[nodiscard]] auto serialize() const -> std::string {
-    using namespace std::string_literals;
-    using namespace std::string_view_literals;
+    char buffer[max_serialized_size];
+    return std::string(buffer, serialize_to(buffer));
+  }
+};
 
-    constexpr auto separator = [](auto i) { return (i < 4) ? "."sv : ""sv; };
+namespace details {
+/// Parses four decimal numbers of one to three digits, without
+/// leading zeros and at most 255, separated by dots
+///
+/// \param input An input string
+/// \returns The address, or `std::nullopt` if `input` has another
+///          form, which `parse_ipv4_address` handles
+constexpr inline auto parse_ipv4_dotted_quad_scalar(std::string_view input) noexcept
+    -> std::optional<std::uint32_t> {
+  auto address = std::uint32_t(0);
+  auto it = input.begin();
+  for (auto i = 0; i < 4; ++i) {
+    if (i > 0) {
+      if ((it == input.end()) || (*it != '.')) {
+        return std::nullopt;
+      }
+      ++it;
+    }
+    auto first = it;
+    auto number = 0U;
+    while ((it != input.end()) && (*it >= '0') && (*it <= '9') && ((it - first) < 3)) {
+      number = (number * 10) + static_cast<unsigned>(*it - '0');
+      ++it;
+    }
+    auto length = it - first;
+    if ((length == 0) || ((length > 1) && (*first == '0')) || (number > 255)) {
+      return std::nullopt;
+    }
+    address = (address << 8u) | number;
+  }
+  if (it != input.end()) {
+    return std::nullopt;
+  }
+  return address;
+}
 
-    auto output = ""s;
-    auto n = address_;
-    for (auto i = 1U; i <= 4U; ++i) {
-      output = fmt::format("{}{}{}", separator(i), n % 256, output);
-      n >>= 8;
+#if defined(__SSSE3__)
+/// Shuffle patterns which move the digits of the octets of
+/// lengths `l1` to `l4` to the hundreds, tens and ones of four
+/// 32-bit lanes, at index `27 * (l1 - 1) + 9 * (l2 - 1) +
+/// 3 * (l3 - 1) + (l4 - 1)`
+constexpr inline auto make_ipv4_shuffle_table() {
+  auto table = std::array<std::array<std::uint8_t, 16>, 81>{};
+  for (auto index = 0U; index < 81U; ++index) {
+    auto lengths = std::array<unsigned, 4>{index / 27 + 1, (index / 9) % 3 + 1, (index / 3) % 3 + 1, index % 3 + 1};
+    auto position = 0U;
+    for (auto i = 0U; i < 4U; ++i) {
+      for (auto j = 0U; j < 4U; ++j) {
+        table[index][(4 * i) + j] = 0x80;
+      }
+      for (auto j = 0U; j < lengths[i]; ++j) {
+        table[index][(4 * i) + 3 - lengths[i] + j] = static_cast<std::uint8_t>(position + j);
+      }
+      position += lengths[i] + 1;
     }
-    return output;
   }
-};
+  return table;
+}
+
+alignas(16) inline constexpr auto ipv4_shuffle_table = make_ipv4_shuffle_table();
+
+/// A vectorized `parse_ipv4_dotted_quad_scalar` for inputs of
+/// 7 to 15 bytes
+inline auto parse_ipv4_dotted_quad_ssse3(std::string_view input) noexcept -> std::optional<std::uint32_t> {
+  // the input is copied so that 16 bytes can be loaded
+  alignas(16) char buffer[16] = {};
+  std::memcpy(buffer, input.data(), input.size());
+  auto bytes = _mm_load_si128(reinterpret_cast<const __m128i *>(buffer));
+  auto digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+  auto is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+  auto dots = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('.'))));
+  auto digit_mask = static_cast<unsigned>(_mm_movemask_epi8(is_digit));
+  auto size_mask = (1U << input.size()) - 1;
+
+  // every byte is a digit or one of three dots
+  if (((dots | digit_mask) & size_mask) != size_mask) {
+    return std::nullopt;
+  }
+  dots &= size_mask;
+  if (std::popcount(dots) != 3) {
+    return std::nullopt;
+  }
+  auto p1 = static_cast<unsigned>(std::countr_zero(dots));
+  dots &= dots - 1;
+  auto p2 = static_cast<unsigned>(std::countr_zero(dots));
+  dots &= dots - 1;
+  auto p3 = static_cast<unsigned>(std::countr_zero(dots));
+  auto l1 = p1;
+  auto l2 = p2 - p1 - 1;
+  auto l3 = p3 - p2 - 1;
+  auto l4 = static_cast<unsigned>(input.size()) - p3 - 1;
+  if (((l1 - 1) > 2) || ((l2 - 1) > 2) || ((l3 - 1) > 2) || ((l4 - 1) > 2)) {
+    return std::nullopt;
+  }
+  if (((l1 > 1) && (buffer[0] == '0')) || ((l2 > 1) && (buffer[p1 + 1] == '0')) ||
+      ((l3 > 1) && (buffer[p2 + 1] == '0')) || ((l4 > 1) && (buffer[p3 + 1] == '0'))) {
+    return std::nullopt;
+  }
+
+  const auto &pattern = ipv4_shuffle_table[(27 * (l1 - 1)) + (9 * (l2 - 1)) + (3 * (l3 - 1)) + (l4 - 1)];
+  auto shuffled = _mm_shuffle_epi8(digits, _mm_load_si128(reinterpret_cast<const __m128i *>(pattern.data())));
+  auto weighted = _mm_maddubs_epi16(
+      shuffled, _mm_setr_epi8(100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0));
+  auto octets = _mm_madd_epi16(weighted, _mm_set1_epi16(1));
+  if (_mm_movemask_epi8(_mm_cmpgt_epi32(octets, _mm_set1_epi32(255))) != 0) {
+    return std::nullopt;
+  }
+  auto packed = _mm_packus_epi16(_mm_packs_epi32(octets, octets), _mm_setzero_si128());
+  auto address = static_cast<std::uint32_t>(_mm_cvtsi128_si32(packed));
+  // the first octet is in the lowest byte
+  return ((address & 0xffU) << 24u) | ((address & 0xff00U) << 8u) | ((address >> 8u) & 0xff00U) | (address >> 24u);
+}
+#endif  // defined(__SSSE3__)
+
+/// Parses the common form of an IPv4 address
+///
+/// \param input An input string
+/// \returns The address, or `std::nullopt` if `input` has another
+///          form, which `parse_ipv4_address` handles
+constexpr inline auto parse_ipv4_dotted_quad(std::string_view input) noexcept -> std::optional<std::uint32_t> {
+  if ((input.size() < 7) || (input.size() > 15)) {
+    return std::nullopt;
+  }
+#if defined(__SSSE3__)
+  if (!std::is_constant_evaluated()) {
+    return parse_ipv4_dotted_quad_ssse3(input);
+  }
+#endif  // defined(__SSSE3__)
+  return parse_ipv4_dotted_quad_scalar(input);
+}
 
-namespace details {
 constexpr inline auto parse_ipv4_number(std::string_view input, bool *validation_error)
     -> tl::expected<std::uint64_t, ipv4_address_errc> {
   auto base = 10;
@@ -112,6 +263,11 @@ constexpr inline auto parse_ipv4_address(std::string_view input, bool *validatio
     -> tl::expected<ipv4_address, ipv4_address_errc> {
   using namespace std::string_view_literals;
 
+  // four decimal octets need none of the steps below
+  if (auto address = details::parse_ipv4_dotted_quad(input)) {
+    return ipv4_address(address.value());
+  }
+
   constexpr auto to_string_view = [](auto &&part) {
     return std::string_view(std::addressof(*std::begin(part)), ranges::distance(part));
   };
@@ -9,15 +9,15 @@
 #include <string>
 #include <string_view>
 #include <array>
+#include <cstdint>
 #include <optional>
 #include <algorithm>
 #include <iterator>
 #include <locale>
+#include <bit>
 #include <tl/expected.hpp>
-#include <range/v3/algorithm/stable_sort.hpp>
-#include <skyr/v2/containers/static_vector.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <skyr/v2/platform/endianness.hpp>
-#include <fmt/format.h>
 
 namespace skyr::inline v2 {
 /// Enumerates IPv6 address parsing errors
@@ -62,76 +62,72 @@ class ipv6_address {
     return bytes;
   }
 
-  /// \returns The IPv6 address as a string
-  [[nodiscard]] auto serialize() const -> std::string {
-    using namespace std::string_literals;
-    using namespace std::string_view_literals;
-
-    auto output = ""s;
-    auto compress = std::optional<std::size_t>();
-
-    auto sequences = static_vector<std::pair<std::size_t, std::size_t>, 8>{};
-    auto in_sequence = false;
-
-    auto first = std::cbegin(address_), last = std::cend(address_);
-    auto it = first;
-    while (true) {
-      if (*it == 0) {
-        auto index = ranges::distance(first, it);
-
-        if (!in_sequence) {
-          sequences.emplace_back(index, 1);
-          in_sequence = true;
-        } else {
-          ++sequences.back().second;
-        }
-      } else {
-        if (in_sequence) {
-          if (sequences.back().second == 1) {
-            sequences.pop_back();
-          }
-          in_sequence = false;
-        }
-      }
-      ++it;
+  /// The length of the longest serialized address
+  static constexpr std::size_t max_serialized_size = 39;
 
-      if (it == last) {
-        if (!sequences.empty() && (sequences.back().second == 1)) {
-          sequences.pop_back();
-        }
-        in_sequence = false;
-        break;
-      }
-    }
-
-    if (!sequences.empty()) {
-      constexpr static auto greater = [](const auto &lhs, const auto &rhs) -> bool { return lhs.second > rhs.second; };
+  /// Writes the serialized IPv6 address to a buffer
+  /// \param buffer A buffer of at least `max_serialized_size` characters
+  /// \returns The number of characters written
+  constexpr auto serialize_to(char *buffer) const noexcept -> std::size_t {
+    constexpr auto hex = std::string_view("0123456789abcdef");
 
-      ranges::stable_sort(sequences, greater);
-      compress = sequences.front().first;
+    // bit i is set when piece i is zero
+    auto zeros = 0U;
+    for (auto i = 0U; i < 8U; ++i) {
+      zeros |= static_cast<unsigned>(address_[i] == 0) << i;  // NOLINT
     }
 
-    auto ignore0 = false;
-    for (auto i = 0UL; i <= 7UL; ++i) {
-      if (ignore0 && (address_[i] == 0)) {  // NOLINT
-        continue;
-      } else if (ignore0) {
-        ignore0 = false;
+    // after k steps, bit i is set when pieces i to i + k
+    // are zero, so the lowest bit left marks the first
+    // longest run. A single zero piece is not compressed.
+    auto compress = 8U;
+    auto length = 0U;
+    if (auto runs = zeros & (zeros >> 1U); runs != 0U) {
+      length = 2;
+      while ((runs & (runs >> 1U)) != 0U) {
+        runs &= runs >> 1U;
+        ++length;
       }
+      compress = static_cast<unsigned>(std::countr_zero(runs));
+    }
 
-      if (compress && (compress.value() == i)) {
-        auto separator = (i == 0) ? "::"sv : ":"sv;
-        output += separator;
-        ignore0 = true;
+    auto output = buffer;
+    for (auto i = 0U; i < 8U; ++i) {
+      if (i == compress) {
+        *output++ = ':';
+        i += length - 1;
+        if (i == 7U) {
+          *output++ = ':';
+        }
         continue;
       }
+      if (i != 0U) {
+        *output++ = ':';
+      }
 
-      constexpr auto separator = [](auto i) { return (i != 7) ? ":"sv : ""sv; };
-
-      output += fmt::format("{:x}{}", address_[i], separator(i));  // NOLINT
+      // all four digits are written and the leading zeros are
+      // shifted out; the extra characters are overwritten by the
+      // next piece, or are past the end of the output
+      auto value = static_cast<unsigned>(address_[i]);  // NOLINT
+      auto digits = 1 + (value > 0xfU) + (value > 0xffU) + (value > 0xfffU);
+      auto chars = (static_cast<std::uint32_t>(hex[value >> 12U]) << 24U) |
+                   (static_cast<std::uint32_t>(hex[(value >> 8U) & 0xfU]) << 16U) |
+                   (static_cast<std::uint32_t>(hex[(value >> 4U) & 0xfU]) << 8U) |
+                   static_cast<std::uint32_t>(hex[value & 0xfU]);
+      chars <<= 8U * static_cast<unsigned>(4 - digits);
+      output[0] = static_cast<char>(chars >> 24U);
+      output[1] = static_cast<char>(chars >> 16U);
+      output[2] = static_cast<char>(chars >> 8U);
+      output[3] = static_cast<char>(chars);
+      output += digits;
     }
+    return static_cast<std::size_t>(output - buffer);
+  }
 
-    return output;
+  /// \returns The IPv6 address as a string
+  [[nodiscard]] auto serialize() const -> std::string {
+    char buffer[max_serialized_size];
+    return std::string(buffer, serialize_to(buffer));
   }
 };
 
@@ -148,6 +144,90 @@ constexpr inline auto hex_to_dec(charT byte) noexcept {
 }
 }  // namespace details
 
+namespace details {
+/// Parses an IPv6 address made only of pieces of one to four
+/// hex digits, with at most one "::"
+/// \param input An input string
+/// \returns The pieces of the address, or `std::nullopt` for
+///          any other input, which must then be parsed by
+///          `parse_ipv6_address` to get the same result or error
+constexpr inline auto parse_ipv6_hex_pieces(std::string_view input) noexcept
+    -> std::optional<std::array<unsigned short, 8>> {
+  constexpr auto hex_value = [](char c) -> unsigned {
+    auto byte = static_cast<unsigned char>(c);
+    auto digit = static_cast<unsigned>(byte - '0');
+    auto letter = static_cast<unsigned>((byte | 0x20U) - 'a');
+    return (digit < 10U) ? digit : (letter < 6U) ? (letter + 10U) : 16U;
+  };
+
+  auto pieces = std::array<unsigned short, 8>{};
+  auto count = 0;
+  auto compress = -1;
+  auto it = input.begin(), last = input.end();
+  if (input.starts_with("::")) {
+    compress = 0;
+    it += 2;
+  }
+
+  while (it != last) {
+    auto value = 0U;
+    auto length = 0;
+    while ((it != last) && (length < 5)) {
+      auto digit = hex_value(*it);
+      if (digit > 15U) {
+        break;
+      }
+      value = (value << 4U) | digit;
+      ++it;
+      ++length;
+    }
+    if ((length == 0) || (length > 4) || (count == 8)) {
+      return std::nullopt;
+    }
+    pieces[count++] = static_cast<unsigned short>(value);  // NOLINT
+
+    if (it == last) {
+      break;
+    }
+    if (*it != ':') {
+      return std::nullopt;
+    }
+    ++it;
+    if ((it != last) && (*it == ':')) {
+      if (compress != -1) {
+        return std::nullopt;
+      }
+      compress = count;
+      ++it;
+    } else if (it == last) {
+      return std::nullopt;
+    }
+  }
+
+  if (compress == -1) {
+    if (count != 8) {
+      return std::nullopt;
+    }
+    return pieces;
+  }
+
+  // "::" stands for at least one piece, and the pieces after
+  // it go to the end of the address
+  if (count > 7) {
+    return std::nullopt;
+  }
+  auto address = std::array<unsigned short, 8>{};
+  auto tail = count - compress;
+  for (auto i = 0; i < compress; ++i) {
+    address[i] = pieces[i];  // NOLINT
+  }
+  for (auto i = 0; i < tail; ++i) {
+    address[8 - tail + i] = pieces[compress + i];  // NOLINT
+  }
+  return address;
+}
+}  // namespace details
+
 /// Parses an IPv6 address
 /// \param input An input string
 /// \returns An `ipv6_address` object or an error
@@ -155,6 +235,10 @@ constexpr inline auto parse_ipv6_address(std::string_view input, bool *validatio
     -> tl::expected<ipv6_address, ipv6_address_errc> {
   using namespace std::string_view_literals;
 
+  if (auto address = details::parse_ipv6_hex_pieces(input)) {
+    return ipv6_address(address.value());
+  }
+
   auto address = std::array<unsigned short, 8>{{0, 0, 0, 0, 0, 0, 0, 0}};
   auto piece_index = 0;
   auto compress = std::optional<decltype(piece_index)>();
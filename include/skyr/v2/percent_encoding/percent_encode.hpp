@@ -6,24 +6,166 @@
 #ifndef SKYR_V2_PERCENT_ENCODING_PERCENT_ENCODE_HPP
 #define SKYR_V2_PERCENT_ENCODING_PERCENT_ENCODE_HPP
 
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 #include <string>
-#include <range/v3/view/transform.hpp>
 #include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace skyr::inline v2 {
+namespace percent_encoding::details {
+#if defined(__SSSE3__)
+/// A mask of the bytes of a 16-byte block which are in the encode set
+///
+/// Each byte selects a row of the nibble tables with its low nibble
+/// and top bit, and a bit of the row with the rest of its high nibble.
+inline auto encode_mask_block(const char *first, const encode_table &table) noexcept -> unsigned {
+  const auto lo_row = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.nibbles.data()));
+  const auto hi_row = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.nibbles.data() + 16));
+  const auto bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const auto nibble = _mm_set1_epi8(0x0f);
+  auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+  auto lo = _mm_and_si128(bytes, nibble);
+  auto hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+  auto top = _mm_cmplt_epi8(bytes, _mm_setzero_si128());
+  auto row = _mm_or_si128(_mm_and_si128(top, _mm_shuffle_epi8(hi_row, lo)),
+                          _mm_andnot_si128(top, _mm_shuffle_epi8(lo_row, lo)));
+  auto out = _mm_cmpeq_epi8(_mm_and_si128(row, _mm_shuffle_epi8(bits, hi)), _mm_setzero_si128());
+  return static_cast<unsigned>(_mm_movemask_epi8(out)) ^ 0xffffu;
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+/// A mask of the bytes of a 16-byte block which are in the encode set
+///
+/// Each byte selects a row of the nibble tables with its low nibble
+/// and top bit, and a bit of the row with the rest of its high nibble.
+inline auto encode_mask_block(const char *first, const encode_table &table) noexcept -> unsigned {
+  static constexpr std::uint8_t bits_[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+  const auto rows = uint8x16x2_t{{vld1q_u8(table.nibbles.data()), vld1q_u8(table.nibbles.data() + 16)}};
+  auto bytes = vld1q_u8(reinterpret_cast<const std::uint8_t *>(first));
+  auto index = vorrq_u8(vandq_u8(bytes, vdupq_n_u8(0x0f)), vshrq_n_u8(vandq_u8(bytes, vdupq_n_u8(0x80)), 3));
+  const auto bits = vld1q_u8(bits_);
+  auto in = vtstq_u8(vqtbl2q_u8(rows, index), vqtbl1q_u8(bits, vshrq_n_u8(bytes, 4)));
+  // one bit per byte, added across each half
+  auto weighted = vandq_u8(in, bits);
+  return static_cast<unsigned>(vaddv_u8(vget_low_u8(weighted))) |
+         (static_cast<unsigned>(vaddv_u8(vget_high_u8(weighted))) << 8u);
+}
+#else
+/// A mask of the bytes of a 16-byte block which are in the encode set
+inline auto encode_mask_block(const char *first, const encode_table &table) noexcept -> unsigned {
+  auto mask = 0u;
+  for (auto i = 0u; i < 16u; ++i) {
+    mask |= static_cast<unsigned>(table.contains(static_cast<unsigned char>(first[i]))) << i;
+  }
+  return mask;
+}
+#endif  // defined(__SSSE3__)
+}  // namespace percent_encoding::details
+
+/// Computes the size of the percent encoded input
+///
+/// The bytes are classified 16 at a time, with a shuffle of the nibble
+/// tables of the encode set when SSSE3 or NEON is available.
+///
+/// \param input The input bytes
+/// \param encodes The set of bytes to encode
+/// \returns The number of characters that `percent_encode_bytes` writes
+inline auto percent_encoded_size(std::string_view input, percent_encoding::encode_set encodes) noexcept
+    -> std::size_t {
+  const auto &table = percent_encoding::details::get_encode_table(encodes);
+  auto first = input.data();
+  auto last = first + input.size();
+  auto count = std::size_t{0};
+  while ((last - first) >= 16) {
+    count += static_cast<std::size_t>(std::popcount(percent_encoding::details::encode_mask_block(first, table)));
+    first += 16;
+  }
+  while (first != last) {
+    count += table.contains(static_cast<unsigned char>(*first)) ? 1 : 0;
+    ++first;
+  }
+  return input.size() + (2 * count);
+}
+
+/// Percent encodes the input into a buffer
+///
+/// \param input The input bytes
+/// \param encodes The set of bytes to encode
+/// \param out The buffer, which must have room for
+///            `percent_encoded_size(input, encodes)` characters
+/// \returns The end of the output
+inline auto percent_encode_bytes_to(std::string_view input, percent_encoding::encode_set encodes, char *out) noexcept
+    -> char * {
+  using percent_encoding::details::hex_to_alnum;
+  const auto &table = percent_encoding::details::get_encode_table(encodes);
+  auto first = input.data();
+  auto last = first + input.size();
+  while ((last - first) >= 16) {
+    auto mask = percent_encoding::details::encode_mask_block(first, table);
+    if (mask == 0) {
+      // copy blocks which need no encoding at once
+      std::memcpy(out, first, 16);
+      out += 16;
+      first += 16;
+      continue;
+    }
+    // copy the bytes before the first one to encode
+    auto n = std::countr_zero(mask);
+    std::memcpy(out, first, static_cast<std::size_t>(n));
+    out += n;
+    first += n;
+    out[0] = '%';
+    out[1] = hex_to_alnum(std::byte(static_cast<unsigned char>(*first) >> 4u));
+    out[2] = hex_to_alnum(std::byte(static_cast<unsigned char>(*first) & 0x0fu));
+    out += 3;
+    ++first;
+  }
+  while (first != last) {
+    auto byte = static_cast<unsigned char>(*first);
+    if (table.contains(byte)) {
+      out[0] = '%';
+      out[1] = hex_to_alnum(std::byte(byte >> 4u));
+      out[2] = hex_to_alnum(std::byte(byte & 0x0fu));
+      out += 3;
+    } else {
+      *out++ = static_cast<char>(byte);
+    }
+    ++first;
+  }
+  return out;
+}
+
+/// Percent encodes the input, appending it to a string
+///
+/// The output is sized exactly once before it is written.
+///
+/// \param input The input bytes
+/// \param encodes The set of bytes to encode
+/// \param out The string to append to
+inline void percent_encode_bytes_to(std::string_view input, percent_encoding::encode_set encodes, std::string &out) {
+  auto size = percent_encoded_size(input, encodes);
+  auto pos = out.size();
+  out.resize(pos + size);
+  if (size == input.size()) {
+    input.copy(out.data() + pos, size);
+    return;
+  }
+  percent_encode_bytes_to(input, encodes, out.data() + pos);
+}
+
 /// Percent encodes the input
 /// \returns The percent encoded output when successful, an error otherwise.
 inline auto percent_encode_bytes(std::string_view input, percent_encoding::encode_set encodes) -> std::string {
-  static auto encode = [&encodes] (auto byte) {
-    using percent_encoding::percent_encode_byte;
-    return percent_encode_byte(std::byte(byte), encodes);
-  };
-
   auto result = std::string{};
-  for (const auto &encoded : input | ranges::views::transform(encode)) {
-    result += std::string(std::cbegin(encoded), std::cend(encoded));
-  }
+  percent_encode_bytes_to(input, encodes, result);
   return result;
 }
 
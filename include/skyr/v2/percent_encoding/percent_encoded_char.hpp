@@ -6,13 +6,35 @@
 #ifndef SKYR_V2_PERCENT_ENCODING_PERCENT_ENCODED_CHAR_HPP
 #define SKYR_V2_PERCENT_ENCODING_PERCENT_ENCODED_CHAR_HPP
 
+#include <array>
 #include <string>
 #include <locale>
 #include <cstddef>
+#include <cstdint>
 
 namespace skyr {
 inline namespace v2 {
 namespace percent_encoding {
+///
+enum class encode_set {
+  ///
+  any = 0,
+  ///
+  c0_control,
+  ///
+  fragment,
+  ///
+  query,
+  ///
+  special_query,
+  ///
+  path,
+  ///
+  userinfo,
+  ///
+  component,
+};
+
 namespace details {
 ///
 /// \param value
@@ -113,28 +135,87 @@ inline constexpr auto is_component_byte(std::byte value) {
       (value == std::byte(0x2b)) ||
       (value == std::byte(0x2c));
 }
-}  // namespace details
 
+/// The bytes of an encode set, as a 256-bit bitmap and as the nibble
+/// tables of a 16-byte shuffle
 ///
-enum class encode_set {
-  ///
-  any = 0,
-  ///
-  c0_control,
-  ///
-  fragment,
-  ///
-  query,
-  ///
-  special_query,
-  ///
-  path,
-  ///
-  userinfo,
+/// The nibble tables have the layout of Boost.URL's `lut_chars`: the
+/// byte `16 * h + l` is in the set when bit `h & 7` of
+/// `nibbles[l + 16 * (h >> 3)]` is set.
+struct encode_table {
+  std::array<std::uint64_t, 4> bits;
+  std::array<std::uint8_t, 32> nibbles;
+
   ///
-  component,
+  /// \param byte
+  /// \return `true` if the byte is in the encode set
+  [[nodiscard]] constexpr auto contains(unsigned char byte) const noexcept -> bool {
+    return ((bits[byte >> 6u] >> (byte & 0x3fu)) & 1u) != 0;
+  }
+};
+
+///
+/// \param encodes
+/// \return The tables of the encode set
+constexpr auto make_encode_table(encode_set encodes) noexcept {
+  auto table = encode_table{};
+  for (auto i = 0u; i < 256u; ++i) {
+    auto byte = std::byte(i);
+    auto encode = true;
+    switch (encodes) {
+      case encode_set::any:
+        break;
+      case encode_set::c0_control:
+        encode = is_c0_control_byte(byte);
+        break;
+      case encode_set::fragment:
+        encode = is_fragment_byte(byte);
+        break;
+      case encode_set::query:
+        encode = is_query_byte(byte);
+        break;
+      case encode_set::special_query:
+        encode = is_special_query_byte(byte);
+        break;
+      case encode_set::path:
+        encode = is_path_byte(byte);
+        break;
+      case encode_set::userinfo:
+        encode = is_userinfo_byte(byte);
+        break;
+      case encode_set::component:
+        encode = is_component_byte(byte);
+        break;
+    }
+    if (encode) {
+      table.bits[i >> 6u] |= std::uint64_t(1) << (i & 0x3fu);
+      table.nibbles[(i & 0x0fu) + 16 * (i >> 7u)] |= static_cast<std::uint8_t>(1u << ((i >> 4u) & 0x07u));
+    }
+  }
+  return table;
+}
+
+/// The tables of every encode set, in the order of the enumeration
+inline constexpr std::array<encode_table, 8> encode_tables = {
+    make_encode_table(encode_set::any),
+    make_encode_table(encode_set::c0_control),
+    make_encode_table(encode_set::fragment),
+    make_encode_table(encode_set::query),
+    make_encode_table(encode_set::special_query),
+    make_encode_table(encode_set::path),
+    make_encode_table(encode_set::userinfo),
+    make_encode_table(encode_set::component),
 };
 
+///
+/// \param encodes
+/// \return The tables of the encode set
+constexpr auto get_encode_table(encode_set encodes) noexcept -> const encode_table & {
+  return encode_tables[static_cast<std::size_t>(encodes)];
+}
+}  // namespace details
+
+
 ///
 struct percent_encoded_char {
 
@@ -243,25 +324,11 @@ inline auto percent_encode_byte(std::byte byte, Pred pred) -> percent_encoded_ch
 /// \param encodes
 /// \return
 inline auto percent_encode_byte(std::byte value, encode_set encodes) -> percent_encoded_char {
-  switch (encodes) {
-    case encode_set::any:
-      return percent_encoding::percent_encoded_char(value);
-    case encode_set::c0_control:
-      return percent_encode_byte(value, details::is_c0_control_byte);
-    case encode_set::component:
-      return percent_encode_byte(value, details::is_component_byte);
-    case encode_set::userinfo:
-      return percent_encode_byte(value, details::is_userinfo_byte);
-    case encode_set::path:
-      return percent_encode_byte(value, details::is_path_byte);
-    case encode_set::special_query:
-      return percent_encode_byte(value, details::is_special_query_byte);
-    case encode_set::query:
-      return percent_encode_byte(value, details::is_query_byte);
-    case encode_set::fragment:
-      return percent_encode_byte(value, details::is_fragment_byte);
+  if (details::get_encode_table(encodes).contains(std::to_integer<unsigned char>(value))) {
+    return percent_encoding::percent_encoded_char(value);
   }
-  return percent_encoding::percent_encoded_char(value);
+  return percent_encoding::percent_encoded_char(
+      value, percent_encoding::percent_encoded_char::no_encode());
 }
 
 /// Tests whether the input string contains percent encoded values
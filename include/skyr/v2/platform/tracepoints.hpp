@@ -0,0 +1,36 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_PLATFORM_TRACEPOINTS_HPP
+#define SKYR_V2_PLATFORM_TRACEPOINTS_HPP
+
+/// \file
+/// Static tracepoints of the provider `skyr`, for tools such as
+/// bpftrace, perf and SystemTap:
+///
+///   basic_parse_entry       const char *, size
+///   basic_parse_return      ok
+///   domain_to_ascii_entry   const char *, size
+///   domain_to_ascii_return  ok
+///
+/// They are only compiled when `SKYR_ENABLE_TRACEPOINTS` is
+/// defined, which needs `<sys/sdt.h>`. An inactive tracepoint is
+/// a single nop, and its arguments are only read by the tracer.
+
+#if defined(SKYR_ENABLE_TRACEPOINTS)
+
+#include <sys/sdt.h>
+
+#define SKYR_TRACE1(name, a0) DTRACE_PROBE1(skyr, name, a0)
+#define SKYR_TRACE2(name, a0, a1) DTRACE_PROBE2(skyr, name, a0, a1)
+
+#else
+
+#define SKYR_TRACE1(name, a0) ((void)0)
+#define SKYR_TRACE2(name, a0, a1) ((void)0)
+
+#endif  // defined(SKYR_ENABLE_TRACEPOINTS)
+
+#endif  // SKYR_V2_PLATFORM_TRACEPOINTS_HPP
@@ -7,10 +7,12 @@
 #define SKYR_V2_UNICODE_DETAILS_TO_U8_HPP
 
 #include <string>
+#include <string_view>
 #include <skyr/v2/concepts/url_concepts.hpp>
 #include <skyr/v2/unicode/ranges/transforms/u8_transform.hpp>
 #include <skyr/v2/unicode/ranges/views/u16_view.hpp>
 #include <skyr/v2/unicode/errors.hpp>
+#include <skyr/v2/unicode/transcode.hpp>
 
 namespace skyr::inline v2::details {
 template <class Source> requires is_string_container<Source, char>
@@ -25,10 +27,22 @@ inline auto to_u8(const Source &source)
   return std::string(std::cbegin(source), std::cend(source));
 }
 
-template <class Source> requires is_string_container<Source, char16_t> || is_string_container<Source, wchar_t>
+template <class Source> requires is_string_container<Source, char16_t>
 inline auto to_u8(const Source &source)
     -> tl::expected<std::string, unicode::unicode_errc> {
-  return unicode::as<std::string>(unicode::views::as_u16(source) | unicode::transforms::to_u8);
+  return unicode::u16_to_u8(std::u16string_view(source));
+}
+
+template <class Source> requires is_string_container<Source, wchar_t>
+inline auto to_u8(const Source &source)
+    -> tl::expected<std::string, unicode::unicode_errc> {
+  if constexpr (sizeof(wchar_t) == sizeof(char16_t)) {
+    // UTF-16, as on Windows
+    auto input = std::wstring_view(source);
+    return unicode::u16_to_u8(std::u16string_view(reinterpret_cast<const char16_t *>(input.data()), input.size()));
+  } else {
+    return unicode::as<std::string>(unicode::views::as_u16(source) | unicode::transforms::to_u8);
+  }
 }
 
 template <class Source> requires is_string_container<Source, char32_t>
@@ -154,6 +154,8 @@ class view_unchecked_u8_range {
 };
 
 namespace views {
+/// A view over the code points of a UTF-8 encoded range that
+/// is not checked, e.g. one accepted by \c validate_u8
 ///
 /// \tparam OctetRange
 /// \param range
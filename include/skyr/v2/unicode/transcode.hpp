@@ -0,0 +1,354 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_UNICODE_TRANSCODE_HPP
+#define SKYR_V2_UNICODE_TRANSCODE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <tl/expected.hpp>
+#include <skyr/v2/unicode/constants.hpp>
+#include <skyr/v2/unicode/core.hpp>
+#include <skyr/v2/unicode/errors.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace skyr::inline v2::unicode {
+namespace details {
+/// Tests whether the next 8 octets are all ASCII
+/// \param first A pointer to at least 8 octets
+/// \return \c true if none of the octets has the high bit set
+inline auto is_ascii_block(const char *first) noexcept {
+  auto block = std::uint64_t{0};
+  std::memcpy(&block, first, sizeof(block));
+  return (block & 0x8080808080808080ull) == 0;
+}
+
+/// Decodes a code point from a sequence that is known to be valid
+/// \param first A pointer to the lead octet
+/// \param length The length of the sequence
+/// \return The code point value
+inline auto decode_valid_sequence(const char *first, std::size_t length) noexcept -> char32_t {
+  auto octet = [first](std::size_t i) { return static_cast<char32_t>(static_cast<std::uint8_t>(first[i])); };
+  switch (length) {
+    case 2:
+      return ((octet(0) & 0x1fu) << 6u) | (octet(1) & 0x3fu);
+    case 3:
+      return ((octet(0) & 0x0fu) << 12u) | ((octet(1) & 0x3fu) << 6u) | (octet(2) & 0x3fu);
+    default:
+      return ((octet(0) & 0x07u) << 18u) | ((octet(1) & 0x3fu) << 12u) | ((octet(2) & 0x3fu) << 6u) |
+             (octet(3) & 0x3fu);
+  }
+}
+
+/// Calls a function for every code point of a buffer that is
+/// known to be valid UTF-8, passing ASCII blocks of 8 octets at
+/// once
+template <class AsciiFn, class CodePointFn>
+inline void for_each_valid_u8(std::string_view input, AsciiFn ascii, CodePointFn code_point) {
+  auto first = input.data();
+  auto last = first + input.size();
+  while (first != last) {
+    if (((last - first) >= 8) && is_ascii_block(first)) {
+      ascii(first);
+      first += 8;
+      continue;
+    }
+    auto length = static_cast<std::size_t>(sequence_length(static_cast<std::uint8_t>(*first)));
+    if (length == 1) {
+      code_point(static_cast<char32_t>(static_cast<std::uint8_t>(*first)));
+    } else {
+      code_point(decode_valid_sequence(first, length));
+    }
+    first += length;
+  }
+}
+}  // namespace details
+
+/// Validates a UTF-8 encoded buffer
+///
+/// ASCII text is checked 8 octets at a time. Overlong sequences,
+/// surrogates, values above U+10FFFF and truncated sequences are
+/// rejected.
+///
+/// \param input The UTF-8 encoded buffer
+/// \return The number of code points in the buffer, or an error
+///         if the buffer is not valid UTF-8
+inline auto validate_u8(std::string_view input) noexcept -> tl::expected<std::size_t, unicode_errc> {
+  auto first = input.data();
+  auto last = first + input.size();
+  auto count = std::size_t{0};
+  while (first != last) {
+    if (((last - first) >= 8) && details::is_ascii_block(first)) {
+      first += 8;
+      count += 8;
+      continue;
+    }
+
+    auto lead = static_cast<std::uint8_t>(*first);
+    auto length = std::ptrdiff_t{1};
+    if (lead < 0x80u) {
+      ++first;
+      ++count;
+      continue;
+    } else if (lead < 0xc2u) {
+      return tl::make_unexpected(unicode_errc::invalid_lead);
+    } else if (lead < 0xe0u) {
+      length = 2;
+    } else if (lead < 0xf0u) {
+      length = 3;
+    } else if (lead < 0xf5u) {
+      length = 4;
+    } else {
+      return tl::make_unexpected(unicode_errc::invalid_lead);
+    }
+
+    if ((last - first) < length) {
+      return tl::make_unexpected(unicode_errc::illegal_byte_sequence);
+    }
+    for (auto i = 1; i < length; ++i) {
+      if (!is_trail(static_cast<std::uint8_t>(first[i]))) {
+        return tl::make_unexpected(unicode_errc::illegal_byte_sequence);
+      }
+    }
+
+    // overlong sequences, surrogates and values above U+10FFFF
+    auto second = static_cast<std::uint8_t>(first[1]);
+    if (((lead == 0xe0u) && (second < 0xa0u)) || ((lead == 0xedu) && (second >= 0xa0u)) ||
+        ((lead == 0xf0u) && (second < 0x90u)) || ((lead == 0xf4u) && (second >= 0x90u))) {
+      return tl::make_unexpected(unicode_errc::invalid_code_point);
+    }
+
+    first += length;
+    ++count;
+  }
+  return count;
+}
+
+/// Tests whether a buffer is valid UTF-8
+/// \param input The UTF-8 encoded buffer
+/// \return \c true if the buffer is valid UTF-8, \c false otherwise
+inline auto is_valid_u8(std::string_view input) noexcept -> bool {
+  return validate_u8(input).has_value();
+}
+
+/// Converts a UTF-8 encoded buffer to UTF-32, replacing the contents
+/// of a string so that its memory is reused
+///
+/// The buffer is validated first, so that the output is sized
+/// once, and ASCII text is then copied 8 octets at a time.
+///
+/// \param input The UTF-8 encoded buffer
+/// \param output The UTF-32 encoded string, which is unchanged on error
+/// \return An error if the buffer is not valid UTF-8
+inline auto u8_to_u32(std::string_view input, std::u32string *output) -> tl::expected<void, unicode_errc> {
+  auto count = validate_u8(input);
+  if (!count) {
+    return tl::make_unexpected(count.error());
+  }
+
+  output->resize(count.value());
+  auto out = output->data();
+  details::for_each_valid_u8(
+      input,
+      [&out](const char *block) {
+        for (auto i = 0; i < 8; ++i) {
+          out[i] = static_cast<char32_t>(block[i]);
+        }
+        out += 8;
+      },
+      [&out](char32_t code_point) { *out++ = code_point; });
+  return {};
+}
+
+/// Converts a UTF-8 encoded buffer to UTF-32
+///
+/// The buffer is validated first, so that the output is sized
+/// once, and ASCII text is then copied 8 octets at a time.
+///
+/// \param input The UTF-8 encoded buffer
+/// \return The UTF-32 encoded string, or an error if the buffer is
+///         not valid UTF-8
+inline auto u8_to_u32(std::string_view input) -> tl::expected<std::u32string, unicode_errc> {
+  auto result = std::u32string{};
+  return u8_to_u32(input, &result).map([&result]() { return std::move(result); });
+}
+
+/// Converts a UTF-8 encoded buffer to UTF-16
+///
+/// The buffer is validated first, so that the output is sized
+/// once, and ASCII text is then copied 8 octets at a time.
+///
+/// \param input The UTF-8 encoded buffer
+/// \return The UTF-16 encoded string, or an error if the buffer is
+///         not valid UTF-8
+inline auto u8_to_u16(std::string_view input) -> tl::expected<std::u16string, unicode_errc> {
+  auto count = validate_u8(input);
+  if (!count) {
+    return tl::make_unexpected(count.error());
+  }
+
+  // code points outside the BMP take a surrogate pair
+  auto size = count.value();
+  for (auto c : input) {
+    size += (static_cast<std::uint8_t>(c) >= 0xf0u) ? 1 : 0;
+  }
+
+  auto result = std::u16string(size, u'\0');
+  auto out = result.data();
+  details::for_each_valid_u8(
+      input,
+      [&out](const char *block) {
+        for (auto i = 0; i < 8; ++i) {
+          out[i] = static_cast<char16_t>(block[i]);
+        }
+        out += 8;
+      },
+      [&out](char32_t code_point) {
+        if (code_point < U'\x10000') {
+          *out++ = static_cast<char16_t>(code_point);
+        } else {
+          *out++ = static_cast<char16_t>(constants::surrogates::lead_offset + (code_point >> 10u));
+          *out++ = static_cast<char16_t>(constants::surrogates::trail_min + (code_point & 0x3ffu));
+        }
+      });
+  return result;
+}
+
+namespace details {
+/// Tests whether the next 8 code units are all ASCII
+/// \param first A pointer to at least 8 code units
+/// \return \c true if every code unit is below U+0080
+inline auto is_ascii_block(const char16_t *first) noexcept {
+#if defined(__SSE2__)
+  auto units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+  return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xff80))),
+                                           _mm_setzero_si128())) == 0xffff;
+#else
+  std::uint64_t block[2];
+  std::memcpy(block, first, sizeof(block));
+  return ((block[0] | block[1]) & 0xff80ff80ff80ff80ull) == 0;
+#endif  // defined(__SSE2__)
+}
+
+/// Narrows 8 ASCII code units to octets
+/// \param first A pointer to 8 ASCII code units
+/// \param out A pointer to storage for 8 octets
+inline void narrow_ascii_block(const char16_t *first, char *out) noexcept {
+#if defined(__SSE2__)
+  auto units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+  _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(units, units));
+#else
+  for (auto i = 0; i < 8; ++i) {
+    out[i] = static_cast<char>(first[i]);
+  }
+#endif  // defined(__SSE2__)
+}
+
+/// Returns the number of octets of the UTF-8 encoding of a UTF-16
+/// encoded buffer, which is validated
+///
+/// \param input The UTF-16 encoded buffer
+/// \return The number of octets, or an error if a surrogate is not
+///         part of a pair
+inline auto u8_size(std::u16string_view input) noexcept -> tl::expected<std::size_t, unicode_errc> {
+  auto first = input.data();
+  auto last = first + input.size();
+  auto size = std::size_t{0};
+  while (first != last) {
+    if (((last - first) >= 8) && is_ascii_block(first)) {
+      size += 8;
+      first += 8;
+      continue;
+    }
+    auto unit = *first++;
+    if (unit < u'\x80') {
+      size += 1;
+    } else if (unit < u'\x800') {
+      size += 2;
+    } else if (!is_surrogate(unit)) {
+      size += 3;
+    } else if (is_lead_surrogate(unit) && (first != last) && is_trail_surrogate(*first)) {
+      size += 4;
+      ++first;
+    } else {
+      return tl::make_unexpected(unicode_errc::invalid_code_point);
+    }
+  }
+  return size;
+}
+}  // namespace details
+
+/// Converts a UTF-16 encoded buffer to UTF-8, replacing the contents
+/// of a string so that its memory is reused
+///
+/// The buffer is validated first, so that the output is sized
+/// once. ASCII text is then narrowed 8 code units at a time, and
+/// only the other code points are encoded one by one.
+///
+/// \param input The UTF-16 encoded buffer
+/// \param output The UTF-8 encoded string, which is unchanged on error
+/// \return An error if a surrogate is not part of a pair
+inline auto u16_to_u8(std::u16string_view input, std::string *output) -> tl::expected<void, unicode_errc> {
+  auto size = details::u8_size(input);
+  if (!size) {
+    return tl::make_unexpected(size.error());
+  }
+
+  output->resize(size.value());
+  auto out = output->data();
+  auto first = input.data();
+  auto last = first + input.size();
+  while (first != last) {
+    if (((last - first) >= 8) && details::is_ascii_block(first)) {
+      details::narrow_ascii_block(first, out);
+      first += 8;
+      out += 8;
+      continue;
+    }
+    auto code_point = static_cast<char32_t>(*first++);
+    if (code_point < U'\x80') {
+      *out++ = static_cast<char>(code_point);
+      continue;
+    }
+    if (is_lead_surrogate(static_cast<char16_t>(code_point))) {
+      code_point = (code_point << 10u) + static_cast<char32_t>(*first++) + constants::surrogates::offset;
+    }
+    if (code_point < U'\x800') {
+      *out++ = static_cast<char>(0xc0u | (code_point >> 6u));
+    } else if (code_point < U'\x10000') {
+      *out++ = static_cast<char>(0xe0u | (code_point >> 12u));
+      *out++ = static_cast<char>(0x80u | ((code_point >> 6u) & 0x3fu));
+    } else {
+      *out++ = static_cast<char>(0xf0u | (code_point >> 18u));
+      *out++ = static_cast<char>(0x80u | ((code_point >> 12u) & 0x3fu));
+      *out++ = static_cast<char>(0x80u | ((code_point >> 6u) & 0x3fu));
+    }
+    *out++ = static_cast<char>(0x80u | (code_point & 0x3fu));
+  }
+  return {};
+}
+
+/// Converts a UTF-16 encoded buffer to UTF-8
+///
+/// The buffer is validated first, so that the output is sized
+/// once, and ASCII text is then narrowed 8 code units at a time.
+///
+/// \param input The UTF-16 encoded buffer
+/// \return The UTF-8 encoded string, or an error if a surrogate is
+///         not part of a pair
+inline auto u16_to_u8(std::u16string_view input) -> tl::expected<std::string, unicode_errc> {
+  auto result = std::string{};
+  return u16_to_u8(input, &result).map([&result]() { return std::move(result); });
+}
+}  // namespace skyr::inline v2::unicode
+
+#endif  // SKYR_V2_UNICODE_TRANSCODE_HPP
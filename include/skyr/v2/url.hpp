@@ -6,23 +6,39 @@
 #ifndef SKYR_V2_URL_HPP
 #define SKYR_V2_URL_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <version>
+#if defined(__cpp_lib_format)
+#include <format>
+#endif  // defined(__cpp_lib_format)
 #include <tl/expected.hpp>
+#include <fmt/format.h>
 #include <skyr/config.hpp>
 #include <skyr/v2/network/ipv4_address.hpp>
 #include <skyr/v2/network/ipv6_address.hpp>
 #include <skyr/v2/unicode/details/to_u8.hpp>
+#include <skyr/v2/percent_encoding/percent_decode_range.hpp>
+#include <skyr/v2/percent_encoding/percent_encode.hpp>
 #include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
 #include <skyr/v2/domain/domain.hpp>
 #include <skyr/v2/core/errors.hpp>
 #include <skyr/v2/core/url_record.hpp>
 #include <skyr/v2/core/url_parse_state.hpp>
 #include <skyr/v2/core/parse.hpp>
+#include <skyr/v2/core/base_context.hpp>
+#include <skyr/v2/core/origin.hpp>
 #include <skyr/v2/core/serialize.hpp>
 #include <skyr/v2/url_search_parameters.hpp>
+#include <skyr/v2/url_search_parameters_view.hpp>
 
 #if defined(SKYR_PLATFORM_MSVC)
 #pragma warning(push)
@@ -61,6 +77,8 @@ class url_parse_error : public std::runtime_error {
 /// The API follows closely the
 /// [WhatWG IDL specification](https://url.spec.whatwg.org/#url-class).
 class url {
+  friend class url_search_parameters;
+
  public:
   /// The internal ASCII string type, or `std::basic_string<value_type>`
   using string_type = std::string;
@@ -82,7 +100,7 @@ class url {
   /// Constructs an empty `url` object
   ///
   /// \post `empty() == true`
-  url() : url_(), href_(), view_(href_), parameters_(this) {
+  url() : url_(), href_(), view_(href_), offsets_(), origin_(), parameters_(this) {
   }
 
   /// Parses a URL from the input string. The input string can be
@@ -125,24 +143,66 @@ class url {
   }
 
   /// Copy constructor
+  ///
+  /// The serialized URL is copied, not rebuilt from the record.
+  ///
   /// \param other Another `url` object
-  url(const url &other) : url(url_record(other.url_)) {
+  url(const url &other)
+      : url_(other.url_),
+        href_(other.href_),
+        view_(href_),
+        offsets_(other.offsets_),
+        origin_(other.origin_),
+        parameters_(this) {
+    update_parameters();
   }
 
   /// Move constructor
+  ///
   /// \param other Another `url` object
-  url(url &&other) noexcept : url(std::move(other.url_)) {
+  /// \post `other.empty() == true`
+  url(url &&other) noexcept
+      : url_(std::move(other.url_)),
+        href_(std::move(other.href_)),
+        view_(href_),
+        offsets_(other.offsets_),
+        origin_(std::move(other.origin_)),
+        parameters_(this) {
+    update_parameters();
+    other.reset();
   }
 
   /// Copy assignment operator
   /// \param other Another `url` object
   /// \return *this
-  url &operator=(const url &other) = default;
+  url &operator=(const url &other) {
+    if (this != &other) {
+      url_ = other.url_;
+      href_ = other.href_;
+      view_ = string_view(href_);
+      offsets_ = other.offsets_;
+      origin_ = other.origin_;
+      update_parameters();
+    }
+    return *this;
+  }
 
   /// Move assignment operator
   /// \param other Another `url` object
   /// \return *this
-  url &operator=(url &&other) = default;
+  /// \post `other.empty() == true`
+  url &operator=(url &&other) noexcept {
+    if (this != &other) {
+      url_ = std::move(other.url_);
+      href_ = std::move(other.href_);
+      view_ = string_view(href_);
+      offsets_ = other.offsets_;
+      origin_ = std::move(other.origin_);
+      update_parameters();
+      other.reset();
+    }
+    return *this;
+  }
 
   /// Destructor
   ~url() = default;
@@ -154,9 +214,11 @@ class url {
     using std::swap;
     swap(url_, other.url_);
     swap(href_, other.href_);
+    swap(offsets_, other.offsets_);
+    swap(origin_, other.origin_);
     view_ = string_view(href_);
     other.view_ = string_view(other.href_);
-    swap(parameters_, other.parameters_);
+    parameters_.swap_state(other.parameters_);
   }
 
   /// Returns the [serialization of the context object’s url](https://url.spec.whatwg.org/#dom-url-href)
@@ -169,6 +231,20 @@ class url {
     return href_;
   }
 
+  /// Returns the [serialization of the context object’s url](https://url.spec.whatwg.org/#dom-url-href)
+  /// without a copy
+  ///
+  /// The `_view` accessors return views of strings that are
+  /// built when the URL is modified, so reading a component
+  /// never allocates. The views are invalidated by any
+  /// modification of the URL.
+  ///
+  /// \returns A view of the serialization of the context object's url
+  /// \sa href()
+  [[nodiscard]] auto href_view() const noexcept -> string_view {
+    return view_;
+  }
+
   /// Sets the context object's url according to the
   /// [steps described in the specification](https://url.spec.whatwg.org/#dom-url-href)
 
@@ -213,23 +289,63 @@ class url {
   ///
   /// \returns The [URL origin](https://url.spec.whatwg.org/#origin)
   [[nodiscard]] auto origin() const -> string_type {
+    return string_type(origin_view());
+  }
+
+  /// Returns the [URL origin](https://url.spec.whatwg.org/#origin)
+  /// without a copy
+  ///
+  /// \returns A view of the [URL origin](https://url.spec.whatwg.org/#origin)
+  [[nodiscard]] auto origin_view() const noexcept -> string_view {
+    using namespace std::string_view_literals;
+
     if (url_.scheme == "blob") {
-      auto url = details::make_url(pathname(), nullptr);
-      return url ? url.value().origin() : "";
-    } else if ((url_.scheme == "ftp") || (url_.scheme == "http") || (url_.scheme == "https") || (url_.scheme == "ws") ||
-               (url_.scheme == "wss")) {
-      return protocol() + "//" + host();
+      return origin_;
+    } else if (has_tuple_origin()) {
+      // the origin is a prefix of href, unless there are
+      // credentials between the scheme and the host
+      return url_.includes_credentials() ? string_view(origin_) : view_.substr(0, offsets_.path);
     } else if (url_.scheme == "file") {
-      return "";
+      return ""sv;
     }
-    return "null";
+    return "null"sv;
+  }
+  /// Returns the [URL origin](https://url.spec.whatwg.org/#origin)
+  /// as a scheme, host and port
+  ///
+  /// The returned origin references this URL. Unlike the
+  /// serialized origin, it is compared and hashed without
+  /// building a string, and its port is the default port of
+  /// the scheme when the URL has none.
+  ///
+  /// ```
+  /// auto a = skyr::url("https://example.com/index.html");
+  /// auto b = skyr::url("https://example.com:443/?q");
+  /// assert(a.origin_parts() == b.origin_parts());
+  /// ```
+  ///
+  /// \returns The [URL origin](https://url.spec.whatwg.org/#origin)
+  [[nodiscard]] auto origin_parts() const noexcept -> url_origin {
+    if (url_.scheme == "blob") {
+      return details::parse_serialized_origin(origin_);
+    } else if (has_tuple_origin() && url_.host) {
+      auto port = url_.port ? url_.port.value() : default_port(url_.scheme).value_or(0);
+      return url_origin(view_.substr(0, url_.scheme.size()), hostname_view(), port);
+    }
+    return {};
   }
 
+
   /// The URL scheme
   [[nodiscard]] auto scheme() const -> string_type {
     return url_.scheme;
   }
 
+  /// The URL scheme without a copy
+  [[nodiscard]] auto scheme_view() const noexcept -> string_view {
+    return url_.scheme;
+  }
+
   /// The URL scheme + `":"`
   ///
   /// \returns The [URL protocol](https://url.spec.whatwg.org/#dom-url-protocol)
@@ -237,6 +353,13 @@ class url {
     return url_.scheme + ":";
   }
 
+  /// The URL scheme + `":"` without a copy
+  ///
+  /// \returns A view of the [URL protocol](https://url.spec.whatwg.org/#dom-url-protocol)
+  [[nodiscard]] auto protocol_view() const noexcept -> string_view {
+    return view_.substr(0, url_.scheme.size() + 1);
+  }
+
   /// Sets the [URL protocol](https://url.spec.whatwg.org/#dom-url-protocol)
   ///
   /// \tparam Source The input string type
@@ -264,11 +387,11 @@ class url {
     }
 
     bool validation_error = false;
-    auto new_url = details::basic_parse(protocol, &validation_error, nullptr, &url_, url_parse_state::scheme_start);
-    if (!new_url) {
-      return new_url.error();
+    auto result = details::basic_parse(protocol, &validation_error, url_, url_parse_state::scheme_start);
+    if (!result) {
+      return result.error();
     }
-    update_record(std::move(new_url).value());
+    reserialize();
     return {};
   }
 
@@ -277,6 +400,11 @@ class url {
     return url_.username;
   }
 
+  /// \returns A view of the [URL username](https://url.spec.whatwg.org/#dom-url-username)
+  [[nodiscard]] auto username_view() const noexcept -> string_view {
+    return url_.username;
+  }
+
   /// Sets the [URL username](https://url.spec.whatwg.org/#dom-url-username)
   ///
   /// \tparam Source The input string type
@@ -300,15 +428,10 @@ class url {
       return make_error_code(url_parse_errc::cannot_have_a_username_password_or_port);
     }
 
-    auto new_url = url_;
-
-    new_url.username.clear();
-    for (auto c : username) {
-      auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-      new_url.username += pct_encoded.to_string();
-    }
+    url_.username.clear();
+    percent_encode_bytes_to(username, percent_encoding::encode_set::userinfo, url_.username);
 
-    update_record(std::move(new_url));
+    reserialize();
     return {};
   }
 
@@ -321,6 +444,11 @@ class url {
     return url_.password;
   }
 
+  /// \returns A view of the [URL password](https://url.spec.whatwg.org/#dom-url-password)
+  [[nodiscard]] auto password_view() const noexcept -> string_view {
+    return url_.password;
+  }
+
   /// Sets the [URL password](https://url.spec.whatwg.org/#dom-url-password)
   ///
   /// \tparam Source The input string type
@@ -344,29 +472,21 @@ class url {
       return make_error_code(url_parse_errc::cannot_have_a_username_password_or_port);
     }
 
-    auto new_url = url_;
-
-    new_url.password.clear();
-    for (auto c : password) {
-      auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-      new_url.password += pct_encoded.to_string();
-    }
+    url_.password.clear();
+    percent_encode_bytes_to(password, percent_encoding::encode_set::userinfo, url_.password);
 
-    update_record(std::move(new_url));
+    reserialize();
     return {};
   }
 
   /// \returns The [URL host](https://url.spec.whatwg.org/#dom-url-host)
   [[nodiscard]] auto host() const -> string_type {
-    if (!url_.host) {
-      return {};
-    }
-
-    if (!url_.port) {
-      return url_.host.value().serialize();
-    }
+    return string_type(host_view());
+  }
 
-    return url_.host.value().serialize() + ":" + std::to_string(url_.port.value());
+  /// \returns A view of the [URL host](https://url.spec.whatwg.org/#dom-url-host)
+  [[nodiscard]] auto host_view() const noexcept -> string_view {
+    return view_.substr(offsets_.host, offsets_.path - offsets_.host);
   }
 
   /// Sets the [URL host](https://url.spec.whatwg.org/#dom-url-host)
@@ -392,29 +512,32 @@ class url {
       return make_error_code(url_parse_errc::cannot_be_a_base_url);
     }
 
+    // on an invalid port the host has already been written, and
+    // parsing again as a hostname writes the same host
     bool validation_error = false;
-    auto new_url = details::basic_parse(host, &validation_error, nullptr, &url_, url_parse_state::host);
-    if (!new_url) {
-      if (new_url.error() == url_parse_errc::invalid_port) {
-        new_url = details::basic_parse(host, &validation_error, nullptr, &url_, url_parse_state::hostname);
-        if (!new_url) {
-          return new_url.error();
+    auto result = details::basic_parse(host, &validation_error, url_, url_parse_state::host);
+    if (!result) {
+      if (result.error() == url_parse_errc::invalid_port) {
+        result = details::basic_parse(host, &validation_error, url_, url_parse_state::hostname);
+        if (!result) {
+          return result.error();
         }
       } else {
-        return new_url.error();
+        return result.error();
       }
     }
-    update_record(std::move(new_url).value());
+    reserialize();
     return {};
   }
 
   /// \returns The [URL hostname](https://url.spec.whatwg.org/#dom-url-hostname)
   [[nodiscard]] auto hostname() const -> string_type {
-    if (!url_.host) {
-      return {};
-    }
+    return string_type(hostname_view());
+  }
 
-    return url_.host.value().serialize();
+  /// \returns A view of the [URL hostname](https://url.spec.whatwg.org/#dom-url-hostname)
+  [[nodiscard]] auto hostname_view() const noexcept -> string_view {
+    return view_.substr(offsets_.host, offsets_.port - offsets_.host);
   }
 
   /// Sets the [URL hostname](https://url.spec.whatwg.org/#dom-url-hostname)
@@ -441,17 +564,17 @@ class url {
     }
 
     bool validation_error = false;
-    auto new_url = details::basic_parse(hostname, &validation_error, nullptr, &url_, url_parse_state::hostname);
-    if (!new_url) {
-      return new_url.error();
+    auto result = details::basic_parse(hostname, &validation_error, url_, url_parse_state::hostname);
+    if (!result) {
+      return result.error();
     }
-    update_record(std::move(new_url).value());
+    reserialize();
     return {};
   }
 
   /// Checks if the hostname is a valid domain name
   [[nodiscard]] auto is_domain() const -> bool {
-    return url_.is_special() && !hostname().empty() && !is_ipv4_address() && !is_ipv6_address();
+    return url_.is_special() && !hostname_view().empty() && !is_ipv4_address() && !is_ipv6_address();
   }
 
   /// Returns an optional domain name
@@ -463,7 +586,7 @@ class url {
   /// \returns
   [[nodiscard]] auto u8domain() const -> std::optional<std::string> {
     auto domain = this->domain();
-    if (domain) {
+    if (domain && details::has_punycode_label(domain.value())) {
       auto u8_domain = std::string{};
       return domain_to_u8(domain.value(), &u8_domain) ? std::make_optional(u8_domain) : std::nullopt;
     }
@@ -512,11 +635,18 @@ class url {
   ///
   /// \returns The [URL port](https://url.spec.whatwg.org/#dom-url-port)
   [[nodiscard]] auto port() const -> string_type {
+    return string_type(port_view());
+  }
+
+  /// Returns the [URL port](https://url.spec.whatwg.org/#dom-url-port)
+  /// without a copy
+  ///
+  /// \returns A view of the [URL port](https://url.spec.whatwg.org/#dom-url-port)
+  [[nodiscard]] auto port_view() const noexcept -> string_view {
     if (!url_.port) {
       return {};
     }
-
-    return std::to_string(url_.port.value());
+    return view_.substr(offsets_.port + 1, offsets_.path - offsets_.port - 1);
   }
 
   /// Returns the [URL port](https://url.spec.whatwg.org/#dom-url-port)
@@ -568,18 +698,16 @@ class url {
     }
 
     if (port.empty()) {
-      auto new_url = url_;
-      new_url.port = std::nullopt;
-      update_record(std::move(new_url));
+      url_.port = std::nullopt;
     } else {
       bool validation_error = false;
-      auto new_url = details::basic_parse(port, &validation_error, nullptr, &url_, url_parse_state::port);
-      if (!new_url) {
-        return new_url.error();
+      auto result = details::basic_parse(port, &validation_error, url_, url_parse_state::port);
+      if (!result) {
+        return result.error();
       }
-      update_record(std::move(new_url).value());
     }
 
+    reserialize();
     return {};
   }
 
@@ -587,20 +715,19 @@ class url {
   ///
   /// \returns The URL pathname
   [[nodiscard]] auto pathname() const -> string_type {
-    if (url_.cannot_be_a_base_url) {
-      return url_.path.front();
-    }
+    return string_type(pathname_view());
+  }
 
-    if (url_.path.empty()) {
+  /// Returns the [URL pathname](https://url.spec.whatwg.org/#dom-url-pathname)
+  /// without a copy
+  ///
+  /// \returns A view of the URL pathname
+  [[nodiscard]] auto pathname_view() const noexcept -> string_view {
+    // an empty path is serialized as "/"
+    if (!url_.cannot_be_a_base_url && url_.path.empty()) {
       return {};
     }
-
-    auto pathname = string_type("/");
-    for (const auto &segment : url_.path) {
-      pathname += segment;
-      pathname += "/";
-    }
-    return pathname.substr(0, pathname.length() - 1);
+    return view_.substr(offsets_.path, offsets_.query - offsets_.path);
   }
 
   /// Sets the [URL pathname](https://url.spec.whatwg.org/#dom-url-pathname)
@@ -626,13 +753,21 @@ class url {
       return make_error_code(url_parse_errc::cannot_be_a_base_url);
     }
 
+    auto empty_host = url_.host && url_.host.value().is_empty();
     url_.path.clear();
     bool validation_error = false;
-    auto new_url = details::basic_parse(pathname, &validation_error, nullptr, &url_, url_parse_state::path_start);
-    if (!new_url) {
-      return new_url.error();
+    auto result = details::basic_parse(pathname, &validation_error, url_, url_parse_state::path_start);
+    if (!result) {
+      return result.error();
+    }
+
+    // a file path starting with a Windows drive letter
+    // empties the host
+    if (empty_host != (url_.host && url_.host.value().is_empty())) {
+      reserialize();
+    } else {
+      replace_path();
     }
-    update_record(std::move(new_url).value());
     return {};
   }
 
@@ -640,11 +775,18 @@ class url {
   ///
   /// \returns The [URL search string](https://url.spec.whatwg.org/#dom-url-search)
   [[nodiscard]] auto search() const -> string_type {
+    return string_type(search_view());
+  }
+
+  /// Returns the [URL search string](https://url.spec.whatwg.org/#dom-url-search)
+  /// without a copy
+  ///
+  /// \returns A view of the [URL search string](https://url.spec.whatwg.org/#dom-url-search)
+  [[nodiscard]] auto search_view() const noexcept -> string_view {
     if (!url_.query || url_.query.value().empty()) {
       return {};
     }
-
-    return "?" + url_.query.value();
+    return view_.substr(offsets_.query, offsets_.fragment - offsets_.query);
   }
 
   /// Sets the [URL search string](https://url.spec.whatwg.org/#dom-url-search)
@@ -666,24 +808,23 @@ class url {
   /// \param search The new search string
   /// \returns An error on failure to parse the new URL
   auto set_search(string_view search) -> std::error_code {
-    auto url = url_;
     if (search.empty()) {
-      url.query = std::nullopt;
-      update_record(std::move(url));
-      return {};
-    }
+      url_.query = std::nullopt;
+    } else {
+      if (search.front() == '?') {
+        search.remove_prefix(1);
+      }
 
-    if (search.front() == '?') {
-      search.remove_prefix(1);
+      url_.query = "";
+      bool validation_error = false;
+      auto result = details::basic_parse(search, &validation_error, url_, url_parse_state::query);
+      if (!result) {
+        return result.error();
+      }
     }
 
-    url.query = "";
-    bool validation_error = false;
-    auto new_url = details::basic_parse(search, &validation_error, nullptr, &url, url_parse_state::query);
-    if (!new_url) {
-      return new_url.error();
-    }
-    update_record(std::move(new_url).value());
+    replace_in_href(offsets_.query, offsets_.fragment, '?', url_.query);
+    update_parameters();
     return {};
   }
 
@@ -697,15 +838,33 @@ class url {
     return parameters_;
   }
 
+  /// Returns a view of the search parameters, which are split
+  /// and decoded only when they are read
+  ///
+  /// The view refers to the URL, which must outlive it and must
+  /// not be modified while it is in use.
+  ///
+  /// \returns A view of the search parameters
+  [[nodiscard]] auto search_parameters_view() const noexcept -> url_search_parameters_view {
+    return url_search_parameters_view(search_view());
+  }
+
   /// Returns the [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
   ///
   /// \returns The [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
   [[nodiscard]] auto hash() const -> string_type {
+    return string_type(hash_view());
+  }
+
+  /// Returns the [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
+  /// without a copy
+  ///
+  /// \returns A view of the [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
+  [[nodiscard]] auto hash_view() const noexcept -> string_view {
     if (!url_.fragment || url_.fragment.value().empty()) {
       return {};
     }
-
-    return "#" + url_.fragment.value();
+    return view_.substr(offsets_.fragment);
   }
 
   /// Sets the [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
@@ -729,21 +888,20 @@ class url {
   auto set_hash(string_view hash) -> std::error_code {
     if (hash.empty()) {
       url_.fragment = std::nullopt;
-      update_record(std::move(url_));
-      return {};
-    }
+    } else {
+      if (hash.front() == '#') {
+        hash.remove_prefix(1);
+      }
 
-    if (hash.front() == '#') {
-      hash.remove_prefix(1);
+      url_.fragment = "";
+      bool validation_error = false;
+      auto result = details::basic_parse(hash, &validation_error, url_, url_parse_state::fragment);
+      if (!result) {
+        return result.error();
+      }
     }
 
-    url_.fragment = "";
-    bool validation_error = false;
-    auto new_url = details::basic_parse(hash, &validation_error, nullptr, &url_, url_parse_state::fragment);
-    if (!new_url) {
-      return new_url.error();
-    }
-    update_record(std::move(new_url).value());
+    replace_in_href(offsets_.fragment, href_.size(), '#', url_.fragment);
     return {};
   }
 
@@ -868,15 +1026,161 @@ class url {
   }
 
   void update_record(url_record &&url) {
-    url_ = url;
-    href_ = serialize(url_);
+    if (&url != &url_) {
+      url_ = std::move(url);
+    }
+    reserialize();
+    update_parameters();
+  }
+
+  // The setters update url_ in place and then write the new
+  // components into href_, so both keep their capacity
+
+  void reserialize() {
+    href_.clear();
+    serialize_to(url_, href_);
     view_ = string_view(href_);
-    parameters_.initialize(url_.query ? string_view(url_.query.value()) : string_view{});
+    update_offsets();
+  }
+
+  // Writes the path over href_[offsets_.path, offsets_.query)
+  void replace_path() {
+    // the segments are stored serialized
+    auto path = string_view("/");
+    if (url_.cannot_be_a_base_url) {
+      path = url_.path.front();
+    } else if (!url_.path.empty()) {
+      path = url_.path.chars();
+    }
+    href_.replace(offsets_.path, offsets_.query - offsets_.path, path);
+    view_ = string_view(href_);
+    update_offsets();
+  }
+
+  // Writes the query or the fragment over href_[first, last),
+  // after `delim` if there is one
+  void replace_in_href(std::size_t first, std::size_t last, char delim, const std::optional<string_type> &component) {
+    if (component) {
+      href_.replace(first, last - first, component.value().size() + 1, delim);
+      std::copy(std::cbegin(component.value()), std::cend(component.value()),
+                std::next(std::begin(href_), static_cast<std::ptrdiff_t>(first + 1)));
+    } else {
+      href_.erase(first, last - first);
+    }
+    view_ = string_view(href_);
+    update_offsets();
+  }
+
+  // The parameters are tokenized again when they are next used
+  void update_parameters() noexcept {
+    parameters_.invalidate();
+    // without a query, the empty list is its serialization
+    parameters_.synced_ = !url_.query;
+  }
+
+  // Leaves a moved-from url empty, as if default constructed
+  void reset() noexcept {
+    url_ = url_record{};
+    href_.clear();
+    view_ = string_view(href_);
+    offsets_ = offsets{};
+    origin_.clear();
+    update_parameters();
+  }
+
+  // Appends "&pair" to the query, or makes "pair" the query,
+  // and writes it at the end of the query in href_
+  void append_to_query(string_view pair) {
+    auto pos = offsets_.fragment;
+    auto delim = url_.query ? '&' : '?';
+    if (url_.query) {
+      url_.query.value() += '&';
+      url_.query.value() += pair;
+    } else {
+      url_.query = string_type(pair);
+    }
+    href_.insert(pos, 1, delim);
+    href_.insert(pos + 1, pair);
+    view_ = string_view(href_);
+    update_offsets();
+  }
+
+  [[nodiscard]] auto has_tuple_origin() const noexcept -> bool {
+    return (url_.scheme == "ftp") || (url_.scheme == "http") || (url_.scheme == "https") || (url_.scheme == "ws") ||
+           (url_.scheme == "wss");
+  }
+
+  // Locates the components in href_ from the lengths of the
+  // parts of the record, which is cheaper than serializing
+  // them again. The path, query and fragment are found from
+  // the end, and the host from the start.
+  void update_offsets() {
+    auto size = href_.size();
+    offsets_.fragment = url_.fragment ? (size - url_.fragment.value().size() - 1) : size;
+    offsets_.query = url_.query ? (offsets_.fragment - url_.query.value().size() - 1) : offsets_.fragment;
+
+    auto path_size = std::size_t(1);
+    if (url_.cannot_be_a_base_url) {
+      path_size = url_.path.empty() ? 0 : url_.path.front().size();
+    } else if (!url_.path.empty()) {
+      path_size = url_.path.chars().size();
+    }
+    offsets_.path = offsets_.query - path_size;
+
+    if (url_.host) {
+      offsets_.host = url_.scheme.size() + 3;
+      if (url_.includes_credentials()) {
+        offsets_.host += url_.username.size() + 1;
+        if (!url_.password.empty()) {
+          offsets_.host += url_.password.size() + 1;
+        }
+      }
+      offsets_.port = offsets_.path;
+      if (url_.port) {
+        auto port = url_.port.value();
+        do {
+          --offsets_.port;
+          port /= 10;
+        } while (port != 0);
+        --offsets_.port;
+      }
+    } else {
+      offsets_.host = offsets_.port = offsets_.path;
+    }
+    assert(!url_.port || (href_[offsets_.port] == ':'));
+    assert(!url_.query || (href_[offsets_.query] == '?'));
+    assert(!url_.fragment || (href_[offsets_.fragment] == '#'));
+
+    // an origin which is not a prefix of href is kept apart
+    origin_.clear();
+    if (url_.scheme == "blob") {
+      auto url = details::make_url(pathname_view(), nullptr);
+      if (url) {
+        origin_ = url.value().origin_view();
+      }
+    } else if (has_tuple_origin() && url_.includes_credentials()) {
+      origin_ = protocol_view();
+      origin_ += "//";
+      origin_ += host_view();
+    }
   }
 
+  // Positions in href_. The host ends at `port`, which is
+  // the ':' before the port number if there is one, and
+  // `query` and `fragment` are at the '?' and the '#'.
+  struct offsets {
+    std::size_t host = 0;
+    std::size_t port = 0;
+    std::size_t path = 0;
+    std::size_t query = 0;
+    std::size_t fragment = 0;
+  };
+
   url_record url_;
   std::string href_;
   string_view view_;
+  offsets offsets_;
+  std::string origin_;
   url_search_parameters parameters_;
 };
 
@@ -931,6 +1235,23 @@ inline auto make_url(const Source &input, const url &base) -> tl::expected<url,
   return details::make_url(bytes.value(), &base_record);
 }
 
+/// Parses a URL string against a prepared base URL and
+/// constructs a `url` object on success, wrapped in a
+/// `tl::expected`
+///
+/// \tparam Source The input string type
+/// \param input The input string
+/// \param base The base URL
+/// \returns A `url` object on success, an error on failure
+template <class Source>
+inline auto make_url(const Source &input, const base_context &base) -> tl::expected<url, url_parse_errc> {
+  auto bytes = details::to_u8(input);
+  if (!bytes) {
+    return tl::make_unexpected(url_parse_errc::invalid_unicode_character);
+  }
+  return details::make_url(bytes.value(), &base.record());
+}
+
 /// Tests two URLs for equality according to the
 /// [WhatWG specification](https://url.spec.whatwg.org/#url-equivalence)
 ///
@@ -991,7 +1312,7 @@ inline auto operator>=(const url &lhs, const url &rhs) noexcept {
 /// \param url
 /// \returns
 inline auto &operator<<(std::ostream &os, const url &url) {
-  return os << url.href();
+  return os << url.href_view();
 }
 
 namespace literals {
@@ -1028,7 +1349,12 @@ inline auto operator"" _url(const char32_t *str, std::size_t length) {
 }
 }  // namespace literals
 
-inline url_search_parameters::url_search_parameters(url *url) : url_(url) {
+inline url_search_parameters::url_search_parameters(url *url) : url_(url), stale_(true) {
+}
+
+inline void url_search_parameters::tokenize() const {
+  stale_ = false;
+  parameters_.clear();
   if (url_->record().query) {
     initialize(url_->record().query.value());
   }
@@ -1039,10 +1365,176 @@ inline void url_search_parameters::update() {
     auto query = to_string();
     parameters_.clear();
     url_->set_search(std::string_view(query));
+    synced_ = true;
   }
 }
+
+inline void url_search_parameters::append_to_url(const value_type &parameter) {
+  auto pair = string_type{};
+  percent_encode_bytes_to(parameter.name, percent_encoding::encode_set::component, pair);
+  if (parameter.value) {
+    pair.push_back('=');
+    percent_encode_bytes_to(parameter.value.value(), percent_encoding::encode_set::component, pair);
+  }
+
+  // the query state of the parser also encodes "'" in
+  // special URLs, which the component set leaves alone
+  if (pair.find('\'') != string_type::npos) {
+    update();
+    return;
+  }
+  url_->append_to_query(pair);
+}
 }  // namespace skyr::inline v2
 
+namespace skyr::inline v2::details {
+/// The component of a URL selected by a format spec
+enum class url_format_part {
+  href,
+  origin,
+  protocol,
+  username,
+  password,
+  host,
+  hostname,
+  port,
+  pathname,
+  search,
+  hash,
+};
+
+/// Formats a `skyr::url` for `fmt::format` and `std::format`
+///
+/// The format spec is `[part][:decoded]` or `decoded`, where
+/// `part` is the name of one of the URL accessors, e.g.
+/// `{:hostname}` or `{:pathname:decoded}`. The characters are
+/// written to the output in runs, without building a string.
+///
+/// 	param Error The exception thrown on an invalid format spec
+template <class Error>
+struct url_formatter {
+  url_format_part part = url_format_part::href;
+  bool decoded = false;
+
+  template <class ParseContext>
+  constexpr auto parse(ParseContext &ctx) -> decltype(ctx.begin()) {
+    using namespace std::string_view_literals;
+
+    constexpr std::pair<std::string_view, url_format_part> names[] = {
+        {"href"sv, url_format_part::href},         {"origin"sv, url_format_part::origin},
+        {"protocol"sv, url_format_part::protocol}, {"username"sv, url_format_part::username},
+        {"password"sv, url_format_part::password}, {"hostname"sv, url_format_part::hostname},
+        {"host"sv, url_format_part::host},         {"port"sv, url_format_part::port},
+        {"pathname"sv, url_format_part::pathname}, {"search"sv, url_format_part::search},
+        {"hash"sv, url_format_part::hash},
+    };
+
+    auto it = ctx.begin(), last = ctx.end();
+    auto word = [&it, last]() {
+      auto first = it;
+      while ((it != last) && (*it != ':') && (*it != '}')) {
+        ++it;
+      }
+      return std::string_view(&*first, static_cast<std::size_t>(it - first));
+    };
+
+    if ((it == last) || (*it == '}')) {
+      return it;
+    }
+    auto name = word();
+    if (name == "decoded"sv) {
+      decoded = true;
+    } else {
+      auto found = std::find_if(std::begin(names), std::end(names), [name](auto &&n) { return n.first == name; });
+      if (found == std::end(names)) {
+        throw Error("invalid URL format spec");
+      }
+      part = found->second;
+      if ((it != last) && (*it == ':')) {
+        ++it;
+        if ((it == last) || (word() != "decoded"sv)) {
+          throw Error("invalid URL format spec");
+        }
+        decoded = true;
+      }
+    }
+    if ((it != last) && (*it != '}')) {
+      throw Error("invalid URL format spec");
+    }
+    return it;
+  }
+
+  template <class FormatContext>
+  auto format(const url &u, FormatContext &ctx) const -> decltype(ctx.out()) {
+    auto s = component(u);
+    auto out = ctx.out();
+    if (!decoded) {
+      return std::copy(std::begin(s), std::end(s), out);
+    }
+
+    // copy the runs between escapes, and decode the escapes
+    while (!s.empty()) {
+      auto pct = s.find('%');
+      auto run = s.substr(0, pct);
+      out = std::copy(std::begin(run), std::end(run), out);
+      if (pct == std::string_view::npos) {
+        break;
+      }
+      s.remove_prefix(pct);
+      auto hi = percent_encoding::details::alnum_to_hex(s.size() > 1 ? s[1] : '\0');
+      auto lo = percent_encoding::details::alnum_to_hex(s.size() > 2 ? s[2] : '\0');
+      if (hi && lo) {
+        *out++ = static_cast<char>((std::to_integer<unsigned>(hi.value()) << 4u) | std::to_integer<unsigned>(lo.value()));
+        s.remove_prefix(3);
+      } else {
+        *out++ = '%';
+        s.remove_prefix(1);
+      }
+    }
+    return out;
+  }
+
+ private:
+  [[nodiscard]] auto component(const url &u) const noexcept -> std::string_view {
+    switch (part) {
+      case url_format_part::origin:
+        return u.origin_view();
+      case url_format_part::protocol:
+        return u.protocol_view();
+      case url_format_part::username:
+        return u.username_view();
+      case url_format_part::password:
+        return u.password_view();
+      case url_format_part::host:
+        return u.host_view();
+      case url_format_part::hostname:
+        return u.hostname_view();
+      case url_format_part::port:
+        return u.port_view();
+      case url_format_part::pathname:
+        return u.pathname_view();
+      case url_format_part::search:
+        return u.search_view();
+      case url_format_part::hash:
+        return u.hash_view();
+      case url_format_part::href:
+      default:
+        return u.href_view();
+    }
+  }
+};
+}  // namespace skyr::inline v2::details
+
+/// Formats a `skyr::url` with `fmt::format`
+template <>
+struct fmt::formatter<skyr::v2::url> : skyr::v2::details::url_formatter<fmt::format_error> {};
+
+#if defined(__cpp_lib_format)
+/// Formats a `skyr::url` with `std::format`
+template <>
+struct std::formatter<skyr::v2::url> : skyr::v2::details::url_formatter<std::format_error> {};
+#endif  // defined(__cpp_lib_format)
+
 #if defined(SKYR_PLATFORM_MSVC)
 #pragma warning(pop)
 #endif  // defined(SKYR_PLATFORM_MSVC)
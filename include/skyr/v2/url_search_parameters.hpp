@@ -13,6 +13,8 @@
 #include <optional>
 #include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <utility>
 #include <fmt/format.h>
 #include <skyr/v2/core/parse_query.hpp>
 #include <skyr/v2/percent_encoding/percent_encode.hpp>
@@ -59,6 +61,8 @@ class url_search_parameters {
   /// \c std::size_t
   using size_type = std::size_t;
 
+  class deferred_update;
+
   /// Default constructor
   url_search_parameters() = default;
 
@@ -78,32 +82,46 @@ class url_search_parameters {
 
   ///
   /// \param other
-  void swap(url_search_parameters &other) noexcept {
-    std::swap(parameters_, other.parameters_);
+  void swap(url_search_parameters &other) {
+    materialize();
+    other.materialize();
+    swap_state(other);
   }
 
   /// Appends a name-value pair to the search string
   ///
+  /// When the query of the URL is the serialization of the
+  /// parameters, which is the case after any other change
+  /// through this object, the pair is appended to the query
+  /// in place, without reparsing it.
+  ///
   /// \param name The parameter name
   /// \param value The parameter value
   void append(std::string_view name, std::string_view value) {
+    materialize();
     parameters_.emplace_back(std::string(name), std::string(value));
-    update();
+    if (url_ && (deferred_ == 0) && synced_) {
+      append_to_url(parameters_.back());
+    } else {
+      changed();
+    }
   }
 
   /// Removes a parameter from the search string
   ///
   /// \param name The name of the parameter to remove
   void remove(std::string_view name) {
+    materialize();
     auto first = std::begin(parameters_), last = std::end(parameters_);
     auto it = std::remove_if(first, last, details::is_name(name));
     parameters_.erase(it, last);
-    update();
+    changed();
   }
 
   /// \param name The search parameter name
   /// \returns The first search parameter value with the given name
   [[nodiscard]] auto get(std::string_view name) const -> std::optional<string_type> {
+    materialize();
     auto first = std::cbegin(parameters_), last = std::cend(parameters_);
     auto it = std::find_if(first, last, details::is_name(name));
     return (it != last) ? it->value : std::nullopt;
@@ -112,6 +130,7 @@ class url_search_parameters {
   /// \param name The search parameter name
   /// \returns All search parameter values with the given name
   [[nodiscard]] auto get_all(std::string_view name) const -> std::vector<string_type> {
+    materialize();
     std::vector<string_type> result;
     result.reserve(parameters_.size());
     for (auto [parameter_name, value] : parameters_) {
@@ -122,12 +141,27 @@ class url_search_parameters {
     return result;
   }
 
+  /// A forward range of the values of the parameters with a name
+  class value_range;
+
+  /// Returns the values of the parameters with a name
+  ///
+  /// Unlike `get_all`, this copies nothing; the values are views of
+  /// the parameters, which are found as the range is iterated. The
+  /// range is invalidated by changes to the parameters.
+  ///
+  /// \param name The search parameter name
+  /// \returns A lazy range of the values with the given name, in
+  ///          order
+  [[nodiscard]] auto values(std::string_view name) const -> value_range;
+
   /// Tests if there is a parameter with the given name
   ///
   /// \param name The search parameter name
   /// \returns `true` if the value is in the search parameters,
   /// `false` otherwise.
-  [[nodiscard]] auto contains(std::string_view name) const noexcept -> bool {
+  [[nodiscard]] auto contains(std::string_view name) const -> bool {
+    materialize();
     auto first = std::cbegin(parameters_), last = std::cend(parameters_);
     return std::find_if(first, last, details::is_name(name)) != last;
   }
@@ -137,6 +171,7 @@ class url_search_parameters {
   /// \param name The search parameter name
   /// \param value The search parameter value
   void set(std::string_view name, std::string_view value) {
+    materialize();
     auto first = std::begin(parameters_), last = std::end(parameters_);
     auto it = std::find_if(first, last, details::is_name(name));
     if (it != last) {
@@ -146,9 +181,9 @@ class url_search_parameters {
       it = std::remove_if(it, last, details::is_name(name));
       ranges::erase(parameters_, it, last);
     } else {
-      append(name, value);
+      parameters_.emplace_back(std::string(name), std::string(value));
     }
-    update();
+    changed();
   }
 
   /// Clears the search parameters
@@ -156,10 +191,12 @@ class url_search_parameters {
   /// \post `empty() == true`
   void clear() noexcept {
     parameters_.clear();
-    update();
+    stale_ = false;
+    changed();
   }
 
-  /// Sorts the search parameters alphanumerically
+  /// Sorts the search parameters alphanumerically, keeping the
+  /// relative order of parameters with the same name
   ///
   /// https://url.spec.whatwg.org/#example-searchparams-sort
   ///
@@ -172,57 +209,96 @@ class url_search_parameters {
   void sort() {
     static constexpr auto less_name = [](const auto &lhs, const auto &rhs) { return lhs.name < rhs.name; };
 
+    // the sort is stable, and moves the parameters
+    materialize();
     auto first = std::begin(parameters_), last = std::end(parameters_);
-    std::sort(first, last, less_name);
-    update();
+    std::stable_sort(first, last, less_name);
+    changed();
+  }
+
+  /// Defers writing the changes back to the URL
+  ///
+  /// Until the returned object is destroyed, the changes made
+  /// through this object are only applied to the parameters,
+  /// and the URL is updated once, when it is destroyed. The
+  /// query of the URL is not updated in the meantime.
+  ///
+  /// ```
+  /// auto url = skyr::url("https://example.org/");
+  /// {
+  ///   auto edit = url.search_parameters().defer_update();
+  ///   for (auto i = 0; i < 30; ++i) {
+  ///     url.search_parameters().append("k", std::to_string(i));
+  ///   }
+  /// }
+  /// assert(url.search_parameters().size() == 30);
+  /// ```
+  ///
+  /// \returns An object which commits the changes when it is destroyed
+  [[nodiscard]] auto defer_update() -> deferred_update;
+
+  /// Writes the deferred changes back to the URL
+  ///
+  /// This does nothing if there are none.
+  void commit() {
+    if (dirty_) {
+      dirty_ = false;
+      update();
+    }
   }
 
   /// \returns An iterator to the first element in the search parameters
-  [[nodiscard]] auto cbegin() const noexcept {
+  [[nodiscard]] auto cbegin() const {
+    materialize();
     return parameters_.cbegin();
   }
 
   /// \returns An iterator to the last element in the search parameters
-  [[nodiscard]] auto cend() const noexcept {
+  [[nodiscard]] auto cend() const {
+    materialize();
     return parameters_.cend();
   }
 
   /// \returns An iterator to the first element in the search parameters
-  [[nodiscard]] auto begin() const noexcept {
+  [[nodiscard]] auto begin() const {
     return cbegin();
   }
 
   /// \returns An iterator to the last element in the search parameters
-  [[nodiscard]] auto end() const noexcept {
+  [[nodiscard]] auto end() const {
     return cend();
   }
 
   /// \returns `true` if the URL search string is empty, `false`
   ///          otherwise
-  [[nodiscard]] auto empty() const noexcept {
+  [[nodiscard]] auto empty() const {
+    materialize();
     return parameters_.empty();
   }
 
   /// \returns The size of the parameters array (i.e. the
   ///          number of parameters)
-  [[nodiscard]] auto size() const noexcept {
+  [[nodiscard]] auto size() const {
+    materialize();
     return parameters_.size();
   }
 
   /// \returns The serialized URL search parameters
   [[nodiscard]] auto to_string() const -> string_type {
+    materialize();
     auto result = string_type{};
 
     bool start = true;
     for (const auto &[name, value] : parameters_) {
       if (start) {
-        result.append(percent_encode(name));
         start = false;
       } else {
-        result.append(fmt::format("&{}", percent_encode(name)));
+        result.push_back('&');
       }
+      percent_encode_bytes_to(name, percent_encoding::encode_set::component, result);
       if (value) {
-        result.append(fmt::format("={}", percent_encode(value.value())));
+        result.push_back('=');
+        percent_encode_bytes_to(value.value(), percent_encoding::encode_set::component, result);
       }
     }
 
@@ -232,7 +308,7 @@ class url_search_parameters {
  private:
   explicit url_search_parameters(url *url);
 
-  void initialize(std::string_view query) {
+  void initialize(std::string_view query) const {
     if (auto parameters = parse_query(query); parameters) {
       for (auto [name, value] : parameters.value()) {
         auto name_ = percent_decode(name).value_or(std::string(name));
@@ -244,14 +320,178 @@ class url_search_parameters {
 
   void update();
 
-  std::vector<value_type> parameters_;
+  // The parameters of a url are only tokenized from its
+  // query when they are first used after the query changed
+  void materialize() const {
+    if (stale_) {
+      tokenize();
+    }
+  }
+
+  void tokenize() const;
+
+  void invalidate() noexcept {
+    stale_ = true;
+    dirty_ = false;
+  }
+
+  void swap_state(url_search_parameters &other) noexcept {
+    std::swap(parameters_, other.parameters_);
+    std::swap(stale_, other.stale_);
+    std::swap(synced_, other.synced_);
+    std::swap(dirty_, other.dirty_);
+  }
+
+  void append_to_url(const value_type &parameter);
+
+  void changed() {
+    if (deferred_ != 0) {
+      dirty_ = true;
+    } else {
+      update();
+    }
+  }
+
+  mutable std::vector<value_type> parameters_;
   url *url_ = nullptr;
+  // parameters_ must be tokenized from the query of the url
+  mutable bool stale_ = false;
+  // the query of the url is the serialization of parameters_
+  bool synced_ = false;
+  // changes are waiting for a commit
+  bool dirty_ = false;
+  std::size_t deferred_ = 0;
 };
 
+class url_search_parameters::value_range {
+ public:
+  /// An iterator through the values
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = value_type;
+
+    /// Constructs a singular iterator
+    const_iterator() = default;
+
+    /// Increments the iterator
+    auto operator++() noexcept -> const_iterator & {
+      it_ = std::find_if(std::next(it_), last_, details::is_name(name_));
+      return *this;
+    }
+
+    /// Increments the iterator
+    auto operator++(int) noexcept -> const_iterator {
+      auto result = *this;
+      ++*this;
+      return result;
+    }
+
+    /// \returns The current value, or an empty string if the
+    ///          parameter has none
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+      return it_->value ? std::string_view(it_->value.value()) : std::string_view();
+    }
+
+    /// Tests two iterators for equality
+    [[nodiscard]] auto operator==(const const_iterator &other) const noexcept -> bool {
+      return it_ == other.it_;
+    }
+
+   private:
+    friend class value_range;
+
+    url_search_parameters::const_iterator it_, last_;
+    std::string_view name_;
+  };
+
+  /// An alias to \c const_iterator
+  using iterator = const_iterator;
+
+  /// \returns An iterator to the first value
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    auto it = end();
+    it.it_ = first_;
+    return it;
+  }
+
+  /// \returns An iterator past the last value
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    auto it = const_iterator();
+    it.it_ = last_;
+    it.last_ = last_;
+    it.name_ = name_;
+    return it;
+  }
+
+  /// \returns `true` if no parameter has the name, `false` otherwise
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return first_ == last_;
+  }
+
+ private:
+  friend class url_search_parameters;
+
+  value_range(const_iterator::value_type name, url_search_parameters::const_iterator first,
+              url_search_parameters::const_iterator last) noexcept
+      : first_(std::find_if(first, last, details::is_name(name))), last_(last), name_(name) {
+  }
+
+  url_search_parameters::const_iterator first_, last_;
+  std::string_view name_;
+};
+
+inline auto url_search_parameters::values(std::string_view name) const -> value_range {
+  materialize();
+  return value_range(name, parameters_.cbegin(), parameters_.cend());
+}
+
+/// Commits the changes to a `url_search_parameters` object when
+/// it is destroyed
+///
+/// \sa url_search_parameters::defer_update
+class url_search_parameters::deferred_update {
+ public:
+  /// Constructor
+  /// \param parameters The parameters to update
+  explicit deferred_update(url_search_parameters &parameters) noexcept : parameters_(&parameters) {
+    ++parameters_->deferred_;
+  }
+
+  deferred_update(const deferred_update &) = delete;
+  deferred_update &operator=(const deferred_update &) = delete;
+
+  /// Move constructor
+  deferred_update(deferred_update &&other) noexcept : parameters_(std::exchange(other.parameters_, nullptr)) {
+  }
+
+  deferred_update &operator=(deferred_update &&) = delete;
+
+  /// Destructor
+  ///
+  /// Commits the changes when this is the last pending
+  /// `deferred_update` of the parameters
+  ~deferred_update() {
+    if (parameters_ && (--parameters_->deferred_ == 0)) {
+      parameters_->commit();
+    }
+  }
+
+ private:
+  url_search_parameters *parameters_;
+};
+
+inline auto url_search_parameters::defer_update() -> deferred_update {
+  return deferred_update(*this);
+}
+
 ///
 /// \param lhs
 /// \param rhs
-inline void swap(url_search_parameters &lhs, url_search_parameters &rhs) noexcept {
+inline void swap(url_search_parameters &lhs, url_search_parameters &rhs) {
   lhs.swap(rhs);
 }
 }  // namespace skyr::inline v2
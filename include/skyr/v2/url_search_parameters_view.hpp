@@ -0,0 +1,653 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_V2_URL_SEARCH_PARAMETERS_VIEW_HPP
+#define SKYR_V2_URL_SEARCH_PARAMETERS_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <skyr/v2/percent_encoding/percent_decode.hpp>
+
+namespace skyr::inline v2 {
+/// A name-value pair of a search string, as it is encoded
+struct query_parameter_view {
+  std::string_view name;
+  std::string_view value;
+};
+
+namespace details {
+inline constexpr auto is_query_separator(char byte) noexcept {
+  return (byte == '&') || (byte == ';');
+}
+
+inline auto decode_query_component(std::string_view component) -> std::string {
+  return percent_decode(component).value_or(std::string(component));
+}
+
+// Compares an encoded name with a decoded one, and only
+// decodes if the encoded name has an escape
+inline auto query_name_equals(std::string_view encoded, std::string_view name) -> bool {
+  if (encoded.find('%') == std::string_view::npos) {
+    return encoded == name;
+  }
+  return decode_query_component(encoded) == name;
+}
+
+// An encoded value, and the position of the next value with the
+// same name, or -1
+struct query_link {
+  std::string_view value;
+  std::size_t next;
+};
+}  // namespace details
+
+class parameter_groups;
+
+/// A read-only view of the
+/// [URL search parameters](https://url.spec.whatwg.org/#urlsearchparams)
+/// of a serialized search string
+///
+/// Unlike `url_search_parameters`, which decodes every parameter
+/// into strings it owns, the view splits the search string as it is
+/// iterated, and names and values are decoded only when they are
+/// looked up. Empty sequences, as in `a=1&&b=2`, are skipped. The
+/// search string must outlive the view.
+///
+/// The second lookup of a name indexes the parameters by name, so
+/// that later lookups are logarithmic. The index is built by `const`
+/// member functions, so a view must not be shared between threads,
+/// but copies can be.
+///
+/// ```
+/// auto url = skyr::url("https://example.org/?utm_source=news&id=42&utm_medium=email");
+/// auto parameters = url.search_parameters_view();
+/// assert(parameters.get("id") == "42");
+/// ```
+class url_search_parameters_view {
+ public:
+  /// string type
+  /// \sa url::string_type
+  using string_type = std::string;
+
+  /// string_view type
+  using string_view = std::string_view;
+
+  /// An encoded name-value pair
+  using value_type = query_parameter_view;
+
+  /// \c std::size_t
+  using size_type = std::size_t;
+
+  /// An iterator through the encoded search parameters
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = query_parameter_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    /// Constructs an end iterator
+    constexpr const_iterator() noexcept = default;
+
+    /// Increments the iterator
+    auto operator++() noexcept -> const_iterator & {
+      next();
+      return *this;
+    }
+
+    /// Increments the iterator
+    auto operator++(int) noexcept -> const_iterator {
+      auto result = *this;
+      next();
+      return result;
+    }
+
+    /// \returns The current parameter
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+      return parameter_;
+    }
+
+    /// \returns A pointer to the current parameter
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+      return &parameter_;
+    }
+
+    /// Tests two iterators for equality
+    [[nodiscard]] auto operator==(const const_iterator &other) const noexcept -> bool {
+      return parameter_.name.data() == other.parameter_.name.data();
+    }
+
+   private:
+    friend class url_search_parameters_view;
+
+    explicit const_iterator(string_view query) noexcept : rest_(query) {
+      next();
+    }
+
+    void next() noexcept {
+      while (!rest_.empty() && details::is_query_separator(rest_.front())) {
+        rest_.remove_prefix(1);
+      }
+      if (rest_.empty()) {
+        parameter_ = {};
+        return;
+      }
+
+      auto last = std::find_if(std::cbegin(rest_), std::cend(rest_), details::is_query_separator);
+      auto sequence = rest_.substr(0, static_cast<size_type>(std::distance(std::cbegin(rest_), last)));
+      rest_.remove_prefix(sequence.size());
+
+      auto delim = sequence.find('=');
+      if (delim != string_view::npos) {
+        parameter_ = {sequence.substr(0, delim), sequence.substr(delim + 1)};
+      } else {
+        parameter_ = {sequence, sequence.substr(sequence.size())};
+      }
+    }
+
+    string_view rest_;
+    value_type parameter_;
+  };
+
+  /// An alias to \c const_iterator
+  using iterator = const_iterator;
+
+  /// A forward range of the encoded values of the parameters with a
+  /// name, in order
+  ///
+  /// The values are views of the search string; they are found as
+  /// the range is iterated, and are neither copied nor decoded.
+  class value_range {
+   public:
+    /// An iterator through the encoded values
+    class const_iterator {
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = string_view;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const value_type *;
+      using reference = value_type;
+
+      /// Constructs an end iterator
+      constexpr const_iterator() noexcept = default;
+
+      /// Increments the iterator
+      auto operator++() -> const_iterator & {
+        next();
+        return *this;
+      }
+
+      /// Increments the iterator
+      auto operator++(int) -> const_iterator {
+        auto result = *this;
+        next();
+        return result;
+      }
+
+      /// \returns The current encoded value
+      [[nodiscard]] auto operator*() const noexcept -> reference {
+        return (links_ != nullptr) ? links_[link_].value : it_->value;
+      }
+
+      /// Tests two iterators for equality
+      [[nodiscard]] auto operator==(const const_iterator &other) const noexcept -> bool {
+        return (links_ != nullptr) ? (link_ == other.link_) : (it_ == other.it_);
+      }
+
+     private:
+      friend class value_range;
+
+      void next() {
+        if (links_ != nullptr) {
+          link_ = links_[link_].next;
+          return;
+        }
+        do {
+          ++it_;
+        } while ((it_ != url_search_parameters_view::const_iterator()) &&
+                 !details::query_name_equals(it_->name, name_));
+      }
+
+      url_search_parameters_view::const_iterator it_;
+      string_view name_;
+      const details::query_link *links_ = nullptr;
+      size_type link_ = 0;
+    };
+
+    /// An alias to \c const_iterator
+    using iterator = const_iterator;
+
+    /// Constructs an empty range
+    value_range() = default;
+
+    /// \returns An iterator to the first value
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+      auto it = const_iterator();
+      it.it_ = first_;
+      it.name_ = name_;
+      it.links_ = links_;
+      it.link_ = link_;
+      return it;
+    }
+
+    /// \returns An iterator past the last value
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+      auto it = const_iterator();
+      it.links_ = links_;
+      it.link_ = npos;
+      return it;
+    }
+
+    /// \returns `true` if no parameter has the name, `false` otherwise
+    [[nodiscard]] auto empty() const noexcept -> bool {
+      return begin() == end();
+    }
+
+   private:
+    friend class url_search_parameters_view;
+    friend class parameter_groups;
+
+    static constexpr auto npos = static_cast<size_type>(-1);
+
+    url_search_parameters_view::const_iterator first_;
+    string_view name_;
+    const details::query_link *links_ = nullptr;
+    size_type link_ = npos;
+  };
+
+  /// Constructs an empty view
+  url_search_parameters_view() = default;
+
+  /// Constructor
+  ///
+  /// \param query A serialized search string, with or without the
+  ///        leading `?`
+  explicit url_search_parameters_view(string_view query) noexcept : query_(query) {
+    if (!query_.empty() && (query_.front() == '?')) {
+      query_.remove_prefix(1);
+    }
+  }
+
+  /// \returns The search string, without the leading `?`
+  [[nodiscard]] auto query() const noexcept -> string_view {
+    return query_;
+  }
+
+  /// \returns An iterator to the first parameter
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return const_iterator(query_);
+  }
+
+  /// \returns An iterator past the last parameter
+  [[nodiscard]] auto cend() const noexcept -> const_iterator {
+    return const_iterator();
+  }
+
+  /// \returns An iterator to the first parameter
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return cbegin();
+  }
+
+  /// \returns An iterator past the last parameter
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return cend();
+  }
+
+  /// \returns `true` if there are no parameters, `false` otherwise
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return cbegin() == cend();
+  }
+
+  /// \returns The number of parameters
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return static_cast<size_type>(std::distance(cbegin(), cend()));
+  }
+
+  /// \param name The decoded parameter name
+  /// \returns The first decoded value with the given name
+  [[nodiscard]] auto get(string_view name) const -> std::optional<string_type> {
+    if (use_index()) {
+      auto [first, last] = equal_range(name);
+      if (first != last) {
+        return details::decode_query_component(first->value);
+      }
+    } else {
+      for (const auto &[parameter_name, value] : *this) {
+        if (details::query_name_equals(parameter_name, name)) {
+          return details::decode_query_component(value);
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// \param name The decoded parameter name
+  /// \returns All decoded values with the given name, in order
+  [[nodiscard]] auto get_all(string_view name) const -> std::vector<string_type> {
+    auto result = std::vector<string_type>{};
+    if (use_index()) {
+      auto [first, last] = equal_range(name);
+      for (; first != last; ++first) {
+        result.emplace_back(details::decode_query_component(first->value));
+      }
+    } else {
+      for (const auto &[parameter_name, value] : *this) {
+        if (details::query_name_equals(parameter_name, name)) {
+          result.emplace_back(details::decode_query_component(value));
+        }
+      }
+    }
+    return result;
+  }
+
+  /// Returns the encoded values of the parameters with a name
+  ///
+  /// Unlike `get_all`, this allocates nothing, and leaves decoding
+  /// to the caller:
+  ///
+  /// ```
+  /// auto parameters = skyr::url_search_parameters_view("?filter=red&size=42&filter=blue");
+  /// for (auto value : parameters.values("filter")) {
+  ///   facets.push_back(skyr::percent_decode(value).value());
+  /// }
+  /// ```
+  ///
+  /// \param name The decoded parameter name
+  /// \returns A lazy range of the encoded values with the given name,
+  ///          in order
+  [[nodiscard]] auto values(string_view name) const -> value_range {
+    auto range = value_range();
+    range.first_ = std::find_if(cbegin(), cend(), [name](const auto &parameter) {
+      return details::query_name_equals(parameter.name, name);
+    });
+    range.name_ = name;
+    return range;
+  }
+
+  /// Groups the parameters by decoded name in one pass
+  ///
+  /// \returns The groups, in the order in which their names first
+  ///          appear
+  [[nodiscard]] auto group_by_key() const -> parameter_groups;
+
+  /// Tests if there is a parameter with the given name
+  ///
+  /// \param name The decoded parameter name
+  /// \returns `true` if there is a parameter with this name,
+  ///          `false` otherwise
+  [[nodiscard]] auto contains(string_view name) const -> bool {
+    if (use_index()) {
+      auto [first, last] = equal_range(name);
+      return first != last;
+    }
+    return std::any_of(cbegin(), cend(),
+                       [name](const auto &parameter) { return details::query_name_equals(parameter.name, name); });
+  }
+
+ private:
+  // A decoded name is a view of the parameter if it has no
+  // escape, and otherwise is in names_
+  struct index_entry {
+    size_type offset;
+    size_type size;
+    bool decoded;
+    string_view value;
+  };
+
+  [[nodiscard]] auto name_of(const index_entry &entry) const noexcept -> string_view {
+    return entry.decoded ? string_view(names_).substr(entry.offset, entry.size)
+                         : query_.substr(entry.offset, entry.size);
+  }
+
+  [[nodiscard]] auto use_index() const -> bool {
+    if (!indexed_ && std::exchange(looked_up_, true)) {
+      build_index();
+    }
+    return indexed_;
+  }
+
+  void build_index() const {
+    for (const auto &[name, value] : *this) {
+      if (name.find('%') == string_view::npos) {
+        auto offset = static_cast<size_type>(name.data() - query_.data());
+        index_.push_back({offset, name.size(), false, value});
+      } else {
+        auto offset = names_.size();
+        names_ += details::decode_query_component(name);
+        index_.push_back({offset, names_.size() - offset, true, value});
+      }
+    }
+
+    // equal names stay in the order of the search string
+    std::stable_sort(std::begin(index_), std::end(index_),
+                     [this](const auto &lhs, const auto &rhs) { return name_of(lhs) < name_of(rhs); });
+    indexed_ = true;
+  }
+
+  using index_iterator = std::vector<index_entry>::const_iterator;
+
+  struct less_name {
+    const url_search_parameters_view *view;
+
+    auto operator()(const index_entry &entry, string_view name) const noexcept {
+      return view->name_of(entry) < name;
+    }
+
+    auto operator()(string_view name, const index_entry &entry) const noexcept {
+      return name < view->name_of(entry);
+    }
+  };
+
+  [[nodiscard]] auto equal_range(string_view name) const -> std::pair<index_iterator, index_iterator> {
+    return std::equal_range(std::cbegin(index_), std::cend(index_), name, less_name{this});
+  }
+
+  string_view query_;
+  mutable std::vector<index_entry> index_;
+  mutable std::string names_;
+  mutable bool looked_up_ = false;
+  mutable bool indexed_ = false;
+};
+
+/// The parameters of a search string, grouped by decoded name
+///
+/// The groups are built in one pass over the parameters, using a
+/// small open-addressing hash table of the names. Each parameter is
+/// linked to the next one with the same name, so that the values of a
+/// group are visited without comparing names. The values are views
+/// of the search string, which must outlive the groups.
+///
+/// ```
+/// auto url = skyr::url("https://example.org/?filter=red&size=42&filter=blue");
+/// for (const auto &[name, count, values] : url.search_parameters_view().group_by_key()) {
+///   std::cout << name << ": " << count << " values\n";
+/// }
+/// ```
+class parameter_groups {
+ public:
+  /// The parameters with the same decoded name
+  struct group {
+    /// The encoded name of the first parameter
+    std::string_view name;
+    /// The number of parameters
+    std::size_t count = 0;
+    /// The encoded values of the parameters
+    url_search_parameters_view::value_range values;
+  };
+
+  /// A group of parameters
+  using value_type = group;
+
+  /// An iterator through the groups
+  using const_iterator = std::vector<group>::const_iterator;
+
+  /// An alias to \c const_iterator
+  using iterator = const_iterator;
+
+  /// \c std::size_t
+  using size_type = std::size_t;
+
+  /// Constructs an empty set of groups
+  parameter_groups() = default;
+
+  /// Groups the parameters of a view
+  ///
+  /// \param parameters The parameters
+  explicit parameter_groups(const url_search_parameters_view &parameters) {
+    for (const auto &[name, value] : parameters) {
+      add(name, value);
+    }
+
+    groups_.reserve(slots_.size());
+    for (const auto &slot : slots_) {
+      auto range = url_search_parameters_view::value_range();
+      range.links_ = links_.data();
+      range.link_ = slot.first;
+      groups_.push_back({slot.name, slot.count, range});
+    }
+  }
+
+  // The groups refer to the links
+  parameter_groups(const parameter_groups &) = delete;
+  parameter_groups(parameter_groups &&) noexcept = default;
+  auto operator=(const parameter_groups &) -> parameter_groups & = delete;
+  auto operator=(parameter_groups &&) noexcept -> parameter_groups & = default;
+  ~parameter_groups() = default;
+
+  /// \returns An iterator to the first group
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return groups_.cbegin();
+  }
+
+  /// \returns An iterator past the last group
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return groups_.cend();
+  }
+
+  /// \returns The number of distinct names
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return groups_.size();
+  }
+
+  /// \returns `true` if there are no parameters, `false` otherwise
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return groups_.empty();
+  }
+
+  /// \param index The position of the group
+  /// \returns The group at the given position
+  [[nodiscard]] auto operator[](size_type index) const noexcept -> const group & {
+    return groups_[index];
+  }
+
+  /// \param name The decoded parameter name
+  /// \returns The encoded values with the given name, in order
+  [[nodiscard]] auto values(std::string_view name) const noexcept -> url_search_parameters_view::value_range {
+    auto index = find(name);
+    return (index != npos) ? groups_[index].values : url_search_parameters_view::value_range();
+  }
+
+ private:
+  static constexpr auto npos = static_cast<size_type>(-1);
+
+  struct slot {
+    std::string_view name;
+    size_type hash;
+    // the decoded name is in names_ if the name has an escape
+    bool escaped;
+    size_type offset;
+    size_type size;
+    size_type count;
+    size_type first;
+    size_type last;
+  };
+
+  [[nodiscard]] auto decoded_name(const slot &s) const noexcept -> std::string_view {
+    return s.escaped ? std::string_view(names_).substr(s.offset, s.size) : s.name;
+  }
+
+  [[nodiscard]] auto find(std::string_view name) const noexcept -> size_type {
+    if (table_.empty()) {
+      return npos;
+    }
+    auto hash = std::hash<std::string_view>()(name);
+    auto mask = table_.size() - 1;
+    for (auto i = hash & mask; table_[i] != 0; i = (i + 1) & mask) {
+      const auto &s = slots_[table_[i] - 1];
+      if ((s.hash == hash) && (decoded_name(s) == name)) {
+        return table_[i] - 1;
+      }
+    }
+    return npos;
+  }
+
+  void add(std::string_view name, std::string_view value) {
+    auto position = links_.size();
+    links_.push_back({value, npos});
+
+    // only names with an escape are decoded
+    auto escaped = name.find('%') != std::string_view::npos;
+    auto offset = names_.size();
+    if (escaped) {
+      names_ += details::decode_query_component(name);
+    }
+    auto size = escaped ? (names_.size() - offset) : name.size();
+    auto decoded = escaped ? std::string_view(names_).substr(offset, size) : name;
+    auto hash = std::hash<std::string_view>()(decoded);
+    if ((slots_.size() + 1) * 2 > table_.size()) {
+      grow();
+    }
+    auto mask = table_.size() - 1;
+    auto i = hash & mask;
+    for (; table_[i] != 0; i = (i + 1) & mask) {
+      auto &s = slots_[table_[i] - 1];
+      if ((s.hash == hash) && (decoded_name(s) == decoded)) {
+        links_[s.last].next = position;
+        s.last = position;
+        ++s.count;
+        if (escaped) {
+          names_.resize(offset);
+        }
+        return;
+      }
+    }
+    slots_.push_back({name, hash, escaped, offset, size, 1, position, position});
+    table_[i] = slots_.size();
+  }
+
+  void grow() {
+    table_.assign((table_.size() < 8) ? 16 : (table_.size() * 2), 0);
+    auto mask = table_.size() - 1;
+    for (auto n = size_type(0); n < slots_.size(); ++n) {
+      auto i = slots_[n].hash & mask;
+      while (table_[i] != 0) {
+        i = (i + 1) & mask;
+      }
+      table_[i] = n + 1;
+    }
+  }
+
+  std::vector<details::query_link> links_;
+  std::vector<slot> slots_;
+  // the positions of the slots plus one, or zero
+  std::vector<size_type> table_;
+  std::string names_;
+  std::vector<group> groups_;
+};
+
+inline auto url_search_parameters_view::group_by_key() const -> parameter_groups {
+  return parameter_groups(*this);
+}
+}  // namespace skyr::inline v2
+
+#endif  // SKYR_V2_URL_SEARCH_PARAMETERS_VIEW_HPP
@@ -0,0 +1,612 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority.hpp>
+#include <boost/url/encode.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/stats.hpp>
+#include "detail/print.hpp"
+#include "rfc/detail/charsets.hpp"
+#include "rfc/detail/ipvfuture_rule.hpp"
+#include "rfc/detail/port_rule.hpp"
+#include <boost/assert.hpp>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Return true if s references
+// characters of the buffer
+bool
+aliases(
+    core::string_view s,
+    char const* first,
+    std::size_t n) noexcept
+{
+    std::less_equal<char const*> le;
+    return
+        le(first, s.data()) &&
+        le(s.data(), first + n);
+}
+
+} // (anon)
+
+constexpr std::size_t authority::inline_capacity;
+
+authority::
+~authority()
+{
+    if(s_ != buf_)
+    {
+        detail::stats_deallocate();
+        delete[] s_;
+    }
+}
+
+authority::
+authority() noexcept
+    : u_(from::authority)
+    , s_(buf_)
+    , cap_(inline_capacity)
+{
+    s_[0] = '\0';
+    u_.cs_ = s_;
+}
+
+authority::
+authority(
+    core::string_view s)
+    : authority()
+{
+    copy(parse_authority(s
+        ).value(BOOST_URL_POS));
+}
+
+authority::
+authority(
+    authority_view const& a)
+    : authority()
+{
+    copy(a);
+}
+
+authority::
+authority(
+    authority const& other)
+    : authority()
+{
+    copy(other);
+}
+
+authority::
+authority(
+    authority&& other) noexcept
+    : authority()
+{
+    *this = std::move(other);
+}
+
+authority&
+authority::
+operator=(
+    authority const& other)
+{
+    if(this != &other)
+        copy(other);
+    return *this;
+}
+
+authority&
+authority::
+operator=(
+    authority&& other) noexcept
+{
+    if(this == &other)
+        return *this;
+    if(other.s_ == other.buf_)
+    {
+        // always fits inline
+        std::memcpy(s_, other.s_,
+            other.size() + 1);
+        u_ = other.u_;
+        u_.cs_ = s_;
+        other.clear();
+        return *this;
+    }
+    if(s_ != buf_)
+    {
+        detail::stats_deallocate();
+        delete[] s_;
+    }
+    u_ = other.u_;
+    s_ = other.s_;
+    cap_ = other.cap_;
+    other.s_ = other.buf_;
+    other.cap_ = inline_capacity;
+    other.clear();
+    return *this;
+}
+
+authority&
+authority::
+operator=(
+    authority_view const& a)
+{
+    copy(a);
+    return *this;
+}
+
+void
+authority::
+copy(
+    authority_view const& a)
+{
+    std::size_t const n = a.size();
+    if(n > cap_)
+    {
+        char* s = new char[n + 1];
+        detail::stats_allocate(n + 1);
+        if(s_ != buf_)
+        {
+            detail::stats_deallocate();
+            delete[] s_;
+        }
+        s_ = s;
+        cap_ = n;
+    }
+    // a may reference this buffer
+    if(n > 0)
+        std::memmove(s_, a.data(), n);
+    s_[n] = '\0';
+    u_ = a.u_;
+    u_.cs_ = s_;
+}
+
+//------------------------------------------------
+//
+// Observers
+//
+//------------------------------------------------
+
+pct_string_view
+authority::
+encoded_userinfo() const noexcept
+{
+    return authority_view(
+        *this).encoded_userinfo();
+}
+
+core::string_view
+authority::
+port() const noexcept
+{
+    auto s = u_.get(id_port);
+    if(s.empty())
+        return s;
+    BOOST_ASSERT(s.starts_with(':'));
+    return s.substr(1);
+}
+
+//------------------------------------------------
+//
+// Modifiers
+//
+//------------------------------------------------
+
+void
+authority::
+clear() noexcept
+{
+    // preserve capacity
+    u_ = {from::authority};
+    s_[0] = '\0';
+    u_.cs_ = s_;
+}
+
+// Replace [first, last) with n
+// uninitialized characters, and
+// return a pointer to them. When
+// the buffer is too small, it is
+// replaced by one of the exact
+// size needed.
+char*
+authority::
+resize(
+    int first,
+    int last,
+    std::size_t n)
+{
+    std::size_t const n0 =
+        u_.len(first, last);
+    std::size_t const pos =
+        u_.offset(last);
+    std::size_t const end = size();
+    if(n > n0)
+    {
+        std::size_t const d = n - n0;
+        if(d > BOOST_URL_MAX_SIZE - end)
+            detail::throw_length_error();
+        if(end + d > cap_)
+        {
+            char* s = new char[end + d + 1];
+            detail::stats_allocate(end + d + 1);
+            std::memcpy(s, s_,
+                u_.offset(first));
+            std::memcpy(s + pos + d,
+                s_ + pos, end - pos + 1);
+            if(s_ != buf_)
+            {
+                detail::stats_deallocate();
+                delete[] s_;
+            }
+            s_ = s;
+            cap_ = end + d;
+            u_.cs_ = s_;
+        }
+        else
+        {
+            std::memmove(s_ + pos + d,
+                s_ + pos, end - pos + 1);
+        }
+        u_.collapse(first, last, pos + d);
+        u_.adjust_right(last, id_end, d);
+    }
+    else if(n < n0)
+    {
+        std::size_t const d = n0 - n;
+        std::memmove(s_ + pos - d,
+            s_ + pos, end - pos + 1);
+        u_.collapse(first, last, pos - d);
+        u_.adjust_left(last, id_end, d);
+    }
+    return s_ + u_.offset(first);
+}
+
+char*
+authority::
+resize(
+    int id,
+    std::size_t n)
+{
+    return resize(id, id + 1, n);
+}
+
+//------------------------------------------------
+
+authority&
+authority::
+set_encoded_userinfo(
+    pct_string_view s)
+{
+    if(aliases(s, s_, size()))
+    {
+        std::string const t(s);
+        return set_encoded_userinfo(
+            make_pct_string_view_unsafe(
+                t.data(), t.size(),
+                s.decoded_size()));
+    }
+    encoding_opts opt;
+    auto const pos = s.find_first_of(':');
+    if(pos != core::string_view::npos)
+    {
+        // user:pass
+        auto const s0 = s.substr(0, pos);
+        auto const s1 = s.substr(pos + 1);
+        auto const n0 =
+            detail::re_encoded_size_unsafe(
+                s0, detail::user_chars, opt);
+        auto const n1 =
+            detail::re_encoded_size_unsafe(
+                s1, detail::password_chars, opt);
+        auto dest = resize(
+            id_user, id_host, n0 + n1 + 2);
+        u_.split(id_user, n0);
+        u_.decoded_[id_user] =
+            detail::re_encode_unsafe(
+                dest, dest + n0, s0,
+                detail::user_chars, opt);
+        *dest++ = ':';
+        u_.decoded_[id_pass] =
+            detail::re_encode_unsafe(
+                dest, dest + n1, s1,
+                detail::password_chars, opt);
+        *dest = '@';
+    }
+    else
+    {
+        // user
+        auto const n =
+            detail::re_encoded_size_unsafe(
+                s, detail::user_chars, opt);
+        auto dest = resize(
+            id_user, id_host, n + 1);
+        u_.split(id_user, n);
+        u_.decoded_[id_user] =
+            detail::re_encode_unsafe(
+                dest, dest + n, s,
+                detail::user_chars, opt);
+        u_.decoded_[id_pass] = 0;
+        *dest = '@';
+    }
+    return *this;
+}
+
+authority&
+authority::
+set_userinfo(
+    core::string_view s)
+{
+    if(aliases(s, s_, size()))
+        return set_userinfo(
+            std::string(s));
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::userinfo_chars, opt);
+    auto dest = resize(
+        id_user, id_host, n + 1);
+    encode_unsafe(dest, n, s,
+        detail::userinfo_chars, opt);
+    dest[n] = '@';
+    auto const pos = core::string_view(
+        dest, n).find_first_of(':');
+    if(pos != core::string_view::npos)
+    {
+        u_.split(id_user, pos);
+        auto const pos2 =
+            s.find_first_of(':');
+        u_.decoded_[id_user] = pos2;
+        u_.decoded_[id_pass] =
+            s.size() - pos2 - 1;
+    }
+    else
+    {
+        u_.split(id_user, n);
+        u_.decoded_[id_user] = s.size();
+        u_.decoded_[id_pass] = 0;
+    }
+    return *this;
+}
+
+authority&
+authority::
+remove_userinfo() noexcept
+{
+    // shrinking never allocates
+    resize(id_user, id_host, 0);
+    u_.decoded_[id_user] = 0;
+    u_.decoded_[id_pass] = 0;
+    return *this;
+}
+
+//------------------------------------------------
+
+authority&
+authority::
+set_host(
+    core::string_view s)
+{
+    if(aliases(s, s_, size()))
+        return set_host(
+            std::string(s));
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        auto rv = parse_ipv6_address(
+            s.substr(1, s.size() - 2));
+        if(rv)
+            return set_host_ipv6(*rv);
+        if(grammar::parse(
+            s.substr(1, s.size() - 2),
+                detail::ipvfuture_rule))
+        {
+            set_host_ipvfuture(
+                s.substr(1, s.size() - 2));
+            return *this;
+        }
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        auto rv = parse_ipv4_address(s);
+        if(rv)
+            return set_host_ipv4(*rv);
+    }
+
+    // reg-name
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::host_chars, opt);
+    auto dest = resize(id_host, n);
+    encode_unsafe(dest, n, s,
+        detail::host_chars, opt);
+    u_.decoded_[id_host] = s.size();
+    u_.host_type_ =
+        urls::host_type::name;
+    u_.host_norm_ = false;
+    return *this;
+}
+
+authority&
+authority::
+set_encoded_host(
+    pct_string_view s)
+{
+    if(aliases(s, s_, size()))
+    {
+        std::string const t(s);
+        return set_encoded_host(
+            make_pct_string_view_unsafe(
+                t.data(), t.size(),
+                s.decoded_size()));
+    }
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        auto rv = parse_ipv6_address(
+            s.substr(1, s.size() - 2));
+        if(rv)
+            return set_host_ipv6(*rv);
+        if(grammar::parse(
+            s.substr(1, s.size() - 2),
+                detail::ipvfuture_rule))
+        {
+            set_host_ipvfuture(
+                s.substr(1, s.size() - 2));
+            return *this;
+        }
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        auto rv = parse_ipv4_address(s);
+        if(rv)
+            return set_host_ipv4(*rv);
+    }
+
+    // reg-name
+    encoding_opts opt;
+    auto const n = detail::re_encoded_size_unsafe(
+        s, detail::host_chars, opt);
+    auto dest = resize(id_host, n);
+    u_.decoded_[id_host] =
+        detail::re_encode_unsafe(
+            dest, dest + n, s,
+            detail::host_chars, opt);
+    BOOST_ASSERT(u_.decoded_[id_host] ==
+        s.decoded_size());
+    u_.host_type_ =
+        urls::host_type::name;
+    u_.host_norm_ = false;
+    return *this;
+}
+
+authority&
+authority::
+set_host_ipv4(
+    ipv4_address const& addr)
+{
+    char buf[urls::ipv4_address::max_str_len];
+    auto s = addr.to_buffer(buf, sizeof(buf));
+    auto dest = resize(id_host, s.size());
+    std::memcpy(dest, s.data(), s.size());
+    u_.decoded_[id_host] = s.size();
+    u_.host_type_ = urls::host_type::ipv4;
+    u_.host_norm_ = true;
+    auto bytes = addr.to_bytes();
+    std::memcpy(
+        u_.ip_addr_,
+        bytes.data(),
+        bytes.size());
+    return *this;
+}
+
+authority&
+authority::
+set_host_ipv6(
+    ipv6_address const& addr)
+{
+    char buf[2 +
+        urls::ipv6_address::max_str_len];
+    auto s = addr.to_buffer(
+        buf + 1, sizeof(buf) - 2);
+    buf[0] = '[';
+    buf[s.size() + 1] = ']';
+    auto const n = s.size() + 2;
+    auto dest = resize(id_host, n);
+    std::memcpy(dest, buf, n);
+    u_.decoded_[id_host] = n;
+    u_.host_type_ = urls::host_type::ipv6;
+    u_.host_norm_ = false;
+    auto bytes = addr.to_bytes();
+    std::memcpy(
+        u_.ip_addr_,
+        bytes.data(),
+        bytes.size());
+    return *this;
+}
+
+void
+authority::
+set_host_ipvfuture(
+    core::string_view s)
+{
+    auto dest = resize(
+        id_host, s.size() + 2);
+    *dest++ = '[';
+    dest += s.copy(dest, s.size());
+    *dest = ']';
+    u_.decoded_[id_host] = s.size() + 2;
+    u_.host_type_ =
+        urls::host_type::ipvfuture;
+    u_.host_norm_ = false;
+}
+
+//------------------------------------------------
+
+authority&
+authority::
+set_port(
+    core::string_view s)
+{
+    if(aliases(s, s_, size()))
+        return set_port(
+            std::string(s));
+    auto t = grammar::parse(s,
+        detail::port_rule{}
+            ).value(BOOST_URL_POS);
+    auto dest = resize(
+        id_port, t.str.size() + 1);
+    *dest++ = ':';
+    std::memcpy(dest,
+        t.str.data(), t.str.size());
+    u_.port_number_ = t.has_number ?
+        t.number : 0;
+    return *this;
+}
+
+authority&
+authority::
+set_port_number(
+    std::uint16_t n)
+{
+    auto s = detail::make_printed(n);
+    auto dest = resize(id_port,
+        s.string().size() + 1);
+    *dest++ = ':';
+    std::memcpy(dest,
+        s.string().data(),
+        s.string().size());
+    u_.port_number_ = n;
+    return *this;
+}
+
+authority&
+authority::
+remove_port() noexcept
+{
+    // shrinking never allocates
+    resize(id_port, 0);
+    u_.port_number_ = 0;
+    return *this;
+}
+
+} // urls
+} // boost
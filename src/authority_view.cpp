@@ -379,9 +379,17 @@ compare(const authority_view& other) const noexcept
         }
     }
 
-    comp = detail::ci_compare_encoded(
-        encoded_host(),
-        other.encoded_host());
+    // hosts in normal form
+    // compare as they are
+    if( u_.host_norm_ &&
+        other.u_.host_norm_)
+        comp = detail::compare(
+            encoded_host(),
+            other.encoded_host());
+    else
+        comp = detail::ci_compare_encoded(
+            encoded_host(),
+            other.encoded_host());
     if ( comp != 0 )
         return comp;
 
@@ -0,0 +1,350 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_CACHE_KEY_BUILDER_IPP
+#define BOOST_URL_IMPL_CACHE_KEY_BUILDER_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/cache_key_builder.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include "detail/decode.hpp"
+#include "detail/normalize.hpp"
+#include "rfc/detail/charsets.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// escapes of the characters which delimit
+// params are kept, and '+' may be a space
+constexpr auto key_chars =
+    detail::param_key_chars - '+';
+
+constexpr auto value_chars =
+    detail::param_value_chars - '=' - '+';
+
+// Copy s to dest, decoding the escapes of
+// allowed characters and uppercasing the
+// hexadecimal digits of the others, as
+// url_base::normalize_octets_impl does
+template<class CharSet>
+char*
+put_normalized(
+    char* dest,
+    core::string_view s,
+    CharSet const& allowed) noexcept
+{
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    while(it != end)
+    {
+        char const* p = detail::find_escape(
+            it, end, false);
+        std::memcpy(dest, it, p - it);
+        dest += p - it;
+        it = p;
+        if(it == end)
+            break;
+        BOOST_ASSERT(end - it >= 3);
+        char const c = detail::decode_one(it + 1);
+        if(allowed(c))
+        {
+            *dest++ = c;
+        }
+        else
+        {
+            *dest++ = '%';
+            *dest++ = grammar::to_upper(it[1]);
+            *dest++ = grammar::to_upper(it[2]);
+        }
+        it += 3;
+    }
+    return dest;
+}
+
+char*
+put(char* dest, core::string_view s) noexcept
+{
+    std::memcpy(dest, s.data(), s.size());
+    return dest + s.size();
+}
+
+struct query_param
+{
+    char const* p;
+    std::size_t n;
+    std::size_t nk;
+    std::size_t dk;
+};
+
+} // (anon)
+
+cache_key_builder&
+cache_key_builder::
+ignore_param(core::string_view key)
+{
+    ignored_.insert(key);
+    return *this;
+}
+
+cache_key_builder&
+cache_key_builder::
+ignore_param_prefix(core::string_view prefix)
+{
+    ignored_.insert_prefix(prefix);
+    return *this;
+}
+
+//------------------------------------------------
+
+// Write the key into dest, which has room
+// for u.size() characters, and return its
+// size. Every part of the key is at most
+// as long as the part of the URL it is
+// written from.
+std::size_t
+cache_key_builder::
+write_key(
+    url_view_base const& u,
+    char* const dest) const
+{
+    detail::url_impl const& src = *u.pi_;
+    char* out = dest;
+
+    // scheme
+    {
+        char* const p = out;
+        out = put(out, src.get(id_scheme));
+        grammar::detail::to_lower_in_place(
+            p, out, false);
+    }
+
+    // userinfo
+    out = put_normalized(out,
+        src.get(id_user), detail::user_chars);
+    out = put_normalized(out,
+        src.get(id_pass), detail::password_chars);
+
+    // host
+    if(src.host_norm_)
+    {
+        out = put(out, src.get(id_host));
+    }
+    else
+    {
+        char* const p = out;
+        if(src.host_type_ == host_type::name)
+            out = put_normalized(out,
+                src.get(id_host),
+                detail::reg_name_chars);
+        else
+            out = put(out, src.get(id_host));
+        grammar::detail::to_lower_in_place(
+            p, out, true);
+    }
+
+    // port
+    {
+        bool keep = src.len(id_port) != 0;
+        if( keep &&
+            remove_default_port_)
+        {
+            std::uint16_t const port =
+                default_port(src.scheme_);
+            keep =
+                src.len(id_port) > 1 &&
+                (port == 0 ||
+                    src.port_number_ != port);
+        }
+        if(keep)
+            out = put(out, src.get(id_port));
+    }
+
+    // path, with the dot segments removed
+    // in place, as url_base::normalize_path
+    // does for URLs with an authority
+    {
+        char* const p = out;
+        out = put_normalized(out,
+            src.get(id_path),
+            detail::segment_chars);
+        std::size_t skip = 0;
+        core::string_view const path(p, out - p);
+        if( src.len(id_user) == 0 &&
+            path.starts_with("/./"))
+        {
+            // keep a "/." which stops the
+            // path from starting with "//"
+            skip = 2;
+            while(path.substr(skip, 3).starts_with("/./"))
+                skip += 2;
+            if(! path.substr(skip).starts_with("//"))
+                skip = 0;
+            else
+                skip = 2;
+        }
+        out = p + skip + detail::remove_dot_segments(
+            p + skip, out, path.substr(skip));
+    }
+
+    // query, without the ignored params
+    if(src.len(id_query) != 0)
+    {
+        char const* it =
+            src.cs_ + src.offset(id_query) + 1;
+        char const* const end =
+            src.cs_ + src.offset(id_frag);
+
+        // most queries fit, so
+        // nothing is allocated
+        query_param small[16];
+        std::vector<query_param> large;
+        query_param* first = small;
+        std::size_t n = 0;
+        for(;;)
+        {
+            char const* amp = static_cast<
+                char const*>(std::memchr(
+                    it, '&', end - it));
+            if(! amp)
+                amp = end;
+            char const* eq = static_cast<
+                char const*>(std::memchr(
+                    it, '=', amp - it));
+            core::string_view const key(
+                it, (eq ? eq : amp) - it);
+            std::size_t const dk =
+                detail::decode_bytes_unsafe(key);
+            if(! ignored_.match_encoded(
+                make_pct_string_view_unsafe(
+                    key.data(), key.size(), dk)))
+            {
+                query_param const pr{ it,
+                    static_cast<std::size_t>(amp - it),
+                    key.size(), dk };
+                if(n < 16)
+                {
+                    small[n] = pr;
+                }
+                else
+                {
+                    if(n == 16)
+                        large.assign(small, small + 16);
+                    large.push_back(pr);
+                    first = large.data();
+                }
+                ++n;
+            }
+            if(amp == end)
+                break;
+            it = amp + 1;
+        }
+
+        if( sort_params_ &&
+            n > 1)
+        {
+            auto const less = [](
+                query_param const& p0, query_param const& p1)
+            {
+                return detail::make_decode_view(
+                    core::string_view(p0.p, p0.nk),
+                    p0.dk, encoding_opts()).compare(
+                detail::make_decode_view(
+                    core::string_view(p1.p, p1.nk),
+                    p1.dk, encoding_opts())) < 0;
+            };
+            if(! std::is_sorted(first, first + n, less))
+                std::stable_sort(first, first + n, less);
+        }
+
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            query_param const& pr = first[i];
+            *out++ = i == 0 ? '?' : '&';
+            out = put_normalized(out,
+                core::string_view(pr.p, pr.nk),
+                key_chars);
+            if(pr.nk < pr.n)
+            {
+                *out++ = '=';
+                out = put_normalized(out,
+                    core::string_view(
+                        pr.p + pr.nk + 1,
+                        pr.n - pr.nk - 1),
+                    value_chars);
+            }
+        }
+    }
+
+    // fragment
+    if(keep_fragment_)
+        out = put_normalized(out,
+            src.get(id_frag),
+            detail::fragment_chars);
+
+    BOOST_ASSERT(static_cast<std::size_t>(
+        out - dest) <= u.size());
+    return out - dest;
+}
+
+void
+cache_key_builder::
+key_impl(
+    url_view_base const& u,
+    string_token::arg& t) const
+{
+    // the key is written before the token
+    // prepares its storage, which may be
+    // the storage u references
+    char small[512];
+    std::unique_ptr<char[]> large;
+    char* buf = small;
+    if(u.size() > sizeof(small))
+    {
+        large.reset(new char[u.size()]);
+        buf = large.get();
+    }
+    std::size_t const n = write_key(u, buf);
+    char* dest = t.prepare(n);
+    std::memcpy(dest, buf, n);
+}
+
+std::uint64_t
+cache_key_builder::
+hash(
+    url_view_base const& u,
+    std::uint64_t seed) const
+{
+    char small[512];
+    std::unique_ptr<char[]> large;
+    char* buf = small;
+    if(u.size() > sizeof(small))
+    {
+        large.reset(new char[u.size()]);
+        buf = large.get();
+    }
+    std::size_t const n = write_key(u, buf);
+    detail::mum_hasher<1> h(seed);
+    h.put(core::string_view(buf, n));
+    return h.digest();
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,333 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_CANONICAL_REQUEST_IPP
+#define BOOST_URL_IMPL_CANONICAL_REQUEST_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/canonical_request.hpp>
+#include <boost/url/encode.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include "detail/decode.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Collects the canonical characters and
+// calls the sink once for each block
+class canonical_writer
+{
+    detail::canonical_write_fn write_;
+    void* sink_;
+    std::size_t n_ = 0;
+    char buf_[512];
+
+public:
+    canonical_writer(
+        detail::canonical_write_fn write,
+        void* sink) noexcept
+        : write_(write)
+        , sink_(sink)
+    {
+    }
+
+    void
+    flush()
+    {
+        if(n_ != 0)
+            write_(sink_, buf_, n_);
+        n_ = 0;
+    }
+
+    void
+    put(core::string_view s)
+    {
+        while(! s.empty())
+        {
+            if(n_ == sizeof(buf_))
+                flush();
+            std::size_t const n = (std::min)(
+                s.size(), sizeof(buf_) - n_);
+            std::memcpy(buf_ + n_, s.data(), n);
+            n_ += n;
+            s.remove_prefix(n);
+        }
+    }
+
+    // Decode s and encode it again with
+    // only the unreserved characters
+    void
+    put_encoded(core::string_view s)
+    {
+        // the decoded characters, in slices
+        // which fit in the buffer once encoded
+        char d[sizeof(buf_) / 3];
+        std::size_t dn = 0;
+        auto const emit = [this, &d, &dn]
+        {
+            if(sizeof(buf_) - n_ < 3 * dn)
+                flush();
+            n_ += encode_unsafe(buf_ + n_,
+                sizeof(buf_) - n_,
+                core::string_view(d, dn),
+                unreserved_chars, {});
+            dn = 0;
+        };
+        char const* it = s.data();
+        char const* const end = it + s.size();
+        while(it != end)
+        {
+            if(*it != '%')
+            {
+                d[dn++] = *it++;
+            }
+            else
+            {
+                BOOST_ASSERT(end - it >= 3);
+                d[dn++] = detail::decode_one(it + 1);
+                it += 3;
+            }
+            if(dn == sizeof(d))
+                emit();
+        }
+        if(dn != 0)
+            emit();
+    }
+};
+
+// Produces the bytes of an encoded string
+// decoded and encoded again, one at a time,
+// so that strings are compared in the order
+// of their canonical forms without writing
+// them anywhere
+class canonical_reader
+{
+    char const* it_;
+    char const* end_;
+    char hex_[2];
+    unsigned pending_ = 0;
+
+public:
+    explicit
+    canonical_reader(
+        core::string_view s) noexcept
+        : it_(s.data())
+        , end_(s.data() + s.size())
+    {
+    }
+
+    // the next byte, or -1 at the end
+    int
+    next() noexcept
+    {
+        if(pending_ != 0)
+            return static_cast<unsigned char>(
+                hex_[2 - pending_--]);
+        if(it_ == end_)
+            return -1;
+        char c = *it_;
+        if(c == '%')
+        {
+            c = detail::decode_one(it_ + 1);
+            it_ += 3;
+        }
+        else
+        {
+            ++it_;
+        }
+        if(unreserved_chars(c))
+            return static_cast<unsigned char>(c);
+        unsigned char const b =
+            static_cast<unsigned char>(c);
+        hex_[0] = "0123456789ABCDEF"[b >> 4];
+        hex_[1] = "0123456789ABCDEF"[b & 0xf];
+        pending_ = 2;
+        return '%';
+    }
+};
+
+int
+canonical_compare(
+    core::string_view s0,
+    core::string_view s1) noexcept
+{
+    canonical_reader r0(s0);
+    canonical_reader r1(s1);
+    for(;;)
+    {
+        int const c0 = r0.next();
+        int const c1 = r1.next();
+        if(c0 != c1)
+            return c0 < c1 ? -1 : 1;
+        if(c0 < 0)
+            return 0;
+    }
+}
+
+struct query_param
+{
+    core::string_view key;
+    core::string_view value;
+};
+
+} // (anon)
+
+namespace detail {
+
+void
+write_canonical_uri(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink)
+{
+    canonical_writer w(write, sink);
+    core::string_view p = u.encoded_path();
+    if(! p.starts_with('/'))
+        w.put("/");
+    for(;;)
+    {
+        auto const i = p.find('/');
+        w.put_encoded(p.substr(0, i));
+        if(i == core::string_view::npos)
+            break;
+        w.put("/");
+        p.remove_prefix(i + 1);
+    }
+    w.flush();
+}
+
+void
+write_canonical_query(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink)
+{
+    if(! u.has_query())
+        return;
+    core::string_view q = u.encoded_query();
+
+    // most queries fit, so
+    // nothing is allocated
+    query_param small[16];
+    std::vector<query_param> large;
+    query_param* first = small;
+    std::size_t n = 0;
+    for(;;)
+    {
+        auto const i = q.find('&');
+        core::string_view const s = q.substr(0, i);
+        if(! s.empty())
+        {
+            auto const eq = s.find('=');
+            query_param p;
+            p.key = s.substr(0, eq);
+            if(eq != core::string_view::npos)
+                p.value = s.substr(eq + 1);
+            if(n < 16)
+            {
+                small[n] = p;
+            }
+            else
+            {
+                if(n == 16)
+                    large.assign(small, small + 16);
+                large.push_back(p);
+                first = large.data();
+            }
+            ++n;
+        }
+        if(i == core::string_view::npos)
+            break;
+        q.remove_prefix(i + 1);
+    }
+
+    auto const less = [](
+        query_param const& p0,
+        query_param const& p1) noexcept
+    {
+        int const r = canonical_compare(
+            p0.key, p1.key);
+        if(r != 0)
+            return r < 0;
+        return canonical_compare(
+            p0.value, p1.value) < 0;
+    };
+    if(! std::is_sorted(first, first + n, less))
+        std::sort(first, first + n, less);
+
+    canonical_writer w(write, sink);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(i != 0)
+            w.put("&");
+        w.put_encoded(first[i].key);
+        w.put("=");
+        w.put_encoded(first[i].value);
+    }
+    w.flush();
+}
+
+void
+write_canonical_host(
+    url_view_base const& u,
+    canonical_write_fn write,
+    void* sink)
+{
+    canonical_writer w(write, sink);
+    core::string_view s = u.encoded_host();
+    char buf[64];
+    // the characters of an escape
+    // which are left to copy
+    unsigned skip = 0;
+    while(! s.empty())
+    {
+        std::size_t const n = (std::min)(
+            s.size(), sizeof(buf));
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            char const c = s[i];
+            if(skip != 0)
+            {
+                buf[i] = c;
+                --skip;
+            }
+            else if(c == '%')
+            {
+                buf[i] = c;
+                skip = 2;
+            }
+            else
+            {
+                buf[i] = grammar::to_lower(c);
+            }
+        }
+        w.put(core::string_view(buf, n));
+        s.remove_prefix(n);
+    }
+    if(! u.port().empty())
+    {
+        w.put(":");
+        w.put(u.port());
+    }
+    w.flush();
+}
+
+} // detail
+
+} // urls
+} // boost
+
+#endif
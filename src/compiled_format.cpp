@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/compiled_format.hpp>
+#include <boost/url/detail/replacement_field_rule.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/unsigned_rule.hpp>
+#include "detail/pattern.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+// the components are the
+// pieces of a compiled_format
+class compiled_format::source
+    : public detail::pattern_source
+{
+    compiled_format const& f_;
+
+    template<class Context>
+    detail::format_arg
+    get_arg(
+        piece const& pc,
+        detail::format_parse_context& pctx,
+        Context& ctx) const
+    {
+        switch(pc.kind)
+        {
+        case piece::indexed:
+            return ctx.arg(pc.n);
+        case piece::named:
+            return ctx.arg(core::string_view(
+                f_.s_.data() + pc.pos, pc.size));
+        default:
+        case piece::automatic:
+            return ctx.arg(pctx.next_arg_id());
+        }
+    }
+
+    detail::format_parse_context
+    context(
+        detail::format_parse_context& pctx) const noexcept
+    {
+        return {
+            f_.s_.data(),
+            f_.s_.data() + f_.s_.size(),
+            pctx.next_arg_id() };
+    }
+
+public:
+    explicit
+    source(
+        compiled_format const& f) noexcept
+        : f_(f)
+    {
+    }
+
+    std::size_t
+    measure(
+        int id,
+        grammar::lut_chars const& cs,
+        detail::format_parse_context& pctx,
+        detail::measure_context& mctx) const override
+    {
+        auto const& pt = f_.parts_[id + 1];
+        pctx = context(pctx);
+        for(auto i = pt.first; i != pt.last; ++i)
+        {
+            auto const& pc = f_.v_[i];
+            if(pc.kind == piece::literal)
+            {
+                mctx.advance_to(mctx.out() + pc.n);
+                continue;
+            }
+            pctx.advance_to(f_.s_.data() + pc.spec);
+            get_arg(pc, pctx, mctx).measure(
+                pctx, mctx, cs);
+        }
+        return mctx.out();
+    }
+
+    char*
+    format(
+        int id,
+        grammar::lut_chars const& cs,
+        detail::format_parse_context& pctx,
+        detail::format_context& fctx) const override
+    {
+        auto const& pt = f_.parts_[id + 1];
+        pctx = context(pctx);
+        for(auto i = pt.first; i != pt.last; ++i)
+        {
+            auto const& pc = f_.v_[i];
+            if(pc.kind == piece::literal)
+            {
+                char* o = fctx.out();
+                char const* it = f_.s_.data() + pc.pos;
+                if(pc.n == pc.size)
+                {
+                    // nothing to escape
+                    std::memcpy(o, it, pc.size);
+                    o += pc.size;
+                }
+                else
+                {
+                    for(auto const end = it + pc.size;
+                            it != end; ++it)
+                        detail::encode_one(o, *it, cs);
+                }
+                fctx.advance_to(o);
+                continue;
+            }
+            pctx.advance_to(f_.s_.data() + pc.spec);
+            get_arg(pc, pctx, fctx).format(
+                pctx, fctx, cs);
+        }
+        return fctx.out();
+    }
+};
+
+compiled_format::
+compiled_format(
+    core::string_view fmt)
+    : s_(fmt)
+{
+    using parts = detail::parts_base;
+    auto const p = detail::parse_pattern(
+        s_).value(BOOST_URL_POS);
+    has_authority_ = p.has_authority;
+    has_user_ = p.has_user;
+    has_pass_ = p.has_pass;
+    has_port_ = p.has_port;
+    has_query_ = p.has_query;
+    has_frag_ = p.has_frag;
+
+    compile(parts::id_scheme,
+        p.scheme, grammar::alpha_chars);
+    compile(parts::id_user,
+        p.user, detail::user_chars);
+    compile(parts::id_pass,
+        p.pass, detail::password_chars);
+    if(p.host.starts_with('['))
+    {
+        // the pieces are inside the brackets
+        compile(parts::id_host,
+            p.host.substr(1, p.host.size() - 2),
+            detail::lhost_chars);
+        auto& pt = parts_[parts::id_host + 1];
+        --pt.pos;
+        pt.size += 2;
+    }
+    else
+    {
+        compile(parts::id_host,
+            p.host, detail::host_chars);
+    }
+    compile(parts::id_port,
+        p.port, grammar::digit_chars);
+    compile(parts::id_path,
+        p.path, detail::path_chars);
+    compile(parts::id_query,
+        p.query, detail::query_chars);
+    compile(parts::id_frag,
+        p.frag, detail::fragment_chars);
+}
+
+void
+compiled_format::
+compile(
+    int id,
+    core::string_view s,
+    grammar::lut_chars const& cs)
+{
+    auto& pt = parts_[id + 1];
+    pt.pos = s.data() ?
+        static_cast<std::size_t>(
+            s.data() - s_.data()) : 0;
+    pt.size = s.size();
+    pt.first = v_.size();
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        // literal prefix
+        auto it1 = it;
+        std::size_t n = 0;
+        while(
+            it1 != end &&
+            *it1 != '{')
+        {
+            n += detail::measure_one(*it1, cs);
+            ++it1;
+        }
+        if(it1 != it)
+        {
+            piece pc;
+            pc.pos = it - s_.data();
+            pc.size = it1 - it;
+            pc.n = n;
+            v_.push_back(pc);
+        }
+        if(it1 == end)
+            break;
+
+        // {id} or {id:specs}
+        it = it1;
+        auto rv = detail::replacement_field_rule.parse(
+            it, end);
+        BOOST_ASSERT(rv);
+        (void)rv;
+        auto const id0 = it1 + 1;
+        auto id1 = id0;
+        while(
+            *id1 != ':' &&
+            *id1 != '}')
+            ++id1;
+        piece pc;
+        pc.pos = id0 - s_.data();
+        pc.size = id1 - id0;
+        if(*id1 == ':')
+            ++id1;
+        pc.spec = id1 - s_.data();
+        core::string_view const name(
+            id0, pc.size);
+        auto idv = grammar::parse(name,
+            grammar::unsigned_rule<std::size_t>{});
+        if(idv)
+        {
+            pc.kind = piece::indexed;
+            pc.n = *idv;
+        }
+        else if(! name.empty())
+        {
+            pc.kind = piece::named;
+        }
+        else
+        {
+            pc.kind = piece::automatic;
+        }
+        v_.push_back(pc);
+    }
+    pt.last = v_.size();
+}
+
+void
+compiled_format::
+vformat_to(
+    url_base& u,
+    detail::format_args args) const
+{
+    using parts = detail::parts_base;
+    auto const get = [this](int id)
+    {
+        auto const& pt = parts_[id + 1];
+        return core::string_view(
+            s_.data() + pt.pos, pt.size);
+    };
+    detail::pattern p;
+    p.scheme = get(parts::id_scheme);
+    p.user = get(parts::id_user);
+    p.pass = get(parts::id_pass);
+    p.host = get(parts::id_host);
+    p.port = get(parts::id_port);
+    p.path = get(parts::id_path);
+    p.query = get(parts::id_query);
+    p.frag = get(parts::id_frag);
+    p.has_authority = has_authority_;
+    p.has_user = has_user_;
+    p.has_pass = has_pass_;
+    p.has_port = has_port_;
+    p.has_query = has_query_;
+    p.has_frag = has_frag_;
+    p.apply(u, args, source(*this));
+}
+
+} // urls
+} // boost
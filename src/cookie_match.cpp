@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/cookie_match.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+core::string_view
+trim_domain(core::string_view d) noexcept
+{
+    if(d.starts_with('.'))
+        d.remove_prefix(1);
+    return d;
+}
+
+// the path compared by path-match
+core::string_view
+request_path(
+    url_view_base const& u) noexcept
+{
+    core::string_view const p =
+        u.encoded_path();
+    if(! p.starts_with('/'))
+        return "/";
+    return p;
+}
+
+bool
+path_match_impl(
+    core::string_view p,
+    core::string_view path) noexcept
+{
+    if(! p.starts_with(path))
+        return false;
+    return
+        p.size() == path.size() ||
+        path.ends_with('/') ||
+        p[path.size()] == '/';
+}
+
+// returns the size of the domain
+// if it matches, or zero
+std::size_t
+domain_match_size(
+    url_view_base const& u,
+    core::string_view domain) noexcept
+{
+    domain = trim_domain(domain);
+    if(domain.empty())
+        return 0;
+    core::string_view const host =
+        u.encoded_host_address();
+    if(host.size() == domain.size())
+        return grammar::ci_is_equal(
+            host, domain) ? domain.size() : 0;
+    if( host.size() < domain.size() ||
+        u.host_type() != host_type::name)
+        return 0;
+    auto const i =
+        host.size() - domain.size();
+    if( host[i - 1] != '.' ||
+        ! grammar::ci_is_equal(
+            host.substr(i), domain))
+        return 0;
+    return domain.size();
+}
+
+} // (anon)
+
+bool
+domain_match(
+    url_view_base const& u,
+    core::string_view domain) noexcept
+{
+    return domain_match_size(
+        u, domain) != 0;
+}
+
+bool
+domain_match(
+    url_view_base const& u,
+    core::string_view domain,
+    public_suffix_list_view psl) noexcept
+{
+    auto const n =
+        domain_match_size(u, domain);
+    if(n == 0)
+        return false;
+    core::string_view const host =
+        u.encoded_host_address();
+    if( n == host.size() ||
+        u.host_type() != host_type::name)
+        return true;
+    // the domain is a suffix of the host,
+    // so it is a public suffix when it is
+    // no longer than the host's
+    return n > psl.public_suffix(
+        u.encoded_host_address()).size();
+}
+
+bool
+path_match(
+    url_view_base const& u,
+    core::string_view path) noexcept
+{
+    return path_match_impl(
+        request_path(u), path);
+}
+
+core::string_view
+default_cookie_path(
+    url_view_base const& u) noexcept
+{
+    core::string_view const p =
+        u.encoded_path();
+    if(! p.starts_with('/'))
+        return "/";
+    auto const i = p.rfind('/');
+    if(i == 0)
+        return "/";
+    return p.substr(0, i);
+}
+
+//------------------------------------------------
+
+std::size_t
+cookie_index::
+find(core::string_view d) const noexcept
+{
+    if(table_.empty())
+        return 0;
+    auto const h = grammar::ci_digest(d);
+    auto const mask = table_.size() - 1;
+    for(auto i = h & mask;
+        table_[i] != 0;
+        i = (i + 1) & mask)
+    {
+        auto const& dm = domains_[table_[i] - 1];
+        if( dm.hash == h &&
+            grammar::ci_is_equal(
+                core::string_view(
+                    keys_.data() + dm.key,
+                    dm.size), d))
+            return table_[i];
+    }
+    return 0;
+}
+
+void
+cookie_index::
+rehash(std::size_t n)
+{
+    std::size_t slots = 16;
+    while(slots < 2 * n)
+        slots *= 2;
+    std::vector<std::size_t> table(slots);
+    auto const mask = slots - 1;
+    for(std::size_t j = 0; j < domains_.size(); ++j)
+    {
+        auto i = domains_[j].hash & mask;
+        while(table[i] != 0)
+            i = (i + 1) & mask;
+        table[i] = j + 1;
+    }
+    table_.swap(table);
+}
+
+void
+cookie_index::
+insert(
+    std::size_t id,
+    core::string_view d,
+    core::string_view path,
+    bool host_only)
+{
+    d = trim_domain(d);
+    if(d.empty())
+        return;
+    auto k = find(d);
+
+    // allocate before anything
+    // changes, for the strong
+    // guarantee
+    cookies_.reserve(cookies_.size() + 1);
+    if(k == 0)
+    {
+        domains_.reserve(domains_.size() + 1);
+        keys_.reserve(
+            keys_.size() + d.size() + path.size());
+        if(2 * (domains_.size() + 1) > table_.size())
+            rehash(domains_.size() + 1);
+    }
+    else
+    {
+        keys_.reserve(keys_.size() + path.size());
+    }
+
+    // nothing below throws
+    if(k == 0)
+    {
+        domain dm;
+        dm.hash = grammar::ci_digest(d);
+        dm.key = keys_.size();
+        dm.size = d.size();
+        keys_.append(d.data(), d.size());
+        domains_.push_back(dm);
+        k = domains_.size();
+        auto const mask = table_.size() - 1;
+        auto i = dm.hash & mask;
+        while(table_[i] != 0)
+            i = (i + 1) & mask;
+        table_[i] = k;
+    }
+    cookie ck;
+    ck.id = id;
+    ck.path = keys_.size();
+    ck.path_size = path.size();
+    ck.host_only = host_only;
+    keys_.append(path.data(), path.size());
+    cookies_.push_back(ck);
+    auto& dm = domains_[k - 1];
+    if(dm.last != 0)
+        cookies_[dm.last - 1].next = cookies_.size();
+    else
+        dm.first = cookies_.size();
+    dm.last = cookies_.size();
+    ++size_;
+}
+
+std::size_t
+cookie_index::
+erase(
+    std::size_t id,
+    core::string_view d) noexcept
+{
+    auto const k = find(trim_domain(d));
+    if(k == 0)
+        return 0;
+    // unlink the entries, whose
+    // storage is not reused
+    auto& dm = domains_[k - 1];
+    std::size_t n = 0;
+    std::size_t prev = 0;
+    auto i = dm.first;
+    while(i != 0)
+    {
+        auto const next = cookies_[i - 1].next;
+        if(cookies_[i - 1].id != id)
+        {
+            prev = i;
+            i = next;
+            continue;
+        }
+        if(prev != 0)
+            cookies_[prev - 1].next = next;
+        else
+            dm.first = next;
+        if(dm.last == i)
+            dm.last = prev;
+        ++n;
+        i = next;
+    }
+    size_ -= n;
+    return n;
+}
+
+std::size_t
+cookie_index::
+match(
+    url_view_base const& u,
+    std::vector<std::size_t>& ids) const
+{
+    if(size_ == 0)
+        return 0;
+    core::string_view const host =
+        u.encoded_host_address();
+    core::string_view const p =
+        request_path(u);
+    bool const name =
+        u.host_type() == host_type::name;
+    std::size_t n = 0;
+    core::string_view d = host;
+    while(! d.empty())
+    {
+        auto const k = find(d);
+        if(k != 0)
+        {
+            bool const exact =
+                d.size() == host.size();
+            for(auto i = domains_[k - 1].first;
+                i != 0; i = cookies_[i - 1].next)
+            {
+                auto const& ck = cookies_[i - 1];
+                if(ck.host_only && ! exact)
+                    continue;
+                if(! path_match_impl(p,
+                    core::string_view(
+                        keys_.data() + ck.path,
+                        ck.path_size)))
+                    continue;
+                ids.push_back(ck.id);
+                ++n;
+            }
+        }
+        // only names have
+        // parent domains
+        if(! name)
+            break;
+        auto const dot = d.find('.');
+        if(dot == core::string_view::npos)
+            break;
+        d.remove_prefix(dot + 1);
+    }
+    return n;
+}
+
+} // urls
+} // boost
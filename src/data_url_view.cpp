@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/data_url_view.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/parse.hpp>
+#include "detail/base64.hpp"
+#include "detail/decode.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+pct_string_view
+data_url_view::
+slice(
+    std::size_t first,
+    std::size_t last) const noexcept
+{
+    core::string_view const s =
+        u_.buffer().substr(
+            first, last - first);
+    std::size_t n = 0;
+    for(char c : s)
+        n += c == '%';
+    return make_pct_string_view_unsafe(
+        s.data(), s.size(), s.size() - 2 * n);
+}
+
+system::result<std::size_t>
+data_url_view::
+decode(
+    char* dest,
+    std::size_t size) const noexcept
+{
+    core::string_view const s =
+        encoded_data();
+    if(base64_)
+        return detail::decode_base64(
+            dest, size, s);
+    // escapes only make the
+    // data shorter
+    if( s.size() > size &&
+        detail::decode_bytes_unsafe(s) > size)
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    return detail::decode_unsafe(
+        dest, dest + size, s);
+}
+
+//------------------------------------------------
+
+system::result<data_url_view>
+parse_data_url(
+    core::string_view s) noexcept
+{
+    auto rv = parse_uri(s);
+    if(! rv)
+        return rv.error();
+    if( ! grammar::ci_is_equal(
+            rv->scheme(), "data") ||
+        rv->has_authority())
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+
+    data_url_view d;
+    d.u_ = *rv;
+    core::string_view const path =
+        d.u_.encoded_path();
+    char const* const first = s.data();
+    char const* const p = path.data();
+    char const* const comma = static_cast<
+        char const*>(std::memchr(
+            p, ',', path.size()));
+    if(! comma)
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+
+    // the base64 flag ends the header
+    core::string_view header(
+        p, comma - p);
+    core::string_view const b64 = ";base64";
+    if( header.size() >= b64.size() &&
+        grammar::ci_is_equal(
+            header.substr(
+                header.size() - b64.size()),
+            b64))
+    {
+        d.base64_ = true;
+        header.remove_suffix(b64.size());
+    }
+    char const* const semi = static_cast<
+        char const*>(std::memchr(
+            p, ';', header.size()));
+    d.type_end_ = (semi ? semi
+        : p + header.size()) - first;
+    d.params_end_ = p + header.size() - first;
+    d.data_ = comma + 1 - first;
+    d.data_end_ = s.size();
+    if(d.u_.has_fragment())
+        d.data_end_ = d.u_.encoded_fragment(
+            ).data() - 1 - first;
+    return d;
+}
+
+} // urls
+} // boost
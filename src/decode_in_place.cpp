@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_in_place.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include "detail/decode.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Decode the valid string [it, last) to
+// dest, which is not after it, and
+// return the end of the decoded string
+char*
+decode_forward(
+    char* dest,
+    char const* it,
+    char const* const last,
+    bool plus) noexcept
+{
+    while(it != last)
+    {
+        auto const p = detail::find_escape(
+            it, last, plus);
+        std::size_t const n = p - it;
+        if(dest != it)
+            std::memmove(dest, it, n);
+        dest += n;
+        it = p;
+        if(it == last)
+            break;
+        if(*it == '+')
+        {
+            *dest++ = ' ';
+            ++it;
+            continue;
+        }
+        *dest++ = detail::decode_one(it + 1);
+        it += 3;
+    }
+    return dest;
+}
+
+} // (anon)
+
+system::result<std::size_t>
+decode_in_place(
+    char* data,
+    std::size_t size,
+    encoding_opts opt) noexcept
+{
+    auto rv = make_pct_string_view(
+        core::string_view(data, size));
+    if(! rv)
+        return rv.error();
+    return decode_forward(
+        data, data, data + size,
+        opt.space_as_plus) - data;
+}
+
+system::result<void>
+decode_in_place(
+    std::string& s,
+    encoding_opts opt) noexcept
+{
+    auto rv = decode_in_place(
+        &s[0], s.size(), opt);
+    if(! rv)
+        return rv.error();
+    // shrinking does not allocate
+    s.resize(*rv);
+    return {};
+}
+
+system::result<void>
+decode_params_in_place(
+    std::string& s,
+    std::vector<param_view>& params,
+    encoding_opts opt)
+{
+    auto rv = make_pct_string_view(s);
+    if(! rv)
+        return rv.error();
+    if(s.empty())
+        return {};
+    // allocate before the string is
+    // modified, so it is unchanged
+    // if this throws
+    params.reserve(params.size() + 1 +
+        std::count(s.begin(), s.end(), '&'));
+
+    // The separators are not escapes, so
+    // each escape is inside one key or
+    // value, and everything after the
+    // decoded strings is still encoded.
+    char* const base = &s[0];
+    char const* it = base;
+    char const* const last = base + s.size();
+    char* dest = base;
+    for(;;)
+    {
+        auto const amp = std::find(
+            it, last, '&');
+        auto const eq = std::find(
+            it, amp, '=');
+        char* const key = dest;
+        dest = decode_forward(
+            dest, it, eq, opt.space_as_plus);
+        core::string_view const k(
+            key, dest - key);
+        if(eq == amp)
+        {
+            params.emplace_back(k, no_value);
+        }
+        else
+        {
+            char* const value = dest;
+            dest = decode_forward(
+                dest, eq + 1, amp,
+                opt.space_as_plus);
+            params.emplace_back(k,
+                core::string_view(
+                    value, dest - value));
+        }
+        if(amp == last)
+            break;
+        it = amp + 1;
+    }
+    s.resize(dest - base);
+    return {};
+}
+
+} // urls
+} // boost
@@ -0,0 +1,28 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_validate_utf8.hpp>
+#include "detail/decode.hpp"
+
+namespace boost {
+namespace urls {
+
+std::size_t
+decode_validate_utf8(
+    pct_string_view s,
+    char* dest,
+    encoding_opts opt) noexcept
+{
+    return detail::decode_validate_utf8_unsafe(
+        dest, s, opt.space_as_plus);
+}
+
+} // urls
+} // boost
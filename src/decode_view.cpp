@@ -12,7 +12,11 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/decode_view.hpp>
+#include <boost/url/detail/url_formatter.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
+#include "detail/decode.hpp"
+#include <algorithm>
+#include <cstring>
 #include <ostream>
 
 namespace boost {
@@ -20,51 +24,186 @@ namespace urls {
 
 namespace detail {
 
+namespace {
+
+// Produces the decoded chars of a string
+// as runs of unescaped chars, which are
+// referenced in place, and single decoded
+// escapes. Runs are found with find_escape,
+// so they can be compared and copied with
+// memcmp and memcpy instead of one char
+// at a time.
+class decoded_chunks
+{
+    char const* it_;
+    char const* end_;
+    bool plus_;
+    bool raw_;
+    char c_ = 0;
+
+public:
+    explicit
+    decoded_chunks(
+        decode_view s) noexcept
+        : it_(s.begin().base())
+        , end_(s.end().base())
+        , plus_(s.options().space_as_plus)
+        , raw_(false)
+    {
+    }
+
+    // an encoded string
+    decoded_chunks(
+        core::string_view s,
+        bool plus) noexcept
+        : it_(s.data())
+        , end_(s.data() + s.size())
+        , plus_(plus)
+        , raw_(false)
+    {
+    }
+
+    // plain strings are a single run
+    explicit
+    decoded_chunks(
+        core::string_view s) noexcept
+        : it_(s.data())
+        , end_(s.data() + s.size())
+        , plus_(false)
+        , raw_(true)
+    {
+    }
+
+    decoded_chunks(
+        decoded_chunks const&) = delete;
+
+    char const*
+    pos() const noexcept
+    {
+        return it_;
+    }
+
+    // Return the next run, or an
+    // empty string at the end
+    core::string_view
+    next() noexcept
+    {
+        if(it_ == end_)
+            return {};
+        char const* p = end_;
+        if(! raw_)
+            p = find_escape(
+                it_, end_, plus_);
+        if(p != it_)
+        {
+            core::string_view s(
+                it_, p - it_);
+            it_ = p;
+            return s;
+        }
+        if(*it_ == '+')
+        {
+            c_ = ' ';
+            ++it_;
+        }
+        else
+        {
+            c_ = decode_one(it_ + 1);
+            it_ += 3;
+        }
+        return { &c_, 1 };
+    }
+
+    // Skip n decoded chars
+    void
+    skip(std::size_t n) noexcept
+    {
+        while(n > 0)
+        {
+            auto const last = it_ + (std::min)(
+                n, static_cast<std::size_t>(
+                    end_ - it_));
+            char const* p = last;
+            if(! raw_)
+                p = find_escape(
+                    it_, last, plus_);
+            n -= p - it_;
+            it_ = p;
+            if(n == 0 || it_ == end_)
+                return;
+            it_ += *it_ == '%' ? 3 : 1;
+            --n;
+        }
+    }
+};
+
+// Compare the next n decoded chars
+int
+compare_n(
+    decoded_chunks& c0,
+    decoded_chunks& c1,
+    std::size_t n) noexcept
+{
+    core::string_view s0;
+    core::string_view s1;
+    while(n > 0)
+    {
+        if(s0.empty())
+            s0 = c0.next();
+        if(s1.empty())
+            s1 = c1.next();
+        auto const m = (std::min)(n,
+            (std::min)(s0.size(), s1.size()));
+        BOOST_ASSERT(m > 0);
+        int const r = std::memcmp(
+            s0.data(), s1.data(), m);
+        if(r != 0)
+            return r < 0 ? -1 : 1;
+        s0.remove_prefix(m);
+        s1.remove_prefix(m);
+        n -= m;
+    }
+    return 0;
+}
+
 template <class T>
 int
-decoded_strcmp(decode_view s0, T s1)
+decoded_strcmp(decode_view s0, T s1) noexcept
 {
     auto const n0 = s0.size();
     auto const n1 = s1.size();
-    auto n = (std::min)(n0, n1);
-    auto it0 = s0.begin();
-    auto it1 = s1.begin();
-    while (n--)
+    decoded_chunks c0(s0);
+    decoded_chunks c1(s1);
+    int const r = compare_n(
+        c0, c1, (std::min)(n0, n1));
+    if(r != 0)
+        return r;
+    return 1 - (n0 == n1) - 2 * (n0 < n1);
+}
+
+} // (anon)
+
+void
+write_decoded(
+    core::string_view s,
+    bool space_as_plus,
+    void (*write)(void*, char const*, std::size_t),
+    void* out)
+{
+    decoded_chunks c(s, space_as_plus);
+    for(;;)
     {
-        const char c0 = *it0++;
-        const char c1 = *it1++;
-        if (c0 == c1)
-            continue;
-        return 1 - 2 * (static_cast<unsigned char>(c0)
-                      < static_cast<unsigned char>(c1));
+        auto const r = c.next();
+        if(r.empty())
+            break;
+        write(out, r.data(), r.size());
     }
-    return 1 - (n0 == n1) - 2 * (n0 < n1);
 }
 
 } // detail
 
 //------------------------------------------------
 
-auto
-decode_view::
-iterator::
-operator*() const noexcept ->
-    reference
-{
-    if (space_as_plus_ &&
-        *pos_ == '+')
-        return ' ';
-    if (*pos_ != '%')
-        return *pos_;
-    auto d0 = grammar::hexdig_value(pos_[1]);
-    auto d1 = grammar::hexdig_value(pos_[2]);
-    return static_cast<char>(
-        ((static_cast<
-              unsigned char>(d0) << 4) +
-         (static_cast<
-             unsigned char>(d1))));
-}
-
 // unchecked constructor
 decode_view::
 decode_view(
@@ -97,26 +236,26 @@ void
 decode_view::
 write(std::ostream& os) const
 {
-    auto it = begin();
-    auto const end_ = end();
-    while(it != end_)
-        os.put(*it++);
+    detail::decoded_chunks c(*this);
+    for(;;)
+    {
+        auto const s = c.next();
+        if(s.empty())
+            break;
+        os.write(s.data(), static_cast<
+            std::streamsize>(s.size()));
+    }
 }
 
 void
 decode_view::
 remove_prefix( size_type n )
 {
-    auto it = begin();
-    auto n0 = n;
-    while (n)
-    {
-        ++it;
-        --n;
-    }
-    n_ -= (it.base() - begin().base());
-    dn_ -= n0;
-    p_ = it.base();
+    detail::decoded_chunks c(*this);
+    c.skip(n);
+    n_ -= c.pos() - p_;
+    dn_ -= n;
+    p_ = c.pos();
 }
 
 void
@@ -140,18 +279,10 @@ starts_with( core::string_view s ) const noexcept
 {
     if (s.size() > size())
         return false;
-    auto it0 = begin();
-    auto it1 = s.begin();
-    std::size_t n = s.size();
-    while (n)
-    {
-        if (*it0 != *it1)
-            return false;
-        ++it0;
-        ++it1;
-        --n;
-    }
-    return true;
+    detail::decoded_chunks c0(*this);
+    detail::decoded_chunks c1(s);
+    return detail::compare_n(
+        c0, c1, s.size()) == 0;
 }
 
 bool
@@ -198,15 +329,25 @@ decode_view::const_iterator
 decode_view::
 find( char ch ) const noexcept
 {
-    auto it = begin();
-    auto end = this->end();
-    while (it != end)
+    detail::decoded_chunks c(*this);
+    for(;;)
     {
-        if (*it == ch)
-            return it;
-        ++it;
+        auto const p = c.pos();
+        auto const s = c.next();
+        if(s.empty())
+            return end();
+        auto const q = static_cast<char const*>(
+            std::memchr(s.data(), ch, s.size()));
+        if(! q)
+            continue;
+        // runs are referenced in place,
+        // escapes are not
+        if(s.data() == p)
+            return { p_, static_cast<size_type>(
+                q - p_), space_as_plus_ };
+        return { p_, static_cast<size_type>(
+            p - p_), space_as_plus_ };
     }
-    return it;
 }
 
 decode_view::const_iterator
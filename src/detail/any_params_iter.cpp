@@ -40,6 +40,34 @@ namespace detail {
 any_params_iter::
 ~any_params_iter() noexcept = default;
 
+std::size_t
+any_params_iter::
+measure_all(std::size_t& n)
+{
+    std::size_t nparam = 0;
+    while(measure(n))
+        ++nparam;
+    return nparam;
+}
+
+void
+any_params_iter::
+copy_all(
+    char*& dest,
+    char const* end) noexcept
+{
+    // the number of elements is
+    // known from the measurement
+    if(dest == end)
+        return;
+    copy(dest, end);
+    while(dest != end)
+    {
+        *dest++ = '&';
+        copy(dest, end);
+    }
+}
+
 //------------------------------------------------
 //
 // query_iter
@@ -27,6 +27,40 @@ namespace detail {
 //
 //------------------------------------------------
 
+std::size_t
+any_segments_iter::
+measure_all(std::size_t& n)
+{
+    std::size_t nseg = 0;
+    while(measure(n))
+    {
+        ++nseg;
+        encode_colons = false;
+    }
+    return nseg;
+}
+
+void
+any_segments_iter::
+copy_all(
+    char*& dest,
+    char const* end,
+    std::size_t nseg) noexcept
+{
+    if(nseg == 0)
+        return;
+    for(;;)
+    {
+        copy(dest, end);
+        encode_colons = false;
+        if(--nseg == 0)
+            break;
+        *dest++ = '/';
+    }
+}
+
+//------------------------------------------------
+
 segment_iter::
 segment_iter(
     core::string_view s_) noexcept
@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include "base64.hpp"
+#include "decode.hpp"
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <cstdint>
+
+#ifdef BOOST_URL_USE_SSSE3
+# include <emmintrin.h>
+# include <tmmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// Return the value of a character
+// of the alphabet, or -1
+int
+base64_value(char c) noexcept
+{
+    if(c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if(c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if(c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if(c == '+')
+        return 62;
+    if(c == '/')
+        return 63;
+    return -1;
+}
+
+bool
+is_space(char c) noexcept
+{
+    return
+        c == ' ' || c == '\t' ||
+        c == '\n' || c == '\r' ||
+        c == '\f';
+}
+
+#ifdef BOOST_URL_USE_SSSE3
+
+bool
+cpu_has_ssse3() noexcept
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 1);
+    return (r[2] & 0x200) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3") != 0;
+#endif
+}
+
+/*  Decode 16 characters to 12 bytes
+
+    The characters are translated to their
+    values with two lookups, by the high and
+    by the low nibble of each character, as
+    described by Wojciech Mula in "Base64
+    encoding and decoding at almost the
+    speed of a memory copy". False is
+    returned, and nothing is written, if a
+    character is not in the alphabet. The
+    16 bytes at `dest` are overwritten.
+*/
+#ifndef _MSC_VER
+__attribute__((target("ssse3")))
+#endif
+bool
+decode_base64_ssse3(
+    char const* s,
+    char* dest) noexcept
+{
+    __m128i const in = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(s));
+    __m128i const m2f = _mm_set1_epi8(0x2f);
+    __m128i const lut_lo = _mm_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    __m128i const lut_hi = _mm_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    __m128i const lut_roll = _mm_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71,
+        0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i const hi_nibbles = _mm_and_si128(
+        _mm_srli_epi32(in, 4), m2f);
+    __m128i const lo_nibbles =
+        _mm_and_si128(in, m2f);
+    __m128i const lo = _mm_shuffle_epi8(
+        lut_lo, lo_nibbles);
+    __m128i const hi = _mm_shuffle_epi8(
+        lut_hi, hi_nibbles);
+    // a character is valid when its
+    // two lookups share no bit
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(lo, hi),
+            _mm_setzero_si128())) != 0xffff)
+        return false;
+    __m128i const roll = _mm_shuffle_epi8(
+        lut_roll, _mm_add_epi8(
+            _mm_cmpeq_epi8(in, m2f), hi_nibbles));
+    __m128i const v = _mm_add_epi8(in, roll);
+    // pack four 6-bit values in 24 bits,
+    // then the 3 bytes of each group
+    __m128i const ab = _mm_maddubs_epi16(
+        v, _mm_set1_epi32(0x01400140));
+    __m128i const abc = _mm_madd_epi16(
+        ab, _mm_set1_epi32(0x00011000));
+    __m128i const out = _mm_shuffle_epi8(
+        abc, _mm_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9,
+            8, 14, 13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dest), out);
+    return true;
+}
+
+#endif
+
+} // (anon)
+
+system::result<std::size_t>
+decode_base64(
+    char* const dest,
+    std::size_t size,
+    core::string_view s) noexcept
+{
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    char* out = dest;
+    char* const last = dest + size;
+#ifdef BOOST_URL_USE_SSSE3
+    static bool const has_ssse3 =
+        cpu_has_ssse3();
+    // after a block fails, the characters
+    // before this are decoded one by one
+    char const* scalar = has_ssse3
+        ? it : end;
+#endif
+    std::uint32_t bits = 0;
+    unsigned n = 0;
+    while(it != end)
+    {
+#ifdef BOOST_URL_USE_SSSE3
+        if( n == 0 &&
+            it >= scalar &&
+            end - it >= 16 &&
+            last - out >= 16)
+        {
+            if(decode_base64_ssse3(it, out))
+            {
+                it += 16;
+                out += 12;
+                continue;
+            }
+            scalar = it + 16;
+        }
+#endif
+        char c = *it;
+        if(c == '%')
+        {
+            c = decode_one(it + 1);
+            it += 3;
+        }
+        else
+        {
+            ++it;
+        }
+        if(is_space(c))
+            continue;
+        if(c == '=')
+        {
+            // only padding and white
+            // space may follow
+            unsigned pad = 1;
+            while(it != end)
+            {
+                c = *it;
+                if(c == '%')
+                {
+                    c = decode_one(it + 1);
+                    it += 3;
+                }
+                else
+                {
+                    ++it;
+                }
+                if(c == '=')
+                    ++pad;
+                else if(! is_space(c))
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+            }
+            if( n < 2 ||
+                n + pad > 4)
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            break;
+        }
+        int const v = base64_value(c);
+        if(v < 0)
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        bits = (bits << 6) |
+            static_cast<std::uint32_t>(v);
+        if(++n < 4)
+            continue;
+        if(last - out < 3)
+            BOOST_URL_RETURN_EC(
+                error::no_space);
+        out[0] = static_cast<char>(bits >> 16);
+        out[1] = static_cast<char>(bits >> 8);
+        out[2] = static_cast<char>(bits);
+        out += 3;
+        bits = 0;
+        n = 0;
+    }
+    // a partial group of two or
+    // three characters, unpadded
+    // or padded
+    if(n == 1)
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    if(n > 1)
+    {
+        std::size_t const m = n - 1;
+        if(static_cast<std::size_t>(
+                last - out) < m)
+            BOOST_URL_RETURN_EC(
+                error::no_space);
+        bits <<= 6 * (4 - n);
+        out[0] = static_cast<char>(bits >> 16);
+        if(m > 1)
+            out[1] = static_cast<char>(bits >> 8);
+        out += m;
+    }
+    return static_cast<
+        std::size_t>(out - dest);
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_BASE64_HPP
+#define BOOST_URL_DETAIL_BASE64_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  Decode base64 with percent-escapes
+
+    The characters of `s` are the base64
+    alphabet of RFC 4648, section 4, where
+    any character may be percent-encoded,
+    as in the data of a URL. The escapes
+    must be valid. Decoded white space is
+    skipped, and the padding is optional.
+
+    The bytes are written to `dest`, and
+    their number is returned. Blocks of
+    characters without escapes are decoded
+    sixteen at a time when the CPU has
+    SSSE3.
+*/
+system::result<std::size_t>
+decode_base64(
+    char* dest,
+    std::size_t size,
+    core::string_view s) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/compact_url_view.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/detail/ci_string.hpp>
+#include "url_image.hpp"
+#include "../rfc/detail/host_rule.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+void
+compact_url_base::
+get(
+    url_view_base const& u,
+    parts& p) noexcept
+{
+    auto const& impl = url_image::impl(u);
+    p.cs = impl.cs_;
+    for(int id = id_user; id <= id_end; ++id)
+        p.offset[id] = impl.offset(id);
+    p.nseg = impl.nseg_;
+    p.nparam = impl.nparam_;
+    p.port_number = impl.port_number_;
+    p.host_type = impl.host_type_;
+    p.scheme = impl.scheme_;
+}
+
+url_view
+compact_url_base::
+construct(parts const& p) noexcept
+{
+    url_impl u(url_impl::from::string);
+    u.cs_ = p.cs;
+    for(int id = id_user; id <= id_end; ++id)
+        u.offset_[id] = p.offset[id];
+    u.nseg_ = p.nseg;
+    u.nparam_ = p.nparam;
+    u.port_number_ = p.port_number;
+    u.host_type_ = p.host_type;
+    u.scheme_ = p.scheme;
+
+    // every escape decodes three
+    // characters to one, and the
+    // delimiters are not counted
+    auto const decoded = [&u](
+        int id, std::size_t delims)
+    {
+        auto const s = u.get(id);
+        auto const n = static_cast<
+            std::size_t>(std::count(
+                s.begin(), s.end(), '%'));
+        return s.size() - 2 * n - delims;
+    };
+    if(u.len(id_user) > 0)
+        u.decoded_[id_user] =
+            decoded(id_user, 2);
+    if(u.len(id_pass) > 1)
+        u.decoded_[id_pass] =
+            decoded(id_pass, 2);
+    u.decoded_[id_host] = decoded(id_host, 0);
+    u.decoded_[id_path] = decoded(id_path, 0);
+    if(u.len(id_query) > 0)
+        u.decoded_[id_query] =
+            decoded(id_query, 1);
+    if(u.len(id_frag) > 0)
+        u.decoded_[id_frag] =
+            decoded(id_frag, 1);
+
+    auto const host = u.get(id_host);
+    u.host_norm_ =
+        u.decoded_[id_host] == host.size() &&
+        grammar::detail::find_upper(
+            host.data(),
+            host.data() + host.size()) ==
+                host.data() + host.size();
+    if( p.host_type != host_type::name &&
+        p.host_type != host_type::none)
+    {
+        // the address is read again
+        auto rv = grammar::parse(
+            host, host_rule);
+        BOOST_ASSERT(rv.has_value());
+        if(rv)
+            std::memcpy(
+                u.ip_addr_,
+                rv->addr,
+                sizeof(u.ip_addr_));
+    }
+    return u.construct();
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include "crc32c.hpp"
+#include "decode.hpp"
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE42
+# include <nmmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+#if defined(BOOST_URL_USE_NEON) && \
+    defined(__ARM_FEATURE_CRC32)
+# define BOOST_URL_CRC32C_ARM
+# include <arm_acle.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+#ifndef BOOST_URL_CRC32C_ARM
+
+// The table of the reflected
+// polynomial 0x1EDC6F41
+struct crc32c_table
+{
+    std::uint32_t t[256];
+
+    crc32c_table() noexcept
+    {
+        for(std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for(int k = 0; k < 8; ++k)
+                c = (c >> 1) ^
+                    (0x82F63B78u & (0u - (c & 1)));
+            t[i] = c;
+        }
+    }
+};
+
+std::uint32_t
+crc32c_scalar(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept
+{
+    static crc32c_table const tab;
+    while(first != last)
+        crc = tab.t[(crc ^ static_cast<
+            unsigned char>(*first++)) & 0xff] ^
+                (crc >> 8);
+    return crc;
+}
+
+#endif
+
+#ifdef BOOST_URL_USE_SSE42
+
+bool
+cpu_has_sse42() noexcept
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 1);
+    return (r[2] & 0x100000) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+}
+
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif
+std::uint32_t
+crc32c_sse42(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept
+{
+    std::uint64_t c = crc;
+    while(last - first >= 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, first, 8);
+        c = _mm_crc32_u64(c, w);
+        first += 8;
+    }
+    auto crc1 = static_cast<std::uint32_t>(c);
+    while(first != last)
+        crc1 = _mm_crc32_u8(crc1,
+            static_cast<unsigned char>(*first++));
+    return crc1;
+}
+
+#endif
+
+#ifdef BOOST_URL_CRC32C_ARM
+
+std::uint32_t
+crc32c_arm(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept
+{
+    while(last - first >= 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, first, 8);
+        crc = __crc32cd(crc, w);
+        first += 8;
+    }
+    while(first != last)
+        crc = __crc32cb(crc,
+            static_cast<std::uint8_t>(*first++));
+    return crc;
+}
+
+#endif
+
+} // (anon)
+
+std::uint32_t
+crc32c(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept
+{
+#if defined(BOOST_URL_CRC32C_ARM)
+    return crc32c_arm(crc, first, last);
+#else
+# ifdef BOOST_URL_USE_SSE42
+    static bool const has_sse42 =
+        cpu_has_sse42();
+    if(has_sse42)
+        return crc32c_sse42(
+            crc, first, last);
+# endif
+    return crc32c_scalar(crc, first, last);
+#endif
+}
+
+std::uint32_t
+crc32c_decoded(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept
+{
+    for(;;)
+    {
+        // the words of a run are
+        // hashed as they are
+        auto const p = find_escape(
+            first, last, false);
+        crc = crc32c(crc, first, p);
+        if(p == last)
+            return crc;
+        char const c = decode_one(p + 1);
+        crc = crc32c(crc, &c, &c + 1);
+        first = p + 3;
+    }
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_CRC32C_HPP
+#define BOOST_URL_DETAIL_CRC32C_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Return the CRC32C of [first, last),
+// continuing from crc. Uses the CRC32
+// instructions of SSE4.2 or ARMv8 when
+// they are available.
+std::uint32_t
+crc32c(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept;
+
+// Return the CRC32C of the decoded
+// bytes of the valid percent-encoded
+// string [first, last), continuing
+// from crc
+std::uint32_t
+crc32c_decoded(
+    std::uint32_t crc,
+    char const* first,
+    char const* last) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
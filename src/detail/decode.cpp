@@ -14,12 +14,208 @@
 #include "decode.hpp"
 #include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/core/bit.hpp>
+#include <cstring>
 #include <memory>
 
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
+
 namespace boost {
 namespace urls {
 namespace detail {
 
+char const*
+find_escape(
+    char const* it,
+    char const* const last,
+    bool plus) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const pct = _mm_set1_epi8('%');
+    __m128i const pls = _mm_set1_epi8(
+        plus ? '+' : '%');
+    while(last - it >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(v, pct),
+                _mm_cmpeq_epi8(v, pls))));
+        if(m)
+            return it + boost::core::countr_zero(m);
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const pct = vdupq_n_u8('%');
+    uint8x16_t const pls = vdupq_n_u8(
+        plus ? '+' : '%');
+    while(last - it >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(it));
+        uint8x16_t const e = vorrq_u8(
+            vceqq_u8(v, pct), vceqq_u8(v, pls));
+        // four bits per byte
+        std::uint64_t const m = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(
+                vreinterpretq_u16_u8(e), 4)), 0);
+        if(m)
+            return it + (
+                boost::core::countr_zero(m) >> 2);
+        it += 16;
+    }
+#endif
+    while(it != last)
+    {
+        if( *it == '%' ||
+            (plus && *it == '+'))
+            break;
+        ++it;
+    }
+    return it;
+}
+
+void
+upper_escapes(
+    char* it,
+    char* const last) noexcept
+{
+    char* const first = it;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const pct = _mm_set1_epi8('%');
+    __m128i const a = _mm_set1_epi8('a' - 1);
+    __m128i const f = _mm_set1_epi8('f' + 1);
+    __m128i const bit = _mm_set1_epi8(0x20);
+    __m128i prev = _mm_setzero_si128();
+    while(last - it >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        __m128i const e = _mm_cmpeq_epi8(v, pct);
+        // the two bytes after each '%',
+        // including those of the previous
+        // block's last escapes
+        __m128i const hex = _mm_or_si128(
+            _mm_or_si128(
+                _mm_slli_si128(e, 1),
+                _mm_srli_si128(prev, 15)),
+            _mm_or_si128(
+                _mm_slli_si128(e, 2),
+                _mm_srli_si128(prev, 14)));
+        __m128i const lower = _mm_and_si128(hex,
+            _mm_and_si128(
+                _mm_cmpgt_epi8(v, a),
+                _mm_cmpgt_epi8(f, v)));
+        // a normalized block is only read
+        if(_mm_movemask_epi8(lower))
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(it),
+                _mm_sub_epi8(v,
+                    _mm_and_si128(lower, bit)));
+        prev = e;
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const pct = vdupq_n_u8('%');
+    uint8x16_t const a = vdupq_n_u8('a');
+    uint8x16_t const f = vdupq_n_u8('f');
+    uint8x16_t const bit = vdupq_n_u8(0x20);
+    uint8x16_t prev = vdupq_n_u8(0);
+    while(last - it >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(it));
+        uint8x16_t const e = vceqq_u8(v, pct);
+        // the two bytes after each '%',
+        // including those of the previous
+        // block's last escapes
+        uint8x16_t const hex = vorrq_u8(
+            vextq_u8(prev, e, 15),
+            vextq_u8(prev, e, 14));
+        uint8x16_t const lower = vandq_u8(hex,
+            vandq_u8(
+                vcgeq_u8(v, a),
+                vcleq_u8(v, f)));
+        // a normalized block is only read
+        if(vmaxvq_u8(lower))
+            vst1q_u8(
+                reinterpret_cast<
+                    std::uint8_t*>(it),
+                vsubq_u8(v,
+                    vandq_u8(lower, bit)));
+        prev = e;
+        it += 16;
+    }
+#endif
+    // back up to an escape which
+    // straddles the last block
+    if(it - first >= 1 && it[-1] == '%')
+        it -= 1;
+    else if(it - first >= 2 && it[-2] == '%')
+        it -= 2;
+    while(last - it >= 3)
+    {
+        if(*it != '%')
+        {
+            ++it;
+            continue;
+        }
+        if(it[1] >= 'a' && it[1] <= 'f')
+            it[1] -= 0x20;
+        if(it[2] >= 'a' && it[2] <= 'f')
+            it[2] -= 0x20;
+        it += 3;
+    }
+}
+
+namespace {
+
+// Return the number of '%' in [it, last)
+std::size_t
+count_pct(
+    char const* it,
+    char const* const last) noexcept
+{
+    std::size_t n = 0;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const pct = _mm_set1_epi8('%');
+    while(last - it >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        n += boost::core::popcount(
+            static_cast<unsigned>(
+                _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(v, pct))));
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const pct = vdupq_n_u8('%');
+    uint8x16_t const one = vdupq_n_u8(1);
+    while(last - it >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(it));
+        n += vaddvq_u8(vandq_u8(
+            vceqq_u8(v, pct), one));
+        it += 16;
+    }
+#endif
+    while(it != last)
+        n += *it++ == '%';
+    return n;
+}
+
+} // (anon)
+
 char
 decode_one(
     char const* const it) noexcept
@@ -37,23 +233,13 @@ std::size_t
 decode_bytes_unsafe(
     core::string_view s) noexcept
 {
-    auto p = s.begin();
-    auto const end = s.end();
-    std::size_t dn = 0;
-    if(s.size() >= 3)
-    {
-        auto const safe_end = end - 2;
-        while(p < safe_end)
-        {
-            if(*p != '%')
-                p += 1;
-            else
-                p += 3;
-            ++dn;
-        }
-    }
-    dn += end - p;
-    return dn;
+    // Each escape has two hexdigs after it,
+    // so an escape can only start before
+    // the last two chars.
+    if(s.size() < 3)
+        return s.size();
+    return s.size() - 2 * count_pct(
+        s.data(), s.data() + s.size() - 2);
 }
 
 std::size_t
@@ -67,71 +253,194 @@ decode_unsafe(
     auto const last = it + s.size();
     auto dest = dest0;
 
-    if(opt.space_as_plus)
+    while(it != last)
     {
-        while(it != last)
+        // unescaped run
+        auto const p = find_escape(
+            it, last, opt.space_as_plus);
+        std::size_t n = p - it;
+        if(n > static_cast<std::size_t>(
+            end - dest))
         {
-            if(dest == end)
-            {
-                // dest too small
-                return dest - dest0;
-            }
-            if(*it == '+')
-            {
-                // plus to space
-                *dest++ = ' ';
-                ++it;
-                continue;
-            }
-            if(*it == '%')
-            {
-                // escaped
-                ++it;
-                if(last - it < 2)
-                {
-                    // missing input,
-                    // initialize output
-                    std::memset(dest,
-                        0, end - dest);
-                    return dest - dest0;
-                }
-                *dest++ = decode_one(it);
-                it += 2;
-                continue;
-            }
-            // unescaped
-            *dest++ = *it++;
+            // dest too small
+            n = end - dest;
+            if(n > 0)
+                std::memcpy(dest, it, n);
+            return (dest + n) - dest0;
         }
-        return dest - dest0;
-    }
-
-    while(it != last)
-    {
+        std::memcpy(dest, it, n);
+        dest += n;
+        it = p;
+        if(it == last)
+            break;
         if(dest == end)
         {
             // dest too small
             return dest - dest0;
         }
-        if(*it == '%')
+        if(*it == '+')
         {
-            // escaped
+            // plus to space
+            *dest++ = ' ';
             ++it;
-            if(last - it < 2)
+            continue;
+        }
+        // escaped
+        ++it;
+        if(last - it < 2)
+        {
+            // missing input,
+            // initialize output
+            std::memset(dest,
+                0, end - dest);
+            return dest - dest0;
+        }
+        *dest++ = decode_one(it);
+        it += 2;
+    }
+    return dest - dest0;
+}
+
+std::size_t
+decode_validate_utf8_unsafe(
+    char* const dest0,
+    core::string_view s,
+    bool plus) noexcept
+{
+    auto it = s.data();
+    auto const last = it + s.size();
+    auto dest = dest0;
+
+    // continuation bytes still expected,
+    // the range of the next one, and the
+    // lead byte of the sequence
+    std::size_t need = 0;
+    unsigned lo = 0x80;
+    unsigned hi = 0xBF;
+    char* lead = nullptr;
+    while(it != last)
+    {
+        // copy blocks which are ASCII
+        // and have no escape at once
+#ifdef BOOST_URL_USE_SSE2
+        if(need == 0)
+        {
+            __m128i const pct = _mm_set1_epi8('%');
+            __m128i const pls = _mm_set1_epi8(
+                plus ? '+' : '%');
+            while(last - it >= 16)
+            {
+                __m128i const v = _mm_loadu_si128(
+                    reinterpret_cast<__m128i const*>(it));
+                // the sign bit is set for bytes
+                // above 0x7F and for matches
+                if(_mm_movemask_epi8(_mm_or_si128(v,
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(v, pct),
+                        _mm_cmpeq_epi8(v, pls)))))
+                    break;
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(dest), v);
+                it += 16;
+                dest += 16;
+            }
+            if(it == last)
+                break;
+        }
+#elif defined(BOOST_URL_USE_NEON)
+        if(need == 0)
+        {
+            uint8x16_t const pct = vdupq_n_u8('%');
+            uint8x16_t const pls = vdupq_n_u8(
+                plus ? '+' : '%');
+            while(last - it >= 16)
             {
-                // missing input,
-                // initialize output
-                std::memset(dest,
-                    0, end - dest);
-                return dest - dest0;
+                uint8x16_t const v = vld1q_u8(
+                    reinterpret_cast<
+                        std::uint8_t const*>(it));
+                if(vmaxvq_u8(vorrq_u8(v, vorrq_u8(
+                        vceqq_u8(v, pct),
+                        vceqq_u8(v, pls)))) >= 0x80)
+                    break;
+                vst1q_u8(reinterpret_cast<
+                    std::uint8_t*>(dest), v);
+                it += 16;
+                dest += 16;
             }
-            *dest++ = decode_one(it);
-            it += 2;
+            if(it == last)
+                break;
+        }
+#endif
+        unsigned c;
+        if(*it == '%')
+        {
+            c = static_cast<unsigned char>(
+                decode_one(it + 1));
+            it += 3;
+        }
+        else if(plus && *it == '+')
+        {
+            c = ' ';
+            ++it;
+        }
+        else
+        {
+            c = static_cast<unsigned char>(*it);
+            ++it;
+        }
+        *dest++ = static_cast<char>(c);
+        if(need > 0)
+        {
+            if(c < lo || c > hi)
+                goto invalid;
+            --need;
+            lo = 0x80;
+            hi = 0xBF;
+            continue;
+        }
+        if(c < 0x80)
             continue;
+        lead = dest - 1;
+        if(c < 0xC2)
+        {
+            goto invalid;
+        }
+        else if(c < 0xE0)
+        {
+            need = 1;
+        }
+        else if(c < 0xF0)
+        {
+            need = 2;
+            if(c == 0xE0)
+                lo = 0xA0;
+            else if(c == 0xED)
+                hi = 0x9F;
+        }
+        else if(c < 0xF5)
+        {
+            need = 3;
+            if(c == 0xF0)
+                lo = 0x90;
+            else if(c == 0xF4)
+                hi = 0x8F;
+        }
+        else
+        {
+            goto invalid;
         }
-        // unescaped
-        *dest++ = *it++;
     }
-    return dest - dest0;
+    if(need == 0)
+        return dest - dest0;
+    return lead - dest0;
+
+invalid:
+    // decode the rest
+    decode_unsafe(dest,
+        dest0 + decode_bytes_unsafe(s),
+        core::string_view(it, last - it),
+        encoding_opts(plus));
+    return lead - dest0;
 }
 
 } // detail
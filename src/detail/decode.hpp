@@ -19,6 +19,25 @@ namespace boost {
 namespace urls {
 namespace detail {
 
+// Return a pointer to the first '%' in
+// [it, last), or the first '+' as well
+// when plus is true, or last if none.
+BOOST_URL_DECL
+char const*
+find_escape(
+    char const* it,
+    char const* last,
+    bool plus) noexcept;
+
+// Uppercase the hex digits of the
+// escapes in [it, last), which must
+// all be complete.
+BOOST_URL_DECL
+void
+upper_escapes(
+    char* it,
+    char* last) noexcept;
+
 BOOST_URL_DECL
 char
 decode_one(
@@ -37,6 +56,17 @@ decode_unsafe(
     core::string_view s,
     encoding_opts opt = {}) noexcept;
 
+// Decode the valid string s to dest, which
+// has room for its decoded size, and return
+// the offset in dest of the first invalid
+// UTF-8 sequence, or the decoded size.
+BOOST_URL_DECL
+std::size_t
+decode_validate_utf8_unsafe(
+    char* dest,
+    core::string_view s,
+    bool plus) noexcept;
+
 } // detail
 } // urls
 } // boost
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/epoch_domain.hpp>
+#include <boost/assert.hpp>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// the slot of the calling thread,
+// assigned in the order threads
+// first enter any domain
+std::size_t
+this_slot() noexcept
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    static std::atomic<std::size_t> next{0};
+    thread_local std::size_t const i =
+        next.fetch_add(1,
+            std::memory_order_relaxed);
+    return i;
+#else
+    return 0;
+#endif
+}
+
+} // (anon)
+
+constexpr std::size_t epoch_domain::slot_count;
+
+epoch_domain::
+epoch_domain() noexcept
+{
+    for(auto& s : slots_)
+    {
+        s.n[0].store(0,
+            std::memory_order_relaxed);
+        s.n[1].store(0,
+            std::memory_order_relaxed);
+    }
+}
+
+std::size_t
+epoch_domain::
+enter() noexcept
+{
+    // sequentially consistent, so that
+    // the increment is ordered before
+    // the load of the table, and a
+    // writer which does not see it
+    // has already replaced the table
+    std::size_t const i =
+        this_slot() % slot_count;
+    std::size_t const e =
+        epoch_.load() & 1;
+    slots_[i].n[e].fetch_add(1);
+    return 2 * i + e;
+}
+
+void
+epoch_domain::
+leave(std::size_t token) noexcept
+{
+    BOOST_ASSERT(token < 2 * slot_count);
+    slots_[token / 2].n[token % 2].fetch_sub(
+        1, std::memory_order_release);
+}
+
+void
+epoch_domain::
+synchronize() noexcept
+{
+    // A reader can read the epoch just
+    // before a flip and add itself to
+    // the counter of the old epoch after
+    // the writer saw it empty, so each
+    // epoch is waited for in turn.
+    for(int k = 0; k < 2; ++k)
+    {
+        std::size_t const e =
+            epoch_.fetch_add(1) & 1;
+        for(auto& s : slots_)
+        {
+            while(s.n[e].load() != 0)
+            {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+                std::this_thread::yield();
+#else
+                BOOST_ASSERT(false);
+#endif
+            }
+        }
+    }
+}
+
+} // detail
+} // urls
+} // boost
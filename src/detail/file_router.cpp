@@ -0,0 +1,273 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/file_router.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/parse_path.hpp>
+#include "normalize.hpp"
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+constexpr std::size_t file_router_base::npos;
+
+bool
+file_router_base::
+normalize(
+    segments_encoded_view segs,
+    std::string& out)
+{
+    out.clear();
+    bool dot = false;
+    for(auto it = segs.begin();
+        it != segs.end(); ++it)
+    {
+        auto const d = **it;
+        if(d == ".")
+        {
+            dot = true;
+            continue;
+        }
+        if(d == "..")
+        {
+            // never above the first segment
+            auto const i = out.rfind('/');
+            if(i != std::string::npos)
+                out.resize(i);
+            dot = true;
+            continue;
+        }
+        dot = false;
+        out.push_back('/');
+        for(char c : d)
+        {
+            if( c == '/' ||
+                c == '\\' ||
+                c == '\0')
+                return false;
+            out.push_back(c);
+        }
+    }
+    // "/a/b/.." is "/a/"
+    if(dot)
+        out.push_back('/');
+    return true;
+}
+
+url_fingerprint
+file_router_base::
+digest(core::string_view s) noexcept
+{
+    mum_hasher<2> h(0);
+    h.put(s);
+    h.end(parts_base::id_path);
+    url_fingerprint f;
+    f.low = h.digest();
+    f.high = h.digest_high();
+    return f;
+}
+
+std::size_t
+file_router_base::
+child(
+    std::size_t parent,
+    core::string_view k) const noexcept
+{
+    auto const& v = nodes_[parent].children;
+    auto it = std::lower_bound(
+        v.begin(), v.end(), k,
+        [this](std::size_t i, core::string_view s)
+        {
+            return key(nodes_[i]) < s;
+        });
+    if( it != v.end() &&
+        key(nodes_[*it]) == k)
+        return *it;
+    return 0;
+}
+
+std::size_t
+file_router_base::
+insert_impl(
+    core::string_view prefix,
+    core::string_view root)
+{
+    if(root.empty())
+        detail::throw_invalid_argument();
+    std::string s;
+    if(! normalize(
+            parse_path(prefix).value(), s))
+        detail::throw_invalid_argument();
+    // "/static/" is "/static"
+    if( ! s.empty() &&
+        s.back() == '/')
+        s.pop_back();
+    while( root.size() > 1 &&
+           root.back() == '/')
+        root.remove_suffix(1);
+
+    auto const n0 = nodes_.size();
+    auto const r0 = roots_.size();
+    auto const k0 = keys_.size();
+    try
+    {
+        if(nodes_.empty())
+            nodes_.emplace_back();
+        std::size_t cur = 0;
+        // the existing node which gets
+        // the first new node as a child
+        std::size_t parent = npos;
+        std::size_t first = 0;
+        std::size_t i = 0;
+        while(i < s.size())
+        {
+            auto j = s.find('/', i + 1);
+            if(j == std::string::npos)
+                j = s.size();
+            core::string_view const seg(
+                s.data() + i + 1, j - i - 1);
+            std::size_t next = 0;
+            if(parent == npos)
+                next = child(cur, seg);
+            if(next == 0)
+            {
+                next = nodes_.size();
+                node nd;
+                nd.key = keys_.size();
+                nd.size = seg.size();
+                keys_.append(
+                    seg.data(), seg.size());
+                nodes_.push_back(std::move(nd));
+                if(parent == npos)
+                {
+                    parent = cur;
+                    first = next;
+                    auto& v = nodes_[cur].children;
+                    v.reserve(v.size() + 1);
+                }
+                else
+                {
+                    nodes_[cur].children.push_back(next);
+                }
+            }
+            cur = next;
+            i = j;
+        }
+        auto const pos = keys_.size();
+        keys_.append(root.data(), root.size());
+        auto r = nodes_[cur].route;
+        if(r == npos)
+        {
+            r = roots_.size();
+            roots_.push_back({ pos, root.size() });
+        }
+        else
+        {
+            // the previous root
+            // is left unused
+            roots_[r] = { pos, root.size() };
+        }
+
+        // from here nothing throws
+        nodes_[cur].route = r;
+        if(parent != npos)
+        {
+            auto& v = nodes_[parent].children;
+            auto const k = key(nodes_[first]);
+            auto it = std::lower_bound(
+                v.begin(), v.end(), k,
+                [this](std::size_t i, core::string_view s)
+                {
+                    return key(nodes_[i]) < s;
+                });
+            v.insert(it, first);
+        }
+        return r;
+    }
+    catch(...)
+    {
+        nodes_.resize(n0);
+        roots_.resize(r0);
+        keys_.resize(k0);
+        throw;
+    }
+}
+
+std::size_t
+file_router_base::
+match(
+    core::string_view path,
+    std::size_t& rest) const noexcept
+{
+    if(nodes_.empty())
+        return npos;
+    std::size_t cur = 0;
+    std::size_t best = nodes_[0].route;
+    rest = 0;
+    std::size_t i = 0;
+    while(i < path.size())
+    {
+        auto j = path.find('/', i + 1);
+        if(j == core::string_view::npos)
+            j = path.size();
+        cur = child(cur, path.substr(
+            i + 1, j - i - 1));
+        if(cur == 0)
+            break;
+        i = j;
+        if(nodes_[cur].route != npos)
+        {
+            best = nodes_[cur].route;
+            rest = i;
+        }
+    }
+    return best;
+}
+
+std::size_t
+file_router_base::
+resolve_impl(
+    segments_encoded_view segs,
+    std::string& out) const
+{
+    std::size_t rest = 0;
+    std::size_t r = npos;
+    if(normalize(segs, out))
+        r = match(out, rest);
+    if(r == npos)
+    {
+        out.clear();
+        return npos;
+    }
+    join(r, rest, out);
+    return r;
+}
+
+void
+file_router_base::
+join(
+    std::size_t route,
+    std::size_t rest,
+    std::string& path) const
+{
+    auto const s = root(route);
+    // a root of "/" keeps its slash
+    if( s.back() == '/' &&
+        rest < path.size())
+        ++rest;
+    path.replace(0, rest, s.data(), s.size());
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,308 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/intern_table.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// An open addressing table. Each slot holds
+// the high half of a hash and the id plus
+// one, or zero if it is empty. Tables are
+// enlarged by publishing a new one, and the
+// old ones are kept until destruction for
+// the readers which still use them.
+struct intern_table::table
+{
+    table* prev = nullptr;
+    std::size_t mask;
+    std::size_t used = 0;
+    std::atomic<std::uint64_t>* slots;
+
+    explicit
+    table(std::size_t n)
+        : mask(n - 1)
+        , slots(new std::atomic<
+            std::uint64_t>[n]())
+    {
+        BOOST_ASSERT((n & mask) == 0);
+    }
+
+    ~table()
+    {
+        delete[] slots;
+    }
+
+    void
+    insert(
+        std::uint64_t hash,
+        std::uint32_t id) noexcept
+    {
+        std::size_t i = static_cast<
+            std::size_t>(hash) & mask;
+        while(slots[i].load(
+                std::memory_order_relaxed) != 0)
+            i = (i + 1) & mask;
+        slots[i].store(
+            ((hash >> 32) << 32) |
+                (std::uint64_t(id) + 1),
+            std::memory_order_release);
+        ++used;
+    }
+};
+
+struct intern_table::chunk
+{
+    chunk* next;
+    std::size_t size;
+    std::size_t used;
+};
+
+namespace {
+
+constexpr std::size_t chunk_size = 65536;
+
+constexpr std::size_t align =
+    alignof(std::max_align_t);
+
+constexpr
+std::size_t
+align_up(std::size_t n) noexcept
+{
+    return (n + align - 1) & ~(align - 1);
+}
+
+// the segment of an id, and
+// the id of its first entry
+int
+segment_of(
+    std::uint32_t id,
+    std::size_t first,
+    std::size_t& base) noexcept
+{
+    int const k = static_cast<int>(
+        core::bit_width(static_cast<
+            std::uint32_t>(id / first + 1))) - 1;
+    base = first * ((std::size_t(1) << k) - 1);
+    return k;
+}
+
+} // (anon)
+
+constexpr std::size_t intern_table::first_segment;
+constexpr int intern_table::max_segments;
+constexpr std::uint32_t intern_table::npos;
+
+intern_table::
+intern_table(std::size_t n)
+{
+    for(auto& s : segs_)
+        s.store(nullptr,
+            std::memory_order_relaxed);
+    if(n == 0)
+        return;
+    std::size_t cap = 16;
+    while(cap < 2 * n)
+        cap *= 2;
+    table_.store(new table(cap),
+        std::memory_order_relaxed);
+}
+
+intern_table::
+~intern_table()
+{
+    table* t = table_.load(
+        std::memory_order_relaxed);
+    while(t)
+    {
+        table* prev = t->prev;
+        delete t;
+        t = prev;
+    }
+    for(auto& s : segs_)
+        delete[] s.load(
+            std::memory_order_relaxed);
+    while(chunks_)
+    {
+        chunk* next = chunks_->next;
+        ::operator delete(chunks_);
+        chunks_ = next;
+    }
+}
+
+auto
+intern_table::
+at(std::uint32_t id) const noexcept ->
+    entry const&
+{
+    std::size_t base;
+    int const k = segment_of(
+        id, first_segment, base);
+    BOOST_ASSERT(k < max_segments);
+    entry const* seg = segs_[k].load(
+        std::memory_order_acquire);
+    BOOST_ASSERT(seg != nullptr);
+    return seg[id - base];
+}
+
+std::uint32_t
+intern_table::
+find(
+    table const* t,
+    std::uint64_t hash,
+    bool (*eq)(void const*, void const*),
+    void const* key) const noexcept
+{
+    if(! t)
+        return npos;
+    std::uint64_t const tag = hash >> 32;
+    std::size_t i = static_cast<
+        std::size_t>(hash) & t->mask;
+    for(;;)
+    {
+        std::uint64_t const v =
+            t->slots[i].load(
+                std::memory_order_acquire);
+        if(v == 0)
+            return npos;
+        if((v >> 32) == tag)
+        {
+            std::uint32_t const id =
+                static_cast<std::uint32_t>(
+                    v & 0xffffffff) - 1;
+            entry const& e = at(id);
+            if( e.hash == hash &&
+                eq(e.rec, key))
+                return id;
+        }
+        i = (i + 1) & t->mask;
+    }
+}
+
+std::uint32_t
+intern_table::
+find(
+    std::uint64_t hash,
+    bool (*eq)(void const*, void const*),
+    void const* key) const noexcept
+{
+    return find(table_.load(
+        std::memory_order_acquire),
+            hash, eq, key);
+}
+
+void*
+intern_table::
+allocate(std::size_t n)
+{
+    std::size_t const bytes = align_up(n);
+    chunk* c = chunks_;
+    if( ! c ||
+        c->size - c->used < bytes)
+    {
+        std::size_t const size =
+            bytes > chunk_size ?
+                bytes : chunk_size;
+        c = static_cast<chunk*>(
+            ::operator new(
+                align_up(sizeof(chunk)) + size));
+        c->size = size;
+        c->used = 0;
+        if( chunks_ &&
+            size != chunk_size)
+        {
+            // a large record gets its own
+            // chunk, and the current one
+            // keeps being filled
+            c->next = chunks_->next;
+            chunks_->next = c;
+        }
+        else
+        {
+            c->next = chunks_;
+            chunks_ = c;
+        }
+    }
+    char* p = reinterpret_cast<char*>(c) +
+        align_up(sizeof(chunk)) + c->used;
+    c->used += bytes;
+    bytes_.fetch_add(bytes,
+        std::memory_order_relaxed);
+    return p;
+}
+
+std::uint32_t
+intern_table::
+insert(
+    std::uint64_t hash,
+    bool (*eq)(void const*, void const*),
+    void const* key,
+    std::size_t n,
+    void (*init)(void*, void const*))
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::lock_guard<std::mutex> lock(m_);
+#endif
+    table* t = table_.load(
+        std::memory_order_relaxed);
+    std::uint32_t id = find(t, hash, eq, key);
+    if(id != npos)
+        // inserted by another thread
+        return id;
+    id = size_.load(
+        std::memory_order_relaxed);
+    if(id == npos)
+        detail::throw_length_error();
+
+    // make room first, so a throw
+    // leaves the table unchanged
+    if( ! t ||
+        2 * (t->used + 1) > t->mask + 1)
+    {
+        table* t1 = new table(
+            t ? 2 * (t->mask + 1) : 16);
+        for(std::uint32_t i = 0; i < id; ++i)
+            t1->insert(at(i).hash, i);
+        t1->prev = t;
+        table_.store(t1,
+            std::memory_order_release);
+        t = t1;
+    }
+    std::size_t base;
+    int const k = segment_of(
+        id, first_segment, base);
+    entry* seg = segs_[k].load(
+        std::memory_order_relaxed);
+    if(! seg)
+    {
+        seg = new entry[
+            first_segment << k];
+        segs_[k].store(seg,
+            std::memory_order_release);
+    }
+    void* rec = allocate(n);
+    init(rec, key);
+    seg[id - base] = { hash, rec };
+
+    // publish
+    t->insert(hash, id);
+    size_.store(id + 1,
+        std::memory_order_release);
+    return id;
+}
+
+} // detail
+} // urls
+} // boost
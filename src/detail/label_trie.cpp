@@ -0,0 +1,289 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include "label_trie.hpp"
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <limits>
+
+namespace boost {
+namespace urls {
+namespace detail {
+namespace label_trie {
+
+namespace {
+
+// Returns the decoded, lowercase char
+// at s[i] and moves i past its escape
+char
+decoded_char(
+    core::string_view s,
+    std::size_t& i) noexcept
+{
+    char c = s[i++];
+    if(c == '%')
+    {
+        // pct_string_view has valid escapes
+        BOOST_ASSERT(i + 2 <= s.size());
+        c = static_cast<char>(
+            (grammar::hexdig_value(s[i]) << 4) +
+                grammar::hexdig_value(s[i + 1]));
+        i += 2;
+    }
+    return grammar::to_lower(c);
+}
+
+} // (anon)
+
+builder::
+builder() = default;
+
+std::size_t
+builder::
+insert(core::string_view name)
+{
+    name_.assign(name.data(), name.size());
+    for(auto& c : name_)
+        c = grammar::to_lower(c);
+
+    // insert the labels from the right
+    std::size_t cur = 0;
+    core::string_view rest = name_;
+    while(! rest.empty())
+    {
+        auto const label = pop_label(rest);
+        key_.assign(
+            reinterpret_cast<
+                char const*>(&cur),
+            sizeof(cur));
+        key_.append(label.data(), label.size());
+        auto it = children_.find(key_);
+        if(it != children_.end())
+        {
+            cur = it->second;
+            continue;
+        }
+        auto const child = node_count();
+        edges_.push_back({
+            cur, labels_.size(), label.size()});
+        labels_.append(
+            label.data(), label.size());
+        children_.emplace(key_, child);
+        cur = child;
+    }
+    return cur;
+}
+
+std::size_t
+builder::
+image_size(std::size_t node_size)
+{
+    // at most half of the slots are used,
+    // so probe sequences stay short
+    slots_ = 0;
+    if(! edges_.empty())
+    {
+        slots_ = 1;
+        while(slots_ < 2 * edges_.size())
+            slots_ *= 2;
+    }
+    constexpr std::size_t max_size =
+        (std::numeric_limits<std::uint32_t>::max)();
+    auto const nodes = node_count();
+    if( slots_ > max_size / slot_size ||
+        nodes > max_size / node_size ||
+        labels_.size() > max_size ||
+        header_size + slots_ * slot_size >
+            max_size - nodes * node_size - labels_.size())
+        detail::throw_length_error();
+    return
+        header_size +
+        slots_ * slot_size +
+        nodes * node_size +
+        labels_.size();
+}
+
+char*
+builder::
+write(
+    char* p,
+    char const (&magic)[4],
+    std::uint32_t version,
+    std::size_t rules,
+    std::size_t node_size) const noexcept
+{
+    std::memcpy(p, magic, sizeof(magic));
+    store32(p + 4, version);
+    store32(p + 8,
+        static_cast<std::uint32_t>(rules));
+    store32(p + 12,
+        static_cast<std::uint32_t>(node_count()));
+    store32(p + 16,
+        static_cast<std::uint32_t>(slots_));
+    store32(p + 20,
+        static_cast<std::uint32_t>(labels_.size()));
+
+    auto const table = p + header_size;
+    std::memset(table, 0, slots_ * slot_size);
+    for(std::size_t i = 0; i < edges_.size(); ++i)
+    {
+        auto const& e = edges_[i];
+        auto h = hash_parent(
+            static_cast<std::uint32_t>(e.parent));
+        for(std::size_t j = 0; j < e.size; ++j)
+            h = hash_byte(h, static_cast<
+                unsigned char>(labels_[e.offset + j]));
+        auto pos = h & (slots_ - 1);
+        while(load32(table +
+                pos * slot_size + 4) != 0)
+            pos = (pos + 1) & (slots_ - 1);
+        auto const s = table + pos * slot_size;
+        store32(s,
+            static_cast<std::uint32_t>(e.parent));
+        store32(s + 4,
+            static_cast<std::uint32_t>(i + 1));
+        store32(s + 8,
+            static_cast<std::uint32_t>(e.offset));
+        store32(s + 12,
+            static_cast<std::uint32_t>(e.size));
+    }
+    auto const nodes = table + slots_ * slot_size;
+    if(! labels_.empty())
+        std::memcpy(
+            nodes + node_count() * node_size,
+            labels_.data(), labels_.size());
+    return nodes;
+}
+
+//------------------------------------------------
+
+view::
+view(
+    core::string_view data,
+    std::size_t node_size) noexcept
+{
+    if(data.empty())
+        return;
+    BOOST_ASSERT(data.size() >= header_size);
+    rules = load32(data.data() + 8);
+    node_count = load32(data.data() + 12);
+    table_size = load32(data.data() + 16);
+    labels_size = load32(data.data() + 20);
+    table = data.data() + header_size;
+    nodes = reinterpret_cast<
+        unsigned char const*>(table +
+            std::size_t(table_size) * slot_size);
+    labels = reinterpret_cast<
+        char const*>(nodes) +
+            std::size_t(node_count) * node_size;
+}
+
+core::string_view
+view::
+checked(
+    core::string_view data,
+    char const (&magic)[4],
+    std::uint32_t version,
+    std::size_t node_size)
+{
+    if( data.size() < header_size ||
+        std::memcmp(data.data(),
+            magic, sizeof(magic)) != 0 ||
+        load32(data.data() + 4) != version)
+        detail::throw_invalid_argument();
+    auto const nodes =
+        load32(data.data() + 12);
+    auto const slots =
+        load32(data.data() + 16);
+    auto const labels =
+        load32(data.data() + 20);
+    // the root is needed to use the table
+    if( (slots & (slots - 1)) != 0 ||
+        (slots != 0 && nodes == 0))
+        detail::throw_invalid_argument();
+    std::uint64_t const size =
+        header_size +
+        std::uint64_t(slots) * slot_size +
+        std::uint64_t(nodes) * node_size +
+        labels;
+    if(size != data.size())
+        detail::throw_invalid_argument();
+    return data;
+}
+
+core::string_view
+view::
+data() const noexcept
+{
+    if(! table)
+        return {};
+    auto const first =
+        table - header_size;
+    return core::string_view(
+        first, (labels + labels_size) - first);
+}
+
+std::uint32_t
+view::
+find(
+    std::uint32_t parent,
+    core::string_view label) const noexcept
+{
+    if(table_size == 0)
+        return 0;
+    auto h = hash_parent(parent);
+    std::size_t i = 0;
+    std::size_t size = 0;
+    while(i < label.size())
+    {
+        h = hash_byte(h, static_cast<
+            unsigned char>(decoded_char(label, i)));
+        ++size;
+    }
+    auto const mask = table_size - 1;
+    auto pos = h & mask;
+    // the probe count only matters
+    // when the table is full
+    for(std::uint32_t n = 0;
+        n < table_size; ++n)
+    {
+        auto const s = table +
+            std::size_t(pos) * slot_size;
+        auto const child = load32(s + 4);
+        if(child == 0)
+            return 0;
+        auto const offset = load32(s + 8);
+        if( load32(s) == parent &&
+            load32(s + 12) == size &&
+            child < node_count &&
+            size <= labels_size &&
+            offset <= labels_size - size)
+        {
+            auto const* p = labels + offset;
+            std::size_t j = 0;
+            std::size_t k = 0;
+            while( j < label.size() &&
+                decoded_char(label, j) == p[k])
+                ++k;
+            if(k == size)
+                return child;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return 0;
+}
+
+} // label_trie
+} // detail
+} // urls
+} // boost
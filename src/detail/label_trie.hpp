@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_LABEL_TRIE_HPP
+#define BOOST_URL_DETAIL_LABEL_TRIE_HPP
+
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Layout of a compiled trie of host
+// labels, read from the rightmost label
+//
+// header:
+//      char[4]     magic
+//      uint32      version
+//      uint32      number of rules
+//      uint32      number of nodes
+//      uint32      number of slots, zero or a power of two
+//      uint32      size of the label pool
+// slots:
+//      uint32      parent node
+//      uint32      child node, zero when empty
+//      uint32      offset of the label in the pool
+//      uint32      size of the label
+// nodes:
+//      byte[]      node_size bytes per node
+// labels:
+//      char[]      lowercase labels
+//
+// The magic, the version and the
+// contents of the nodes belong to
+// the user of the trie.
+
+namespace label_trie {
+
+constexpr std::size_t header_size = 24;
+constexpr std::size_t slot_size = 16;
+
+// FNV-1a
+constexpr std::uint32_t hash_basis = 2166136261u;
+constexpr std::uint32_t hash_prime = 16777619u;
+
+inline
+std::uint32_t
+hash_byte(
+    std::uint32_t h,
+    unsigned char c) noexcept
+{
+    return (h ^ c) * hash_prime;
+}
+
+inline
+std::uint32_t
+hash_parent(
+    std::uint32_t parent) noexcept
+{
+    std::uint32_t h = hash_basis;
+    h = hash_byte(h, parent & 0xff);
+    h = hash_byte(h, (parent >> 8) & 0xff);
+    h = hash_byte(h, (parent >> 16) & 0xff);
+    h = hash_byte(h, (parent >> 24) & 0xff);
+    return h;
+}
+
+inline
+std::uint32_t
+load32(char const* p) noexcept
+{
+    auto const u = reinterpret_cast<
+        unsigned char const*>(p);
+    return
+        static_cast<std::uint32_t>(u[0]) |
+        (static_cast<std::uint32_t>(u[1]) << 8) |
+        (static_cast<std::uint32_t>(u[2]) << 16) |
+        (static_cast<std::uint32_t>(u[3]) << 24);
+}
+
+inline
+void
+store32(
+    char* p,
+    std::uint32_t v) noexcept
+{
+    p[0] = static_cast<char>(v & 0xff);
+    p[1] = static_cast<char>((v >> 8) & 0xff);
+    p[2] = static_cast<char>((v >> 16) & 0xff);
+    p[3] = static_cast<char>((v >> 24) & 0xff);
+}
+
+// Split the rightmost label from a host
+inline
+core::string_view
+pop_label(core::string_view& s) noexcept
+{
+    auto const dot = s.rfind('.');
+    if(dot == core::string_view::npos)
+    {
+        auto r = s;
+        s = {};
+        return r;
+    }
+    auto r = s.substr(dot + 1);
+    s = s.substr(0, dot);
+    return r;
+}
+
+// Collects the labels of the rules
+// and writes the image
+class builder
+{
+public:
+    builder();
+
+    // Inserts the labels of a name, which
+    // is folded to lower case, and returns
+    // the node where it ends
+    std::size_t
+    insert(core::string_view name);
+
+    std::size_t
+    node_count() const noexcept
+    {
+        return edges_.size() + 1;
+    }
+
+    // Returns the size of an image with
+    // node_size bytes per node, and sets
+    // the number of slots, or throws if
+    // the image is too large
+    std::size_t
+    image_size(std::size_t node_size);
+
+    // Writes the header and the table,
+    // and the labels after the nodes.
+    // Returns the start of the nodes.
+    char*
+    write(
+        char* p,
+        char const (&magic)[4],
+        std::uint32_t version,
+        std::size_t rules,
+        std::size_t node_size) const noexcept;
+
+private:
+    struct edge
+    {
+        std::size_t parent;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    // edges_[i] leads to node i + 1
+    std::vector<edge> edges_;
+    std::string labels_;
+    std::unordered_map<
+        std::string, std::size_t> children_;
+    std::string key_;
+    std::string name_;
+    std::size_t slots_ = 0;
+};
+
+// The trie of an image, used in place
+struct view
+{
+    char const* table = nullptr;
+    unsigned char const* nodes = nullptr;
+    char const* labels = nullptr;
+    std::uint32_t rules = 0;
+    std::uint32_t node_count = 0;
+    std::uint32_t table_size = 0;
+    std::uint32_t labels_size = 0;
+
+    view() = default;
+
+    // data is empty, or was checked
+    view(
+        core::string_view data,
+        std::size_t node_size) noexcept;
+
+    // Throws if data does not start with
+    // a supported header, or has the
+    // wrong size
+    static
+    core::string_view
+    checked(
+        core::string_view data,
+        char const (&magic)[4],
+        std::uint32_t version,
+        std::size_t node_size);
+
+    // Returns the image, which is empty
+    // when there is none
+    core::string_view
+    data() const noexcept;
+
+    // Returns the child of parent for
+    // a percent-encoded label, or zero
+    std::uint32_t
+    find(
+        std::uint32_t parent,
+        core::string_view label) const noexcept;
+};
+
+} // label_trie
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -76,20 +76,6 @@ compare_encoded(
     return 1;
 }
 
-void
-digest_encoded(
-    core::string_view s,
-    fnv_1a& hasher) noexcept
-{
-    char c = 0;
-    std::size_t n = 0;
-    while(!s.empty())
-    {
-        pop_encoded_front(s, c, n);
-        hasher.put(c);
-    }
-}
-
 int
 ci_compare_encoded(
     core::string_view lhs,
@@ -121,21 +107,6 @@ ci_compare_encoded(
     return 1;
 }
 
-void
-ci_digest_encoded(
-    core::string_view s,
-    fnv_1a& hasher) noexcept
-{
-    char c = 0;
-    std::size_t n = 0;
-    while(!s.empty())
-    {
-        pop_encoded_front(s, c, n);
-        c = grammar::to_lower(c);
-        hasher.put(c);
-    }
-}
-
 int
 compare(
     core::string_view lhs,
@@ -163,130 +134,7 @@ ci_compare(
     core::string_view lhs,
     core::string_view rhs) noexcept
 {
-    auto rlen = (std::min)(lhs.size(), rhs.size());
-    for (std::size_t i = 0; i < rlen; ++i)
-    {
-        char c0 = grammar::to_lower(lhs[i]);
-        char c1 = grammar::to_lower(rhs[i]);
-        if (c0 < c1)
-            return -1;
-        if (c1 < c0)
-            return 1;
-    }
-    if ( lhs.size() == rhs.size() )
-        return 0;
-    if ( lhs.size() < rhs.size() )
-        return -1;
-    return 1;
-}
-
-void
-ci_digest(
-    core::string_view s,
-    fnv_1a& hasher) noexcept
-{
-    for (char c: s)
-    {
-        c = grammar::to_lower(c);
-        hasher.put(c);
-    }
-}
-
-std::size_t
-path_starts_with(
-    core::string_view lhs,
-    core::string_view rhs) noexcept
-{
-    auto consume_one = [](
-        core::string_view::iterator& it,
-        char &c)
-    {
-        if(*it != '%')
-        {
-            c = *it;
-            ++it;
-            return;
-        }
-        detail::decode_unsafe(
-            &c,
-            &c + 1,
-            core::string_view(it, 3));
-        if (c != '/')
-        {
-            it += 3;
-            return;
-        }
-        c = *it;
-        ++it;
-    };
-
-    auto it0 = lhs.begin();
-    auto it1 = rhs.begin();
-    auto end0 = lhs.end();
-    auto end1 = rhs.end();
-    char c0 = 0;
-    char c1 = 0;
-    while (
-        it0 < end0 &&
-        it1 < end1)
-    {
-        consume_one(it0, c0);
-        consume_one(it1, c1);
-        if (c0 != c1)
-            return 0;
-    }
-    if (it1 == end1)
-        return it0 - lhs.begin();
-    return 0;
-}
-
-std::size_t
-path_ends_with(
-    core::string_view lhs,
-    core::string_view rhs) noexcept
-{
-    auto consume_last = [](
-        core::string_view::iterator& it,
-        core::string_view::iterator& end,
-        char& c)
-    {
-        if ((end - it) < 3 ||
-            *(std::prev(end, 3)) != '%')
-        {
-            c = *--end;
-            return;
-        }
-        detail::decode_unsafe(
-            &c,
-            &c + 1,
-            core::string_view(std::prev(
-                end, 3), 3));
-        if (c != '/')
-        {
-            end -= 3;
-            return;
-        }
-        c = *--end;
-    };
-
-    auto it0 = lhs.begin();
-    auto it1 = rhs.begin();
-    auto end0 = lhs.end();
-    auto end1 = rhs.end();
-    char c0 = 0;
-    char c1 = 0;
-    while(
-        it0 < end0 &&
-        it1 < end1)
-    {
-        consume_last(it0, end0, c0);
-        consume_last(it1, end1, c1);
-        if (c0 != c1)
-            return 0;
-    }
-    if (it1 == end1)
-        return lhs.end() - end0;
-    return 0;
+    return grammar::ci_compare(lhs, rhs);
 }
 
 std::size_t
@@ -438,6 +286,16 @@ remove_dot_segments(
         }
 
         // Rule C
+        //
+        // The backward scan for the last '/'
+        // only visits the last segment of the
+        // output, which is then erased, or is
+        // a "/.." kept by Errata 4547, which
+        // is visited in constant time. Every
+        // output character is thus visited
+        // once before it is erased, and the
+        // loop is linear in the size of the
+        // input without a stack of offsets.
         bool const is_dotdot_seg = dot_starts_with(input, "/../", n);
         if (is_dotdot_seg)
         {
@@ -564,329 +422,170 @@ remove_dot_segments(
     return dest - dest0;
 }
 
-char
-path_pop_back( core::string_view& s )
+// calculate path size as if it were normalized
+static
+std::size_t
+normalized_size(
+    segments_encoded_view seg) noexcept
 {
-    if (s.size() < 3 ||
-        *std::prev(s.end(), 3) != '%')
-    {
-        char c = s.back();
-        s.remove_suffix(1);
-        return c;
-    }
-    char c = 0;
-    detail::decode_unsafe(
-        &c, &c + 1, s.substr(s.size() - 3));
-    if (c != '/')
-    {
-        s.remove_suffix(3);
-        return c;
-    }
-    c = s.back();
-    s.remove_suffix(1);
-    return c;
-};
+    if (seg.empty())
+        return seg.is_absolute();
 
-void
-pop_last_segment(
-    core::string_view& s,
-    core::string_view& c,
-    std::size_t& level,
-    bool r) noexcept
-{
-    c = {};
     std::size_t n = 0;
-    while (!s.empty())
-    {
-        // B.  if the input buffer begins with a
-        // prefix of "/./" or "/.", where "." is
-        // a complete path segment, then replace
-        // that prefix with "/" in the input
-        // buffer; otherwise,
-        n = detail::path_ends_with(s, "/./");
-        if (n)
-        {
-            c = s.substr(s.size() - n);
-            s.remove_suffix(n);
-            continue;
-        }
-        n = detail::path_ends_with(s, "/.");
-        if (n)
-        {
-            c = s.substr(s.size() - n, 1);
-            s.remove_suffix(n);
-            continue;
-        }
-
-        // C. if the input buffer begins with a
-        // prefix of "/../" or "/..", where ".."
-        // is a complete path segment, then
-        // replace that prefix with "/" in the
-        // input buffer and remove the last
-        // segment and its preceding "/"
-        // (if any) from the output buffer
-        // otherwise,
-        n = detail::path_ends_with(s, "/../");
-        if (n)
-        {
-            c = s.substr(s.size() - n);
-            s.remove_suffix(n);
-            ++level;
-            continue;
-        }
-        n = detail::path_ends_with(s, "/..");
-        if (n)
+    std::size_t skip = 0;
+    auto begin = seg.begin();
+    auto it = seg.end();
+    while (it != begin)
+    {
+        --it;
+        decode_view dseg = **it;
+        if (dseg == "..")
+            ++skip;
+        else if (dseg != ".")
         {
-            c = s.substr(s.size() - n);
-            s.remove_suffix(n);
-            ++level;
-            continue;
-        }
-
-        // E.  move the first path segment in the
-        // input buffer to the end of the output
-        // buffer, including the initial "/"
-        // character (if any) and any subsequent
-        // characters up to, but not including,
-        // the next "/" character or the end of
-        // the input buffer.
-        std::size_t p = s.size() > 1
-            ? s.find_last_of('/', s.size() - 2)
-            : core::string_view::npos;
-        if (p != core::string_view::npos)
-        {
-            c = s.substr(p + 1);
-            s.remove_suffix(c.size());
-        }
-        else
-        {
-            c = s;
-            s = {};
+            if (skip)
+                --skip;
+            else
+                n += dseg.size() + 1;
         }
-
-        if (level == 0)
-            return;
-        if (!s.empty())
-            --level;
-    }
-    // we still need to skip n_skip + 1
-    // but the string is empty
-    if (r && level)
-    {
-        c = "/";
-        level = 0;
-        return;
     }
-    else if (level)
-    {
-        if (c.empty())
-            c = "/..";
-        else
-            c = "/../";
-        --level;
-        return;
-    }
-    c = {};
+    n += skip * 3;
+    // a relative path whose segments
+    // all cancel out is empty
+    if (n != 0)
+        n -= !seg.is_absolute();
+    return n;
 }
 
-void
-normalized_path_digest(
-    core::string_view s,
-    bool remove_unmatched,
-    fnv_1a& hasher) noexcept
+normalized_path_reader::
+normalized_path_reader(
+    segments_encoded_view seg) noexcept
+    : n_(normalized_size(seg))
+    , begin_(seg.begin())
+    , it_(seg.end())
 {
-    core::string_view child;
-    std::size_t level = 0;
-    do
+    if (it_ != begin_)
     {
-        pop_last_segment(
-            s, child, level, remove_unmatched);
-        while (!child.empty())
-        {
-            char c = path_pop_back(child);
-            hasher.put(c);
-        }
+        --it_;
+        dseg_ = **it_;
     }
-    while (!s.empty());
+    cit_ = dseg_.end();
 }
 
-// compare segments as if there were a normalized
-int
-segments_compare(
-    segments_encoded_view seg0,
-    segments_encoded_view seg1) noexcept
+// consume the last char from a segment range
+char
+normalized_path_reader::
+pop_back() noexcept
 {
-    // calculate path size as if it were normalized
-    auto normalized_size =
-        [](segments_encoded_view seg) -> std::size_t
-    {
-        if (seg.empty())
-            return seg.is_absolute();
-
-        std::size_t n = 0;
-        std::size_t skip = 0;
-        auto begin = seg.begin();
-        auto it = seg.end();
-        while (it != begin)
-        {
-            --it;
-            decode_view dseg = **it;
-            if (dseg == "..")
-                ++skip;
-            else if (dseg != ".")
-            {
-                if (skip)
-                    --skip;
-                else
-                    n += dseg.size() + 1;
-            }
-        }
-        n += skip * 3;
-        n -= !seg.is_absolute();
-        return n;
-    };
+    BOOST_ASSERT(n_ != 0);
+    if (cit_ != dseg_.begin())
+    {
+        // return last char from current segment
+        at_slash_ = false;
+        --cit_;
+        --n_;
+        return *cit_;
+    }
 
-    // find the normalized size for the comparison
-    std::size_t n0 = normalized_size(seg0);
-    std::size_t n1 = normalized_size(seg1);
-    std::size_t n00 = n0;
-    std::size_t n10 = n1;
-
-    // consume the last char from a segment range
-    auto consume_last =
-        [](
-            std::size_t& n,
-            decode_view& dseg,
-            segments_encoded_view::iterator& begin,
-            segments_encoded_view::iterator& it,
-            decode_view::iterator& cit,
-            std::size_t& skip,
-            bool& at_slash) -> char
+    if (!at_slash_)
     {
-        if (cit != dseg.begin())
-        {
-            // return last char from current segment
-            at_slash = false;
-            --cit;
-            --n;
-            return *cit;
-        }
+        // current segment dseg is over and
+        // previous char was not a slash
+        // so we output one
+        at_slash_ = true;
+        --n_;
+        return '/';
+    }
 
-        if (!at_slash)
+    // current segment dseg is over and
+    // last char was already the slash
+    // between segments, so take the
+    // next final segment to consume
+    at_slash_ = false;
+    while (cit_ == dseg_.begin())
+    {
+        // take next segment
+        if (it_ != begin_)
+            --it_;
+        else
+            break;
+        if (**it_ == "..")
         {
-            // current segment dseg is over and
-            // previous char was not a slash
-            // so we output one
-            at_slash = true;
-            --n;
-            return '/';
+            // skip next if this is ".."
+            ++skip_;
         }
-
-        // current segment dseg is over and
-        // last char was already the slash
-        // between segments, so take the
-        // next final segment to consume
-        at_slash = false;
-        while (cit == dseg.begin())
+        else if (**it_ != ".")
         {
-            // take next segment
-            if (it != begin)
-                --it;
-            else
-                break;
-            if (**it == "..")
+            if (skip_)
             {
-                // skip next if this is ".."
-                ++skip;
+                // discount skips
+                --skip_;
             }
-            else if (**it != ".")
+            else
             {
-                if (skip)
-                {
-                    // discount skips
-                    --skip;
-                }
-                else
-                {
-                    // or update current seg
-                    dseg = **it;
-                    cit = dseg.end();
-                    break;
-                }
+                // or update current seg
+                dseg_ = **it_;
+                cit_ = dseg_.end();
+                break;
             }
         }
-        // consume from the new current
-        // segment
-        --n;
-        if (cit != dseg.begin())
-        {
-            // in the general case, we consume
-            // one more character from the end
-            --cit;
-            return *cit;
-        }
+    }
+    // consume from the new current
+    // segment
+    --n_;
+    if (cit_ != dseg_.begin())
+    {
+        // in the general case, we consume
+        // one more character from the end
+        --cit_;
+        return *cit_;
+    }
 
-        // nothing left to consume in the
-        // current and new segment
-        if (it == begin)
-        {
-            // if this is the first
-            // segment, the segments are
-            // over and there can only
-            // be repetitions of "../" to
-            // output
-            return "/.."[n % 3];
-        }
-        // at other segments, we need
-        // a slash to transition to the
-        // next segment
-        at_slash = true;
-        return '/';
-    };
+    // nothing left to consume in the
+    // current and new segment
+    if (it_ == begin_)
+    {
+        // if this is the first
+        // segment, the segments are
+        // over and there can only
+        // be repetitions of "../" to
+        // output
+        return "/.."[n_ % 3];
+    }
+    // at other segments, we need
+    // a slash to transition to the
+    // next segment
+    at_slash_ = true;
+    return '/';
+}
+
+// compare segments as if there were a normalized
+int
+segments_compare(
+    segments_encoded_view seg0,
+    segments_encoded_view seg1) noexcept
+{
+    // find the normalized size for the comparison
+    normalized_path_reader r0(seg0);
+    normalized_path_reader r1(seg1);
+    std::size_t const n00 = r0.size();
+    std::size_t const n10 = r1.size();
 
     // consume final segments from seg0 that
     // should not influence the comparison
-    auto begin0 = seg0.begin();
-    auto it0 = seg0.end();
-    decode_view dseg0;
-    if (it0 != seg0.begin())
-    {
-        --it0;
-        dseg0 = **it0;
-    }
-    decode_view::iterator cit0 = dseg0.end();
-    std::size_t skip0 = 0;
-    bool at_slash0 = true;
-    while (n0 > n1)
-    {
-        consume_last(n0, dseg0, begin0, it0, cit0, skip0, at_slash0);
-    }
+    while (r0.size() > r1.size())
+        r0.pop_back();
 
     // consume final segments from seg1 that
     // should not influence the comparison
-    auto begin1 = seg1.begin();
-    auto it1 = seg1.end();
-    decode_view dseg1;
-    if (it1 != seg1.begin())
-    {
-        --it1;
-        dseg1 = **it1;
-    }
-    decode_view::iterator cit1 = dseg1.end();
-    std::size_t skip1 = 0;
-    bool at_slash1 = true;
-    while (n1 > n0)
-    {
-        consume_last(n1, dseg1, begin1, it1, cit1, skip1, at_slash1);
-    }
+    while (r1.size() > r0.size())
+        r1.pop_back();
 
     int cmp = 0;
-    while (n0)
+    while (r0.size())
     {
-        char c0 = consume_last(
-            n0, dseg0, begin0, it0, cit0, skip0, at_slash0);
-        char c1 = consume_last(
-            n1, dseg1, begin1, it1, cit1, skip1, at_slash1);
+        char c0 = r0.pop_back();
+        char c1 = r1.pop_back();
         if (c0 < c1)
             cmp = -1;
         else if (c1 < c0)
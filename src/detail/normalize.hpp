@@ -11,8 +11,12 @@
 #ifndef BOOST_URL_DETAIL_NORMALIZED_HPP
 #define BOOST_URL_DETAIL_NORMALIZED_HPP
 
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/config.hpp>
 #include <boost/core/detail/string_view.hpp>
+#include <boost/url/decode_view.hpp>
 #include "boost/url/segments_encoded_view.hpp"
+#include <cstdint>
 
 namespace boost {
 namespace urls {
@@ -67,6 +71,133 @@ private:
     std::size_t h_;
 };
 
+// A streaming hasher in the style of
+// wyhash. Characters are gathered in
+// 16-byte blocks which are folded into
+// each lane with a 64x64->128 multiply.
+// The second lane, for 128-bit digests,
+// folds the words of a block swapped
+// with different secrets.
+template<std::size_t Lanes>
+class mum_hasher
+{
+    static_assert(
+        Lanes == 1 || Lanes == 2,
+        "1 or 2 lanes");
+
+    static constexpr std::uint64_t p0 = 0xa0761d6478bd642fULL;
+    static constexpr std::uint64_t p1 = 0xe7037ed1a0b428dbULL;
+    static constexpr std::uint64_t p2 = 0x8ebc6af09c88c6e3ULL;
+    static constexpr std::uint64_t p3 = 0x589965cc75374cc3ULL;
+
+    static
+    std::uint64_t
+    mix(
+        std::uint64_t a,
+        std::uint64_t b) noexcept
+    {
+#ifdef BOOST_HAS_INT128
+        boost::uint128_type r = a;
+        r *= b;
+        return
+            static_cast<std::uint64_t>(r) ^
+            static_cast<std::uint64_t>(r >> 64);
+#else
+        std::uint64_t const ha = a >> 32;
+        std::uint64_t const hb = b >> 32;
+        std::uint64_t const la = a & 0xffffffffULL;
+        std::uint64_t const lb = b & 0xffffffffULL;
+        std::uint64_t const rh = ha * hb;
+        std::uint64_t const rm0 = ha * lb;
+        std::uint64_t const rm1 = hb * la;
+        std::uint64_t const rl = la * lb;
+        std::uint64_t const t = rl + (rm0 << 32);
+        std::uint64_t c = t < rl;
+        std::uint64_t const lo = t + (rm1 << 32);
+        c += lo < t;
+        std::uint64_t const hi =
+            rh + (rm0 >> 32) + (rm1 >> 32) + c;
+        return lo ^ hi;
+#endif
+    }
+
+    void
+    fold() noexcept
+    {
+        s_[0] = mix(w_[0] ^ p1, w_[1] ^ s_[0]);
+        if(Lanes == 2)
+            s_[Lanes - 1] = mix(
+                w_[1] ^ p3, w_[0] ^ s_[Lanes - 1]);
+        w_[0] = 0;
+        w_[1] = 0;
+        n_ = 0;
+    }
+
+public:
+    explicit
+    mum_hasher(std::uint64_t seed) noexcept
+    {
+        s_[0] = seed ^ mix(seed ^ p0, p1);
+        if(Lanes == 2)
+            s_[Lanes - 1] = seed ^ mix(seed ^ p2, p3);
+    }
+
+    void
+    put(char c) noexcept
+    {
+        w_[n_ >> 3] |= static_cast<std::uint64_t>(
+            static_cast<unsigned char>(c)) << ((n_ & 7) * 8);
+        ++len_;
+        if(++n_ == 16)
+            fold();
+    }
+
+    void
+    put(core::string_view s) noexcept
+    {
+        for (char c: s)
+        {
+            put(c);
+        }
+    }
+
+    // end a component, so the characters
+    // of adjacent components cannot be
+    // confused with each other
+    void
+    end(int id) noexcept
+    {
+        if(n_ != 0)
+            fold();
+        std::uint64_t const tag =
+            (len_ << 8) | static_cast<
+                unsigned char>(id + 1);
+        s_[0] = mix(s_[0] ^ p0, tag ^ p2);
+        if(Lanes == 2)
+            s_[Lanes - 1] = mix(
+                s_[Lanes - 1] ^ p2, tag ^ p0);
+        len_ = 0;
+    }
+
+    std::uint64_t
+    digest() const noexcept
+    {
+        return mix(s_[0] ^ p2, s_[Lanes - 1] ^ p3);
+    }
+
+    std::uint64_t
+    digest_high() const noexcept
+    {
+        return mix(s_[Lanes - 1] ^ p1, s_[0] ^ p0);
+    }
+
+private:
+    std::uint64_t s_[Lanes];
+    std::uint64_t w_[2] = {};
+    std::size_t n_ = 0;
+    std::uint64_t len_ = 0;
+};
+
 void
 pop_encoded_front(
     core::string_view& s,
@@ -82,34 +213,17 @@ compare_encoded(
 
 // digest a core::string_view as if it were
 // percent-decoded
+template<class Hasher>
 void
 digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    Hasher& hasher) noexcept;
 
 void
 digest(
     core::string_view s,
     fnv_1a& hasher) noexcept;
 
-// check if core::string_view lhs starts with core::string_view
-// rhs as if they are both percent-decoded. If
-// lhs starts with rhs, return number of chars
-// matched in the encoded core::string_view
-std::size_t
-path_starts_with(
-    core::string_view lhs,
-    core::string_view rhs) noexcept;
-
-// check if core::string_view lhs ends with core::string_view
-// rhs as if they are both percent-decoded. If
-// lhs ends with rhs, return number of chars
-// matched in the encoded core::string_view
-std::size_t
-path_ends_with(
-    core::string_view lhs,
-    core::string_view rhs) noexcept;
-
 // compare two core::string_views as if they are both
 // percent-decoded and lowercase
 int
@@ -119,10 +233,11 @@ ci_compare_encoded(
 
 // digest a core::string_view as if it were decoded
 // and lowercase
+template<class Hasher>
 void
 ci_digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    Hasher& hasher) noexcept;
 
 // compare two ascii core::string_views
 int
@@ -138,10 +253,11 @@ ci_compare(
     core::string_view rhs) noexcept;
 
 // digest a core::string_view as if it were lowercase
+template<class Hasher>
 void
 ci_digest(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    Hasher& hasher) noexcept;
 
 BOOST_URL_DECL
 std::size_t
@@ -150,27 +266,105 @@ remove_dot_segments(
     char const* end,
     core::string_view input) noexcept;
 
-void
-pop_last_segment(
-    core::string_view& s,
-    core::string_view& c,
-    std::size_t& level,
-    bool r) noexcept;
+// the characters of a path as if it
+// were normalized, from last to first
+class normalized_path_reader
+{
+    std::size_t n_;
+    decode_view dseg_;
+    segments_encoded_view::iterator begin_;
+    segments_encoded_view::iterator it_;
+    decode_view::iterator cit_;
+    std::size_t skip_ = 0;
+    bool at_slash_ = true;
 
-char
-path_pop_back( core::string_view& s );
+public:
+    explicit
+    normalized_path_reader(
+        segments_encoded_view seg) noexcept;
+
+    // the number of characters left
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    char
+    pop_back() noexcept;
+};
 
+// digest the segments as if the path
+// were normalized, consistent with
+// segments_compare
+template<class Hasher>
 void
 normalized_path_digest(
-    core::string_view s,
-    bool remove_unmatched,
-    fnv_1a& hasher) noexcept;
+    segments_encoded_view seg,
+    Hasher& hasher) noexcept;
 
 int
 segments_compare(
     segments_encoded_view seg0,
     segments_encoded_view seg1) noexcept;
 
+//------------------------------------------------
+
+template<class Hasher>
+void
+digest_encoded(
+    core::string_view s,
+    Hasher& hasher) noexcept
+{
+    char c = 0;
+    std::size_t n = 0;
+    while(!s.empty())
+    {
+        pop_encoded_front(s, c, n);
+        hasher.put(c);
+    }
+}
+
+template<class Hasher>
+void
+ci_digest_encoded(
+    core::string_view s,
+    Hasher& hasher) noexcept
+{
+    char c = 0;
+    std::size_t n = 0;
+    while(!s.empty())
+    {
+        pop_encoded_front(s, c, n);
+        c = grammar::to_lower(c);
+        hasher.put(c);
+    }
+}
+
+template<class Hasher>
+void
+ci_digest(
+    core::string_view s,
+    Hasher& hasher) noexcept
+{
+    for (char c: s)
+    {
+        c = grammar::to_lower(c);
+        hasher.put(c);
+    }
+}
+
+template<class Hasher>
+void
+normalized_path_digest(
+    segments_encoded_view seg,
+    Hasher& hasher) noexcept
+{
+    normalized_path_reader r(seg);
+    while (r.size())
+        hasher.put(r.pop_back());
+}
+
 } // detail
 } // urls
 } // boost
@@ -61,75 +61,6 @@ params_iter_impl(
         setup();
 }
 
-// set up state for key/value at pos
-void
-params_iter_impl::
-setup() noexcept
-{
-    dk = 1;
-    dv = 0;
-    auto const end = ref.end();
-    BOOST_ASSERT(pos != ref.size());
-    auto p0 = ref.begin() + pos;
-    auto p = p0;
-    // key
-    for(;;)
-    {
-        if( p == end ||
-            *p == '&')
-        {
-            // no value
-            nk = 1 + p - p0;
-            dk = nk - dk;
-            nv = 0;
-            return;
-        }
-        if(*p == '=')
-            break;
-        if(*p == '%')
-        {
-            BOOST_ASSERT(
-                end - p >= 3);
-            dk += 2;
-            p += 2;
-        }
-        ++p;
-    }
-    nk = 1 + p - p0;
-    dk = nk - dk;
-    p0 = p;
-
-    // value
-    for(;;)
-    {
-        ++p;
-        if( p == end ||
-            *p == '&')
-            break;
-        if(*p == '%')
-        {
-            BOOST_ASSERT(
-                end - p >= 3);
-            dv += 2;
-            p += 2;
-        }
-    }
-    nv = p - p0;
-    dv = nv - dv - 1;
-}
-
-void
-params_iter_impl::
-increment() noexcept
-{
-    BOOST_ASSERT(
-        index < ref.nparam());
-    pos += nk + nv;
-    ++index;
-    if(index < ref.nparam())
-        setup();
-}
-
 void
 params_iter_impl::
 decrement() noexcept
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PARSE_OPTIONS_HPP
+#define BOOST_URL_DETAIL_PARSE_OPTIONS_HPP
+
+#include <boost/url/error.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/parse_options.hpp>
+#include <boost/url/url_view_base.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// the counts are stored in the url,
+// so this is constant time
+inline
+system::result<void>
+check_limits(
+    url_view_base const& u,
+    parse_options const& opt) noexcept
+{
+    if(u.size() > opt.max_size)
+    {
+        BOOST_URL_RETURN_EC(error::too_long);
+    }
+    if(u.encoded_host().size() > opt.max_host_size)
+    {
+        BOOST_URL_RETURN_EC(error::host_too_long);
+    }
+    if(u.encoded_segments().size() > opt.max_segments)
+    {
+        BOOST_URL_RETURN_EC(error::too_many_segments);
+    }
+    if(u.encoded_params().size() > opt.max_params)
+    {
+        BOOST_URL_RETURN_EC(error::too_many_params);
+    }
+    return {};
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
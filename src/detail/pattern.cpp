@@ -22,12 +22,129 @@
 #include "boost/url/rfc/detail/path_rules.hpp"
 #include "../rfc/detail/port_rule.hpp"
 #include "../rfc/detail/scheme_rule.hpp"
+#include <string>
 
 namespace boost {
 namespace urls {
 namespace detail {
 
-static constexpr auto lhost_chars = host_chars + ':';
+namespace {
+
+// the components are the substrings
+// of the format string
+class string_source
+    : public pattern_source
+{
+    pattern const& p_;
+
+    core::string_view
+    get(int id) const noexcept
+    {
+        using parts = parts_base;
+        switch(id)
+        {
+        case parts::id_scheme: return p_.scheme;
+        case parts::id_user: return p_.user;
+        case parts::id_pass: return p_.pass;
+        case parts::id_host:
+            if (p_.host.starts_with('['))
+                return p_.host.substr(
+                    1, p_.host.size() - 2);
+            return p_.host;
+        case parts::id_port: return p_.port;
+        case parts::id_path: return p_.path;
+        case parts::id_query: return p_.query;
+        default:
+        case parts::id_frag: return p_.frag;
+        }
+    }
+
+public:
+    explicit
+    string_source(
+        pattern const& p) noexcept
+        : p_(p)
+    {
+    }
+
+    std::size_t
+    measure(
+        int id,
+        grammar::lut_chars const& cs,
+        format_parse_context& pctx,
+        measure_context& mctx) const override
+    {
+        pctx = {get(id), pctx.next_arg_id()};
+        return pct_vmeasure(cs, pctx, mctx);
+    }
+
+    char*
+    format(
+        int id,
+        grammar::lut_chars const& cs,
+        format_parse_context& pctx,
+        format_context& fctx) const override
+    {
+        pctx = {get(id), pctx.next_arg_id()};
+        return pct_vformat(cs, pctx, fctx);
+    }
+};
+
+// number of chars the emit pass inserts
+// in a formatted path which would otherwise
+// be mistaken for an authority or a scheme
+std::size_t
+path_escapes(
+    core::string_view s,
+    bool no_scheme) noexcept
+{
+    if (s.starts_with("//"))
+    {
+        // "/." is prepended
+        return 2;
+    }
+    if (!no_scheme)
+        return 0;
+    // the colons in the first
+    // segment are escaped
+    auto it = s.begin();
+    if (it != s.end() &&
+        *it == '/')
+        ++it;
+    std::size_t nc = 0;
+    while (it != s.end() &&
+        *it != '/')
+        nc += *it++ == ':';
+    return nc * 2;
+}
+
+// the escapes of a path with replacement
+// fields, which is formatted to count them
+std::size_t
+measure_path_escapes(
+    pattern_source const& src,
+    format_parse_context pctx,
+    format_args const& args,
+    std::size_t n,
+    bool no_scheme)
+{
+    char small[128];
+    std::string big;
+    char* buf = small;
+    if (n > sizeof(small))
+    {
+        big.resize(n);
+        buf = &big[0];
+    }
+    format_context fctx(buf, args);
+    char const* end = src.format(
+        parts_base::id_path, path_chars, pctx, fctx);
+    return path_escapes(
+        core::string_view(buf, end - buf),
+        no_scheme);
+}
+
+} // (anon)
 
 void
 pattern::
@@ -35,6 +152,17 @@ apply(
     url_base& u,
     format_args const& args) const
 {
+    apply(u, args, string_source(*this));
+}
+
+void
+pattern::
+apply(
+    url_base& u,
+    format_args const& args,
+    pattern_source const& src) const
+{
+    using parts = parts_base;
     // measure total
     struct sizes
     {
@@ -53,8 +181,7 @@ apply(
     measure_context mctx(args);
     if (!scheme.empty())
     {
-        pctx = {scheme, pctx.next_arg_id()};
-        n.scheme = pct_vmeasure(
+        n.scheme = src.measure(parts::id_scheme,
             grammar::alpha_chars, pctx, mctx);
         mctx.advance_to(0);
     }
@@ -62,14 +189,12 @@ apply(
     {
         if (has_user)
         {
-            pctx = {user, pctx.next_arg_id()};
-            n.user = pct_vmeasure(
+            n.user = src.measure(parts::id_user,
                 user_chars, pctx, mctx);
             mctx.advance_to(0);
             if (has_pass)
             {
-                pctx = {pass, pctx.next_arg_id()};
-                n.pass = pct_vmeasure(
+                n.pass = src.measure(parts::id_pass,
                     password_chars, pctx, mctx);
                 mctx.advance_to(0);
             }
@@ -77,78 +202,134 @@ apply(
         if (host.starts_with('['))
         {
             BOOST_ASSERT(host.ends_with(']'));
-            pctx = {host.substr(1, host.size() - 2), pctx.next_arg_id()};
-            n.host = pct_vmeasure(
+            n.host = src.measure(parts::id_host,
                 lhost_chars, pctx, mctx) + 2;
             mctx.advance_to(0);
         }
         else
         {
-            pctx = {host, pctx.next_arg_id()};
-            n.host = pct_vmeasure(
+            n.host = src.measure(parts::id_host,
                 host_chars, pctx, mctx);
             mctx.advance_to(0);
         }
         if (has_port)
         {
-            pctx = {port, pctx.next_arg_id()};
-            n.port = pct_vmeasure(
+            n.port = src.measure(parts::id_port,
                 grammar::digit_chars, pctx, mctx);
             mctx.advance_to(0);
         }
     }
+    std::size_t n_escapes = 0;
     if (!path.empty())
     {
-        pctx = {path, pctx.next_arg_id()};
-        n.path = pct_vmeasure(
+        format_parse_context const pctx0 = pctx;
+        n.path = src.measure(parts::id_path,
             path_chars, pctx, mctx);
         mctx.advance_to(0);
+        if (!has_authority &&
+            !u.has_authority())
+        {
+            bool const no_scheme =
+                scheme.empty() && !u.has_scheme();
+            // a literal path is formatted
+            // as it is written
+            if (path.find('{') == core::string_view::npos)
+                n_escapes = path_escapes(
+                    path, no_scheme);
+            else
+                n_escapes = measure_path_escapes(
+                    src, pctx0, args, n.path,
+                    no_scheme);
+        }
     }
     if (has_query)
     {
-        pctx = {query, pctx.next_arg_id()};
-        n.query = pct_vmeasure(
+        n.query = src.measure(parts::id_query,
             query_chars, pctx, mctx);
         mctx.advance_to(0);
     }
     if (has_frag)
     {
-        pctx = {frag, pctx.next_arg_id()};
-        n.frag = pct_vmeasure(
+        n.frag = src.measure(parts::id_frag,
             fragment_chars, pctx, mctx);
         mctx.advance_to(0);
     }
-    std::size_t const n_total =
-        n.scheme +
-        (n.scheme != 0) * 1 + // ":"
-        has_authority * 2 +   // "//"
-        n.user +
-        has_pass * 1 +        // ":"
-        n.pass +
-        has_user * 1 +        // "@"
-        n.host +
-        has_port * 1 +        // ":"
-        n.port +
-        n.path +
-        has_query * 1 +       // "?"
-        n.query +
-        has_frag * 1 +        // "#"
-        n.frag;
+    // The components not in the pattern
+    // are kept, so the final size is known
+    // and reserved before anything is
+    // written. This is also where a
+    // static_url which cannot fit the
+    // result throws, leaving it unchanged.
+    std::size_t n_total = 0;
+    if (!scheme.empty())
+        n_total += n.scheme + 1;   // ":"
+    else
+        n_total += u.impl_.len(parts::id_scheme);
+    bool const had_authority =
+        u.impl_.len(parts::id_user) != 0;
+    bool make_absolute = false;
+    if (has_authority)
+    {
+        n_total += 2;              // "//"
+        if (has_user)
+        {
+            n_total += n.user;
+            if (has_pass)
+                n_total += n.pass + 2; // ":" "@"
+            else if (u.impl_.len(parts::id_pass) != 0)
+                n_total += u.impl_.len(parts::id_pass);
+            else
+                n_total += 1;      // "@"
+        }
+        else if (had_authority)
+        {
+            n_total +=
+                u.impl_.len(parts::id_user) - 2 +
+                u.impl_.len(parts::id_pass);
+        }
+        n_total += n.host;
+        if (has_port)
+            n_total += n.port + 1; // ":"
+        else if (had_authority)
+            n_total += u.impl_.len(parts::id_port);
+        // a kept relative path becomes absolute
+        make_absolute =
+            !had_authority &&
+            path.empty() &&
+            !u.is_path_absolute() &&
+            u.impl_.len(parts::id_path) != 0;
+    }
+    else
+    {
+        n_total += u.impl_.len(
+            parts::id_user, parts::id_path);
+    }
+    if (!path.empty())
+        n_total += n.path + n_escapes;
+    else
+        n_total += u.impl_.len(parts::id_path) +
+            make_absolute;
+    if (has_query)
+        n_total += n.query + 1;    // "?"
+    else
+        n_total += u.impl_.len(parts::id_query);
+    if (has_frag)
+        n_total += n.frag + 1;     // "#"
+    else
+        n_total += u.impl_.len(parts::id_frag);
     u.reserve(n_total);
 
     // Apply
     pctx = {nullptr, nullptr, 0};
     format_context fctx(nullptr, args);
     url_base::op_t op(u);
-    using parts = parts_base;
     if (!scheme.empty())
     {
         auto dest = u.resize_impl(
             parts::id_scheme,
             n.scheme + 1, op);
-        pctx = {scheme, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        const char* dest1 = pct_vformat(
+        const char* dest1 = src.format(parts::id_scheme,
             grammar::alpha_chars, pctx, fctx);
         dest[n.scheme] = ':';
         // validate
@@ -163,9 +344,8 @@ apply(
         {
             auto dest = u.set_user_impl(
                 n.user, op);
-            pctx = {user, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 = pct_vformat(
+            char const* dest1 = src.format(parts::id_user,
                 user_chars, pctx, fctx);
             u.impl_.decoded_[parts::id_user] =
                 pct_string_view(dest, dest1 - dest)
@@ -174,9 +354,8 @@ apply(
             {
                 char* destp = u.set_password_impl(
                     n.pass, op);
-                pctx = {pass, pctx.next_arg_id()};
                 fctx.advance_to(destp);
-                dest1 = pct_vformat(
+                dest1 = src.format(parts::id_pass,
                     password_chars, pctx, fctx);
                 u.impl_.decoded_[parts::id_pass] =
                     pct_string_view({destp, dest1})
@@ -188,11 +367,10 @@ apply(
         if (host.starts_with('['))
         {
             BOOST_ASSERT(host.ends_with(']'));
-            pctx = {host.substr(1, host.size() - 2), pctx.next_arg_id()};
             *dest++ = '[';
             fctx.advance_to(dest);
-            char* dest1 =
-                pct_vformat(lhost_chars, pctx, fctx);
+            char* dest1 = src.format(parts::id_host,
+                lhost_chars, pctx, fctx);
             *dest1++ = ']';
             u.impl_.decoded_[parts::id_host] =
                 pct_string_view(dest - 1, dest1 - dest)
@@ -200,10 +378,9 @@ apply(
         }
         else
         {
-            pctx = {host, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 =
-                pct_vformat(host_chars, pctx, fctx);
+            char const* dest1 = src.format(parts::id_host,
+                host_chars, pctx, fctx);
             u.impl_.decoded_[parts::id_host] =
                 pct_string_view(dest, dest1 - dest)
                     ->decoded_size();
@@ -218,9 +395,8 @@ apply(
         if (has_port)
         {
             dest = u.set_port_impl(n.port, op);
-            pctx = {port, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 = pct_vformat(
+            char const* dest1 = src.format(parts::id_port,
                 grammar::digit_chars, pctx, fctx);
             u.impl_.decoded_[parts::id_port] =
                 pct_string_view(dest, dest1 - dest)
@@ -236,9 +412,8 @@ apply(
         auto dest = u.resize_impl(
             parts::id_path,
             n.path, op);
-        pctx = {path, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
+        auto dest1 = src.format(parts::id_path,
             path_chars, pctx, fctx);
         pct_string_view npath(dest, dest1 - dest);
         u.impl_.decoded_[parts::id_path] +=
@@ -263,7 +438,7 @@ apply(
             if (nc)
             {
                 std::size_t diff = nc * 2;
-                u.reserve(n_total + diff);
+                BOOST_ASSERT(diff == n_escapes);
                 dest = u.resize_impl(
                     parts::id_path,
                     n.path + diff, op);
@@ -290,7 +465,7 @@ apply(
         if (!u.has_authority() &&
             u.encoded_path().starts_with("//"))
         {
-            u.reserve(n_total + 2);
+            BOOST_ASSERT(n_escapes == 2);
             dest = u.resize_impl(
                 parts::id_path,
                 n.path + 2, op);
@@ -305,9 +480,8 @@ apply(
             parts::id_query,
             n.query + 1, op);
         *dest++ = '?';
-        pctx = {query, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
+        auto dest1 = src.format(parts::id_query,
             query_chars, pctx, fctx);
         pct_string_view nquery(dest, dest1 - dest);
         u.impl_.decoded_[parts::id_query] +=
@@ -325,15 +499,15 @@ apply(
             parts::id_frag,
             n.frag + 1, op);
         *dest++ = '#';
-        pctx = {frag, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
+        auto dest1 = src.format(parts::id_frag,
             fragment_chars, pctx, fctx);
         u.impl_.decoded_[parts::id_frag] +=
             make_pct_string_view(
                 core::string_view(dest, dest1 - dest))
                 ->decoded_size() + 1;
     }
+    BOOST_ASSERT(u.size() == n_total);
 }
 
 // This rule represents a pct-encoded string
@@ -12,6 +12,8 @@
 
 #include "boost/url/error_types.hpp"
 #include "boost/url/url_base.hpp"
+#include "boost/url/detail/format_args.hpp"
+#include "../rfc/detail/charsets.hpp"
 #include <boost/core/detail/string_view.hpp>
 
 // This file includes functions and classes
@@ -23,6 +25,33 @@ namespace detail {
 
 class format_args;
 
+// chars of an IP-literal host in a pattern
+constexpr auto lhost_chars = host_chars + ':';
+
+// Produces the characters of each
+// component of a pattern
+class pattern_source
+{
+public:
+    // measure the component id
+    virtual
+    std::size_t
+    measure(
+        int id,
+        grammar::lut_chars const& cs,
+        format_parse_context& pctx,
+        measure_context& mctx) const = 0;
+
+    // format the component id
+    virtual
+    char*
+    format(
+        int id,
+        grammar::lut_chars const& cs,
+        format_parse_context& pctx,
+        format_context& fctx) const = 0;
+};
+
 struct pattern
 {
     core::string_view scheme;
@@ -46,6 +75,15 @@ struct pattern
     apply(
         url_base& u,
         format_args const& args) const;
+
+    // apply with the components
+    // produced by src
+    BOOST_URL_DECL
+    void
+    apply(
+        url_base& u,
+        format_args const& args,
+        pattern_source const& src) const;
 };
 
 BOOST_URL_DECL
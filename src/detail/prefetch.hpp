@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PREFETCH_HPP
+#define BOOST_URL_DETAIL_PREFETCH_HPP
+
+#include <boost/url/detail/config.hpp>
+#if defined(BOOST_URL_USE_SSE2) && defined(BOOST_MSVC)
+# include <xmmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Hint that p will be read soon
+inline
+void
+prefetch(void const* p) noexcept
+{
+#if defined(BOOST_GCC) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(BOOST_URL_USE_SSE2) && defined(BOOST_MSVC)
+    _mm_prefetch(static_cast<char const*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PUBLIC_SUFFIX_LIST_HPP
+#define BOOST_URL_DETAIL_PUBLIC_SUFFIX_LIST_HPP
+
+#include "label_trie.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A compiled public suffix list is a
+// label trie, see label_trie.hpp, with
+// one byte of flags per node
+
+namespace psl {
+
+constexpr char magic[4] = {
+    '\x7f', 'P', 'S', 'L' };
+constexpr std::uint32_t version = 1;
+constexpr std::size_t node_size = 1;
+
+// The node has a rule ending on it
+constexpr unsigned char is_rule = 1;
+// Any child of the node is a rule
+constexpr unsigned char is_wildcard = 2;
+// The node is an exception rule
+constexpr unsigned char is_exception = 4;
+
+} // psl
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -10,15 +10,20 @@
 #ifndef BOOST_URL_DETAIL_ROUTER_IPP
 #define BOOST_URL_DETAIL_ROUTER_IPP
 
-#include "../router.hpp"
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/router.hpp>
 #include <boost/url/decode_view.hpp>
 #include <boost/url/grammar/alnum_chars.hpp>
 #include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/basic_range_rule.hpp>
 #include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 #include <boost/url/grammar/variant_rule.hpp>
 #include <boost/url/rfc/detail/path_rules.hpp>
 #include <boost/url/detail/replacement_field_rule.hpp>
+#include "prefetch.hpp"
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 namespace boost {
@@ -47,9 +52,6 @@ class segment_template
 public:
     segment_template() = default;
 
-    bool
-    match(pct_string_view seg) const;
-
     core::string_view
     string() const
     {
@@ -152,23 +154,12 @@ constexpr auto path_template_rule =
         grammar::squelch(
             grammar::optional_rule(
                 grammar::delim_rule('/'))),
-        grammar::range_rule(
+        grammar::basic_range_rule(
             segment_template_rule,
             grammar::tuple_rule(
                 grammar::squelch(grammar::delim_rule('/')),
                 segment_template_rule)));
 
-bool
-segment_template::
-match(pct_string_view seg) const
-{
-    if (is_literal_)
-        return *seg == str_;
-
-    // other nodes match any string
-    return true;
-}
-
 core::string_view
 segment_template::
 id() const
@@ -278,12 +269,12 @@ public:
         std::memcpy(static_child_idx_, other.static_child_idx_, size_ * sizeof(std::size_t));
     }
 
-    child_idx_vector(child_idx_vector&& other)
+    child_idx_vector(child_idx_vector&& other) noexcept
         : child_idx{other.child_idx}
         , size_{other.size_}
         , cap_{other.cap_}
     {
-        std::memcpy(static_child_idx_, other.static_child_idx_, N);
+        std::memcpy(static_child_idx_, other.static_child_idx_, N * sizeof(std::size_t));
         other.child_idx = nullptr;
     }
 
@@ -330,11 +321,20 @@ public:
     void
     erase(std::size_t* it)
     {
-        BOOST_ASSERT(it - begin() >= 0);
-        std::memmove(it - 1, it, end() - it);
+        BOOST_ASSERT(it >= begin() && it < end());
+        std::memmove(it, it + 1, (end() - it - 1) * sizeof(std::size_t));
         --size_;
     }
 
+    void
+    insert(std::size_t const* pos, std::size_t v)
+    {
+        BOOST_ASSERT(pos >= begin() && pos <= end());
+        std::size_t const i = pos - begin();
+        push_back(v);
+        std::rotate(begin() + i, end() - 1, end());
+    }
+
     void
     push_back(std::size_t v)
     {
@@ -376,8 +376,16 @@ struct node
     // implementation pool of nodes
     std::size_t parent_idx{npos};
 
-    // Index of child nodes in the pool
+    // Index of child nodes in the pool. The
+    // literal segments come first, sorted by
+    // their decoded strings so they can be
+    // found with a binary search. They are
+    // followed by the replacement fields in
+    // order of precedence.
     detail::child_idx_vector child_idx;
+
+    // Number of literal segments in child_idx
+    std::size_t literals{0};
 };
 
 class impl
@@ -411,7 +419,30 @@ public:
         core::string_view*& matches,
         core::string_view*& ids) const;
 
+    // match a batch of paths
+    void
+    find_many_impl(
+        segments_encoded_view const* paths,
+        std::size_t n,
+        router_base::any_resource const** rs,
+        core::string_view** matches,
+        core::string_view** ids) const;
+
 private:
+    // find the literal child matching a
+    // request segment
+    node const*
+    find_literal(
+        node const& n,
+        pct_string_view s) const noexcept;
+
+    // find or create the child of a node
+    // for a segment template
+    std::size_t
+    emplace_child(
+        std::size_t parent_idx,
+        segment_template const& seg);
+
     // try to match from this root node
     node const*
     try_match(
@@ -434,6 +465,83 @@ private:
         core::string_view*& ids);
 };
 
+node const*
+impl::
+find_literal(
+    node const& n,
+    pct_string_view s) const noexcept
+{
+    auto const first = n.child_idx.begin();
+    auto const last = first + n.literals;
+    decode_view const ds = *s;
+    auto const it = std::lower_bound(
+        first, last, ds,
+        [this](std::size_t i, decode_view const& v)
+        {
+            return v.compare(nodes_[i].seg.string()) > 0;
+        });
+    if (it != last &&
+        ds == nodes_[*it].seg.string())
+        return &nodes_[*it];
+    return nullptr;
+}
+
+std::size_t
+impl::
+emplace_child(
+    std::size_t parent_idx,
+    segment_template const& seg)
+{
+    // look for an existing child
+    auto const& cs = nodes_[parent_idx].child_idx;
+    auto const lits = cs.begin() + nodes_[parent_idx].literals;
+    std::size_t const* pos;
+    if (seg.is_literal())
+    {
+        pos = std::lower_bound(
+            cs.begin(), lits, seg.string(),
+            [this](std::size_t i, core::string_view v)
+            {
+                return nodes_[i].seg.string() < v;
+            });
+        if (pos != lits &&
+            nodes_[*pos].seg.string() == seg.string())
+            return *pos;
+    }
+    else
+    {
+        auto const it = std::find_if(
+            lits, cs.end(),
+            [this, &seg](std::size_t i)
+            {
+                return nodes_[i].seg == seg;
+            });
+        if (it != cs.end())
+            return *it;
+        // keep fields sorted by precedence
+        pos = std::upper_bound(
+            lits, cs.end(), seg,
+            [this](segment_template const& v, std::size_t i)
+            {
+                return v < nodes_[i].seg;
+            });
+    }
+
+    // create child if it doesn't exist
+    std::size_t const i = pos - cs.begin();
+    node child;
+    child.seg = seg;
+    child.parent_idx = parent_idx;
+    nodes_.push_back(std::move(child));
+    node& p = nodes_[parent_idx];
+    p.child_idx.insert(
+        p.child_idx.begin() + i,
+        nodes_.size() - 1);
+    if (seg.is_literal())
+        ++p.literals;
+    return nodes_.size() - 1;
+}
+
 node const*
 impl::
 find_optional_resource(
@@ -446,9 +554,11 @@ find_optional_resource(
     if (root->resource)
         return root;
     BOOST_ASSERT(!root->child_idx.empty());
-    for (auto i: root->child_idx)
+    auto const first =
+        root->child_idx.begin() + root->literals;
+    for (auto it = first; it != root->child_idx.end(); ++it)
     {
-        auto& c = ns[i];
+        auto& c = ns[*it];
         if (!c.seg.is_optional() &&
             !c.seg.is_star())
             continue;
@@ -519,10 +629,12 @@ insert_impl(
                 node* p = &nodes_[p_idx];
                 std::size_t cur_idx = cur - nodes_.data();
                 p->child_idx.erase(
-                    std::remove(
+                    std::find(
                         p->child_idx.begin(),
                         p->child_idx.end(),
                         cur_idx));
+                if (cur->seg.is_literal())
+                    --p->literals;
                 nodes_.pop_back();
             }
             cur = &nodes_[p_idx];
@@ -536,44 +648,10 @@ insert_impl(
             ++it;
             continue;
         }
-        // look for child
-        auto cit = std::find_if(
-            cur->child_idx.begin(),
-            cur->child_idx.end(),
-            [this, &it](std::size_t ci) -> bool
-            {
-                return nodes_[ci].seg == *it;
-            });
-        if (cit != cur->child_idx.end())
-        {
-            // move to existing child
-            cur = &nodes_[*cit];
-        }
-        else
-        {
-            // create child if it doesn't exist
-            node child;
-            child.seg = *it;
-            std::size_t cur_id = cur - nodes_.data();
-            child.parent_idx = cur_id;
-            nodes_.push_back(std::move(child));
-            nodes_[cur_id].child_idx.push_back(nodes_.size() - 1);
-            if (nodes_[cur_id].child_idx.size() > 1)
-            {
-                // keep nodes sorted
-                auto& cs = nodes_[cur_id].child_idx;
-                std::size_t n = cs.size() - 1;
-                while (n)
-                {
-                    if (nodes_[cs.begin()[n]].seg < nodes_[cs.begin()[n - 1]].seg)
-                        std::swap(cs.begin()[n], cs.begin()[n - 1]);
-                    else
-                        break;
-                    --n;
-                }
-            }
-            cur = &nodes_.back();
-        }
+        // move to the child, creating it
+        // if it doesn't exist
+        cur = &nodes_[emplace_child(
+            cur - nodes_.data(), *it)];
         ++it;
     }
     if (level != 0)
@@ -646,27 +724,24 @@ try_match(
         // resource. Otherwise, we can just
         // consume the node and input without
         // any recursive function calls.
+        // At most one literal child can match,
+        // and it is found with a binary search.
+        // Replacement fields match any segment.
+        node const* lit = find_literal(*cur, s);
+        auto fit = cur->child_idx.begin() + cur->literals;
+        auto const fend = cur->child_idx.end();
         bool branch = false;
-        if (cur->child_idx.size() > 1)
         {
-            int branches_lb = 0;
-            for (auto i: cur->child_idx)
+            // a literal path counts only
+            // if it matches
+            int branches_lb = lit != nullptr;
+            for (auto f = fit; f != fend; ++f)
             {
-                auto& c = nodes_[i];
-                if (c.seg.is_literal() ||
-                    !c.seg.has_modifier())
-                {
-                    // a literal path counts only
-                    // if it matches
-                    branches_lb += c.seg.match(s);
-                }
-                else
-                {
-                    // everything not matching
-                    // a single path counts as
-                    // more than one path already
-                    branches_lb = 2;
-                }
+                // everything not matching
+                // a single path counts as
+                // more than one path already
+                branches_lb +=
+                    nodes_[*f].seg.has_modifier() ? 2 : 1;
                 if (branches_lb > 1)
                 {
                     // already know we need to
@@ -677,13 +752,16 @@ try_match(
             }
         }
 
-        // attempt to match each child node
+        // attempt to match the literal child
+        // and then each replacement field
         node const* r = nullptr;
         bool match_any = false;
-        for (auto i: cur->child_idx)
+        for (node const* pc = lit ? lit :
+                (fit != fend ? &nodes_[*fit++] : nullptr);
+            pc;
+            pc = fit != fend ? &nodes_[*fit++] : nullptr)
         {
-            auto& c = nodes_[i];
-            if (c.seg.match(s))
+            auto& c = *pc;
             {
                 if (c.seg.is_literal())
                 {
@@ -910,6 +988,89 @@ find_impl(
     return nullptr;
 }
 
+void
+impl::
+find_many_impl(
+    segments_encoded_view const* paths,
+    std::size_t n,
+    router_base::any_resource const** rs,
+    core::string_view** matches,
+    core::string_view** ids) const
+{
+    BOOST_ASSERT(n <= router_base::batch_size);
+    struct cursor
+    {
+        segments_encoded_view::const_iterator it;
+        segments_encoded_view::const_iterator end;
+        node const* cur;
+    };
+    cursor cs[router_base::batch_size];
+    std::size_t walking[router_base::batch_size];
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // parse_path is inconsistent for empty paths
+        segments_encoded_view path = paths[i];
+        if (path.empty())
+            path = segments_encoded_view("./");
+        cs[i].it = path.begin();
+        cs[i].end = path.end();
+        cs[i].cur = &nodes_.front();
+        walking[i] = i;
+    }
+
+    // Walk the paths together, one level at
+    // a time, while each one has a single
+    // way forward: a literal child and no
+    // replacement fields. Everything else
+    // is left to try_match, which continues
+    // from the same node. The nodes each
+    // path reads next are prefetched while
+    // the other paths are matched.
+    std::size_t nw = n;
+    while (nw != 0)
+    {
+        std::size_t j = 0;
+        while (j < nw)
+        {
+            auto& c = cs[walking[j]];
+            node const* next = nullptr;
+            if (c.it != c.end &&
+                c.cur->literals == c.cur->child_idx.size())
+            {
+                pct_string_view s = *c.it;
+                if (*s != "." &&
+                    *s != "..")
+                    next = find_literal(*c.cur, s);
+            }
+            if (!next)
+            {
+                walking[j] = walking[--nw];
+                continue;
+            }
+            c.cur = next;
+            ++c.it;
+            if (!next->child_idx.empty())
+            {
+                // the children of the next node,
+                // and the first probe of the
+                // binary search among them
+                auto const first = next->child_idx.begin();
+                prefetch(first);
+                prefetch(&nodes_[first[next->literals / 2]]);
+            }
+            ++j;
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        node const* p = try_match(
+            cs[i].it, cs[i].end, cs[i].cur, 0,
+            matches[i], ids[i]);
+        rs[i] = p ? p->resource : nullptr;
+    }
+}
+
 router_base::
 router_base()
     : impl_(new impl{}) {}
@@ -942,6 +1103,19 @@ find_impl(
         ->find_impl(path, matches, ids);
 }
 
+void
+router_base::
+find_many_impl(
+    segments_encoded_view const* paths,
+    std::size_t n,
+    any_resource const** rs,
+    core::string_view** matches,
+    core::string_view** ids) const noexcept
+{
+    reinterpret_cast<impl*>(impl_)
+        ->find_many_impl(paths, n, rs, matches, ids);
+}
+
 } // detail
 } // urls
 } // boost
@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_SCHEME_KEY_HPP
+#define BOOST_URL_DETAIL_SCHEME_KEY_HPP
+
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The longest scheme with a key
+constexpr std::size_t scheme_key_size = 8;
+
+// Pack a string of up to eight characters
+// into an integer, so it can be compared
+// with a single instruction. The windows
+// may overlap, but every character is
+// included, so the keys of two strings
+// of the same size are equal only when
+// the strings are equal.
+inline
+std::uint64_t
+scheme_key(
+    char const* p,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n <= scheme_key_size);
+    if(n >= 4)
+    {
+        std::uint32_t lo;
+        std::uint32_t hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + n - 4, 4);
+        return lo | (
+            std::uint64_t(hi) << 32);
+    }
+    if(n == 0)
+        return 0;
+    return
+        std::uint64_t(static_cast<
+            unsigned char>(p[0])) |
+        (std::uint64_t(static_cast<
+            unsigned char>(p[n / 2])) << 8) |
+        (std::uint64_t(static_cast<
+            unsigned char>(p[n - 1])) << 16);
+}
+
+template<std::size_t N>
+std::uint64_t
+scheme_key(char const(&s)[N]) noexcept
+{
+    return scheme_key(s, N - 1);
+}
+
+// The bits to OR into the key of a string
+// so that the letters of a lowercase name
+// match in either case. Only the letters
+// are folded, because OR-ing 0x20 into
+// other characters can produce a digit,
+// but never a letter.
+inline
+std::uint64_t
+scheme_fold_mask(
+    char const* p,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n <= scheme_key_size);
+    char m[scheme_key_size];
+    for(std::size_t i = 0; i < n; ++i)
+        m[i] = (p[i] >= 'a' &&
+            p[i] <= 'z') ? 0x20 : 0;
+    return scheme_key(m, n);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_SCHEME_TABLE_HPP
+#define BOOST_URL_DETAIL_SCHEME_TABLE_HPP
+
+#include <boost/url/scheme.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct known_scheme
+{
+    char const* name;
+    std::size_t size;
+    scheme id;
+    std::uint16_t default_port;
+};
+
+// The known schemes, in the order of
+// the enumeration, starting at ftp.
+// Every function which maps schemes to
+// names or ports reads this table.
+constexpr known_scheme known_schemes[] = {
+    { "ftp",   3, scheme::ftp,   21 },
+    { "file",  4, scheme::file,  0 },
+    { "http",  4, scheme::http,  80 },
+    { "https", 5, scheme::https, 443 },
+    { "ws",    2, scheme::ws,    80 },
+    { "wss",   3, scheme::wss,   443 },
+};
+
+constexpr std::size_t known_scheme_count =
+    sizeof(known_schemes) / sizeof(known_schemes[0]);
+
+static_assert(
+    known_schemes[0].id == scheme::ftp &&
+    known_schemes[known_scheme_count - 1].id == scheme::wss,
+    "known_schemes must follow the enumeration");
+
+// Return the entry of a known scheme,
+// or null for none and unknown
+inline
+known_scheme const*
+find_known_scheme(scheme s) noexcept
+{
+    auto const i =
+        static_cast<std::size_t>(s) -
+        static_cast<std::size_t>(scheme::ftp);
+    if(i >= known_scheme_count)
+        return nullptr;
+    return &known_schemes[i];
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
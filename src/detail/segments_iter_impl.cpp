@@ -92,42 +92,6 @@ update() noexcept
         p0, p - p0, dn);
 }
 
-void
-segments_iter_impl::
-increment() noexcept
-{
-    BOOST_ASSERT(
-        index != ref.nseg());
-    ++index;
-    pos = next;
-    if(index == ref.nseg())
-        return;
-    // "/" segment
-    auto const end = ref.end();
-    auto p = ref.data() + pos;
-    BOOST_ASSERT(p != end);
-    BOOST_ASSERT(*p == '/');
-    dn = 0;
-    ++p; // skip '/'
-    auto const p0 = p;
-    while(p != end)
-    {
-        if(*p == '/')
-            break;
-        if(*p != '%')
-        {
-            ++p;
-            continue;
-        }
-        p += 3;
-        dn += 2;
-    }
-    next = p - ref.data();
-    dn = p - p0 - dn;
-    s_ = make_pct_string_view_unsafe(
-        p0, p - p0, dn);
-}
-
 void
 segments_iter_impl::
 decrement() noexcept
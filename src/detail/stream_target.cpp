@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/stream_target.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/rfc/gen_delim_chars.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// Every character which can appear in
+// a URL, except the '%' of escapes
+constexpr auto target_chars =
+    unreserved_chars +
+    gen_delim_chars +
+    sub_delim_chars;
+
+} // (anon)
+
+system::result<std::size_t>
+stream_target::
+write(core::string_view s)
+{
+    if(ec_.failed())
+        return ec_;
+    if(done_)
+        return 0;
+    auto const first = s.data();
+    auto const end = first + s.size();
+    auto it = first;
+    while(it != end)
+    {
+        if(pct_ != 0)
+        {
+            if(! grammar::hexdig_chars(*it))
+            {
+                // expected HEXDIG
+                ec_ = BOOST_URL_ERR(
+                    grammar::error::invalid);
+                return ec_;
+            }
+            --pct_;
+            ++it;
+            continue;
+        }
+        it = grammar::find_if_not(
+            it, end, target_chars);
+        if(it == end)
+            break;
+        if(*it != '%')
+        {
+            // the end of the target
+            done_ = true;
+            break;
+        }
+        pct_ = 2;
+        ++it;
+    }
+    std::size_t const n = it - first;
+    if( n == 0 &&
+        ! done_)
+        return n;
+    if( done_ &&
+        ! in_buf_)
+    {
+        // the whole target is in this
+        // chunk, so nothing is copied
+        s_ = core::string_view(first, n);
+    }
+    else
+    {
+        // the caller may reuse the chunk
+        // before the target is complete
+        if(! in_buf_)
+        {
+            buf_.clear();
+            in_buf_ = true;
+        }
+        buf_.append(first, n);
+    }
+    size_ += n;
+    return n;
+}
+
+system::result<core::string_view>
+stream_target::
+finish() noexcept
+{
+    if(ec_.failed())
+        return ec_;
+    done_ = true;
+    if(in_buf_)
+        return core::string_view(buf_);
+    return s_;
+}
+
+void
+stream_target::
+reset() noexcept
+{
+    // buf_ keeps its capacity
+    buf_.clear();
+    s_ = {};
+    ec_ = {};
+    size_ = 0;
+    pct_ = 0;
+    done_ = false;
+    in_buf_ = false;
+}
+
+} // detail
+} // urls
+} // boost
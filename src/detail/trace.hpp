@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_TRACE_HPP
+#define BOOST_URL_DETAIL_TRACE_HPP
+
+// Static tracepoints of the provider
+// boost_url, for tools such as bpftrace,
+// perf and SystemTap:
+//
+//  parse_uri_entry             char const*, size
+//  parse_uri_return            ok
+//  parse_uri_reference_entry   char const*, size
+//  parse_uri_reference_return  ok
+//  parse_origin_form_entry     char const*, size
+//  parse_origin_form_return    ok
+//  resize_entry                old size, new size
+//  resize_return               size
+//  reallocate                  old capacity, new capacity
+//  normalize_entry             size
+//  normalize_return            size
+//
+// They are only compiled when the library
+// is built with BOOST_URL_ENABLE_TRACEPOINTS,
+// which needs <sys/sdt.h>. An inactive
+// tracepoint is a single nop, and its
+// arguments are only read by the tracer.
+//
+// Example:
+//
+//  bpftrace -e 'usdt:./app:boost_url:parse_uri_entry
+//      { @start[tid] = nsecs; }
+//    usdt:./app:boost_url:parse_uri_return
+//      { @ns = hist(nsecs - @start[tid]); }'
+
+#ifdef BOOST_URL_ENABLE_TRACEPOINTS
+
+#include <sys/sdt.h>
+
+#define BOOST_URL_TRACE1(name, a0) \
+    DTRACE_PROBE1(boost_url, name, a0)
+#define BOOST_URL_TRACE2(name, a0, a1) \
+    DTRACE_PROBE2(boost_url, name, a0, a1)
+
+#else
+
+#define BOOST_URL_TRACE1(name, a0) ((void)0)
+#define BOOST_URL_TRACE2(name, a0, a1) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_IMAGE_HPP
+#define BOOST_URL_DETAIL_URL_IMAGE_HPP
+
+#include "url_list.hpp"
+#include <boost/url/url_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Layout of a url image
+//
+// header:
+//      char[4]     magic
+//      uint32      version
+//      uint64[8]   offset of id_user ... id_end
+//      uint64[7]   decoded size of id_user ... id_frag
+//      uint64      number of segments
+//      uint64      number of params
+//      uint16      port number
+//      uint8       host_type
+//      uint8       scheme
+//      uint8[16]   ip address
+// characters:
+//      char[]      the url, offset of id_end bytes
+//
+// Integers are little-endian and unaligned,
+// and use the functions of the url list.
+
+namespace ui {
+
+constexpr char magic[4] = {
+    '\x7f', 'U', 'R', 'V' };
+constexpr std::uint32_t version = 1;
+constexpr std::size_t header_size =
+    4 + 4 + 8 * (parts_base::id_end + 1) +
+    8 * parts_base::id_end + 8 + 8 + 2 + 1 + 1 + 16;
+
+} // ui
+
+// Accesses the impl of a url_view_base
+struct url_image
+{
+    static
+    url_impl const&
+    impl(url_view_base const& u) noexcept
+    {
+        return *u.pi_;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
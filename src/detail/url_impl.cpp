@@ -14,6 +14,7 @@
 #include "path.hpp"
 #include <boost/url/detail/url_impl.hpp>
 #include <boost/url/authority_view.hpp>
+#include <boost/url/grammar/detail/ci_string.hpp>
 #include <boost/assert.hpp>
 #include <cstring>
 
@@ -85,6 +86,11 @@ apply_host(
     set_size(id_host, s.size());
     decoded_[id_host] =
         s.decoded_size();
+    host_norm_ =
+        s.decoded_size() == s.size() &&
+        grammar::detail::find_upper(
+            s.data(), s.data() + s.size()) ==
+                s.data() + s.size();
     std::memcpy(
         ip_addr_,
         addr,
@@ -122,6 +128,7 @@ apply_authority(
 
     // host, port
     host_type_ = a.u_.host_type_;
+    host_norm_ = a.u_.host_norm_;
     port_number_ = a.u_.port_number_;
     set_size(id_host, a.u_.len(id_host));
     set_size(id_port, a.u_.len(id_port));
@@ -163,43 +170,6 @@ apply_frag(
     decoded_[id_frag] = s.decoded_size();
 }
 
-// return length of [first, last)
-auto
-url_impl::
-len(
-    int first,
-    int last) const noexcept ->
-        std::size_t
-{
-    BOOST_ASSERT(first <= last);
-    BOOST_ASSERT(last <= id_end);
-    return offset(last) - offset(first);
-}
-
-// return length of part
-auto
-url_impl::
-len(int id) const noexcept ->
-    std::size_t
-{
-    return id == id_end
-        ? zero_
-        : ( offset(id + 1) -
-            offset(id) );
-}
-
-// return offset of id
-auto
-url_impl::
-offset(int id) const noexcept ->
-    std::size_t
-{
-    return
-        id == id_scheme
-        ? zero_
-        : offset_[id];
-}
-
 // return id as string
 core::string_view
 url_impl::
@@ -366,44 +336,6 @@ buffer() const noexcept
         data_, size_, dn_);
 }
 
-std::size_t
-path_ref::
-size() const noexcept
-{
-    if(impl_)
-        return impl_->len(id_path);
-    return size_;
-}
-
-char const*
-path_ref::
-data() const noexcept
-{
-    if(impl_)
-        return impl_->cs_ +
-            impl_->offset(id_path);
-    return data_;
-}
-
-char const*
-path_ref::
-end() const noexcept
-{
-    if(impl_)
-        return impl_->cs_ +
-            impl_->offset(id_query);
-    return data_ + size_;
-}
-
-std::size_t
-path_ref::
-nseg() const noexcept
-{
-    if(impl_)
-        return impl_->nseg_;
-    return nseg_;
-}
-
 //------------------------------------------------
 //
 // query_ref
@@ -472,56 +404,6 @@ buffer() const noexcept
         data_, size_, dn_);
 }
 
-// with '?'
-std::size_t
-query_ref::
-size() const noexcept
-{
-    if(impl_)
-        return impl_->len(id_query);
-    if(size_ > 0)
-        return size_ + 1;
-    return question_mark_;
-}
-
-// no '?'
-char const*
-query_ref::
-begin() const noexcept
-{
-    if(impl_)
-    {
-        // using the offset array here
-        auto pos = impl_->offset_[id_query];
-        auto pos1 = impl_->offset_[id_frag];
-        if(pos < pos1)
-            return impl_->cs_ + pos + 1; // no '?'
-        // empty
-        return impl_->cs_ + pos;
-    }
-    return data_;
-
-}
-
-char const*
-query_ref::
-end() const noexcept
-{
-    if(impl_)
-        return impl_->cs_ +
-            impl_->offset(id_frag);
-    return data_ + size_;
-}
-
-std::size_t
-query_ref::
-nparam() const noexcept
-{
-    if(impl_)
-        return impl_->nparam_;
-    return nparam_;
-}
-
 #if defined(__GNUC__) && ! defined(__clang__) && defined(__MINGW32__)
 #pragma GCC diagnostic pop
 #endif
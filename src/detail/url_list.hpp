@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_LIST_HPP
+#define BOOST_URL_DETAIL_URL_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Layout of a url list image
+//
+// entries:
+//      varint      characters shared with the previous url
+//      varint      size of the suffix
+//      char[]      suffix
+// restarts:
+//      uint64      offset of every interval-th entry,
+//                  which shares no characters
+// footer:
+//      uint64      number of urls
+//      uint64      size of the entries
+//      uint32      restart interval
+//      uint32      version
+//      char[4]     magic
+//
+// Integers are little-endian and unaligned.
+// Varints store 7 bits per byte, least
+// significant first, and set the high bit
+// of every byte but the last.
+
+namespace ul {
+
+constexpr char magic[4] = {
+    '\x7f', 'U', 'R', 'L' };
+constexpr std::uint32_t version = 1;
+constexpr std::size_t footer_size = 28;
+constexpr std::size_t restart_size = 8;
+constexpr std::size_t max_varint_size = 10;
+
+// The number of entries decoded at
+// once is bounded by the interval
+constexpr std::size_t max_interval = 64;
+
+inline
+std::uint32_t
+load32(char const* p) noexcept
+{
+    auto const u = reinterpret_cast<
+        unsigned char const*>(p);
+    return
+        static_cast<std::uint32_t>(u[0]) |
+        (static_cast<std::uint32_t>(u[1]) << 8) |
+        (static_cast<std::uint32_t>(u[2]) << 16) |
+        (static_cast<std::uint32_t>(u[3]) << 24);
+}
+
+inline
+std::uint64_t
+load64(char const* p) noexcept
+{
+    return
+        static_cast<std::uint64_t>(load32(p)) |
+        (static_cast<std::uint64_t>(load32(p + 4)) << 32);
+}
+
+inline
+void
+store32(
+    char* p,
+    std::uint32_t v) noexcept
+{
+    p[0] = static_cast<char>(v & 0xff);
+    p[1] = static_cast<char>((v >> 8) & 0xff);
+    p[2] = static_cast<char>((v >> 16) & 0xff);
+    p[3] = static_cast<char>((v >> 24) & 0xff);
+}
+
+inline
+void
+store64(
+    char* p,
+    std::uint64_t v) noexcept
+{
+    store32(p, static_cast<std::uint32_t>(v));
+    store32(p + 4, static_cast<std::uint32_t>(v >> 32));
+}
+
+// Writes v to dest, returns the
+// number of characters written
+inline
+std::size_t
+store_varint(
+    char* dest,
+    std::uint64_t v) noexcept
+{
+    std::size_t n = 0;
+    while(v >= 0x80)
+    {
+        dest[n++] = static_cast<char>(
+            (v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    dest[n++] = static_cast<char>(v);
+    return n;
+}
+
+// Reads a varint from [it, end),
+// returns false if it is truncated
+// or does not fit in 64 bits
+inline
+bool
+load_varint(
+    char const*& it,
+    char const* end,
+    std::uint64_t& v) noexcept
+{
+    v = 0;
+    for(unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if(it == end)
+            return false;
+        auto const c = static_cast<
+            unsigned char>(*it++);
+        v |= static_cast<std::uint64_t>(
+            c & 0x7f) << shift;
+        if(c < 0x80)
+            return true;
+    }
+    return false;
+}
+
+} // ul
+
+} // detail
+} // urls
+} // boost
+
+#endif
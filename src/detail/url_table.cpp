@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// the table is rehashed when it
+// would be more than 3/4 full
+constexpr std::size_t min_slots = 16;
+
+std::size_t
+slots_for(std::size_t n) noexcept
+{
+    std::size_t cap = min_slots;
+    while(cap / 4 * 3 < n)
+        cap *= 2;
+    return cap;
+}
+
+} // (anon)
+
+void
+url_table::
+rehash(std::size_t n)
+{
+    std::vector<slot> v(n, slot{0, 0});
+    std::size_t const mask = n - 1;
+    for(auto const& s : slots_)
+    {
+        if(s.index == 0)
+            continue;
+        std::size_t i = s.fp & mask;
+        while(v[i].index != 0)
+            i = (i + 1) & mask;
+        v[i] = s;
+    }
+    slots_.swap(v);
+}
+
+url_view
+url_table::
+get(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < ends_.size());
+    std::size_t const pos =
+        i == 0 ? 0 : ends_[i - 1];
+    // the string was the buffer
+    // of a url, so it is valid
+    return *parse_uri_reference(
+        core::string_view(
+            arena_.data() + pos,
+            ends_[i] - pos));
+}
+
+std::size_t
+url_table::
+find(
+    url_view_base const& u,
+    std::uint64_t fp) const noexcept
+{
+    if(slots_.empty())
+        return npos;
+    std::size_t const mask =
+        slots_.size() - 1;
+    std::size_t i = fp & mask;
+    for(;;)
+    {
+        slot const& s = slots_[i];
+        if(s.index == 0)
+            return npos;
+        if( s.fp == fp &&
+            get(s.index - 1).compare(u) == 0)
+            return s.index - 1;
+        i = (i + 1) & mask;
+    }
+}
+
+void
+url_table::
+reserve(
+    std::size_t n,
+    std::size_t m)
+{
+    if(slots_.size() / 4 * 3 < n)
+        rehash(slots_for(n));
+    // grow geometrically, since
+    // entries are reserved one
+    // at a time on insert
+    if(ends_.capacity() < n)
+        ends_.reserve((std::max)(
+            n, 2 * ends_.capacity()));
+    if(arena_.capacity() < m)
+        arena_.reserve((std::max)(
+            m, 2 * arena_.capacity()));
+}
+
+std::size_t
+url_table::
+insert(
+    url_view_base const& u,
+    std::uint64_t fp) noexcept
+{
+    BOOST_ASSERT(
+        ends_.size() < ends_.capacity());
+    BOOST_ASSERT(
+        arena_.capacity() - arena_.size() >=
+            u.size());
+    BOOST_ASSERT(
+        slots_.size() / 4 * 3 > ends_.size());
+    arena_.append(
+        u.data(), u.size());
+    ends_.push_back(arena_.size());
+    std::size_t const mask =
+        slots_.size() - 1;
+    std::size_t i = fp & mask;
+    while(slots_[i].index != 0)
+        i = (i + 1) & mask;
+    slots_[i] = { fp, ends_.size() };
+    return ends_.size() - 1;
+}
+
+void
+url_table::
+clear() noexcept
+{
+    std::fill(
+        slots_.begin(),
+        slots_.end(),
+        slot{0, 0});
+    ends_.clear();
+    arena_.clear();
+}
+
+void
+url_table::
+swap(url_table& other) noexcept
+{
+    slots_.swap(other.slots_);
+    ends_.swap(other.ends_);
+    arena_.swap(other.arena_);
+}
+
+} // detail
+} // urls
+} // boost
+
@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/edit_session.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+edit_session::
+edit_session(
+    url_base& u,
+    part p)
+    : first_(p == path
+        ? id_query : id_frag)
+{
+    auto& impl = u.impl_;
+    tail_.assign(
+        impl.cs_ + impl.offset(first_),
+        impl.len(first_, id_end));
+    for(int id = first_; id < id_end; ++id)
+    {
+        len_[id] = impl.len(id);
+        decoded_[id] = impl.decoded_[id];
+        impl.decoded_[id] = 0;
+    }
+    if(first_ <= id_query)
+    {
+        nparam_ = impl.nparam_;
+        impl.nparam_ = 0;
+    }
+    impl.collapse(first_, id_end + 1,
+        impl.offset(first_));
+    if(u.s_)
+        u.s_[u.size()] = '\0';
+    u_ = &u;
+}
+
+edit_session::
+~edit_session()
+{
+    close();
+}
+
+void
+edit_session::
+close()
+{
+    if(! u_)
+        return;
+    auto& u = *u_;
+    auto& impl = u.impl_;
+    // only the edited component
+    // may change in a session
+    BOOST_ASSERT(
+        impl.len(first_, id_end) == 0);
+    auto const pos = u.size();
+    if(! tail_.empty())
+    {
+        {
+            url_base::op_t op(u);
+            u.reserve_impl(
+                pos + tail_.size(), op);
+        }
+        std::memcpy(
+            u.s_ + pos,
+            tail_.data(),
+            tail_.size());
+        u.s_[pos + tail_.size()] = '\0';
+    }
+    for(int id = first_; id < id_end; ++id)
+    {
+        impl.offset_[id + 1] =
+            impl.offset(id) + len_[id];
+        impl.decoded_[id] = decoded_[id];
+    }
+    if(first_ <= id_query)
+        impl.nparam_ = nparam_;
+    u_ = nullptr;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/endpoint_key.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <deque>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+
+endpoint_key
+make_endpoint_key(
+    url_view_base const& u) noexcept
+{
+    endpoint_key k;
+    k.host = u.encoded_host();
+    k.host_hash = grammar::ci_digest(k.host);
+    k.port = u.effective_port();
+    k.scheme = u.scheme_id();
+    return k;
+}
+
+//------------------------------------------------
+
+struct endpoint_table::impl
+{
+    struct slot
+    {
+        std::size_t hash = 0;
+        std::uint32_t id = 0;
+    };
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::mutex m;
+#endif
+    // open addressing, the size
+    // is a power of two
+    std::vector<slot> slots;
+    // the lowercase hosts, indexed by
+    // id - 1. A deque never moves its
+    // elements, so views of them stay
+    // valid as hosts are added.
+    std::deque<std::string> hosts;
+
+    impl()
+        : slots(16)
+    {
+    }
+
+    void
+    grow()
+    {
+        std::vector<slot> v(slots.size() * 2);
+        std::size_t const mask = v.size() - 1;
+        for(auto const& e : slots)
+        {
+            if(e.id == 0)
+                continue;
+            std::size_t i = e.hash & mask;
+            while(v[i].id != 0)
+                i = (i + 1) & mask;
+            v[i] = e;
+        }
+        slots.swap(v);
+    }
+};
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# define BOOST_URL_ENDPOINT_TABLE_LOCK(p) \
+    std::lock_guard<std::mutex> lock((p)->m)
+#else
+# define BOOST_URL_ENDPOINT_TABLE_LOCK(p) \
+    (void)(p)
+#endif
+
+endpoint_table::
+endpoint_table()
+    : impl_(new impl)
+{
+}
+
+endpoint_table::
+~endpoint_table()
+{
+    delete impl_;
+}
+
+std::uint32_t
+endpoint_table::
+host_id(
+    core::string_view host,
+    std::size_t host_hash)
+{
+    BOOST_URL_ENDPOINT_TABLE_LOCK(impl_);
+    std::size_t mask = impl_->slots.size() - 1;
+    std::size_t i = host_hash & mask;
+    for(;;)
+    {
+        auto const& e = impl_->slots[i];
+        if(e.id == 0)
+            break;
+        if( e.hash == host_hash &&
+            grammar::ci_is_equal(
+                impl_->hosts[e.id - 1], host))
+            return e.id;
+        i = (i + 1) & mask;
+    }
+
+    // keep the load factor below one half
+    if(2 * (impl_->hosts.size() + 1) >
+        impl_->slots.size())
+    {
+        impl_->grow();
+        mask = impl_->slots.size() - 1;
+        i = host_hash & mask;
+        while(impl_->slots[i].id != 0)
+            i = (i + 1) & mask;
+    }
+
+    std::string s(host.data(), host.size());
+    for(auto& c : s)
+        c = grammar::to_lower(c);
+    impl_->hosts.push_back(std::move(s));
+    auto const id = static_cast<
+        std::uint32_t>(impl_->hosts.size());
+    impl_->slots[i].hash = host_hash;
+    impl_->slots[i].id = id;
+    return id;
+}
+
+core::string_view
+endpoint_table::
+host(std::uint32_t id) const noexcept
+{
+    BOOST_URL_ENDPOINT_TABLE_LOCK(impl_);
+    if( id == 0 ||
+        id > impl_->hosts.size())
+        return {};
+    return impl_->hosts[id - 1];
+}
+
+std::size_t
+endpoint_table::
+size() const noexcept
+{
+    BOOST_URL_ENDPOINT_TABLE_LOCK(impl_);
+    return impl_->hosts.size();
+}
+
+#undef BOOST_URL_ENDPOINT_TABLE_LOCK
+
+} // urls
+} // boost
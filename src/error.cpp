@@ -52,6 +52,12 @@ case error::incomplete_encoding: return "incomplete pct-encoding";
 case error::missing_pct_hexdig: return "missing hexdig in pct-encoding";
 case error::no_space: return "no space";
 case error::not_a_base: return "not a base";
+case error::scheme_not_allowed: return "scheme not allowed";
+case error::too_long: return "too long";
+case error::too_many_segments: return "too many segments";
+case error::too_many_params: return "too many params";
+case error::host_too_long: return "host too long";
+case error::bad_utf8: return "bad utf-8";
     }
     return "";
 }
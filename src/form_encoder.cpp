@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/form_encoder.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+// Write the pending characters which
+// fit, and return true if none remain
+bool
+form_encoder::
+flush(
+    char*& dest,
+    char const* end) noexcept
+{
+    while( pi_ != pn_ &&
+        dest != end)
+        *dest++ = pend_[pi_++];
+    return pi_ == pn_;
+}
+
+// Encode the characters of s which fit,
+// removing them from s, and return true
+// if s was written entirely
+bool
+form_encoder::
+encode_some(
+    char*& dest,
+    char const* end,
+    core::string_view& s) noexcept
+{
+    char const* const hex =
+        detail::hexdigs[opt_.lower_case];
+    auto it = s.data();
+    auto const last = it + s.size();
+    bool full = false;
+    while(it != last)
+    {
+        // unreserved run
+        auto const p = grammar::find_if_not(
+            it, last, unreserved_chars);
+        std::size_t n = p - it;
+        if(n > static_cast<std::size_t>(
+            end - dest))
+        {
+            n = end - dest;
+            full = true;
+        }
+        if(n > 0)
+            std::memcpy(dest, it, n);
+        dest += n;
+        it += n;
+        if( full ||
+            it == last)
+            break;
+        if(dest == end)
+        {
+            full = true;
+            break;
+        }
+        unsigned char const c = *it++;
+        if( opt_.space_as_plus &&
+            c == ' ')
+        {
+            *dest++ = '+';
+            continue;
+        }
+        pend_[0] = '%';
+        pend_[1] = hex[c >> 4];
+        pend_[2] = hex[c & 0xf];
+        pn_ = 3;
+        pi_ = 0;
+        if(! flush(dest, end))
+        {
+            full = true;
+            break;
+        }
+    }
+    s = core::string_view(it, last - it);
+    return ! full && it == last;
+}
+
+void
+form_encoder::
+put(param_view const& qp) noexcept
+{
+    BOOST_ASSERT(done());
+    key_ = qp.key;
+    value_ = qp.value;
+    has_value_ = qp.has_value;
+    part_ = 1;
+    pi_ = 0;
+    pn_ = 0;
+    if(! first_)
+        pend_[pn_++] = '&';
+    first_ = false;
+}
+
+std::size_t
+form_encoder::
+write(
+    char* const dest0,
+    std::size_t size) noexcept
+{
+    auto dest = dest0;
+    auto const end = dest + size;
+    for(;;)
+    {
+        if(! flush(dest, end))
+            break;
+        if(part_ == 1)
+        {
+            if(! encode_some(
+                    dest, end, key_))
+                break;
+            if(has_value_)
+            {
+                pend_[0] = '=';
+                pn_ = 1;
+                pi_ = 0;
+                part_ = 2;
+                continue;
+            }
+            part_ = 0;
+        }
+        else if(part_ == 2)
+        {
+            if(! encode_some(
+                    dest, end, value_))
+                break;
+            part_ = 0;
+        }
+        break;
+    }
+    return dest - dest0;
+}
+
+void
+form_encoder::
+reset() noexcept
+{
+    key_ = {};
+    value_ = {};
+    pn_ = 0;
+    pi_ = 0;
+    part_ = 0;
+    has_value_ = false;
+    first_ = true;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/form_parser.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// The characters which are not
+// copied to the param as they are
+constexpr grammar::lut_chars
+    form_delim_chars("%+&=");
+
+} // (anon)
+
+system::result<std::size_t>
+form_parser::
+feed(
+    char const* const first,
+    char const* const last)
+{
+    if(ec_.failed())
+        return ec_;
+    if(clear_)
+    {
+        buf_.clear();
+        clear_ = false;
+    }
+    any_ = true;
+    auto it = first;
+    auto const append = [this](
+        char const* p, std::size_t n)
+    {
+        if(n > max_size_ - buf_.size())
+        {
+            ec_ = BOOST_URL_ERR(
+                error::no_space);
+            return false;
+        }
+        buf_.append(p, n);
+        return true;
+    };
+    while(it != last)
+    {
+        if(pct_ != 0)
+        {
+            // an escape which
+            // straddles chunks
+            auto const d =
+                grammar::hexdig_value(*it);
+            if(d < 0)
+            {
+                ec_ = BOOST_URL_ERR(
+                    error::bad_pct_hexdig);
+                return ec_;
+            }
+            hex_ = static_cast<unsigned char>(
+                (hex_ << 4) | d);
+            ++it;
+            if( --pct_ == 0 &&
+                ! append(reinterpret_cast<
+                    char const*>(&hex_), 1))
+                return ec_;
+            continue;
+        }
+        auto const p = grammar::find_if(
+            it, last, form_delim_chars);
+        if(! append(it, p - it))
+            return ec_;
+        it = p;
+        if(it == last)
+            break;
+        switch(*it++)
+        {
+        case '%':
+            pct_ = 2;
+            hex_ = 0;
+            break;
+
+        case '+':
+            if(! append(opt_.space_as_plus ?
+                    " " : "+", 1))
+                return ec_;
+            break;
+
+        case '=':
+            if(has_value_)
+            {
+                // part of the value
+                if(! append("=", 1))
+                    return ec_;
+                break;
+            }
+            key_size_ = buf_.size();
+            has_value_ = true;
+            break;
+
+        default:
+            // '&' ends the param
+            ready_ = true;
+            return it - first;
+        }
+    }
+    return it - first;
+}
+
+param_view
+form_parser::
+take() noexcept
+{
+    core::string_view const s = buf_;
+    param_view qp = has_value_ ?
+        param_view(
+            s.substr(0, key_size_),
+            s.substr(key_size_)) :
+        param_view(s, no_value);
+    // the storage is cleared before the
+    // next call to feed, not here, so
+    // the view stays valid for the handler
+    ready_ = false;
+    has_value_ = false;
+    clear_ = true;
+    return qp;
+}
+
+void
+form_parser::
+reset() noexcept
+{
+    buf_.clear();
+    ec_ = {};
+    key_size_ = 0;
+    pct_ = 0;
+    hex_ = 0;
+    has_value_ = false;
+    ready_ = false;
+    any_ = false;
+    clear_ = false;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/gather.hpp>
+#include <boost/assert.hpp>
+#include "detail/prefetch.hpp"
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// How many elements ahead the
+// characters are requested
+constexpr std::size_t distance = 8;
+
+struct get_scheme
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.scheme();
+    }
+};
+
+struct get_user
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_user();
+    }
+};
+
+struct get_password
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_password();
+    }
+};
+
+struct get_host
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_host();
+    }
+};
+
+struct get_port
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.port();
+    }
+};
+
+struct get_path
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_path();
+    }
+};
+
+struct get_query
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_query();
+    }
+};
+
+struct get_fragment
+{
+    core::string_view
+    operator()(url_view_base const& u) const noexcept
+    {
+        return u.encoded_fragment();
+    }
+};
+
+template<class T, class Get>
+void
+gather_impl(
+    T const* urls,
+    std::size_t n,
+    core::string_view* out,
+    Get get) noexcept
+{
+    // the URL objects are read in order,
+    // the characters they reference are
+    // requested ahead of their use
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(i + distance < n)
+            detail::prefetch(get(
+                urls[i + distance]).data());
+        out[i] = get(urls[i]);
+    }
+}
+
+template<class T>
+void
+gather_part(
+    url_batch::part p,
+    T const* urls,
+    std::size_t n,
+    core::string_view* out) noexcept
+{
+    switch(p)
+    {
+    case url_batch::scheme:
+        return gather_impl(
+            urls, n, out, get_scheme{});
+    case url_batch::user:
+        return gather_impl(
+            urls, n, out, get_user{});
+    case url_batch::password:
+        return gather_impl(
+            urls, n, out, get_password{});
+    case url_batch::host:
+        return gather_impl(
+            urls, n, out, get_host{});
+    case url_batch::port:
+        return gather_impl(
+            urls, n, out, get_port{});
+    case url_batch::path:
+        return gather_impl(
+            urls, n, out, get_path{});
+    case url_batch::query:
+        return gather_impl(
+            urls, n, out, get_query{});
+    case url_batch::fragment:
+        return gather_impl(
+            urls, n, out, get_fragment{});
+    default:
+        BOOST_ASSERT(p != url_batch::end);
+        break;
+    }
+}
+
+} // (anon)
+
+void
+gather(
+    url_batch::part p,
+    url_view const* urls,
+    std::size_t n,
+    core::string_view* out) noexcept
+{
+    gather_part(p, urls, n, out);
+}
+
+void
+gather(
+    url_batch::part p,
+    url const* urls,
+    std::size_t n,
+    core::string_view* out) noexcept
+{
+    gather_part(p, urls, n, out);
+}
+
+} // urls
+} // boost
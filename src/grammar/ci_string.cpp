@@ -12,6 +12,15 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/grammar/ci_string.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
 
 namespace boost {
 namespace urls {
@@ -24,35 +33,248 @@ namespace detail {
 // https://lemire.me/blog/2020/04/30/for-case-insensitive-string-comparisons-avoid-char-by-char-functions/
 // https://github.com/lemire/Code-used-on-Daniel-Lemire-s-blog/blob/master/2020/04/30/tolower.cpp
 
-bool
-ci_is_equal(
-    core::string_view s0,
-    core::string_view s1) noexcept
+namespace {
+
+#ifdef BOOST_URL_USE_SSE2
+
+// a mask of the bytes in 'A'...'Z'
+inline
+__m128i
+upper_mask(__m128i v) noexcept
+{
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+        _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+}
+
+inline
+__m128i
+fold(__m128i v) noexcept
+{
+    return _mm_or_si128(v, _mm_and_si128(
+        upper_mask(v), _mm_set1_epi8(0x20)));
+}
+
+#elif defined(BOOST_URL_USE_NEON)
+
+inline
+uint8x16_t
+upper_mask(uint8x16_t v) noexcept
+{
+    return vandq_u8(
+        vcgeq_u8(v, vdupq_n_u8('A')),
+        vcleq_u8(v, vdupq_n_u8('Z')));
+}
+
+inline
+uint8x16_t
+fold(uint8x16_t v) noexcept
+{
+    return vorrq_u8(v, vandq_u8(
+        upper_mask(v), vdupq_n_u8(0x20)));
+}
+
+// four bits per byte
+inline
+std::uint64_t
+nibble_mask(uint8x16_t m) noexcept
+{
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(
+            vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+#endif
+
+// Return the index of the first character
+// in [0, n) which differs between p0 and
+// p1 ignoring case, or n if there is none.
+std::size_t
+ci_mismatch(
+    char const* p0,
+    char const* p1,
+    std::size_t n) noexcept
 {
-    auto n = s0.size();
-    auto p1 = s0.data();
-    auto p2 = s1.data();
-    char a, b;
-    // fast loop
-    while(n--)
+    std::size_t i = 0;
+#ifdef BOOST_URL_USE_SSE2
+    for(; n - i >= 16; i += 16)
+    {
+        __m128i const v0 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p0 + i));
+        __m128i const v1 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p1 + i));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(
+                fold(v0), fold(v1)))) ^ 0xffff;
+        if(m)
+            return i + boost::core::countr_zero(m);
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    for(; n - i >= 16; i += 16)
+    {
+        uint8x16_t const v0 = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(p0 + i));
+        uint8x16_t const v1 = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(p1 + i));
+        std::uint64_t const m = nibble_mask(
+            vmvnq_u8(vceqq_u8(
+                fold(v0), fold(v1))));
+        if(m)
+            return i + (
+                boost::core::countr_zero(m) >> 2);
+    }
+#endif
+    // what is left of a vector, or
+    // all of a short string
+    for(; n - i >= 8; i += 8)
     {
-        a = *p1++;
-        b = *p2++;
-        if(a != b)
-            goto slow;
+        std::uint64_t v0;
+        std::uint64_t v1;
+        std::memcpy(&v0, p0 + i, 8);
+        std::memcpy(&v1, p1 + i, 8);
+        if(fold8(v0) != fold8(v1))
+            break;
     }
-    return true;
-slow:
-    do
+    for(; i < n; ++i)
     {
-        if( to_lower(a) !=
-            to_lower(b))
-            return false;
-        a = *p1++;
-        b = *p2++;
+        if( p0[i] != p1[i] &&
+            to_lower(p0[i]) !=
+                to_lower(p1[i]))
+            break;
+    }
+    return i;
+}
+
+} // (anon)
+
+char const*
+find_upper(
+    char const* it,
+    char const* const last) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    while(last - it >= 16)
+    {
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(upper_mask(
+                _mm_loadu_si128(reinterpret_cast<
+                    __m128i const*>(it)))));
+        if(m)
+            return it + boost::core::countr_zero(m);
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    while(last - it >= 16)
+    {
+        std::uint64_t const m = nibble_mask(
+            upper_mask(vld1q_u8(reinterpret_cast<
+                std::uint8_t const*>(it))));
+        if(m)
+            return it + (
+                boost::core::countr_zero(m) >> 2);
+        it += 16;
+    }
+#endif
+    while(it != last)
+    {
+        if( *it >= 'A' &&
+            *it <= 'Z')
+            break;
+        ++it;
+    }
+    return it;
+}
+
+void
+to_lower_in_place(
+    char* it,
+    char* const last,
+    bool escapes) noexcept
+{
+    // the characters of an escape
+    // which are left to skip
+    unsigned skip = 0;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const pct = _mm_set1_epi8(
+        escapes ? '%' : 0);
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const pct = vdupq_n_u8(
+        escapes ? '%' : 0);
+#endif
+    for(;;)
+    {
+#ifdef BOOST_URL_USE_SSE2
+        while(
+            skip == 0 &&
+            last - it >= 16)
+        {
+            __m128i const v = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(it));
+            if( escapes &&
+                _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(v, pct)) != 0)
+                break;
+            // write only what changes
+            if(_mm_movemask_epi8(
+                    upper_mask(v)) != 0)
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(it),
+                    fold(v));
+            it += 16;
+        }
+#elif defined(BOOST_URL_USE_NEON)
+        while(
+            skip == 0 &&
+            last - it >= 16)
+        {
+            uint8x16_t const v = vld1q_u8(
+                reinterpret_cast<
+                    std::uint8_t const*>(it));
+            if( escapes &&
+                nibble_mask(vceqq_u8(v, pct)) != 0)
+                break;
+            if(nibble_mask(upper_mask(v)) != 0)
+                vst1q_u8(reinterpret_cast<
+                    std::uint8_t*>(it), fold(v));
+            it += 16;
+        }
+#endif
+        // a block with escapes, or
+        // the rest, one at a time
+        char* const end =
+            last - it > 16 ? it + 16 : last;
+        for(; it != end; ++it)
+        {
+            char const c = *it;
+            if(skip != 0)
+                --skip;
+            else if(
+                escapes &&
+                c == '%')
+                skip = 2;
+            else if(
+                c >= 'A' &&
+                c <= 'Z')
+                *it = static_cast<char>(c + 32);
+        }
+        if(it == last)
+            return;
     }
-    while(n--);
-    return true;
+}
+
+//------------------------------------------------
+
+bool
+ci_is_equal(
+    core::string_view s0,
+    core::string_view s1) noexcept
+{
+    BOOST_ASSERT(s0.size() == s1.size());
+    return ci_mismatch(
+        s0.data(), s1.data(), s0.size()) ==
+            s0.size();
 }
 
 //------------------------------------------------
@@ -62,17 +284,14 @@ ci_is_less(
     core::string_view s0,
     core::string_view s1) noexcept
 {
-    auto p1 = s0.data();
-    auto p2 = s1.data();
-    for(auto n = s0.size();n--;)
-    {
-        auto c1 = to_lower(*p1++);
-        auto c2 = to_lower(*p2++);
-        if(c1 != c2)
-            return c1 < c2;
-    }
-    // equal
-    return false;
+    BOOST_ASSERT(s0.size() == s1.size());
+    auto const i = ci_mismatch(
+        s0.data(), s1.data(), s0.size());
+    if(i == s0.size())
+        // equal
+        return false;
+    return to_lower(s0[i]) <
+        to_lower(s1[i]);
 }
 
 } // detail
@@ -101,21 +320,14 @@ ci_compare(
             bias = 0;
         n = s1.size();
     }
-    auto it0 = s0.data();
-    auto it1 = s1.data();
-    while(n--)
-    {
-        auto c0 =
-            to_lower(*it0++);
-        auto c1 =
-            to_lower(*it1++);
-        if(c0 == c1)
-            continue;
-        if(c0 < c1)
-            return -1;
-        return 1;
-    }
-    return bias;
+    auto const i = detail::ci_mismatch(
+        s0.data(), s1.data(), n);
+    if(i == n)
+        return bias;
+    if( to_lower(s0[i]) <
+        to_lower(s1[i]))
+        return -1;
+    return 1;
 }
 
 //------------------------------------------------
@@ -138,12 +350,19 @@ ci_digest(
             0x811C9DC5UL;
     auto hash = hash0;
     auto p = s.data();
-    auto n = s.size();
-    for(;n--;++p)
+    auto const end = p + s.size();
+    for(;;)
     {
-        // VFALCO NOTE Consider using a lossy
-        // to_lower which works 4 or 8 chars at a time.
+        // runs without uppercase
+        // letters are hashed as-is
+        auto const q =
+            detail::find_upper(p, end);
+        for(;p != q;++p)
+            hash = (*p ^ hash) * prime;
+        if(p == end)
+            break;
         hash = (to_lower(*p) ^ hash) * prime;
+        ++p;
     }
     return hash;
 }
@@ -0,0 +1,326 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/detail/charset.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(BOOST_URL_USE_AVX2) || \
+    defined(BOOST_URL_USE_NEON)
+
+#ifdef BOOST_URL_USE_AVX2
+# include <immintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+#ifdef BOOST_URL_USE_NEON
+# include <arm_neon.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+namespace {
+
+char const*
+find_lut_scalar(
+    std::uint64_t const* mask,
+    char const* first,
+    char const* last,
+    bool match) noexcept
+{
+    while(first != last)
+    {
+        auto const c = static_cast<
+            unsigned char>(*first);
+        bool const b = (mask[c & 3] &
+            (1ULL << (c >> 2))) != 0;
+        if(b == match)
+            break;
+        ++first;
+    }
+    return first;
+}
+
+#ifdef BOOST_URL_USE_AVX2
+
+bool
+cpu_has_avx2() noexcept
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 0);
+    if(r[0] < 7)
+        return false;
+    __cpuid(r, 1);
+    // OSXSAVE and AVX
+    if((r[2] & 0x18000000) != 0x18000000)
+        return false;
+    // XMM and YMM state enabled by the OS
+    if((_xgetbv(0) & 6) != 6)
+        return false;
+    __cpuidex(r, 7, 0);
+    return (r[1] & 0x20) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#ifndef _MSC_VER
+__attribute__((target("avx2")))
+#endif
+char const*
+find_lut_avx2(
+    std::uint64_t const* mask,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    bool match) noexcept
+{
+    __m256i const lo = _mm256_broadcastsi128_si256(
+        _mm_load_si128(
+            reinterpret_cast<__m128i const*>(tab)));
+    __m256i const hi = _mm256_broadcastsi128_si256(
+        _mm_load_si128(
+            reinterpret_cast<__m128i const*>(tab + 16)));
+    __m256i const bits = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i const nib = _mm256_set1_epi8(0x0F);
+    __m256i const zero = _mm256_setzero_si256();
+    // movemask yields the non-members
+    unsigned const flip = match ? ~0U : 0U;
+    while(last - first >= 32)
+    {
+        __m256i const v = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(first));
+        __m256i const l = _mm256_and_si256(v, nib);
+        __m256i const h = _mm256_and_si256(
+            _mm256_srli_epi16(v, 4), nib);
+        // top bit of v selects the hi row
+        __m256i const row = _mm256_blendv_epi8(
+            _mm256_shuffle_epi8(lo, l),
+            _mm256_shuffle_epi8(hi, l), v);
+        __m256i const in = _mm256_and_si256(
+            row, _mm256_shuffle_epi8(bits, h));
+        unsigned const m = flip ^ static_cast<
+            unsigned>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, zero)));
+        if(m)
+            return first + boost::core::countr_zero(m);
+        first += 32;
+    }
+    return find_lut_scalar(
+        mask, first, last, match);
+}
+
+#ifndef _MSC_VER
+__attribute__((target("avx2")))
+#endif
+char const*
+scan_pct_avx2(
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    std::size_t& n) noexcept
+{
+    __m256i const lo = _mm256_broadcastsi128_si256(
+        _mm_load_si128(
+            reinterpret_cast<__m128i const*>(tab)));
+    __m256i const hi = _mm256_broadcastsi128_si256(
+        _mm_load_si128(
+            reinterpret_cast<__m128i const*>(tab + 16)));
+    __m256i const bits = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i const nib = _mm256_set1_epi8(0x0F);
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const pct = _mm256_set1_epi8('%');
+    __m256i const d0 = _mm256_set1_epi8('0');
+    __m256i const d9 = _mm256_set1_epi8(9);
+    __m256i const lower = _mm256_set1_epi8(0x20);
+    __m256i const a0 = _mm256_set1_epi8('a');
+    __m256i const a5 = _mm256_set1_epi8(5);
+    while(last - first >= 32)
+    {
+        __m256i const v = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(first));
+        __m256i const l = _mm256_and_si256(v, nib);
+        __m256i const h = _mm256_and_si256(
+            _mm256_srli_epi16(v, 4), nib);
+        __m256i const row = _mm256_blendv_epi8(
+            _mm256_shuffle_epi8(lo, l),
+            _mm256_shuffle_epi8(hi, l), v);
+        __m256i const in = _mm256_and_si256(
+            row, _mm256_shuffle_epi8(bits, h));
+        unsigned const member = ~static_cast<
+            unsigned>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, zero)));
+        unsigned const pcts = static_cast<
+            unsigned>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(v, pct)));
+        // '0'-'9', or 'a'-'f' after
+        // setting the lowercase bit
+        __m256i const d = _mm256_sub_epi8(v, d0);
+        __m256i const a = _mm256_sub_epi8(
+            _mm256_or_si256(v, lower), a0);
+        unsigned const hex = static_cast<
+            unsigned>(_mm256_movemask_epi8(
+                _mm256_or_si256(
+                    _mm256_cmpeq_epi8(
+                        _mm256_min_epu8(d, d9), d),
+                    _mm256_cmpeq_epi8(
+                        _mm256_min_epu8(a, a5), a))));
+
+        // an escape which does not fit in
+        // the block starts the next block
+        unsigned k = 32;
+        if(pcts & 0x80000000U)
+            k = 31;
+        else if(pcts & 0x40000000U)
+            k = 30;
+        unsigned const keep = k == 32 ?
+            ~0U : ((1U << k) - 1);
+        unsigned const p = pcts & keep;
+        unsigned const esc = (p << 1) | (p << 2);
+        unsigned const bad = esc & ~hex;
+        unsigned const stop =
+            ~(member | p | esc) & keep;
+        if(stop)
+        {
+            unsigned const s =
+                boost::core::countr_zero(stop);
+            if( bad &&
+                static_cast<unsigned>(
+                    boost::core::countr_zero(
+                        bad)) < s)
+                return nullptr;
+            // each triplet decodes to one byte
+            n += boost::core::popcount(
+                ~esc & ((1U << s) - 1));
+            return first + s;
+        }
+        if(bad)
+            return nullptr;
+        n += boost::core::popcount(~esc & keep);
+        first += k;
+    }
+    return first;
+}
+
+#endif
+
+#ifdef BOOST_URL_USE_NEON
+
+char const*
+find_lut_neon(
+    std::uint64_t const* mask,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    bool match) noexcept
+{
+    uint8x16x2_t const rows = {{
+        vld1q_u8(tab), vld1q_u8(tab + 16) }};
+    static unsigned char const bits_[16] = {
+        1, 2, 4, 8, 16, 32, 64, 128,
+        1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t const bits = vld1q_u8(bits_);
+    uint8x16_t const nib = vdupq_n_u8(0x0F);
+    uint8x16_t const top = vdupq_n_u8(0x80);
+    std::uint64_t const flip = match ? 0 : ~0ULL;
+    while(last - first >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(first));
+        // l + 16 when the top bit is set,
+        // which indexes the hi row
+        uint8x16_t const idx = vorrq_u8(
+            vandq_u8(v, nib),
+            vshrq_n_u8(vandq_u8(v, top), 3));
+        uint8x16_t const row = vqtbl2q_u8(rows, idx);
+        uint8x16_t const in = vtstq_u8(
+            row, vqtbl1q_u8(bits, vshrq_n_u8(v, 4)));
+        // four bits per byte in the mask
+        std::uint64_t const m = flip ^ vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(
+                vreinterpretq_u16_u8(in), 4)), 0);
+        if(m)
+            return first + (
+                boost::core::countr_zero(m) >> 2);
+        first += 16;
+    }
+    return find_lut_scalar(
+        mask, first, last, match);
+}
+
+#endif
+
+} // (anon)
+
+#ifdef BOOST_URL_USE_AVX2
+
+char const*
+scan_pct_wide(
+    std::uint64_t const*,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    std::size_t& n) noexcept
+{
+    static bool const has_avx2 =
+        cpu_has_avx2();
+    if(! has_avx2)
+        return first;
+    return scan_pct_avx2(
+        tab, first, last, n);
+}
+
+#endif
+
+char const*
+find_lut_wide(
+    std::uint64_t const* mask,
+    unsigned char const* tab,
+    char const* first,
+    char const* last,
+    bool match) noexcept
+{
+#ifdef BOOST_URL_USE_AVX2
+    static bool const has_avx2 =
+        cpu_has_avx2();
+    if(! has_avx2)
+        return find_lut_scalar(
+            mask, first, last, match);
+    return find_lut_avx2(
+        mask, tab, first, last, match);
+#else
+    return find_lut_neon(
+        mask, tab, first, last, match);
+#endif
+}
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
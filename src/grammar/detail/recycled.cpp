@@ -8,10 +8,17 @@
 //
 
 #include <boost/url/detail/config.hpp>
-#include <boost/url/grammar/detail/recycled.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include <boost/core/typeinfo.hpp>
 #include <cstdlib>
 #include <utility>
+#include <algorithm>
 #include <atomic>
+#include <new>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
 
 #ifdef BOOST_URL_REPORT
 # ifdef _MSC_VER
@@ -55,45 +62,329 @@ struct all_reports
 
 static all_reports all_reports_;
 
+namespace {
+
 void
-recycled_add_impl(
+update_max(
+    std::atomic<std::size_t>& m,
     std::size_t n) noexcept
 {
-    auto& a = all_reports_;
-
-    std::size_t new_count = ++a.count;
-    std::size_t old_count_max = a.count_max;
+    std::size_t old = m;
     while (
-        old_count_max < new_count &&
-        !a.count_max.compare_exchange_weak(
-            old_count_max, new_count))
-    {}
-
-    std::size_t new_bytes = a.bytes.fetch_add(n) + n;
-    std::size_t old_bytes_max = a.bytes_max;
-    while (
-        old_bytes_max < new_bytes &&
-        !a.bytes_max.compare_exchange_weak(
-            old_bytes_max, new_bytes))
+        old < n &&
+        !m.compare_exchange_weak(
+            old, n))
     {}
+}
 
-    std::size_t old_alloc_max = a.alloc_max;
-    while (
-        old_alloc_max < n &&
-        !a.alloc_max.compare_exchange_weak(
-            old_alloc_max, n))
-    {}
+void
+shared_add(
+    std::size_t n) noexcept
+{
+    auto& a = all_reports_;
+    update_max(a.count_max, ++a.count);
+    update_max(a.bytes_max,
+        a.bytes.fetch_add(n) + n);
+    update_max(a.alloc_max, n);
 }
 
 void
-recycled_remove_impl(
+shared_remove(
     std::size_t n) noexcept
 {
     all_reports_.count--;
     all_reports_.bytes-=n;
 }
 
+#if !defined(BOOST_URL_DISABLE_THREADS)
+
+// Counters for the calling thread, so that
+// updates never write to memory shared with
+// other threads. They are folded into
+// all_reports_ when the thread exits, and
+// read by get_recycled_stats before then.
+//
+// Instances released on a different thread
+// than the one which acquired them make the
+// per-thread counts wrap around; their sum
+// over all threads is still exact. The
+// maximums are per-thread.
+struct thread_reports
+{
+    // only written by the owning thread
+    std::atomic<std::size_t> count{0};
+    std::atomic<std::size_t> bytes{0};
+    std::atomic<std::size_t> count_max{0};
+    std::atomic<std::size_t> bytes_max{0};
+    std::atomic<std::size_t> alloc_max{0};
+
+    // list of live threads
+    thread_reports* prev = nullptr;
+    thread_reports* next = nullptr;
+
+    thread_reports() noexcept;
+    ~thread_reports();
+};
+
+// Remains valid after thread_reports is
+// destroyed at thread exit
+struct thread_state
+{
+    thread_reports* p;
+    bool done;
+};
+
+thread_local thread_state thread_state_ = {};
+
+// Guards the list of live threads
+struct thread_list
+{
+    std::mutex m;
+    thread_reports* head = nullptr;
+};
+
+thread_list&
+threads() noexcept
+{
+    // never destroyed, threads may
+    // exit after static destruction
+    alignas(thread_list) static unsigned char
+        buf[sizeof(thread_list)];
+    static thread_list* p = ::new(
+        static_cast<void*>(buf)) thread_list;
+    return *p;
+}
+
+thread_reports::
+thread_reports() noexcept
+{
+    auto& t = threads();
+    std::lock_guard<std::mutex> lock(t.m);
+    next = t.head;
+    if(next)
+        next->prev = this;
+    t.head = this;
+    thread_state_.p = this;
+}
+
+thread_reports::
+~thread_reports()
+{
+    thread_state_.p = nullptr;
+    thread_state_.done = true;
+    auto& t = threads();
+    std::lock_guard<std::mutex> lock(t.m);
+    if(prev)
+        prev->next = next;
+    else
+        t.head = next;
+    if(next)
+        next->prev = prev;
+    auto& a = all_reports_;
+    a.count += count.load();
+    a.bytes += bytes.load();
+    update_max(a.count_max, count_max.load());
+    update_max(a.bytes_max, bytes_max.load());
+    update_max(a.alloc_max, alloc_max.load());
+}
+
+thread_reports*
+local_reports() noexcept
+{
+    auto& st = thread_state_;
+    if(st.p || st.done)
+        return st.p;
+    static thread_local thread_reports r;
+    return st.p;
+}
+
+// Only called by the owning thread,
+// so no read-modify-write is needed
+void
+store(
+    std::atomic<std::size_t>& a,
+    std::size_t n) noexcept
+{
+    a.store(n, std::memory_order_relaxed);
+}
+
+std::size_t
+load(
+    std::atomic<std::size_t> const& a) noexcept
+{
+    return a.load(std::memory_order_relaxed);
+}
+
+#endif
+
+// The registered types
+std::atomic<recycled_type*> types_{nullptr};
+
+void
+type_add(
+    recycled_type& t,
+    std::size_t n) noexcept
+{
+    update_max(t.count_max, t.count.fetch_add(
+        1, std::memory_order_relaxed) + 1);
+    update_max(t.bytes_max, t.bytes.fetch_add(
+        n, std::memory_order_relaxed) + n);
+    update_max(t.alloc_max, n);
+}
+
+void
+type_remove(
+    recycled_type& t,
+    std::size_t n) noexcept
+{
+    t.count.fetch_sub(1,
+        std::memory_order_relaxed);
+    t.bytes.fetch_sub(n,
+        std::memory_order_relaxed);
+}
+
+} // (anon)
+
+void
+recycled_add_impl(
+    std::size_t n) noexcept
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if(auto r = local_reports())
+    {
+        auto const count = load(r->count) + 1;
+        auto const bytes = load(r->bytes) + n;
+        store(r->count, count);
+        store(r->bytes, bytes);
+        if(count > load(r->count_max))
+            store(r->count_max, count);
+        if(bytes > load(r->bytes_max))
+            store(r->bytes_max, bytes);
+        if(n > load(r->alloc_max))
+            store(r->alloc_max, n);
+        return;
+    }
+#endif
+    shared_add(n);
+}
+
+void
+recycled_remove_impl(
+    std::size_t n) noexcept
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if(auto r = local_reports())
+    {
+        store(r->count, load(r->count) - 1);
+        store(r->bytes, load(r->bytes) - n);
+        return;
+    }
+#endif
+    shared_remove(n);
+}
+
+void
+recycled_add_impl(
+    recycled_type& t,
+    std::size_t n) noexcept
+{
+    type_add(t, n);
+    recycled_add_impl(n);
+}
+
+void
+recycled_remove_impl(
+    recycled_type& t,
+    std::size_t n) noexcept
+{
+    type_remove(t, n);
+    recycled_remove_impl(n);
+}
+
+void
+recycled_register_impl(
+    recycled_type& t) noexcept
+{
+    // types are never removed
+    recycled_type* head = types_.load(
+        std::memory_order_relaxed);
+    do
+    {
+        t.next = head;
+    }
+    while(! types_.compare_exchange_weak(
+        head, &t,
+        std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+recycled_stats
+recycled_read(
+    recycled_type const& t) noexcept
+{
+    recycled_stats st;
+    st.count = t.count.load(
+        std::memory_order_relaxed);
+    st.bytes = t.bytes.load(
+        std::memory_order_relaxed);
+    st.count_max = t.count_max.load(
+        std::memory_order_relaxed);
+    st.bytes_max = t.bytes_max.load(
+        std::memory_order_relaxed);
+    st.alloc_max = t.alloc_max.load(
+        std::memory_order_relaxed);
+    return st;
+}
+
 } // detail
+
+recycled_stats
+get_recycled_stats() noexcept
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    // exiting threads fold their
+    // counters while holding the lock
+    auto& t = detail::threads();
+    std::lock_guard<std::mutex> lock(t.m);
+#endif
+    auto& a = detail::all_reports_;
+    recycled_stats st;
+    st.count = a.count;
+    st.bytes = a.bytes;
+    st.count_max = a.count_max;
+    st.bytes_max = a.bytes_max;
+    st.alloc_max = a.alloc_max;
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    for(auto r = t.head; r; r = r->next)
+    {
+        st.count += detail::load(r->count);
+        st.bytes += detail::load(r->bytes);
+        st.count_max = (std::max)(st.count_max,
+            detail::load(r->count_max));
+        st.bytes_max = (std::max)(st.bytes_max,
+            detail::load(r->bytes_max));
+        st.alloc_max = (std::max)(st.alloc_max,
+            detail::load(r->alloc_max));
+    }
+#endif
+    return st;
+}
+
+std::vector<recycled_type_stats>
+get_recycled_type_stats()
+{
+    std::vector<recycled_type_stats> v;
+    for(auto t = detail::types_.load(
+            std::memory_order_acquire);
+        t; t = t->next)
+    {
+        v.push_back({
+            core::demangled_name(*t->type),
+            detail::recycled_read(*t)});
+    }
+    return v;
+}
+
 } // grammar
 } // urls
 } // boost
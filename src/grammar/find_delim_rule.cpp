@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/find_delim_rule.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+auto
+ch_find_delim_rule::
+parse(
+    char const*& it,
+    char const* end) const noexcept ->
+        system::result<value_type>
+{
+    // memchr is vectorized
+    // by the C library
+    void const* p = it == end ? nullptr :
+        std::memchr(it, ch_, end - it);
+    if(! p)
+    {
+        // no delimiter
+        BOOST_URL_RETURN_EC(
+            error::need_more);
+    }
+    char const* const it0 = it;
+    it = static_cast<char const*>(p);
+    return core::string_view(
+        it0, it - it0);
+}
+
+} // grammar
+} // urls
+} // boost
@@ -13,6 +13,7 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/literal_rule.hpp>
+#include <boost/url/grammar/ci_string.hpp>
 #include <boost/assert.hpp>
 #include <cstring>
 
@@ -64,6 +65,52 @@ parse(
         error::need_more);
 }
 
+auto
+ci_literal_rule::
+parse(
+    char const*& it,
+    char const* end) const noexcept ->
+        system::result<value_type>
+{
+    // Can't have a literal
+    // with an empty string!
+    BOOST_ASSERT(n_ > 0);
+
+    std::size_t n = end - it;
+    if(n >= n_)
+    {
+        if(! detail::ci_is_equal(
+            core::string_view(it, n_),
+            core::string_view(s_, n_)))
+        {
+            // non-match
+            BOOST_URL_RETURN_EC(
+                error::mismatch);
+        }
+        it += n_;
+        return core::string_view(
+            it - n_, it);
+    }
+    if(n > 0)
+    {
+        // short input
+        if(! detail::ci_is_equal(
+            core::string_view(it, n),
+            core::string_view(s_, n)))
+        {
+            // non-match
+            BOOST_URL_RETURN_EC(
+                error::mismatch);
+        }
+        // prefix matches
+        BOOST_URL_RETURN_EC(
+            error::need_more);
+    }
+    // end
+    BOOST_URL_RETURN_EC(
+        error::need_more);
+}
+
 } // grammar
 } // urls
 } // boost
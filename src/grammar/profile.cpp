@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/profile.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <algorithm>
+#include <atomic>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+namespace {
+
+// The registered types
+std::atomic<rule_type*> types_{nullptr};
+
+} // (anon)
+
+void
+rule_register_impl(
+    rule_type& t) noexcept
+{
+    // types are never removed
+    rule_type* head = types_.load(
+        std::memory_order_relaxed);
+    do
+    {
+        t.next = head;
+    }
+    while(! types_.compare_exchange_weak(
+        head, &t,
+        std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+rule_profile
+rule_read(
+    rule_type const& t) noexcept
+{
+    rule_profile p;
+    p.calls = t.calls.load(
+        std::memory_order_relaxed);
+    p.failures = t.failures.load(
+        std::memory_order_relaxed);
+    p.bytes = t.bytes.load(
+        std::memory_order_relaxed);
+    p.backtracks = t.backtracks.load(
+        std::memory_order_relaxed);
+    p.cycles = t.cycles.load(
+        std::memory_order_relaxed);
+    return p;
+}
+
+} // detail
+
+std::vector<rule_type_profile>
+get_rule_type_profiles()
+{
+    std::vector<rule_type_profile> v;
+    for(auto t = detail::types_.load(
+            std::memory_order_acquire);
+        t; t = t->next)
+    {
+        v.push_back({
+            core::demangled_name(*t->type),
+            detail::rule_read(*t)});
+    }
+    std::stable_sort(v.begin(), v.end(),
+        [](
+            rule_type_profile const& a,
+            rule_type_profile const& b)
+        {
+            return a.profile.cycles >
+                b.profile.cycles;
+        });
+    return v;
+}
+
+void
+reset_rule_profiles() noexcept
+{
+    for(auto t = detail::types_.load(
+            std::memory_order_acquire);
+        t; t = t->next)
+    {
+        t->calls.store(0,
+            std::memory_order_relaxed);
+        t->failures.store(0,
+            std::memory_order_relaxed);
+        t->bytes.store(0,
+            std::memory_order_relaxed);
+        t->backtracks.store(0,
+            std::memory_order_relaxed);
+        t->cycles.store(0,
+            std::memory_order_relaxed);
+    }
+}
+
+} // grammar
+} // urls
+} // boost
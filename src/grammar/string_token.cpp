@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <memory>
+
+namespace boost {
+namespace urls {
+namespace string_token {
+namespace detail {
+
+namespace {
+
+struct scratch
+{
+    std::unique_ptr<char[]> p;
+    std::size_t cap = 0;
+};
+
+} // (anon)
+
+char*
+prepare_scratch(std::size_t n)
+{
+    static thread_local scratch s;
+    if(n > s.cap)
+    {
+        // grow geometrically so a
+        // thread allocates only a
+        // few times in total
+        std::size_t cap = 2 * s.cap;
+        if(cap < n)
+            cap = n;
+        if(cap < 64)
+            cap = 64;
+        s.p.reset(new char[cap]);
+        s.cap = cap;
+    }
+    return s.p.get();
+}
+
+} // detail
+} // string_token
+} // urls
+} // boost
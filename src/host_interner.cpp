@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_interner.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <new>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// A record is the size of
+// the host, then its
+// lowercase characters
+struct record
+{
+    std::size_t n;
+
+    char const*
+    data() const noexcept
+    {
+        return reinterpret_cast<
+            char const*>(this + 1);
+    }
+};
+
+std::uint64_t
+mix(
+    std::uint64_t a,
+    std::uint64_t b) noexcept
+{
+    a ^= b;
+    a *= 0x9e3779b97f4a7c15ULL;
+    return a ^ (a >> 29);
+}
+
+// Hash the characters 8 at a
+// time, ignoring case
+std::uint64_t
+ci_hash(core::string_view s) noexcept
+{
+    std::uint64_t h = s.size();
+    char const* p = s.data();
+    std::size_t n = s.size();
+    while(n >= 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, 8);
+        h = mix(h, grammar::detail::fold8(w));
+        p += 8;
+        n -= 8;
+    }
+    if(n > 0)
+    {
+        std::uint64_t w = 0;
+        std::memcpy(&w, p, n);
+        h = mix(h, grammar::detail::fold8(w));
+    }
+    return mix(h, 0xa0761d6478bd642fULL);
+}
+
+bool
+equal(
+    void const* rec,
+    void const* k) noexcept
+{
+    auto const& r = *static_cast<
+        record const*>(rec);
+    auto const& s = *static_cast<
+        core::string_view const*>(k);
+    return
+        r.n == s.size() &&
+        grammar::ci_is_equal(
+            core::string_view(r.data(), r.n), s);
+}
+
+} // (anon)
+
+constexpr host_interner::id_type host_interner::npos;
+
+auto
+host_interner::
+intern(core::string_view host) ->
+    id_type
+{
+    std::uint64_t const h = ci_hash(host);
+    id_type const id =
+        t_.find(h, &equal, &host);
+    if(id != npos)
+        return id;
+    return t_.insert(h, &equal, &host,
+        sizeof(record) + host.size(),
+        [](void* p, void const* k)
+        {
+            auto const& s = *static_cast<
+                core::string_view const*>(k);
+            record* r = ::new(p) record;
+            r->n = s.size();
+            char* d = reinterpret_cast<
+                char*>(r + 1);
+            for(std::size_t i = 0;
+                    i < s.size(); ++i)
+                d[i] = grammar::to_lower(s[i]);
+        });
+}
+
+auto
+host_interner::
+find(core::string_view host) const noexcept ->
+    id_type
+{
+    return t_.find(
+        ci_hash(host), &equal, &host);
+}
+
+core::string_view
+host_interner::
+host(id_type id) const noexcept
+{
+    BOOST_ASSERT(id < size());
+    auto const& r = *static_cast<
+        record const*>(t_.get(id));
+    return core::string_view(
+        r.data(), r.n);
+}
+
+} // urls
+} // boost
@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_policy_table.hpp>
+#include "detail/label_trie.hpp"
+#include <cstring>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// A compiled host policy table is a
+// label trie with 8 bytes per node:
+//
+//      uint32      flags
+//      uint32      identifier of the policy
+
+constexpr char magic[4] = {
+    '\x7f', 'H', 'S', 'T' };
+constexpr std::uint32_t version = 1;
+constexpr std::size_t node_size = 8;
+
+// A policy ends on the node
+constexpr std::uint32_t has_policy = 1;
+// The policy includes subdomains
+constexpr std::uint32_t has_subdomains = 2;
+
+// The image of a table without policies
+constexpr char empty_image[
+    detail::label_trie::header_size] = {
+    '\x7f', 'H', 'S', 'T', 1 };
+
+} // (anon)
+
+host_policy_table::
+host_policy_table(
+    host_policy const* policies,
+    std::size_t n)
+{
+    namespace lt = detail::label_trie;
+
+    struct node
+    {
+        std::uint32_t flags = 0;
+        std::uint32_t id = 0;
+    };
+
+    lt::builder trie;
+    std::vector<node> nodes;
+    std::size_t count = 0;
+
+    nodes.emplace_back();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto const& p = policies[i];
+        core::string_view host = p.host;
+        if(host.ends_with('.'))
+            host.remove_suffix(1);
+        if(host.empty())
+            continue;
+        auto const cur = trie.insert(host);
+        nodes.resize(trie.node_count());
+        auto& nd = nodes[cur];
+        if(! (nd.flags & has_policy))
+            ++count;
+        nd.flags = has_policy;
+        if(p.include_subdomains)
+            nd.flags |= has_subdomains;
+        nd.id = p.id;
+    }
+
+    data_.resize(trie.image_size(node_size));
+    auto q = trie.write(
+        &data_[0], magic, version,
+        count, node_size);
+    for(auto const& nd : nodes)
+    {
+        lt::store32(q, nd.flags);
+        lt::store32(q + 4, nd.id);
+        q += node_size;
+    }
+}
+
+//------------------------------------------------
+
+host_policy_table_view::
+host_policy_table_view(
+    core::string_view data)
+    : host_policy_table_view(
+        detail::label_trie::view::checked(
+            data, magic, version, node_size),
+        no_check{})
+{
+}
+
+host_policy_table_view::
+host_policy_table_view(
+    core::string_view data,
+    no_check) noexcept
+{
+    detail::label_trie::view const v(
+        data, node_size);
+    table_ = v.table;
+    nodes_ = v.nodes;
+    labels_ = v.labels;
+    rules_ = v.rules;
+    node_count_ = v.node_count;
+    table_size_ = v.table_size;
+    labels_size_ = v.labels_size;
+}
+
+core::string_view
+host_policy_table_view::
+data() const noexcept
+{
+    if(! table_)
+        return core::string_view(
+            empty_image, sizeof(empty_image));
+    auto const first =
+        table_ - detail::label_trie::header_size;
+    return core::string_view(
+        first, (labels_ + labels_size_) - first);
+}
+
+boost::optional<host_policy>
+host_policy_table_view::
+find(
+    pct_string_view host) const noexcept
+{
+    namespace lt = detail::label_trie;
+    if(node_count_ == 0)
+        return boost::none;
+    lt::view v;
+    v.table = table_;
+    v.nodes = nodes_;
+    v.labels = labels_;
+    v.node_count = node_count_;
+    v.table_size = table_size_;
+    v.labels_size = labels_size_;
+
+    core::string_view const s0 = host;
+    core::string_view s = s0;
+    if(s.ends_with('.'))
+        s.remove_suffix(1);
+    boost::optional<host_policy> r;
+    std::uint32_t cur = 0;
+    while(! s.empty())
+    {
+        auto const label =
+            lt::pop_label(s);
+        cur = v.find(cur, label);
+        if(cur == 0)
+            break;
+        auto const nd = reinterpret_cast<
+            char const*>(nodes_) +
+                std::size_t(cur) * node_size;
+        auto const flags = lt::load32(nd);
+        if(! (flags & has_policy))
+            continue;
+        // the whole host was read
+        bool const exact =
+            label.data() == s0.data();
+        if( ! exact &&
+            ! (flags & has_subdomains))
+            continue;
+        host_policy p;
+        p.host = s0.substr(
+            label.data() - s0.data());
+        p.id = lt::load32(nd + 4);
+        p.include_subdomains =
+            (flags & has_subdomains) != 0;
+        r = p;
+    }
+    return r;
+}
+
+boost::optional<host_policy>
+host_policy_table_view::
+find(
+    url_view_base const& u) const noexcept
+{
+    if(u.host_type() != host_type::name)
+        return boost::none;
+    return find(u.encoded_host());
+}
+
+bool
+host_policy_table_view::
+upgrade(url_base& u) const
+{
+    if( u.scheme_id() != scheme::http ||
+        ! force_https(u))
+        return false;
+    bool const port =
+        u.has_port() &&
+        u.port() == "80";
+    // one more character for the
+    // scheme and one for the port,
+    // so nothing below throws
+    u.reserve(u.size() + 2);
+    u.set_scheme_id(scheme::https);
+    if(port)
+        u.set_port_number(443);
+    return true;
+}
+
+} // urls
+} // boost
@@ -103,41 +103,75 @@ is_multicast() const noexcept
         0xE0000000;
 }
 
+namespace {
+
+// The decimal digits of each octet,
+// followed by a dot, in four bytes
+constexpr char octets[] =
+    "0.\0\0" "1.\0\0" "2.\0\0" "3.\0\0" "4.\0\0" "5.\0\0" "6.\0\0" "7.\0\0"
+    "8.\0\0" "9.\0\0" "10.\0" "11.\0" "12.\0" "13.\0" "14.\0" "15.\0"
+    "16.\0" "17.\0" "18.\0" "19.\0" "20.\0" "21.\0" "22.\0" "23.\0"
+    "24.\0" "25.\0" "26.\0" "27.\0" "28.\0" "29.\0" "30.\0" "31.\0"
+    "32.\0" "33.\0" "34.\0" "35.\0" "36.\0" "37.\0" "38.\0" "39.\0"
+    "40.\0" "41.\0" "42.\0" "43.\0" "44.\0" "45.\0" "46.\0" "47.\0"
+    "48.\0" "49.\0" "50.\0" "51.\0" "52.\0" "53.\0" "54.\0" "55.\0"
+    "56.\0" "57.\0" "58.\0" "59.\0" "60.\0" "61.\0" "62.\0" "63.\0"
+    "64.\0" "65.\0" "66.\0" "67.\0" "68.\0" "69.\0" "70.\0" "71.\0"
+    "72.\0" "73.\0" "74.\0" "75.\0" "76.\0" "77.\0" "78.\0" "79.\0"
+    "80.\0" "81.\0" "82.\0" "83.\0" "84.\0" "85.\0" "86.\0" "87.\0"
+    "88.\0" "89.\0" "90.\0" "91.\0" "92.\0" "93.\0" "94.\0" "95.\0"
+    "96.\0" "97.\0" "98.\0" "99.\0" "100." "101." "102." "103."
+    "104." "105." "106." "107." "108." "109." "110." "111."
+    "112." "113." "114." "115." "116." "117." "118." "119."
+    "120." "121." "122." "123." "124." "125." "126." "127."
+    "128." "129." "130." "131." "132." "133." "134." "135."
+    "136." "137." "138." "139." "140." "141." "142." "143."
+    "144." "145." "146." "147." "148." "149." "150." "151."
+    "152." "153." "154." "155." "156." "157." "158." "159."
+    "160." "161." "162." "163." "164." "165." "166." "167."
+    "168." "169." "170." "171." "172." "173." "174." "175."
+    "176." "177." "178." "179." "180." "181." "182." "183."
+    "184." "185." "186." "187." "188." "189." "190." "191."
+    "192." "193." "194." "195." "196." "197." "198." "199."
+    "200." "201." "202." "203." "204." "205." "206." "207."
+    "208." "209." "210." "211." "212." "213." "214." "215."
+    "216." "217." "218." "219." "220." "221." "222." "223."
+    "224." "225." "226." "227." "228." "229." "230." "231."
+    "232." "233." "234." "235." "236." "237." "238." "239."
+    "240." "241." "242." "243." "244." "245." "246." "247."
+    "248." "249." "250." "251." "252." "253." "254." "255.";
+
+// Writes an octet and a dot with one
+// four byte store, returns the number
+// of digits. Past the dot, the bytes
+// are overwritten or past the end.
+inline
+std::size_t
+write_octet(
+    char* dest,
+    unsigned v) noexcept
+{
+    std::memcpy(dest, &octets[4 * v], 4);
+    return 1 + (v >= 10) + (v >= 100);
+}
+
+} // (anon)
+
 std::size_t
 ipv4_address::
 print_impl(
     char* dest) const noexcept
 {
     auto const start = dest;
-    auto const write =
-        []( char*& dest,
-            unsigned char v)
-        {
-            if(v >= 100)
-            {
-                *dest++ = '0' +
-                    v / 100;
-                v %= 100;
-                *dest++ = '0' +
-                    v / 10;
-                v %= 10;
-            }
-            else if(v >= 10)
-            {
-                *dest++ = '0' +
-                    v / 10;
-                v %= 10;
-            }
-            *dest++ = '0' + v;
-        };
     auto const v = to_uint();
-    write(dest, (v >> 24) & 0xff);
-    *dest++ = '.';
-    write(dest, (v >> 16) & 0xff);
-    *dest++ = '.';
-    write(dest, (v >>  8) & 0xff);
-    *dest++ = '.';
-    write(dest, (v      ) & 0xff);
+    dest += write_octet(dest, (v >> 24) & 0xff) + 1;
+    dest += write_octet(dest, (v >> 16) & 0xff) + 1;
+    dest += write_octet(dest, (v >>  8) & 0xff) + 1;
+    // the last octet has no dot, and at
+    // most three bytes fit in the buffer
+    auto const last = v & 0xff;
+    std::memcpy(dest, &octets[4 * last], 3);
+    dest += 1 + (last >= 10) + (last >= 100);
     return dest - start;
 }
 
@@ -154,6 +188,27 @@ to_string_impl(
 
 //------------------------------------------------
 
+core::string_view
+write_ipv4_addresses(
+    ipv4_address const* addrs,
+    std::size_t n,
+    char* dest,
+    std::size_t dest_size,
+    char delim)
+{
+    if(dest_size / (
+        ipv4_address::max_str_len + 1) < n)
+        detail::throw_length_error();
+    auto const start = dest;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        dest += addrs[i].print_impl(dest);
+        *dest++ = delim;
+    }
+    return core::string_view(
+        start, dest - start);
+}
+
 auto
 parse_ipv4_address(
     core::string_view s) noexcept ->
@@ -16,6 +16,8 @@
 #include <boost/url/rfc/ipv6_address_rule.hpp>
 #include <boost/url/detail/except.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
 #include <cstring>
 
 namespace boost {
@@ -103,122 +105,83 @@ ipv6_address::
 print_impl(
     char* dest) const noexcept
 {
-    auto const count_zeroes =
-    []( unsigned char const* first,
-        unsigned char const* const last)
-    {
-        std::size_t n = 0;
-        while(first != last)
-        {
-            if( first[0] != 0 ||
-                first[1] != 0)
-                break;
-            n += 2;
-            first += 2;
-        }
-        return n;
-    };
-    auto const print_hex =
-    []( char* dest,
-        unsigned short v)
-    {
-        char const* const dig =
-            "0123456789abcdef";
-        if(v >= 0x1000)
-        {
-            *dest++ = dig[v>>12];
-            v &= 0x0fff;
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x100)
-        {
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x10)
-        {
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else
-        {
-            *dest++ = dig[v];
-        }
-        return dest;
-    };
+    char const* const hex =
+        "0123456789abcdef";
     auto const dest0 = dest;
-    // find longest run of zeroes
-    std::size_t best_len = 0;
-    int best_pos = -1;
-    auto it = addr_.data();
     auto const v4 =
         is_v4_mapped();
-    auto const end = v4 ?
-        (it + addr_.size() - 4)
-        : it + addr_.size();
-    while(it != end)
-    {
-        auto n = count_zeroes(
-            it, end);
-        if(n == 0)
-        {
-            it += 2;
-            continue;
-        }
-        if(n > best_len)
-        {
-            best_pos = static_cast<
-                int>(it - addr_.data());
-            best_len = n;
-        }
-        it += n;
-    }
-    it = addr_.data();
-    if(best_pos != 0)
+    // groups printed in hex, the
+    // last two are the ipv4 address
+    int const n = v4 ? 6 : 8;
+    unsigned w[8];
+    unsigned zero = 0;
+    for(int i = 0; i < 8; ++i)
     {
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
+        w[i] = (addr_[2 * i] * 256U) +
+            addr_[2 * i + 1];
+        zero |= unsigned(w[i] == 0) << i;
     }
-    else
+    zero &= (1U << n) - 1;
+
+    // find the first longest run of zero
+    // groups: after k steps, bit i is set
+    // when groups i through i+k are zero.
+    // rfc5952 does not shorten one group.
+    int best_pos = -1;
+    int best_len = 0;
+    unsigned run = zero & (zero >> 1);
+    if(run != 0)
     {
-        *dest++ = ':';
-        it += best_len;
-        if(it == end)
-            *dest++ = ':';
+        best_len = 2;
+        while((run & (run >> 1)) != 0)
+        {
+            run &= run >> 1;
+            ++best_len;
+        }
+        best_pos = core::countr_zero(run);
     }
-    while(it != end)
+
+    for(int i = 0; i < n; ++i)
     {
-        *dest++ = ':';
-        if(it - addr_.data() ==
-            best_pos)
+        if(i == best_pos)
         {
-            it += best_len;
-            if(it == end)
+            // "::" replaces the run
+            *dest++ = ':';
+            i += best_len - 1;
+            if(i == n - 1)
                 *dest++ = ':';
             continue;
         }
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
+        if(i > 0)
+            *dest++ = ':';
+        // all four digits are written and
+        // the leading zeros shifted out.
+        // Characters past the end of the
+        // group are overwritten or past the
+        // end of the result, which fits in
+        // max_str_len.
+        unsigned const v = w[i];
+        int const d = 1 +
+            (v > 0xf) + (v > 0xff) + (v > 0xfff);
+        std::uint32_t x =
+            (std::uint32_t(hex[v >> 12]) << 24) |
+            (std::uint32_t(hex[(v >> 8) & 0xf]) << 16) |
+            (std::uint32_t(hex[(v >> 4) & 0xf]) << 8) |
+             std::uint32_t(hex[v & 0xf]);
+        x <<= 8 * (4 - d);
+        dest[0] = static_cast<char>(x >> 24);
+        dest[1] = static_cast<char>(x >> 16);
+        dest[2] = static_cast<char>(x >> 8);
+        dest[3] = static_cast<char>(x);
+        dest += d;
     }
     if(v4)
     {
         ipv4_address::bytes_type bytes;
-        bytes[0] = it[0];
-        bytes[1] = it[1];
-        bytes[2] = it[2];
-        bytes[3] = it[3];
+        bytes[0] = addr_[12];
+        bytes[1] = addr_[13];
+        bytes[2] = addr_[14];
+        bytes[3] = addr_[15];
         ipv4_address a(bytes);
         *dest++ = ':';
         dest += a.print_impl(dest);
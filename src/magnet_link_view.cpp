@@ -0,0 +1,312 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_MAGNET_LINK_VIEW_IPP
+#define BOOST_URL_IMPL_MAGNET_LINK_VIEW_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/magnet_link_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/rfc/absolute_uri_rule.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// The longest decoded exact topic which
+// is checked without allocating. URNs
+// with a hash are much shorter than this.
+constexpr std::size_t max_topic_size = 256;
+
+// A param in [it, end) of the encoded
+// query, which ends at the next '&'
+struct raw_param
+{
+    core::string_view key;
+    core::string_view value;
+    bool has_value = false;
+    char const* next = nullptr;
+};
+
+raw_param
+next_param(
+    char const* it,
+    char const* end) noexcept
+{
+    raw_param p;
+    char const* amp = static_cast<
+        char const*>(std::memchr(
+            it, '&', end - it));
+    if(! amp)
+        amp = end;
+    char const* eq = static_cast<
+        char const*>(std::memchr(
+            it, '=', amp - it));
+    if(eq)
+    {
+        p.key = core::string_view(
+            it, eq - it);
+        p.value = core::string_view(
+            eq + 1, amp - eq - 1);
+        p.has_value = true;
+    }
+    else
+    {
+        p.key = core::string_view(
+            it, amp - it);
+    }
+    p.next = amp;
+    return p;
+}
+
+// Return the decoded character at
+// it, and advance past its escape
+char
+decode_char(
+    char const*& it) noexcept
+{
+    if(*it != '%')
+        return *it++;
+    char const c = static_cast<char>(
+        (grammar::hexdig_value(it[1]) << 4) +
+            grammar::hexdig_value(it[2]));
+    it += 3;
+    return c;
+}
+
+// The fields of a link, in the order
+// of magnet_link_view::field, after none
+enum class key_kind
+{
+    none,
+    xt,
+    dn,
+    tr,
+    ws
+};
+
+// Return the field of a key. The
+// query was validated by the parser,
+// so every escape is complete.
+key_kind
+classify(core::string_view key) noexcept
+{
+    if(key.size() < 2)
+        return key_kind::none;
+    char const* it = key.data();
+    char const* const end = it + key.size();
+    char const c0 = decode_char(it);
+    if(it == end)
+        return key_kind::none;
+    char const c1 = decode_char(it);
+    if(it == end)
+    {
+        if(c0 == 'x' && c1 == 't')
+            return key_kind::xt;
+        if(c0 == 'd' && c1 == 'n')
+            return key_kind::dn;
+        if(c0 == 't' && c1 == 'r')
+            return key_kind::tr;
+        if(c0 == 'w' && c1 == 's')
+            return key_kind::ws;
+        return key_kind::none;
+    }
+    // "xt." 1*DIGIT
+    if( c0 != 'x' ||
+        c1 != 't' ||
+        decode_char(it) != '.' ||
+        it == end)
+        return key_kind::none;
+    while(it != end)
+    {
+        char const c = decode_char(it);
+        if(c < '0' || c > '9')
+            return key_kind::none;
+    }
+    return key_kind::xt;
+}
+
+// Return true if the decoded value
+// of an exact topic is a URI
+bool
+is_valid_topic(
+    core::string_view value) noexcept
+{
+    if(! std::memchr(
+        value.data(), '%', value.size()))
+        return parse_uri(value).has_value();
+    char buf[max_topic_size];
+    std::size_t n = 0;
+    char const* it = value.data();
+    char const* const end = it + value.size();
+    while(it != end)
+    {
+        if(n == sizeof(buf))
+            return false;
+        buf[n++] = decode_char(it);
+    }
+    return parse_uri(
+        core::string_view(buf, n)).has_value();
+}
+
+pct_string_view
+make_value(
+    core::string_view s) noexcept
+{
+    std::size_t n = 0;
+    for(char c : s)
+        n += c == '%';
+    return make_pct_string_view_unsafe(
+        s.data(), s.size(), s.size() - 2 * n);
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+pct_string_view
+magnet_link_view::
+display_name() const noexcept
+{
+    if(dn_.n == 0)
+        return {};
+    core::string_view q =
+        u_.encoded_query();
+    char const* it = q.data() + dn_.pos;
+    return make_value(next_param(
+        it, q.data() + q.size()).value);
+}
+
+//------------------------------------------------
+
+char const*
+magnet_link_view::
+params_type::
+iterator::
+find_next() const noexcept
+{
+    char const* amp = static_cast<
+        char const*>(std::memchr(
+            p_, '&', end_ - p_));
+    return amp ? amp : end_;
+}
+
+void
+magnet_link_view::
+params_type::
+iterator::
+increment() noexcept
+{
+    key_kind const k =
+        static_cast<key_kind>(
+            static_cast<int>(f_) + 1);
+    while(next_ != end_)
+    {
+        p_ = next_ + 1;
+        next_ = find_next();
+        if(classify(next_param(
+            p_, next_).key) == k)
+            return;
+    }
+    p_ = nullptr;
+    next_ = nullptr;
+}
+
+auto
+magnet_link_view::
+params_type::
+iterator::
+operator*() const noexcept ->
+    reference
+{
+    BOOST_ASSERT(p_);
+    raw_param const p =
+        next_param(p_, next_);
+    return param_pct_view(
+        make_value(p.key),
+        make_value(p.value),
+        p.has_value);
+}
+
+//------------------------------------------------
+
+system::result<magnet_link_view>
+parse_magnet_link(
+    core::string_view s) noexcept
+{
+    auto rv = grammar::parse(
+        s, absolute_uri_rule);
+    if(! rv)
+        return rv.error();
+    if(! grammar::ci_is_equal(
+            rv->scheme(), "magnet"))
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+
+    magnet_link_view m;
+    m.u_ = *rv;
+    if(! m.u_.has_query())
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+
+    // Record the first param and the
+    // number of params of each field
+    core::string_view const q =
+        m.u_.encoded_query();
+    char const* const first = q.data();
+    char const* const end = first + q.size();
+    char const* it = first;
+    for(;;)
+    {
+        raw_param const p =
+            next_param(it, end);
+        magnet_link_view::field_pos* fp = nullptr;
+        switch(classify(p.key))
+        {
+        case key_kind::none:
+            break;
+        case key_kind::xt:
+            if(! p.has_value ||
+                ! is_valid_topic(p.value))
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            fp = &m.xt_;
+            break;
+        case key_kind::dn:
+            fp = &m.dn_;
+            break;
+        case key_kind::tr:
+            fp = &m.tr_;
+            break;
+        case key_kind::ws:
+            fp = &m.ws_;
+            break;
+        }
+        if(fp && fp->n++ == 0)
+            fp->pos = it - first;
+        if(p.next == end)
+            break;
+        it = p.next + 1;
+    }
+    if(m.xt_.n == 0)
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    return m;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,355 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/mailto_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/rfc/absolute_uri_rule.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// A param in [it, end) of the encoded
+// query, which ends at the next '&'
+struct raw_param
+{
+    core::string_view key;
+    core::string_view value;
+    bool has_value = false;
+    char const* next = nullptr;
+};
+
+raw_param
+next_param(
+    char const* it,
+    char const* end) noexcept
+{
+    raw_param p;
+    char const* amp = static_cast<
+        char const*>(std::memchr(
+            it, '&', end - it));
+    if(! amp)
+        amp = end;
+    char const* eq = static_cast<
+        char const*>(std::memchr(
+            it, '=', amp - it));
+    if(eq)
+    {
+        p.key = core::string_view(
+            it, eq - it);
+        p.value = core::string_view(
+            eq + 1, amp - eq - 1);
+        p.has_value = true;
+    }
+    else
+    {
+        p.key = core::string_view(
+            it, amp - it);
+    }
+    p.next = amp;
+    return p;
+}
+
+// The header fields of a URL, in the order
+// of mailto_view::field, after none
+enum class key_kind
+{
+    none,
+    to,
+    cc,
+    bcc,
+    subject,
+    body
+};
+
+// Return the header field of a key. The
+// query was validated by the parser,
+// so every escape is complete.
+key_kind
+classify(core::string_view key) noexcept
+{
+    // longest name is "subject"
+    char buf[7];
+    std::size_t n = 0;
+    char const* it = key.data();
+    char const* const end = it + key.size();
+    while(it != end)
+    {
+        if(n == sizeof(buf))
+            return key_kind::none;
+        if(*it != '%')
+        {
+            buf[n++] = *it++;
+            continue;
+        }
+        buf[n++] = static_cast<char>(
+            (grammar::hexdig_value(it[1]) << 4) +
+                grammar::hexdig_value(it[2]));
+        it += 3;
+    }
+    core::string_view const s(buf, n);
+    switch(n)
+    {
+    case 2:
+        if(grammar::ci_is_equal(s, "to"))
+            return key_kind::to;
+        if(grammar::ci_is_equal(s, "cc"))
+            return key_kind::cc;
+        break;
+    case 3:
+        if(grammar::ci_is_equal(s, "bcc"))
+            return key_kind::bcc;
+        break;
+    case 4:
+        if(grammar::ci_is_equal(s, "body"))
+            return key_kind::body;
+        break;
+    case 7:
+        if(grammar::ci_is_equal(s, "subject"))
+            return key_kind::subject;
+        break;
+    default:
+        break;
+    }
+    return key_kind::none;
+}
+
+// Return the number of non-empty
+// addresses in a list
+std::size_t
+count_addresses(
+    core::string_view s) noexcept
+{
+    std::size_t n = 0;
+    bool empty = true;
+    for(char c : s)
+    {
+        if(c != ',')
+        {
+            empty = false;
+            continue;
+        }
+        n += ! empty;
+        empty = true;
+    }
+    return n + ! empty;
+}
+
+pct_string_view
+make_value(
+    core::string_view s) noexcept
+{
+    std::size_t n = 0;
+    for(char c : s)
+        n += c == '%';
+    return make_pct_string_view_unsafe(
+        s.data(), s.size(), s.size() - 2 * n);
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+pct_string_view
+mailto_view::
+value(field_pos const& fp) const noexcept
+{
+    if(fp.n == 0)
+        return {};
+    core::string_view q =
+        u_.encoded_query();
+    char const* it = q.data() + fp.pos;
+    return make_value(next_param(
+        it, q.data() + q.size()).value);
+}
+
+//------------------------------------------------
+
+mailto_view::
+addresses_type::
+iterator::
+iterator(
+    addresses_type const& r) noexcept
+    : list_end_(r.path_end_)
+    , first_(r.first_)
+    , end_(r.end_)
+    , f_(r.f_)
+    , path_(true)
+{
+    if(! find_address(r.path_))
+        increment();
+}
+
+bool
+mailto_view::
+addresses_type::
+iterator::
+find_address(
+    char const* it) noexcept
+{
+    while(it != list_end_)
+    {
+        char const* comma = static_cast<
+            char const*>(std::memchr(
+                it, ',', list_end_ - it));
+        if(! comma)
+            comma = list_end_;
+        if(comma != it)
+        {
+            p_ = it;
+            next_ = comma;
+            return true;
+        }
+        it = comma + 1;
+    }
+    return false;
+}
+
+void
+mailto_view::
+addresses_type::
+iterator::
+increment() noexcept
+{
+    if( p_ &&
+        next_ != list_end_ &&
+        find_address(next_ + 1))
+        return;
+
+    // the next header field of the field,
+    // starting with the first one when
+    // leaving the path
+    char const* it = nullptr;
+    if(path_)
+    {
+        path_ = false;
+        it = first_;
+    }
+    else if(list_end_ != end_)
+    {
+        it = list_end_ + 1;
+    }
+    key_kind const k =
+        static_cast<key_kind>(
+            static_cast<int>(f_) + 1);
+    while(it)
+    {
+        raw_param const p =
+            next_param(it, end_);
+        if( p.has_value &&
+            classify(p.key) == k)
+        {
+            list_end_ = p.next;
+            if(find_address(p.value.data()))
+                return;
+        }
+        it = p.next != end_ ?
+            p.next + 1 : nullptr;
+    }
+    p_ = nullptr;
+    next_ = nullptr;
+}
+
+auto
+mailto_view::
+addresses_type::
+iterator::
+operator*() const noexcept ->
+    reference
+{
+    BOOST_ASSERT(p_);
+    return make_value(
+        core::string_view(p_, next_ - p_));
+}
+
+//------------------------------------------------
+
+system::result<mailto_view>
+parse_mailto(
+    core::string_view s) noexcept
+{
+    auto rv = grammar::parse(
+        s, absolute_uri_rule);
+    if(! rv)
+        return rv.error();
+    if(! grammar::ci_is_equal(
+            rv->scheme(), "mailto"))
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+
+    mailto_view m;
+    m.u_ = *rv;
+    if(m.u_.has_authority())
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    m.path_n_ = count_addresses(
+        m.u_.encoded_path());
+    if(! m.u_.has_query())
+        return m;
+
+    // Record the first header field and
+    // the number of addresses or header
+    // fields of each field
+    core::string_view const q =
+        m.u_.encoded_query();
+    char const* const first = q.data();
+    char const* const end = first + q.size();
+    char const* it = first;
+    for(;;)
+    {
+        raw_param const p =
+            next_param(it, end);
+        mailto_view::field_pos* fp = nullptr;
+        std::size_t n = 1;
+        switch(classify(p.key))
+        {
+        case key_kind::none:
+            break;
+        case key_kind::to:
+            fp = &m.to_;
+            n = count_addresses(p.value);
+            break;
+        case key_kind::cc:
+            fp = &m.cc_;
+            n = count_addresses(p.value);
+            break;
+        case key_kind::bcc:
+            fp = &m.bcc_;
+            n = count_addresses(p.value);
+            break;
+        case key_kind::subject:
+            fp = &m.subject_;
+            break;
+        case key_kind::body:
+            fp = &m.body_;
+            break;
+        }
+        if( fp &&
+            p.has_value &&
+            n != 0)
+        {
+            if(fp->n == 0)
+                fp->pos = it - first;
+            fp->n += n;
+        }
+        if(p.next == end)
+            break;
+        it = p.next + 1;
+    }
+    return m;
+}
+
+} // urls
+} // boost
@@ -7,7 +7,11 @@
 // Official repository: https://github.com/boostorg/url
 //
 
-#include "../matches.hpp"
+#include <boost/url/detail/config.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <stdexcept>
 
 namespace boost {
 namespace urls {
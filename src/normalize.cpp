@@ -0,0 +1,647 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/normalize.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include "detail/decode.hpp"
+#include "detail/normalize.hpp"
+#include "rfc/detail/charsets.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+normalize_opts::
+normalize_opts(
+    bool lower_case_,
+    bool percent_encoding_,
+    bool remove_dot_segments_,
+    bool remove_default_port_) noexcept
+    : lower_case(lower_case_)
+    , percent_encoding(percent_encoding_)
+    , remove_dot_segments(remove_dot_segments_)
+    , remove_default_port(remove_default_port_)
+{}
+
+namespace detail {
+
+namespace {
+
+// writes the normalized components
+// to [out, last), returns false if
+// the buffer is too small
+class writer
+{
+    char* out_;
+    char const* last_;
+
+public:
+    writer(
+        char* dest,
+        std::size_t size) noexcept
+        : out_(dest)
+        , last_(dest + size)
+    {
+    }
+
+    char*
+    out() const noexcept
+    {
+        return out_;
+    }
+
+    char const*
+    last() const noexcept
+    {
+        return last_;
+    }
+
+    void
+    advance_to(char* out) noexcept
+    {
+        out_ = out;
+    }
+
+    bool
+    fits(std::size_t n) const noexcept
+    {
+        return static_cast<std::size_t>(
+            last_ - out_) >= n;
+    }
+
+    bool
+    put(char c) noexcept
+    {
+        if(! fits(1))
+            return false;
+        *out_++ = c;
+        return true;
+    }
+
+    bool
+    put(
+        core::string_view s,
+        bool lower) noexcept
+    {
+        if(! fits(s.size()))
+            return false;
+        if(! lower)
+        {
+            std::memcpy(
+                out_, s.data(), s.size());
+            out_ += s.size();
+            return true;
+        }
+        for(char c : s)
+            *out_++ = grammar::to_lower(c);
+        return true;
+    }
+
+    // decode the escapes of allowed
+    // characters and uppercase the
+    // others, as in normalize_octets_impl
+    template<class CharSet>
+    bool
+    put_octets(
+        core::string_view s,
+        CharSet const& allowed,
+        bool decode,
+        bool lower) noexcept
+    {
+        if(! decode)
+        {
+            if(! fits(s.size()))
+                return false;
+            for(auto it = s.begin();
+                it != s.end();)
+            {
+                if(*it != '%')
+                {
+                    *out_++ = lower ?
+                        grammar::to_lower(*it) : *it;
+                    ++it;
+                    continue;
+                }
+                *out_++ = *it++;
+                *out_++ = *it++;
+                *out_++ = *it++;
+            }
+            return true;
+        }
+        auto it = s.begin();
+        auto const end = s.end();
+        while(it != end)
+        {
+            if(*it != '%')
+            {
+                if(! fits(1))
+                    return false;
+                *out_++ = lower ?
+                    grammar::to_lower(*it) : *it;
+                ++it;
+                continue;
+            }
+            BOOST_ASSERT(end - it >= 3);
+            char const d =
+                detail::decode_one(it + 1);
+            if(allowed(d))
+            {
+                if(! fits(1))
+                    return false;
+                *out_++ = lower ?
+                    grammar::to_lower(d) : d;
+                it += 3;
+                continue;
+            }
+            if(! fits(3))
+                return false;
+            *out_++ = '%';
+            ++it;
+            *out_++ = grammar::to_upper(*it++);
+            *out_++ = grammar::to_upper(*it++);
+        }
+        return true;
+    }
+};
+
+} // (anon)
+
+struct normalizer
+{
+    static
+    bool
+    write_path(
+        url_view_base const& u,
+        writer& w,
+        normalize_opts const& opt) noexcept;
+
+    static
+    system::result<url_view>
+    write(
+        url_view_base const& u,
+        char* dest,
+        std::size_t size,
+        normalize_opts const& opt) noexcept;
+
+    static
+    void
+    write(
+        url_view_base const& u,
+        url_base& dest,
+        normalize_opts const& opt);
+
+    static
+    bool
+    is_normal(
+        url_view_base const& u,
+        normalize_opts const& opt) noexcept;
+
+    static
+    system::result<url_view>
+    parse(
+        core::string_view s,
+        char* dest,
+        std::size_t size,
+        normalize_opts const& opt) noexcept;
+
+    static
+    system::result<void>
+    parse(
+        core::string_view s,
+        url_base& dest,
+        normalize_opts const& opt);
+};
+
+bool
+normalizer::
+write_path(
+    url_view_base const& u,
+    writer& w,
+    normalize_opts const& opt) noexcept
+{
+    char* const p0 = w.out();
+    if(! w.put_octets(
+            u.encoded_path(),
+            detail::segment_chars,
+            opt.percent_encoding,
+            false))
+        return false;
+    core::string_view p(p0, w.out() - p0);
+    std::size_t skip_dot = 0;
+    bool encode_colons = false;
+    core::string_view first_seg;
+
+    // determine the initial dot segments
+    // to keep, and if colons in the first
+    // segment need to be encoded, with
+    // the rules of url_base::normalize_path
+    if(! opt.remove_dot_segments)
+    {
+        if( !u.has_scheme() &&
+            !u.has_authority())
+        {
+            first_seg = p.substr(
+                0, p.find('/'));
+            encode_colons =
+                first_seg.contains(':');
+        }
+    }
+    else if(
+        !u.has_authority() &&
+        p.starts_with("/./"))
+    {
+        // check if removing the "/./"
+        // would result in "//"
+        skip_dot = 2;
+        while (p.substr(skip_dot, 3).starts_with("/./"))
+            skip_dot += 2;
+        if (p.substr(skip_dot).starts_with("//"))
+            skip_dot = 2;
+        else
+            skip_dot = 0;
+    }
+    else if(
+        !u.has_scheme() &&
+        !u.has_authority())
+    {
+        if (p.starts_with("./"))
+        {
+            // check if removing the "./"
+            // would result in "//"
+            skip_dot = 1;
+            while (p.substr(skip_dot, 3).starts_with("/./"))
+                skip_dot += 2;
+            if (p.substr(skip_dot).starts_with("//"))
+                skip_dot = 2;
+            else
+                skip_dot = 0;
+
+            if ( !skip_dot )
+            {
+                // check if removing "./"s would
+                // leave a first segment with an
+                // ambiguous ":"
+                first_seg = p.substr(2);
+                while (first_seg.starts_with("./"))
+                    first_seg = first_seg.substr(2);
+                first_seg = first_seg.substr(
+                    0, first_seg.find('/'));
+                encode_colons =
+                    first_seg.contains(':');
+            }
+        }
+        else
+        {
+            // decoding may have created
+            // a ":" in the first segment
+            first_seg = p.substr(
+                0, p.find('/'));
+            encode_colons =
+                first_seg.contains(':');
+        }
+    }
+
+    if(encode_colons)
+    {
+        auto const cn = static_cast<
+            std::size_t>(std::count(
+                first_seg.begin(),
+                first_seg.end(),
+                ':'));
+        if(! w.fits(2 * cn))
+            return false;
+        // move the 2nd, 3rd, ... segments
+        char* const seg =
+            const_cast<char*>(first_seg.data());
+        char* const seg_end = seg + first_seg.size();
+        char* const end = w.out();
+        std::memmove(
+            seg_end + 2 * cn,
+            seg_end,
+            end - seg_end);
+        // expand the 1st segment
+        char const* src = seg_end;
+        char* dest = seg_end + 2 * cn;
+        while(src != seg)
+        {
+            --src;
+            if(*src != ':')
+            {
+                *--dest = *src;
+                continue;
+            }
+            // use uppercase as required by
+            // syntax-based normalization
+            *--dest = 'A';
+            *--dest = '3';
+            *--dest = '%';
+        }
+        w.advance_to(end + 2 * cn);
+        p = core::string_view(
+            p0, w.out() - p0);
+        skip_dot = 0;
+    }
+
+    if(opt.remove_dot_segments)
+    {
+        p.remove_prefix(skip_dot);
+        auto const n =
+            detail::remove_dot_segments(
+                p0 + skip_dot, w.last(), p);
+        w.advance_to(p0 + skip_dot + n);
+    }
+    return true;
+}
+
+system::result<url_view>
+normalizer::
+write(
+    url_view_base const& u,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt) noexcept
+{
+    BOOST_ASSERT(
+        dest + size <= u.buffer().data() ||
+        u.buffer().data() + u.size() <= dest);
+    writer w(dest, size);
+    bool const dec = opt.percent_encoding;
+    bool const lower = opt.lower_case;
+
+    // scheme
+    if( u.has_scheme() && (
+        ! w.put(u.scheme(), lower) ||
+        ! w.put(':')))
+        BOOST_URL_RETURN_EC(error::no_space);
+
+    // authority
+    if(u.has_authority())
+    {
+        if(! w.put("//", false))
+            BOOST_URL_RETURN_EC(error::no_space);
+        if(u.has_userinfo())
+        {
+            if(! w.put_octets(
+                    u.encoded_user(),
+                    detail::user_chars,
+                    dec, false))
+                BOOST_URL_RETURN_EC(error::no_space);
+            if( u.has_password() && (
+                ! w.put(':') ||
+                ! w.put_octets(
+                    u.encoded_password(),
+                    detail::password_chars,
+                    dec, false)))
+                BOOST_URL_RETURN_EC(error::no_space);
+            if(! w.put('@'))
+                BOOST_URL_RETURN_EC(error::no_space);
+        }
+        if(u.pi_->host_norm_)
+        {
+            if(! w.put(u.encoded_host(), false))
+                BOOST_URL_RETURN_EC(error::no_space);
+        }
+        else if(! w.put_octets(
+                u.encoded_host(),
+                detail::reg_name_chars,
+                dec && u.host_type() ==
+                    urls::host_type::name,
+                lower))
+            BOOST_URL_RETURN_EC(error::no_space);
+        if(u.has_port())
+        {
+            auto const dp =
+                default_port(u.scheme_id());
+            bool const keep =
+                ! opt.remove_default_port || (
+                ! u.port().empty() && (
+                    dp == 0 ||
+                    u.port_number() != dp));
+            if( keep && (
+                ! w.put(':') ||
+                ! w.put(u.port(), false)))
+                BOOST_URL_RETURN_EC(error::no_space);
+        }
+    }
+
+    // path
+    if(! write_path(u, w, opt))
+        BOOST_URL_RETURN_EC(error::no_space);
+
+    // query
+    if( u.has_query() && (
+        ! w.put('?') ||
+        ! w.put_octets(
+            u.encoded_query(),
+            detail::query_chars,
+            dec, false)))
+        BOOST_URL_RETURN_EC(error::no_space);
+
+    // fragment
+    if( u.has_fragment() && (
+        ! w.put('#') ||
+        ! w.put_octets(
+            u.encoded_fragment(),
+            detail::fragment_chars,
+            dec, false)))
+        BOOST_URL_RETURN_EC(error::no_space);
+
+    auto rv = parse_uri_reference(
+        core::string_view(
+            dest, w.out() - dest));
+    BOOST_ASSERT(rv.has_value());
+    return rv;
+}
+
+void
+normalizer::
+write(
+    url_view_base const& u,
+    url_base& dest,
+    normalize_opts const& opt)
+{
+    if(u.size() == 0)
+    {
+        dest.clear();
+        return;
+    }
+
+    // normalization never grows the URL,
+    // except when colons in the first
+    // segment of a relative path are
+    // encoded
+    std::size_t n = u.size();
+    if( !u.has_scheme() &&
+        !u.has_authority())
+    {
+        auto const p = u.encoded_path();
+        n += 2 * static_cast<std::size_t>(
+            std::count(p.begin(), p.end(), ':'));
+    }
+    url_base::op_t op(dest);
+    dest.reserve_impl(n, op);
+    auto rv = write(u, dest.s_, n, opt);
+    BOOST_ASSERT(rv.has_value());
+    auto const size = rv->size();
+    dest.s_[size] = '\0';
+    dest.impl_ = rv->impl_;
+    dest.impl_.cs_ = dest.s_;
+    dest.impl_.from_ = {parts_base::from::url};
+}
+
+// true if normalizing u leaves it
+// unchanged. This is conservative:
+// any escape or dot segment is
+// rewritten by the normalizer.
+bool
+normalizer::
+is_normal(
+    url_view_base const& u,
+    normalize_opts const& opt) noexcept
+{
+    core::string_view const s = u.buffer();
+    if( opt.percent_encoding &&
+        std::memchr(
+            s.data(), '%', s.size()))
+        return false;
+    if(opt.lower_case)
+    {
+        auto const upper = [](
+            core::string_view t) noexcept
+        {
+            for(char c : t)
+                if(c >= 'A' && c <= 'Z')
+                    return true;
+            return false;
+        };
+        if(upper(u.scheme()))
+            return false;
+        if( ! u.pi_->host_norm_ &&
+            upper(u.encoded_host()))
+            return false;
+    }
+    if( opt.remove_default_port &&
+        u.has_port())
+    {
+        auto const dp =
+            default_port(u.scheme_id());
+        if( u.port().empty() || (
+            dp != 0 &&
+            u.port_number() == dp))
+            return false;
+    }
+    if(opt.remove_dot_segments)
+    {
+        core::string_view p =
+            u.encoded_path();
+        while(! p.empty())
+        {
+            auto const n = p.find('/');
+            auto const seg = p.substr(0, n);
+            if( seg == "." ||
+                seg == "..")
+                return false;
+            if(n == core::string_view::npos)
+                break;
+            p.remove_prefix(n + 1);
+        }
+    }
+    return true;
+}
+
+system::result<url_view>
+normalizer::
+parse(
+    core::string_view s,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt) noexcept
+{
+    auto rv = parse_uri(s);
+    if(! rv)
+        return rv.error();
+    if(! is_normal(*rv, opt))
+        return write(*rv, dest, size, opt);
+    if(size < s.size())
+        BOOST_URL_RETURN_EC(error::no_space);
+    std::memcpy(dest, s.data(), s.size());
+    url_impl impl = *rv->pi_;
+    impl.cs_ = dest;
+    return impl.construct();
+}
+
+system::result<void>
+normalizer::
+parse(
+    core::string_view s,
+    url_base& dest,
+    normalize_opts const& opt)
+{
+    auto rv = parse_uri(s);
+    if(! rv)
+        return rv.error();
+    if(! is_normal(*rv, opt))
+        write(*rv, dest, opt);
+    else
+        dest.copy(*rv);
+    return {};
+}
+
+} // detail
+
+system::result<url_view>
+normalize_to(
+    url_view_base const& u,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt) noexcept
+{
+    return detail::normalizer::write(
+        u, dest, size, opt);
+}
+
+void
+normalize_to(
+    url_view_base const& u,
+    url_base& dest,
+    normalize_opts const& opt)
+{
+    detail::normalizer::write(
+        u, dest, opt);
+}
+
+system::result<url_view>
+parse_uri_normalized(
+    core::string_view s,
+    char* dest,
+    std::size_t size,
+    normalize_opts const& opt) noexcept
+{
+    return detail::normalizer::parse(
+        s, dest, size, opt);
+}
+
+system::result<void>
+parse_uri_normalized(
+    core::string_view s,
+    url_base& dest,
+    normalize_opts const& opt)
+{
+    return detail::normalizer::parse(
+        s, dest, opt);
+}
+
+} // urls
+} // boost
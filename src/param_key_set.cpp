@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_PARAM_KEY_SET_IPP
+#define BOOST_URL_IMPL_PARAM_KEY_SET_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/param_key_set.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// FNV-1a, one character at a time
+inline
+std::size_t
+hash_char(
+    std::size_t h,
+    char c) noexcept
+{
+    return (h ^ static_cast<
+        unsigned char>(c)) * 16777619u;
+}
+
+constexpr std::size_t hash_init = 2166136261u;
+
+} // (anon)
+
+std::uint32_t
+param_key_set::
+child(
+    std::uint32_t n,
+    char c) const noexcept
+{
+    for(auto i = trie_[n].child;
+        i != 0; i = trie_[i].sibling)
+    {
+        if(trie_[i].c == c)
+            return i;
+    }
+    return 0;
+}
+
+void
+param_key_set::
+rehash(std::size_t nkey)
+{
+    std::size_t n = 1;
+    while(n < 2 * nkey)
+        n *= 2;
+    std::vector<slot> table(n);
+    for(std::size_t k = 0; k < keys_.size(); ++k)
+    {
+        std::size_t h = hash_init;
+        for(char c : keys_[k])
+            h = hash_char(h, c);
+        auto i = h & (n - 1);
+        while(table[i].key != 0)
+            i = (i + 1) & (n - 1);
+        table[i].hash = h;
+        table[i].key = k + 1;
+    }
+    table_ = std::move(table);
+}
+
+void
+param_key_set::
+insert(core::string_view key)
+{
+    std::string s(key.data(), key.size());
+    if(ic_)
+    {
+        for(char& c : s)
+            c = grammar::to_lower(c);
+    }
+    std::size_t h = hash_init;
+    for(char c : s)
+        h = hash_char(h, c);
+    if(! table_.empty())
+    {
+        auto const mask = table_.size() - 1;
+        for(auto i = h & mask;
+            table_[i].key != 0;
+            i = (i + 1) & mask)
+        {
+            if( table_[i].hash == h &&
+                keys_[table_[i].key - 1] == s)
+                return;
+        }
+    }
+    // allocate before anything
+    // changes, for the strong
+    // guarantee
+    keys_.reserve(keys_.size() + 1);
+    if(2 * (keys_.size() + 1) > table_.size())
+        rehash(keys_.size() + 1);
+    keys_.push_back(std::move(s));
+    auto const mask = table_.size() - 1;
+    auto i = h & mask;
+    while(table_[i].key != 0)
+        i = (i + 1) & mask;
+    table_[i].hash = h;
+    table_[i].key = keys_.size();
+}
+
+void
+param_key_set::
+insert_prefix(core::string_view prefix)
+{
+    // the nodes are added to a copy
+    // for the strong guarantee
+    std::vector<node> trie(trie_);
+    if(trie.empty())
+        trie.emplace_back();
+    std::uint32_t n = 0;
+    for(char c : prefix)
+    {
+        if(ic_)
+            c = grammar::to_lower(c);
+        std::uint32_t i = trie[n].child;
+        while(i != 0 && trie[i].c != c)
+            i = trie[i].sibling;
+        if(i == 0)
+        {
+            node nd;
+            nd.c = c;
+            nd.sibling = trie[n].child;
+            i = static_cast<
+                std::uint32_t>(trie.size());
+            trie.push_back(nd);
+            trie[n].child = i;
+        }
+        n = i;
+    }
+    trie[n].end = true;
+    trie_ = std::move(trie);
+}
+
+// Walk the trie and hash the key in
+// the same pass, then look the hash
+// up in the table
+template<class Iter>
+bool
+param_key_set::
+match_impl(
+    Iter const first,
+    Iter const last) const noexcept
+{
+    std::size_t h = hash_init;
+    std::size_t n = 0;
+    bool walk = ! trie_.empty();
+    std::uint32_t t = 0;
+    for(Iter it = first; it != last; ++it)
+    {
+        char c = *it;
+        if(ic_)
+            c = grammar::to_lower(c);
+        if(walk)
+        {
+            if(trie_[t].end)
+                return true;
+            t = child(t, c);
+            walk = t != 0;
+        }
+        else if(table_.empty())
+        {
+            return false;
+        }
+        h = hash_char(h, c);
+        ++n;
+    }
+    if(walk && trie_[t].end)
+        return true;
+    if(table_.empty())
+        return false;
+
+    auto const mask = table_.size() - 1;
+    for(auto i = h & mask;
+        table_[i].key != 0;
+        i = (i + 1) & mask)
+    {
+        if(table_[i].hash != h)
+            continue;
+        auto const& k = keys_[table_[i].key - 1];
+        if(k.size() != n)
+            continue;
+        auto p = k.data();
+        Iter it = first;
+        for(; it != last; ++it, ++p)
+        {
+            char c = *it;
+            if(ic_)
+                c = grammar::to_lower(c);
+            if(c != *p)
+                break;
+        }
+        if(it == last)
+            return true;
+    }
+    return false;
+}
+
+bool
+param_key_set::
+match(core::string_view key) const noexcept
+{
+    return match_impl(key.begin(), key.end());
+}
+
+bool
+param_key_set::
+match_encoded(pct_string_view key) const noexcept
+{
+    if(key.decoded_size() == key.size())
+        return match_impl(key.begin(), key.end());
+    decode_view const dv = *key;
+    return match_impl(dv.begin(), dv.end());
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/param_values_view.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+
+auto
+param_values_view::
+iterator::
+operator++() noexcept ->
+    iterator&
+{
+    auto const n = it_.ref.nparam();
+    BOOST_ASSERT(it_.index < n);
+    if(links_)
+    {
+        auto const next =
+            links_[it_.index].next;
+        if(next == n)
+            it_ = detail::params_iter_impl(
+                it_.ref, 0);
+        else
+            it_ = detail::params_iter_impl(
+                it_.ref, links_[next].pos, next);
+        return *this;
+    }
+    for(;;)
+    {
+        it_.increment();
+        if(it_.index == n)
+            return *this;
+        auto const k = *it_.key();
+        if(decoded_key_)
+        {
+            if(ic_ ? grammar::ci_is_equal(k, dkey_)
+                    : k == dkey_)
+                return *this;
+        }
+        else if(ic_ ? grammar::ci_is_equal(k, *key_)
+                    : k == *key_)
+        {
+            return *this;
+        }
+    }
+}
+
+} // urls
+} // boost
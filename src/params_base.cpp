@@ -112,6 +112,18 @@ find(
         opt_);
 }
 
+param_values_view
+params_base::
+values(
+    core::string_view key,
+    ignore_case_param ic) const noexcept
+{
+    return { find_impl(
+        begin().it_, key, ic),
+        {}, key, true,
+        static_cast<bool>(ic), nullptr };
+}
+
 auto
 params_base::
 find_last(
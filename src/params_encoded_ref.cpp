@@ -136,6 +136,13 @@ erase(
     return n;
 }
 
+void
+params_encoded_ref::
+sort()
+{
+    u_->sort_params({});
+}
+
 auto
 params_encoded_ref::
 replace(
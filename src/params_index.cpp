@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_index.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// FNV-1a over the decoded key,
+// folded to lower case if ic
+template<class String>
+std::size_t
+key_hash(
+    String const& key,
+    bool ic) noexcept
+{
+    std::size_t h = 2166136261u;
+    if(! ic)
+    {
+        for(char c : key)
+            h = (h ^ static_cast<
+                unsigned char>(c)) * 16777619u;
+        return h;
+    }
+    for(char c : key)
+        h = (h ^ static_cast<unsigned char>(
+            grammar::to_lower(c))) * 16777619u;
+    return h;
+}
+
+template<class String>
+bool
+key_equal(
+    pct_string_view k0,
+    String const& k1,
+    bool ic) noexcept
+{
+    if(! ic)
+        return *k0 == k1;
+    return grammar::ci_is_equal(*k0, k1);
+}
+
+} // (anon)
+
+params_index::
+params_index(
+    params_view const& ps,
+    ignore_case_param ic)
+{
+    assign(ps, ic);
+}
+
+void
+params_index::
+assign(
+    params_view const& ps,
+    ignore_case_param ic)
+{
+    std::size_t n = 0;
+    if(! ps.empty())
+    {
+        // at most half of the slots
+        // are used by distinct keys
+        n = 1;
+        while(n < 2 * ps.size())
+            n *= 2;
+    }
+    table_.assign(n, slot{});
+    order_.clear();
+    links_.assign(ps.size(),
+        detail::param_link{0, ps.size()});
+    ps_ = ps;
+    ic_ = static_cast<bool>(ic);
+
+    detail::params_iter_impl it(ps_.ref_);
+    detail::params_iter_impl const end(ps_.ref_, 0);
+    for(; ! it.equal(end); it.increment())
+    {
+        auto const key = it.key();
+        auto const h = key_hash(*key, ic_);
+        auto i = h & (n - 1);
+        links_[it.index].pos = it.pos;
+        for(;;)
+        {
+            auto& s = table_[i];
+            if(s.n == 0)
+            {
+                s.n = 1;
+                s.hash = h;
+                s.key = key;
+                s.pos = it.pos;
+                s.index = it.index;
+                s.last = it.index;
+                order_.push_back(i);
+                break;
+            }
+            if( s.hash == h &&
+                key_equal(s.key, *key, ic_))
+            {
+                ++s.n;
+                links_[s.last].next = it.index;
+                s.last = it.index;
+                break;
+            }
+            i = (i + 1) & (n - 1);
+        }
+    }
+}
+
+auto
+params_index::
+find_slot(
+    core::string_view key) const noexcept ->
+        slot const*
+{
+    if(table_.empty())
+        return nullptr;
+    auto const mask = table_.size() - 1;
+    auto const h = key_hash(key, ic_);
+    auto i = h & mask;
+    for(;;)
+    {
+        auto const& s = table_[i];
+        if(s.n == 0)
+            return nullptr;
+        if( s.hash == h &&
+            key_equal(s.key, key, ic_))
+            return &s;
+        i = (i + 1) & mask;
+    }
+}
+
+std::size_t
+params_index::
+count(
+    core::string_view key) const noexcept
+{
+    auto const s = find_slot(key);
+    if(! s)
+        return 0;
+    return s->n;
+}
+
+auto
+params_index::
+find(
+    core::string_view key) const noexcept ->
+        params_view::iterator
+{
+    auto const s = find_slot(key);
+    if(! s)
+        return ps_.end();
+    return params_view::iterator(
+        detail::params_iter_impl(
+            ps_.ref_, s->pos, s->index),
+        ps_.opt_);
+}
+
+param_values_view
+params_index::
+values(
+    core::string_view key) const noexcept
+{
+    auto const s = find_slot(key);
+    if(! s)
+        return { detail::params_iter_impl(
+            ps_.ref_, 0), {}, {}, false, ic_,
+            links_.data() };
+    return make_values(*s);
+}
+
+auto
+params_index::
+operator[](std::size_t i) const noexcept ->
+    group
+{
+    BOOST_ASSERT(i < order_.size());
+    auto const& s = table_[order_[i]];
+    return { s.key, s.n, make_values(s) };
+}
+
+param_values_view
+params_index::
+make_values(slot const& s) const noexcept
+{
+    return { detail::params_iter_impl(
+        ps_.ref_, s.pos, s.index), s.key,
+        {}, false, ic_, links_.data() };
+}
+
+} // urls
+} // boost
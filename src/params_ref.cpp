@@ -121,6 +121,21 @@ erase(
     return n;
 }
 
+std::size_t
+params_ref::
+erase(
+    param_key_set const& keys) noexcept
+{
+    return u_->erase_params(keys);
+}
+
+void
+params_ref::
+sort()
+{
+    u_->sort_params(opt_);
+}
+
 auto
 params_ref::
 replace(
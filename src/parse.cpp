@@ -13,53 +13,311 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/parse_cache.hpp>
 #include <boost/url/rfc/absolute_uri_rule.hpp>
 #include <boost/url/rfc/relative_ref_rule.hpp>
 #include <boost/url/rfc/uri_rule.hpp>
 #include <boost/url/rfc/uri_reference_rule.hpp>
 #include <boost/url/rfc/origin_form_rule.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/detail/stats.hpp>
+#include "detail/parse_options.hpp"
+#include "detail/trace.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
 
 namespace boost {
 namespace urls {
 
+namespace {
+
+constexpr
+grammar::lut_chars
+scheme_chars(
+    "0123456789" "+-."
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+
+// the characters allowed anywhere in a
+// URI reference, except those which are
+// checked one at a time. The fragment
+// may contain '#', see fragment_chars.
+constexpr
+grammar::lut_chars
+plain_chars =
+    pchars + '/' + '?' + '#';
+
+bool
+is_delimiter(char c) noexcept
+{
+    return
+        c == '/' ||
+        c == '?' ||
+        c == '#';
+}
+
+bool
+is_plausible(
+    core::string_view s,
+    bool absolute) noexcept
+{
+    char const* it = s.data();
+    char const* const last =
+        it + s.size();
+
+    // scheme
+    char const* p = grammar::find_if_not(
+        it, last, scheme_chars);
+    if( p != last &&
+        *p == ':' &&
+        p != it &&
+        grammar::alpha_chars(*it))
+    {
+        it = p + 1;
+    }
+    else if(absolute)
+    {
+        return false;
+    }
+    else
+    {
+        // the first segment of a relative
+        // reference has no ':'
+        p = std::find_if(p, last,
+            [](char c)
+            {
+                return c == ':' ||
+                    is_delimiter(c);
+            });
+        if( p != last &&
+            *p == ':')
+            return false;
+    }
+
+    // authority
+    char const* auth = last;
+    char const* auth_end = last;
+    if( last - it >= 2 &&
+        it[0] == '/' &&
+        it[1] == '/')
+    {
+        auth = it + 2;
+        auth_end = std::find_if(
+            auth, last, is_delimiter);
+    }
+
+    // every character, in one scan of
+    // the string for the common ones
+    for(;;)
+    {
+        it = grammar::find_if_not(
+            it, last, plain_chars);
+        if(it == last)
+            return true;
+        switch(*it)
+        {
+        case '%':
+            if( last - it < 3 ||
+                ! grammar::hexdig_chars(it[1]) ||
+                ! grammar::hexdig_chars(it[2]))
+                return false;
+            it += 3;
+            break;
+        case '[':
+        case ']':
+            if( it < auth ||
+                it >= auth_end)
+                return false;
+            ++it;
+            break;
+        default:
+            return false;
+        }
+    }
+}
+
+} // (anon)
+
 system::result<url_view>
 parse_absolute_uri(
     core::string_view s)
 {
-    return grammar::parse(
+    auto rv = grammar::parse(
         s, absolute_uri_rule);
+    detail::stats_parse(
+        rv.has_value());
+    return rv;
 }
 
 system::result<url_view>
 parse_origin_form(
     core::string_view s)
 {
-    return grammar::parse(
+    BOOST_URL_TRACE2(parse_origin_form_entry,
+        s.data(), s.size());
+    auto rv = grammar::parse(
         s, origin_form_rule);
+    detail::stats_parse(
+        rv.has_value());
+    BOOST_URL_TRACE1(parse_origin_form_return,
+        rv.has_value());
+    return rv;
+}
+
+system::result<url_view>
+parse_origin_form(
+    core::string_view s,
+    parse_options const& opt)
+{
+    if(s.size() > opt.max_size)
+    {
+        BOOST_URL_RETURN_EC(error::too_long);
+    }
+    auto rv = parse_origin_form(s);
+    if(! rv)
+        return rv;
+    auto rv2 = detail::check_limits(*rv, opt);
+    if(! rv2)
+        return rv2.error();
+    return rv;
 }
 
 system::result<url_view>
 parse_relative_ref(
     core::string_view s)
 {
-    return grammar::parse(
+    auto rv = grammar::parse(
         s, relative_ref_rule);
+    detail::stats_parse(
+        rv.has_value());
+    return rv;
 }
 system::result<url_view>
 parse_uri(
     core::string_view s)
 {
-    return grammar::parse(
-        s, uri_rule);
+    BOOST_URL_TRACE2(parse_uri_entry,
+        s.data(), s.size());
+    parse_cache* c =
+        detail::get_parse_cache();
+    auto rv = c ?
+        c->parse_uri(s) :
+        grammar::parse(s, uri_rule);
+    if(! c)
+        detail::stats_parse(
+            rv.has_value());
+    BOOST_URL_TRACE1(parse_uri_return,
+        rv.has_value());
+    return rv;
+}
+
+system::result<url_view>
+parse_uri(
+    core::string_view s,
+    parse_options const& opt)
+{
+    if(s.size() > opt.max_size)
+    {
+        BOOST_URL_RETURN_EC(error::too_long);
+    }
+    auto rv = parse_uri(s);
+    if(! rv)
+        return rv;
+    auto rv2 = detail::check_limits(*rv, opt);
+    if(! rv2)
+        return rv2.error();
+    return rv;
 }
 
 system::result<url_view>
 parse_uri_reference(
     core::string_view s)
 {
-    return grammar::parse(
-        s, uri_reference_rule);
+    BOOST_URL_TRACE2(parse_uri_reference_entry,
+        s.data(), s.size());
+    parse_cache* c =
+        detail::get_parse_cache();
+    auto rv = c ?
+        c->parse_uri_reference(s) :
+        grammar::parse(s, uri_reference_rule);
+    if(! c)
+        detail::stats_parse(
+            rv.has_value());
+    BOOST_URL_TRACE1(parse_uri_reference_return,
+        rv.has_value());
+    return rv;
+}
+
+bool
+is_plausible_uri(
+    core::string_view s) noexcept
+{
+    return is_plausible(s, true);
+}
+
+bool
+is_plausible_uri_reference(
+    core::string_view s) noexcept
+{
+    return is_plausible(s, false);
+}
+
+std::size_t
+parse_uri_reference(
+    core::string_view const* first,
+    std::size_t n,
+    system::result<url_view>* out) noexcept
+{
+    parse_progress p;
+    parse_uri_reference(
+        first, n, out, p);
+    return p.good;
+}
+
+bool
+parse_uri_reference(
+    core::string_view const* first,
+    std::size_t n,
+    system::result<url_view>* out,
+    parse_progress& p,
+    parse_budget b) noexcept
+{
+    BOOST_ASSERT(p.next <= n);
+    std::size_t urls = 0;
+    std::size_t bytes = 0;
+    while(p.next != n)
+    {
+        core::string_view const s =
+            first[p.next];
+        // always parse one input,
+        // so that the batch moves
+        if( urls > 0 && (
+            urls >= b.urls ||
+            bytes >= b.bytes ||
+            s.size() > b.bytes - bytes))
+            return false;
+        ++urls;
+        bytes += s.size();
+        char const* it = s.data();
+        char const* const end =
+            it + s.size();
+        auto rv = uri_reference_rule.parse(
+            it, end);
+        if( rv &&
+            it != end)
+            rv = grammar::error::leftover;
+        if(rv)
+            ++p.good;
+        detail::stats_parse(
+            rv.has_value());
+        out[p.next++] = rv;
+    }
+    return true;
 }
 
 } // urls
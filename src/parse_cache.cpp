@@ -0,0 +1,279 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse_cache.hpp>
+#include <boost/url/rfc/uri_rule.hpp>
+#include <boost/url/rfc/uri_reference_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include "detail/url_image.hpp"
+#include <boost/assert.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+enum : int
+{
+    kind_uri = 1,
+    kind_uri_reference = 2
+};
+
+std::uint64_t
+mix(
+    std::uint64_t a,
+    std::uint64_t b) noexcept
+{
+    a ^= b;
+    a *= 0x9e3779b97f4a7c15ULL;
+    return a ^ (a >> 29);
+}
+
+// Hash the characters 8 at a time. This
+// only selects a slot; the characters
+// of a hit are compared with memcmp.
+std::uint64_t
+hash(
+    core::string_view s,
+    int kind) noexcept
+{
+    std::uint64_t h = mix(
+        s.size(), static_cast<
+            std::uint64_t>(kind));
+    char const* p = s.data();
+    std::size_t n = s.size();
+    while(n >= 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, 8);
+        h = mix(h, w);
+        p += 8;
+        n -= 8;
+    }
+    if(n > 0)
+    {
+        std::uint64_t w = 0;
+        std::memcpy(&w, p, n);
+        h = mix(h, w);
+    }
+    return mix(h, 0xa0761d6478bd642fULL);
+}
+
+std::atomic<parse_cache*> installed_{nullptr};
+
+} // (anon)
+
+struct parse_cache::shard
+{
+    struct slot
+    {
+        std::uint64_t hash = 0;
+        int kind = 0;
+        std::string chars;
+        detail::url_impl impl{
+            detail::url_impl::from::string};
+    };
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::mutex m;
+#endif
+    slot* slots = nullptr;
+    parse_cache_stats st;
+
+    ~shard()
+    {
+        delete[] slots;
+    }
+};
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# define BOOST_URL_PARSE_CACHE_LOCK(sh) \
+    std::lock_guard<std::mutex> lock((sh).m)
+#else
+# define BOOST_URL_PARSE_CACHE_LOCK(sh) \
+    (void)(sh)
+#endif
+
+parse_cache::
+parse_cache(
+    std::size_t slots,
+    std::size_t max_size)
+    : nslot_(
+        (slots + shard_count - 1) /
+            shard_count)
+    , max_size_(max_size)
+{
+    if(nslot_ == 0)
+        nslot_ = 1;
+    shards_ = new shard[shard_count];
+    try
+    {
+        for(std::size_t i = 0;
+            i < shard_count; ++i)
+            shards_[i].slots =
+                new shard::slot[nslot_];
+    }
+    catch(...)
+    {
+        delete[] shards_;
+        throw;
+    }
+}
+
+parse_cache::
+~parse_cache()
+{
+    BOOST_ASSERT(
+        installed_.load() != this);
+    delete[] shards_;
+}
+
+system::result<url_view>
+parse_cache::
+parse_uri(core::string_view s)
+{
+    return parse(s, kind_uri);
+}
+
+system::result<url_view>
+parse_cache::
+parse_uri_reference(core::string_view s)
+{
+    return parse(s, kind_uri_reference);
+}
+
+system::result<url_view>
+parse_cache::
+parse(
+    core::string_view s,
+    int kind)
+{
+    std::uint64_t const h = hash(s, kind);
+    shard& sh = shards_[h % shard_count];
+    shard::slot& e = sh.slots[
+        (h / shard_count) % nslot_];
+    {
+        BOOST_URL_PARSE_CACHE_LOCK(sh);
+        if( e.hash == h &&
+            e.kind == kind &&
+            e.chars.size() == s.size() &&
+            std::memcmp(
+                e.chars.data(),
+                s.data(),
+                s.size()) == 0)
+        {
+            detail::url_impl impl = e.impl;
+            ++sh.st.hits;
+            impl.cs_ = s.data();
+            detail::stats_parse(true);
+            return impl.construct();
+        }
+        ++sh.st.misses;
+    }
+
+    system::result<url_view> rv;
+    if(kind == kind_uri)
+        rv = grammar::parse(s, uri_rule);
+    else
+        rv = grammar::parse(s, uri_reference_rule);
+    detail::stats_parse(rv.has_value());
+    if( ! rv ||
+        s.size() > max_size_)
+        return rv;
+
+    BOOST_URL_PARSE_CACHE_LOCK(sh);
+    if(e.kind != 0)
+    {
+        if( e.hash == h &&
+            e.kind == kind &&
+            e.chars == s)
+            // stored by another thread
+            return rv;
+        ++sh.st.evictions;
+    }
+    e.chars.assign(s.data(), s.size());
+    e.hash = h;
+    e.kind = kind;
+    e.impl = detail::url_image::impl(*rv);
+    ++sh.st.insertions;
+    return rv;
+}
+
+parse_cache_stats
+parse_cache::
+stats() const noexcept
+{
+    parse_cache_stats st;
+    for(std::size_t i = 0;
+        i < shard_count; ++i)
+    {
+        shard& sh = shards_[i];
+        BOOST_URL_PARSE_CACHE_LOCK(sh);
+        st.hits += sh.st.hits;
+        st.misses += sh.st.misses;
+        st.insertions += sh.st.insertions;
+        st.evictions += sh.st.evictions;
+    }
+    return st;
+}
+
+void
+parse_cache::
+clear() noexcept
+{
+    for(std::size_t i = 0;
+        i < shard_count; ++i)
+    {
+        shard& sh = shards_[i];
+        BOOST_URL_PARSE_CACHE_LOCK(sh);
+        for(std::size_t j = 0;
+            j < nslot_; ++j)
+        {
+            // keep the capacity
+            sh.slots[j].kind = 0;
+            sh.slots[j].hash = 0;
+            sh.slots[j].chars.clear();
+        }
+        sh.st = {};
+    }
+}
+
+#undef BOOST_URL_PARSE_CACHE_LOCK
+
+parse_cache*
+set_parse_cache(parse_cache* c) noexcept
+{
+    return installed_.exchange(c,
+        std::memory_order_acq_rel);
+}
+
+namespace detail {
+
+parse_cache*
+get_parse_cache() noexcept
+{
+    return installed_.load(
+        std::memory_order_acquire);
+}
+
+} // detail
+
+} // urls
+} // boost
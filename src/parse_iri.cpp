@@ -0,0 +1,362 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_PARSE_IRI_IPP
+#define BOOST_URL_IMPL_PARSE_IRI_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse_iri.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Return the first byte in [it, last)
+// which is not ASCII, or last
+char const*
+find_non_ascii(
+    char const* it,
+    char const* const last) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    while(last - it >= 16)
+    {
+        // the high bit of each byte
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(it))));
+        if(m)
+            return it + boost::core::countr_zero(m);
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    while(last - it >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(it));
+        if(vmaxvq_u8(v) >= 0x80)
+            break;
+        it += 16;
+    }
+#endif
+    while( it != last &&
+        static_cast<unsigned char>(*it) < 0x80)
+        ++it;
+    return it;
+}
+
+// Decode the UTF-8 sequence at it and return
+// its size, or zero if it is not valid: a
+// continuation byte, a truncated or overlong
+// sequence, a surrogate, or above U+10FFFF
+std::size_t
+decode_utf8(
+    char const* it,
+    char const* const last,
+    std::uint32_t& cp) noexcept
+{
+    auto const byte = [it](std::size_t i)
+    {
+        return static_cast<std::uint32_t>(
+            static_cast<unsigned char>(it[i]));
+    };
+    std::uint32_t const c = byte(0);
+    std::size_t n;
+    std::uint32_t min;
+    if(c < 0xC2)
+        return 0;
+    if(c < 0xE0)
+    {
+        n = 2;
+        min = 0x80;
+        cp = c & 0x1F;
+    }
+    else if(c < 0xF0)
+    {
+        n = 3;
+        min = 0x800;
+        cp = c & 0x0F;
+    }
+    else if(c < 0xF5)
+    {
+        n = 4;
+        min = 0x10000;
+        cp = c & 0x07;
+    }
+    else
+    {
+        return 0;
+    }
+    if(static_cast<std::size_t>(last - it) < n)
+        return 0;
+    for(std::size_t i = 1; i < n; ++i)
+    {
+        std::uint32_t const b = byte(i);
+        if((b & 0xC0) != 0x80)
+            return 0;
+        cp = (cp << 6) | (b & 0x3F);
+    }
+    if( cp < min ||
+        cp > 0x10FFFF ||
+        (cp >= 0xD800 && cp <= 0xDFFF))
+        return 0;
+    return n;
+}
+
+bool
+is_ucschar(std::uint32_t c) noexcept
+{
+    if(c < 0x10000)
+        return
+            (c >= 0xA0 && c <= 0xD7FF) ||
+            (c >= 0xF900 && c <= 0xFDCF) ||
+            (c >= 0xFDF0 && c <= 0xFFEF);
+    // the planes 1 to 14, less the last
+    // two code points of each plane and
+    // the block U+E0000 to U+E0FFF
+    if((c & 0xFFFE) == 0xFFFE)
+        return false;
+    return
+        c < 0xE0000 ||
+        (c >= 0xE1000 && c < 0xF0000);
+}
+
+bool
+is_iprivate(std::uint32_t c) noexcept
+{
+    if(c < 0x10000)
+        return c >= 0xE000 && c <= 0xF8FF;
+    return
+        c >= 0xF0000 &&
+        (c & 0xFFFE) != 0xFFFE;
+}
+
+// Write the IRI in [it, last) to dest
+// with its bytes which are not ASCII
+// percent-encoded, and return the end
+char*
+map_to_uri(
+    char* dest,
+    char const* it,
+    char const* const last) noexcept
+{
+    constexpr char const* hex =
+        "0123456789ABCDEF";
+    while(it != last)
+    {
+        char const* p =
+            find_non_ascii(it, last);
+        std::memcpy(dest, it, p - it);
+        dest += p - it;
+        it = p;
+        while( it != last &&
+            static_cast<unsigned char>(*it) >= 0x80)
+        {
+            unsigned char const c =
+                static_cast<unsigned char>(*it++);
+            dest[0] = '%';
+            dest[1] = hex[c >> 4];
+            dest[2] = hex[c & 0xf];
+            dest += 3;
+        }
+    }
+    return dest;
+}
+
+} // (anon)
+
+namespace detail {
+
+struct iri_parser
+    : parts_base
+{
+    static
+    system::result<void>
+    apply(
+        core::string_view s,
+        url_base& dest);
+
+    static
+    void
+    assign(
+        url_base& dest,
+        url_base::op_t& op,
+        char const* p,
+        url_view const& u);
+};
+
+// Store the URI reference u, whose string
+// is p, in dest, which has room for it
+void
+iri_parser::
+assign(
+    url_base& dest,
+    url_base::op_t& op,
+    char const* p,
+    url_view const& u)
+{
+    std::size_t const n = u.size();
+    if(n == 0)
+    {
+        dest.clear();
+        return;
+    }
+    dest.reserve_impl(n, op);
+    std::memmove(dest.s_, p, n);
+    dest.impl_ = u.impl_;
+    dest.impl_.cs_ = dest.s_;
+    dest.impl_.from_ = from::url;
+    dest.s_[n] = '\0';
+}
+
+system::result<void>
+iri_parser::
+apply(
+    core::string_view s,
+    url_base& dest)
+{
+    char const* const first = s.data();
+    char const* const last = first + s.size();
+    char const* it = find_non_ascii(first, last);
+    if(it == last)
+    {
+        // all ASCII, so the IRI
+        // is also the URI
+        auto rv = parse_uri_reference(s);
+        if(! rv)
+            return rv.error();
+        url_base::op_t op(dest);
+        assign(dest, op, first, *rv);
+        return {};
+    }
+
+    // Validate the characters which are not
+    // ASCII and count their bytes. The part
+    // of the IRI is only tracked up to the
+    // private characters, which are rare.
+    std::size_t high = 0;
+    char const* scanned = first;
+    bool query = false;
+    bool fragment = false;
+    while(it != last)
+    {
+        std::uint32_t cp;
+        std::size_t const n =
+            decode_utf8(it, last, cp);
+        if(n == 0)
+            BOOST_URL_RETURN_EC(
+                error::bad_utf8);
+        if(! is_ucschar(cp))
+        {
+            if(! is_iprivate(cp))
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            for(; scanned != it; ++scanned)
+            {
+                if(*scanned == '#')
+                    fragment = true;
+                else if(*scanned == '?')
+                    query = true;
+            }
+            if( ! query ||
+                fragment)
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+        }
+        high += n;
+        it = find_non_ascii(it + n, last);
+    }
+    std::size_t const size =
+        s.size() + 2 * high;
+
+    // The URI is written directly into an
+    // empty destination, which has nothing
+    // to lose if it is not valid, and into
+    // a temporary buffer otherwise.
+    bool const direct =
+        dest.size() == 0 &&
+        ! (dest.s_ &&
+            first < dest.s_ + dest.cap_ &&
+            last > dest.s_);
+    url_base::op_t op(dest);
+    char small[512];
+    std::unique_ptr<char[]> large;
+    char* buf = small;
+    if(direct)
+    {
+        dest.reserve_impl(size, op);
+        buf = dest.s_;
+    }
+    else if(size > sizeof(small))
+    {
+        large.reset(new char[size]);
+        buf = large.get();
+    }
+    char const* const end =
+        map_to_uri(buf, first, last);
+    BOOST_ASSERT(static_cast<std::size_t>(
+        end - buf) == size);
+    (void)end;
+
+    auto rv = parse_uri_reference(
+        core::string_view(buf, size));
+    if(! rv)
+    {
+        if(direct)
+            dest.s_[0] = '\0';
+        return rv.error();
+    }
+    assign(dest, op, buf, *rv);
+    return {};
+}
+
+} // detail
+
+//------------------------------------------------
+
+system::result<void>
+parse_iri_reference(
+    core::string_view s,
+    url_base& dest)
+{
+    return detail::iri_parser::apply(s, dest);
+}
+
+system::result<url>
+parse_iri_reference(
+    core::string_view s)
+{
+    url u;
+    auto rv = detail::iri_parser::apply(s, u);
+    if(! rv)
+        return rv.error();
+    return u;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,1119 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_PARSE_WHATWG_IPP
+#define BOOST_URL_IMPL_PARSE_WHATWG_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse_whatwg.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include "rfc/detail/charsets.hpp"
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr grammar::lut_chars
+    tab_or_newline_chars("\t\n\r");
+
+constexpr grammar::lut_chars
+    scheme_chars(
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz"
+        "0123456789" "+-.");
+
+constexpr grammar::lut_chars
+    forbidden_host_chars =
+        grammar::lut_chars('\0') +
+        "\t\n\r #/:<>?@[\\]^|";
+
+// The characters kept in each part.
+// These are the RFC 3986 sets, less
+// the characters which the WHATWG
+// percent-encode sets escape.
+constexpr auto credential_chars =
+    detail::user_chars - ';' - '=';
+
+constexpr auto special_query_chars =
+    detail::query_chars - '\'';
+
+// these end the parts of
+// special and other URLs
+constexpr grammar::lut_chars
+    special_authority_end("/\\?#");
+
+constexpr grammar::lut_chars
+    authority_end("/?#");
+
+constexpr grammar::lut_chars
+    path_end("?#");
+
+inline
+bool
+is_forbidden_domain(char c) noexcept
+{
+    unsigned char const u =
+        static_cast<unsigned char>(c);
+    return
+        u < 0x20 || u >= 0x7f ||
+        c == '%' ||
+        forbidden_host_chars(c);
+}
+
+inline
+bool
+is_escape(
+    char const* it,
+    char const* end) noexcept
+{
+    return
+        end - it >= 3 &&
+        it[0] == '%' &&
+        grammar::hexdig_chars(it[1]) &&
+        grammar::hexdig_chars(it[2]);
+}
+
+// Return the size of s once the characters
+// not in cs are escaped. Valid escapes are
+// kept, and other percent signs escaped.
+std::size_t
+measure_part(
+    core::string_view s,
+    grammar::lut_chars const& cs) noexcept
+{
+    std::size_t n = 0;
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    for(;;)
+    {
+        char const* const it0 = it;
+        it = grammar::find_if_not(it, end, cs);
+        n += it - it0;
+        if(it == end)
+            return n;
+        n += 3;
+        it += is_escape(it, end) ? 3 : 1;
+    }
+}
+
+char*
+encode_part(
+    char* dest,
+    core::string_view s,
+    grammar::lut_chars const& cs,
+    bool lower = false) noexcept
+{
+    char const* const hex =
+        "0123456789ABCDEF";
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    for(;;)
+    {
+        char const* const it0 = it;
+        it = grammar::find_if_not(it, end, cs);
+        if(lower)
+        {
+            for(char const* p = it0; p != it; ++p)
+                *dest++ = grammar::to_lower(*p);
+        }
+        else if(it != it0)
+        {
+            std::memcpy(dest, it0, it - it0);
+            dest += it - it0;
+        }
+        if(it == end)
+            return dest;
+        if(is_escape(it, end))
+        {
+            std::memcpy(dest, it, 3);
+            dest += 3;
+            it += 3;
+            continue;
+        }
+        unsigned char const c =
+            static_cast<unsigned char>(*it++);
+        *dest++ = '%';
+        *dest++ = hex[c >> 4];
+        *dest++ = hex[c & 0xf];
+    }
+}
+
+inline
+bool
+is_drive_letter(core::string_view s) noexcept
+{
+    return
+        s.size() == 2 &&
+        grammar::alpha_chars(s[0]) &&
+        (s[1] == ':' || s[1] == '|');
+}
+
+bool
+is_single_dot(core::string_view s) noexcept
+{
+    return
+        s == "." ||
+        grammar::ci_is_equal(s, "%2e");
+}
+
+bool
+is_double_dot(core::string_view s) noexcept
+{
+    return
+        s == ".." ||
+        grammar::ci_is_equal(s, ".%2e") ||
+        grammar::ci_is_equal(s, "%2e.") ||
+        grammar::ci_is_equal(s, "%2e%2e");
+}
+
+// Parse one part of an IPv4 address,
+// in decimal, octal or hexadecimal.
+// Values which do not fit in 32 bits
+// are reported as 2^32.
+bool
+parse_ipv4_number(
+    core::string_view s,
+    std::uint64_t& v) noexcept
+{
+    if(s.empty())
+        return false;
+    unsigned r = 10;
+    if( s.size() >= 2 &&
+        s[0] == '0' &&
+        (s[1] == 'x' || s[1] == 'X'))
+    {
+        s.remove_prefix(2);
+        r = 16;
+    }
+    else if(
+        s.size() >= 2 &&
+        s[0] == '0')
+    {
+        s.remove_prefix(1);
+        r = 8;
+    }
+    v = 0;
+    for(char c : s)
+    {
+        signed char const d =
+            grammar::hexdig_value(c);
+        if( d < 0 ||
+            static_cast<unsigned>(d) >= r)
+            return false;
+        if(v < 0x100000000)
+            v = v * r + static_cast<
+                unsigned>(d);
+    }
+    if(v > 0x100000000)
+        v = 0x100000000;
+    return true;
+}
+
+// true if the last label of the
+// domain is a number, in which case
+// the host is an IPv4 address
+bool
+ends_in_number(core::string_view s) noexcept
+{
+    if( ! s.empty() &&
+        s.back() == '.')
+        s.remove_suffix(1);
+    auto const pos = s.rfind('.');
+    if(pos != core::string_view::npos)
+        s.remove_prefix(pos + 1);
+    if( ! s.empty() &&
+        grammar::find_if_not(
+            s.begin(), s.end(),
+            grammar::digit_chars) == s.end())
+        return true;
+    std::uint64_t v;
+    return parse_ipv4_number(s, v);
+}
+
+bool
+parse_whatwg_ipv4(
+    core::string_view s,
+    std::uint32_t& result) noexcept
+{
+    if( s.size() > 1 &&
+        s.back() == '.')
+        s.remove_suffix(1);
+    std::uint64_t v[4];
+    std::size_t n = 0;
+    for(;;)
+    {
+        if(n == 4)
+            return false;
+        auto const pos = s.find('.');
+        if(! parse_ipv4_number(
+                s.substr(0, pos), v[n++]))
+            return false;
+        if(pos == core::string_view::npos)
+            break;
+        s.remove_prefix(pos + 1);
+    }
+    for(std::size_t i = 0; i < n - 1; ++i)
+        if(v[i] > 255)
+            return false;
+    if(v[n - 1] >= (std::uint64_t(1) <<
+            (8 * (5 - n))))
+        return false;
+    std::uint64_t ip = v[n - 1];
+    for(std::size_t i = 0; i < n - 1; ++i)
+        ip += v[i] << (8 * (3 - i));
+    result = static_cast<std::uint32_t>(ip);
+    return true;
+}
+
+// The WHATWG serialization, which
+// compresses the first longest run
+// of zero pieces and never prints an
+// embedded IPv4 address
+std::size_t
+print_whatwg_ipv6(
+    char* dest,
+    ipv6_address const& a) noexcept
+{
+    char const* const hex =
+        "0123456789abcdef";
+    auto const b = a.to_bytes();
+    unsigned w[8];
+    for(int i = 0; i < 8; ++i)
+        w[i] = b[2 * i] * 256U + b[2 * i + 1];
+    int best = -1;
+    int best_len = 1;
+    for(int i = 0; i < 8;)
+    {
+        if(w[i] != 0)
+        {
+            ++i;
+            continue;
+        }
+        int j = i;
+        while(j < 8 && w[j] == 0)
+            ++j;
+        if(j - i > best_len)
+        {
+            best = i;
+            best_len = j - i;
+        }
+        i = j;
+    }
+    char* const dest0 = dest;
+    *dest++ = '[';
+    for(int i = 0; i < 8; ++i)
+    {
+        if(i == best)
+        {
+            *dest++ = ':';
+            if(i == 0)
+                *dest++ = ':';
+            i += best_len - 1;
+            continue;
+        }
+        unsigned const v = w[i];
+        if(v >= 0x1000)
+            *dest++ = hex[v >> 12];
+        if(v >= 0x100)
+            *dest++ = hex[(v >> 8) & 0xf];
+        if(v >= 0x10)
+            *dest++ = hex[(v >> 4) & 0xf];
+        *dest++ = hex[v & 0xf];
+        if(i != 7)
+            *dest++ = ':';
+    }
+    *dest++ = ']';
+    return dest - dest0;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+namespace detail {
+
+// The state of the basic URL parser, as
+// the positions of the parts of the input
+// and the hosts it computed. The input is
+// read once to find and check the parts,
+// then each part is written once into the
+// destination, escaped.
+struct whatwg_parser
+    : parts_base
+{
+    enum class host_kind
+    {
+        none,
+        domain,
+        ip,
+        opaque
+    };
+
+    enum class path_kind
+    {
+        empty,
+        list,
+        opaque
+    };
+
+    core::string_view scheme;
+    bool special = false;
+    bool file = false;
+    std::uint16_t def_port = 0;
+    core::string_view user;
+    core::string_view pass;
+    host_kind kind = host_kind::none;
+    core::string_view host;
+    // the host is converted
+    // to lower case when written
+    bool lower = false;
+    bool has_port = false;
+    std::uint16_t port = 0;
+    path_kind pk = path_kind::empty;
+    core::string_view path;
+    bool has_query = false;
+    core::string_view query;
+    bool has_frag = false;
+    core::string_view frag;
+    std::string buf;
+    char ip[48];
+
+    bool
+    is_sep(char c) const noexcept
+    {
+        return c == '/' ||
+            (special && c == '\\');
+    }
+
+    system::result<void>
+    parse_host(
+        core::string_view s,
+        whatwg_opts const& opt);
+
+    system::result<void>
+    parse_authority(
+        core::string_view s,
+        whatwg_opts const& opt);
+
+    system::result<void>
+    parse(
+        core::string_view s,
+        whatwg_opts const& opt);
+
+    std::size_t
+    measure_path() const noexcept;
+
+    char*
+    write_path(char* dest) const noexcept;
+
+    std::size_t
+    measure() const noexcept;
+
+    char*
+    write(char* dest) const noexcept;
+
+    static
+    system::result<void>
+    apply(
+        core::string_view s,
+        url_base& dest,
+        whatwg_opts const& opt);
+};
+
+system::result<void>
+whatwg_parser::
+parse_host(
+    core::string_view s,
+    whatwg_opts const& opt)
+{
+    if(s.front() == '[')
+    {
+        if( s.size() < 2 ||
+            s.back() != ']')
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        auto rv = parse_ipv6_address(
+            s.substr(1, s.size() - 2));
+        if(! rv)
+            return rv.error();
+        kind = host_kind::ip;
+        host = core::string_view(ip,
+            print_whatwg_ipv6(ip, *rv));
+        return {};
+    }
+
+    if(! special)
+    {
+        if(grammar::find_if(
+            s.begin(), s.end(),
+            forbidden_host_chars) != s.end())
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        kind = host_kind::opaque;
+        host = s;
+        return {};
+    }
+
+    // domain, percent-decoded
+    core::string_view d = s;
+    if(std::memchr(
+        s.data(), '%', s.size()))
+    {
+        buf.clear();
+        buf.reserve(s.size());
+        char const* it = s.data();
+        char const* const end =
+            it + s.size();
+        while(it != end)
+        {
+            if(*it != '%')
+            {
+                buf.push_back(*it++);
+                continue;
+            }
+            if(! is_escape(it, end))
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            buf.push_back(static_cast<char>(
+                grammar::hexdig_value(it[1]) * 16 +
+                grammar::hexdig_value(it[2])));
+            it += 3;
+        }
+        d = buf;
+    }
+
+    // only domains which are not
+    // all ASCII, or which have a
+    // punycode label, need IDNA
+    bool ascii = true;
+    bool ace = false;
+    for(std::size_t i = 0; i < d.size(); ++i)
+    {
+        if(static_cast<unsigned char>(
+                d[i]) >= 0x80)
+            ascii = false;
+        else if(
+            (i == 0 || d[i - 1] == '.') &&
+            grammar::ci_is_equal(
+                d.substr(i, 4), "xn--"))
+            ace = true;
+    }
+    if( ! ascii ||
+        (ace && opt.domain_to_ascii))
+    {
+        if(! opt.domain_to_ascii)
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        std::string r;
+        if(! opt.domain_to_ascii(d, r))
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        buf = std::move(r);
+        d = buf;
+    }
+    if(d.data() == buf.data())
+    {
+        for(char& c : buf)
+            c = grammar::to_lower(c);
+        lower = false;
+    }
+    else
+    {
+        lower = true;
+    }
+
+    if(d.empty())
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    for(char c : d)
+        if(is_forbidden_domain(c))
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+
+    if(ends_in_number(d))
+    {
+        std::uint32_t v;
+        if(! parse_whatwg_ipv4(d, v))
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        kind = host_kind::ip;
+        host = ipv4_address(v).to_buffer(
+            ip, sizeof(ip));
+        lower = false;
+        return {};
+    }
+    kind = host_kind::domain;
+    host = d;
+    return {};
+}
+
+system::result<void>
+whatwg_parser::
+parse_authority(
+    core::string_view s,
+    whatwg_opts const& opt)
+{
+    // the userinfo ends at the last
+    // '@', earlier ones are escaped
+    auto const at = s.rfind('@');
+    if(at != core::string_view::npos)
+    {
+        core::string_view const ui =
+            s.substr(0, at);
+        auto const colon = ui.find(':');
+        user = ui.substr(0, colon);
+        if(colon != core::string_view::npos)
+            pass = ui.substr(colon + 1);
+        s.remove_prefix(at + 1);
+        if(s.empty())
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+    }
+
+    // the port starts at the first
+    // ':' outside of brackets
+    std::size_t i = 0;
+    bool brackets = false;
+    for(; i < s.size(); ++i)
+    {
+        char const c = s[i];
+        if(c == '[')
+            brackets = true;
+        else if(c == ']')
+            brackets = false;
+        else if(c == ':' && ! brackets)
+            break;
+    }
+    core::string_view const h =
+        s.substr(0, i);
+    if(i < s.size())
+    {
+        if(h.empty())
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        core::string_view const p =
+            s.substr(i + 1);
+        if(! p.empty())
+        {
+            std::uint32_t v = 0;
+            for(char c : p)
+            {
+                if(! grammar::digit_chars(c))
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                v = v * 10 + (c - '0');
+                if(v > 65535)
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+            }
+            if(! special ||
+                v != def_port)
+            {
+                has_port = true;
+                port = static_cast<
+                    std::uint16_t>(v);
+            }
+        }
+    }
+    if(h.empty())
+    {
+        if(special)
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        kind = host_kind::opaque;
+        host = h;
+        return {};
+    }
+    return parse_host(h, opt);
+}
+
+system::result<void>
+whatwg_parser::
+parse(
+    core::string_view s,
+    whatwg_opts const& opt)
+{
+    char const* it = s.data();
+    char const* const end = it + s.size();
+
+    // scheme
+    if( it == end ||
+        ! grammar::alpha_chars(*it))
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    char const* p = grammar::find_if_not(
+        it + 1, end, scheme_chars);
+    if( p == end ||
+        *p != ':')
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    scheme = core::string_view(it, p - it);
+    it = p + 1;
+    auto const id = string_to_scheme(scheme);
+    special =
+        id != urls::scheme::unknown &&
+        id != urls::scheme::none;
+    file = id == urls::scheme::file;
+    def_port = default_port(id);
+
+    if(file)
+    {
+        // always has a host,
+        // which may be empty
+        kind = host_kind::domain;
+        if( it != end &&
+            is_sep(*it))
+        {
+            ++it;
+            if( it != end &&
+                is_sep(*it))
+            {
+                p = grammar::find_if(it + 1,
+                    end, special_authority_end);
+                core::string_view const h(
+                    it + 1, p - it - 1);
+                // "file://C:/" has a
+                // path and no host
+                if(! is_drive_letter(h))
+                {
+                    if(! h.empty())
+                    {
+                        auto rv = parse_host(h, opt);
+                        if(! rv)
+                            return rv;
+                        if( kind == host_kind::domain &&
+                            grammar::ci_is_equal(
+                                host, "localhost"))
+                            host = {};
+                    }
+                    it = p;
+                    if( it != end &&
+                        is_sep(*it))
+                        ++it;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        pk = path_kind::list;
+    }
+    else if(special)
+    {
+        while( it != end &&
+            is_sep(*it))
+            ++it;
+        p = grammar::find_if(
+            it, end, special_authority_end);
+        auto rv = parse_authority(
+            core::string_view(it, p - it), opt);
+        if(! rv)
+            return rv;
+        it = p;
+        if( it != end &&
+            is_sep(*it))
+            ++it;
+        pk = path_kind::list;
+    }
+    else if(
+        end - it >= 2 &&
+        it[0] == '/' &&
+        it[1] == '/')
+    {
+        it += 2;
+        p = grammar::find_if(
+            it, end, authority_end);
+        auto rv = parse_authority(
+            core::string_view(it, p - it), opt);
+        if(! rv)
+            return rv;
+        it = p;
+        if( it != end &&
+            *it == '/')
+        {
+            ++it;
+            pk = path_kind::list;
+        }
+    }
+    else if(
+        it != end &&
+        *it == '/')
+    {
+        ++it;
+        pk = path_kind::list;
+    }
+    else
+    {
+        pk = path_kind::opaque;
+    }
+
+    // path
+    p = grammar::find_if(it, end, path_end);
+    path = core::string_view(it, p - it);
+    it = p;
+
+    // query
+    if( it != end &&
+        *it == '?')
+    {
+        p = static_cast<char const*>(
+            std::memchr(it, '#', end - it));
+        if(! p)
+            p = end;
+        has_query = true;
+        query = core::string_view(
+            it + 1, p - it - 1);
+        it = p;
+    }
+
+    // fragment
+    if(it != end)
+    {
+        has_frag = true;
+        frag = core::string_view(
+            it + 1, end - it - 1);
+    }
+    return {};
+}
+
+std::size_t
+whatwg_parser::
+measure_path() const noexcept
+{
+    // dot segments only remove
+    // characters, so this is the
+    // size of every segment, plus
+    // room for a "/." prefix
+    std::size_t n = 2;
+    char const* it = path.data();
+    char const* const end =
+        it + path.size();
+    for(;;)
+    {
+        char const* p = it;
+        while(p != end && ! is_sep(*p))
+            ++p;
+        n += 1 + measure_part(
+            core::string_view(it, p - it),
+            detail::segment_chars);
+        if(p == end)
+            return n;
+        it = p + 1;
+    }
+}
+
+char*
+whatwg_parser::
+write_path(char* const dest) const noexcept
+{
+    char* out = dest;
+    std::size_t nseg = 0;
+    char const* it = path.data();
+    char const* const end =
+        it + path.size();
+    for(;;)
+    {
+        char const* p = it;
+        while(p != end && ! is_sep(*p))
+            ++p;
+        core::string_view const seg(
+            it, p - it);
+        bool const last = p == end;
+        if(is_double_dot(seg))
+        {
+            // a drive letter is
+            // never removed
+            bool const drive =
+                file && nseg == 1 &&
+                out - dest == 3 &&
+                grammar::alpha_chars(dest[1]) &&
+                dest[2] == ':';
+            if( nseg != 0 &&
+                ! drive)
+            {
+                while(*--out != '/')
+                    ;
+                --nseg;
+            }
+            if(last)
+            {
+                *out++ = '/';
+                ++nseg;
+            }
+        }
+        else if(is_single_dot(seg))
+        {
+            if(last)
+            {
+                *out++ = '/';
+                ++nseg;
+            }
+        }
+        else
+        {
+            *out++ = '/';
+            if( file &&
+                nseg == 0 &&
+                is_drive_letter(seg))
+            {
+                *out++ = seg[0];
+                *out++ = ':';
+            }
+            else
+            {
+                out = encode_part(out, seg,
+                    detail::segment_chars);
+            }
+            ++nseg;
+        }
+        if(last)
+            break;
+        it = p + 1;
+    }
+
+    // without an authority, a path
+    // starting with "//" gets a "/."
+    // prefix, as in the serializer
+    if( kind == host_kind::none &&
+        out - dest >= 2 &&
+        dest[1] == '/')
+    {
+        std::memmove(dest + 2,
+            dest, out - dest);
+        dest[0] = '/';
+        dest[1] = '.';
+        out += 2;
+    }
+    return out;
+}
+
+std::size_t
+whatwg_parser::
+measure() const noexcept
+{
+    std::size_t n = scheme.size() + 1;
+    if(kind != host_kind::none)
+    {
+        n += 2;
+        if( ! user.empty() ||
+            ! pass.empty())
+        {
+            n += measure_part(
+                user, credential_chars) + 1;
+            if(! pass.empty())
+                n += measure_part(
+                    pass, credential_chars) + 1;
+        }
+        if(kind == host_kind::ip)
+            n += host.size();
+        else
+            n += measure_part(
+                host, detail::host_chars);
+        if(has_port)
+            n += 6;
+    }
+    if(pk == path_kind::list)
+        n += measure_path();
+    else if(pk == path_kind::opaque)
+        n += measure_part(
+            path, detail::path_chars);
+    if(has_query)
+        n += 1 + measure_part(query,
+            special
+                ? special_query_chars
+                : detail::query_chars);
+    if(has_frag)
+        n += 1 + measure_part(
+            frag, detail::fragment_chars);
+    return n;
+}
+
+char*
+whatwg_parser::
+write(char* dest) const noexcept
+{
+    for(char c : scheme)
+        *dest++ = grammar::to_lower(c);
+    *dest++ = ':';
+    if(kind != host_kind::none)
+    {
+        *dest++ = '/';
+        *dest++ = '/';
+        if( ! user.empty() ||
+            ! pass.empty())
+        {
+            dest = encode_part(
+                dest, user, credential_chars);
+            if(! pass.empty())
+            {
+                *dest++ = ':';
+                dest = encode_part(
+                    dest, pass, credential_chars);
+            }
+            *dest++ = '@';
+        }
+        if(kind == host_kind::ip)
+        {
+            std::memcpy(dest,
+                host.data(), host.size());
+            dest += host.size();
+        }
+        else
+        {
+            dest = encode_part(dest, host,
+                detail::host_chars, lower);
+        }
+        if(has_port)
+        {
+            *dest++ = ':';
+            char digits[5];
+            std::size_t n = 0;
+            unsigned v = port;
+            do
+            {
+                digits[n++] = static_cast<
+                    char>('0' + v % 10);
+                v /= 10;
+            }
+            while(v != 0);
+            while(n != 0)
+                *dest++ = digits[--n];
+        }
+    }
+    if(pk == path_kind::list)
+        dest = write_path(dest);
+    else if(pk == path_kind::opaque)
+        dest = encode_part(dest, path,
+            detail::path_chars);
+    if(has_query)
+    {
+        *dest++ = '?';
+        dest = encode_part(dest, query,
+            special
+                ? special_query_chars
+                : detail::query_chars);
+    }
+    if(has_frag)
+    {
+        *dest++ = '#';
+        dest = encode_part(dest, frag,
+            detail::fragment_chars);
+    }
+    return dest;
+}
+
+system::result<void>
+whatwg_parser::
+apply(
+    core::string_view s,
+    url_base& dest,
+    whatwg_opts const& opt)
+{
+    // leading and trailing C0
+    // controls and spaces
+    char const* first = s.data();
+    char const* last = first + s.size();
+    while( first != last &&
+        static_cast<unsigned char>(
+            *first) <= 0x20)
+        ++first;
+    while( last != first &&
+        static_cast<unsigned char>(
+            last[-1]) <= 0x20)
+        --last;
+
+    // tabs and newlines are removed. A
+    // string referencing dest is copied
+    // too, since dest is written over.
+    std::string tmp;
+    bool const alias =
+        dest.s_ &&
+        first < dest.s_ + dest.cap_ &&
+        last > dest.s_;
+    if( alias ||
+        grammar::find_if(first, last,
+            tab_or_newline_chars) != last)
+    {
+        tmp.reserve(last - first);
+        for(char const* p = first; p != last; ++p)
+            if(! tab_or_newline_chars(*p))
+                tmp.push_back(*p);
+        first = tmp.data();
+        last = first + tmp.size();
+    }
+
+    whatwg_parser p;
+    auto rv = p.parse(core::string_view(
+        first, last - first), opt);
+    if(! rv)
+        return rv;
+
+    // nothing fails past this
+    // point, so dest is only
+    // changed on success
+    url_base::op_t op(dest);
+    dest.reserve_impl(p.measure(), op);
+    std::size_t const n =
+        p.write(dest.s_) - dest.s_;
+    auto u = parse_uri(
+        core::string_view(dest.s_, n));
+    BOOST_ASSERT(u.has_value());
+    dest.impl_ = u->impl_;
+    dest.impl_.cs_ = dest.s_;
+    dest.impl_.from_ = from::url;
+    dest.s_[n] = '\0';
+    return {};
+}
+
+} // detail
+
+//------------------------------------------------
+
+system::result<void>
+parse_whatwg(
+    core::string_view s,
+    url_base& dest,
+    whatwg_opts const& opt)
+{
+    return detail::whatwg_parser::apply(
+        s, dest, opt);
+}
+
+system::result<url>
+parse_whatwg(
+    core::string_view s,
+    whatwg_opts const& opt)
+{
+    url u;
+    auto rv = detail::whatwg_parser::apply(
+        s, u, opt);
+    if(! rv)
+        return rv.error();
+    return u;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,572 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/path_prefix_index.hpp>
+#include "detail/decode.hpp"
+#include "detail/normalize.hpp"
+#include <boost/core/bit.hpp>
+#include <algorithm>
+#include <cstdint>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+#ifdef BOOST_URL_USE_SSE2
+
+// A mask of the bytes of p0 which differ
+// from those of p1 or are '%'
+inline
+unsigned
+stop_mask(
+    char const* p0,
+    char const* p1) noexcept
+{
+    __m128i const v0 = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(p0));
+    __m128i const v1 = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(p1));
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_andnot_si128(
+            _mm_cmpeq_epi8(v0, _mm_set1_epi8('%')),
+            _mm_cmpeq_epi8(v0, v1)))) ^ 0xffff;
+}
+
+#elif defined(BOOST_URL_USE_NEON)
+
+// A mask of the bytes of p0 which differ
+// from those of p1 or are '%', with four
+// bits per byte
+inline
+std::uint64_t
+stop_mask(
+    char const* p0,
+    char const* p1) noexcept
+{
+    uint8x16_t const v0 = vld1q_u8(
+        reinterpret_cast<
+            std::uint8_t const*>(p0));
+    uint8x16_t const v1 = vld1q_u8(
+        reinterpret_cast<
+            std::uint8_t const*>(p1));
+    uint8x16_t const m = vorrq_u8(
+        vmvnq_u8(vceqq_u8(v0, v1)),
+        vceqq_u8(v0, vdupq_n_u8('%')));
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(
+            vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+#endif
+
+// Return the number of characters at the
+// start of p0 and p1, up to n, which are
+// equal and are not '%'. These characters
+// decode to themselves on both sides.
+std::size_t
+raw_prefix(
+    char const* p0,
+    char const* p1,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#ifdef BOOST_URL_USE_SSE2
+    for(; n - i >= 16; i += 16)
+    {
+        auto const m = stop_mask(p0 + i, p1 + i);
+        if(m)
+            return i + boost::core::countr_zero(m);
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    for(; n - i >= 16; i += 16)
+    {
+        auto const m = stop_mask(p0 + i, p1 + i);
+        if(m)
+            return i + (
+                boost::core::countr_zero(m) >> 2);
+    }
+#endif
+    for(; i < n; ++i)
+    {
+        if( p0[i] != p1[i] ||
+            p0[i] == '%')
+            break;
+    }
+    return i;
+}
+
+// Return the number of characters at the
+// end of the strings ending at e0 and e1,
+// up to n, which are equal and are not '%'
+std::size_t
+raw_suffix(
+    char const* e0,
+    char const* e1,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#ifdef BOOST_URL_USE_SSE2
+    for(; n - i >= 16; i += 16)
+    {
+        auto const m = stop_mask(
+            e0 - i - 16, e1 - i - 16);
+        if(m)
+            return i + (
+                boost::core::countl_zero(m) - 16);
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    for(; n - i >= 16; i += 16)
+    {
+        auto const m = stop_mask(
+            e0 - i - 16, e1 - i - 16);
+        if(m)
+            return i + (
+                boost::core::countl_zero(m) >> 2);
+    }
+#endif
+    for(; i < n; ++i)
+    {
+        char const c = *(e0 - i - 1);
+        if( c != *(e1 - i - 1) ||
+            c == '%')
+            break;
+    }
+    return i;
+}
+
+// Read the first decoded character at it.
+// An escaped slash is read as a literal
+// '%', so it never matches a separator.
+void
+consume_one(
+    char const*& it,
+    char& c) noexcept
+{
+    if(*it != '%')
+    {
+        c = *it++;
+        return;
+    }
+    detail::decode_unsafe(
+        &c, &c + 1,
+        core::string_view(it, 3));
+    if(c != '/')
+    {
+        it += 3;
+        return;
+    }
+    c = *it++;
+}
+
+// Read the last decoded character before
+// end, as consume_one does
+void
+consume_last(
+    char const* begin,
+    char const*& end,
+    char& c) noexcept
+{
+    if( end - begin < 3 ||
+        *(end - 3) != '%')
+    {
+        c = *--end;
+        return;
+    }
+    detail::decode_unsafe(
+        &c, &c + 1,
+        core::string_view(end - 3, 3));
+    if(c != '/')
+    {
+        end -= 3;
+        return;
+    }
+    c = *--end;
+}
+
+// Return the number of characters before
+// p, which starts a run of raw characters,
+// that belong to an escape
+std::size_t
+escape_tail(
+    char const* begin,
+    char const* p) noexcept
+{
+    if( p - begin >= 1 &&
+        *(p - 1) == '%')
+        return 2;
+    if( p - begin >= 2 &&
+        *(p - 2) == '%')
+        return 1;
+    return 0;
+}
+
+// Remove the leading slash of a prefix and
+// a trailing slash, and return false if
+// there are no segments left
+bool
+prefix_segments(
+    core::string_view& s) noexcept
+{
+    if(s.starts_with('/'))
+        s.remove_prefix(1);
+    if(s.empty())
+        return false;
+    if(s.ends_with('/'))
+        s.remove_suffix(1);
+    return true;
+}
+
+// Pop the first segment of s, and
+// return false if it was the last
+bool
+pop_segment(
+    core::string_view& s,
+    core::string_view& seg) noexcept
+{
+    auto const pos = s.find('/');
+    if(pos == core::string_view::npos)
+    {
+        seg = s;
+        return false;
+    }
+    seg = s.substr(0, pos);
+    s.remove_prefix(pos + 1);
+    return true;
+}
+
+std::size_t
+edge_hash(
+    std::size_t parent,
+    core::string_view seg) noexcept
+{
+    detail::fnv_1a h(parent);
+    detail::digest_encoded(seg, h);
+    return h.digest();
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+boost::optional<std::size_t>
+path_starts_with(
+    pct_string_view path,
+    pct_string_view prefix) noexcept
+{
+    char const* it0 = path.data();
+    char const* it1 = prefix.data();
+    char const* const end0 = it0 + path.size();
+    char const* const end1 = it1 + prefix.size();
+    for(;;)
+    {
+        // equal runs without escapes
+        // need no decoding
+        auto const k = raw_prefix(it0, it1,
+            (std::min)(end0 - it0, end1 - it1));
+        it0 += k;
+        it1 += k;
+        if( it0 == end0 ||
+            it1 == end1)
+            break;
+        char c0;
+        char c1;
+        consume_one(it0, c0);
+        consume_one(it1, c1);
+        if(c0 != c1)
+            return boost::none;
+    }
+    if(it1 != end1)
+        return boost::none;
+    return static_cast<std::size_t>(
+        it0 - path.data());
+}
+
+boost::optional<std::size_t>
+path_ends_with(
+    pct_string_view path,
+    pct_string_view suffix) noexcept
+{
+    char const* const begin0 = path.data();
+    char const* const begin1 = suffix.data();
+    char const* end0 = begin0 + path.size();
+    char const* end1 = begin1 + suffix.size();
+    for(;;)
+    {
+        auto k = raw_suffix(end0, end1,
+            (std::min)(end0 - begin0, end1 - begin1));
+        if(k != 0)
+        {
+            // the characters after a '%' are
+            // decoded with it, so they are
+            // left to consume_last
+            auto const r = (std::max)(
+                escape_tail(begin0, end0 - k),
+                escape_tail(begin1, end1 - k));
+            k -= (std::min)(k, r);
+            end0 -= k;
+            end1 -= k;
+        }
+        if( end0 == begin0 ||
+            end1 == begin1)
+            break;
+        char c0;
+        char c1;
+        consume_last(begin0, end0, c0);
+        consume_last(begin1, end1, c1);
+        if(c0 != c1)
+            return boost::none;
+    }
+    if(end1 != begin1)
+        return boost::none;
+    return static_cast<std::size_t>(
+        (begin0 + path.size()) - end0);
+}
+
+//------------------------------------------------
+
+std::size_t
+path_prefix_index::
+find(
+    std::size_t parent,
+    core::string_view seg,
+    std::size_t hash) const noexcept
+{
+    if(table_.empty())
+        return 0;
+    auto const mask = table_.size() - 1;
+    for(auto i = hash & mask;
+        table_[i] != 0;
+        i = (i + 1) & mask)
+    {
+        auto const& nd = nodes_[table_[i]];
+        if( nd.hash == hash &&
+            nd.parent == parent &&
+            detail::compare_encoded(
+                core::string_view(
+                    keys_.data() + nd.key,
+                    nd.size), seg) == 0)
+            return table_[i];
+    }
+    return 0;
+}
+
+std::size_t
+path_prefix_index::
+find(core::string_view s) const noexcept
+{
+    if(nodes_.empty())
+        return 0;
+    std::size_t cur = 0;
+    if(prefix_segments(s))
+    {
+        core::string_view seg;
+        bool more = true;
+        while(more)
+        {
+            more = pop_segment(s, seg);
+            cur = find(cur, seg,
+                edge_hash(cur, seg));
+            if(cur == 0)
+                return 0;
+        }
+    }
+    return cur + 1;
+}
+
+void
+path_prefix_index::
+rehash(std::size_t n)
+{
+    std::size_t slots = 16;
+    while(slots < 2 * n)
+        slots *= 2;
+    std::vector<std::size_t> table(slots);
+    auto const mask = slots - 1;
+    for(std::size_t j = 1; j < nodes_.size(); ++j)
+    {
+        auto i = nodes_[j].hash & mask;
+        while(table[i] != 0)
+            i = (i + 1) & mask;
+        table[i] = j;
+    }
+    table_.swap(table);
+}
+
+void
+path_prefix_index::
+insert(
+    std::size_t id,
+    pct_string_view prefix)
+{
+    // find the deepest existing node,
+    // and the size of what is missing
+    core::string_view s = prefix;
+    bool const any = prefix_segments(s);
+    core::string_view rest;
+    bool missing = false;
+    std::size_t cur = 0;
+    std::size_t nodes = 0;
+    if(any)
+    {
+        core::string_view seg;
+        bool more = true;
+        while(more)
+        {
+            core::string_view const s0 = s;
+            more = pop_segment(s, seg);
+            if(! missing)
+            {
+                auto const next = find(cur, seg,
+                    edge_hash(cur, seg));
+                if(next != 0)
+                {
+                    cur = next;
+                    continue;
+                }
+                missing = true;
+                rest = s0;
+            }
+            ++nodes;
+        }
+    }
+
+    // allocate before anything
+    // changes, for the strong
+    // guarantee
+    entries_.reserve(entries_.size() + 1);
+    std::size_t const root = nodes_.empty();
+    nodes_.reserve(nodes_.size() + root + nodes);
+    keys_.reserve(keys_.size() + rest.size());
+    if( nodes != 0 &&
+        2 * (nodes_.size() + nodes) > table_.size())
+        rehash(nodes_.size() + nodes);
+
+    // nothing below throws
+    if(root)
+        nodes_.push_back(node{0, 0, 0, 0});
+    if(missing)
+    {
+        core::string_view seg;
+        bool more = true;
+        auto const mask = table_.size() - 1;
+        while(more)
+        {
+            more = pop_segment(rest, seg);
+            node nd{};
+            nd.parent = cur;
+            nd.hash = edge_hash(cur, seg);
+            nd.key = keys_.size();
+            nd.size = seg.size();
+            keys_.append(seg.data(), seg.size());
+            nodes_.push_back(nd);
+            cur = nodes_.size() - 1;
+            auto i = nd.hash & mask;
+            while(table_[i] != 0)
+                i = (i + 1) & mask;
+            table_[i] = cur;
+        }
+    }
+    entry e;
+    e.id = id;
+    entries_.push_back(e);
+    auto& nd = nodes_[cur];
+    if(nd.last != 0)
+        entries_[nd.last - 1].next = entries_.size();
+    else
+        nd.first = entries_.size();
+    nd.last = entries_.size();
+    ++size_;
+}
+
+std::size_t
+path_prefix_index::
+erase(
+    std::size_t id,
+    pct_string_view prefix) noexcept
+{
+    auto const k = find(prefix);
+    if(k == 0)
+        return 0;
+    // unlink the entries, whose
+    // storage is not reused
+    auto& nd = nodes_[k - 1];
+    std::size_t n = 0;
+    std::size_t prev = 0;
+    auto i = nd.first;
+    while(i != 0)
+    {
+        auto const next = entries_[i - 1].next;
+        if(entries_[i - 1].id != id)
+        {
+            prev = i;
+            i = next;
+            continue;
+        }
+        if(prev != 0)
+            entries_[prev - 1].next = next;
+        else
+            nd.first = next;
+        if(nd.last == i)
+            nd.last = prev;
+        ++n;
+        i = next;
+    }
+    size_ -= n;
+    return n;
+}
+
+std::size_t
+path_prefix_index::
+match(
+    pct_string_view path,
+    std::vector<std::size_t>& ids) const
+{
+    if(size_ == 0)
+        return 0;
+    std::size_t n = 0;
+    auto const append = [&](std::size_t k)
+    {
+        for(auto i = nodes_[k].first;
+            i != 0; i = entries_[i - 1].next)
+        {
+            ids.push_back(entries_[i - 1].id);
+            ++n;
+        }
+    };
+    append(0);
+    core::string_view s = path;
+    if(s.empty())
+        return n;
+    if(s.starts_with('/'))
+        s.remove_prefix(1);
+    std::size_t cur = 0;
+    core::string_view seg;
+    bool more = true;
+    while(more)
+    {
+        more = pop_segment(s, seg);
+        cur = find(cur, seg,
+            edge_hash(cur, seg));
+        if(cur == 0)
+            break;
+        append(cur);
+    }
+    return n;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/public_suffix_list.hpp>
+#include "detail/public_suffix_list.hpp"
+#include <cstring>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+public_suffix_list::
+public_suffix_list(
+    core::string_view rules)
+{
+    namespace psl = detail::psl;
+
+    detail::label_trie::builder trie;
+    std::vector<unsigned char> nodes;
+    std::size_t count = 0;
+
+    nodes.push_back(0);
+    while(! rules.empty())
+    {
+        // each line holds at most one rule,
+        // up to the first whitespace
+        auto const eol = rules.find('\n');
+        auto line = rules.substr(0, eol);
+        rules.remove_prefix(
+            eol == core::string_view::npos ?
+                rules.size() : eol + 1);
+        auto const ws = line.find_first_of(" \t\r\v\f");
+        if(ws != core::string_view::npos)
+            line = line.substr(0, ws);
+        if( line.empty() ||
+            line.starts_with("//"))
+            continue;
+
+        unsigned char flag = psl::is_rule;
+        if(line.starts_with('!'))
+        {
+            flag = psl::is_exception;
+            line.remove_prefix(1);
+        }
+        if( flag == psl::is_rule && (
+            line == "*" ||
+            line.starts_with("*.")))
+        {
+            flag = psl::is_wildcard;
+            line.remove_prefix(
+                (std::min)(line.size(),
+                    std::size_t(2)));
+        }
+        ++count;
+
+        auto const cur = trie.insert(line);
+        nodes.resize(trie.node_count());
+        nodes[cur] |= flag;
+    }
+
+    data_.resize(trie.image_size(
+        psl::node_size));
+    auto const p = trie.write(
+        &data_[0], psl::magic, psl::version,
+        count, psl::node_size);
+    std::memcpy(p, nodes.data(), nodes.size());
+}
+
+} // urls
+} // boost
@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/public_suffix_list_view.hpp>
+#include "detail/public_suffix_list.hpp"
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// The image of a list without rules
+constexpr char empty_image[
+    detail::label_trie::header_size] = {
+    '\x7f', 'P', 'S', 'L', 1 };
+
+// Returns the offset in host where its
+// last n labels start, or npos if host
+// has no more than n - 1 dots
+std::size_t
+labels_start(
+    core::string_view host,
+    std::size_t n) noexcept
+{
+    auto pos = host.size();
+    while(n-- > 0)
+    {
+        auto const dot = pos == 0 ?
+            core::string_view::npos :
+            host.rfind('.', pos - 1);
+        if(dot == core::string_view::npos)
+            return n == 0 ? 0 :
+                core::string_view::npos;
+        pos = dot;
+    }
+    return pos + 1;
+}
+
+} // (anon)
+
+public_suffix_list_view::
+public_suffix_list_view(
+    core::string_view data)
+    : public_suffix_list_view(
+        detail::label_trie::view::checked(
+            data, detail::psl::magic,
+            detail::psl::version,
+            detail::psl::node_size),
+        no_check{})
+{
+}
+
+public_suffix_list_view::
+public_suffix_list_view(
+    core::string_view data,
+    no_check) noexcept
+{
+    detail::label_trie::view const v(
+        data, detail::psl::node_size);
+    table_ = v.table;
+    nodes_ = v.nodes;
+    labels_ = v.labels;
+    rules_ = v.rules;
+    node_count_ = v.node_count;
+    table_size_ = v.table_size;
+    labels_size_ = v.labels_size;
+}
+
+core::string_view
+public_suffix_list_view::
+data() const noexcept
+{
+    if(! table_)
+        return core::string_view(
+            empty_image, sizeof(empty_image));
+    auto const first =
+        table_ - detail::label_trie::header_size;
+    return core::string_view(
+        first, (labels_ + labels_size_) - first);
+}
+
+std::uint32_t
+public_suffix_list_view::
+find(
+    std::uint32_t parent,
+    core::string_view label) const noexcept
+{
+    detail::label_trie::view v;
+    v.table = table_;
+    v.nodes = nodes_;
+    v.labels = labels_;
+    v.node_count = node_count_;
+    v.table_size = table_size_;
+    v.labels_size = labels_size_;
+    return v.find(parent, label);
+}
+
+// Returns the number of labels
+// in the public suffix of host
+std::size_t
+public_suffix_list_view::
+suffix_labels(
+    core::string_view host) const noexcept
+{
+    namespace psl = detail::psl;
+    // the implicit "*" rule
+    std::size_t n = 1;
+    if(node_count_ == 0)
+        return n;
+    std::uint32_t cur = 0;
+    std::size_t i = 0;
+    while(! host.empty())
+    {
+        if(nodes_[cur] & psl::is_wildcard)
+            n = (std::max)(n, i + 1);
+        auto const label =
+            detail::label_trie::pop_label(host);
+        auto const child = find(cur, label);
+        if(child == 0)
+            break;
+        if(nodes_[child] & psl::is_exception)
+        {
+            // the exception rule minus
+            // its leftmost label
+            n = i;
+            break;
+        }
+        if(nodes_[child] & psl::is_rule)
+            n = (std::max)(n, i + 1);
+        cur = child;
+        ++i;
+    }
+    return n;
+}
+
+core::string_view
+public_suffix_list_view::
+public_suffix(
+    pct_string_view host) const noexcept
+{
+    core::string_view s = host;
+    if(s.ends_with('.'))
+        s.remove_suffix(1);
+    if(s.empty())
+        return {};
+    auto const pos = labels_start(
+        s, suffix_labels(s));
+    if(pos == core::string_view::npos)
+        return host;
+    return core::string_view(host).substr(pos);
+}
+
+core::string_view
+public_suffix_list_view::
+registrable_domain(
+    pct_string_view host) const noexcept
+{
+    core::string_view s = host;
+    if(s.ends_with('.'))
+        s.remove_suffix(1);
+    if(s.empty())
+        return {};
+    auto const pos = labels_start(
+        s, suffix_labels(s) + 1);
+    if(pos == core::string_view::npos)
+        return {};
+    // an empty label is not a domain
+    if( pos < s.size() &&
+        s[pos] == '.')
+        return {};
+    return core::string_view(host).substr(pos);
+}
+
+} // urls
+} // boost
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_RESOLVER_IPP
+#define BOOST_URL_IMPL_RESOLVER_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/resolver.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <cstring>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// true if normalize_path could
+// change the path
+bool
+needs_normalize(
+    core::string_view path) noexcept
+{
+    return
+        std::memchr(path.data(), '.', path.size()) ||
+        std::memchr(path.data(), '%', path.size());
+}
+
+} // (anon)
+
+// The parts [first, last) of a url
+struct resolver::part
+{
+    url_view_base const* u;
+    int first;
+    int last;
+};
+
+resolver::
+resolver(url_view_base const& base)
+    : base_(base)
+    , norm_(base)
+{
+    if(! base.has_scheme())
+        detail::throw_system_error(
+            BOOST_URL_ERR(error::not_a_base));
+    norm_.normalize_path();
+}
+
+// Write the parts of each url, in order,
+// into dest after a single reservation.
+// The offsets and the decoded sizes are
+// those of the sources, so nothing is
+// parsed again.
+void
+resolver::
+assign(
+    url_base& dest,
+    part const* p,
+    std::size_t n)
+{
+    BOOST_ASSERT(n > 0);
+    BOOST_ASSERT(p[0].first == id_scheme);
+    BOOST_ASSERT(p[n - 1].last == id_end);
+    std::size_t size = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        BOOST_ASSERT(p[i].u !=
+            static_cast<url_view_base*>(&dest));
+        size += p[i].u->pi_->len(
+            p[i].first, p[i].last);
+    }
+    url_base::op_t op(dest);
+    dest.reserve_impl(size, op);
+    detail::url_impl impl(from::url);
+    std::size_t pos = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        detail::url_impl const& src = *p[i].u->pi_;
+        auto const first = src.offset(p[i].first);
+        for(int id = p[i].first;
+            id < p[i].last; ++id)
+        {
+            switch(id)
+            {
+            case id_scheme:
+                impl.scheme_ = src.scheme_;
+                // the offset is always zero
+                continue;
+            case id_host:
+                impl.host_type_ = src.host_type_;
+                impl.host_norm_ = src.host_norm_;
+                std::memcpy(impl.ip_addr_,
+                    src.ip_addr_, sizeof(impl.ip_addr_));
+                break;
+            case id_port:
+                impl.port_number_ = src.port_number_;
+                break;
+            case id_path:
+                impl.nseg_ = src.nseg_;
+                break;
+            case id_query:
+                impl.nparam_ = src.nparam_;
+                break;
+            default:
+                break;
+            }
+            impl.offset_[id] =
+                pos + src.offset(id) - first;
+            impl.decoded_[id] = src.decoded_[id];
+        }
+        auto const len = src.len(
+            p[i].first, p[i].last);
+        std::memcpy(dest.s_ + pos,
+            src.cs_ + first, len);
+        pos += len;
+    }
+    BOOST_ASSERT(pos == size);
+    impl.offset_[id_end] = pos;
+    impl.cs_ = dest.s_;
+    dest.impl_ = impl;
+    dest.s_[pos] = '\0';
+}
+
+void
+resolver::
+resolve(
+    url_view_base const& ref,
+    url_base& dest) const
+{
+    // the characters of ref are copied
+    // into dest, so they must not be
+    // the characters of dest
+    auto const b = dest.buffer();
+    if( static_cast<url_view_base const*>(
+            &dest) == &ref || (
+        ! ref.empty() &&
+        std::less_equal<char const*>()(
+            b.data(), ref.data()) &&
+        std::less<char const*>()(
+            ref.data(), b.data() + b.size())))
+    {
+        url const tmp(ref);
+        resolve(tmp, dest);
+        return;
+    }
+
+    //
+    // 5.2.2. Transform References
+    // https://datatracker.ietf.org/doc/html/rfc3986#section-5.2.2
+    //
+
+    if( ref.has_scheme() &&
+        ref.scheme() != base_.scheme())
+    {
+        dest.copy(ref);
+        if(needs_normalize(ref.encoded_path()))
+            dest.normalize_path();
+        return;
+    }
+
+    if(ref.has_authority())
+    {
+        part const p[] = {
+            { &base_, id_scheme, id_user },
+            { &ref, id_user, id_end } };
+        assign(dest, p, 2);
+        if(needs_normalize(ref.encoded_path()))
+            dest.normalize_path();
+        return;
+    }
+
+    if(ref.encoded_path().empty())
+    {
+        // the query and the fragment
+        // of the base are kept unless
+        // ref has its own
+        part const p[] = {
+            { &norm_, id_scheme, id_query },
+            { ref.has_query() ?
+                &ref : &norm_, id_query, id_frag },
+            { ref.has_fragment() ?
+                &ref : &norm_, id_frag, id_end } };
+        assign(dest, p, 3);
+        return;
+    }
+
+    if(ref.is_path_absolute())
+    {
+        part const p[] = {
+            { &base_, id_scheme, id_path },
+            { &ref, id_path, id_end } };
+        assign(dest, p, 2);
+        if(needs_normalize(ref.encoded_path()))
+            dest.normalize_path();
+        return;
+    }
+
+    // 5.2.3. Merge Paths
+    dest.reserve(base_.size() + ref.size());
+    dest.copy(base_);
+    auto rv = dest.resolve(ref);
+    BOOST_ASSERT(rv.has_value());
+    ignore_unused(rv);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -12,17 +12,187 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/optional_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
 #include "detail/host_rule.hpp"
+#include "detail/ipv4_fast.hpp"
+#include "detail/ipv6_fast.hpp"
 #include "detail/port_rule.hpp"
 #include "detail/userinfo_rule.hpp"
+#include <cstdint>
+#include <cstring>
 
 namespace boost {
 namespace urls {
 
+namespace {
+
+// reg-name, without escapes
+constexpr
+grammar::lut_chars
+host_chars =
+    unreserved_chars + sub_delim_chars;
+
+// the characters which can continue
+// a userinfo after a host and port
+constexpr
+grammar::lut_chars
+user_chars =
+    host_chars + ':' + '%' + '@';
+
+/*  Return the value of 1 to 8 digits
+
+    The digits are placed in the high
+    bytes of a little-endian word and
+    combined in pairs, then quads, then
+    all eight, with three multiplies.
+*/
+std::uint32_t
+swar_digits(
+    char const* p,
+    std::size_t n) noexcept
+{
+    BOOST_ASSERT(n > 0 && n <= 8);
+    std::uint64_t v = 0;
+    for(std::size_t i = 0; i < 8; ++i)
+    {
+        unsigned char const c =
+            i + n < 8 ? '0' :
+            static_cast<unsigned char>(
+                p[i + n - 8]);
+        v |= std::uint64_t(c) << (8 * i);
+    }
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) *
+            (100 + (1000000ULL << 32))) +
+        (((v >> 16) & 0x000000FF000000FFULL) *
+            (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<std::uint32_t>(v);
+}
+
+/*  Parse an authority without a userinfo
+
+    This handles the hosts found in Host
+    headers and CONNECT targets: a reg-name
+    or IPv4address, told apart by a single
+    scan of the host characters, or an
+    IPv6address in brackets, followed by an
+    optional port. The first byte selects
+    the kind of host.
+
+    False is returned, and `it` is unchanged,
+    for any other input, such as a userinfo,
+    an escape, or an IPvFuture, which must
+    then be parsed by the general rules.
+*/
+bool
+parse_authority_fast(
+    char const*& it,
+    char const* const end,
+    detail::url_impl& u) noexcept
+{
+    char const* const first = it;
+    char const* p = first;
+    unsigned char addr[16] = {};
+    host_type ht;
+    if( p != end &&
+        *p == '[')
+    {
+        // IP-literal
+        char const* const q =
+            static_cast<char const*>(
+                std::memchr(p, ']', end - p));
+        if(! q)
+            return false;
+        std::size_t const n = q - p - 1;
+        if( n == 0 ||
+            detail::parse_ipv6_fast(
+                p + 1, q, addr) != n)
+            return false;
+        ht = host_type::ipv6;
+        p = q + 1;
+    }
+    else
+    {
+        // reg-name or IPv4address
+        p = grammar::find_if_not(
+            p, end, host_chars);
+        if( p != end && (
+            *p == '%' ||
+            *p == '@'))
+            return false;
+        std::size_t const n = p - first;
+        ht = n >= 7 &&
+            n <= 15 &&
+            grammar::digit_chars(*first) &&
+            detail::parse_ipv4_fast(
+                first, p, addr) == n
+            ? host_type::ipv4
+            : host_type::name;
+        if(ht != host_type::ipv4)
+            std::memset(addr, 0, sizeof(addr));
+    }
+    char const* const he = p;
+
+    // [ ":" port ]
+    char const* pe = nullptr;
+    std::uint16_t pn = 0;
+    if( p != end &&
+        *p == ':')
+    {
+        pe = p + 1;
+        char const* d = pe;
+        while(
+            d != end &&
+            *d == '0')
+            ++d;
+        p = d;
+        while(
+            p != end &&
+            grammar::digit_chars(*p))
+            ++p;
+        // larger numbers have
+        // no port number
+        std::size_t const n = p - d;
+        if(n > 0 && n <= 5)
+        {
+            std::uint32_t const v =
+                swar_digits(d, n);
+            if(v <= 65535)
+                pn = static_cast<
+                    std::uint16_t>(v);
+        }
+    }
+
+    // a userinfo would continue
+    if( ht != host_type::ipv6 &&
+        p != end &&
+        user_chars(*p))
+        return false;
+
+    std::size_t const hn = he - first;
+    u.cs_ = first;
+    u.apply_host(ht,
+        make_pct_string_view_unsafe(
+            first, hn, hn),
+        addr);
+    if(pe)
+        u.apply_port(
+            core::string_view(pe, p - pe),
+            pn);
+    it = p;
+    return true;
+}
+
+} // (anon)
+
 auto
 authority_rule_t::
 parse(
@@ -32,6 +202,8 @@ parse(
     system::result<value_type>
 {
     detail::url_impl u(detail::url_impl::from::authority);
+    if(parse_authority_fast(it, end, u))
+        return u.construct_authority();
     u.cs_ = it;
 
     // [ userinfo "@" ]
@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include "ipv4_fast.hpp"
+#include <boost/core/bit.hpp>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSSE3
+# include <emmintrin.h>
+# include <tmmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+std::size_t
+parse_ipv4_scalar(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept
+{
+    char const* const first = it;
+    for(int i = 0; i < 4; ++i)
+    {
+        if(i > 0)
+        {
+            if( it == end ||
+                *it != '.')
+                return 0;
+            ++it;
+        }
+        char const* const p = it;
+        unsigned n = 0;
+        while(
+            it != end &&
+            it - p < 4 &&
+            static_cast<unsigned char>(
+                *it - '0') < 10)
+        {
+            n = 10 * n + static_cast<
+                unsigned>(*it - '0');
+            ++it;
+        }
+        auto const len = it - p;
+        if( len == 0 ||
+            len > 3 ||
+            (len > 1 && *p == '0') ||
+            n > 255)
+            return 0;
+        v[i] = static_cast<
+            unsigned char>(n);
+    }
+    return static_cast<
+        std::size_t>(it - first);
+}
+
+#ifdef BOOST_URL_USE_SSSE3
+
+bool
+cpu_has_ssse3() noexcept
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 1);
+    return (r[2] & 0x200) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3") != 0;
+#endif
+}
+
+constexpr unsigned char z = 0x80;
+
+/*  Shuffle patterns
+
+    The row for octets of lengths l1 to l4
+    is at index 27 * (l1 - 1) + 9 * (l2 - 1) +
+    3 * (l3 - 1) + (l4 - 1). Octet i goes to
+    bytes 4 * i to 4 * i + 3 as hundreds,
+    tens, ones and zero, with the digits
+    aligned to the ones. `z` yields zero.
+*/
+alignas(16) unsigned char const
+ipv4_shuffle[81][16] = {
+    {z, z, 0, z, z, z, 2, z, z, z, 4, z, z, z, 6, z}, // 1111
+    {z, z, 0, z, z, z, 2, z, z, z, 4, z, z, 6, 7, z}, // 1112
+    {z, z, 0, z, z, z, 2, z, z, z, 4, z, 6, 7, 8, z}, // 1113
+    {z, z, 0, z, z, z, 2, z, z, 4, 5, z, z, z, 7, z}, // 1121
+    {z, z, 0, z, z, z, 2, z, z, 4, 5, z, z, 7, 8, z}, // 1122
+    {z, z, 0, z, z, z, 2, z, z, 4, 5, z, 7, 8, 9, z}, // 1123
+    {z, z, 0, z, z, z, 2, z, 4, 5, 6, z, z, z, 8, z}, // 1131
+    {z, z, 0, z, z, z, 2, z, 4, 5, 6, z, z, 8, 9, z}, // 1132
+    {z, z, 0, z, z, z, 2, z, 4, 5, 6, z, 8, 9, 10, z}, // 1133
+    {z, z, 0, z, z, 2, 3, z, z, z, 5, z, z, z, 7, z}, // 1211
+    {z, z, 0, z, z, 2, 3, z, z, z, 5, z, z, 7, 8, z}, // 1212
+    {z, z, 0, z, z, 2, 3, z, z, z, 5, z, 7, 8, 9, z}, // 1213
+    {z, z, 0, z, z, 2, 3, z, z, 5, 6, z, z, z, 8, z}, // 1221
+    {z, z, 0, z, z, 2, 3, z, z, 5, 6, z, z, 8, 9, z}, // 1222
+    {z, z, 0, z, z, 2, 3, z, z, 5, 6, z, 8, 9, 10, z}, // 1223
+    {z, z, 0, z, z, 2, 3, z, 5, 6, 7, z, z, z, 9, z}, // 1231
+    {z, z, 0, z, z, 2, 3, z, 5, 6, 7, z, z, 9, 10, z}, // 1232
+    {z, z, 0, z, z, 2, 3, z, 5, 6, 7, z, 9, 10, 11, z}, // 1233
+    {z, z, 0, z, 2, 3, 4, z, z, z, 6, z, z, z, 8, z}, // 1311
+    {z, z, 0, z, 2, 3, 4, z, z, z, 6, z, z, 8, 9, z}, // 1312
+    {z, z, 0, z, 2, 3, 4, z, z, z, 6, z, 8, 9, 10, z}, // 1313
+    {z, z, 0, z, 2, 3, 4, z, z, 6, 7, z, z, z, 9, z}, // 1321
+    {z, z, 0, z, 2, 3, 4, z, z, 6, 7, z, z, 9, 10, z}, // 1322
+    {z, z, 0, z, 2, 3, 4, z, z, 6, 7, z, 9, 10, 11, z}, // 1323
+    {z, z, 0, z, 2, 3, 4, z, 6, 7, 8, z, z, z, 10, z}, // 1331
+    {z, z, 0, z, 2, 3, 4, z, 6, 7, 8, z, z, 10, 11, z}, // 1332
+    {z, z, 0, z, 2, 3, 4, z, 6, 7, 8, z, 10, 11, 12, z}, // 1333
+    {z, 0, 1, z, z, z, 3, z, z, z, 5, z, z, z, 7, z}, // 2111
+    {z, 0, 1, z, z, z, 3, z, z, z, 5, z, z, 7, 8, z}, // 2112
+    {z, 0, 1, z, z, z, 3, z, z, z, 5, z, 7, 8, 9, z}, // 2113
+    {z, 0, 1, z, z, z, 3, z, z, 5, 6, z, z, z, 8, z}, // 2121
+    {z, 0, 1, z, z, z, 3, z, z, 5, 6, z, z, 8, 9, z}, // 2122
+    {z, 0, 1, z, z, z, 3, z, z, 5, 6, z, 8, 9, 10, z}, // 2123
+    {z, 0, 1, z, z, z, 3, z, 5, 6, 7, z, z, z, 9, z}, // 2131
+    {z, 0, 1, z, z, z, 3, z, 5, 6, 7, z, z, 9, 10, z}, // 2132
+    {z, 0, 1, z, z, z, 3, z, 5, 6, 7, z, 9, 10, 11, z}, // 2133
+    {z, 0, 1, z, z, 3, 4, z, z, z, 6, z, z, z, 8, z}, // 2211
+    {z, 0, 1, z, z, 3, 4, z, z, z, 6, z, z, 8, 9, z}, // 2212
+    {z, 0, 1, z, z, 3, 4, z, z, z, 6, z, 8, 9, 10, z}, // 2213
+    {z, 0, 1, z, z, 3, 4, z, z, 6, 7, z, z, z, 9, z}, // 2221
+    {z, 0, 1, z, z, 3, 4, z, z, 6, 7, z, z, 9, 10, z}, // 2222
+    {z, 0, 1, z, z, 3, 4, z, z, 6, 7, z, 9, 10, 11, z}, // 2223
+    {z, 0, 1, z, z, 3, 4, z, 6, 7, 8, z, z, z, 10, z}, // 2231
+    {z, 0, 1, z, z, 3, 4, z, 6, 7, 8, z, z, 10, 11, z}, // 2232
+    {z, 0, 1, z, z, 3, 4, z, 6, 7, 8, z, 10, 11, 12, z}, // 2233
+    {z, 0, 1, z, 3, 4, 5, z, z, z, 7, z, z, z, 9, z}, // 2311
+    {z, 0, 1, z, 3, 4, 5, z, z, z, 7, z, z, 9, 10, z}, // 2312
+    {z, 0, 1, z, 3, 4, 5, z, z, z, 7, z, 9, 10, 11, z}, // 2313
+    {z, 0, 1, z, 3, 4, 5, z, z, 7, 8, z, z, z, 10, z}, // 2321
+    {z, 0, 1, z, 3, 4, 5, z, z, 7, 8, z, z, 10, 11, z}, // 2322
+    {z, 0, 1, z, 3, 4, 5, z, z, 7, 8, z, 10, 11, 12, z}, // 2323
+    {z, 0, 1, z, 3, 4, 5, z, 7, 8, 9, z, z, z, 11, z}, // 2331
+    {z, 0, 1, z, 3, 4, 5, z, 7, 8, 9, z, z, 11, 12, z}, // 2332
+    {z, 0, 1, z, 3, 4, 5, z, 7, 8, 9, z, 11, 12, 13, z}, // 2333
+    {0, 1, 2, z, z, z, 4, z, z, z, 6, z, z, z, 8, z}, // 3111
+    {0, 1, 2, z, z, z, 4, z, z, z, 6, z, z, 8, 9, z}, // 3112
+    {0, 1, 2, z, z, z, 4, z, z, z, 6, z, 8, 9, 10, z}, // 3113
+    {0, 1, 2, z, z, z, 4, z, z, 6, 7, z, z, z, 9, z}, // 3121
+    {0, 1, 2, z, z, z, 4, z, z, 6, 7, z, z, 9, 10, z}, // 3122
+    {0, 1, 2, z, z, z, 4, z, z, 6, 7, z, 9, 10, 11, z}, // 3123
+    {0, 1, 2, z, z, z, 4, z, 6, 7, 8, z, z, z, 10, z}, // 3131
+    {0, 1, 2, z, z, z, 4, z, 6, 7, 8, z, z, 10, 11, z}, // 3132
+    {0, 1, 2, z, z, z, 4, z, 6, 7, 8, z, 10, 11, 12, z}, // 3133
+    {0, 1, 2, z, z, 4, 5, z, z, z, 7, z, z, z, 9, z}, // 3211
+    {0, 1, 2, z, z, 4, 5, z, z, z, 7, z, z, 9, 10, z}, // 3212
+    {0, 1, 2, z, z, 4, 5, z, z, z, 7, z, 9, 10, 11, z}, // 3213
+    {0, 1, 2, z, z, 4, 5, z, z, 7, 8, z, z, z, 10, z}, // 3221
+    {0, 1, 2, z, z, 4, 5, z, z, 7, 8, z, z, 10, 11, z}, // 3222
+    {0, 1, 2, z, z, 4, 5, z, z, 7, 8, z, 10, 11, 12, z}, // 3223
+    {0, 1, 2, z, z, 4, 5, z, 7, 8, 9, z, z, z, 11, z}, // 3231
+    {0, 1, 2, z, z, 4, 5, z, 7, 8, 9, z, z, 11, 12, z}, // 3232
+    {0, 1, 2, z, z, 4, 5, z, 7, 8, 9, z, 11, 12, 13, z}, // 3233
+    {0, 1, 2, z, 4, 5, 6, z, z, z, 8, z, z, z, 10, z}, // 3311
+    {0, 1, 2, z, 4, 5, 6, z, z, z, 8, z, z, 10, 11, z}, // 3312
+    {0, 1, 2, z, 4, 5, 6, z, z, z, 8, z, 10, 11, 12, z}, // 3313
+    {0, 1, 2, z, 4, 5, 6, z, z, 8, 9, z, z, z, 11, z}, // 3321
+    {0, 1, 2, z, 4, 5, 6, z, z, 8, 9, z, z, 11, 12, z}, // 3322
+    {0, 1, 2, z, 4, 5, 6, z, z, 8, 9, z, 11, 12, 13, z}, // 3323
+    {0, 1, 2, z, 4, 5, 6, z, 8, 9, 10, z, z, z, 12, z}, // 3331
+    {0, 1, 2, z, 4, 5, 6, z, 8, 9, 10, z, z, 12, 13, z}, // 3332
+    {0, 1, 2, z, 4, 5, 6, z, 8, 9, 10, z, 12, 13, 14, z}, // 3333
+};
+
+// An address has at most 15 characters,
+// so it is in the first 16 bytes of `s`
+#ifndef _MSC_VER
+__attribute__((target("ssse3")))
+#endif
+std::size_t
+parse_ipv4_ssse3(
+    char const* s,
+    unsigned char* v) noexcept
+{
+    __m128i const x = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(s));
+    __m128i const d = _mm_sub_epi8(
+        x, _mm_set1_epi8('0'));
+    // unsigned d <= 9
+    __m128i const digit = _mm_cmpeq_epi8(
+        _mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    __m128i const dot = _mm_cmpeq_epi8(
+        x, _mm_set1_epi8('.'));
+    unsigned const dots = static_cast<unsigned>(
+        _mm_movemask_epi8(dot));
+    unsigned const mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_or_si128(
+            digit, dot)));
+
+    // the address ends at the first other
+    // character or at the fourth dot
+    unsigned const len = static_cast<unsigned>(
+        core::countr_one(mask));
+    unsigned const m = dots & ((1u << len) - 1);
+    if(core::popcount(m) < 3)
+        return 0;
+    unsigned const p1 = static_cast<
+        unsigned>(core::countr_zero(m));
+    unsigned const m2 = m & (m - 1);
+    unsigned const p2 = static_cast<
+        unsigned>(core::countr_zero(m2));
+    unsigned const m3 = m2 & (m2 - 1);
+    unsigned const p3 = static_cast<
+        unsigned>(core::countr_zero(m3));
+    unsigned const m4 = m3 & (m3 - 1);
+    unsigned const e = m4 != 0
+        ? static_cast<unsigned>(
+            core::countr_zero(m4))
+        : len;
+    unsigned const l1 = p1;
+    unsigned const l2 = p2 - p1 - 1;
+    unsigned const l3 = p3 - p2 - 1;
+    unsigned const l4 = e - p3 - 1;
+    if( l1 - 1 > 2 || l2 - 1 > 2 ||
+        l3 - 1 > 2 || l4 - 1 > 2)
+        return 0;
+
+    // leading zeros
+    if( (l1 > 1 && s[0] == '0') ||
+        (l2 > 1 && s[p1 + 1] == '0') ||
+        (l3 > 1 && s[p2 + 1] == '0') ||
+        (l4 > 1 && s[p3 + 1] == '0'))
+        return 0;
+
+    __m128i const shuf = _mm_load_si128(
+        reinterpret_cast<__m128i const*>(
+            ipv4_shuffle[
+                27 * (l1 - 1) + 9 * (l2 - 1) +
+                3 * (l3 - 1) + (l4 - 1)]));
+    __m128i const digits =
+        _mm_shuffle_epi8(d, shuf);
+    // 100 * h + 10 * t and o in 16 bits,
+    // then their sum in 32 bits
+    __m128i const w = _mm_maddubs_epi16(
+        digits, _mm_setr_epi8(
+            100, 10, 1, 0, 100, 10, 1, 0,
+            100, 10, 1, 0, 100, 10, 1, 0));
+    __m128i const octets = _mm_madd_epi16(
+        w, _mm_set1_epi16(1));
+    if(_mm_movemask_epi8(_mm_cmpgt_epi32(
+            octets, _mm_set1_epi32(255))) != 0)
+        return 0;
+    __m128i const b = _mm_packus_epi16(
+        _mm_packs_epi32(octets, octets),
+        _mm_setzero_si128());
+    int const r = _mm_cvtsi128_si32(b);
+    std::memcpy(v, &r, 4);
+    return e;
+}
+
+#endif
+
+} // (anon)
+
+std::size_t
+parse_ipv4_fast(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept
+{
+#ifdef BOOST_URL_USE_SSSE3
+    static bool const has_ssse3 =
+        cpu_has_ssse3();
+    if(! has_ssse3)
+        return parse_ipv4_scalar(
+            it, end, v);
+    // copying a short input into a buffer
+    // costs more than the scalar loop
+    if(end - it >= 16)
+        return parse_ipv4_ssse3(it, v);
+    return parse_ipv4_scalar(
+        it, end, v);
+#else
+    return parse_ipv4_scalar(
+        it, end, v);
+#endif
+}
+
+} // detail
+} // urls
+} // boost
@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RFC_DETAIL_IPV4_FAST_HPP
+#define BOOST_URL_RFC_DETAIL_IPV4_FAST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  Parse a dotted quad at the start of [it, end)
+
+    This recognizes the common form of an
+    IPv4address: four decimal octets of one
+    to three digits, without leading zeros,
+    each at most 255, separated by dots. The
+    octets are written to `v`, and the number
+    of characters in the address, between 7
+    and 15, is returned.
+
+    Zero is returned for any other input,
+    including invalid addresses, which must
+    then be parsed by ipv4_address_rule to
+    obtain the same result or error.
+*/
+std::size_t
+parse_ipv4_fast(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include "ipv6_fast.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// value of a hex digit, or 16. The
+// comparisons compile to conditional
+// moves rather than a switch.
+inline
+unsigned
+hex_value(char c) noexcept
+{
+    auto const u =
+        static_cast<unsigned char>(c);
+    unsigned const d = u - '0';
+    unsigned const x = (u | 0x20u) - 'a';
+    unsigned const r = x < 6 ? x + 10 : 16;
+    return d < 10 ? d : r;
+}
+
+// reads one to four hex digits,
+// returns the number read
+inline
+std::size_t
+read_h16(
+    char const* p,
+    char const* end,
+    unsigned& v) noexcept
+{
+    std::size_t const avail =
+        static_cast<std::size_t>(end - p);
+    std::size_t n = 0;
+    v = 0;
+    while(n < 4 && n < avail)
+    {
+        unsigned const d = hex_value(p[n]);
+        if(d > 15)
+            break;
+        v = (v << 4) | d;
+        ++n;
+    }
+    return n;
+}
+
+} // (anon)
+
+std::size_t
+parse_ipv6_fast(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept
+{
+    unsigned short w[8];
+    int n = 0;      // groups read
+    int gap = -1;   // groups before "::"
+    char const* p = it;
+    if( end - p >= 2 &&
+        p[0] == ':' &&
+        p[1] == ':')
+    {
+        gap = 0;
+        p += 2;
+    }
+    for(;;)
+    {
+        unsigned h;
+        std::size_t const k =
+            read_h16(p, end, h);
+        if(k == 0)
+        {
+            // only "::" may be
+            // followed by no group
+            if(gap != n)
+                return 0;
+            break;
+        }
+        p += k;
+        if( p != end &&
+            hex_value(*p) < 16)
+            return 0;
+        w[n++] = static_cast<
+            unsigned short>(h);
+        if(n == 8)
+        {
+            if(gap != -1)
+                return 0;
+            // complete, whatever
+            // follows the address
+            break;
+        }
+        if( p == end ||
+            *p != ':')
+            break;
+        if( end - p >= 2 &&
+            p[1] == ':')
+        {
+            if(gap != -1)
+                return 0;
+            gap = n;
+            p += 2;
+            continue;
+        }
+        ++p;
+    }
+    if(n < 8)
+    {
+        // "::" stands for at least one
+        // group, and nothing which could
+        // continue an address may follow
+        if( gap == -1 || (
+                p != end && (
+                *p == ':' ||
+                *p == '.')))
+            return 0;
+    }
+
+    // the groups after "::" go
+    // to the end of the address
+    int const head = gap == -1 ? n : gap;
+    int const tail = n - head;
+    std::memset(v, 0, 16);
+    for(int i = 0; i < head; ++i)
+    {
+        v[2 * i] = static_cast<
+            unsigned char>(w[i] >> 8);
+        v[2 * i + 1] = static_cast<
+            unsigned char>(w[i]);
+    }
+    for(int i = 0; i < tail; ++i)
+    {
+        int const j = 8 - tail + i;
+        v[2 * j] = static_cast<
+            unsigned char>(w[head + i] >> 8);
+        v[2 * j + 1] = static_cast<
+            unsigned char>(w[head + i]);
+    }
+    return static_cast<
+        std::size_t>(p - it);
+}
+
+} // detail
+} // urls
+} // boost
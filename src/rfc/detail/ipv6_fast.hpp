@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RFC_DETAIL_IPV6_FAST_HPP
+#define BOOST_URL_RFC_DETAIL_IPV6_FAST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  Parse an IPv6 address at the start of [it, end)
+
+    This recognizes the common forms of an
+    IPv6address: eight groups of one to four
+    hex digits separated by colons, or fewer
+    groups with a single "::". The sixteen
+    bytes of the address are written to `v`,
+    and the number of characters in the
+    address is returned.
+
+    Zero is returned for any other input,
+    including invalid addresses and those
+    ending in an IPv4address, which must then
+    be parsed by ipv6_address_rule to obtain
+    the same result or error.
+*/
+std::size_t
+parse_ipv6_fast(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -15,6 +15,7 @@
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 #include <boost/url/grammar/unsigned_rule.hpp>
+#include <boost/url/grammar/detail/digits.hpp>
 #include <boost/static_assert.hpp>
 #include <type_traits>
 
@@ -55,12 +56,15 @@ parse(
         if (grammar::digit_chars(*it))
         {
             // number > max uint16_t
-            while (
-                it != end &&
-                grammar::digit_chars(*it))
+            std::size_t n;
+            do
             {
-                ++it;
+                n = grammar::detail::count_digits8(
+                    grammar::detail::load_digits8(
+                        it, end));
+                it += n;
             }
+            while(n == 8);
             t.str = core::string_view(start, it);
             t.has_number = true;
             t.number = 0;
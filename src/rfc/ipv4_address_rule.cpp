@@ -16,6 +16,7 @@
 #include <boost/url/grammar/dec_octet_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
+#include "detail/ipv4_fast.hpp"
 
 namespace boost {
 namespace urls {
@@ -28,6 +29,18 @@ parse(
         ) const noexcept ->
     system::result<value_type>
 {
+    std::array<unsigned char, 4> v;
+    std::size_t const n =
+        detail::parse_ipv4_fast(
+            it, end, v.data());
+    if(n != 0)
+    {
+        it += n;
+        return ipv4_address(v);
+    }
+
+    // invalid input, or one which the
+    // fast path does not handle
     using namespace grammar;
     auto rv = grammar::parse(
         it, end, tuple_rule(
@@ -37,7 +50,6 @@ parse(
             dec_octet_rule));
     if(! rv)
         return rv.error();
-    std::array<unsigned char, 4> v;
     v[0] = std::get<0>(*rv);
     v[1] = std::get<1>(*rv);
     v[2] = std::get<2>(*rv);
@@ -14,6 +14,7 @@
 #include <boost/url/rfc/ipv6_address_rule.hpp>
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 #include "detail/h16_rule.hpp"
+#include "detail/ipv6_fast.hpp"
 #include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
@@ -57,12 +58,23 @@ parse(
         ) const noexcept ->
     system::result<ipv6_address>
 {
+    ipv6_address::bytes_type bytes;
+    std::size_t const len =
+        detail::parse_ipv6_fast(
+            it, end, bytes.data());
+    if(len != 0)
+    {
+        it += len;
+        return ipv6_address{bytes};
+    }
+
+    // invalid input, or one which the
+    // fast path does not handle
     int n = 8;      // words needed
     int b = -1;     // value of n
                     // when '::' seen
     bool c = false; // need colon
     auto prev = it;
-    ipv6_address::bytes_type bytes;
     system::result<detail::h16_rule_t::value_type> rv;
     for(;;)
     {
@@ -15,13 +15,263 @@
 #include <boost/url/rfc/query_rule.hpp>
 #include "boost/url/rfc/detail/path_rules.hpp"
 #include "detail/query_part_rule.hpp"
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/grammar/basic_range_rule.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
-#include <boost/url/grammar/range_rule.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
 
 namespace boost {
 namespace urls {
 
+namespace {
+
+// the characters of an absolute-path,
+// which are also characters of a query
+constexpr
+grammar::lut_chars
+path_chars = pchars + '/';
+
+#ifdef BOOST_URL_USE_SSE2
+
+// bits per byte in the block masks
+constexpr int block_shift = 0;
+
+// Return a mask of the bytes in [p, p+16)
+// which are not path_chars, and set `m` to
+// a mask of the bytes equal to `marker`
+inline
+std::uint64_t
+block_masks(
+    char const* p,
+    char marker,
+    std::uint64_t& m) noexcept
+{
+    __m128i const v = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(p));
+    auto const eq = [&v](char c)
+    {
+        return _mm_cmpeq_epi8(
+            v, _mm_set1_epi8(c));
+    };
+    // lo <= c <= hi, unsigned
+    auto const in = [&v](char lo, char hi)
+    {
+        __m128i const d = _mm_sub_epi8(
+            v, _mm_set1_epi8(lo));
+        return _mm_cmpeq_epi8(_mm_min_epu8(d,
+            _mm_set1_epi8(static_cast<char>(
+                hi - lo))), d);
+    };
+    // & ' ( ) * + , - . / 0-9 : ;
+    // @ A-Z a-z ! $ = _ ~
+    __m128i const ok = _mm_or_si128(
+        _mm_or_si128(
+            _mm_or_si128(in('&', ';'), in('@', 'Z')),
+            _mm_or_si128(in('a', 'z'), eq('!'))),
+        _mm_or_si128(
+            _mm_or_si128(eq('$'), eq('=')),
+            _mm_or_si128(eq('_'), eq('~'))));
+    m = static_cast<unsigned>(
+        _mm_movemask_epi8(eq(marker)));
+    return ~static_cast<unsigned>(
+        _mm_movemask_epi8(ok)) & 0xFFFF;
+}
+
+#elif defined(BOOST_URL_USE_NEON)
+
+// bits per byte in the block masks
+constexpr int block_shift = 2;
+
+// four bits per byte
+inline
+std::uint64_t
+nibble_mask(uint8x16_t e) noexcept
+{
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(
+            vreinterpretq_u16_u8(e), 4)), 0);
+}
+
+// Return a mask of the bytes in [p, p+16)
+// which are not path_chars, and set `m` to
+// a mask of the bytes equal to `marker`
+inline
+std::uint64_t
+block_masks(
+    char const* p,
+    char marker,
+    std::uint64_t& m) noexcept
+{
+    uint8x16_t const v = vld1q_u8(
+        reinterpret_cast<
+            std::uint8_t const*>(p));
+    auto const eq = [&v](char c)
+    {
+        return vceqq_u8(v, vdupq_n_u8(
+            static_cast<std::uint8_t>(c)));
+    };
+    // lo <= c <= hi, unsigned
+    auto const in = [&v](char lo, char hi)
+    {
+        return vcleq_u8(
+            vsubq_u8(v, vdupq_n_u8(
+                static_cast<std::uint8_t>(lo))),
+            vdupq_n_u8(static_cast<
+                std::uint8_t>(hi - lo)));
+    };
+    // & ' ( ) * + , - . / 0-9 : ;
+    // @ A-Z a-z ! $ = _ ~
+    uint8x16_t const ok = vorrq_u8(
+        vorrq_u8(
+            vorrq_u8(in('&', ';'), in('@', 'Z')),
+            vorrq_u8(in('a', 'z'), eq('!'))),
+        vorrq_u8(
+            vorrq_u8(eq('$'), eq('=')),
+            vorrq_u8(eq('_'), eq('~'))));
+    m = nibble_mask(eq(marker));
+    return ~nibble_mask(ok);
+}
+
+#endif
+
+// Return the first character in [p, end)
+// which is not in path_chars, adding the
+// number of characters equal to `marker`
+// before it to `n`
+char const*
+find_special(
+    char const* p,
+    char const* const end,
+    char marker,
+    std::size_t& n) noexcept
+{
+#if defined(BOOST_URL_USE_SSE2) || \
+    defined(BOOST_URL_USE_NEON)
+    while(end - p >= 16)
+    {
+        std::uint64_t m;
+        std::uint64_t const s =
+            block_masks(p, marker, m);
+        if(s)
+        {
+            int const k = boost::core::countr_zero(s);
+            n += boost::core::popcount(
+                m & ((std::uint64_t(1) << k) - 1)) >>
+                    block_shift;
+            return p + (k >> block_shift);
+        }
+        n += boost::core::popcount(m) >>
+            block_shift;
+        p += 16;
+    }
+#endif
+    while(p != end)
+    {
+        if(! path_chars(*p))
+            return p;
+        if(*p == marker)
+            ++n;
+        ++p;
+    }
+    return p;
+}
+
+/*  Parse origin-form in one pass
+
+    The path and query are split, validated
+    and measured as the characters are
+    scanned. The segments are counted as
+    the slashes of the path and the params
+    as the ampersands of the query.
+
+    False is returned, and `it` is unchanged,
+    when the input does not start with '/' or
+    contains an invalid escape. The input must
+    then be parsed by the general rules to
+    obtain the same error.
+*/
+bool
+parse_origin_form_fast(
+    char const*& it,
+    char const* const end,
+    detail::url_impl& u) noexcept
+{
+    if( it == end ||
+        *it != '/')
+        return false;
+    char const* const first = it;
+    char const* q = nullptr;
+    std::size_t nseg = 0;
+    std::size_t namp = 0;
+    std::size_t dn[2] = {};
+    char const* p = first;
+    for(;;)
+    {
+        p = q
+            ? find_special(p, end, '&', namp)
+            : find_special(p, end, '/', nseg);
+        if(p == end)
+            break;
+        if(*p == '%')
+        {
+            if( end - p < 3 ||
+                ! grammar::hexdig_chars(p[1]) ||
+                ! grammar::hexdig_chars(p[2]))
+                return false;
+            dn[q != nullptr] += 2;
+            p += 3;
+            continue;
+        }
+        if(*p == '?')
+        {
+            if(! q)
+                q = p + 1;
+            ++p;
+            continue;
+        }
+        if( q && (
+            *p == '[' ||
+            *p == ']'))
+        {
+            ++p;
+            continue;
+        }
+        break;
+    }
+
+    u.cs_ = first;
+    char const* const pe =
+        q ? q - 1 : p;
+    std::size_t const n = pe - first;
+    u.apply_path(
+        make_pct_string_view_unsafe(
+            first, n, n - dn[0]),
+        nseg);
+    if(q)
+    {
+        // "?" has one empty param
+        std::size_t const n1 = p - q;
+        u.apply_query(
+            make_pct_string_view_unsafe(
+                q, n1, n1 - dn[1]),
+            namp + 1);
+    }
+    it = p;
+    return true;
+}
+
+} // (anon)
+
 auto
 origin_form_rule_t::
 parse(
@@ -31,11 +281,13 @@ parse(
     system::result<value_type>
 {
     detail::url_impl u(detail::url_impl::from::string);
+    if(parse_origin_form_fast(it, end, u))
+        return u.construct();
     u.cs_ = it;
 
     {
         auto rv = grammar::parse(it, end,
-            grammar::range_rule(
+            grammar::basic_range_rule(
                 grammar::tuple_rule(
                     grammar::delim_rule('/'),
                     detail::segment_rule),
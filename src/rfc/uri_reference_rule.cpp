@@ -15,8 +15,10 @@
 #include <boost/url/rfc/uri_rule.hpp>
 #include <boost/url/rfc/relative_ref_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
-#include <boost/url/grammar/variant_rule.hpp>
-#include <boost/variant2/variant.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 
 namespace boost {
 namespace urls {
@@ -29,21 +31,42 @@ parse(
         ) const noexcept ->
     system::result<value_type>
 {
+    // The characters which could be a scheme
+    // are scanned once. When they are not
+    // followed by a colon, uri_rule cannot
+    // match, and only relative_ref_rule is
+    // tried.
+    static
+    constexpr
+    grammar::lut_chars scheme_chars(
+        "0123456789" "+-."
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+    auto const it0 = it;
+    if( it != end &&
+        grammar::alpha_chars(*it))
+    {
+        auto const p = grammar::find_if_not(
+            it + 1, end, scheme_chars);
+        if( p != end &&
+            *p == ':')
+        {
+            auto rv = grammar::parse(
+                it, end, uri_rule);
+            if( rv )
+                return rv;
+            it = it0;
+        }
+    }
     auto rv = grammar::parse(
-        it, end,
-        grammar::variant_rule(
-            uri_rule,
-            relative_ref_rule));
+        it, end, relative_ref_rule);
     if(! rv)
-        return rv.error();
-    switch(rv->index())
     {
-    default:
-    case 0:
-        return boost::variant2::get<0>(*rv);
-    case 1:
-        return boost::variant2::get<1>(*rv);
+        it = it0;
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
     }
+    return rv;
 }
 
 } // urls
@@ -0,0 +1,435 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/robots_matcher.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr int wildcard = -1;
+
+constexpr char const* hexdigs =
+    "0123456789ABCDEF";
+
+// Calls f with the characters of a
+// valid encoded string, in which
+// escaped unreserved characters are
+// decoded and other escapes have
+// upper case digits, until f
+// returns false
+template<class F>
+bool
+each_char(
+    core::string_view s,
+    F const& f)
+{
+    char const* it = s.data();
+    char const* const end =
+        it + s.size();
+    while(it != end)
+    {
+        if(*it != '%')
+        {
+            if(! f(static_cast<
+                unsigned char>(*it++)))
+                return false;
+            continue;
+        }
+        auto const c = static_cast<
+            unsigned char>(
+                (grammar::hexdig_value(it[1]) << 4) +
+                grammar::hexdig_value(it[2]));
+        it += 3;
+        if(unreserved_chars(static_cast<char>(c)))
+        {
+            if(! f(c))
+                return false;
+            continue;
+        }
+        if( ! f('%') ||
+            ! f(hexdigs[c >> 4]) ||
+            ! f(hexdigs[c & 0xf]))
+            return false;
+    }
+    return true;
+}
+
+// Calls f with the characters of a
+// rule in the same form, or with
+// wildcard for a '*'. Characters
+// which can not appear in a path or
+// query are escaped.
+template<class F>
+void
+each_rule_char(
+    core::string_view s,
+    F const& f)
+{
+    auto const escape = [&f](unsigned char c)
+    {
+        f('%');
+        f(hexdigs[c >> 4]);
+        f(hexdigs[c & 0xf]);
+    };
+    char const* it = s.data();
+    char const* const end =
+        it + s.size();
+    while(it != end)
+    {
+        auto const c = static_cast<
+            unsigned char>(*it);
+        if(c == '*')
+        {
+            f(wildcard);
+            ++it;
+        }
+        else if(c == '%')
+        {
+            if( end - it >= 3 &&
+                grammar::hexdig_chars(it[1]) &&
+                grammar::hexdig_chars(it[2]))
+            {
+                auto const d = static_cast<
+                    unsigned char>(
+                        (grammar::hexdig_value(it[1]) << 4) +
+                        grammar::hexdig_value(it[2]));
+                if(unreserved_chars(static_cast<char>(d)))
+                    f(d);
+                else
+                    escape(d);
+                it += 3;
+            }
+            else
+            {
+                escape(c);
+                ++it;
+            }
+        }
+        else if(
+            pchars(static_cast<char>(c)) ||
+            c == '/' ||
+            c == '?')
+        {
+            f(c);
+            ++it;
+        }
+        else
+        {
+            escape(c);
+            ++it;
+        }
+    }
+}
+
+inline
+std::size_t
+hash_edge(
+    std::uint32_t parent,
+    unsigned char c) noexcept
+{
+    std::uint64_t const h =
+        ((std::uint64_t(parent) << 8) | c) *
+            0x9e3779b97f4a7c15ull;
+    return static_cast<std::size_t>(h >> 32);
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+// The live nodes of the automaton, kept
+// inline unless there are too many
+class robots_matcher::state
+{
+    static constexpr std::size_t N = 64;
+
+    struct set
+    {
+        std::uint32_t buf[N];
+        std::vector<std::uint32_t> v;
+        std::uint32_t* p = buf;
+        std::size_t n = 0;
+        std::size_t cap = N;
+
+        void
+        push(std::uint32_t i)
+        {
+            if(n == cap)
+            {
+                std::vector<std::uint32_t> v2(2 * cap);
+                std::copy(p, p + n, v2.data());
+                v.swap(v2);
+                p = v.data();
+                cap = v.size();
+            }
+            p[n++] = i;
+        }
+
+        bool
+        contains(std::uint32_t i) const noexcept
+        {
+            return std::find(p, p + n, i) != p + n;
+        }
+    };
+
+    robots_matcher const& m_;
+    set s_[2];
+    set* cur_ = &s_[0];
+    set* next_ = &s_[1];
+    std::size_t best_ = 0;
+
+    // A node is reached through a single
+    // edge, so only nodes which loop can
+    // be reached twice in the same step
+    void
+    enter(std::uint32_t i)
+    {
+        auto const& nd = m_.nodes_[i];
+        next_->push(i);
+        best_ = (std::max)(best_, nd.score);
+        if(nd.star == 0)
+            return;
+        if(next_->contains(nd.star))
+            return;
+        next_->push(nd.star);
+        best_ = (std::max)(best_,
+            m_.nodes_[nd.star].score);
+    }
+
+public:
+    explicit
+    state(robots_matcher const& m)
+        : m_(m)
+    {
+        enter(0);
+        std::swap(cur_, next_);
+    }
+
+    // returns false when no
+    // node is live
+    bool
+    step(unsigned char c)
+    {
+        next_->n = 0;
+        for(std::size_t k = 0; k < cur_->n; ++k)
+        {
+            auto const i = cur_->p[k];
+            if( m_.nodes_[i].loop &&
+                ! next_->contains(i))
+                next_->push(i);
+            auto const j = m_.child(i, c);
+            if(j != 0)
+                enter(j);
+        }
+        std::swap(cur_, next_);
+        return cur_->n != 0;
+    }
+
+    bool
+    allowed() const noexcept
+    {
+        auto best = best_;
+        for(std::size_t k = 0; k < cur_->n; ++k)
+            best = (std::max)(best,
+                m_.nodes_[cur_->p[k]].end);
+        return best == 0 || (best & 1) != 0;
+    }
+};
+
+//------------------------------------------------
+
+std::uint32_t
+robots_matcher::
+child(
+    std::uint32_t parent,
+    unsigned char c) const noexcept
+{
+    if(table_.empty())
+        return 0;
+    auto const mask = table_.size() - 1;
+    for(auto i = hash_edge(parent, c) & mask;
+        table_[i].child != 0;
+        i = (i + 1) & mask)
+    {
+        if( table_[i].parent == parent &&
+            table_[i].c == c)
+            return table_[i].child;
+    }
+    return 0;
+}
+
+void
+robots_matcher::
+rehash(std::size_t n)
+{
+    std::size_t slots = 16;
+    while(slots < 2 * n)
+        slots *= 2;
+    std::vector<edge> table(slots);
+    auto const mask = slots - 1;
+    for(auto const& e : table_)
+    {
+        if(e.child == 0)
+            continue;
+        auto i = hash_edge(e.parent, e.c) & mask;
+        while(table[i].child != 0)
+            i = (i + 1) & mask;
+        table[i] = e;
+    }
+    table_.swap(table);
+}
+
+std::uint32_t
+robots_matcher::
+add(
+    std::uint32_t parent,
+    unsigned char c)
+{
+    if(nodes_.size() >= 0xffffffff)
+        detail::throw_length_error();
+    if(2 * (edges_ + 1) > table_.size())
+        rehash(edges_ + 1);
+    nodes_.emplace_back();
+    auto const j = static_cast<
+        std::uint32_t>(nodes_.size() - 1);
+    auto const mask = table_.size() - 1;
+    auto i = hash_edge(parent, c) & mask;
+    while(table_[i].child != 0)
+        i = (i + 1) & mask;
+    table_[i].child = j;
+    table_[i].parent = parent;
+    table_[i].c = c;
+    ++edges_;
+    return j;
+}
+
+void
+robots_matcher::
+insert(
+    core::string_view pattern,
+    bool allow)
+{
+    if(pattern.empty())
+        return;
+    std::size_t const score =
+        2 * pattern.size() + (allow ? 1 : 0);
+    bool const anchored =
+        pattern.ends_with('$');
+    if(anchored)
+        pattern.remove_suffix(1);
+
+    // on error, the nodes which were
+    // added end no rule, so they do
+    // not change any match
+    if(nodes_.empty())
+        nodes_.emplace_back();
+    std::uint32_t cur = 0;
+    each_rule_char(pattern,
+        [this, &cur](int c)
+        {
+            if(c == wildcard)
+            {
+                // "**" is the same as "*"
+                if(nodes_[cur].loop)
+                    return;
+                if(nodes_[cur].star == 0)
+                {
+                    if(nodes_.size() >= 0xffffffff)
+                        detail::throw_length_error();
+                    nodes_.emplace_back();
+                    nodes_.back().loop = true;
+                    nodes_[cur].star = static_cast<
+                        std::uint32_t>(nodes_.size() - 1);
+                }
+                cur = nodes_[cur].star;
+                return;
+            }
+            auto const uc = static_cast<
+                unsigned char>(c);
+            auto next = child(cur, uc);
+            if(next == 0)
+                next = add(cur, uc);
+            cur = next;
+        });
+    auto& nd = nodes_[cur];
+    if(anchored)
+        nd.end = (std::max)(nd.end, score);
+    else
+        nd.score = (std::max)(nd.score, score);
+    ++size_;
+}
+
+void
+robots_matcher::
+allow(core::string_view pattern)
+{
+    insert(pattern, true);
+}
+
+void
+robots_matcher::
+disallow(core::string_view pattern)
+{
+    insert(pattern, false);
+}
+
+bool
+robots_matcher::
+allowed(
+    url_view_base const& u) const
+{
+    if(nodes_.empty())
+        return true;
+    state st(*this);
+    auto const f = [&st](unsigned char c)
+    {
+        return st.step(c);
+    };
+    core::string_view const path =
+        u.encoded_path();
+    bool live = path.empty()
+        ? f('/')
+        : each_char(path, f);
+    if( live &&
+        u.has_query())
+        live = f('?') &&
+            each_char(u.encoded_query(), f);
+    return st.allowed();
+}
+
+bool
+robots_matcher::
+allowed(
+    pct_string_view target) const
+{
+    if(nodes_.empty())
+        return true;
+    state st(*this);
+    auto const f = [&st](unsigned char c)
+    {
+        return st.step(c);
+    };
+    if(target.empty())
+        f('/');
+    else
+        each_char(target, f);
+    return st.allowed();
+}
+
+} // urls
+} // boost
@@ -12,7 +12,8 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/scheme.hpp>
-#include <boost/url/grammar/ci_string.hpp>
+#include "detail/scheme_key.hpp"
+#include "detail/scheme_table.hpp"
 
 namespace boost {
 namespace urls {
@@ -21,110 +22,44 @@ scheme
 string_to_scheme(
     core::string_view s) noexcept
 {
-    using grammar::to_lower;
-    switch(s.size())
-    {
-    case 0: // none
+    auto const n = s.size();
+    if(n == 0)
         return scheme::none;
-
-    case 2: // ws
-        if( to_lower(s[0]) == 'w' &&
-            to_lower(s[1]) == 's')
-            return scheme::ws;
-        break;
-
-    case 3:
-        switch(to_lower(s[0]))
-        {
-        case 'w': // wss
-            if( to_lower(s[1]) == 's' &&
-                to_lower(s[2]) == 's')
-                return scheme::wss;
-            break;
-
-        case 'f': // ftp
-            if( to_lower(s[1]) == 't' &&
-                to_lower(s[2]) == 'p')
-                return scheme::ftp;
-            break;
-
-        default:
-            break;
-        }
-        break;
-
-    case 4:
-        switch(to_lower(s[0]))
-        {
-        case 'f': // file
-            if( to_lower(s[1]) == 'i' &&
-                to_lower(s[2]) == 'l' &&
-                to_lower(s[3]) == 'e')
-                return scheme::file;
-            break;
-
-        case 'h': // http
-            if( to_lower(s[1]) == 't' &&
-                to_lower(s[2]) == 't' &&
-                to_lower(s[3]) == 'p')
-                return scheme::http;
-            break;
-
-        default:
-            break;
-        }
-        break;
-
-    case 5: // https
-        if( to_lower(s[0]) == 'h' &&
-            to_lower(s[1]) == 't' &&
-            to_lower(s[2]) == 't' &&
-            to_lower(s[3]) == 'p' &&
-            to_lower(s[4]) == 's')
-            return scheme::https;
-        break;
-
-    default:
-        break;
-    }
+    if(n > 5)
+        return scheme::unknown;
+    // every known scheme is all letters,
+    // so every character is folded
+    std::uint64_t const k =
+        detail::scheme_key(s.data(), n) | (
+            n >= 4 ? 0x2020202020202020ULL
+                   : 0x202020ULL);
+    for(auto const& e : detail::known_schemes)
+        if( e.size == n &&
+            k == detail::scheme_key(e.name, n))
+            return e.id;
     return scheme::unknown;
 }
 
 core::string_view
 to_string(scheme s) noexcept
 {
-    switch(s)
-    {
-    case scheme::ftp:   return "ftp";
-    case scheme::file:  return "file";
-    case scheme::http:  return "http";
-    case scheme::https: return "https";
-    case scheme::ws:    return "ws";
-    case scheme::wss:   return "wss";
-    case scheme::none:  return {};
-    default:
-        break;
-    }
-    return "<unknown>";
+    if(s == scheme::none)
+        return {};
+    auto const e =
+        detail::find_known_scheme(s);
+    if(! e)
+        return "<unknown>";
+    return { e->name, e->size };
 }
 
 std::uint16_t
 default_port(scheme s) noexcept
 {
-    switch(s)
-    {
-    case scheme::ftp:
-        return 21;
-    case scheme::http:
-    case scheme::ws:
-        return 80;
-    case scheme::https:
-    case scheme::wss:
-        return 443;
-    default:
-        break;
-    }
-    return 0;
+    auto const e =
+        detail::find_known_scheme(s);
+    if(! e)
+        return 0;
+    return e->default_port;
 }
 
 } // urls
@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_SCHEME_REGISTRY_IPP
+#define BOOST_URL_IMPL_SCHEME_REGISTRY_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/scheme_registry.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include "detail/scheme_key.hpp"
+#include "rfc/detail/scheme_rule.hpp"
+
+namespace boost {
+namespace urls {
+
+constexpr std::size_t scheme_registry::npos;
+
+std::size_t
+scheme_registry::
+insert(
+    core::string_view s,
+    std::uint16_t port)
+{
+    grammar::parse(s, detail::scheme_rule{}
+        ).value(BOOST_URL_POS);
+    auto const i = find(s);
+    if(i != npos)
+    {
+        v_[i].port = port;
+        return i;
+    }
+    entry e;
+    e.name.reserve(s.size());
+    for(char c : s)
+        e.name.push_back(grammar::to_lower(c));
+    e.port = port;
+    if(s.size() <= detail::scheme_key_size)
+    {
+        e.key = detail::scheme_key(
+            e.name.data(), e.name.size());
+        e.mask = detail::scheme_fold_mask(
+            e.name.data(), e.name.size());
+    }
+    v_.push_back(std::move(e));
+    return v_.size() - 1;
+}
+
+std::size_t
+scheme_registry::
+find(core::string_view s) const noexcept
+{
+    auto const n = s.size();
+    if(n > detail::scheme_key_size)
+    {
+        for(std::size_t i = 0; i < v_.size(); ++i)
+            if(grammar::ci_is_equal(s, v_[i].name))
+                return i;
+        return npos;
+    }
+    auto const k = detail::scheme_key(
+        s.data(), n);
+    for(std::size_t i = 0; i < v_.size(); ++i)
+    {
+        auto const& e = v_[i];
+        if( e.name.size() == n &&
+            (k | e.mask) == e.key)
+            return i;
+    }
+    return npos;
+}
+
+std::uint16_t
+scheme_registry::
+default_port(core::string_view s) const noexcept
+{
+    auto const i = find(s);
+    if(i == npos)
+        return 0;
+    return v_[i].port;
+}
+
+} // urls
+} // boost
+
+#endif
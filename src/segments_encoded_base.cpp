@@ -13,6 +13,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/segments_encoded_base.hpp>
+#include "detail/crc32c.hpp"
 #include <boost/assert.hpp>
 #include <ostream>
 
@@ -99,6 +100,47 @@ end() const noexcept ->
     return iterator(ref_, 0);
 }
 
+std::size_t
+segments_encoded_base::
+hashes(
+    std::uint32_t* dest,
+    std::size_t n) const noexcept
+{
+    detail::segments_iter_impl it(ref_);
+    detail::segments_iter_impl const end(ref_, 0);
+    std::size_t i = 0;
+    for(; i < n && ! it.equal(end);
+        ++i, it.increment())
+    {
+        auto const s = it.dereference();
+        dest[i] = ~detail::crc32c_decoded(
+            0xFFFFFFFF, s.data(),
+            s.data() + s.size());
+    }
+    return ref_.nseg();
+}
+
+std::vector<std::uint32_t>
+segments_encoded_base::
+hashes() const
+{
+    std::vector<std::uint32_t> v(
+        ref_.nseg());
+    hashes(v.data(), v.size());
+    return v;
+}
+
+//------------------------------------------------
+
+std::uint32_t
+segment_hash(
+    core::string_view s) noexcept
+{
+    return ~detail::crc32c(
+        0xFFFFFFFF, s.data(),
+        s.data() + s.size());
+}
+
 //------------------------------------------------
 
 std::ostream&
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_SHARED_URL_IPP
+#define BOOST_URL_IMPL_SHARED_URL_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/shared_url.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+// The characters follow the header
+// in the same allocation
+struct shared_url::rep
+{
+    std::atomic<std::size_t> refs;
+    std::size_t size;
+
+    explicit
+    rep(std::size_t n) noexcept
+        : refs(1)
+        , size(n)
+    {
+    }
+
+    char*
+    data() noexcept
+    {
+        return reinterpret_cast<
+            char*>(this + 1);
+    }
+};
+
+//------------------------------------------------
+
+shared_url::
+~shared_url()
+{
+    release();
+}
+
+// Views of the characters copy the
+// offsets, as they do for a string,
+// instead of referencing this object
+shared_url::
+shared_url() noexcept
+    : url_view_base(detail::url_impl(
+        from::string))
+{
+}
+
+shared_url::
+shared_url(core::string_view s)
+    : shared_url(parse_uri_reference(s
+        ).value(BOOST_URL_POS))
+{
+}
+
+shared_url::
+shared_url(url_view_base const& u)
+    : shared_url()
+{
+    auto const n = u.size();
+    if(n == 0)
+        return;
+    std::size_t const bytes =
+        sizeof(rep) + n + 1;
+    p_ = ::new(::operator new(
+        bytes)) rep(n);
+    detail::stats_allocate(bytes);
+    char* s = p_->data();
+    std::memcpy(s, u.data(), n);
+    s[n] = '\0';
+    impl_ = *u.pi_;
+    impl_.cs_ = s;
+    impl_.from_ = from::string;
+}
+
+shared_url::
+shared_url(shared_url const& u) noexcept
+    : url_view_base(u)
+    , p_(u.p_)
+{
+    if(p_)
+        p_->refs.fetch_add(1,
+            std::memory_order_relaxed);
+}
+
+shared_url::
+shared_url(shared_url&& u) noexcept
+    : url_view_base(u)
+    , p_(u.p_)
+{
+    u.p_ = nullptr;
+    u.impl_ = detail::url_impl(
+        from::string);
+}
+
+shared_url&
+shared_url::
+operator=(shared_url const& u) noexcept
+{
+    shared_url tmp(u);
+    swap(tmp);
+    return *this;
+}
+
+shared_url&
+shared_url::
+operator=(shared_url&& u) noexcept
+{
+    shared_url tmp(std::move(u));
+    swap(tmp);
+    return *this;
+}
+
+shared_url&
+shared_url::
+operator=(url_view_base const& u)
+{
+    shared_url tmp(u);
+    swap(tmp);
+    return *this;
+}
+
+std::size_t
+shared_url::
+use_count() const noexcept
+{
+    if(! p_)
+        return 0;
+    return p_->refs.load(
+        std::memory_order_relaxed);
+}
+
+void
+shared_url::
+swap(shared_url& other) noexcept
+{
+    if(this == &other)
+        return;
+    std::swap(p_, other.p_);
+    std::swap(impl_, other.impl_);
+}
+
+void
+shared_url::
+release() noexcept
+{
+    if(! p_)
+        return;
+    if(p_->refs.fetch_sub(1,
+        std::memory_order_acq_rel) != 1)
+        return;
+    detail::stats_deallocate();
+    p_->~rep();
+    ::operator delete(p_);
+    p_ = nullptr;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_SMALL_URL_IPP
+#define BOOST_URL_IMPL_SMALL_URL_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/small_url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+small_url_base::
+~small_url_base()
+{
+    if(s_ != inline_)
+    {
+        detail::stats_deallocate();
+        delete[] s_;
+    }
+}
+
+small_url_base::
+small_url_base(
+    char* buf,
+    std::size_t cap) noexcept
+    : inline_(buf)
+    , inline_cap_(cap)
+{
+    s_ = buf;
+    cap_ = cap;
+    s_[0] = '\0';
+    impl_.cs_ = s_;
+}
+
+small_url_base::
+small_url_base(
+    char* buf,
+    std::size_t cap,
+    core::string_view s)
+    : small_url_base(buf, cap)
+{
+    copy(parse_uri_reference(s
+        ).value(BOOST_URL_POS));
+}
+
+// Both urls have the same inline
+// capacity, so inline characters
+// always fit without allocating.
+void
+small_url_base::
+move(small_url_base& u) noexcept
+{
+    BOOST_ASSERT(
+        inline_cap_ == u.inline_cap_);
+    if(u.s_ == u.inline_)
+    {
+        BOOST_ASSERT(u.size() <= cap_);
+        std::memcpy(s_, u.s_, u.size() + 1);
+        impl_ = u.impl_;
+        impl_.cs_ = s_;
+        u.clear_impl();
+        return;
+    }
+    if(s_ != inline_)
+    {
+        detail::stats_deallocate();
+        delete[] s_;
+    }
+    impl_ = u.impl_;
+    s_ = u.s_;
+    cap_ = u.cap_;
+    u.s_ = u.inline_;
+    u.cap_ = u.inline_cap_;
+    u.clear_impl();
+}
+
+void
+small_url_base::
+clear_impl() noexcept
+{
+    // preserve capacity
+    impl_ = {from::url};
+    s_[0] = '\0';
+    impl_.cs_ = s_;
+}
+
+void
+small_url_base::
+reserve_impl(
+    std::size_t n,
+    op_t& op)
+{
+    if(n > max_size())
+        detail::throw_length_error();
+    if(n <= cap_)
+        return;
+    // 50% growth policy, starting
+    // from the inline capacity
+    auto const h = cap_ / 2;
+    std::size_t new_cap;
+    if(cap_ <= max_size() - h)
+        new_cap = cap_ + h;
+    else
+        new_cap = max_size();
+    if( new_cap < n)
+        new_cap = n;
+    char* s = new char[new_cap + 1];
+    detail::stats_allocate(new_cap + 1);
+    std::memcpy(s, s_, size() + 1);
+    if(s_ != inline_)
+    {
+        // the inline buffer is never
+        // freed, so only heap buffers
+        // are released by cleanup
+        detail::stats_reallocate();
+        BOOST_ASSERT(! op.old);
+        op.old = s_;
+    }
+    s_ = s;
+    cap_ = new_cap;
+    impl_.cs_ = s_;
+}
+
+void
+small_url_base::
+cleanup(
+    op_t& op)
+{
+    if(op.old)
+    {
+        detail::stats_deallocate();
+        delete[] op.old;
+    }
+}
+
+} // urls
+} // boost
+
+#endif
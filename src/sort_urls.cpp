@@ -0,0 +1,264 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/sort_urls.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+using key = core::string_view;
+
+// buckets smaller than this
+// are sorted by comparison
+constexpr std::size_t small_size = 32;
+
+// smaller ranges are sorted
+// on the calling thread
+constexpr std::size_t parallel_size = 65536;
+
+// the byte of a key at depth d, plus
+// one, or zero past the end of the key
+inline
+std::size_t
+byte_at(
+    key const& k,
+    std::size_t d) noexcept
+{
+    return d < k.size() ?
+        static_cast<unsigned char>(k[d]) + 1 : 0;
+}
+
+// compares keys which are
+// equal before depth
+struct less_from
+{
+    std::size_t depth;
+
+    bool
+    operator()(
+        key const& k0,
+        key const& k1) const noexcept
+    {
+        std::size_t const n0 = k0.size() - depth;
+        std::size_t const n1 = k1.size() - depth;
+        int const r = std::memcmp(
+            k0.data() + depth,
+            k1.data() + depth,
+            (std::min)(n0, n1));
+        if(r != 0)
+            return r < 0;
+        return n0 < n1;
+    }
+};
+
+struct bucket
+{
+    std::size_t pos;
+    std::size_t size;
+    std::size_t depth;
+};
+
+class radix_sorter
+{
+    key* a_;
+    key* t_;
+
+public:
+    radix_sorter(
+        key* a,
+        key* t) noexcept
+        : a_(a)
+        , t_(t)
+    {
+    }
+
+    // Partition a bucket on the first byte
+    // where its keys differ, and push the
+    // buckets which still need sorting
+    void
+    split(
+        bucket b,
+        std::vector<bucket>& out) const
+    {
+        key* const a = a_ + b.pos;
+        std::size_t count[257];
+        for(;;)
+        {
+            std::fill(count, count + 257, 0);
+            for(std::size_t i = 0; i < b.size; ++i)
+                ++count[byte_at(a[i], b.depth)];
+            // the keys are equal
+            if(count[0] == b.size)
+                return;
+            // the keys share this byte
+            if(count[byte_at(a[0], b.depth)] != b.size)
+                break;
+            ++b.depth;
+        }
+
+        std::size_t next[257];
+        std::size_t sum = 0;
+        for(std::size_t c = 0; c < 257; ++c)
+        {
+            next[c] = sum;
+            sum += count[c];
+        }
+        key* const t = t_ + b.pos;
+        for(std::size_t i = 0; i < b.size; ++i)
+            t[next[byte_at(a[i], b.depth)]++] = a[i];
+        std::copy(t, t + b.size, a);
+
+        // the keys which end
+        // here are in order
+        std::size_t pos = b.pos + count[0];
+        for(std::size_t c = 1; c < 257; ++c)
+        {
+            if(count[c] > 1)
+                out.push_back({
+                    pos, count[c], b.depth + 1 });
+            pos += count[c];
+        }
+    }
+
+    void
+    sort(bucket b) const
+    {
+        std::vector<bucket> stack;
+        stack.push_back(b);
+        while(! stack.empty())
+        {
+            b = stack.back();
+            stack.pop_back();
+            if(b.size < small_size)
+                std::sort(
+                    a_ + b.pos,
+                    a_ + b.pos + b.size,
+                    less_from{ b.depth });
+            else
+                split(b, stack);
+        }
+    }
+};
+
+} // (anon)
+
+void
+radix_sort_keys(
+    core::string_view* first,
+    core::string_view* last,
+    std::size_t threads)
+{
+    std::size_t const n = static_cast<
+        std::size_t>(last - first);
+    if(n < 2)
+        return;
+    std::vector<key> tmp(n);
+    radix_sorter s(first, tmp.data());
+#if defined(BOOST_URL_DISABLE_THREADS)
+    (void)threads;
+    s.sort({ 0, n, 0 });
+#else
+    if(threads == 0)
+        threads = (std::max)(1u,
+            std::thread::hardware_concurrency());
+    if( threads == 1 ||
+        n < parallel_size)
+    {
+        s.sort({ 0, n, 0 });
+        return;
+    }
+
+    // Split the large buckets on this
+    // thread, until there are enough
+    // buckets to share among the threads
+    std::size_t const share = (std::max)(
+        small_size, n / (4 * threads));
+    std::vector<bucket> large;
+    std::vector<bucket> tasks;
+    large.push_back({ 0, n, 0 });
+    while(! large.empty())
+    {
+        bucket const b = large.back();
+        large.pop_back();
+        if(b.size <= share)
+            tasks.push_back(b);
+        else
+            s.split(b, large);
+    }
+
+    // the largest buckets first,
+    // to balance the threads
+    std::sort(tasks.begin(), tasks.end(),
+        [](bucket const& b0, bucket const& b1)
+        {
+            return b0.size > b1.size;
+        });
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr ep;
+    std::mutex m;
+    auto const work = [&]
+    {
+        try
+        {
+            for(;;)
+            {
+                std::size_t const i = next.fetch_add(
+                    1, std::memory_order_relaxed);
+                if(i >= tasks.size())
+                    return;
+                s.sort(tasks[i]);
+            }
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m);
+            if(! ep)
+                ep = std::current_exception();
+            next.store(tasks.size(),
+                std::memory_order_relaxed);
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for(std::size_t i = 1; i < threads; ++i)
+    {
+        try
+        {
+            pool.emplace_back(work);
+        }
+        catch(std::system_error const&)
+        {
+            // the threads which
+            // started do the work
+            break;
+        }
+    }
+    work();
+    for(auto& t : pool)
+        t.join();
+    if(ep)
+        std::rethrow_exception(ep);
+#endif
+}
+
+} // urls
+} // boost
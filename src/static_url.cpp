@@ -70,6 +70,13 @@ cleanup(op_t&)
 {
 }
 
+std::size_t
+static_url_base::
+max_capacity_impl() const noexcept
+{
+    return cap_;
+}
+
 } // urls
 } // boost
 
@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/stats.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <atomic>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+struct counters
+{
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> deallocations{0};
+    std::atomic<std::size_t> bytes_allocated{0};
+    std::atomic<std::size_t> reallocations{0};
+    std::atomic<std::size_t> recycled_hits{0};
+    std::atomic<std::size_t> recycled_misses{0};
+    std::atomic<std::size_t> parse_calls{0};
+    std::atomic<std::size_t> parse_errors{0};
+};
+
+counters counters_;
+
+void
+add(
+    std::atomic<std::size_t>& c,
+    std::size_t n = 1) noexcept
+{
+    c.fetch_add(n,
+        std::memory_order_relaxed);
+}
+
+std::size_t
+get(std::atomic<std::size_t> const& c) noexcept
+{
+    return c.load(
+        std::memory_order_relaxed);
+}
+
+void
+clear(std::atomic<std::size_t>& c) noexcept
+{
+    c.store(0,
+        std::memory_order_relaxed);
+}
+
+} // (anon)
+
+namespace detail {
+
+void
+stats_allocate_impl(
+    std::size_t n) noexcept
+{
+    add(counters_.allocations);
+    add(counters_.bytes_allocated, n);
+}
+
+void
+stats_deallocate_impl() noexcept
+{
+    add(counters_.deallocations);
+}
+
+void
+stats_reallocate_impl() noexcept
+{
+    add(counters_.reallocations);
+}
+
+void
+stats_recycled_impl(
+    bool hit) noexcept
+{
+    if(hit)
+        add(counters_.recycled_hits);
+    else
+        add(counters_.recycled_misses);
+}
+
+void
+stats_parse_impl(
+    bool ok) noexcept
+{
+    add(counters_.parse_calls);
+    if(! ok)
+        add(counters_.parse_errors);
+}
+
+} // detail
+
+url_stats
+get_url_stats() noexcept
+{
+    url_stats st;
+    auto const& c = counters_;
+    st.allocations = get(c.allocations);
+    st.deallocations = get(c.deallocations);
+    st.bytes_allocated = get(c.bytes_allocated);
+    st.reallocations = get(c.reallocations);
+    st.recycled_hits = get(c.recycled_hits);
+    st.recycled_misses = get(c.recycled_misses);
+    st.parse_calls = get(c.parse_calls);
+    st.parse_errors = get(c.parse_errors);
+    return st;
+}
+
+void
+reset_url_stats() noexcept
+{
+    auto& c = counters_;
+    clear(c.allocations);
+    clear(c.deallocations);
+    clear(c.bytes_allocated);
+    clear(c.reallocations);
+    clear(c.recycled_hits);
+    clear(c.recycled_misses);
+    clear(c.parse_calls);
+    clear(c.parse_errors);
+}
+
+} // urls
+} // boost
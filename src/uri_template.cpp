@@ -0,0 +1,714 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/uri_template.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/rfc/gen_delim_chars.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// the values of the operators
+// are encoded with one of these
+constexpr grammar::lut_chars
+    unreserved_lut = unreserved_chars;
+
+constexpr grammar::lut_chars
+    reserved_lut = unreserved_chars +
+        gen_delim_chars + sub_delim_chars;
+
+constexpr grammar::lut_chars
+    varchar_lut = grammar::alnum_chars +
+        grammar::lut_chars('_');
+
+// the expansion rules of
+// an operator, rfc6570 appendix A
+struct op_info
+{
+    char op;
+    char first;
+    char sep;
+    bool named;
+    bool ifemp;
+    bool reserved;
+};
+
+// 0 is for literals
+constexpr op_info ops[] = {
+    {   0,   0,   0, false, false, true  },
+    {   0,   0, ',', false, false, false },
+    { '+',   0, ',', false, false, true  },
+    { '#', '#', ',', false, false, true  },
+    { '.', '.', '.', false, false, false },
+    { '/', '/', '/', false, false, false },
+    { ';', ';', ';', true,  false, false },
+    { '?', '?', '&', true,  true,  false },
+    { '&', '&', '&', true,  true,  false },
+};
+
+// the characters an expansion
+// of each operator can have
+constexpr grammar::lut_chars expr_luts[] = {
+    reserved_lut,
+    unreserved_lut + ",%",
+    reserved_lut + '%',
+    reserved_lut + '%',
+    unreserved_lut + ",%",
+    unreserved_lut + "/,%",
+    unreserved_lut + ";=,%",
+    unreserved_lut + "?&=,%",
+    unreserved_lut + "&=,%",
+};
+
+bool
+is_pct_encoded(
+    char const* it,
+    char const* end) noexcept
+{
+    return
+        end - it >= 3 &&
+        it[0] == '%' &&
+        grammar::hexdig_chars(it[1]) &&
+        grammar::hexdig_chars(it[2]);
+}
+
+// return the size of s encoded
+std::size_t
+measure_value(
+    core::string_view s,
+    bool reserved) noexcept
+{
+    auto const& cs = reserved
+        ? reserved_lut : unreserved_lut;
+    std::size_t n = 0;
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        if(cs(*it))
+        {
+            ++n;
+            ++it;
+            continue;
+        }
+        if( reserved &&
+            is_pct_encoded(it, end))
+            it += 3;
+        else
+            ++it;
+        n += 3;
+    }
+    return n;
+}
+
+// write s encoded, escaping the
+// characters which are not allowed
+char*
+encode_value(
+    char* dest,
+    core::string_view s,
+    bool reserved) noexcept
+{
+    auto const& cs = reserved
+        ? reserved_lut : unreserved_lut;
+    char const* const hex =
+        detail::hexdigs[0];
+    auto it = s.data();
+    auto const end = it + s.size();
+    while(it != end)
+    {
+        auto it1 = grammar::find_if_not(
+            it, end, cs);
+        std::memcpy(dest, it, it1 - it);
+        dest += it1 - it;
+        it = it1;
+        if(it == end)
+            break;
+        if( reserved &&
+            is_pct_encoded(it, end))
+        {
+            std::memcpy(dest, it, 3);
+            dest += 3;
+            it += 3;
+            continue;
+        }
+        auto const c = static_cast<
+            unsigned char>(*it++);
+        *dest++ = '%';
+        *dest++ = hex[c >> 4];
+        *dest++ = hex[c & 0xf];
+    }
+    return dest;
+}
+
+// return the first n characters of
+// s, without splitting a UTF-8 code
+// point
+core::string_view
+prefix_of(
+    core::string_view s,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for(; i < s.size(); ++i)
+    {
+        // not a continuation byte
+        if((static_cast<unsigned char>(
+            s[i]) & 0xC0) != 0x80)
+        {
+            if(n == 0)
+                break;
+            --n;
+        }
+    }
+    return s.substr(0, i);
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+// measures the expansion when dest
+// is null, or writes it to dest
+class uri_template::expander
+{
+    uri_template const& t_;
+    vars_ref vars_;
+    char* dest_;
+    std::size_t n_ = 0;
+
+    void
+    put(char c) noexcept
+    {
+        if(dest_)
+            dest_[n_] = c;
+        ++n_;
+    }
+
+    void
+    put(core::string_view s) noexcept
+    {
+        if(dest_)
+            std::memcpy(
+                dest_ + n_, s.data(), s.size());
+        n_ += s.size();
+    }
+
+    void
+    put_encoded(
+        core::string_view s,
+        bool reserved) noexcept
+    {
+        if(! dest_)
+        {
+            n_ += measure_value(s, reserved);
+            return;
+        }
+        n_ = encode_value(
+            dest_ + n_, s, reserved) - dest_;
+    }
+
+    // name=value, or name and
+    // ifemp when value is empty
+    void
+    put_named(
+        core::string_view name,
+        core::string_view value,
+        op_info const& op,
+        bool encode_name)
+    {
+        if(encode_name)
+            put_encoded(name, op.reserved);
+        else
+            put(name);
+        if(value.empty())
+        {
+            if(op.ifemp)
+                put('=');
+            return;
+        }
+        put('=');
+        put_encoded(value, op.reserved);
+    }
+
+    void
+    expand(piece const& pc)
+    {
+        auto const& op = ops[pc.op];
+        bool first = true;
+        for(auto i = pc.first; i != pc.last; ++i)
+        {
+            auto const& vs = t_.vars_[i];
+            core::string_view const name(
+                t_.s_.data() + vs.pos, vs.size);
+            auto const v = vars_.get(vars_.p, name);
+            auto const k = v.kind();
+            if(k == template_value::undefined)
+                continue;
+            if(first)
+            {
+                if(op.first)
+                    put(op.first);
+                first = false;
+            }
+            else
+            {
+                put(op.sep);
+            }
+
+            if(k == template_value::string)
+            {
+                auto s = v.str();
+                if(vs.prefix)
+                    s = prefix_of(s, vs.prefix);
+                if(op.named)
+                    put_named(name, s, op, false);
+                else
+                    put_encoded(s, op.reserved);
+                continue;
+            }
+
+            if(! vs.explode)
+            {
+                // name=a,b,c or name=k1,v1,k2,v2
+                if(op.named)
+                {
+                    put(name);
+                    put('=');
+                }
+                for(std::size_t j = 0; j < v.size(); ++j)
+                {
+                    if(j > 0)
+                        put(',');
+                    put_encoded(v.at(j), op.reserved);
+                    if(k == template_value::map)
+                    {
+                        put(',');
+                        put_encoded(
+                            v.value_at(j), op.reserved);
+                    }
+                }
+                continue;
+            }
+
+            // one element per separator
+            for(std::size_t j = 0; j < v.size(); ++j)
+            {
+                if(j > 0)
+                    put(op.sep);
+                if(k == template_value::map)
+                {
+                    if(op.named)
+                    {
+                        put_named(v.at(j),
+                            v.value_at(j), op, true);
+                    }
+                    else
+                    {
+                        put_encoded(v.at(j), op.reserved);
+                        put('=');
+                        put_encoded(
+                            v.value_at(j), op.reserved);
+                    }
+                }
+                else if(op.named)
+                {
+                    put_named(name,
+                        v.at(j), op, false);
+                }
+                else
+                {
+                    put_encoded(v.at(j), op.reserved);
+                }
+            }
+        }
+    }
+
+public:
+    expander(
+        uri_template const& t,
+        vars_ref vars,
+        char* dest) noexcept
+        : t_(t)
+        , vars_(vars)
+        , dest_(dest)
+    {
+    }
+
+    std::size_t
+    run()
+    {
+        for(auto const& pc : t_.v_)
+        {
+            if(pc.op != 0)
+            {
+                expand(pc);
+                continue;
+            }
+            put(core::string_view(
+                t_.lit_.data() + pc.epos, pc.n));
+        }
+        return n_;
+    }
+};
+
+//------------------------------------------------
+
+uri_template::
+uri_template(
+    core::string_view s)
+    : s_(s)
+{
+    auto const invalid = []
+    {
+        detail::throw_system_error(
+            BOOST_URL_ERR(grammar::error::invalid));
+    };
+    char const* const first = s_.data();
+    char const* it = first;
+    char const* const end = first + s_.size();
+    while(it != end)
+    {
+        // literals
+        auto it1 = it;
+        while(
+            it1 != end &&
+            *it1 != '{')
+        {
+            if(*it1 == '}')
+                invalid();
+            ++it1;
+        }
+        if(it1 != it)
+        {
+            piece pc;
+            pc.pos = it - first;
+            pc.size = it1 - it;
+            core::string_view const lit(
+                it, pc.size);
+            pc.epos = lit_.size();
+            pc.n = measure_value(lit, true);
+            lit_.resize(pc.epos + pc.n);
+            encode_value(
+                &lit_[pc.epos], lit, true);
+            v_.push_back(pc);
+        }
+        if(it1 == end)
+            break;
+
+        // "{" [ operator ] variable-list "}"
+        it = it1 + 1;
+        piece pc;
+        pc.op = 1;
+        if(it != end)
+        {
+            for(unsigned char i = 2;
+                i < sizeof(ops) / sizeof(ops[0]); ++i)
+            {
+                if(*it == ops[i].op)
+                {
+                    pc.op = i;
+                    ++it;
+                    break;
+                }
+            }
+        }
+        pc.first = vars_.size();
+        for(;;)
+        {
+            // varname
+            varspec vs;
+            vs.pos = it - first;
+            for(;;)
+            {
+                if(it == end)
+                    invalid();
+                if(varchar_lut(*it))
+                    ++it;
+                else if(is_pct_encoded(it, end))
+                    it += 3;
+                else
+                    invalid();
+                if( it != end &&
+                    *it == '.')
+                    ++it;
+                else if(
+                    it == end ||
+                    ! ( varchar_lut(*it) ||
+                        *it == '%'))
+                    break;
+            }
+            vs.size = (it - first) - vs.pos;
+
+            // [ modifier-level4 ]
+            if(it != end && *it == '*')
+            {
+                vs.explode = true;
+                ++it;
+            }
+            else if(it != end && *it == ':')
+            {
+                // %x31-39 0*3DIGIT
+                ++it;
+                if( it == end ||
+                    *it < '1' || *it > '9')
+                    invalid();
+                auto const it0 = it;
+                while(
+                    it != end &&
+                    it - it0 < 4 &&
+                    grammar::digit_chars(*it))
+                {
+                    vs.prefix = 10 * vs.prefix +
+                        (*it - '0');
+                    ++it;
+                }
+            }
+            vars_.push_back(vs);
+
+            if(it == end)
+                invalid();
+            if(*it == '}')
+                break;
+            if(*it != ',')
+                invalid();
+            ++it;
+        }
+        pc.last = vars_.size();
+        v_.push_back(pc);
+        ++it;
+    }
+}
+
+void
+uri_template::
+vexpand_to(
+    url_base& u,
+    vars_ref vars) const
+{
+    auto const n = expander(
+        *this, vars, nullptr).run();
+    if(n == 0)
+    {
+        u.clear();
+        return;
+    }
+    {
+        url_base::op_t op(u);
+        u.reserve_impl(n, op);
+    }
+    // until the expansion is parsed,
+    // the url is kept empty and valid
+    u.clear();
+    try
+    {
+        auto const n1 = expander(
+            *this, vars, u.s_).run();
+        BOOST_ASSERT(n1 == n);
+        (void)n1;
+    }
+    catch(...)
+    {
+        u.s_[0] = '\0';
+        throw;
+    }
+    auto rv = parse_uri_reference(
+        core::string_view(u.s_, n));
+    if(! rv)
+    {
+        u.s_[0] = '\0';
+        detail::throw_system_error(rv.error());
+    }
+    u.impl_ = rv->impl_;
+    u.impl_.cs_ = u.s_;
+    u.impl_.from_ =
+        detail::parts_base::from::url;
+    u.s_[n] = '\0';
+}
+
+bool
+uri_template::
+match(
+    core::string_view s,
+    matches_base& m) const noexcept
+{
+    auto const values = m.matches();
+    auto const ids = m.ids();
+    auto const cap = m.capacity();
+    std::size_t k = 0;
+    auto const put = [&](
+        std::size_t i,
+        char const* first,
+        char const* last)
+    {
+        if(k == cap)
+            return false;
+        auto const& vs = vars_[i];
+        ids[k] = core::string_view(
+            s_.data() + vs.pos, vs.size);
+        values[k] = core::string_view(
+            first, last - first);
+        ++k;
+        return true;
+    };
+    auto const fail = [&m]
+    {
+        m.resize(0);
+        return false;
+    };
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    for(std::size_t j = 0; j < v_.size(); ++j)
+    {
+        auto const& pc = v_[j];
+        if(pc.op == 0)
+        {
+            if( static_cast<std::size_t>(
+                    end - it) < pc.n ||
+                std::memcmp(it, lit_.data() +
+                    pc.epos, pc.n) != 0)
+                return fail();
+            it += pc.n;
+            continue;
+        }
+
+        // the end of the expression
+        auto last = grammar::find_if_not(
+            it, end, expr_luts[pc.op]);
+        if( j + 1 < v_.size() &&
+            v_[j + 1].op == 0)
+        {
+            auto const& lit = v_[j + 1];
+            auto const n = (std::min)(
+                static_cast<std::size_t>(
+                    end - it),
+                static_cast<std::size_t>(
+                    last - it) + lit.n);
+            auto const pos =
+                core::string_view(it, n).find(
+                    core::string_view(lit_.data() +
+                        lit.epos, lit.n));
+            if(pos != core::string_view::npos)
+                last = it + pos;
+        }
+        if(it == last)
+            continue;
+
+        auto const& op = ops[pc.op];
+        if(op.first)
+        {
+            // all the variables
+            // are undefined
+            if(*it != op.first)
+                continue;
+            ++it;
+        }
+        if(! op.named)
+        {
+            auto i = pc.first;
+            for(;;)
+            {
+                auto const& vs = vars_[i];
+                auto const it1 =
+                    (vs.explode || i + 1 != pc.last)
+                    ? std::find(it, last, op.sep)
+                    : last;
+                if(! put(i, it, it1))
+                    return fail();
+                it = it1;
+                if(it == last)
+                    break;
+                ++it;
+                if(! vs.explode)
+                    ++i;
+                BOOST_ASSERT(i != pc.last);
+            }
+            continue;
+        }
+
+        // name=value pairs
+        auto ex = pc.first;
+        while( ex != pc.last &&
+              ! vars_[ex].explode)
+            ++ex;
+        auto start = it - 1;
+        for(;;)
+        {
+            auto const it1 =
+                std::find(it, last, op.sep);
+            auto const eq =
+                std::find(it, it1, '=');
+            core::string_view const name(
+                it, eq - it);
+            auto i = pc.first;
+            while( i != pc.last &&
+                core::string_view(
+                    s_.data() + vars_[i].pos,
+                    vars_[i].size) != name)
+                ++i;
+            if(i != pc.last)
+            {
+                if(! put(i, (eq == it1)
+                        ? eq : eq + 1, it1))
+                    return fail();
+            }
+            else if(ex != pc.last)
+            {
+                if(! put(ex, it, it1))
+                    return fail();
+            }
+            else
+            {
+                // the pair is left
+                // to what follows
+                it = start;
+                break;
+            }
+            it = it1;
+            if(it == last)
+                break;
+            start = it++;
+        }
+    }
+    if(it != end)
+        return fail();
+    m.resize(k);
+    return true;
+}
+
+std::string
+uri_template::
+vexpand_string(
+    vars_ref vars) const
+{
+    std::string s(expander(
+        *this, vars, nullptr).run(), '\0');
+    if(! s.empty())
+        expander(*this, vars, &s[0]).run();
+    return s;
+}
+
+} // urls
+} // boost
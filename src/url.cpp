@@ -14,6 +14,8 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/detail/stats.hpp>
+#include "detail/trace.hpp"
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -77,6 +79,7 @@ allocate(std::size_t n)
 {
     auto s = new char[n + 1];
     cap_ = n;
+    detail::stats_allocate(n + 1);
     return s;
 }
 
@@ -84,6 +87,7 @@ void
 url::
 deallocate(char* s)
 {
+    detail::stats_deallocate();
     delete[] s;
 }
 
@@ -127,6 +131,9 @@ reserve_impl(
         if( new_cap < n)
             new_cap = n;
         s = allocate(new_cap);
+        detail::stats_reallocate();
+        BOOST_URL_TRACE2(reallocate,
+            cap_, new_cap);
         std::memcpy(s, s_, size() + 1);
         BOOST_ASSERT(! op.old);
         op.old = s_;
@@ -18,14 +18,18 @@
 #include <boost/url/host_type.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/url_view.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/param_key_set.hpp>
 #include <boost/url/detail/any_params_iter.hpp>
 #include <boost/url/detail/any_segments_iter.hpp>
 #include "detail/decode.hpp"
 #include <boost/url/detail/encode.hpp>
 #include <boost/url/detail/except.hpp>
 #include "detail/normalize.hpp"
+#include "detail/parse_options.hpp"
 #include "detail/path.hpp"
 #include "detail/print.hpp"
+#include "detail/trace.hpp"
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
 #include <boost/url/rfc/query_rule.hpp>
@@ -38,10 +42,12 @@
 #include "rfc/detail/userinfo_rule.hpp"
 #include <boost/url/grammar/parse.hpp>
 #include "detail/move_chars.hpp"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace boost {
 namespace urls {
@@ -176,10 +182,14 @@ remove_scheme()
         return *this;
     auto const po = impl_.offset(id_path);
     auto fseg = first_segment();
+    // a "./" prefix already keeps the
+    // first segment from looking like
+    // a scheme
     bool const encode_colon =
         !has_authority() &&
         impl_.nseg_ > 0 &&
         s_[po] != '/' &&
+        !impl_.get(id_path).starts_with("./") &&
         fseg.contains(':');
     if(!encode_colon)
     {
@@ -814,6 +824,7 @@ set_host_ipv4(
     std::memcpy(dest, s.data(), s.size());
     impl_.decoded_[id_host] = impl_.len(id_host);
     impl_.host_type_ = urls::host_type::ipv4;
+    impl_.host_norm_ = true;
     auto bytes = addr.to_bytes();
     std::memcpy(
         impl_.ip_addr_,
@@ -1002,6 +1013,240 @@ remove_origin()
     return *this;
 }
 
+//------------------------------------------------
+//
+// Capacity-checked setters
+//
+//------------------------------------------------
+
+system::result<void>
+url_base::
+try_set_scheme(
+    core::string_view s)
+{
+    auto rv = grammar::parse(
+        s, detail::scheme_rule());
+    if(! rv)
+        return rv.error();
+    auto const n = s.size();
+    if(has_dot_prefix())
+    {
+        // the "./" is removed after
+        // reserving for the scheme
+        if(! fits(size() + n + 1 - 2))
+            BOOST_URL_RETURN_EC(
+                error::no_space);
+    }
+    else
+    {
+        if(! fits(size() -
+                impl_.len(id_scheme) + n + 1))
+            BOOST_URL_RETURN_EC(
+                error::no_space);
+    }
+    set_scheme(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_encoded_host(
+    pct_string_view s)
+{
+    // same cases as set_encoded_host
+    std::size_t n = 0;
+    bool found = false;
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        auto rv = parse_ipv6_address(
+            s.substr(1, s.size() - 2));
+        if(rv)
+        {
+            char buf[urls::ipv6_address::max_str_len];
+            n = rv->to_buffer(
+                buf, sizeof(buf)).size() + 2;
+            found = true;
+        }
+        else if(grammar::parse(
+            s.substr(1, s.size() - 2),
+                detail::ipvfuture_rule))
+        {
+            n = s.size();
+            found = true;
+        }
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        auto rv = parse_ipv4_address(s);
+        if(rv)
+        {
+            char buf[urls::ipv4_address::max_str_len];
+            n = rv->to_buffer(
+                buf, sizeof(buf)).size();
+            found = true;
+        }
+    }
+    if(! found)
+    {
+        encoding_opts opt;
+        n = detail::re_encoded_size_unsafe(
+            s, detail::host_chars, opt);
+    }
+    if(! fits(host_size(n)))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_encoded_host(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_port_number(
+    std::uint16_t n)
+{
+    auto s = detail::make_printed(n);
+    if(! fits(port_size(s.string().size())))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_port_number(n);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_encoded_path(
+    pct_string_view s)
+{
+    // same measure as set_encoded_path
+    encoding_opts opt;
+    auto n = detail::re_encoded_size_unsafe(
+        s, detail::path_chars, opt);
+    if (!has_scheme() &&
+        !has_authority() &&
+        !s.starts_with('/'))
+    {
+        core::string_view first_seg =
+            detail::to_sv(s);
+        std::size_t p = s.find('/');
+        if (p != core::string_view::npos)
+            first_seg = s.substr(0, p);
+        n += 2 * std::count(
+            first_seg.begin(), first_seg.end(), ':');
+    }
+    bool const make_absolute =
+        has_authority() &&
+        !s.starts_with('/') &&
+        !s.empty();
+    bool const add_dot_segment =
+        !make_absolute &&
+        !has_authority() &&
+        s.starts_with("//");
+    n += make_absolute + 2 * add_dot_segment;
+    if(! fits(size() - impl_.len(id_path) + n))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_encoded_path(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_query(
+    core::string_view s)
+{
+    detail::query_iter it(s, true);
+    std::size_t n = 0;
+    // one '?' or '&' for each param
+    auto const nparam = it.measure_all(n);
+    n += nparam;
+    if(! fits(size() - impl_.len(id_query) + n))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_query(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_encoded_query(
+    pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n = detail::re_encoded_size_unsafe(
+        s, detail::query_chars, opt);
+    if(! fits(size() - impl_.len(id_query) + n + 1))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_encoded_query(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_fragment(
+    core::string_view s)
+{
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::fragment_chars, opt);
+    if(! fits(size() - impl_.len(id_frag) + n + 1))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_fragment(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_set_encoded_fragment(
+    pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n = detail::re_encoded_size_unsafe(
+        s, detail::fragment_chars, opt);
+    if(! fits(size() - impl_.len(id_frag) + n + 1))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    set_encoded_fragment(s);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_append_param(
+    param_view const& p)
+{
+    detail::param_iter it(p);
+    std::size_t n = 0;
+    // one '?' or '&' for the param
+    auto const nparam = it.measure_all(n);
+    n += nparam;
+    if(! fits(size() + n))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    params().append(p);
+    return {};
+}
+
+system::result<void>
+url_base::
+try_append_encoded_param(
+    param_pct_view const& p)
+{
+    detail::param_encoded_iter it(p);
+    std::size_t n = 0;
+    // one '?' or '&' for the param
+    auto const nparam = it.measure_all(n);
+    n += nparam;
+    if(! fits(size() + n))
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    encoded_params().append(p);
+    return {};
+}
+
 //------------------------------------------------
 //
 // Path
@@ -1670,34 +1915,47 @@ normalize_octets_impl(
 {
     char* it = s_ + impl_.offset(id);
     char* end = s_ + impl_.offset(id + 1);
-    char d = 0;
-    char* dest = it;
-    while (it < end)
+
+    // uppercase the escapes in place,
+    // a normalized component is only read
+    detail::upper_escapes(it, end);
+
+    // find the first escape to decode
+    for(;;)
     {
-        if (*it != '%')
-        {
-            *dest = *it;
-            ++it;
-            ++dest;
-            continue;
-        }
+        it += detail::find_escape(
+            it, end, false) - it;
+        if(it == end)
+            return;
         BOOST_ASSERT(end - it >= 3);
+        if(allowed(detail::decode_one(it + 1)))
+            break;
+        it += 3;
+    }
 
-        // decode unreserved octets
-        d = detail::decode_one(it + 1);
+    // compact the runs between escapes
+    char* dest = it;
+    while (it != end)
+    {
+        BOOST_ASSERT(end - it >= 3);
+        char const d = detail::decode_one(it + 1);
         if (allowed(d))
         {
-            *dest = d;
+            // decode unreserved octets
+            *dest++ = d;
             it += 3;
-            ++dest;
-            continue;
         }
-
-        // uppercase percent-encoding triplets
-        *dest++ = '%';
-        ++it;
-        *dest++ = grammar::to_upper(*it++);
-        *dest++ = grammar::to_upper(*it++);
+        else
+        {
+            std::memmove(dest, it, 3);
+            dest += 3;
+            it += 3;
+        }
+        char* const p = it + (detail::find_escape(
+            it, end, false) - it);
+        std::memmove(dest, it, p - it);
+        dest += p - it;
+        it = p;
     }
     if (it != dest)
     {
@@ -1723,13 +1981,19 @@ normalize_authority()
     op_t op(*this);
 
     // normalize host
-    if (host_type() == urls::host_type::name)
+    if(! impl_.host_norm_)
     {
-        normalize_octets_impl(
-            id_host,
-            detail::reg_name_chars, op);
+        if (host_type() == urls::host_type::name)
+        {
+            normalize_octets_impl(
+                id_host,
+                detail::reg_name_chars, op);
+        }
+        decoded_to_lower_impl(id_host);
+        impl_.host_norm_ =
+            impl_.decoded_[id_host] ==
+                impl_.len(id_host);
     }
-    decoded_to_lower_impl(id_host);
 
     // normalize password
     normalize_octets_impl(id_pass, detail::password_chars, op);
@@ -1893,8 +2157,9 @@ normalize_path()
         if (p == "/")
             impl_.nseg_ = 0;
         else if (!p.empty())
-            impl_.nseg_ = std::count(
-                p.begin() + 1, p.end(), '/') + 1;
+            impl_.nseg_ = detail::path_segments(p,
+                std::count(
+                    p.begin() + 1, p.end(), '/') + 1);
         else
             impl_.nseg_ = 0;
         impl_.decoded_[id_path] =
@@ -1927,14 +2192,27 @@ url_base&
 url_base::
 normalize()
 {
+    BOOST_URL_TRACE1(normalize_entry, size());
     normalize_fragment();
     normalize_query();
     normalize_path();
     normalize_authority();
     normalize_scheme();
+    BOOST_URL_TRACE1(normalize_return, size());
     return *this;
 }
 
+system::result<void>
+url_base::
+normalize(parse_options const& opt)
+{
+    auto rv = detail::check_limits(*this, opt);
+    if(! rv)
+        return rv;
+    normalize();
+    return {};
+}
+
 //------------------------------------------------
 //
 // Implementation
@@ -2004,9 +2282,15 @@ resize_impl(
     auto const n0 = impl_.len(first, last);
     if(new_len == 0 && n0 == 0)
         return s_ + impl_.offset(first);
+    BOOST_URL_TRACE2(resize_entry,
+        size(), size() - n0 + new_len);
     if(new_len <= n0)
-        return shrink_impl(
+    {
+        auto const p = shrink_impl(
             first, last, new_len, op);
+        BOOST_URL_TRACE1(resize_return, size());
+        return p;
+    }
 
     // growing
     std::size_t n = new_len - n0;
@@ -2025,6 +2309,7 @@ resize_impl(
     // shift (last, end) right
     impl_.adjust_right(last, id_end, n);
     s_[size()] = '\0';
+    BOOST_URL_TRACE1(resize_return, size());
     return s_ + impl_.offset(first);
 }
 
@@ -2084,24 +2369,8 @@ set_scheme_impl(
     auto const n = s.size();
     auto const p = impl_.offset(id_path);
 
-    // check for "./" prefix
-    bool const has_dot =
-        [this, p]
-    {
-        if(impl_.nseg_ == 0)
-            return false;
-        if(first_segment().size() < 2)
-            return false;
-        auto const src = s_ + p;
-        if(src[0] != '.')
-            return false;
-        if(src[1] != '/')
-            return false;
-        return true;
-    }();
-
     // Remove "./"
-    if(has_dot)
+    if(has_dot_prefix())
     {
         // do this first, for
         // strong exception safety
@@ -2238,6 +2507,7 @@ set_host_impl(
     op_t& op)
 {
     check_invariants();
+    impl_.host_norm_ = false;
     if(impl_.len(id_user) == 0)
     {
         // add authority
@@ -2319,6 +2589,70 @@ set_path_impl(
 }
 
 
+std::size_t
+url_base::
+max_capacity_impl() const noexcept
+{
+    return max_size();
+}
+
+bool
+url_base::
+fits(std::size_t n) const noexcept
+{
+    return n <= max_capacity_impl();
+}
+
+// true if the path has a "./" prefix,
+// which protects a first segment with
+// colons when there is no scheme
+bool
+url_base::
+has_dot_prefix() const noexcept
+{
+    if(impl_.nseg_ == 0)
+        return false;
+    if(first_segment().size() < 2)
+        return false;
+    auto const src = impl_.cs_ +
+        impl_.offset(id_path);
+    if(src[0] != '.')
+        return false;
+    if(src[1] != '/')
+        return false;
+    return true;
+}
+
+// size of the url after
+// set_host_impl(n)
+std::size_t
+url_base::
+host_size(std::size_t n) const noexcept
+{
+    if(impl_.len(id_user) != 0)
+        return size() -
+            impl_.len(id_host) + n;
+    bool const make_absolute =
+        !is_path_absolute() &&
+        impl_.len(id_path) != 0;
+    return size() + n + 2 + make_absolute;
+}
+
+// size of the url after
+// set_port_impl(n)
+std::size_t
+url_base::
+port_size(std::size_t n) const noexcept
+{
+    if(impl_.len(id_user) != 0)
+        return size() -
+            impl_.len(id_port) + n + 1;
+    bool const make_absolute =
+        !is_path_absolute() &&
+        impl_.len(id_path) != 0;
+    return size() + 3 + n + make_absolute;
+}
+
 //------------------------------------------------
 
 // return the first segment of the path.
@@ -2504,18 +2838,9 @@ edit_segments(
 //  segments including internal separators.
 //
     src.encode_colons = encode_colons;
-    std::size_t nseg = 0;
-    if(src.measure(nchar))
-    {
-        src.encode_colons = false;
-        for(;;)
-        {
-            ++nseg;
-            if(! src.measure(nchar))
-                break;
-            ++nchar;
-        }
-    }
+    std::size_t nseg = src.measure_all(nchar);
+    if(nseg > 1)
+        nchar += nseg - 1; // for '/'
 
     switch(src.fast_nseg)
     {
@@ -2635,14 +2960,7 @@ edit_segments(
     if(nseg > 0)
     {
         src.encode_colons = encode_colons;
-        for(;;)
-        {
-            src.copy(dest, end);
-            if(--nseg == 0)
-                break;
-            *dest++ = '/';
-            src.encode_colons = false;
-        }
+        src.copy_all(dest, end, nseg);
         if(suffix)
             *dest++ = '/';
     }
@@ -2706,18 +3024,10 @@ edit_params(
 //
 
     std::size_t nchar = 0;
-    std::size_t nparam = 0;
-    if(src.measure(nchar))
-    {
-        ++nchar; // for '?' or '&'
-        for(;;)
-        {
-            ++nparam;
-            if(! src.measure(nchar))
-                break;
-            ++nchar; // for '&'
-        }
-    }
+    std::size_t const nparam =
+        src.measure_all(nchar);
+    // for '?' or '&' before each param
+    nchar += nparam;
 
 //------------------------------------------------
 //
@@ -2781,13 +3091,8 @@ edit_params(
         else
             *dest++ = '&';
         src.rewind();
-        for(;;)
-        {
-            src.copy(dest, end);
-            if(--nparam == 0)
-                break;
-            *dest++ = '&';
-        }
+        src.copy_all(dest, end);
+        BOOST_ASSERT(dest == end);
     }
 
     // calc decoded size of new range,
@@ -2807,23 +3112,164 @@ edit_params(
 
 //------------------------------------------------
 
-void
+// Remove the params whose key is in
+// keys, moving the characters of the
+// ones which are kept at most once
+std::size_t
 url_base::
-decoded_to_lower_impl(int id) noexcept
+erase_params(
+    param_key_set const& keys) noexcept
 {
-    char* it = s_ + impl_.offset(id);
-    char const* const end = s_ + impl_.offset(id + 1);
-    while(it < end)
-    {
-        if (*it != '%')
+    if( impl_.len(id_query) == 0 ||
+        keys.empty())
+        return 0;
+    op_t op(*this);
+    char* const first =
+        s_ + impl_.offset(id_query);
+    char const* it = first + 1;
+    char const* const end =
+        s_ + impl_.offset(id_frag);
+    char* dest = first;
+    std::size_t nkept = 0;
+    std::size_t nerased = 0;
+    // escapes in the erased params
+    std::size_t npct = 0;
+    for(;;)
+    {
+        char const* amp = static_cast<
+            char const*>(std::memchr(
+                it, '&', end - it));
+        if(! amp)
+            amp = end;
+        char const* eq = static_cast<
+            char const*>(std::memchr(
+                it, '=', amp - it));
+        core::string_view const key(
+            it, (eq ? eq : amp) - it);
+        if(keys.match_encoded(
+            make_pct_string_view_unsafe(
+                key.data(), key.size(),
+                detail::decode_bytes_unsafe(key))))
         {
-            *it = grammar::to_lower(
-                *it);
-            ++it;
-            continue;
+            ++nerased;
+            npct += static_cast<std::size_t>(
+                std::count(it, amp, '%'));
         }
-        it += 3;
+        else
+        {
+            // dest is never ahead of it
+            *dest++ = nkept++ == 0 ? '?' : '&';
+            std::memmove(dest, it, amp - it);
+            dest += amp - it;
+        }
+        if(amp == end)
+            break;
+        it = amp + 1;
+    }
+    if(nerased == 0)
+        return 0;
+
+    // the escapes of the kept params
+    auto const n0 = impl_.len(id_query);
+    npct = (n0 - 1 - impl_.decoded_[id_query]) / 2 - npct;
+    auto const n = static_cast<
+        std::size_t>(dest - first);
+    shrink_impl(id_query, n, op);
+    impl_.nparam_ = nkept;
+    impl_.decoded_[id_query] =
+        n == 0 ? 0 : n - 1 - 2 * npct;
+    return nerased;
+}
+
+//------------------------------------------------
+
+// Stable sort the params by decoded key.
+// The bounds of the params are sorted,
+// then the query is copied once and
+// written back in the new order.
+void
+url_base::
+sort_params(encoding_opts opt)
+{
+    if(impl_.nparam_ < 2)
+        return;
+    struct param
+    {
+        std::size_t pos;
+        std::size_t n;
+        std::size_t nk;
+        std::size_t dk;
+    };
+    char const* const first =
+        s_ + impl_.offset(id_query) + 1;
+    char const* const end =
+        s_ + impl_.offset(id_frag);
+    std::vector<param> v;
+    v.reserve(impl_.nparam_);
+    char const* it = first;
+    for(;;)
+    {
+        char const* amp = static_cast<
+            char const*>(std::memchr(
+                it, '&', end - it));
+        if(! amp)
+            amp = end;
+        char const* eq = static_cast<
+            char const*>(std::memchr(
+                it, '=', amp - it));
+        core::string_view const key(
+            it, (eq ? eq : amp) - it);
+        v.push_back({
+            static_cast<std::size_t>(it - first),
+            static_cast<std::size_t>(amp - it),
+            key.size(),
+            detail::decode_bytes_unsafe(key) });
+        if(amp == end)
+            break;
+        it = amp + 1;
+    }
+    BOOST_ASSERT(v.size() == impl_.nparam_);
+    auto const less = [first, opt](
+        param const& p0, param const& p1)
+    {
+        return detail::make_decode_view(
+            core::string_view(
+                first + p0.pos, p0.nk),
+            p0.dk, opt).compare(
+        detail::make_decode_view(
+            core::string_view(
+                first + p1.pos, p1.nk),
+            p1.dk, opt)) < 0;
+    };
+    if(std::is_sorted(v.begin(), v.end(), less))
+        return;
+    std::stable_sort(v.begin(), v.end(), less);
+
+    // the size and the decoded
+    // size are unchanged
+    std::string const tmp(first, end);
+    char* dest = s_ + impl_.offset(id_query) + 1;
+    for(auto const& p : v)
+    {
+        if(&p != v.data())
+            *dest++ = '&';
+        std::memcpy(dest,
+            tmp.data() + p.pos, p.n);
+        dest += p.n;
     }
+    BOOST_ASSERT(dest == end);
+}
+
+//------------------------------------------------
+
+void
+url_base::
+decoded_to_lower_impl(int id) noexcept
+{
+    grammar::detail::to_lower_in_place(
+        s_ + impl_.offset(id),
+        s_ + impl_.offset(id + 1),
+        true);
 }
 
 void
@@ -2831,13 +3277,11 @@ url_base::
 to_lower_impl(int id) noexcept
 {
     char* it = s_ + impl_.offset(id);
-    char const* const end = s_ + impl_.offset(id + 1);
-    while(it < end)
-    {
-        *it = grammar::to_lower(
-            *it);
-        ++it;
-    }
+    char* const end = s_ + impl_.offset(id + 1);
+    it += grammar::detail::find_upper(
+        it, end) - it;
+    grammar::detail::to_lower_in_place(
+        it, end, false);
 }
 
 } // urls
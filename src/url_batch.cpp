@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_batch.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <limits>
+
+namespace boost {
+namespace urls {
+
+constexpr std::uint32_t url_batch::zero_;
+
+void
+url_batch::
+reserve(
+    std::size_t n,
+    std::size_t chars)
+{
+    chars_.reserve(chars);
+    pos_[scheme].reserve(n + 1);
+    for(int p = user; p < end; ++p)
+        pos_[p].reserve(n);
+    scheme_.reserve(n);
+    host_type_.reserve(n);
+    port_number_.reserve(n);
+    nseg_.reserve(n);
+    nparam_.reserve(n);
+}
+
+void
+url_batch::
+clear() noexcept
+{
+    chars_.clear();
+    for(auto& v : pos_)
+        v.clear();
+    scheme_.clear();
+    host_type_.clear();
+    port_number_.clear();
+    nseg_.clear();
+    nparam_.clear();
+}
+
+void
+url_batch::
+push_back(
+    url_view_base const& u)
+{
+    parts p;
+    compact_url_base::get(u, p);
+    auto const pos = chars_.size();
+    auto const n = p.offset[id_end];
+    if(n > (std::numeric_limits<
+        std::uint32_t>::max)() - pos)
+        detail::throw_length_error();
+    auto const i = size();
+    auto const n0 = pos_[scheme].size();
+    try
+    {
+        if(pos_[scheme].empty())
+            pos_[scheme].push_back(0);
+        chars_.append(p.cs, n);
+        pos_[scheme].push_back(
+            static_cast<std::uint32_t>(
+                pos + n));
+        for(int id = id_user; id < id_end; ++id)
+            pos_[id + 1].push_back(
+                static_cast<std::uint32_t>(
+                    pos + p.offset[id]));
+        scheme_.push_back(p.scheme);
+        host_type_.push_back(p.host_type);
+        port_number_.push_back(p.port_number);
+        nseg_.push_back(static_cast<
+            std::uint32_t>(p.nseg));
+        nparam_.push_back(static_cast<
+            std::uint32_t>(p.nparam));
+    }
+    catch(...)
+    {
+        chars_.resize(pos);
+        pos_[scheme].resize(n0);
+        for(int id = id_user; id < id_end; ++id)
+            pos_[id + 1].resize(i);
+        scheme_.resize(i);
+        host_type_.resize(i);
+        port_number_.resize(i);
+        nseg_.resize(i);
+        nparam_.resize(i);
+        throw;
+    }
+}
+
+system::result<void>
+url_batch::
+append(
+    core::string_view s)
+{
+    auto rv = parse_uri_reference(s);
+    if(! rv)
+        return rv.error();
+    push_back(*rv);
+    return {};
+}
+
+core::string_view
+url_batch::
+get(
+    part p,
+    std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < size());
+    BOOST_ASSERT(p != end);
+    auto first = positions(p)[i];
+    auto last = positions(
+        static_cast<part>(p + 1))[i];
+    if(first == last)
+        return {};
+    switch(p)
+    {
+    case scheme:
+        // ':'
+        --last;
+        break;
+    case user:
+        // "//"
+        first += 2;
+        break;
+    case password:
+        // [ ':' password ] '@'
+        if(chars_[first] == ':')
+            ++first;
+        --last;
+        break;
+    case port:
+    case query:
+    case fragment:
+        ++first;
+        break;
+    default:
+        break;
+    }
+    return slice(first, last);
+}
+
+url_view
+url_batch::
+view(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < size());
+    auto const pos = offsets()[i];
+    parts p;
+    p.cs = chars_.data() + pos;
+    for(int id = id_user; id < id_end; ++id)
+        p.offset[id] = pos_[id + 1][i] - pos;
+    p.offset[id_end] =
+        offsets()[i + 1] - pos;
+    p.nseg = nseg_[i];
+    p.nparam = nparam_[i];
+    p.port_number = port_number_[i];
+    p.host_type = host_type_[i];
+    p.scheme = scheme_[i];
+    return construct(p);
+}
+
+} // urls
+} // boost
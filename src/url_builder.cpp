@@ -0,0 +1,659 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_builder.hpp>
+#include <boost/url/encode.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/detail/ci_string.hpp>
+#include "detail/print.hpp"
+#include "rfc/detail/charsets.hpp"
+#include "rfc/detail/host_rule.hpp"
+#include "rfc/detail/ipvfuture_rule.hpp"
+#include "rfc/detail/scheme_rule.hpp"
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// a leading empty or "." segment
+// needs the "/." prefix, or the path
+// would start with "//" or "/./"
+bool
+needs_prefix(core::string_view s) noexcept
+{
+    return s.empty() || s == ".";
+}
+
+} // (anon)
+
+url_builder::
+url_builder(std::size_t capacity)
+{
+    u_.reserve(capacity);
+}
+
+// grow component id, which is the
+// last one written, by n characters
+char*
+url_builder::
+append(int id, std::size_t n)
+{
+    BOOST_ASSERT(n > 0);
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    auto const pos = impl.offset(id_end);
+    BOOST_ASSERT(impl.offset(id + 1) == pos);
+    {
+        url_base::op_t op(u);
+        u.reserve_impl(pos + n, op);
+    }
+    impl.set_size(id, impl.len(id) + n);
+    u.s_[pos + n] = '\0';
+    return u.s_ + pos;
+}
+
+// throw if a component after id
+// was already written, and close
+// the userinfo of a skipped host
+void
+url_builder::
+start(int id)
+{
+    if(id_ > id)
+        detail::throw_invalid_argument();
+    if( id <= id_host ||
+        id_ > id_host)
+        return;
+    url_base& u = u_;
+    if( id == id_port ||
+        u.impl_.len(id_user) != 0)
+    {
+        // empty host
+        open_authority();
+        u.impl_.host_type_ =
+            urls::host_type::name;
+    }
+}
+
+// write the "//" and the "@"
+// which precede the host
+void
+url_builder::
+open_authority()
+{
+    url_base& u = u_;
+    auto const& impl = u.impl_;
+    if(impl.len(id_user) == 0)
+    {
+        auto dest = append(id_user, 2);
+        dest[0] = '/';
+        dest[1] = '/';
+    }
+    else if(impl.len(id_pass) == 0)
+    {
+        *append(id_pass, 1) = '@';
+    }
+}
+
+void
+url_builder::
+clear() noexcept
+{
+    u_.clear();
+    id_ = id_scheme;
+}
+
+url
+url_builder::
+release() noexcept
+{
+    url u(std::move(u_));
+    id_ = id_scheme;
+    return u;
+}
+
+//------------------------------------------------
+//
+// Scheme
+//
+//------------------------------------------------
+
+url_builder&
+url_builder::
+set_scheme(core::string_view s)
+{
+    start(id_scheme);
+    grammar::parse(
+        s, detail::scheme_rule()
+            ).value(BOOST_URL_POS);
+    auto dest = append(
+        id_scheme, s.size() + 1);
+    std::memcpy(dest, s.data(), s.size());
+    dest[s.size()] = ':';
+    url_base& u = u_;
+    u.impl_.scheme_ = string_to_scheme(s);
+    id_ = id_user;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_scheme_id(urls::scheme id)
+{
+    if( id == urls::scheme::unknown ||
+        id == urls::scheme::none)
+        detail::throw_invalid_argument();
+    return set_scheme(to_string(id));
+}
+
+//------------------------------------------------
+//
+// Authority
+//
+//------------------------------------------------
+
+url_builder&
+url_builder::
+set_user(core::string_view s)
+{
+    start(id_user);
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::user_chars, opt);
+    auto dest = append(id_user, 2 + n);
+    dest[0] = '/';
+    dest[1] = '/';
+    encode_unsafe(
+        dest + 2,
+        n,
+        s,
+        detail::user_chars,
+        opt);
+    url_base& u = u_;
+    u.impl_.decoded_[id_user] = s.size();
+    id_ = id_pass;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_encoded_user(pct_string_view s)
+{
+    start(id_user);
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::user_chars, opt);
+    auto dest = append(id_user, 2 + n);
+    *dest++ = '/';
+    *dest++ = '/';
+    url_base& u = u_;
+    u.impl_.decoded_[id_user] =
+        detail::re_encode_unsafe(
+            dest,
+            dest + n,
+            s,
+            detail::user_chars,
+            opt);
+    id_ = id_pass;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_password(core::string_view s)
+{
+    start(id_pass);
+    url_base& u = u_;
+    if(u.impl_.len(id_user) == 0)
+    {
+        auto dest = append(id_user, 2);
+        dest[0] = '/';
+        dest[1] = '/';
+    }
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::password_chars, opt);
+    auto dest = append(id_pass, 2 + n);
+    dest[0] = ':';
+    encode_unsafe(
+        dest + 1,
+        n,
+        s,
+        detail::password_chars,
+        opt);
+    dest[n + 1] = '@';
+    u.impl_.decoded_[id_pass] = s.size();
+    id_ = id_host;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_encoded_password(pct_string_view s)
+{
+    start(id_pass);
+    url_base& u = u_;
+    if(u.impl_.len(id_user) == 0)
+    {
+        auto dest = append(id_user, 2);
+        dest[0] = '/';
+        dest[1] = '/';
+    }
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::password_chars, opt);
+    auto dest = append(id_pass, 2 + n);
+    *dest++ = ':';
+    u.impl_.decoded_[id_pass] =
+        detail::re_encode_unsafe(
+            dest,
+            dest + n,
+            s,
+            detail::password_chars,
+            opt);
+    *dest = '@';
+    id_ = id_host;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_host(core::string_view s)
+{
+    start(id_host);
+    open_authority();
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    auto const pos = impl.offset(id_host);
+    core::string_view lit;
+    char buf[2 + urls::ipv6_address::max_str_len];
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        auto const s1 =
+            s.substr(1, s.size() - 2);
+        auto rv = parse_ipv6_address(s1);
+        if(rv)
+        {
+            auto s2 = rv->to_buffer(
+                buf + 1, sizeof(buf) - 2);
+            buf[0] = '[';
+            buf[s2.size() + 1] = ']';
+            lit = core::string_view(
+                buf, s2.size() + 2);
+        }
+        else if(grammar::parse(
+            s1, detail::ipvfuture_rule))
+        {
+            lit = s;
+        }
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        auto rv = parse_ipv4_address(s);
+        if(rv)
+            lit = rv->to_buffer(
+                buf, sizeof(buf));
+    }
+    if(! lit.empty())
+    {
+        std::memcpy(append(
+            id_host, lit.size()),
+                lit.data(), lit.size());
+    }
+    else
+    {
+        // reg-name
+        encoding_opts opt;
+        auto const n = encoded_size(
+            s, detail::host_chars, opt);
+        if(n > 0)
+            encode_unsafe(
+                append(id_host, n),
+                n,
+                s,
+                detail::host_chars,
+                opt);
+    }
+
+    // the host written is parsed
+    // to find its type and address
+    char const* it = u.s_ + pos;
+    auto rv = grammar::parse(
+        it, u.s_ + impl.offset(id_port),
+        detail::host_rule);
+    BOOST_ASSERT(rv.has_value());
+    BOOST_ASSERT(it == u.s_ + impl.offset(id_port));
+    impl.host_type_ = rv->host_type;
+    impl.decoded_[id_host] =
+        rv->host_type == urls::host_type::name
+        ? rv->name.decoded_size()
+        : rv->match.size();
+    impl.host_norm_ =
+        impl.decoded_[id_host] == impl.len(id_host) &&
+        grammar::detail::find_upper(
+            rv->match.data(), rv->match.data() +
+                rv->match.size()) ==
+            rv->match.data() + rv->match.size();
+    std::memcpy(
+        impl.ip_addr_,
+        rv->addr,
+        sizeof(impl.ip_addr_));
+    id_ = id_port;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_encoded_host(pct_string_view s)
+{
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        return set_host(s);
+    }
+    if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        if(parse_ipv4_address(s))
+            return set_host(s);
+    }
+
+    // reg-name
+    start(id_host);
+    open_authority();
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::host_chars, opt);
+    std::size_t dn = 0;
+    if(n > 0)
+    {
+        auto dest = append(id_host, n);
+        dn = detail::re_encode_unsafe(
+            dest,
+            dest + n,
+            s,
+            detail::host_chars,
+            opt);
+    }
+    BOOST_ASSERT(dn == s.decoded_size());
+    impl.host_type_ = urls::host_type::name;
+    impl.decoded_[id_host] = dn;
+    auto const h = impl.get(id_host);
+    impl.host_norm_ =
+        dn == h.size() &&
+        grammar::detail::find_upper(
+            h.data(), h.data() + h.size()) ==
+                h.data() + h.size();
+    std::memset(
+        impl.ip_addr_, 0,
+        sizeof(impl.ip_addr_));
+    id_ = id_port;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_port_number(std::uint16_t n)
+{
+    start(id_port);
+    auto s = detail::make_printed(n);
+    auto dest = append(
+        id_port, 1 + s.string().size());
+    dest[0] = ':';
+    std::memcpy(
+        dest + 1,
+        s.string().data(),
+        s.string().size());
+    url_base& u = u_;
+    u.impl_.port_number_ = n;
+    id_ = id_path;
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Path
+//
+//------------------------------------------------
+
+url_builder&
+url_builder::
+append_segment(core::string_view s)
+{
+    start(id_path);
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    std::size_t const prefix =
+        ( impl.len(id_path) == 0 &&
+            needs_prefix(s) ) ? 2 : 0;
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::segment_chars, opt);
+    auto dest = append(
+        id_path, prefix + 1 + n);
+    if(prefix)
+    {
+        *dest++ = '/';
+        *dest++ = '.';
+    }
+    *dest++ = '/';
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::segment_chars,
+        opt);
+    impl.decoded_[id_path] +=
+        prefix + 1 + s.size();
+    ++impl.nseg_;
+    id_ = id_path;
+    return *this;
+}
+
+url_builder&
+url_builder::
+append_encoded_segment(pct_string_view s)
+{
+    start(id_path);
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    std::size_t const prefix =
+        ( impl.len(id_path) == 0 &&
+            needs_prefix(s) ) ? 2 : 0;
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::segment_chars, opt);
+    auto dest = append(
+        id_path, prefix + 1 + n);
+    if(prefix)
+    {
+        *dest++ = '/';
+        *dest++ = '.';
+    }
+    *dest++ = '/';
+    impl.decoded_[id_path] +=
+        prefix + 1 +
+        detail::re_encode_unsafe(
+            dest,
+            dest + n,
+            s,
+            detail::segment_chars,
+            opt);
+    ++impl.nseg_;
+    id_ = id_path;
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Query
+//
+//------------------------------------------------
+
+url_builder&
+url_builder::
+append_param(param_view const& p)
+{
+    start(id_query);
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    encoding_opts opt;
+    auto const nk = encoded_size(
+        p.key, detail::param_key_chars, opt);
+    std::size_t nv = 0;
+    if(p.has_value)
+        nv = 1 + encoded_size(
+            p.value, detail::param_value_chars, opt);
+    bool const first =
+        impl.len(id_query) == 0;
+    auto dest = append(
+        id_query, 1 + nk + nv);
+    *dest++ = first ? '?' : '&';
+    encode_unsafe(
+        dest,
+        nk,
+        p.key,
+        detail::param_key_chars,
+        opt);
+    std::size_t dn =
+        (first ? 0 : 1) + p.key.size();
+    if(p.has_value)
+    {
+        dest += nk;
+        *dest++ = '=';
+        encode_unsafe(
+            dest,
+            nv - 1,
+            p.value,
+            detail::param_value_chars,
+            opt);
+        dn += 1 + p.value.size();
+    }
+    impl.decoded_[id_query] += dn;
+    ++impl.nparam_;
+    id_ = id_query;
+    return *this;
+}
+
+url_builder&
+url_builder::
+append_encoded_param(param_pct_view const& p)
+{
+    start(id_query);
+    url_base& u = u_;
+    auto& impl = u.impl_;
+    encoding_opts opt;
+    auto const nk =
+        detail::re_encoded_size_unsafe(
+            p.key, detail::param_key_chars, opt);
+    std::size_t nv = 0;
+    if(p.has_value)
+        nv = 1 + detail::re_encoded_size_unsafe(
+            p.value, detail::param_value_chars, opt);
+    bool const first =
+        impl.len(id_query) == 0;
+    auto dest = append(
+        id_query, 1 + nk + nv);
+    auto const end = dest + 1 + nk + nv;
+    *dest++ = first ? '?' : '&';
+    std::size_t dn = first ? 0 : 1;
+    dn += detail::re_encode_unsafe(
+        dest,
+        end,
+        p.key,
+        detail::param_key_chars,
+        opt);
+    if(p.has_value)
+    {
+        *dest++ = '=';
+        dn += 1 + detail::re_encode_unsafe(
+            dest,
+            end,
+            p.value,
+            detail::param_value_chars,
+            opt);
+    }
+    impl.decoded_[id_query] += dn;
+    ++impl.nparam_;
+    id_ = id_query;
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Fragment
+//
+//------------------------------------------------
+
+url_builder&
+url_builder::
+set_fragment(core::string_view s)
+{
+    start(id_frag);
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::fragment_chars, opt);
+    auto dest = append(id_frag, 1 + n);
+    dest[0] = '#';
+    encode_unsafe(
+        dest + 1,
+        n,
+        s,
+        detail::fragment_chars,
+        opt);
+    url_base& u = u_;
+    u.impl_.decoded_[id_frag] = s.size();
+    id_ = id_end;
+    return *this;
+}
+
+url_builder&
+url_builder::
+set_encoded_fragment(pct_string_view s)
+{
+    start(id_frag);
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::fragment_chars, opt);
+    auto dest = append(id_frag, 1 + n);
+    *dest++ = '#';
+    url_base& u = u_;
+    u.impl_.decoded_[id_frag] =
+        detail::re_encode_unsafe(
+            dest,
+            dest + n,
+            s,
+            detail::fragment_chars,
+            opt);
+    id_ = id_end;
+    return *this;
+}
+
+} // urls
+} // boost
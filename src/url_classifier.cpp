@@ -0,0 +1,500 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_classifier.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+constexpr std::size_t url_classifier::npos;
+
+namespace {
+
+// compare a key with a label or a
+// segment, lowering it for hosts
+int
+compare(
+    core::string_view k,
+    core::string_view s,
+    bool ci) noexcept
+{
+    auto const n = (std::min)(
+        k.size(), s.size());
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto const c = ci ?
+            grammar::to_lower(s[i]) : s[i];
+        if(k[i] != c)
+            return static_cast<unsigned char>(
+                k[i]) < static_cast<unsigned char>(
+                    c) ? -1 : 1;
+    }
+    if(k.size() == s.size())
+        return 0;
+    return k.size() < s.size() ? -1 : 1;
+}
+
+// '*' in p matches any characters of s
+bool
+glob_match(
+    core::string_view p,
+    core::string_view s,
+    bool ci) noexcept
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    std::size_t star = core::string_view::npos;
+    std::size_t mark = 0;
+    while(j < s.size())
+    {
+        if( i < p.size() &&
+            p[i] == '*')
+        {
+            star = i++;
+            mark = j;
+        }
+        else if(
+            i < p.size() &&
+            p[i] == (ci ? grammar::to_lower(
+                s[j]) : s[j]))
+        {
+            ++i;
+            ++j;
+        }
+        else if(star != core::string_view::npos)
+        {
+            i = star + 1;
+            j = ++mark;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while( i < p.size() &&
+           p[i] == '*')
+        ++i;
+    return i == p.size();
+}
+
+// split the rightmost label from a host
+core::string_view
+pop_label(core::string_view& s) noexcept
+{
+    auto const dot = s.rfind('.');
+    if(dot == core::string_view::npos)
+    {
+        auto r = s;
+        s = {};
+        return r;
+    }
+    auto r = s.substr(dot + 1);
+    s = s.substr(0, dot);
+    return r;
+}
+
+core::string_view
+trim_dot(core::string_view s) noexcept
+{
+    if( ! s.empty() &&
+        s.back() == '.')
+        s.remove_suffix(1);
+    return s;
+}
+
+// append the elements of s
+// separated by c to v
+void
+split(
+    core::string_view s,
+    char c,
+    std::vector<core::string_view>& v)
+{
+    for(;;)
+    {
+        auto const i = s.find(c);
+        if(i == core::string_view::npos)
+        {
+            v.push_back(s);
+            return;
+        }
+        v.push_back(s.substr(0, i));
+        s.remove_prefix(i + 1);
+    }
+}
+
+// reserve room for n more elements,
+// growing geometrically
+template<class Container>
+void
+reserve_more(
+    Container& v,
+    std::size_t n)
+{
+    if(v.capacity() - v.size() >= n)
+        return;
+    v.reserve((std::max)(
+        v.size() + n, 2 * v.capacity()));
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+struct url_classifier::matcher
+{
+    using iterator =
+        segments_encoded_view::iterator;
+
+    url_classifier const& c;
+    core::string_view scheme;
+    iterator begin;
+    iterator end;
+    std::size_t best = npos;
+
+    matcher(
+        url_classifier const& c_,
+        core::string_view scheme_,
+        iterator begin_,
+        iterator end_) noexcept
+        : c(c_)
+        , scheme(scheme_)
+        , begin(begin_)
+        , end(end_)
+    {
+    }
+
+    void
+    host(
+        std::size_t n,
+        core::string_view s) noexcept
+    {
+        auto const& nd = c.nodes_[n];
+        if(nd.first >= best)
+            return;
+        if( s.empty() &&
+            nd.paths != 0)
+            path(nd.paths, begin);
+        for(auto i : nd.globs)
+        {
+            if(! c.nodes_[i].any)
+                continue;
+            // any number of labels
+            auto t = s;
+            for(;;)
+            {
+                host(i, t);
+                if(t.empty())
+                    break;
+                pop_label(t);
+            }
+        }
+        if(s.empty())
+            return;
+        auto rest = s;
+        auto const label = pop_label(rest);
+        auto it = std::lower_bound(
+            nd.lits.begin(), nd.lits.end(), label,
+            [this](std::size_t i, core::string_view l)
+            {
+                return compare(c.key(
+                    c.nodes_[i]), l, true) < 0;
+            });
+        if( it != nd.lits.end() &&
+            compare(c.key(c.nodes_[*it]),
+                label, true) == 0)
+            host(*it, rest);
+        for(auto i : nd.globs)
+        {
+            auto const& ch = c.nodes_[i];
+            if( ! ch.any &&
+                glob_match(c.key(ch), label, true))
+                host(i, rest);
+        }
+    }
+
+    void
+    path(
+        std::size_t n,
+        iterator it) noexcept
+    {
+        auto const& nd = c.nodes_[n];
+        if(nd.first >= best)
+            return;
+        if(it == end)
+        {
+            for(auto r : nd.rules)
+            {
+                if(r >= best)
+                    break;
+                auto const& ru = c.rules_[r];
+                if( ru.scheme_size == 0 ||
+                    grammar::ci_is_equal(scheme,
+                        core::string_view(
+                            c.keys_.data() + ru.scheme,
+                            ru.scheme_size)))
+                {
+                    best = r;
+                    break;
+                }
+            }
+        }
+        for(auto i : nd.globs)
+        {
+            if(! c.nodes_[i].any)
+                continue;
+            // any number of segments
+            auto t = it;
+            for(;;)
+            {
+                path(i, t);
+                if(t == end)
+                    break;
+                ++t;
+            }
+        }
+        if(it == end)
+            return;
+        core::string_view const seg = *it;
+        auto next = it;
+        ++next;
+        auto lit = std::lower_bound(
+            nd.lits.begin(), nd.lits.end(), seg,
+            [this](std::size_t i, core::string_view s)
+            {
+                return compare(c.key(
+                    c.nodes_[i]), s, false) < 0;
+            });
+        if( lit != nd.lits.end() &&
+            c.key(c.nodes_[*lit]) == seg)
+            path(*lit, next);
+        for(auto i : nd.globs)
+        {
+            auto const& ch = c.nodes_[i];
+            if( ! ch.any &&
+                glob_match(c.key(ch), seg, false))
+                path(i, next);
+        }
+    }
+};
+
+//------------------------------------------------
+
+std::size_t
+url_classifier::
+child(
+    std::size_t parent,
+    core::string_view k,
+    bool host) const noexcept
+{
+    auto const& p = nodes_[parent];
+    if(k.find('*') != core::string_view::npos)
+    {
+        for(auto i : p.globs)
+            if(key(nodes_[i]) == k)
+                return i;
+        return 0;
+    }
+    auto it = std::lower_bound(
+        p.lits.begin(), p.lits.end(), k,
+        [this, host](std::size_t i, core::string_view s)
+        {
+            return compare(key(
+                nodes_[i]), s, host) < 0;
+        });
+    if( it != p.lits.end() &&
+        key(nodes_[*it]) == k)
+        return *it;
+    return 0;
+}
+
+void
+url_classifier::
+insert(
+    std::size_t h,
+    url_glob const& g)
+{
+    // the elements of the patterns: the
+    // labels of the host from the right,
+    // then the segments of the path
+    std::string host(
+        g.host.data(), g.host.size());
+    for(auto& c : host)
+        c = grammar::to_lower(c);
+    std::vector<core::string_view> es;
+    auto const hs = trim_dot(host);
+    if(hs.empty())
+        es.push_back("**");
+    else
+        split(hs, '.', es);
+    std::reverse(es.begin(), es.end());
+    auto const nh = es.size();
+    auto ps = g.path;
+    if(ps.empty())
+    {
+        es.push_back("**");
+    }
+    else
+    {
+        if(ps.front() == '/')
+            ps.remove_prefix(1);
+        if(! ps.empty())
+            split(ps, '/', es);
+    }
+
+    // the steps are the host elements,
+    // the edge to the path trie, and the
+    // path elements
+    auto const steps = es.size() + 1;
+    auto const elem = [&](std::size_t k)
+    {
+        return es[k < nh ? k : k - 1];
+    };
+
+    // the existing nodes along the steps
+    std::vector<std::size_t> chain;
+    std::size_t k = 0;
+    if(! nodes_.empty())
+    {
+        std::size_t cur = 0;
+        chain.push_back(cur);
+        while(k < steps)
+        {
+            auto const next = k == nh
+                ? nodes_[cur].paths
+                : child(cur, elem(k), k < nh);
+            if(next == 0)
+                break;
+            cur = next;
+            chain.push_back(cur);
+            ++k;
+        }
+    }
+
+    // the new nodes, linked to each other
+    auto const base = nodes_.size();
+    std::vector<node> v;
+    std::string keys;
+    if(nodes_.empty())
+    {
+        v.emplace_back();
+        chain.push_back(0);
+    }
+    auto const parent = chain.back();
+    auto const step = k;
+    auto cur = parent;
+    for(; k < steps; ++k)
+    {
+        auto const idx = base + v.size();
+        v.emplace_back();
+        if(k != nh)
+        {
+            auto const e = elem(k);
+            node& nd = v.back();
+            nd.key = keys_.size() + keys.size();
+            nd.size = e.size();
+            nd.glob = e.find('*') !=
+                core::string_view::npos;
+            nd.any = e == "**";
+            keys.append(e.data(), e.size());
+        }
+        if(cur >= base)
+        {
+            node& p = v[cur - base];
+            if(k == nh)
+                p.paths = idx;
+            else if(v.back().glob)
+                p.globs.push_back(idx);
+            else
+                p.lits.push_back(idx);
+        }
+        chain.push_back(idx);
+        cur = idx;
+    }
+    auto const r = rules_.size();
+    if(cur >= base)
+        v[cur - base].rules.push_back(r);
+
+    // allocate before changing anything
+    reserve_more(rules_, 1);
+    reserve_more(keys_,
+        keys.size() + g.scheme.size());
+    reserve_more(nodes_, v.size());
+    bool const linked =
+        parent < base && step < steps;
+    bool const link_child =
+        linked && step != nh;
+    bool const link_glob =
+        link_child && v.front().glob;
+    if(link_child)
+        reserve_more(link_glob
+            ? nodes_[parent].globs
+            : nodes_[parent].lits, 1);
+    if(cur < base)
+        reserve_more(nodes_[cur].rules, 1);
+
+    // from here nothing throws
+    auto const scheme = keys_.size() + keys.size();
+    keys_.append(keys);
+    keys_.append(g.scheme.data(), g.scheme.size());
+    for(auto& nd : v)
+        nodes_.push_back(std::move(nd));
+    if(linked)
+    {
+        auto& p = nodes_[parent];
+        if(! link_child)
+        {
+            p.paths = base;
+        }
+        else if(link_glob)
+        {
+            p.globs.push_back(base);
+        }
+        else
+        {
+            auto const kb = key(nodes_[base]);
+            auto it = std::lower_bound(
+                p.lits.begin(), p.lits.end(), kb,
+                [this](std::size_t i, core::string_view s)
+                {
+                    return key(nodes_[i]) < s;
+                });
+            p.lits.insert(it, base);
+        }
+    }
+    if(cur < base)
+        nodes_[cur].rules.push_back(r);
+    rules_.push_back({ h, scheme, g.scheme.size() });
+    for(auto i : chain)
+        if(nodes_[i].first == npos)
+            nodes_[i].first = r;
+}
+
+std::size_t
+url_classifier::
+find(
+    url_view_base const& u) const noexcept
+{
+    if(nodes_.empty())
+        return npos;
+    auto const segs = u.encoded_segments();
+    matcher m(*this, u.scheme(),
+        segs.begin(), segs.end());
+    m.host(0, trim_dot(u.encoded_host()));
+    if(m.best == npos)
+        return npos;
+    return rules_[m.best].handler;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,282 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_delta.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "detail/url_image.hpp"
+#include "detail/url_list.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+using id = detail::parts_base;
+
+// The components are the parts of the
+// url_impl, so one bit each fits a byte
+constexpr int components =
+    id::id_end - id::id_scheme;
+
+static_assert(
+    components <= 8,
+    "one flag byte per delta");
+
+constexpr
+unsigned
+flag(int i) noexcept
+{
+    return 1u << (i - id::id_scheme);
+}
+
+// The largest delta of a url of n characters
+constexpr
+std::size_t
+max_delta_size(std::size_t n) noexcept
+{
+    return 1 + components * 3 *
+        detail::ul::max_varint_size + n;
+}
+
+// The characters of a part
+core::string_view
+get_part(
+    detail::url_impl const& impl,
+    int i) noexcept
+{
+    return core::string_view(
+        impl.cs_ + impl.offset(i),
+        impl.len(i));
+}
+
+// Writes the delta to dest, returns
+// the number of characters written
+std::size_t
+write_delta(
+    detail::url_impl const& a,
+    detail::url_impl const& b,
+    char* dest) noexcept
+{
+    namespace ul = detail::ul;
+    char* p = dest + 1;
+    unsigned flags = 0;
+    for(int i = id::id_scheme; i < id::id_end; ++i)
+    {
+        core::string_view const s0 = get_part(a, i);
+        core::string_view const s1 = get_part(b, i);
+        if( s0.size() == s1.size() &&
+            (s0.empty() || std::memcmp(
+                s0.data(), s1.data(), s0.size()) == 0))
+            continue;
+        flags |= flag(i);
+        std::size_t const n = (std::min)(
+            s0.size(), s1.size());
+        std::size_t head = 0;
+        while( head < n &&
+            s0[head] == s1[head])
+            ++head;
+        std::size_t tail = 0;
+        while( tail < n - head &&
+            s0[s0.size() - 1 - tail] ==
+                s1[s1.size() - 1 - tail])
+            ++tail;
+        std::size_t const m =
+            s1.size() - head - tail;
+        p += ul::store_varint(p, head);
+        p += ul::store_varint(p, tail);
+        p += ul::store_varint(p, m);
+        if(m > 0)
+            std::memcpy(p, s1.data() + head, m);
+        p += m;
+    }
+    dest[0] = static_cast<char>(flags);
+    return p - dest;
+}
+
+// Writes the characters of the url
+// described by the delta to dest,
+// returns the size of the delta
+system::result<std::size_t>
+read_delta(
+    detail::url_impl const& a,
+    core::string_view delta,
+    std::string& dest)
+{
+    namespace ul = detail::ul;
+    if(delta.empty())
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::need_more);
+    }
+    char const* it = delta.data() + 1;
+    char const* const end =
+        delta.data() + delta.size();
+    auto const flags = static_cast<
+        unsigned char>(delta[0]);
+    dest.clear();
+    for(int i = id::id_scheme; i < id::id_end; ++i)
+    {
+        core::string_view const s0 = get_part(a, i);
+        if(! (flags & flag(i)))
+        {
+            dest.append(s0.data(), s0.size());
+            continue;
+        }
+        std::uint64_t head;
+        std::uint64_t tail;
+        std::uint64_t m;
+        if( ! ul::load_varint(it, end, head) ||
+            ! ul::load_varint(it, end, tail) ||
+            ! ul::load_varint(it, end, m) ||
+            m > static_cast<std::uint64_t>(end - it))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::need_more);
+        }
+        if( head > s0.size() ||
+            tail > s0.size() - head)
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        auto const n = static_cast<std::size_t>(m);
+        dest.append(s0.data(),
+            static_cast<std::size_t>(head));
+        dest.append(it, n);
+        dest.append(s0.data() + s0.size() - tail,
+            static_cast<std::size_t>(tail));
+        it += n;
+    }
+    return static_cast<std::size_t>(
+        it - delta.data());
+}
+
+// Assigns the url described by the delta
+system::result<std::size_t>
+apply_delta(
+    url_view_base const& prev,
+    core::string_view delta,
+    std::string& buf,
+    url& dest)
+{
+    auto rv = read_delta(
+        detail::url_image::impl(prev),
+        delta, buf);
+    if(! rv)
+        return rv.error();
+    auto u = parse_uri_reference(buf);
+    if(! u)
+        return u.error();
+    dest = *u;
+    return rv;
+}
+
+} // (anon)
+
+//------------------------------------------------
+//
+// url_delta
+//
+//------------------------------------------------
+
+void
+url_delta::
+encode(
+    url_view_base const& prev,
+    url_view_base const& next,
+    std::string& dest)
+{
+    std::size_t const n = dest.size();
+    dest.resize(n + max_delta_size(next.size()));
+    std::size_t const m = write_delta(
+        detail::url_image::impl(prev),
+        detail::url_image::impl(next),
+        &dest[n]);
+    dest.resize(n + m);
+}
+
+system::result<std::size_t>
+url_delta::
+apply(
+    url_view_base const& prev,
+    core::string_view delta,
+    url& dest)
+{
+    std::string buf;
+    return apply_delta(
+        prev, delta, buf, dest);
+}
+
+//------------------------------------------------
+//
+// url_delta_encoder
+//
+//------------------------------------------------
+
+void
+url_delta_encoder::
+push_back(url_view_base const& u)
+{
+    // allocate first, so the
+    // rest cannot throw
+    std::size_t const n = s_.size();
+    std::size_t const max =
+        max_delta_size(u.size());
+    if(s_.capacity() - n < max)
+        s_.reserve((std::max)(
+            n + max, 2 * s_.capacity()));
+    prev_.reserve(u.size());
+
+    s_.resize(n + max);
+    std::size_t const m = write_delta(
+        detail::url_image::impl(prev_),
+        detail::url_image::impl(u),
+        &s_[n]);
+    s_.resize(n + m);
+    prev_ = u;
+    ++size_;
+}
+
+std::string
+url_delta_encoder::
+release()
+{
+    std::string s = std::move(s_);
+    s_.clear();
+    prev_.clear();
+    size_ = 0;
+    return s;
+}
+
+//------------------------------------------------
+//
+// url_delta_decoder
+//
+//------------------------------------------------
+
+system::result<url_view>
+url_delta_decoder::
+next()
+{
+    BOOST_ASSERT(! done());
+    auto rv = apply_delta(cur_,
+        data_.substr(pos_), buf_, cur_);
+    if(! rv)
+        return rv.error();
+    pos_ += *rv;
+    return url_view(cur_);
+}
+
+} // urls
+} // boost
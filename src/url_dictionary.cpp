@@ -0,0 +1,158 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_dictionary.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <new>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// A record is the size of
+// the string, then its
+// characters
+struct record
+{
+    std::size_t n;
+
+    char const*
+    data() const noexcept
+    {
+        return reinterpret_cast<
+            char const*>(this + 1);
+    }
+};
+
+std::uint64_t
+mix(
+    std::uint64_t a,
+    std::uint64_t b) noexcept
+{
+    a ^= b;
+    a *= 0x9e3779b97f4a7c15ULL;
+    return a ^ (a >> 29);
+}
+
+// Hash the characters 8 at a time
+std::uint64_t
+hash(core::string_view s) noexcept
+{
+    std::uint64_t h = s.size();
+    char const* p = s.data();
+    std::size_t n = s.size();
+    while(n >= 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, 8);
+        h = mix(h, w);
+        p += 8;
+        n -= 8;
+    }
+    if(n > 0)
+    {
+        std::uint64_t w = 0;
+        std::memcpy(&w, p, n);
+        h = mix(h, w);
+    }
+    return mix(h, 0xa0761d6478bd642fULL);
+}
+
+bool
+equal(
+    void const* rec,
+    void const* k) noexcept
+{
+    auto const& r = *static_cast<
+        record const*>(rec);
+    auto const& s = *static_cast<
+        core::string_view const*>(k);
+    return
+        r.n == s.size() && (r.n == 0 ||
+        std::memcmp(r.data(), s.data(), r.n) == 0);
+}
+
+} // (anon)
+
+constexpr url_dictionary::id_type url_dictionary::npos;
+
+auto
+url_dictionary::
+insert(
+    kind k,
+    core::string_view s) ->
+        id_type
+{
+    auto& t = t_[static_cast<int>(k)];
+    std::uint64_t const h = hash(s);
+    id_type const id =
+        t.find(h, &equal, &s);
+    if(id != npos)
+        return id;
+    return t.insert(h, &equal, &s,
+        sizeof(record) + s.size(),
+        [](void* p, void const* k)
+        {
+            auto const& s = *static_cast<
+                core::string_view const*>(k);
+            record* r = ::new(p) record;
+            r->n = s.size();
+            if(s.size() > 0)
+                std::memcpy(r + 1,
+                    s.data(), s.size());
+        });
+}
+
+void
+url_dictionary::
+insert(url_view_base const& u)
+{
+    if(u.has_authority())
+        insert(kind::host, u.encoded_host());
+    for(auto s : u.encoded_segments())
+        insert(kind::segment, s);
+    if(u.has_query())
+    {
+        for(auto p : u.encoded_params())
+            insert(kind::key, p.key);
+    }
+}
+
+auto
+url_dictionary::
+find(
+    kind k,
+    core::string_view s) const noexcept ->
+        id_type
+{
+    return t_[static_cast<int>(k)].find(
+        hash(s), &equal, &s);
+}
+
+core::string_view
+url_dictionary::
+get(
+    kind k,
+    id_type id) const noexcept
+{
+    BOOST_ASSERT(id < size(k));
+    auto const& r = *static_cast<
+        record const*>(
+            t_[static_cast<int>(k)].get(id));
+    return core::string_view(
+        r.data(), r.n);
+}
+
+} // urls
+} // boost
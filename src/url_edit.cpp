@@ -0,0 +1,857 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_edit.hpp>
+#include <boost/url/encode.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include "detail/print.hpp"
+#include "rfc/detail/charsets.hpp"
+#include "rfc/detail/ipvfuture_rule.hpp"
+#include "rfc/detail/port_rule.hpp"
+#include "rfc/detail/scheme_rule.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// a piece of the resulting URL:
+// new characters, or characters
+// kept from the old string
+struct piece
+{
+    char const* p;
+    std::size_t pos;
+    std::size_t n;
+};
+
+// the pieces of the resulting URL in order
+class layout
+{
+    // "x:" "//" "u" ":" "p" "@" "h" ":" "80"
+    // "/." "p" "?q" "#f"
+    piece v_[16];
+    std::size_t n_ = 0;
+
+public:
+    void
+    add(char const* p, std::size_t n) noexcept
+    {
+        if(n == 0)
+            return;
+        BOOST_ASSERT(n_ < 16);
+        v_[n_++] = {p, 0, n};
+    }
+
+    void
+    add(core::string_view s) noexcept
+    {
+        add(s.data(), s.size());
+    }
+
+    void
+    keep(std::size_t pos, std::size_t n) noexcept
+    {
+        if(n == 0)
+            return;
+        BOOST_ASSERT(n_ < 16);
+        v_[n_++] = {nullptr, pos, n};
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < n_; ++i)
+            n += v_[i].n;
+        return n;
+    }
+
+    // Write the pieces to s. The kept
+    // pieces are in order in the old
+    // string, so the ones moving left
+    // are moved first from the start,
+    // and the ones moving right from
+    // the end, before any new characters
+    // are copied.
+    void
+    write(char* s) const noexcept
+    {
+        std::size_t pos[16];
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < n_; ++i)
+        {
+            pos[i] = n;
+            n += v_[i].n;
+        }
+        for(std::size_t i = 0; i < n_; ++i)
+        {
+            auto const& pc = v_[i];
+            if( pc.p == nullptr &&
+                pos[i] < pc.pos)
+                std::memmove(
+                    s + pos[i], s + pc.pos, pc.n);
+        }
+        for(std::size_t i = n_; i-- != 0;)
+        {
+            auto const& pc = v_[i];
+            if( pc.p == nullptr &&
+                pos[i] > pc.pos)
+                std::memmove(
+                    s + pos[i], s + pc.pos, pc.n);
+        }
+        for(std::size_t i = 0; i < n_; ++i)
+        {
+            auto const& pc = v_[i];
+            if(pc.p != nullptr)
+                std::memcpy(
+                    s + pos[i], pc.p, pc.n);
+        }
+        s[n] = '\0';
+    }
+};
+
+// the size of the first segment
+// of a relative path
+std::size_t
+first_segment_size(
+    core::string_view s) noexcept
+{
+    auto const pos = s.find('/');
+    if(pos == core::string_view::npos)
+        return s.size();
+    return pos;
+}
+
+// escape the colons in the first
+// segment of a relative path
+void
+escape_colons(
+    std::string& dest,
+    core::string_view s)
+{
+    auto const n = first_segment_size(s);
+    dest.reserve(s.size() + 2 * std::count(
+        s.begin(), s.begin() + n, ':'));
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(s[i] != ':')
+            dest.push_back(s[i]);
+        else
+            dest.append("%3A", 3);
+    }
+    dest.append(s.data() + n, s.size() - n);
+}
+
+bool
+has_colon(core::string_view s) noexcept
+{
+    if(s.starts_with('/'))
+        return false;
+    auto const n = first_segment_size(s);
+    return s.substr(0, n).contains(':');
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+char*
+url_edit::
+stage(int id, std::size_t n)
+{
+    auto const pos = s_.size();
+    s_.resize(pos + n);
+    f_[id + 1] = {op::set, pos, n};
+    return &s_[pos];
+}
+
+void
+url_edit::
+stage(int id, core::string_view s)
+{
+    auto dest = stage(id, s.size());
+    if(! s.empty())
+        std::memcpy(dest, s.data(), s.size());
+}
+
+core::string_view
+url_edit::
+get(int id) const noexcept
+{
+    return core::string_view(
+        s_.data() + f_[id + 1].pos, f_[id + 1].n);
+}
+
+void
+url_edit::
+clear() noexcept
+{
+    for(auto& f : f_)
+        f = {};
+    remove_authority_ = false;
+    set_authority_ = false;
+    s_.clear();
+}
+
+void
+url_edit::
+apply(url_base& u) const
+{
+    auto const& impl = u.impl_;
+    char const* const s = impl.cs_;
+    auto const kept = [&impl, s](int id)
+    {
+        return core::string_view(
+            s + impl.offset(id), impl.len(id));
+    };
+    layout out;
+
+    // scheme
+    bool const had_scheme =
+        impl.len(id_scheme) != 0;
+    bool has_scheme = had_scheme;
+    switch(f_[id_scheme + 1].what)
+    {
+    case op::set:
+        out.add(get(id_scheme));
+        out.add(":", 1);
+        has_scheme = true;
+        break;
+    case op::remove:
+        has_scheme = false;
+        break;
+    case op::keep:
+        out.keep(
+            impl.offset(id_scheme),
+            impl.len(id_scheme));
+        break;
+    }
+
+    // authority
+    bool const had_authority =
+        impl.len(id_user) != 0;
+    bool const keep_authority =
+        had_authority &&
+        ! remove_authority_;
+    bool const has_authority =
+        keep_authority ||
+        set_authority_;
+    if(has_authority)
+    {
+        out.add("//", 2);
+        // user
+        bool has_user = false;
+        switch(f_[id_user + 1].what)
+        {
+        case op::set:
+            out.add(get(id_user));
+            has_user = true;
+            break;
+        case op::remove:
+            break;
+        case op::keep:
+            if(! keep_authority)
+                break;
+            out.keep(
+                impl.offset(id_user) + 2,
+                impl.len(id_user) - 2);
+            has_user = impl.len(id_pass) != 0;
+            break;
+        }
+        // password
+        bool has_pass = false;
+        switch(f_[id_pass + 1].what)
+        {
+        case op::set:
+            out.add(":", 1);
+            out.add(get(id_pass));
+            has_pass = true;
+            break;
+        case op::remove:
+            break;
+        case op::keep:
+            if( ! keep_authority ||
+                impl.len(id_pass) < 2)
+                break;
+            // ":" password
+            out.keep(
+                impl.offset(id_pass),
+                impl.len(id_pass) - 1);
+            has_pass = true;
+            break;
+        }
+        if(has_user || has_pass)
+            out.add("@", 1);
+        // host
+        if(f_[id_host + 1].what == op::set)
+            out.add(get(id_host));
+        else if(
+            f_[id_host + 1].what == op::keep &&
+            keep_authority)
+            out.keep(
+                impl.offset(id_host),
+                impl.len(id_host));
+        // port
+        if(f_[id_port + 1].what == op::set)
+        {
+            out.add(":", 1);
+            out.add(get(id_port));
+        }
+        else if(
+            f_[id_port + 1].what == op::keep &&
+            keep_authority)
+        {
+            out.keep(
+                impl.offset(id_port),
+                impl.len(id_port));
+        }
+    }
+
+    // path
+    std::string tmp;
+    if(f_[id_path + 1].what == op::set)
+    {
+        // as if set after the
+        // other components
+        auto p = get(id_path);
+        if(has_authority)
+        {
+            if( ! p.empty() &&
+                ! p.starts_with('/'))
+                out.add("/", 1);
+            out.add(p);
+        }
+        else if(p.starts_with("//"))
+        {
+            out.add("/.", 2);
+            out.add(p);
+        }
+        else if(
+            ! has_scheme &&
+            has_colon(p))
+        {
+            escape_colons(tmp, p);
+            out.add(tmp);
+        }
+        else
+        {
+            out.add(p);
+        }
+    }
+    else
+    {
+        // as if adjusted by each
+        // setter in turn
+        auto pos = impl.offset(id_path);
+        auto p = kept(id_path);
+        if( f_[id_scheme + 1].what == op::set &&
+            impl.nseg_ != 0 &&
+            p.starts_with("./") &&
+            first_segment_size(
+                p.substr(2)) >= 2)
+        {
+            // set_scheme removes "./"
+            pos += 2;
+            p.remove_prefix(2);
+        }
+        if( had_scheme &&
+            ! has_scheme &&
+            ! had_authority &&
+            impl.nseg_ != 0 &&
+            has_colon(p))
+        {
+            escape_colons(tmp, p);
+            p = tmp;
+        }
+        if( had_authority &&
+            remove_authority_ &&
+            p.starts_with("//"))
+        {
+            out.add("/.", 2);
+        }
+        else if(
+            has_authority &&
+            ! p.empty() &&
+            ! p.starts_with('/'))
+        {
+            out.add("/", 1);
+        }
+        if(p.data() == tmp.data())
+            out.add(p);
+        else
+            out.keep(pos, p.size());
+    }
+
+    // query
+    switch(f_[id_query + 1].what)
+    {
+    case op::set:
+        out.add("?", 1);
+        out.add(get(id_query));
+        break;
+    case op::remove:
+        break;
+    case op::keep:
+        out.keep(
+            impl.offset(id_query),
+            impl.len(id_query));
+        break;
+    }
+
+    // fragment
+    switch(f_[id_frag + 1].what)
+    {
+    case op::set:
+        out.add("#", 1);
+        out.add(get(id_frag));
+        break;
+    case op::remove:
+        break;
+    case op::keep:
+        out.keep(
+            impl.offset(id_frag),
+            impl.len(id_frag));
+        break;
+    }
+
+    auto const n = out.size();
+    if(n == 0)
+    {
+        u.clear();
+        return;
+    }
+    url_base::op_t op(u);
+    u.reserve_impl(n, op);
+    out.write(u.s_);
+    auto rv = parse_uri_reference(
+        core::string_view(u.s_, n));
+    BOOST_ASSERT(rv.has_value());
+    u.impl_ = rv->impl_;
+    u.impl_.cs_ = u.s_;
+    u.impl_.from_ = {from::url};
+}
+
+//------------------------------------------------
+//
+// Scheme
+//
+//------------------------------------------------
+
+url_edit&
+url_edit::
+set_scheme(core::string_view s)
+{
+    grammar::parse(
+        s, detail::scheme_rule()
+            ).value(BOOST_URL_POS);
+    stage(id_scheme, s);
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_scheme_id(urls::scheme id)
+{
+    if(id == urls::scheme::unknown)
+        detail::throw_invalid_argument();
+    if(id == urls::scheme::none)
+        return remove_scheme();
+    stage(id_scheme, to_string(id));
+    return *this;
+}
+
+url_edit&
+url_edit::
+remove_scheme() noexcept
+{
+    f_[id_scheme + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Authority
+//
+//------------------------------------------------
+
+url_edit&
+url_edit::
+remove_authority() noexcept
+{
+    remove_authority_ = true;
+    set_authority_ = false;
+    f_[id_user + 1] = {op::remove, 0, 0};
+    f_[id_pass + 1] = {op::remove, 0, 0};
+    f_[id_host + 1] = {op::remove, 0, 0};
+    f_[id_port + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_user(core::string_view s)
+{
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::user_chars, opt);
+    auto dest = stage(id_user, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::user_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_user(pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::user_chars, opt);
+    auto dest = stage(id_user, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::user_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_password(core::string_view s)
+{
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::password_chars, opt);
+    auto dest = stage(id_pass, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::password_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_password(pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::password_chars, opt);
+    auto dest = stage(id_pass, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::password_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+remove_userinfo() noexcept
+{
+    f_[id_user + 1] = {op::remove, 0, 0};
+    f_[id_pass + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_host(core::string_view s)
+{
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        auto const s1 =
+            s.substr(1, s.size() - 2);
+        auto rv = parse_ipv6_address(s1);
+        if(rv)
+        {
+            char buf[2 +
+                urls::ipv6_address::max_str_len];
+            auto s2 = rv->to_buffer(
+                buf + 1, sizeof(buf) - 2);
+            buf[0] = '[';
+            buf[s2.size() + 1] = ']';
+            stage(id_host, core::string_view(
+                buf, s2.size() + 2));
+            set_authority_ = true;
+            return *this;
+        }
+        if(grammar::parse(
+            s1, detail::ipvfuture_rule))
+        {
+            stage(id_host, s);
+            set_authority_ = true;
+            return *this;
+        }
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        auto rv = parse_ipv4_address(s);
+        if(rv)
+        {
+            char buf[urls::ipv4_address::max_str_len];
+            stage(id_host, rv->to_buffer(
+                buf, sizeof(buf)));
+            set_authority_ = true;
+            return *this;
+        }
+    }
+
+    // reg-name
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::host_chars, opt);
+    auto dest = stage(id_host, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::host_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_host(pct_string_view s)
+{
+    if( s.size() > 2 &&
+        s.front() == '[' &&
+        s.back() == ']')
+    {
+        // IP-literal
+        return set_host(s);
+    }
+    else if(s.size() >= 7) // "0.0.0.0"
+    {
+        // IPv4-address
+        if(parse_ipv4_address(s))
+            return set_host(s);
+    }
+
+    // reg-name
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::host_chars, opt);
+    auto dest = stage(id_host, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::host_chars,
+        opt);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_port_number(std::uint16_t n)
+{
+    auto s = detail::make_printed(n);
+    stage(id_port, s.string());
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_port(core::string_view s)
+{
+    auto t = grammar::parse(s,
+        detail::port_rule{}
+            ).value(BOOST_URL_POS);
+    stage(id_port, t.str);
+    set_authority_ = true;
+    return *this;
+}
+
+url_edit&
+url_edit::
+remove_port() noexcept
+{
+    f_[id_port + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Path
+//
+//------------------------------------------------
+
+url_edit&
+url_edit::
+set_path(core::string_view s)
+{
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::path_chars, opt);
+    auto dest = stage(id_path, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::path_chars,
+        opt);
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_path(pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::path_chars, opt);
+    auto dest = stage(id_path, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::path_chars,
+        opt);
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Query
+//
+//------------------------------------------------
+
+url_edit&
+url_edit::
+set_query(core::string_view s)
+{
+    // as an intact string, the plus
+    // sign is not an encoded space
+    encoding_opts opt;
+    opt.space_as_plus = false;
+    auto const n = encoded_size(
+        s, detail::query_chars, opt);
+    auto dest = stage(id_query, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::query_chars,
+        opt);
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_query(pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::query_chars, opt);
+    auto dest = stage(id_query, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::query_chars,
+        opt);
+    return *this;
+}
+
+url_edit&
+url_edit::
+remove_query() noexcept
+{
+    f_[id_query + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+//------------------------------------------------
+//
+// Fragment
+//
+//------------------------------------------------
+
+url_edit&
+url_edit::
+set_fragment(core::string_view s)
+{
+    encoding_opts opt;
+    auto const n = encoded_size(
+        s, detail::fragment_chars, opt);
+    auto dest = stage(id_frag, n);
+    encode_unsafe(
+        dest,
+        n,
+        s,
+        detail::fragment_chars,
+        opt);
+    return *this;
+}
+
+url_edit&
+url_edit::
+set_encoded_fragment(pct_string_view s)
+{
+    encoding_opts opt;
+    auto const n =
+        detail::re_encoded_size_unsafe(
+            s, detail::fragment_chars, opt);
+    auto dest = stage(id_frag, n);
+    detail::re_encode_unsafe(
+        dest,
+        dest + n,
+        s,
+        detail::fragment_chars,
+        opt);
+    return *this;
+}
+
+url_edit&
+url_edit::
+remove_fragment() noexcept
+{
+    f_[id_frag + 1] = {op::remove, 0, 0};
+    return *this;
+}
+
+} // urls
+} // boost
@@ -0,0 +1,290 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_FEATURES_IPP
+#define BOOST_URL_IMPL_URL_FEATURES_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_features.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/core/bit.hpp>
+#include <cmath>
+#include <cstdint>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+bool
+is_digit(unsigned char c) noexcept
+{
+    return static_cast<unsigned char>(
+        c - '0') < 10;
+}
+
+bool
+is_letter(unsigned char c) noexcept
+{
+    return static_cast<unsigned char>(
+        (c | 0x20) - 'a') < 26;
+}
+
+// Store the counts of the characters
+// of s in v
+void
+count_chars(
+    core::string_view s,
+    float* v) noexcept
+{
+    char const* it = s.data();
+    char const* const last = it + s.size();
+    std::size_t nd = 0;
+    std::size_t nl = 0;
+    std::size_t nt = 0;
+    std::size_t nh = 0;
+    std::size_t ne = 0;
+#ifdef BOOST_URL_USE_SSE2
+    // x - lo is below n as unsigned when
+    // it is below n - 128 as signed, once
+    // the high bit is flipped
+    __m128i const bias = _mm_set1_epi8(
+        static_cast<char>(0x80));
+    __m128i const zero = _mm_set1_epi8('0');
+    __m128i const ten = _mm_set1_epi8(
+        static_cast<char>(0x80 + 10));
+    __m128i const lower = _mm_set1_epi8(0x20);
+    __m128i const a = _mm_set1_epi8('a');
+    __m128i const n26 = _mm_set1_epi8(
+        static_cast<char>(0x80 + 26));
+    __m128i const dot = _mm_set1_epi8('.');
+    __m128i const hyphen = _mm_set1_epi8('-');
+    __m128i const pct = _mm_set1_epi8('%');
+    auto const bits = [](__m128i m)
+    {
+        return boost::core::popcount(
+            static_cast<unsigned>(
+                _mm_movemask_epi8(m)));
+    };
+    while(last - it >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        nd += bits(_mm_cmplt_epi8(_mm_xor_si128(
+            _mm_sub_epi8(v, zero), bias), ten));
+        nl += bits(_mm_cmplt_epi8(_mm_xor_si128(
+            _mm_sub_epi8(_mm_or_si128(v, lower), a),
+                bias), n26));
+        nt += bits(_mm_cmpeq_epi8(v, dot));
+        nh += bits(_mm_cmpeq_epi8(v, hyphen));
+        ne += bits(_mm_cmpeq_epi8(v, pct));
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const one = vdupq_n_u8(1);
+    uint8x16_t const zero = vdupq_n_u8('0');
+    uint8x16_t const ten = vdupq_n_u8(10);
+    uint8x16_t const lower = vdupq_n_u8(0x20);
+    uint8x16_t const a = vdupq_n_u8('a');
+    uint8x16_t const n26 = vdupq_n_u8(26);
+    uint8x16_t const dot = vdupq_n_u8('.');
+    uint8x16_t const hyphen = vdupq_n_u8('-');
+    uint8x16_t const pct = vdupq_n_u8('%');
+    auto const bits = [one](uint8x16_t m)
+    {
+        return vaddvq_u8(vandq_u8(m, one));
+    };
+    while(last - it >= 16)
+    {
+        uint8x16_t const v = vld1q_u8(
+            reinterpret_cast<
+                std::uint8_t const*>(it));
+        nd += bits(vcltq_u8(vsubq_u8(v, zero), ten));
+        nl += bits(vcltq_u8(vsubq_u8(
+            vorrq_u8(v, lower), a), n26));
+        nt += bits(vceqq_u8(v, dot));
+        nh += bits(vceqq_u8(v, hyphen));
+        ne += bits(vceqq_u8(v, pct));
+        it += 16;
+    }
+#endif
+    for(; it != last; ++it)
+    {
+        unsigned char const c =
+            static_cast<unsigned char>(*it);
+        nd += is_digit(c);
+        nl += is_letter(c);
+        nt += c == '.';
+        nh += c == '-';
+        ne += c == '%';
+    }
+    v[url_features::url_digits] =
+        static_cast<float>(nd);
+    v[url_features::url_letters] =
+        static_cast<float>(nl);
+    v[url_features::url_dots] =
+        static_cast<float>(nt);
+    v[url_features::url_hyphens] =
+        static_cast<float>(nh);
+    v[url_features::url_escapes] =
+        static_cast<float>(ne);
+}
+
+// Store the statistics of s in v, which
+// are in the order of those of the whole
+// URL, and add its tokens to the buckets
+// when they are not null.
+// The counts of h are zero, and are left
+// zero, so that no component clears them.
+void
+measure(
+    core::string_view s,
+    float* v,
+    std::uint32_t* h,
+    float* buckets) noexcept
+{
+    v[url_features::url_length] =
+        static_cast<float>(s.size());
+    count_chars(s, v);
+    if(s.empty())
+        return;
+
+    // the histogram of the bytes
+    // and the tokens, in one pass
+    std::uint32_t th = 2166136261u;
+    bool in_token = false;
+    for(char ch : s)
+    {
+        unsigned char const c =
+            static_cast<unsigned char>(ch);
+        ++h[c];
+        if(! buckets)
+            continue;
+        if(is_digit(c) || is_letter(c))
+        {
+            // FNV-1a, ignoring case
+            unsigned char const l =
+                is_letter(c) ? (c | 0x20) : c;
+            th = (th ^ l) * 16777619u;
+            in_token = true;
+        }
+        else if(in_token)
+        {
+            buckets[th %
+                url_features::token_buckets] += 1;
+            th = 2166136261u;
+            in_token = false;
+        }
+    }
+    if(in_token)
+        buckets[th %
+            url_features::token_buckets] += 1;
+
+    // the entropy, visiting each byte
+    // value once as the counts are
+    // cleared
+    double sum = 0;
+    for(char ch : s)
+    {
+        std::uint32_t& k = h[
+            static_cast<unsigned char>(ch)];
+        if(k == 0)
+            continue;
+        sum += k * std::log2(
+            static_cast<double>(k));
+        k = 0;
+    }
+    double const n =
+        static_cast<double>(s.size());
+    v[url_features::url_entropy] =
+        static_cast<float>(
+            std::log2(n) - sum / n);
+}
+
+} // (anon)
+
+void
+extract_features(
+    url_view_base const& u,
+    url_features& f) noexcept
+{
+    float* const v = f.v_;
+    for(float& x : f.v_)
+        x = 0;
+    float* const buckets =
+        v + url_features::token_hash;
+    std::uint32_t h[256] = {};
+    measure(u.buffer(),
+        v + url_features::url_length,
+        h, nullptr);
+    core::string_view const host =
+        u.encoded_host();
+    measure(host,
+        v + url_features::host_length,
+        h, buckets);
+    measure(u.encoded_path(),
+        v + url_features::path_length,
+        h, buckets);
+    measure(u.encoded_query(),
+        v + url_features::query_length,
+        h, buckets);
+
+    if(u.host_type() == host_type::name)
+    {
+        if(! host.empty())
+            v[url_features::host_labels] =
+                v[url_features::host_dots] +
+                (host.back() != '.');
+    }
+    else if(u.host_type() != host_type::none)
+    {
+        v[url_features::host_is_ip] = 1;
+    }
+    v[url_features::path_segments] =
+        static_cast<float>(
+            u.encoded_segments().size());
+    if(u.has_query())
+        v[url_features::query_params] =
+            static_cast<float>(
+                u.encoded_params().size());
+    v[url_features::has_userinfo] =
+        u.has_userinfo();
+    v[url_features::has_port] =
+        u.has_port();
+    v[url_features::is_https] =
+        u.scheme_id() == scheme::https;
+}
+
+void
+extract_features(
+    url_batch const& b,
+    float* columns) noexcept
+{
+    std::size_t const n = b.size();
+    url_features f;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        extract_features(b.view(i), f);
+        for(std::size_t j = 0;
+            j < url_features::count; ++j)
+            columns[j * n + i] = f[j];
+    }
+}
+
+} // urls
+} // boost
+
+#endif
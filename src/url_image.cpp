@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_image.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "detail/url_image.hpp"
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+using id = detail::parts_base;
+
+// Reads the header and sets cs_
+// to the characters after it
+void
+read_header(
+    char const* p,
+    detail::url_impl& u) noexcept
+{
+    namespace ul = detail::ul;
+    char const* const first = p;
+    p += 8;
+    for(int i = 0; i <= id::id_end; ++i)
+    {
+        u.offset_[i] = static_cast<
+            std::size_t>(ul::load64(p));
+        p += 8;
+    }
+    for(int i = 0; i < id::id_end; ++i)
+    {
+        u.decoded_[i] = static_cast<
+            std::size_t>(ul::load64(p));
+        p += 8;
+    }
+    u.nseg_ = static_cast<
+        std::size_t>(ul::load64(p));
+    p += 8;
+    u.nparam_ = static_cast<
+        std::size_t>(ul::load64(p));
+    p += 8;
+    auto const b = reinterpret_cast<
+        unsigned char const*>(p);
+    u.port_number_ = static_cast<
+        std::uint16_t>(b[0] | (b[1] << 8));
+    u.host_type_ = static_cast<
+        host_type>(b[2]);
+    u.scheme_ = static_cast<
+        scheme>(b[3]);
+    std::memcpy(u.ip_addr_,
+        p + 4, sizeof(u.ip_addr_));
+    u.cs_ = p + 4 + sizeof(u.ip_addr_);
+    BOOST_ASSERT(u.cs_ ==
+        first + detail::ui::header_size);
+    (void)first;
+}
+
+} // (anon)
+
+std::size_t
+url_image_size(
+    url_view_base const& u) noexcept
+{
+    return detail::ui::header_size +
+        detail::url_image::impl(u).offset(
+            id::id_end);
+}
+
+system::result<std::size_t>
+write_url_image(
+    url_view_base const& u,
+    char* dest,
+    std::size_t size) noexcept
+{
+    namespace ul = detail::ul;
+    auto const& impl =
+        detail::url_image::impl(u);
+    auto const n = url_image_size(u);
+    if(size < n)
+    {
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+    }
+    char* p = dest;
+    std::memcpy(p, detail::ui::magic, 4);
+    ul::store32(p + 4, detail::ui::version);
+    p += 8;
+    for(int i = 0; i <= id::id_end; ++i)
+    {
+        ul::store64(p, impl.offset_[i]);
+        p += 8;
+    }
+    for(int i = 0; i < id::id_end; ++i)
+    {
+        ul::store64(p, impl.decoded_[i]);
+        p += 8;
+    }
+    ul::store64(p, impl.nseg_);
+    p += 8;
+    ul::store64(p, impl.nparam_);
+    p += 8;
+    p[0] = static_cast<char>(
+        impl.port_number_ & 0xff);
+    p[1] = static_cast<char>(
+        impl.port_number_ >> 8);
+    p[2] = static_cast<char>(
+        impl.host_type_);
+    p[3] = static_cast<char>(
+        impl.scheme_);
+    std::memcpy(p + 4, impl.ip_addr_,
+        sizeof(impl.ip_addr_));
+    p += 4 + sizeof(impl.ip_addr_);
+    BOOST_ASSERT(static_cast<std::size_t>(
+        p - dest) == detail::ui::header_size);
+    // the buffer of an empty url
+    // can be a null pointer
+    auto const len = impl.offset(id::id_end);
+    if(len > 0)
+        std::memcpy(p, impl.cs_, len);
+    return n;
+}
+
+std::string
+make_url_image(
+    url_view_base const& u)
+{
+    std::string s(url_image_size(u), '\0');
+    auto rv = write_url_image(
+        u, &s[0], s.size());
+    BOOST_ASSERT(rv.has_value());
+    (void)rv;
+    return s;
+}
+
+system::result<url_view>
+read_url_image(
+    core::string_view image) noexcept
+{
+    if(image.size() < detail::ui::header_size)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    if( std::memcmp(image.data(),
+            detail::ui::magic, 4) != 0 ||
+        detail::ul::load32(image.data() + 4) !=
+            detail::ui::version)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    detail::url_impl u(
+        detail::url_impl::from::string);
+    read_header(image.data(), u);
+
+    // offsets are ascending and end
+    // at the last character, and no
+    // part decodes to more characters
+    // than it has
+    if(u.offset_[id::id_end] != image.size() -
+        detail::ui::header_size)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    for(int i = id::id_scheme; i < id::id_end; ++i)
+    {
+        if(u.offset(i) > u.offset(i + 1))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+    }
+    for(int i = id::id_user; i < id::id_end; ++i)
+    {
+        if(u.decoded_[i] > u.len(i))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+    }
+    if( u.nseg_ > u.len(id::id_path) ||
+        u.nparam_ > u.len(id::id_query) ||
+        static_cast<unsigned>(u.host_type_) >
+            static_cast<unsigned>(
+                host_type::ipvfuture) ||
+        static_cast<unsigned>(u.scheme_) >
+            static_cast<unsigned>(scheme::wss))
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    return u.construct();
+}
+
+url_view
+read_url_image_unchecked(
+    core::string_view image) noexcept
+{
+    BOOST_ASSERT(
+        image.size() >= detail::ui::header_size);
+    detail::url_impl u(
+        detail::url_impl::from::string);
+    read_header(image.data(), u);
+    BOOST_ASSERT(u.offset_[id::id_end] ==
+        image.size() - detail::ui::header_size);
+    return u.construct();
+}
+
+} // urls
+} // boost
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_index.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+url_index::
+url_index(
+    url_view_base const& u)
+{
+    assign(u);
+}
+
+url_index::
+url_index(
+    url_index const& other)
+{
+    *this = other;
+}
+
+url_index&
+url_index::
+operator=(
+    url_index const& other)
+{
+    if(this == &other)
+        return *this;
+    auto const n =
+        other.nseg_ * seg_words +
+        other.nparam_ * param_words;
+    reserve(n);
+    std::copy(other.p_, other.p_ + n, p_);
+    data_ = other.data_;
+    nseg_ = other.nseg_;
+    nparam_ = other.nparam_;
+    return *this;
+}
+
+url_index::
+~url_index()
+{
+    if(p_ != inline_)
+        delete[] p_;
+}
+
+void
+url_index::
+reserve(std::size_t n)
+{
+    if(n <= cap_)
+        return;
+    auto p = new std::size_t[n];
+    if(p_ != inline_)
+        delete[] p_;
+    p_ = p;
+    cap_ = n;
+}
+
+void
+url_index::
+assign(
+    url_view_base const& u)
+{
+    auto const segs = u.encoded_segments();
+    auto const params = u.encoded_params();
+    auto const nseg = segs.size();
+    auto const nparam = params.size();
+    reserve(
+        nseg * seg_words +
+        nparam * param_words);
+    data_ = u.data();
+    nseg_ = nseg;
+    nparam_ = nparam;
+
+    // every string views the
+    // characters of the URL
+    auto const offset = [this](
+        core::string_view s) noexcept
+    {
+        return static_cast<std::size_t>(
+            s.data() - data_);
+    };
+    auto e = p_;
+    for(pct_string_view s : segs)
+    {
+        e[0] = offset(s);
+        e[1] = s.size();
+        e[2] = s.decoded_size();
+        e += seg_words;
+    }
+    for(param_pct_view p : params)
+    {
+        e[0] = offset(p.key);
+        e[1] = p.key.size();
+        e[2] = p.key.decoded_size();
+        if(p.has_value)
+        {
+            e[3] = offset(p.value);
+            e[4] = p.value.size();
+            e[5] = p.value.decoded_size();
+        }
+        else
+        {
+            // views the end of the key
+            e[3] = e[0] + e[1];
+            e[4] = 0;
+            e[5] = 0;
+        }
+        e[6] = p.has_value;
+        e += param_words;
+    }
+}
+
+} // urls
+} // boost
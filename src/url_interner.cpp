@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_interner.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include "detail/url_image.hpp"
+#include <boost/assert.hpp>
+#include <cstring>
+#include <new>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+struct key
+{
+    url_view_base const& u;
+
+    // the normalized copy
+    url const* v;
+};
+
+bool
+equal(
+    void const* rec,
+    void const* k) noexcept
+{
+    auto const& impl = *static_cast<
+        detail::url_impl const*>(rec);
+    return impl.construct() ==
+        static_cast<key const*>(k)->u;
+}
+
+} // (anon)
+
+constexpr url_interner::id_type url_interner::npos;
+
+auto
+url_interner::
+intern(url_view_base const& u) ->
+    id_type
+{
+    std::uint64_t const fp =
+        u.fingerprint();
+    key k{u, nullptr};
+    id_type const id =
+        t_.find(fp, &equal, &k);
+    if(id != npos)
+        return id;
+
+    // normalize outside the lock
+    url v(u);
+    v.normalize();
+    k.v = &v;
+
+    // the record is the url_impl of the
+    // normalized url, then its characters
+    return t_.insert(fp, &equal, &k,
+        sizeof(detail::url_impl) + v.size() + 1,
+        [](void* p, void const* pk)
+        {
+            url const& v = *static_cast<
+                key const*>(pk)->v;
+            auto* impl = ::new(p) detail::url_impl(
+                detail::url_image::impl(v));
+            char* s = reinterpret_cast<
+                char*>(impl + 1);
+            std::memcpy(s, impl->cs_, v.size());
+            s[v.size()] = '\0';
+            impl->cs_ = s;
+            impl->from_ =
+                detail::url_impl::from::string;
+        });
+}
+
+auto
+url_interner::
+find(url_view_base const& u) const noexcept ->
+    id_type
+{
+    key const k{u, nullptr};
+    return t_.find(
+        u.fingerprint(), &equal, &k);
+}
+
+url_view
+url_interner::
+view(id_type id) const noexcept
+{
+    BOOST_ASSERT(id < size());
+    return static_cast<detail::url_impl const*>(
+        t_.get(id))->construct();
+}
+
+} // urls
+} // boost
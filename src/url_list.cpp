@@ -0,0 +1,402 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_list.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "detail/url_list.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// An entry of the list
+struct entry
+{
+    std::size_t shared;
+    std::size_t n;
+    char const* p;
+};
+
+// Reads the entry at it and moves it
+// past the entry, returns false if the
+// entry does not fit in [it, end)
+bool
+read_entry(
+    char const*& it,
+    char const* end,
+    entry& e) noexcept
+{
+    namespace ul = detail::ul;
+    std::uint64_t shared;
+    std::uint64_t n;
+    if( ! ul::load_varint(it, end, shared) ||
+        ! ul::load_varint(it, end, n) ||
+        n > static_cast<std::uint64_t>(end - it))
+        return false;
+    e.shared = static_cast<std::size_t>(shared);
+    e.n = static_cast<std::size_t>(n);
+    e.p = it;
+    it += e.n;
+    return true;
+}
+
+// The length of the common prefix of
+// two strings
+std::size_t
+mismatch(
+    core::string_view a,
+    core::string_view b) noexcept
+{
+    std::size_t const n =
+        (std::min)(a.size(), b.size());
+    std::size_t i = 0;
+    while( i < n &&
+        a[i] == b[i])
+        ++i;
+    return i;
+}
+
+// Make room for n more characters,
+// growing geometrically
+void
+grow(
+    std::string& s,
+    std::size_t n)
+{
+    if(s.capacity() - s.size() >= n)
+        return;
+    s.reserve((std::max)(
+        s.size() + n,
+        2 * s.capacity()));
+}
+
+} // (anon)
+
+//------------------------------------------------
+//
+// url_list_view
+//
+//------------------------------------------------
+
+url_list_view::
+url_list_view(
+    core::string_view data)
+    : data_(data)
+{
+    namespace ul = detail::ul;
+    if(data.size() < ul::footer_size)
+        detail::throw_invalid_argument();
+    char const* const f =
+        data.data() + data.size() -
+        ul::footer_size;
+    if( std::memcmp(f + 24,
+            ul::magic, sizeof(ul::magic)) != 0 ||
+        ul::load32(f + 20) != ul::version)
+        detail::throw_invalid_argument();
+    std::uint64_t const n = ul::load64(f);
+    std::uint64_t const entries = ul::load64(f + 8);
+    std::uint32_t const interval = ul::load32(f + 16);
+    if( interval == 0 ||
+        interval > ul::max_interval ||
+        entries > data.size())
+        detail::throw_invalid_argument();
+    std::uint64_t const restarts =
+        n == 0 ? 0 : (n - 1) / interval + 1;
+    // every entry has at least two characters
+    if( n > entries / 2 ||
+        entries + restarts * ul::restart_size +
+            ul::footer_size != data.size())
+        detail::throw_invalid_argument();
+    size_ = static_cast<std::size_t>(n);
+    entries_size_ = static_cast<std::size_t>(entries);
+    interval_ = interval;
+}
+
+system::result<url_view>
+url_list_view::
+get(
+    std::size_t i,
+    char* dest,
+    std::size_t size) const noexcept
+{
+    namespace ul = detail::ul;
+    BOOST_ASSERT(i < size_);
+    if(i >= size_)
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+
+    // read the entries from the restart
+    // point, without their characters
+    std::size_t const block = i / interval_;
+    std::uint64_t const pos = ul::load64(
+        data_.data() + entries_size_ +
+        block * ul::restart_size);
+    if(pos >= entries_size_)
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    char const* it = data_.data() + pos;
+    char const* const end =
+        data_.data() + entries_size_;
+    entry e[ul::max_interval];
+    std::size_t const m =
+        i - block * interval_ + 1;
+    std::size_t len = 0;
+    for(std::size_t j = 0; j < m; ++j)
+    {
+        if( ! read_entry(it, end, e[j]) ||
+            e[j].shared > len)
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        len = e[j].shared + e[j].n;
+    }
+    if(len > size)
+        BOOST_URL_RETURN_EC(
+            error::no_space);
+
+    // copy each character once, from the
+    // last entry which stores it
+    std::size_t need = len;
+    for(std::size_t j = m; need > 0; --j)
+    {
+        entry const& ej = e[j - 1];
+        if(need > ej.shared)
+        {
+            std::memcpy(
+                dest + ej.shared, ej.p,
+                need - ej.shared);
+            need = ej.shared;
+        }
+    }
+    return parse_uri_reference(
+        core::string_view(dest, len));
+}
+
+url_view
+url_list_view::
+get(
+    std::size_t i,
+    std::string& dest) const
+{
+    for(;;)
+    {
+        dest.resize(dest.capacity());
+        auto rv = get(i, &dest[0], dest.size());
+        if(rv)
+        {
+            dest.resize(rv->size());
+            // the view references the
+            // same characters
+            return *rv;
+        }
+        if(rv.error() != error::no_space)
+            detail::throw_system_error(rv.error());
+        dest.resize(2 * dest.size() + 64);
+    }
+}
+
+std::size_t
+url_list_view::
+lower_bound(
+    core::string_view s) const noexcept
+{
+    namespace ul = detail::ul;
+    if(size_ == 0)
+        return 0;
+    char const* const end =
+        data_.data() + entries_size_;
+    std::size_t const restarts =
+        (size_ - 1) / interval_ + 1;
+
+    // the entry at a restart point
+    auto restart = [&](
+        std::size_t b,
+        entry& e) noexcept
+    {
+        std::uint64_t const pos = ul::load64(
+            data_.data() + entries_size_ +
+            b * ul::restart_size);
+        if(pos >= entries_size_)
+            return false;
+        char const* it = data_.data() + pos;
+        return
+            read_entry(it, end, e) &&
+            e.shared == 0;
+    };
+
+    // the last block which starts
+    // with a url less than s
+    std::size_t lo = 0;
+    std::size_t hi = restarts;
+    while(lo < hi)
+    {
+        std::size_t const mid = lo + (hi - lo) / 2;
+        entry e;
+        if(! restart(mid, e))
+            return size_;
+        if(core::string_view(e.p, e.n) < s)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if(lo == 0)
+        return 0;
+    std::size_t const block = lo - 1;
+
+    // scan the block, keeping the length
+    // of the prefix which the previous
+    // url, less than s, shares with s
+    std::uint64_t const pos = ul::load64(
+        data_.data() + entries_size_ +
+        block * ul::restart_size);
+    if(pos >= entries_size_)
+        return size_;
+    char const* it = data_.data() + pos;
+    std::size_t const first = block * interval_;
+    std::size_t const last = (std::min)(
+        first + interval_, size_);
+    std::size_t common = 0;
+    for(std::size_t i = first; i < last; ++i)
+    {
+        entry e;
+        if(! read_entry(it, end, e))
+            return size_;
+        if(e.shared > common)
+        {
+            // the url agrees with the
+            // previous one where it
+            // is less than s
+            continue;
+        }
+        if(e.shared < common)
+        {
+            // the url differs from the
+            // previous one, and from s,
+            // at a greater character
+            return i;
+        }
+        core::string_view const rest =
+            s.substr(common);
+        core::string_view const suffix(e.p, e.n);
+        std::size_t const k =
+            mismatch(rest, suffix);
+        if(k == suffix.size())
+        {
+            // the url is a prefix of s
+            if(k == rest.size())
+                return i;
+            common += k;
+            continue;
+        }
+        if( k == rest.size() ||
+            static_cast<unsigned char>(suffix[k]) >
+            static_cast<unsigned char>(rest[k]))
+            return i;
+        common += k;
+    }
+    return last;
+}
+
+//------------------------------------------------
+//
+// url_list_builder
+//
+//------------------------------------------------
+
+url_list_builder::
+url_list_builder(
+    std::size_t restart_interval)
+    : interval_(restart_interval)
+{
+    if( restart_interval == 0 ||
+        restart_interval > detail::ul::max_interval)
+        detail::throw_invalid_argument();
+}
+
+void
+url_list_builder::
+push_back(url_view_base const& u)
+{
+    namespace ul = detail::ul;
+    core::string_view const s = u.buffer();
+    if( size_ != 0 &&
+        s < core::string_view(last_))
+        detail::throw_invalid_argument();
+    bool const is_restart =
+        size_ % interval_ == 0;
+    std::size_t const shared =
+        is_restart ? 0 : mismatch(last_, s);
+
+    // allocate first, so the
+    // rest cannot throw
+    grow(entries_,
+        2 * ul::max_varint_size +
+        s.size() - shared);
+    if(is_restart)
+        grow(restarts_, ul::restart_size);
+    last_.reserve(s.size());
+
+    if(is_restart)
+    {
+        char buf[ul::restart_size];
+        ul::store64(buf, entries_.size());
+        restarts_.append(buf, sizeof(buf));
+    }
+    char buf[2 * ul::max_varint_size];
+    std::size_t n = ul::store_varint(
+        buf, shared);
+    n += ul::store_varint(
+        buf + n, s.size() - shared);
+    entries_.append(buf, n);
+    entries_.append(
+        s.data() + shared,
+        s.size() - shared);
+    last_.assign(s.data(), s.size());
+    ++size_;
+}
+
+std::string
+url_list_builder::
+release()
+{
+    namespace ul = detail::ul;
+    std::uint64_t const entries =
+        entries_.size();
+    entries_.reserve(
+        entries_.size() +
+        restarts_.size() +
+        ul::footer_size);
+    entries_.append(restarts_);
+    char f[ul::footer_size];
+    ul::store64(f, size_);
+    ul::store64(f + 8, entries);
+    ul::store32(f + 16,
+        static_cast<std::uint32_t>(interval_));
+    ul::store32(f + 20, ul::version);
+    std::memcpy(f + 24,
+        ul::magic, sizeof(ul::magic));
+    entries_.append(f, sizeof(f));
+    std::string s = std::move(entries_);
+    entries_.clear();
+    restarts_.clear();
+    last_.clear();
+    size_ = 0;
+    return s;
+}
+
+} // urls
+} // boost
+
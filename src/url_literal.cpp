@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_literal.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/url/scheme.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+url_literal::
+operator url_view() const noexcept
+{
+    using id = detail::parts_base;
+    detail::url_impl u(
+        detail::url_impl::from::string);
+    u.cs_ = s_;
+    std::memcpy(u.offset_,
+        p_.offset, sizeof(u.offset_));
+    std::memcpy(u.decoded_,
+        p_.decoded, sizeof(u.decoded_));
+    std::memcpy(u.ip_addr_,
+        p_.ip_addr, sizeof(u.ip_addr_));
+    u.nseg_ = p_.nseg;
+    u.nparam_ = p_.nparam;
+    u.port_number_ = p_.port_number;
+    u.host_type_ = p_.host_type;
+    auto const n = p_.len(id::id_scheme);
+    if(n > 0)
+        u.scheme_ = string_to_scheme(
+            core::string_view(s_, n - 1));
+    return u.construct();
+}
+
+} // urls
+} // boost
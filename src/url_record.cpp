@@ -0,0 +1,476 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_record.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/scheme.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "detail/url_list.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+using kind = url_dictionary::kind;
+
+enum : unsigned
+{
+    has_scheme      = 0x01,
+    has_authority   = 0x02,
+    has_userinfo    = 0x04,
+    has_port        = 0x08,
+    has_query       = 0x10,
+    has_fragment    = 0x20,
+    is_absolute     = 0x40
+};
+
+void
+put_varint(
+    std::string& dest,
+    std::uint64_t v)
+{
+    char buf[detail::ul::max_varint_size];
+    dest.append(buf,
+        detail::ul::store_varint(buf, v));
+}
+
+void
+put_string(
+    std::string& dest,
+    core::string_view s)
+{
+    put_varint(dest, s.size());
+    dest.append(s.data(), s.size());
+}
+
+// An identifier plus one, or zero
+// followed by the string
+void
+put_token(
+    std::string& dest,
+    url_dictionary const& d,
+    kind k,
+    core::string_view s)
+{
+    auto const id = d.find(k, s);
+    if(id != url_dictionary::npos)
+        return put_varint(dest,
+            std::uint64_t(id) + 1);
+    put_varint(dest, 0);
+    put_string(dest, s);
+}
+
+// Returns true if the segments,
+// joined with slashes, are the
+// characters of the path. The
+// prefixes which the segments
+// hide, such as "/." before a
+// path starting with "//", are
+// not.
+bool
+is_tokenized(
+    core::string_view path,
+    segments_encoded_view const& ss,
+    bool absolute) noexcept
+{
+    char const* p = path.data() +
+        (absolute ? 1 : 0);
+    char const* const end =
+        path.data() + path.size();
+    bool first = true;
+    for(auto s : ss)
+    {
+        if(! first)
+        {
+            if(p == end || *p != '/')
+                return false;
+            ++p;
+        }
+        first = false;
+        if(s.data() != p)
+            return false;
+        p += s.size();
+    }
+    return p == end;
+}
+
+bool
+is_tokenized(
+    core::string_view query,
+    params_encoded_view const& ps) noexcept
+{
+    char const* p = query.data();
+    char const* const end =
+        query.data() + query.size();
+    bool first = true;
+    for(auto const& q : ps)
+    {
+        if(! first)
+        {
+            if(p == end || *p != '&')
+                return false;
+            ++p;
+        }
+        first = false;
+        if(q.key.data() != p)
+            return false;
+        p += q.key.size();
+        if(q.has_value)
+        {
+            if(p == end || *p != '=')
+                return false;
+            p += 1 + q.value.size();
+        }
+    }
+    return p == end;
+}
+
+// Reads a record into the arena
+class reader
+{
+    char const* it_;
+    char const* end_;
+    url_dictionary const& d_;
+    std::string& s_;
+
+    system::error_code
+    varint(std::uint64_t& v) noexcept
+    {
+        if(! detail::ul::load_varint(
+                it_, end_, v))
+            return grammar::error::need_more;
+        return {};
+    }
+
+    system::error_code
+    string()
+    {
+        std::uint64_t n;
+        if( ! detail::ul::load_varint(
+                it_, end_, n) ||
+            n > static_cast<std::uint64_t>(
+                end_ - it_))
+            return grammar::error::need_more;
+        s_.append(it_, static_cast<
+            std::size_t>(n));
+        it_ += n;
+        return {};
+    }
+
+    // an identifier plus one, or
+    // zero followed by the string
+    system::error_code
+    token(
+        kind k,
+        std::uint64_t v)
+    {
+        if(v == 0)
+            return string();
+        if(v > d_.size(k))
+            return grammar::error::invalid;
+        s_.append(d_.get(k, static_cast<
+            url_dictionary::id_type>(v - 1)));
+        return {};
+    }
+
+    system::error_code
+    token(kind k)
+    {
+        std::uint64_t v;
+        auto ec = varint(v);
+        if(ec.failed())
+            return ec;
+        return token(k, v);
+    }
+
+    system::error_code
+    scheme_part()
+    {
+        std::uint64_t v;
+        auto ec = varint(v);
+        if(ec.failed())
+            return ec;
+        if(v == 0)
+            ec = string();
+        else if(
+            v < static_cast<std::uint64_t>(scheme::ftp) ||
+            v > static_cast<std::uint64_t>(scheme::wss))
+            ec = grammar::error::invalid;
+        else
+            s_.append(to_string(
+                static_cast<scheme>(v)));
+        s_.push_back(':');
+        return ec;
+    }
+
+    system::error_code
+    path_part(bool absolute)
+    {
+        std::uint64_t v;
+        auto ec = varint(v);
+        if(ec.failed())
+            return ec;
+        if(v == 0)
+            return string();
+        if(absolute)
+            s_.push_back('/');
+        for(std::uint64_t i = 1; i < v; ++i)
+        {
+            if(i > 1)
+                s_.push_back('/');
+            ec = token(kind::segment);
+            if(ec.failed())
+                return ec;
+        }
+        return {};
+    }
+
+    system::error_code
+    query_part()
+    {
+        s_.push_back('?');
+        std::uint64_t v;
+        auto ec = varint(v);
+        if(ec.failed())
+            return ec;
+        if(v == 0)
+            return string();
+        for(std::uint64_t i = 1; i < v; ++i)
+        {
+            if(i > 1)
+                s_.push_back('&');
+            std::uint64_t tag;
+            ec = varint(tag);
+            if(ec.failed())
+                return ec;
+            ec = token(kind::key, tag >> 1);
+            if(ec.failed())
+                return ec;
+            if(tag & 1)
+            {
+                s_.push_back('=');
+                ec = string();
+                if(ec.failed())
+                    return ec;
+            }
+        }
+        return {};
+    }
+
+public:
+    reader(
+        core::string_view data,
+        url_dictionary const& d,
+        std::string& s) noexcept
+        : it_(data.data())
+        , end_(data.data() + data.size())
+        , d_(d)
+        , s_(s)
+    {
+    }
+
+    char const*
+    pos() const noexcept
+    {
+        return it_;
+    }
+
+    system::error_code
+    record()
+    {
+        s_.clear();
+        if(it_ == end_)
+            return grammar::error::need_more;
+        auto const flags = static_cast<
+            unsigned char>(*it_++);
+        system::error_code ec;
+        if(flags & has_scheme)
+        {
+            ec = scheme_part();
+            if(ec.failed())
+                return ec;
+        }
+        if(flags & has_authority)
+        {
+            s_.append("//", 2);
+            if(flags & has_userinfo)
+            {
+                ec = string();
+                if(ec.failed())
+                    return ec;
+                s_.push_back('@');
+            }
+            ec = token(kind::host);
+            if(ec.failed())
+                return ec;
+            if(flags & has_port)
+            {
+                s_.push_back(':');
+                ec = string();
+                if(ec.failed())
+                    return ec;
+            }
+        }
+        ec = path_part(
+            (flags & is_absolute) != 0);
+        if(ec.failed())
+            return ec;
+        if(flags & has_query)
+        {
+            ec = query_part();
+            if(ec.failed())
+                return ec;
+        }
+        if(flags & has_fragment)
+        {
+            s_.push_back('#');
+            ec = string();
+        }
+        return ec;
+    }
+};
+
+} // (anon)
+
+void
+url_record_writer::
+write(
+    url_view_base const& u,
+    std::string& dest) const
+{
+    auto const ss = u.encoded_segments();
+    auto const ps = u.encoded_params();
+    std::size_t const nparam =
+        u.has_query() ? ps.size() : 0;
+
+    // allocate first, so the
+    // rest cannot throw
+    std::size_t const n = dest.size();
+    std::size_t const max = 1 + u.size() +
+        detail::ul::max_varint_size * (
+            11 + 2 * ss.size() + 3 * nparam);
+    if(dest.capacity() - n < max)
+        dest.reserve((std::max)(
+            n + max, 2 * dest.capacity()));
+
+    unsigned flags = 0;
+    if(u.has_scheme())
+        flags |= has_scheme;
+    if(u.has_authority())
+        flags |= has_authority;
+    if(u.has_userinfo())
+        flags |= has_userinfo;
+    if(u.has_port())
+        flags |= has_port;
+    if(u.has_query())
+        flags |= has_query;
+    if(u.has_fragment())
+        flags |= has_fragment;
+    if(u.is_path_absolute())
+        flags |= is_absolute;
+    dest.push_back(static_cast<char>(flags));
+
+    if(u.has_scheme())
+    {
+        // the enum is only used when
+        // the case matches
+        scheme const id = u.scheme_id();
+        if( id != scheme::unknown &&
+            u.scheme() == to_string(id))
+        {
+            put_varint(dest,
+                static_cast<unsigned>(id));
+        }
+        else
+        {
+            put_varint(dest, 0);
+            put_string(dest, u.scheme());
+        }
+    }
+    if(u.has_authority())
+    {
+        if(u.has_userinfo())
+            put_string(dest, u.encoded_userinfo());
+        put_token(dest, *d_,
+            kind::host, u.encoded_host());
+        if(u.has_port())
+            put_string(dest, u.port());
+    }
+    core::string_view const path =
+        u.encoded_path();
+    if(is_tokenized(path, ss,
+        u.is_path_absolute()))
+    {
+        put_varint(dest, ss.size() + 1);
+        for(auto s : ss)
+            put_token(dest, *d_,
+                kind::segment, s);
+    }
+    else
+    {
+        put_varint(dest, 0);
+        put_string(dest, path);
+    }
+    if(u.has_query())
+    {
+        core::string_view const query =
+            u.encoded_query();
+        if(is_tokenized(query, ps))
+        {
+            put_varint(dest, nparam + 1);
+            for(auto const& q : ps)
+            {
+                auto const id = d_->find(
+                    kind::key, q.key);
+                std::uint64_t const tag =
+                    id != url_dictionary::npos ?
+                        std::uint64_t(id) + 1 : 0;
+                put_varint(dest, (tag << 1) |
+                    (q.has_value ? 1 : 0));
+                if(tag == 0)
+                    put_string(dest, q.key);
+                if(q.has_value)
+                    put_string(dest, q.value);
+            }
+        }
+        else
+        {
+            put_varint(dest, 0);
+            put_string(dest, query);
+        }
+    }
+    if(u.has_fragment())
+        put_string(dest, u.encoded_fragment());
+    BOOST_ASSERT(dest.size() - n <= max);
+}
+
+system::result<url_view>
+url_record_reader::
+read(core::string_view& data)
+{
+    reader r(data, *d_, arena_);
+    auto const ec = r.record();
+    if(ec.failed())
+        return ec;
+    auto u = parse_uri_reference(arena_);
+    if(! u)
+        return u.error();
+    data.remove_prefix(static_cast<
+        std::size_t>(r.pos() - data.data()));
+    return *u;
+}
+
+} // urls
+} // boost
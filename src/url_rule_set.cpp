@@ -0,0 +1,499 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_RULE_SET_IPP
+#define BOOST_URL_IMPL_URL_RULE_SET_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_rule_set.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// FNV-1a, one character at a time
+inline
+std::size_t
+hash_char(
+    std::size_t h,
+    char c) noexcept
+{
+    return (h ^ static_cast<
+        unsigned char>(c)) * 16777619u;
+}
+
+inline
+std::size_t
+hash_parent(std::size_t parent) noexcept
+{
+    return (2166136261u ^ parent) * 16777619u;
+}
+
+// Split the rightmost label from a host
+core::string_view
+pop_label(core::string_view& s) noexcept
+{
+    auto const dot = s.rfind('.');
+    if(dot == core::string_view::npos)
+    {
+        auto r = s;
+        s = {};
+        return r;
+    }
+    auto r = s.substr(dot + 1);
+    s = s.substr(0, dot);
+    return r;
+}
+
+// The same, for an encoded host,
+// where a dot may be escaped
+core::string_view
+pop_encoded_label(core::string_view& s) noexcept
+{
+    auto i = s.size();
+    while(i > 0)
+    {
+        --i;
+        if(s[i] == '.')
+        {
+            auto r = s.substr(i + 1);
+            s = s.substr(0, i);
+            return r;
+        }
+        if( s[i] == '%' &&
+            s[i + 1] == '2' && (
+                s[i + 2] == 'E' ||
+                s[i + 2] == 'e'))
+        {
+            auto r = s.substr(i + 3);
+            s = s.substr(0, i);
+            return r;
+        }
+    }
+    auto r = s;
+    s = {};
+    return r;
+}
+
+// Split the leftmost segment from a path
+core::string_view
+pop_segment(core::string_view& s) noexcept
+{
+    auto const slash = s.find('/');
+    if(slash == core::string_view::npos)
+    {
+        auto r = s;
+        s = {};
+        return r;
+    }
+    auto r = s.substr(0, slash);
+    s = s.substr(slash + 1);
+    return r;
+}
+
+core::string_view
+trim_host(core::string_view s) noexcept
+{
+    if(s.ends_with('.'))
+        s.remove_suffix(1);
+    return s;
+}
+
+} // (anon)
+
+// The decoded characters of a label
+// or segment, which is either plain
+// or percent-encoded, and is folded
+// to lower case for hosts
+struct url_rule_set::cursor
+{
+    char const* p;
+    char const* end;
+    bool encoded;
+    bool lower;
+
+    bool
+    done() const noexcept
+    {
+        return p == end;
+    }
+
+    char
+    next() noexcept
+    {
+        char c = *p++;
+        if(encoded && c == '%')
+        {
+            // escapes are valid
+            c = static_cast<char>(
+                (grammar::hexdig_value(p[0]) << 4) +
+                grammar::hexdig_value(p[1]));
+            p += 2;
+        }
+        if(lower)
+            c = grammar::to_lower(c);
+        return c;
+    }
+};
+
+std::size_t
+url_rule_set::
+child(
+    std::size_t parent,
+    cursor c) const noexcept
+{
+    if(table_.empty())
+        return 0;
+    auto const c0 = c;
+    std::size_t h = hash_parent(parent);
+    std::size_t n = 0;
+    while(! c.done())
+    {
+        h = hash_char(h, c.next());
+        ++n;
+    }
+    auto const mask = table_.size() - 1;
+    for(auto i = h & mask;
+        table_[i].node != 0;
+        i = (i + 1) & mask)
+    {
+        if(table_[i].hash != h)
+            continue;
+        auto const& nd = nodes_[table_[i].node];
+        if( nd.parent != parent ||
+            nd.size != n)
+            continue;
+        c = c0;
+        auto k = keys_.data() + nd.key;
+        while(! c.done() && c.next() == *k)
+            ++k;
+        if(k == keys_.data() + nd.key + n)
+            return table_[i].node;
+    }
+    return 0;
+}
+
+void
+url_rule_set::
+rehash(std::size_t n)
+{
+    std::size_t slots = 1;
+    while(slots < 2 * n)
+        slots *= 2;
+    std::vector<slot> table(slots);
+    for(std::size_t i = 1; i < nodes_.size(); ++i)
+    {
+        auto const& nd = nodes_[i];
+        if(nodes_[nd.parent].paths == i)
+            continue;
+        std::size_t h = hash_parent(nd.parent);
+        for(std::size_t j = 0; j < nd.size; ++j)
+            h = hash_char(h, keys_[nd.key + j]);
+        auto pos = h & (slots - 1);
+        while(table[pos].node != 0)
+            pos = (pos + 1) & (slots - 1);
+        table[pos].hash = h;
+        table[pos].node = i;
+    }
+    table_ = std::move(table);
+}
+
+void
+url_rule_set::
+link(std::size_t i) noexcept
+{
+    auto const& nd = nodes_[i];
+    std::size_t h = hash_parent(nd.parent);
+    for(std::size_t j = 0; j < nd.size; ++j)
+        h = hash_char(h, keys_[nd.key + j]);
+    auto const mask = table_.size() - 1;
+    auto pos = h & mask;
+    while(table_[pos].node != 0)
+        pos = (pos + 1) & mask;
+    table_[pos].hash = h;
+    table_[pos].node = i;
+}
+
+void
+url_rule_set::
+insert(
+    std::size_t id,
+    url_rule const& r)
+{
+    core::string_view host = trim_host(r.host);
+    if(host.starts_with('.'))
+        host.remove_prefix(1);
+    core::string_view path = r.path;
+    if(path.starts_with('/'))
+        path.remove_prefix(1);
+    // a trailing slash requires
+    // one more segment
+    bool const deeper =
+        path.ends_with('/');
+    if(deeper)
+        path.remove_suffix(1);
+
+    // find the existing nodes, and
+    // count what must be added
+    std::size_t host_node = 0;
+    bool host_found = ! nodes_.empty();
+    std::size_t n_new = nodes_.empty();
+    std::size_t n_key = 0;
+    core::string_view rest = host;
+    while(! rest.empty())
+    {
+        auto const label = pop_label(rest);
+        if(host_found)
+        {
+            auto const next = child(host_node, cursor{
+                label.data(), label.data() + label.size(),
+                false, true});
+            if(next != 0)
+            {
+                host_node = next;
+                continue;
+            }
+            host_found = false;
+        }
+        ++n_new;
+        n_key += label.size();
+    }
+    std::size_t path_node = 0;
+    bool path_found = host_found &&
+        nodes_[host_node].paths != 0;
+    if(path_found)
+        path_node = nodes_[host_node].paths;
+    else
+        ++n_new;
+    rest = path;
+    bool more = ! path.empty();
+    while(more)
+    {
+        more = rest.find('/') !=
+            core::string_view::npos;
+        auto const seg = pop_segment(rest);
+        if(path_found)
+        {
+            auto const next = child(path_node, cursor{
+                seg.data(), seg.data() + seg.size(),
+                false, false});
+            if(next != 0)
+            {
+                path_node = next;
+                continue;
+            }
+            path_found = false;
+        }
+        ++n_new;
+        n_key += seg.size();
+    }
+
+    // allocate before anything
+    // changes, for the strong
+    // guarantee
+    auto const n_node = nodes_.size() + n_new;
+    nodes_.reserve(n_node);
+    rules_.reserve(rules_.size() + 1);
+    keys_.reserve(
+        keys_.size() + n_key + r.param.size());
+    if(2 * n_node > table_.size())
+        rehash(n_node);
+
+    // nothing below throws
+    auto const add = [this](
+        std::size_t parent,
+        core::string_view key,
+        bool lower)
+    {
+        node nd;
+        nd.parent = parent;
+        nd.key = keys_.size();
+        nd.size = key.size();
+        for(char c : key)
+            keys_.push_back(lower ?
+                grammar::to_lower(c) : c);
+        nodes_.push_back(nd);
+        auto const i = nodes_.size() - 1;
+        link(i);
+        return i;
+    };
+    if(nodes_.empty())
+        nodes_.emplace_back();
+    std::size_t cur_node = 0;
+    rest = host;
+    while(! rest.empty())
+    {
+        auto const label = pop_label(rest);
+        auto next = child(cur_node, cursor{
+            label.data(), label.data() + label.size(),
+            false, true});
+        if(next == 0)
+            next = add(cur_node, label, true);
+        cur_node = next;
+    }
+    if(nodes_[cur_node].paths == 0)
+    {
+        // a path root has no key, and is
+        // not reachable through the table
+        node nd;
+        nd.parent = cur_node;
+        nd.key = keys_.size();
+        nodes_.push_back(nd);
+        nodes_[cur_node].paths =
+            nodes_.size() - 1;
+    }
+    cur_node = nodes_[cur_node].paths;
+    rest = path;
+    more = ! path.empty();
+    while(more)
+    {
+        more = rest.find('/') !=
+            core::string_view::npos;
+        auto const seg = pop_segment(rest);
+        auto next = child(cur_node, cursor{
+            seg.data(), seg.data() + seg.size(),
+            false, false});
+        if(next == 0)
+            next = add(cur_node, seg, false);
+        cur_node = next;
+    }
+
+    rule ru;
+    ru.id = id;
+    ru.param = keys_.size();
+    ru.param_size = r.param.size();
+    ru.deeper = deeper;
+    ru.next = 0;
+    keys_.append(
+        r.param.data(), r.param.size());
+    rules_.push_back(ru);
+    auto& nd = nodes_[cur_node];
+    if(nd.last != 0)
+        rules_[nd.last - 1].next = rules_.size();
+    else
+        nd.rules = rules_.size();
+    nd.last = rules_.size();
+}
+
+template<class F>
+bool
+url_rule_set::
+visit(
+    url_view_base const& u,
+    F const& f) const
+{
+    if(nodes_.empty())
+        return false;
+
+    // the rules ending at a path node
+    auto const rules = [&](
+        std::size_t n,
+        bool more) -> bool
+    {
+        for(auto i = nodes_[n].rules;
+            i != 0; i = rules_[i - 1].next)
+        {
+            auto const& ru = rules_[i - 1];
+            if(ru.deeper && ! more)
+                continue;
+            if( ru.param_size != 0 &&
+                ! u.params().contains(
+                    core::string_view(
+                        keys_.data() + ru.param,
+                        ru.param_size)))
+                continue;
+            if(f(ru.id))
+                return true;
+        }
+        return false;
+    };
+
+    // the path trie of a host node
+    auto const paths = [&](
+        std::size_t h) -> bool
+    {
+        auto n = nodes_[h].paths;
+        if(n == 0)
+            return false;
+        auto const segs = u.encoded_segments();
+        auto it = segs.begin();
+        auto const end = segs.end();
+        if(rules(n, it != end))
+            return true;
+        while(it != end)
+        {
+            auto const seg = *it++;
+            n = child(n, cursor{
+                seg.data(), seg.data() + seg.size(),
+                true, false});
+            if(n == 0)
+                return false;
+            if(rules(n, it != end))
+                return true;
+        }
+        return false;
+    };
+
+    std::size_t h = 0;
+    if(paths(h))
+        return true;
+    core::string_view rest =
+        u.encoded_host();
+    if(rest.ends_with("%2E") ||
+        rest.ends_with("%2e"))
+        rest.remove_suffix(3);
+    else
+        rest = trim_host(rest);
+    while(! rest.empty())
+    {
+        auto const label = pop_encoded_label(rest);
+        h = child(h, cursor{
+            label.data(), label.data() + label.size(),
+            true, true});
+        if(h == 0)
+            return false;
+        if(paths(h))
+            return true;
+    }
+    return false;
+}
+
+std::size_t
+url_rule_set::
+match(
+    url_view_base const& u,
+    std::vector<std::size_t>& ids) const
+{
+    auto const n0 = ids.size();
+    visit(u, [&ids](std::size_t id)
+    {
+        ids.push_back(id);
+        return false;
+    });
+    return ids.size() - n0;
+}
+
+bool
+url_rule_set::
+match_any(
+    url_view_base const& u) const noexcept
+{
+    return visit(u, [](std::size_t)
+    {
+        return true;
+    });
+}
+
+} // urls
+} // boost
+
+#endif
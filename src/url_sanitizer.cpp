@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_SANITIZER_IPP
+#define BOOST_URL_IMPL_URL_SANITIZER_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_sanitizer.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/scheme.hpp>
+#include "detail/decode.hpp"
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+url_sanitizer&
+url_sanitizer::
+allow_scheme(
+    core::string_view s,
+    std::uint16_t port)
+{
+    if(port == 0)
+        port = default_port(
+            string_to_scheme(s));
+    schemes_.insert(s, port);
+    return *this;
+}
+
+url_sanitizer&
+url_sanitizer::
+deny_param(core::string_view key)
+{
+    denied_.insert(key);
+    return *this;
+}
+
+url_sanitizer&
+url_sanitizer::
+deny_param_prefix(core::string_view prefix)
+{
+    denied_.insert_prefix(prefix);
+    return *this;
+}
+
+//------------------------------------------------
+
+system::result<void>
+url_sanitizer::
+sanitize(
+    url_view_base const& u,
+    url_base& dest) const
+{
+    BOOST_ASSERT(&u !=
+        static_cast<url_view_base*>(&dest));
+    detail::url_impl const& src = *u.pi_;
+    char const* const cs = src.cs_;
+
+    if( ! schemes_.empty() &&
+        ! schemes_.contains(u.scheme()))
+        BOOST_URL_RETURN_EC(
+            error::scheme_not_allowed);
+
+    bool const has_authority =
+        src.len(id_user) != 0;
+    bool const strip =
+        has_authority &&
+        strip_userinfo_;
+    bool keep_port =
+        src.len(id_port) != 0;
+    if( keep_port &&
+        remove_default_port_)
+    {
+        std::uint16_t port =
+            schemes_.default_port(u.scheme());
+        if(port == 0)
+            port = default_port(src.scheme_);
+        keep_port =
+            src.len(id_port) > 1 &&
+            (port == 0 ||
+                src.port_number_ != port);
+    }
+    bool const keep_frag =
+        ! remove_fragment_;
+
+    if(src.offset(id_end) == 0)
+    {
+        dest.clear();
+        return {};
+    }
+
+    // The result is never longer
+    // than the URL, so the storage
+    // is reserved once and written
+    // in a single pass. Characters
+    // are never written ahead of the
+    // ones read, so u may reference
+    // the characters of dest.
+    url_base::op_t op(dest);
+    dest.reserve_impl(
+        src.offset(id_end), op);
+    char* const s = dest.s_;
+    detail::url_impl impl(from::url);
+    std::size_t pos = 0;
+    auto const put = [s, &pos](
+        char const* p, std::size_t n)
+    {
+        std::memmove(s + pos, p, n);
+        pos += n;
+    };
+    auto const keep = [&](int id)
+    {
+        impl.offset_[id] = pos;
+        impl.decoded_[id] = src.decoded_[id];
+        put(cs + src.offset(id), src.len(id));
+    };
+
+    // scheme, the offset is always zero
+    impl.scheme_ = src.scheme_;
+    impl.decoded_[id_scheme] =
+        src.decoded_[id_scheme];
+    put(cs, src.len(id_scheme));
+
+    // userinfo
+    if(strip)
+    {
+        impl.offset_[id_user] = pos;
+        put("//", 2);
+        impl.offset_[id_pass] = pos;
+    }
+    else
+    {
+        keep(id_user);
+        keep(id_pass);
+    }
+
+    // host
+    impl.host_type_ = src.host_type_;
+    impl.host_norm_ = src.host_norm_;
+    std::memcpy(impl.ip_addr_,
+        src.ip_addr_, sizeof(impl.ip_addr_));
+    keep(id_host);
+
+    // port
+    if(keep_port)
+    {
+        impl.port_number_ = src.port_number_;
+        keep(id_port);
+    }
+    else
+    {
+        impl.offset_[id_port] = pos;
+    }
+
+    // path
+    impl.nseg_ = src.nseg_;
+    keep(id_path);
+
+    // query, without the denied params
+    impl.offset_[id_query] = pos;
+    if(src.len(id_query) != 0)
+    {
+        char const* it =
+            cs + src.offset(id_query) + 1;
+        char const* const end =
+            cs + src.offset(id_frag);
+        std::size_t const start = pos;
+        std::size_t nparam = 0;
+        for(;;)
+        {
+            char const* amp = static_cast<
+                char const*>(std::memchr(
+                    it, '&', end - it));
+            if(! amp)
+                amp = end;
+            char const* eq = static_cast<
+                char const*>(std::memchr(
+                    it, '=', amp - it));
+            core::string_view const key(
+                it, (eq ? eq : amp) - it);
+            if(! denied_.match_encoded(
+                make_pct_string_view_unsafe(
+                    key.data(), key.size(),
+                    detail::decode_bytes_unsafe(key))))
+            {
+                put(nparam++ == 0 ? "?" : "&", 1);
+                put(it, amp - it);
+            }
+            if(amp == end)
+                break;
+            it = amp + 1;
+        }
+        if(nparam != 0)
+        {
+            std::size_t const n =
+                pos - start - 1;
+            impl.nparam_ = nparam;
+            impl.decoded_[id_query] = n - 2 *
+                static_cast<std::size_t>(std::count(
+                    s + start + 1, s + pos, '%'));
+        }
+    }
+
+    // fragment
+    if(keep_frag)
+        keep(id_frag);
+    else
+        impl.offset_[id_frag] = pos;
+
+    impl.offset_[id_end] = pos;
+    impl.cs_ = s;
+    dest.impl_ = impl;
+    s[pos] = '\0';
+    return {};
+}
+
+std::size_t
+url_sanitizer::
+sanitize(
+    core::string_view const* first,
+    std::size_t n,
+    url* out) const
+{
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto rv = parse_uri_reference(first[i]);
+        if( rv.has_value() &&
+            sanitize(*rv, out[i]).has_value())
+        {
+            ++count;
+            continue;
+        }
+        out[i].clear();
+    }
+    return count;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_SCANNER_IPP
+#define BOOST_URL_IMPL_URL_SCANNER_IPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_scanner.hpp>
+#include <boost/url/rfc/absolute_uri_rule.hpp>
+#include <boost/url/rfc/gen_delim_chars.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/core/bit.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#elif defined(BOOST_URL_USE_NEON)
+# include <arm_neon.h>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr
+grammar::lut_chars
+scheme_chars(
+    "0123456789" "+-."
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+
+// the characters of an absolute-URI,
+// which has no fragment
+constexpr
+grammar::lut_chars
+uri_chars =
+    pchars + gen_delim_chars + '%' - '#';
+
+// Return the first "://" in [it, last),
+// or last if there is none
+char const*
+find_scheme_sep(
+    char const* it,
+    char const* const last) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const colon = _mm_set1_epi8(':');
+    __m128i const slash = _mm_set1_epi8('/');
+    while(last - it >= 18)
+    {
+        __m128i const v0 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        __m128i const v1 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it + 1));
+        __m128i const v2 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it + 2));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(v0, colon),
+                _mm_and_si128(
+                    _mm_cmpeq_epi8(v1, slash),
+                    _mm_cmpeq_epi8(v2, slash)))));
+        if(m)
+            return it + boost::core::countr_zero(m);
+        it += 16;
+    }
+#elif defined(BOOST_URL_USE_NEON)
+    uint8x16_t const colon = vdupq_n_u8(':');
+    uint8x16_t const slash = vdupq_n_u8('/');
+    while(last - it >= 18)
+    {
+        auto const p = reinterpret_cast<
+            std::uint8_t const*>(it);
+        uint8x16_t const e = vandq_u8(
+            vceqq_u8(vld1q_u8(p), colon),
+            vandq_u8(
+                vceqq_u8(vld1q_u8(p + 1), slash),
+                vceqq_u8(vld1q_u8(p + 2), slash)));
+        // four bits per byte
+        std::uint64_t const m = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(
+                vreinterpretq_u16_u8(e), 4)), 0);
+        if(m)
+            return it + (
+                boost::core::countr_zero(m) >> 2);
+        it += 16;
+    }
+#endif
+    while(last - it >= 3)
+    {
+        it = static_cast<char const*>(
+            std::memchr(it, ':', last - it - 2));
+        if(! it)
+            return last;
+        if( it[1] == '/' &&
+            it[2] == '/')
+            return it;
+        ++it;
+    }
+    return last;
+}
+
+// Remove the punctuation which usually
+// belongs to the surrounding text
+char const*
+trim_end(
+    char const* first,
+    char const* last) noexcept
+{
+    while(last != first)
+    {
+        switch(last[-1])
+        {
+        case '.':
+        case ',':
+        case ';':
+        case ':':
+        case '!':
+        case '?':
+        case '\'':
+            --last;
+            continue;
+        case ')':
+            // unmatched
+            if( std::count(first, last, ')') >
+                std::count(first, last, '('))
+            {
+                --last;
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        break;
+    }
+    return last;
+}
+
+} // (anon)
+
+void
+url_scanner::
+iterator::
+next() noexcept
+{
+    // the scheme can not start
+    // before the previous URL
+    char const* const first = it_;
+    char const* it = it_;
+    for(;;)
+    {
+        char const* const p =
+            find_scheme_sep(it, end_);
+        if(p == end_)
+            break;
+        it = p + 3;
+
+        // scheme
+        char const* s = p;
+        while( s != first &&
+            scheme_chars(s[-1]))
+            --s;
+        while( s != p &&
+            ! grammar::alpha_chars(*s))
+            ++s;
+        if(s == p)
+            continue;
+
+        // hier-part and query
+        char const* e = trim_end(it,
+            grammar::find_if_not(
+                it, end_, uri_chars));
+        if(e == it)
+            continue;
+
+        auto rv = grammar::parse(
+            core::string_view(s, e - s),
+            absolute_uri_rule);
+        if(! rv)
+            continue;
+        u_ = *rv;
+        it_ = e;
+        return;
+    }
+    it_ = nullptr;
+    end_ = nullptr;
+    u_ = url_view();
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_sharder.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/normalize.hpp"
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Jump consistent hash, from
+// "A Fast, Minimal Memory, Consistent
+// Hash Algorithm" by Lamping and Veach
+std::uint32_t
+jump_hash(
+    std::uint64_t key,
+    std::uint32_t n) noexcept
+{
+    std::int64_t b = -1;
+    std::int64_t j = 0;
+    while(j < static_cast<std::int64_t>(n))
+    {
+        b = j;
+        key = key * 2862933555777941757ULL + 1;
+        j = static_cast<std::int64_t>(
+            static_cast<double>(b + 1) * (
+                static_cast<double>(1LL << 31) /
+                static_cast<double>((key >> 33) + 1)));
+    }
+    return static_cast<std::uint32_t>(b);
+}
+
+} // (anon)
+
+url_sharder::
+url_sharder(
+    public_suffix_list_view psl,
+    std::uint32_t shards,
+    std::uint64_t seed)
+    : psl_(psl)
+    , seed_(seed)
+    , n_(shards)
+{
+    if(shards == 0)
+        detail::throw_invalid_argument();
+}
+
+core::string_view
+url_sharder::
+key(url_view_base const& u) const noexcept
+{
+    pct_string_view const host =
+        u.encoded_host();
+    if(u.host_type() != host_type::name)
+        return host;
+    core::string_view const d =
+        psl_.registrable_domain(host);
+    if(d.empty())
+        return host;
+    return d;
+}
+
+std::uint64_t
+url_sharder::
+digest(url_view_base const& u) const noexcept
+{
+    detail::mum_hasher<1> h(seed_);
+    detail::ci_digest_encoded(key(u), h);
+    h.end(0);
+    return h.digest();
+}
+
+std::uint32_t
+url_sharder::
+shard(url_view_base const& u) const noexcept
+{
+    return jump_hash(digest(u), n_);
+}
+
+void
+url_sharder::
+assign(
+    url_view const* urls,
+    std::size_t n,
+    std::vector<std::vector<
+        std::size_t>>& shards) const
+{
+    shards.resize(n_);
+    for(auto& v : shards)
+        v.clear();
+    for(std::size_t i = 0; i < n; ++i)
+        shards[shard(urls[i])].push_back(i);
+}
+
+} // urls
+} // boost
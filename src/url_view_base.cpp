@@ -15,8 +15,12 @@
 #include <boost/url/url_view_base.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/detail/over_allocator.hpp>
+#include <boost/url/grammar/ci_string.hpp>
 #include "detail/normalize.hpp"
-#include "detail/over_allocator.hpp"
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <type_traits>
 
 namespace boost {
 namespace urls {
@@ -48,52 +52,312 @@ digest(std::size_t salt) const noexcept
     detail::ci_digest(pi_->get(id_scheme), h);
     detail::digest_encoded(pi_->get(id_user), h);
     detail::digest_encoded(pi_->get(id_pass), h);
-    detail::ci_digest_encoded(pi_->get(id_host), h);
+    if(pi_->host_norm_)
+        h.put(pi_->get(id_host));
+    else
+        detail::ci_digest_encoded(pi_->get(id_host), h);
     h.put(pi_->get(id_port));
     detail::normalized_path_digest(
-        pi_->get(id_path), is_path_absolute(), h);
+        encoded_segments(), h);
     detail::digest_encoded(pi_->get(id_query), h);
     detail::digest_encoded(pi_->get(id_frag), h);
     return h.digest();
 }
 
-//------------------------------------------------
-//
-// Observers
-//
-//------------------------------------------------
+namespace {
+
+// digest the components as if the url
+// were normalized, consistent with
+// url_view_base::compare
+template<class Hasher>
+void
+normalized_digest(
+    detail::url_impl const& u,
+    segments_encoded_view segs,
+    Hasher& h) noexcept
+{
+    using parts = detail::parts_base;
+    if(u.len(parts::id_scheme) != 0)
+    {
+        auto const s = u.get(parts::id_scheme);
+        detail::ci_digest(
+            s.substr(0, s.size() - 1), h);
+        h.end(parts::id_scheme);
+    }
+    if(u.len(parts::id_user) != 0)
+    {
+        auto const pass = u.get(parts::id_pass);
+        if(! pass.empty())
+        {
+            // userinfo
+            detail::digest_encoded(
+                u.get(parts::id_user).substr(2), h);
+            h.end(parts::id_user);
+            if(pass.size() > 1)
+            {
+                detail::digest_encoded(
+                    pass.substr(1, pass.size() - 2), h);
+                h.end(parts::id_pass);
+            }
+        }
+        if(u.host_norm_)
+            h.put(u.get(parts::id_host));
+        else
+            detail::ci_digest_encoded(
+                u.get(parts::id_host), h);
+        h.end(parts::id_host);
+        auto const port = u.get(parts::id_port);
+        if(! port.empty())
+        {
+            h.put(port.substr(1));
+            h.end(parts::id_port);
+        }
+    }
+    detail::normalized_path_digest(
+        segs, h);
+    h.end(parts::id_path);
+    auto const query = u.get(parts::id_query);
+    if(! query.empty())
+    {
+        detail::digest_encoded(
+            query.substr(1), h);
+        h.end(parts::id_query);
+    }
+    auto const frag = u.get(parts::id_frag);
+    if(! frag.empty())
+    {
+        detail::digest_encoded(
+            frag.substr(1), h);
+        h.end(parts::id_frag);
+    }
+}
+
+} // (anon)
+
+std::uint64_t
+url_view_base::
+fingerprint(std::uint64_t seed) const noexcept
+{
+    detail::mum_hasher<1> h(seed);
+    normalized_digest(*pi_, encoded_segments(), h);
+    return h.digest();
+}
+
+url_fingerprint
+url_view_base::
+fingerprint128(std::uint64_t seed) const noexcept
+{
+    detail::mum_hasher<2> h(seed);
+    normalized_digest(*pi_, encoded_segments(), h);
+    url_fingerprint f;
+    f.low = h.digest();
+    f.high = h.digest_high();
+    return f;
+}
 
-struct url_view_base::shared_impl
-    : url_view
+namespace {
+
+// Writes the bytes of a sort key, or counts
+// them when there is no destination. Each
+// char is mapped so that the unsigned order
+// of the bytes is the order of char used by
+// url_view_base::compare. A zero byte is
+// escaped as 0 0xff and each string ends
+// with 0 1, so that a string sorts before
+// the strings it is a prefix of.
+class sort_key_writer
 {
-    virtual
-    ~shared_impl()
+    char* p_;
+    std::size_t n_ = 0;
+
+    static
+    unsigned char
+    order(char c) noexcept
+    {
+        return static_cast<unsigned char>(c) ^
+            (std::is_signed<char>::value ? 0x80 : 0);
+    }
+
+    void
+    put(unsigned char b) noexcept
+    {
+        if(p_)
+            p_[n_] = static_cast<char>(b);
+        ++n_;
+    }
+
+    void
+    put_char(char c) noexcept
+    {
+        unsigned char const b = order(c);
+        put(b);
+        if(b == 0)
+            put(0xff);
+    }
+
+    void
+    end() noexcept
+    {
+        put(0);
+        put(1);
+    }
+
+public:
+    explicit
+    sort_key_writer(char* p) noexcept
+        : p_(p)
+    {
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    void
+    flag(bool b) noexcept
     {
+        put(b ? 1 : 0);
     }
 
-    shared_impl(
-        url_view const& u) noexcept
-        : url_view(u)
+    void
+    string(
+        core::string_view s,
+        bool ignore_case) noexcept
     {
-        impl_.cs_ = reinterpret_cast<
-            char const*>(this + 1);
+        for(char c : s)
+            put_char(ignore_case ?
+                grammar::to_lower(c) : c);
+        end();
+    }
+
+    void
+    encoded(
+        core::string_view s,
+        bool ignore_case) noexcept
+    {
+        char c;
+        std::size_t n = 0;
+        while(! s.empty())
+        {
+            detail::pop_encoded_front(s, c, n);
+            put_char(ignore_case ?
+                grammar::to_lower(c) : c);
+        }
+        end();
+    }
+
+    // the reader pops the normalized
+    // path from the back, so the bytes
+    // are written from the back
+    void
+    path(segments_encoded_view segs) noexcept
+    {
+        std::size_t n = 0;
+        {
+            detail::normalized_path_reader r(segs);
+            n = r.size();
+            while(r.size())
+                n += order(r.pop_back()) == 0;
+        }
+        if(p_)
+        {
+            detail::normalized_path_reader r(segs);
+            char* it = p_ + n_ + n;
+            while(r.size())
+            {
+                unsigned char const b =
+                    order(r.pop_back());
+                if(b == 0)
+                    *--it = static_cast<char>(0xff);
+                *--it = static_cast<char>(b);
+            }
+        }
+        n_ += n;
+        end();
     }
 };
 
+// write the components in the
+// order of url_view_base::compare
+void
+write_key(
+    detail::url_impl const& u,
+    segments_encoded_view segs,
+    sort_key_writer& w) noexcept
+{
+    using parts = detail::parts_base;
+    w.flag(u.len(parts::id_scheme) != 0);
+    if(u.len(parts::id_scheme) != 0)
+    {
+        auto const s = u.get(parts::id_scheme);
+        w.string(s.substr(0, s.size() - 1), true);
+    }
+    w.flag(u.len(parts::id_user) != 0);
+    if(u.len(parts::id_user) != 0)
+    {
+        auto const pass = u.get(parts::id_pass);
+        w.flag(! pass.empty());
+        if(! pass.empty())
+        {
+            w.encoded(u.get(parts::id_user).substr(2), false);
+            w.flag(pass.size() > 1);
+            if(pass.size() > 1)
+                w.encoded(pass.substr(1, pass.size() - 2), false);
+        }
+        w.encoded(u.get(parts::id_host), true);
+        auto const port = u.get(parts::id_port);
+        w.flag(! port.empty());
+        if(! port.empty())
+            w.string(port.substr(1), false);
+    }
+    w.path(segs);
+    auto const query = u.get(parts::id_query);
+    w.flag(! query.empty());
+    if(! query.empty())
+        w.encoded(query.substr(1), false);
+    auto const frag = u.get(parts::id_frag);
+    w.flag(! frag.empty());
+    if(! frag.empty())
+        w.encoded(frag.substr(1), false);
+}
+
+} // (anon)
+
+std::size_t
+url_view_base::
+sort_key_size() const noexcept
+{
+    sort_key_writer w(nullptr);
+    write_key(*pi_, encoded_segments(), w);
+    return w.size();
+}
+
+void
+url_view_base::
+write_sort_key(
+    char* dest,
+    std::size_t n) const noexcept
+{
+    sort_key_writer w(dest);
+    write_key(*pi_, encoded_segments(), w);
+    BOOST_ASSERT(w.size() == n);
+    ignore_unused(n);
+}
+
+//------------------------------------------------
+//
+// Observers
+//
+//------------------------------------------------
+
 std::shared_ptr<url_view const>
 url_view_base::
 persist() const
 {
-    using T = shared_impl;
-    using Alloc = std::allocator<char>;
-    Alloc a;
-    auto p = std::allocate_shared<T>(
-        detail::over_allocator<T, Alloc>(
-            size(), a), url_view(*pi_));
-    std::memcpy(
-        reinterpret_cast<char*>(
-            p.get() + 1), data(), size());
-    return p;
+    return persist(
+        std::allocator<char>());
 }
 
 //------------------------------------------------
@@ -171,6 +435,7 @@ authority() const noexcept
         u.ip_addr_[i] = pi_->ip_addr_[i];
     u.port_number_ = pi_->port_number_;
     u.host_type_ = pi_->host_type_;
+    u.host_norm_ = pi_->host_norm_;
     return u.construct_authority();
 }
 
@@ -472,6 +737,25 @@ port_number() const noexcept
     return pi_->port_number_;
 }
 
+std::uint16_t
+url_view_base::
+effective_port() const noexcept
+{
+    if(pi_->len(id_port) > 1)
+        return pi_->port_number_;
+    return default_port(pi_->scheme_);
+}
+
+std::uint64_t
+url_view_base::
+authority_key() const noexcept
+{
+    std::uint64_t const h =
+        grammar::ci_digest(
+            pi_->get(id_host));
+    return (h << 16) | effective_port();
+}
+
 //------------------------------------------------
 //
 // Path
@@ -614,6 +898,30 @@ encoded_origin() const noexcept
     return pi_->get(id_scheme, id_path);
 }
 
+origin_view
+url_view_base::
+origin() const noexcept
+{
+    switch(pi_->scheme_)
+    {
+    case urls::scheme::ftp:
+    case urls::scheme::http:
+    case urls::scheme::https:
+    case urls::scheme::ws:
+    case urls::scheme::wss:
+        break;
+    default:
+        return {};
+    }
+    core::string_view const host =
+        pi_->get(id_host);
+    if( ! has_authority() ||
+        host.empty())
+        return {};
+    return { pi_->scheme_, host,
+        effective_port() };
+}
+
 pct_string_view
 url_view_base::
 encoded_resource() const noexcept
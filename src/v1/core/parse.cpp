@@ -6,6 +6,7 @@
 #include <skyr/v1/core/parse.hpp>
 #include <skyr/v1/core/check_input.hpp>
 #include <skyr/v1/core/errors.hpp>
+#include <skyr/v1/core/stats.hpp>
 #include "url_parse_impl.hpp"
 #include "url_parser_context.hpp"
 
@@ -80,14 +81,21 @@ auto basic_parse(
   auto context = url_parser_context(input_, validation_error, base, url, state_override);
 
   while (true) {
+    // copy runs of plain bytes without dispatching on each one
+    if (context.parse_run()) {
+      continue;
+    }
+
     auto byte = context.is_eof() ? '\0' : *context.it;
     auto action = parse_next(context, byte);
     if (!action) {
+      count_parse(false);
       return tl::make_unexpected(action.error());
     }
 
     switch (action.value()) {
       case url_parse_action::success:
+        count_parse(true);
         return context.url;
       case url_parse_action::increment:
         break;
@@ -101,6 +109,7 @@ auto basic_parse(
     context.increment();
   }
 
+  count_parse(true);
   return context.url;
 }
 }  // namespace details
@@ -48,6 +48,51 @@ auto port_number(std::string_view port) noexcept -> tl::expected<std::uint16_t,
   return static_cast<std::uint16_t>(port_value);
 }
 
+using byte_charset = std::array<bool, 256>;
+
+template <class Pred>
+constexpr auto make_byte_charset(Pred pred) noexcept {
+  auto charset = byte_charset{};
+  for (auto i = 0u; i < charset.size(); ++i) {
+    charset[i] = pred(static_cast<char>(i));
+  }
+  return charset;
+}
+
+constexpr auto is_ascii_alphanumeric(char byte) noexcept {
+  return ((byte >= '0') && (byte <= '9')) || ((byte >= 'a') && (byte <= 'z')) || ((byte >= 'A') && (byte <= 'Z'));
+}
+
+/// URL code points, and '%', that are neither in the path percent
+/// encode set nor path delimiters
+constexpr auto path_run_charset = make_byte_charset([](char byte) {
+  return is_ascii_alphanumeric(byte) || ("!$%&'()*+,-.:;=@_~"sv.find(byte) != std::string_view::npos);
+});
+
+constexpr auto query_run_charset = make_byte_charset([](char byte) {
+  return (byte >= '!') && (byte <= '~') && (R"("#<>)"sv.find(byte) == std::string_view::npos);
+});
+
+constexpr auto special_query_run_charset = make_byte_charset([](char byte) {
+  return query_run_charset[static_cast<unsigned char>(byte)] && (byte != '\'');
+});
+
+/// URL code points, which are never in the fragment percent encode
+/// set; '%' is excluded because it's validated
+constexpr auto fragment_run_charset = make_byte_charset([](char byte) {
+  return is_ascii_alphanumeric(byte) || ("!$&'()*+,-./:;=?@_~"sv.find(byte) != std::string_view::npos);
+});
+
+auto find_end_of_run(
+    std::string_view::const_iterator first,
+    std::string_view::const_iterator last,
+    const byte_charset &charset) noexcept {
+  while ((first != last) && charset[static_cast<unsigned char>(*first)]) {
+    ++first;
+  }
+  return first;
+}
+
 auto is_url_code_point(char byte) noexcept {
   return std::isalnum(byte, std::locale::classic()) || contains("!$&'()*+,-./:;=?@_~"sv, byte);
 }
@@ -718,5 +763,43 @@ auto url_parser_context::parse_fragment(char byte) -> tl::expected<url_parse_act
   }
   return url_parse_action::increment;
 }
+
+auto url_parser_context::parse_run() -> bool {
+  const byte_charset *charset = nullptr;
+  switch (state) {
+    case url_parse_state::path:
+      charset = &path_run_charset;
+      break;
+    case url_parse_state::query:
+      charset = url.is_special() ? &special_query_run_charset : &query_run_charset;
+      break;
+    case url_parse_state::fragment:
+      charset = &fragment_run_charset;
+      break;
+    default:
+      return false;
+  }
+
+  auto first = it;
+  auto last = find_end_of_run(first, end(input), *charset);
+  if (first == last) {
+    return false;
+  }
+
+  auto run = input.substr(std::distance(begin(input), first), std::distance(first, last));
+  switch (state) {
+    case url_parse_state::path:
+      buffer += run;
+      break;
+    case url_parse_state::query:
+      url.query.value() += run;
+      break;
+    default:
+      url.fragment.value() += run;
+      break;
+  }
+  it = last;
+  return true;
+}
 }  // namespace v1
 }  // namespace skyr
@@ -96,6 +96,8 @@ class url_parser_context {
   auto parse_query(char byte) -> tl::expected<url_parse_action, url_parse_errc>;
   auto parse_fragment(char byte) -> tl::expected<url_parse_action, url_parse_errc>;
 
+  auto parse_run() -> bool;
+
 };
 }  // namespace v1
 }  // namespace skyr
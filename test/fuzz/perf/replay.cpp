@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2023 alandefreitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+
+// Replays a fuzz corpus through a fuzz target
+// and reports the time it takes per byte of
+// input. Inputs which take more than `ratio`
+// times the median time per byte are listed,
+// and make the program fail, so that inputs
+// which trigger superlinear behavior in the
+// grammar are caught as the corpus grows.
+//
+// Usage:
+//   perf_<target> [-ratio=R] [-repeat=N] [-min_size=B] DIR...
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C"
+int
+LLVMFuzzerTestOneInput(
+    const uint8_t* data,
+    size_t size);
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct sample
+{
+    std::string path;
+    std::string data;
+    double ns = 0;
+    double ns_per_byte = 0;
+};
+
+std::string
+read_file(fs::path const& p)
+{
+    std::ifstream f(p, std::ios::binary);
+    return {
+        std::istreambuf_iterator<char>(f),
+        std::istreambuf_iterator<char>()};
+}
+
+// The fastest of several runs, which
+// is the least affected by noise
+double
+time_input(
+    std::string const& s,
+    int repeat)
+{
+    auto const* p = reinterpret_cast<
+        const uint8_t*>(s.data());
+    double best = 0;
+    for(int i = 0; i < repeat; ++i)
+    {
+        auto const t0 =
+            std::chrono::steady_clock::now();
+        LLVMFuzzerTestOneInput(p, s.size());
+        auto const t1 =
+            std::chrono::steady_clock::now();
+        double const ns = static_cast<double>(
+            std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                    t1 - t0).count());
+        if(i == 0 || ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+bool
+parse_option(
+    char const* arg,
+    char const* name,
+    double& value)
+{
+    auto const n = std::strlen(name);
+    if(std::strncmp(arg, name, n) != 0 ||
+        arg[n] != '=')
+        return false;
+    value = std::atof(arg + n + 1);
+    return true;
+}
+
+} // (anon)
+
+int
+main(int argc, char** argv)
+{
+    double ratio = 10;
+    double repeat = 20;
+    double min_size = 64;
+    std::vector<sample> v;
+    for(int i = 1; i < argc; ++i)
+    {
+        if( parse_option(argv[i], "-ratio", ratio) ||
+            parse_option(argv[i], "-repeat", repeat) ||
+            parse_option(argv[i], "-min_size", min_size))
+            continue;
+        fs::path const dir(argv[i]);
+        if(! fs::is_directory(dir))
+        {
+            std::fprintf(stderr,
+                "skipping %s: not a directory\n", argv[i]);
+            continue;
+        }
+        for(auto const& e :
+            fs::recursive_directory_iterator(dir))
+        {
+            if(! e.is_regular_file())
+                continue;
+            sample s;
+            s.path = e.path().string();
+            s.data = read_file(e.path());
+            v.push_back(std::move(s));
+        }
+    }
+    if(v.empty())
+    {
+        std::fprintf(stderr, "no inputs\n");
+        return 0;
+    }
+
+    // warm up the caches and
+    // the recycled objects
+    for(auto const& s : v)
+        time_input(s.data, 1);
+
+    // short inputs are dominated by the
+    // fixed cost of a call, so they are
+    // measured as if they had min_size bytes
+    for(auto& s : v)
+    {
+        s.ns = time_input(
+            s.data, static_cast<int>(repeat));
+        s.ns_per_byte = s.ns / std::max(
+            static_cast<double>(s.data.size()),
+            min_size);
+    }
+
+    std::vector<double> per_byte;
+    per_byte.reserve(v.size());
+    for(auto const& s : v)
+        per_byte.push_back(s.ns_per_byte);
+    auto const mid = per_byte.begin() +
+        static_cast<std::ptrdiff_t>(per_byte.size() / 2);
+    std::nth_element(
+        per_byte.begin(), mid, per_byte.end());
+    double const median = *mid;
+    double const p99 = [&]
+    {
+        auto it = per_byte.begin() +
+            static_cast<std::ptrdiff_t>(
+                (per_byte.size() - 1) * 99 / 100);
+        std::nth_element(
+            per_byte.begin(), it, per_byte.end());
+        return *it;
+    }();
+
+    std::sort(v.begin(), v.end(),
+        [](sample const& a, sample const& b)
+        {
+            return a.ns_per_byte > b.ns_per_byte;
+        });
+    std::printf(
+        "%zu inputs, median %.3f ns/byte, "
+        "p99 %.3f ns/byte, max %.3f ns/byte\n",
+        v.size(), median, p99, v.front().ns_per_byte);
+
+    std::size_t slow = 0;
+    for(auto const& s : v)
+    {
+        if(s.ns_per_byte <= ratio * median)
+            break;
+        ++slow;
+        std::printf(
+            "SLOW %.1fx median: %s "
+            "(%zu bytes, %.0f ns)\n",
+            s.ns_per_byte / median,
+            s.path.c_str(),
+            s.data.size(),
+            s.ns);
+    }
+    if(slow != 0)
+    {
+        std::printf(
+            "%zu inputs are more than %.1f "
+            "times slower than the median\n",
+            slow, ratio);
+        return 1;
+    }
+    return 0;
+}
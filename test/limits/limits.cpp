@@ -11,16 +11,254 @@
 
 #include "test_suite.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 
+// This test is built with BOOST_URL_MAX_SIZE=16,
+// so that the limit can be reached by small urls.
+// Inputs of unbounded size are exercised in
+// stress.cpp, which uses the default limit.
+namespace {
+constexpr std::size_t N = BOOST_URL_MAX_SIZE;
+} // (anon)
+
 struct limits_test
 {
-    // VFALCO class url needs limit tests
+    // a url with exactly n characters
+    static
+    std::string
+    make(std::size_t n)
+    {
+        std::string s = "/";
+        s.append(n - 1, 'a');
+        return s;
+    }
+
+    // calling f on a copy of u throws,
+    // and the copy is left unchanged
+    template<class F>
+    static
+    void
+    check_throws(
+        url const& u,
+        F const& f)
+    {
+        url v = u;
+        BOOST_TEST_THROWS(f(v),
+            system::system_error);
+        BOOST_TEST_EQ(v.buffer(), u.buffer());
+        BOOST_TEST_LE(v.capacity(), N);
+    }
+
+    void
+    testMaxSize()
+    {
+        BOOST_TEST_EQ(N, 16u);
+        BOOST_TEST_EQ(url::max_size(), N);
+        BOOST_TEST_EQ(url_view::max_size(), N);
+    }
+
+    void
+    testConstruct()
+    {
+        // at the limit
+        {
+            url u(make(N));
+            BOOST_TEST_EQ(u.size(), N);
+            BOOST_TEST_LE(u.capacity(), N);
+        }
+
+        // over the limit
+        BOOST_TEST_THROWS(url(make(N + 1)),
+            system::system_error);
+
+        // views are not owned,
+        // only urls are limited
+        {
+            std::string const s = make(N + 1);
+            url_view v(s);
+            BOOST_TEST_EQ(v.size(), N + 1);
+            BOOST_TEST_THROWS(url(v),
+                system::system_error);
+        }
+
+        // reserve
+        {
+            url u;
+            BOOST_TEST_NO_THROW(u.reserve(N));
+            BOOST_TEST_THROWS(u.reserve(N + 1),
+                system::system_error);
+            BOOST_TEST_EQ(u.buffer(), "");
+        }
+    }
+
+    void
+    testModify()
+    {
+        url const u("http://x.y/z");
+        BOOST_TEST_EQ(u.size(), 12u);
+
+        check_throws(u, [](url& v)
+        {
+            v.set_scheme("https-extra");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_encoded_user("user");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_encoded_host("www.x.yz");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_port_number(65535);
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_encoded_path("/a/b/cd");
+        });
+        check_throws(u, [](url& v)
+        {
+            // each character is escaped
+            v.set_path("%%");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_encoded_query("k=vv");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.set_encoded_fragment("frag");
+        });
+
+        // containers
+        check_throws(u, [](url& v)
+        {
+            v.segments().push_back("abcde");
+        });
+        check_throws(u, [](url& v)
+        {
+            v.params().append({"k", "vv"});
+        });
+
+        // edits which fit
+        {
+            url v = u;
+            v.set_encoded_fragment("abc");
+            BOOST_TEST_EQ(v.size(), N);
+            v.remove_fragment();
+            v.segments().push_back("a");
+            BOOST_TEST_EQ(v.buffer(), "http://x.y/z/a");
+        }
+    }
+
+    void
+    testNormalize()
+    {
+        // normalization never grows a url
+        url u("http://X.Y/%7e/.");
+        BOOST_TEST_EQ(u.size(), N);
+        BOOST_TEST_NO_THROW(u.normalize());
+        BOOST_TEST_EQ(u.buffer(), "http://x.y/~/");
+    }
+
+    void
+    testResolve()
+    {
+        url_view const base("http://x.y/a/b");
+        {
+            url u;
+            BOOST_TEST_NO_THROW(resolve(
+                base, url_view("c"), u).value());
+            BOOST_TEST_EQ(u.buffer(), "http://x.y/a/c");
+        }
+        {
+            url u;
+            BOOST_TEST_THROWS(resolve(
+                base, url_view("cdefgh"), u),
+                system::system_error);
+        }
+    }
+
+    void
+    testParseOptions()
+    {
+        // no limits
+        {
+            parse_options opt;
+            std::string const s =
+                "http://www.example.com/a/b?k=v";
+            BOOST_TEST(parse_uri(s, opt).has_value());
+        }
+
+        // the size is checked before parsing
+        {
+            parse_options opt;
+            opt.max_size = 4;
+            BOOST_TEST(parse_uri(
+                "not a url", opt).error() ==
+                    error::too_long);
+            BOOST_TEST(parse_origin_form(
+                "/abcd", opt).error() ==
+                    error::too_long);
+            BOOST_TEST(parse_origin_form(
+                "/abc", opt).has_value());
+        }
+
+        // invalid strings fail as usual
+        {
+            parse_options opt;
+            opt.max_segments = 0;
+            BOOST_TEST(parse_uri(
+                "http://[", opt).error() !=
+                    error::too_many_segments);
+        }
+
+        {
+            parse_options opt;
+            opt.max_segments = 2;
+            opt.max_params = 2;
+            opt.max_host_size = 3;
+            BOOST_TEST(parse_uri(
+                "x://abc/a/b?c&d", opt).has_value());
+            BOOST_TEST(parse_uri(
+                "x://abc/a/b/c", opt).error() ==
+                    error::too_many_segments);
+            BOOST_TEST(parse_origin_form(
+                "/a?b&c&d", opt).error() ==
+                    error::too_many_params);
+            BOOST_TEST(parse_uri(
+                "x://abcd/", opt).error() ==
+                    error::host_too_long);
+        }
+
+        // normalize leaves the url
+        // unchanged when it fails
+        {
+            parse_options opt;
+            opt.max_segments = 2;
+            url u("http://X.Y/a/./b");
+            BOOST_TEST(u.normalize(opt).error() ==
+                error::too_many_segments);
+            BOOST_TEST_EQ(u.buffer(), "http://X.Y/a/./b");
+            opt.max_segments = 3;
+            BOOST_TEST(u.normalize(opt).has_value());
+            BOOST_TEST_EQ(u.buffer(), "http://x.y/a/b");
+        }
+    }
 
     void
     run()
     {
+        testMaxSize();
+        testConstruct();
+        testModify();
+        testNormalize();
+        testResolve();
+        testParseOptions();
     }
 };
 
@@ -0,0 +1,420 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#include <boost/url.hpp>
+
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+// Degenerate inputs of up to millions of
+// elements. Each operation is timed at two
+// sizes, n and 8n: a linear operation takes
+// about 8 times longer on the larger input,
+// a quadratic one 64 times. The limit of
+// 32 leaves room for cache effects.
+struct stress_test
+{
+    static
+    constexpr
+    double max_ratio = 32;
+
+    // the shortest of a few runs, in seconds
+    template<class F>
+    static
+    double
+    time_of(
+        F const& f,
+        std::size_t n)
+    {
+        using clock = std::chrono::steady_clock;
+        double best = 1e9;
+        for(int i = 0; i < 3; ++i)
+        {
+            auto const t0 = clock::now();
+            f(n);
+            auto const t1 = clock::now();
+            best = (std::min)(best,
+                std::chrono::duration<double>(
+                    t1 - t0).count());
+        }
+        return best;
+    }
+
+    // f(8 * n) is not much slower
+    // than 8 times f(n)
+    template<class F>
+    static
+    void
+    check_linear(
+        char const* name,
+        std::size_t n,
+        F const& f)
+    {
+        double const t0 = time_of(f, n);
+        double const t1 = time_of(f, 8 * n);
+        // a small absolute slack absorbs
+        // timer resolution on fast runs
+        if(! BOOST_TEST_LE(t1,
+            max_ratio * t0 + 0.01))
+        {
+            test_suite::log <<
+                name << ": " << t0 << "s for " << n <<
+                ", " << t1 << "s for " << 8 * n << "\n";
+        }
+    }
+
+    // the capacity of a url grown one
+    // element at a time is proportional
+    // to its size
+    static
+    void
+    check_capacity(url const& u)
+    {
+        BOOST_TEST_LE(u.capacity(),
+            2 * u.size() + 64);
+    }
+
+    static
+    std::string
+    repeat(
+        core::string_view s,
+        std::size_t n)
+    {
+        std::string r;
+        r.reserve(s.size() * n);
+        for(std::size_t i = 0; i < n; ++i)
+            r.append(s.data(), s.size());
+        return r;
+    }
+
+    //--------------------------------------------
+
+    // up to 1M segments
+    void
+    testDeepPath()
+    {
+        std::size_t const n = 128 * 1024;
+
+        check_linear("parse segments", n,
+            [](std::size_t n)
+            {
+                std::string const s =
+                    "http://www.example.com" +
+                    repeat("/a", n);
+                url_view u = parse_uri(s).value();
+                BOOST_TEST_EQ(u.segments().size(), n);
+                std::size_t m = 0;
+                for(auto seg : u.encoded_segments())
+                    m += seg.size();
+                BOOST_TEST_EQ(m, n);
+            });
+
+        check_linear("push_back segments", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com");
+                auto segs = u.segments();
+                for(std::size_t i = 0; i < n; ++i)
+                    segs.push_back("a");
+                BOOST_TEST_EQ(u.segments().size(), n);
+                check_capacity(u);
+            });
+
+        check_linear("set path", n,
+            [](std::size_t n)
+            {
+                std::string const s = repeat("/a%2F", n);
+                url u("http://www.example.com?q#f");
+                u.set_encoded_path(s);
+                BOOST_TEST_EQ(u.segments().size(), n);
+                BOOST_TEST_EQ(u.path().size(), 3 * n);
+            });
+
+        check_linear("erase segments", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com" +
+                    repeat("/a", n) + "?q#f");
+                auto segs = u.segments();
+                segs.erase(segs.begin(), segs.end());
+                // with an authority, the
+                // path becomes empty
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com?q#f");
+            });
+    }
+
+    // up to 100k params
+    void
+    testLongQuery()
+    {
+        std::size_t const n = 12 * 1024;
+
+        check_linear("parse params", n,
+            [](std::size_t n)
+            {
+                std::string const s =
+                    "http://www.example.com/?" +
+                    repeat("k=v&", n);
+                url_view u = parse_uri(s).value();
+                // the trailing '&' adds
+                // an empty param
+                BOOST_TEST_EQ(u.params().size(), n + 1);
+                std::size_t m = 0;
+                for(auto p : u.params())
+                    m += p.key.size() + p.value.size();
+                BOOST_TEST_EQ(m, 2 * n);
+            });
+
+        check_linear("append params", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/");
+                auto ps = u.params();
+                for(std::size_t i = 0; i < n; ++i)
+                    ps.append({"key", "value"});
+                BOOST_TEST_EQ(u.params().size(), n);
+                check_capacity(u);
+            });
+
+        check_linear("find param", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/?" +
+                    repeat("k=v&", n) + "last=1#f");
+                auto ps = u.params();
+                auto it = ps.find("last");
+                BOOST_TEST(it != ps.end());
+                ps.erase(ps.begin(), it);
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/?last=1#f");
+            });
+
+        check_linear("set query", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/#f");
+                u.set_query(repeat("k=v %&", n));
+                BOOST_TEST_EQ(u.params().size(), n + 1);
+                u.remove_query();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/#f");
+            });
+    }
+
+    // up to 1M escapes
+    void
+    testEscapes()
+    {
+        std::size_t const n = 128 * 1024;
+
+        check_linear("decode escapes", n,
+            [](std::size_t n)
+            {
+                std::string const s = repeat("%41", n);
+                pct_string_view p(s);
+                BOOST_TEST_EQ(p.decoded_size(), n);
+                std::size_t m = 0;
+                for(char c : *p)
+                    m += c == 'A';
+                BOOST_TEST_EQ(m, n);
+                BOOST_TEST_EQ(p.decode().size(), n);
+            });
+
+        check_linear("encode escapes", n,
+            [](std::size_t n)
+            {
+                std::string const s(n, '%');
+                url u("http://www.example.com/?q#f");
+                u.set_path(s);
+                BOOST_TEST_EQ(
+                    u.encoded_path().size(), 3 * n + 1);
+                BOOST_TEST_EQ(
+                    u.encoded_path().decoded_size(), n + 1);
+                std::string const e = encode(
+                    s, unreserved_chars);
+                BOOST_TEST_EQ(e.size(), 3 * n);
+            });
+
+        check_linear("invalid escapes", n,
+            [](std::size_t n)
+            {
+                // the error is at the end
+                std::string const s =
+                    "/" + repeat("%41", n) + "%";
+                BOOST_TEST(parse_uri_reference(s).has_error());
+            });
+
+        check_linear("normalize escapes", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/" +
+                    repeat("%7e%2f", n) + "?" +
+                    repeat("%41", n) + "#" +
+                    repeat("%61", n));
+                u.normalize();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/" +
+                    repeat("~%2F", n) + "?" +
+                    repeat("A", n) + "#" +
+                    repeat("a", n));
+            });
+    }
+
+    // up to 1M dot segments
+    void
+    testDotSegments()
+    {
+        std::size_t const n = 128 * 1024;
+
+        check_linear("normalize dot segments", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/" +
+                    repeat("a/", n) + repeat("../", n) + "b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/b");
+            });
+
+        check_linear("normalize leading dot segments", n,
+            [](std::size_t n)
+            {
+                url u(repeat("../", n) + "b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.size(), 3 * n + 1);
+            });
+
+        check_linear("normalize single dots", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com" +
+                    repeat("/.", n) + repeat("/%2e", n) + "/b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/b");
+            });
+
+        check_linear("alternating dot segments", n,
+            [](std::size_t n)
+            {
+                // deep descents, each undone
+                // by a run of ".."
+                url u("http://www.example.com/" +
+                    repeat(repeat("a/", 64) +
+                        repeat("../", 64), n / 64) + "b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/b");
+            });
+
+        check_linear("long segments and dot segments", n,
+            [](std::size_t n)
+            {
+                url u("http://www.example.com/" +
+                    repeat(std::string(64, 'a') + "/../",
+                        n / 16) + "b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/b");
+            });
+
+        check_linear("dot segments above the root", n,
+            [](std::size_t n)
+            {
+                // Errata 4547 keeps the ".."
+                // which can not be applied
+                url u(repeat("x/", n) +
+                    repeat("%2e%2E/", 2 * n) + "b");
+                u.normalize_path();
+                BOOST_TEST_EQ(u.size(), 3 * n + 1);
+            });
+
+        check_linear("resolve dot segments", n,
+            [](std::size_t n)
+            {
+                url_view const base(
+                    "http://www.example.com/a/b");
+                std::string const ref =
+                    repeat("x/", n) + repeat("../", n + 1) + "c";
+                url u;
+                resolve(base, url_view(ref), u).value();
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com/c");
+            });
+    }
+
+    // hosts of up to 1M characters
+    void
+    testLongHosts()
+    {
+        std::size_t const n = 128 * 1024;
+
+        check_linear("ipv6 zone id", n,
+            [](std::size_t n)
+            {
+                // rfc6874 zone id
+                std::string const s =
+                    "http://[fe80::1%25" +
+                    std::string(n, 'e') + "]/";
+                url_view u = parse_uri(s).value();
+                BOOST_TEST(u.host_type() ==
+                    host_type::ipv6);
+                BOOST_TEST_EQ(
+                    u.encoded_zone_id().size(), n);
+            });
+
+        check_linear("ipvfuture", n,
+            [](std::size_t n)
+            {
+                std::string const s =
+                    "http://[v1." +
+                    std::string(n, 'e') + "]/";
+                url_view u = parse_uri(s).value();
+                BOOST_TEST(u.host_type() ==
+                    host_type::ipvfuture);
+                BOOST_TEST_EQ(u.encoded_host().size(), n + 5);
+            });
+
+        check_linear("reg-name", n,
+            [](std::size_t n)
+            {
+                url u("http://x/");
+                u.set_host(repeat("a.%", n));
+                BOOST_TEST(u.host_type() ==
+                    host_type::name);
+                BOOST_TEST_EQ(u.encoded_host().size(), 5 * n);
+                u.normalize_authority();
+                BOOST_TEST_EQ(u.encoded_host().size(), 5 * n);
+            });
+    }
+
+    void
+    run()
+    {
+        testDeepPath();
+        testLongQuery();
+        testEscapes();
+        testDotSegments();
+        testLongHosts();
+    }
+};
+
+TEST_SUITE(
+    stress_test,
+    "boost.url.stress");
+
+} // urls
+} // boost
@@ -0,0 +1,303 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/authority.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+struct authority_test
+{
+    // the container agrees with
+    // a reparse of its buffer
+    static
+    void
+    check(authority const& a)
+    {
+        BOOST_TEST_EQ(a.c_str()[a.size()], '\0');
+        auto rv = parse_authority(a.buffer());
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        authority_view const v = a;
+        BOOST_TEST_EQ(v.buffer(), a.buffer());
+        BOOST_TEST_EQ(v.encoded_userinfo(), rv->encoded_userinfo());
+        BOOST_TEST_EQ(v.encoded_user(), rv->encoded_user());
+        BOOST_TEST_EQ(v.encoded_password(), rv->encoded_password());
+        BOOST_TEST_EQ(v.encoded_userinfo().decoded_size(),
+            rv->encoded_userinfo().decoded_size());
+        BOOST_TEST_EQ(v.encoded_user().decoded_size(),
+            rv->encoded_user().decoded_size());
+        BOOST_TEST_EQ(v.has_password(), rv->has_password());
+        BOOST_TEST_EQ(v.encoded_host(), rv->encoded_host());
+        BOOST_TEST_EQ(v.encoded_host().decoded_size(),
+            rv->encoded_host().decoded_size());
+        BOOST_TEST(v.host_type() == rv->host_type());
+        BOOST_TEST(v.host_ipv4_address() == rv->host_ipv4_address());
+        BOOST_TEST(v.host_ipv6_address() == rv->host_ipv6_address());
+        BOOST_TEST_EQ(v.has_port(), rv->has_port());
+        BOOST_TEST_EQ(v.port(), rv->port());
+        BOOST_TEST_EQ(v.port_number(), rv->port_number());
+        BOOST_TEST_EQ(a.has_userinfo(), rv->has_userinfo());
+        BOOST_TEST_EQ(a.encoded_userinfo(), rv->encoded_userinfo());
+        BOOST_TEST_EQ(a.encoded_host(), rv->encoded_host());
+        BOOST_TEST(a.host_type() == rv->host_type());
+        BOOST_TEST_EQ(a.has_port(), rv->has_port());
+        BOOST_TEST_EQ(a.port(), rv->port());
+        BOOST_TEST_EQ(a.port_number(), rv->port_number());
+        BOOST_TEST_EQ(a.encoded_host_and_port(),
+            rv->encoded_host_and_port());
+    }
+
+    void
+    testSpecial()
+    {
+        // authority()
+        {
+            authority a;
+            BOOST_TEST(a.empty());
+            BOOST_TEST(a.is_inline());
+            BOOST_TEST_EQ(a.capacity(),
+                authority::inline_capacity);
+            BOOST_TEST_EQ(a.buffer(), "");
+            BOOST_TEST(! a.has_userinfo());
+            BOOST_TEST(! a.has_port());
+        }
+
+        // authority(core::string_view)
+        {
+            authority a("user:pass@www.example.com:8080");
+            BOOST_TEST_EQ(a.buffer(),
+                "user:pass@www.example.com:8080");
+            BOOST_TEST(a.is_inline());
+            check(a);
+            BOOST_TEST_THROWS(authority("a b"),
+                system::system_error);
+        }
+
+        // authority(authority_view)
+        {
+            authority a(url_view(
+                "http://[::1]:80/").authority());
+            BOOST_TEST_EQ(a.buffer(), "[::1]:80");
+            check(a);
+        }
+
+        // copy, move
+        {
+            std::string const big(100, 'x');
+            authority a0("u@" + big + ":1");
+            BOOST_TEST(! a0.is_inline());
+            authority a1(a0);
+            BOOST_TEST_EQ(a1.buffer(), a0.buffer());
+            check(a1);
+            auto const p = a0.c_str();
+            authority a2(std::move(a0));
+            BOOST_TEST_EQ(a2.c_str(), p);
+            BOOST_TEST(a0.empty());
+            BOOST_TEST(a0.is_inline());
+            check(a2);
+
+            authority a3("x:1");
+            authority a4(std::move(a3));
+            BOOST_TEST_EQ(a4.buffer(), "x:1");
+            BOOST_TEST(a3.empty());
+            check(a4);
+
+            a3 = a2;
+            BOOST_TEST_EQ(a3.buffer(), a2.buffer());
+            check(a3);
+            a3 = std::move(a4);
+            BOOST_TEST_EQ(a3.buffer(), "x:1");
+            BOOST_TEST(a4.empty());
+            check(a3);
+            a3 = url_view("//h.com").authority();
+            BOOST_TEST_EQ(a3.buffer(), "h.com");
+            check(a3);
+            authority const& r = a3;
+            a3 = r;
+            BOOST_TEST_EQ(a3.buffer(), "h.com");
+        }
+    }
+
+    void
+    testUserinfo()
+    {
+        authority a("example.com:80");
+        a.set_encoded_userinfo("user:p%40ss");
+        BOOST_TEST_EQ(a.buffer(), "user:p%40ss@example.com:80");
+        check(a);
+        a.set_encoded_userinfo("x");
+        BOOST_TEST_EQ(a.buffer(), "x@example.com:80");
+        check(a);
+        a.set_encoded_userinfo("a@b:c:d");
+        BOOST_TEST_EQ(a.buffer(), "a%40b:c:d@example.com:80");
+        check(a);
+        a.set_userinfo("us er:p@ss");
+        BOOST_TEST_EQ(a.buffer(), "us%20er:p%40ss@example.com:80");
+        check(a);
+        a.set_userinfo("me");
+        BOOST_TEST_EQ(a.buffer(), "me@example.com:80");
+        check(a);
+        a.set_userinfo("");
+        BOOST_TEST_EQ(a.buffer(), "@example.com:80");
+        check(a);
+        a.remove_userinfo();
+        BOOST_TEST_EQ(a.buffer(), "example.com:80");
+        check(a);
+        a.remove_userinfo();
+        BOOST_TEST_EQ(a.buffer(), "example.com:80");
+        BOOST_TEST_THROWS(a.set_encoded_userinfo("%"),
+            system::system_error);
+        BOOST_TEST_EQ(a.buffer(), "example.com:80");
+
+        // aliasing
+        a.set_encoded_userinfo("u:p");
+        a.set_encoded_userinfo(a.encoded_host());
+        BOOST_TEST_EQ(a.buffer(), "example.com@example.com:80");
+        check(a);
+        a.set_userinfo(a.buffer());
+        BOOST_TEST_EQ(a.buffer(),
+            "example.com%40example.com:80@example.com:80");
+        check(a);
+    }
+
+    void
+    testHost()
+    {
+        authority a("user@example.com:80");
+        a.set_host("[::1]");
+        BOOST_TEST_EQ(a.buffer(), "user@[::1]:80");
+        BOOST_TEST(a.host_type() == host_type::ipv6);
+        check(a);
+        a.set_host("127.0.0.1");
+        BOOST_TEST_EQ(a.buffer(), "user@127.0.0.1:80");
+        BOOST_TEST(a.host_type() == host_type::ipv4);
+        check(a);
+        a.set_host("[v1.x]");
+        BOOST_TEST_EQ(a.buffer(), "user@[v1.x]:80");
+        BOOST_TEST(a.host_type() == host_type::ipvfuture);
+        check(a);
+        a.set_host("my host");
+        BOOST_TEST_EQ(a.buffer(), "user@my%20host:80");
+        BOOST_TEST(a.host_type() == host_type::name);
+        check(a);
+        a.set_host("[x]");
+        BOOST_TEST_EQ(a.buffer(), "user@%5Bx%5D:80");
+        check(a);
+        a.set_encoded_host("b%20ackend.internal");
+        BOOST_TEST_EQ(a.buffer(), "user@b%20ackend.internal:80");
+        check(a);
+        a.set_encoded_host("[::ffff:1.2.3.4]");
+        BOOST_TEST_EQ(a.buffer(), "user@[::ffff:1.2.3.4]:80");
+        check(a);
+        a.set_encoded_host("10.0.0.1");
+        BOOST_TEST(a.host_type() == host_type::ipv4);
+        check(a);
+        a.set_encoded_host("");
+        BOOST_TEST_EQ(a.buffer(), "user@:80");
+        check(a);
+        a.set_host_ipv4(ipv4_address(0x7f000001));
+        BOOST_TEST_EQ(a.buffer(), "user@127.0.0.1:80");
+        check(a);
+        a.set_host_ipv6(ipv6_address("1::6:c0a8:1"));
+        BOOST_TEST_EQ(a.buffer(), "user@[1::6:c0a8:1]:80");
+        check(a);
+        BOOST_TEST_THROWS(a.set_encoded_host("%zz"),
+            system::system_error);
+        BOOST_TEST_EQ(a.buffer(), "user@[1::6:c0a8:1]:80");
+
+        // aliasing
+        a.set_encoded_host("example.com");
+        a.set_encoded_host(a.encoded_userinfo());
+        BOOST_TEST_EQ(a.buffer(), "user@user:80");
+        check(a);
+    }
+
+    void
+    testPort()
+    {
+        authority a("example.com");
+        a.set_port("8080");
+        BOOST_TEST_EQ(a.buffer(), "example.com:8080");
+        BOOST_TEST_EQ(a.port_number(), 8080);
+        check(a);
+        a.set_port_number(443);
+        BOOST_TEST_EQ(a.buffer(), "example.com:443");
+        check(a);
+        a.set_port("");
+        BOOST_TEST_EQ(a.buffer(), "example.com:");
+        BOOST_TEST_EQ(a.port_number(), 0);
+        check(a);
+        a.set_port("99999");
+        BOOST_TEST_EQ(a.port_number(), 0);
+        check(a);
+        a.remove_port();
+        BOOST_TEST_EQ(a.buffer(), "example.com");
+        check(a);
+        a.remove_port();
+        BOOST_TEST_EQ(a.buffer(), "example.com");
+        BOOST_TEST_THROWS(a.set_port("80a"),
+            system::system_error);
+        BOOST_TEST_EQ(a.buffer(), "example.com");
+    }
+
+    void
+    testResize()
+    {
+        // growing past the inline
+        // buffer allocates exactly
+        authority a("h:1");
+        std::string const big(80, 'x');
+        a.set_host(big);
+        BOOST_TEST(! a.is_inline());
+        BOOST_TEST_EQ(a.capacity(), a.size());
+        BOOST_TEST_EQ(a.buffer(), big + ":1");
+        check(a);
+        a.set_userinfo("u");
+        BOOST_TEST_EQ(a.capacity(), a.size());
+        check(a);
+        // shrinking keeps the buffer
+        auto const cap = a.capacity();
+        a.set_host("h");
+        BOOST_TEST_EQ(a.capacity(), cap);
+        BOOST_TEST_EQ(a.buffer(), "u@h:1");
+        check(a);
+        a.clear();
+        BOOST_TEST(a.empty());
+        BOOST_TEST_EQ(a.capacity(), cap);
+        a.set_host("h");
+        BOOST_TEST_EQ(a.buffer(), "h");
+        check(a);
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testUserinfo();
+        testHost();
+        testPort();
+        testResize();
+    }
+};
+
+TEST_SUITE(
+    authority_test,
+    "boost.url.authority");
+
+} // urls
+} // boost
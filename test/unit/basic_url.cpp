@@ -0,0 +1,391 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/basic_url.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <unordered_set>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// monotonic buffer, released all at once
+struct arena
+{
+    char buf[4096];
+    std::size_t used = 0;
+    std::size_t count = 0;
+};
+
+template<class T>
+struct arena_allocator
+{
+    using value_type = T;
+
+    arena* a;
+
+    explicit
+    arena_allocator(arena& a_) noexcept
+        : a(&a_)
+    {
+    }
+
+    template<class U>
+    arena_allocator(
+        arena_allocator<U> const& other) noexcept
+        : a(other.a)
+    {
+    }
+
+    T*
+    allocate(std::size_t n)
+    {
+        if(sizeof(a->buf) - a->used < n)
+            throw std::bad_alloc();
+        T* p = reinterpret_cast<
+            T*>(a->buf + a->used);
+        a->used += n;
+        ++a->count;
+        return p;
+    }
+
+    void
+    deallocate(T*, std::size_t) noexcept
+    {
+    }
+
+    friend
+    bool
+    operator==(
+        arena_allocator const& a0,
+        arena_allocator const& a1) noexcept
+    {
+        return a0.a == a1.a;
+    }
+
+    friend
+    bool
+    operator!=(
+        arena_allocator const& a0,
+        arena_allocator const& a1) noexcept
+    {
+        return a0.a != a1.a;
+    }
+};
+
+// counts outstanding bytes
+struct counted
+{
+    std::size_t bytes = 0;
+};
+
+template<class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counted* c = nullptr;
+
+    counting_allocator() = default;
+
+    explicit
+    counting_allocator(counted& c_) noexcept
+        : c(&c_)
+    {
+    }
+
+    T*
+    allocate(std::size_t n)
+    {
+        if(c)
+            c->bytes += n;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T* p, std::size_t n) noexcept
+    {
+        if(c)
+            c->bytes -= n;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend
+    bool
+    operator==(
+        counting_allocator const& a0,
+        counting_allocator const& a1) noexcept
+    {
+        return a0.c == a1.c;
+    }
+
+    friend
+    bool
+    operator!=(
+        counting_allocator const& a0,
+        counting_allocator const& a1) noexcept
+    {
+        return a0.c != a1.c;
+    }
+};
+
+} // (anon)
+
+struct basic_url_test
+{
+    using arena_url = basic_url<
+        arena_allocator<char>>;
+
+    using counted_url = basic_url<
+        counting_allocator<char>>;
+
+    BOOST_STATIC_ASSERT(
+        std::is_copy_constructible<
+            counted_url>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            counted_url, url_view>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            counted_url, url>::value);
+
+    void
+    testSpecial()
+    {
+        // basic_url()
+        {
+            counted c;
+            counted_url u{counting_allocator<char>(c)};
+            BOOST_TEST_EQ(*u.c_str(), '\0');
+            BOOST_TEST(u.buffer().empty());
+            BOOST_TEST_EQ(u.capacity(), 0u);
+            BOOST_TEST_EQ(c.bytes, 0u);
+        }
+
+        // basic_url(core::string_view)
+        {
+            counted c;
+            BOOST_TEST_THROWS(
+                counted_url("$:$",
+                    counting_allocator<char>(c)),
+                system::system_error);
+            BOOST_TEST_EQ(c.bytes, 0u);
+            {
+                counted_url u(
+                    "http://www.example.com",
+                    counting_allocator<char>(c));
+                BOOST_TEST_EQ(u.buffer(),
+                    "http://www.example.com");
+                BOOST_TEST_EQ(c.bytes,
+                    u.capacity() + 1);
+            }
+            BOOST_TEST_EQ(c.bytes, 0u);
+        }
+
+        // basic_url(basic_url&&)
+        {
+            counted c;
+            counted_url u0(
+                "http://www.example.com",
+                counting_allocator<char>(c));
+            auto const p = u0.c_str();
+            counted_url u1(std::move(u0));
+            BOOST_TEST(u0.buffer().empty());
+            BOOST_TEST_EQ(u1.c_str(), p);
+            BOOST_TEST(
+                u1.get_allocator() ==
+                counting_allocator<char>(c));
+        }
+
+        // basic_url(basic_url const&)
+        {
+            counted c;
+            counted_url u0(
+                "http://www.example.com",
+                counting_allocator<char>(c));
+            counted_url u1(u0);
+            BOOST_TEST_EQ(u0, u1);
+            BOOST_TEST_NE(u0.c_str(), u1.c_str());
+        }
+
+        // basic_url(url_view_base const&)
+        {
+            counted c;
+            url_view uv("http://www.example.com");
+            counted_url u(uv,
+                counting_allocator<char>(c));
+            BOOST_TEST_EQ(u.buffer(), uv.buffer());
+            BOOST_TEST_NE(c.bytes, 0u);
+        }
+
+        // operator=(basic_url&&)
+        {
+            counted c0;
+            counted c1;
+            counted_url u0(
+                "http://www.example.com",
+                counting_allocator<char>(c0));
+            counted_url u1(
+                "/path",
+                counting_allocator<char>(c0));
+
+            // equal allocators
+            auto const p = u0.c_str();
+            u1 = std::move(u0);
+            BOOST_TEST_EQ(u1.c_str(), p);
+            BOOST_TEST(u0.buffer().empty());
+
+            // unequal allocators copy
+            counted_url u2{
+                counting_allocator<char>(c1)};
+            u2 = std::move(u1);
+            BOOST_TEST_EQ(u2.buffer(),
+                "http://www.example.com");
+            BOOST_TEST_NE(u2.c_str(), p);
+            BOOST_TEST(
+                u2.get_allocator() ==
+                counting_allocator<char>(c1));
+            BOOST_TEST_NE(c1.bytes, 0u);
+
+            // and release the moved-from storage
+            BOOST_TEST(u1.empty());
+            BOOST_TEST_EQ(c0.bytes, 0u);
+            u1.set_path("/x");
+            BOOST_TEST_EQ(u1.buffer(), "/x");
+        }
+
+        // operator=(basic_url const&)
+        // operator=(url_view_base const&)
+        {
+            counted c;
+            counted_url u0(
+                "http://www.example.com",
+                counting_allocator<char>(c));
+            counted_url u1{
+                counting_allocator<char>(c)};
+            u1 = u0;
+            BOOST_TEST_EQ(u0, u1);
+            u1 = url_view("/path/to/file.txt");
+            BOOST_TEST_EQ(u1.buffer(),
+                "/path/to/file.txt");
+        }
+
+        // swap
+        {
+            counted c;
+            counted_url u0(
+                "http://www.example.com",
+                counting_allocator<char>(c));
+            counted_url u1(
+                "http://www.boost.org",
+                counting_allocator<char>(c));
+            swap(u0, u1);
+            BOOST_TEST_EQ(u0.buffer(),
+                "http://www.boost.org");
+            BOOST_TEST_EQ(u1.buffer(),
+                "http://www.example.com");
+        }
+    }
+
+    void
+    testGrowth()
+    {
+        // reallocation returns the old buffer
+        {
+            counted c;
+            {
+                counted_url u{
+                    counting_allocator<char>(c)};
+                u.set_scheme("https");
+                u.set_host("www.example.com");
+                for(int i = 0; i < 50; ++i)
+                    u.segments().push_back("segment");
+                u.params().append({"key", "value"});
+                BOOST_TEST_EQ(c.bytes,
+                    u.capacity() + 1);
+                u.clear();
+                BOOST_TEST(u.empty());
+                BOOST_TEST_EQ(c.bytes,
+                    u.capacity() + 1);
+            }
+            BOOST_TEST_EQ(c.bytes, 0u);
+        }
+
+        // request-scoped arena
+        {
+            arena a;
+            {
+                arena_url u(
+                    "https://www.example.com",
+                    arena_allocator<char>(a));
+                u.set_path("/path/to/file.txt");
+                u.set_query("a=1&b=2");
+                u.set_fragment("frag");
+                BOOST_TEST_EQ(u.buffer(),
+                    "https://www.example.com"
+                    "/path/to/file.txt?a=1&b=2#frag");
+                BOOST_TEST_GE(a.count, 1u);
+                BOOST_TEST(
+                    u.c_str() >= a.buf &&
+                    u.c_str() < a.buf + sizeof(a.buf));
+            }
+            BOOST_TEST_NE(a.used, 0u);
+        }
+
+        // arena exhausted
+        {
+            arena a;
+            arena_url u{
+                arena_allocator<char>(a)};
+            std::string s(sizeof(a.buf), 'x');
+            BOOST_TEST_THROWS(
+                u.set_path(s),
+                std::bad_alloc);
+            BOOST_TEST(u.empty());
+        }
+    }
+
+    void
+    testHash()
+    {
+        std::unordered_set<counted_url> s;
+        s.emplace("http://www.example.com");
+        s.emplace("http://www.boost.org");
+        s.emplace("http://www.example.com");
+        BOOST_TEST_EQ(s.size(), 2u);
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testGrowth();
+        testHash();
+    }
+};
+
+TEST_SUITE(
+    basic_url_test,
+    "boost.url.basic_url");
+
+} // urls
+} // boost
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/cache_key_builder.hpp>
+
+#include <boost/url/param_key_set.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct cache_key_builder_test
+{
+    static
+    void
+    check(
+        cache_key_builder const& b,
+        core::string_view in,
+        core::string_view expected)
+    {
+        url_view const u =
+            parse_uri_reference(in).value();
+        BOOST_TEST_EQ(b.key(u), expected);
+        url_view const v =
+            parse_uri_reference(expected).value();
+        BOOST_TEST_EQ(b.key(v), expected);
+        BOOST_TEST_EQ(b.hash(u), b.hash(v));
+        BOOST_TEST_EQ(b.hash(u, 1), b.hash(v, 1));
+        BOOST_TEST_NE(b.hash(u), b.hash(u, 1));
+    }
+
+    // the key is the url edited
+    // one step at a time
+    static
+    void
+    check_edits(core::string_view in)
+    {
+        cache_key_builder b;
+        b.ignore_param("fbclid")
+         .ignore_param_prefix("utm_");
+        param_key_set ks(ignore_case);
+        ks.insert("fbclid");
+        ks.insert_prefix("utm_");
+
+        url u = parse_uri_reference(in).value();
+        u.normalize();
+        u.params().erase(ks);
+        if(u.encoded_params().empty())
+            u.remove_query();
+        u.encoded_params().sort();
+        u.remove_fragment();
+        BOOST_TEST_EQ(b.key(
+            parse_uri_reference(in).value()),
+            u.buffer());
+    }
+
+    void
+    testKey()
+    {
+        cache_key_builder b;
+        check(b, "", "");
+        check(b, "HTTP://Www.Example.COM", "http://www.example.com");
+        check(b, "http://h/%7e%7Ea/b/../c/./d", "http://h/~~a/c/d");
+        check(b, "http://h/%2f%2F%41", "http://h/%2F%2FA");
+        check(b, "http://U%73er:P%61ss@H:80/", "http://User:Pass@h:80/");
+        check(b, "http://[::FFFF:1.2.3.4]/", "http://[::ffff:1.2.3.4]/");
+        check(b, "http://h/?b=2&a=1&%61=3&b=1", "http://h/?a=1&a=3&b=2&b=1");
+        check(b, "http://h/?&b&&a", "http://h/?&&a&b");
+        check(b, "http://h/?", "http://h/?");
+        check(b, "http://h/#f", "http://h/");
+        check(b, "http://h/?a#", "http://h/?a");
+        check(b, "mailto:A@B", "mailto:A@B");
+
+        // the params are unchanged
+        check(b, "http://h/?a%3db=%26%2b%3d+", "http://h/?a%3Db=%26%2B%3D+");
+        check(b, "http://h/?%2B=1&+=2", "http://h/?%2B=1&+=2");
+
+        // a path which starts with "//"
+        check(b, "x:/.//y", "x:/.//y");
+        check(b, "x:/./a/../y", "x:/y");
+
+        // the sort is stable
+        {
+            cache_key_builder b1;
+            b1.sort_params(false);
+            check(b1, "http://h/?b=2&a=1", "http://h/?b=2&a=1");
+        }
+
+        // ignored params
+        {
+            cache_key_builder b1;
+            b1.ignore_param("fbclid")
+              .ignore_param_prefix("utm_");
+            check(b1, "http://h/?utm_source=x&id=1&FBCLID=2&%75tm_x",
+                "http://h/?id=1");
+            check(b1, "http://h/?utm_source=x#f", "http://h/");
+            check(b1, "http://h/?fbclid", "http://h/");
+            check(b1, "http://h/?fbclid=1&", "http://h/?");
+        }
+
+        // default ports
+        {
+            cache_key_builder b1;
+            b1.remove_default_port();
+            check(b1, "http://h:80/", "http://h/");
+            check(b1, "https://h:443/", "https://h/");
+            check(b1, "http://h:/", "http://h/");
+            check(b1, "http://h:8080/", "http://h:8080/");
+            check(b1, "x://h:80/", "x://h:80/");
+        }
+
+        // fragments
+        {
+            cache_key_builder b1;
+            b1.keep_fragment();
+            check(b1, "http://h/#%7e%2f%5b", "http://h/#~/%5B");
+            check(b1, "http://h/?b&a#", "http://h/?a&b#");
+        }
+
+        // many params
+        {
+            std::string s = "http://h/?";
+            std::string r = "http://h/?";
+            for(int i = 40; i-- > 0;)
+            {
+                s += "k" + std::to_string(
+                    i % 10) + "=" + std::to_string(i) + "&";
+            }
+            for(int d = 0; d < 10; ++d)
+                for(int i = 40; i-- > 0;)
+                    if(i % 10 == d)
+                        r += "k" + std::to_string(d) +
+                            "=" + std::to_string(i) + "&";
+            s.pop_back();
+            r.pop_back();
+            check(b, s, r);
+        }
+
+        // long urls
+        {
+            std::string s = "http://h/";
+            s.append(1000, 'x');
+            s += "?b&A#f";
+            std::string r = "http://h/";
+            r.append(1000, 'x');
+            r += "?A&b";
+            check(b, s, r);
+        }
+
+        // the same as editing a url
+        check_edits("HTTP://User@WWW.Example.com:8080/a/%2e%2E/b%7e?q=1&utm_x=2&a=%41#x");
+        check_edits("https://h/p/./q/?fbclid=1&z&y=&x=%7a");
+        check_edits("https://h?utm_a&utm_b");
+        check_edits("http://[v1.FF]/?b=1&b=0&a");
+
+        // string tokens
+        {
+            std::string s = "key:";
+            b.key(url_view("HTTP://H/?b&a"),
+                string_token::append_to(s));
+            BOOST_TEST_EQ(s, "key:http://h/?a&b");
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // class
+        {
+        cache_key_builder b;
+        b.ignore_param_prefix( "utm_" )
+         .ignore_param( "fbclid" );
+
+        url_view u( "HTTPS://Example.com/a/./%7Euser?z=1&utm_source=x&a=2#top" );
+        assert( b.key( u ) == "https://example.com/a/~user?a=2&z=1" );
+        assert( b.hash( u ) == b.hash( url_view( "https://example.com/a/~user?a=2&z=1" ) ) );
+        }
+
+        // key
+        {
+        cache_key_builder b;
+        assert( b.key( url_view( "http://H/%61/../b?y&x#f" ) ) == "http://h/b?x&y" );
+        }
+    }
+
+    void
+    run()
+    {
+        testKey();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    cache_key_builder_test,
+    "boost.url.cache_key_builder");
+
+} // urls
+} // boost
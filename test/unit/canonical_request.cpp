@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/canonical_request.hpp>
+
+#include <boost/url/encode.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct canonical_request_test
+{
+    // a sink like the update
+    // function of a hash
+    struct hash_sink
+    {
+        std::string s;
+        std::size_t calls = 0;
+
+        void
+        operator()(
+            char const* p,
+            std::size_t n)
+        {
+            BOOST_TEST_GT(n, 0u);
+            s.append(p, n);
+            ++calls;
+        }
+    };
+
+    static
+    std::string
+    uri(core::string_view s)
+    {
+        hash_sink h;
+        write_canonical_uri(
+            parse_uri_reference(s).value(), h);
+        return h.s;
+    }
+
+    static
+    std::string
+    query(core::string_view s)
+    {
+        hash_sink h;
+        write_canonical_query(
+            parse_uri_reference(s).value(), h);
+        return h.s;
+    }
+
+    static
+    std::string
+    host(core::string_view s)
+    {
+        hash_sink h;
+        write_canonical_host(
+            parse_uri_reference(s).value(), h);
+        return h.s;
+    }
+
+    static
+    std::string
+    reencode(pct_string_view s)
+    {
+        return encode(s.decode(),
+            unreserved_chars);
+    }
+
+    // the canonical query built
+    // one string at a time
+    static
+    std::string
+    slow_query(url_view u)
+    {
+        std::vector<std::pair<
+            std::string, std::string>> v;
+        for(auto p : u.encoded_params())
+        {
+            if( p.key.empty() &&
+                ! p.has_value)
+                continue;
+            v.emplace_back(
+                reencode(p.key),
+                reencode(p.value));
+        }
+        std::sort(v.begin(), v.end());
+        std::string r;
+        for(auto const& p : v)
+        {
+            if(! r.empty())
+                r += '&';
+            r += p.first + "=" + p.second;
+        }
+        return r;
+    }
+
+    void
+    testUri()
+    {
+        BOOST_TEST_EQ(uri("https://h"), "/");
+        BOOST_TEST_EQ(uri("https://h/"), "/");
+        BOOST_TEST_EQ(uri("https://h/a/b/"), "/a/b/");
+        BOOST_TEST_EQ(uri("https://h/test.txt"), "/test.txt");
+        BOOST_TEST_EQ(uri("https://h/a%7eb/c%20d/%2f"), "/a~b/c%20d/%2F");
+        BOOST_TEST_EQ(uri("https://h/a+b/$x!/(*)"), "/a%2Bb/%24x%21/%28%2A%29");
+        BOOST_TEST_EQ(uri("https://h/%c3%a9"), "/%C3%A9");
+        BOOST_TEST_EQ(uri("https://h//a//"), "//a//");
+        BOOST_TEST_EQ(uri("https://h/a/../b"), "/a/../b");
+        BOOST_TEST_EQ(uri("a/b"), "/a/b");
+
+        // long paths are written in blocks
+        {
+            std::string s = "https://h/";
+            std::string r = "/";
+            for(int i = 0; i < 500; ++i)
+            {
+                s += "%20x";
+                r += "%20x";
+            }
+            hash_sink h;
+            write_canonical_uri(
+                parse_uri(s).value(), h);
+            BOOST_TEST_EQ(h.s, r);
+            BOOST_TEST_GT(h.calls, 1u);
+        }
+    }
+
+    void
+    testQuery()
+    {
+        BOOST_TEST_EQ(query("https://h/"), "");
+        BOOST_TEST_EQ(query("https://h/?"), "");
+        BOOST_TEST_EQ(query("https://h/?&&"), "");
+        BOOST_TEST_EQ(query("https://h/?Action=ListUsers&Version=2010-05-08"),
+            "Action=ListUsers&Version=2010-05-08");
+        BOOST_TEST_EQ(query("https://h/?b=2&a&%61=1&c=x+y"),
+            "a=&a=1&b=2&c=x%2By");
+        BOOST_TEST_EQ(query("https://h/?k=b&k=a&k=%41"),
+            "k=A&k=a&k=b");
+        BOOST_TEST_EQ(query("https://h/?=1"), "=1");
+        BOOST_TEST_EQ(query("https://h/?x=a=b"), "x=a%3Db");
+        BOOST_TEST_EQ(query("https://h/?prefix=%2Fsome%20dir&delimiter=/"),
+            "delimiter=%2F&prefix=%2Fsome%20dir");
+
+        // keys are sorted by their encoded
+        // forms, not their decoded forms
+        BOOST_TEST_EQ(query("https://h/?%7E=1&%C3%A9=2&a-b=3&a=4"),
+            "%C3%A9=2&a=4&a-b=3&~=1");
+
+        // the same as building each string
+        {
+            char const* const cs[] = {
+                "https://h/?z=1&y&x=&w=%20&v=%7e&u=%ff",
+                "https://h/?%21=1&%2a=2&A=3&a=4&_=5&~=6&%7f=7",
+                "https://h/?a=2&a=10&a=1&a&a=",
+                };
+            for(auto s : cs)
+            {
+                url_view u(s);
+                BOOST_TEST_EQ(query(s), slow_query(u));
+            }
+        }
+
+        // many params
+        {
+            std::string s = "https://h/?";
+            for(int i = 100; i-- > 0;)
+                s += "k" + std::to_string(i % 7) +
+                    "=" + std::to_string(i) + "&";
+            url_view u(s);
+            BOOST_TEST_EQ(query(s), slow_query(u));
+        }
+    }
+
+    void
+    testHost()
+    {
+        BOOST_TEST_EQ(host("https://Bucket.S3.Amazonaws.com/k"),
+            "bucket.s3.amazonaws.com");
+        BOOST_TEST_EQ(host("https://H:8443/k"), "h:8443");
+        BOOST_TEST_EQ(host("https://H:/k"), "h");
+        BOOST_TEST_EQ(host("https://X%C3%A9/"), "x%C3%A9");
+        BOOST_TEST_EQ(host("https://[::FFFF:1.2.3.4]:80"), "[::ffff:1.2.3.4]:80");
+        BOOST_TEST_EQ(host("/path"), "");
+    }
+
+    void
+    testJavadocs()
+    {
+        // write_canonical_uri
+        {
+        std::string s;
+        write_canonical_uri( url_view( "https://h/a%7eb/c%20d/%2f" ),
+            [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+        assert( s == "/a~b/c%20d/%2F" );
+        }
+
+        // write_canonical_query
+        {
+        std::string s;
+        write_canonical_query( url_view( "https://h/?b=2&a&%61=1&c=x+y" ),
+            [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+        assert( s == "a=&a=1&b=2&c=x%2By" );
+        }
+
+        // write_canonical_host
+        {
+        std::string s;
+        write_canonical_host( url_view( "https://Bucket.S3.Amazonaws.com:8443/k" ),
+            [&s]( char const* p, std::size_t n ) { s.append( p, n ); } );
+        assert( s == "bucket.s3.amazonaws.com:8443" );
+        }
+    }
+
+    void
+    run()
+    {
+        testUri();
+        testQuery();
+        testHost();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    canonical_request_test,
+    "boost.url.canonical_request");
+
+} // urls
+} // boost
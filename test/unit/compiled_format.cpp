@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/compiled_format.hpp>
+
+#include <boost/url/format.hpp>
+#include <boost/url/static_url.hpp>
+#include "test_suite.hpp"
+
+namespace boost {
+namespace urls {
+
+struct compiled_format_test
+{
+    // compiled_format agrees with format,
+    // arguments are copied because named
+    // arguments bind to rvalues
+    template <class... Args>
+    static
+    void
+    check(
+        core::string_view fmt,
+        Args... args)
+    {
+        compiled_format const f(fmt);
+        BOOST_TEST_EQ(f.buffer(), fmt);
+        url u0 = urls::format(fmt, Args(args)...);
+        url u1 = f.format(Args(args)...);
+        BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+        BOOST_TEST(u1 == u0);
+        BOOST_TEST_EQ(
+            u1.encoded_segments().size(),
+            u0.encoded_segments().size());
+        BOOST_TEST_EQ(
+            u1.encoded_params().size(),
+            u0.encoded_params().size());
+        BOOST_TEST(u1.host_type() == u0.host_type());
+        BOOST_TEST_EQ(u1.port_number(), u0.port_number());
+
+        // reuse
+        url u2 = f.format(Args(args)...);
+        BOOST_TEST_EQ(u2.buffer(), u0.buffer());
+        f.format_to(u2, Args(args)...);
+        BOOST_TEST_EQ(u2.buffer(), u0.buffer());
+    }
+
+    void
+    testSpecial()
+    {
+        // compiled_format(core::string_view)
+        {
+            compiled_format f("https://{}/users/{id}");
+            url u = f.format("example.com", arg("id", 42));
+            BOOST_TEST_EQ(u.buffer(), "https://example.com/users/42");
+            u = f.format("a.b", arg("id", 1));
+            BOOST_TEST_EQ(u.buffer(), "https://a.b/users/1");
+        }
+        {
+            BOOST_TEST_THROWS(
+                compiled_format("{:"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                compiled_format("{://"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                compiled_format("http:%"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                compiled_format("/a b/{}"),
+                system::system_error);
+        }
+
+        // copies
+        {
+            compiled_format f("/{}/b?{}");
+            compiled_format f2(f);
+            url u = f2.format('a', "k=v");
+            BOOST_TEST_EQ(u.buffer(), "/a/b?k=v");
+            compiled_format f3("x");
+            f3 = f;
+            BOOST_TEST_EQ(f3.buffer(), "/{}/b?{}");
+            BOOST_TEST_EQ(
+                f3.format('c', 'd').buffer(), "/c/b?d");
+        }
+    }
+
+    void
+    testFormat()
+    {
+        check("http:");
+        check("{}:", "http");
+        check("{}://", "http");
+        check("{}:///", "http");
+        check("{}://{}", "http", "a.b");
+        check("{}://[{}]", "http", "fe80::1ff:fe23:4567:890a");
+        check("{}:?q", "http");
+        check("{}:/", "http");
+        check("{}:path:to:joe", "mailto");
+        check("{}:{}", "mailto", "joe");
+        check("{}:{}/a/{}/b", "http", 'a', 'b');
+        check("http://www.a.org");
+        check("{}://u@www.a.org", "http");
+        check("{}://{}@www.a.org", "http", "user");
+        check("{}://{}:{}@www.a.org", "http", "u", "p");
+        check("{}://{}:{}@{}:80", "http", 'u', 'p', "a.b");
+        check("{}://{}:{}@{}:", "http", 'u', 'p', "a.b");
+        check("{}://{}:{}@{}:{}", "http", 'u', 'p', "a.b", 80);
+        check("{}://{}?{}", "http", "a.b", "k=v");
+        check("{}://{}:{}@{}:{}/{}/{}/{}?{}",
+            "http", 'u', 'p', "a.b", 80, 'a', 'b', 'c', "k=v");
+        check("/{}/b/{}/d?{}", 'a', 'c', "k=v");
+        check("");
+        check("/");
+        check("a");
+        check("//{}", "a.b");
+        check("{}", 0);
+        check("a?{}#{}", 'q', 'f');
+        check("{}://{}?{}#{}", "http", "a.b", 'q', 'f');
+        check("http{}://{}.{}.com:{}/{}/file.txt?k={}#frag-{}",
+            "s", "www", "boost", 443, "path", "val", 2);
+        check("//{}", ':');
+        check("{}", "::joe:/b:");
+        check("{}:{}", "http", "//joe");
+        check("{}", "//joe");
+        check("/{}/{}/{}", 'a', 'b');
+        check("/a/{}", "c d");
+        check("/{}", "%41?#");
+        check("{}://{}:{}@{}", "http", "u@", "p:", "a b");
+        check("//[{}]:{}", "::1", 8080);
+        check("//{}:{}", "1.2.3.4", 0);
+    }
+
+    void
+    testSpecs()
+    {
+        check("{:^3s}", 'a');
+        check("{:.>{}s}", 'a', 5);
+        check("{:.>{1}s}", 'a', 5);
+        check("{0:.>{2}s}/{1}", 'a', 'b', 5);
+        check("{:.>{b}s}", 'a', arg("b", 5));
+        check("{:^6d}", 99);
+        check("{:>+06d}", 99);
+        check("{0:.>{2}d}/{1}", 99, 'b', 6);
+        check("{1}/{0}/{1}", 'a', 'b');
+        check("/{x}/{y}/{x}", arg("x", 1), arg("y", "z"));
+        check("{}/{:.>{}d}/{}", 'a', 99, 6, 'b');
+
+        compiled_format f("{x}://{y}/{}");
+        static_url<64> u;
+        f.format_to(u, {'p', {"x", "https"}, {"y", "a.b"}});
+        BOOST_TEST_EQ(u.buffer(), "https://a.b/p");
+        url u2 = f.format({'q', {"x", "http"}, {"y", "c.d"}});
+        BOOST_TEST_EQ(u2.buffer(), "http://c.d/q");
+    }
+
+    void
+    testErrors()
+    {
+        compiled_format f("{}://www.a.com");
+        BOOST_TEST_THROWS(
+            f.format("1nvalid scheme"),
+            system::system_error);
+        BOOST_TEST_NO_THROW(f.format("https"));
+
+        compiled_format f2("{}://{}:{}@{}:{}");
+        BOOST_TEST_THROWS(
+            f2.format("http", 'u', 'p', "a.b", 'a'),
+            system::system_error);
+
+        // strong guarantee
+        static_url<16> u("x:y");
+        compiled_format f3("http://{}");
+        BOOST_TEST_THROWS(
+            f3.format_to(u, "a-very-long-host-name"),
+            std::exception);
+        BOOST_TEST_EQ(u.buffer(), "x:y");
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testFormat();
+        testSpecs();
+        testErrors();
+    }
+};
+
+TEST_SUITE(
+    compiled_format_test,
+    "boost.url.compiled_format");
+
+} // urls
+} // boost
@@ -0,0 +1,231 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/cookie_match.hpp>
+
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct cookie_match_test
+{
+    void
+    testDomainMatch()
+    {
+        auto const f = [](
+            core::string_view u,
+            core::string_view d)
+        {
+            return domain_match(url_view(u), d);
+        };
+        BOOST_TEST(f("http://example.com/", "example.com"));
+        BOOST_TEST(f("http://EXAMPLE.com/", "example.COM"));
+        BOOST_TEST(f("http://www.example.com/", "example.com"));
+        BOOST_TEST(f("http://a.b.example.com/", ".example.com"));
+        BOOST_TEST(f("http://www.example.com/", "www.example.com"));
+        BOOST_TEST(! f("http://badexample.com/", "example.com"));
+        BOOST_TEST(! f("http://example.com/", "www.example.com"));
+        BOOST_TEST(! f("http://example.com/", "com."));
+        BOOST_TEST(! f("http://example.com/", ""));
+        BOOST_TEST(! f("http://example.com/", "."));
+        BOOST_TEST(! f("file:///x", ""));
+
+        // IP addresses only match themselves
+        BOOST_TEST(f("http://10.0.0.1/", "10.0.0.1"));
+        BOOST_TEST(! f("http://10.0.0.1/", "0.0.1"));
+        BOOST_TEST(f("http://[::1]:80/", "::1"));
+        BOOST_TEST(! f("http://[::1]/", "1"));
+
+        // a long host, for the vector compare
+        std::string const h(
+            "a-very-long-subdomain-name.of-a-long-domain-name.example.com");
+        BOOST_TEST(f("http://www." + h + "/", h));
+        BOOST_TEST(! f("http://www." + h + "/", "x" + h.substr(1)));
+    }
+
+    void
+    testPublicSuffix()
+    {
+        public_suffix_list psl(
+            "com\n"
+            "uk\n"
+            "co.uk\n"
+            "*.ck\n"
+            "!www.ck\n");
+        auto const f = [&psl](
+            core::string_view u,
+            core::string_view d)
+        {
+            return domain_match(url_view(u), d, psl);
+        };
+        BOOST_TEST(f("http://www.example.co.uk/", "example.co.uk"));
+        BOOST_TEST(f("http://www.example.co.uk/", "www.example.co.uk"));
+        BOOST_TEST(! f("http://www.example.co.uk/", "co.uk"));
+        BOOST_TEST(! f("http://www.example.co.uk/", "uk"));
+        BOOST_TEST(! f("http://www.example.com/", "com"));
+        BOOST_TEST(f("http://www.example.com/", "example.com"));
+        BOOST_TEST(! f("http://a.b.ck/", "b.ck"));
+        BOOST_TEST(f("http://a.www.ck/", "www.ck"));
+
+        // a host equal to a public suffix
+        BOOST_TEST(f("http://co.uk/", "co.uk"));
+        BOOST_TEST(f("http://10.0.0.1/", "10.0.0.1"));
+        BOOST_TEST(! f("http://www.example.com/", "example.org"));
+    }
+
+    void
+    testPathMatch()
+    {
+        auto const f = [](
+            core::string_view u,
+            core::string_view p)
+        {
+            return path_match(url_view(u), p);
+        };
+        BOOST_TEST(f("http://h/", "/"));
+        BOOST_TEST(f("http://h/docs", "/"));
+        BOOST_TEST(f("http://h/docs", "/docs"));
+        BOOST_TEST(f("http://h/docs/", "/docs"));
+        BOOST_TEST(f("http://h/docs/a", "/docs"));
+        BOOST_TEST(f("http://h/docs/a", "/docs/"));
+        BOOST_TEST(! f("http://h/docs", "/docs/"));
+        BOOST_TEST(! f("http://h/docsets", "/docs"));
+        BOOST_TEST(! f("http://h/Docs", "/docs"));
+        BOOST_TEST(! f("http://h/", "/docs"));
+        BOOST_TEST(f("http://h", "/"));
+        BOOST_TEST(f("http://h?q", "/"));
+        BOOST_TEST(! f("http://h", "/a"));
+        BOOST_TEST(f("http://h/a%20b/c", "/a%20b"));
+        BOOST_TEST(! f("http://h/a%20b/c", "/a b"));
+    }
+
+    void
+    testDefaultPath()
+    {
+        auto const f = [](core::string_view u)
+        {
+            return default_cookie_path(url_view(u));
+        };
+        BOOST_TEST_EQ(f("http://h"), "/");
+        BOOST_TEST_EQ(f("http://h/"), "/");
+        BOOST_TEST_EQ(f("http://h/a"), "/");
+        BOOST_TEST_EQ(f("http://h/a/"), "/a");
+        BOOST_TEST_EQ(f("http://h/a/b"), "/a");
+        BOOST_TEST_EQ(f("http://h/a/b/c?q"), "/a/b");
+        BOOST_TEST_EQ(f("x:a/b"), "/");
+    }
+
+    void
+    testIndex()
+    {
+        cookie_index idx;
+        BOOST_TEST(idx.empty());
+        std::vector<std::size_t> ids;
+        BOOST_TEST_EQ(idx.match(
+            url_view("http://example.com/"), ids), 0u);
+
+        idx.insert(1, "example.com", "/");
+        idx.insert(2, "www.example.com", "/docs", true);
+        idx.insert(3, "other.com", "/");
+        idx.insert(4, ".Example.COM", "/private/");
+        idx.insert(5, "example.com", "/", true);
+        idx.insert(6, "", "/");
+        BOOST_TEST_EQ(idx.size(), 5u);
+
+        auto const match = [&](core::string_view u)
+        {
+            ids.clear();
+            auto const n = idx.match(url_view(u), ids);
+            BOOST_TEST_EQ(n, ids.size());
+            return ids;
+        };
+        using v = std::vector<std::size_t>;
+        BOOST_TEST(match("https://www.example.com/docs/a") == v({2, 1}));
+        BOOST_TEST(match("https://WWW.example.com/docs") == v({2, 1}));
+        BOOST_TEST(match("https://www.example.com/") == v({1}));
+        BOOST_TEST(match("https://a.www.example.com/docs") == v({1}));
+        BOOST_TEST(match("https://example.com/private/x") == v({1, 4, 5}));
+        BOOST_TEST(match("https://example.com/private") == v({1, 5}));
+        BOOST_TEST(match("https://example.com") == v({1, 5}));
+        BOOST_TEST(match("https://badexample.com/") == v());
+        BOOST_TEST(match("https://com/") == v());
+        BOOST_TEST(match("https://other.com/a") == v({3}));
+        BOOST_TEST(match("file:///a") == v());
+
+        // erase
+        BOOST_TEST_EQ(idx.erase(1, ".example.com"), 1u);
+        BOOST_TEST_EQ(idx.erase(1, "example.com"), 0u);
+        BOOST_TEST_EQ(idx.erase(1, "nowhere.com"), 0u);
+        BOOST_TEST_EQ(idx.size(), 4u);
+        BOOST_TEST(match("https://example.com/private/x") == v({4, 5}));
+        BOOST_TEST_EQ(idx.erase(5, "example.com"), 1u);
+        BOOST_TEST(match("https://example.com/private/x") == v({4}));
+        idx.insert(7, "example.com", "/");
+        BOOST_TEST(match("https://example.com/private/x") == v({4, 7}));
+        BOOST_TEST_EQ(idx.erase(4, "example.com"), 1u);
+        BOOST_TEST_EQ(idx.erase(7, "example.com"), 1u);
+        BOOST_TEST(match("https://example.com/") == v());
+        idx.insert(8, "example.com", "/");
+        BOOST_TEST(match("https://example.com/") == v({8}));
+
+        // the same id twice
+        idx.insert(9, "a.com", "/x");
+        idx.insert(9, "a.com", "/");
+        BOOST_TEST(match("https://a.com/x") == v({9, 9}));
+        BOOST_TEST_EQ(idx.erase(9, "a.com"), 2u);
+
+        // IP hosts have no parents
+        idx.insert(10, "10.0.0.1", "/");
+        idx.insert(11, "0.0.1", "/");
+        BOOST_TEST(match("http://10.0.0.1/") == v({10}));
+        idx.insert(12, "::1", "/");
+        BOOST_TEST(match("http://[::1]/") == v({12}));
+    }
+
+    void
+    testManyDomains()
+    {
+        cookie_index idx;
+        for(std::size_t i = 0; i < 1000; ++i)
+            idx.insert(i, "d" + std::to_string(i) + ".example.com", "/");
+        idx.insert(1000, "example.com", "/");
+        BOOST_TEST_EQ(idx.size(), 1001u);
+        std::vector<std::size_t> ids;
+        idx.match(url_view("https://www.d500.example.com/"), ids);
+        BOOST_TEST(ids == std::vector<std::size_t>({500, 1000}));
+        ids.clear();
+        idx.match(url_view("https://d5000.example.com/"), ids);
+        BOOST_TEST(ids == std::vector<std::size_t>({1000}));
+    }
+
+    void
+    run()
+    {
+        testDomainMatch();
+        testPublicSuffix();
+        testPathMatch();
+        testDefaultPath();
+        testIndex();
+        testManyDomains();
+    }
+};
+
+TEST_SUITE(
+    cookie_match_test,
+    "boost.url.cookie_match");
+
+} // urls
+} // boost
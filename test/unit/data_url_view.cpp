@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/data_url_view.hpp>
+
+#include <boost/url/error.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct data_url_view_test
+{
+    static
+    std::string
+    decode(data_url_view const& d)
+    {
+        std::string s(d.max_decoded_size(), '\0');
+        auto rv = d.decode(&s[0], s.size());
+        if(! BOOST_TEST(rv.has_value()))
+            return {};
+        BOOST_TEST_LE(*rv, s.size());
+        s.resize(*rv);
+        return s;
+    }
+
+    static
+    std::string
+    decode(core::string_view s)
+    {
+        auto rv = parse_data_url(s);
+        if(! BOOST_TEST(rv.has_value()))
+            return {};
+        return decode(*rv);
+    }
+
+    static
+    std::string
+    encode_base64(core::string_view s)
+    {
+        static char const* const alphabet =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz"
+            "0123456789+/";
+        std::string r;
+        std::size_t i = 0;
+        for(; i + 3 <= s.size(); i += 3)
+        {
+            unsigned v =
+                static_cast<unsigned char>(s[i]) << 16 |
+                static_cast<unsigned char>(s[i + 1]) << 8 |
+                static_cast<unsigned char>(s[i + 2]);
+            r.push_back(alphabet[v >> 18]);
+            r.push_back(alphabet[(v >> 12) & 63]);
+            r.push_back(alphabet[(v >> 6) & 63]);
+            r.push_back(alphabet[v & 63]);
+        }
+        if(i < s.size())
+        {
+            unsigned v =
+                static_cast<unsigned char>(s[i]) << 16;
+            if(i + 1 < s.size())
+                v |= static_cast<unsigned char>(s[i + 1]) << 8;
+            r.push_back(alphabet[v >> 18]);
+            r.push_back(alphabet[(v >> 12) & 63]);
+            if(i + 1 < s.size())
+                r.push_back(alphabet[(v >> 6) & 63]);
+            else
+                r.push_back('=');
+            r.push_back('=');
+        }
+        return r;
+    }
+
+    void
+    testParse()
+    {
+        auto bad = [](core::string_view s)
+        {
+            BOOST_TEST(parse_data_url(s).has_error());
+        };
+        bad("");
+        bad("data:");
+        bad("data:text/plain");
+        bad("http://example.com/,a");
+        bad("data://example.com/,a");
+        bad("data:,%");
+        bad("data:, a");
+
+        {
+            auto rv = parse_data_url("data:,");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST(rv->media_type().empty());
+                BOOST_TEST(rv->parameters().empty());
+                BOOST_TEST(! rv->is_base64());
+                BOOST_TEST(rv->encoded_data().empty());
+                BOOST_TEST_EQ(rv->max_decoded_size(), 0u);
+            }
+        }
+        {
+            core::string_view s =
+                "DATA:image/svg+xml;charset=utf-8;name=a%20b;BASE64,PHN2Zz4=#frag";
+            auto rv = parse_data_url(s);
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST_EQ(rv->buffer(), s);
+                BOOST_TEST_EQ(rv->media_type(), "image/svg+xml");
+                BOOST_TEST_EQ(rv->parameters(), "charset=utf-8;name=a%20b");
+                BOOST_TEST_EQ(rv->parameters().decode(), "charset=utf-8;name=a b");
+                BOOST_TEST(rv->is_base64());
+                BOOST_TEST_EQ(rv->encoded_data(), "PHN2Zz4=");
+                BOOST_TEST_EQ(decode(*rv), "<svg>");
+                // no copies
+                BOOST_TEST(rv->encoded_data().data() > s.data());
+                BOOST_TEST(rv->encoded_data().data() < s.data() + s.size());
+            }
+        }
+        {
+            auto rv = parse_data_url("data:text/plain,a,b?c;d#e");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST_EQ(rv->media_type(), "text/plain");
+                BOOST_TEST(rv->parameters().empty());
+                BOOST_TEST(! rv->is_base64());
+                BOOST_TEST_EQ(rv->encoded_data(), "a,b?c;d");
+            }
+        }
+        {
+            auto rv = parse_data_url("data:;base64,");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST(rv->media_type().empty());
+                BOOST_TEST(rv->parameters().empty());
+                BOOST_TEST(rv->is_base64());
+            }
+        }
+        {
+            // not the flag
+            auto rv = parse_data_url("data:text/plain;xbase64,QQ");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST_EQ(rv->parameters(), "xbase64");
+                BOOST_TEST(! rv->is_base64());
+                BOOST_TEST_EQ(decode(*rv), "QQ");
+            }
+        }
+    }
+
+    void
+    testDecode()
+    {
+        BOOST_TEST_EQ(decode("data:,Hello%2C%20World%21"), "Hello, World!");
+        BOOST_TEST_EQ(decode("data:,A%20brief%20note"), "A brief note");
+        BOOST_TEST_EQ(decode("data:;base64,SGVsbG8="), "Hello");
+        BOOST_TEST_EQ(decode("data:;base64,SGVsbG8"), "Hello");
+        BOOST_TEST_EQ(decode("data:;base64,SGVsbA=="), "Hell");
+        BOOST_TEST_EQ(decode("data:;base64,SGVsbA"), "Hell");
+        BOOST_TEST_EQ(decode("data:;base64,SGVs"), "Hel");
+        BOOST_TEST_EQ(decode("data:;base64,SGVs%0D%0AbG8%3D"), "Hello");
+        BOOST_TEST_EQ(decode("data:;base64,%2B%2F%2b%2f"), "\xfb\xff\xbf");
+
+        // every length, with the blocks
+        // decoded sixteen at a time
+        std::string in;
+        for(int i = 0; i < 300; ++i)
+        {
+            std::string s = "data:;base64," +
+                encode_base64(in);
+            BOOST_TEST_EQ(decode(s), in);
+            // escape one character
+            if(s.size() > 40)
+            {
+                static char const* const hex =
+                    "0123456789ABCDEF";
+                unsigned char const c = s[30];
+                char const e[] = {
+                    '%', hex[c >> 4], hex[c & 15] };
+                s.replace(30, 1, e, 3);
+                BOOST_TEST_EQ(decode(s), in);
+            }
+            in.push_back(static_cast<char>(i * 7 + 3));
+        }
+
+        auto invalid = [](core::string_view s)
+        {
+            auto rv = parse_data_url(s);
+            if(! BOOST_TEST(rv.has_value()))
+                return;
+            char buf[64];
+            BOOST_TEST(rv->decode(buf, sizeof(buf)).has_error());
+        };
+        invalid("data:;base64,S");
+        invalid("data:;base64,SGVsbG8=A");
+        invalid("data:;base64,SGVsbG8=?");
+        invalid("data:;base64,SGVsb===");
+        invalid("data:;base64,=");
+        invalid("data:;base64,SGVsbG8-");
+        invalid("data:;base64,SGVsbG8_");
+        invalid("data:;base64,SGVsbG8%00");
+        invalid("data:;base64,SGVsbG8.SGVsbG8.SGVsbG8.SGVsbG8");
+
+        // buffer too small
+        {
+            auto d = parse_data_url(
+                "data:;base64,SGVsbG8gV29ybGQhIEhlbGxvIFdvcmxkIQ==").value();
+            char buf[64];
+            auto rv = d.decode(buf, 10);
+            BOOST_TEST(rv.error() == error::no_space);
+            rv = d.decode(buf, d.max_decoded_size());
+            if(BOOST_TEST(rv.has_value()))
+                BOOST_TEST_EQ(
+                    core::string_view(buf, *rv),
+                    "Hello World! Hello World!");
+        }
+        {
+            auto d = parse_data_url(
+                "data:,Hello%2C%20World%21").value();
+            char buf[64];
+            auto rv = d.decode(buf, 12);
+            BOOST_TEST(rv.error() == error::no_space);
+            rv = d.decode(buf, 13);
+            BOOST_TEST(rv.has_value());
+        }
+    }
+
+    void
+    testJavadoc()
+    {
+        data_url_view d = parse_data_url(
+            "data:text/plain;charset=utf-8;base64,SGVsbG8=" ).value();
+
+        assert( d.media_type() == "text/plain" );
+        assert( d.parameters() == "charset=utf-8" );
+        assert( d.is_base64() );
+
+        std::string s( d.max_decoded_size(), '\0' );
+        s.resize( d.decode( &s[0], s.size() ).value() );
+        assert( s == "Hello" );
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testDecode();
+        testJavadoc();
+    }
+};
+
+TEST_SUITE(
+    data_url_view_test,
+    "boost.url.data_url_view");
+
+} // urls
+} // boost
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/decode_in_place.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct decode_in_place_test
+{
+    static
+    void
+    check(
+        core::string_view s0,
+        core::string_view s1,
+        encoding_opts opt = {})
+    {
+        std::string s(s0);
+        auto rv = decode_in_place(s, opt);
+        BOOST_TEST(rv.has_value());
+        BOOST_TEST_EQ(s, s1);
+
+        std::string b(s0);
+        auto rv1 = decode_in_place(
+            &b[0], b.size(), opt);
+        if(! BOOST_TEST(rv1.has_value()))
+            return;
+        BOOST_TEST_EQ(core::string_view(
+            b.data(), *rv1), s1);
+    }
+
+    static
+    void
+    bad(core::string_view s0)
+    {
+        std::string s(s0);
+        BOOST_TEST(decode_in_place(
+            s).has_error());
+        // unchanged
+        BOOST_TEST_EQ(s, s0);
+
+        std::vector<param_view> v;
+        BOOST_TEST(decode_params_in_place(
+            s, v).has_error());
+        BOOST_TEST_EQ(s, s0);
+        BOOST_TEST(v.empty());
+    }
+
+    void
+    testDecode()
+    {
+        check("", "");
+        check("abc", "abc");
+        check("%41", "A");
+        check("%41%42%43", "ABC");
+        check("Program%20Files", "Program Files");
+        check("%2b+x", "++x");
+        check("%2b+x", "+ x", encoding_opts(true));
+        check("%00", std::string(1, '\0'));
+        check("a%2fb%2Fc", "a/b/c");
+
+        bad("%");
+        bad("%4");
+        bad("%4G");
+        bad("abc%");
+        bad("%%41");
+    }
+
+    void
+    testParams()
+    {
+        auto const check = [](
+            core::string_view s0,
+            std::vector<param_view> const& v1,
+            encoding_opts opt = {})
+        {
+            std::string s(s0);
+            std::vector<param_view> v;
+            auto rv = decode_params_in_place(
+                s, v, opt);
+            if(! BOOST_TEST(rv.has_value()))
+                return;
+            if(! BOOST_TEST_EQ(v.size(), v1.size()))
+                return;
+            std::size_t n = 0;
+            for(std::size_t i = 0; i < v.size(); ++i)
+            {
+                BOOST_TEST_EQ(v[i].key, v1[i].key);
+                BOOST_TEST_EQ(v[i].value, v1[i].value);
+                BOOST_TEST_EQ(v[i].has_value,
+                    v1[i].has_value);
+                // packed in the string
+                BOOST_TEST_EQ(v[i].key.data(),
+                    s.data() + n);
+                n += v[i].key.size();
+                if(v[i].has_value)
+                {
+                    BOOST_TEST_EQ(v[i].value.data(),
+                        s.data() + n);
+                    n += v[i].value.size();
+                }
+            }
+            BOOST_TEST_EQ(s.size(), n);
+        };
+
+        check("", {});
+        check("a", {{"a", no_value}});
+        check("a=", {{"a", ""}});
+        check("=", {{"", ""}});
+        check("&", {
+            {"", no_value},
+            {"", no_value}});
+        check("a=1&b=2", {
+            {"a", "1"},
+            {"b", "2"}});
+        check("a=1&a=2&&c", {
+            {"a", "1"},
+            {"a", "2"},
+            {"", no_value},
+            {"c", no_value}});
+        check("k%3D=v%26w=x", {
+            {"k=", "v&w=x"}});
+        check("name=John+Doe&msg=a%26b", {
+            {"name", "John+Doe"},
+            {"msg", "a&b"}});
+        check("name=John+Doe&msg=a%26b", {
+            {"name", "John Doe"},
+            {"msg", "a&b"}},
+            encoding_opts(true));
+        check("%41%42=%43%44&e%46=g%48", {
+            {"AB", "CD"},
+            {"eF", "gH"}});
+
+        // params are appended
+        {
+            std::string s = "a=1";
+            std::vector<param_view> v;
+            v.emplace_back("x", "y");
+            BOOST_TEST(decode_params_in_place(
+                s, v).has_value());
+            BOOST_TEST_EQ(v.size(), 2u);
+            BOOST_TEST_EQ(v[1].key, "a");
+            BOOST_TEST_EQ(v[1].value, "1");
+        }
+
+        bad("a=%&b");
+        bad("a=1&b=%4");
+    }
+
+    void
+    run()
+    {
+        testDecode();
+        testParams();
+    }
+};
+
+TEST_SUITE(
+    decode_in_place_test,
+    "boost.url.decode_in_place");
+
+} // urls
+} // boost
@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/decode_validate_utf8.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct decode_validate_utf8_test
+{
+    // check at every alignment, so
+    // that both the blocks and the
+    // tail are used
+    static
+    void
+    check(
+        core::string_view s0,
+        core::string_view decoded,
+        std::size_t invalid,
+        encoding_opts opt = {})
+    {
+        for(std::size_t i = 0; i < 20; ++i)
+        {
+            std::string const pre(i, 'x');
+            std::string const s = pre + std::string(s0);
+            pct_string_view const ps(s);
+            std::string buf(ps.decoded_size(), '\0');
+            auto const n = decode_validate_utf8(
+                ps, &buf[0], opt);
+            BOOST_TEST_EQ(n, invalid + i);
+            BOOST_TEST_EQ(buf, pre + std::string(decoded));
+        }
+    }
+
+    static
+    void
+    good(
+        core::string_view s0,
+        core::string_view decoded,
+        encoding_opts opt = {})
+    {
+        check(s0, decoded, decoded.size(), opt);
+    }
+
+    void
+    testValid()
+    {
+        good("", "");
+        good("abc", "abc");
+        good("0123456789abcdef0123456789abcdef",
+            "0123456789abcdef0123456789abcdef");
+        good("r%C3%A9sum%C3%A9.pdf", "r\xc3\xa9sum\xc3\xa9.pdf");
+        good("r\xc3\xa9sum\xc3\xa9", "r\xc3\xa9sum\xc3\xa9");
+        good("%E2%82%AC", "\xe2\x82\xac");
+        good("%e2%82%ac", "\xe2\x82\xac");
+        good("%F0%9F%98%80", "\xf0\x9f\x98\x80");
+        good("%F4%8F%BF%BF", "\xf4\x8f\xbf\xbf");
+        good("%ED%9F%BF", "\xed\x9f\xbf");
+        good("%EE%80%80", "\xee\x80\x80");
+        good("%C2%80 %DF%BF", "\xc2\x80 \xdf\xbf");
+        good("a+b%20c", "a+b c");
+        good("a+b%20c", "a b c", encoding_opts(true));
+        good("%00", core::string_view("\0", 1));
+        good("0123456789abcdef%C3%A90123456789abcdef",
+            "0123456789abcdef\xc3\xa9" "0123456789abcdef");
+    }
+
+    void
+    testInvalid()
+    {
+        // continuation without a lead
+        check("ab%80cd", "ab\x80" "cd", 2);
+        check("%BF", "\xbf", 0);
+        // overlong
+        check("a%C0%AF", "a\xc0\xaf", 1);
+        check("%C1%BF", "\xc1\xbf", 0);
+        check("%E0%9F%BF", "\xe0\x9f\xbf", 0);
+        check("%F0%8F%BF%BF", "\xf0\x8f\xbf\xbf", 0);
+        // surrogate
+        check("ok%ED%A0%80", "ok\xed\xa0\x80", 2);
+        // above U+10FFFF
+        check("%F4%90%80%80", "\xf4\x90\x80\x80", 0);
+        check("%F5%80%80%80", "\xf5\x80\x80\x80", 0);
+        check("%FF", "\xff", 0);
+        // truncated
+        check("abc%C3", "abc\xc3", 3);
+        check("%E2%82", "\xe2\x82", 0);
+        check("%E2%82x%AC", "\xe2\x82x\xac", 0);
+        check("%F0%9F%98", "\xf0\x9f\x98", 0);
+        // the first invalid sequence
+        check("%C3%A9%FF%FE", "\xc3\xa9\xff\xfe", 2);
+        check("%C3%A9%FF0123456789abcdef%2B+",
+            "\xc3\xa9\xff" "0123456789abcdef++", 2);
+        check("%C3%A9%FF0123456789abcdef%2B+",
+            "\xc3\xa9\xff" "0123456789abcdef+ ", 2,
+            encoding_opts(true));
+        check("a\xc3(", "a\xc3(", 1);
+    }
+
+    void
+    testViews()
+    {
+        {
+            url_view u("/files/r%C3%A9sum%C3%A9.pdf");
+            pct_string_view s = u.segments().buffer();
+            std::string buf(s.decoded_size(), '\0');
+            BOOST_TEST_EQ(decode_validate_utf8(
+                s, &buf[0]), buf.size());
+            BOOST_TEST_EQ(buf, "/files/r\xc3\xa9sum\xc3\xa9.pdf");
+        }
+        {
+            url_view u("/a/%C3/%A9");
+            pct_string_view s = u.segments().buffer();
+            std::string buf(s.decoded_size(), '\0');
+            BOOST_TEST_EQ(decode_validate_utf8(
+                s, &buf[0]), 3u);
+        }
+        {
+            decode_view v("a+%E2%82%AC", encoding_opts(true));
+            std::string buf(v.size(), '\0');
+            BOOST_TEST_EQ(decode_validate_utf8(
+                v, &buf[0]), v.size());
+            BOOST_TEST_EQ(buf, "a \xe2\x82\xac");
+        }
+    }
+
+    void
+    run()
+    {
+        testValid();
+        testInvalid();
+        testViews();
+    }
+};
+
+TEST_SUITE(
+    decode_validate_utf8_test,
+    "boost.url.decode_validate_utf8");
+
+} // urls
+} // boost
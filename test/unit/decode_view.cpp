@@ -11,7 +11,10 @@
 #include <boost/url/decode_view.hpp>
 
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <iterator>
 #include <sstream>
+#include <string>
 #include "test_suite.hpp"
 
 namespace boost {
@@ -353,6 +356,107 @@ struct decode_view_test
         }
     }
 
+    // long unescaped runs are compared and
+    // copied as a whole, with the escapes
+    // between them decoded one at a time
+    void
+    testRuns()
+    {
+        std::string s;
+        for(int i = 0; i < 40; ++i)
+        {
+            s.append(i % 7, 'x');
+            s += i % 3 == 0 ? "%41" : (
+                i % 3 == 1 ? "+" : "%2b");
+            s.append(20, 'y');
+        }
+        for(bool plus : { false, true })
+        {
+            encoding_opts opt;
+            opt.space_as_plus = plus;
+            decode_view const dv(s, opt);
+            std::string d;
+            for(char c : dv)
+                d += c;
+            BOOST_TEST_EQ(d.size(), dv.size());
+
+            // compare
+            BOOST_TEST(dv == d);
+            BOOST_TEST(dv == decode_view(s, opt));
+            BOOST_TEST_EQ(dv.compare(d), 0);
+            for(std::size_t i :
+                { std::size_t(0), std::size_t(17),
+                  d.size() / 2, d.size() - 1 })
+            {
+                std::string d1 = d;
+                d1[i] = '~';
+                BOOST_TEST_LT(dv.compare(d1), 0);
+                BOOST_TEST(dv != d1);
+                d1[i] = '\x01';
+                BOOST_TEST_GT(dv.compare(d1), 0);
+                BOOST_TEST_GT(dv.compare(
+                    d.substr(0, i)), 0);
+                BOOST_TEST_LT(dv.compare(d + 'z'), 0);
+            }
+
+            // starts_with
+            BOOST_TEST(dv.starts_with(d));
+            BOOST_TEST(dv.starts_with(
+                d.substr(0, d.size() / 2)));
+            BOOST_TEST(! dv.starts_with(d + 'y'));
+            BOOST_TEST(! dv.starts_with(
+                d.substr(0, 30) + '~'));
+
+            // find
+            BOOST_TEST_EQ(std::distance(
+                dv.begin(), dv.find('A')), 0);
+            BOOST_TEST_EQ(std::distance(
+                dv.begin(), dv.find('+')),
+                static_cast<std::ptrdiff_t>(
+                    d.find('+')));
+            BOOST_TEST_EQ(std::distance(
+                dv.begin(), dv.find(' ')),
+                static_cast<std::ptrdiff_t>(
+                    (std::min)(d.find(' '), d.size())));
+            BOOST_TEST(dv.find('~') == dv.end());
+
+            // remove_prefix
+            for(std::size_t i :
+                { std::size_t(1), std::size_t(21),
+                  std::size_t(22), d.size() })
+            {
+                decode_view dv1 = dv;
+                dv1.remove_prefix(i);
+                BOOST_TEST_EQ(dv1.size(), d.size() - i);
+                BOOST_TEST(dv1 == d.substr(i));
+            }
+
+            // operator<<
+            std::stringstream ss;
+            ss << dv;
+            BOOST_TEST_EQ(ss.str(), d);
+        }
+    }
+
+    void
+    testEncoded()
+    {
+        decode_view const dv(str);
+        BOOST_TEST_EQ(dv.encoded(), str);
+        BOOST_TEST_EQ(
+            dv.encoded().decoded_size(), dv.size());
+        decode_view dv1 = dv;
+        dv1.remove_prefix(2);
+        BOOST_TEST_EQ(dv1.encoded(), "uri+test");
+
+        // javadoc
+        {
+        decode_view v( "Program%20Files" );
+        BOOST_TEST( v.encoded() == "Program%20Files" );
+        BOOST_TEST( v.encoded().decoded_size() == v.size() );
+        }
+    }
+
     void
     run()
     {
@@ -365,6 +469,8 @@ struct decode_view_test
         testCompare();
         testStream();
         testPR127Cases();
+        testRuns();
+        testEncoded();
     }
 };
 
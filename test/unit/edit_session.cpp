@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/edit_session.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct edit_session_test
+{
+    // the url is the same as
+    // the url parsed from its
+    // string
+    static
+    void
+    check(
+        url_base const& u,
+        core::string_view s)
+    {
+        BOOST_TEST_EQ(u.buffer(), s);
+        BOOST_TEST_EQ(u.c_str()[u.size()], '\0');
+        url_view const u0 = parse_uri_reference(s).value();
+        BOOST_TEST_EQ(u.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u.has_query(), u0.has_query());
+        BOOST_TEST_EQ(u.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u.encoded_query().decoded_size(),
+            u0.encoded_query().decoded_size());
+        BOOST_TEST_EQ(u.params().size(), u0.params().size());
+        BOOST_TEST_EQ(u.has_fragment(), u0.has_fragment());
+        BOOST_TEST_EQ(u.encoded_fragment(), u0.encoded_fragment());
+        BOOST_TEST_EQ(u.encoded_fragment().decoded_size(),
+            u0.encoded_fragment().decoded_size());
+    }
+
+    void
+    testPath()
+    {
+        url u("https://www.example.com/api?key=0123456789abcdef#section");
+        {
+            edit_session s(u, edit_session::path);
+            BOOST_TEST(s.is_open());
+            BOOST_TEST_EQ(u.buffer(), "https://www.example.com/api");
+            BOOST_TEST(! u.has_query());
+            BOOST_TEST(! u.has_fragment());
+            for(auto seg : { "v2", "items", "4 2" })
+                u.segments().push_back(seg);
+        }
+        check(u, "https://www.example.com/api/v2/items/4%202?key=0123456789abcdef#section");
+
+        // empty query and fragment
+        u = url("x:/a?#");
+        {
+            edit_session s(u, edit_session::path);
+            u.segments().pop_back();
+            s.close();
+            BOOST_TEST(! s.is_open());
+            s.close();
+        }
+        check(u, "x:/?#");
+
+        // nothing to hold aside
+        u = url("x:/a");
+        {
+            edit_session s(u, edit_session::path);
+            u.set_encoded_path("/b/c");
+        }
+        check(u, "x:/b/c");
+    }
+
+    void
+    testQuery()
+    {
+        url u("https://www.example.com/?a=1#fragment");
+        {
+            edit_session s(u, edit_session::query);
+            BOOST_TEST_EQ(u.buffer(), "https://www.example.com/?a=1");
+            for(int i = 0; i < 100; ++i)
+                u.params().append({"k", std::to_string(i)});
+        }
+        BOOST_TEST_EQ(u.params().size(), 101u);
+        BOOST_TEST_EQ(u.encoded_fragment(), "fragment");
+        check(u, u.buffer());
+
+        // the query is created
+        u = url("/p#f");
+        {
+            edit_session s(u, edit_session::query);
+            u.params().append({"a b", "c"});
+        }
+        check(u, "/p?a%20b=c#f");
+
+        // the query is removed
+        u = url("/p?a=1#f");
+        {
+            edit_session s(u, edit_session::query);
+            u.remove_query();
+        }
+        check(u, "/p#f");
+    }
+
+    void
+    testStatic()
+    {
+        static_url<64> u("/?a#bcdefgh");
+        {
+            edit_session s(u, edit_session::query);
+            u.params().append({"c", "d"});
+            u.params().append({"e", "f"});
+        }
+        check(u, "/?a&c=d&e=f#bcdefgh");
+
+        // the tail does not fit
+        static_url<16> u1("/#0123456789");
+        {
+            edit_session s(u1, edit_session::path);
+            u1.set_encoded_path("/abcdefgh");
+            BOOST_TEST_THROWS(s.close(), system::system_error);
+            BOOST_TEST(s.is_open());
+            u1.set_encoded_path("/");
+        }
+        check(u1, "/#0123456789");
+    }
+
+    void
+    testEmpty()
+    {
+        url u;
+        {
+            edit_session s(u, edit_session::path);
+            BOOST_TEST_EQ(u.buffer(), "");
+        }
+        check(u, "");
+    }
+
+    void
+    run()
+    {
+        testPath();
+        testQuery();
+        testStatic();
+        testEmpty();
+    }
+};
+
+TEST_SUITE(
+    edit_session_test,
+    "boost.url.edit_session");
+
+} // urls
+} // boost
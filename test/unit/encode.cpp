@@ -11,12 +11,15 @@
 // Test that header file is self-contained.
 #include <boost/url/encode.hpp>
 
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/rfc/pchars.hpp>
 #include <boost/core/ignore_unused.hpp>
 
 #include "test_suite.hpp"
 
 #include <memory>
+#include <string>
 
 #ifdef assert
 #undef assert
@@ -136,6 +139,159 @@ public:
             BOOST_TEST(encode(
                 " A+", test_chars{}, opt, {}) == "+A+");
         }
+
+        // space_as_plus with an unreserved space
+        {
+            grammar::lut_chars const cs("A ");
+            encoding_opts opt;
+            opt.space_as_plus = true;
+            core::string_view const s = "A B ";
+            BOOST_TEST_EQ(
+                encoded_size(s, cs, opt), 6u);
+            BOOST_TEST(encode(
+                s, cs, opt, {}) == "A %42 ");
+            char buf[16];
+            std::size_t n = encode(
+                buf, sizeof(buf), s, cs, opt);
+            BOOST_TEST_EQ(
+                core::string_view(buf, n), "A %42 ");
+            BOOST_TEST(encode(s, cs,
+                static_encoding_opts<true>{}, {}) ==
+                    "A %42 ");
+
+            core::string_view const e = "A%41 B";
+            BOOST_TEST_EQ(
+                detail::re_encoded_size_unsafe(
+                    e, cs, opt), 8u);
+            char* dest = buf;
+            detail::re_encode_unsafe(
+                dest, buf + sizeof(buf), e, cs, opt);
+            BOOST_TEST_EQ(
+                core::string_view(buf, dest - buf),
+                "A%41 %42");
+        }
+    }
+
+    static
+    std::string
+    ref_encode(
+        core::string_view s,
+        bool space_as_plus)
+    {
+        std::string r;
+        for(char c : s)
+        {
+            if(pchars(c))
+                r.push_back(c);
+            else if(space_as_plus && c == ' ')
+                r.push_back('+');
+            else
+            {
+                auto u = static_cast<unsigned char>(c);
+                r.push_back('%');
+                r.push_back("0123456789ABCDEF"[u >> 4]);
+                r.push_back("0123456789ABCDEF"[u & 0xf]);
+            }
+        }
+        return r;
+    }
+
+    void
+    testEncodeLong()
+    {
+        // long runs of unreserved chars, with
+        // reserved chars at every offset
+        for(std::size_t n : { 15, 16, 17, 63, 64, 65, 130 })
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                for(char c : { ' ', '#', '\xff' })
+                {
+                    std::string s(n, 'a');
+                    s[i] = c;
+                    for(bool plus : { false, true })
+                    {
+                        encoding_opts opt;
+                        opt.space_as_plus = plus;
+                        std::string const m =
+                            ref_encode(s, plus);
+                        BOOST_TEST_EQ(encoded_size(
+                            s, pchars, opt), m.size());
+                        BOOST_TEST_EQ(encode(
+                            s, pchars, opt), m);
+
+                        // truncated output
+                        std::string t(m.size(), 0);
+                        for(std::size_t k = 0;
+                            k <= m.size(); k += 7)
+                        {
+                            std::size_t r = encode(
+                                &t[0], k, s, pchars, opt);
+                            BOOST_TEST_LE(r, k);
+                            BOOST_TEST_EQ(
+                                core::string_view(t.data(), r),
+                                core::string_view(m).substr(0, r));
+                            BOOST_TEST_GE(r + 2, k < m.size() ? k : m.size());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template<bool SpaceAsPlus, bool LowerCase>
+    static
+    void
+    checkStatic(core::string_view s)
+    {
+        // same results as the runtime options
+        static_encoding_opts<
+            SpaceAsPlus, LowerCase> const sopt;
+        encoding_opts const opt = sopt;
+        BOOST_TEST_EQ(opt.space_as_plus, SpaceAsPlus);
+        BOOST_TEST_EQ(opt.lower_case, LowerCase);
+        std::string const m = encode(
+            s, pchars, opt);
+        BOOST_TEST_EQ(encoded_size(
+            s, pchars, sopt), m.size());
+        BOOST_TEST_EQ(encode(
+            s, pchars, sopt), m);
+        std::string t(m.size(), 0);
+        for(std::size_t k = 0;
+            k <= m.size(); ++k)
+        {
+            std::size_t const n0 = encode(
+                &t[0], k, s, pchars, opt);
+            std::string const t0(t, 0, n0);
+            std::size_t const n = encode(
+                &t[0], k, s, pchars, sopt);
+            BOOST_TEST_EQ(n, n0);
+            BOOST_TEST_EQ(t.substr(0, n), t0);
+        }
+    }
+
+    void
+    testStaticOpts()
+    {
+        for(core::string_view s : {
+            "", " ", "abc", "a b\xfe",
+            "Program Files/\x01#?[]",
+            "  aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa zz" })
+        {
+            checkStatic<false, false>(s);
+            checkStatic<true, false>(s);
+            checkStatic<false, true>(s);
+            checkStatic<true, true>(s);
+        }
+
+        BOOST_TEST_EQ(encode("a b\xfe", pchars,
+            static_encoding_opts<true, true>{}), "a+b%fe");
+        BOOST_TEST_EQ(encode("a b\xfe", pchars,
+            static_encoding_opts<>{}), "a%20b%FE");
+
+        // a space that is unreserved stays
+        BOOST_TEST_EQ(encoded_size(" ", grammar::all_chars,
+            static_encoding_opts<true>{}), 1u);
     }
 
     void
@@ -153,6 +309,27 @@ public:
 
     ignore_unused(buf);
         }
+
+        // encoded_size(), static_encoding_opts
+        {
+    assert( encoded_size( "My Stuff", pchars, static_encoding_opts< true >{} ) == 8 );
+        }
+
+        // encode(), static_encoding_opts
+        {
+    char buf[100];
+    assert( encode( buf, sizeof(buf), "Program Files", pchars,
+        static_encoding_opts< false, true >{} ) == 15 );
+
+    ignore_unused(buf);
+        }
+
+        {
+    std::string s = encode( "My Stuff", pchars,
+        static_encoding_opts< true >{} );
+
+    assert( s == "My+Stuff" );
+        }
     }
 
     void
@@ -160,6 +337,8 @@ public:
     {
         testEncode();
         testEncodeExtras();
+        testEncodeLong();
+        testStaticOpts();
         testJavadocs();
     }
 };
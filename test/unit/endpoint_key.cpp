@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/endpoint_key.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <unordered_set>
+
+namespace boost {
+namespace urls {
+
+struct endpoint_key_test
+{
+    static
+    endpoint_key
+    key(core::string_view s)
+    {
+        return make_endpoint_key(url_view(s));
+    }
+
+    void
+    testKey()
+    {
+        {
+            url_view u("https://user@API.example.com:8443/v1?q");
+            endpoint_key k = make_endpoint_key(u);
+            BOOST_TEST_EQ(k.host, "API.example.com");
+            BOOST_TEST_EQ(k.host.data(),
+                u.encoded_host().data());
+            BOOST_TEST_EQ(k.host_hash,
+                grammar::ci_digest("api.example.com"));
+            BOOST_TEST_EQ(k.port, 8443);
+            BOOST_TEST(k.scheme == scheme::https);
+        }
+
+        BOOST_TEST(key("https://API.example.com/a") ==
+            key("https://api.example.com:443/b"));
+        BOOST_TEST(key("http://a.com") != key("https://a.com"));
+        BOOST_TEST(key("http://a.com") != key("ws://a.com"));
+        BOOST_TEST(key("http://a.com") != key("http://a.com:81"));
+        BOOST_TEST(key("http://a.com") != key("http://b.com"));
+        BOOST_TEST_EQ(key("http://a.com/x").digest(),
+            key("http://A.COM:80/y").digest());
+
+        std::unordered_set<endpoint_key> set;
+        set.insert(key("http://a.com/1"));
+        set.insert(key("http://A.com/2"));
+        set.insert(key("http://b.com/"));
+        BOOST_TEST_EQ(set.size(), 2u);
+    }
+
+    void
+    testTable()
+    {
+        endpoint_table t;
+        BOOST_TEST_EQ(t.size(), 0u);
+        BOOST_TEST(t.host(0).empty());
+        BOOST_TEST(t.host(1).empty());
+
+        auto const id0 = t.intern(key("http://A.com/1"));
+        auto const id1 = t.intern(key("http://a.com:80/2"));
+        auto const id2 = t.intern(key("https://a.com/"));
+        auto const id3 = t.intern(key("http://b.com/"));
+        BOOST_TEST_EQ(id0, id1);
+        BOOST_TEST_NE(id0, id2);
+        BOOST_TEST_NE(id0, id3);
+        BOOST_TEST_EQ(id0 >> 32, id2 >> 32);
+        BOOST_TEST_EQ(id0 & 0xffff, 80u);
+        BOOST_TEST_EQ(t.size(), 2u);
+        BOOST_TEST_EQ(t.host(
+            static_cast<std::uint32_t>(id0 >> 32)), "a.com");
+
+        // growth keeps the ids and hosts
+        std::string s;
+        for(int i = 0; i < 1000; ++i)
+        {
+            s = "http://h" + std::to_string(i) + ".com/";
+            auto const id = t.intern(key(s));
+            BOOST_TEST_EQ(t.intern(key(s)), id);
+        }
+        BOOST_TEST_EQ(t.size(), 1002u);
+        BOOST_TEST_EQ(t.intern(key("http://a.com")), id0);
+        BOOST_TEST_EQ(t.host(
+            static_cast<std::uint32_t>(id0 >> 32)), "a.com");
+        BOOST_TEST_EQ(t.host(1002), "h999.com");
+    }
+
+    void
+    run()
+    {
+        testKey();
+        testTable();
+    }
+};
+
+TEST_SUITE(
+    endpoint_key_test,
+    "boost.url.endpoint_key");
+
+} // urls
+} // boost
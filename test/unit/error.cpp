@@ -61,6 +61,12 @@ public:
 
         check(error::no_space);
         check(error::not_a_base);
+        check(error::scheme_not_allowed);
+        check(error::too_long);
+        check(error::too_many_segments);
+        check(error::too_many_params);
+        check(error::host_too_long);
+        check(error::bad_utf8);
 
         auto v = static_cast<boost::urls::error>(-1);
         auto ec = make_error_code(v);
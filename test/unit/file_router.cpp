@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/file_router.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct file_router_test
+{
+    using router_type = file_router<int>;
+
+    static
+    std::size_t
+    resolve(
+        router_type const& r,
+        core::string_view s,
+        std::string& path)
+    {
+        return r.resolve(url_view(s), path);
+    }
+
+    void
+    testResolve()
+    {
+        router_type r;
+        std::string p;
+        BOOST_TEST_EQ(resolve(r, "/a", p), router_type::npos);
+
+        BOOST_TEST_EQ(r.insert("/static/", "/var/www/static/"), 0u);
+        BOOST_TEST_EQ(r.insert("/", "/"), 1u);
+        BOOST_TEST_EQ(r.insert("/static/img", "/img"), 2u);
+        BOOST_TEST_EQ(r.size(), 3u);
+
+        BOOST_TEST_EQ(resolve(r, "/static/css/../app.js?v=2", p), 0u);
+        BOOST_TEST_EQ(p, "/var/www/static/app.js");
+        BOOST_TEST_EQ(resolve(r, "/static/%61pp.js", p), 0u);
+        BOOST_TEST_EQ(p, "/var/www/static/app.js");
+        BOOST_TEST_EQ(resolve(r, "/static", p), 0u);
+        BOOST_TEST_EQ(p, "/var/www/static");
+        BOOST_TEST_EQ(resolve(r, "/static/", p), 0u);
+        BOOST_TEST_EQ(p, "/var/www/static/");
+        BOOST_TEST_EQ(resolve(r, "/static/img/a.png", p), 2u);
+        BOOST_TEST_EQ(p, "/img/a.png");
+        BOOST_TEST_EQ(resolve(r, "/static/imgs/a.png", p), 0u);
+        BOOST_TEST_EQ(p, "/var/www/static/imgs/a.png");
+        BOOST_TEST_EQ(resolve(r, "/x/y", p), 1u);
+        BOOST_TEST_EQ(p, "/x/y");
+        BOOST_TEST_EQ(resolve(r, "", p), 1u);
+        BOOST_TEST_EQ(p, "/");
+
+        // no escape from the root
+        BOOST_TEST_EQ(resolve(r, "/static/../../etc/passwd", p), 1u);
+        BOOST_TEST_EQ(p, "/etc/passwd");
+        BOOST_TEST_EQ(resolve(r, "/static/img/%2E%2E/%2e%2e/a", p), 1u);
+        BOOST_TEST_EQ(p, "/a");
+
+        // separators and nulls
+        BOOST_TEST_EQ(resolve(r, "/static/a%2Fb", p), router_type::npos);
+        BOOST_TEST(p.empty());
+        BOOST_TEST_EQ(resolve(r, "/static/a%5Cb", p), router_type::npos);
+        BOOST_TEST_EQ(resolve(r, "/static/a%00", p), router_type::npos);
+
+        // invalid routes
+        BOOST_TEST_THROWS(r.insert("/a", ""), system::system_error);
+        BOOST_TEST_THROWS(r.insert("/a%2Fb", "/b"), system::system_error);
+        BOOST_TEST_THROWS(r.insert("/%", "/b"), system::system_error);
+        BOOST_TEST_EQ(r.size(), 3u);
+    }
+
+    void
+    testLookup()
+    {
+        router_type r(16);
+        r.insert("/static", "/srv/static");
+        r.insert("/img", "/srv/img");
+
+        auto e = r.lookup(url_view("/static/./a.js"));
+        if(BOOST_TEST(e))
+        {
+            BOOST_TEST_EQ(e->route, 0u);
+            BOOST_TEST_EQ(e->path, "/srv/static/a.js");
+            BOOST_TEST(! e->has_info);
+            e->info = 42;
+            e->has_info = true;
+        }
+        auto e2 = r.lookup(url_view("/static/%61.js?x"));
+        BOOST_TEST_EQ(e2, e);
+        if(BOOST_TEST(e2))
+        {
+            BOOST_TEST(e2->has_info);
+            BOOST_TEST_EQ(e2->info, 42);
+        }
+        BOOST_TEST(r.lookup(url_view("/none")) == nullptr);
+        BOOST_TEST(r.lookup(url_view("/img/a%2F")) == nullptr);
+
+        // inserting a route clears the cache
+        r.insert("/static", "/www");
+        e = r.lookup(url_view("/static/a.js"));
+        if(BOOST_TEST(e))
+        {
+            BOOST_TEST_EQ(e->path, "/www/a.js");
+            BOOST_TEST(! e->has_info);
+        }
+
+        // no cache
+        router_type n;
+        BOOST_TEST(n.lookup(url_view("/a")) == nullptr);
+        n.insert("/a", "r");
+        e = n.lookup(url_view("/a/b"));
+        if(BOOST_TEST(e))
+        {
+            BOOST_TEST_EQ(e->path, "r/b");
+            e->has_info = true;
+        }
+        e = n.lookup(url_view("/a/b"));
+        if(BOOST_TEST(e))
+            BOOST_TEST(! e->has_info);
+    }
+
+    void
+    run()
+    {
+        testResolve();
+        testLookup();
+    }
+};
+
+TEST_SUITE(
+    file_router_test,
+    "boost.url.file_router");
+
+} // urls
+} // boost
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/form_encoder.hpp>
+
+#include <boost/url/encode.hpp>
+#include <boost/url/form_parser.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct form_encoder_test
+{
+    // Write the params with buffers
+    // of n characters
+    static
+    std::string
+    write(
+        std::vector<param_view> const& v,
+        std::size_t n,
+        encoding_opts opt)
+    {
+        form_encoder e(opt);
+        std::string s;
+        std::string buf(n, '\0');
+        for(auto const& qp : v)
+        {
+            BOOST_TEST(e.done());
+            e.put(qp);
+            while(! e.done())
+            {
+                auto const n1 = e.write(
+                    &buf[0], buf.size());
+                if(! e.done())
+                    BOOST_TEST_EQ(n1, n);
+                s.append(buf.data(), n1);
+            }
+        }
+        return s;
+    }
+
+    static
+    void
+    check(
+        std::vector<param_view> const& v,
+        encoding_opts opt = encoding_opts(true))
+    {
+        std::string s0;
+        for(auto const& qp : v)
+        {
+            if(&qp != &v.front())
+                s0.push_back('&');
+            s0 += encode(qp.key, unreserved_chars, opt);
+            if(qp.has_value)
+            {
+                s0.push_back('=');
+                s0 += encode(qp.value, unreserved_chars, opt);
+            }
+        }
+        for(std::size_t n = 1; n <= s0.size() + 1; ++n)
+            BOOST_TEST_EQ(write(v, n, opt), s0);
+
+        // the parser reads it back
+        std::vector<param> v1;
+        form_parser p(opt);
+        auto const h = [&v1](param_view const& qp)
+        {
+            v1.emplace_back(
+                qp.key, qp.value, qp.has_value);
+        };
+        BOOST_TEST(p.write(s0, h).has_value());
+        BOOST_TEST(p.finish(h).has_value());
+        if(! BOOST_TEST_EQ(v1.size(), v.size()))
+            return;
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            BOOST_TEST_EQ(v1[i].key, v[i].key);
+            BOOST_TEST_EQ(v1[i].has_value, v[i].has_value);
+            if(v[i].has_value)
+                BOOST_TEST_EQ(v1[i].value, v[i].value);
+        }
+    }
+
+    void
+    testEncode()
+    {
+        check({});
+        check({{"a", no_value}});
+        check({{"a", ""}});
+        check({{"a", "1"}, {"b", "2"}});
+        check({{"name", "John Doe"}, {"msg", "a&b"}});
+        check({{"name", "John Doe"}, {"msg", "a&b"}},
+            encoding_opts(false));
+        check({{"k=", "v&w=x"}, {"", no_value}});
+        check({{"%", "+"}, {"\xff\x01", "~.-_"}});
+        check({{"snow", "\xe2\x98\x83 \xe2\x98\x83"}},
+            encoding_opts(true, true));
+
+        BOOST_TEST_EQ(write({
+            {"name", "John Doe"},
+            {"msg", "a&b"}}, 4, encoding_opts(true)),
+            "name=John+Doe&msg=a%26b");
+        BOOST_TEST_EQ(write({
+            {"a b", "c"}}, 2, encoding_opts(false)),
+            "a%20b=c");
+    }
+
+    void
+    testReset()
+    {
+        form_encoder e;
+        char buf[4];
+        e.put({"abc", "def"});
+        BOOST_TEST_EQ(e.write(buf, 4), 4u);
+        BOOST_TEST(! e.done());
+        e.reset();
+        BOOST_TEST(e.done());
+        e.put({"x", no_value});
+        BOOST_TEST_EQ(e.write(buf, 4), 1u);
+        BOOST_TEST(e.done());
+        BOOST_TEST_EQ(buf[0], 'x');
+        // nothing to write
+        BOOST_TEST_EQ(e.write(buf, 4), 0u);
+    }
+
+    void
+    run()
+    {
+        testEncode();
+        testReset();
+    }
+};
+
+TEST_SUITE(
+    form_encoder_test,
+    "boost.url.form_encoder");
+
+} // urls
+} // boost
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/form_parser.hpp>
+
+#include <boost/url/decode_in_place.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct form_parser_test
+{
+    struct collect
+    {
+        std::vector<param>* v;
+
+        void
+        operator()(param_view const& qp) const
+        {
+            v->emplace_back(
+                qp.key, qp.value, qp.has_value);
+        }
+    };
+
+    // Parse the body split in chunks
+    // of at most n characters
+    static
+    system::result<std::vector<param>>
+    parse(
+        form_parser& p,
+        core::string_view s,
+        std::size_t n)
+    {
+        std::vector<param> v;
+        p.reset();
+        while(! s.empty())
+        {
+            // a copy, so the chunks
+            // are not referenced
+            std::string const chunk(
+                s.substr(0, n));
+            auto rv = p.write(
+                chunk, collect{&v});
+            if(! rv)
+                return rv.error();
+            BOOST_TEST_EQ(*rv, chunk.size());
+            s.remove_prefix(chunk.size());
+        }
+        auto rv = p.finish(collect{&v});
+        if(! rv)
+            return rv.error();
+        return v;
+    }
+
+    // Every split of the body gives the
+    // params of decode_params_in_place
+    static
+    void
+    check(
+        core::string_view s,
+        encoding_opts opt = encoding_opts(true))
+    {
+        std::string s1(s);
+        std::vector<param_view> v0;
+        if(! BOOST_TEST(decode_params_in_place(
+                s1, v0, opt).has_value()))
+            return;
+        form_parser p(opt);
+        for(std::size_t n = 1; n <= s.size() + 1; ++n)
+        {
+            auto rv = parse(p, s, n);
+            if(! BOOST_TEST(rv.has_value()))
+                continue;
+            if(! BOOST_TEST_EQ(rv->size(), v0.size()))
+                continue;
+            for(std::size_t i = 0; i < v0.size(); ++i)
+            {
+                BOOST_TEST_EQ((*rv)[i].key, v0[i].key);
+                BOOST_TEST_EQ((*rv)[i].value, v0[i].value);
+                BOOST_TEST_EQ((*rv)[i].has_value,
+                    v0[i].has_value);
+            }
+        }
+    }
+
+    static
+    void
+    bad(core::string_view s)
+    {
+        form_parser p;
+        for(std::size_t n = 1; n <= s.size() + 1; ++n)
+            BOOST_TEST(parse(p, s, n).has_error());
+    }
+
+    void
+    testParse()
+    {
+        check("");
+        check("a");
+        check("a=");
+        check("=");
+        check("&");
+        check("&&");
+        check("a=1&b=2");
+        check("a=1&a=2&&c");
+        check("a=1&");
+        check("a=b=c");
+        check("k%3D=v%26w=x");
+        check("name=John+Doe&msg=a%26b");
+        check("name=John+Doe&msg=a%26b",
+            encoding_opts(false));
+        check("%41%42=%43%44&e%46=g%48");
+        check("%00=%ff&%e2%82%ac=%2b+");
+        check(std::string(300, 'x') + "=" +
+            std::string(300, 'y') + "&z");
+
+        bad("%");
+        bad("a=%4");
+        bad("a=%4G");
+        bad("a=%%41");
+        bad("a=%G4&b");
+    }
+
+    void
+    testLimits()
+    {
+        // a param larger than the limit
+        {
+            form_parser p(encoding_opts(true), 8);
+            BOOST_TEST(parse(p, "abcd=efgh", 3).has_value());
+            BOOST_TEST(parse(p, "abcd=efgh&i", 3).has_value());
+            BOOST_TEST(parse(p, "abcd=efghi", 3).has_error());
+            BOOST_TEST(parse(p, "a=%41%41%41%41%41%41%41", 5).has_value());
+            BOOST_TEST(parse(p, "a=%41%41%41%41%41%41%41%41", 5).has_error());
+        }
+
+        // errors are sticky
+        {
+            form_parser p;
+            std::vector<param> v;
+            BOOST_TEST(p.write("a=%x", collect{&v}).has_error());
+            BOOST_TEST(p.write("b=1", collect{&v}).has_error());
+            BOOST_TEST(p.finish(collect{&v}).has_error());
+            BOOST_TEST(v.empty());
+            p.reset();
+            BOOST_TEST(p.write("b=1", collect{&v}).has_value());
+            BOOST_TEST(p.finish(collect{&v}).has_value());
+            BOOST_TEST_EQ(v.size(), 1u);
+        }
+
+        // the escape is not complete
+        {
+            form_parser p;
+            std::vector<param> v;
+            BOOST_TEST(p.write("a=%4", collect{&v}).has_value());
+            BOOST_TEST(p.finish(collect{&v}).has_error());
+        }
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testLimits();
+    }
+};
+
+TEST_SUITE(
+    form_parser_test,
+    "boost.url.form_parser");
+
+} // urls
+} // boost
@@ -15,6 +15,9 @@
 
 #include "test_suite.hpp"
 
+#include <limits>
+#include <string>
+
 #ifdef BOOST_TEST_CSTR_EQ
 #undef BOOST_TEST_CSTR_EQ
 #define BOOST_TEST_CSTR_EQ(expr1,expr2) \
@@ -27,9 +30,22 @@ namespace urls {
 struct X
 {};
 
+// convertible to a string, but with
+// a formatter of its own
+struct Y
+{
+    operator core::string_view() const noexcept
+    {
+        return "converted";
+    }
+};
+
 namespace detail {
 template <>
 struct formatter<X>;
+
+template <>
+struct formatter<Y>;
 }
 
 struct format_test
@@ -866,6 +882,154 @@ struct format_test
 
     }
 
+    void
+    testArgKinds()
+    {
+        // char
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}{}", 'c', ' ').buffer(),
+            "/c%20");
+
+        // strings
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}/{}/{}/{}",
+                core::string_view("a"),
+                static_cast<char const*>("b"),
+                std::string("c d"),
+                "e").buffer(),
+            "/a/b/c%20d/e");
+
+        // signed integers
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}/{}/{}/{}",
+                static_cast<short int>(-1),
+                -2, -3L, -4LL).buffer(),
+            "/-1/-2/-3/-4");
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}", 0).buffer(),
+            "/0");
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}",
+                (std::numeric_limits<int>::min)()).buffer(),
+            "/-2147483648");
+
+        // unsigned integers
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}/{}/{}/{}",
+                static_cast<unsigned short int>(1),
+                2u, 3UL, 4ULL).buffer(),
+            "/1/2/3/4");
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}",
+                (std::numeric_limits<unsigned long long int>::max)()).buffer(),
+            "/18446744073709551615");
+        BOOST_TEST_CSTR_EQ(
+            urls::format("http://h:{}", 8080u).port(),
+            "8080");
+
+        // named arguments take the same kinds
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{a}/{b}/{c}",
+                {{"a", 'x'}, {"b", "y"}, {"c", -1}}).buffer(),
+            "/x/y/-1");
+
+        // a formatter of a type convertible
+        // to a string is used
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{}", Y{}).buffer(),
+            "/Y");
+        BOOST_TEST_CSTR_EQ(
+            urls::format("/{y}", {{"y", Y{}}}).buffer(),
+            "/Y");
+    }
+
+    void
+    testFormatTo()
+    {
+        // components not in the
+        // pattern are kept
+        {
+            url u("x://h/p?q#f");
+            format_to(u, "/{}", "a");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "x://h/a?q#f");
+        }
+        {
+            url u("x://u:p@h:80/p?q#f");
+            format_to(u, "{}://{}", "y", "a.b");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "y://u:p@a.b:80/p?q#f");
+            format_to(u, "//{}@{}", "v", "c.d");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "y://v:p@c.d:80/p?q#f");
+            format_to(u, "//{}:{}", "e.f", 8080);
+            BOOST_TEST_CSTR_EQ(u.buffer(), "y://v:p@e.f:8080/p?q#f");
+        }
+        {
+            url u("a/b?q");
+            format_to(u, "//{}", "h");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "//h/a/b?q");
+        }
+
+        // paths escaped after formatting
+        {
+            url u("x:y");
+            format_to(u, "/{}", "/a");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "x:/.//a");
+        }
+        {
+            url u("?q");
+            format_to(u, "{}", "a:b:c/d:e");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "a%3Ab%3Ac/d:e?q");
+        }
+        {
+            // a literal path is escaped too
+            url u;
+            format_to(u, "/a:b");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "/a%3Ab");
+            format_to(u, "/c:d?{}", "q");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "/c%3Ad?q");
+            BOOST_TEST_CSTR_EQ(
+                urls::format("/a:b").buffer(),
+                "/a%3Ab");
+        }
+        {
+            std::string s(200, 'a');
+            s += ":";
+            url u;
+            format_to(u, "{}", s);
+            BOOST_TEST_EQ(u.size(), 203u);
+        }
+
+        // static_url fits or is unchanged
+        {
+            static_url<13> u;
+            BOOST_TEST_EQ(u.capacity(), 13u);
+            format_to(u, "http://{}:{}", "a.b", 80);
+            BOOST_TEST_CSTR_EQ(u.buffer(), "http://a.b:80");
+            BOOST_TEST_THROWS(
+                format_to(u, "http://{}:{}", "a.b", 800),
+                std::exception);
+            BOOST_TEST_CSTR_EQ(u.buffer(), "http://a.b:80");
+        }
+        {
+            static_url<5> u;
+            BOOST_TEST_EQ(u.capacity(), 5u);
+            format_to(u, "{}", "a:b");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "a%3Ab");
+            BOOST_TEST_THROWS(
+                format_to(u, "{}", "a:b:"),
+                std::exception);
+            BOOST_TEST_CSTR_EQ(u.buffer(), "a%3Ab");
+            BOOST_TEST_THROWS(
+                format_to(u, "/a:b"),
+                std::exception);
+            BOOST_TEST_CSTR_EQ(u.buffer(), "a%3Ab");
+        }
+        {
+            static_url<6> u;
+            format_to(u, "/a:b");
+            BOOST_TEST_CSTR_EQ(u.buffer(), "/a%3Ab");
+        }
+    }
+
     void
     run()
     {
@@ -874,6 +1038,8 @@ struct format_test
         // without help from the pros.
 #if !BOOST_WORKAROUND( BOOST_GCC_VERSION, < 60000 )
         testFormat();
+        testArgKinds();
+        testFormatTo();
 #endif
     }
 };
@@ -910,6 +1076,35 @@ public:
         return o;
     }
 };
+
+template <>
+struct formatter<Y>
+{
+public:
+    char const*
+    parse(format_parse_context& ctx) const
+    {
+        return formatter<ignore_format>::parse_empty_spec(
+            ctx.begin(), ctx.end());
+    }
+
+    std::size_t
+    measure(
+        Y,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const
+    {
+        return ctx.out() + measure_one('Y', cs);
+    }
+
+    char*
+    format(Y, format_context& ctx, grammar::lut_chars const& cs) const
+    {
+        char* o = ctx.out();
+        encode_one(o, 'Y', cs);
+        return o;
+    }
+};
 }
 
 } // urls
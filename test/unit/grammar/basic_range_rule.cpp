@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/grammar/basic_range_rule.hpp>
+
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/grammar/token_rule.hpp>
+
+#include "test_rule.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+struct basic_range_rule_test
+{
+    struct semi_rule
+    {
+        using value_type = core::string_view;
+
+        system::result<value_type>
+        parse(
+            char const*& it,
+            char const* end) const noexcept
+        {
+            if(it == end)
+                return error::mismatch;
+            if(*it != ';')
+                return error::mismatch;
+            ++it;
+            if(it == end)
+                return error::mismatch;
+            if(*it == ';')
+                return error::mismatch;
+            return core::string_view(it++, 1);
+        }
+    };
+
+    template<class R>
+    static
+    void
+    check(
+        R const& r,
+        core::string_view s,
+        std::initializer_list<
+            core::string_view> init)
+    {
+        auto rv = parse(s, r);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        if(! BOOST_TEST_EQ(
+                rv->size(), init.size()))
+            return;
+        BOOST_TEST(
+            std::equal(
+                rv->begin(),
+                rv->end(),
+                init.begin()));
+    }
+
+    void
+    testRange()
+    {
+        constexpr auto r0 = basic_range_rule(
+            tuple_rule(
+                squelch(
+                    delim_rule(';')),
+                token_rule(alpha_chars)));
+
+        // basic_range()
+        {
+            basic_range<core::string_view,
+                semi_rule> v;
+            BOOST_TEST(v.empty());
+            BOOST_TEST_EQ(v.size(), 0);
+            BOOST_TEST(v.begin() == v.end());
+
+            // copy
+            auto v2(v);
+            BOOST_TEST(v2.empty());
+            BOOST_TEST_EQ(v2.size(), 0);
+        }
+
+        // basic_range(basic_range const&)
+        {
+            auto v0 = parse(";a;b;c", r0).value();
+            auto v(v0);
+            BOOST_TEST(! v0.empty());
+            BOOST_TEST_EQ(v0.size(), 3);
+            BOOST_TEST_EQ(v0.string(), ";a;b;c");
+            BOOST_TEST(! v.empty());
+            BOOST_TEST_EQ(v.size(), 3);
+            BOOST_TEST_EQ(v.string(), ";a;b;c");
+            BOOST_TEST_EQ(*v.begin(), "a");
+        }
+
+        // operator=(basic_range const&)
+        {
+            constexpr auto r = basic_range_rule(
+                semi_rule{});
+            auto v0 = parse(";a;b;c", r).value();
+            auto v1 = parse(";x;y", r).value();
+            v1 = v0;
+            BOOST_TEST_EQ(v1.size(), 3);
+            BOOST_TEST_EQ(v1.string(), ";a;b;c");
+        }
+
+        // iterator
+        {
+            auto v = parse(";a;b", r0).value();
+            auto it = v.begin();
+            BOOST_TEST_EQ(*it++, "a");
+            BOOST_TEST_EQ(*it, "b");
+            BOOST_TEST(++it == v.end());
+        }
+
+        // lower limit
+        // upper limit
+        {
+            {
+                constexpr auto r = basic_range_rule(
+                    tuple_rule(
+                        squelch(
+                            delim_rule(';')),
+                        token_rule(alpha_chars)),
+                    2, 3);
+
+                bad(r, "", error::mismatch);
+                bad(r, ";x", error::mismatch);
+                check(r, ";x;y", {"x","y"});
+                check(r, ";x;y;z", {"x","y","z"});
+                bad(r, ";a;b;c;d", error::mismatch);
+                bad(r, ";a;b;c;d;e", error::mismatch);
+            }
+            {
+                constexpr auto r = basic_range_rule(
+                    token_rule(alpha_chars),
+                    tuple_rule(
+                        squelch(
+                            delim_rule('+')),
+                        token_rule(alpha_chars)),
+                    2, 3);
+
+                bad(r, "", error::mismatch);
+                bad(r, "x", error::mismatch);
+                check(r, "x+y", {"x","y"});
+                check(r, "x+y+z", {"x","y","z"});
+                bad(r, "a+b+c+d", error::mismatch);
+                bad(r, "a+b+c+d+e", error::mismatch);
+            }
+        }
+    }
+
+    void
+    run()
+    {
+        // constexpr
+        {
+            constexpr auto r = basic_range_rule(
+                token_rule(alpha_chars),
+                tuple_rule(
+                    squelch(
+                        delim_rule('+')),
+                    token_rule(alpha_chars)));
+
+            check(r, "", {});
+            check(r, "x", {"x"});
+        }
+
+        // javadoc
+        {
+            auto rv = parse( ";alpha;xray;charlie",
+                basic_range_rule(
+                    tuple_rule(
+                        squelch( delim_rule( ';' ) ),
+                        token_rule( alpha_chars ) ),
+                    1 ) );
+            BOOST_TEST( rv->size() == 3 );
+            BOOST_TEST( *rv->begin() == "alpha" );
+        }
+
+        // javadoc
+        {
+            auto rv = parse( "whiskey,tango,foxtrot",
+                basic_range_rule(
+                    token_rule( alpha_chars ),          // first
+                    tuple_rule(                      // next
+                        squelch( delim_rule(',') ),
+                        token_rule( alpha_chars ) ) ) );
+            BOOST_TEST( rv->size() == 3 );
+        }
+
+        testRange();
+    }
+};
+
+TEST_SUITE(
+    basic_range_rule_test,
+    "boost.url.grammar.basic_range_rule");
+
+} // grammar
+} // urls
+} // boost
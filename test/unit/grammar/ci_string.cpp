@@ -131,6 +131,98 @@ public:
         BOOST_TEST_EQ(ci_compare("bA", "BB"), -1);
     }
 
+    void
+    testLong()
+    {
+        // longer than the vector width, with
+        // the difference at every position
+        core::string_view const s0 =
+            "www.Example-Domain.with.a-long.name.COM";
+        std::string const s1 =
+            "WWW.EXAMPLE-DOMAIN.WITH.A-LONG.NAME.com";
+        BOOST_TEST(ci_is_equal(s0, s1));
+        BOOST_TEST_EQ(ci_compare(s0, s1), 0);
+        BOOST_TEST_EQ(ci_digest(s0), ci_digest(s1));
+        BOOST_TEST(! ci_is_less(s0, s1));
+        BOOST_TEST(! ci_is_less(s1, s0));
+        for(std::size_t i = 0; i < s1.size(); ++i)
+        {
+            std::string s2 = s1;
+            s2[i] = '~';
+            BOOST_TEST(! ci_is_equal(s0, s2));
+            BOOST_TEST_EQ(ci_compare(s0, s2), -1);
+            BOOST_TEST_EQ(ci_compare(s2, s0), 1);
+            BOOST_TEST(ci_is_less(s0, s2));
+            BOOST_TEST(! ci_is_less(s2, s0));
+            BOOST_TEST_NE(ci_digest(s0), ci_digest(s2));
+        }
+
+        // characters next to the letters
+        BOOST_TEST(! ci_is_equal(
+            "@@@@@@@@@@@@@@@@[[[[", "````````````````{{{{"));
+        BOOST_TEST(ci_is_equal(
+            "abcdefghijklmnopqrstuvwxyz",
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+
+        // the digest is the same as
+        // one character at a time
+        {
+            std::size_t h =
+                sizeof(std::size_t) == 8 ?
+                    std::size_t(0xcbf29ce484222325ULL) :
+                    std::size_t(0x811C9DC5UL);
+            std::size_t const prime =
+                sizeof(std::size_t) == 8 ?
+                    std::size_t(0x100000001B3ULL) :
+                    std::size_t(0x01000193UL);
+            for(char c : s0)
+                h = (to_lower(c) ^ h) * prime;
+            BOOST_TEST_EQ(ci_digest(s0), h);
+        }
+    }
+
+    void
+    testToLowerInPlace()
+    {
+        auto check = [](
+            core::string_view s,
+            bool escapes,
+            core::string_view expect)
+        {
+            std::string t(s);
+            detail::to_lower_in_place(
+                &t[0], &t[0] + t.size(), escapes);
+            BOOST_TEST_EQ(t, expect);
+        };
+        check("", false, "");
+        check("AbC", false, "abc");
+        check("@[`{AZaz09", false, "@[`{azaz09");
+        check("A%C3B", false, "a%c3b");
+        check("A%C3B", true, "a%C3b");
+        check(
+            "WWW.EXAMPLE-DOMAIN.WITH.A-LONG.NAME.COM", false,
+            "www.example-domain.with.a-long.name.com");
+
+        // escapes at every position, and
+        // across the end of the blocks
+        std::string const s =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP";
+        for(std::size_t i = 0; i + 3 <= s.size(); ++i)
+        {
+            std::string t = s;
+            t.replace(i, 3, "%AB");
+            std::string expect;
+            for(std::size_t j = 0; j < t.size(); ++j)
+                expect.push_back(
+                    j > i && j <= i + 2
+                        ? t[j] : to_lower(t[j]));
+            check(t, true, expect);
+            for(auto& c : expect)
+                c = to_lower(c);
+            check(t, false, expect);
+        }
+    }
+
     void
     run()
     {
@@ -164,6 +256,8 @@ public:
         testIsEqual();
         testIsLess();
         testCompare();
+        testLong();
+        testToLowerInPlace();
     }
 };
 
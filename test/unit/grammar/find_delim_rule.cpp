@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/grammar/find_delim_rule.hpp>
+
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_rule.hpp"
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+BOOST_STATIC_ASSERT(is_rule<ch_find_delim_rule>::value);
+
+struct find_delim_rule_test
+{
+    template<class R>
+    static
+    void
+    check(
+        R const& r,
+        core::string_view s,
+        core::string_view v)
+    {
+        auto it = s.data();
+        auto const end = it + s.size();
+        auto rv = r.parse(it, end);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(*rv, v);
+        BOOST_TEST_EQ(it, s.data() + v.size());
+    }
+
+    template<class R>
+    static
+    void
+    fail(
+        R const& r,
+        core::string_view s)
+    {
+        auto it = s.data();
+        auto const end = it + s.size();
+        auto rv = r.parse(it, end);
+        if(! BOOST_TEST(rv.has_error()))
+            return;
+        BOOST_TEST(rv.error() == error::need_more);
+        BOOST_TEST_EQ(it, s.data());
+    }
+
+    void
+    run()
+    {
+        // constexpr
+        {
+            constexpr auto r = find_delim_rule('=');
+            (void)r;
+        }
+
+        // javadoc
+        {
+            system::result< std::tuple< core::string_view, core::string_view > > rv = parse( "key=value;",
+                tuple_rule(
+                    find_delim_rule( '=' ),
+                    squelch( delim_rule( '=' ) ),
+                    find_delim_rule( ';' ),
+                    squelch( delim_rule( ';' ) ) ) );
+            if(BOOST_TEST(rv.has_value()))
+            {
+                BOOST_TEST_EQ(std::get<0>(*rv), "key");
+                BOOST_TEST_EQ(std::get<1>(*rv), "value");
+            }
+        }
+
+        {
+            system::result< core::string_view > rv = parse( "abc;",
+                tuple_rule(
+                    find_delim_rule( lut_chars( ",;" ) ),
+                    squelch( delim_rule( lut_chars( ",;" ) ) ) ) );
+            if(BOOST_TEST(rv.has_value()))
+                BOOST_TEST_EQ(*rv, "abc");
+        }
+
+        check(find_delim_rule('='), "=", "");
+        check(find_delim_rule('='), "a=b", "a");
+        check(find_delim_rule('='),
+            "0123456789abcdef0123456789abcdef=",
+            "0123456789abcdef0123456789abcdef");
+        fail(find_delim_rule('='), "");
+        fail(find_delim_rule('='), "abc");
+
+        constexpr lut_chars cs(",;");
+        check(find_delim_rule(cs), ";", "");
+        check(find_delim_rule(cs), "ab,c;", "ab");
+        check(find_delim_rule(cs),
+            "0123456789abcdef0123456789abcdef;",
+            "0123456789abcdef0123456789abcdef");
+        fail(find_delim_rule(cs), "");
+        fail(find_delim_rule(cs), "abc");
+
+        // mismatch
+        bad(tuple_rule(
+            find_delim_rule('='),
+            squelch(delim_rule('='))),
+            "abc", error::need_more);
+    }
+};
+
+TEST_SUITE(
+    find_delim_rule_test,
+    "boost.url.grammar.find_delim_rule");
+
+} // grammar
+} // urls
+} // boost
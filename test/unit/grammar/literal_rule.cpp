@@ -20,6 +20,7 @@ namespace urls {
 namespace grammar {
 
 BOOST_STATIC_ASSERT(is_rule<literal_rule>::value);
+BOOST_STATIC_ASSERT(is_rule<ci_literal_rule>::value);
 
 struct literal_rule_test
 {
@@ -47,6 +48,38 @@ struct literal_rule_test
         bad(literal_rule("http"), "x", error::mismatch);
         bad(literal_rule("http"), "ftp", error::mismatch);
         bad(literal_rule("HTTP"), "http", error::mismatch);
+
+        // ci_literal_rule
+        {
+            constexpr auto r = ci_literal_rule("http://");
+            (void)r;
+        }
+        {
+            system::result< core::string_view > rv = parse( "HTTP://", ci_literal_rule( "http://" ) );
+            (void)rv;
+        }
+        ok(ci_literal_rule("http://"), "HTTP://", "HTTP://");
+        ok(ci_literal_rule("http://"), "hTtP://", "hTtP://");
+        ok(ci_literal_rule("--"), "--", "--");
+        bad(ci_literal_rule("http"), "", error::need_more);
+        bad(ci_literal_rule("http"), "H", error::need_more);
+        bad(ci_literal_rule("http"), "hT", error::need_more);
+        bad(ci_literal_rule("http"), "x", error::mismatch);
+        bad(ci_literal_rule("http"), "Hx", error::mismatch);
+        bad(ci_literal_rule("http"), "ftp", error::mismatch);
+        // long enough for the block compares
+        ok(ci_literal_rule("application/x-www-form-urlencoded"),
+            "Application/X-WWW-Form-URLEncoded",
+            "Application/X-WWW-Form-URLEncoded");
+        bad(ci_literal_rule("application/x-www-form-urlencoded"),
+            "Application/X-WWW-Form-URLEncodex",
+            error::mismatch);
+        bad(ci_literal_rule("application/x-www-form-urlencoded"),
+            "application/x-www-", error::need_more);
+        bad(ci_literal_rule("application/x-www-form-urlencoded"),
+            "application/y-www-", error::mismatch);
+        bad(ci_literal_rule("0123456789ab"), "0123456789aC",
+            error::mismatch);
     }
 };
 
@@ -10,11 +10,14 @@
 // Test that header file is self-contained.
 #include <boost/url/grammar/lut_chars.hpp>
 
+#include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 
 #include "test_rule.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 namespace grammar {
@@ -71,6 +74,77 @@ struct lut_chars_test
         }
     }
 
+    static
+    char const*
+    ref_find_if(
+        lut_chars const& cs,
+        char const* first,
+        char const* last,
+        bool match)
+    {
+        while(
+            first != last &&
+            cs(*first) != match)
+            ++first;
+        return first;
+    }
+
+    void
+    check_find(
+        lut_chars const& cs,
+        std::string const& s)
+    {
+        char const* const first = s.data();
+        char const* const last = first + s.size();
+        for(std::size_t i = 0; i <= s.size(); ++i)
+        {
+            BOOST_TEST(
+                grammar::find_if(first + i, last, cs) ==
+                ref_find_if(cs, first + i, last, true));
+            BOOST_TEST(
+                grammar::find_if_not(first + i, last, cs) ==
+                ref_find_if(cs, first + i, last, false));
+        }
+    }
+
+    void
+    test_find()
+    {
+        // long inputs take the wide path
+        constexpr lut_chars vowels = "AEIOU" "aeiou";
+        constexpr lut_chars most = ~lut_chars("%#\x80\xff");
+        std::string all;
+        for(int i = 0; i < 256; ++i)
+            all.push_back(static_cast<char>(i));
+        check_find(vowels, all);
+        check_find(most, all);
+        check_find(~vowels, all);
+
+        // a single mismatch at every position
+        for(std::size_t n : { 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 200 })
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                std::string s(n, 'x');
+                s[i] = 'a';
+                BOOST_TEST_EQ(static_cast<std::size_t>(
+                    grammar::find_if(s.data(),
+                        s.data() + n, vowels) - s.data()), i);
+                BOOST_TEST_EQ(static_cast<std::size_t>(
+                    grammar::find_if_not(s.data(),
+                        s.data() + n, ~vowels) - s.data()), i);
+                s[i] = '\xe9';
+                BOOST_TEST_EQ(static_cast<std::size_t>(
+                    grammar::find_if_not(s.data(),
+                        s.data() + n, most) - s.data()), n);
+                s[i] = '\x80';
+                BOOST_TEST_EQ(static_cast<std::size_t>(
+                    grammar::find_if_not(s.data(),
+                        s.data() + n, most) - s.data()), i);
+            }
+        }
+    }
+
     void
     run()
     {
@@ -84,6 +158,7 @@ struct lut_chars_test
         }
 
         test_lut_chars();
+        test_find();
 
         // C++11
 #if 1
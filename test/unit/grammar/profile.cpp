@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/grammar/profile.hpp>
+
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/optional_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/grammar/variant_rule.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+struct profile_test
+{
+    // one or more digits
+    struct digits_rule_t
+    {
+        using value_type =
+            core::string_view;
+
+        system::result<value_type>
+        parse(
+            char const*& it,
+            char const* end) const noexcept
+        {
+            auto const it0 = it;
+            while( it != end &&
+                *it >= '0' && *it <= '9')
+                ++it;
+            if(it == it0)
+                BOOST_URL_RETURN_EC(
+                    error::mismatch);
+            return core::string_view(
+                it0, it - it0);
+        }
+    };
+
+    static constexpr digits_rule_t digits_rule{};
+
+    void
+    testRules()
+    {
+        constexpr auto range = tuple_rule(
+            digits_rule,
+            delim_rule('-'),
+            digits_rule);
+        constexpr auto number = variant_rule(
+            range, digits_rule);
+        constexpr auto suffix = tuple_rule(
+            optional_rule(digits_rule),
+            delim_rule('x'));
+        using number_t = std::decay<
+            decltype(number)>::type;
+        using range_t = std::decay<
+            decltype(range)>::type;
+        using optional_t = std::decay<
+            decltype(optional_rule(
+                digits_rule))>::type;
+
+        reset_rule_profiles();
+        BOOST_TEST(parse("12", number).has_value());
+        BOOST_TEST(parse("12-345", number).has_value());
+        BOOST_TEST(parse("x", suffix).has_value());
+        BOOST_TEST(parse("-", number).has_error());
+
+        rule_profile const d =
+            get_rule_profile<digits_rule_t>();
+        rule_profile const n =
+            get_rule_profile<number_t>();
+        rule_profile const r =
+            get_rule_profile<range_t>();
+        rule_profile const o =
+            get_rule_profile<optional_t>();
+        if(! rule_profile_enabled())
+        {
+            BOOST_TEST_EQ(d.calls, 0u);
+            BOOST_TEST_EQ(d.cycles, 0u);
+            BOOST_TEST_EQ(n.calls, 0u);
+            BOOST_TEST_EQ(n.backtracks, 0u);
+            BOOST_TEST_EQ(o.backtracks, 0u);
+            return;
+        }
+
+        // "12":     range(12, fails), 12
+        // "12-345": range(12, 345)
+        // "-":      range(fails), fails
+        BOOST_TEST_EQ(d.calls, 6u);
+        BOOST_TEST_EQ(d.failures, 2u);
+        BOOST_TEST_EQ(d.bytes, 9u);
+        BOOST_TEST_EQ(d.backtracks, 0u);
+
+        BOOST_TEST_EQ(r.calls, 3u);
+        BOOST_TEST_EQ(r.failures, 2u);
+        BOOST_TEST_EQ(r.bytes, 6u);
+
+        BOOST_TEST_EQ(n.calls, 3u);
+        BOOST_TEST_EQ(n.failures, 1u);
+        BOOST_TEST_EQ(n.bytes, 8u);
+        BOOST_TEST_EQ(n.backtracks, 3u);
+        BOOST_TEST_GE(n.cycles, r.cycles);
+
+        // the optional digits are absent
+        BOOST_TEST_EQ(o.backtracks, 1u);
+
+        bool found = false;
+        auto const v = get_rule_type_profiles();
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            if(i > 0)
+                BOOST_TEST_GE(
+                    v[i - 1].profile.cycles,
+                    v[i].profile.cycles);
+            // the compound rules name it too
+            std::string const& s = v[i].type;
+            if( s.size() >= 13 &&
+                s.compare(s.size() - 13, 13,
+                    "digits_rule_t") == 0)
+            {
+                found = true;
+                BOOST_TEST_EQ(
+                    v[i].profile.calls, 6u);
+            }
+        }
+        BOOST_TEST(found);
+
+        reset_rule_profiles();
+        BOOST_TEST_EQ(get_rule_profile<
+            digits_rule_t>().calls, 0u);
+        BOOST_TEST_EQ(get_rule_profile<
+            number_t>().backtracks, 0u);
+    }
+
+    void
+    run()
+    {
+        testRules();
+    }
+};
+
+constexpr profile_test::digits_rule_t profile_test::digits_rule;
+
+TEST_SUITE(
+    profile_test,
+    "boost.url.grammar.profile");
+
+} // grammar
+} // urls
+} // boost
@@ -13,6 +13,11 @@
 #include "test_suite.hpp"
 #include <string>
 
+#if !defined(BOOST_URL_DISABLE_THREADS)
+#include <thread>
+#include <vector>
+#endif
+
 namespace boost {
 namespace urls {
 namespace grammar {
@@ -24,6 +29,137 @@ struct recycled_test
     {
     }
 
+    void
+    testPerThread()
+    {
+        {
+            recycled<std::string> bin;
+            BOOST_TEST(bin.mode() ==
+                recycle_mode::locked);
+        }
+        {
+            recycled<std::string> bin(
+                recycle_mode::per_thread);
+            BOOST_TEST(bin.mode() ==
+                recycle_mode::per_thread);
+            {
+                recycled_ptr<std::string> sp(bin);
+                sp->reserve(1000);
+            }
+            {
+                // reused from the thread cache
+                recycled_ptr<std::string> sp(bin);
+                BOOST_TEST(sp->capacity() >= 1000);
+            }
+            {
+                // more than the cache holds
+                std::vector<
+                    recycled_ptr<std::string>> v;
+                for(int i = 0; i < 40; ++i)
+                    v.emplace_back(bin);
+                for(auto& p : v)
+                    p->assign(100, 'x');
+            }
+            {
+                std::vector<
+                    recycled_ptr<std::string>> v;
+                for(int i = 0; i < 40; ++i)
+                    v.emplace_back(bin);
+                for(auto& p : v)
+                    BOOST_TEST(p->capacity() >= 100 ||
+                        p->empty());
+            }
+        }
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        {
+            recycled<std::string> bin(
+                recycle_mode::per_thread);
+            std::vector<std::thread> v;
+            for(int t = 0; t < 4; ++t)
+            {
+                v.emplace_back([&bin]
+                {
+                    for(int i = 0; i < 100; ++i)
+                    {
+                        recycled_ptr<std::string> a(bin);
+                        recycled_ptr<std::string> b(bin);
+                        a->assign("abc");
+                        b->assign("def");
+                        // released on another thread
+                        std::thread([&a]
+                        {
+                            a.release();
+                        }).join();
+                    }
+                });
+            }
+            for(auto& t : v)
+                t.join();
+            // cached by one of the threads
+            recycled_ptr<std::string> sp(bin);
+            BOOST_TEST(sp->capacity() >= 3);
+        }
+#endif
+    }
+
+    void
+    testStats()
+    {
+        struct counted
+        {
+            char buf[100];
+        };
+
+        {
+            recycled<counted> bin;
+            {
+                recycled_ptr<counted> a(bin);
+                recycled_ptr<counted> b(bin);
+            }
+            auto st = get_recycled_stats<counted>();
+            if(! recycled_stats_enabled())
+            {
+                BOOST_TEST_EQ(st.count, 0u);
+                BOOST_TEST_EQ(st.bytes, 0u);
+                BOOST_TEST(
+                    get_recycled_type_stats().empty());
+                return;
+            }
+            BOOST_TEST_EQ(st.count, 2u);
+            BOOST_TEST_EQ(st.count_max, 2u);
+            BOOST_TEST_GE(st.bytes,
+                2 * sizeof(counted));
+            BOOST_TEST_EQ(st.bytes_max, st.bytes);
+            BOOST_TEST_EQ(st.alloc_max, st.bytes / 2);
+            auto const total = get_recycled_stats();
+            BOOST_TEST_GE(total.count, st.count);
+            BOOST_TEST_GE(total.bytes, st.bytes);
+            {
+                recycled_ptr<counted> a(bin);
+                st = get_recycled_stats<counted>();
+                BOOST_TEST_EQ(st.count, 1u);
+            }
+        }
+
+        // destroying the bin frees
+        // every instance it held
+        auto const st = get_recycled_stats<counted>();
+        BOOST_TEST_EQ(st.count, 0u);
+        BOOST_TEST_EQ(st.bytes, 0u);
+        BOOST_TEST_EQ(st.count_max, 2u);
+
+        bool found = false;
+        for(auto const& e : get_recycled_type_stats())
+        {
+            if(e.type.find("counted") ==
+                    std::string::npos)
+                continue;
+            found = true;
+            BOOST_TEST_EQ(e.stats.count_max, 2u);
+        }
+        BOOST_TEST(found);
+    }
+
     void
     run()
     {
@@ -37,6 +173,9 @@ struct recycled_test
             BOOST_TEST(sp->capacity() >= 1000);
         }
 
+        testPerThread();
+        testStats();
+
         // coverage
         {
             detail::recycled_add_impl(1);
@@ -12,12 +12,81 @@
 
 #include "test_suite.hpp"
 
+#include <boost/static_assert.hpp>
+#include <boost/system/system_error.hpp>
+#include <new>
+#include <string>
+#include <thread>
+
 namespace boost {
 namespace urls {
 namespace grammar {
 
 struct string_token_test
 {
+    // a bump allocator which
+    // never frees its memory
+    struct bump
+    {
+        char buf[64];
+        std::size_t used = 0;
+    };
+
+    template<class T>
+    struct bump_allocator
+    {
+        using value_type = T;
+
+        bump* b;
+
+        explicit
+        bump_allocator(bump& b_) noexcept
+            : b(&b_)
+        {
+        }
+
+        template<class U>
+        bump_allocator(
+            bump_allocator<U> const& other) noexcept
+            : b(other.b)
+        {
+        }
+
+        T*
+        allocate(std::size_t n)
+        {
+            if(sizeof(b->buf) - b->used < n * sizeof(T))
+                throw std::bad_alloc();
+            T* p = reinterpret_cast<
+                T*>(b->buf + b->used);
+            b->used += n * sizeof(T);
+            return p;
+        }
+
+        void
+        deallocate(T*, std::size_t) noexcept
+        {
+        }
+
+        friend
+        bool
+        operator==(
+            bump_allocator const& a0,
+            bump_allocator const& a1) noexcept
+        {
+            return a0.b == a1.b;
+        }
+
+        friend
+        bool
+        operator!=(
+            bump_allocator const& a0,
+            bump_allocator const& a1) noexcept
+        {
+            return a0.b != a1.b;
+        }
+    };
+
     void
     f_impl(
         string_token::arg& dest,
@@ -75,6 +144,94 @@ struct string_token_test
             sv = f(string_token::preserve_size(s));
             BOOST_TEST_EQ(sv, "test");
         }
+
+        // span_token
+        {
+            char buf[8];
+            core::string_view sv = f(
+                string_token::span_token(buf));
+            BOOST_TEST_EQ(sv, "test");
+            BOOST_TEST(sv.data() == &buf[0]);
+
+            sv = f(string_token::span_token(
+                buf, 4));
+            BOOST_TEST_EQ(sv, "test");
+
+            sv = f(string_token::span_token(
+                nullptr, 0), "");
+            BOOST_TEST(sv.empty());
+
+            // too small
+            buf[0] = 'x';
+            BOOST_TEST_THROWS(f(
+                string_token::span_token(buf, 3)),
+                system::system_error);
+            BOOST_TEST_EQ(buf[0], 'x');
+        }
+
+        // arena_token
+        {
+            bump b;
+            core::string_view s0 = f(
+                string_token::arena_token(
+                    bump_allocator<char>(b)));
+            core::string_view s1 = f(
+                string_token::arena_token(
+                    bump_allocator<int>(b)), "url");
+            BOOST_TEST_EQ(s0, "test");
+            BOOST_TEST_EQ(s1, "url");
+            BOOST_TEST(s0.data() == &b.buf[0]);
+            BOOST_TEST(s1.data() == &b.buf[4]);
+            BOOST_TEST_EQ(b.used, 7u);
+
+            BOOST_TEST_THROWS(f(
+                string_token::arena_token(
+                    bump_allocator<char>(b)),
+                "supercalifragilisticexpialidocious"
+                "supercalifragilisticexpialidocious"),
+                std::bad_alloc);
+            BOOST_TEST_EQ(s0, "test");
+        }
+
+        // scratch_token
+        {
+            core::string_view s0 = f(
+                string_token::scratch_token());
+            BOOST_TEST_EQ(s0, "test");
+            core::string_view s1 = f(
+                string_token::scratch_token(), "url");
+            BOOST_TEST_EQ(s1, "url");
+            // the buffer is reused
+            BOOST_TEST(s1.data() == s0.data());
+
+            std::string const big(1000, 'x');
+            s1 = f(string_token::scratch_token(),
+                big.c_str());
+            BOOST_TEST_EQ(s1, big);
+            char const* p = s1.data();
+            s1 = f(string_token::scratch_token(),
+                "supercalifragilisticexpialidocious");
+            BOOST_TEST_EQ(s1,
+                "supercalifragilisticexpialidocious");
+            BOOST_TEST(s1.data() == p);
+
+            // one buffer per thread
+            std::thread t([this, p]{
+                core::string_view s = f(
+                    string_token::scratch_token());
+                BOOST_TEST_EQ(s, "test");
+                BOOST_TEST(s.data() != p);
+            });
+            t.join();
+        }
+
+        BOOST_STATIC_ASSERT(string_token::is_token<
+            string_token::span_token_t>::value);
+        BOOST_STATIC_ASSERT(string_token::is_token<
+            string_token::scratch_token_t>::value);
+        BOOST_STATIC_ASSERT(string_token::is_token<
+            string_token::arena_token_t<
+                std::allocator<char>>>::value);
     }
 };
 
@@ -13,6 +13,8 @@
 #include <boost/url/grammar/dec_octet_rule.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
 #include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/literal_rule.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 #include <boost/url/rfc/pct_encoded_rule.hpp>
@@ -78,6 +80,76 @@ struct tuple_rule_test
         (void)r2;
     }
 
+    void
+    testFused()
+    {
+        // runs of token, delim and literal
+        // rules are matched by one scanner
+        constexpr lut_chars word("abcdefghijklmnopqrstuvwxyz");
+        auto const r = tuple_rule(
+            token_rule( word ),
+            squelch( delim_rule( ':' ) ),
+            token_rule( digit_chars ),
+            literal_rule( "/x" ),
+            delim_rule( digit_chars ) );
+        {
+            auto rv = parse("host:8080/x7", r);
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(std::get<0>(*rv), "host");
+            BOOST_TEST_EQ(std::get<1>(*rv), "8080");
+            BOOST_TEST_EQ(std::get<2>(*rv), "/x");
+            BOOST_TEST_EQ(std::get<3>(*rv), "7");
+        }
+        BOOST_TEST(parse("host8080/x7", r).error() ==
+            error::mismatch);
+        BOOST_TEST(parse("host:", r).error() ==
+            error::need_more);
+        BOOST_TEST(parse("host:1/", r).error() ==
+            error::need_more);
+        BOOST_TEST(parse("host:1/y", r).error() ==
+            error::mismatch);
+        BOOST_TEST(parse("host:1/x7z", r).error() ==
+            error::leftover);
+
+        // the input stops at the rule
+        // which failed, as without fusion
+        {
+            core::string_view s = "host:1/y";
+            char const* it = s.data();
+            BOOST_TEST(r.parse(
+                it, s.data() + s.size()).has_error());
+            BOOST_TEST_EQ(it - s.data(), 6);
+        }
+
+        // runs between other rules
+        {
+            auto rv = parse("10.2::ab",
+                tuple_rule(
+                    dec_octet_rule,
+                    squelch( delim_rule('.') ),
+                    dec_octet_rule,
+                    squelch( literal_rule("::") ),
+                    token_rule( word ) ) );
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(std::get<0>(*rv), 10);
+            BOOST_TEST_EQ(std::get<1>(*rv), 2);
+            BOOST_TEST_EQ(std::get<2>(*rv), "ab");
+        }
+
+        // one value
+        {
+            auto const r1 = tuple_rule(
+                squelch( delim_rule('[') ),
+                token_rule( word ),
+                squelch( delim_rule(']') ) );
+            auto rv = parse("[abc]", r1);
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(*rv, "abc");
+            BOOST_TEST(parse("[abc", r1).error() ==
+                error::need_more);
+        }
+    }
+
     void
     run()
     {
@@ -112,6 +184,7 @@ struct tuple_rule_test
         }
         testSequence();
         testSquelch();
+        testFused();
     }
 };
 
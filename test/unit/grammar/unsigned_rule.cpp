@@ -16,6 +16,8 @@
 
 #include "test_rule.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 namespace grammar {
@@ -88,6 +90,53 @@ struct unsigned_rule_test
             bad(t, "4294967296", error::invalid);
             bad(t, "5000000000", error::invalid);
         }
+        {
+            using T = std::uint64_t;
+            constexpr auto t =
+                unsigned_rule<T>{};
+
+            ok(t, "12345678", T(12345678));
+            ok(t, "123456789", T(123456789));
+            ok(t, "1234567890123456", T(1234567890123456));
+            ok(t, "18446744073709551615",
+                T(18446744073709551615ULL));
+
+            bad(t, "18446744073709551616", error::invalid);
+            bad(t, "100000000000000000000", error::invalid);
+        }
+
+        // the digits end in the
+        // middle of a word, or at
+        // the end of the input
+        {
+            using T = std::uint32_t;
+            constexpr auto t =
+                unsigned_rule<T>{};
+            for(char const* s : {
+                "7", "42", "443", "8080", "65535",
+                "123456", "1234567", "12345678" })
+            {
+                std::string const u(s);
+                T v = 0;
+                for(char c : u)
+                    v = v * 10 + T(c - '0');
+                for(char const* tail : {
+                    "", "/", ":", "a", "/index.html",
+                    "\x7f", "\xff\xff\xff\xff\xff\xff\xff\xff" })
+                {
+                    std::string const s1 = u + tail;
+                    char const* it = s1.data();
+                    auto rv = t.parse(
+                        it, s1.data() + s1.size());
+                    if(BOOST_TEST(rv.has_value()))
+                        BOOST_TEST_EQ(*rv, v);
+                    BOOST_TEST_EQ(
+                        it - s1.data(),
+                        static_cast<std::ptrdiff_t>(
+                            u.size()));
+                }
+            }
+        }
     }
 };
 
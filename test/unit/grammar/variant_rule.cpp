@@ -10,6 +10,7 @@
 // Test that header file is self-contained.
 #include <boost/url/grammar/variant_rule.hpp>
 
+#include <boost/url/grammar/alpha_chars.hpp>
 #include <boost/url/grammar/delim_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/rfc/absolute_uri_rule.hpp>
@@ -24,9 +25,85 @@ namespace grammar {
 
 struct variant_rule_test
 {
+    // counts the calls to parse
+    struct counted_rule
+    {
+        using value_type = core::string_view;
+
+        char ch;
+        int* n;
+
+        system::result<value_type>
+        parse(
+            char const*& it,
+            char const* end) const noexcept
+        {
+            ++*n;
+            return grammar::parse(
+                it, end, delim_rule(ch));
+        }
+
+        detail::ch_chars
+        first_chars() const noexcept
+        {
+            return { ch };
+        }
+    };
+
+    void
+    testFirstChars()
+    {
+        // alternatives which cannot start
+        // with the next character are skipped
+        int n0 = 0;
+        int n1 = 0;
+        auto const r = variant_rule(
+            counted_rule{ 'a', &n0 },
+            counted_rule{ 'b', &n1 });
+        ok(r, "b", variant<core::string_view, core::string_view>(
+            variant2::in_place_index_t<1>{}, "b"));
+        BOOST_TEST_EQ(n0, 0);
+        BOOST_TEST_EQ(n1, 1);
+        bad(r, "c", error::mismatch);
+        bad(r, "", error::mismatch);
+        BOOST_TEST_EQ(n0, 0);
+        BOOST_TEST_EQ(n1, 1);
+
+        // a rule without first_chars
+        // is always tried
+        int n2 = 0;
+        auto const r2 = variant_rule(
+            counted_rule{ 'a', &n2 },
+            delim_rule(alpha_chars));
+        ok(r2, "z", variant<core::string_view, core::string_view>(
+            variant2::in_place_index_t<1>{}, "z"));
+        BOOST_TEST_EQ(n2, 0);
+        ok(r2, "a", variant<core::string_view, core::string_view>(
+            variant2::in_place_index_t<0>{}, "a"));
+        BOOST_TEST_EQ(n2, 1);
+
+        // the library rules
+        auto const r3 = variant_rule(
+            origin_form_rule,
+            absolute_uri_rule,
+            authority_rule);
+        {
+            auto rv = grammar::parse("/index.htm", r3);
+            BOOST_TEST(rv && rv->index() == 0);
+            rv = grammar::parse("http://example.com", r3);
+            BOOST_TEST(rv && rv->index() == 1);
+            rv = grammar::parse("[::1]:443", r3);
+            BOOST_TEST(rv && rv->index() == 2);
+            rv = grammar::parse("1.2.3.4:80", r3);
+            BOOST_TEST(rv && rv->index() == 2);
+        }
+    }
+
     void
     run()
     {
+        testFirstChars();
+
         // constexpr
         constexpr auto r =
             variant_rule(
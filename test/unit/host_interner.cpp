@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/host_interner.hpp>
+
+#include <boost/url/parse.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct host_interner_test
+{
+    void
+    testIntern()
+    {
+        host_interner t;
+        BOOST_TEST(t.empty());
+
+        auto const id0 = t.intern("WWW.Example.com");
+        BOOST_TEST_EQ(id0, 0u);
+        BOOST_TEST_EQ(t.intern("www.example.com"), id0);
+        BOOST_TEST_EQ(t.intern(url_view(
+            "http://www.EXAMPLE.com:8080/a")), id0);
+        BOOST_TEST_EQ(t.host(id0), "www.example.com");
+        BOOST_TEST_EQ(t[id0], "www.example.com");
+        BOOST_TEST_EQ(t.size(), 1u);
+
+        // dense ids
+        BOOST_TEST_EQ(t.intern("[::1]"), 1u);
+        BOOST_TEST_EQ(t.intern("127.0.0.1"), 2u);
+        BOOST_TEST_EQ(t.intern(""), 3u);
+        BOOST_TEST_EQ(t.intern(url_view("/a/b")), 3u);
+        BOOST_TEST_EQ(t.size(), 4u);
+
+        // encoded hosts are not decoded
+        BOOST_TEST_NE(t.intern("%41"), t.intern("a"));
+        BOOST_TEST_EQ(t.intern("%4a"), t.intern("%4A"));
+
+        // hosts of every length
+        std::string s;
+        for(int i = 0; i < 40; ++i)
+        {
+            s.push_back(static_cast<
+                char>('A' + i % 26));
+            std::string lower = s;
+            for(auto& c : lower)
+                c = grammar::to_lower(c);
+            auto const id = t.intern(s);
+            BOOST_TEST_EQ(t.intern(lower), id);
+            BOOST_TEST_EQ(t.host(id), lower);
+        }
+
+        // the copies remain valid
+        core::string_view h = t.host(id0);
+        for(int i = 0; i < 3000; ++i)
+            t.intern("h" + std::to_string(i));
+        BOOST_TEST_EQ(h, "www.example.com");
+        BOOST_TEST_EQ(t.find("H2999"), t.size() - 1);
+    }
+
+    void
+    testFind()
+    {
+        host_interner t(8);
+        BOOST_TEST_EQ(t.find("example.com"),
+            host_interner::npos);
+        auto const id = t.intern("example.com");
+        BOOST_TEST_EQ(t.find("EXAMPLE.COM"), id);
+        BOOST_TEST_EQ(t.find(url_view(
+            "https://Example.Com/")), id);
+        BOOST_TEST_EQ(t.find("example.co"),
+            host_interner::npos);
+        BOOST_TEST_EQ(t.find("example.comm"),
+            host_interner::npos);
+    }
+
+    void
+    testHostIdView()
+    {
+        // javadoc
+        {
+            host_interner hosts;
+            host_id_view u0( url_view( "https://WWW.Example.com/a" ), hosts );
+            host_id_view u1( url_view( "http://www.example.com/b" ), hosts );
+            BOOST_TEST( u0.host_id() == u1.host_id() );
+        }
+
+        host_interner t;
+        host_id_view u;
+        BOOST_TEST_EQ(u.host_id(), host_interner::npos);
+        BOOST_TEST(u.empty());
+
+        u = host_id_view(url_view(
+            "https://API.example.com/v1?x=1"), t);
+        BOOST_TEST_EQ(u.host_id(), 0u);
+        BOOST_TEST_EQ(u.encoded_host(), "API.example.com");
+        BOOST_TEST_EQ(u.encoded_path(), "/v1");
+        BOOST_TEST_EQ(t.host(u.host_id()), "api.example.com");
+
+        host_id_view u1(url_view(
+            "https://cdn.example.com/"), t);
+        BOOST_TEST_NE(u1.host_id(), u.host_id());
+        BOOST_TEST_EQ(u1.host_id(), 1u);
+    }
+
+    void
+    run()
+    {
+        testIntern();
+        testFind();
+        testHostIdView();
+    }
+};
+
+TEST_SUITE(
+    host_interner_test,
+    "boost.url.host_interner");
+
+} // urls
+} // boost
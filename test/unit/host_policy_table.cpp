@@ -0,0 +1,236 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/host_policy_table.hpp>
+
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct host_policy_table_test
+{
+    static
+    host_policy_table
+    make()
+    {
+        return host_policy_table{
+            { "example.com", 1, true },
+            { "login.example.org", 2 },
+            { "a.b.example.com", 3 },
+            { "Mixed.Case.NET.", 4, true },
+            { "", 5, true },
+            { "login.example.org", 6 } };
+    }
+
+    static
+    void
+    check(
+        host_policy_table_view t,
+        core::string_view host,
+        core::string_view matched,
+        std::uint32_t id)
+    {
+        auto const r = t.find(host);
+        if(matched.empty())
+        {
+            BOOST_TEST(! r);
+            return;
+        }
+        if(! BOOST_TEST(r))
+            return;
+        BOOST_TEST_EQ(r->host, matched);
+        BOOST_TEST_EQ(r->id, id);
+    }
+
+    void
+    testSpecial()
+    {
+        host_policy_table t;
+        BOOST_TEST(t.empty());
+        BOOST_TEST(! t.find("example.com"));
+        host_policy_table_view v;
+        BOOST_TEST(v.empty());
+        BOOST_TEST(! v.find("example.com"));
+        BOOST_TEST_EQ(v.data(), t.data());
+        host_policy_table_view v2(t.data());
+        BOOST_TEST(v2.empty());
+
+        BOOST_TEST_THROWS(
+            host_policy_table_view(""),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            host_policy_table_view(
+                host_policy_table_view().data().substr(1)),
+            system::system_error);
+    }
+
+    void
+    testFind()
+    {
+        auto const t = make();
+        BOOST_TEST_EQ(t.size(), 4u);
+        check(t, "example.com", "example.com", 1);
+        check(t, "www.example.com", "example.com", 1);
+        check(t, "WWW.Example.COM", "Example.COM", 1);
+        check(t, "www.example.com.", "example.com.", 1);
+        check(t, "badexample.com", "", 0);
+        check(t, "com", "", 0);
+        check(t, "", "", 0);
+        check(t, ".", "", 0);
+
+        // an exact policy does not apply
+        // to subdomains, the closest one does
+        check(t, "login.example.org", "login.example.org", 6);
+        check(t, "x.login.example.org", "", 0);
+        check(t, "example.org", "", 0);
+        check(t, "a.b.example.com", "a.b.example.com", 3);
+        check(t, "x.a.b.example.com", "example.com", 1);
+        check(t, "b.example.com", "example.com", 1);
+
+        // hosts are decoded and folded
+        check(t, "www.mixed.case.net", "mixed.case.net", 4);
+        check(t, "%6Dixed.case.net", "%6Dixed.case.net", 4);
+        check(t, "mixed%2Ecase.net", "", 0);
+
+        auto const r = t.find("x.example.com");
+        BOOST_TEST(r && r->include_subdomains);
+        auto const r2 = t.find("a.b.example.com");
+        BOOST_TEST(r2 && ! r2->include_subdomains);
+    }
+
+    void
+    testUrl()
+    {
+        auto const t = make();
+        BOOST_TEST(t.force_https(url_view("http://www.example.com/")));
+        BOOST_TEST(t.force_https(url_view("wss://example.com/")));
+        BOOST_TEST(! t.force_https(url_view("http://www.example.org/")));
+        BOOST_TEST(! t.force_https(url_view("/path")));
+        BOOST_TEST_EQ(t.find(url_view("http://a.example.com:8080"))->id, 1u);
+
+        host_policy_table const t2{
+            { "127.0.0.1", 1 },
+            { "1", 2, true } };
+        BOOST_TEST(! t2.force_https(url_view("http://127.0.0.1/")));
+        BOOST_TEST(! t2.force_https(url_view("http://[::1]/")));
+        BOOST_TEST(t2.force_https(url_view("http://0.0.0.1.a.1/")));
+    }
+
+    void
+    testUpgrade()
+    {
+        auto const t = make();
+        {
+            url u("http://www.example.com/a?b#c");
+            BOOST_TEST(t.upgrade(u));
+            BOOST_TEST_EQ(u.buffer(), "https://www.example.com/a?b#c");
+            BOOST_TEST(! t.upgrade(u));
+        }
+        {
+            url u("http://user@www.example.com:80/");
+            BOOST_TEST(t.upgrade(u));
+            BOOST_TEST_EQ(u.buffer(), "https://user@www.example.com:443/");
+        }
+        {
+            url u("http://www.example.com:8080/");
+            BOOST_TEST(t.upgrade(u));
+            BOOST_TEST_EQ(u.buffer(), "https://www.example.com:8080/");
+        }
+        {
+            url u("ftp://www.example.com/");
+            BOOST_TEST(! t.upgrade(u));
+            BOOST_TEST_EQ(u.buffer(), "ftp://www.example.com/");
+        }
+        {
+            url u("http://www.example.org/");
+            BOOST_TEST(! t.upgrade(u));
+        }
+        {
+            // no room to grow
+            static_url<22> u("http://example.com:80");
+            BOOST_TEST_THROWS(t.upgrade(u),
+                system::system_error);
+            BOOST_TEST_EQ(u.buffer(), "http://example.com:80");
+        }
+    }
+
+    void
+    testImage()
+    {
+        auto const t = make();
+        // the image is used in place from
+        // any copy, as if it were mapped
+        std::string const image(t.data());
+        host_policy_table_view const v(image);
+        BOOST_TEST_EQ(v.size(), t.size());
+        BOOST_TEST_EQ(v.data().data(), image.data());
+        check(v, "www.example.com", "example.com", 1);
+        check(v, "login.example.org", "login.example.org", 6);
+        check(v, "x.login.example.org", "", 0);
+
+        // a public suffix list image
+        // is not a policy table
+        std::string bad(image);
+        bad[1] = 'P';
+        BOOST_TEST_THROWS(
+            host_policy_table_view(bad),
+            system::system_error);
+        bad = image;
+        bad.push_back('x');
+        BOOST_TEST_THROWS(
+            host_policy_table_view(bad),
+            system::system_error);
+    }
+
+    void
+    testMany()
+    {
+        std::vector<std::string> hosts;
+        for(int i = 0; i < 1000; ++i)
+            hosts.push_back(
+                "h" + std::to_string(i) + ".example.net");
+        std::vector<host_policy> v;
+        for(std::size_t i = 0; i < hosts.size(); ++i)
+            v.push_back({ hosts[i],
+                static_cast<std::uint32_t>(i), i % 2 == 0 });
+        host_policy_table t(v.data(), v.size());
+        BOOST_TEST_EQ(t.size(), 1000u);
+        check(t, "h500.example.net", "h500.example.net", 500);
+        check(t, "x.h500.example.net", "h500.example.net", 500);
+        check(t, "x.h501.example.net", "", 0);
+        check(t, "example.net", "", 0);
+        check(t, "h1000.example.net", "", 0);
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testFind();
+        testUrl();
+        testUpgrade();
+        testImage();
+        testMany();
+    }
+};
+
+TEST_SUITE(
+    host_policy_table_test,
+    "boost.url.host_policy_table");
+
+} // urls
+} // boost
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/hot_table.hpp>
+
+#include <boost/url/router.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <chrono>
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+
+struct hot_table_test
+{
+    // a table which can tell if it
+    // was read after its destruction
+    struct table
+    {
+        static std::atomic<int> live;
+
+        int version;
+        int check;
+
+        explicit
+        table(int v) noexcept
+            : version(v)
+            , check(v)
+        {
+            ++live;
+        }
+
+        table(table&& other) noexcept
+            : version(other.version)
+            , check(other.check)
+        {
+            ++live;
+        }
+
+        ~table()
+        {
+            check = -1;
+            --live;
+        }
+    };
+
+    void
+    testPublish()
+    {
+        {
+            hot_table<table> t;
+            BOOST_TEST(! t.read());
+            BOOST_TEST(t.read().get() == nullptr);
+
+            t.publish(table(1));
+            BOOST_TEST_EQ(table::live.load(), 1);
+            {
+                auto s = t.read();
+                BOOST_TEST(s);
+                BOOST_TEST_EQ(s->version, 1);
+                BOOST_TEST_EQ((*s).check, 1);
+
+                // moved snapshots
+                auto s2 = std::move(s);
+                BOOST_TEST(! s);
+                BOOST_TEST_EQ(s2->version, 1);
+                hot_table<table>::snapshot s3;
+                s3 = std::move(s2);
+                BOOST_TEST_EQ(s3->version, 1);
+                s3 = t.read();
+                BOOST_TEST_EQ(s3->version, 1);
+            }
+
+            t.publish(table(2));
+            BOOST_TEST_EQ(table::live.load(), 1);
+            BOOST_TEST_EQ(t.read()->version, 2);
+
+            t.publish(std::unique_ptr<table const>());
+            BOOST_TEST_EQ(table::live.load(), 0);
+            BOOST_TEST(! t.read());
+
+            t.publish(std::unique_ptr<table const>(
+                new table(3)));
+            BOOST_TEST_EQ(t.read()->version, 3);
+        }
+        BOOST_TEST_EQ(table::live.load(), 0);
+
+        // a router
+        {
+            std::unique_ptr<router<int>> r(
+                new router<int>);
+            r->insert("user/{id}", 1);
+            hot_table<router<int>> t;
+            t.publish(std::move(r));
+            matches m;
+            auto s = t.read();
+            int const* v = s->find(
+                segments_encoded_view("/user/42"), m);
+            BOOST_TEST(v && *v == 1);
+            BOOST_TEST_EQ(m["id"], "42");
+        }
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        // the writer waits for the
+        // snapshot of the old table
+        {
+            hot_table<table> t(table(1));
+            std::atomic<bool> done{false};
+            auto s = t.read();
+            std::thread w([&]
+            {
+                t.publish(table(2));
+                done = true;
+            });
+            std::this_thread::sleep_for(
+                std::chrono::milliseconds(50));
+            BOOST_TEST(! done.load());
+            BOOST_TEST_EQ(s->check, 1);
+            BOOST_TEST_EQ(t.read()->version, 2);
+            s = {};
+            w.join();
+            BOOST_TEST(done.load());
+            BOOST_TEST_EQ(table::live.load(), 1);
+        }
+        BOOST_TEST_EQ(table::live.load(), 0);
+
+        // readers never see a destroyed
+        // table, nor an older version
+        {
+            hot_table<table> t(table(0));
+            std::atomic<bool> stop{false};
+            std::atomic<int> errors{0};
+            std::vector<std::thread> readers;
+            for(int i = 0; i < 4; ++i)
+                readers.emplace_back([&]
+                {
+                    int last = 0;
+                    while(! stop.load())
+                    {
+                        auto s = t.read();
+                        if( s->check != s->version ||
+                            s->version < last)
+                            ++errors;
+                        last = s->version;
+                    }
+                });
+            for(int v = 1; v <= 1000; ++v)
+                t.publish(table(v));
+            stop = true;
+            for(auto& th : readers)
+                th.join();
+            BOOST_TEST_EQ(errors.load(), 0);
+            BOOST_TEST_EQ(t.read()->version, 1000);
+            BOOST_TEST_EQ(table::live.load(), 1);
+        }
+        BOOST_TEST_EQ(table::live.load(), 0);
+#endif
+    }
+
+    void
+    run()
+    {
+        testPublish();
+        testThreads();
+    }
+};
+
+std::atomic<int> hot_table_test::table::live{0};
+
+TEST_SUITE(
+    hot_table_test,
+    "boost.url.hot_table");
+
+} // urls
+} // boost
@@ -12,6 +12,7 @@
 
 #include "test_suite.hpp"
 #include <sstream>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -114,6 +115,44 @@ public:
                 system::system_error);
         }
 
+        // to_buffer, every octet
+        {
+            char buf[ipv4_address::max_str_len];
+            for(unsigned v = 0; v < 256; ++v)
+            {
+                auto const d = std::to_string(v);
+                BOOST_TEST_EQ(ipv4_address(
+                    v * 0x01010101u).to_buffer(
+                        buf, sizeof(buf)),
+                    d + "." + d + "." + d + "." + d);
+                BOOST_TEST_EQ(ipv4_address(
+                    (v << 24) | 0x00ff0a00u).to_buffer(
+                        buf, sizeof(buf)),
+                    d + ".255.10.0");
+            }
+        }
+
+        // write_ipv4_addresses
+        {
+            ipv4_address const v[] = {
+                ipv4_address(0x01020304),
+                ipv4_address(0xffffffff),
+                ipv4_address(0),
+                ipv4_address(0x0a00ff63) };
+            char buf[4 * (ipv4_address::max_str_len + 1)];
+            BOOST_TEST_EQ(write_ipv4_addresses(
+                v, 4, buf, sizeof(buf)),
+                "1.2.3.4\n255.255.255.255\n0.0.0.0\n10.0.255.99\n");
+            BOOST_TEST_EQ(write_ipv4_addresses(
+                v, 2, buf, sizeof(buf), ' '),
+                "1.2.3.4 255.255.255.255 ");
+            BOOST_TEST_EQ(write_ipv4_addresses(
+                v, 0, buf, 0), "");
+            BOOST_TEST_THROWS(write_ipv4_addresses(
+                v, 4, buf, sizeof(buf) - 1),
+                system::system_error);
+        }
+
         // is_loopback
         {
             BOOST_TEST(ipv4_address(
@@ -402,12 +402,90 @@ public:
                 "::ffff:127.0.0.1");
     }
 
+    void
+    testRfc5952()
+    {
+        // lowercase, without leading zeros
+        trip("2001:0DB8:0000:0000:0000:FF00:0042:8329",
+            "2001:db8::ff00:42:8329");
+        trip("0001:0010:0100:1000:000a:00a0:0a00:a000",
+            "1:10:100:1000:a:a0:a00:a000");
+
+        // a single zero group is not shortened
+        trip("1:0:2:3:4:5:6:7", "1:0:2:3:4:5:6:7");
+        trip("0:1:2:3:4:5:6:7", "0:1:2:3:4:5:6:7");
+        trip("1:2:3:4:5:6:7:0", "1:2:3:4:5:6:7:0");
+        trip("1:0:2:0:3:0:4:0", "1:0:2:0:3:0:4:0");
+
+        // the longest run is shortened,
+        // the first one on a tie
+        trip("1:0:0:2:0:0:0:3", "1:0:0:2::3");
+        trip("1:0:0:0:2:0:0:3", "1::2:0:0:3");
+        trip("1:0:0:2:0:0:3:4", "1::2:0:0:3:4");
+        trip("0:0:1:0:0:2:0:0", "::1:0:0:2:0:0");
+        trip("1:0:0:0:0:0:0:2", "1::2");
+
+        // every combination of zero groups,
+        // compared with a plain formatter
+        for(unsigned m = 0; m < 256; ++m)
+        {
+            ipv6_address::bytes_type b{};
+            for(int i = 0; i < 8; ++i)
+                if(! (m & (1U << i)))
+                    b[2 * i + 1] = static_cast<
+                        unsigned char>(i + 1);
+            int pos = -1;
+            int len = 0;
+            for(int i = 0; i < 8;)
+            {
+                int j = i;
+                while(j < 8 && (m & (1U << j)))
+                    ++j;
+                if(j - i > len)
+                {
+                    pos = i;
+                    len = j - i;
+                }
+                i = j + (j == i);
+            }
+            std::string s;
+            for(int i = 0; i < 8; ++i)
+            {
+                if(len > 1 && i == pos)
+                {
+                    s += "::";
+                    i += len - 1;
+                    continue;
+                }
+                if(! s.empty() && s.back() != ':')
+                    s += ':';
+                s += (m & (1U << i)) ?
+                    '0' : static_cast<char>('1' + i);
+            }
+            ipv6_address const a(b);
+            if(! BOOST_TEST_EQ(a.to_string(), s))
+                continue;
+            char buf[ipv6_address::max_str_len];
+            BOOST_TEST_EQ(a.to_buffer(
+                buf, sizeof(buf)), s);
+            BOOST_TEST(ipv6_address(s) == a);
+        }
+
+        // the longest address
+        trip("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff",
+            "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+        BOOST_TEST_EQ(ipv6_address(
+            "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"
+                ).to_string().size(), 39u);
+    }
+
     void
     run()
     {
         testMembers();
         testIO();
         testIpv4();
+        testRfc5952();
     }
 };
 
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/magnet_link_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct magnet_link_view_test
+{
+    static
+    void
+    check(
+        magnet_link_view::params_type r,
+        core::string_view s,
+        std::vector<core::string_view> const& v)
+    {
+        BOOST_TEST_EQ(r.size(), v.size());
+        BOOST_TEST_EQ(r.empty(), v.empty());
+        auto it = r.begin();
+        for(auto const& e : v)
+        {
+            if(! BOOST_TEST(it != r.end()))
+                return;
+            BOOST_TEST(it->has_value);
+            BOOST_TEST_EQ(it->value, e);
+            BOOST_TEST_EQ(
+                it->value.decoded_size(),
+                it->value.decode().size());
+            // no copies
+            BOOST_TEST(
+                it->value.data() >= s.data() &&
+                it->value.data() < s.data() + s.size());
+            ++it;
+        }
+        BOOST_TEST(it == r.end());
+    }
+
+    void
+    testParse()
+    {
+        auto bad = [](core::string_view s)
+        {
+            BOOST_TEST(parse_magnet_link(s).has_error());
+        };
+        bad("");
+        bad("magnet:");
+        bad("magnet:?");
+        bad("magnet:?dn=x");
+        bad("http://example.com/?xt=urn:btih:a");
+        bad("magnet:?xt");
+        bad("magnet:?xt=");
+        bad("magnet:?xt=not%20a%20uri");
+        bad("magnet:?xt=urn:btih:a&xt.1=%");
+        bad("magnet:?dn=x&xt.2=bad%20topic");
+
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?xt=urn:btih:a").has_value());
+        BOOST_TEST(parse_magnet_link(
+            "MAGNET:?xt=urn:btih:a").has_value());
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?xt.1=urn:btih:a").has_value());
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?%78%74=urn%3Abtih%3Aa").has_value());
+        // xt.<non-digits> is not an exact topic
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?xt.a=urn:btih:a").has_error());
+        // decoded topics longer than
+        // the stack buffer are rejected
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?xt=urn:btih:" +
+                std::string(300, 'a')).has_value());
+        BOOST_TEST(parse_magnet_link(
+            "magnet:?xt=urn%3Abtih:" +
+                std::string(300, 'a')).has_error());
+    }
+
+    void
+    testFields()
+    {
+        core::string_view s =
+            "magnet:?xt=urn:btih:d2474e86c95b19b8bcfdb92bc12c9d44667cfa36"
+            "&dn=Leaves+of+Grass"
+            "&tr=udp%3A%2F%2Ftracker.example.com%3A80"
+            "&x.pe=1.2.3.4:5"
+            "&ws=http%3A%2F%2Fexample.com%2Fa"
+            "&xt.1=urn:sha1:ABC"
+            "&tr=udp%3A%2F%2Fother.example.com%3A80"
+            "&dn=Second"
+            "&ws=http%3A%2F%2Fexample.com%2Fb"
+            "&%74r=http%3A%2F%2Fescaped.example.com";
+        auto rv = parse_magnet_link(s);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        magnet_link_view m = *rv;
+        BOOST_TEST_EQ(m.buffer(), s);
+        BOOST_TEST_EQ(m.as_url_view().scheme(), "magnet");
+        BOOST_TEST(m.has_display_name());
+        BOOST_TEST_EQ(m.display_name(), "Leaves+of+Grass");
+        check(m.exact_topics(), s, {
+            "urn:btih:d2474e86c95b19b8bcfdb92bc12c9d44667cfa36",
+            "urn:sha1:ABC"});
+        check(m.address_trackers(), s, {
+            "udp%3A%2F%2Ftracker.example.com%3A80",
+            "udp%3A%2F%2Fother.example.com%3A80",
+            "http%3A%2F%2Fescaped.example.com"});
+        check(m.web_seeds(), s, {
+            "http%3A%2F%2Fexample.com%2Fa",
+            "http%3A%2F%2Fexample.com%2Fb"});
+
+        auto it = m.address_trackers().begin();
+        BOOST_TEST_EQ(it->key, "tr");
+        BOOST_TEST_EQ(it->value.decode(),
+            "udp://tracker.example.com:80");
+        auto it2 = it++;
+        BOOST_TEST(it2 != it);
+        BOOST_TEST_EQ(it->value.decode(),
+            "udp://other.example.com:80");
+    }
+
+    void
+    testEmpty()
+    {
+        auto m = parse_magnet_link(
+            "magnet:?xt=urn:btih:a&").value();
+        BOOST_TEST(! m.has_display_name());
+        BOOST_TEST_EQ(m.display_name(), "");
+        check(m.exact_topics(), m.buffer(), {"urn:btih:a"});
+        check(m.address_trackers(), m.buffer(), {});
+        check(m.web_seeds(), m.buffer(), {});
+
+        magnet_link_view m0;
+        BOOST_TEST(m0.exact_topics().empty());
+        BOOST_TEST(
+            m0.exact_topics().begin() ==
+            m0.exact_topics().end());
+    }
+
+    void
+    testJavadocs()
+    {
+        magnet_link_view m = parse_magnet_link(
+            "magnet:?xt=urn:btih:d2474e86c95b19b8bcfdb92bc12c9d44667cfa36"
+            "&dn=Leaves+of+Grass"
+            "&tr=udp%3A%2F%2Ftracker.example.com%3A80" ).value();
+
+        assert( m.exact_topics().size() == 1 );
+        assert( m.display_name() == "Leaves+of+Grass" );
+        for( auto p : m.address_trackers() )
+            assert( p.value.decode() == "udp://tracker.example.com:80" );
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testFields();
+        testEmpty();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    magnet_link_view_test,
+    "boost.url.magnet_link_view");
+
+} // urls
+} // boost
@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/mailto_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct mailto_view_test
+{
+    static
+    void
+    check(
+        mailto_view::addresses_type r,
+        core::string_view s,
+        std::vector<core::string_view> const& v)
+    {
+        BOOST_TEST_EQ(r.size(), v.size());
+        BOOST_TEST_EQ(r.empty(), v.empty());
+        auto it = r.begin();
+        for(auto const& e : v)
+        {
+            if(! BOOST_TEST(it != r.end()))
+                return;
+            BOOST_TEST_EQ(*it, e);
+            BOOST_TEST_EQ(
+                it->decoded_size(),
+                it->decode().size());
+            // no copies
+            BOOST_TEST(
+                it->data() >= s.data() &&
+                it->data() < s.data() + s.size());
+            ++it;
+        }
+        BOOST_TEST(it == r.end());
+    }
+
+    void
+    testParse()
+    {
+        auto bad = [](core::string_view s)
+        {
+            BOOST_TEST(parse_mailto(s).has_error());
+        };
+        bad("");
+        bad("mailto");
+        bad("http://example.com/?to=a@example.com");
+        bad("mailto://example.com");
+        bad("mailto:a@example.com#frag");
+        bad("mailto:a@example.com?subject=%");
+        bad("mailto:a b@example.com");
+
+        BOOST_TEST(parse_mailto("mailto:").has_value());
+        BOOST_TEST(parse_mailto("mailto:?").has_value());
+        BOOST_TEST(parse_mailto(
+            "MAILTO:a@example.com").has_value());
+        BOOST_TEST(parse_mailto(
+            "mailto:a@example.com?x-mailer=1").has_value());
+    }
+
+    void
+    testFields()
+    {
+        core::string_view s =
+            "mailto:a@example.com,%62@example.com"
+            "?subject=Our%20meeting"
+            "&cc=c@example.com,d@ex%61mple.com"
+            "&to=e@example.com"
+            "&x=to"
+            "&body=Hi%21"
+            "&%54o=f@example.com,,g@example.com,"
+            "&BCC=h@example.com"
+            "&subject=Second"
+            "&cc=i%2Cj@example.com";
+        auto rv = parse_mailto(s);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        mailto_view m = *rv;
+        BOOST_TEST_EQ(m.buffer(), s);
+        BOOST_TEST_EQ(m.as_url_view().scheme(), "mailto");
+        check(m.to(), s, {
+            "a@example.com",
+            "%62@example.com",
+            "e@example.com",
+            "f@example.com",
+            "g@example.com"});
+        check(m.cc(), s, {
+            "c@example.com",
+            "d@ex%61mple.com",
+            "i%2Cj@example.com"});
+        check(m.bcc(), s, {
+            "h@example.com"});
+        BOOST_TEST(m.has_subject());
+        BOOST_TEST_EQ(m.subject(), "Our%20meeting");
+        BOOST_TEST_EQ(m.subject().decode(), "Our meeting");
+        BOOST_TEST(m.has_body());
+        BOOST_TEST_EQ(m.body().decode(), "Hi!");
+
+        auto it = m.to().begin();
+        BOOST_TEST_EQ(it->decode(), "a@example.com");
+        auto it2 = it++;
+        BOOST_TEST(it2 != it);
+        BOOST_TEST_EQ(it->decode(), "b@example.com");
+    }
+
+    void
+    testEmpty()
+    {
+        {
+            // empty addresses are skipped
+            core::string_view s =
+                "mailto:,?to=&cc=,,&to=,a@example.com&bcc&subject";
+            auto m = parse_mailto(s).value();
+            check(m.to(), s, {"a@example.com"});
+            check(m.cc(), s, {});
+            check(m.bcc(), s, {});
+            BOOST_TEST(! m.has_subject());
+            BOOST_TEST_EQ(m.subject(), "");
+            BOOST_TEST(! m.has_body());
+        }
+        {
+            core::string_view s =
+                "mailto:a@example.com,";
+            auto m = parse_mailto(s).value();
+            check(m.to(), s, {"a@example.com"});
+            check(m.cc(), s, {});
+        }
+        {
+            core::string_view s =
+                "mailto:?to=a@example.com&subject=";
+            auto m = parse_mailto(s).value();
+            check(m.to(), s, {"a@example.com"});
+            BOOST_TEST(m.has_subject());
+            BOOST_TEST_EQ(m.subject(), "");
+        }
+
+        mailto_view m0;
+        BOOST_TEST(m0.to().empty());
+        BOOST_TEST(
+            m0.to().begin() ==
+            m0.to().end());
+        BOOST_TEST_EQ(m0.body(), "");
+    }
+
+    void
+    testJavadocs()
+    {
+        mailto_view m = parse_mailto(
+            "mailto:alice@example.com,bob@example.com"
+            "?cc=carol@example.com&subject=Our%20meeting" ).value();
+
+        assert( m.to().size() == 2 );
+        assert( *m.cc().begin() == "carol@example.com" );
+        assert( m.subject().decode() == "Our meeting" );
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testFields();
+        testEmpty();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    mailto_view_test,
+    "boost.url.mailto_view");
+
+} // urls
+} // boost
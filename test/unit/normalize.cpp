@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/normalize.hpp>
+
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+
+namespace boost {
+namespace urls {
+
+struct normalize_test
+{
+    // normalize_to agrees with
+    // url_base::normalize
+    static
+    void
+    check(core::string_view s)
+    {
+        url u0 = parse_uri_reference(s).value();
+        u0.normalize();
+
+        url_view const v =
+            parse_uri_reference(s).value();
+        char buf[256];
+        auto rv = normalize_to(v, buf, sizeof(buf));
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        if(! BOOST_TEST_EQ(rv->buffer(), u0.buffer()))
+            test_suite::log << "\"" << s << "\"\n";
+        BOOST_TEST(rv->buffer().data() == buf);
+
+        // the buffer is also the scratch
+        // space of the algorithm
+        std::size_t n = v.size();
+        if( !v.has_scheme() &&
+            !v.has_authority())
+        {
+            auto const p = v.encoded_path();
+            n += 2 * static_cast<std::size_t>(
+                std::count(p.begin(), p.end(), ':'));
+        }
+        BOOST_TEST(normalize_to(v, buf, n));
+        if(! u0.empty())
+        {
+            BOOST_TEST_EQ(
+                normalize_to(v, buf, u0.size() - 1).error(),
+                error::no_space);
+        }
+
+        url u1("x://y");
+        normalize_to(v, u1);
+        BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+        BOOST_TEST(u1 == u0);
+        BOOST_TEST_EQ(
+            u1.encoded_segments().size(),
+            u0.encoded_segments().size());
+        BOOST_TEST_EQ(
+            u1.encoded_params().size(),
+            u0.encoded_params().size());
+
+        static_url<64> u2;
+        normalize_to(v, u2);
+        BOOST_TEST_EQ(u2.buffer(), u0.buffer());
+
+        // parse_uri_normalized agrees
+        // when s is a URI
+        if(! parse_uri(s))
+        {
+            BOOST_TEST(parse_uri_normalized(
+                s, buf, sizeof(buf)).has_error());
+            return;
+        }
+        rv = parse_uri_normalized(s, buf, sizeof(buf));
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(rv->buffer(), u0.buffer());
+        BOOST_TEST(*rv == u0);
+        BOOST_TEST_EQ(
+            rv->encoded_segments().size(),
+            u0.encoded_segments().size());
+        url u3("x://y");
+        BOOST_TEST(parse_uri_normalized(s, u3));
+        BOOST_TEST_EQ(u3.buffer(), u0.buffer());
+        BOOST_TEST_EQ(
+            u3.encoded_params().size(),
+            u0.encoded_params().size());
+    }
+
+    static
+    void
+    check(
+        core::string_view s,
+        normalize_opts const& opt,
+        core::string_view e)
+    {
+        url_view const v =
+            parse_uri_reference(s).value();
+        char buf[256];
+        auto rv = normalize_to(
+            v, buf, sizeof(buf), opt);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(rv->buffer(), e);
+        url u;
+        normalize_to(v, u, opt);
+        BOOST_TEST_EQ(u.buffer(), e);
+    }
+
+    void
+    testNormalize()
+    {
+        check("");
+        check("HtTp://cPpAlLiAnCe.oRG/");
+        check("http://%2a%2b%2C%2f%3A.org/");
+        check("http://%63%70%70%61%6c%6Ci%61n%63e.org/");
+        check("http://%43%70%50%61%6c%6Ci%61n%43e.org/");
+        check("http://cppalliance.org/a/b/c/./../../g");
+        check("http://cppalliance.org/aa/bb/cc/./../../gg");
+        check("http://cppalliance.org/a/b/../../../../g");
+        check("http://cppalliance.org/..");
+        check("http://cppalliance.org?%61=b");
+        check("http://%75%3a@h.org:80/%7e?%3d#%2f");
+        check("HTTP://u:P%2a@[::A]:8080/B#c");
+        check("x://[v1.A]/");
+        check("x://1.2.3.4/");
+        check("/./my:sharona");
+        check("/.//my:sharona");
+        check("/././/my:sharona");
+        check(".//my:sharona");
+        check("././/my:sharona");
+        check("./my:sharona");
+        check("././my:sharona");
+        check("./my:sha:rona");
+        check("././my:sha:rona");
+        check("./my:sha:rona/b:c/d?q#f");
+        check("my%3Asharona");
+        check("my%3Asharona/%3A");
+        check("https://www.boost.org/doc/../%69%6e%64%65%78%20file.html");
+        check("%2E%2E/./a/b/c/./../../g");
+        check("mid/content=5/../6/..");
+        check("a/..");
+        check(".");
+        check("..");
+        check("x:a/../b");
+        check("?a#b");
+    }
+
+    void
+    testOptions()
+    {
+        normalize_opts const none(
+            false, false, false, false);
+        check("HTTP://A.b:80/a/./%7e?%7e#%7e", none,
+              "HTTP://A.b:80/a/./%7e?%7e#%7e");
+
+        normalize_opts opt = none;
+        opt.lower_case = true;
+        check("HTTP://A%7e.b:80/a/./%7e?%7e#%7e", opt,
+              "http://a%7e.b:80/a/./%7e?%7e#%7e");
+
+        opt = none;
+        opt.percent_encoding = true;
+        check("HTTP://A%7e.b:80/a/./%7e%2f?%7e#%7e", opt,
+              "HTTP://A~.b:80/a/./~%2F?~#~");
+        check("a%3Ab/c", opt, "a%3Ab/c");
+
+        opt = none;
+        opt.remove_dot_segments = true;
+        check("HTTP://A.b:80/a/./%7e/../b", opt,
+              "HTTP://A.b:80/a/b");
+        check("./a:b", opt, "a%3Ab");
+
+        opt = none;
+        opt.remove_default_port = true;
+        check("HTTP://A.b:80/", opt, "HTTP://A.b/");
+        check("https://A.b:443/", opt, "https://A.b/");
+        check("https://A.b:080/", opt, "https://A.b:080/");
+        check("ws://a.b:080/", opt, "ws://a.b/");
+        check("x://a.b:/", opt, "x://a.b/");
+        check("x://a.b:80/", opt, "x://a.b:80/");
+        check("//a.b:80/", opt, "//a.b:80/");
+
+        check("HTTP://u@Ex%41mple.COM:80/a/./b/../%7Ec?%7e#%7e",
+              { true, true, true, true },
+              "http://u@example.com/a/~c?~#~");
+    }
+
+    void
+    testBuffers()
+    {
+        // static_url
+        {
+            url_view const v(
+                "HTTP://Example.com:80/a/./b/../c");
+            static_url<32> u;
+            normalize_to(v, u,
+                { true, true, true, true });
+            BOOST_TEST_EQ(u.buffer(),
+                "http://example.com/a/c");
+            BOOST_TEST_EQ(u.segments().size(), 2u);
+            BOOST_TEST_EQ(u.port_number(), 0);
+        }
+
+        // strong guarantee
+        {
+            static_url<16> u("x:y");
+            BOOST_TEST_THROWS(
+                normalize_to(url_view(
+                    "http://a-very-long-host-name"), u),
+                std::exception);
+            BOOST_TEST_EQ(u.buffer(), "x:y");
+        }
+
+        // a colon in the first segment
+        {
+            url_view const v("./a:b");
+            static_url<5> u;
+            BOOST_TEST_THROWS(
+                normalize_to(v, u),
+                std::exception);
+            char buf[7];
+            BOOST_TEST_EQ(
+                normalize_to(v, buf, 6).error(),
+                error::no_space);
+            auto rv = normalize_to(v, buf, sizeof(buf));
+            BOOST_TEST_EQ(rv.value().buffer(), "a%3Ab");
+        }
+
+        // reuse
+        {
+            url u("http://a.b/c");
+            normalize_to(url_view("X:/./y"), u);
+            BOOST_TEST_EQ(u.buffer(), "x:/y");
+            normalize_to(url_view(""), u);
+            BOOST_TEST_EQ(u.buffer(), "");
+        }
+
+        // the example
+        {
+            char buf[64];
+            url_view u = normalize_to(
+                url_view( "HTTP://Example.com:80/a/./b/../%7Ec" ),
+                buf, sizeof(buf), { true, true, true, true } ).value();
+            BOOST_TEST_EQ(u.buffer(), "http://example.com/a/~c");
+        }
+    }
+
+    void
+    testParseNormalized()
+    {
+        // already normal
+        {
+            core::string_view s =
+                "http://example.com/a/b?c#d";
+            char buf[32];
+            auto rv = parse_uri_normalized(
+                s, buf, sizeof(buf));
+            BOOST_TEST_EQ(rv.value().buffer(), s);
+            BOOST_TEST(rv->buffer().data() == buf);
+            BOOST_TEST_EQ(rv->segments().size(), 2u);
+            BOOST_TEST_EQ(
+                parse_uri_normalized(s, buf, 25).error(),
+                error::no_space);
+        }
+
+        // options
+        {
+            url u;
+            BOOST_TEST(parse_uri_normalized(
+                "http://example.com:80/", u,
+                { true, true, true, true }));
+            BOOST_TEST_EQ(u.buffer(),
+                "http://example.com/");
+            BOOST_TEST(parse_uri_normalized(
+                "http://example.com:80/", u));
+            BOOST_TEST_EQ(u.buffer(),
+                "http://example.com:80/");
+            BOOST_TEST(parse_uri_normalized(
+                "HTTP://a/./%7e", u,
+                { false, false, false, false }));
+            BOOST_TEST_EQ(u.buffer(),
+                "HTTP://a/./%7e");
+        }
+
+        // errors leave dest unchanged
+        {
+            url u("x:y");
+            BOOST_TEST(parse_uri_normalized(
+                "/a/b", u).has_error());
+            BOOST_TEST(parse_uri_normalized(
+                "http://%", u).has_error());
+            BOOST_TEST_EQ(u.buffer(), "x:y");
+        }
+
+        // the examples
+        {
+            char buf[64];
+            url_view u = parse_uri_normalized(
+                "HTTP://Example.com/a/./b/../%7Ec", buf, sizeof(buf) ).value();
+            BOOST_TEST_EQ(u.buffer(), "http://example.com/a/~c");
+        }
+        {
+            url u;
+            parse_uri_normalized( "HTTP://Example.com/a/./b", u ).value();
+            BOOST_TEST_EQ(u.buffer(), "http://example.com/a/b");
+        }
+    }
+
+    void
+    run()
+    {
+        testNormalize();
+        testOptions();
+        testBuffers();
+        testParseNormalized();
+    }
+};
+
+TEST_SUITE(
+    normalize_test,
+    "boost.url.normalize");
+
+} // urls
+} // boost
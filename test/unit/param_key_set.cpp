@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/param_key_set.hpp>
+
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct param_key_set_test
+{
+    void
+    testEmpty()
+    {
+        param_key_set ks;
+        BOOST_TEST(ks.empty());
+        BOOST_TEST(! ks.match(""));
+        BOOST_TEST(! ks.match("a"));
+        BOOST_TEST(! ks.match_encoded("%41"));
+    }
+
+    void
+    testKeys()
+    {
+        param_key_set ks;
+        ks.insert("fbclid");
+        ks.insert("gclid");
+        ks.insert("gclid");
+        ks.insert("");
+        BOOST_TEST(! ks.empty());
+        BOOST_TEST(ks.match("fbclid"));
+        BOOST_TEST(ks.match("gclid"));
+        BOOST_TEST(ks.match(""));
+        BOOST_TEST(! ks.match("GCLID"));
+        BOOST_TEST(! ks.match("gclid2"));
+        BOOST_TEST(! ks.match("gcli"));
+        BOOST_TEST(ks.match_encoded("%66bclid"));
+        BOOST_TEST(ks.match_encoded("gcli%64"));
+        BOOST_TEST(! ks.match_encoded("gcli%44"));
+
+        // many keys, so the table grows
+        param_key_set ks2;
+        for(int i = 0; i < 1000; ++i)
+            ks2.insert("k" + std::to_string(i));
+        for(int i = 0; i < 1000; ++i)
+            BOOST_TEST(ks2.match("k" + std::to_string(i)));
+        BOOST_TEST(! ks2.match("k1000"));
+        BOOST_TEST(! ks2.match("k"));
+    }
+
+    void
+    testPrefixes()
+    {
+        param_key_set ks;
+        ks.insert_prefix("utm_");
+        ks.insert_prefix("ut");
+        ks.insert_prefix("mc_");
+        BOOST_TEST(ks.match("ut"));
+        BOOST_TEST(ks.match("utm"));
+        BOOST_TEST(ks.match("utm_source"));
+        BOOST_TEST(ks.match("mc_eid"));
+        BOOST_TEST(! ks.match("mc"));
+        BOOST_TEST(! ks.match("u"));
+        BOOST_TEST(! ks.match(""));
+        BOOST_TEST(! ks.match("UTM_source"));
+        BOOST_TEST(ks.match_encoded("%75tm_x"));
+        BOOST_TEST(ks.match_encoded("mc%5Fx"));
+
+        param_key_set all;
+        all.insert_prefix("");
+        BOOST_TEST(all.match(""));
+        BOOST_TEST(all.match("anything"));
+    }
+
+    void
+    testIgnoreCase()
+    {
+        param_key_set ks(ignore_case);
+        ks.insert("FbClId");
+        ks.insert_prefix("UTM_");
+        BOOST_TEST(ks.match("fbclid"));
+        BOOST_TEST(ks.match("FBCLID"));
+        BOOST_TEST(ks.match("utm_source"));
+        BOOST_TEST(ks.match("Utm_Source"));
+        BOOST_TEST(ks.match_encoded("%46BCLID"));
+        BOOST_TEST(ks.match_encoded("%55tm_x"));
+        BOOST_TEST(! ks.match("fbclid_"));
+        BOOST_TEST(! ks.match("utm"));
+    }
+
+    void
+    testJavadocs()
+    {
+        param_key_set ks( ignore_case );
+        ks.insert( "fbclid" );
+        ks.insert( "gclid" );
+        ks.insert_prefix( "utm_" );
+
+        url u( "https://www.example.com/?utm_source=a&id=42&FBCLID=x" );
+        assert( u.params().erase( ks ) == 2 );
+        assert( u.buffer() == "https://www.example.com/?id=42" );
+    }
+
+    void
+    run()
+    {
+        testEmpty();
+        testKeys();
+        testPrefixes();
+        testIgnoreCase();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    param_key_set_test,
+    "boost.url.param_key_set");
+
+} // urls
+} // boost
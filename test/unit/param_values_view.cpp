@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/param_values_view.hpp>
+
+#include <boost/url/decode_view.hpp>
+#include <boost/url/params_index.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct param_values_view_test
+{
+    static
+    std::vector<std::string>
+    collect(param_values_view const& v)
+    {
+        std::vector<std::string> r;
+        for(pct_string_view s : v)
+            r.emplace_back(s.data(), s.size());
+        return r;
+    }
+
+    static
+    std::vector<std::string>
+    list(std::initializer_list<
+        char const*> init)
+    {
+        return { init.begin(), init.end() };
+    }
+
+    void
+    testDecoded()
+    {
+        url_view u(
+            "?a=1&b=2&A=3&a=4&%61=5&c&a&b%20=x%20y");
+        auto const ps = u.params();
+
+        BOOST_TEST(collect(ps.values("a")) ==
+            list({ "1", "4", "5", "" }));
+        BOOST_TEST(collect(ps.values("a", ignore_case)) ==
+            list({ "1", "3", "4", "5", "" }));
+        BOOST_TEST(collect(ps.values("c")) ==
+            list({ "" }));
+        BOOST_TEST(collect(ps.values("b ")) ==
+            list({ "x%20y" }));
+        BOOST_TEST_EQ(
+            (*ps.values("b ").begin()).decoded_size(), 3u);
+        BOOST_TEST_EQ(
+            *(*ps.values("b ").begin()), "x y");
+        BOOST_TEST(ps.values("x").empty());
+        BOOST_TEST(ps.values("x").begin() ==
+            ps.values("x").end());
+        BOOST_TEST(! ps.values("b").empty());
+
+        // a decoded key may contain '%'
+        {
+            url_view u2(
+                "?100%25=a&x=b&100%25=c");
+            BOOST_TEST(collect(u2.params()
+                .values("100%")) ==
+                list({ "a", "c" }));
+        }
+
+        // postfix increment
+        auto v = ps.values("a");
+        auto it = v.begin();
+        BOOST_TEST_EQ(*it++, "1");
+        BOOST_TEST_EQ(*it, "4");
+    }
+
+    void
+    testEncoded()
+    {
+        url_view u(
+            "?a=1&b=2&A=3&a=4&%61=5&c&a&b%20=x%20y");
+        auto const ps = u.encoded_params();
+
+        BOOST_TEST(collect(ps.values("a")) ==
+            list({ "1", "4", "5", "" }));
+        BOOST_TEST(collect(ps.values("%61")) ==
+            list({ "1", "4", "5", "" }));
+        BOOST_TEST(collect(ps.values("%41", ignore_case)) ==
+            list({ "1", "3", "4", "5", "" }));
+        BOOST_TEST(collect(ps.values("b%20")) ==
+            list({ "x%20y" }));
+        BOOST_TEST(collect(ps.values("b ")) ==
+            list({ "x%20y" }));
+        BOOST_TEST(ps.values("x").empty());
+        BOOST_TEST(url_view().encoded_params()
+            .values("").empty());
+    }
+
+    void
+    testIndexed()
+    {
+        url_view u(
+            "?a=1&b=2&A=3&a=4&%61=5&c&a&b%20=x%20y");
+        auto const ps = u.params();
+        for(core::string_view key : {
+            "a", "A", "b", "c", "b ", "x" })
+        {
+            params_index idx(ps);
+            BOOST_TEST(collect(idx.values(key)) ==
+                collect(ps.values(key)));
+            params_index idx2(ps, ignore_case);
+            BOOST_TEST(collect(idx2.values(key)) ==
+                collect(ps.values(key, ignore_case)));
+        }
+    }
+
+    void
+    run()
+    {
+        testDecoded();
+        testEncoded();
+        testIndexed();
+    }
+};
+
+TEST_SUITE(
+    param_values_view_test,
+    "boost.url.param_values_view");
+
+} // urls
+} // boost
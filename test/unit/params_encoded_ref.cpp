@@ -20,6 +20,8 @@
 #include "test_suite.hpp"
 
 #include <iterator>
+#include <string>
+#include <vector>
 
 #ifdef assert
 #undef assert
@@ -552,6 +554,18 @@ struct params_encoded_ref_test
                 { {"k0",no_value}, {"k2","key"}, {"k3","4"} });
         }
 
+        // sort()
+        {
+            auto const f = [](params_encoded_ref qp)
+            {
+                qp.sort();
+            };
+            check(f, "?b=2&%61=1&b=1&A=0", "A=0&%61=1&b=2&b=1",
+                { {"A","0"}, {"%61","1"}, {"b","2"}, {"b","1"} });
+            check(f, "?&k=1&", "&&k=1",
+                { {"",no_value}, {"",no_value}, {"k","1"} });
+        }
+
         // replace(iterator, param_pct_view)
         {
             auto const f = [](params_encoded_ref qp)
@@ -768,6 +782,75 @@ struct params_encoded_ref_test
 
         assert( u.encoded_params().count( "id" ) == 1 );
         }
+
+        // sort()
+        {
+        url u( "?b=2&%61=1&b=1&A=0" );
+
+        u.encoded_params().sort();
+
+        assert( u.encoded_query() == "A=0&%61=1&b=2&b=1" );
+        }
+    }
+
+    // ranges are validated, measured and
+    // copied in one pass over the elements
+    static
+    void
+    testRanges()
+    {
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        for(int i = 0; i < 50; ++i)
+        {
+            keys.push_back(i % 5 == 0 ?
+                std::string() : "key%20" + std::to_string(i));
+            values.push_back(i % 3 == 0 ?
+                std::string() : "v%26=&" + std::to_string(i));
+        }
+        std::vector<param_pct_view> v;
+        for(std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if(i % 7 == 0)
+                v.push_back({keys[i], no_value});
+            else
+                v.push_back({keys[i], values[i]});
+        }
+
+        // the same as one param at a time
+        std::string s;
+        {
+            url u("?x=1#f");
+            for(auto const& p : v)
+                u.encoded_params().append(p);
+            s = u.buffer();
+        }
+        {
+            url u("?x=1#f");
+            u.encoded_params().append(
+                v.begin(), v.end());
+            BOOST_TEST_EQ(u.buffer(), s);
+            BOOST_TEST_EQ(u.encoded_params().size(), 51u);
+        }
+        {
+            url u("#f");
+            u.encoded_params().assign(
+                v.begin(), v.end());
+            BOOST_TEST_EQ(u.buffer(),
+                "?" + s.substr(5));
+        }
+
+        // invalid input leaves the url unchanged
+        {
+            url u("?x=1#f");
+            param_view const bad[] = {
+                {"a", "b"}, {"c", "%zz"} };
+            BOOST_TEST_THROWS(
+                u.encoded_params().append(
+                    std::begin(bad), std::end(bad)),
+                system::system_error);
+            BOOST_TEST_EQ(u.buffer(), "?x=1#f");
+        }
     }
 
     void
@@ -776,6 +859,7 @@ struct params_encoded_ref_test
         testSpecial();
         testObservers();
         testModifiers();
+        testRanges();
         testJavadocs();
     }
 };
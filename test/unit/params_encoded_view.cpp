@@ -15,6 +15,7 @@
 #include <boost/url/url_view.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/static_assert.hpp>
+#include <algorithm>
 #include <type_traits>
 
 #include "test_suite.hpp"
@@ -43,6 +44,16 @@ BOOST_STATIC_ASSERT(
     std::is_default_constructible<
         params_encoded_view::iterator>::value);
 
+#ifdef __cpp_lib_ranges
+BOOST_STATIC_ASSERT(
+    std::ranges::bidirectional_range<
+        params_encoded_view>);
+
+BOOST_STATIC_ASSERT(
+    std::ranges::sized_range<
+        params_encoded_view>);
+#endif
+
 struct params_encoded_view_test
 {
     static
@@ -201,6 +212,28 @@ struct params_encoded_view_test
         check( T("&key=value"), { {}, { "key", "value" } } );
     }
 
+    void
+    testRanges()
+    {
+#ifdef __cpp_lib_ranges
+        params_encoded_view qp(
+            "first=John&last=Doe&x");
+        param_pct_view const v[] = {
+            { "first", "John" },
+            { "last", "Doe" },
+            { "x", no_value } };
+        BOOST_TEST(std::ranges::equal(
+            qp, v, &is_equal));
+        BOOST_TEST_EQ(std::ranges::size(qp), 3u);
+        auto key = [](param_view const& p)
+        {
+            return p.key;
+        };
+        BOOST_TEST(std::ranges::find(
+            qp, "last", key) != qp.end());
+#endif
+    }
+
     void
     testJavadocs()
     {
@@ -219,6 +252,7 @@ struct params_encoded_view_test
     {
         testMembers();
         testRange();
+        testRanges();
         testJavadocs();
     }
 };
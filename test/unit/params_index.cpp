@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_index.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct params_index_test
+{
+    // the index agrees with the
+    // linear search of params_view
+    static
+    void
+    check(
+        params_view const& ps,
+        core::string_view key)
+    {
+        {
+            params_index idx(ps);
+            BOOST_TEST_EQ(
+                idx.contains(key), ps.contains(key));
+            BOOST_TEST_EQ(
+                idx.count(key), ps.count(key));
+            BOOST_TEST(
+                idx.find(key) == ps.find(key));
+        }
+        {
+            params_index idx(ps, ignore_case);
+            BOOST_TEST_EQ(
+                idx.contains(key),
+                ps.contains(key, ignore_case));
+            BOOST_TEST_EQ(
+                idx.count(key),
+                ps.count(key, ignore_case));
+            BOOST_TEST(
+                idx.find(key) ==
+                ps.find(key, ignore_case));
+        }
+    }
+
+    void
+    testSpecial()
+    {
+        // params_index()
+        {
+            params_index idx;
+            BOOST_TEST(idx.params().empty());
+            BOOST_TEST(! idx.contains(""));
+            BOOST_TEST_EQ(idx.count("x"), 0u);
+            BOOST_TEST(idx.find("x") == idx.params().end());
+        }
+
+        // params_index(params_view, ignore_case_param)
+        {
+            url_view u("?user=john&Lang=en&tag=a&tag=b");
+            params_index idx(u.params(), ignore_case);
+            BOOST_TEST(idx.contains("lang"));
+            BOOST_TEST_EQ(idx.count("tag"), 2u);
+            BOOST_TEST_EQ((*idx.find("user")).value, "john");
+            BOOST_TEST_EQ((*idx.find("LANG")).value, "en");
+        }
+        {
+            url_view u("?user=john&Lang=en&tag=a&tag=b");
+            params_index idx(u.params());
+            BOOST_TEST(! idx.contains("lang"));
+            BOOST_TEST(idx.contains("Lang"));
+            BOOST_TEST(idx.find("lang") == idx.params().end());
+        }
+    }
+
+    void
+    testFind()
+    {
+        url_view u(
+            "?a=1&b=2&A=3&a=4&%61=5&c&=6&&b%20=7&d+e=8");
+        auto const ps = u.params();
+        for(core::string_view key : {
+            "a", "A", "b", "B", "c", "C", "", "b ",
+            "d+e", "d e", "x", "%61" })
+            check(ps, key);
+
+        params_index idx(ps);
+        BOOST_TEST_EQ(idx.count("a"), 3u);
+        BOOST_TEST_EQ(idx.count(""), 2u);
+        auto it = idx.find("a");
+        BOOST_TEST_EQ((*it).value, "1");
+        ++it;
+        BOOST_TEST_EQ((*it).key, "b");
+
+        params_index idx2(ps, ignore_case);
+        BOOST_TEST_EQ(idx2.count("a"), 4u);
+        BOOST_TEST_EQ((*idx2.find("B ")).value, "7");
+    }
+
+    void
+    testMany()
+    {
+        std::string s = "?";
+        for(int i = 0; i < 200; ++i)
+        {
+            s += "key" + std::to_string(i % 150);
+            s += "=v" + std::to_string(i) + "&";
+        }
+        url_view u(s);
+        params_index idx(u.params());
+        for(int i = 0; i < 150; ++i)
+        {
+            auto const key = "key" + std::to_string(i);
+            BOOST_TEST(idx.contains(key));
+            BOOST_TEST_EQ(idx.count(key), i < 50 ? 2u : 1u);
+            auto it = idx.find(key);
+            BOOST_TEST_EQ((*it).value, "v" + std::to_string(i));
+            check(u.params(), key);
+        }
+        BOOST_TEST(! idx.contains("key150"));
+        BOOST_TEST_EQ(idx.count(""), 1u);
+    }
+
+    void
+    testAssign()
+    {
+        url u("http://example.com/?x=1&y=2");
+        params_index idx(u.params());
+        BOOST_TEST(idx.contains("x"));
+        u.params().append({"z", "3"});
+        idx.assign(u.params());
+        BOOST_TEST(idx.contains("z"));
+        BOOST_TEST_EQ((*idx.find("z")).value, "3");
+        idx.assign(url_view("?Q=1").params(), ignore_case);
+        BOOST_TEST(idx.contains("q"));
+        BOOST_TEST(! idx.contains("x"));
+        idx.assign(url_view().params());
+        BOOST_TEST(! idx.contains(""));
+    }
+
+    void
+    testGroups()
+    {
+        url_view u("?b=1&a=2&B=3&b=4&c&a=5");
+        {
+            params_index idx(u.params());
+            BOOST_TEST_EQ(idx.size(), 4u);
+            BOOST_TEST(! idx.empty());
+            BOOST_TEST_EQ(idx.end() - idx.begin(), 4);
+            auto const g = idx[0];
+            BOOST_TEST_EQ(g.key, "b");
+            BOOST_TEST_EQ(g.count, 2u);
+            auto it = g.values.begin();
+            BOOST_TEST_EQ(*it, "1");
+            ++it;
+            BOOST_TEST_EQ(*it, "4");
+            ++it;
+            BOOST_TEST(it == g.values.end());
+            BOOST_TEST_EQ(idx[1].key, "a");
+            BOOST_TEST_EQ(idx[2].key, "B");
+            BOOST_TEST_EQ(idx[3].key, "c");
+            BOOST_TEST_EQ(*idx[3].values.begin(), "");
+            BOOST_TEST_EQ((*(idx.begin() + 1)).count, 2u);
+            BOOST_TEST_EQ(idx.begin()[2].count, 1u);
+            std::size_t n = 0;
+            for(auto const& g2 : idx)
+                n += g2.count;
+            BOOST_TEST_EQ(n, u.params().size());
+            BOOST_TEST(idx.values("x").empty());
+            BOOST_TEST(idx.values("x").begin() ==
+                idx.values("x").end());
+        }
+        {
+            auto idx = group_by_key(
+                u.params(), ignore_case);
+            BOOST_TEST_EQ(idx.size(), 3u);
+            BOOST_TEST_EQ(idx[0].count, 3u);
+            std::string s;
+            for(pct_string_view v : idx[0].values)
+                s += v;
+            BOOST_TEST_EQ(s, "134");
+            s.clear();
+            for(pct_string_view v : idx.values("A"))
+                s += v;
+            BOOST_TEST_EQ(s, "25");
+        }
+        {
+            params_index idx(u.params());
+            idx.assign(url_view("?x=1").params());
+            BOOST_TEST_EQ(idx.size(), 1u);
+            BOOST_TEST_EQ(idx[0].key, "x");
+            idx.assign(url_view().params());
+            BOOST_TEST(idx.empty());
+            BOOST_TEST(idx.begin() == idx.end());
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testFind();
+        testMany();
+        testAssign();
+        testGroups();
+    }
+};
+
+TEST_SUITE(
+    params_index_test,
+    "boost.url.params_index");
+
+} // urls
+} // boost
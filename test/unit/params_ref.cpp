@@ -20,6 +20,8 @@
 #include "test_suite.hpp"
 
 #include <iterator>
+#include <string>
+#include <vector>
 
 #ifdef assert
 #undef assert
@@ -587,6 +589,80 @@ struct params_ref_test
                 { {"k0",no_value}, {"k2","key"}, {"k3","4"} });
         }
 
+        // erase(param_key_set)
+        {
+            auto const f = [](params_ref qp)
+            {
+                param_key_set ks;
+                ks.insert("k1");
+                ks.insert_prefix("x_");
+                auto n = qp.erase(ks);
+                BOOST_TEST_EQ(n, 4);
+            };
+            check(f, "?x_a=1&k0&k1=&k2=key&%78_b=%41&k1=value&K1=5&x=6#f",
+                "k0&k2=key&K1=5&x=6",
+                { {"k0",no_value}, {"k2","key"}, {"K1","5"}, {"x","6"} });
+        }
+        {
+            auto const f = [](params_ref qp)
+            {
+                param_key_set ks(ignore_case);
+                ks.insert("k1");
+                auto n = qp.erase(ks);
+                BOOST_TEST_EQ(n, 3);
+            };
+            check(f, "?k1&K1=%20&k%31=2", "", {});
+        }
+        {
+            auto const f = [](params_ref qp)
+            {
+                param_key_set ks;
+                ks.insert("k9");
+                auto n = qp.erase(ks);
+                BOOST_TEST_EQ(n, 0);
+            };
+            check(f, "?k0=v0&k1", "k0=v0&k1",
+                { {"k0","v0"}, {"k1",no_value} });
+        }
+        {
+            // sizes are kept in sync
+            url u("http://h/?a=%41&utm_x=%42%43&b=%44#%45");
+            param_key_set ks;
+            ks.insert_prefix("utm_");
+            BOOST_TEST_EQ(u.params().erase(ks), 1u);
+            BOOST_TEST_EQ(u.buffer(), "http://h/?a=%41&b=%44#%45");
+            BOOST_TEST_EQ(u.encoded_query().decoded_size(), 7u);
+            BOOST_TEST_EQ(u.encoded_fragment(), "%45");
+            BOOST_TEST_EQ(u.params().size(), 2u);
+        }
+
+        // sort()
+        {
+            auto const f = [](params_ref qp)
+            {
+                qp.sort();
+            };
+            check(f, "?b=2&a=1&b=1&A=0&%61=3", "A=0&a=1&%61=3&b=2&b=1",
+                { {"A","0"}, {"a","1"}, {"a","3"}, {"b","2"}, {"b","1"} });
+            check(f, "?a&b=&&a=2", "&a&a=2&b=",
+                { {"",no_value}, {"a",no_value}, {"a","2"}, {"b",""} });
+            check(f, "?k", "k", { {"k",no_value} });
+            check(f, "", "", {});
+        }
+        {
+            // keys are decoded, and
+            // '+' is a space
+            url u("http://h/?a%2Bb=1&a+b=2&a!=3&a%FF=4#f");
+            u.params().sort();
+            BOOST_TEST_EQ(u.buffer(),
+                "http://h/?a+b=2&a!=3&a%2Bb=1&a%FF=4#f");
+            BOOST_TEST_EQ(u.encoded_fragment(), "f");
+            BOOST_TEST_EQ(u.params().size(), 4u);
+            u.encoded_params().sort();
+            BOOST_TEST_EQ(u.buffer(),
+                "http://h/?a!=3&a+b=2&a%2Bb=1&a%FF=4#f");
+        }
+
         // replace(iterator, param_view)
         {
             auto const f = [](params_ref qp)
@@ -788,6 +864,27 @@ struct params_ref_test
         ignore_unused(it);
         }
 
+        // erase(param_key_set)
+        {
+        param_key_set ks;
+        ks.insert( "fbclid" );
+        ks.insert_prefix( "utm_" );
+
+        url u( "?utm_source=a&id=42&fbclid=x&utm_medium=b" );
+
+        assert( u.params().erase( ks ) == 3 );
+        assert( u.encoded_query() == "id=42" );
+        }
+
+        // sort()
+        {
+        url u( "?b=2&a=1&b=1&A=0" );
+
+        u.params().sort();
+
+        assert( u.encoded_query() == "A=0&a=1&b=2&b=1" );
+        }
+
         // replace(iterator, param_view)
         {
         url u( "?first=John&last=Doe" );
@@ -825,6 +922,75 @@ struct params_ref_test
         }
     }
 
+    // ranges are measured and copied
+    // in one pass over the elements
+    static
+    void
+    testRanges()
+    {
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        for(int i = 0; i < 50; ++i)
+        {
+            keys.push_back(i % 5 == 0 ?
+                std::string() : "key " + std::to_string(i));
+            values.push_back(i % 3 == 0 ?
+                std::string() : "v&=" + std::to_string(i));
+        }
+        std::vector<param_view> v;
+        for(std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if(i % 7 == 0)
+                v.push_back({keys[i], no_value});
+            else
+                v.push_back({keys[i], values[i]});
+        }
+
+        // the same as one param at a time
+        std::string s;
+        {
+            url u("?x=1#f");
+            for(auto const& p : v)
+                u.params().append(p);
+            s = u.buffer();
+        }
+        {
+            url u("?x=1#f");
+            auto it = u.params().append(
+                v.begin(), v.end());
+            BOOST_TEST_EQ(u.buffer(), s);
+            BOOST_TEST_EQ(u.params().size(), 51u);
+            BOOST_TEST(is_equal(*it, v.front()));
+        }
+        {
+            url u("#f");
+            u.params().assign(v.begin(), v.end());
+            BOOST_TEST_EQ(u.buffer(),
+                "?" + s.substr(5));
+            BOOST_TEST_EQ(u.params().size(), 50u);
+            auto it = u.params().begin();
+            for(auto const& p : v)
+                BOOST_TEST(is_equal(*it++, p));
+        }
+
+        // empty params
+        {
+            url u("?x#f");
+            param_view const e[] = {
+                {"", no_value}, {"", no_value}, {"", no_value} };
+            u.params().append(
+                std::begin(e), std::end(e));
+            BOOST_TEST_EQ(u.buffer(), "?x&&&#f");
+            BOOST_TEST_EQ(u.params().size(), 4u);
+            u.params().assign(
+                std::begin(e), std::end(e));
+            BOOST_TEST_EQ(u.buffer(), "?&&#f");
+            u.params().assign(
+                std::begin(e), std::begin(e));
+            BOOST_TEST_EQ(u.buffer(), "#f");
+        }
+    }
+
     static
     void
     testAll()
@@ -832,6 +998,7 @@ struct params_ref_test
         testSpecial();
         testObservers();
         testModifiers();
+        testRanges();
         testJavadocs();
     }
 
@@ -41,6 +41,168 @@ struct parse_test
         {
             BOOST_TEST_NOT(parse_relative_ref("//0.1.0.1%"));
         }
+        // batch
+        {
+            core::string_view in[] = {
+                "https://www.example.com/index.htm",
+                "/path/to/file.txt?id=1",
+                "http://[::1",
+                "",
+                "A:\\" };
+            system::result< url_view > out[5];
+            std::size_t n = parse_uri_reference( in, 5, out );
+            BOOST_TEST_EQ( n, 3u );
+            BOOST_TEST( out[0].has_value() );
+            BOOST_TEST( out[0]->host() == "www.example.com" );
+            BOOST_TEST( out[1].has_value() );
+            BOOST_TEST( out[1]->query() == "id=1" );
+            BOOST_TEST( out[2].has_error() );
+            BOOST_TEST( out[3].has_value() );
+            BOOST_TEST( out[4].has_error() );
+            for( std::size_t i = 0; i < 5; ++i )
+            {
+                auto r = parse_uri_reference( in[i] );
+                BOOST_TEST_EQ( r.has_value(), out[i].has_value() );
+                if( r )
+                    BOOST_TEST( r->buffer().data() ==
+                        out[i]->buffer().data() );
+            }
+            BOOST_TEST_EQ( parse_uri_reference(
+                in, 0, out), 0u );
+        }
+        // resumable batch
+        {
+            core::string_view in[] = {
+                "https://www.example.com/index.htm",
+                "/path/to/file.txt?id=1",
+                "http://[::1",
+                "",
+                "A:\\" };
+            system::result< url_view > out[5];
+
+            // one url per call
+            {
+                parse_progress p;
+                parse_budget b;
+                b.urls = 1;
+                for( std::size_t i = 1; i < 5; ++i )
+                {
+                    BOOST_TEST_NOT( parse_uri_reference(
+                        in, 5, out, p, b ) );
+                    BOOST_TEST_EQ( p.next, i );
+                }
+                BOOST_TEST( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.next, 5u );
+                BOOST_TEST_EQ( p.good, 3u );
+                BOOST_TEST( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.good, 3u );
+            }
+
+            // byte budget
+            {
+                parse_progress p;
+                parse_budget b;
+                b.bytes = 30;
+                BOOST_TEST_NOT( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.next, 1u );
+                BOOST_TEST_NOT( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.next, 2u );
+                BOOST_TEST( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.next, 5u );
+                BOOST_TEST_EQ( p.good, 3u );
+                BOOST_TEST( out[1]->query() == "id=1" );
+                BOOST_TEST( out[2].has_error() );
+                BOOST_TEST( out[4].has_error() );
+            }
+
+            // at least one url per call
+            {
+                parse_progress p;
+                parse_budget b;
+                b.urls = 0;
+                b.bytes = 0;
+                BOOST_TEST_NOT( parse_uri_reference(
+                    in, 5, out, p, b ) );
+                BOOST_TEST_EQ( p.next, 1u );
+                BOOST_TEST( out[0].has_value() );
+            }
+
+            // no budget
+            {
+                parse_progress p;
+                BOOST_TEST( parse_uri_reference(
+                    in, 5, out, p ) );
+                BOOST_TEST_EQ( p.good, 3u );
+            }
+        }
+        // is_plausible_uri
+        {
+            core::string_view good[] = {
+                "http:",
+                "https://www.example.com/index.htm?id=1#top",
+                "http://[::1]:8080/",
+                "mailto:a@example.com",
+                "urn:x%20y",
+                "http://x/#a#b" };
+            for(auto s : good)
+            {
+                BOOST_TEST(is_plausible_uri(s));
+                BOOST_TEST(is_plausible_uri_reference(s));
+                BOOST_TEST(parse_uri(s).has_value());
+            }
+            core::string_view bad[] = {
+                "",
+                "/path",
+                "1http://x",
+                "http://x y",
+                "http://x/\xc3\xa9",
+                "http://x/\x7f",
+                "http://x/%2",
+                "http://x/%zz",
+                "http://x/[",
+                "http:[::1]",
+                "http://x/{}",
+                "A:\\",
+                "A:\"" };
+            for(auto s : bad)
+            {
+                BOOST_TEST_NOT(is_plausible_uri(s));
+                BOOST_TEST_NOT(parse_uri(s).has_value());
+            }
+        }
+        // is_plausible_uri_reference
+        {
+            core::string_view good[] = {
+                "",
+                "/path/to/file.txt?id=1",
+                "//[::1]/x",
+                "a/b:c",
+                "?q#f",
+                "%41",
+                "#a#" };
+            for(auto s : good)
+            {
+                BOOST_TEST(is_plausible_uri_reference(s));
+                BOOST_TEST(parse_uri_reference(s).has_value());
+            }
+            core::string_view bad[] = {
+                ":a",
+                "1a:b",
+                "a%20:b",
+                "not a url",
+                "x\ty",
+                "/[x]" };
+            for(auto s : bad)
+            {
+                BOOST_TEST_NOT(is_plausible_uri_reference(s));
+                BOOST_TEST_NOT(parse_uri_reference(s).has_value());
+            }
+        }
         // parse docs
         {
             system::result< url_view > r = parse_relative_ref( "//www.boost.org/index.html?field=value#downloads" );
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/parse_cache.hpp>
+
+#include <boost/url/parse.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct parse_cache_test
+{
+    // the view from the cache is the
+    // same as the view from parsing
+    static
+    void
+    check(
+        url_view const& u0,
+        url_view const& u1)
+    {
+        BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+        BOOST_TEST_EQ(u1.scheme_id(), u0.scheme_id());
+        BOOST_TEST_EQ(u1.host_type(), u0.host_type());
+        BOOST_TEST_EQ(u1.encoded_host(), u0.encoded_host());
+        BOOST_TEST_EQ(u1.port_number(), u0.port_number());
+        BOOST_TEST_EQ(u1.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u1.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u1.encoded_fragment(), u0.encoded_fragment());
+        BOOST_TEST_EQ(u1.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u1.params().size(), u0.params().size());
+        BOOST_TEST_EQ(u1.encoded_path().decoded_size(),
+            u0.encoded_path().decoded_size());
+        BOOST_TEST(u1.host_ipv6_address() ==
+            u0.host_ipv6_address());
+    }
+
+    void
+    testHit()
+    {
+        parse_cache c(64);
+        BOOST_TEST_EQ(c.capacity(), 64u);
+        core::string_view const v[] = {
+            "http://www.example.com/a/b?c=d&e#f",
+            "https://user:pass@[::1]:8080/%41",
+            "ftp://192.168.0.1/file.txt",
+            "mailto:someone@example.com",
+            "x:",
+            };
+        for(auto s : v)
+        {
+            // a copy, so the view must
+            // reference the argument
+            std::string const s1(s);
+            url_view const u0 = parse_uri(s).value();
+            auto rv = c.parse_uri(s);
+            BOOST_TEST(rv.has_value());
+            check(u0, *rv);
+            rv = c.parse_uri(s1);
+            BOOST_TEST(rv.has_value());
+            check(u0, *rv);
+            BOOST_TEST_EQ(rv->buffer().data(), s1.data());
+        }
+        auto st = c.stats();
+        BOOST_TEST_EQ(st.hits, 5u);
+        BOOST_TEST_EQ(st.misses, 5u);
+        BOOST_TEST_EQ(st.insertions, 5u);
+
+        c.clear();
+        st = c.stats();
+        BOOST_TEST_EQ(st.hits, 0u);
+        BOOST_TEST_EQ(st.misses, 0u);
+        BOOST_TEST(c.parse_uri(v[0]).has_value());
+        BOOST_TEST_EQ(c.stats().misses, 1u);
+    }
+
+    void
+    testKinds()
+    {
+        parse_cache c(64);
+
+        // a relative reference is not
+        // a hit for parse_uri
+        BOOST_TEST(c.parse_uri_reference("/a/b").has_value());
+        BOOST_TEST(c.parse_uri("/a/b").has_error());
+        BOOST_TEST(c.parse_uri("/a/b").has_error());
+        BOOST_TEST(c.parse_uri_reference("/a/b").has_value());
+        auto st = c.stats();
+        BOOST_TEST_EQ(st.hits, 1u);
+        BOOST_TEST_EQ(st.misses, 3u);
+    }
+
+    void
+    testBounds()
+    {
+        // too long to store
+        {
+            parse_cache c(16, 8);
+            BOOST_TEST_EQ(c.max_size(), 8u);
+            core::string_view s = "http://www.example.com";
+            BOOST_TEST(c.parse_uri(s).has_value());
+            BOOST_TEST(c.parse_uri(s).has_value());
+            auto st = c.stats();
+            BOOST_TEST_EQ(st.hits, 0u);
+            BOOST_TEST_EQ(st.insertions, 0u);
+        }
+
+        // strings replace each other
+        {
+            parse_cache c(1);
+            BOOST_TEST_EQ(c.capacity(), parse_cache::shard_count);
+            std::string s = "http://example.com/";
+            for(int i = 0; i < 100; ++i)
+            {
+                std::string s1 = s + std::to_string(i);
+                BOOST_TEST(c.parse_uri(s1).has_value());
+            }
+            auto st = c.stats();
+            BOOST_TEST_EQ(st.misses, 100u);
+            BOOST_TEST_EQ(st.insertions, 100u);
+            BOOST_TEST_LE(st.insertions - st.evictions,
+                c.capacity());
+        }
+    }
+
+    void
+    testInstall()
+    {
+        parse_cache c(64);
+        BOOST_TEST(set_parse_cache(&c) == nullptr);
+        core::string_view s = "http://www.example.com/index.htm";
+        BOOST_TEST(parse_uri(s).has_value());
+        BOOST_TEST(parse_uri(s).has_value());
+        BOOST_TEST(parse_uri_reference(s).has_value());
+        BOOST_TEST(parse_uri("%").has_error());
+        BOOST_TEST(set_parse_cache(nullptr) == &c);
+        BOOST_TEST(parse_uri(s).has_value());
+        auto st = c.stats();
+        BOOST_TEST_EQ(st.hits, 1u);
+        BOOST_TEST_EQ(st.misses, 3u);
+    }
+
+    void
+    run()
+    {
+        testHit();
+        testKinds();
+        testBounds();
+        testInstall();
+    }
+};
+
+TEST_SUITE(
+    parse_cache_test,
+    "boost.url.parse_cache");
+
+} // urls
+} // boost
@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/parse_iri.hpp>
+
+#include <boost/url/error.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct parse_iri_test
+{
+    // the result is parsed again to
+    // check the parts of the url
+    static
+    void
+    check(
+        core::string_view s,
+        core::string_view expected)
+    {
+        url u("x://y:z@h:1/p?q#f");
+        auto rv = parse_iri_reference(s, u);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(u.buffer(), expected);
+        url_view const v = parse_uri_reference(
+            u.buffer()).value();
+        BOOST_TEST_EQ(u.scheme(), v.scheme());
+        BOOST_TEST_EQ(u.encoded_user(), v.encoded_user());
+        BOOST_TEST_EQ(u.host_type(), v.host_type());
+        BOOST_TEST_EQ(u.encoded_host(), v.encoded_host());
+        BOOST_TEST_EQ(u.port_number(), v.port_number());
+        BOOST_TEST_EQ(u.encoded_path(), v.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), v.segments().size());
+        BOOST_TEST_EQ(u.params().size(), v.params().size());
+        BOOST_TEST_EQ(u.encoded_fragment(), v.encoded_fragment());
+
+        // the same in a static_url,
+        // and as a new url
+        static_url<4096> su;
+        BOOST_TEST(parse_iri_reference(s, su).has_value());
+        BOOST_TEST_EQ(su.buffer(), expected);
+        auto ru = parse_iri_reference(s);
+        if(BOOST_TEST(ru.has_value()))
+            BOOST_TEST_EQ(ru->buffer(), expected);
+    }
+
+    static
+    void
+    bad(
+        core::string_view s,
+        system::error_code ec = {})
+    {
+        url u("http://unchanged/");
+        auto rv = parse_iri_reference(s, u);
+        BOOST_TEST(rv.has_error());
+        if(ec.failed())
+            BOOST_TEST_EQ(rv.error(), ec);
+        BOOST_TEST_EQ(u.buffer(), "http://unchanged/");
+        BOOST_TEST(parse_iri_reference(s).has_error());
+    }
+
+    void
+    testAscii()
+    {
+        check("", "");
+        check("http://example.com/a?b#c", "http://example.com/a?b#c");
+        check("//h:80/p", "//h:80/p");
+        check("a/b%20c", "a/b%20c");
+        check("?q", "?q");
+        bad("http://h/%zz");
+        bad("http://h/ ");
+        bad("1a:b");
+    }
+
+    void
+    testMapping()
+    {
+        check("http://r\xc3\xa9sum\xc3\xa9.example/caf\xc3\xa9",
+            "http://r%C3%A9sum%C3%A9.example/caf%C3%A9");
+        check("/\xe6\x97\xa5\xe6\x9c\xac", "/%E6%97%A5%E6%9C%AC");
+        check("http://u\xc3\xa9:p\xc3\xa9@h/", "http://u%C3%A9:p%C3%A9@h/");
+        check("?q=\xe2\x82\xac&k", "?q=%E2%82%AC&k");
+        check("#\xf0\x9f\x98\x80", "#%F0%9F%98%80");
+        check("x\xc2\xa0y", "x%C2%A0y");
+        check("\xed\x9f\xbf", "%ED%9F%BF");
+        check("\xf3\xa1\x80\x80", "%F3%A1%80%80");
+
+        // long strings take the vector paths
+        {
+            std::string s = "http://example.com/";
+            std::string r = s;
+            for(int i = 0; i < 100; ++i)
+            {
+                s += "abcdefghijklmnopqrstuvwxyz\xc3\xa9";
+                r += "abcdefghijklmnopqrstuvwxyz%C3%A9";
+            }
+            check(s, r);
+        }
+
+        // the mapping does not escape
+        // ASCII characters
+        bad("http://h/\xc3\xa9 ");
+        bad("http://h/\xc3\xa9%zz");
+
+        // escapes are not allowed everywhere
+        bad("\xc3\xa9:x");
+        bad("http://h:8\xc3\xa9/");
+        bad("http://[::\xc3\xa9]/");
+    }
+
+    void
+    testUtf8()
+    {
+        auto const ec = system::error_code(
+            error::bad_utf8);
+        bad("/\x80", ec);
+        bad("/\xbf", ec);
+        bad("/\xc0\xaf", ec);
+        bad("/\xc1\xbf", ec);
+        bad("/\xc3", ec);
+        bad("/\xc3x", ec);
+        bad("/\xe0\x80\xaf", ec);
+        bad("/\xe2\x82", ec);
+        bad("/\xed\xa0\x80", ec);
+        bad("/\xf0\x8f\xbf\xbf", ec);
+        bad("/\xf4\x90\x80\x80", ec);
+        bad("/\xf5\x80\x80\x80", ec);
+        bad("/\xff", ec);
+    }
+
+    void
+    testChars()
+    {
+        // not ucschar
+        bad("/\xc2\x80");
+        bad("/\xc2\x9f");
+        bad("/\xef\xb7\x90");
+        bad("/\xef\xbf\xbe");
+        bad("/\xef\xbf\xbf");
+        bad("/\xf0\x9f\xbf\xbe");
+        bad("/\xf3\xa0\x80\x80");
+
+        // iprivate in the query only
+        check("?\xee\x80\x80", "?%EE%80%80");
+        check("/p?q\xef\xa3\xbf", "/p?q%EF%A3%BF");
+        check("/\xc3\xa9?\xf3\xb0\x80\x80",
+            "/%C3%A9?%F3%B0%80%80");
+        check("?\xf4\x8f\xbf\xbd", "?%F4%8F%BF%BD");
+        bad("/\xee\x80\x80");
+        bad("/\xee\x80\x80?");
+        bad("?#\xee\x80\x80");
+        bad("?a\xc3\xa9#b\xee\x80\x80");
+        bad("?\xf4\x8f\xbf\xbf");
+    }
+
+    void
+    testAlias()
+    {
+        // s refers to dest
+        {
+            url u("http://example.com/path");
+            BOOST_TEST(parse_iri_reference(
+                u.buffer(), u).has_value());
+            BOOST_TEST_EQ(u.buffer(), "http://example.com/path");
+            BOOST_TEST(parse_iri_reference(
+                u.buffer().substr(7), u).has_value());
+            BOOST_TEST_EQ(u.buffer(), "example.com/path");
+        }
+
+        // the capacity is reused
+        {
+            url u;
+            u.reserve(100);
+            char const* p = u.buffer().data();
+            BOOST_TEST(parse_iri_reference(
+                "/\xc3\xa9", u).has_value());
+            BOOST_TEST_EQ(u.buffer(), "/%C3%A9");
+            BOOST_TEST_EQ(u.buffer().data(), p);
+            BOOST_TEST(parse_iri_reference(
+                "/\xc3\xa8", u).has_value());
+            BOOST_TEST_EQ(u.buffer(), "/%C3%A8");
+            BOOST_TEST_EQ(u.buffer().data(), p);
+        }
+
+        // an empty destination is
+        // unchanged by an error
+        {
+            url u;
+            BOOST_TEST(parse_iri_reference(
+                "\xc3\xa9:x", u).has_error());
+            BOOST_TEST_EQ(u.buffer(), "");
+            BOOST_TEST(u.empty());
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // parse_iri_reference(core::string_view, url_base&)
+        {
+        url u;
+        parse_iri_reference( "http://r\xc3\xa9sum\xc3\xa9.example/caf\xc3\xa9?q=\xe2\x82\xac", u ).value();
+        assert( u.buffer() == "http://r%C3%A9sum%C3%A9.example/caf%C3%A9?q=%E2%82%AC" );
+        assert( u.host() == "r\xc3\xa9sum\xc3\xa9.example" );
+        }
+
+        // parse_iri_reference(core::string_view)
+        {
+        url u = parse_iri_reference( "/\xe6\x97\xa5\xe6\x9c\xac" ).value();
+        assert( u.encoded_path() == "/%E6%97%A5%E6%9C%AC" );
+        }
+    }
+
+    void
+    run()
+    {
+        testAscii();
+        testMapping();
+        testUtf8();
+        testChars();
+        testAlias();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    parse_iri_test,
+    "boost.url.parse_iri");
+
+} // urls
+} // boost
@@ -0,0 +1,345 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/parse_whatwg.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct parse_whatwg_test
+{
+    whatwg_opts idna;
+
+    parse_whatwg_test()
+    {
+        // a stand-in for an IDNA library
+        idna.domain_to_ascii = [](
+            core::string_view d, std::string& r)
+        {
+            if(d == "b\xc3\xbc" "cher.de")
+            {
+                r = "xn--BCHER-kva.de";
+                return true;
+            }
+            if(d == "xn--bcher-kva.de")
+            {
+                r = std::string(d);
+                return true;
+            }
+            return false;
+        };
+    }
+
+    // the result is parsed again to
+    // check the parts of the url
+    static
+    void
+    check(
+        core::string_view s,
+        core::string_view expected,
+        whatwg_opts const& opt = {})
+    {
+        url u("x://y:z@h:1/p?q#f");
+        auto rv = parse_whatwg(s, u, opt);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(u.buffer(), expected);
+        url_view const v = parse_uri(
+            u.buffer()).value();
+        BOOST_TEST_EQ(u.scheme_id(), v.scheme_id());
+        BOOST_TEST_EQ(u.encoded_user(), v.encoded_user());
+        BOOST_TEST_EQ(u.encoded_password(), v.encoded_password());
+        BOOST_TEST_EQ(u.host_type(), v.host_type());
+        BOOST_TEST_EQ(u.encoded_host(), v.encoded_host());
+        BOOST_TEST_EQ(u.port_number(), v.port_number());
+        BOOST_TEST_EQ(u.encoded_path(), v.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), v.segments().size());
+        BOOST_TEST_EQ(u.params().size(), v.params().size());
+        BOOST_TEST_EQ(u.encoded_fragment(), v.encoded_fragment());
+
+        // the same in a static_url,
+        // and as a new url
+        static_url<256> su;
+        BOOST_TEST(parse_whatwg(s, su, opt).has_value());
+        BOOST_TEST_EQ(su.buffer(), expected);
+        auto ru = parse_whatwg(s, opt);
+        if(BOOST_TEST(ru.has_value()))
+            BOOST_TEST_EQ(ru->buffer(), expected);
+    }
+
+    static
+    void
+    bad(
+        core::string_view s,
+        whatwg_opts const& opt = {})
+    {
+        url u("http://unchanged/");
+        BOOST_TEST(parse_whatwg(s, u, opt).has_error());
+        BOOST_TEST_EQ(u.buffer(), "http://unchanged/");
+        BOOST_TEST(parse_whatwg(s, opt).has_error());
+    }
+
+    void
+    testScheme()
+    {
+        check("HTTP://h", "http://h/");
+        check("a+b-c.d:x", "a+b-c.d:x");
+        check("  \x01http://h/ \x1f", "http://h/");
+        check("h\tt\ntp://h\r/", "http://h/");
+        bad("");
+        bad("foo");
+        bad(":foo");
+        bad("1foo:bar");
+        bad("fo o:x");
+        bad("/path");
+    }
+
+    void
+    testAuthority()
+    {
+        check("http:h", "http://h/");
+        check("http:/\\/\\h/p", "http://h/p");
+        check("http://u:p@h:81/", "http://u:p@h:81/");
+        check("http://:@h/", "http://h/");
+        check("http://u:@h/", "http://u@h/");
+        check("http://:p@h/", "http://:p@h/");
+        check("http://@h/", "http://h/");
+        check("http://a@b@h/", "http://a%40b@h/");
+        check("http://u;=x:p:q@h/", "http://u%3B%3Dx:p%3Aq@h/");
+        check("http://h:65535/", "http://h:65535/");
+        check("http://h:0080/", "http://h/");
+        check("http://h:/", "http://h/");
+        check("ws://h:443/", "ws://h:443/");
+        check("wss://h:443/", "wss://h/");
+        check("ftp://h:21/", "ftp://h/");
+        check("foo://h:21/", "foo://h:21/");
+        bad("http://");
+        bad("http://u@/");
+        bad("http://h:65536/");
+        bad("http://h:8a/");
+        bad("http://:80/");
+        bad("foo://:1/");
+        bad("foo://u@:1/");
+    }
+
+    void
+    testHost()
+    {
+        // domains
+        check("http://EX%41mple.com/", "http://example.com/");
+        check("http://a\"b{}/", "http://a%22b%7B%7D/");
+        check("http://XN--bcher-kva.de/", "http://xn--bcher-kva.de/");
+        bad("http://ex%zzample/");
+        bad("http://a%2fb/");
+        bad("http://a%00b/");
+        bad("http://a b/");
+        bad("http://a^b/");
+
+        // IPv4
+        check("http://1.2.3.4/", "http://1.2.3.4/");
+        check("http://1.2.3.4./", "http://1.2.3.4/");
+        check("http://0x7f.1/", "http://127.0.0.1/");
+        check("http://4294967295/", "http://255.255.255.255/");
+        check("http://010.0x10.1/", "http://8.16.0.1/");
+        check("http://0x/", "http://0.0.0.0/");
+        check("http://a.b9/", "http://a.b9/");
+        check("http://1.2.3.4../", "http://1.2.3.4../");
+        bad("http://0x100000000/");
+        bad("http://1.2.3.256/");
+        bad("http://256.1/");
+        bad("http://1.2.3.4.5/");
+        bad("http://09/");
+        bad("http://a.09/");
+        bad("http://foo.0x/");
+        {
+            url u = parse_whatwg("http://0x7f.1/").value();
+            BOOST_TEST_EQ(u.host_type(), host_type::ipv4);
+            BOOST_TEST(u.host_ipv4_address() ==
+                ipv4_address(0x7f000001));
+        }
+
+        // IPv6
+        check("http://[::1]/", "http://[::1]/");
+        check("http://[::1]:8080/", "http://[::1]:8080/");
+        check("http://[0:0:0:0:0:ffff:1.2.3.4]/", "http://[::ffff:102:304]/");
+        check("http://[1:0:0:2:0:0:0:3]/", "http://[1:0:0:2::3]/");
+        check("http://[1:0:3:4:5:6:7:8]/", "http://[1:0:3:4:5:6:7:8]/");
+        check("http://[::]/", "http://[::]/");
+        check("http://[1::]/", "http://[1::]/");
+        check("foo://[::1]/", "foo://[::1]/");
+        bad("http://[::1/");
+        bad("http://[::1]x/");
+
+        // opaque hosts
+        check("foo://H%41/", "foo://H%41/");
+        check("foo://h%zz/", "foo://h%25zz/");
+        check("foo://a\"b/", "foo://a%22b/");
+        bad("foo://a b/");
+    }
+
+    void
+    testIdna()
+    {
+        bad("http://b\xc3\xbc" "cher.de/");
+        check("http://b\xc3\xbc" "cher.de/",
+            "http://xn--bcher-kva.de/", idna);
+        check("http://b%C3%BCcher.de/",
+            "http://xn--bcher-kva.de/", idna);
+        check("http://xn--bcher-kva.de/",
+            "http://xn--bcher-kva.de/", idna);
+        bad("http://xn--bad/", idna);
+        bad("http://\xff/", idna);
+
+        // ASCII domains are not passed
+        // to the function
+        check("http://EXAMPLE.com/",
+            "http://example.com/", idna);
+    }
+
+    void
+    testPath()
+    {
+        check("http://h/a/./b/../c/", "http://h/a/c/");
+        check("http://h\\a\\.\\b\\..\\c", "http://h/a/c");
+        check("http://h/a/..", "http://h/");
+        check("http://h/a/.", "http://h/a/");
+        check("http://h/..", "http://h/");
+        check("http://h/../../x", "http://h/x");
+        check("http://h/a/%2e%2E/b", "http://h/b");
+        check("http://h/a/.%2e", "http://h/");
+        check("http://h/a/%2e/b", "http://h/a/b");
+        check("http://h/a b|c^d`e{f}\"<>",
+            "http://h/a%20b%7Cc%5Ed%60e%7Bf%7D%22%3C%3E");
+        check("http://h/%zz%41", "http://h/%25zz%41");
+        check("http://h/\xc3\xa9", "http://h/%C3%A9");
+
+        check("foo:bar", "foo:bar");
+        check("foo:bar baz", "foo:bar%20baz");
+        check("foo:", "foo:");
+        check("foo:a:b?c#d", "foo:a:b?c#d");
+        check("foo:/a/./b/../c", "foo:/a/c");
+        check("foo:/", "foo:/");
+        check("foo://", "foo://");
+        check("foo://h", "foo://h");
+        check("foo://h/", "foo://h/");
+        check("foo://h/a\\b", "foo://h/a%5Cb");
+        check("foo:/.//p", "foo:/.//p");
+        check("foo:/..//p", "foo:/.//p");
+        check("foo:////p", "foo:////p");
+    }
+
+    void
+    testFile()
+    {
+        check("file:///C:/a/../..", "file:///C:/");
+        check("file:///C|/a", "file:///C:/a");
+        check("file://C:/a", "file:///C:/a");
+        check("file:/C|/a", "file:///C:/a");
+        check("file:C|/a", "file:///C:/a");
+        check("file:///1:/..", "file:///");
+        check("file://localhost/x", "file:///x");
+        check("file://LocalHost/x", "file:///x");
+        check("file://Host/x", "file://host/x");
+        check("file:", "file:///");
+        check("file:a", "file:///a");
+        check("file:/a", "file:///a");
+        check("file://h", "file://h/");
+        check("file:\\\\h\\a", "file://h/a");
+        check("file:///a?q#f", "file:///a?q#f");
+        check("file://127.1/", "file://127.0.0.1/");
+        check("file://[::1]/", "file://[::1]/");
+        check("file:////a", "file:////a");
+        bad("file://h:1/");
+        bad("file://u@h/");
+    }
+
+    void
+    testQueryFragment()
+    {
+        check("http://h?a='b'", "http://h/?a=%27b%27");
+        check("foo://h?a='b'", "foo://h?a='b'");
+        check("http://h?a b#c d", "http://h/?a%20b#c%20d");
+        check("http://h#a#b", "http://h/#a#b");
+        check("http://h/#", "http://h/#");
+        check("http://h/?", "http://h/?");
+        check("http://h/p?q\\r", "http://h/p?q%5Cr");
+    }
+
+    void
+    testReuse()
+    {
+        // no reallocation once the
+        // capacity is large enough
+        url u;
+        u.reserve(64);
+        char const* p = u.buffer().data();
+        parse_whatwg("HTTP://A.COM:80/x/../y", u).value();
+        BOOST_TEST_EQ(u.buffer(), "http://a.com/y");
+        BOOST_TEST(u.buffer().data() == p);
+
+        // the input may reference
+        // the destination
+        u = url("http://h/a/../b");
+        parse_whatwg(u.buffer(), u).value();
+        BOOST_TEST_EQ(u.buffer(), "http://h/b");
+    }
+
+    void
+    testJavadocs()
+    {
+        // parse_whatwg
+        {
+        url u;
+        parse_whatwg( " HTTP://EXAMPLE.com:80\\a\\.\\b\\..\\c?x#y ", u ).value();
+        assert( u.buffer() == "http://example.com/a/c?x#y" );
+
+        parse_whatwg( "http://0x7f.1/", u ).value();
+        assert( u.host_type() == host_type::ipv4 );
+        assert( u.buffer() == "http://127.0.0.1/" );
+        }
+
+        {
+        url u = parse_whatwg( "https://example.com:443" ).value();
+        assert( u.buffer() == "https://example.com/" );
+        }
+    }
+
+    void
+    run()
+    {
+        testScheme();
+        testAuthority();
+        testHost();
+        testIdna();
+        testPath();
+        testFile();
+        testQueryFragment();
+        testReuse();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    parse_whatwg_test,
+    "boost.url.parse_whatwg");
+
+} // urls
+} // boost
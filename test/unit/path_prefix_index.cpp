@@ -0,0 +1,358 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/path_prefix_index.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct path_prefix_index_test
+{
+    using ids_type = std::vector<std::size_t>;
+
+    // one decoded character at a time
+    static
+    char
+    ref_front(core::string_view& s)
+    {
+        if(s[0] != '%')
+        {
+            char const c = s[0];
+            s.remove_prefix(1);
+            return c;
+        }
+        char const c = static_cast<char>(std::stoi(
+            std::string(s.substr(1, 2)), nullptr, 16));
+        if(c == '/')
+        {
+            s.remove_prefix(1);
+            return '%';
+        }
+        s.remove_prefix(3);
+        return c;
+    }
+
+    static
+    char
+    ref_back(core::string_view& s)
+    {
+        if( s.size() < 3 ||
+            s[s.size() - 3] != '%')
+        {
+            char const c = s.back();
+            s.remove_suffix(1);
+            return c;
+        }
+        char const c = static_cast<char>(std::stoi(
+            std::string(s.substr(s.size() - 2)), nullptr, 16));
+        if(c == '/')
+        {
+            char const l = s.back();
+            s.remove_suffix(1);
+            return l;
+        }
+        s.remove_suffix(3);
+        return c;
+    }
+
+    static
+    boost::optional<std::size_t>
+    ref_starts_with(
+        core::string_view s0,
+        core::string_view s1)
+    {
+        auto const n = s0.size();
+        while(! s0.empty() && ! s1.empty())
+            if(ref_front(s0) != ref_front(s1))
+                return boost::none;
+        if(! s1.empty())
+            return boost::none;
+        return n - s0.size();
+    }
+
+    static
+    boost::optional<std::size_t>
+    ref_ends_with(
+        core::string_view s0,
+        core::string_view s1)
+    {
+        auto const n = s0.size();
+        while(! s0.empty() && ! s1.empty())
+            if(ref_back(s0) != ref_back(s1))
+                return boost::none;
+        if(! s1.empty())
+            return boost::none;
+        return n - s0.size();
+    }
+
+    void
+    testStartsWith()
+    {
+        auto check = [](
+            core::string_view path,
+            core::string_view prefix,
+            int n)
+        {
+            auto const r =
+                path_starts_with(path, prefix);
+            if(n < 0)
+            {
+                BOOST_TEST(! r);
+                return;
+            }
+            if(BOOST_TEST(r))
+                BOOST_TEST_EQ(*r, std::size_t(n));
+        };
+        check("", "", 0);
+        check("/a", "", 0);
+        check("", "/", -1);
+        check("/api/v1", "/api", 4);
+        check("/api/v1", "/api/", 5);
+        check("/api", "/api/", -1);
+        check("/%61pi/v1", "/api/", 7);
+        check("/api/v1", "/%61%70i/", 5);
+        check("/%61pi", "/%61pi", 6);
+        check("/%61pi", "/%62pi", -1);
+        check("/api%2Fv1", "/api/", -1);
+        check("/api%2Fv1", "/api%2F", 7);
+        check("/api%2fv1", "/api%2F", -1);
+        check("/api/v1", "/api%2F", -1);
+        check("/ap", "/api", -1);
+
+        // long runs take the vector path
+        std::string const a(100, 'a');
+        check("/" + a + "/x", "/" + a, 101);
+        check("/" + a + "/x", "/" + a + "/y", -1);
+        check("/" + a + "%41", "/" + a + "A", 104);
+        std::string b = "/" + a;
+        b[70] = 'b';
+        check("/" + a, b, -1);
+    }
+
+    void
+    testEndsWith()
+    {
+        auto check = [](
+            core::string_view path,
+            core::string_view suffix,
+            int n)
+        {
+            auto const r =
+                path_ends_with(path, suffix);
+            if(n < 0)
+            {
+                BOOST_TEST(! r);
+                return;
+            }
+            if(BOOST_TEST(r))
+                BOOST_TEST_EQ(*r, std::size_t(n));
+        };
+        check("", "", 0);
+        check("/a", "", 0);
+        check("/index.html", "index.html", 10);
+        check("/static/%69ndex.html", "index.html", 12);
+        check("/static/index.html", "%69ndex.html", 10);
+        check("/x%41", "A", 3);
+        check("/x%41", "41", -1);
+        check("/x%41", "x41", -1);
+        check("/a%2Fb", "/b", -1);
+        check("/a%2Fb", "%2Fb", 4);
+        check("b", "ab", -1);
+
+        std::string const a(100, 'a');
+        check("/x/" + a, a, 100);
+        check("/x/%41" + a, "A" + a, 103);
+        check("/x/%41" + a, "41" + a, -1);
+        check("/x/%41" + a + "%2F" + a, "%2F" + a, 103);
+    }
+
+    void
+    testRandom()
+    {
+        // compare with decoding every
+        // character, on strings with
+        // long runs and a few escapes
+        std::mt19937 g(42);
+        char const* const pieces[] = {
+            "a", "b", "/", "%61", "%62",
+            "%2F", "%2f", "%25", "aaaaaaaaaaaaaaaaaaaa" };
+        auto make = [&](std::size_t n)
+        {
+            std::string s;
+            for(std::size_t i = 0; i < n; ++i)
+                s += pieces[g() % 9];
+            return s;
+        };
+        // a random position which
+        // is not inside an escape
+        auto pos = [&](core::string_view s)
+        {
+            std::size_t p = g() % (s.size() + 1);
+            while(p > 0 && (
+                s[p - 1] == '%' ||
+                (p > 1 && s[p - 2] == '%')))
+                --p;
+            return p;
+        };
+        for(int i = 0; i < 20000; ++i)
+        {
+            std::string const s0 = make(g() % 12);
+            std::string s1 = make(g() % 12);
+            // share a prefix or a suffix
+            // more often than not
+            if(g() % 2)
+                s1 = s0.substr(0, pos(s0)) + s1;
+            if(g() % 2)
+                s1 = s1.substr(0, pos(s1));
+            BOOST_TEST(
+                path_starts_with(s0, s1) ==
+                ref_starts_with(s0, s1));
+            std::string s2 = make(g() % 12);
+            if(g() % 2)
+                s2 += s0.substr(pos(s0));
+            if(g() % 2)
+                s2 = s2.substr(pos(s2));
+            BOOST_TEST(
+                path_ends_with(s0, s2) ==
+                ref_ends_with(s0, s2));
+        }
+    }
+
+    void
+    testIndex()
+    {
+        path_prefix_index t;
+        BOOST_TEST(t.empty());
+        ids_type ids;
+        BOOST_TEST_EQ(t.match("/a", ids), 0u);
+
+        t.insert(1, "/");
+        t.insert(2, "/api");
+        t.insert(3, "/api/admin/");
+        t.insert(4, "/static");
+        t.insert(5, "/api");
+        t.insert(6, "/%61pi/users");
+        t.insert(7, "/api%2Fadmin");
+        t.insert(8, "//");
+        BOOST_TEST_EQ(t.size(), 8u);
+
+        auto check = [&t](
+            core::string_view path,
+            ids_type const& v)
+        {
+            // identifiers are appended
+            ids_type ids{ 99 };
+            BOOST_TEST_EQ(
+                t.match(path, ids), v.size());
+            ids_type w{ 99 };
+            w.insert(w.end(), v.begin(), v.end());
+            BOOST_TEST(ids == w);
+        };
+        check("", { 1 });
+        check("/", { 1, 8 });
+        check("/api", { 1, 2, 5 });
+        check("/api/", { 1, 2, 5 });
+        check("/apis", { 1 });
+        check("/api/admin", { 1, 2, 5, 3 });
+        check("/api/admin/x/y", { 1, 2, 5, 3 });
+        check("/%61pi/%61dmin", { 1, 2, 5, 3 });
+        check("/api/users/1", { 1, 2, 5, 6 });
+        check("/api%2Fadmin", { 1, 7 });
+        check("/api%2fadmin/x", { 1, 7 });
+        check("api/users", { 1, 2, 5, 6 });
+        check("/static/app.js", { 1, 4 });
+        check("//x", { 1, 8 });
+
+        ids.clear();
+        t.match(url_view(
+            "https://example.com/static/a?x#y"), ids);
+        BOOST_TEST(ids == ids_type({ 1, 4 }));
+
+        // erase
+        BOOST_TEST_EQ(t.erase(2, "/%61pi"), 1u);
+        BOOST_TEST_EQ(t.erase(2, "/api"), 0u);
+        BOOST_TEST_EQ(t.erase(1, "/nothing"), 0u);
+        BOOST_TEST_EQ(t.erase(1, ""), 1u);
+        BOOST_TEST_EQ(t.size(), 6u);
+        check("/api/admin", { 5, 3 });
+        t.insert(1, "/api");
+        check("/api/admin", { 5, 1, 3 });
+    }
+
+    void
+    testMany()
+    {
+        path_prefix_index t;
+        for(std::size_t i = 0; i < 10000; ++i)
+            t.insert(i, "/tenant" +
+                std::to_string(i % 100) +
+                "/svc" + std::to_string(i));
+        BOOST_TEST_EQ(t.size(), 10000u);
+        ids_type ids;
+        BOOST_TEST_EQ(t.match(
+            "/tenant42/svc4242/a/b", ids), 1u);
+        BOOST_TEST(ids == ids_type({ 4242 }));
+        ids.clear();
+        BOOST_TEST_EQ(t.match(
+            "/tenant42/svc4243", ids), 0u);
+        t.insert(10000, "/tenant42");
+        BOOST_TEST_EQ(t.match(
+            "/tenant42/svc4242", ids), 2u);
+        BOOST_TEST(ids == ids_type({ 10000, 4242 }));
+    }
+
+    void
+    testJavadocs()
+    {
+        assert( *path_starts_with( "/%61pi/v1/users", "/api/" ) == 7 );
+        assert( ! path_starts_with( "/api%2Fv1", "/api/" ) );
+        assert( *path_ends_with( "/static/%69ndex.html", "index.html" ) == 12 );
+
+        path_prefix_index acl;
+        acl.insert( 1, "/" );
+        acl.insert( 2, "/api" );
+        acl.insert( 3, "/api/admin/" );
+        acl.insert( 4, "/static" );
+
+        std::vector< std::size_t > ids;
+        acl.match( "/api/admin/users", ids );
+        assert( ids == std::vector< std::size_t >({ 1, 2, 3 }) );
+    }
+
+    void
+    run()
+    {
+        testStartsWith();
+        testEndsWith();
+        testRandom();
+        testIndex();
+        testMany();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    path_prefix_index_test,
+    "boost.url.path_prefix_index");
+
+} // urls
+} // boost
@@ -12,6 +12,8 @@
 
 #include "test_suite.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 
@@ -133,11 +135,83 @@ struct pct_string_view_test
 
     }
 
+    void
+    testDecode()
+    {
+        // short
+        {
+            BOOST_TEST_EQ(S("").decode(), "");
+            BOOST_TEST_EQ(S("%41").decode(), "A");
+            BOOST_TEST_EQ(S("a+b%20c").decode(), "a+b c");
+            encoding_opts opt;
+            opt.space_as_plus = true;
+            BOOST_TEST_EQ(S("a+b%20c").decode(opt), "a b c");
+        }
+
+        // escapes at every offset of
+        // inputs longer than a block
+        for(std::size_t n : { 15, 16, 17, 31, 32, 33, 70 })
+        {
+            for(std::size_t i = 0; i + 3 <= n; ++i)
+            {
+                std::string e(n - 3, 'x');
+                std::string d = e;
+                e.insert(i, "%2b");
+                d.insert(i, "+");
+                S s(e);
+                BOOST_TEST_EQ(s.decoded_size(), n - 2);
+                BOOST_TEST_EQ(s.decode(), d);
+
+                std::string p(n, 'y');
+                p[i] = '+';
+                encoding_opts opt;
+                opt.space_as_plus = true;
+                std::string pd = p;
+                pd[i] = ' ';
+                BOOST_TEST_EQ(S(p).decode(opt), pd);
+                BOOST_TEST_EQ(S(p).decode(), p);
+            }
+        }
+
+        // many escapes
+        {
+            std::string e;
+            std::string d;
+            for(int i = 0; i < 40; ++i)
+            {
+                e += "ab%41%42cdefghijklmnop%2f";
+                d += "abABcdefghijklmnop/";
+            }
+            S s(e);
+            BOOST_TEST_EQ(s.decoded_size(), d.size());
+            BOOST_TEST_EQ(s.decode(), d);
+        }
+
+        // span_token
+        {
+            char buf[64];
+            core::string_view r = S("Program%20Files").decode(
+                {}, string_token::span_token(buf));
+            BOOST_TEST_EQ(r, "Program Files");
+            BOOST_TEST(r.data() == &buf[0]);
+
+            // exactly decoded_size()
+            r = S("%41%42").decode(
+                {}, string_token::span_token(buf, 2));
+            BOOST_TEST_EQ(r, "AB");
+
+            BOOST_TEST_THROWS(S("%41%42").decode(
+                {}, string_token::span_token(buf, 1)),
+                system::system_error);
+        }
+    }
+
     void
     run()
     {
         testSpecial();
         testRelation();
+        testDecode();
     }
 };
 
@@ -0,0 +1,368 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/public_suffix_list.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct public_suffix_list_test
+{
+    // A subset of public_suffix_list.dat
+    // matching the official test vectors
+    static
+    core::string_view
+    rules() noexcept
+    {
+        return
+            "// ===BEGIN ICANN DOMAINS===\n"
+            "\n"
+            "// biz : https://en.wikipedia.org/wiki/.biz\n"
+            "biz\n"
+            "\n"
+            "com\n"
+            "\n"
+            "// ck : https://en.wikipedia.org/wiki/.ck\n"
+            "*.ck\n"
+            "!www.ck\n"
+            "\n"
+            "// cn : https://en.wikipedia.org/wiki/.cn\n"
+            "cn\n"
+            "com.cn\n"
+            "\xe5\x85\xac\xe5\x8f\xb8.cn\n"
+            "\xe4\xb8\xad\xe5\x9b\xbd\n"
+            "\n"
+            "jp\n"
+            "ac.jp\n"
+            "kyoto.jp\n"
+            "ide.kyoto.jp\n"
+            "*.kobe.jp\n"
+            "!city.kobe.jp\n"
+            "\n"
+            "uk\n"
+            "co.uk\n"
+            "\n"
+            "us\n"
+            "ak.us\n"
+            "k12.ak.us\n"
+            "\n"
+            "// ===END ICANN DOMAINS===\n";
+    }
+
+    // checkPublicSuffix from the official
+    // test vectors, where "" means null
+    static
+    void
+    check(
+        public_suffix_list const& psl,
+        core::string_view host,
+        core::string_view domain)
+    {
+        BOOST_TEST_EQ(
+            psl.registrable_domain(host), domain);
+    }
+
+    void
+    testSpecial()
+    {
+        // public_suffix_list()
+        {
+            public_suffix_list psl;
+            BOOST_TEST(psl.empty());
+            BOOST_TEST_EQ(psl.size(), 0u);
+            BOOST_TEST_EQ(psl.public_suffix(
+                "www.example.com"), "com");
+            BOOST_TEST_EQ(psl.registrable_domain(
+                "www.example.com"), "example.com");
+            BOOST_TEST_EQ(psl.public_suffix("com"), "com");
+            BOOST_TEST_EQ(psl.registrable_domain("com"), "");
+            BOOST_TEST_EQ(psl.public_suffix(""), "");
+        }
+
+        // public_suffix_list(core::string_view)
+        {
+            public_suffix_list psl(rules());
+            BOOST_TEST(! psl.empty());
+            BOOST_TEST_EQ(psl.size(), 19u);
+        }
+        {
+            public_suffix_list psl("");
+            BOOST_TEST(psl.empty());
+        }
+        {
+            public_suffix_list psl(
+                "// only comments\n"
+                "\n"
+                "// and empty lines\n");
+            BOOST_TEST(psl.empty());
+        }
+    }
+
+    void
+    testParse()
+    {
+        // a rule ends at the first whitespace
+        {
+            public_suffix_list psl(
+                "co.uk extra text\r\n"
+                "uk\r\n"
+                "gov.uk\t// comment\r\n");
+            BOOST_TEST_EQ(psl.size(), 3u);
+            BOOST_TEST_EQ(psl.public_suffix(
+                "www.example.co.uk"), "co.uk");
+            BOOST_TEST_EQ(psl.public_suffix(
+                "www.example.gov.uk"), "gov.uk");
+            BOOST_TEST_EQ(psl.public_suffix(
+                "text"), "text");
+        }
+
+        // no newline at the end
+        {
+            public_suffix_list psl("com\nco.uk");
+            BOOST_TEST_EQ(psl.size(), 2u);
+            BOOST_TEST_EQ(psl.registrable_domain(
+                "a.b.co.uk"), "b.co.uk");
+        }
+
+        // rules are case-insensitive
+        {
+            public_suffix_list psl("CO.UK");
+            BOOST_TEST_EQ(psl.public_suffix(
+                "example.co.uk"), "co.uk");
+        }
+
+        // the implicit "*" rule
+        {
+            public_suffix_list psl("*");
+            BOOST_TEST_EQ(psl.size(), 1u);
+            BOOST_TEST_EQ(psl.public_suffix(
+                "example.test"), "test");
+        }
+
+        // shared labels
+        {
+            public_suffix_list psl(
+                "a.b.c\n"
+                "b.c\n"
+                "x.b.c\n"
+                "a.b.c\n");
+            BOOST_TEST_EQ(psl.size(), 4u);
+            BOOST_TEST_EQ(psl.public_suffix("y.a.b.c"), "a.b.c");
+            BOOST_TEST_EQ(psl.public_suffix("y.x.b.c"), "x.b.c");
+            BOOST_TEST_EQ(psl.public_suffix("y.z.b.c"), "b.c");
+            BOOST_TEST_EQ(psl.public_suffix("c"), "c");
+            BOOST_TEST_EQ(psl.public_suffix("b.c.d"), "d");
+        }
+    }
+
+    void
+    testVectors()
+    {
+        public_suffix_list psl(rules());
+
+        // null input
+        check(psl, "", "");
+        // mixed case
+        check(psl, "COM", "");
+        check(psl, "example.COM", "example.COM");
+        check(psl, "WwW.example.COM", "example.COM");
+        // leading dot
+        check(psl, ".com", "");
+        check(psl, ".example", "");
+        // unlisted TLD
+        check(psl, "example", "");
+        check(psl, "example.example", "example.example");
+        check(psl, "b.example.example", "example.example");
+        check(psl, "a.b.example.example", "example.example");
+        // TLD with only one rule
+        check(psl, "biz", "");
+        check(psl, "domain.biz", "domain.biz");
+        check(psl, "b.domain.biz", "domain.biz");
+        check(psl, "a.b.domain.biz", "domain.biz");
+        // TLD with some two-level rules
+        check(psl, "com", "");
+        check(psl, "example.com", "example.com");
+        check(psl, "b.example.com", "example.com");
+        check(psl, "a.b.example.com", "example.com");
+        // more complex TLD
+        check(psl, "jp", "");
+        check(psl, "test.jp", "test.jp");
+        check(psl, "www.test.jp", "test.jp");
+        check(psl, "ac.jp", "");
+        check(psl, "test.ac.jp", "test.ac.jp");
+        check(psl, "www.test.ac.jp", "test.ac.jp");
+        check(psl, "kyoto.jp", "");
+        check(psl, "test.kyoto.jp", "test.kyoto.jp");
+        check(psl, "ide.kyoto.jp", "");
+        check(psl, "b.ide.kyoto.jp", "b.ide.kyoto.jp");
+        check(psl, "a.b.ide.kyoto.jp", "b.ide.kyoto.jp");
+        check(psl, "c.kobe.jp", "");
+        check(psl, "b.c.kobe.jp", "b.c.kobe.jp");
+        check(psl, "a.b.c.kobe.jp", "b.c.kobe.jp");
+        check(psl, "city.kobe.jp", "city.kobe.jp");
+        check(psl, "www.city.kobe.jp", "city.kobe.jp");
+        // TLD with a wildcard rule and exceptions
+        check(psl, "ck", "");
+        check(psl, "test.ck", "");
+        check(psl, "b.test.ck", "b.test.ck");
+        check(psl, "a.b.test.ck", "b.test.ck");
+        check(psl, "www.ck", "www.ck");
+        check(psl, "www.www.ck", "www.ck");
+        // US K12
+        check(psl, "us", "");
+        check(psl, "test.us", "test.us");
+        check(psl, "www.test.us", "test.us");
+        check(psl, "ak.us", "");
+        check(psl, "test.ak.us", "test.ak.us");
+        check(psl, "www.test.ak.us", "test.ak.us");
+        check(psl, "k12.ak.us", "");
+        check(psl, "test.k12.ak.us", "test.k12.ak.us");
+        check(psl, "www.test.k12.ak.us", "test.k12.ak.us");
+        // IDN labels
+        check(psl,
+            "\xe9\xa3\x9f\xe7\x8b\xae.com.cn",
+            "\xe9\xa3\x9f\xe7\x8b\xae.com.cn");
+        check(psl,
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe5\x85\xac\xe5\x8f\xb8.cn",
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe5\x85\xac\xe5\x8f\xb8.cn");
+        check(psl,
+            "www.\xe9\xa3\x9f\xe7\x8b\xae.\xe5\x85\xac\xe5\x8f\xb8.cn",
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe5\x85\xac\xe5\x8f\xb8.cn");
+        check(psl, "shishi.\xe5\x85\xac\xe5\x8f\xb8.cn",
+            "shishi.\xe5\x85\xac\xe5\x8f\xb8.cn");
+        check(psl, "\xe5\x85\xac\xe5\x8f\xb8.cn", "");
+        check(psl,
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe4\xb8\xad\xe5\x9b\xbd",
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe4\xb8\xad\xe5\x9b\xbd");
+        check(psl,
+            "www.\xe9\xa3\x9f\xe7\x8b\xae.\xe4\xb8\xad\xe5\x9b\xbd",
+            "\xe9\xa3\x9f\xe7\x8b\xae.\xe4\xb8\xad\xe5\x9b\xbd");
+        check(psl, "shishi.\xe4\xb8\xad\xe5\x9b\xbd",
+            "shishi.\xe4\xb8\xad\xe5\x9b\xbd");
+        check(psl, "\xe4\xb8\xad\xe5\x9b\xbd", "");
+    }
+
+    void
+    testEncoded()
+    {
+        public_suffix_list psl(rules());
+
+        // labels are percent-decoded
+        check(psl, "example.%63om", "example.%63om");
+        check(psl, "example.%43%4F%4D", "example.%43%4F%4D");
+        check(psl, "%63om", "");
+        check(psl,
+            "www.shishi.%E5%85%AC%E5%8F%B8.cn",
+            "shishi.%E5%85%AC%E5%8F%B8.cn");
+        check(psl, "%E5%85%AC%E5%8F%B8.cn", "");
+        check(psl, "www.%e5%85%ac%e5%8f%b8.cn",
+            "www.%e5%85%ac%e5%8f%b8.cn");
+
+        // an encoded dot does not split labels
+        check(psl, "a.example%2Ecom", "a.example%2Ecom");
+        BOOST_TEST_EQ(psl.public_suffix(
+            "a.example%2Ecom"), "example%2Ecom");
+
+        // punycode is not converted
+        BOOST_TEST_EQ(psl.public_suffix(
+            "www.xn--55qx5d.cn"), "cn");
+    }
+
+    void
+    testTrailingDot()
+    {
+        public_suffix_list psl(rules());
+
+        BOOST_TEST_EQ(psl.public_suffix("com."), "com.");
+        BOOST_TEST_EQ(psl.public_suffix(
+            "www.example.co.uk."), "co.uk.");
+        BOOST_TEST_EQ(psl.registrable_domain(
+            "www.example.co.uk."), "example.co.uk.");
+        BOOST_TEST_EQ(psl.registrable_domain("co.uk."), "");
+        BOOST_TEST_EQ(psl.public_suffix("."), "");
+        BOOST_TEST_EQ(psl.registrable_domain("."), "");
+
+        // empty labels
+        BOOST_TEST_EQ(psl.registrable_domain(
+            "a..com"), "");
+        BOOST_TEST_EQ(psl.registrable_domain(
+            "a..example.com"), "example.com");
+    }
+
+    void
+    testUrl()
+    {
+        public_suffix_list psl(rules());
+
+        url_view u("https://www.Example.co.uk:8080/path");
+        BOOST_TEST_EQ(psl.public_suffix(
+            u.encoded_host()), "co.uk");
+        BOOST_TEST_EQ(psl.registrable_domain(
+            u.encoded_host()), "Example.co.uk");
+    }
+
+    void
+    testManyRules()
+    {
+        // every rule is found through
+        // the same hash table
+        std::string s;
+        for(int i = 0; i < 2000; ++i)
+        {
+            s += "s" + std::to_string(i) + ".com\n";
+            s += "*.w" + std::to_string(i) + ".net\n";
+            s += "!x.w" + std::to_string(i) + ".net\n";
+        }
+        public_suffix_list psl(s);
+        BOOST_TEST_EQ(psl.size(), 6000u);
+        for(int i = 0; i < 2000; ++i)
+        {
+            auto const n = std::to_string(i);
+            BOOST_TEST_EQ(
+                psl.registrable_domain(
+                    "a.b.s" + n + ".com"),
+                "b.s" + n + ".com");
+            BOOST_TEST_EQ(
+                psl.registrable_domain(
+                    "a.b.w" + n + ".net"),
+                "a.b.w" + n + ".net");
+            BOOST_TEST_EQ(
+                psl.registrable_domain(
+                    "a.x.w" + n + ".net"),
+                "x.w" + n + ".net");
+        }
+        BOOST_TEST_EQ(psl.registrable_domain(
+            "a.b.s2000.com"), "s2000.com");
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testParse();
+        testVectors();
+        testEncoded();
+        testTrailingDot();
+        testUrl();
+        testManyRules();
+    }
+};
+
+TEST_SUITE(
+    public_suffix_list_test,
+    "boost.url.public_suffix_list");
+
+} // urls
+} // boost
@@ -0,0 +1,231 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/public_suffix_list_view.hpp>
+
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/system/system_error.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct public_suffix_list_view_test
+{
+    static
+    core::string_view
+    rules() noexcept
+    {
+        return
+            "com\n"
+            "*.ck\n"
+            "!www.ck\n"
+            "jp\n"
+            "ac.jp\n"
+            "*.kobe.jp\n"
+            "!city.kobe.jp\n"
+            "uk\n"
+            "co.uk\n";
+    }
+
+    static
+    void
+    check(public_suffix_list_view v)
+    {
+        BOOST_TEST_EQ(v.size(), 9u);
+        BOOST_TEST(! v.empty());
+        BOOST_TEST_EQ(v.registrable_domain(
+            "www.example.com"), "example.com");
+        BOOST_TEST_EQ(v.registrable_domain(
+            "www.example.co.uk"), "example.co.uk");
+        BOOST_TEST_EQ(v.public_suffix(
+            "a.b.c.kobe.jp"), "c.kobe.jp");
+        BOOST_TEST_EQ(v.registrable_domain(
+            "www.city.kobe.jp"), "city.kobe.jp");
+        BOOST_TEST_EQ(v.registrable_domain(
+            "test.ck"), "");
+        BOOST_TEST_EQ(v.registrable_domain(
+            "www.www.ck"), "www.ck");
+        BOOST_TEST_EQ(v.public_suffix(
+            "example.test"), "test");
+    }
+
+    void
+    testSpecial()
+    {
+        // public_suffix_list_view()
+        {
+            public_suffix_list_view v;
+            BOOST_TEST(v.empty());
+            BOOST_TEST_EQ(v.size(), 0u);
+            BOOST_TEST_EQ(v.public_suffix(
+                "www.example.com"), "com");
+            BOOST_TEST_EQ(v.registrable_domain(
+                "www.example.com"), "example.com");
+
+            // the image of an empty list
+            public_suffix_list_view v2(v.data());
+            BOOST_TEST(v2.empty());
+            BOOST_TEST_EQ(v2.data(), v.data());
+        }
+
+        // public_suffix_list_view(core::string_view)
+        {
+            public_suffix_list psl(rules());
+            public_suffix_list_view v(psl.data());
+            BOOST_TEST_EQ(v.data().data(), psl.data().data());
+            BOOST_TEST_EQ(v.data().size(), psl.data().size());
+            check(v);
+        }
+
+        // operator public_suffix_list_view
+        {
+            public_suffix_list psl(rules());
+            public_suffix_list_view v = psl;
+            check(v);
+        }
+        {
+            public_suffix_list psl;
+            public_suffix_list_view v = psl;
+            BOOST_TEST(v.empty());
+            BOOST_TEST_NO_THROW(
+                public_suffix_list_view(psl.data()));
+        }
+    }
+
+    void
+    testImage()
+    {
+        // the image does not refer
+        // to the list it came from
+        std::string image;
+        {
+            public_suffix_list psl(rules());
+            image = std::string(psl.data());
+        }
+        check(public_suffix_list_view(image));
+
+        // unaligned images
+        std::string shifted = "x" + image;
+        check(public_suffix_list_view(
+            core::string_view(shifted).substr(1)));
+
+        // same image for the same rules
+        BOOST_TEST_EQ(
+            public_suffix_list(rules()).data(),
+            image);
+
+        // an empty rule set
+        {
+            public_suffix_list psl("// none\n");
+            public_suffix_list_view v(psl.data());
+            BOOST_TEST(v.empty());
+            BOOST_TEST_EQ(v.public_suffix("a.b"), "b");
+        }
+    }
+
+    void
+    testInvalid()
+    {
+        using E = system::system_error;
+        std::string const image(
+            public_suffix_list(rules()).data());
+
+        BOOST_TEST_THROWS(
+            public_suffix_list_view(""), E);
+        BOOST_TEST_THROWS(
+            public_suffix_list_view(
+                core::string_view(image).substr(0, 23)), E);
+
+        // signature
+        {
+            auto s = image;
+            s[1] = 'X';
+            BOOST_TEST_THROWS(
+                public_suffix_list_view(s), E);
+        }
+
+        // version
+        {
+            auto s = image;
+            s[4] = 2;
+            BOOST_TEST_THROWS(
+                public_suffix_list_view(s), E);
+        }
+
+        // size
+        {
+            BOOST_TEST_THROWS(
+                public_suffix_list_view(
+                    image + "x"), E);
+            BOOST_TEST_THROWS(
+                public_suffix_list_view(
+                    core::string_view(image).substr(
+                        0, image.size() - 1)), E);
+        }
+
+        // number of slots
+        {
+            auto s = image;
+            s[16] = 3;
+            BOOST_TEST_THROWS(
+                public_suffix_list_view(s), E);
+        }
+    }
+
+    void
+    testDamaged()
+    {
+        // lookups stay inside the image
+        // when its contents are wrong
+        std::string const image(
+            public_suffix_list(rules()).data());
+        for(std::size_t i = 24; i < image.size(); ++i)
+        {
+            for(char c : { '\x00', '\x7f', '\xff' })
+            {
+                auto s = image;
+                s[i] = c;
+                public_suffix_list_view v(s);
+                v.registrable_domain("www.example.com");
+                v.registrable_domain("a.b.c.kobe.jp");
+                v.registrable_domain("www.city.kobe.jp");
+            }
+        }
+
+        // a full table
+        {
+            auto s = image;
+            for(std::size_t i = 24;
+                i < 24 + 16 * 32; i += 16)
+                s[i + 4] = 1;
+            public_suffix_list_view v(s);
+            v.registrable_domain("www.example.test");
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testImage();
+        testInvalid();
+        testDamaged();
+    }
+};
+
+TEST_SUITE(
+    public_suffix_list_view_test,
+    "boost.url.public_suffix_list_view");
+
+} // urls
+} // boost
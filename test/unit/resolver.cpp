@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/resolver.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct resolver_test
+{
+    // the result and its parts are
+    // the same as with url_base::resolve
+    static
+    void
+    check(
+        core::string_view b,
+        core::string_view r)
+    {
+        url_view const ub(b);
+        url_view const ur =
+            parse_uri_reference(r).value();
+        url u0(ub);
+        BOOST_TEST(u0.resolve(ur).has_value());
+
+        resolver const res(ub);
+        url u1("z://y:x@p.q:69/x/f?q#f");
+        res.resolve(ur, u1);
+        BOOST_TEST_EQ(u1.buffer(), u0.buffer());
+        BOOST_TEST_EQ(u1.scheme_id(), u0.scheme_id());
+        BOOST_TEST_EQ(u1.host_type(), u0.host_type());
+        BOOST_TEST_EQ(u1.encoded_host(), u0.encoded_host());
+        BOOST_TEST_EQ(u1.port_number(), u0.port_number());
+        BOOST_TEST_EQ(u1.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u1.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u1.encoded_fragment(), u0.encoded_fragment());
+        BOOST_TEST_EQ(u1.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u1.params().size(), u0.params().size());
+        BOOST_TEST_EQ(u1.encoded_path().decoded_size(),
+            u0.encoded_path().decoded_size());
+        BOOST_TEST_EQ(u1.encoded_query().decoded_size(),
+            u0.encoded_query().decoded_size());
+        BOOST_TEST_EQ(u1.encoded_fragment().decoded_size(),
+            u0.encoded_fragment().decoded_size());
+        BOOST_TEST_EQ(u1.encoded_user().decoded_size(),
+            u0.encoded_user().decoded_size());
+
+        // the returned url
+        BOOST_TEST_EQ(res.resolve(ur).buffer(), u0.buffer());
+
+        // a container with fixed capacity
+        static_url<256> u2;
+        res.resolve(ur, u2);
+        BOOST_TEST_EQ(u2.buffer(), u0.buffer());
+    }
+
+    void
+    testResolve()
+    {
+        char const* const bases[] = {
+            "http://a/b/c/d;p?q",
+            "http://a/b/c/d;p?q#f",
+            "http://a",
+            "http://a/",
+            "http://u:p@[::1]:8080/b/c?k=v&k2#f",
+            "https://127.0.0.1/a%20b/./c/../d?%61",
+            "scheme:a/b/c",
+            "scheme:/a/b/c/",
+            "file:///etc/hosts",
+            "mailto:user@example.com",
+        };
+        char const* const refs[] = {
+            "g:h", "HTTP://X/Y", "http:g", "http://g/a/../a",
+            "//g", "//g?q#f", "//g/a/../a", "//u@g:80",
+            "//[v1.x]/%7Ea", "//127.0.0.1:1/",
+            "/g", "/./g", "/./g?q#f", "/../g", "/a%2fb/%41",
+            "/a/b?x=1&y=2#z", "/.//g",
+            "", "?y", "#s", "?y#s", "?", "#", "?a=1&b=2&c",
+            "g", "./g", "g/", "g?y", "g#s", "g?y#s",
+            ";x", "g;x", "g;x?y#s", ".", "./", "..",
+            "%2E%2E", "../", "../g", "../..", "../../",
+            "../../g", "../../../g", "g.", ".g", "g..",
+            "..g", "./../g", "./g/.", "g/./h", "g/../h",
+            "g;x=1/./y", "g;x=1/../y", "g?y/./x", "g#s/../x",
+            "a:b/c", "./a:b",
+        };
+        for(auto b : bases)
+            for(auto r : refs)
+                check(b, r);
+    }
+
+    void
+    testAlias()
+    {
+        resolver const res(url_view(
+            "http://www.example.com/docs/index.htm"));
+
+        // ref is dest
+        url u("/images/logo.png");
+        res.resolve(u, u);
+        BOOST_TEST_EQ(u.buffer(),
+            "http://www.example.com/images/logo.png");
+
+        // ref references dest
+        u = url("?q=1#top");
+        res.resolve(url_view(u), u);
+        BOOST_TEST_EQ(u.buffer(),
+            "http://www.example.com/docs/index.htm?q=1#top");
+    }
+
+    void
+    testNotABase()
+    {
+        BOOST_TEST_THROWS(
+            resolver(url_view("/path/to/file.txt")),
+            system::system_error);
+    }
+
+    void
+    testJavadocs()
+    {
+        // {class}
+        {
+    resolver r( url_view( "http://www.example.com/docs/index.htm?lang=en" ) );
+    url dest;
+
+    r.resolve( url_view( "/images/logo.png" ), dest );
+    assert( dest.buffer() == "http://www.example.com/images/logo.png" );
+
+    r.resolve( url_view( "#top" ), dest );
+    assert( dest.buffer() == "http://www.example.com/docs/index.htm?lang=en#top" );
+
+    r.resolve( url_view( "guide.htm" ), dest );
+    assert( dest.buffer() == "http://www.example.com/docs/guide.htm" );
+        }
+    }
+
+    void
+    run()
+    {
+        testResolve();
+        testAlias();
+        testNotABase();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    resolver_test,
+    "boost.url.resolver");
+
+} // urls
+} // boost
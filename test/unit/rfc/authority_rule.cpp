@@ -14,6 +14,7 @@
 
 #include "test_rule.hpp"
 
+#include <cstdint>
 #include <type_traits>
 
 namespace boost {
@@ -22,9 +23,96 @@ namespace urls {
 class authority_rule_test
 {
 public:
+    static
+    void
+    check(
+        core::string_view s,
+        host_type ht,
+        core::string_view host,
+        core::string_view port = {},
+        std::uint16_t pn = 0,
+        core::string_view userinfo = {})
+    {
+        auto rv = grammar::parse(
+            s, authority_rule);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        authority_view const a = *rv;
+        BOOST_TEST_EQ(a.buffer(), s);
+        BOOST_TEST(a.host_type() == ht);
+        BOOST_TEST_EQ(a.encoded_host_address(), host);
+        BOOST_TEST_EQ(a.has_port(), port.data() != nullptr);
+        BOOST_TEST_EQ(a.port(), port);
+        BOOST_TEST_EQ(a.port_number(), pn);
+        BOOST_TEST_EQ(a.has_userinfo(), userinfo.data() != nullptr);
+        BOOST_TEST_EQ(a.encoded_userinfo(), userinfo);
+    }
+
+    void
+    testHostAndPort()
+    {
+        using ht = host_type;
+
+        check("", ht::name, "");
+        check(":", ht::name, "", "");
+        check(":80", ht::name, "", "80", 80);
+        check("example.com", ht::name, "example.com");
+        check("www.example.com:443", ht::name, "www.example.com", "443", 443);
+        check("localhost:0", ht::name, "localhost", "0", 0);
+        check("localhost:0080", ht::name, "localhost", "0080", 80);
+        check("localhost:65535", ht::name, "localhost", "65535", 65535);
+        check("localhost:65536", ht::name, "localhost", "65536", 0);
+        check("localhost:12345678", ht::name, "localhost", "12345678", 0);
+        check("a-b_c~d!$&'()*+,;=", ht::name, "a-b_c~d!$&'()*+,;=");
+        check("a%41b:1", ht::name, "a%41b", "1", 1);
+
+        check("127.0.0.1", ht::ipv4, "127.0.0.1");
+        check("127.0.0.1:8080", ht::ipv4, "127.0.0.1", "8080", 8080);
+        check("255.255.255.255", ht::ipv4, "255.255.255.255");
+        check("1.2.3.4.5", ht::name, "1.2.3.4.5");
+        check("1.2.3.04", ht::name, "1.2.3.04");
+        check("1.2.3.256", ht::name, "1.2.3.256");
+        check("1.2.3.4a:1", ht::name, "1.2.3.4a", "1", 1);
+        check("1.2.3", ht::name, "1.2.3");
+
+        check("[::1]", ht::ipv6, "::1");
+        check("[::1]:443", ht::ipv6, "::1", "443", 443);
+        check("[2001:db8::7]:", ht::ipv6, "2001:db8::7", "");
+        check("[::ffff:1.2.3.4]:1", ht::ipv6, "::ffff:1.2.3.4", "1", 1);
+        check("[v1.x]:2", ht::ipvfuture, "v1.x", "2", 2);
+
+        check("u@h", ht::name, "h", {}, 0, "u");
+        check("u:p@h:1", ht::name, "h", "1", 1, "u:p");
+        check("h:1@x", ht::name, "x", {}, 0, "h:1");
+        check("1.2.3.4@[::1]", ht::ipv6, "::1", {}, 0, "1.2.3.4");
+
+        auto const& r = authority_rule;
+        bad(r, "[::1");
+        bad(r, "[]");
+        bad(r, "[::1]x");
+        bad(r, "[::1]:80@x");
+        bad(r, "host:1:2");
+        bad(r, "host:80a");
+        bad(r, "a%4");
+
+        // the rule stops at the
+        // end of the authority
+        {
+            core::string_view s = "example.com:80/index.htm";
+            char const* it = s.data();
+            auto rv = authority_rule.parse(
+                it, s.data() + s.size());
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(it, s.data() + 14);
+            BOOST_TEST_EQ(rv->port_number(), 80);
+        }
+    }
+
     void
     run()
     {
+        testHostAndPort();
+
         // javadoc
         {
             system::result< authority_view > rv = grammar::parse( "user:pass@example.com:8080", authority_rule );
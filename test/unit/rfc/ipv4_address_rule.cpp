@@ -10,16 +10,137 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 
+#include <boost/url/grammar/dec_octet_rule.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
 #include "test_rule.hpp"
 
+#include <cstdint>
+#include <string>
+
 namespace boost {
 namespace urls {
 
 struct ipv4_address_rule_test
 {
+    // parse s with the rule and with the
+    // octet rules, which were used before
+    // the fast path, and compare
+    static
+    void
+    check(core::string_view s)
+    {
+        char const* it0 = s.data();
+        char const* const end = it0 + s.size();
+        auto rv0 = ipv4_address_rule.parse(it0, end);
+
+        using namespace grammar;
+        char const* it1 = s.data();
+        auto rv1 = grammar::parse(
+            it1, end, tuple_rule(
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule));
+        if(! BOOST_TEST_EQ(
+            rv0.has_value(), rv1.has_value()))
+        {
+            test_suite::log << s << "\n";
+            return;
+        }
+        if(rv0.has_error())
+        {
+            BOOST_TEST_EQ(rv0.error(), rv1.error());
+            return;
+        }
+        BOOST_TEST_EQ(it0 - s.data(), it1 - s.data());
+        ipv4_address::bytes_type const b = {{
+            std::get<0>(*rv1), std::get<1>(*rv1),
+            std::get<2>(*rv1), std::get<3>(*rv1) }};
+        BOOST_TEST(*rv0 == ipv4_address(b));
+    }
+
+    void
+    testParse()
+    {
+        ok(ipv4_address_rule, "0.0.0.0");
+        ok(ipv4_address_rule, "1.2.3.4");
+        ok(ipv4_address_rule, "255.255.255.255");
+        ok(ipv4_address_rule, "192.168.100.200");
+        bad(ipv4_address_rule, "");
+        bad(ipv4_address_rule, "1.2.3");
+        bad(ipv4_address_rule, "1.2.3.");
+        bad(ipv4_address_rule, "1.2.3.4.");
+        bad(ipv4_address_rule, "01.2.3.4");
+        bad(ipv4_address_rule, "1.2.3.04");
+        bad(ipv4_address_rule, "256.2.3.4");
+        bad(ipv4_address_rule, "1.2.3.256");
+        bad(ipv4_address_rule, "1.2.3.1000");
+        bad(ipv4_address_rule, "1..2.3.4");
+        bad(ipv4_address_rule, "0x1.2.3.4");
+        bad(ipv4_address_rule, "1.2.3.4x");
+    }
+
+    void
+    testFastPath()
+    {
+        // the fast path handles up to 16
+        // bytes at once, so each address is
+        // followed by inputs long enough to
+        // take it, and by short ones
+        char const* const octets[] = {
+            "0", "1", "9", "00", "01", "10", "99",
+            "000", "001", "010", "100", "199",
+            "249", "250", "255", "256", "299",
+            "999", "1000", "", "x" };
+        char const* const tails[] = {
+            "", ".", "/", ":80", "/path/to/resource",
+            ".5", "0", "1234567890123456",
+            "..........", "%2F" };
+        for(auto a : octets)
+        for(auto b : { "0", "10", "255", "01", "" })
+        for(auto c : { "1", "100", "256" })
+        for(auto d : octets)
+        for(auto t : tails)
+        {
+            std::string s = a;
+            s += '.';
+            s += b;
+            s += '.';
+            s += c;
+            s += '.';
+            s += d;
+            s += t;
+            check(s);
+        }
+
+        // random inputs of up to 20
+        // characters from a small set
+        char const cs[] = {
+            '0', '1', '2', '5', '9', '.', '/' };
+        std::uint32_t x = 1;
+        auto next = [&x]
+        {
+            x = x * 1664525 + 1013904223;
+            return x >> 8;
+        };
+        std::string s;
+        for(int k = 0; k < 100000; ++k)
+        {
+            s.clear();
+            auto const n = next() % 21;
+            for(std::uint32_t i = 0; i < n; ++i)
+                s.push_back(cs[next() % sizeof(cs)]);
+            check(s);
+        }
+    }
+
     void
     run()
     {
+        testParse();
+        testFastPath();
+
         // javadoc
         {
             system::result< ipv4_address > rv = grammar::parse( "192.168.0.1", ipv4_address_rule );
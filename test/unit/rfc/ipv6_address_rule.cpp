@@ -12,14 +12,151 @@
 
 #include "test_rule.hpp"
 
+#include <cstdint>
+#include <string>
+
 namespace boost {
 namespace urls {
 
 struct ipv6_address_rule_test
 {
+    // parse the address at the start of s
+    // and check its bytes and length
+    static
+    void
+    check(
+        core::string_view s,
+        std::size_t n,
+        ipv6_address::bytes_type const& b)
+    {
+        char const* it = s.data();
+        auto rv = ipv6_address_rule.parse(
+            it, s.data() + s.size());
+        if(! BOOST_TEST(rv.has_value()))
+        {
+            test_suite::log << s << "\n";
+            return;
+        }
+        BOOST_TEST_EQ(
+            static_cast<std::size_t>(
+                it - s.data()), n);
+        BOOST_TEST(rv->to_bytes() == b);
+    }
+
+    void
+    testParse()
+    {
+        ok(ipv6_address_rule, "::");
+        ok(ipv6_address_rule, "::1");
+        ok(ipv6_address_rule, "1::");
+        ok(ipv6_address_rule, "1:2:3:4:5:6:7:8");
+        ok(ipv6_address_rule, "1:2:3:4:5:6:7::");
+        ok(ipv6_address_rule, "::2:3:4:5:6:7:8");
+        ok(ipv6_address_rule, "ABCD:ef01::2345:6789");
+        ok(ipv6_address_rule, "::ffff:1.2.3.4");
+        ok(ipv6_address_rule, "1:2:3:4:5:6:1.2.3.4");
+        bad(ipv6_address_rule, "");
+        bad(ipv6_address_rule, ":");
+        bad(ipv6_address_rule, ":::");
+        bad(ipv6_address_rule, ":1::");
+        bad(ipv6_address_rule, "1::2::3");
+        bad(ipv6_address_rule, "1:2:3:4:5:6:7");
+        bad(ipv6_address_rule, "1:2:3:4:5:6:7:");
+        bad(ipv6_address_rule, "1:2:3:4:5:6:7:8:9");
+        bad(ipv6_address_rule, "1:2:3:4::5:6:7:8");
+        bad(ipv6_address_rule, "12345::");
+        bad(ipv6_address_rule, "::12345");
+        bad(ipv6_address_rule, "1::2:");
+        bad(ipv6_address_rule, "1::g");
+        bad(ipv6_address_rule, "::1.2.3");
+    }
+
+    void
+    testFastPath()
+    {
+        // random addresses in every form,
+        // with and without "::", followed
+        // by what may end a host
+        char const* const tails[] = {
+            "", "]", "]:80", "/", "%25eth0" };
+        std::uint32_t x = 1;
+        auto next = [&x]
+        {
+            x = x * 1664525 + 1013904223;
+            return x >> 8;
+        };
+        char const* const dig =
+            "0123456789abcdef";
+        for(int k = 0; k < 20000; ++k)
+        {
+            // groups are zero, short or long
+            unsigned short w[8];
+            for(auto& v : w)
+            {
+                auto const r = next();
+                v = static_cast<unsigned short>(
+                    (r % 3 == 0) ? 0 :
+                    (r % 3 == 1) ? (r >> 4) % 16 :
+                    (r >> 4) % 65536);
+            }
+            ipv6_address::bytes_type b;
+            for(int i = 0; i < 8; ++i)
+            {
+                b[2 * i] = static_cast<
+                    unsigned char>(w[i] >> 8);
+                b[2 * i + 1] = static_cast<
+                    unsigned char>(w[i]);
+            }
+
+            // "::" replaces the zero groups
+            // from i0 to i1, if any
+            int i0 = static_cast<int>(next() % 9);
+            int i1 = i0;
+            while(i1 < 8 && w[i1] == 0)
+                ++i1;
+            if(i0 == i1)
+                i0 = i1 = -1;
+            std::string s;
+            for(int i = 0; i < 8; ++i)
+            {
+                if(i == i0)
+                {
+                    s += "::";
+                    i = i1 - 1;
+                    continue;
+                }
+                if(! s.empty() && s.back() != ':')
+                    s += ':';
+                // optional leading zeros
+                unsigned v = w[i];
+                char h[4];
+                int n = 0;
+                do
+                {
+                    h[n++] = dig[v % 16];
+                    v /= 16;
+                }
+                while(v != 0);
+                int const z = static_cast<int>(
+                    next() % (5 - n));
+                s.append(z, '0');
+                while(n > 0)
+                    s += h[--n];
+            }
+            auto const n = s.size();
+            for(auto t : tails)
+                check(s + t, n, b);
+            BOOST_TEST(ipv6_address(b).to_string() ==
+                ipv6_address(s).to_string());
+        }
+    }
+
     void
     run()
     {
+        testParse();
+        testFastPath();
+
         // javadoc
         {
             system::result< ipv6_address > rv = grammar::parse( "2001:0db8:85a3:0000:0000:8a2e:0370:7334", ipv6_address_rule );
@@ -10,16 +10,123 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/origin_form_rule.hpp>
 
+#include <boost/url/parse.hpp>
 #include "test_rule.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 
 struct origin_form_rule_test
 {
+    // the parts are the same as
+    // those of a relative-ref
+    static
+    void
+    check(core::string_view s)
+    {
+        auto rv = grammar::parse(
+            s, origin_form_rule);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        url_view const u0 =
+            parse_relative_ref(s).value();
+        url_view const u1 = *rv;
+        BOOST_TEST_EQ(u1.buffer(), s);
+        BOOST_TEST(! u1.has_authority());
+        BOOST_TEST_EQ(u1.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u1.encoded_path().decoded_size(),
+            u0.encoded_path().decoded_size());
+        BOOST_TEST_EQ(u1.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u1.has_query(), u0.has_query());
+        BOOST_TEST_EQ(u1.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u1.encoded_query().decoded_size(),
+            u0.encoded_query().decoded_size());
+        BOOST_TEST_EQ(u1.params().size(), u0.params().size());
+    }
+
+    void
+    testParse()
+    {
+        check("/");
+        check("/?");
+        check("/index.htm");
+        check("/index.htm?layout=mobile");
+        check("/a/b/c/");
+        check("/a/./b/../c");
+        check("/a%20b/%2F?%61=%62&c");
+        check("/?&&&");
+        check("/?a=1&b=2&c=3");
+        check("/a?b?c/d");
+        check("/a?x=[1]&y=]");
+        check("/a:b@c!$&'()*+,;=-._~");
+
+        bad(origin_form_rule, "");
+        bad(origin_form_rule, "*");
+        bad(origin_form_rule, "index.htm");
+        bad(origin_form_rule, "http://example.com/");
+        bad(origin_form_rule, "/a b");
+        bad(origin_form_rule, "/a[b]");
+        bad(origin_form_rule, "/a#f");
+        bad(origin_form_rule, "/%");
+        bad(origin_form_rule, "/%2");
+        bad(origin_form_rule, "/%zz");
+        bad(origin_form_rule, "/?%");
+        bad(origin_form_rule, "/?a=%g0");
+        bad(origin_form_rule, "/?a\x80");
+
+        // the rule stops at the
+        // end of the origin-form
+        {
+            core::string_view s = "/a/b?c#d";
+            char const* it = s.data();
+            auto rv = origin_form_rule.parse(
+                it, s.data() + s.size());
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(it, s.data() + 6);
+            BOOST_TEST_EQ(rv->encoded_query(), "c");
+        }
+        {
+            core::string_view s = "/a/b c";
+            char const* it = s.data();
+            auto rv = origin_form_rule.parse(
+                it, s.data() + s.size());
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(it, s.data() + 4);
+            BOOST_TEST_EQ(rv->segments().size(), 2u);
+        }
+
+        // long values, with escapes and
+        // delimiters at every position
+        for(std::size_t i = 0; i < 40; ++i)
+        {
+            std::string s = "/";
+            s.append(i, 'a');
+            std::string const p = s;
+            // a relative-ref which starts
+            // with "//" has an authority
+            if(i > 0)
+            {
+                check(s + "/%41/" + std::string(40, 'b'));
+                check(p + std::string(40, '/') + "?&" + p);
+            }
+            check(s + "?" + std::string(40, 'q'));
+            check(s + "?q=%41&" + std::string(40, 'r') + "&s");
+            bad(origin_form_rule,
+                s + "/%4g" + std::string(40, 'b'));
+            bad(origin_form_rule,
+                s + "?" + std::string(40, 'q') + "%zz");
+            bad(origin_form_rule,
+                s + "/" + std::string(40, 'b') + "{");
+        }
+    }
+
     void
     run()
     {
+        testParse();
+
         // javadoc
         {
             system::result< url_view > rv = grammar::parse( "/index.htm?layout=mobile", origin_form_rule );
@@ -15,15 +15,93 @@
 
 #include "test_suite.hpp"
 
+#include <string>
+
 namespace boost {
 namespace urls {
 
 class pct_encoded_rule_test
 {
 public:
+    static
+    void
+    ok( core::string_view s,
+        std::size_t n)
+    {
+        auto rv = grammar::parse(
+            s, pct_encoded_rule(pchars));
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(rv->size(), s.size());
+        BOOST_TEST_EQ(rv->decoded_size(), n);
+    }
+
+    static
+    void
+    bad(core::string_view s)
+    {
+        BOOST_TEST(grammar::parse(
+            s, pct_encoded_rule(pchars)
+                ).has_error());
+    }
+
+    void
+    testLong()
+    {
+        // escapes at every position
+        // around a 32 character block
+        std::string const a(64, 'a');
+        for(std::size_t i = 0; i < 40; ++i)
+        {
+            std::string s = a;
+            s.replace(i, 3, "%2F");
+            ok(s, 62);
+            s.replace(i, 3, "%2f");
+            ok(s, 62);
+            s.replace(i, 3, "%2G");
+            bad(s);
+            s.replace(i, 3, "%%2");
+            bad(s);
+            s.replace(i, 3, "%/2");
+            bad(s);
+        }
+
+        // consecutive escapes
+        {
+            std::string s;
+            for(int i = 0; i < 30; ++i)
+                s += "%41";
+            ok(s, 30);
+            ok("x" + s, 31);
+            ok("xy" + s, 32);
+            bad(s + "%4");
+            bad(s + "%");
+            bad(s + "%4%41");
+        }
+
+        // stop at a character not in the set
+        {
+            std::string s(40, 'a');
+            s[33] = ' ';
+            auto rv = grammar::parse(
+                s, pct_encoded_rule(pchars));
+            BOOST_TEST(rv.has_error());
+            char const* it = s.data();
+            auto rv1 = pct_encoded_rule(
+                pchars).parse(it, s.data() + s.size());
+            BOOST_TEST(rv1.has_value());
+            BOOST_TEST_EQ(it, s.data() + 33);
+            s[33] = '%';
+            s[35] = '#';
+            bad(s);
+        }
+    }
+
     void
     run()
     {
+        testLong();
+
         // javadoc
         {
             system::result< pct_string_view > rv = grammar::parse( "Program%20Files", pct_encoded_rule( pchars ) );
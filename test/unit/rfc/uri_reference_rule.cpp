@@ -28,6 +28,35 @@ public:
             system::result< url_view > rv = grammar::parse( "ws://echo.example.com/?name=boost#demo", uri_reference_rule );
             (void)rv;
         }
+
+        // URI
+        ok(uri_reference_rule, "http://example.com");
+        ok(uri_reference_rule, "a:");
+        ok(uri_reference_rule, "a+b.c-d:/x");
+        ok(uri_reference_rule, "mailto:x@example.com");
+
+        // relative-ref
+        ok(uri_reference_rule, "");
+        ok(uri_reference_rule, "a");
+        ok(uri_reference_rule, "a/b:c");
+        ok(uri_reference_rule, "a?b:c");
+        ok(uri_reference_rule, "a#b:c");
+        ok(uri_reference_rule, "//example.com:80");
+        ok(uri_reference_rule, "/a:b");
+        ok(uri_reference_rule, "?q:1");
+
+        bad(uri_reference_rule, "a_b:c");
+        bad(uri_reference_rule, "http://[x");
+        bad(uri_reference_rule, "%");
+
+        {
+            auto rv = grammar::parse(
+                "http:x", uri_reference_rule);
+            BOOST_TEST(rv && rv->has_scheme());
+            rv = grammar::parse(
+                "x/http:", uri_reference_rule);
+            BOOST_TEST(rv && ! rv->has_scheme());
+        }
     }
 };
 
@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/robots_matcher.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct robots_matcher_test
+{
+    void
+    testEmpty()
+    {
+        robots_matcher m;
+        BOOST_TEST(m.empty());
+        BOOST_TEST(m.allowed(url_view("http://example.com/")));
+        BOOST_TEST(m.allowed("/x?y"));
+
+        // empty rules are ignored
+        m.disallow("");
+        m.allow("");
+        BOOST_TEST(m.empty());
+        BOOST_TEST(m.allowed("/"));
+    }
+
+    void
+    testPrefix()
+    {
+        robots_matcher m;
+        m.disallow("/private");
+        BOOST_TEST_EQ(m.size(), 1u);
+        BOOST_TEST(! m.allowed("/private"));
+        BOOST_TEST(! m.allowed("/private/a.html"));
+        BOOST_TEST(! m.allowed("/privateer"));
+        BOOST_TEST(m.allowed("/Private"));
+        BOOST_TEST(m.allowed("/priv"));
+        BOOST_TEST(m.allowed("/"));
+        BOOST_TEST(m.allowed(""));
+
+        m.disallow("/");
+        BOOST_TEST(! m.allowed(""));
+        BOOST_TEST(! m.allowed(url_view("http://example.com")));
+        BOOST_TEST(! m.allowed(url_view("http://example.com?q")));
+    }
+
+    void
+    testLongest()
+    {
+        // the longest rule wins
+        robots_matcher m;
+        m.disallow("/");
+        m.allow("/public");
+        m.disallow("/public/drafts");
+        BOOST_TEST(! m.allowed("/index.html"));
+        BOOST_TEST(m.allowed("/public/a"));
+        BOOST_TEST(! m.allowed("/public/drafts/a"));
+
+        // allow wins a tie
+        robots_matcher m2;
+        m2.disallow("/page");
+        m2.allow("/page");
+        BOOST_TEST(m2.allowed("/page"));
+        robots_matcher m3;
+        m3.allow("/page");
+        m3.disallow("/page");
+        BOOST_TEST(m3.allowed("/page"));
+        m3.disallow("/*age");
+        BOOST_TEST(m3.allowed("/page"));
+        m3.disallow("/p*ge/");
+        BOOST_TEST(! m3.allowed("/page/"));
+    }
+
+    void
+    testWildcards()
+    {
+        robots_matcher m;
+        m.disallow("/*.pdf$");
+        m.disallow("/*?sessionid=");
+        m.allow("/docs/*/public*");
+        m.disallow("/docs/");
+        BOOST_TEST(! m.allowed("/a/b.pdf"));
+        BOOST_TEST(m.allowed("/a/b.pdf?x=1"));
+        BOOST_TEST(m.allowed("/a/b.pdfx"));
+        BOOST_TEST(! m.allowed("/.pdf"));
+        BOOST_TEST(! m.allowed("/a?sessionid=1"));
+        BOOST_TEST(! m.allowed("/a/b/c?sessionid=1"));
+        BOOST_TEST(m.allowed("/a/b/c?x=1&sessionid=1"));
+        BOOST_TEST(! m.allowed("/docs/a"));
+        BOOST_TEST(m.allowed("/docs/a/public"));
+        BOOST_TEST(m.allowed("/docs/a/b/publication"));
+        BOOST_TEST(! m.allowed("/docs/public"));
+
+        // repeated wildcards
+        robots_matcher m2;
+        m2.disallow("/**a**b*$");
+        BOOST_TEST(! m2.allowed("/ab"));
+        BOOST_TEST(! m2.allowed("/xaybz"));
+        BOOST_TEST(m2.allowed("/ba"));
+
+        // a wildcard at the start
+        robots_matcher m3;
+        m3.disallow("*/tmp/");
+        BOOST_TEST(! m3.allowed("/a/tmp/b"));
+        BOOST_TEST(m3.allowed("/a/tmp"));
+
+        // "$" in the middle is plain
+        robots_matcher m4;
+        m4.disallow("/a$b");
+        BOOST_TEST(! m4.allowed("/a$bc"));
+        BOOST_TEST(m4.allowed("/a"));
+
+        // "$" alone matches nothing
+        robots_matcher m5;
+        m5.disallow("$");
+        BOOST_TEST(m5.allowed("/"));
+
+        // the end anchor
+        robots_matcher m6;
+        m6.disallow("/$");
+        m6.disallow("/a*$");
+        BOOST_TEST(! m6.allowed("/"));
+        BOOST_TEST(m6.allowed("/b"));
+        BOOST_TEST(! m6.allowed("/a"));
+        BOOST_TEST(! m6.allowed("/abc"));
+    }
+
+    void
+    testEncoding()
+    {
+        // rfc9309 2.2.2
+        robots_matcher m;
+        m.disallow("/foo/bar?baz=quz");
+        m.disallow("/foo/bar/\xe3\x83\x84");
+        m.disallow("/foo/bar/%E3%83%85");
+        m.disallow("/foo/bar/%62%61%7A");
+        BOOST_TEST(! m.allowed("/foo/bar?baz=quz"));
+        BOOST_TEST(! m.allowed("/foo/bar/%E3%83%84"));
+        BOOST_TEST(! m.allowed("/foo/bar/%e3%83%84"));
+        BOOST_TEST(! m.allowed("/foo/bar/%E3%83%85"));
+        BOOST_TEST(! m.allowed("/foo/bar/baz"));
+        BOOST_TEST(! m.allowed("/foo/bar/%62az"));
+        BOOST_TEST(m.allowed("/foo/bar/ba"));
+
+        // reserved characters are not
+        // the same as their escapes
+        robots_matcher m2;
+        m2.disallow("/a/b");
+        m2.disallow("/c%3F");
+        BOOST_TEST(! m2.allowed("/a/b"));
+        BOOST_TEST(m2.allowed("/a%2Fb"));
+        BOOST_TEST(! m2.allowed("/c%3f"));
+        BOOST_TEST(m2.allowed("/c?"));
+
+        // a space, and a lone '%'
+        robots_matcher m3;
+        m3.disallow("/a b");
+        m3.disallow("/100%");
+        BOOST_TEST(! m3.allowed("/a%20b"));
+        BOOST_TEST(! m3.allowed("/100%25"));
+        BOOST_TEST(m3.allowed("/100"));
+
+        // url_view
+        robots_matcher m4;
+        m4.disallow("/p~1?q");
+        BOOST_TEST(! m4.allowed(url_view("http://h/p%7E1?q=1#f")));
+        BOOST_TEST(m4.allowed(url_view("http://h/p%7E1#?q")));
+        BOOST_TEST(m4.allowed(url_view("http://h/p%7E1")));
+    }
+
+    void
+    testManyStates()
+    {
+        // more than 64 live states
+        robots_matcher m;
+        m.disallow("/*" + std::string(100, 'a') + "b");
+        std::string s = "/" + std::string(200, 'a');
+        BOOST_TEST(m.allowed(s));
+        BOOST_TEST(! m.allowed(s + "b"));
+        BOOST_TEST(! m.allowed(s + "bc"));
+
+        // many rules
+        robots_matcher m2;
+        for(int i = 0; i < 1000; ++i)
+        {
+            auto const k = std::to_string(i);
+            m2.disallow("/d" + k + "/");
+            m2.allow("/d" + k + "/*.html$");
+        }
+        BOOST_TEST_EQ(m2.size(), 2000u);
+        BOOST_TEST(! m2.allowed("/d123/a"));
+        BOOST_TEST(m2.allowed("/d123/a.html"));
+        BOOST_TEST(m2.allowed("/d1234/a"));
+        BOOST_TEST(m2.allowed("/d999"));
+    }
+
+    void
+    testJavadocs()
+    {
+        robots_matcher m;
+        m.disallow( "/private" );
+        m.allow( "/private/press*.html$" );
+        m.disallow( "*?sessionid=" );
+
+        assert( ! m.allowed( url_view( "https://example.com/private/x" ) ) );
+        assert( m.allowed( url_view( "https://example.com/private/press-2023.html" ) ) );
+        assert( ! m.allowed( url_view( "https://example.com/a?sessionid=1" ) ) );
+    }
+
+    void
+    run()
+    {
+        testEmpty();
+        testPrefix();
+        testLongest();
+        testWildcards();
+        testEncoding();
+        testManyStates();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    robots_matcher_test,
+    "boost.url.robots_matcher");
+
+} // urls
+} // boost
@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/route_literal.hpp>
+
+#include <boost/url/parse_path.hpp>
+#include <boost/url/router.hpp>
+#include <boost/static_assert.hpp>
+#include "test_suite.hpp"
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+namespace {
+
+constexpr route_literal lit0;
+constexpr route_literal lit1("/user/{id}/files/{path+}");
+constexpr route_literal lit2("a/{}/{0}/{x?}/%7B");
+constexpr route_literal lit3("a/{b}/../{c}");
+
+BOOST_STATIC_ASSERT(lit0.buffer().empty());
+BOOST_STATIC_ASSERT(lit0.fields() == 0);
+BOOST_STATIC_ASSERT(lit1.buffer().size() == 24);
+BOOST_STATIC_ASSERT(lit1.fields() == 2);
+BOOST_STATIC_ASSERT(lit2.fields() == 3);
+BOOST_STATIC_ASSERT(lit3.fields() == 2);
+
+} // (anon)
+#endif
+
+struct route_literal_test
+{
+    // route_literal agrees with
+    // router::insert
+    static
+    void
+    check(
+        core::string_view s,
+        std::size_t fields = 0)
+    {
+        bool ok0 = true;
+        route_literal lit;
+        try
+        {
+            lit = route_literal(s);
+        }
+        catch(system::system_error const&)
+        {
+            ok0 = false;
+        }
+        bool ok1 = true;
+        router<int> r;
+        try
+        {
+            r.insert(s, 0);
+        }
+        catch(system::system_error const&)
+        {
+            ok1 = false;
+        }
+        if(! BOOST_TEST_EQ(ok0, ok1))
+        {
+            test_suite::log << "\"" << s << "\"\n";
+            return;
+        }
+        if(! ok0)
+            return;
+        BOOST_TEST_EQ(lit.buffer(), s);
+        BOOST_TEST(lit.buffer().data() == s.data());
+        BOOST_TEST_EQ(lit.fields(), fields);
+    }
+
+    void
+    testParse()
+    {
+        // literals
+        check("");
+        check("/");
+        check("//");
+        check("user");
+        check("/user/view");
+        check("user//view/");
+        check("%75ser/%7B%7D");
+        check("a:b@c/!$&'()*+,;=-._~");
+        check("a b");
+        check("a?b");
+        check("a#b");
+        check("a}b");
+        check("a{b}");
+
+        // replacement fields
+        check("{}", 1);
+        check("/user/{id}", 1);
+        check("user/{name}/op/{op}", 2);
+        check("{_}/{a_1}/{A}", 3);
+        check("{0}/{10}/{123}", 3);
+        check("{x?}/{x*}/{x+}", 3);
+        check("{?}/{*}/{+}", 3);
+        check("{18446744073709551615}", 1);
+        check("{184467440737095516150}");
+        check("{01}");
+        check("{0a}");
+        check("{1x}");
+        check("{x??}");
+        check("{x?y}");
+        check("{x:y}");
+        check("{x-y}");
+        check("{x");
+        check("{");
+        check("}");
+        check("{x}y");
+        check("y{x}");
+        check("{{x}}");
+        check("{x}/", 1);
+        check("{x}//{y}", 2);
+
+        // dot segments
+        check(".");
+        check("./a");
+        check("a/..");
+        check("a/../b");
+        check("a/b/../c/..");
+        check("a/%2e%2E/b");
+        check("../a");
+        check("..");
+        check("a/../..");
+        check("../..");
+        check("../../a");
+        check("../../a/b");
+        check("user/c/../b");
+        check("../a/user/c/../b");
+        check("user/{name}/../{name}", 2);
+        check(".../a");
+        check("a/...");
+        check("{..}");
+
+        // malformed escapes are rejected
+        // without calling the router
+        BOOST_TEST_THROWS(
+            route_literal("%"),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            route_literal("a/%2"),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            route_literal("a/%zz"),
+            system::system_error);
+    }
+
+    void
+    testRouter()
+    {
+        router<int> r;
+        r.insert(route_literal("/user/{id}"), 1);
+        r.insert(route_literal("/user/{id}/files/{path+}"), 2);
+        matches_storage<2> m;
+        int const* v = r.find(
+            parse_path("/user/42").value(), m);
+        if(BOOST_TEST(v))
+            BOOST_TEST_EQ(*v, 1);
+        BOOST_TEST_EQ(m.size(), 1u);
+        BOOST_TEST_EQ(m["id"], "42");
+        v = r.find(
+            parse_path("/user/42/files/a/b").value(), m);
+        if(BOOST_TEST(v))
+            BOOST_TEST_EQ(*v, 2);
+        BOOST_TEST_EQ(m.size(), 2u);
+        BOOST_TEST_EQ(m["path"], "a/b");
+    }
+
+    void
+    testJavadocs()
+    {
+    #ifndef BOOST_NO_CXX14_CONSTEXPR
+        // route_literal
+        {
+        constexpr route_literal files( "/user/{id}/files/{path+}" );
+        static_assert( files.fields() == 2, "" );
+
+        router< int > r;
+        r.insert( files, 1 );
+
+        matches_storage< files.fields() > m;
+        r.find( parse_path( "/user/42/files/a/b" ).value(), m );
+        assert( m[1] == "a/b" );
+        }
+    #endif
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testRouter();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    route_literal_test,
+    "boost.url.route_literal");
+
+} // urls
+} // boost
@@ -8,14 +8,19 @@
 //
 
 // Test that header file is self-contained.
-#ifndef BOOST_URL_SOURCE
-#define BOOST_URL_SOURCE
-#endif
-
-#include "router.hpp"
+#include <boost/url/router.hpp>
 
+#include <boost/url/parse_path.hpp>
 #include "test_suite.hpp"
 
+#include <string>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
 namespace boost {
 namespace urls {
 
@@ -153,6 +158,139 @@ struct router_test
         bad("user/{", "user/johndoe");
     }
 
+    static
+    void
+    testManyPatterns()
+    {
+        // literal children are looked up
+        // independently of insertion order
+        good({"c/x", "a/x", "b/{id}", "b/y", "%61/y"}, 4, "a/y");
+        good({"c/x", "a/x", "b/{id}", "b/y", "%61/y"}, 1, "%61/x");
+        good({"c/x", "a/x", "b/{id}", "b/y", "%61/y"}, 3, "b/y");
+        good({"c/x", "a/x", "b/{id}", "b/y", "%61/y"}, 2, "b/z", {"z"}, {{"id", "z"}});
+        good({"a/b/../c", "a/b", "a/d"}, 1, "a/b");
+        good({"a/b/../c", "a/b", "a/d"}, 0, "a/c");
+        good({"a/b/../c", "a/b", "a/d"}, 2, "a/d");
+
+        router<int> r;
+        int const n = 5000;
+        for (int i = 0; i < n; ++i)
+        {
+            std::string p = std::to_string(n - i);
+            r.insert(p + "/view", 2 * i);
+            r.insert(p + "/{op}", 2 * i + 1);
+        }
+        matches m;
+        for (int i = 0; i < n; ++i)
+        {
+            std::string p = std::to_string(n - i);
+            int const* v = r.find(
+                segments_encoded_view(p + "/view"), m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 2 * i);
+            BOOST_TEST(m.empty());
+            v = r.find(
+                segments_encoded_view(p + "/edit"), m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 2 * i + 1);
+            BOOST_TEST_EQ(m.size(), 1u);
+        }
+        BOOST_TEST_NOT(r.find(
+            segments_encoded_view("0/view"), m));
+        BOOST_TEST_NOT(r.find(
+            segments_encoded_view("view"), m));
+    }
+
+    static
+    void
+    testFindMany()
+    {
+        router<int> r;
+        r.insert("user/{name}", 0);
+        r.insert("user/{name}/{op?}/b", 1);
+        r.insert("user/view", 2);
+        r.insert("a/b/c/d", 3);
+        r.insert("a/b/{x*}", 4);
+        r.insert("%61/x/y", 5);
+        r.insert("", 6);
+        r.insert("files/{path+}", 7);
+        for (int i = 0; i < 100; ++i)
+            r.insert("n/" + std::to_string(i) + "/x", 100 + i);
+
+        // more paths than one batch
+        std::vector<std::string> ss = {
+            "user/johndoe", "user/view", "user/johndoe/r/b",
+            "user/johndoe/b", "user", "a/b/c/d", "a/b/c/e",
+            "a/b", "a/x/y", "%61/x/y", "a/x/../b/c/d",
+            "./a/b/c/d", "", "/", "files/a/b/c", "files",
+            "nope", "user/../a/x/y", "../a/x/y", "a/b/c/d/..",
+            "user/a/b/c/d/e/f" };
+        for (int i = 0; i < 100; i += 7)
+        {
+            ss.push_back("n/" + std::to_string(i) + "/x");
+            ss.push_back("n/" + std::to_string(i) + "/y");
+        }
+        std::vector<segments_encoded_view> paths;
+        for (auto const& s: ss)
+            paths.push_back(parse_path(s).value());
+        std::size_t const n = paths.size();
+        std::vector<int const*> results(n);
+        std::vector<matches> ms(n);
+        std::size_t found = r.find_many(
+            paths.data(), n, results.data(), ms.data());
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            matches m;
+            int const* v = r.find(paths[i], m);
+            expected += v != nullptr;
+            if (!BOOST_TEST(v == results[i]))
+            {
+                test_suite::log << "\"" << ss[i] << "\"\n";
+                continue;
+            }
+            if (!BOOST_TEST_EQ(m.size(), ms[i].size()))
+                continue;
+            // ids() is only public for const matches
+            matches const& cm0 = m;
+            matches const& cm1 = ms[i];
+            for (std::size_t j = 0; j < m.size(); ++j)
+            {
+                BOOST_TEST_EQ(m[j], ms[i][j]);
+                BOOST_TEST_EQ(cm0.ids()[j], cm1.ids()[j]);
+            }
+        }
+        BOOST_TEST_EQ(found, expected);
+        BOOST_TEST_GT(found, n / 2);
+
+        // empty batch
+        BOOST_TEST_EQ(r.find_many(
+            paths.data(), 0, results.data(), ms.data()), 0u);
+    }
+
+    static
+    void
+    testJavadocs()
+    {
+        // find_many
+        {
+        router< int > r;
+        r.insert( "user/{id}", 1 );
+        r.insert( "help", 2 );
+
+        segments_encoded_view paths[] = {
+            parse_path( "user/42" ).value(),
+            parse_path( "help" ).value(),
+            parse_path( "nope" ).value() };
+        int const* results[3];
+        matches m[3];
+        std::size_t n = r.find_many( paths, 3, results, m );
+        assert( n == 2 );
+        assert( *results[0] == 1 && m[0][0] == "42" );
+        assert( results[2] == nullptr );
+        }
+    }
+
     static
     void
     good(
@@ -253,6 +391,9 @@ struct router_test
     run()
     {
         testPatterns();
+        testManyPatterns();
+        testFindMany();
+        testJavadocs();
     }
 };
 
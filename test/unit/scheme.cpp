@@ -120,6 +120,13 @@ public:
         check("wSs", scheme::wss);
         check("WSS", scheme::wss);
 
+        // only letters match either case
+        check("@s");
+        check("w[");
+        check("{s");
+        check("http\x13");
+        check("ftp\x0b");
+
         // unknown
         check("gopher");
         check("magnet");
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/scheme_registry.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct scheme_registry_test
+{
+    void
+    testInsert()
+    {
+        scheme_registry r;
+        BOOST_TEST(r.empty());
+        BOOST_TEST_EQ(r.size(), 0u);
+        BOOST_TEST_EQ(r.find("s3"), scheme_registry::npos);
+
+        BOOST_TEST_EQ(r.insert("s3"), 0u);
+        BOOST_TEST_EQ(r.insert("GS"), 1u);
+        BOOST_TEST_EQ(r.insert("hdfs", 8020), 2u);
+        BOOST_TEST_EQ(r.insert("kafka", 9092), 3u);
+        BOOST_TEST_EQ(r.insert("grpc", 443), 4u);
+        BOOST_TEST_EQ(r.size(), 5u);
+        BOOST_TEST_EQ(r.name(1), "gs");
+
+        // existing
+        BOOST_TEST_EQ(r.insert("Kafka", 9093), 3u);
+        BOOST_TEST_EQ(r.size(), 5u);
+        BOOST_TEST_EQ(r.default_port("kafka"), 9093);
+
+        // invalid
+        BOOST_TEST_THROWS(r.insert(""),
+            system::system_error);
+        BOOST_TEST_THROWS(r.insert("3s"),
+            system::system_error);
+        BOOST_TEST_THROWS(r.insert("s3:"),
+            system::system_error);
+        BOOST_TEST_EQ(r.size(), 5u);
+    }
+
+    void
+    testFind()
+    {
+        scheme_registry r;
+        r.insert("s3");
+        r.insert("gs");
+        r.insert("hdfs", 8020);
+        r.insert("kafka", 9092);
+        r.insert("grpc");
+        r.insert("svn+ssh", 22);
+        r.insert("coap+tcp");
+        r.insert("chrome-extension");
+
+        BOOST_TEST_EQ(r.find("s3"), 0u);
+        BOOST_TEST_EQ(r.find("S3"), 0u);
+        BOOST_TEST_EQ(r.find("gS"), 1u);
+        BOOST_TEST_EQ(r.find("HdFs"), 2u);
+        BOOST_TEST_EQ(r.find("KAFKA"), 3u);
+        BOOST_TEST_EQ(r.find("grpc"), 4u);
+        BOOST_TEST_EQ(r.find("SVN+SSH"), 5u);
+        BOOST_TEST_EQ(r.find("coap+TCP"), 6u);
+        BOOST_TEST_EQ(r.find("Chrome-Extension"), 7u);
+
+        BOOST_TEST(! r.contains(""));
+        BOOST_TEST(! r.contains("s"));
+        BOOST_TEST(! r.contains("s4"));
+        BOOST_TEST(! r.contains("s33"));
+        BOOST_TEST(! r.contains("kafk"));
+        BOOST_TEST(! r.contains("kafkas"));
+        BOOST_TEST(! r.contains("grpd"));
+        BOOST_TEST(! r.contains("chrome-extensions"));
+        BOOST_TEST(! r.contains("chrome_extension"));
+
+        // only letters are folded
+        BOOST_TEST(! r.contains(std::string("s\x13")));
+        BOOST_TEST(! r.contains("svn\x0bssh"));
+        BOOST_TEST(! r.contains("coap\x0btcp"));
+
+        BOOST_TEST_EQ(r.default_port("HDFS"), 8020);
+        BOOST_TEST_EQ(r.default_port("svn+ssh"), 22);
+        BOOST_TEST_EQ(r.default_port("s3"), 0);
+        BOOST_TEST_EQ(r.default_port("http"), 0);
+    }
+
+    void
+    testJavadocs()
+    {
+        // {class}
+        {
+    scheme_registry r;
+    r.insert( "s3" );
+    r.insert( "kafka", 9092 );
+    r.insert( "grpc", 443 );
+
+    url_view u( "KAFKA://broker/topic" );
+    assert( r.contains( u.scheme() ) );
+    assert( r.default_port( u.scheme() ) == 9092 );
+        }
+
+        // insert
+        {
+        scheme_registry r;
+        assert( r.insert( "hdfs", 8020 ) == 0 );
+        }
+    }
+
+    void
+    run()
+    {
+        testInsert();
+        testFind();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    scheme_registry_test,
+    "boost.url.scheme_registry");
+
+} // urls
+} // boost
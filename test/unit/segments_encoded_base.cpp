@@ -225,6 +225,52 @@ struct segments_encoded_base_test
         check( "fast//",  { "fast", "", "" });
     }
 
+    void
+    testHashes()
+    {
+        // known values
+        BOOST_TEST_EQ(segment_hash(""), 0u);
+        BOOST_TEST_EQ(segment_hash("123456789"), 0xE3069283u);
+
+        auto const check = [](
+            core::string_view s,
+            std::initializer_list<
+                core::string_view> init)
+        {
+            auto const v = parse_path(
+                s).value().hashes();
+            if(! BOOST_TEST_EQ(v.size(), init.size()))
+                return;
+            std::size_t i = 0;
+            for(auto s1 : init)
+                BOOST_TEST_EQ(v[i++], segment_hash(s1));
+        };
+        check("", {});
+        check("/", {});
+        check("/a/b/c", {"a", "b", "c"});
+        check("/%7E/~/%7e", {"~", "~", "~"});
+        check("/fast//query", {"fast", "", "query"});
+        check("/%2F/%2e", {"/", "."});
+        check("/%E2%82%AC", {"\xe2\x82\xac"});
+        check("/0123456789abcdef%41%42%43",
+            {"0123456789abcdefABC"});
+
+        // truncated
+        {
+            std::uint32_t h[2] = {};
+            auto const ps = parse_path(
+                "/a/b/c").value();
+            BOOST_TEST_EQ(ps.hashes(h, 2), 3u);
+            BOOST_TEST_EQ(h[0], segment_hash("a"));
+            BOOST_TEST_EQ(h[1], segment_hash("b"));
+            BOOST_TEST_EQ(ps.hashes(nullptr, 0), 3u);
+        }
+
+        // different segments
+        BOOST_TEST_NE(segment_hash("a"), segment_hash("b"));
+        BOOST_TEST_NE(segment_hash("ab"), segment_hash("ba"));
+    }
+
     void
     testJavadocs()
     {
@@ -264,12 +310,26 @@ struct segments_encoded_base_test
         {
         assert( url_view( "/path/to/file.txt" ).encoded_segments().back() == "file.txt" );
         }
+
+        // hashes()
+        {
+        std::uint32_t h[3];
+        url_view u( "/a/%7E/~" );
+        u.encoded_segments().hashes( h, 3 );
+        assert( h[1] == h[2] && h[1] == segment_hash( "~" ) );
+        }
+
+        // segment_hash()
+        {
+        assert( segment_hash( "~" ) == url_view( "/%7e" ).encoded_segments().hashes()[0] );
+        }
     }
 
     void
     run()
     {
         testRange();
+        testHashes();
         testJavadocs();
     }
 };
@@ -18,6 +18,9 @@
 
 #include "test_suite.hpp"
 
+#include <string>
+#include <vector>
+
 #ifdef BOOST_TEST_CSTR_EQ
 #undef BOOST_TEST_CSTR_EQ
 #define BOOST_TEST_CSTR_EQ(expr1,expr2) \
@@ -827,6 +830,66 @@ struct segments_encoded_ref_test
         }
     }
 
+    // ranges are validated, measured and
+    // copied in one pass over the segments
+    void
+    testRanges()
+    {
+        std::vector<std::string> v;
+        for(int i = 0; i < 50; ++i)
+            v.push_back(i % 5 == 0 ?
+                std::string() : "a:%2F" + std::to_string(i));
+
+        // the same as one segment at a time
+        for(core::string_view s0 : {
+            "", "/", "x:/#f", "//h?q", "a/b"})
+        {
+            std::string s;
+            {
+                url u(s0);
+                auto ss = u.encoded_segments();
+                ss.clear();
+                for(auto const& seg : v)
+                    ss.push_back(seg);
+                s = u.buffer();
+            }
+            {
+                url u(s0);
+                u.encoded_segments().assign(
+                    v.begin(), v.end());
+                BOOST_TEST_EQ(u.buffer(), s);
+            }
+        }
+
+        // insert and replace in the middle
+        {
+            url u("/x/y/z?q#f");
+            auto ss = u.encoded_segments();
+            ss.insert(std::next(ss.begin()),
+                v.begin(), v.end());
+            BOOST_TEST_EQ(ss.size(), v.size() + 3);
+            ss.replace(
+                std::next(ss.begin()),
+                std::prev(ss.end()),
+                v.begin(), v.begin() + 2);
+            BOOST_TEST_EQ(u.buffer(),
+                "/x//a:%2F1/z?q#f");
+        }
+
+        // an invalid segment anywhere in
+        // the range leaves the url unchanged
+        {
+            v.push_back("%");
+            url u("/x/y?q#f");
+            auto ss = u.encoded_segments();
+            BOOST_TEST_THROWS(
+                ss.insert(ss.begin(),
+                    v.begin(), v.end()),
+                system::system_error);
+            BOOST_TEST_EQ(u.buffer(), "/x/y?q#f");
+        }
+    }
+
     void
     run()
     {
@@ -835,6 +898,7 @@ struct segments_encoded_ref_test
         testModifiers();
         testEditSegments();
         testJavadocs();
+        testRanges();
     }
 };
 
@@ -18,6 +18,10 @@
 
 #include "test_suite.hpp"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #ifdef assert
 #undef assert
 #endif
@@ -841,6 +845,72 @@ struct segments_ref_test
         }
     }
 
+    // ranges are measured and copied
+    // in one pass over the segments
+    static
+    void
+    testRanges()
+    {
+        std::vector<std::string> v;
+        for(int i = 0; i < 50; ++i)
+            v.push_back(i % 5 == 0 ?
+                std::string() : "a:/" + std::to_string(i));
+
+        // the same as one segment at a time,
+        // with the colons of the first segment
+        // of a relative path encoded
+        for(core::string_view s0 : {
+            "", "/", "x:/#f", "//h?q", "a/b"})
+        {
+            std::string s;
+            {
+                url u(s0);
+                auto ss = u.segments();
+                ss.clear();
+                for(auto const& seg : v)
+                    ss.push_back(seg);
+                s = u.buffer();
+            }
+            {
+                url u(s0);
+                u.segments().assign(
+                    v.begin(), v.end());
+                BOOST_TEST_EQ(u.buffer(), s);
+                BOOST_TEST(std::equal(
+                    v.begin(), v.end(),
+                    u.segments().begin()));
+            }
+        }
+
+        // insert and replace in the middle
+        {
+            url u("/x/y/z?q#f");
+            auto ss = u.segments();
+            auto it = ss.insert(
+                std::next(ss.begin()),
+                v.begin(), v.end());
+            BOOST_TEST_EQ(*it, v.front());
+            BOOST_TEST_EQ(ss.size(), v.size() + 3);
+            BOOST_TEST_EQ(ss.front(), "x");
+            BOOST_TEST_EQ(ss.back(), "z");
+            ss.replace(
+                std::next(ss.begin()),
+                std::prev(ss.end()),
+                v.begin(), v.begin() + 2);
+            BOOST_TEST_EQ(u.buffer(),
+                "/x//a:%2F1/z?q#f");
+        }
+
+        // empty range
+        {
+            url u("/x/y");
+            auto ss = u.segments();
+            ss.insert(ss.end(),
+                v.begin(), v.begin());
+            BOOST_TEST_EQ(u.buffer(), "/x/y");
+        }
+    }
+
     //--------------------------------------------
 
     static
@@ -851,6 +921,7 @@ struct segments_ref_test
         testObservers();
         testModifiers();
         testJavadocs();
+        testRanges();
     }
 
     void
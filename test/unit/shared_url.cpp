@@ -0,0 +1,212 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/shared_url.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct shared_url_test
+{
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_default_constructible<
+            shared_url>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_copy_constructible<
+            shared_url>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_move_constructible<
+            shared_url>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            shared_url, url_view>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            shared_url, url>::value);
+
+    void
+    testSpecial()
+    {
+        // shared_url()
+        {
+            shared_url u;
+            BOOST_TEST(u.empty());
+            BOOST_TEST_EQ(*u.buffer().data(), '\0');
+            BOOST_TEST_EQ(u.use_count(), 0u);
+        }
+
+        // shared_url(core::string_view)
+        {
+            BOOST_TEST_THROWS(
+                shared_url("$:$"),
+                system::system_error);
+
+            core::string_view s =
+                "https://user@www.example.com:8080/a/b?k=v#f";
+            shared_url u(s);
+            BOOST_TEST_EQ(u.buffer(), s);
+            BOOST_TEST_NE(u.buffer().data(), s.data());
+            BOOST_TEST_EQ(*(u.buffer().data() + s.size()), '\0');
+            BOOST_TEST_EQ(u.use_count(), 1u);
+            BOOST_TEST_EQ(u.encoded_host(), "www.example.com");
+            BOOST_TEST_EQ(u.port_number(), 8080);
+            BOOST_TEST_EQ(u.segments().size(), 2u);
+            BOOST_TEST_EQ(u.params().size(), 1u);
+        }
+
+        // shared_url(url_view_base const&)
+        {
+            url u0("http://www.example.com/path");
+            shared_url u(u0);
+            BOOST_TEST_EQ(u.buffer(), u0.buffer());
+            BOOST_TEST_NE(
+                u.buffer().data(), u0.buffer().data());
+
+            // the source can change
+            u0.set_path("/other");
+            BOOST_TEST_EQ(u.buffer(),
+                "http://www.example.com/path");
+            BOOST_TEST_EQ(u.encoded_path(), "/path");
+
+            // empty
+            shared_url u1((url_view()));
+            BOOST_TEST(u1.empty());
+            BOOST_TEST_EQ(u1.use_count(), 0u);
+        }
+
+        // shared_url(shared_url const&)
+        {
+            shared_url u0("http://www.example.com/path");
+            shared_url u1(u0);
+            BOOST_TEST_EQ(
+                u1.buffer().data(), u0.buffer().data());
+            BOOST_TEST_EQ(u0.use_count(), 2u);
+            {
+                shared_url u2(u1);
+                BOOST_TEST_EQ(u0.use_count(), 3u);
+            }
+            BOOST_TEST_EQ(u0.use_count(), 2u);
+            BOOST_TEST_EQ(u1.encoded_path(), "/path");
+        }
+
+        // shared_url(shared_url&&)
+        {
+            shared_url u0("http://www.example.com/path");
+            char const* p = u0.buffer().data();
+            shared_url u1(std::move(u0));
+            BOOST_TEST_EQ(u1.buffer().data(), p);
+            BOOST_TEST_EQ(u1.use_count(), 1u);
+            BOOST_TEST(u0.empty());
+            BOOST_TEST_EQ(u0.use_count(), 0u);
+        }
+
+        // operator=(shared_url const&)
+        // operator=(shared_url&&)
+        // operator=(url_view_base const&)
+        {
+            shared_url u0("http://www.example.com/a");
+            shared_url u1("http://www.example.com/b");
+            u1 = u0;
+            BOOST_TEST_EQ(
+                u1.buffer().data(), u0.buffer().data());
+            BOOST_TEST_EQ(u0.use_count(), 2u);
+            u1 = u1;
+            BOOST_TEST_EQ(u0.use_count(), 2u);
+            shared_url u2;
+            u2 = std::move(u1);
+            BOOST_TEST(u1.empty());
+            BOOST_TEST_EQ(u0.use_count(), 2u);
+            u2 = url_view("/c");
+            BOOST_TEST_EQ(u2.buffer(), "/c");
+            BOOST_TEST_EQ(u0.use_count(), 1u);
+        }
+    }
+
+    void
+    testViews()
+    {
+        shared_url u("http://www.example.com/a/b?k=v");
+
+        // views copy the offsets, and
+        // reference the shared characters
+        url_view v = u;
+        BOOST_TEST_EQ(v.buffer().data(), u.buffer().data());
+        shared_url u1 = u;
+        u = shared_url();
+        BOOST_TEST_EQ(v.buffer(), "http://www.example.com/a/b?k=v");
+        BOOST_TEST_EQ(v.encoded_path(), "/a/b");
+
+        // modification makes a copy
+        url u2 = u1.to_url();
+        u2.set_query("k=w");
+        BOOST_TEST_EQ(u2.buffer(), "http://www.example.com/a/b?k=w");
+        BOOST_TEST_EQ(u1.buffer(), "http://www.example.com/a/b?k=v");
+    }
+
+    void
+    testHash()
+    {
+        std::unordered_set<shared_url> s;
+        s.insert(shared_url("http://www.example.com/a"));
+        s.insert(shared_url("HTTP://www.example.com/a"));
+        s.insert(shared_url("http://www.example.com/b"));
+        BOOST_TEST_EQ(s.size(), 2u);
+    }
+
+    void
+    testJavadocs()
+    {
+        // {class}
+        {
+    shared_url u( "https://www.example.com/index.htm?q=1" );
+    shared_url u2 = u;
+    assert( u2.buffer().data() == u.buffer().data() );
+
+    url u3 = u.to_url();
+    u3.set_query( "q=2" );
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testViews();
+        testHash();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    shared_url_test,
+    "boost.url.shared_url");
+
+} // urls
+} // boost
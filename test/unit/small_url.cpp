@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/small_url.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct small_url_test
+{
+    BOOST_STATIC_ASSERT(
+        std::is_default_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_copy_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_copy_assignable<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_move_constructible<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_nothrow_move_assignable<
+            small_url<10>>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            small_url<10>, url_view>::value);
+
+    BOOST_STATIC_ASSERT(
+        std::is_convertible<
+            small_url<10>, url>::value);
+
+    // the characters are in the object
+    template<std::size_t N>
+    static
+    bool
+    in_object(small_url<N> const& u)
+    {
+        auto const p = reinterpret_cast<
+            char const*>(&u);
+        return
+            u.buffer().data() >= p &&
+            u.buffer().data() < p + sizeof(u);
+    }
+
+    static
+    std::string
+    long_url()
+    {
+        std::string s = "http://www.example.com";
+        for(int i = 0; i < 20; ++i)
+            s += "/segment" + std::to_string(i);
+        return s;
+    }
+
+    void
+    testSpecial()
+    {
+        // small_url()
+        {
+            small_url<32> u;
+            BOOST_TEST_EQ(*u.c_str(), '\0');
+            BOOST_TEST(u.buffer().empty());
+            BOOST_TEST(u.is_inline());
+            BOOST_TEST(in_object(u));
+            BOOST_TEST_EQ(u.capacity(), 32u);
+        }
+
+        // small_url(core::string_view)
+        {
+            // invalid
+            BOOST_TEST_THROWS(
+                small_url<32>("$:$"),
+                system::system_error);
+
+            // inline
+            small_url<32> u0("http://www.example.com");
+            BOOST_TEST(u0.is_inline());
+            BOOST_TEST(in_object(u0));
+            BOOST_TEST_EQ(u0.buffer(), "http://www.example.com");
+
+            // too large for the inline buffer
+            std::string const s = long_url();
+            small_url<32> u1(s);
+            BOOST_TEST(! u1.is_inline());
+            BOOST_TEST(! in_object(u1));
+            BOOST_TEST_EQ(u1.buffer(), s);
+            BOOST_TEST_GE(u1.capacity(), s.size());
+        }
+
+        // small_url(small_url const&)
+        // small_url(url_view_base const&)
+        {
+            small_url<32> u0("/path/to/file.txt");
+            small_url<32> u1(u0);
+            BOOST_TEST_EQ(u0.buffer(), u1.buffer());
+            BOOST_TEST(u1.is_inline());
+
+            std::string const s = long_url();
+            small_url<32> u2((url_view(s)));
+            BOOST_TEST_EQ(u2.buffer(), s);
+            small_url<32> u3(u2);
+            BOOST_TEST_EQ(u3.buffer(), s);
+            BOOST_TEST_NE(
+                u3.buffer().data(), u2.buffer().data());
+            small_url<512> u4(u2);
+            BOOST_TEST_EQ(u4.buffer(), s);
+            BOOST_TEST(u4.is_inline());
+        }
+
+        // small_url(small_url&&)
+        {
+            // inline characters are copied
+            small_url<32> u0("/path/to/file.txt");
+            small_url<32> u1(std::move(u0));
+            BOOST_TEST_EQ(u1.buffer(), "/path/to/file.txt");
+            BOOST_TEST(u1.is_inline());
+            BOOST_TEST(u0.empty());
+            BOOST_TEST(u0.is_inline());
+
+            // the heap buffer is transferred
+            std::string const s = long_url();
+            small_url<32> u2(s);
+            char const* p = u2.buffer().data();
+            small_url<32> u3(std::move(u2));
+            BOOST_TEST_EQ(u3.buffer(), s);
+            BOOST_TEST_EQ(u3.buffer().data(), p);
+            BOOST_TEST(u2.empty());
+            BOOST_TEST(u2.is_inline());
+            BOOST_TEST_EQ(u2.capacity(), 32u);
+
+            // the moved-from url is usable
+            u2.set_encoded_path("/a/b");
+            BOOST_TEST_EQ(u2.buffer(), "/a/b");
+        }
+
+        // operator=(small_url&&)
+        {
+            std::string const s = long_url();
+            small_url<32> u0(s);
+            small_url<32> u1("/x");
+            u1 = std::move(u0);
+            BOOST_TEST_EQ(u1.buffer(), s);
+            BOOST_TEST(! u1.is_inline());
+            BOOST_TEST(u0.empty());
+
+            // a heap url receives inline characters
+            small_url<32> u2("/y");
+            u1 = std::move(u2);
+            BOOST_TEST_EQ(u1.buffer(), "/y");
+            BOOST_TEST(u2.empty());
+
+            // a heap url receives another heap buffer
+            small_url<32> u3(s);
+            u1 = std::move(u3);
+            BOOST_TEST_EQ(u1.buffer(), s);
+
+            // self-assignment
+            small_url<32>& r = u1;
+            u1 = std::move(r);
+            BOOST_TEST_EQ(u1.buffer(), s);
+        }
+
+        // operator=(small_url const&)
+        // operator=(url_view_base const&)
+        {
+            std::string const s = long_url();
+            small_url<32> u0(s);
+            small_url<32> u1;
+            u1 = u0;
+            BOOST_TEST_EQ(u1.buffer(), s);
+            u1 = url_view("/path/to/file.txt");
+            BOOST_TEST_EQ(u1.buffer(), "/path/to/file.txt");
+            u1 = url("http://www.example.com");
+            BOOST_TEST_EQ(u1.buffer(), "http://www.example.com");
+        }
+    }
+
+    void
+    testModify()
+    {
+        // grows past the inline capacity
+        small_url<32> u("http://www.example.com");
+        BOOST_TEST(u.is_inline());
+        std::string path;
+        for(int i = 0; i < 100; ++i)
+        {
+            u.segments().push_back("s" + std::to_string(i));
+            path += "/s" + std::to_string(i);
+            BOOST_TEST_EQ(u.encoded_path(), path);
+            BOOST_TEST_LE(u.size(), u.capacity());
+        }
+        BOOST_TEST(! u.is_inline());
+        BOOST_TEST_EQ(u.segments().size(), 100u);
+
+        // the capacity is kept
+        auto const cap = u.capacity();
+        u.clear();
+        BOOST_TEST(u.empty());
+        BOOST_TEST_EQ(u.capacity(), cap);
+
+        // a part of the url itself
+        // is copied while spilling
+        {
+            small_url<32> u1("http://www.example.com/abcdefgh");
+            u1.set_encoded_query(u1.encoded_path());
+            u1.set_encoded_fragment(u1.buffer());
+            BOOST_TEST_EQ(u1.buffer(),
+                "http://www.example.com/abcdefgh?/abcdefgh"
+                "#http://www.example.com/abcdefgh?/abcdefgh");
+            BOOST_TEST(! u1.is_inline());
+        }
+
+        // reserve
+        {
+            small_url<32> u1("/x");
+            u1.reserve(16);
+            BOOST_TEST(u1.is_inline());
+            u1.reserve(100);
+            BOOST_TEST(! u1.is_inline());
+            BOOST_TEST_GE(u1.capacity(), 100u);
+            BOOST_TEST_EQ(u1.buffer(), "/x");
+        }
+
+        // fluent api
+        {
+            small_url<64> u1;
+            u1.set_scheme("https")
+                .set_host("www.example.com")
+                .set_path("/index.htm")
+                .set_query("a=1");
+            BOOST_TEST_EQ(u1.buffer(),
+                "https://www.example.com/index.htm?a=1");
+        }
+    }
+
+    void
+    testOstream()
+    {
+        small_url<64> u("http://example.com");
+        std::stringstream ss;
+        ss << u;
+        BOOST_TEST_EQ(ss.str(), "http://example.com");
+    }
+
+    void
+    testJavadocs()
+    {
+        // {class}
+        {
+    small_url< 256 > u( "https://www.example.com" );
+    assert( u.is_inline() );
+
+    ignore_unused(u);
+        }
+
+        // small_url()
+        {
+        small_url< 256 > u;
+
+        ignore_unused(u);
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testModify();
+        testOstream();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    small_url_test,
+    "boost.url.small_url");
+
+} // urls
+} // boost
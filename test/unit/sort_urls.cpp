@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/sort_urls.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct sort_urls_test
+{
+    static
+    void
+    check(
+        std::vector<std::string> const& v,
+        std::size_t threads)
+    {
+        std::vector<core::string_view> keys(
+            v.begin(), v.end());
+        radix_sort_keys(
+            keys.data(),
+            keys.data() + keys.size(),
+            threads);
+        std::vector<std::string> r(v);
+        std::sort(r.begin(), r.end());
+        BOOST_TEST_EQ(keys.size(), r.size());
+        std::size_t i = 0;
+        for(; i < r.size(); ++i)
+            if(keys[i] != r[i])
+                break;
+        BOOST_TEST_EQ(i, r.size());
+    }
+
+    void
+    testRadixSort()
+    {
+        // javadoc
+        {
+            std::vector< core::string_view > v = { "b", "ab", "a" };
+            radix_sort_keys( v.data(), v.data() + v.size() );
+            BOOST_TEST( v[0] == "a" && v[1] == "ab" && v[2] == "b" );
+        }
+
+        check({}, 1);
+        check({ "" }, 1);
+        check({ "b", "", "a", "" }, 1);
+
+        // bytes of every value,
+        // prefixes and long prefixes
+        std::mt19937 g;
+        std::vector<std::string> v;
+        std::string const prefix(40, '\x01');
+        for(int i = 0; i < 3000; ++i)
+        {
+            std::string s;
+            if(i % 3 == 0)
+                s = prefix;
+            auto const n = g() % 6;
+            for(unsigned j = 0; j < n; ++j)
+                s.push_back(static_cast<
+                    char>(g() % 4 * 85));
+            v.push_back(s);
+        }
+        check(v, 1);
+        check(v, 4);
+
+        // parallel
+        for(int i = 0; i < 70000; ++i)
+            v.push_back(std::string("\x01http\x00", 6) +
+                std::to_string(g() % 100000));
+        check(v, 1);
+        check(v, 3);
+        check(v, 0);
+    }
+
+    void
+    testSortUrls()
+    {
+        // javadoc
+        {
+            std::vector< url_view > v = {
+                url_view( "http://www.b.com" ),
+                url_view( "HTTP://www.A.com/x/../y" ),
+                url_view( "http://www.a.com" ) };
+            sort_urls( v.begin(), v.end() );
+            BOOST_TEST( v[0] == url_view( "http://www.a.com" ) );
+            BOOST_TEST( v[1] == url_view( "http://www.a.com/y" ) );
+        }
+
+        // stable
+        {
+            std::vector<url> v = {
+                url("http://a/%62"),
+                url("/x"),
+                url("HTTP://A/b"),
+                url("http://a/b"),
+                url("") };
+            sort_urls(v.begin(), v.end(), 1);
+            BOOST_TEST_EQ(v[0].buffer(), "");
+            BOOST_TEST_EQ(v[1].buffer(), "/x");
+            BOOST_TEST_EQ(v[2].buffer(), "http://a/%62");
+            BOOST_TEST_EQ(v[3].buffer(), "HTTP://A/b");
+            BOOST_TEST_EQ(v[4].buffer(), "http://a/b");
+        }
+
+        // the order of compare
+        {
+            std::mt19937 g;
+            std::vector<std::string> s;
+            char const* const hosts[] = {
+                "a.com", "A.com", "b.com", "%61.com" };
+            char const* const paths[] = {
+                "", "/", "/x", "/X", "/x/../y", "/%78" };
+            for(int i = 0; i < 2000; ++i)
+            {
+                std::string u = g() % 2 ? "http" : "HTTPS";
+                u += "://";
+                u += hosts[g() % 4];
+                u += paths[g() % 6];
+                if(g() % 2)
+                    u += "?q=" + std::to_string(g() % 10);
+                s.push_back(u);
+            }
+            std::vector<url_view> v(s.begin(), s.end());
+            std::vector<url_view> r(v);
+            sort_urls(v.begin(), v.end(), 2);
+            std::stable_sort(r.begin(), r.end());
+            std::size_t i = 0;
+            for(; i < r.size(); ++i)
+                if(v[i].buffer().data() !=
+                        r[i].buffer().data())
+                    break;
+            BOOST_TEST_EQ(i, r.size());
+        }
+    }
+
+    void
+    run()
+    {
+        testRadixSort();
+        testSortUrls();
+    }
+};
+
+TEST_SUITE(
+    sort_urls_test,
+    "boost.url.sort_urls");
+
+} // urls
+} // boost
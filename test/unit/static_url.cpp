@@ -161,6 +161,167 @@ struct static_url_test
         }
     }
 
+    // the result needs exactly N chars
+    template<std::size_t N, class F>
+    static
+    void
+    check_fit(
+        core::string_view s0,
+        F const& f,
+        core::string_view s1)
+    {
+        BOOST_TEST_EQ(s1.size(), N);
+        {
+            static_url<N> u(s0);
+            auto rv = f(u);
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(u.buffer(), s1);
+        }
+        {
+            static_url<N - 1> u(s0);
+            auto rv = f(u);
+            BOOST_TEST(rv.error() == error::no_space);
+            BOOST_TEST_EQ(u.buffer(), s0);
+        }
+    }
+
+    void
+    testTrySet()
+    {
+        // try_set_scheme
+        {
+            auto f = [](url_base& u)
+            {
+                return u.try_set_scheme("https");
+            };
+            check_fit<13>("//a.com", f, "https://a.com");
+            check_fit<13>("ws://a.com", f, "https://a.com");
+        }
+        {
+            // removes "./"
+            static_url<5> u("./x:y");
+            BOOST_TEST(u.try_set_scheme("s").has_value());
+            BOOST_TEST_EQ(u.buffer(), "s:x:y");
+        }
+        {
+            static_url<64> u("http://a.com");
+            auto rv = u.try_set_scheme("1x");
+            BOOST_TEST(rv.has_error());
+            BOOST_TEST(rv.error() != error::no_space);
+            BOOST_TEST_EQ(u.buffer(), "http://a.com");
+        }
+
+        // try_set_encoded_host
+        {
+            check_fit<12>("/path", [](url_base& u)
+            {
+                return u.try_set_encoded_host("a.com");
+            }, "//a.com/path");
+            check_fit<5>("x", [](url_base& u)
+            {
+                return u.try_set_encoded_host("h");
+            }, "//h/x");
+            check_fit<12>("http:", [](url_base& u)
+            {
+                return u.try_set_encoded_host("[0::1]");
+            }, "http://[::1]");
+            check_fit<14>("http://a", [](url_base& u)
+            {
+                return u.try_set_encoded_host("1.2.3.4");
+            }, "http://1.2.3.4");
+            check_fit<13>("http://a", [](url_base& u)
+            {
+                return u.try_set_encoded_host("[v1.x]");
+            }, "http://[v1.x]");
+            check_fit<12>("http://a", [](url_base& u)
+            {
+                return u.try_set_encoded_host("a%20b");
+            }, "http://a%20b");
+        }
+
+        // try_set_port_number
+        {
+            auto f = [](url_base& u)
+            {
+                return u.try_set_port_number(8080);
+            };
+            check_fit<13>("http://h", f, "http://h:8080");
+            check_fit<13>("http://h:80", f, "http://h:8080");
+            check_fit<9>("x", f, "//:8080/x");
+        }
+
+        // try_set_encoded_path
+        {
+            check_fit<5>("", [](url_base& u)
+            {
+                return u.try_set_encoded_path("a:b");
+            }, "a%3Ab");
+            check_fit<10>("http://h", [](url_base& u)
+            {
+                return u.try_set_encoded_path("p");
+            }, "http://h/p");
+            check_fit<5>("", [](url_base& u)
+            {
+                return u.try_set_encoded_path("//x");
+            }, "/.//x");
+        }
+
+        // try_set_query
+        {
+            check_fit<9>("/", [](url_base& u)
+            {
+                return u.try_set_query("a b&c");
+            }, "/?a%20b&c");
+            check_fit<7>("/?xy", [](url_base& u)
+            {
+                return u.try_set_encoded_query("a%20b");
+            }, "/?a%20b");
+        }
+
+        // try_set_fragment
+        {
+            check_fit<7>("/", [](url_base& u)
+            {
+                return u.try_set_fragment("a b");
+            }, "/#a%20b");
+            check_fit<7>("/#x", [](url_base& u)
+            {
+                return u.try_set_encoded_fragment("a%20b");
+            }, "/#a%20b");
+        }
+
+        // try_append_param
+        {
+            check_fit<22>("/path", [](url_base& u)
+            {
+                return u.try_append_param(
+                    {"first", "John Doe"});
+            }, "/path?first=John%20Doe");
+            check_fit<7>("/?a", [](url_base& u)
+            {
+                return u.try_append_param({"b", "c"});
+            }, "/?a&b=c");
+            check_fit<3>("/", [](url_base& u)
+            {
+                return u.try_append_param(
+                    {"k", "", false});
+            }, "/?k");
+            check_fit<8>("/", [](url_base& u)
+            {
+                return u.try_append_encoded_param(
+                    {"k", "v%20"});
+            }, "/?k=v%20");
+        }
+
+        // url can grow
+        {
+            url u("/");
+            BOOST_TEST(u.try_set_query("a=1").has_value());
+            BOOST_TEST(u.try_append_param({"b", "2"}).has_value());
+            BOOST_TEST_EQ(u.buffer(), "/?a=1&b=2");
+        }
+    }
+
     void
     testJavadocs()
     {
@@ -185,6 +346,20 @@ struct static_url_test
         ignore_unused(u);
         }
 
+        // try_set_scheme
+        {
+        static_url< 16 > u( "http://a.com" );
+        BOOST_TEST( u.try_set_scheme( "https" ).has_value() );
+        BOOST_TEST( u.try_set_scheme( "a-very-long-scheme" ).error() == error::no_space );
+        BOOST_TEST( u.buffer() == "https://a.com" );
+        }
+
+        // try_append_param
+        {
+        static_url< 32 > u( "/path" );
+        BOOST_TEST( u.try_append_param( { "first", "John Doe" } ).has_value() );
+        BOOST_TEST( u.buffer() == "/path?first=John%20Doe" );
+        }
     }
 
     void
@@ -192,6 +367,7 @@ struct static_url_test
     {
         testSpecial();
         testOstream();
+        testTrySet();
         testJavadocs();
     }
 };
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/stats.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/detail/stats.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct stats_test
+{
+    // work which updates every counter
+    static
+    void
+    work()
+    {
+        BOOST_TEST(parse_uri(
+            "http://www.example.com/").has_value());
+        BOOST_TEST(parse_uri(
+            "not a url").has_error());
+        BOOST_TEST(parse_relative_ref(
+            "/path?q").has_value());
+        {
+            url u("http://www.example.com");
+            for(int i = 0; i < 32; ++i)
+                u.segments().push_back("segment");
+        }
+        {
+            grammar::recycled<std::string> bin;
+            {
+                grammar::recycled_ptr<
+                    std::string> p(bin);
+            }
+            {
+                grammar::recycled_ptr<
+                    std::string> p(bin);
+            }
+        }
+    }
+
+    void
+    testEnabled()
+    {
+        reset_url_stats();
+        work();
+        url_stats const st = get_url_stats();
+        if(! url_stats_enabled())
+        {
+            BOOST_TEST_EQ(st.allocations, 0u);
+            BOOST_TEST_EQ(st.deallocations, 0u);
+            BOOST_TEST_EQ(st.bytes_allocated, 0u);
+            BOOST_TEST_EQ(st.reallocations, 0u);
+            BOOST_TEST_EQ(st.recycled_hits, 0u);
+            BOOST_TEST_EQ(st.recycled_misses, 0u);
+            BOOST_TEST_EQ(st.parse_calls, 0u);
+            BOOST_TEST_EQ(st.parse_errors, 0u);
+            return;
+        }
+        // url(string_view) parses too
+        BOOST_TEST_EQ(st.parse_calls, 4u);
+        BOOST_TEST_EQ(st.parse_errors, 1u);
+        BOOST_TEST_GE(st.allocations, 2u);
+        BOOST_TEST_EQ(st.allocations, st.deallocations);
+        BOOST_TEST_GE(st.reallocations, 1u);
+        BOOST_TEST_LT(st.reallocations, st.allocations);
+        BOOST_TEST_GE(st.bytes_allocated,
+            st.allocations);
+        BOOST_TEST_GE(st.recycled_hits, 1u);
+        BOOST_TEST_GE(st.recycled_misses, 1u);
+    }
+
+    void
+    testReset()
+    {
+        detail::stats_allocate_impl(10);
+        detail::stats_deallocate_impl();
+        detail::stats_reallocate_impl();
+        detail::stats_recycled_impl(true);
+        detail::stats_recycled_impl(false);
+        detail::stats_parse_impl(false);
+        url_stats st = get_url_stats();
+        BOOST_TEST_GE(st.allocations, 1u);
+        BOOST_TEST_GE(st.bytes_allocated, 10u);
+        BOOST_TEST_GE(st.parse_errors, 1u);
+        reset_url_stats();
+        st = get_url_stats();
+        BOOST_TEST_EQ(st.allocations, 0u);
+        BOOST_TEST_EQ(st.deallocations, 0u);
+        BOOST_TEST_EQ(st.bytes_allocated, 0u);
+        BOOST_TEST_EQ(st.reallocations, 0u);
+        BOOST_TEST_EQ(st.recycled_hits, 0u);
+        BOOST_TEST_EQ(st.recycled_misses, 0u);
+        BOOST_TEST_EQ(st.parse_calls, 0u);
+        BOOST_TEST_EQ(st.parse_errors, 0u);
+    }
+
+    void
+    run()
+    {
+        testEnabled();
+        testReset();
+    }
+};
+
+TEST_SUITE(
+    stats_test,
+    "boost.url.stats");
+
+} // urls
+} // boost
@@ -0,0 +1,341 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/uri_template.hpp>
+
+#include <boost/url/static_url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct uri_template_test
+{
+    // the variables of rfc6570 section 3.2
+    std::vector<std::string> list =
+        { "red", "green", "blue" };
+    std::vector<std::pair<
+        std::string, std::string>> keys =
+        { { "semi", ";" }, { "dot", "." },
+          { "comma", "," } };
+    std::vector<std::string> empty_list;
+
+    template_value
+    operator()(core::string_view name) const
+    {
+        if(name == "list")
+            return template_value::make_list(list);
+        if(name == "keys")
+            return template_value::make_map(keys);
+        if(name == "empty_list")
+            return template_value::make_list(empty_list);
+        if(name == "var")
+            return "value";
+        if(name == "hello")
+            return "Hello World!";
+        if(name == "half")
+            return "50%";
+        if(name == "path")
+            return "/foo/bar";
+        if(name == "base")
+            return "http://example.com/home/";
+        if(name == "who")
+            return "fred";
+        if(name == "dub")
+            return "me/too";
+        if(name == "x")
+            return "1024";
+        if(name == "y")
+            return "768";
+        if(name == "empty")
+            return "";
+        return {};
+    }
+
+    void
+    check(
+        core::string_view s,
+        core::string_view expected)
+    {
+        uri_template const t(s);
+        BOOST_TEST_EQ(t.buffer(), s);
+        BOOST_TEST_EQ(t.expand_string(*this), expected);
+    }
+
+    void
+    bad(core::string_view s)
+    {
+        BOOST_TEST_THROWS(
+            uri_template{s},
+            system::system_error);
+    }
+
+    void
+    testLevels()
+    {
+        // level 1
+        check("{var}", "value");
+        check("{hello}", "Hello%20World%21");
+        check("{half}", "50%25");
+        check("O{empty}X", "OX");
+        check("O{undef}X", "OX");
+
+        // level 2
+        check("{+var}", "value");
+        check("{+hello}", "Hello%20World!");
+        check("{+half}", "50%25");
+        check("{base}index", "http%3A%2F%2Fexample.com%2Fhome%2Findex");
+        check("{+base}index", "http://example.com/home/index");
+        check("{+path}/here", "/foo/bar/here");
+        check("here?ref={+path}", "here?ref=/foo/bar");
+        check("X{#var}", "X#value");
+        check("X{#hello}", "X#Hello%20World!");
+
+        // level 3
+        check("map?{x,y}", "map?1024,768");
+        check("{x,hello,y}", "1024,Hello%20World%21,768");
+        check("{+x,hello,y}", "1024,Hello%20World!,768");
+        check("{#x,hello,y}", "#1024,Hello%20World!,768");
+        check("X{.var}", "X.value");
+        check("X{.x,y}", "X.1024.768");
+        check("{/var}", "/value");
+        check("{/var,x}/here", "/value/1024/here");
+        check("{;x,y}", ";x=1024;y=768");
+        check("{;x,y,empty}", ";x=1024;y=768;empty");
+        check("{?x,y}", "?x=1024&y=768");
+        check("{?x,y,empty}", "?x=1024&y=768&empty=");
+        check("?fixed=yes{&x}", "?fixed=yes&x=1024");
+        check("{&x,y,empty}", "&x=1024&y=768&empty=");
+        check("{?undef,x}", "?x=1024");
+    }
+
+    void
+    testLevel4()
+    {
+        check("{var:3}", "val");
+        check("{var:30}", "value");
+        check("{list}", "red,green,blue");
+        check("{list*}", "red,green,blue");
+        check("{keys}", "semi,%3B,dot,.,comma,%2C");
+        check("{keys*}", "semi=%3B,dot=.,comma=%2C");
+        check("{+path:6}/here", "/foo/b/here");
+        check("{+list}", "red,green,blue");
+        check("{+keys}", "semi,;,dot,.,comma,,");
+        check("{+keys*}", "semi=;,dot=.,comma=,");
+        check("{#path:6}/here", "#/foo/b/here");
+        check("{#list*}", "#red,green,blue");
+        check("{#keys}", "#semi,;,dot,.,comma,,");
+        check("X{.list*}", "X.red.green.blue");
+        check("X{.keys*}", "X.semi=%3B.dot=..comma=%2C");
+        check("{/var:1,var}", "/v/value");
+        check("{/list*}", "/red/green/blue");
+        check("{/list*,path:4}", "/red/green/blue/%2Ffoo");
+        check("{/keys*}", "/semi=%3B/dot=./comma=%2C");
+        check("{;hello:5}", ";hello=Hello");
+        check("{;list}", ";list=red,green,blue");
+        check("{;list*}", ";list=red;list=green;list=blue");
+        check("{;keys*}", ";semi=%3B;dot=.;comma=%2C");
+        check("{?var:3}", "?var=val");
+        check("{?list*}", "?list=red&list=green&list=blue");
+        check("{?keys}", "?keys=semi,%3B,dot,.,comma,%2C");
+        check("{?keys*}", "?semi=%3B&dot=.&comma=%2C");
+        check("{&list*}", "&list=red&list=green&list=blue");
+        check("{/empty_list}", "");
+    }
+
+    void
+    testParse()
+    {
+        // literals are encoded
+        check("a b%20c", "a%20b%20c");
+        check("", "");
+        check("{a.b,a%20b,a_1}", "");
+
+        bad("{");
+        bad("}");
+        bad("{}");
+        bad("{x");
+        bad("{x,}");
+        bad("{x y}");
+        bad("{x:0}");
+        bad("{x:10000}");
+        bad("{=x}");
+        bad("{.}");
+        bad("{a.}");
+        bad("{%2}");
+    }
+
+    void
+    testExpand()
+    {
+        uri_template const t(
+            "https://www.example.com{/list*}{?x,y}{#var}");
+        url u = t.expand(*this);
+        BOOST_TEST_EQ(u.buffer(),
+            "https://www.example.com/red/green/blue?x=1024&y=768#value");
+        BOOST_TEST_EQ(u.encoded_host(), "www.example.com");
+        BOOST_TEST_EQ(u.segments().size(), 3u);
+        BOOST_TEST_EQ(u.params().size(), 2u);
+        BOOST_TEST_EQ(u.encoded_fragment(), "value");
+
+        // the contents are replaced
+        uri_template const t1("/{who}");
+        t1.expand_to(u, *this);
+        BOOST_TEST_EQ(u.buffer(), "/fred");
+        BOOST_TEST(! u.has_authority());
+
+        static_url<32> su;
+        t1.expand_to(su, *this);
+        BOOST_TEST_EQ(su.buffer(), "/fred");
+        BOOST_TEST_THROWS(
+            t.expand_to(su, *this),
+            system::system_error);
+
+        // empty expansion
+        uri_template const t2("{undef}");
+        t2.expand_to(u, *this);
+        BOOST_TEST(u.empty());
+
+        // percent signs are encoded
+        uri_template const t3("{+base}%zz");
+        BOOST_TEST_EQ(t3.expand_string(*this),
+            "http://example.com/home/%25zz");
+        // not a uri reference
+        uri_template const t5("http://[{x}]/");
+        u = url("x:y");
+        BOOST_TEST_THROWS(
+            t5.expand_to(u, *this),
+            system::system_error);
+        BOOST_TEST(u.empty());
+        BOOST_TEST_EQ(u.c_str()[0], '\0');
+    }
+
+    static
+    void
+    match(
+        core::string_view t,
+        core::string_view s,
+        std::initializer_list<std::pair<
+            core::string_view,
+            core::string_view>> init)
+    {
+        // the ids reference the template
+        uri_template const ut(t);
+        matches m;
+        if(! BOOST_TEST(ut.match(s, m)))
+            return;
+        if(! BOOST_TEST_EQ(m.size(), init.size()))
+            return;
+        // ids() is only public for const matches
+        matches const& cm = m;
+        std::size_t i = 0;
+        for(auto const& e : init)
+        {
+            BOOST_TEST_EQ(cm.ids()[i], e.first);
+            BOOST_TEST_EQ(m[i], e.second);
+            ++i;
+        }
+    }
+
+    static
+    void
+    nomatch(
+        core::string_view t,
+        core::string_view s)
+    {
+        matches_storage<3> m;
+        BOOST_TEST(! uri_template(t).match(s, m));
+        BOOST_TEST(m.empty());
+    }
+
+    void
+    testMatch()
+    {
+        // the expansion is matched back
+        {
+            uri_template const t(
+                "https://www.example.com{/list*}{?x,y}{#var}");
+            url const u = t.expand(*this);
+            matches m;
+            BOOST_TEST(t.match(u, m));
+            BOOST_TEST_EQ(m.size(), 6u);
+            BOOST_TEST_EQ(m[0], "red");
+            BOOST_TEST_EQ(m[2], "blue");
+            BOOST_TEST_EQ(m["x"], "1024");
+            BOOST_TEST_EQ(m["y"], "768");
+            BOOST_TEST_EQ(m["var"], "value");
+            // the values reference the url
+            BOOST_TEST(m["x"].data() > u.data());
+            BOOST_TEST(m["x"].data() < u.data() + u.size());
+        }
+
+        match("/users/{id}/posts{?page,limit}",
+            "/users/42/posts?limit=10",
+            {{"id", "42"}, {"limit", "10"}});
+        match("/users/{id}/posts{?page,limit}",
+            "/users/42/posts", {{"id", "42"}});
+        match("{+path}/here", "/foo/bar/here",
+            {{"path", "/foo/bar"}});
+        match("{x}.json", "1024.json", {{"x", "1024"}});
+        match("X{.x,y}", "X.1024.768",
+            {{"x", "1024"}, {"y", "768"}});
+        match("{/var,x}/here", "/value/1024/here",
+            {{"var", "value"}, {"x", "1024"}});
+        match("{list}", "red,green,blue",
+            {{"list", "red,green,blue"}});
+        match("{;x,y,empty}", ";x=1024;y=768;empty",
+            {{"x", "1024"}, {"y", "768"}, {"empty", ""}});
+        match("{?list}", "?list=red,green,blue",
+            {{"list", "red,green,blue"}});
+        match("{?y,x}", "?x=1024&y=768",
+            {{"x", "1024"}, {"y", "768"}});
+        match("/a{?x,rest*}", "/a?x=1&z=2&w",
+            {{"x", "1"}, {"rest", "z=2"}, {"rest", "w"}});
+        match("/a{?x}{&y}", "/a?x=1&y=2",
+            {{"x", "1"}, {"y", "2"}});
+        match("/a{?x}{&y}", "/a&y=2", {{"y", "2"}});
+        match("{/a}{?q}", "?q=1", {{"q", "1"}});
+        match("/a{#f}", "/a", {});
+        match("a b{x}", "a%20b1", {{"x", "1"}});
+        match("{hello}", "Hello%20World%21",
+            {{"hello", "Hello%20World%21"}});
+
+        nomatch("/a", "/b");
+        nomatch("/a", "/a/");
+        nomatch("{x}", "a/b");
+        nomatch("/a{?x}", "/a?x=1&z=2");
+        nomatch("/a{?x}{&y}", "/a?y=2");
+        // the results do not fit
+        nomatch("{/list*}", "/a/b/c/d");
+    }
+
+    void
+    run()
+    {
+        testLevels();
+        testLevel4();
+        testParse();
+        testExpand();
+        testMatch();
+    }
+};
+
+TEST_SUITE(
+    uri_template_test,
+    "boost.url.uri_template");
+
+} // urls
+} // boost
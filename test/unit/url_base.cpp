@@ -102,6 +102,8 @@ struct url_base_test
         remove("yabba:dabba:doo", "dabba%3Adoo");
         remove("yabba:dabba:doo:doo", "dabba%3Adoo%3Adoo");
         remove("x::::", "%3A%3A%3A");
+        remove("x:./a:b", "./a:b");
+        remove("x:./a:b/c:d", "./a:b/c:d");
 
 
         remove("x://a.b/1/2",      "//a.b/1/2");
@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_builder.hpp>
+
+#include <boost/url/parse.hpp>
+#include "test_suite.hpp"
+
+
+namespace boost {
+namespace urls {
+
+struct url_builder_test
+{
+    // the url built is the same
+    // as the url parsed from its
+    // string
+    static
+    void
+    check(
+        url_builder& b,
+        core::string_view s)
+    {
+        BOOST_TEST_EQ(b.buffer(), s);
+        url const u = b.release();
+        BOOST_TEST_EQ(b.buffer(), "");
+        BOOST_TEST_EQ(u.buffer(), s);
+        BOOST_TEST_EQ(u.c_str()[u.size()], '\0');
+        url_view const u0 = parse_uri_reference(s).value();
+        BOOST_TEST_EQ(u.scheme_id(), u0.scheme_id());
+        BOOST_TEST_EQ(u.has_authority(), u0.has_authority());
+        BOOST_TEST_EQ(u.encoded_user(), u0.encoded_user());
+        BOOST_TEST_EQ(u.has_password(), u0.has_password());
+        BOOST_TEST_EQ(u.encoded_password(), u0.encoded_password());
+        BOOST_TEST_EQ(u.host_type(), u0.host_type());
+        BOOST_TEST_EQ(u.encoded_host(), u0.encoded_host());
+        BOOST_TEST(u.host_ipv4_address() ==
+            u0.host_ipv4_address());
+        BOOST_TEST(u.host_ipv6_address() ==
+            u0.host_ipv6_address());
+        BOOST_TEST_EQ(u.has_port(), u0.has_port());
+        BOOST_TEST_EQ(u.port_number(), u0.port_number());
+        BOOST_TEST_EQ(u.encoded_path(), u0.encoded_path());
+        BOOST_TEST_EQ(u.encoded_path().decoded_size(),
+            u0.encoded_path().decoded_size());
+        BOOST_TEST_EQ(u.segments().size(), u0.segments().size());
+        BOOST_TEST_EQ(u.has_query(), u0.has_query());
+        BOOST_TEST_EQ(u.encoded_query(), u0.encoded_query());
+        BOOST_TEST_EQ(u.encoded_query().decoded_size(),
+            u0.encoded_query().decoded_size());
+        BOOST_TEST_EQ(u.params().size(), u0.params().size());
+        BOOST_TEST_EQ(u.has_fragment(), u0.has_fragment());
+        BOOST_TEST_EQ(u.encoded_fragment(), u0.encoded_fragment());
+        BOOST_TEST_EQ(u.encoded_fragment().decoded_size(),
+            u0.encoded_fragment().decoded_size());
+        BOOST_TEST(u == u0);
+    }
+
+    void
+    testComponents()
+    {
+        {
+            url_builder b;
+            check(b, "");
+        }
+        {
+            url_builder b(64);
+            b.set_scheme("https")
+             .set_host("www.example.com")
+             .set_port_number(8443)
+             .append_segment("path")
+             .append_segment("to file.txt")
+             .append_param({"id", "42"})
+             .set_fragment("top");
+            check(b,
+                "https://www.example.com:8443/path/to%20file.txt?id=42#top");
+        }
+        {
+            url_builder b;
+            b.set_scheme_id(scheme::ftp)
+             .set_user("us er")
+             .set_password("p:ss")
+             .set_host("Example.COM")
+             .append_segment("a");
+            check(b, "ftp://us%20er:p:ss@Example.COM/a");
+        }
+        {
+            url_builder b;
+            b.set_encoded_user("a%41")
+             .set_encoded_password("%42")
+             .set_encoded_host("h%43st")
+             .append_encoded_segment("x%2Fy/z")
+             .append_encoded_param({"k%3D", "v=w", true})
+             .append_encoded_param({"q", "", false})
+             .set_encoded_fragment("f%20#");
+            check(b, "//a%41:%42@h%43st/x%2Fy%2Fz?k%3D=v=w&q#f%20#");
+        }
+        {
+            url_builder b;
+            b.append_param({"a b", "c&d"})
+             .append_param({"", ""});
+            check(b, "?a%20b=c%26d&=");
+        }
+        {
+            url_builder b;
+            b.set_fragment("");
+            check(b, "#");
+        }
+    }
+
+    void
+    testHost()
+    {
+        {
+            url_builder b;
+            b.set_scheme("http").set_host("127.0.0.1");
+            check(b, "http://127.0.0.1");
+        }
+        {
+            url_builder b;
+            b.set_scheme("http").set_host("[0:0::1]");
+            check(b, "http://[::1]");
+        }
+        {
+            url_builder b;
+            b.set_scheme("http").set_encoded_host("[v1.x]");
+            check(b, "http://[v1.x]");
+        }
+        {
+            url_builder b;
+            b.set_scheme("http").set_host("[zz]");
+            check(b, "http://%5Bzz%5D");
+        }
+        {
+            url_builder b;
+            b.set_scheme("http").set_host("");
+            check(b, "http://");
+        }
+        {
+            // skipped host
+            url_builder b;
+            b.set_user("u").set_port_number(80);
+            check(b, "//u@:80");
+        }
+        {
+            url_builder b;
+            b.set_user("u").append_segment("p");
+            check(b, "//u@/p");
+        }
+        {
+            url_builder b;
+            b.set_password("p").set_fragment("f");
+            check(b, "//:p@#f");
+        }
+        {
+            url_builder b;
+            b.set_port_number(0);
+            check(b, "//:0");
+        }
+    }
+
+    void
+    testPath()
+    {
+        {
+            url_builder b;
+            b.append_segment("");
+            check(b, "/./");
+        }
+        {
+            url_builder b;
+            b.append_segment("").append_segment("a");
+            check(b, "/.//a");
+        }
+        {
+            url_builder b;
+            b.append_segment(".").append_segment("a");
+            check(b, "/././a");
+        }
+        {
+            url_builder b;
+            b.set_scheme("x")
+             .append_encoded_segment("")
+             .append_segment("");
+            check(b, "x:/.//");
+        }
+        {
+            url_builder b;
+            b.set_scheme("x")
+             .set_host("h")
+             .append_segment("")
+             .append_segment(".");
+            check(b, "x://h/.//.");
+        }
+        {
+            url_builder b;
+            b.append_segment("a:b").append_segment("?#");
+            check(b, "/a:b/%3F%23");
+        }
+    }
+
+    void
+    testOrder()
+    {
+        url_builder b;
+        b.set_scheme("http").set_host("h");
+        BOOST_TEST_THROWS(b.set_scheme("x"),
+            system::system_error);
+        BOOST_TEST_THROWS(b.set_user("u"),
+            system::system_error);
+        BOOST_TEST_THROWS(b.set_host("u"),
+            system::system_error);
+        b.append_segment("a");
+        BOOST_TEST_THROWS(b.set_port_number(1),
+            system::system_error);
+        b.append_param({"k", "v"});
+        BOOST_TEST_THROWS(b.append_segment("b"),
+            system::system_error);
+        b.set_fragment("f");
+        BOOST_TEST_THROWS(b.set_fragment("g"),
+            system::system_error);
+        BOOST_TEST_THROWS(b.append_param({"k", "v"}),
+            system::system_error);
+        BOOST_TEST_EQ(b.buffer(), "http://h/a?k=v#f");
+
+        // invalid input
+        url_builder b1;
+        BOOST_TEST_THROWS(b1.set_scheme("1x"),
+            system::system_error);
+        BOOST_TEST_THROWS(b1.set_scheme_id(scheme::unknown),
+            system::system_error);
+        BOOST_TEST_EQ(b1.buffer(), "");
+
+        // clear
+        b.clear();
+        BOOST_TEST_EQ(b.buffer(), "");
+        b.set_scheme("y");
+        check(b, "y:");
+    }
+
+    void
+    testCapacity()
+    {
+        url_builder b(100);
+        b.set_scheme("https")
+         .set_host("www.example.com");
+        for(int i = 0; i < 8; ++i)
+            b.append_segment("segment");
+        url u = b.release();
+        BOOST_TEST_GE(u.capacity(), 100u);
+        BOOST_TEST_EQ(u.segments().size(), 8u);
+
+        // grows past the hint
+        url_builder b1(4);
+        for(int i = 0; i < 50; ++i)
+            b1.append_param({"key", "value"});
+        u = b1.release();
+        BOOST_TEST_EQ(u.params().size(), 50u);
+        BOOST_TEST_EQ(u.size(), 50u * 10u);
+    }
+
+    void
+    run()
+    {
+        testComponents();
+        testHost();
+        testPath();
+        testOrder();
+        testCapacity();
+    }
+};
+
+TEST_SUITE(
+    url_builder_test,
+    "boost.url.url_builder");
+
+} // urls
+} // boost
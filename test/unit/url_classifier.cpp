@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_classifier.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct url_classifier_test
+{
+    static
+    std::size_t
+    find(
+        url_classifier const& c,
+        core::string_view s)
+    {
+        return c.find(url_view(s));
+    }
+
+    void
+    testHost()
+    {
+        url_classifier c;
+        BOOST_TEST(c.empty());
+        BOOST_TEST_EQ(find(c, "http://a.com"), url_classifier::npos);
+
+        c.insert(1, { "", "**.apple.com", "" });
+        c.insert(2, { "", "*apple.com", "" });
+        c.insert(3, { "https", "**.google.com", "" });
+        c.insert(4, { "", "*.example.com", "" });
+        c.insert(5, { "", "example.com", "" });
+        BOOST_TEST_EQ(c.size(), 5u);
+
+        BOOST_TEST_EQ(find(c, "http://apple.com"), 1u);
+        BOOST_TEST_EQ(find(c, "http://www.APPLE.com./x"), 1u);
+        BOOST_TEST_EQ(find(c, "http://pineapple.com"), 2u);
+        BOOST_TEST_EQ(find(c, "https://maps.google.com/x"), 3u);
+        BOOST_TEST_EQ(find(c, "HTTPS://google.com"), 3u);
+        BOOST_TEST_EQ(find(c, "http://maps.google.com"), url_classifier::npos);
+        BOOST_TEST_EQ(find(c, "http://www.example.com"), 4u);
+        BOOST_TEST_EQ(find(c, "http://a.b.example.com"), url_classifier::npos);
+        BOOST_TEST_EQ(find(c, "http://example.com"), 5u);
+        BOOST_TEST_EQ(find(c, "http://badexample.com"), url_classifier::npos);
+        BOOST_TEST_EQ(find(c, "/path"), url_classifier::npos);
+    }
+
+    void
+    testPath()
+    {
+        url_classifier c;
+        c.insert(1, { "", "", "/workplace/**" });
+        c.insert(2, { "", "www.example.com", "/img/*.png" });
+        c.insert(3, { "", "*.example.com", "/img/**" });
+        c.insert(4, { "", "c.com", "/" });
+        c.insert(5, { "", "c.com", "/x/" });
+        c.insert(6, { "", "c.com", "/x/*/y" });
+        c.insert(7, { "", "", "" });
+
+        BOOST_TEST_EQ(find(c, "http://intranet/workplace"), 1u);
+        BOOST_TEST_EQ(find(c, "http://intranet/workplace/a/b"), 1u);
+        BOOST_TEST_EQ(find(c, "/workplace/a"), 1u);
+        BOOST_TEST_EQ(find(c, "http://www.example.com/img/a.png"), 2u);
+        BOOST_TEST_EQ(find(c, "http://www.example.com/img/a.jpg"), 3u);
+        BOOST_TEST_EQ(find(c, "http://www.example.com/img/a.PNG"), 3u);
+        BOOST_TEST_EQ(find(c, "http://c.com"), 4u);
+        BOOST_TEST_EQ(find(c, "http://c.com/"), 4u);
+        BOOST_TEST_EQ(find(c, "http://c.com/x"), 7u);
+        BOOST_TEST_EQ(find(c, "http://c.com/x/"), 5u);
+        BOOST_TEST_EQ(find(c, "http://c.com/x/q/y"), 6u);
+        BOOST_TEST_EQ(find(c, "mailto:a@b.com"), 7u);
+    }
+
+    void
+    testOrder()
+    {
+        // the first pattern wins, whatever
+        // the order of the trie
+        url_classifier c;
+        c.insert(10, { "", "**", "/a/**" });
+        c.insert(20, { "", "www.example.com", "/a/b" });
+        c.insert(30, { "", "b.com", "" });
+        c.insert(40, { "", "a.com", "" });
+        c.insert(40, { "", "a.com", "/p" });
+        BOOST_TEST_EQ(find(c, "http://www.example.com/a/b"), 10u);
+        BOOST_TEST_EQ(find(c, "http://a.com/p"), 40u);
+        BOOST_TEST_EQ(find(c, "http://b.com/p"), 30u);
+        BOOST_TEST_EQ(c.size(), 5u);
+    }
+
+    void
+    run()
+    {
+        testHost();
+        testPath();
+        testOrder();
+    }
+};
+
+TEST_SUITE(
+    url_classifier_test,
+    "boost.url.url_classifier");
+
+} // urls
+} // boost
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_dictionary.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct url_dictionary_test
+{
+    using kind = url_dictionary::kind;
+
+    void
+    testInsert()
+    {
+        url_dictionary d;
+        BOOST_TEST_EQ(d.size(kind::host), 0u);
+        BOOST_TEST_EQ(d.find(kind::host, "a"),
+            url_dictionary::npos);
+
+        // dense ids per kind
+        BOOST_TEST_EQ(d.insert(kind::host, "www.example.com"), 0u);
+        BOOST_TEST_EQ(d.insert(kind::host, "cdn.example.com"), 1u);
+        BOOST_TEST_EQ(d.insert(kind::segment, "www.example.com"), 0u);
+        BOOST_TEST_EQ(d.insert(kind::host, "www.example.com"), 0u);
+        BOOST_TEST_EQ(d.size(kind::host), 2u);
+        BOOST_TEST_EQ(d.size(kind::segment), 1u);
+        BOOST_TEST_EQ(d.size(kind::key), 0u);
+        BOOST_TEST_EQ(d.get(kind::host, 1), "cdn.example.com");
+
+        // strings are compared with case
+        BOOST_TEST_EQ(d.find(kind::host, "WWW.example.com"),
+            url_dictionary::npos);
+        BOOST_TEST_EQ(d.insert(kind::key, ""), 0u);
+        BOOST_TEST_EQ(d.find(kind::key, ""), 0u);
+        BOOST_TEST_EQ(d.get(kind::key, 0), "");
+
+        // strings of every length
+        std::string s;
+        for(int i = 0; i < 40; ++i)
+        {
+            s.push_back(static_cast<
+                char>('a' + i % 26));
+            auto const id = d.insert(kind::segment, s);
+            BOOST_TEST_EQ(d.find(kind::segment, s), id);
+            BOOST_TEST_EQ(d.get(kind::segment, id), s);
+        }
+    }
+
+    void
+    testInsertUrl()
+    {
+        url_dictionary d;
+        d.insert(url_view("https://www.example.com/docs/a/?page=2&lang=en#x"));
+        d.insert(url_view("https://www.example.com/docs/b?page=3"));
+        d.insert(url_view("/docs/c"));
+        d.insert(url_view("mailto:a@example.com"));
+        BOOST_TEST_EQ(d.size(kind::host), 1u);
+        BOOST_TEST_EQ(d.get(kind::host, 0), "www.example.com");
+        BOOST_TEST_EQ(d.size(kind::segment), 6u);
+        BOOST_TEST_EQ(d.find(kind::segment, "docs"), 0u);
+        BOOST_TEST_EQ(d.find(kind::segment, ""), 2u);
+        BOOST_TEST_EQ(d.find(kind::segment, "a@example.com"), 5u);
+        BOOST_TEST_EQ(d.size(kind::key), 2u);
+        BOOST_TEST_EQ(d.get(kind::key, 1), "lang");
+    }
+
+    void
+    run()
+    {
+        testInsert();
+        testInsertUrl();
+    }
+};
+
+TEST_SUITE(
+    url_dictionary_test,
+    "boost.url.url_dictionary");
+
+} // urls
+} // boost
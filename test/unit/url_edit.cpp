@@ -0,0 +1,381 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_edit.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+struct url_edit_test
+{
+    // for each component, 0 keeps
+    // it, 1 sets it, 2 removes it
+    struct edits
+    {
+        int scheme = 0;
+        char const* scheme_s = nullptr;
+        int authority = 0;
+        int user = 0;
+        char const* user_s = nullptr;
+        int pass = 0;
+        char const* pass_s = nullptr;
+        int host = 0;
+        char const* host_s = nullptr;
+        int port = 0;
+        char const* port_s = nullptr;
+        int path = 0;
+        char const* path_s = nullptr;
+        int query = 0;
+        char const* query_s = nullptr;
+        int frag = 0;
+        char const* frag_s = nullptr;
+    };
+
+    static
+    url_edit
+    make_edit(edits const& e)
+    {
+        url_edit ed;
+        if(e.scheme == 1)
+            ed.set_scheme(e.scheme_s);
+        else if(e.scheme == 2)
+            ed.remove_scheme();
+        if(e.authority == 2)
+            ed.remove_authority();
+        if(e.user == 2)
+            ed.remove_userinfo();
+        if(e.user == 1)
+            ed.set_encoded_user(e.user_s);
+        if(e.pass == 1)
+            ed.set_encoded_password(e.pass_s);
+        if(e.host == 1)
+            ed.set_encoded_host(e.host_s);
+        if(e.port == 1)
+            ed.set_port(e.port_s);
+        else if(e.port == 2)
+            ed.remove_port();
+        if(e.path == 1)
+            ed.set_encoded_path(e.path_s);
+        if(e.query == 1)
+            ed.set_encoded_query(e.query_s);
+        else if(e.query == 2)
+            ed.remove_query();
+        if(e.frag == 1)
+            ed.set_encoded_fragment(e.frag_s);
+        else if(e.frag == 2)
+            ed.remove_fragment();
+        return ed;
+    }
+
+    // the same edits, one setter at a time
+    static
+    void
+    apply_each(url_base& u, edits const& e)
+    {
+        if(e.scheme == 1)
+            u.set_scheme(e.scheme_s);
+        else if(e.scheme == 2)
+            u.remove_scheme();
+        if(e.authority == 2)
+            u.remove_authority();
+        if(e.user == 2)
+            u.remove_userinfo();
+        if(e.user == 1)
+            u.set_encoded_user(e.user_s);
+        if(e.pass == 1)
+            u.set_encoded_password(e.pass_s);
+        if(e.host == 1)
+            u.set_encoded_host(e.host_s);
+        if(e.port == 1)
+            u.set_port(e.port_s);
+        else if(e.port == 2)
+            u.remove_port();
+        if(e.path == 1)
+            u.set_encoded_path(e.path_s);
+        if(e.query == 1)
+            u.set_encoded_query(e.query_s);
+        else if(e.query == 2)
+            u.remove_query();
+        if(e.frag == 1)
+            u.set_encoded_fragment(e.frag_s);
+        else if(e.frag == 2)
+            u.remove_fragment();
+    }
+
+    static
+    void
+    check(
+        core::string_view s,
+        edits const& e)
+    {
+        url u0(s);
+        apply_each(u0, e);
+        url u1(s);
+        make_edit(e).apply(u1);
+        if(! BOOST_TEST_EQ(u1.buffer(), u0.buffer()))
+            test_suite::log << "\"" << s << "\"\n";
+        // the components are
+        // the ones of the string
+        url_view const v =
+            parse_uri_reference(
+                u0.buffer()).value();
+        BOOST_TEST(u1.scheme_id() == v.scheme_id());
+        BOOST_TEST(u1.host_type() == v.host_type());
+        BOOST_TEST_EQ(u1.port_number(), v.port_number());
+        BOOST_TEST_EQ(
+            u1.encoded_host().decoded_size(),
+            v.encoded_host().decoded_size());
+        BOOST_TEST_EQ(
+            u1.encoded_segments().size(),
+            v.encoded_segments().size());
+        BOOST_TEST_EQ(
+            u1.encoded_params().size(),
+            v.encoded_params().size());
+        BOOST_TEST_EQ(
+            u1.encoded_path().decoded_size(),
+            v.encoded_path().decoded_size());
+    }
+
+    void
+    testSpecial()
+    {
+        // url_edit()
+        {
+            url u("http://h/p?q#f");
+            url_edit e;
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "http://h/p?q#f");
+        }
+
+        // clear()
+        {
+            url u("http://h/p?q#f");
+            url_edit e;
+            e.set_scheme("https");
+            e.clear();
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "http://h/p?q#f");
+        }
+    }
+
+    void
+    testApply()
+    {
+        {
+            url_edit e;
+            e.set_scheme("https")
+             .set_encoded_host("backend.internal")
+             .set_port_number(8443)
+             .set_encoded_path("/v2/items");
+
+            url u("http://example.com/items?id=42");
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(),
+                "https://backend.internal:8443/v2/items?id=42");
+            BOOST_TEST(u.scheme_id() == scheme::https);
+            BOOST_TEST_EQ(u.port_number(), 8443);
+            BOOST_TEST_EQ(u.segments().size(), 2u);
+            BOOST_TEST_EQ(u.params().size(), 1u);
+
+            // reuse
+            url u2("ws://a.b:1/");
+            e.apply(u2);
+            BOOST_TEST_EQ(u2.buffer(),
+                "https://backend.internal:8443/v2/items");
+        }
+        {
+            url_edit e;
+            e.set_user("a b")
+             .set_password("c:d")
+             .set_host("[::1]")
+             .set_path("x y")
+             .set_query("k=v w")
+             .set_fragment("f g");
+            url u("z:");
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(),
+                "z://a%20b:c:d@[::1]/x%20y?k=v%20w#f%20g");
+            BOOST_TEST(u.host_type() == host_type::ipv6);
+            BOOST_TEST_EQ(u.user(), "a b");
+            BOOST_TEST_EQ(u.password(), "c:d");
+        }
+        {
+            url_edit e;
+            e.set_host("1.2.3.4").remove_query();
+            url u("/p?q");
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "//1.2.3.4/p");
+            BOOST_TEST(u.host_type() == host_type::ipv4);
+        }
+        {
+            url_edit e;
+            e.set_scheme_id(scheme::ftp);
+            url u;
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "ftp:");
+            e.set_scheme_id(scheme::none);
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "");
+        }
+
+        // path adjustments
+        {
+            url u("x:a:b");
+            url_edit e;
+            e.remove_scheme();
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "a%3Ab");
+        }
+        {
+            url u("x://h//a");
+            url_edit e;
+            e.remove_authority();
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "x:/.//a");
+        }
+        {
+            url u("a/b");
+            url_edit e;
+            e.set_host("h");
+            e.apply(u);
+            BOOST_TEST_EQ(u.buffer(), "//h/a/b");
+        }
+    }
+
+    void
+    testErrors()
+    {
+        url_edit e;
+        BOOST_TEST_THROWS(
+            e.set_scheme("1x"),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            e.set_scheme_id(scheme::unknown),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            e.set_port("8x"),
+            system::system_error);
+
+        // strong guarantee
+        e.set_scheme("https")
+         .set_host("a-very-long-host-name");
+        static_url<16> u("x:y");
+        BOOST_TEST_THROWS(
+            e.apply(u),
+            std::exception);
+        BOOST_TEST_EQ(u.buffer(), "x:y");
+        static_url<64> u2("x:y");
+        e.apply(u2);
+        BOOST_TEST_EQ(u2.buffer(),
+            "https://a-very-long-host-name/y");
+    }
+
+    void
+    testSetters()
+    {
+        // agrees with the setters
+        core::string_view const urls[] = {
+            "",
+            "a",
+            "/",
+            "//",
+            "x:",
+            "x:a:b",
+            "x:./ab:c",
+            "x:./a",
+            "x:/a",
+            "x://",
+            "x://h",
+            "x://h/",
+            "x://h//a",
+            "x://u@h",
+            "x://u:p@h:80",
+            "x://:p@h",
+            "x://@h",
+            "x://h:/p",
+            "//h?q",
+            "?q#f",
+            "#f",
+            "a/b?q",
+            "./a:b",
+            "http://u:p@example.com:8080/a/b?k=v#frag",
+            "http://[::1]:80/",
+            "mailto:joe@example.com",
+        };
+        char const* const schemes[] = { "https", "y" };
+        char const* const users[] = { "", "u2", "a%20b" };
+        char const* const passes[] = { "", "p2", "c:d" };
+        char const* const hosts[] = {
+            "", "h2", "1.2.3.4", "[::2]", "[v1.z]" };
+        char const* const ports[] = { "", "8080" };
+        char const* const paths[] = {
+            "", "/", "a", "a:b/c", "/x/y", "//z", "./p:q" };
+        char const* const queries[] = { "", "a=1&b" };
+        char const* const frags[] = { "", "g" };
+
+        std::uint32_t r = 1;
+        auto const next = [&r](std::uint32_t n)
+        {
+            r = r * 1103515245 + 12345;
+            return static_cast<int>(
+                (r >> 16) % n);
+        };
+        for(auto s : urls)
+        {
+            for(int i = 0; i < 400; ++i)
+            {
+                edits e;
+                e.scheme = next(3);
+                e.scheme_s = schemes[next(2)];
+                e.authority = next(4) == 0 ? 2 : 0;
+                e.user = next(4);
+                if(e.user == 3)
+                    e.user = 0;
+                e.user_s = users[next(3)];
+                e.pass = next(3) == 0;
+                e.pass_s = passes[next(3)];
+                e.host = next(3) == 0;
+                e.host_s = hosts[next(5)];
+                e.port = next(3);
+                e.port_s = ports[next(2)];
+                e.path = next(2);
+                e.path_s = paths[next(7)];
+                e.query = next(3);
+                e.query_s = queries[next(2)];
+                e.frag = next(3);
+                e.frag_s = frags[next(2)];
+                check(s, e);
+            }
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testApply();
+        testErrors();
+        testSetters();
+    }
+};
+
+TEST_SUITE(
+    url_edit_test,
+    "boost.url.url_edit");
+
+} // urls
+} // boost
@@ -0,0 +1,313 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_index.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct url_index_test
+{
+    // the index agrees with iteration
+    static
+    void
+    check(
+        url_index const& idx,
+        url_view_base const& u)
+    {
+        auto const segs = u.encoded_segments();
+        BOOST_TEST_EQ(idx.segments_size(), segs.size());
+        std::size_t i = 0;
+        for(pct_string_view s : segs)
+        {
+            if(! BOOST_TEST_LT(i, idx.segments_size()))
+                return;
+            auto const s1 = idx.segment(i);
+            BOOST_TEST_EQ(s1, s);
+            BOOST_TEST_EQ(s1.data(), s.data());
+            BOOST_TEST_EQ(
+                s1.decoded_size(), s.decoded_size());
+            ++i;
+        }
+
+        auto const params = u.encoded_params();
+        BOOST_TEST_EQ(idx.params_size(), params.size());
+        i = 0;
+        for(param_pct_view p : params)
+        {
+            if(! BOOST_TEST_LT(i, idx.params_size()))
+                return;
+            auto const p1 = idx.param(i);
+            BOOST_TEST_EQ(p1.key, p.key);
+            BOOST_TEST_EQ(p1.key.data(), p.key.data());
+            BOOST_TEST_EQ(
+                p1.key.decoded_size(), p.key.decoded_size());
+            BOOST_TEST_EQ(p1.has_value, p.has_value);
+            BOOST_TEST_EQ(p1.value, p.value);
+            BOOST_TEST_EQ(
+                p1.value.decoded_size(), p.value.decoded_size());
+            ++i;
+        }
+    }
+
+    static
+    void
+    check(core::string_view s)
+    {
+        url_view u(s);
+        url_index idx(u);
+        check(idx, u);
+    }
+
+    void
+    testSpecial()
+    {
+        // url_index()
+        {
+            url_index idx;
+            BOOST_TEST_EQ(idx.segments_size(), 0u);
+            BOOST_TEST_EQ(idx.params_size(), 0u);
+        }
+
+        // url_index(url_view_base const&)
+        {
+            url_view u("/api/v1/users/42?fields=name&sort=asc");
+            url_index idx(u);
+            BOOST_TEST_EQ(idx.segments_size(), 4u);
+            BOOST_TEST_EQ(idx.segment(3), "42");
+            BOOST_TEST_EQ(idx.params_size(), 2u);
+            BOOST_TEST_EQ(idx.param(1).key, "sort");
+            BOOST_TEST_EQ(idx.param(1).value, "asc");
+        }
+
+        // url_index(url_index const&)
+        {
+            url_view u("/a/b?c=d");
+            url_index idx(u);
+            url_index idx2(idx);
+            check(idx2, u);
+        }
+        {
+            std::string s = "/x";
+            for(int i = 0; i < 50; ++i)
+                s += "/s" + std::to_string(i);
+            url_view u(s);
+            url_index idx(u);
+            url_index idx2(idx);
+            check(idx2, u);
+        }
+
+        // operator=(url_index const&)
+        {
+            url_view u0("/a/b?c=d");
+            std::string s = "/x?";
+            for(int i = 0; i < 50; ++i)
+                s += "k" + std::to_string(i) + "=v&";
+            url_view u1(s);
+            url_index idx0(u0);
+            url_index idx1(u1);
+            url_index idx;
+            idx = idx0;
+            check(idx, u0);
+            idx = idx1;
+            check(idx, u1);
+            idx = idx0;
+            check(idx, u0);
+            idx = idx;
+            check(idx, u0);
+        }
+    }
+
+    void
+    testAssign()
+    {
+        url_index idx;
+        url_view u0("/a/b/c?x=1&y");
+        idx.assign(u0);
+        check(idx, u0);
+
+        std::string s = "/";
+        for(int i = 0; i < 100; ++i)
+        {
+            s += "seg" + std::to_string(i);
+            s += '/';
+        }
+        s += '?';
+        for(int i = 0; i < 100; ++i)
+            s += "key" + std::to_string(i) + "=value&";
+        url_view u1(s);
+        idx.assign(u1);
+        check(idx, u1);
+        BOOST_TEST_EQ(idx.segment(57), "seg57");
+        BOOST_TEST_EQ(idx.param(99).key, "key99");
+
+        // the storage is reused
+        idx.assign(u0);
+        check(idx, u0);
+        idx.assign(url_view());
+        check(idx, url_view());
+    }
+
+    void
+    testUrls()
+    {
+        check("");
+        check("/");
+        check("//");
+        check("x");
+        check("http://www.example.com");
+        check("http://www.example.com/");
+        check("http://www.example.com/a%20b/c%2Fd/");
+        check("a//b///c");
+        check("../../x");
+        check("./a:b");
+        check("mailto:someone@example.com");
+        check("?");
+        check("?&");
+        check("?&&=");
+        check("/path?a&b=&=c&%41=%42");
+        check("http://u@h:1/p/q?k=v#f");
+
+        // urls are indexed in place
+        url u("http://example.com/a/b?k=v");
+        url_index idx(u);
+        check(idx, u);
+        u.segments().push_back("c");
+        idx.assign(u);
+        check(idx, u);
+        BOOST_TEST_EQ(idx.segment(2), "c");
+    }
+
+    void
+    testIterators()
+    {
+        // empty
+        {
+            url_index idx;
+            BOOST_TEST(idx.segments_begin() ==
+                idx.segments_end());
+            BOOST_TEST(idx.params_begin() ==
+                idx.params_end());
+        }
+
+        std::string s = "/";
+        for(int i = 0; i < 100; ++i)
+        {
+            s += "seg" + std::to_string(1000 + i);
+            s += '/';
+        }
+        s += '?';
+        for(int i = 0; i < 100; ++i)
+            s += "key" + std::to_string(1000 + i) + "=v&";
+        url_view u(s);
+        url_index idx(u);
+
+        // the iterators agree with
+        // segment(i) and param(i)
+        {
+            auto it = idx.segments_begin();
+            BOOST_TEST_EQ(idx.segments_end() - it,
+                static_cast<std::ptrdiff_t>(
+                    idx.segments_size()));
+            for(std::size_t i = 0;
+                i < idx.segments_size(); ++i, ++it)
+                BOOST_TEST_EQ(*it, idx.segment(i));
+            BOOST_TEST(it == idx.segments_end());
+        }
+        {
+            auto it = idx.params_end();
+            BOOST_TEST_EQ(it - idx.params_begin(),
+                static_cast<std::ptrdiff_t>(
+                    idx.params_size()));
+            for(std::size_t i = idx.params_size(); i > 0;)
+            {
+                --it;
+                --i;
+                BOOST_TEST_EQ(it->key, idx.param(i).key);
+                BOOST_TEST_EQ(it->has_value,
+                    idx.param(i).has_value);
+            }
+            BOOST_TEST(it == idx.params_begin());
+        }
+
+        // random access
+        {
+            auto const first = idx.segments_begin();
+            auto const last = idx.segments_end();
+            BOOST_TEST_EQ(first[42], "seg1042");
+            BOOST_TEST_EQ(*(first + 10), "seg1010");
+            BOOST_TEST_EQ(*(10 + first), "seg1010");
+            BOOST_TEST_EQ(*(last - 2), "seg1099");
+            auto it = first;
+            it += 5;
+            BOOST_TEST(it > first);
+            BOOST_TEST(it >= first);
+            BOOST_TEST(first < it);
+            BOOST_TEST(first <= it);
+            it -= 5;
+            BOOST_TEST(it == first);
+            BOOST_TEST_EQ(
+                *std::next(first, 77), "seg1077");
+            BOOST_TEST_EQ(
+                std::distance(first, last), 101);
+        }
+
+        // the segments are sorted except
+        // for the last, which is empty
+        {
+            auto const first = idx.segments_begin();
+            auto const last =
+                std::prev(idx.segments_end());
+            BOOST_TEST(std::is_sorted(first, last));
+            auto it = std::lower_bound(
+                first, last, "seg1063");
+            BOOST_TEST_EQ(it - first, 63);
+            it = std::lower_bound(
+                first, last, "seg2000");
+            BOOST_TEST(it == last);
+        }
+        {
+            auto const first = idx.params_begin();
+            auto const last = std::prev(idx.params_end());
+            auto it = std::lower_bound(first, last,
+                "key1050",
+                [](param_pct_view p, core::string_view k)
+                {
+                    return p.key < k;
+                });
+            BOOST_TEST_EQ(it->key, "key1050");
+            BOOST_TEST_EQ(it->value, "v");
+        }
+    }
+
+    void
+    run()
+    {
+        testSpecial();
+        testAssign();
+        testUrls();
+        testIterators();
+    }
+};
+
+TEST_SUITE(
+    url_index_test,
+    "boost.url.url_index");
+
+} // urls
+} // boost
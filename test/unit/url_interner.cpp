@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_interner.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+
+struct url_interner_test
+{
+    void
+    testIntern()
+    {
+        url_interner t;
+        BOOST_TEST(t.empty());
+        BOOST_TEST_EQ(t.arena_size(), 0u);
+
+        auto const id0 = t.intern(url_view(
+            "HTTP://www.Example.com/a/./b"));
+        BOOST_TEST_EQ(id0, 0u);
+        BOOST_TEST_EQ(t.size(), 1u);
+        BOOST_TEST_GT(t.arena_size(), 0u);
+
+        // equal spellings
+        BOOST_TEST_EQ(t.intern(url_view(
+            "http://www.example.com/a/b")), id0);
+        BOOST_TEST_EQ(t.intern(url_view(
+            "http://www.example.com/a/%62")), id0);
+        BOOST_TEST_EQ(t.size(), 1u);
+
+        // the normalized copy
+        url_view u = t.view(id0);
+        BOOST_TEST_EQ(u.buffer(),
+            "http://www.example.com/a/b");
+        BOOST_TEST_EQ(u.encoded_host(), "www.example.com");
+        BOOST_TEST_EQ(u.segments().size(), 2u);
+        BOOST_TEST_EQ(t[id0].buffer(), u.buffer());
+
+        auto const id1 = t.intern(url_view(
+            "https://[::1]:8080/x?a=1&b=2#f"));
+        BOOST_TEST_EQ(id1, 1u);
+        u = t.view(id1);
+        BOOST_TEST_EQ(u.host_type(), host_type::ipv6);
+        BOOST_TEST(u.host_ipv6_address() ==
+            ipv6_address("::1"));
+        BOOST_TEST_EQ(u.port_number(), 8080);
+        BOOST_TEST_EQ(u.params().size(), 2u);
+        BOOST_TEST_EQ(u.encoded_fragment(), "f");
+
+        // the argument is not referenced
+        {
+            std::string s = "mailto:someone@example.com";
+            auto const id2 = t.intern(url_view(s));
+            s.assign(s.size(), 'x');
+            BOOST_TEST_EQ(t.view(id2).buffer(),
+                "mailto:someone@example.com");
+        }
+
+        // the views remain valid
+        for(int i = 0; i < 2000; ++i)
+            t.intern(url_view(
+                "http://h/" + std::to_string(i)));
+        BOOST_TEST_EQ(t.size(), 2003u);
+        BOOST_TEST_EQ(u.buffer(),
+            "https://[::1]:8080/x?a=1&b=2#f");
+        BOOST_TEST_EQ(t.view(3).buffer(), "http://h/0");
+        BOOST_TEST_EQ(t.view(2002).buffer(), "http://h/1999");
+    }
+
+    void
+    testFind()
+    {
+        url_interner t(4);
+        BOOST_TEST_EQ(t.find(url_view("x:")),
+            url_interner::npos);
+        BOOST_TEST(! t.contains(url_view("x:")));
+        auto const id = t.intern(url_view("X:/%7e"));
+        BOOST_TEST_EQ(t.find(url_view("x:/~")), id);
+        BOOST_TEST(t.contains(url_view("x:/%7E")));
+        BOOST_TEST_EQ(t.find(url_view("x:/y")),
+            url_interner::npos);
+        BOOST_TEST_EQ(t.size(), 1u);
+
+        // long urls get their own chunk
+        std::string s = "http://h/";
+        s.append(100000, 'a');
+        auto const id1 = t.intern(url_view(s));
+        auto const id2 = t.intern(url_view("y:"));
+        BOOST_TEST_EQ(t.view(id1).buffer(), s);
+        BOOST_TEST_EQ(t.view(id2).buffer(), "y:");
+        BOOST_TEST_EQ(t.find(url_view(s)), id1);
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        url_interner t;
+        std::vector<std::string> v;
+        for(int i = 0; i < 500; ++i)
+            v.push_back("http://example.com/" +
+                std::to_string(i % 250));
+        std::vector<std::vector<
+            url_interner::id_type>> ids(4);
+        std::vector<std::thread> threads;
+        for(std::size_t i = 0; i < ids.size(); ++i)
+            threads.emplace_back([&, i]
+            {
+                for(auto const& s : v)
+                {
+                    auto const id =
+                        t.intern(url_view(s));
+                    ids[i].push_back(id);
+                    if(t.view(id).buffer() != s)
+                        ids[i].push_back(
+                            url_interner::npos);
+                }
+            });
+        for(auto& th : threads)
+            th.join();
+        BOOST_TEST_EQ(t.size(), 250u);
+        for(auto const& w : ids)
+        {
+            BOOST_TEST(w == ids[0]);
+            BOOST_TEST_EQ(w.size(), v.size());
+        }
+#endif
+    }
+
+    void
+    run()
+    {
+        testIntern();
+        testFind();
+        testThreads();
+    }
+};
+
+TEST_SUITE(
+    url_interner_test,
+    "boost.url.url_interner");
+
+} // urls
+} // boost
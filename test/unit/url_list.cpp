@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_list.hpp>
+
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/error.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct url_list_test
+{
+    static
+    std::vector<std::string>
+    make_urls(std::size_t n)
+    {
+        std::vector<std::string> v;
+        v.push_back("");
+        v.push_back("/");
+        v.push_back("http://a.com");
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            v.push_back(
+                "http://www.example.com/docs/" +
+                std::to_string(i % 17) + "/p" +
+                std::to_string(i) + "?q=" +
+                std::to_string(i % 3));
+        }
+        v.push_back("http://www.example.com/docs/1");
+        v.push_back("http://www.example.com/docs/1/");
+        v.push_back("https://www.example.com/");
+        v.push_back("https://www.example.com/");
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    static
+    void
+    check(
+        std::vector<std::string> const& v,
+        std::size_t interval)
+    {
+        url_list_builder b(interval);
+        for(auto const& s : v)
+            b.push_back(url_view(s));
+        BOOST_TEST_EQ(b.size(), v.size());
+        std::string const image = b.release();
+        BOOST_TEST_EQ(b.size(), 0u);
+
+        url_list_view const ul(image);
+        BOOST_TEST_EQ(ul.size(), v.size());
+        BOOST_TEST(ul.data() == image);
+        std::string buf;
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            url_view const u = ul.get(i, buf);
+            BOOST_TEST_EQ(u.buffer(), v[i]);
+            BOOST_TEST_EQ(u.buffer().data(), buf.data());
+
+            char tmp[64];
+            auto rv = ul.get(i, tmp, sizeof(tmp));
+            if(v[i].size() <= sizeof(tmp))
+            {
+                BOOST_TEST_EQ(rv->buffer(), v[i]);
+                BOOST_TEST_EQ(
+                    rv->encoded_path(),
+                    url_view(v[i]).encoded_path());
+            }
+            else
+            {
+                BOOST_TEST_EQ(rv.error(), error::no_space);
+            }
+            if(! v[i].empty())
+            {
+                BOOST_TEST_EQ(
+                    ul.get(i, tmp, v[i].size() - 1).error(),
+                    error::no_space);
+            }
+        }
+
+        // lower_bound agrees with std::lower_bound
+        std::vector<std::string> keys = v;
+        keys.push_back("");
+        keys.push_back("a");
+        keys.push_back("http://www.example.com/docs/");
+        keys.push_back("http://www.example.com/docs/1/p");
+        keys.push_back("http://www.example.com/docs/16/p999");
+        keys.push_back("z");
+        for(auto const& s : v)
+        {
+            std::string k = s;
+            k.push_back('!');
+            keys.push_back(k);
+            if(! s.empty())
+            {
+                k = s;
+                k.pop_back();
+                keys.push_back(k);
+                k = s;
+                ++k.back();
+                keys.push_back(k);
+            }
+        }
+        for(auto const& k : keys)
+        {
+            std::size_t const e = static_cast<std::size_t>(
+                std::lower_bound(v.begin(), v.end(), k) -
+                    v.begin());
+            if(! BOOST_TEST_EQ(ul.lower_bound(k), e))
+                test_suite::log << "\"" << k << "\"\n";
+        }
+    }
+
+    void
+    testList()
+    {
+        auto v = make_urls(200);
+        check(v, 1);
+        check(v, 2);
+        check(v, 16);
+        check(v, 64);
+        check({ "x:" }, 16);
+        check({}, 16);
+
+        // front coding makes the image smaller
+        std::size_t n = 0;
+        for(auto const& s : v)
+            n += s.size();
+        url_list_builder b;
+        for(auto const& s : v)
+            b.push_back(url_view(s));
+        BOOST_TEST_LT(b.release().size(), n / 2);
+
+        // the builder can be reused
+        b.push_back(url_view("y:"));
+        std::string const image = b.release();
+        url_list_view ul(image);
+        BOOST_TEST_EQ(ul.size(), 1u);
+    }
+
+    void
+    testErrors()
+    {
+        BOOST_TEST_THROWS(
+            url_list_builder(0), system::system_error);
+        BOOST_TEST_THROWS(
+            url_list_builder(65), system::system_error);
+
+        // not sorted
+        {
+            url_list_builder b;
+            b.push_back(url_view("b:"));
+            BOOST_TEST_THROWS(
+                b.push_back(url_view("a:")),
+                system::system_error);
+            b.push_back(url_view("b:"));
+            BOOST_TEST_EQ(b.size(), 2u);
+        }
+
+        // damaged images
+        url_list_builder b;
+        b.push_back(url_view("http://a/1"));
+        b.push_back(url_view("http://a/2"));
+        std::string const image = b.release();
+        BOOST_TEST_THROWS(
+            url_list_view(""), system::system_error);
+        BOOST_TEST_THROWS(
+            url_list_view(image.substr(1)),
+            system::system_error);
+        {
+            std::string s = image;
+            s.back() = 'x';
+            BOOST_TEST_THROWS(
+                url_list_view(s), system::system_error);
+        }
+        {
+            // a bad shared length
+            std::string s = image;
+            s[12] = '\x40';
+            url_list_view const ul(s);
+            char buf[64];
+            BOOST_TEST_EQ(
+                ul.get(0, buf, sizeof(buf)).value().buffer(),
+                "http://a/1");
+            BOOST_TEST_EQ(
+                ul.get(1, buf, sizeof(buf)).error(),
+                grammar::error::invalid);
+            std::string str;
+            BOOST_TEST_THROWS(
+                ul.get(1, str),
+                system::system_error);
+        }
+        {
+            // a bad url
+            std::string s = image;
+            s[2] = '%';
+            url_list_view const ul(s);
+            char buf[64];
+            BOOST_TEST(ul.get(0, buf, sizeof(buf)).has_error());
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        url_list_builder b;
+        b.push_back( url_view( "https://www.example.com/docs/a" ) );
+        b.push_back( url_view( "https://www.example.com/docs/b" ) );
+        std::string image = b.release();
+
+        url_list_view v( image );
+        std::string buf;
+        BOOST_TEST( v.get( 1, buf ).path() == "/docs/b" );
+    }
+
+    void
+    run()
+    {
+        testList();
+        testErrors();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_list_test,
+    "boost.url.url_list");
+
+} // urls
+} // boost
@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_map.hpp>
+
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct url_map_test
+{
+    // throws when constructed from -1
+    struct thrower
+    {
+        int v = 0;
+
+        thrower() = default;
+
+        explicit
+        thrower(int v_)
+            : v(v_)
+        {
+            if(v < 0)
+                throw std::runtime_error("thrower");
+        }
+    };
+
+    void
+    testInsert()
+    {
+        url_map<int> m;
+        BOOST_TEST(m.empty());
+        BOOST_TEST(m.begin() == m.end());
+        BOOST_TEST(m.find(url_view("x:y")) == m.end());
+
+        auto r = m.insert(url_view("http://a.b/c/./d"), 1);
+        BOOST_TEST(r.second);
+        BOOST_TEST_EQ((*r.first).first.buffer(), "http://a.b/c/./d");
+        BOOST_TEST_EQ((*r.first).second, 1);
+
+        r = m.insert(url_view("HTTP://A.B/c/%64"), 2);
+        BOOST_TEST(! r.second);
+        BOOST_TEST_EQ((*r.first).second, 1);
+
+        r = m.emplace(url_view("http://a.b/e"), 3);
+        BOOST_TEST(r.second);
+        BOOST_TEST_EQ(m.size(), 2u);
+
+        // operator[]
+        m[url_view("http://a.b/c/d")] += 10;
+        BOOST_TEST_EQ(m[url("http://a.b/c/x/../d")], 11);
+        BOOST_TEST_EQ(m[url_view("http://a.b/f")], 0);
+        BOOST_TEST_EQ(m.size(), 3u);
+        BOOST_TEST(m.contains(url_view("http://A.B/f")));
+        BOOST_TEST_EQ(m.count(url_view("http://a.b/g")), 0u);
+
+        // modify through iterators
+        (*m.find(url_view("http://a.b/e"))).second = 4;
+        url_map<int> const& cm = m;
+        BOOST_TEST_EQ((*cm.find(url_view("http://a.b/e"))).second, 4);
+        BOOST_TEST(cm.find(url_view("http://a.b/g")) == cm.end());
+
+        // insertion order
+        int const e[] = { 11, 4, 0 };
+        std::size_t i = 0;
+        for(auto kv : cm)
+            BOOST_TEST_EQ(kv.second, e[i++]);
+        BOOST_TEST_EQ(i, 3u);
+        url_map<int>::const_iterator it = m.begin();
+        BOOST_TEST(it == cm.begin());
+        ++it;
+        BOOST_TEST_EQ((*it).first.buffer(), "http://a.b/e");
+
+        // move-only values
+        url_map<std::unique_ptr<int>> mp;
+        mp.emplace(url_view("x:y"), new int(5));
+        mp.insert(url_view("x:z"), std::unique_ptr<int>(new int(6)));
+        BOOST_TEST_EQ(*mp[url_view("X:y")], 5);
+        BOOST_TEST_EQ(*mp[url_view("x:z")], 6);
+    }
+
+    void
+    testExceptions()
+    {
+        url_map<thrower> m;
+        m.emplace(url_view("x:a"), 1);
+        BOOST_TEST_THROWS(
+            m.emplace(url_view("x:b"), -1),
+            std::runtime_error);
+        BOOST_TEST_EQ(m.size(), 1u);
+        BOOST_TEST(! m.contains(url_view("x:b")));
+
+        // the value is not constructed
+        // when the key exists
+        BOOST_TEST(! m.emplace(url_view("x:a"), -1).second);
+
+        m.emplace(url_view("x:b"), 2);
+        BOOST_TEST_EQ(m[url_view("x:b")].v, 2);
+        BOOST_TEST_EQ(m.size(), 2u);
+    }
+
+    void
+    testGrowth()
+    {
+        url_map<std::size_t> m;
+        m.reserve(10);
+        for(std::size_t i = 0; i < 1000; ++i)
+        {
+            std::string const s =
+                "/" + std::to_string(i);
+            BOOST_TEST(m.insert(url_view(s), i).second);
+        }
+        for(std::size_t i = 0; i < 1000; ++i)
+        {
+            std::string const s =
+                "/./" + std::to_string(i);
+            BOOST_TEST_EQ(m[url_view(s)], i);
+        }
+        BOOST_TEST_EQ(m.size(), 1000u);
+
+        url_map<std::size_t> m1;
+        m1.swap(m);
+        BOOST_TEST(m.empty());
+        BOOST_TEST_EQ(m1.size(), 1000u);
+        m1.clear();
+        BOOST_TEST(m1.empty());
+        BOOST_TEST(! m1.contains(url_view("/1")));
+    }
+
+    void
+    testJavadocs()
+    {
+        url_map< int > m;
+        m[ url_view( "http://www.example.com/a/./b" ) ] = 1;
+        m[ url_view( "HTTP://www.EXAMPLE.com/a/%62" ) ] += 1;
+        BOOST_TEST( m.size() == 1 );
+        BOOST_TEST( (*m.find( url_view( "http://www.example.com/a/b" ) )).second == 2 );
+    }
+
+    void
+    run()
+    {
+        testInsert();
+        testExceptions();
+        testGrowth();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_map_test,
+    "boost.url.url_map");
+
+} // urls
+} // boost
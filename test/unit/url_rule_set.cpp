@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_rule_set.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_rule_set_test
+{
+    using ids_t = std::vector<std::size_t>;
+
+    static
+    ids_t
+    match(
+        url_rule_set const& rs,
+        core::string_view s)
+    {
+        ids_t ids;
+        url_view u(s);
+        std::size_t const n = rs.match(u, ids);
+        BOOST_TEST_EQ(n, ids.size());
+        BOOST_TEST_EQ(rs.match_any(u), ! ids.empty());
+        return ids;
+    }
+
+    void
+    testEmpty()
+    {
+        url_rule_set rs;
+        BOOST_TEST(rs.empty());
+        BOOST_TEST_EQ(rs.size(), 0u);
+        BOOST_TEST(match(rs, "http://example.com/").empty());
+        BOOST_TEST(match(rs, "").empty());
+
+        // an empty rule matches everything
+        rs.insert(1, {});
+        BOOST_TEST(! rs.empty());
+        BOOST_TEST_EQ(rs.size(), 1u);
+        BOOST_TEST(match(rs, "http://example.com/") == ids_t{1});
+        BOOST_TEST(match(rs, "") == ids_t{1});
+        BOOST_TEST(match(rs, "x:y") == ids_t{1});
+    }
+
+    void
+    testHost()
+    {
+        url_rule_set rs;
+        rs.insert(1, {"example.com", {}, {}});
+        rs.insert(2, {"ads.example.com.", {}, {}});
+        rs.insert(3, {".Tracker.NET", {}, {}});
+        rs.insert(4, {"a..b", {}, {}});
+
+        BOOST_TEST(match(rs, "http://example.com") == ids_t{1});
+        BOOST_TEST(match(rs, "http://www.example.com/") == ids_t{1});
+        BOOST_TEST(match(rs, "http://ads.example.com/x") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "http://x.ADS.Example.COM./") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "http://ads%2Eexample.com/") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "http://%61ds.example.com/") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "http://tracker.net") == ids_t{3});
+        BOOST_TEST(match(rs, "http://a..b") == ids_t{4});
+        BOOST_TEST(match(rs, "http://badexample.com/").empty());
+        BOOST_TEST(match(rs, "http://example.com.au/").empty());
+        BOOST_TEST(match(rs, "http://com/").empty());
+        BOOST_TEST(match(rs, "http://a.b/").empty());
+        BOOST_TEST(match(rs, "/example.com").empty());
+    }
+
+    void
+    testPath()
+    {
+        url_rule_set rs;
+        rs.insert(1, {"", "/ads", {}});
+        rs.insert(2, {"", "/ads/", {}});
+        rs.insert(3, {"", "/a b/c", {}});
+        rs.insert(4, {"h", "/", {}});
+
+        BOOST_TEST(match(rs, "http://h/ads") == (ids_t{1, 4}));
+        BOOST_TEST(match(rs, "http://x/ads") == ids_t{1});
+        BOOST_TEST(match(rs, "http://x/ads/") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "http://x/ads/banner.png") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "/ads/a/b") == (ids_t{1, 2}));
+        BOOST_TEST(match(rs, "ads") == ids_t{1});
+        BOOST_TEST(match(rs, "http://x/adsense").empty());
+        BOOST_TEST(match(rs, "http://x/ADS").empty());
+        BOOST_TEST(match(rs, "http://x/x/ads").empty());
+        BOOST_TEST(match(rs, "http://x/a%20b/c/d") == ids_t{3});
+        BOOST_TEST(match(rs, "http://x/a%20b/c%2Fd").empty());
+        BOOST_TEST(match(rs, "http://x/a%20b").empty());
+        BOOST_TEST(match(rs, "http://h") == ids_t{4});
+    }
+
+    void
+    testParam()
+    {
+        url_rule_set rs;
+        rs.insert(1, {"", "", "utm_source"});
+        rs.insert(2, {"example.com", "/p", "id"});
+        rs.insert(3, {"example.com", "/p", {}});
+
+        BOOST_TEST(match(rs, "http://x/?utm_source=a") == ids_t{1});
+        BOOST_TEST(match(rs, "http://x/?utm_%73ource") == ids_t{1});
+        BOOST_TEST(match(rs, "http://x/?UTM_SOURCE=a").empty());
+        BOOST_TEST(match(rs, "http://x/#utm_source").empty());
+        BOOST_TEST(match(rs, "http://example.com/p?id=1") == (ids_t{2, 3}));
+        BOOST_TEST(match(rs, "http://example.com/p?idx=1") == ids_t{3});
+        BOOST_TEST(match(rs, "http://example.com/q?id=1").empty());
+    }
+
+    void
+    testIds()
+    {
+        // ids may repeat, and come in
+        // order of host, path, and
+        // insertion
+        url_rule_set rs;
+        rs.insert(7, {"example.com", "/a", {}});
+        rs.insert(7, {"com", {}, {}});
+        rs.insert(5, {"example.com", "/a", {}});
+        rs.insert(6, {"example.com", {}, {}});
+        ids_t ids{42};
+        url_view u("http://example.com/a/b");
+        BOOST_TEST_EQ(rs.match(u, ids), 4u);
+        BOOST_TEST(ids == (ids_t{42, 7, 6, 7, 5}));
+        BOOST_TEST_EQ(rs.size(), 4u);
+    }
+
+    void
+    testMany()
+    {
+        // many rules, so the table grows
+        url_rule_set rs;
+        for(std::size_t i = 0; i < 1000; ++i)
+        {
+            auto const h = "h" + std::to_string(i) + ".com";
+            auto const p = "/p/" + std::to_string(i % 7);
+            rs.insert(i, {h, p, i % 3 ? "" : "k"});
+        }
+        BOOST_TEST_EQ(rs.size(), 1000u);
+        BOOST_TEST(match(rs, "http://x.h42.com/p/0?k") == ids_t{42});
+        BOOST_TEST(match(rs, "http://x.h42.com/p/0").empty());
+        BOOST_TEST(match(rs, "http://h43.com/p/1/z") == ids_t{43});
+        BOOST_TEST(match(rs, "http://h43.com/p/2").empty());
+        BOOST_TEST(match(rs, "http://h1000.com/p/6").empty());
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_rule_set
+        {
+        url_rule_set rs;
+        rs.insert( 1, { "ads.example.com", {}, {} } );
+        rs.insert( 2, { "example.com", "/track", {} } );
+        rs.insert( 3, { "", "/", "utm_source" } );
+
+        std::vector< std::size_t > ids;
+        rs.match( url_view( "https://www.example.com/track/x?utm_source=a" ), ids );
+        assert( ids.size() == 2 );     // 3 and 2
+
+        BOOST_TEST(ids == (ids_t{3, 2}));
+        }
+    }
+
+    void
+    run()
+    {
+        testEmpty();
+        testHost();
+        testPath();
+        testParam();
+        testIds();
+        testMany();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_rule_set_test,
+    "boost.url.url_rule_set");
+
+} // urls
+} // boost
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_scanner.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+#ifdef assert
+#undef assert
+#endif
+#define assert BOOST_TEST
+
+namespace boost {
+namespace urls {
+
+struct url_scanner_test
+{
+    static
+    void
+    check(
+        core::string_view s,
+        std::vector<core::string_view> const& v)
+    {
+        url_scanner sc(s);
+        auto it = sc.begin();
+        for(auto const& e : v)
+        {
+            if(! BOOST_TEST(it != sc.end()))
+                return;
+            BOOST_TEST_EQ(it->buffer(), e);
+            // no copies
+            BOOST_TEST(
+                it->buffer().data() >= s.data() &&
+                it->buffer().data() < s.data() + s.size());
+            ++it;
+        }
+        BOOST_TEST(it == sc.end());
+    }
+
+    void
+    testScan()
+    {
+        check("", {});
+        check("no links here", {});
+        check("://", {});
+        check("http://", {});
+        check("mailto:user@example.com", {});
+        check("http://a", {"http://a"});
+        check("HTTPS://A.COM/X", {"HTTPS://A.COM/X"});
+
+        // separators
+        check("x http://a.com/b y", {"http://a.com/b"});
+        check("<http://a.com/b>", {"http://a.com/b"});
+        check("\"http://a.com/b\"", {"http://a.com/b"});
+        check("http://a.com\nhttp://b.com",
+            {"http://a.com", "http://b.com"});
+        check("http://a.com/x http://a.com/x",
+            {"http://a.com/x", "http://a.com/x"});
+
+        // html
+        check(
+            "<html><body>"
+            "<a href=\"https://www.example.com/index.htm\">home</a>"
+            "<img src=\"http://cdn.example.com/a/b.png?w=10&amp;h=20\"/>"
+            "<a href=\"/relative\">x</a>"
+            "<a href=\"ftp://[::1]:2121/pub\">ftp</a>"
+            "</body></html>", {
+            "https://www.example.com/index.htm",
+            "http://cdn.example.com/a/b.png?w=10&amp;h=20",
+            "ftp://[::1]:2121/pub"});
+
+        // scheme
+        check("1http://a.com", {"http://a.com"});
+        check("-+.git+ssh://a.com", {"git+ssh://a.com"});
+        check("123://a.com", {});
+        check("http://a.com/x://b.com", {"http://a.com/x://b.com"});
+
+        // fragments are not included
+        check("http://a.com/x#frag", {"http://a.com/x"});
+        check("http://a.com/x#", {"http://a.com/x"});
+
+        // trailing punctuation
+        check("see http://a.com/x.", {"http://a.com/x"});
+        check("see http://a.com/x, or", {"http://a.com/x"});
+        check("(see http://a.com/x)", {"http://a.com/x"});
+        check("(see http://a.com/x).", {"http://a.com/x"});
+        check("http://a.com/f(x)", {"http://a.com/f(x)"});
+        check("http://a.com/?", {"http://a.com/"});
+        check("'http://a.com/'", {"http://a.com/"});
+
+        // invalid candidates are skipped
+        check("http://a.com/%zz http://b.com",
+            {"http://b.com"});
+        check("http://[::1 http://b.com",
+            {"http://b.com"});
+        check("http://a.com:xyz/", {});
+
+        // long inputs
+        {
+            std::string s(1000, ' ');
+            s += "http://a.com/x";
+            s += std::string(1000, 'z');
+            s += " http://b.com";
+            s += std::string(1000, '.');
+            check(s, {
+                s.substr(1000, 1014),
+                "http://b.com"});
+        }
+    }
+
+    void
+    testIterator()
+    {
+        url_scanner sc("a http://a.com b http://b.com c");
+        auto it0 = sc.begin();
+        auto it1 = it0++;
+        BOOST_TEST(it0 != it1);
+        BOOST_TEST_EQ(it1->buffer(), "http://a.com");
+        BOOST_TEST_EQ((*it0).buffer(), "http://b.com");
+        BOOST_TEST(++it0 == sc.end());
+        BOOST_TEST(url_scanner::iterator() == sc.end());
+        BOOST_TEST(url_scanner().begin() == url_scanner().end());
+
+        std::size_t n = 0;
+        for(url_view u : sc)
+        {
+            BOOST_TEST(u.has_authority());
+            ++n;
+        }
+        BOOST_TEST_EQ(n, 2u);
+    }
+
+    void
+    testJavadocs()
+    {
+        // {class}
+        {
+    core::string_view s =
+        "<a href=\"https://www.example.com/a?x=1\">home</a> "
+        "(see http://example.org/docs.)";
+
+    url_scanner sc( s );
+    auto it = sc.begin();
+    assert( it->buffer() == "https://www.example.com/a?x=1" );
+    ++it;
+    assert( it->buffer() == "http://example.org/docs" );
+    ++it;
+    assert( it == sc.end() );
+        }
+    }
+
+    void
+    run()
+    {
+        testScan();
+        testIterator();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_scanner_test,
+    "boost.url.url_scanner");
+
+} // urls
+} // boost
@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_set.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct url_set_test
+{
+    void
+    testInsert()
+    {
+        url_set s;
+        BOOST_TEST(s.empty());
+        BOOST_TEST_EQ(s.size(), 0u);
+        BOOST_TEST(s.begin() == s.end());
+        BOOST_TEST(! s.contains(url_view("x:y")));
+        BOOST_TEST(s.find(url_view("x:y")) == s.end());
+
+        auto r = s.insert(url_view(
+            "http://www.example.com/a/./b"));
+        BOOST_TEST(r.second);
+        BOOST_TEST_EQ((*r.first).buffer(),
+            "http://www.example.com/a/./b");
+
+        // equivalent spellings
+        r = s.insert(url_view(
+            "HTTP://www.EXAMPLE.com/a/%62"));
+        BOOST_TEST(! r.second);
+        BOOST_TEST(r.first == s.begin());
+        BOOST_TEST_EQ((*r.first).buffer(),
+            "http://www.example.com/a/./b");
+        BOOST_TEST(s.contains(url(
+            "http://www.example.com/a/b")));
+        BOOST_TEST_EQ(s.count(url_view(
+            "http://www.example.com/a/x/../b")), 1u);
+        BOOST_TEST_EQ(s.size(), 1u);
+
+        // distinct urls
+        BOOST_TEST(s.insert(url_view(
+            "http://www.example.com/a/b/")).second);
+        BOOST_TEST(s.insert(url_view(
+            "https://www.example.com/a/b")).second);
+        BOOST_TEST(s.insert(url_view("")).second);
+        BOOST_TEST(! s.insert(url_view("")).second);
+        BOOST_TEST(s.insert(url_view("?")).second);
+        BOOST_TEST_EQ(s.size(), 5u);
+        BOOST_TEST_EQ(s.count(url_view("#")), 0u);
+
+        // insertion order
+        std::vector<std::string> v;
+        for(auto u : s)
+            v.push_back(u.buffer());
+        BOOST_TEST_EQ(v.size(), 5u);
+        BOOST_TEST_EQ(v[0], "http://www.example.com/a/./b");
+        BOOST_TEST_EQ(v[1], "http://www.example.com/a/b/");
+        BOOST_TEST_EQ(v[2], "https://www.example.com/a/b");
+        BOOST_TEST_EQ(v[3], "");
+        BOOST_TEST_EQ(v[4], "?");
+        auto it = s.end();
+        --it;
+        BOOST_TEST_EQ((*it).buffer(), "?");
+        BOOST_TEST_EQ((*it--).buffer(), "?");
+        BOOST_TEST_EQ((*it++).buffer(), "");
+        BOOST_TEST(++it == s.end());
+
+        // the views are parsed
+        BOOST_TEST_EQ((*s.find(url_view(
+            "HTTPS://www.example.com/a/b"))).encoded_host(),
+            "www.example.com");
+    }
+
+    void
+    testGrowth()
+    {
+        url_set s;
+        std::vector<std::string> v;
+        for(int i = 0; i < 2000; ++i)
+        {
+            v.push_back(
+                "http://www.example.com/" +
+                std::to_string(i) + "?q=" +
+                std::to_string(i % 7));
+        }
+        for(auto const& e : v)
+            BOOST_TEST(s.insert(url_view(e)).second);
+        BOOST_TEST_EQ(s.size(), v.size());
+        for(auto const& e : v)
+        {
+            BOOST_TEST(! s.insert(url_view(e)).second);
+            std::string e1 = e;
+            e1.replace(0, 4, "HTTP");
+            BOOST_TEST(s.contains(url_view(e1)));
+            e1 += "&";
+            BOOST_TEST(! s.contains(url_view(e1)));
+        }
+        BOOST_TEST_EQ(s.size(), v.size());
+        std::size_t i = 0;
+        for(auto u : s)
+            BOOST_TEST_EQ(u.buffer(), v[i++]);
+
+        // copy and swap
+        url_set s1(s);
+        BOOST_TEST_EQ(s1.size(), v.size());
+        BOOST_TEST(s1.contains(url_view(v[42])));
+        url_set s2;
+        swap(s1, s2);
+        BOOST_TEST(s1.empty());
+        BOOST_TEST(s2.contains(url_view(v[42])));
+
+        // clear keeps working
+        s.clear();
+        BOOST_TEST(s.empty());
+        BOOST_TEST(! s.contains(url_view(v[0])));
+        BOOST_TEST(s.insert(url_view(v[0])).second);
+        BOOST_TEST_EQ(s.size(), 1u);
+    }
+
+    void
+    testReserve()
+    {
+        url_set s;
+        s.reserve(100, 3000);
+        for(int i = 0; i < 100; ++i)
+        {
+            std::string const e =
+                "x://h/" + std::to_string(i);
+            BOOST_TEST(s.insert(url_view(e)).second);
+        }
+        BOOST_TEST_EQ(s.size(), 100u);
+        BOOST_TEST(s.contains(url_view("X://H/%35")));
+    }
+
+    void
+    testJavadocs()
+    {
+        url_set s;
+        s.insert( url_view( "http://www.example.com/a/./b" ) );
+        BOOST_TEST( ! s.insert( url_view( "HTTP://www.EXAMPLE.com/a/%62" ) ).second );
+        BOOST_TEST( s.contains( url_view( "http://www.example.com/a/b" ) ) );
+        BOOST_TEST( s.size() == 1 );
+    }
+
+    void
+    run()
+    {
+        testInsert();
+        testGrowth();
+        testReserve();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_set_test,
+    "boost.url.url_set");
+
+} // urls
+} // boost
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_sharder.hpp>
+
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/url.hpp>
+#include <boost/system/system_error.hpp>
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct url_sharder_test
+{
+    public_suffix_list psl{
+        "com\n"
+        "uk\n"
+        "co.uk\n"};
+
+    void
+    testKey()
+    {
+        url_sharder s(psl, 16);
+        BOOST_TEST_EQ(s.size(), 16u);
+        BOOST_TEST_EQ(s.key(url_view(
+            "https://www.example.co.uk/a")), "example.co.uk");
+        BOOST_TEST_EQ(s.key(url_view(
+            "http://a.b.example.com:8080/")), "example.com");
+        BOOST_TEST_EQ(s.key(url_view(
+            "http://example.com")), "example.com");
+
+        // no registrable domain
+        BOOST_TEST_EQ(s.key(url_view(
+            "http://co.uk/")), "co.uk");
+        BOOST_TEST_EQ(s.key(url_view(
+            "http://192.168.0.1/")), "192.168.0.1");
+        BOOST_TEST_EQ(s.key(url_view(
+            "http://[::1]/")), "[::1]");
+        BOOST_TEST_EQ(s.key(url_view(
+            "mailto:x@example.com")), "");
+    }
+
+    void
+    testShard()
+    {
+        url_sharder s(psl, 64);
+
+        // same registrable domain
+        BOOST_TEST_EQ(
+            s.shard(url_view("https://www.example.com/")),
+            s.shard(url_view("http://api.example.com:81/x?y")));
+        BOOST_TEST_EQ(
+            s.digest(url_view("https://www.example.com/")),
+            s.digest(url_view("https://WWW.EXAMPLE.Com/")));
+        BOOST_TEST_EQ(
+            s.digest(url_view("https://www.example.com/")),
+            s.digest(url_view("https://www.%65xample.com/")));
+
+        // the seed changes the digest
+        url_sharder s2(psl, 64, 1);
+        BOOST_TEST_NE(
+            s.digest(url_view("https://www.example.com/")),
+            s2.digest(url_view("https://www.example.com/")));
+
+        // all shards are used
+        std::vector<bool> used(64);
+        for(int i = 0; i < 4096; ++i)
+        {
+            url u("https://www.example.com/");
+            u.set_host("d" + std::to_string(i) + ".com");
+            auto const n = s.shard(u);
+            BOOST_TEST_LT(n, 64u);
+            if(n < 64)
+                used[n] = true;
+        }
+        for(bool b : used)
+            BOOST_TEST(b);
+    }
+
+    void
+    testGrow()
+    {
+        // growing by one shard only moves
+        // domains to the new shard
+        std::vector<url> v;
+        for(int i = 0; i < 1000; ++i)
+        {
+            url u("https://www.example.com/");
+            u.set_host("d" + std::to_string(i) + ".co.uk");
+            v.push_back(u);
+        }
+        for(std::uint32_t n = 1; n < 20; ++n)
+        {
+            url_sharder a(psl, n);
+            url_sharder b(psl, n + 1);
+            std::size_t moved = 0;
+            for(auto const& u : v)
+            {
+                auto const sa = a.shard(u);
+                auto const sb = b.shard(u);
+                if(sa == sb)
+                    continue;
+                BOOST_TEST_EQ(sb, n);
+                ++moved;
+            }
+            BOOST_TEST_GT(moved, 0u);
+            BOOST_TEST_LT(moved, 2 * v.size() / (n + 1));
+        }
+    }
+
+    void
+    testAssign()
+    {
+        url_sharder s(psl, 8);
+        std::vector<url_view> urls = {
+            url_view("https://www.example.com/"),
+            url_view("https://a.test.co.uk/"),
+            url_view("https://cdn.example.com/x"),
+            url_view("http://10.0.0.1/"),
+            url_view("https://b.test.co.uk/") };
+        std::vector<std::vector<std::size_t>> shards(
+            20, std::vector<std::size_t>{ 99 });
+        s.assign(urls.data(), urls.size(), shards);
+        BOOST_TEST_EQ(shards.size(), 8u);
+        std::size_t total = 0;
+        for(std::size_t i = 0; i < shards.size(); ++i)
+        {
+            total += shards[i].size();
+            for(auto j : shards[i])
+                BOOST_TEST_EQ(s.shard(urls[j]), i);
+        }
+        BOOST_TEST_EQ(total, urls.size());
+        auto const& s0 = shards[s.shard(urls[0])];
+        BOOST_TEST(
+            std::find(s0.begin(), s0.end(), 2u) != s0.end());
+
+        s.assign(nullptr, 0, shards);
+        BOOST_TEST_EQ(shards.size(), 8u);
+        for(auto const& v : shards)
+            BOOST_TEST(v.empty());
+    }
+
+    void
+    testInvalid()
+    {
+        BOOST_TEST_THROWS(
+            url_sharder(psl, 0),
+            system::system_error);
+    }
+
+    void
+    run()
+    {
+        testKey();
+        testShard();
+        testGrow();
+        testAssign();
+        testInvalid();
+    }
+};
+
+TEST_SUITE(
+    url_sharder_test,
+    "boost.url.url_sharder");
+
+} // urls
+} // boost
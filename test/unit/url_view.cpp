@@ -16,7 +16,10 @@
 
 #include "test_rule.hpp"
 
+#include <iterator>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #ifdef assert
 #undef assert
@@ -26,6 +29,71 @@
 namespace boost {
 namespace urls {
 
+namespace {
+
+// counts allocations and outstanding bytes
+struct alloc_stats
+{
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+};
+
+template<class T>
+struct stats_allocator
+{
+    using value_type = T;
+
+    alloc_stats* s;
+
+    explicit
+    stats_allocator(alloc_stats& s_) noexcept
+        : s(&s_)
+    {
+    }
+
+    template<class U>
+    stats_allocator(
+        stats_allocator<U> const& other) noexcept
+        : s(other.s)
+    {
+    }
+
+    T*
+    allocate(std::size_t n)
+    {
+        ++s->count;
+        s->bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T* p, std::size_t n) noexcept
+    {
+        s->bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend
+    bool
+    operator==(
+        stats_allocator const& a0,
+        stats_allocator const& a1) noexcept
+    {
+        return a0.s == a1.s;
+    }
+
+    friend
+    bool
+    operator!=(
+        stats_allocator const& a0,
+        stats_allocator const& a1) noexcept
+    {
+        return a0.s != a1.s;
+    }
+};
+
+} // (anon)
+
 class url_view_test
 {
 public:
@@ -1006,6 +1074,134 @@ public:
         BOOST_TEST(parse_origin_form("?").has_error());
     }
 
+    void
+    testPersist()
+    {
+        // persist(Allocator)
+        {
+            alloc_stats st;
+            std::shared_ptr<url_view const> sp;
+            {
+                std::string s("http://example.com/path?q#f");
+                url_view u(s);
+                sp = u.persist(
+                    stats_allocator<char>(st));
+                BOOST_TEST_EQ(st.count, 1u);
+                BOOST_TEST_GE(st.bytes, s.size());
+                BOOST_TEST(sp->data() != s.data());
+                BOOST_TEST_EQ(sp->buffer(), s);
+            }
+            BOOST_TEST_EQ(sp->encoded_path(), "/path");
+            BOOST_TEST_EQ(sp->fragment(), "f");
+
+            // a copy references the same buffer
+            url_view v = *sp;
+            BOOST_TEST_EQ(v.buffer(), sp->buffer());
+            sp.reset();
+            BOOST_TEST_EQ(st.bytes, 0u);
+        }
+
+        // persist(Allocator) from a url
+        {
+            alloc_stats st;
+            std::shared_ptr<url_view const> sp;
+            {
+                url u("http://example.com/a?q");
+                sp = u.persist(
+                    stats_allocator<char>(st));
+                u.set_path("/bcd");
+                BOOST_TEST_EQ(sp->buffer(),
+                    "http://example.com/a?q");
+            }
+            BOOST_TEST_EQ(sp->buffer(),
+                "http://example.com/a?q");
+            BOOST_TEST_EQ(sp->encoded_path(), "/a");
+            BOOST_TEST_EQ(sp->query(), "q");
+            url_view v = *sp;
+            BOOST_TEST_EQ(v.buffer(), sp->buffer());
+            sp.reset();
+            BOOST_TEST_EQ(st.bytes, 0u);
+        }
+
+        // persist() from a url
+        {
+            std::shared_ptr<url_view const> sp;
+            {
+                url u("http://example.com/a");
+                sp = u.persist();
+            }
+            BOOST_TEST_EQ(sp->buffer(),
+                "http://example.com/a");
+            BOOST_TEST_EQ(sp->host(), "example.com");
+        }
+
+        // persist_all
+        {
+            alloc_stats st;
+            std::vector<std::shared_ptr<
+                url_view const>> v;
+            {
+                std::vector<std::string> s = {
+                    "http://a.example.com/",
+                    "",
+                    "x:y",
+                    "//user@host:80/p?q#f" };
+                std::vector<url_view> uv;
+                for(auto const& e : s)
+                    uv.push_back(url_view(e));
+                auto it = persist_all(
+                    uv.begin(), uv.end(),
+                    std::back_inserter(v),
+                    stats_allocator<char>(st));
+                ignore_unused(it);
+                BOOST_TEST_EQ(st.count, 1u);
+                if(! BOOST_TEST_EQ(v.size(), 4u))
+                    return;
+                for(std::size_t i = 0; i < 4; ++i)
+                {
+                    BOOST_TEST_EQ(v[i]->buffer(), s[i]);
+                    BOOST_TEST(
+                        v[i]->data() != s[i].data());
+                }
+            }
+            BOOST_TEST_EQ(v[3]->encoded_user(), "user");
+            BOOST_TEST_EQ(v[3]->port_number(), 80);
+            BOOST_TEST(v[0]->data() < v[1]->data());
+
+            // the arena is freed with
+            // the last reference
+            url_view u = *v[2];
+            v.erase(v.begin(), v.begin() + 3);
+            BOOST_TEST_GT(st.bytes, 0u);
+            BOOST_TEST_EQ(u.buffer(), "x:y");
+            v.clear();
+            BOOST_TEST_EQ(st.bytes, 0u);
+        }
+
+        // persist_all, urls
+        {
+            std::vector<url> us = {
+                url("http://a/"), url("http://b/") };
+            std::vector<std::shared_ptr<
+                url_view const>> v;
+            persist_all(us.begin(), us.end(),
+                std::back_inserter(v));
+            us.clear();
+            BOOST_TEST_EQ(v.size(), 2u);
+            BOOST_TEST_EQ(v[1]->buffer(), "http://b/");
+        }
+
+        // persist_all, empty range
+        {
+            std::vector<url_view> uv;
+            std::vector<std::shared_ptr<
+                url_view const>> v;
+            persist_all(uv.begin(), uv.end(),
+                std::back_inserter(v));
+            BOOST_TEST(v.empty());
+        }
+    }
+
     void
     testJavadocs()
     {
@@ -1034,6 +1230,18 @@ public:
 
         ignore_unused(u);
         }
+
+        // persist_all
+        {
+        std::vector< url_view > v;
+        v.push_back( url_view( "http://a.example.com/" ) );
+        v.push_back( url_view( "http://b.example.com/" ) );
+
+        std::vector< std::shared_ptr< url_view const > > sp;
+        persist_all( v.begin(), v.end(), std::back_inserter( sp ) );
+        assert( sp.size() == 2 );
+        assert( sp[1]->buffer() == "http://b.example.com/" );
+        }
     }
 
     void
@@ -1056,6 +1264,7 @@ public:
         testRelativePart();
 
         testParseOriginForm();
+        testPersist();
 
         testJavadocs();
 
@@ -86,4 +86,47 @@ TEST_CASE("url_parsing_example_tests", "[parse]") {
     auto instance = skyr::parse("http://[www.example.com]/");
     REQUIRE_FALSE(instance);
   }
+
+  SECTION("url_path_query_fragment_runs") {
+    auto instance = skyr::parse("https://example.com/a/b%2Fc/./d/../e?q=1&r='x'#frag/ment?x");
+    REQUIRE(instance);
+    CHECK(skyr::serialize(instance.value()) == "https://example.com/a/b%2Fc/e?q=1&r=%27x%27#frag/ment?x");
+  }
+
+  SECTION("url_runs_with_percent_encoded_bytes") {
+    auto instance = skyr::parse("https://example.com/a b\"c{d}?e f<g>#h`i j");
+    REQUIRE(instance);
+    CHECK(skyr::serialize(instance.value()) == "https://example.com/a%20b%22c%7Bd%7D?e%20f%3Cg%3E#h%60i%20j");
+  }
+
+  SECTION("url_runs_with_tabs_and_newlines") {
+    bool validation_error = false;
+    auto instance = skyr::parse("http://example.com/pa\tth/to?qu\nery#fr\rag", &validation_error);
+    REQUIRE(instance);
+    CHECK(skyr::serialize(instance.value()) == "http://example.com/path/to?query#frag");
+    CHECK(validation_error);
+  }
+
+  SECTION("url_non_special_query_run") {
+    auto instance = skyr::parse("foo://example.com/p?a'b");
+    REQUIRE(instance);
+    CHECK(instance.value().query.value() == "a'b");
+  }
+
+  SECTION("url_fragment_run_with_validation_error") {
+    bool validation_error = false;
+    auto instance = skyr::parse("https://example.com/#abc%zzdef", &validation_error);
+    REQUIRE(instance);
+    CHECK(instance.value().fragment.value() == "abc%zzdef");
+    CHECK(validation_error);
+  }
+
+  SECTION("url_long_path_segment") {
+    auto segment = std::string(1000, 'a');
+    auto instance = skyr::parse("https://example.com/" + segment + "/");
+    REQUIRE(instance);
+    REQUIRE(2 == instance.value().path.size());
+    CHECK(instance.value().path[0] == segment);
+    CHECK(instance.value().path[1].empty());
+  }
 }
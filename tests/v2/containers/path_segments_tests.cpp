@@ -0,0 +1,72 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/containers/path_segments.hpp>
+
+TEST_CASE("push back segments", "[containers]") {
+  auto path = skyr::path_segments{};
+  CHECK(path.empty());
+  CHECK(path.chars().empty());
+
+  path.push_back("a");
+  path.push_back("");
+  path.push_back("bc");
+  REQUIRE(path.size() == 3);
+  CHECK(path[0] == "a");
+  CHECK(path[1].empty());
+  CHECK(path[2] == "bc");
+  CHECK(path.front() == "a");
+  CHECK(path.back() == "bc");
+  CHECK(path.chars() == "/a//bc");
+}
+
+TEST_CASE("pop segments", "[containers]") {
+  auto path = skyr::path_segments{"a", "b", "c"};
+  path.pop_back();
+  CHECK(path.size() == 2);
+  CHECK(path.chars() == "/a/b");
+
+  path.push_back("d");
+  path.pop_front();
+  REQUIRE(path.size() == 2);
+  CHECK(path[0] == "b");
+  CHECK(path[1] == "d");
+  CHECK(path.chars() == "/b/d");
+
+  path.pop_back();
+  path.pop_back();
+  CHECK(path.empty());
+  CHECK(path.chars().empty());
+}
+
+TEST_CASE("append to the last segment", "[containers]") {
+  auto path = skyr::path_segments{"a"};
+  path.append_to_back("bc");
+  path.append_to_back("d");
+  REQUIRE(path.size() == 1);
+  CHECK(path.front() == "abcd");
+}
+
+TEST_CASE("iterate through segments", "[containers]") {
+  auto path = skyr::path_segments{"a", "b", "c"};
+  auto expected = std::array<std::string_view, 3>{"a", "b", "c"};
+  CHECK(std::distance(std::cbegin(path), std::cend(path)) == 3);
+  CHECK(std::equal(std::cbegin(path), std::cend(path), std::cbegin(expected)));
+  CHECK(*(std::cend(path) - 1) == "c");
+}
+
+TEST_CASE("compare and clear segments", "[containers]") {
+  auto path = skyr::path_segments{"a", "b"};
+  CHECK(path == skyr::path_segments{"a", "b"});
+  CHECK_FALSE(path == skyr::path_segments{"a/b"});
+
+  path.clear();
+  CHECK(path.empty());
+  CHECK(path == skyr::path_segments{});
+}
@@ -56,3 +56,15 @@ TEST_CASE("destructor calls element destructors", "[containers]") {
   }
   CHECK(destructed);
 }
+
+TEST_CASE("resize", "[containers]") {
+  auto vector = skyr::static_vector<int, 4>{};
+  vector.push_back(42);
+  vector.resize(3);
+  REQUIRE(3 == vector.size());
+  CHECK(42 == vector.front());
+  CHECK(0 == vector.back());
+  vector.resize(1);
+  REQUIRE(1 == vector.size());
+  CHECK(42 == vector.back());
+}
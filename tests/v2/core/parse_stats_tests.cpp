@@ -0,0 +1,45 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define SKYR_ENABLE_STATS
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/core/parse.hpp>
+#include <skyr/v2/core/stats.hpp>
+
+TEST_CASE("parse_stats_tests", "[parse]") {
+  REQUIRE(skyr::parse_stats_enabled());
+
+  SECTION("parse calls") {
+    skyr::reset_parse_stats();
+    CHECK(skyr::parse("https://example.com/"));
+    CHECK(!skyr::parse("not a url"));
+    auto stats = skyr::get_parse_stats();
+    CHECK(stats.parse_calls == 2);
+    CHECK(stats.parse_errors == 1);
+  }
+
+  SECTION("compact record reserves") {
+    skyr::reset_parse_stats();
+    auto url = skyr::compact_url_record{};
+    CHECK(skyr::parse("https://example.com/a/b/c?x=1", url));
+    CHECK(skyr::parse("https://example.com/", url));
+    auto stats = skyr::get_parse_stats();
+    CHECK(stats.parse_calls == 2);
+    CHECK(stats.parse_errors == 0);
+    // the second parse fits in the buffer of the first
+    CHECK(stats.reserves == 1);
+    CHECK(stats.bytes_reserved >= 29);
+  }
+
+  SECTION("reset") {
+    CHECK(skyr::parse("https://example.com/"));
+    skyr::reset_parse_stats();
+    auto stats = skyr::get_parse_stats();
+    CHECK(stats.parse_calls == 0);
+    CHECK(stats.parse_errors == 0);
+    CHECK(stats.reserves == 0);
+    CHECK(stats.bytes_reserved == 0);
+  }
+}
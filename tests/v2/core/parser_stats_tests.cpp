@@ -0,0 +1,64 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define SKYR_ENABLE_PARSER_STATS
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/core/parse.hpp>
+#include <skyr/v2/core/parser_stats.hpp>
+
+TEST_CASE("parser_stats_tests", "[parse]") {
+  using skyr::url_parse_state;
+  using skyr::validation_error_kind;
+
+  REQUIRE(skyr::parser_stats_enabled());
+
+  SECTION("states") {
+    skyr::reset_parser_stats();
+    CHECK(skyr::parse("https://example.com/a?b#cd"));
+    auto stats = skyr::get_parser_stats();
+    CHECK(stats.visits(url_parse_state::scheme_start) == 1);
+    CHECK(stats.bytes(url_parse_state::query) == 2);
+    CHECK(stats.bytes(url_parse_state::fragment) == 2);
+    CHECK(stats.visits(url_parse_state::cannot_be_a_base_url_path) == 0);
+    CHECK(stats.bytes(url_parse_state::cannot_be_a_base_url_path) == 0);
+  }
+
+  SECTION("validation errors") {
+    skyr::reset_parser_stats();
+    auto validation_error = false;
+    CHECK(skyr::parse("https://example.com/", &validation_error));
+    CHECK(!validation_error);
+    CHECK(skyr::parse("https:example.com/", &validation_error));
+    CHECK(validation_error);
+    CHECK(skyr::parse("https://user@example.com/"));
+    CHECK(skyr::parse("https://example.com/a b"));
+    auto stats = skyr::get_parser_stats();
+    CHECK(stats.errors(validation_error_kind::special_scheme_missing_following_solidus) == 1);
+    CHECK(stats.errors(validation_error_kind::invalid_credentials) == 1);
+    CHECK(stats.errors(validation_error_kind::invalid_url_unit) == 1);
+    CHECK(stats.errors(validation_error_kind::port_invalid) == 0);
+  }
+
+  SECTION("hosts") {
+    skyr::reset_parser_stats();
+    CHECK(skyr::parse("https://example.com/"));
+    CHECK(skyr::parse("https://127.0.0.1/"));
+    CHECK(skyr::parse("mailto:user@example.com"));
+    auto stats = skyr::get_parser_stats();
+    CHECK(stats.host_parses == 2);
+    CHECK(stats.domain_to_ascii_calls == 2);
+    CHECK(stats.host_time >= stats.domain_to_ascii_time);
+  }
+
+  SECTION("reset") {
+    CHECK(skyr::parse("https://example.com/"));
+    skyr::reset_parser_stats();
+    auto stats = skyr::get_parser_stats();
+    CHECK(stats.visits(url_parse_state::scheme_start) == 0);
+    CHECK(stats.host_parses == 0);
+    CHECK(stats.domain_to_ascii_calls == 0);
+    CHECK(stats.host_time.count() == 0);
+  }
+}
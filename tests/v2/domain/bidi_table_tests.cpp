@@ -0,0 +1,128 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/domain/bidi.hpp>
+
+
+struct class_parameter {
+  char32_t value;
+  skyr::idna::bidi_class bidi_class;
+};
+
+TEST_CASE("Bidi class values", "[bidi]") {
+  using skyr::idna::bidi_class;
+
+  auto code_point = GENERATE(
+      class_parameter{U'a', bidi_class::l},
+      class_parameter{U'0', bidi_class::en},
+      class_parameter{U'-', bidi_class::es},
+      class_parameter{U'.', bidi_class::cs},
+      class_parameter{U'$', bidi_class::et},
+      class_parameter{U' ', bidi_class::ws},
+      class_parameter{0x0300, bidi_class::nsm},
+      class_parameter{0x05d0, bidi_class::r},
+      class_parameter{0x0627, bidi_class::al},
+      class_parameter{0x0661, bidi_class::an},
+      class_parameter{0x200d, bidi_class::bn},
+      class_parameter{0x202e, bidi_class::rlo},
+      class_parameter{0x4f60, bidi_class::l},
+      class_parameter{0x10800, bidi_class::r},
+      class_parameter{0x1e900, bidi_class::r},
+      class_parameter{0x10ffff, bidi_class::bn});
+
+  SECTION("code_point_set") {
+    const auto [value, expected] = code_point;
+    INFO("0x" << std::hex << static_cast<std::uint32_t>(value));
+    CHECK(expected == skyr::idna::code_point_bidi_class(value));
+  }
+}
+
+struct joining_parameter {
+  char32_t value;
+  skyr::idna::joining_type joining_type;
+};
+
+TEST_CASE("Joining type values", "[bidi]") {
+  using skyr::idna::joining_type;
+
+  auto code_point = GENERATE(
+      joining_parameter{U'a', joining_type::u},
+      joining_parameter{0x0627, joining_type::r},
+      joining_parameter{0x0628, joining_type::d},
+      joining_parameter{0x0640, joining_type::c},
+      joining_parameter{0x064b, joining_type::t},
+      joining_parameter{0x200d, joining_type::c},
+      joining_parameter{0xa872, joining_type::l});
+
+  SECTION("code_point_set") {
+    const auto [value, expected] = code_point;
+    INFO("0x" << std::hex << static_cast<std::uint32_t>(value));
+    CHECK(expected == skyr::idna::code_point_joining_type(value));
+  }
+}
+
+TEST_CASE("Bidi rule", "[bidi]") {
+  using skyr::idna::direction_of;
+  using skyr::idna::label_direction;
+
+  SECTION("ltr_labels") {
+    CHECK(direction_of(U"") == label_direction::ltr);
+    CHECK(direction_of(U"example") == label_direction::ltr);
+    CHECK(direction_of(U"a-b1") == label_direction::ltr);
+    CHECK(direction_of(U"a\x0300") == label_direction::ltr);
+    CHECK(direction_of(U"\x4f60\x597d") == label_direction::ltr);
+  }
+
+  SECTION("invalid_ltr_labels") {
+    CHECK(direction_of(U"1a") == label_direction::invalid_ltr);
+    CHECK(direction_of(U"a-") == label_direction::invalid_ltr);
+    CHECK(direction_of(U"a b") == label_direction::invalid_ltr);
+  }
+
+  SECTION("rtl_labels") {
+    CHECK(direction_of(U"\x05d0\x05d1") == label_direction::rtl);
+    CHECK(direction_of(U"\x0627\x0661") == label_direction::rtl);
+    CHECK(direction_of(U"\x05d0" U"1") == label_direction::rtl);
+    CHECK(direction_of(U"\x0628\x064b") == label_direction::rtl);
+  }
+
+  SECTION("invalid_rtl_labels") {
+    CHECK(direction_of(U"a\x064a") == label_direction::invalid_rtl);
+    CHECK(direction_of(U"\x0661\x0627") == label_direction::invalid_rtl);
+    CHECK(direction_of(U"\x05d0" U"a") == label_direction::invalid_rtl);
+    CHECK(direction_of(U"\x05d0-") == label_direction::invalid_rtl);
+    CHECK(direction_of(U"\x0627" U"1\x0661") == label_direction::invalid_rtl);
+  }
+}
+
+TEST_CASE("CONTEXTJ rules", "[bidi]") {
+  using skyr::idna::satisfies_contextj;
+
+  SECTION("without_joiners") {
+    CHECK(satisfies_contextj(U""));
+    CHECK(satisfies_contextj(U"example"));
+  }
+
+  SECTION("after_virama") {
+    CHECK(satisfies_contextj(U"\x0dc1\x0dca\x200d\x0dbb\x0dd3"));
+    CHECK(satisfies_contextj(U"\x0915\x094d\x200c\x0937"));
+  }
+
+  SECTION("zwnj_between_joining_letters") {
+    CHECK(satisfies_contextj(U"\x0646\x0627\x0645\x0647\x200c\x0627\x06cc"));
+    CHECK(satisfies_contextj(U"\x0628\x064b\x200c\x064b\x0628"));
+    CHECK_FALSE(satisfies_contextj(U"\x0627\x200c\x0628"));
+    CHECK_FALSE(satisfies_contextj(U"\x0628\x200c\x0020"));
+    CHECK_FALSE(satisfies_contextj(U"\x0628\x200c"));
+    CHECK_FALSE(satisfies_contextj(U"\x200c\x0628"));
+  }
+
+  SECTION("zwj") {
+    CHECK_FALSE(satisfies_contextj(U"\x200d"));
+    CHECK_FALSE(satisfies_contextj(U"a\x200d"));
+    CHECK_FALSE(satisfies_contextj(U"\x0628\x200d\x0628"));
+  }
+}
@@ -0,0 +1,68 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/domain/domain_batch.hpp>
+
+namespace {
+const auto domains = std::vector<std::string_view>{
+    "example.com", "⌘.ws", "你好你好.com", "faß.ExAmPlE", "xn--a-yoc", "", "Example.COM", "a\xcc\x81.com",
+    "xn--a-xbb.com", "bad_domain.com", "⌘.ws", ".", "münchen.de", "\xff.com",
+};
+
+void check_same_results(skyr::domain_batch &batch, bool be_strict) {
+  auto results = batch.domain_to_ascii(domains);
+  REQUIRE(domains.size() == results.size());
+  for (auto i = 0UL; i < domains.size(); ++i) {
+    auto expected = std::string{};
+    auto expected_result = skyr::domain_to_ascii(domains[i], &expected, be_strict);
+    INFO(domains[i]);
+    REQUIRE(expected_result.has_value() == results[i].has_value());
+    if (results[i]) {
+      CHECK(expected == results[i].value());
+    } else {
+      CHECK(expected_result.error() == results[i].error());
+    }
+  }
+}
+}  // namespace
+
+TEST_CASE("domain batch", "[domain]") {
+  SECTION("same_results_as_domain_to_ascii") {
+    auto batch = skyr::domain_batch{};
+    check_same_results(batch, false);
+  }
+
+  SECTION("same_results_as_domain_to_ascii_when_strict") {
+    auto batch = skyr::domain_batch{true};
+    check_same_results(batch, true);
+  }
+
+  SECTION("same_results_with_a_cache") {
+    auto cache = skyr::domain_cache{};
+    auto batch = skyr::domain_batch{false, &cache};
+    check_same_results(batch, false);
+    check_same_results(batch, false);
+    CHECK(0 < cache.hits());
+  }
+
+  SECTION("reused_between_calls") {
+    auto batch = skyr::domain_batch{};
+    check_same_results(batch, false);
+    auto names = std::vector<std::string_view>{"⌘.ws", "www.example.com"};
+    auto results = batch.domain_to_ascii(names);
+    REQUIRE(2 == results.size());
+    CHECK("xn--bih.ws" == results[0].value());
+    CHECK("www.example.com" == results[1].value());
+  }
+
+  SECTION("empty_batch") {
+    auto batch = skyr::domain_batch{};
+    CHECK(batch.domain_to_ascii({}).empty());
+  }
+}
@@ -0,0 +1,84 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/domain/domain_cache.hpp>
+#include <skyr/v2/core/host.hpp>
+
+TEST_CASE("domain cache", "[domain]") {
+  using namespace std::string_literals;
+
+  SECTION("same_results_as_domain_to_ascii") {
+    auto cache = skyr::domain_cache{};
+    for (auto domain : {"example.com"s, "⌘.ws"s, "你好你好.com"s, "faß.ExAmPlE"s, "xn--a-yoc"s, ""s}) {
+      for (auto i = 0; i < 2; ++i) {
+        auto expected = std::string{};
+        auto expected_result = skyr::domain_to_ascii(domain, &expected);
+        auto output = std::string{};
+        auto result = cache.domain_to_ascii(domain, &output);
+        REQUIRE(expected_result.has_value() == result.has_value());
+        if (result) {
+          CHECK(expected == output);
+        } else {
+          CHECK(expected_result.error() == result.error());
+        }
+      }
+    }
+    CHECK(6 == cache.hits());
+    CHECK(6 == cache.misses());
+    CHECK(6 == cache.size());
+  }
+
+  SECTION("appends_to_output") {
+    auto cache = skyr::domain_cache{};
+    auto output = "www."s;
+    REQUIRE(cache.domain_to_ascii("⌘.ws", &output));
+    CHECK("www.xn--bih.ws" == output);
+  }
+
+  SECTION("memory_budget") {
+    auto cache = skyr::domain_cache{skyr::domain_cache::shard_count * 1024};
+    for (auto i = 0; i < 1000; ++i) {
+      auto output = std::string{};
+      REQUIRE(cache.domain_to_ascii("host" + std::to_string(i) + ".example", &output));
+    }
+    CHECK(cache.memory_usage() <= skyr::domain_cache::shard_count * 1024);
+    CHECK(cache.size() < 1000);
+    CHECK(1000 == cache.misses());
+
+    cache.clear();
+    CHECK(0 == cache.size());
+    CHECK(0 == cache.memory_usage());
+  }
+
+  SECTION("least_recently_used_is_evicted") {
+    auto cache = skyr::domain_cache{skyr::domain_cache::shard_count * 512};
+    auto output = std::string{};
+    for (auto i = 0; i < 1000; ++i) {
+      output.clear();
+      REQUIRE(cache.domain_to_ascii("⌘.ws", &output));
+      output.clear();
+      REQUIRE(cache.domain_to_ascii("host" + std::to_string(i) + ".example", &output));
+    }
+    CHECK(999 == cache.hits());
+  }
+
+  SECTION("used_by_parse_host") {
+    auto cache = skyr::domain_cache{};
+    skyr::set_domain_cache(&cache);
+    auto first = skyr::parse_host("⌘.ws");
+    auto second = skyr::parse_host("⌘.ws");
+    skyr::set_domain_cache(nullptr);
+    REQUIRE(first);
+    REQUIRE(second);
+    CHECK("xn--bih.ws" == second.value().serialize());
+    CHECK(1 == cache.hits());
+    CHECK(1 == cache.misses());
+
+    CHECK(skyr::parse_host("⌘.ws"));
+    CHECK(1 == cache.hits());
+  }
+}
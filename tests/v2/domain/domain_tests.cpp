@@ -20,7 +20,14 @@ TEST_CASE("valid domains to ascii", "[domain]") {
       param{"उदाहरण.परीक्षा", "xn--p1b6ci4b4b3a.xn--11b5bs3a9aj6g"},
       param{"faß.ExAmPlE", "xn--fa-hia.example"},
       param{"βόλος.com", "xn--nxasmm1c.com"},
-      param{"Ｇｏ.com", "go.com"});
+      param{"Ｇｏ.com", "go.com"},
+      param{"WWW.Example.COM", "www.example.com"},
+      param{"xn--bih.ws", "xn--bih.ws"},
+      param{"XN--BIH.ws", "xn--bih.ws"},
+      param{"a-b.c--d.123", "a-b.c--d.123"},
+      param{"a\xcc\x81.com", "xn--1ca.com"},
+      param{"\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab.kr", "xn--6q8b.kr"},
+      param{"example.com.", "example.com."});
 
   SECTION("domain_to_ascii_tests") {
     const auto &[input, expected] = domain;
@@ -88,6 +95,38 @@ TEST_CASE("invalid domains", "[domain]") {
     REQUIRE_FALSE(instance);
     REQUIRE(instance.error() == skyr::domain_errc::invalid_length);
   }
+
+  SECTION("invalid_ascii_name_long_label") {
+    auto domain = std::string(64, 'x') + ".com";
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii(domain, &output, true);
+    REQUIRE_FALSE(instance);
+    REQUIRE(instance.error() == skyr::domain_errc::invalid_length);
+  }
+
+  SECTION("invalid_ascii_punycode_label") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("xn--a.com", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("invalid_punycode_label_not_nfc") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("xn--a-xbb.com", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("hyphens_in_third_and_fourth_positions") {
+    auto check = [](std::string_view domain) {
+      auto output = std::string{};
+      return skyr::domain_to_ascii(domain, &output, true, false, false, false, false, false).has_value();
+    };
+    CHECK_FALSE(check("ab--.com"));
+    CHECK_FALSE(check("ab--cd.com"));
+    CHECK_FALSE(check("ab--c\xc3\xa9.com"));
+    CHECK(check("abc--d.com"));
+    CHECK(check("abc--d\xc3\xa9.com"));
+  }
 }
 
 TEST_CASE("web platform tests", "[domain]") {
@@ -110,6 +149,45 @@ TEST_CASE("web platform tests", "[domain]") {
     REQUIRE_FALSE(instance);
   }
 
+  /// CheckJoiners
+  SECTION("toascii_04") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xe2\x80\x8d.example", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("toascii_05") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("xn--1ug.example", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  /// CheckBidi
+  SECTION("toascii_06") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("a\xd9\x8a", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("toascii_07") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("xn--a-yoc", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("bidi_domain_with_invalid_ltr_label") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("0a.\xd7\x90", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("ltr_label_in_bidi_domain") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("a.\xd7\x90", &output);
+    REQUIRE(instance);
+    CHECK("a.xn--4db" == output);
+  }
+
     /// ProcessingOptions is non-transitional
   SECTION("toascii_08") {
     auto output = std::string{};
@@ -140,30 +218,38 @@ TEST_CASE("web platform tests", "[domain]") {
   }
 }
 
-TEST_CASE("web platform tests mayfail", "[domain][!mayfail]") {
-  /// CheckJoiners
-  SECTION("toascii_04") {
-    auto output = std::string{};
-    auto instance = skyr::domain_to_ascii("\xe2\x80\x8d.example", &output);
-    REQUIRE_FALSE(instance);
+TEST_CASE("domains to u8 without punycode labels", "[domain]") {
+  using namespace std::string_view_literals;
+
+  SECTION("has_punycode_label") {
+    CHECK(skyr::details::has_punycode_label("xn--bih.ws"));
+    CHECK(skyr::details::has_punycode_label("www.xn--bih.ws"));
+    CHECK_FALSE(skyr::details::has_punycode_label("www.example.com"));
+    CHECK_FALSE(skyr::details::has_punycode_label("axn--bih.ws"));
+    CHECK_FALSE(skyr::details::has_punycode_label("xn-.xn-"));
+    CHECK_FALSE(skyr::details::has_punycode_label(""));
   }
 
-  SECTION("toascii_05") {
-    auto output = std::string{};
-    auto instance = skyr::domain_to_ascii("xn--1ug.example", &output);
-    REQUIRE_FALSE(instance);
+  SECTION("view_of_input") {
+    auto input = "www.example.com."sv;
+    auto buffer = std::string{};
+    auto result = skyr::domain_to_u8_view(input, &buffer);
+    REQUIRE(result);
+    CHECK(input.data() == result.value().data());
+    CHECK(input == result.value());
+    CHECK(buffer.empty());
   }
 
-  /// CheckBidi
-  SECTION("toascii_06") {
-    auto output = std::string{};
-    auto instance = skyr::domain_to_ascii("a\xd9\x8a", &output);
-    REQUIRE_FALSE(instance);
+  SECTION("view_of_buffer") {
+    auto buffer = std::string{};
+    auto result = skyr::domain_to_u8_view("www.xn--bih.ws", &buffer);
+    REQUIRE(result);
+    CHECK("www.⌘.ws" == result.value());
+    CHECK(buffer.data() == result.value().data());
   }
 
-  SECTION("toascii_07") {
-    auto output = std::string{};
-    auto instance = skyr::domain_to_ascii("xn--a-yoc", &output);
-    REQUIRE_FALSE(instance);
+  SECTION("invalid_punycode") {
+    auto buffer = std::string{};
+    CHECK_FALSE(skyr::domain_to_u8_view("xn--!.ws", &buffer));
   }
 }
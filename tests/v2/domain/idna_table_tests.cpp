@@ -27,3 +27,33 @@ TEST_CASE("IDNA character values", "[idna]") {
     REQUIRE(status == skyr::idna::code_point_status(value));
   }
 }
+
+struct mapping_parameter {
+  char32_t value;
+  char32_t mapped;
+};
+
+TEST_CASE("IDNA mapped values", "[idna]") {
+  auto code_point = GENERATE(
+      mapping_parameter{U'A', U'a'},
+      mapping_parameter{U'z', U'z'},
+      mapping_parameter{0x00c0, 0x00e0},
+      mapping_parameter{0x0132, 0x0069},
+      mapping_parameter{0xff21, U'a'},
+      mapping_parameter{0x1d400, U'a'},
+      mapping_parameter{0x2fa1d, 0x2a600},
+      mapping_parameter{0x110000, 0x110000});
+
+  SECTION("code_point_mapped") {
+    const auto [value, mapped] = code_point;
+    INFO("0x" << std::hex << static_cast<std::uint32_t>(value));
+    REQUIRE(mapped == skyr::idna::map_code_point(value));
+  }
+}
+
+TEST_CASE("IDNA lookups are constant expressions", "[idna]") {
+  static_assert(skyr::idna::code_point_status(U'a') == skyr::idna::idna_status::valid);
+  static_assert(skyr::idna::code_point_status(U'A') == skyr::idna::idna_status::mapped);
+  static_assert(skyr::idna::map_code_point(U'A') == U'a');
+  CHECK(skyr::idna::code_point_status(0x110000) == skyr::idna::idna_status::valid);
+}
@@ -0,0 +1,90 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/domain/nfc.hpp>
+
+TEST_CASE("Canonical combining classes", "[nfc]") {
+  CHECK(skyr::idna::canonical_combining_class(U'a') == 0);
+  CHECK(skyr::idna::canonical_combining_class(0x0301) == 230);
+  CHECK(skyr::idna::canonical_combining_class(0x0323) == 220);
+  CHECK(skyr::idna::canonical_combining_class(0x094d) == 9);
+  CHECK(skyr::idna::canonical_combining_class(0x1d16e) == 216);
+  CHECK(skyr::idna::canonical_combining_class(0x110000) == 0);
+}
+
+TEST_CASE("NFC quick check", "[nfc]") {
+  using skyr::idna::nfc_quick_check;
+  using skyr::idna::quick_check_nfc;
+
+  CHECK(quick_check_nfc(U"example.com") == nfc_quick_check::yes);
+  CHECK(quick_check_nfc(U"b\x00fc\x0063her") == nfc_quick_check::yes);
+  CHECK(quick_check_nfc(U"\x4f60\x597d") == nfc_quick_check::yes);
+  CHECK(quick_check_nfc(U"") == nfc_quick_check::yes);
+
+  // a combining mark which may compose
+  CHECK(quick_check_nfc(U"a\x0301") == nfc_quick_check::maybe);
+  CHECK(quick_check_nfc(U"\x1112\x1161") == nfc_quick_check::maybe);
+
+  // a composition exclusion, and marks out of order
+  CHECK(quick_check_nfc(U"\x0958") == nfc_quick_check::no);
+  CHECK(quick_check_nfc(U"\x212b") == nfc_quick_check::no);
+  CHECK(quick_check_nfc(U"a\x0301\x0323") == nfc_quick_check::no);
+}
+
+TEST_CASE("NFC normalization", "[nfc]") {
+  using param = std::pair<std::u32string, std::u32string>;
+
+  auto value = GENERATE(
+      param{U"example", U"example"},
+      param{U"", U""},
+      param{U"a\x0301", U"\x00e1"},
+      param{U"\x212b", U"\x00c5"},
+      param{U"A\x030a", U"\x00c5"},
+      // canonical ordering, then composition of the first mark
+      param{U"a\x0301\x0323", U"\x1ea1\x0301"},
+      param{U"a\x0323\x0301", U"\x1ea1\x0301"},
+      // a blocked mark does not compose
+      param{U"a\x0305\x0301", U"a\x0305\x0301"},
+      // a composition exclusion
+      param{U"\x0958", U"\x0915\x093c"},
+      // a singleton
+      param{U"\x2126", U"\x03a9"},
+      // Hangul
+      param{U"\x1112\x1161\x11ab", U"\xd55c"},
+      param{U"\xd558\x11ab", U"\xd55c"},
+      param{U"\xd55c", U"\xd55c"},
+      // leading combining marks
+      param{U"\x0301" U"a", U"\x0301" U"a"},
+      param{U"\x0301\x0323", U"\x0323\x0301"},
+      param{U"e\x0301.e\x0301", U"\x00e9.\x00e9"});
+
+  SECTION("to_nfc") {
+    const auto &[input, expected] = value;
+    auto output = std::u32string{};
+    skyr::idna::to_nfc(input, &output);
+    CHECK(expected == output);
+  }
+
+  SECTION("normalize_nfc") {
+    const auto &[input, expected] = value;
+    auto output = input;
+    skyr::idna::normalize_nfc(&output);
+    CHECK(expected == output);
+  }
+
+  SECTION("is_nfc") {
+    const auto &[input, expected] = value;
+    CHECK(skyr::idna::is_nfc(expected));
+    CHECK(skyr::idna::is_nfc(input) == (input == expected));
+  }
+}
+
+TEST_CASE("NFC appends to the output", "[nfc]") {
+  auto output = std::u32string{U"x."};
+  skyr::idna::to_nfc(U"a\x0301", &output);
+  CHECK(output == U"x.\x00e1");
+}
@@ -3,6 +3,7 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <array>
 #include <string>
 #include <catch2/catch_all.hpp>
 #include <skyr/v2/domain/punycode.hpp>
@@ -57,3 +58,45 @@ TEST_CASE("special_strings") {
     CHECK(U"\xfffd" == decoded);
   }
 }
+
+TEST_CASE("buffers", "[punycode]") {
+  using namespace std::string_literals;
+  using namespace std::string_view_literals;
+
+  SECTION("encode_into_buffer") {
+    auto buffer = std::array<char, 16>{};
+    auto result = skyr::punycode_encode(U"b\x00FC\x0063her"sv, buffer);
+    REQUIRE(result);
+    CHECK("bcher-kva"sv == std::string_view(buffer.data(), result.value()));
+  }
+
+  SECTION("encode_into_small_buffer") {
+    auto buffer = std::array<char, 8>{};
+    auto result = skyr::punycode_encode(U"b\x00FC\x0063her"sv, buffer);
+    REQUIRE_FALSE(result);
+    CHECK(skyr::domain_errc::big_output == result.error());
+
+    auto encoded = std::string{};
+    CHECK(skyr::punycode_encode(std::u32string(100, U'\x00FC'), &encoded));
+  }
+
+  SECTION("decode_into_buffer") {
+    auto buffer = std::array<char32_t, 16>{};
+    auto result = skyr::punycode_decode("6qqa088eba"sv, buffer);
+    REQUIRE(result);
+    CHECK(U"\x4F60\x597D\x4F60\x597D"sv == std::u32string_view(buffer.data(), result.value()));
+  }
+
+  SECTION("decode_into_small_buffer") {
+    auto buffer = std::array<char32_t, 3>{};
+    auto result = skyr::punycode_decode("6qqa088eba"sv, buffer);
+    REQUIRE_FALSE(result);
+    CHECK(skyr::domain_errc::big_output == result.error());
+  }
+
+  SECTION("append_to_string") {
+    auto decoded = U"x"s;
+    REQUIRE(skyr::punycode_decode("tda"sv, &decoded));
+    CHECK(U"x\x00FC" == decoded);
+  }
+}
@@ -0,0 +1,79 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/domain/skeleton.hpp>
+#include <skyr/v2/domain/errors.hpp>
+
+namespace {
+auto skeleton_of(std::string_view domain_name) {
+  auto skeleton = std::string{};
+  auto result = skyr::domain_to_skeleton(domain_name, &skeleton);
+  REQUIRE(result);
+  return skeleton;
+}
+}  // namespace
+
+TEST_CASE("domain skeletons", "[domain][skeleton]") {
+  using param = std::pair<std::string, std::string>;
+
+  auto domain = GENERATE(
+      param{"", ""},
+      param{"test.org", "test.org"},
+      param{"example.com", "exarnple.corn"},
+      param{"paypa1.net", "paypal.net"},
+      param{"\xd0\xb0pple.net", "apple.net"},
+      param{"\xf0\x9d\x90\x9a\xf0\x9d\x90\x9b.net", "ab.net"},
+      param{"b\xc3\xbc" "cher.net", "bu\xcc\x88" "cher.net"},
+      param{"\xe4\xbd\xa0\xe5\xa5\xbd.cn", "\xe4\xbd\xa0\xe5\xa5\xbd.cn"},
+      param{"\xed\x95\x9c\xea\xb5\xad",
+            "\xe1\x84\x92\xe1\x85\xa1\xe1\x84\x82\xe1\x84\x80\xe1\x85\xae\xe1\x84\x80"});
+
+  SECTION("domain_to_skeleton_tests") {
+    const auto &[input, expected] = domain;
+    CHECK(expected == skeleton_of(input));
+  }
+}
+
+TEST_CASE("confusable domains", "[domain][skeleton]") {
+  SECTION("mixed_scripts") {
+    CHECK(skeleton_of("apple.com") == skeleton_of("\xd0\xb0pple.com"));
+    CHECK(skeleton_of("google.com") == skeleton_of("g\xd0\xbe\xd0\xbegle.com"));
+    CHECK(skeleton_of("microsoft.com") == skeleton_of("rnicrosoft.com"));
+    CHECK(skeleton_of("example.com") != skeleton_of("examples.com"));
+  }
+
+  SECTION("punycode_labels") {
+    CHECK(skeleton_of("apple.com") == skeleton_of("xn--pple-43d.com"));
+  }
+
+  SECTION("combining_marks") {
+    CHECK("e\xcc\xa3\xcc\x81" == skeleton_of("e\xcc\x81\xcc\xa3"));
+    CHECK("e\xcc\xa3\xcc\x81" == skeleton_of("e\xcc\xa3\xcc\x81"));
+    CHECK("e\xcc\xa3\xcc\x81" == skeleton_of("\xc3\xa9\xcc\xa3"));
+  }
+
+  SECTION("long_ascii_domains") {
+    CHECK("login.exarnple-accounts.security.net" == skeleton_of("login.example-accounts.security.net"));
+    CHECK("www.abcdefghijkl.net" == skeleton_of("www.abcdefghijkl.net"));
+  }
+}
+
+TEST_CASE("domain skeleton errors", "[domain][skeleton]") {
+  SECTION("invalid_utf8") {
+    auto skeleton = std::string{};
+    auto result = skyr::domain_to_skeleton("\xc3.com", &skeleton);
+    REQUIRE_FALSE(result);
+    CHECK(skyr::domain_errc::encoding_error == result.error());
+  }
+
+  SECTION("skeleton_is_appended_to") {
+    auto skeleton = std::string{"test.org "};
+    auto result = skyr::domain_to_skeleton("paypa1.net", &skeleton);
+    REQUIRE(result);
+    CHECK("test.org paypal.net" == skeleton);
+  }
+}
@@ -44,6 +44,56 @@ TEST_CASE("filesystem path", "[filesystem_path]") {
     CHECK(url.value().href() == "file:///C:/path/to/file.txt");
   }
 
-  // TODO: add test with percent encoding
-  // TODO: add test with unicode
+  SECTION("from_path_percent_encoding") {
+    auto path = std::filesystem::path("/path/to/my file<1>%.txt");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///path/to/my%20file%3C1%3E%.txt");
+  }
+
+  SECTION("from_path_unicode") {
+    auto path = std::filesystem::path("/r\xc3\xa9sum\xc3\xa9/\xe2\x8c\x98.txt");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///r%C3%A9sum%C3%A9/%E2%8C%98.txt");
+    CHECK(url.value().pathname() == "/r%C3%A9sum%C3%A9/%E2%8C%98.txt");
+  }
+
+  SECTION("from_path_same_as_parser") {
+    for (auto input : {"/a", "/a/", "/a//b", "/a/./b", "/a/../b", "/a/%2e%2E/b", "/a/.b/c..", "/C:/x", "/C|/x",
+                       "/a?b#c", "/a b ", "relative/path", "//host/share", "/a\\b", "/%zz", "/a;b=c/d@e"}) {
+      auto path = std::filesystem::path(input);
+      auto url = skyr::filesystem::from_path(path);
+      auto expected = skyr::make_url("file://" + path.generic_string());
+      REQUIRE(url.has_value() == expected.has_value());
+      if (url) {
+        CHECK(url.value().href() == expected.value().href());
+        CHECK(url.value().pathname() == expected.value().pathname());
+      }
+    }
+  }
+
+  SECTION("to_path_percent_decoding") {
+    auto instance = skyr::url{"file:///path/to/my%20file%3C1%3E.txt"};
+    auto path = skyr::filesystem::to_path(instance);
+    REQUIRE(path);
+    CHECK(path.value().generic_string() == "/path/to/my file<1>.txt");
+  }
+
+  SECTION("to_path_invalid_percent_encoding") {
+    for (auto input : {"file:///a%zz", "file:///a%2"}) {
+      auto instance = skyr::url{std::string(input)};
+      auto path = skyr::filesystem::to_path(instance);
+      CHECK_FALSE(path);
+    }
+  }
+
+  SECTION("round_trip") {
+    auto path = std::filesystem::path("/srv/artifacts/build 42/r\xc3\xa9sum\xc3\xa9 100.tar.gz");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    auto result = skyr::filesystem::to_path(url.value());
+    REQUIRE(result);
+    CHECK(result.value() == path);
+  }
 }
@@ -5,6 +5,8 @@
 
 
 #include <catch2/catch_all.hpp>
+#include <iterator>
+#include <utility>
 #include <vector>
 #include <skyr/v2/json/json.hpp>
 
@@ -65,4 +67,41 @@ TEST_CASE("json_tests", "[json.query]") {
     auto query = skyr::json::encode_query(json);
     REQUIRE_FALSE(query);
   }
+
+  SECTION("decode_query_with_repeated_and_encoded_names") {
+    auto query = "?a=1&%61=2&a=3&b=%20&c"s;
+    auto json = skyr::json::decode_query(query);
+    CHECK(json["a"].get<std::vector<std::string>>() == std::vector<std::string>{"1", "2", "3"});
+    CHECK(json["b"] == " ");
+    CHECK(json["c"] == "");
+  }
+
+  SECTION("decode_query_to") {
+    auto parameters = std::vector<std::pair<std::string, std::string>>{};
+    skyr::json::decode_query_to("?a=b&&%63=%CF%80;e=%zz&f", [&parameters](auto name, auto value) {
+      parameters.emplace_back(name, value);
+    });
+    CHECK(parameters == std::vector<std::pair<std::string, std::string>>{
+                            {"a", "b"}, {"c", "\xcf\x80"}, {"e", "%zz"}, {"f", ""}});
+  }
+
+  SECTION("encode_query_to") {
+    auto json = nlohmann::json{ { "a", { "b", "e f" } }, { "c", "\xcf\x80" }, { "d", 1 } };
+    auto query = std::string();
+    auto out = skyr::json::encode_query_to(json, std::back_inserter(query), ';', ':');
+    REQUIRE(out);
+    CHECK(query == "a:b;a:e%20f;c:%CF%80;d:");
+
+    char buffer[64] = {};
+    auto end = skyr::json::encode_query_to(json, static_cast<char *>(buffer));
+    REQUIRE(end);
+    CHECK(std::string_view(buffer, static_cast<std::size_t>(end.value() - buffer)) == "a=b&a=e%20f&c=%CF%80&d=");
+  }
+
+  SECTION("encode_then_decode") {
+    auto json = nlohmann::json{ { "a b", { "1", "2&3" } }, { "c=d", "%" } };
+    auto query = skyr::json::encode_query(json);
+    REQUIRE(query);
+    CHECK(skyr::json::decode_query(query.value()) == json);
+  }
 }
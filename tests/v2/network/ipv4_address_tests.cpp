@@ -90,4 +90,35 @@ TEST_CASE("ipv4 addresses", "[ipv4]") {
     std::array<unsigned char, 4> bytes{{0x7f, 0x00, 0x00, 0x01}};
     CHECK(bytes == instance.value().to_bytes());
   }
+
+  SECTION("parse_dotted_quad") {
+    CHECK(skyr::details::parse_ipv4_dotted_quad("1.2.3.4") == 0x01020304U);
+    CHECK(skyr::details::parse_ipv4_dotted_quad("255.255.255.255") == 0xffffffffU);
+    CHECK(skyr::details::parse_ipv4_dotted_quad("10.0.200.99") == 0x0a00c863U);
+    // other forms are left to the full parser
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1.2.3"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1.2.3.4."));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("01.2.3.4"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("0x1.2.3.4"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1.2.3.256"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1.2.3.1000"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1..2.3"));
+    CHECK_FALSE(skyr::details::parse_ipv4_dotted_quad("1.2.3.4x"));
+  }
+
+  SECTION("parse_address_with_octal") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv4_address("010.0.0.01"s, &validation_error);
+    REQUIRE(instance);
+    CHECK(0x08000001 == instance.value().address());
+    CHECK(validation_error);
+  }
+
+  SECTION("parse_address_with_trailing_dot") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv4_address("1.2.3.4."s, &validation_error);
+    REQUIRE(instance);
+    CHECK(0x01020304 == instance.value().address());
+    CHECK(validation_error);
+  }
 }
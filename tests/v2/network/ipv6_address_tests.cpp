@@ -174,4 +174,58 @@ TEST_CASE("ipv6_address_tests", "[ipv6]") {
       }};
     CHECK(bytes == instance.to_bytes());
   }
+
+  SECTION("serialize_single_zero_piece_test") {
+    auto address = std::array<unsigned short, 8>{{1, 0, 2, 3, 4, 5, 6, 7}};
+    auto instance = skyr::ipv6_address(address);
+    CHECK("1:0:2:3:4:5:6:7" == instance.serialize());
+  }
+
+  SECTION("serialize_first_longest_run_test") {
+    auto address = std::array<unsigned short, 8>{{1, 0, 0, 2, 0, 0, 3, 4}};
+    auto instance = skyr::ipv6_address(address);
+    CHECK("1::2:0:0:3:4" == instance.serialize());
+  }
+
+  SECTION("serialize_to_test") {
+    auto address = std::array<unsigned short, 8>{{0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff}};
+    auto instance = skyr::ipv6_address(address);
+    char buffer[skyr::ipv6_address::max_serialized_size];
+    auto length = instance.serialize_to(buffer);
+    CHECK(skyr::ipv6_address::max_serialized_size == length);
+    CHECK("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" == std::string_view(buffer, length));
+  }
+
+  SECTION("parse_hex_pieces_test") {
+    auto pieces = skyr::details::parse_ipv6_hex_pieces("1:2:3:4:5:6:7::");
+    REQUIRE(pieces);
+    CHECK(pieces.value() == std::array<unsigned short, 8>{{1, 2, 3, 4, 5, 6, 7, 0}});
+    CHECK(!skyr::details::parse_ipv6_hex_pieces("1:2:3:4:5:6:7:8::"));
+    CHECK(!skyr::details::parse_ipv6_hex_pieces("::ffff:1.2.3.4"));
+    CHECK(!skyr::details::parse_ipv6_hex_pieces("1::2::3"));
+    CHECK(!skyr::details::parse_ipv6_hex_pieces("12345::"));
+  }
+
+  SECTION("parse_invalid_test") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv6_address("1:2:3:4:5:6:7:8:9", &validation_error);
+    REQUIRE(!instance);
+    CHECK(skyr::ipv6_address_errc::invalid_piece == instance.error());
+    CHECK(validation_error);
+  }
+
+  SECTION("parse_round_trip_test") {
+    for (auto mask = 0U; mask < 256U; ++mask) {
+      auto address = std::array<unsigned short, 8>{};
+      for (auto i = 0U; i < 8U; ++i) {
+        address[i] = static_cast<unsigned short>(((mask >> i) & 1U) ? 0U : 0x1000U * i + 0xabU);  // NOLINT
+      }
+      auto instance = skyr::ipv6_address(address);
+      bool validation_error = false;
+      auto parsed = skyr::parse_ipv6_address(instance.serialize(), &validation_error);
+      REQUIRE(parsed);
+      CHECK(instance.to_bytes() == parsed.value().to_bytes());
+      CHECK(!validation_error);
+    }
+  }
 }
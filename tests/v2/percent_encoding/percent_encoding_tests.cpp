@@ -3,10 +3,12 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <utility>
 #include <catch2/catch_all.hpp>
 #define FMT_HEADER_ONLY
 #include <fmt/format.h>
 #include <skyr/v2/percent_encoding/percent_encoded_char.hpp>
+#include <skyr/v2/percent_encoding/percent_encode.hpp>
 
 TEST_CASE("encode fragment", "[percent_encoding]") {
   auto c = GENERATE(
@@ -73,3 +75,79 @@ TEST_CASE("encode_tests", "[percent_encoding]") {
     CHECK("%2B" == encoded.to_string());
   }
 }
+
+TEST_CASE("encode_bytes_tests", "[percent_encoding]") {
+  using namespace std::string_literals;
+
+  auto encode_bytewise = [](std::string_view input, skyr::percent_encoding::encode_set encodes) {
+    auto result = std::string{};
+    for (auto c : input) {
+      result += skyr::percent_encoding::percent_encode_byte(std::byte(c), encodes).to_string();
+    }
+    return result;
+  };
+
+  auto encodes = GENERATE(
+      skyr::percent_encoding::encode_set::any,
+      skyr::percent_encoding::encode_set::c0_control,
+      skyr::percent_encoding::encode_set::fragment,
+      skyr::percent_encoding::encode_set::query,
+      skyr::percent_encoding::encode_set::special_query,
+      skyr::percent_encoding::encode_set::path,
+      skyr::percent_encoding::encode_set::userinfo,
+      skyr::percent_encoding::encode_set::component);
+
+  SECTION("encode_every_byte") {
+    auto input = std::string{};
+    for (auto i = 0u; i <= 0xffu; ++i) {
+      input.push_back(static_cast<char>(i));
+    }
+    auto encoded = skyr::percent_encode_bytes(input, encodes);
+    CHECK(encode_bytewise(input, encodes) == encoded);
+    CHECK(skyr::percent_encoded_size(input, encodes) == encoded.size());
+  }
+
+  SECTION("encode_long_inputs") {
+    auto input = std::string(40, 'a') + "b c" + std::string(17, 'd') + "\xff" + "x{y}z/"s;
+    for (auto i = 0u; i <= input.size(); ++i) {
+      auto substr = std::string_view(input).substr(i);
+      auto encoded = skyr::percent_encode_bytes(substr, encodes);
+      CHECK(encode_bytewise(substr, encodes) == encoded);
+      CHECK(skyr::percent_encoded_size(substr, encodes) == encoded.size());
+    }
+  }
+
+  SECTION("encode_appends") {
+    auto result = "prefix="s;
+    skyr::percent_encode_bytes_to("a b", encodes, result);
+    CHECK("prefix="s + encode_bytewise("a b", encodes) == result);
+  }
+}
+
+TEST_CASE("encode_table_tests", "[percent_encoding]") {
+  using skyr::percent_encoding::encode_set;
+  namespace details = skyr::percent_encoding::details;
+
+  auto [encodes, pred] = GENERATE(
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::c0_control, details::is_c0_control_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::fragment, details::is_fragment_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::query, details::is_query_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::special_query, details::is_special_query_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::path, details::is_path_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::userinfo, details::is_userinfo_byte},
+      std::pair<encode_set, bool (*)(std::byte)>{encode_set::component, details::is_component_byte});
+
+  SECTION("bitmap_and_nibbles_match_predicate") {
+    const auto &table = details::get_encode_table(encodes);
+    for (auto i = 0u; i <= 0xffu; ++i) {
+      auto in_nibbles = ((table.nibbles[(i & 0x0fu) + 16 * (i >> 7u)] >> ((i >> 4u) & 0x07u)) & 1u) != 0;
+      CHECK(pred(std::byte(i)) == table.contains(static_cast<unsigned char>(i)));
+      CHECK(pred(std::byte(i)) == in_nibbles);
+    }
+  }
+}
+
+TEST_CASE("encode_component_tests", "[percent_encoding]") {
+  CHECK("abc%20%2F%3D" == skyr::percent_encode("abc /="));
+  CHECK(skyr::percent_encode("").empty());
+}
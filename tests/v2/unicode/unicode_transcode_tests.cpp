@@ -0,0 +1,146 @@
+// Copyright 2020 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/unicode/transcode.hpp>
+#include <skyr/v2/unicode/ranges/transforms/u16_transform.hpp>
+#include <skyr/v2/unicode/ranges/transforms/u32_transform.hpp>
+#include <skyr/v2/unicode/ranges/views/u8_view.hpp>
+#include <skyr/v2/unicode/ranges/views/unchecked_u8_view.hpp>
+#include <string>
+
+TEST_CASE("validate_u8", "[unicode]") {
+  using namespace std::string_literals;
+  using skyr::unicode::unicode_errc;
+
+  SECTION("valid_input") {
+    CHECK(0 == skyr::unicode::validate_u8("").value());
+    CHECK(5 == skyr::unicode::validate_u8("hello").value());
+    CHECK(17 == skyr::unicode::validate_u8("a long ascii text").value());
+    CHECK(4 == skyr::unicode::validate_u8("\x7f\xc2\x80\xef\xbf\xbf\xf4\x8f\xbf\xbf").value());
+    CHECK(11 == skyr::unicode::validate_u8("\xf0\x9f\x92\xa9 abcdefgh\xce\xbb").value());
+  }
+
+  SECTION("invalid_leads") {
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("\x80").error());
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("abcdefgh\xbf").error());
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("\xc0\xaf").error());
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("\xc1\xbf").error());
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("\xf5\x80\x80\x80").error());
+    CHECK(unicode_errc::invalid_lead == skyr::unicode::validate_u8("\xff").error());
+  }
+
+  SECTION("illegal_byte_sequences") {
+    CHECK(unicode_errc::illegal_byte_sequence == skyr::unicode::validate_u8("\xc3").error());
+    CHECK(unicode_errc::illegal_byte_sequence == skyr::unicode::validate_u8("\xe2\x82").error());
+    CHECK(unicode_errc::illegal_byte_sequence == skyr::unicode::validate_u8("\xf0\x9f\x92").error());
+    CHECK(unicode_errc::illegal_byte_sequence == skyr::unicode::validate_u8("\xc3(").error());
+    CHECK(unicode_errc::illegal_byte_sequence == skyr::unicode::validate_u8("\xe2\x28\xa1").error());
+  }
+
+  SECTION("invalid_code_points") {
+    CHECK(unicode_errc::invalid_code_point == skyr::unicode::validate_u8("\xe0\x80\xaf").error());
+    CHECK(unicode_errc::invalid_code_point == skyr::unicode::validate_u8("\xed\xa0\x80").error());
+    CHECK(unicode_errc::invalid_code_point == skyr::unicode::validate_u8("\xf0\x8f\xbf\xbf").error());
+    CHECK(unicode_errc::invalid_code_point == skyr::unicode::validate_u8("\xf4\x90\x80\x80").error());
+  }
+
+  SECTION("is_valid_u8") {
+    CHECK(skyr::unicode::is_valid_u8("\xce\xbb"));
+    CHECK_FALSE(skyr::unicode::is_valid_u8("\xce"));
+  }
+}
+
+TEST_CASE("u8_to_u32", "[unicode]") {
+  using namespace std::string_literals;
+
+  SECTION("same_as_range_transform") {
+    const auto input = "ascii text \xf0\x9f\x92\xa9, \xce\xbb and \xe2\x82\xac in a longer buffer"s;
+    auto expected = skyr::unicode::as<std::u32string>(
+        skyr::unicode::views::as_u8(input) | skyr::unicode::transforms::to_u32);
+    REQUIRE(expected);
+    for (auto i = 0u; i <= input.size(); ++i) {
+      auto prefix = std::string_view(input).substr(0, i);
+      if (skyr::unicode::is_valid_u8(prefix)) {
+        auto u32 = skyr::unicode::u8_to_u32(prefix);
+        REQUIRE(u32);
+        CHECK(expected.value().substr(0, u32.value().size()) == u32.value());
+      }
+    }
+    CHECK(expected.value() == skyr::unicode::u8_to_u32(input).value());
+  }
+
+  SECTION("unchecked_view_once_validated") {
+    const auto input = "\xf0\x9f\x92\xa9\xce\xbb"s;
+    REQUIRE(skyr::unicode::is_valid_u8(input));
+    auto result = std::u32string{};
+    for (auto &&code_point : skyr::unicode::views::unchecked_u8(input)) {
+      result.push_back(code_point.u32_value());
+    }
+    CHECK(skyr::unicode::u8_to_u32(input).value() == result);
+  }
+
+  SECTION("invalid_input") {
+    CHECK_FALSE(skyr::unicode::u8_to_u32("abc\xed\xa0\x80"));
+  }
+}
+
+TEST_CASE("u8_to_u16", "[unicode]") {
+  using namespace std::string_literals;
+
+  SECTION("surrogate_pairs") {
+    auto u16 = skyr::unicode::u8_to_u16("\xf0\x9f\x92\xa9"s);
+    REQUIRE(u16);
+    CHECK(u"\xd83d\xdca9" == u16.value());
+  }
+
+  SECTION("mixed_input") {
+    auto u16 = skyr::unicode::u8_to_u16("domain \xce\xbb.example \xf0\x9f\x92\xa9!"s);
+    REQUIRE(u16);
+    CHECK(u"domain \x03bb.example \xd83d\xdca9!" == u16.value());
+  }
+
+  SECTION("invalid_input") {
+    CHECK_FALSE(skyr::unicode::u8_to_u16("\xf4\x90\x80\x80"));
+  }
+}
+
+TEST_CASE("u16_to_u8", "[unicode]") {
+  using namespace std::string_literals;
+
+  SECTION("ascii_blocks") {
+    auto u8 = skyr::unicode::u16_to_u8(u"https://www.example.com/path?query#fragment");
+    REQUIRE(u8);
+    CHECK("https://www.example.com/path?query#fragment" == u8.value());
+  }
+
+  SECTION("mixed_input") {
+    auto u8 = skyr::unicode::u16_to_u8(u"domain \x03bb.example/\x4f60\x597d \xd83d\xdca9!");
+    REQUIRE(u8);
+    CHECK("domain \xce\xbb.example/\xe4\xbd\xa0\xe5\xa5\xbd \xf0\x9f\x92\xa9!"s == u8.value());
+    CHECK(skyr::unicode::u8_to_u16(u8.value()).value() == u"domain \x03bb.example/\x4f60\x597d \xd83d\xdca9!");
+  }
+
+  SECTION("non_ascii_in_a_block") {
+    auto u8 = skyr::unicode::u16_to_u8(u"abcdefg\x00e9hijklmnopq");
+    REQUIRE(u8);
+    CHECK("abcdefg\xc3\xa9hijklmnopq"s == u8.value());
+  }
+
+  SECTION("reuses_output") {
+    auto output = std::string(64, 'x');
+    REQUIRE(skyr::unicode::u16_to_u8(u"example", &output));
+    CHECK("example" == output);
+    CHECK(output.capacity() >= 64);
+  }
+
+  SECTION("invalid_input") {
+    auto output = "unchanged"s;
+    CHECK_FALSE(skyr::unicode::u16_to_u8(u"abc\xd83d", &output));
+    CHECK_FALSE(skyr::unicode::u16_to_u8(u"abc\xdca9xyz"));
+    CHECK_FALSE(skyr::unicode::u16_to_u8(u"abc\xd83dxyz"));
+    CHECK("unchanged" == output);
+  }
+}
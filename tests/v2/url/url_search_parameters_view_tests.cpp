@@ -0,0 +1,162 @@
+// Copyright 2023 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+#include <catch2/catch_all.hpp>
+#include <skyr/v2/url.hpp>
+
+TEST_CASE("url_search_parameters_view_tests", "[url_search_parameters]") {
+  using namespace std::string_literals;
+
+  SECTION("empty") {
+    auto parameters = skyr::url_search_parameters_view();
+    CHECK(parameters.empty());
+    CHECK(parameters.size() == 0);
+    CHECK(parameters.begin() == parameters.end());
+    CHECK_FALSE(parameters.get("a"));
+
+    CHECK(skyr::url_search_parameters_view("?").empty());
+    CHECK(skyr::url_search_parameters_view("&;&").empty());
+  }
+
+  SECTION("iterate") {
+    auto parameters = skyr::url_search_parameters_view("?a=1&&b&c=%20x;=d&e=");
+    auto names = std::vector<std::string_view>{};
+    auto values = std::vector<std::string_view>{};
+    for (const auto &[name, value] : parameters) {
+      names.push_back(name);
+      values.push_back(value);
+    }
+    CHECK(names == std::vector<std::string_view>{"a", "b", "c", "", "e"});
+    CHECK(values == std::vector<std::string_view>{"1", "", "%20x", "d", ""});
+    CHECK(parameters.size() == 5);
+    CHECK(parameters.query() == "a=1&&b&c=%20x;=d&e=");
+  }
+
+  SECTION("get") {
+    auto parameters = skyr::url_search_parameters_view("a=1&b=2&a=3&%63=%34");
+    CHECK(parameters.get("a") == "1");
+    CHECK(parameters.get("b") == "2");
+    CHECK(parameters.get("c") == "4");
+    CHECK_FALSE(parameters.get("d"));
+    CHECK(parameters.get_all("a") == std::vector{"1"s, "3"s});
+    CHECK(parameters.get_all("c") == std::vector{"4"s});
+    CHECK(parameters.get_all("d").empty());
+    CHECK(parameters.contains("b"));
+    CHECK_FALSE(parameters.contains("%63"));
+  }
+
+  SECTION("the index gives the same results as a linear search") {
+    auto query = std::string();
+    for (auto i = 0; i < 200; ++i) {
+      query += (i % 7 == 0) ? "%6Bey" : "key";
+      query += std::to_string(i % 50) + "=value" + std::to_string(i) + "&";
+    }
+
+    auto parameters = skyr::url_search_parameters_view(query);
+    for (auto i = 0; i < 60; ++i) {
+      auto name = "key" + std::to_string(i);
+      auto copy = skyr::url_search_parameters_view(query);
+      CHECK(parameters.get(name) == copy.get(name));
+      CHECK(parameters.get_all(name) == skyr::url_search_parameters_view(query).get_all(name));
+      CHECK(parameters.contains(name) == (i < 50));
+    }
+    CHECK(parameters.get("key3") == "value3");
+    CHECK(parameters.get_all("key0") == std::vector{"value0"s, "value50"s, "value100"s, "value150"s});
+  }
+
+  SECTION("values") {
+    auto parameters = skyr::url_search_parameters_view("?filter=red&size=42&%66ilter=a%20b&filter&x=1");
+    auto values = std::vector<std::string_view>{};
+    for (auto value : parameters.values("filter")) {
+      values.push_back(value);
+    }
+    CHECK(values == std::vector<std::string_view>{"red", "a%20b", ""});
+    CHECK(parameters.values("size").begin() != parameters.values("size").end());
+    CHECK(*parameters.values("size").begin() == "42");
+    CHECK(parameters.values("y").empty());
+    CHECK(skyr::url_search_parameters_view().values("").empty());
+
+    auto instance = skyr::url("https://example.org/?filter=red&size=42&%66ilter=a%20b&filter&x=1");
+    auto decoded = std::vector<std::string_view>{};
+    for (auto value : instance.search_parameters().values("filter")) {
+      decoded.push_back(value);
+    }
+    CHECK(decoded == std::vector<std::string_view>{"red", "a b", ""});
+    CHECK(instance.search_parameters().values("y").empty());
+  }
+
+  SECTION("group by key") {
+    auto parameters = skyr::url_search_parameters_view("?filter=red&size=42&%66ilter=a%20b&filter&x=1&size=7");
+    auto groups = parameters.group_by_key();
+    REQUIRE(groups.size() == 3);
+    CHECK(groups[0].name == "filter");
+    CHECK(groups[0].count == 3);
+    CHECK(groups[1].name == "size");
+    CHECK(groups[1].count == 2);
+    CHECK(groups[2].name == "x");
+
+    auto values = std::vector<std::string_view>{};
+    for (auto value : groups[0].values) {
+      values.push_back(value);
+    }
+    CHECK(values == std::vector<std::string_view>{"red", "a%20b", ""});
+
+    values.clear();
+    for (auto value : groups.values("size")) {
+      values.push_back(value);
+    }
+    CHECK(values == std::vector<std::string_view>{"42", "7"});
+    CHECK(groups.values("y").empty());
+
+    auto total = std::size_t(0);
+    for (const auto &[name, count, group_values] : groups) {
+      total += count;
+    }
+    CHECK(total == parameters.size());
+    CHECK(skyr::url_search_parameters_view().group_by_key().empty());
+  }
+
+  SECTION("group by key with many names") {
+    auto query = std::string();
+    for (auto i = 0; i < 200; ++i) {
+      query += (i % 7 == 0) ? "%6Bey" : "key";
+      query += std::to_string(i % 50) + "=value" + std::to_string(i) + "&";
+    }
+
+    auto parameters = skyr::url_search_parameters_view(query);
+    auto groups = parameters.group_by_key();
+    CHECK(groups.size() == 50);
+    for (auto i = 0; i < 50; ++i) {
+      auto name = "key" + std::to_string(i);
+      auto decoded = std::vector<std::string>{};
+      for (auto value : groups.values(name)) {
+        decoded.emplace_back(value);
+      }
+      CHECK(decoded == parameters.get_all(name));
+      CHECK(groups[static_cast<std::size_t>(i)].count == 4);
+    }
+  }
+
+  SECTION("url") {
+    auto instance = skyr::url("https://example.org/?utm_source=news&id=42&q=a%20b#f");
+    auto parameters = instance.search_parameters_view();
+    CHECK(parameters.size() == instance.search_parameters().size());
+    CHECK(parameters.get("id") == instance.search_parameters().get("id"));
+    CHECK(parameters.get("q") == "a b");
+    CHECK(parameters.get("q") == instance.search_parameters().get("q"));
+    CHECK_FALSE(parameters.get("f"));
+
+    CHECK(skyr::url("https://example.org/").search_parameters_view().empty());
+    CHECK(skyr::url("https://example.org/?").search_parameters_view().empty());
+  }
+
+  SECTION("sort is stable") {
+    auto instance = skyr::url("https://example.org/?z=1&a=2&z=0&a=1&b=3");
+    instance.search_parameters().sort();
+    CHECK(instance.search() == "?a=2&a=1&b=3&z=1&z=0");
+  }
+}
@@ -0,0 +1,226 @@
+# Copyright 2018-20 Glyn Matthews.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# This script parses the Bidi_Class, Joining_Type and Canonical_Combining_Class
+# properties from the Unicode Character Database,
+#
+#   https://unicode.org/Public/14.0.0/ucd/extracted/DerivedBidiClass.txt
+#   https://unicode.org/Public/14.0.0/ucd/extracted/DerivedJoiningType.txt
+#   https://unicode.org/Public/14.0.0/ucd/extracted/DerivedCombiningClass.txt
+#
+# and converts them to the C++ table used by the Bidi Rule (RFC 5893) and the
+# CONTEXTJ rules (RFC 5892) of the domain validity criteria:
+#
+#   python make_bidi_table.py DerivedBidiClass.txt DerivedJoiningType.txt DerivedCombiningClass.txt \
+#       ../include/skyr/domain/bidi_table.hpp
+
+
+import sys
+import jinja2
+
+
+def parse_line(line):
+    missing = line.startswith('# @missing:')
+    if missing:
+        line = line[len('# @missing:'):]
+    line = line[0:line.find('#')] if '#' in line else line
+    tokens = [token.strip() for token in line.split(';')] if line.strip() else []
+    if len(tokens) >= 2:
+        first, last = tokens[0].split('..') if '..' in tokens[0] else (tokens[0], tokens[0])
+        return missing, int(first, 16), int(last, 16), tokens[1]
+    return None
+
+
+def parse_file(filename):
+    """Return the ranges of a property, those of the @missing lines first."""
+    with open(filename, 'r') as input_file:
+        ranges = [parse_line(line) for line in input_file.readlines()]
+    ranges = [r for r in ranges if r]
+    return [r[1:] for r in ranges if r[0]] + [r[1:] for r in ranges if not r[0]]
+
+
+# The values of bidi_class in skyr v2
+bidi_class_values = [
+    'L', 'R', 'AL', 'EN', 'ES', 'ET', 'AN', 'CS', 'NSM', 'BN', 'B', 'S', 'WS', 'ON',
+    'LRE', 'LRO', 'RLE', 'RLO', 'PDF', 'LRI', 'RLI', 'FSI', 'PDI',
+    ]
+
+# The values of joining_type in skyr v2
+joining_type_values = ['U', 'C', 'D', 'L', 'R', 'T']
+
+# The combining class of a virama
+virama = '9'
+
+
+class Table(object):
+    """A run-length table of code point properties.
+
+    Each code point has a bidi class and a joining type, packed in a byte.
+    The code points are split into blocks of `1 << block_shift` values, and
+    each block is a list of runs of code points with the same properties. A
+    run is packed in 16 bits: its first code point relative to the block,
+    then the properties. The runs of identical blocks are stored once.
+    """
+
+    block_shift = 7
+    class_bits = 5
+
+    def __init__(self, bidi_classes, joining_types, combining_classes, max_code_point=0x10ffff):
+        values = [0] * (max_code_point + 1)
+        for first, last, value in bidi_classes:
+            for code_point in range(first, last + 1):
+                values[code_point] = bidi_class_values.index(value)
+        for first, last, value in joining_types:
+            for code_point in range(first, last + 1):
+                values[code_point] = (values[code_point] & ((1 << self.class_bits) - 1)) | \
+                    (joining_type_values.index(value) << self.class_bits)
+
+        block_size = 1 << self.block_shift
+        block_indexes, self.blocks, self.block_runs, self.runs = {}, [], [], []
+        for first in range(0, len(values), block_size):
+            runs = []
+            for value in range(first, first + block_size):
+                if not runs or runs[-1][1] != values[value]:
+                    runs.append((value - first, values[value]))
+            key = tuple(runs)
+            if key not in block_indexes:
+                block_indexes[key] = len(self.block_runs)
+                self.block_runs.append(len(self.runs))
+                self.runs.extend(start | (value << self.block_shift) for start, value in runs)
+            self.blocks.append(block_indexes[key])
+        self.block_runs.append(len(self.runs))
+
+        self.viramas = sorted(
+            code_point for first, last, value in combining_classes if value == virama
+            for code_point in range(first, last + 1))
+
+        assert len(self.block_runs) <= 0x100
+        assert len(self.runs) <= 0x10000
+        assert max(self.runs) < 0x10000
+
+    @staticmethod
+    def array(type, values, width=16, format=str):
+        rows = [', '.join(format(value) for value in values[i:i + width]) for i in range(0, len(values), width)]
+        return 'std::array<%s, %d>{\n%s\n}' % (type, len(values), '\n'.join('  %s,' % row for row in rows))
+
+
+def main():
+    bidi_input, joining_input, combining_input, output = sys.argv[1], sys.argv[2], sys.argv[3], sys.argv[4]
+
+    table = Table(parse_file(bidi_input), parse_file(joining_input), parse_file(combining_input))
+
+    with open(output, 'w+') as output_file:
+        template = jinja2.Template(
+            """// Auto-generated by tools/make_bidi_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_BIDI_TABLE_HPP
+#define SKYR_DOMAIN_BIDI_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// The Bidi_Class and Joining_Type table of the domain validity criteria
+///
+/// The variables are `inline`, as those of the IDNA mapping table.
+namespace skyr::bidi_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = {{ block_shift }};
+
+/// The number of bits of the bidi class of a value
+inline constexpr auto class_bits = {{ class_bits }};
+
+/// The index of the runs of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = {{ blocks }};
+
+/// The first run of the runs of each block index, then the number of runs
+inline constexpr auto block_runs = {{ block_runs }};
+
+/// The runs of code points with the same properties, each packed as
+/// `first | ((bidi_class | (joining_type << class_bits)) << block_shift)`
+inline constexpr auto runs = {{ runs }};
+
+/// The code points with a canonical combining class of Virama, in order
+inline constexpr auto viramas = {{ viramas }};
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The properties of the code point
+constexpr auto find_value(char32_t code_point) noexcept -> std::uint8_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = blocks[code_point >> block_shift];
+  auto first = std::size_t(block_runs[block]), last = std::size_t(block_runs[block + 1]);
+  auto low = static_cast<std::uint32_t>(code_point) & block_mask;
+
+  // the first run of a block starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((runs[middle] & block_mask) <= low) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return static_cast<std::uint8_t>(runs[first] >> block_shift);
+}
+
+/// The code points below `direct_size` are looked up with one load
+inline constexpr auto direct_size = std::size_t(0x800);
+
+constexpr auto make_direct_values() noexcept {
+  auto table = std::array<std::uint8_t, direct_size>{};
+  for (auto i = std::size_t(0); i < direct_size; ++i) {
+    table[i] = find_value(static_cast<char32_t>(i));
+  }
+  return table;
+}
+
+/// The properties of each code point below `direct_size`
+inline constexpr auto direct_values = make_direct_values();
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The properties of the code point
+constexpr auto value_of(char32_t code_point) noexcept -> std::uint8_t {
+  return (code_point < direct_size) ? direct_values[code_point] : find_value(code_point);
+}
+
+/// \\param value The properties of a code point
+/// \\return The value of `bidi_class` of the code point
+constexpr auto bidi_class_of(std::uint8_t value) noexcept -> int {
+  return static_cast<int>(value & ((1u << class_bits) - 1));
+}
+
+/// \\param value The properties of a code point
+/// \\return The value of `joining_type` of the code point
+constexpr auto joining_type_of(std::uint8_t value) noexcept -> int {
+  return static_cast<int>(value >> class_bits);
+}
+
+/// \\param code_point A code point value
+/// \\return `true` if the canonical combining class of the code point is Virama
+constexpr auto is_virama(char32_t code_point) noexcept -> bool {
+  return std::binary_search(viramas.begin(), viramas.end(), code_point);
+}
+}  // namespace skyr::bidi_data
+
+#endif  // SKYR_DOMAIN_BIDI_TABLE_HPP
+""")
+
+        template.stream(
+            block_shift=table.block_shift,
+            class_bits=table.class_bits,
+            blocks=Table.array('std::uint8_t', table.blocks),
+            block_runs=Table.array('std::uint16_t', table.block_runs),
+            runs=Table.array('std::uint16_t', table.runs),
+            viramas=Table.array('char32_t', table.viramas, width=8, format=lambda value: "U'\\x%x'" % value),
+        ).dump(output_file)
+
+
+if __name__ == '__main__':
+    main()
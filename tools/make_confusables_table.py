@@ -0,0 +1,203 @@
+# Copyright 2018-20 Glyn Matthews.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# This script parses the confusables table from
+# https://unicode.org/Public/security/latest/confusables.txt,
+# and converts it to the C++ table of the skeletons of UTS #39:
+#
+#   python make_confusables_table.py confusables.txt ../include/skyr/domain/confusables_table.hpp
+#
+# The decompositions and the canonical combining classes come from the
+# `unicodedata` module, whose Unicode version should be that of the
+# confusables table.
+
+
+import sys
+import unicodedata
+import jinja2
+
+
+def parse_line(line):
+    line = line[0:line.find('#')] if '#' in line else line
+    tokens = [token.strip() for token in line.lstrip('\ufeff').split(';')] if line.strip() else []
+    if len(tokens) >= 2:
+        return int(tokens[0], 16), ''.join(chr(int(value, 16)) for value in tokens[1].split())
+    return None
+
+
+def is_hangul_syllable(code_point):
+    return 0xac00 <= code_point <= 0xd7a3
+
+
+class Table(object):
+    """A two-stage table of the mappings of code points.
+
+    The mapping of a code point which has a canonical decomposition is its
+    decomposition, and that of any other code point is the NFD of its
+    prototype, so that the skeleton of a string is found by decomposing
+    it, then mapping the decomposed code points to their prototypes, with
+    the combining marks put in canonical order after each step. The code
+    points are split into blocks of `1 << block_shift` values, and each
+    value of a block is the index of a mapping. Identical blocks are
+    stored once.
+
+    Index 0 means that the code point is its own prototype and a starter.
+    Combining marks always have an index, which holds their combining
+    class. Hangul syllables are decomposed by the algorithm instead.
+    """
+
+    block_shift = 7
+
+    def __init__(self, prototypes, max_code_point=0x10ffff):
+        keys = {}
+        self.mappings, self.offsets, self.classes = [], [0, 0], [0]
+        values = [0] * (max_code_point + 1)
+        for code_point in range(max_code_point + 1):
+            if (0xd800 <= code_point <= 0xdfff) or is_hangul_syllable(code_point):
+                continue
+            character = chr(code_point)
+            mapping = unicodedata.normalize('NFD', character)
+            is_decomposition = mapping != character
+            if not is_decomposition:
+                mapping = unicodedata.normalize('NFD', prototypes.get(code_point, character))
+                if (mapping == character) and (unicodedata.combining(character) == 0):
+                    continue
+            assert mapping
+            classes = unicodedata.combining(mapping[0]) | (unicodedata.combining(mapping[-1]) << 8) | \
+                (unicodedata.combining(character) << 16) | (int(is_decomposition) << 24)
+            key = (mapping, classes)
+            if key not in keys:
+                keys[key] = len(self.classes)
+                self.mappings.extend(mapping.encode('utf-8'))
+                self.offsets.append(len(self.mappings))
+                self.classes.append(classes)
+            values[code_point] = keys[key]
+
+        block_size = 1 << self.block_shift
+        block_indexes, self.blocks, self.block_values = {}, [], []
+        for first in range(0, len(values), block_size):
+            key = tuple(values[first:first + block_size])
+            if key not in block_indexes:
+                block_indexes[key] = len(block_indexes)
+                self.block_values.extend(key)
+            self.blocks.append(block_indexes[key])
+
+        # the runs of code points with the same combining class
+        self.combining_classes = []
+        for code_point in range(max_code_point + 1):
+            value = unicodedata.combining(chr(code_point))
+            if not self.combining_classes or (self.combining_classes[-1] & 0xff) != value:
+                self.combining_classes.append((code_point << 8) | value)
+
+        assert len(block_indexes) <= 0x100
+        assert len(self.classes) <= 0x10000
+        assert len(self.mappings) <= 0x10000
+
+    @staticmethod
+    def array(type, values, width=16):
+        rows = [', '.join(str(value) for value in values[i:i + width]) for i in range(0, len(values), width)]
+        return 'std::array<%s, %d>{\n%s\n}' % (type, len(values), '\n'.join('  %s,' % row for row in rows))
+
+
+def main():
+    input, output = sys.argv[1], sys.argv[2]
+
+    with open(input, 'r', encoding='utf-8') as input_file:
+        prototypes = dict(filter(None, (parse_line(line) for line in input_file.readlines())))
+
+    table = Table(prototypes)
+
+    with open(output, 'w+') as output_file:
+        template = jinja2.Template(
+            """// Auto-generated by tools/make_confusables_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
+#define SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// The table of the prototypes of confusable code points of UTS #39
+///
+/// The mapping of a code point which has a canonical decomposition is its
+/// decomposition, and that of any other code point is the NFD of its
+/// prototype. The skeleton of a string is found by decomposing it, then
+/// mapping the decomposed code points, with the combining marks put in
+/// canonical order after each step. Hangul syllables are not in the table,
+/// and are decomposed by the algorithm.
+namespace skyr::confusables_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = {{ block_shift }};
+
+/// The index of the values of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = {{ blocks }};
+
+/// The index of the mapping of each code point of each block, or 0 when the
+/// code point is its own prototype and a starter
+inline constexpr auto block_values = {{ block_values }};
+
+/// The first octet of each mapping, then the number of octets
+inline constexpr auto mapping_offsets = {{ mapping_offsets }};
+
+/// The combining classes of the first and the last code point of each
+/// mapping and of the mapped code point, and whether the mapping is a
+/// decomposition, packed as `first | (last << 8) | (source << 16) | (is_decomposition << 24)`
+inline constexpr auto mapping_classes = {{ mapping_classes }};
+
+/// The UTF-8 encoded mappings
+inline constexpr auto mappings = {{ mappings }};
+
+/// The runs of code points with the same canonical combining class, each
+/// packed as `(first << 8) | combining_class`
+inline constexpr auto combining_classes = {{ combining_classes }};
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The index of the mapping of the code point
+constexpr auto mapping_of(char32_t code_point) noexcept -> std::size_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = std::size_t(blocks[code_point >> block_shift]);
+  return block_values[(block << block_shift) | (static_cast<std::uint32_t>(code_point) & block_mask)];
+}
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The canonical combining class of the code point
+constexpr auto combining_class_of(char32_t code_point) noexcept -> int {
+  auto key = static_cast<std::uint32_t>(code_point) << 8;
+  auto first = std::size_t(0), last = combining_classes.size();
+
+  // the first run starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((combining_classes[middle] & ~std::uint32_t(0xff)) <= key) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return static_cast<int>(combining_classes[first] & 0xff);
+}
+}  // namespace skyr::confusables_data
+
+#endif  // SKYR_DOMAIN_CONFUSABLES_TABLE_HPP
+""")
+
+        template.stream(
+            block_shift=table.block_shift,
+            blocks=Table.array('std::uint8_t', table.blocks),
+            block_values=Table.array('std::uint16_t', table.block_values),
+            mapping_offsets=Table.array('std::uint16_t', table.offsets),
+            mapping_classes=Table.array('std::uint32_t', table.classes),
+            mappings=Table.array('std::uint8_t', table.mappings),
+            combining_classes=Table.array('std::uint32_t', table.combining_classes),
+        ).dump(output_file)
+
+
+if __name__ == '__main__':
+    main()
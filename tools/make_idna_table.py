@@ -0,0 +1,228 @@
+# Copyright 2018-20 Glyn Matthews.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# This script parses the IDNA table from
+# https://unicode.org/Public/idna/11.0.0/IdnaMappingTable.txt,
+# and converts it to the C++ table shared by skyr v1 and v2:
+#
+#   python make_idna_table.py IdnaMappingTable.txt ../include/skyr/domain/idna_table.hpp
+
+
+import sys
+import jinja2
+
+
+def parse_line(line):
+    line = line[0:line.find('#')]
+    tokens = [token.strip() for token in line.split(';')] if line else []
+    if len(tokens) == 3:
+        tokens[2] = tokens[2].split(' ')[0]
+    return tokens
+
+
+# The values of idna_status in skyr v1 and v2
+status_values = {
+    'disallowed': 1,
+    'disallowed_STD3_valid': 2,
+    'disallowed_STD3_mapped': 3,
+    'ignored': 4,
+    'mapped': 5,
+    'deviation': 6,
+    'valid': 7,
+    }
+
+
+class CodePointRange(object):
+
+    def __init__(self, range, status, mapped):
+        if type(range) == str:
+            range = range.split('..') if '..' in range else [range, range]
+        if type(range[0]) == str:
+            range = [int(range[0], 16), int(range[1], 16)]
+        self.range = range
+        self.status = status
+        self.mapped = int(mapped, 16) if mapped else None
+
+    @property
+    def is_mapped(self):
+        return self.status in ('mapped', 'disallowed_STD3_mapped')
+
+    @property
+    def is_valid(self):
+        return self.status == 'valid'
+
+
+class Table(object):
+    """A run-length table of code point properties.
+
+    Each code point has a status and the difference between its mapped
+    value and itself. The code points are split into blocks of
+    `1 << block_shift` values, and each block is a list of runs of code
+    points with the same properties. A run is packed in 32 bits: its
+    first code point relative to the block, the status, and the offset
+    plus a bias. The runs of identical blocks are stored once.
+    """
+
+    block_shift = 7
+    status_bits = 3
+    offset_bias = 1 << 21
+
+    def __init__(self, code_points, max_code_point=0x10ffff):
+        values = [(status_values['valid'], 0)] * (max_code_point + 1)
+        for code_point in code_points:
+            if code_point.is_valid:
+                continue
+            for value in range(code_point.range[0], code_point.range[1] + 1):
+                offset = code_point.mapped - value if code_point.is_mapped and code_point.mapped is not None else 0
+                values[value] = (status_values[code_point.status], offset)
+
+        block_size = 1 << self.block_shift
+        block_indexes, self.blocks, self.block_runs, self.runs = {}, [], [], []
+        for first in range(0, len(values), block_size):
+            runs = []
+            for value in range(first, first + block_size):
+                if not runs or runs[-1][1] != values[value]:
+                    runs.append((value - first, values[value]))
+            key = tuple(runs)
+            if key not in block_indexes:
+                block_indexes[key] = len(self.block_runs)
+                self.block_runs.append(len(self.runs))
+                self.runs.extend(self.pack(start, status, offset) for start, (status, offset) in runs)
+            self.blocks.append(block_indexes[key])
+        self.block_runs.append(len(self.runs))
+
+        assert len(self.block_runs) <= 0x100
+        assert len(self.runs) <= 0x10000
+
+    def pack(self, start, status, offset):
+        assert -self.offset_bias <= offset < self.offset_bias
+        return start | (status << self.block_shift) | \
+            ((offset + self.offset_bias) << (self.block_shift + self.status_bits))
+
+    @staticmethod
+    def array(type, values, width=16):
+        rows = [', '.join(str(value) for value in values[i:i + width]) for i in range(0, len(values), width)]
+        return 'std::array<%s, %d>{\n%s\n}' % (type, len(values), '\n'.join('  %s,' % row for row in rows))
+
+
+def main():
+    input, output = sys.argv[1], sys.argv[2]
+
+    with open(input, 'r') as input_file, open(output, 'w+') as output_file:
+        code_points = []
+        for line in input_file.readlines():
+            code_point = parse_line(line)
+            if code_point:
+                code_points.append(CodePointRange(
+                    code_point[0], code_point[1], code_point[2] if len(code_point) > 2 else None))
+
+        table = Table(code_points)
+
+        template = jinja2.Template(
+            """// Auto-generated by tools/make_idna_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_IDNA_TABLE_HPP
+#define SKYR_DOMAIN_IDNA_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// The IDNA mapping table shared by skyr v1 and v2
+///
+/// The variables are `inline`, so a program which uses both
+/// versions of the library holds one copy of the table.
+namespace skyr::idna_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = {{ block_shift }};
+
+/// The number of bits of the status of a run
+inline constexpr auto status_bits = {{ status_bits }};
+
+/// The bias added to the offset of a run
+inline constexpr auto offset_bias = std::int32_t({{ offset_bias }});
+
+/// The index of the runs of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = {{ blocks }};
+
+/// The first run of the runs of each block index, then the number of runs
+inline constexpr auto block_runs = {{ block_runs }};
+
+/// The runs of code points with the same properties, each packed as
+/// `first | (status << block_shift) | ((offset + offset_bias) << (block_shift + status_bits))`
+inline constexpr auto runs = {{ runs }};
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The packed run of the code point
+constexpr auto find_run(char32_t code_point) noexcept -> std::uint32_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = blocks[code_point >> block_shift];
+  auto first = std::size_t(block_runs[block]), last = std::size_t(block_runs[block + 1]);
+  auto low = static_cast<std::uint32_t>(code_point) & block_mask;
+
+  // the first run of a block starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((runs[middle] & block_mask) <= low) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return runs[first];
+}
+
+/// The code points below `direct_size` are looked up with one load
+inline constexpr auto direct_size = std::size_t(0x800);
+
+constexpr auto make_direct_runs() noexcept {
+  auto table = std::array<std::uint32_t, direct_size>{};
+  for (auto i = std::size_t(0); i < direct_size; ++i) {
+    table[i] = find_run(static_cast<char32_t>(i));
+  }
+  return table;
+}
+
+/// The packed run of each code point below `direct_size`
+inline constexpr auto direct_runs = make_direct_runs();
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The packed run of the code point
+constexpr auto run_of(char32_t code_point) noexcept -> std::uint32_t {
+  return (code_point < direct_size) ? direct_runs[code_point] : find_run(code_point);
+}
+
+/// \\param run A packed run
+/// \\return The value of `idna_status` of the run
+constexpr auto status_of(std::uint32_t run) noexcept -> int {
+  return static_cast<int>((run >> block_shift) & ((std::uint32_t(1) << status_bits) - 1));
+}
+
+/// \\param run A packed run
+/// \\return The difference between the mapped value and the code point
+constexpr auto offset_of(std::uint32_t run) noexcept -> std::int32_t {
+  return static_cast<std::int32_t>(run >> (block_shift + status_bits)) - offset_bias;
+}
+}  // namespace skyr::idna_data
+
+#endif  // SKYR_DOMAIN_IDNA_TABLE_HPP
+""")
+
+        template.stream(
+            block_shift=table.block_shift,
+            status_bits=table.status_bits,
+            offset_bias=table.offset_bias,
+            blocks=Table.array('std::uint8_t', table.blocks),
+            block_runs=Table.array('std::uint16_t', table.block_runs),
+            runs=Table.array('std::uint32_t', table.runs),
+        ).dump(output_file)
+
+
+if __name__ == '__main__':
+    main()
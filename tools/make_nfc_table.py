@@ -0,0 +1,315 @@
+# Copyright 2023 Glyn Matthews.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# This script parses the canonical decompositions, the Canonical_Combining_Class,
+# NFC_Quick_Check and Full_Composition_Exclusion properties from the Unicode
+# Character Database,
+#
+#   https://unicode.org/Public/14.0.0/ucd/UnicodeData.txt
+#   https://unicode.org/Public/14.0.0/ucd/DerivedNormalizationProps.txt
+#
+# and converts them to the C++ table used by the NFC normalization of IDNA
+# processing (UTS #46):
+#
+#   python make_nfc_table.py UnicodeData.txt DerivedNormalizationProps.txt \
+#       ../include/skyr/domain/nfc_table.hpp
+
+
+import sys
+import jinja2
+
+
+def parse_unicode_data(filename):
+    """Return the canonical combining classes and the canonical decompositions."""
+    combining_classes, decompositions = {}, {}
+    with open(filename, 'r') as input_file:
+        for line in input_file.readlines():
+            tokens = line.split(';')
+            if len(tokens) < 6:
+                continue
+            code_point = int(tokens[0], 16)
+            if int(tokens[3]) != 0:
+                combining_classes[code_point] = int(tokens[3])
+            # compatibility decompositions start with a tag
+            if tokens[5] and not tokens[5].startswith('<'):
+                decompositions[code_point] = [int(value, 16) for value in tokens[5].split(' ')]
+    return combining_classes, decompositions
+
+
+def parse_normalization_props(filename):
+    """Return the code points with NFC_QC=N, those with NFC_QC=M, and the
+    Full_Composition_Exclusion code points."""
+    quick_check_no, quick_check_maybe, exclusions = set(), set(), set()
+    with open(filename, 'r') as input_file:
+        for line in input_file.readlines():
+            line = line[0:line.find('#')] if '#' in line else line
+            tokens = [token.strip() for token in line.split(';')] if line.strip() else []
+            if len(tokens) < 2:
+                continue
+            first, last = tokens[0].split('..') if '..' in tokens[0] else (tokens[0], tokens[0])
+            code_points = range(int(first, 16), int(last, 16) + 1)
+            if tokens[1] == 'NFC_QC' and tokens[2] == 'N':
+                quick_check_no.update(code_points)
+            elif tokens[1] == 'NFC_QC' and tokens[2] == 'M':
+                quick_check_maybe.update(code_points)
+            elif tokens[1] == 'Full_Composition_Exclusion':
+                exclusions.update(code_points)
+    return quick_check_no, quick_check_maybe, exclusions
+
+
+# The values of nfc_quick_check in skyr v2
+quick_check_values = {'Y': 0, 'N': 1, 'M': 2}
+
+
+class Table(object):
+    """A run-length table of the normalization properties of code points.
+
+    Each code point has a canonical combining class and an NFC quick check
+    value, packed in a byte: the index of the class in `combining_classes`,
+    then the quick check value. The code points are split into blocks of
+    `1 << block_shift` values, and each block is a list of runs of code
+    points with the same properties, as in the Bidi table.
+
+    The decompositions are full, so that a code point is decomposed with
+    one lookup. The Hangul syllables are decomposed and composed
+    arithmetically, and are not in the tables.
+    """
+
+    block_shift = 7
+    class_bits = 6
+
+    def __init__(self, combining_classes, decompositions, quick_check_no, quick_check_maybe, exclusions,
+                 max_code_point=0x10ffff):
+        self.combining_classes = [0] + sorted(set(combining_classes.values()))
+        assert len(self.combining_classes) <= (1 << self.class_bits)
+
+        values = [0] * (max_code_point + 1)
+        for code_point, value in combining_classes.items():
+            values[code_point] = self.combining_classes.index(value)
+        for code_point in quick_check_no:
+            values[code_point] |= quick_check_values['N'] << self.class_bits
+        for code_point in quick_check_maybe:
+            values[code_point] |= quick_check_values['M'] << self.class_bits
+
+        # below this code point, every value is 0, so the quick check
+        # needs no lookup
+        self.first_value = next(code_point for code_point, value in enumerate(values) if value != 0)
+
+        block_size = 1 << self.block_shift
+        block_indexes, self.blocks, self.block_runs, self.runs = {}, [], [], []
+        for first in range(0, len(values), block_size):
+            runs = []
+            for value in range(first, first + block_size):
+                if not runs or runs[-1][1] != values[value]:
+                    runs.append((value - first, values[value]))
+            key = tuple(runs)
+            if key not in block_indexes:
+                block_indexes[key] = len(self.block_runs)
+                self.block_runs.append(len(self.runs))
+                self.runs.extend(start | (value << self.block_shift) for start, value in runs)
+            self.blocks.append(block_indexes[key])
+        self.block_runs.append(len(self.runs))
+
+        def decompose(code_point):
+            if code_point not in decompositions:
+                return [code_point]
+            return [value for part in decompositions[code_point] for value in decompose(part)]
+
+        self.decomposed, self.decomposition_offsets, self.decomposition_data = [], [], []
+        for code_point in sorted(decompositions):
+            self.decomposed.append(code_point)
+            self.decomposition_offsets.append(len(self.decomposition_data))
+            self.decomposition_data.extend(decompose(code_point))
+        self.decomposition_offsets.append(len(self.decomposition_data))
+
+        # the primary composites, keyed by the pair which they compose
+        pairs = sorted(
+            ((decomposition[0] << 21) | decomposition[1], code_point)
+            for code_point, decomposition in decompositions.items()
+            if len(decomposition) == 2 and code_point not in exclusions)
+        self.composition_keys = [key for key, _ in pairs]
+        self.composites = [code_point for _, code_point in pairs]
+
+        assert len(self.block_runs) <= 0x100
+        assert len(self.runs) <= 0x10000
+        assert max(self.runs) < 0x10000
+        assert len(self.decomposition_data) < 0x10000
+
+    @staticmethod
+    def array(type, values, width=16, format=str):
+        rows = [', '.join(format(value) for value in values[i:i + width]) for i in range(0, len(values), width)]
+        return 'std::array<%s, %d>{\n%s\n}' % (type, len(values), '\n'.join('  %s,' % row for row in rows))
+
+
+def main():
+    unicode_data_input, normalization_props_input, output = sys.argv[1], sys.argv[2], sys.argv[3]
+
+    combining_classes, decompositions = parse_unicode_data(unicode_data_input)
+    table = Table(combining_classes, decompositions, *parse_normalization_props(normalization_props_input))
+
+    code_point = lambda value: "U'\\x%x'" % value
+
+    with open(output, 'w+') as output_file:
+        template = jinja2.Template(
+            """// Auto-generated by tools/make_nfc_table.py.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_NFC_TABLE_HPP
+#define SKYR_DOMAIN_NFC_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/// The normalization table of the NFC step of IDNA processing
+///
+/// The variables are `inline`, as those of the IDNA mapping table.
+namespace skyr::nfc_data {
+/// Code points are looked up in blocks of `1 << block_shift` values
+inline constexpr auto block_shift = {{ block_shift }};
+
+/// The number of bits of the combining class index of a value
+inline constexpr auto class_bits = {{ class_bits }};
+
+/// Every code point below this one has a canonical combining class of 0
+/// and an NFC_Quick_Check value of Yes
+inline constexpr auto first_value = {{ first_value }};
+
+/// The canonical combining classes, indexed by the values of the table
+inline constexpr auto combining_classes = {{ combining_classes }};
+
+/// The index of the runs of a block, indexed by `code_point >> block_shift`
+inline constexpr auto blocks = {{ blocks }};
+
+/// The first run of the runs of each block index, then the number of runs
+inline constexpr auto block_runs = {{ block_runs }};
+
+/// The runs of code points with the same properties, each packed as
+/// `first | ((class_index | (quick_check << class_bits)) << block_shift)`
+inline constexpr auto runs = {{ runs }};
+
+/// The code points with a canonical decomposition, other than the Hangul
+/// syllables, in order
+inline constexpr auto decomposed = {{ decomposed }};
+
+/// The first code point of the full decomposition of each code point of
+/// `decomposed`, then the size of `decomposition_data`
+inline constexpr auto decomposition_offsets = {{ decomposition_offsets }};
+
+/// The full canonical decompositions
+inline constexpr auto decomposition_data = {{ decomposition_data }};
+
+/// The pairs which compose to a primary composite, other than the Hangul
+/// syllables, each packed as `(first << 21) | second`, in order
+inline constexpr auto composition_keys = {{ composition_keys }};
+
+/// The primary composite of each pair of `composition_keys`
+inline constexpr auto composites = {{ composites }};
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The properties of the code point
+constexpr auto find_value(char32_t code_point) noexcept -> std::uint8_t {
+  constexpr auto block_mask = (std::uint32_t(1) << block_shift) - 1;
+
+  auto block = blocks[code_point >> block_shift];
+  auto first = std::size_t(block_runs[block]), last = std::size_t(block_runs[block + 1]);
+  auto low = static_cast<std::uint32_t>(code_point) & block_mask;
+
+  // the first run of a block starts at 0
+  while ((last - first) > 1) {
+    auto middle = first + ((last - first) / 2);
+    if ((runs[middle] & block_mask) <= low) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+  return static_cast<std::uint8_t>(runs[first] >> block_shift);
+}
+
+/// The code points below `direct_size` are looked up with one load
+inline constexpr auto direct_size = std::size_t(0x800);
+
+constexpr auto make_direct_values() noexcept {
+  auto table = std::array<std::uint8_t, direct_size>{};
+  for (auto i = std::size_t(0); i < direct_size; ++i) {
+    table[i] = find_value(static_cast<char32_t>(i));
+  }
+  return table;
+}
+
+/// The properties of each code point below `direct_size`
+inline constexpr auto direct_values = make_direct_values();
+
+/// \\param code_point A code point value, no greater than U+10FFFF
+/// \\return The properties of the code point
+constexpr auto value_of(char32_t code_point) noexcept -> std::uint8_t {
+  return (code_point < direct_size) ? direct_values[code_point] : find_value(code_point);
+}
+
+/// \\param value The properties of a code point
+/// \\return The canonical combining class of the code point
+constexpr auto combining_class_of(std::uint8_t value) noexcept -> std::uint8_t {
+  return combining_classes[value & ((1u << class_bits) - 1)];
+}
+
+/// \\param value The properties of a code point
+/// \\return The value of `nfc_quick_check` of the code point
+constexpr auto quick_check_of(std::uint8_t value) noexcept -> int {
+  return static_cast<int>(value >> class_bits);
+}
+
+/// \\param code_point A code point value
+/// \\return The full canonical decomposition of the code point, as a pair
+///         of offsets in `decomposition_data`, which are equal if the code
+///         point has none
+constexpr auto decomposition_of(char32_t code_point) noexcept -> std::pair<std::size_t, std::size_t> {
+  auto it = std::lower_bound(decomposed.begin(), decomposed.end(), code_point);
+  if ((it == decomposed.end()) || (*it != code_point)) {
+    return {0, 0};
+  }
+  auto index = static_cast<std::size_t>(it - decomposed.begin());
+  return {decomposition_offsets[index], decomposition_offsets[index + 1]};
+}
+
+/// \\param first A code point value
+/// \\param second A code point value
+/// \\return The primary composite of the pair, or 0 if there is none
+constexpr auto composite_of(char32_t first, char32_t second) noexcept -> char32_t {
+  auto key = (std::uint64_t(first) << 21) | std::uint64_t(second);
+  auto it = std::lower_bound(composition_keys.begin(), composition_keys.end(), key);
+  if ((it == composition_keys.end()) || (*it != key)) {
+    return 0;
+  }
+  return composites[static_cast<std::size_t>(it - composition_keys.begin())];
+}
+}  // namespace skyr::nfc_data
+
+#endif  // SKYR_DOMAIN_NFC_TABLE_HPP
+""")
+
+        template.stream(
+            block_shift=table.block_shift,
+            class_bits=table.class_bits,
+            first_value=code_point(table.first_value),
+            combining_classes=Table.array('std::uint8_t', table.combining_classes),
+            blocks=Table.array('std::uint8_t', table.blocks),
+            block_runs=Table.array('std::uint16_t', table.block_runs),
+            runs=Table.array('std::uint16_t', table.runs),
+            decomposed=Table.array('char32_t', table.decomposed, width=8, format=code_point),
+            decomposition_offsets=Table.array('std::uint16_t', table.decomposition_offsets),
+            decomposition_data=Table.array('char32_t', table.decomposition_data, width=8, format=code_point),
+            composition_keys=Table.array('std::uint64_t', table.composition_keys, width=4,
+                                         format=lambda value: '0x%x' % value),
+            composites=Table.array('char32_t', table.composites, width=8, format=code_point),
+        ).dump(output_file)
+
+
+if __name__ == '__main__':
+    main()